@@ -24,12 +24,18 @@ EXPERIMENTS = {
             "transport_supplies_client_latency",
         ],
         "core_end2end_test": [
+            "chttp2_message_size_limits",
+            "chttp2_parallel_stream_recv",
+            "chttp2_transport_deadlines",
+            "combiner_offload_budget",
             "promise_based_client_call",
             "promise_based_server_call",
+            "tls_kernel_offload",
         ],
         "endpoint_test": [
             "tcp_frame_size_tuning",
             "tcp_rcv_lowat",
+            "tcp_rx_zerocopy",
         ],
         "event_engine_client_test": [
             "event_engine_client",
@@ -37,11 +43,17 @@ EXPERIMENTS = {
         "event_engine_listener_test": [
             "event_engine_listener",
         ],
+        "event_engine_timer_test": [
+            "event_engine_timer_wheel",
+        ],
         "flow_control_test": [
             "peer_state_based_framing",
             "tcp_frame_size_tuning",
             "tcp_rcv_lowat",
         ],
+        "hpack_test": [
+            "hpack_intern_cache",
+        ],
         "lame_client_test": [
             "promise_based_client_call",
         ],
@@ -0,0 +1,27 @@
+# Copyright 2023 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+if(TARGET lz4)
+  message(STATUS "Found lz4 via pkg-config already?")
+  return()
+endif()
+
+find_package(PkgConfig)
+pkg_check_modules(LZ4 liblz4)
+
+if(LZ4_FOUND)
+  set(lz4_FOUND "${LZ4_FOUND}")
+  add_library(lz4 INTERFACE IMPORTED)
+  message(STATUS "Found lz4 via pkg-config.")
+endif()
@@ -192,6 +192,16 @@ GRPCAPI void grpc_channel_watch_connectivity_state(
     grpc_channel* channel, grpc_connectivity_state last_observed_state,
     gpr_timespec deadline, grpc_completion_queue* cq, void* tag);
 
+/** EXPERIMENTAL.  Warm up a channel before sending it traffic.
+    Connects every backend the channel's load balancing policy knows of,
+    starting name resolution if needed, and once at least \a fraction (0 to 1)
+    of them are READY, enqueues tag on cq with success=1.
+    If deadline expires or the channel is shut down first, tag will be
+    enqueued on cq with success=0. */
+GRPCAPI void grpc_channel_watch_warm(grpc_channel* channel, double fraction,
+                                     gpr_timespec deadline,
+                                     grpc_completion_queue* cq, void* tag);
+
 /** Check whether a grpc channel supports connectivity watcher */
 GRPCAPI int grpc_channel_support_connectivity_watcher(grpc_channel* channel);
 
@@ -467,6 +467,23 @@ GRPCAPI grpc_call_credentials* grpc_metadata_credentials_create_from_plugin(
     grpc_metadata_credentials_plugin plugin,
     grpc_security_level min_security_level, void* reserved);
 
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Like grpc_metadata_credentials_create_from_plugin(), but declares that the
+ * metadata returned by the plugin for a given service_url and method_name
+ * stays valid for metadata_ttl. A channel using these credentials then reuses
+ * that metadata for later calls to the same authority and method until it
+ * expires, instead of invoking the plugin again. This is only applied when
+ * the credentials are set on the channel, not on individual calls. A zero
+ * metadata_ttl disables the caching.
+ */
+GRPCAPI grpc_call_credentials*
+grpc_metadata_credentials_create_from_plugin_with_metadata_ttl(
+    grpc_metadata_credentials_plugin plugin,
+    grpc_security_level min_security_level, gpr_timespec metadata_ttl,
+    void* reserved);
+
 /** Server certificate config object holds the server's public certificates and
    associated private keys, as well as any CA certificates needed for client
    certificate validation (if applicable). Create using
@@ -887,6 +904,155 @@ GRPCAPI void grpc_tls_credentials_options_set_cert_request_type(
 GRPCAPI void grpc_tls_credentials_options_set_crl_directory(
     grpc_tls_credentials_options* options, const char* crl_directory);
 
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * A struct that supplies the keys a TLS server encrypts and decrypts session
+ * tickets with. Servers given the same keys resume each other's sessions.
+ */
+typedef struct grpc_tls_session_ticket_key_provider
+    grpc_tls_session_ticket_key_provider;
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Creates a grpc_tls_session_ticket_key_provider holding the keys set with
+ * grpc_tls_session_ticket_key_provider_in_memory_set_keys. Until keys are
+ * set, servers using it issue no session tickets.
+ */
+GRPCAPI grpc_tls_session_ticket_key_provider*
+grpc_tls_session_ticket_key_provider_in_memory_create(void);
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Replaces the keys of a provider created with
+ * grpc_tls_session_ticket_key_provider_in_memory_create. |keys| holds 80 byte
+ * keys back to back, each made of a 16 byte key name, a 32 byte HMAC-SHA256
+ * key and a 32 byte AES-256 key, as in the session ticket key files of other
+ * TLS servers. The first key encrypts new tickets; the others only decrypt
+ * tickets issued before a key rotation. Servers already using the provider see
+ * the new keys right away.
+ * Returns 0, leaving the keys as they were, if |keys| is empty or not made of
+ * whole keys. It does not take ownership of |keys|.
+ */
+GRPCAPI int grpc_tls_session_ticket_key_provider_in_memory_set_keys(
+    grpc_tls_session_ticket_key_provider* provider, const char* keys,
+    size_t keys_size);
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Creates a grpc_tls_session_ticket_key_provider that reads the keys, in the
+ * format described for grpc_tls_session_ticket_key_provider_in_memory_set_keys,
+ * from the file at |key_file_path|, and reads the file again every
+ * |refresh_interval_sec| seconds. If reading the file fails, the keys read
+ * last are kept. It does not take ownership of parameters.
+ */
+GRPCAPI grpc_tls_session_ticket_key_provider*
+grpc_tls_session_ticket_key_provider_file_watcher_create(
+    const char* key_file_path, unsigned int refresh_interval_sec);
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Releases a grpc_tls_session_ticket_key_provider object. The creator of the
+ * grpc_tls_session_ticket_key_provider object is responsible for its release.
+ */
+GRPCAPI void grpc_tls_session_ticket_key_provider_release(
+    grpc_tls_session_ticket_key_provider* provider);
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Sets the provider of the keys that the server encrypts and decrypts session
+ * tickets with. This shall only be called on the server side. The options
+ * take a reference to |provider|.
+ */
+GRPCAPI void grpc_tls_credentials_options_set_session_ticket_key_provider(
+    grpc_tls_credentials_options* options,
+    grpc_tls_session_ticket_key_provider* provider);
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * A struct that signs the TLS handshakes of a server with a private key that
+ * is not in process memory, such as one kept in an HSM.
+ */
+typedef struct grpc_tls_private_key_signer grpc_tls_private_key_signer;
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * A callback function provided by gRPC as a parameter of the |sign| function
+ * in grpc_tls_private_key_signer_external. The implementer of |sign| invokes
+ * it with |callback_arg| once the signing is done. On success, |status| is
+ * GRPC_STATUS_OK and |signature| holds |signature_size| bytes, which gRPC
+ * copies. Otherwise, |error_details| may describe what went wrong, and the
+ * handshake fails.
+ */
+typedef void (*grpc_tls_on_private_key_sign_done_cb)(
+    void* callback_arg, grpc_status_code status, const char* error_details,
+    const unsigned char* signature, size_t signature_size);
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * A struct containing the functions a custom external private key signer
+ * needs to implement to be converted to a grpc_tls_private_key_signer.
+ */
+typedef struct grpc_tls_private_key_signer_external {
+  void* user_data;
+  /**
+   * Starts signing |data|, of |data_size| bytes, with |signature_algorithm|,
+   * a TLS SignatureScheme as listed in RFC 8446, section 4.2.3, such as
+   * 0x0804 for rsa_pss_rsae_sha256. |data| is not hashed yet: the signer
+   * hashes it as the algorithm says. The handshake waits, without blocking a
+   * thread, until |callback| is invoked with |callback_arg|, which must
+   * happen exactly once. It may happen on any thread, including this one
+   * before |sign| returns. |data| is only valid until |sign| returns.
+   */
+  void (*sign)(void* user_data, const unsigned char* data, size_t data_size,
+               uint16_t signature_algorithm,
+               grpc_tls_on_private_key_sign_done_cb callback,
+               void* callback_arg);
+  /**
+   * Called, if not NULL, once the signer is destroyed, to release |user_data|.
+   */
+  void (*destruct)(void* user_data);
+} grpc_tls_private_key_signer_external;
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Converts an external private key signer to a grpc_tls_private_key_signer.
+ * |external_signer| is copied, and may be freed once this returns.
+ */
+GRPCAPI grpc_tls_private_key_signer*
+grpc_tls_private_key_signer_external_create(
+    const grpc_tls_private_key_signer_external* external_signer);
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Releases a grpc_tls_private_key_signer object. The creator of the
+ * grpc_tls_private_key_signer object is responsible for its release.
+ */
+GRPCAPI void grpc_tls_private_key_signer_release(
+    grpc_tls_private_key_signer* signer);
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Sets the signer that signs the server's TLS handshakes, in place of the
+ * private keys of its identity key-cert pairs, which may then be empty. This
+ * shall only be called on the server side, and is only supported when gRPC
+ * is built with BoringSSL: otherwise the server fails to create its
+ * handshakers. The options take a reference to |signer|.
+ */
+GRPCAPI void grpc_tls_credentials_options_set_private_key_signer(
+    grpc_tls_credentials_options* options, grpc_tls_private_key_signer* signer);
+
 /**
  * EXPERIMENTAL API - Subject to change
  *
@@ -896,6 +1062,51 @@ GRPCAPI void grpc_tls_credentials_options_set_crl_directory(
 GRPCAPI void grpc_tls_credentials_options_set_verify_server_cert(
     grpc_tls_credentials_options* options, int verify_server_cert);
 
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Sets how many peers that passed the certificate verifier are remembered by
+ * the channels using these options. A new connection to a peer presenting the
+ * same leaf certificate for the same target, under the same root
+ * certificates, then skips the verifier. The chain is still verified, and
+ * CRLs still enforced, on every handshake. The default value is 0, which
+ * disables the cache. This shall only be called on the client side.
+ */
+GRPCAPI void grpc_tls_credentials_options_set_verified_peer_cache_size(
+    grpc_tls_credentials_options* options, size_t verified_peer_cache_size);
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Sets whether TLS 1.3 0-RTT early data is used. On the client side, what a
+ * connection resuming a session from the channel's session cache (see
+ * GRPC_SSL_SESSION_CACHE_ARG) writes first, such as its first RPCs, is sent
+ * without waiting for the handshake, which saves a round trip. Early data may
+ * be replayed by an attacker, so this shall only be set on channels all of
+ * whose RPCs are safe to be processed more than once. If the server rejects
+ * the early data, the connection fails, and the next one does a full
+ * handshake. On the server side, early data is accepted; see
+ * grpc_tls_credentials_options_set_early_data_anti_replay_capacity. The
+ * default value is 0. Only supported when gRPC is built with BoringSSL.
+ */
+GRPCAPI void grpc_tls_credentials_options_set_early_data(
+    grpc_tls_credentials_options* options, int enable_early_data);
+
+/**
+ * EXPERIMENTAL API - Subject to change
+ *
+ * Sets how many ClientHellos a server accepting early data remembers, so as
+ * to reject the early data of a ClientHello sent to it again within 60
+ * seconds, as a replay would be; older replays are rejected anyway. Once that
+ * many ClientHellos are remembered, new ones get their early data rejected
+ * until the oldest expire. Replays sent to other servers sharing the same
+ * session ticket keys are not detected. 0 disables replay detection. The
+ * default value is 10000. This shall only be called on the server side.
+ */
+GRPCAPI void grpc_tls_credentials_options_set_early_data_anti_replay_capacity(
+    grpc_tls_credentials_options* options,
+    size_t early_data_anti_replay_capacity);
+
 /**
  * EXPERIMENTAL API - Subject to change
  *
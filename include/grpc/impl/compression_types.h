@@ -61,6 +61,10 @@ typedef enum {
   GRPC_COMPRESS_NONE = 0,
   GRPC_COMPRESS_DEFLATE,
   GRPC_COMPRESS_GZIP,
+  /** Only available when gRPC is built with libzstd (HAVE_LIBZSTD). */
+  GRPC_COMPRESS_ZSTD,
+  /** Only available when gRPC is built with liblz4 (HAVE_LIBLZ4). */
+  GRPC_COMPRESS_LZ4,
   /* TODO(ctiller): snappy */
   GRPC_COMPRESS_ALGORITHMS_COUNT
 } grpc_compression_algorithm;
@@ -68,7 +72,8 @@ typedef enum {
 /** Compression levels allow a party with knowledge of its peer's accepted
  * encodings to request compression in an abstract way. The level-algorithm
  * mapping is performed internally and depends on the peer's supported
- * compression algorithms. */
+ * compression algorithms. The level is also mapped onto the chosen codec's own
+ * effort setting (e.g. zlib 1/6/9 for LOW/MED/HIGH). */
 typedef enum {
   GRPC_COMPRESS_LEVEL_NONE = 0,
   GRPC_COMPRESS_LEVEL_LOW,
@@ -144,6 +144,63 @@ typedef struct {
 /** If non-zero, call metric recording is enabled. */
 #define GRPC_ARG_SERVER_CALL_METRIC_RECORDING \
   "grpc.server_call_metric_recording"
+/** If non-zero, the server fails new calls with RESOURCE_EXHAUSTED while it
+    is overloaded: while incoming calls wait too long for the application to
+    request them, its memory quota is under high pressure, or its
+    EventEngine is slow to run callbacks. */
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL "grpc.server_admission_control"
+/** With GRPC_ARG_SERVER_ADMISSION_CONTROL, how long an incoming call may wait
+    for the application to request it before the server counts as
+    overloaded. Int valued, milliseconds. Defaults to 100. */
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL_MAX_QUEUE_DELAY_MS \
+  "grpc.server_admission_control.max_queue_delay_ms"
+/** With GRPC_ARG_SERVER_ADMISSION_CONTROL, how long the EventEngine may take
+    to run a callback before the server counts as overloaded. Int valued,
+    milliseconds. Defaults to 100. */
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL_MAX_EVENT_ENGINE_DELAY_MS \
+  "grpc.server_admission_control.max_event_engine_delay_ms"
+/** If non-zero, incoming calls waiting for the application to request them
+    are queued per tenant, and matched to requests by weighted round robin
+    across tenants rather than in arrival order, so that one tenant queueing
+    many calls does not hold up the calls of the others. */
+#define GRPC_ARG_SERVER_FAIR_QUEUING "grpc.server_fair_queuing"
+/** With GRPC_ARG_SERVER_FAIR_QUEUING, the initial metadata key whose value is
+    the tenant of a call. Calls without it make up one tenant. If unset, calls
+    are classified by method. String valued. */
+#define GRPC_ARG_SERVER_FAIR_QUEUING_TENANT_METADATA_KEY \
+  "grpc.server_fair_queuing.tenant_metadata_key"
+/** With GRPC_ARG_SERVER_FAIR_QUEUING, the weights of tenants, as a comma
+    separated list of tenant=weight, such as "gold=4,silver=2". A tenant with
+    weight N gets N of its calls matched per round. Tenants not listed have
+    weight 1. String valued. */
+#define GRPC_ARG_SERVER_FAIR_QUEUING_TENANT_WEIGHTS \
+  "grpc.server_fair_queuing.tenant_weights"
+/** With GRPC_ARG_SERVER_FAIR_QUEUING, how many calls of one tenant may be in
+    flight, queued ones included. Further calls of the tenant fail with
+    RESOURCE_EXHAUSTED before reaching the application. Int valued. Defaults
+    to 0, which means no limit. */
+#define GRPC_ARG_SERVER_FAIR_QUEUING_MAX_CONCURRENT_CALLS_PER_TENANT \
+  "grpc.server_fair_queuing.max_concurrent_calls_per_tenant"
+/** If set, a server whose load is above this percentage of its capacity
+    sends graceful GOAWAYs to some of its oldest connections, so that their
+    clients reconnect and spread over the other servers. The load is the
+    highest of the utilization reported through the server's ORCA metric
+    recorder, if any, and the calls in flight relative to
+    GRPC_ARG_SERVER_CONNECTION_REBALANCING_MAX_CALLS. Shed connections get
+    GRPC_ARG_SERVER_CONFIG_CHANGE_DRAIN_GRACE_TIME_MS to finish their calls.
+    Int valued. Defaults to 0, which disables rebalancing. */
+#define GRPC_ARG_SERVER_CONNECTION_REBALANCING_LOAD_THRESHOLD_PERCENT \
+  "grpc.server_connection_rebalancing.load_threshold_percent"
+/** With GRPC_ARG_SERVER_CONNECTION_REBALANCING_LOAD_THRESHOLD_PERCENT, how
+    many GOAWAYs the server sends per second at most, over all of its
+    listeners. Int valued. Defaults to 1. */
+#define GRPC_ARG_SERVER_CONNECTION_REBALANCING_MAX_GOAWAYS_PER_SECOND \
+  "grpc.server_connection_rebalancing.max_goaways_per_second"
+/** With GRPC_ARG_SERVER_CONNECTION_REBALANCING_LOAD_THRESHOLD_PERCENT, how
+    many calls in flight make up the full capacity of the server. Int valued.
+    Defaults to 0, which leaves calls in flight out of the load. */
+#define GRPC_ARG_SERVER_CONNECTION_REBALANCING_MAX_CALLS \
+  "grpc.server_connection_rebalancing.max_calls"
 /** Request that optional features default to off (regardless of what they
     usually default to) - to enable tight control over what gets enabled */
 #define GRPC_ARG_MINIMAL_STACK "grpc.minimal_stack"
@@ -181,6 +238,20 @@ typedef struct {
    application will see the compressed message in the byte buffer. */
 #define GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION \
   "grpc.per_message_decompression"
+/** Experimental Arg. Messages of at least this many bytes are compressed and
+   decompressed on the EventEngine's thread pool rather than inline on the
+   call's transport path, so that they do not hold up other streams. Int
+   valued, bytes. Defaults to 0, meaning all messages are processed inline. */
+#define GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD \
+  "grpc.experimental.compression_offload_threshold"
+/** Experimental Arg. If non-zero, a server that sends deflate-compressed
+   messages may compress all of a stream's messages with one deflate
+   context, so that each message is compressed against those before it.
+   Streams of similar messages then compress much better. Clients offer this
+   and servers use it only if both set this arg. It costs the server about
+   256 KiB of deflate state for each stream that uses it. Defaults to 0. */
+#define GRPC_ARG_ENABLE_STREAM_COMPRESSION \
+  "grpc.experimental.stream_compression"
 /** Enable/disable support for deadline checking. Defaults to 1, unless
     GRPC_ARG_MINIMAL_STACK is enabled, in which case it defaults to 0 */
 #define GRPC_ARG_ENABLE_DEADLINE_CHECKS "grpc.enable_deadline_checking"
@@ -204,6 +275,12 @@ typedef struct {
 #define GRPC_ARG_HTTP2_MAX_FRAME_SIZE "grpc.http2.max_frame_size"
 /** Should BDP probing be performed? */
 #define GRPC_ARG_HTTP2_BDP_PROBE "grpc.http2.bdp_probe"
+/** If set, client transports remember the BDP they measure for each peer
+    address, start new connections to that address from the remembered
+    value, and size their windows for the BDP estimate as soon as it changes
+    rather than ramping towards it. Still backs off under memory pressure.
+    Requires BDP probing. Boolean, defaults to false. */
+#define GRPC_ARG_HTTP2_BDP_HISTORY "grpc.http2.bdp_history"
 /** (DEPRECATED) Does not have any effect.
     Earlier, this arg configured the minimum time between successive ping frames
     without receiving any data/header frame, Int valued, milliseconds. This put
@@ -234,6 +311,28 @@ typedef struct {
 /** How much data are we willing to queue up per stream if
     GRPC_WRITE_BUFFER_HINT is set? This is an upper bound */
 #define GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE "grpc.http2.write_buffer_size"
+/** How long may an http2 transport hold back a small write so that frames
+    flushed shortly after it (eg for other streams) go out in the same
+    sendmsg? Zero (the default) disables write coalescing. Int valued,
+    microseconds. */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_BUDGET_US \
+  "grpc.http2.write_coalescing_budget_us"
+/** Writes of at least this many bytes are never held back for coalescing, and
+    a held back write is started as soon as it reaches this size. Only used if
+    GRPC_ARG_HTTP2_WRITE_COALESCING_BUDGET_US is set. Int valued, bytes.
+    Defaults to 16KiB. */
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_BYTES \
+  "grpc.http2.write_coalescing_bytes"
+/** How an http2 transport shares the connection between streams with data to
+    send. "fifo" (the default) lets each stream send all that flow control
+    allows before moving on to the next. "round_robin" lets each stream send
+    at most one frame's worth of data per turn, so that a bulk stream cannot
+    hold up small messages behind it. "weighted_fair" is deficit round robin:
+    like "round_robin", but each turn a stream may send as many frames' worth
+    as its weight (the grpc-write-weight metadata it was started with, or the
+    writeWeight of its method's service config; 1 if neither is set). String
+    valued. */
+#define GRPC_ARG_HTTP2_WRITE_SCHEDULER "grpc.http2.write_scheduler"
 /** Should we allow receipt of true-binary data on http2 connections?
     Defaults to on (1) */
 #define GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY "grpc.http2.true_binary"
@@ -271,9 +370,60 @@ typedef struct {
 /** The time between the first and second connection attempts, in ms */
 #define GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS \
   "grpc.initial_reconnect_backoff_ms"
+/** The most connections a subchannel may open to its address. When more than
+    one, a subchannel whose connections are all using as many streams as the
+    peer's MAX_CONCURRENT_STREAMS allows opens another, spreads new calls
+    across them, and closes extra connections once they go idle. Int valued,
+    defaults to 1. */
+#define GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS \
+  "grpc.experimental.subchannel_max_connections"
+/** How long an extra subchannel connection (see
+    GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS) may go without calls before it is
+    closed, in ms. Defaults to 30 seconds. */
+#define GRPC_ARG_SUBCHANNEL_EXTRA_CONNECTION_IDLE_TIMEOUT_MS \
+  "grpc.experimental.subchannel_extra_connection_idle_timeout_ms"
+/** How many extra subchannel connections (see
+    GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS) to keep open as warm standbys, even
+    when idle. When the primary connection receives a GOAWAY, a standby takes
+    its place while it drains; without one, the subchannel reconnects right
+    away rather than waiting for the next call. Raises the maximum number of
+    connections to at least one more than this. Int valued, defaults to 0. */
+#define GRPC_ARG_SUBCHANNEL_WARM_STANDBY_CONNECTIONS \
+  "grpc.experimental.subchannel_warm_standby_connections"
+/** The most connection attempts, handshakes included, that subchannels in
+    this process may have in progress to one address at a time. Further
+    attempts wait their turn, those for channels with queued calls first.
+    Int valued, defaults to 0, which sets no limit. */
+#define GRPC_ARG_MAX_CONCURRENT_CONNECTS_PER_ADDRESS \
+  "grpc.experimental.max_concurrent_connects_per_address"
+/** If non-zero, subchannels pick each reconnect backoff at random between
+    the initial backoff and three times the previous one, up to the maximum
+    backoff ("decorrelated jitter"), so that clients that lost a backend
+    together do not keep retrying in lockstep. Defaults to 0. */
+#define GRPC_ARG_DECORRELATED_RECONNECT_JITTER \
+  "grpc.experimental.decorrelated_reconnect_jitter"
+/** While a weighted_target policy is READY, new pickers from its children
+    are combined and reported at most once per this many ms, so that
+    connectivity flapping across many localities does not make the channel
+    re-pick its queued calls over and over. Int valued, defaults to 0, which
+    reports every change right away. */
+#define GRPC_ARG_LB_PICKER_UPDATE_COALESCING_WINDOW_MS \
+  "grpc.experimental.lb_picker_update_coalescing_window_ms"
+/** If set, pick_first races connection attempts as described in RFC 8305
+    ("Happy Eyeballs"): addresses are interleaved by family, and if an attempt
+    has neither succeeded nor failed after this many ms, the next address is
+    tried in parallel. The first to connect is used. Int valued, RFC 8305
+    recommends 250. Defaults to 0, which tries addresses one at a time. */
+#define GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS \
+  "grpc.experimental.happy_eyeballs_connection_attempt_delay_ms"
 /** Minimum amount of time between DNS resolutions, in ms */
 #define GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS \
   "grpc.dns_min_time_between_resolutions_ms"
+/** Maximum age, in ms, of a result in the process-wide DNS result cache
+    that a DNS resolution may use instead of querying DNS again.  Concurrent
+    resolutions of the same name from different channels always share one
+    query.  Defaults to 0 (cached results are not used). */
+#define GRPC_ARG_DNS_CACHE_MAX_AGE_MS "grpc.dns_cache_max_age_ms"
 /** The timeout used on servers for finishing handshaking on an incoming
     connection.  Defaults to 120 seconds. */
 #define GRPC_ARG_SERVER_HANDSHAKE_TIMEOUT_MS "grpc.server_handshake_timeout_ms"
@@ -293,11 +443,29 @@ typedef struct {
  *  protector.
  */
 #define GRPC_ARG_TSI_MAX_FRAME_SIZE "grpc.tsi.max_frame_size"
+/** If non-zero, the steps of TSI handshakes, which include private key
+    operations and certificate verification, run on a dedicated, bounded pool
+    of threads rather than on the thread that read the handshake data, so
+    that a burst of new connections does not hold up established ones. Steps
+    of handshakes already under way and of TLS handshakes resuming a session
+    run first; new full handshakes are failed when too many steps are
+    waiting. */
+#define GRPC_ARG_HANDSHAKE_EXECUTOR "grpc.handshake_executor"
+/** With GRPC_ARG_HANDSHAKE_EXECUTOR, how many handshake steps may wait for
+    the pool before new handshakes are failed. Int valued. Defaults to 256. */
+#define GRPC_ARG_HANDSHAKE_EXECUTOR_MAX_QUEUED \
+  "grpc.handshake_executor.max_queued"
 /** Maximum metadata size, in bytes. Note this limit applies to the max sum of
     all metadata key-value entries in a batch of headers. */
 #define GRPC_ARG_MAX_METADATA_SIZE "grpc.max_metadata_size"
 /** If non-zero, allow the use of SO_REUSEPORT if it's available (default 1) */
 #define GRPC_ARG_ALLOW_REUSEPORT "grpc.so_reuseport"
+/** Number of listening sockets a server opens for each of its ports when
+    SO_REUSEPORT is in use, so that the kernel spreads incoming connections
+    across them. Each socket is steered to a different CPU with
+    SO_INCOMING_CPU where supported. Defaults to one per pollset for the iomgr
+    TCP server, and to 1 for the EventEngine listener. */
+#define GRPC_ARG_TCP_LISTENERS_PER_PORT "grpc.tcp_listeners_per_port"
 /** If non-zero, a pointer to a buffer pool (a pointer of type
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable) */
@@ -359,6 +527,26 @@ typedef struct {
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* If positive, sets TCP_NOTSENT_LOWAT to this many bytes on TCP sockets, so
+   that the kernel takes no more than that ahead of what it has sent, and the
+   HTTP/2 transport sizes its writes to match. Frames queued later, such as
+   those of small RPCs, then do not wait behind megabytes of bulk data in the
+   socket send buffer. By default, it is unset. */
+#define GRPC_ARG_TCP_NOTSENT_LOWAT "grpc.experimental.tcp_notsent_lowat"
+/* If non-zero, sets TCP_FASTOPEN_CONNECT on client TCP sockets where the
+   platform supports it. connect() then completes at once when the kernel
+   holds a Fast Open cookie for the server, and the first bytes the client
+   writes (the TLS ClientHello or the HTTP/2 preface) go out in the SYN,
+   saving a round trip per connection to servers that enable Fast Open.
+   By default, it is off. */
+#define GRPC_ARG_TCP_FAST_OPEN_CONNECT "grpc.experimental.tcp_fast_open_connect"
+/* If non-zero, the HTTP/2 transport has the kernel timestamp the writes of
+   each stream (SO_TIMESTAMPING, Linux only) and reports when the stream's
+   latest ACKed write left the host and when the peer ACKed it, with the
+   other transport timings of the call attempt, to its call tracer. This
+   tells time spent on the network apart from time spent in the processes at
+   either end. By default, it is off. */
+#define GRPC_ARG_TCP_WRITE_TIMESTAMPS "grpc.experimental.tcp_write_timestamps"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
@@ -404,15 +592,14 @@ typedef struct {
     retries are enabled when they are configured via the service config.
     For details, see:
       https://github.com/grpc/proposal/blob/master/A6-client-retries.md
-    NOTE: Hedging functionality is not yet implemented, so those
-          fields in the service config will currently be ignored.  See
-          also the GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING arg below.
+    NOTE: Hedging policies in the service config are ignored unless the
+          GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING arg below is also set.
  */
 #define GRPC_ARG_ENABLE_RETRIES "grpc.enable_retries"
 /** Enables hedging functionality, as described in:
       https://github.com/grpc/proposal/blob/master/A6-client-retries.md
-    Default is currently false, since this functionality is not yet
-    fully implemented.
+    Default is currently false.  perAttemptRecvTimeout applies only to
+    retry policies.
     NOTE: This channel arg is experimental and will eventually be removed.
           Once hedging functionality has been implemented and proves stable,
           this arg will be removed, and the hedging functionality will
@@ -761,7 +948,14 @@ typedef enum {
       grpc_completion_queue_next() or grpc_completion_queue_pluck() MUST still
       be called to pop events from the completion queue; it is not required to
       call them actively to make I/O progress */
-  GRPC_CQ_NON_POLLING
+  GRPC_CQ_NON_POLLING,
+
+  /** Similar to GRPC_CQ_NON_POLLING, except that threads waiting for events
+      park on a futex (or a condition variable where futexes are not
+      available) instead of the completion queue's lock. Queueing an event on
+      a GRPC_CQ_NEXT completion queue then never takes a lock, which helps
+      when completions are posted from many threads */
+  GRPC_CQ_NON_POLLING_LOCK_FREE
 } grpc_cq_polling_type;
 
 /** Specifies the type of APIs to use to pop events from the completion queue */
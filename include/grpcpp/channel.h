@@ -19,6 +19,7 @@
 #ifndef GRPCPP_CHANNEL_H
 #define GRPCPP_CHANNEL_H
 
+#include <functional>
 #include <memory>
 
 #include <grpc/grpc.h>
@@ -69,6 +70,29 @@ class Channel final : public grpc::ChannelInterface,
   /// not available.
   std::string GetServiceConfigJSON() const;
 
+  /// EXPERIMENTAL: Runs \a start_calls, which should start a burst of unary
+  /// calls (typically on this channel) with the callback API, and starts all
+  /// of them as one batch: the calls are created and their operations queued
+  /// first, and the core work they need (filter stacks, load balancing picks,
+  /// transport writes) then runs back to back, before this returns. Calls
+  /// that fail immediately have their callbacks invoked on this thread
+  /// before this returns, after all the calls have been started.
+  /// \a start_calls must not block, in particular on any of the calls it
+  /// starts, and must not make blocking (synchronous) calls.
+  void StartUnaryBatch(const std::function<void()>& start_calls);
+
+  /// EXPERIMENTAL: Starts name resolution if needed, connects every backend
+  /// the load balancing policy knows of, and blocks until at least \a
+  /// fraction (0 to 1) of them are READY or \a deadline passes. Returns
+  /// whether enough backends became READY. With policies that spread calls
+  /// over every backend, like round_robin, this lets the first calls be
+  /// spread as evenly as later ones.
+  template <typename T>
+  bool WaitForWarm(T deadline, double fraction) {
+    grpc::TimePoint<T> deadline_tp(deadline);
+    return WaitForWarmImpl(deadline_tp.raw_time(), fraction);
+  }
+
  private:
   template <class InputMessage, class OutputMessage>
   friend class grpc::internal::BlockingUnaryCallImpl;
@@ -97,6 +121,7 @@ class Channel final : public grpc::ChannelInterface,
                                void* tag) override;
   bool WaitForStateChangeImpl(grpc_connectivity_state last_observed,
                               gpr_timespec deadline) override;
+  bool WaitForWarmImpl(gpr_timespec deadline, double fraction);
 
   grpc::CompletionQueue* CallbackCQ() override;
 
@@ -104,6 +129,8 @@ class Channel final : public grpc::ChannelInterface,
       const grpc::internal::RpcMethod& method, grpc::ClientContext* context,
       grpc::CompletionQueue* cq, size_t interceptor_pos) override;
 
+  void StartUnaryCall(void (*start)(void* arg), void* arg) override;
+
   const std::string host_;
   grpc_channel* const c_channel_;  // owned
 
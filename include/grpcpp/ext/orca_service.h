@@ -60,11 +60,6 @@ class OrcaService : public Service {
 
   const ServerMetricRecorder* const server_metric_recorder_;
   const absl::Duration min_report_duration_;
-  grpc::internal::Mutex mu_;
-  // Contains the last serialized metrics from server_metric_recorder_.
-  absl::optional<Slice> response_slice_ ABSL_GUARDED_BY(mu_);
-  // The update sequence number of metrics serialized in response_slice_.
-  absl::optional<uint64_t> response_slice_seq_ ABSL_GUARDED_BY(mu_);
 };
 
 }  // namespace experimental
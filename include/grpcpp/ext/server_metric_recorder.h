@@ -32,6 +32,7 @@ struct BackendMetricData;
 
 namespace grpc {
 class BackendMetricState;
+class ServerMetricRecorderLoadReporter;
 
 namespace experimental {
 /// Records server wide metrics to be reported to the client.
@@ -80,6 +81,7 @@ class ServerMetricRecorder {
  private:
   // To access GetMetrics().
   friend class grpc::BackendMetricState;
+  friend class grpc::ServerMetricRecorderLoadReporter;
   friend class OrcaService;
 
   struct BackendMetricDataState;
@@ -22,6 +22,7 @@
 #include <cstring>
 #include <map>
 #include <memory>
+#include <utility>
 
 #include <grpc/grpc.h>
 #include <grpc/impl/compression_types.h>
@@ -77,7 +78,8 @@ inline grpc_metadata* FillMetadataArray(
 /// Per-message write options.
 class WriteOptions {
  public:
-  WriteOptions() : flags_(0), last_message_(false) {}
+  WriteOptions()
+      : flags_(0), last_message_(false), background_serialization_(false) {}
 
   /// Clear all flags.
   inline void Clear() { flags_ = 0; }
@@ -184,6 +186,27 @@ class WriteOptions {
 
   inline bool is_write_through() const { return GetBit(GRPC_WRITE_THROUGH); }
 
+  /// EXPERIMENTAL: background-serialization bit: for writes on callback-API
+  /// streams, serializes the message on the EventEngine's thread pool instead
+  /// of on the thread that starts the write, which then returns without
+  /// waiting for it. Worth it for large messages started from threads that
+  /// must not stall. Writes stay in order with the stream's other operations.
+  /// This has no effect on writes started before StartCall, or on
+  /// WriteAndFinish.
+  inline WriteOptions& set_background_serialization() {
+    background_serialization_ = true;
+    return *this;
+  }
+
+  inline WriteOptions& clear_background_serialization() {
+    background_serialization_ = false;
+    return *this;
+  }
+
+  bool is_background_serialization() const {
+    return background_serialization_;
+  }
+
  private:
   void SetBit(const uint32_t mask) { flags_ |= mask; }
 
@@ -193,6 +216,7 @@ class WriteOptions {
 
   uint32_t flags_;
   bool last_message_;
+  bool background_serialization_;
 };
 
 namespace internal {
@@ -296,6 +320,14 @@ class CallOpSendMessage {
   template <class M>
   Status SendMessage(const M& message) GRPC_MUST_USE_RESULT;
 
+  /// Send \a message using \a options for the write, taking over its
+  /// contents rather than referencing them, and leaving \a message empty.
+  /// The options are cleared after use.
+  Status SendMessage(ByteBuffer&& message,
+                     WriteOptions options) GRPC_MUST_USE_RESULT;
+
+  Status SendMessage(ByteBuffer&& message) GRPC_MUST_USE_RESULT;
+
   /// Send \a message using \a options for the write. The \a options are cleared
   /// after use. This form of SendMessage allows gRPC to reference \a message
   /// beyond the lifetime of SendMessage.
@@ -393,6 +425,17 @@ Status CallOpSendMessage::SendMessage(const M& message) {
   return SendMessage(message, WriteOptions());
 }
 
+inline Status CallOpSendMessage::SendMessage(ByteBuffer&& message,
+                                             WriteOptions options) {
+  write_options_ = options;
+  send_buf_ = std::move(message);
+  return Status::OK;
+}
+
+inline Status CallOpSendMessage::SendMessage(ByteBuffer&& message) {
+  return SendMessage(std::move(message), WriteOptions());
+}
+
 template <class M>
 Status CallOpSendMessage::SendMessagePtr(const M* message,
                                          WriteOptions options) {
@@ -867,13 +910,15 @@ class CallOpSet : public CallOpSetInterface,
  public:
   CallOpSet() : core_cq_tag_(this), return_tag_(this) {}
   // The copy constructor and assignment operator reset the value of
-  // core_cq_tag_, return_tag_, done_intercepting_ and interceptor_methods_
-  // since those are only meaningful on a specific object, not across objects.
+  // core_cq_tag_, return_tag_, done_intercepting_, avalanching_ and
+  // interceptor_methods_ since those are only meaningful on a specific object,
+  // not across objects.
   CallOpSet(const CallOpSet& other)
       : core_cq_tag_(this),
         return_tag_(this),
         call_(other.call_),
         done_intercepting_(false),
+        avalanching_(false),
         interceptor_methods_(InterceptorBatchMethodsImpl()) {}
 
   CallOpSet& operator=(const CallOpSet& other) {
@@ -884,6 +929,7 @@ class CallOpSet : public CallOpSetInterface,
     return_tag_ = this;
     call_ = other.call_;
     done_intercepting_ = false;
+    avalanching_ = false;
     interceptor_methods_ = InterceptorBatchMethodsImpl();
     return *this;
   }
@@ -905,6 +951,7 @@ class CallOpSet : public CallOpSetInterface,
   bool FinalizeResult(void** tag, bool* status) override {
     if (done_intercepting_) {
       // Complete the avalanching since we are done with this batch of ops
+      avalanching_ = false;
       call_.cq()->CompleteAvalanching();
       // We have already finished intercepting and filling in the results. This
       // round trip from the core needed to be made because interceptors were
@@ -1000,11 +1047,12 @@ class CallOpSet : public CallOpSetInterface,
     this->Op4::SetInterceptionHookPoint(&interceptor_methods_);
     this->Op5::SetInterceptionHookPoint(&interceptor_methods_);
     this->Op6::SetInterceptionHookPoint(&interceptor_methods_);
-    if (interceptor_methods_.InterceptorsListEmpty()) {
+    if (interceptor_methods_.InterceptorsUninterested()) {
       return true;
     }
     // This call will go through interceptors and would need to
     // schedule new batches, so delay completion queue shutdown
+    avalanching_ = true;
     call_.cq()->RegisterAvalanching();
     return interceptor_methods_.RunInterceptors();
   }
@@ -1019,6 +1067,19 @@ class CallOpSet : public CallOpSetInterface,
     this->Op4::SetFinishInterceptionHookPoint(&interceptor_methods_);
     this->Op5::SetFinishInterceptionHookPoint(&interceptor_methods_);
     this->Op6::SetFinishInterceptionHookPoint(&interceptor_methods_);
+    // The interceptors acting before the batch are not necessarily the ones
+    // acting after it.
+    if (interceptor_methods_.InterceptorsUninterested()) {
+      if (avalanching_) {
+        avalanching_ = false;
+        call_.cq()->CompleteAvalanching();
+      }
+      return true;
+    }
+    if (!avalanching_) {
+      avalanching_ = true;
+      call_.cq()->RegisterAvalanching();
+    }
     return interceptor_methods_.RunInterceptors();
   }
 
@@ -1026,6 +1087,8 @@ class CallOpSet : public CallOpSetInterface,
   void* return_tag_;
   Call call_;
   bool done_intercepting_ = false;
+  // Whether completion queue shutdown is delayed for the interceptors.
+  bool avalanching_ = false;
   InterceptorBatchMethodsImpl interceptor_methods_;
   bool saved_status_;
 };
@@ -164,6 +164,16 @@ class ChannelInterface {
   // and adding a new pure method to an interface would be a breaking change
   // (even though this is private and non-API)
   virtual grpc::CompletionQueue* CallbackCQ() { return nullptr; }
+
+  // Runs \a start(arg), which creates a unary call on this channel and starts
+  // the single batch that carries all of its operations.  Channels may run it
+  // so that the core work of both steps is flushed in one go; \a start must
+  // not run application code that could block.
+  // Not pure, since adding a new pure method to an interface would be a
+  // breaking change (even though this is private and non-API)
+  virtual void StartUnaryCall(void (*start)(void* arg), void* arg) {
+    start(arg);
+  }
 };
 }  // namespace grpc
 
@@ -60,23 +60,34 @@ class BlockingUnaryCallImpl {
     grpc::CompletionQueue cq(grpc_completion_queue_attributes{
         GRPC_CQ_CURRENT_VERSION, GRPC_CQ_PLUCK, GRPC_CQ_DEFAULT_POLLING,
         nullptr});  // Pluckable completion queue
-    grpc::internal::Call call(channel->CreateCall(method, context, &cq));
     CallOpSet<CallOpSendInitialMetadata, CallOpSendMessage,
               CallOpRecvInitialMetadata, CallOpRecvMessage<OutputMessage>,
               CallOpClientSendClose, CallOpClientRecvStatus>
         ops;
-    status_ = ops.SendMessagePtr(&request);
-    if (!status_.ok()) {
+    bool started = false;
+    auto start = [&]() {
+      grpc::internal::Call call(channel->CreateCall(method, context, &cq));
+      status_ = ops.SendMessagePtr(&request);
+      if (!status_.ok()) {
+        return;
+      }
+      ops.SendInitialMetadata(&context->send_initial_metadata_,
+                              context->initial_metadata_flags());
+      ops.RecvInitialMetadata(context);
+      ops.RecvMessage(result);
+      ops.AllowNoMessage();
+      ops.ClientSendClose();
+      ops.ClientRecvStatus(context, &status_);
+      call.PerformOps(&ops);
+      started = true;
+    };
+    // All of the call's operations go in one batch, so creating the call and
+    // starting its batch is the whole start of the call.
+    channel->StartUnaryCall(
+        [](void* arg) { (*static_cast<decltype(start)*>(arg))(); }, &start);
+    if (!started) {
       return;
     }
-    ops.SendInitialMetadata(&context->send_initial_metadata_,
-                            context->initial_metadata_flags());
-    ops.RecvInitialMetadata(context);
-    ops.RecvMessage(result);
-    ops.AllowNoMessage();
-    ops.ClientSendClose();
-    ops.ClientRecvStatus(context, &status_);
-    call.PerformOps(&ops);
     cq.Pluck(&ops);
     // Some of the ops might fail. If the ops fail in the core layer, status
     // would reflect the error. But, if the ops fail in the C++ layer, the
@@ -63,6 +63,11 @@
 #define GRPC_CUSTOM_ZEROCOPYINPUTSTREAM \
   ::google::protobuf::io::ZeroCopyInputStream
 #define GRPC_CUSTOM_CODEDINPUTSTREAM ::google::protobuf::io::CodedInputStream
+// Since protobuf 22, ZeroCopyInputStream can hand [ctype = CORD] fields to
+// the parser as an absl::Cord.
+#if GOOGLE_PROTOBUF_VERSION >= 4022000
+#define GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
+#endif
 #endif
 
 #ifndef GRPC_CUSTOM_JSONUTIL
@@ -19,7 +19,6 @@
 #ifndef GRPCPP_IMPL_INTERCEPTOR_COMMON_H
 #define GRPCPP_IMPL_INTERCEPTOR_COMMON_H
 
-#include <array>
 #include <functional>
 
 #include <grpc/impl/grpc_types.h>
@@ -36,20 +35,13 @@ namespace internal {
 class InterceptorBatchMethodsImpl
     : public experimental::InterceptorBatchMethods {
  public:
-  InterceptorBatchMethodsImpl() {
-    for (auto i = static_cast<experimental::InterceptionHookPoints>(0);
-         i < experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS;
-         i = static_cast<experimental::InterceptionHookPoints>(
-             static_cast<size_t>(i) + 1)) {
-      hooks_[static_cast<size_t>(i)] = false;
-    }
-  }
+  InterceptorBatchMethodsImpl() {}
 
   ~InterceptorBatchMethodsImpl() override {}
 
   bool QueryInterceptionHookPoint(
       experimental::InterceptionHookPoints type) override {
-    return hooks_[static_cast<size_t>(type)];
+    return (hooks_ & experimental::InterceptionHookBit(type)) != 0;
   }
 
   void Proceed() override {
@@ -76,7 +68,7 @@ class InterceptorBatchMethodsImpl
   }
 
   void AddInterceptionHookPoint(experimental::InterceptionHookPoints type) {
-    hooks_[static_cast<size_t>(type)] = true;
+    hooks_ |= experimental::InterceptionHookBit(type);
   }
 
   ByteBuffer* GetSerializedSendMessage() override {
@@ -129,8 +121,8 @@ class InterceptorBatchMethodsImpl
   Status* GetRecvStatus() override { return recv_status_; }
 
   void FailHijackedSendMessage() override {
-    GPR_ASSERT(hooks_[static_cast<size_t>(
-        experimental::InterceptionHookPoints::PRE_SEND_MESSAGE)]);
+    GPR_ASSERT(QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::PRE_SEND_MESSAGE));
     *fail_send_message_ = true;
   }
 
@@ -192,8 +184,8 @@ class InterceptorBatchMethodsImpl
   }
 
   void FailHijackedRecvMessage() override {
-    GPR_ASSERT(hooks_[static_cast<size_t>(
-        experimental::InterceptionHookPoints::PRE_RECV_MESSAGE)]);
+    GPR_ASSERT(QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::PRE_RECV_MESSAGE));
     *hijacked_recv_message_failed_ = true;
   }
 
@@ -218,16 +210,20 @@ class InterceptorBatchMethodsImpl
   // Alternatively, RunInterceptors(std::function<void(void)> f) can be used.
   void SetCallOpSetInterface(CallOpSetInterface* ops) { ops_ = ops; }
 
-  // SetCall should have been called before this.
-  // Returns true if the interceptors list is empty
-  bool InterceptorsListEmpty() {
+  // SetCall and the hook points should have been set before this.
+  // Returns true if no interceptor acts at any of the hook points of this
+  // batch, in which case RunInterceptors() will not run any.
+  bool InterceptorsUninterested() {
     auto* client_rpc_info = call_->client_rpc_info();
     if (client_rpc_info != nullptr) {
-      return client_rpc_info->interceptors_.empty();
+      // The ops of a hijacked RPC must go to the hijacking interceptor.
+      return !client_rpc_info->hijacked_ &&
+             (client_rpc_info->hook_mask_ & hooks_) == 0;
     }
 
     auto* server_rpc_info = call_->server_rpc_info();
-    return server_rpc_info == nullptr || server_rpc_info->interceptors_.empty();
+    return server_rpc_info == nullptr ||
+           (server_rpc_info->hook_mask_ & hooks_) == 0;
   }
 
   // This should be used only by subclasses of CallOpSetInterface. SetCall and
@@ -237,19 +233,10 @@ class InterceptorBatchMethodsImpl
   // them is invoked if there were no interceptors registered.
   bool RunInterceptors() {
     GPR_ASSERT(ops_);
-    auto* client_rpc_info = call_->client_rpc_info();
-    if (client_rpc_info != nullptr) {
-      if (client_rpc_info->interceptors_.empty()) {
-        return true;
-      } else {
-        RunClientInterceptors();
-        return false;
-      }
-    }
-
-    auto* server_rpc_info = call_->server_rpc_info();
-    if (server_rpc_info == nullptr || server_rpc_info->interceptors_.empty()) {
-      return true;
+    if (InterceptorsUninterested()) return true;
+    if (call_->client_rpc_info() != nullptr) {
+      RunClientInterceptors();
+      return false;
     }
     RunServerInterceptors();
     return false;
@@ -263,10 +250,7 @@ class InterceptorBatchMethodsImpl
     // This is used only by the server for initial call request
     GPR_ASSERT(reverse_ == true);
     GPR_ASSERT(call_->client_rpc_info() == nullptr);
-    auto* server_rpc_info = call_->server_rpc_info();
-    if (server_rpc_info == nullptr || server_rpc_info->interceptors_.empty()) {
-      return true;
-    }
+    if (InterceptorsUninterested()) return true;
     callback_ = std::move(f);
     RunServerInterceptors();
     return false;
@@ -284,7 +268,7 @@ class InterceptorBatchMethodsImpl
         current_interceptor_index_ = rpc_info->interceptors_.size() - 1;
       }
     }
-    rpc_info->RunInterceptor(this, current_interceptor_index_);
+    RunCurrentInterceptor(rpc_info);
   }
 
   void RunServerInterceptors() {
@@ -294,6 +278,16 @@ class InterceptorBatchMethodsImpl
     } else {
       current_interceptor_index_ = rpc_info->interceptors_.size() - 1;
     }
+    RunCurrentInterceptor(rpc_info);
+  }
+
+  // Runs the interceptor at current_interceptor_index_, or proceeds past it
+  // if it does not act at any of the hook points of this batch.
+  template <typename RpcInfo>
+  void RunCurrentInterceptor(RpcInfo* rpc_info) {
+    if ((rpc_info->hook_masks_[current_interceptor_index_] & hooks_) == 0) {
+      return Proceed();
+    }
     rpc_info->RunInterceptor(this, current_interceptor_index_);
   }
 
@@ -318,7 +312,7 @@ class InterceptorBatchMethodsImpl
           // This is a hijacked RPC and we are done with hijacking
           ops_->ContinueFillOpsAfterInterception();
         } else {
-          rpc_info->RunInterceptor(this, current_interceptor_index_);
+          RunCurrentInterceptor(rpc_info);
         }
       } else {
         // we are done running all the interceptors without any hijacking
@@ -329,7 +323,7 @@ class InterceptorBatchMethodsImpl
       if (current_interceptor_index_ > 0) {
         // Continue running interceptors
         current_interceptor_index_--;
-        rpc_info->RunInterceptor(this, current_interceptor_index_);
+        RunCurrentInterceptor(rpc_info);
       } else {
         // we are done running all the interceptors without any hijacking
         ops_->ContinueFinalizeResultAfterInterception();
@@ -342,7 +336,7 @@ class InterceptorBatchMethodsImpl
     if (!reverse_) {
       current_interceptor_index_++;
       if (current_interceptor_index_ < rpc_info->interceptors_.size()) {
-        return rpc_info->RunInterceptor(this, current_interceptor_index_);
+        return RunCurrentInterceptor(rpc_info);
       } else if (ops_) {
         return ops_->ContinueFillOpsAfterInterception();
       }
@@ -351,7 +345,7 @@ class InterceptorBatchMethodsImpl
       if (current_interceptor_index_ > 0) {
         // Continue running interceptors
         current_interceptor_index_--;
-        return rpc_info->RunInterceptor(this, current_interceptor_index_);
+        return RunCurrentInterceptor(rpc_info);
       } else if (ops_) {
         return ops_->ContinueFinalizeResultAfterInterception();
       }
@@ -360,19 +354,13 @@ class InterceptorBatchMethodsImpl
     callback_();
   }
 
-  void ClearHookPoints() {
-    for (auto i = static_cast<experimental::InterceptionHookPoints>(0);
-         i < experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS;
-         i = static_cast<experimental::InterceptionHookPoints>(
-             static_cast<size_t>(i) + 1)) {
-      hooks_[static_cast<size_t>(i)] = false;
-    }
-  }
+  void ClearHookPoints() { hooks_ = 0; }
 
-  std::array<bool,
-             static_cast<size_t>(
-                 experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS)>
-      hooks_;
+  static_assert(static_cast<size_t>(experimental::InterceptionHookPoints::
+                                        NUM_INTERCEPTION_HOOKS) <= 32,
+                "hooks_ has a bit per hook point");
+  // The hook points of this batch, as InterceptionHookBit() values.
+  uint32_t hooks_ = 0;
 
   size_t current_interceptor_index_ = 0;  // Current iterator
   bool reverse_ = false;
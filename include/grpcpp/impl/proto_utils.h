@@ -19,6 +19,7 @@
 #ifndef GRPCPP_IMPL_PROTO_UTILS_H
 #define GRPCPP_IMPL_PROTO_UTILS_H
 
+#include <limits>
 #include <type_traits>
 
 #include <grpc/byte_buffer_reader.h>
@@ -76,6 +77,17 @@ Status GenericDeserialize(ByteBuffer* buffer,
     return Status(StatusCode::INTERNAL, "No payload");
   }
   Status result = grpc::Status::OK;
+  // Messages read in one piece, as large messages are by the posix endpoints,
+  // are parsed straight from their bytes.
+  Slice slice;
+  if (buffer->TrySingleSlice(&slice).ok()) {
+    if (slice.size() > static_cast<size_t>(std::numeric_limits<int>::max()) ||
+        !msg->ParseFromArray(slice.begin(), static_cast<int>(slice.size()))) {
+      result = Status(StatusCode::INTERNAL, msg->InitializationErrorString());
+    }
+    buffer->Clear();
+    return result;
+  }
   {
     ProtoBufferReader reader(buffer);
     if (!reader.status().ok()) {
@@ -530,7 +530,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
         ctx_->sent_initial_metadata_ = true;
       }
       finish_ops_.ServerSendStatus(&ctx_->trailing_metadata_, s);
-      call_.PerformOps(&finish_ops_);
+      ops_queue_.Run([this]() { call_.PerformOps(&finish_ops_); });
     }
 
     void SendInitialMetadata() override {
@@ -573,7 +573,23 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
       }
       // TODO(vjpai): don't assert
       GPR_ASSERT(write_ops_.SendMessagePtr(resp, options).ok());
-      call_.PerformOps(&write_ops_);
+      if (GPR_UNLIKELY(options.is_background_serialization())) {
+        // Hold the call until the write has been started on the pool.
+        this->Ref();
+        ops_queue_.RunInBackground(
+            [this]() { call_.PerformOps(&write_ops_); },
+            [this]() { this->MaybeDone(/*inlineable_ondone=*/false); });
+        return;
+      }
+      ops_queue_.Run([this]() { call_.PerformOps(&write_ops_); });
+    }
+
+    void WriteBatch(const ResponseType* const* resps, size_t count,
+                    grpc::WriteOptions options) override {
+      grpc::WriteOptions first_options;
+      const ResponseType* first =
+          write_batch_.Start(resps, count, options, &first_options);
+      Write(first, first_options);
     }
 
     void WriteAndFinish(const ResponseType* resp, grpc::WriteOptions options,
@@ -603,7 +619,17 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
       write_tag_.Set(
           call_.call(),
           [this, reactor](bool ok) {
-            reactor->OnWriteDone(ok);
+            grpc::WriteOptions options;
+            if (const ResponseType* next = write_batch_.Next(ok, &options)) {
+              // Carry on with the batch; its write holds the call in place of
+              // this one.
+              Write(next, options);
+            } else {
+              if (ok) {
+                grpc::internal::MaybeNotifyWritable(reactor, call_.call());
+              }
+              reactor->OnWriteDone(ok);
+            }
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
           &write_ops_, /*can_inline=*/false);
@@ -651,6 +677,10 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
                               grpc::internal::CallOpSendMessage>
         write_ops_;
     grpc::internal::CallbackWithSuccessTag write_tag_;
+    grpc::internal::CallbackWriteBatch<ResponseType> write_batch_;
+    // Orders writes and Finish around the writes that are performed in the
+    // background.
+    grpc::internal::CallbackStreamOpQueue ops_queue_;
 
     grpc::CallbackServerContext* const ctx_;
     grpc::internal::Call call_;
@@ -740,7 +770,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
         ctx_->sent_initial_metadata_ = true;
       }
       finish_ops_.ServerSendStatus(&ctx_->trailing_metadata_, s);
-      call_.PerformOps(&finish_ops_);
+      ops_queue_.Run([this]() { call_.PerformOps(&finish_ops_); });
     }
 
     void SendInitialMetadata() override {
@@ -783,7 +813,23 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
       }
       // TODO(vjpai): don't assert
       GPR_ASSERT(write_ops_.SendMessagePtr(resp, options).ok());
-      call_.PerformOps(&write_ops_);
+      if (GPR_UNLIKELY(options.is_background_serialization())) {
+        // Hold the call until the write has been started on the pool.
+        this->Ref();
+        ops_queue_.RunInBackground(
+            [this]() { call_.PerformOps(&write_ops_); },
+            [this]() { this->MaybeDone(/*inlineable_ondone=*/false); });
+        return;
+      }
+      ops_queue_.Run([this]() { call_.PerformOps(&write_ops_); });
+    }
+
+    void WriteBatch(const ResponseType* const* resps, size_t count,
+                    grpc::WriteOptions options) override {
+      grpc::WriteOptions first_options;
+      const ResponseType* first =
+          write_batch_.Start(resps, count, options, &first_options);
+      Write(first, first_options);
     }
 
     void WriteAndFinish(const ResponseType* resp, grpc::WriteOptions options,
@@ -815,7 +861,17 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
       write_tag_.Set(
           call_.call(),
           [this, reactor](bool ok) {
-            reactor->OnWriteDone(ok);
+            grpc::WriteOptions options;
+            if (const ResponseType* next = write_batch_.Next(ok, &options)) {
+              // Carry on with the batch; its write holds the call in place of
+              // this one.
+              Write(next, options);
+            } else {
+              if (ok) {
+                grpc::internal::MaybeNotifyWritable(reactor, call_.call());
+              }
+              reactor->OnWriteDone(ok);
+            }
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
           &write_ops_, /*can_inline=*/false);
@@ -867,6 +923,10 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
                               grpc::internal::CallOpSendMessage>
         write_ops_;
     grpc::internal::CallbackWithSuccessTag write_tag_;
+    grpc::internal::CallbackWriteBatch<ResponseType> write_batch_;
+    // Orders writes and Finish around the writes that are performed in the
+    // background.
+    grpc::internal::CallbackStreamOpQueue ops_queue_;
     grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<RequestType>>
         read_ops_;
     grpc::internal::CallbackWithSuccessTag read_tag_;
@@ -311,6 +311,16 @@ std::shared_ptr<CallCredentials> MetadataCredentialsFromPlugin(
     std::unique_ptr<MetadataCredentialsPlugin> plugin,
     grpc_security_level min_security_level);
 
+/// Like MetadataCredentialsFromPlugin, but declares that the metadata the
+/// plugin returns for a given service URL and method name stays valid for
+/// \a metadata_ttl_seconds. Channels created with these credentials reuse it
+/// for later calls to the same authority and method until it expires, instead
+/// of calling the plugin again. This is not applied to credentials set on
+/// individual calls.
+std::shared_ptr<CallCredentials> MetadataCredentialsFromPlugin(
+    std::unique_ptr<MetadataCredentialsPlugin> plugin,
+    grpc_security_level min_security_level, long metadata_ttl_seconds);
+
 /// Options used to build AltsCredentials.
 struct AltsCredentialsOptions {
   /// service accounts of target endpoint that will be acceptable
@@ -28,6 +28,8 @@
 #include <grpc/support/log.h>
 #include <grpcpp/security/tls_certificate_provider.h>
 #include <grpcpp/security/tls_certificate_verifier.h>
+#include <grpcpp/security/tls_private_key_signer.h>
+#include <grpcpp/security/tls_session_ticket_key_provider.h>
 #include <grpcpp/support/config.h>
 
 namespace grpc {
@@ -104,6 +106,14 @@ class TlsCredentialsOptions {
   // version > 1.1.
   void set_crl_directory(const std::string& path);
 
+  // Sets whether TLS 1.3 0-RTT early data is used. Clients then send the
+  // first RPCs of connections that resume a session from their session cache
+  // without waiting for the handshake, and servers accept them. Early data
+  // may be replayed by an attacker, so clients shall only enable it when all
+  // their RPCs are safe to be processed more than once. The default is false.
+  // Only supported when gRPC is built with BoringSSL.
+  void set_early_data(bool early_data);
+
   // ----- Getters for member fields ----
   // Get the internal c options. This function shall be used only internally.
   grpc_tls_credentials_options* c_credentials_options() const {
@@ -128,6 +138,12 @@ class TlsChannelCredentialsOptions final : public TlsCredentialsOptions {
   // The default is true.
   void set_verify_server_certs(bool verify_server_certs);
 
+  // Sets how many servers that passed the certificate verifier are
+  // remembered, so that new connections to a server presenting the same leaf
+  // certificate for the same target skip the verifier. The chain is still
+  // verified on every handshake. The default is 0, which disables the cache.
+  void set_verified_peer_cache_size(size_t verified_peer_cache_size);
+
  private:
 };
 
@@ -148,7 +164,29 @@ class TlsServerCredentialsOptions final : public TlsCredentialsOptions {
   void set_cert_request_type(
       grpc_ssl_client_certificate_request_type cert_request_type);
 
+  // Sets the provider of the keys that session tickets are encrypted and
+  // decrypted with. Servers using the same keys resume each other's TLS
+  // sessions. If not set, each server generates its own keys.
+  void set_session_ticket_key_provider(
+      std::shared_ptr<SessionTicketKeyProviderInterface>
+          session_ticket_key_provider);
+
+  // Sets the signer that signs the TLS handshakes in place of the private
+  // keys of the identity key-cert pairs, which may then be empty, so that the
+  // keys never have to be loaded into the server. Only supported when gRPC is
+  // built with BoringSSL: otherwise the server fails its handshakes.
+  void set_private_key_signer(
+      std::shared_ptr<PrivateKeySigner> private_key_signer);
+
+  // Sets how many ClientHellos are remembered when early data is accepted,
+  // so that the early data of a ClientHello replayed within 60 seconds is
+  // rejected. 0 disables replay detection. The default is 10000.
+  void set_early_data_anti_replay_capacity(
+      size_t early_data_anti_replay_capacity);
+
  private:
+  std::shared_ptr<SessionTicketKeyProviderInterface>
+      session_ticket_key_provider_;
 };
 
 }  // namespace experimental
@@ -0,0 +1,67 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPCPP_SECURITY_TLS_PRIVATE_KEY_SIGNER_H
+#define GRPCPP_SECURITY_TLS_PRIVATE_KEY_SIGNER_H
+
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+
+#include <grpcpp/support/config.h>
+#include <grpcpp/support/status.h>
+
+namespace grpc {
+namespace experimental {
+
+// Interface for a class that signs the TLS handshakes of a server with a
+// private key that is not in process memory, such as one kept in an HSM or by
+// a remote signing service. The handshake waits for the signature without
+// holding a thread.
+class PrivateKeySigner {
+ public:
+  // The TLS SignatureSchemes a server may be asked to sign with, as listed in
+  // RFC 8446, section 4.2.3.
+  enum class SignatureAlgorithm : uint16_t {
+    kRsaPkcs1Sha256 = 0x0401,
+    kRsaPkcs1Sha384 = 0x0501,
+    kRsaPkcs1Sha512 = 0x0601,
+    kEcdsaSecp256r1Sha256 = 0x0403,
+    kEcdsaSecp384r1Sha384 = 0x0503,
+    kEcdsaSecp521r1Sha512 = 0x0603,
+    kRsaPssRsaeSha256 = 0x0804,
+    kRsaPssRsaeSha384 = 0x0805,
+    kRsaPssRsaeSha512 = 0x0806,
+    kEd25519 = 0x0807,
+  };
+
+  virtual ~PrivateKeySigner() = default;
+
+  // Starts signing |data_to_sign|, which is not hashed yet, with
+  // |signature_algorithm|. |on_done| must be invoked exactly once, with the
+  // signature on success, and may be invoked on any thread, including this
+  // one before Sign() returns.
+  virtual void Sign(
+      const std::string& data_to_sign, SignatureAlgorithm signature_algorithm,
+      std::function<void(grpc::Status status, std::string signature)>
+          on_done) = 0;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_SECURITY_TLS_PRIVATE_KEY_SIGNER_H
@@ -0,0 +1,87 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPCPP_SECURITY_TLS_SESSION_TICKET_KEY_PROVIDER_H
+#define GRPCPP_SECURITY_TLS_SESSION_TICKET_KEY_PROVIDER_H
+
+#include <string>
+
+#include <grpc/grpc_security.h>
+#include <grpcpp/support/config.h>
+
+namespace grpc {
+namespace experimental {
+
+// Interface for a class that supplies the keys a TLS server encrypts and
+// decrypts session tickets with. Servers given the same keys resume each
+// other's sessions, so that clients spread over them skip the full handshake.
+// Implementations should be a wrapper class of an internal provider
+// implementation.
+class SessionTicketKeyProviderInterface {
+ public:
+  virtual ~SessionTicketKeyProviderInterface() = default;
+  virtual grpc_tls_session_ticket_key_provider* c_provider() = 0;
+};
+
+// A SessionTicketKeyProviderInterface implementation holding the keys set
+// with SetKeys(), which can be called again at any time to rotate them.
+class InMemorySessionTicketKeyProvider final
+    : public SessionTicketKeyProviderInterface {
+ public:
+  InMemorySessionTicketKeyProvider();
+
+  ~InMemorySessionTicketKeyProvider() override;
+
+  // Replaces the keys. |keys| holds 80 byte keys back to back, each made of a
+  // 16 byte key name, a 32 byte HMAC-SHA256 key and a 32 byte AES-256 key.
+  // The first key encrypts new tickets; the others only decrypt the tickets
+  // issued before a key rotation. Returns false, leaving the keys as they
+  // were, if |keys| is empty or not made of whole keys.
+  bool SetKeys(const std::string& keys);
+
+  grpc_tls_session_ticket_key_provider* c_provider() override {
+    return c_provider_;
+  }
+
+ private:
+  grpc_tls_session_ticket_key_provider* c_provider_ = nullptr;
+};
+
+// A SessionTicketKeyProviderInterface implementation that reads the keys, in
+// the format described for InMemorySessionTicketKeyProvider::SetKeys(), from
+// a file. The file is read again every |refresh_interval_sec| seconds, so
+// that the keys can be rotated by replacing it. It is the callers'
+// responsibility to replace the file atomically.
+class FileWatcherSessionTicketKeyProvider final
+    : public SessionTicketKeyProviderInterface {
+ public:
+  FileWatcherSessionTicketKeyProvider(const std::string& key_file_path,
+                                      unsigned int refresh_interval_sec);
+
+  ~FileWatcherSessionTicketKeyProvider() override;
+
+  grpc_tls_session_ticket_key_provider* c_provider() override {
+    return c_provider_;
+  }
+
+ private:
+  grpc_tls_session_ticket_key_provider* c_provider_ = nullptr;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_SECURITY_TLS_SESSION_TICKET_KEY_PROVIDER_H
@@ -172,6 +172,10 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
   ///
   /// \param sync_cq_timeout_msec The timeout to use when calling AsyncNext() on
   /// server completion queues passed via sync_server_cqs param.
+  ///
+  /// \param max_handlers The maximum number of threads per server completion
+  /// queue handling the requests found by the polling threads, or 0 if the
+  /// polling threads handle them (used only in case of sync server)
   Server(ChannelArguments* args,
          std::shared_ptr<std::vector<std::unique_ptr<ServerCompletionQueue>>>
              sync_server_cqs,
@@ -184,7 +188,8 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
              std::unique_ptr<experimental::ServerInterceptorFactoryInterface>>
              interceptor_creators = std::vector<std::unique_ptr<
                  experimental::ServerInterceptorFactoryInterface>>(),
-         experimental::ServerMetricRecorder* server_metric_recorder = nullptr);
+         experimental::ServerMetricRecorder* server_metric_recorder = nullptr,
+         int max_handlers = 0);
 
   /// Start the server.
   ///
@@ -223,6 +228,7 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
   class CallbackRequestBase;
   template <class ServerContextType>
   class CallbackRequest;
+  class CallbackRequestPool;
   class UnimplementedAsyncRequest;
   class UnimplementedAsyncResponse;
 
@@ -337,6 +343,12 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
   // Handler for callback generic service, if any
   std::unique_ptr<internal::MethodHandler> generic_handler_;
 
+  // Storage for the CallbackRequests of registered and generic callback
+  // methods, recycled from one call to the next. Set when the first such
+  // method is registered.
+  std::unique_ptr<CallbackRequestPool> callback_request_pool_;
+  std::unique_ptr<CallbackRequestPool> generic_callback_request_pool_;
+
   // callback_cq_ references the callbackable completion queue associated
   // with this server (if any). It is set on the first call to CallbackCQ().
   // It is _not owned_ by the server; ownership belongs with its internal
@@ -228,7 +228,13 @@ class ServerBuilder {
     NUM_CQS,         ///< Number of completion queues.
     MIN_POLLERS,     ///< Minimum number of polling threads.
     MAX_POLLERS,     ///< Maximum number of polling threads.
-    CQ_TIMEOUT_MSEC  ///< Completion queue timeout in milliseconds.
+    CQ_TIMEOUT_MSEC,  ///< Completion queue timeout in milliseconds.
+    /// Maximum number of threads per completion queue handling RPCs found by
+    /// the polling threads. When positive, polling threads only poll, and
+    /// handler threads are added up to this number while RPCs wait to be
+    /// handled and the process has CPU to spare. The default of 0 has each
+    /// polling thread handle the RPCs it finds.
+    MAX_HANDLERS
   };
 
   /// Only useful if this is a Synchronous server.
@@ -367,7 +373,11 @@ class ServerBuilder {
 
   struct SyncServerSettings {
     SyncServerSettings()
-        : num_cqs(1), min_pollers(1), max_pollers(2), cq_timeout_msec(10000) {}
+        : num_cqs(1),
+          min_pollers(1),
+          max_pollers(2),
+          cq_timeout_msec(10000),
+          max_handlers(0) {}
 
     /// Number of server completion queues to create to listen to incoming RPCs.
     int num_cqs;
@@ -382,6 +392,10 @@ class ServerBuilder {
 
     /// The timeout for server completion queue's AsyncNext call.
     int cq_timeout_msec;
+
+    /// Maximum number of threads per completion queue that handle the RPCs
+    /// found by the polling threads, or 0 if the polling threads handle them.
+    int max_handlers;
   };
 
   int max_receive_message_size_;
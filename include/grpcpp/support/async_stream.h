@@ -19,6 +19,8 @@
 #ifndef GRPCPP_SUPPORT_ASYNC_STREAM_H
 #define GRPCPP_SUPPORT_ASYNC_STREAM_H
 
+#include <utility>
+
 #include <grpc/grpc.h>
 #include <grpc/support/log.h>
 #include <grpcpp/impl/call.h>
@@ -577,6 +579,25 @@ class ClientAsyncReaderWriter final
     call_.PerformOps(&write_ops_);
   }
 
+  /// Like the other Write() overloads, but takes over \a msg. For a
+  /// \a ByteBuffer read from another call, this forwards its contents
+  /// without copying or referencing them again.
+  void Write(W&& msg, void* tag) {
+    Write(std::move(msg), grpc::WriteOptions(), tag);
+  }
+
+  void Write(W&& msg, grpc::WriteOptions options, void* tag) {
+    GPR_ASSERT(started_);
+    write_ops_.set_output_tag(tag);
+    if (options.is_last_message()) {
+      options.set_buffer_hint();
+      write_ops_.ClientSendClose();
+    }
+    // TODO(ctiller): don't assert
+    GPR_ASSERT(write_ops_.SendMessage(std::move(msg), options).ok());
+    call_.PerformOps(&write_ops_);
+  }
+
   void WritesDone(void* tag) override {
     GPR_ASSERT(started_);
     write_ops_.set_output_tag(tag);
@@ -1057,6 +1078,23 @@ class ServerAsyncReaderWriter final
     call_.PerformOps(&write_ops_);
   }
 
+  /// Like the other Write() overloads, but takes over \a msg. For a
+  /// \a ByteBuffer read from another call, this forwards its contents
+  /// without copying or referencing them again.
+  void Write(W&& msg, void* tag) {
+    Write(std::move(msg), grpc::WriteOptions(), tag);
+  }
+
+  void Write(W&& msg, grpc::WriteOptions options, void* tag) {
+    write_ops_.set_output_tag(tag);
+    if (options.is_last_message()) {
+      options.set_buffer_hint();
+    }
+    EnsureInitialMetadataSent(&write_ops_);
+    GPR_ASSERT(write_ops_.SendMessage(std::move(msg), options).ok());
+    call_.PerformOps(&write_ops_);
+  }
+
   /// See the \a ServerAsyncReaderWriterInterface.WriteAndFinish
   /// method for semantics.
   ///
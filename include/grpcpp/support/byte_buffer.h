@@ -94,6 +94,13 @@ class ByteBuffer final {
   /// size-independent.
   ByteBuffer(const ByteBuffer& buf) : buffer_(nullptr) { operator=(buf); }
 
+  /// Take over the contents of \a buf, leaving it empty. Unlike copying,
+  /// this neither allocates nor references the slices again, so received
+  /// messages can be forwarded to another call at no cost.
+  ByteBuffer(ByteBuffer&& buf) noexcept : buffer_(buf.buffer_) {
+    buf.buffer_ = nullptr;
+  }
+
   ~ByteBuffer() {
     if (buffer_) {
       grpc_byte_buffer_destroy(buffer_);
@@ -114,6 +121,15 @@ class ByteBuffer final {
     return *this;
   }
 
+  /// Take over the contents of \a buf, leaving it empty.
+  ByteBuffer& operator=(ByteBuffer&& buf) noexcept {
+    if (this != &buf) {
+      Clear();
+      Swap(&buf);
+    }
+    return *this;
+  }
+
   // If this ByteBuffer's representation is a single flat slice, returns a
   // slice referencing that array.
   Status TrySingleSlice(Slice* slice) const;
@@ -19,7 +19,10 @@
 #ifndef GRPCPP_SUPPORT_CALLBACK_COMMON_H
 #define GRPCPP_SUPPORT_CALLBACK_COMMON_H
 
+#include <atomic>
 #include <functional>
+#include <utility>
+#include <vector>
 
 #include <grpc/grpc.h>
 #include <grpc/impl/grpc_types.h>
@@ -27,6 +30,7 @@
 #include <grpcpp/impl/call.h>
 #include <grpcpp/impl/codegen/channel_interface.h>
 #include <grpcpp/impl/completion_queue_tag.h>
+#include <grpcpp/impl/sync.h>
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/status.h>
 
@@ -215,6 +219,135 @@ class CallbackWithSuccessTag : public grpc_completion_queue_functor {
   }
 };
 
+/// Runs \a work on the EventEngine's thread pool.
+void RunInBackground(std::function<void()> work);
+
+/// Returns how many bytes \a call could send right now without waiting for
+/// flow control, as last published by its transport, or -1 if unknown.
+int64_t WritableBytesHint(grpc_call* call);
+
+/// Delivers the transport's send window hint for \a call, if it has one, to
+/// \a reactor's OnWritable(). Used on successful write completion.
+template <class Reactor>
+void MaybeNotifyWritable(Reactor* reactor, grpc_call* call) {
+  int64_t bytes = WritableBytesHint(call);
+  if (bytes >= 0) reactor->OnWritable(static_cast<size_t>(bytes));
+}
+
+/// Tracks the messages of a StartWriteBatch on a callback-API stream. They
+/// are written one after the other from the stream's write completion, all
+/// but the last one corked so that the transport holds them and sends them
+/// together with the last; the reactor only sees the completion of the
+/// batch as a whole. Only accessed from the write path, which cannot be
+/// concurrent with itself.
+template <class Message>
+class CallbackWriteBatch {
+ public:
+  /// Starts a batch of \a count messages written with \a options, and
+  /// returns the first one along with the options to write it with.
+  const Message* Start(const Message* const* msgs, size_t count,
+                       grpc::WriteOptions options,
+                       grpc::WriteOptions* first_options) {
+    GPR_ASSERT(count > 0);
+    msgs_ = msgs;
+    count_ = count;
+    next_ = 0;
+    options_ = options;
+    return Next(/*ok=*/true, first_options);
+  }
+
+  /// Returns the next message of the batch to write, or nullptr if the write
+  /// that just completed was the last of the batch, failed, or was not part
+  /// of one; the batch is then over.
+  const Message* Next(bool ok, grpc::WriteOptions* options) {
+    if (!ok || next_ == count_) {
+      count_ = next_ = 0;
+      return nullptr;
+    }
+    *options = options_;
+    if (next_ + 1 < count_) options->clear_last_message().set_corked();
+    return msgs_[next_++];
+  }
+
+ private:
+  const Message* const* msgs_ = nullptr;
+  size_t count_ = 0;
+  size_t next_ = 0;
+  grpc::WriteOptions options_;
+};
+
+/// Keeps the operations of a callback-API stream in order when some of its
+/// writes are performed, and so serialized, on the EventEngine's thread pool
+/// (see WriteOptions::set_background_serialization). Every operation that
+/// must reach core after such a write (the next writes, WritesDone, Finish)
+/// goes through Run(), which performs it at once unless a background write
+/// is still being started, in which case it is performed on the pool right
+/// after that write. Background writes go through RunInBackground(). Costs a single atomic load per operation while no
+/// background write is in flight.
+class CallbackStreamOpQueue {
+ public:
+  /// Performs \a op once all the background writes before it are started.
+  template <class Op>
+  void Run(Op op) {
+    if (GPR_UNLIKELY(background_.load(std::memory_order_acquire))) {
+      grpc::internal::MutexLock lock(&mu_);
+      if (background_.load(std::memory_order_relaxed)) {
+        queued_.emplace_back(std::move(op));
+        return;
+      }
+    }
+    op();
+  }
+
+  /// Performs \a write, and then the operations that were queued behind it,
+  /// on the pool. \a release is invoked once the write has been started,
+  /// and should drop a hold that keeps the stream alive until then.
+  template <class Write, class Release>
+  void RunInBackground(Write write, Release release) {
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      if (background_.load(std::memory_order_relaxed)) {
+        // The pool is already busy with this stream and performs the write
+        // when it gets to it.
+        queued_.emplace_back([write = std::move(write),
+                              release = std::move(release)]() {
+          write();
+          release();
+        });
+        return;
+      }
+      background_.store(true, std::memory_order_relaxed);
+    }
+    grpc::internal::RunInBackground(
+        [this, write = std::move(write), release = std::move(release)]() {
+          write();
+          Drain();
+          release();
+        });
+  }
+
+ private:
+  void Drain() {
+    while (true) {
+      std::function<void()> op;
+      {
+        grpc::internal::MutexLock lock(&mu_);
+        if (queued_.empty()) {
+          background_.store(false, std::memory_order_release);
+          return;
+        }
+        op = std::move(queued_.front());
+        queued_.erase(queued_.begin());
+      }
+      op();
+    }
+  }
+
+  std::atomic<bool> background_{false};
+  grpc::internal::Mutex mu_;
+  std::vector<std::function<void()>> queued_;
+};
+
 }  // namespace internal
 }  // namespace grpc
 
@@ -29,6 +29,7 @@
 #include <grpcpp/impl/sync.h>
 #include <grpcpp/support/callback_common.h>
 #include <grpcpp/support/config.h>
+#include <grpcpp/support/message_allocator.h>
 #include <grpcpp/support/status.h>
 
 namespace grpc {
@@ -60,6 +61,27 @@ void CallbackUnaryCall(grpc::ChannelInterface* channel,
       channel, method, context, request, result, on_completion);
 }
 
+/// Perform a callback-based unary call whose request and response are owned
+/// by \a messages, typically obtained from a MessageAllocator. \a messages
+/// is released after \a on_completion returns, so that the allocator can
+/// reuse the messages (or the arena they live on) for a later call.
+template <class InputMessage, class OutputMessage,
+          class BaseInputMessage = InputMessage,
+          class BaseOutputMessage = OutputMessage>
+void CallbackUnaryCall(
+    grpc::ChannelInterface* channel, const grpc::internal::RpcMethod& method,
+    grpc::ClientContext* context,
+    grpc::MessageHolder<InputMessage, OutputMessage>* messages,
+    std::function<void(grpc::Status)> on_completion) {
+  CallbackUnaryCall<InputMessage, OutputMessage, BaseInputMessage,
+                    BaseOutputMessage>(
+      channel, method, context, messages->request(), messages->response(),
+      [messages, on_completion = std::move(on_completion)](grpc::Status s) {
+        on_completion(std::move(s));
+        messages->Release();
+      });
+}
+
 template <class InputMessage, class OutputMessage>
 class CallbackUnaryCallImpl {
  public:
@@ -70,7 +92,6 @@ class CallbackUnaryCallImpl {
                         std::function<void(grpc::Status)> on_completion) {
     grpc::CompletionQueue* cq = channel->CallbackCQ();
     GPR_ASSERT(cq != nullptr);
-    grpc::internal::Call call(channel->CreateCall(method, context, cq));
 
     using FullCallOpSet = grpc::internal::CallOpSet<
         grpc::internal::CallOpSendInitialMetadata,
@@ -84,28 +105,39 @@ class CallbackUnaryCallImpl {
       FullCallOpSet opset;
       grpc::internal::CallbackWithStatusTag tag;
     };
-    const size_t alloc_sz = sizeof(OpSetAndTag);
-    auto* const alloced =
-        static_cast<OpSetAndTag*>(grpc_call_arena_alloc(call.call(), alloc_sz));
-    auto* ops = new (&alloced->opset) FullCallOpSet;
-    auto* tag = new (&alloced->tag)
-        grpc::internal::CallbackWithStatusTag(call.call(), on_completion, ops);
-
-    // TODO(vjpai): Unify code with sync API as much as possible
-    grpc::Status s = ops->SendMessagePtr(request);
+    grpc::internal::CallbackWithStatusTag* tag = nullptr;
+    grpc::Status s;
+    auto start = [&]() {
+      grpc::internal::Call call(channel->CreateCall(method, context, cq));
+      const size_t alloc_sz = sizeof(OpSetAndTag);
+      auto* const alloced = static_cast<OpSetAndTag*>(
+          grpc_call_arena_alloc(call.call(), alloc_sz));
+      auto* ops = new (&alloced->opset) FullCallOpSet;
+      tag = new (&alloced->tag) grpc::internal::CallbackWithStatusTag(
+          call.call(), on_completion, ops);
+
+      // TODO(vjpai): Unify code with sync API as much as possible
+      s = ops->SendMessagePtr(request);
+      if (!s.ok()) {
+        return;
+      }
+      ops->SendInitialMetadata(&context->send_initial_metadata_,
+                               context->initial_metadata_flags());
+      ops->RecvInitialMetadata(context);
+      ops->RecvMessage(result);
+      ops->AllowNoMessage();
+      ops->ClientSendClose();
+      ops->ClientRecvStatus(context, tag->status_ptr());
+      ops->set_core_cq_tag(tag);
+      call.PerformOps(ops);
+    };
+    channel->StartUnaryCall(
+        [](void* arg) { (*static_cast<decltype(start)*>(arg))(); }, &start);
+    // The callback of a call that could not be started runs only once the
+    // channel is done starting it.
     if (!s.ok()) {
       tag->force_run(s);
-      return;
     }
-    ops->SendInitialMetadata(&context->send_initial_metadata_,
-                             context->initial_metadata_flags());
-    ops->RecvInitialMetadata(context);
-    ops->RecvMessage(result);
-    ops->AllowNoMessage();
-    ops->ClientSendClose();
-    ops->ClientRecvStatus(context, tag->status_ptr());
-    ops->set_core_cq_tag(tag);
-    call.PerformOps(ops);
   }
 };
 
@@ -162,6 +194,8 @@ class ClientCallbackReaderWriter {
   virtual ~ClientCallbackReaderWriter() {}
   virtual void StartCall() = 0;
   virtual void Write(const Request* req, grpc::WriteOptions options) = 0;
+  virtual void WriteBatch(const Request* const* reqs, size_t count,
+                          grpc::WriteOptions options) = 0;
   virtual void WritesDone() = 0;
   virtual void Read(Response* resp) = 0;
   virtual void AddHold(int holds) = 0;
@@ -195,6 +229,8 @@ class ClientCallbackWriter {
   virtual void StartCall() = 0;
   void Write(const Request* req) { Write(req, grpc::WriteOptions()); }
   virtual void Write(const Request* req, grpc::WriteOptions options) = 0;
+  virtual void WriteBatch(const Request* const* reqs, size_t count,
+                          grpc::WriteOptions options) = 0;
   void WriteLast(const Request* req, grpc::WriteOptions options) {
     Write(req, options.set_last_message());
   }
@@ -268,6 +304,27 @@ class ClientBidiReactor : public internal::ClientReactor {
     stream_->Write(req, options);
   }
 
+  /// Initiate/post a write of several messages as a single operation. The
+  /// messages are passed down the stack back to back, corked so that the
+  /// transport sends them together, and OnWriteDone is called once, when the
+  /// last of them has been written or any of them has failed. This is much
+  /// cheaper than a StartWrite per message for streams of small messages.
+  ///
+  /// \param[in] reqs The messages to be written, in order. The library does not
+  ///                 take ownership but the caller must ensure that the array
+  ///                 and the messages are not deleted or modified until
+  ///                 OnWriteDone is called.
+  /// \param[in] count How many messages \a reqs holds; at least one.
+  /// \param[in] options The WriteOptions to use for the batch. With
+  ///                    set_last_message, the batch is the last write.
+  void StartWriteBatch(const Request* const* reqs, size_t count,
+                       grpc::WriteOptions options) {
+    stream_->WriteBatch(reqs, count, options);
+  }
+  void StartWriteBatch(const Request* const* reqs, size_t count) {
+    StartWriteBatch(reqs, count, grpc::WriteOptions());
+  }
+
   /// Initiate/post a write operation with specified options and an indication
   /// that this is the last write (like StartWrite and StartWritesDone, merged).
   /// Note that calling this means that no more calls to StartWrite,
@@ -349,6 +406,15 @@ class ClientBidiReactor : public internal::ClientReactor {
   ///               will succeed, and any further Start* should not be called.
   virtual void OnWriteDone(bool /*ok*/) {}
 
+  /// Notifies the application, just before a successful OnWriteDone, how
+  /// many more bytes the transport could send on this stream right now
+  /// without waiting for the peer's flow control. Applications that produce
+  /// data faster than the peer consumes it can use this to pace or coalesce
+  /// their next writes. Not called if the transport does not report it.
+  ///
+  /// \param[in] bytes The send window left after what is already queued.
+  virtual void OnWritable(size_t /*bytes*/) {}
+
   /// Notifies the application that a StartWritesDone operation completed. Note
   /// that this is only used on explicit StartWritesDone operations and not for
   /// those that are implicitly invoked as part of a StartWriteLast.
@@ -401,6 +467,13 @@ class ClientWriteReactor : public internal::ClientReactor {
   void StartWrite(const Request* req, grpc::WriteOptions options) {
     writer_->Write(req, options);
   }
+  void StartWriteBatch(const Request* const* reqs, size_t count,
+                       grpc::WriteOptions options) {
+    writer_->WriteBatch(reqs, count, options);
+  }
+  void StartWriteBatch(const Request* const* reqs, size_t count) {
+    StartWriteBatch(reqs, count, grpc::WriteOptions());
+  }
   void StartWriteLast(const Request* req, grpc::WriteOptions options) {
     StartWrite(req, options.set_last_message());
   }
@@ -416,6 +489,15 @@ class ClientWriteReactor : public internal::ClientReactor {
   void OnDone(const grpc::Status& /*s*/) override {}
   virtual void OnReadInitialMetadataDone(bool /*ok*/) {}
   virtual void OnWriteDone(bool /*ok*/) {}
+
+  /// Notifies the application, just before a successful OnWriteDone, how
+  /// many more bytes the transport could send on this stream right now
+  /// without waiting for the peer's flow control. Applications that produce
+  /// data faster than the peer consumes it can use this to pace or coalesce
+  /// their next writes. Not called if the transport does not report it.
+  ///
+  /// \param[in] bytes The send window left after what is already queued.
+  virtual void OnWritable(size_t /*bytes*/) {}
   virtual void OnWritesDoneDone(bool /*ok*/) {}
 
  private:
@@ -550,7 +632,23 @@ class ClientCallbackReaderWriterImpl
         return;
       }
     }
-    call_.PerformOps(&write_ops_);
+    if (GPR_UNLIKELY(options.is_background_serialization())) {
+      // Hold the stream until the write has been started on the pool.
+      callbacks_outstanding_.fetch_add(1, std::memory_order_relaxed);
+      ops_queue_.RunInBackground(
+          [this]() { call_.PerformOps(&write_ops_); },
+          [this]() { MaybeFinish(/*from_reaction=*/false); });
+      return;
+    }
+    ops_queue_.Run([this]() { call_.PerformOps(&write_ops_); });
+  }
+
+  void WriteBatch(const Request* const* msgs, size_t count,
+                  grpc::WriteOptions options) override {
+    grpc::WriteOptions first_options;
+    const Request* first =
+        write_batch_.Start(msgs, count, options, &first_options);
+    Write(first, first_options);
   }
   void WritesDone() ABSL_LOCKS_EXCLUDED(start_mu_) override {
     writes_done_ops_.ClientSendClose();
@@ -575,7 +673,7 @@ class ClientCallbackReaderWriterImpl
         return;
       }
     }
-    call_.PerformOps(&writes_done_ops_);
+    ops_queue_.Run([this]() { call_.PerformOps(&writes_done_ops_); });
   }
 
   void AddHold(int holds) override {
@@ -611,7 +709,15 @@ class ClientCallbackReaderWriterImpl
     write_tag_.Set(
         call_.call(),
         [this](bool ok) {
-          reactor_->OnWriteDone(ok);
+          grpc::WriteOptions options;
+          if (const Request* next = write_batch_.Next(ok, &options)) {
+            // Carry on with the batch; its write holds the stream in place of
+            // this one.
+            Write(next, options);
+          } else {
+            if (ok) grpc::internal::MaybeNotifyWritable(reactor_, call_.call());
+            reactor_->OnWriteDone(ok);
+          }
           MaybeFinish(/*from_reaction=*/true);
         },
         &write_ops_, /*can_inline=*/false);
@@ -679,6 +785,7 @@ class ClientCallbackReaderWriterImpl
                             grpc::internal::CallOpClientSendClose>
       write_ops_;
   grpc::internal::CallbackWithSuccessTag write_tag_;
+  grpc::internal::CallbackWriteBatch<Request> write_batch_;
 
   grpc::internal::CallOpSet<grpc::internal::CallOpSendInitialMetadata,
                             grpc::internal::CallOpClientSendClose>
@@ -700,6 +807,10 @@ class ClientCallbackReaderWriterImpl
   std::atomic<intptr_t> callbacks_outstanding_{3};
   std::atomic_bool started_{false};
   grpc::internal::Mutex start_mu_;
+
+  // Orders the writes and WritesDone started after StartCall, around the
+  // writes that are performed in the background.
+  grpc::internal::CallbackStreamOpQueue ops_queue_;
 };
 
 template <class Request, class Response>
@@ -949,7 +1060,23 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
         return;
       }
     }
-    call_.PerformOps(&write_ops_);
+    if (GPR_UNLIKELY(options.is_background_serialization())) {
+      // Hold the stream until the write has been started on the pool.
+      callbacks_outstanding_.fetch_add(1, std::memory_order_relaxed);
+      ops_queue_.RunInBackground(
+          [this]() { call_.PerformOps(&write_ops_); },
+          [this]() { MaybeFinish(/*from_reaction=*/false); });
+      return;
+    }
+    ops_queue_.Run([this]() { call_.PerformOps(&write_ops_); });
+  }
+
+  void WriteBatch(const Request* const* msgs, size_t count,
+                  grpc::WriteOptions options) override {
+    grpc::WriteOptions first_options;
+    const Request* first =
+        write_batch_.Start(msgs, count, options, &first_options);
+    Write(first, first_options);
   }
 
   void WritesDone() ABSL_LOCKS_EXCLUDED(start_mu_) override {
@@ -977,7 +1104,7 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
         return;
       }
     }
-    call_.PerformOps(&writes_done_ops_);
+    ops_queue_.Run([this]() { call_.PerformOps(&writes_done_ops_); });
   }
 
   void AddHold(int holds) override {
@@ -1014,7 +1141,15 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
     write_tag_.Set(
         call_.call(),
         [this](bool ok) {
-          reactor_->OnWriteDone(ok);
+          grpc::WriteOptions options;
+          if (const Request* next = write_batch_.Next(ok, &options)) {
+            // Carry on with the batch; its write holds the stream in place of
+            // this one.
+            Write(next, options);
+          } else {
+            if (ok) grpc::internal::MaybeNotifyWritable(reactor_, call_.call());
+            reactor_->OnWriteDone(ok);
+          }
           MaybeFinish(/*from_reaction=*/true);
         },
         &write_ops_, /*can_inline=*/false);
@@ -1072,6 +1207,7 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
                             grpc::internal::CallOpClientSendClose>
       write_ops_;
   grpc::internal::CallbackWithSuccessTag write_tag_;
+  grpc::internal::CallbackWriteBatch<Request> write_batch_;
 
   grpc::internal::CallOpSet<grpc::internal::CallOpSendInitialMetadata,
                             grpc::internal::CallOpClientSendClose>
@@ -1088,6 +1224,10 @@ class ClientCallbackWriterImpl : public ClientCallbackWriter<Request> {
   std::atomic<intptr_t> callbacks_outstanding_{3};
   std::atomic_bool started_{false};
   grpc::internal::Mutex start_mu_;
+
+  // Orders the writes and WritesDone started after StartCall, around the
+  // writes that are performed in the background.
+  grpc::internal::CallbackStreamOpQueue ops_queue_;
 };
 
 template <class Request>
@@ -0,0 +1,263 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_CLIENT_COROUTINE_H
+#define GRPCPP_SUPPORT_CLIENT_COROUTINE_H
+
+// C++20 coroutine awaitables on top of the client callback API.  They can be
+// awaited from any coroutine type.  Coroutines are resumed inline on the
+// thread that runs the callback API's reactions, so no completion queue and
+// no extra threads are involved.  This header is empty unless the compiler
+// supports C++20 coroutines.
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && \
+    defined(__has_include)
+#if __has_include(<coroutine>)
+#define GRPCPP_CLIENT_COROUTINE_SUPPORTED
+#endif
+#endif
+
+#ifdef GRPCPP_CLIENT_COROUTINE_SUPPORTED
+
+#include <coroutine>
+#include <utility>
+
+#include <grpcpp/impl/sync.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/config.h>
+#include <grpcpp/support/status.h>
+
+namespace grpc {
+namespace experimental {
+
+namespace internal {
+
+// Awaits a single operation on a stream: \a start starts the operation, and
+// the reactor resumes the coroutine stored in \a *handle when it completes,
+// with the result in \a *ok.
+template <class Start>
+class StreamOpAwaiter {
+ public:
+  StreamOpAwaiter(std::coroutine_handle<>* handle, const bool* ok, Start start)
+      : handle_(handle), ok_(ok), start_(std::move(start)) {}
+
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(std::coroutine_handle<> handle) {
+    *handle_ = handle;
+    // The coroutine may be resumed, and this awaiter destroyed, before
+    // start() returns.
+    Start start = std::move(start_);
+    start();
+  }
+  bool await_resume() const noexcept { return *ok_; }
+
+ private:
+  std::coroutine_handle<>* const handle_;
+  const bool* const ok_;
+  Start start_;
+};
+
+template <class Start>
+StreamOpAwaiter<Start> MakeStreamOpAwaiter(std::coroutine_handle<>* handle,
+                                           const bool* ok, Start start) {
+  return StreamOpAwaiter<Start>(handle, ok, std::move(start));
+}
+
+// Resumes the coroutine stored in \a *handle, and clears it.
+inline void ResumeStreamOp(std::coroutine_handle<>* handle) {
+  std::exchange(*handle, nullptr).resume();
+}
+
+// Records the final status of a stream, and wakes the coroutine waiting for
+// it in Finish().
+class StreamFinisher {
+ public:
+  class Awaiter {
+   public:
+    explicit Awaiter(StreamFinisher* finisher) : finisher_(finisher) {}
+
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle) {
+      grpc::internal::MutexLock lock(&finisher_->mu_);
+      if (finisher_->done_) return false;
+      finisher_->handle_ = handle;
+      return true;
+    }
+    grpc::Status await_resume() { return std::move(finisher_->status_); }
+
+   private:
+    StreamFinisher* const finisher_;
+  };
+
+  // Must be called from the reactor's OnDone(). The reactor must not be
+  // touched once this returns, since the coroutine may have destroyed it.
+  void Done(const grpc::Status& status) {
+    std::coroutine_handle<> handle;
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      status_ = status;
+      done_ = true;
+      handle = std::exchange(handle_, nullptr);
+    }
+    if (handle) handle.resume();
+  }
+
+ private:
+  grpc::internal::Mutex mu_;
+  bool done_ = false;
+  grpc::Status status_;
+  std::coroutine_handle<> handle_;
+};
+
+}  // namespace internal
+
+/// Awaits a unary call on the callback API, and returns its status. \a start
+/// is invoked with the reactor to bind to the call, for example
+///
+///   grpc::Status status = co_await grpc::experimental::UnaryCallAwaiter(
+///       [&](grpc::ClientUnaryReactor* reactor) {
+///         stub->async()->Echo(&context, &request, &response, reactor);
+///       });
+///
+/// The context, request and response must outlive the co_await expression.
+template <class Start>
+class UnaryCallAwaiter final : public ClientUnaryReactor {
+ public:
+  explicit UnaryCallAwaiter(Start start) : start_(std::move(start)) {}
+
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(std::coroutine_handle<> handle) {
+    handle_ = handle;
+    start_(this);
+    StartCall();
+  }
+  grpc::Status await_resume() { return std::move(status_); }
+
+  void OnDone(const grpc::Status& s) override {
+    status_ = s;
+    // This is the last reaction, so the awaiter may go away from here on.
+    handle_.resume();
+  }
+
+ private:
+  Start start_;
+  std::coroutine_handle<> handle_;
+  grpc::Status status_;
+};
+
+/// A bidi streaming call whose operations are awaited. Bind it to a call and
+/// start it like any ClientBidiReactor, for example
+///
+///   grpc::experimental::ClientBidiStream<Request, Response> stream;
+///   stub->async()->BidiStream(&context, &stream);
+///   stream.StartCall();
+///   bool ok = co_await stream.Write(&request);
+///   ok = co_await stream.Read(&response);
+///   co_await stream.WritesDone();
+///   grpc::Status status = co_await stream.Finish();
+///
+/// Reads may be awaited concurrently with writes (from another coroutine),
+/// but at most one read and one write may be outstanding at a time, as with
+/// the callback API. Finish() must be awaited before the stream is destroyed.
+template <class Request, class Response>
+class ClientBidiStream final : public ClientBidiReactor<Request, Response> {
+ public:
+  /// Awaits the next message into \a response; returns false once the stream
+  /// has no more messages.
+  auto Read(Response* response) {
+    return internal::MakeStreamOpAwaiter(
+        &read_handle_, &read_ok_,
+        [this, response]() { this->StartRead(response); });
+  }
+
+  /// Awaits a write of \a request; returns false if the stream is broken.
+  auto Write(const Request* request,
+             grpc::WriteOptions options = grpc::WriteOptions()) {
+    return internal::MakeStreamOpAwaiter(
+        &write_handle_, &write_ok_, [this, request, options]() {
+          this->StartWrite(request, options);
+        });
+  }
+
+  /// Awaits the half-close of the stream.
+  auto WritesDone() {
+    return internal::MakeStreamOpAwaiter(&write_handle_, &write_ok_,
+                                         [this]() { this->StartWritesDone(); });
+  }
+
+  /// Awaits the end of the call, and returns its status.
+  internal::StreamFinisher::Awaiter Finish() {
+    return internal::StreamFinisher::Awaiter(&finisher_);
+  }
+
+  void OnReadDone(bool ok) override {
+    read_ok_ = ok;
+    internal::ResumeStreamOp(&read_handle_);
+  }
+  void OnWriteDone(bool ok) override {
+    write_ok_ = ok;
+    internal::ResumeStreamOp(&write_handle_);
+  }
+  void OnWritesDoneDone(bool ok) override {
+    write_ok_ = ok;
+    internal::ResumeStreamOp(&write_handle_);
+  }
+  void OnDone(const grpc::Status& s) override { finisher_.Done(s); }
+
+ private:
+  std::coroutine_handle<> read_handle_;
+  bool read_ok_ = false;
+  std::coroutine_handle<> write_handle_;
+  bool write_ok_ = false;
+  internal::StreamFinisher finisher_;
+};
+
+/// A server streaming call whose reads are awaited. Bind it to a call and
+/// start it like any ClientReadReactor, then co_await Read() until it returns
+/// false, and co_await Finish() before destroying the stream.
+template <class Response>
+class ClientReadStream final : public ClientReadReactor<Response> {
+ public:
+  auto Read(Response* response) {
+    return internal::MakeStreamOpAwaiter(
+        &read_handle_, &read_ok_,
+        [this, response]() { this->StartRead(response); });
+  }
+
+  internal::StreamFinisher::Awaiter Finish() {
+    return internal::StreamFinisher::Awaiter(&finisher_);
+  }
+
+  void OnReadDone(bool ok) override {
+    read_ok_ = ok;
+    internal::ResumeStreamOp(&read_handle_);
+  }
+  void OnDone(const grpc::Status& s) override { finisher_.Done(s); }
+
+ private:
+  std::coroutine_handle<> read_handle_;
+  bool read_ok_ = false;
+  internal::StreamFinisher finisher_;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_CLIENT_COROUTINE_SUPPORTED
+
+#endif  // GRPCPP_SUPPORT_CLIENT_COROUTINE_H
@@ -154,17 +154,25 @@ class ClientRpcInfo {
          ++it) {
       auto* interceptor = (*it)->CreateClientInterceptor(this);
       if (interceptor != nullptr) {
-        interceptors_.push_back(
-            std::unique_ptr<experimental::Interceptor>(interceptor));
+        AddInterceptor(interceptor);
       }
     }
     if (internal::g_global_client_interceptor_factory != nullptr) {
-      interceptors_.push_back(std::unique_ptr<experimental::Interceptor>(
-          internal::g_global_client_interceptor_factory
-              ->CreateClientInterceptor(this)));
+      auto* interceptor = internal::g_global_client_interceptor_factory
+                              ->CreateClientInterceptor(this);
+      if (interceptor != nullptr) {
+        AddInterceptor(interceptor);
+      }
     }
   }
 
+  void AddInterceptor(experimental::Interceptor* interceptor) {
+    interceptors_.push_back(
+        std::unique_ptr<experimental::Interceptor>(interceptor));
+    hook_masks_.push_back(interceptor->InterceptionHookMask());
+    hook_mask_ |= hook_masks_.back();
+  }
+
   grpc::ClientContext* ctx_ = nullptr;
   // TODO(yashykt): make type_ const once move-assignment is deleted
   Type type_{Type::UNKNOWN};
@@ -172,6 +180,9 @@ class ClientRpcInfo {
   const char* suffix_for_stats_ = nullptr;
   grpc::ChannelInterface* channel_ = nullptr;
   std::vector<std::unique_ptr<experimental::Interceptor>> interceptors_;
+  // The InterceptionHookMask() of each interceptor, and their union.
+  std::vector<uint32_t> hook_masks_;
+  uint32_t hook_mask_ = 0;
   bool hijacked_ = false;
   size_t hijacked_interceptor_ = 0;
 
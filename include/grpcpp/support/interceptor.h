@@ -19,6 +19,8 @@
 #ifndef GRPCPP_SUPPORT_INTERCEPTOR_H
 #define GRPCPP_SUPPORT_INTERCEPTOR_H
 
+#include <stdint.h>
+
 #include <map>
 #include <memory>
 #include <string>
@@ -80,6 +82,12 @@ enum class InterceptionHookPoints {
   NUM_INTERCEPTION_HOOKS
 };
 
+/// Returns the bit for \a point in the masks returned by
+/// Interceptor::InterceptionHookMask().
+inline constexpr uint32_t InterceptionHookBit(InterceptionHookPoints point) {
+  return uint32_t{1} << static_cast<int>(point);
+}
+
 /// Class that is passed as an argument to the \a Intercept method
 /// of the application's \a Interceptor interface implementation. It has five
 /// purposes:
@@ -222,6 +230,15 @@ class Interceptor {
   /// The one public method of an Interceptor interface. Override this to
   /// trigger the desired actions at the hook points described above.
   virtual void Intercept(InterceptorBatchMethods* methods) = 0;
+
+  /// Returns the hook points at which Intercept() does anything, as an OR of
+  /// InterceptionHookBit() values. Intercept() is not called for batches
+  /// that have none of them, as though it had called Proceed() right away,
+  /// and batches that no interceptor of the RPC acts on skip interception
+  /// altogether. An interceptor that may Hijack() must include
+  /// PRE_SEND_INITIAL_METADATA. Called once, when the interceptor is created.
+  /// The default is every hook point.
+  virtual uint32_t InterceptionHookMask() { return ~uint32_t{0}; }
 };
 
 }  // namespace experimental
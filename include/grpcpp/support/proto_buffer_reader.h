@@ -19,6 +19,7 @@
 #ifndef GRPCPP_SUPPORT_PROTO_BUFFER_READER_H
 #define GRPCPP_SUPPORT_PROTO_BUFFER_READER_H
 
+#include <algorithm>
 #include <type_traits>
 
 #include <grpc/byte_buffer.h>
@@ -31,6 +32,11 @@
 #include <grpcpp/support/byte_buffer.h>
 #include <grpcpp/support/status.h>
 
+#ifdef GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
+#include "absl/strings/cord.h"
+#include "absl/strings/string_view.h"
+#endif
+
 /// This header provides an object that reads bytes directly from a
 /// grpc::ByteBuffer, via the ZeroCopyInputStream interface
 
@@ -120,6 +126,35 @@ class ProtoBufferReader : public grpc::protobuf::io::ZeroCopyInputStream {
   /// Returns the total number of bytes read since this object was created.
   int64_t ByteCount() const override { return byte_count_ - backup_count_; }
 
+#ifdef GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
+  /// The proto library calls this to read \a count bytes into \a cord, for
+  /// fields with [ctype = CORD]. Large chunks are not copied: \a cord
+  /// references the byte buffer's slices instead, and keeps them alive.
+  bool ReadCord(absl::Cord* cord, int count) override {
+    if (!status_.ok()) {
+      return false;
+    }
+    while (count > 0) {
+      /// Unread bytes at the end of the current slice are kept as a backup,
+      /// so that a later Next returns them.
+      if (backup_count_ == 0) {
+        if (!grpc_byte_buffer_reader_peek(&reader_, &slice_)) {
+          return false;
+        }
+        backup_count_ = GRPC_SLICE_LENGTH(*slice_);
+        byte_count_ += backup_count_;
+      }
+      const size_t begin = GRPC_SLICE_LENGTH(*slice_) - backup_count_;
+      const size_t length = std::min(static_cast<size_t>(backup_count_),
+                                     static_cast<size_t>(count));
+      AppendToCord(cord, begin, length);
+      backup_count_ -= length;
+      count -= static_cast<int>(length);
+    }
+    return true;
+  }
+#endif
+
   // These protected members are needed to support internal optimizations.
   // they expose internal bits of grpc core that are NOT stable. If you have
   // a use case needs to use one of these functions, please send an email to
@@ -133,6 +168,27 @@ class ProtoBufferReader : public grpc::protobuf::io::ZeroCopyInputStream {
   grpc_slice** mutable_slice_ptr() { return &slice_; }
 
  private:
+#ifdef GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
+  /// Appends \a length bytes of the current slice, from \a begin, to \a cord.
+  void AppendToCord(absl::Cord* cord, size_t begin, size_t length) {
+    const char* data =
+        reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(*slice_)) + begin;
+    /// Referencing a slice costs about as much as copying a small chunk.
+    if (length < kMinReferencedLength) {
+      cord->Append(absl::string_view(data, length));
+      return;
+    }
+    grpc_slice piece = grpc_slice_sub(*slice_, begin, begin + length);
+    cord->Append(absl::MakeCordFromExternal(
+        absl::string_view(
+            reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(piece)),
+            length),
+        [piece](absl::string_view /*data*/) { grpc_slice_unref(piece); }));
+  }
+
+  static constexpr size_t kMinReferencedLength = 512;
+#endif
+
   int64_t byte_count_;              ///< total bytes read since object creation
   int64_t backup_count_;            ///< how far backed up in the stream we are
   grpc_byte_buffer_reader reader_;  ///< internal object to read \a grpc_slice
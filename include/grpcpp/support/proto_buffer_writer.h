@@ -41,6 +41,14 @@ namespace internal {
 class ProtoBufferWriterPeer;
 }  // namespace internal
 
+namespace internal {
+/// Allocates a slice of \a length bytes for ProtoBufferWriter to serialize
+/// into. Slices big enough to be worth it reuse blocks from a pool, which
+/// they go back to once the last reference to them is dropped, typically
+/// when the transport has sent them.
+grpc_slice AllocateProtoBufferWriterSlice(size_t length);
+}  // namespace internal
+
 const int kProtoBufferWriterMaxBufferLength = 1024 * 1024;
 
 /// This is a specialization of the protobuf class ZeroCopyOutputStream.
@@ -98,9 +106,10 @@ class ProtoBufferWriter : public grpc::protobuf::io::ZeroCopyOutputStream {
       // But make sure the allocated slice is not inlined.
       size_t allocate_length =
           remain > static_cast<size_t>(block_size_) ? block_size_ : remain;
-      slice_ = grpc_slice_malloc(allocate_length > GRPC_SLICE_INLINED_SIZE
-                                     ? allocate_length
-                                     : GRPC_SLICE_INLINED_SIZE + 1);
+      slice_ = internal::AllocateProtoBufferWriterSlice(
+          allocate_length > GRPC_SLICE_INLINED_SIZE
+              ? allocate_length
+              : GRPC_SLICE_INLINED_SIZE + 1);
     }
     *data = GRPC_SLICE_START_PTR(slice_);
     // On win x64, int is only 32bit
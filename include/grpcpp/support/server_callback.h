@@ -225,6 +225,8 @@ class ServerCallbackWriter : public internal::ServerCallbackCall {
   virtual void Finish(grpc::Status s) = 0;
   virtual void SendInitialMetadata() = 0;
   virtual void Write(const Response* msg, grpc::WriteOptions options) = 0;
+  virtual void WriteBatch(const Response* const* msgs, size_t count,
+                          grpc::WriteOptions options) = 0;
   virtual void WriteAndFinish(const Response* msg, grpc::WriteOptions options,
                               grpc::Status s) = 0;
 
@@ -243,6 +245,8 @@ class ServerCallbackReaderWriter : public internal::ServerCallbackCall {
   virtual void SendInitialMetadata() = 0;
   virtual void Read(Request* msg) = 0;
   virtual void Write(const Response* msg, grpc::WriteOptions options) = 0;
+  virtual void WriteBatch(const Response* const* msgs, size_t count,
+                          grpc::WriteOptions options) = 0;
   virtual void WriteAndFinish(const Response* msg, grpc::WriteOptions options,
                               grpc::Status s) = 0;
 
@@ -341,6 +345,40 @@ class ServerBidiReactor : public internal::ServerReactor {
     stream->Write(resp, options);
   }
 
+  /// Initiate a write of several messages as a single operation. The
+  /// messages are passed down the stack back to back, corked so that the
+  /// transport sends them together, and OnWriteDone is called once, when the
+  /// last of them has been written or any of them has failed. This is much
+  /// cheaper than a StartWrite per message for streams of small messages.
+  ///
+  /// \param[in] resps The messages to be written, in order. The library does
+  ///                  not take ownership but the caller must ensure that the
+  ///                  array and the messages are not deleted or modified
+  ///                  until OnWriteDone is called.
+  /// \param[in] count How many messages \a resps holds; at least one.
+  /// \param[in] options The WriteOptions to use for the batch. With
+  ///                    set_last_message, the batch is the last write.
+  void StartWriteBatch(const Response* const* resps, size_t count,
+                       grpc::WriteOptions options)
+      ABSL_LOCKS_EXCLUDED(stream_mu_) {
+    ServerCallbackReaderWriter<Request, Response>* stream =
+        stream_.load(std::memory_order_acquire);
+    if (stream == nullptr) {
+      grpc::internal::MutexLock l(&stream_mu_);
+      stream = stream_.load(std::memory_order_relaxed);
+      if (stream == nullptr) {
+        backlog_.write_batch_wanted = resps;
+        backlog_.write_batch_count_wanted = count;
+        backlog_.write_options_wanted = options;
+        return;
+      }
+    }
+    stream->WriteBatch(resps, count, options);
+  }
+  void StartWriteBatch(const Response* const* resps, size_t count) {
+    StartWriteBatch(resps, count, grpc::WriteOptions());
+  }
+
   /// Initiate a write operation with specified options and final RPC Status,
   /// which also causes any trailing metadata for this RPC to be sent out.
   /// StartWriteAndFinish is like merging StartWriteLast and Finish into a
@@ -426,6 +464,15 @@ class ServerBidiReactor : public internal::ServerReactor {
   ///               will succeed.
   virtual void OnWriteDone(bool /*ok*/) {}
 
+  /// Notifies the application, just before a successful OnWriteDone, how
+  /// many more bytes the transport could send on this stream right now
+  /// without waiting for the peer's flow control. Applications that produce
+  /// data faster than the peer consumes it can use this to pace or coalesce
+  /// their next writes. Not called if the transport does not report it.
+  ///
+  /// \param[in] bytes The send window left after what is already queued.
+  virtual void OnWritable(size_t /*bytes*/) {}
+
   /// Notifies the application that all operations associated with this RPC
   /// have completed. This is an override (from the internal base class) but
   /// still abstract, so derived classes MUST override it to be instantiated.
@@ -459,6 +506,11 @@ class ServerBidiReactor : public internal::ServerReactor {
         stream->Write(backlog_.write_wanted,
                       std::move(backlog_.write_options_wanted));
       }
+      if (GPR_UNLIKELY(backlog_.write_batch_wanted != nullptr)) {
+        stream->WriteBatch(backlog_.write_batch_wanted,
+                           backlog_.write_batch_count_wanted,
+                           std::move(backlog_.write_options_wanted));
+      }
       if (GPR_UNLIKELY(backlog_.finish_wanted)) {
         stream->Finish(std::move(backlog_.status_wanted));
       }
@@ -479,6 +531,8 @@ class ServerBidiReactor : public internal::ServerReactor {
     bool finish_wanted = false;
     Request* read_wanted = nullptr;
     const Response* write_wanted = nullptr;
+    const Response* const* write_batch_wanted = nullptr;
+    size_t write_batch_count_wanted = 0;
     grpc::WriteOptions write_options_wanted;
     grpc::Status status_wanted;
   };
@@ -612,6 +666,26 @@ class ServerWriteReactor : public internal::ServerReactor {
     }
     writer->Write(resp, options);
   }
+  void StartWriteBatch(const Response* const* resps, size_t count,
+                       grpc::WriteOptions options)
+      ABSL_LOCKS_EXCLUDED(writer_mu_) {
+    ServerCallbackWriter<Response>* writer =
+        writer_.load(std::memory_order_acquire);
+    if (writer == nullptr) {
+      grpc::internal::MutexLock l(&writer_mu_);
+      writer = writer_.load(std::memory_order_relaxed);
+      if (writer == nullptr) {
+        backlog_.write_batch_wanted = resps;
+        backlog_.write_batch_count_wanted = count;
+        backlog_.write_options_wanted = options;
+        return;
+      }
+    }
+    writer->WriteBatch(resps, count, options);
+  }
+  void StartWriteBatch(const Response* const* resps, size_t count) {
+    StartWriteBatch(resps, count, grpc::WriteOptions());
+  }
   void StartWriteAndFinish(const Response* resp, grpc::WriteOptions options,
                            grpc::Status s) ABSL_LOCKS_EXCLUDED(writer_mu_) {
     ServerCallbackWriter<Response>* writer =
@@ -650,6 +724,15 @@ class ServerWriteReactor : public internal::ServerReactor {
   /// The following notifications are exactly like ServerBidiReactor.
   virtual void OnSendInitialMetadataDone(bool /*ok*/) {}
   virtual void OnWriteDone(bool /*ok*/) {}
+
+  /// Notifies the application, just before a successful OnWriteDone, how
+  /// many more bytes the transport could send on this stream right now
+  /// without waiting for the peer's flow control. Applications that produce
+  /// data faster than the peer consumes it can use this to pace or coalesce
+  /// their next writes. Not called if the transport does not report it.
+  ///
+  /// \param[in] bytes The send window left after what is already queued.
+  virtual void OnWritable(size_t /*bytes*/) {}
   void OnDone() override = 0;
   void OnCancel() override {}
 
@@ -673,6 +756,11 @@ class ServerWriteReactor : public internal::ServerReactor {
         writer->Write(backlog_.write_wanted,
                       std::move(backlog_.write_options_wanted));
       }
+      if (GPR_UNLIKELY(backlog_.write_batch_wanted != nullptr)) {
+        writer->WriteBatch(backlog_.write_batch_wanted,
+                           backlog_.write_batch_count_wanted,
+                           std::move(backlog_.write_options_wanted));
+      }
       if (GPR_UNLIKELY(backlog_.finish_wanted)) {
         writer->Finish(std::move(backlog_.status_wanted));
       }
@@ -688,6 +776,8 @@ class ServerWriteReactor : public internal::ServerReactor {
     bool write_and_finish_wanted = false;
     bool finish_wanted = false;
     const Response* write_wanted = nullptr;
+    const Response* const* write_batch_wanted = nullptr;
+    size_t write_batch_count_wanted = 0;
     grpc::WriteOptions write_options_wanted;
     grpc::Status status_wanted;
   };
@@ -113,6 +113,8 @@ class ServerRpcInfo {
       if (interceptor != nullptr) {
         interceptors_.push_back(
             std::unique_ptr<experimental::Interceptor>(interceptor));
+        hook_masks_.push_back(interceptor->InterceptionHookMask());
+        hook_mask_ |= hook_masks_.back();
       }
     }
   }
@@ -129,6 +131,9 @@ class ServerRpcInfo {
   const Type type_;
   std::atomic<intptr_t> ref_{1};
   std::vector<std::unique_ptr<experimental::Interceptor>> interceptors_;
+  // The InterceptionHookMask() of each interceptor, and their union.
+  std::vector<uint32_t> hook_masks_;
+  uint32_t hook_mask_ = 0;
 
   friend class internal::InterceptorBatchMethodsImpl;
   friend class grpc::ServerContextBase;
@@ -673,6 +673,10 @@ void PrintHeaderClientMethodCallback(grpc_generator::Printer* printer,
                    "void $Method$(::grpc::ClientContext* context, "
                    "const $Request$* request, $Response$* response, "
                    "::grpc::ClientUnaryReactor* reactor) override;\n");
+    printer->Print(*vars,
+                   "void $Method$(::grpc::ClientContext* context, "
+                   "::grpc::MessageHolder< $Request$, $Response$>* messages, "
+                   "std::function<void(::grpc::Status)>);\n");
   } else if (ClientOnlyStreaming(method)) {
     printer->Print(*vars,
                    "void $Method$(::grpc::ClientContext* context, "
@@ -1729,6 +1733,18 @@ void PrintSourceClientMethod(grpc_generator::Printer* printer,
                    "(stub_->channel_.get(), stub_->rpcmethod_$Method$_, "
                    "context, request, response, reactor);\n}\n\n");
 
+    printer->Print(*vars,
+                   "void $ns$$Service$::Stub::async::$Method$("
+                   "::grpc::ClientContext* context, "
+                   "::grpc::MessageHolder< $Request$, $Response$>* messages, "
+                   "std::function<void(::grpc::Status)> f) {\n");
+    printer->Print(*vars,
+                   "  ::grpc::internal::CallbackUnaryCall"
+                   "< $Request$, $Response$, ::grpc::protobuf::MessageLite, "
+                   "::grpc::protobuf::MessageLite>"
+                   "(stub_->channel_.get(), stub_->rpcmethod_$Method$_, "
+                   "context, messages, std::move(f));\n}\n\n");
+
     printer->Print(*vars,
                    "::grpc::ClientAsyncResponseReader< $Response$>* "
                    "$ns$$Service$::Stub::PrepareAsync$Method$Raw(::grpc::"
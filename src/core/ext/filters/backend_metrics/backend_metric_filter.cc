@@ -49,10 +49,7 @@ namespace grpc_core {
 
 TraceFlag grpc_backend_metric_filter_trace(false, "backend_metric_filter");
 
-absl::optional<std::string> BackendMetricFilter::MaybeSerializeBackendMetrics(
-    BackendMetricProvider* provider) const {
-  if (provider == nullptr) return absl::nullopt;
-  BackendMetricData data = provider->GetBackendMetricData();
+Slice SerializeBackendMetricData(const BackendMetricData& data) {
   upb::Arena arena;
   xds_data_orca_v3_OrcaLoadReport* response =
       xds_data_orca_v3_OrcaLoadReport_new(arena.ptr());
@@ -86,12 +83,21 @@ absl::optional<std::string> BackendMetricFilter::MaybeSerializeBackendMetrics(
     has_data = true;
   }
   if (!has_data) {
-    return absl::nullopt;
+    return Slice();
   }
   size_t len;
   char* buf =
       xds_data_orca_v3_OrcaLoadReport_serialize(response, arena.ptr(), &len);
-  return std::string(buf, len);
+  return Slice::FromCopiedBuffer(buf, len);
+}
+
+Slice BackendMetricFilter::MaybeSerializeBackendMetrics(
+    BackendMetricProvider* provider) const {
+  if (provider == nullptr) return Slice();
+  // Metrics the provider keeps serialized already are sent as they are.
+  absl::optional<Slice> serialized = provider->GetSerializedBackendMetricData();
+  if (serialized.has_value()) return std::move(*serialized);
+  return SerializeBackendMetricData(provider->GetBackendMetricData());
 }
 
 const grpc_channel_filter BackendMetricFilter::kFilter =
@@ -116,17 +122,16 @@ ArenaPromise<ServerMetadataHandle> BackendMetricFilter::MakeCallPromise(
           }
           return trailing_metadata;
         }
-        absl::optional<std::string> serialized = MaybeSerializeBackendMetrics(
+        Slice serialized = MaybeSerializeBackendMetrics(
             reinterpret_cast<BackendMetricProvider*>(ctx->value));
-        if (serialized.has_value() && !serialized->empty()) {
+        if (!serialized.empty()) {
           if (GRPC_TRACE_FLAG_ENABLED(grpc_backend_metric_filter_trace)) {
             gpr_log(GPR_INFO,
                     "[%p] Backend metrics serialized. size: %" PRIuPTR, this,
-                    serialized->size());
+                    serialized.size());
           }
-          trailing_metadata->Set(
-              EndpointLoadMetricsBinMetadata(),
-              Slice::FromCopiedString(std::move(*serialized)));
+          trailing_metadata->Set(EndpointLoadMetricsBinMetadata(),
+                                 std::move(serialized));
         } else if (GRPC_TRACE_FLAG_ENABLED(grpc_backend_metric_filter_trace)) {
           gpr_log(GPR_INFO, "[%p] No backend metrics.", this);
         }
@@ -17,20 +17,24 @@
 
 #include <grpc/support/port_platform.h>
 
-#include <string>
-
 #include "absl/status/statusor.h"
 #include "absl/types/optional.h"
 
 #include "src/core/ext/filters/backend_metrics/backend_metric_provider.h"
+#include "src/core/ext/filters/client_channel/lb_policy/backend_metric_data.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/transport.h"
 
 namespace grpc_core {
 
+// Serializes \a data as an xds.data.orca.v3.OrcaLoadReport, the form sent in
+// endpoint-load-metrics-bin.  Returns an empty slice when no metric is set.
+Slice SerializeBackendMetricData(const BackendMetricData& data);
+
 class BackendMetricFilter : public ChannelFilter {
  public:
   static const grpc_channel_filter kFilter;
@@ -43,8 +47,7 @@ class BackendMetricFilter : public ChannelFilter {
       CallArgs call_args, NextPromiseFactory next_promise_factory) override;
 
  private:
-  absl::optional<std::string> MaybeSerializeBackendMetrics(
-      BackendMetricProvider* provider) const;
+  Slice MaybeSerializeBackendMetrics(BackendMetricProvider* provider) const;
 };
 
 }  // namespace grpc_core
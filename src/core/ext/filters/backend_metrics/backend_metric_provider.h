@@ -15,6 +15,10 @@
 #ifndef GRPC_SRC_CORE_EXT_FILTERS_BACKEND_METRICS_BACKEND_METRIC_PROVIDER_H
 #define GRPC_SRC_CORE_EXT_FILTERS_BACKEND_METRICS_BACKEND_METRIC_PROVIDER_H
 
+#include "absl/types/optional.h"
+
+#include "src/core/lib/slice/slice.h"
+
 namespace grpc_core {
 
 struct BackendMetricData;
@@ -22,6 +26,13 @@ class BackendMetricProvider {
  public:
   virtual ~BackendMetricProvider() = default;
   virtual BackendMetricData GetBackendMetricData() = 0;
+  // Returns the metrics already serialized as an OrcaLoadReport, if the
+  // provider keeps them that way (an empty slice if there are none), sparing
+  // a serialization per call.  Otherwise returns nullopt, and
+  // GetBackendMetricData() is serialized instead.
+  virtual absl::optional<Slice> GetSerializedBackendMetricData() {
+    return absl::nullopt;
+  }
 };
 
 }  // namespace grpc_core
@@ -22,6 +22,7 @@
 #include <stdlib.h>
 
 #include <functional>
+#include <memory>
 #include <utility>
 
 #include "absl/types/optional.h"
@@ -169,7 +170,7 @@ void MaxAgeFilter::PostInit() {
     max_age_activity_.Set(MakeActivity(
         TrySeq(
             // First sleep until the max connection age
-            Sleep(Timestamp::Now() + max_connection_age_),
+            Sleep(Timestamp::Now() + CoarseTimeout(max_connection_age_)),
             // Then send a goaway.
             [this] {
               GRPC_CHANNEL_STACK_REF(this->channel_stack(),
@@ -228,19 +229,19 @@ bool ChannelIdleFilter::StartTransportOp(grpc_transport_op* op) {
 void ChannelIdleFilter::Shutdown() {
   // IncreaseCallCount() introduces a phony call and prevent the timer from
   // being reset by other threads.
-  IncreaseCallCount();
+  (void)idle_filter_state_->IncreaseCallCount();
   activity_.Reset();
 }
 
 void ChannelIdleFilter::IncreaseCallCount() {
-  idle_filter_state_->IncreaseCallCount();
+  if (idle_filter_state_->IncreaseCallCount()) {
+    // If there is no timer watching the channel, start the idle timer.
+    StartIdleTimer();
+  }
 }
 
 void ChannelIdleFilter::DecreaseCallCount() {
-  if (idle_filter_state_->DecreaseCallCount()) {
-    // If there are no more calls in progress, start the idle timer.
-    StartIdleTimer();
-  }
+  idle_filter_state_->DecreaseCallCount();
 }
 
 void ChannelIdleFilter::StartIdleTimer() {
@@ -249,15 +250,22 @@ void ChannelIdleFilter::StartIdleTimer() {
   // Hold a ref to the channel stack for the timer callback.
   auto channel_stack = channel_stack_->Ref();
   auto timeout = client_idle_timeout_;
-  auto promise = Loop([timeout, idle_filter_state]() {
-    return TrySeq(Sleep(Timestamp::Now() + timeout),
-                  [idle_filter_state]() -> Poll<LoopCtl<absl::Status>> {
-                    if (idle_filter_state->CheckTimer()) {
-                      return Continue{};
-                    } else {
-                      return absl::OkStatus();
-                    }
-                  });
+  // When the timer next fires, as CheckTimer() last said.
+  auto next_check =
+      std::make_shared<Timestamp>(Timestamp::Now() + CoarseTimeout(timeout));
+  auto promise = Loop([timeout, idle_filter_state, next_check]() {
+    return TrySeq(
+        Sleep(*next_check),
+        [timeout, idle_filter_state,
+         next_check]() -> Poll<LoopCtl<absl::Status>> {
+          auto next = idle_filter_state->CheckTimer(timeout);
+          if (next.has_value()) {
+            *next_check = *next;
+            return Continue{};
+          } else {
+            return absl::OkStatus();
+          }
+        });
   });
   activity_.Set(MakeActivity(
       std::move(promise), ExecCtxWakeupScheduler{},
@@ -16,81 +16,68 @@
 
 #include "src/core/ext/filters/channel_idle/idle_filter_state.h"
 
-#include <assert.h>
+#include <algorithm>
 
 namespace grpc_core {
 
 IdleFilterState::IdleFilterState(bool start_timer)
-    : state_(start_timer ? kTimerStarted : 0) {}
+    : timer_started_(start_timer) {}
 
-void IdleFilterState::IncreaseCallCount() {
-  uintptr_t state = state_.load(std::memory_order_relaxed);
-  uintptr_t new_state;
-  do {
-    // Increment the counter, and flag that there's been activity.
-    new_state = state;
-    new_state |= kCallsStartedSinceLastTimerCheck;
-    new_state += kCallIncrement;
-  } while (!state_.compare_exchange_weak(
-      state, new_state, std::memory_order_acq_rel, std::memory_order_relaxed));
+bool IdleFilterState::IncreaseCallCount() {
+  // Sequentially consistent, to pair with CheckTimer(): either the timer is
+  // seen stopped here, or this call is seen in progress there.
+  shards_.this_cpu().calls.fetch_add(1, std::memory_order_seq_cst);
+  if (timer_started_.load(std::memory_order_seq_cst)) return false;
+  bool expected = false;
+  return timer_started_.compare_exchange_strong(expected, true,
+                                                std::memory_order_seq_cst);
 }
 
-bool IdleFilterState::DecreaseCallCount() {
-  uintptr_t state = state_.load(std::memory_order_relaxed);
-  uintptr_t new_state;
-  bool start_timer;
-  do {
-    start_timer = false;
-    new_state = state;
-    // Decrement call count (and assert there's at least one call outstanding!)
-    assert(new_state >= kCallIncrement);
-    new_state -= kCallIncrement;
-    // If that decrement reaches a call count of zero and we have not started a
-    // timer
-    if ((new_state >> kCallsInProgressShift) == 0 &&
-        (new_state & kTimerStarted) == 0) {
-      // Flag that we will start a timer, and mark it started so nobody else
-      // does.
-      start_timer = true;
-      new_state |= kTimerStarted;
-      new_state &= ~kCallsInProgressShift;
-    }
-  } while (!state_.compare_exchange_weak(
-      state, new_state, std::memory_order_acq_rel, std::memory_order_relaxed));
-  return start_timer;
+void IdleFilterState::DecreaseCallCount() {
+  Shard& shard = shards_.this_cpu();
+  shard.last_finished.store(
+      static_cast<int64_t>(Timestamp::Now().milliseconds_after_process_epoch()),
+      std::memory_order_relaxed);
+  // Release, so that whoever sees the call finished sees when.
+  shard.calls.fetch_sub(1, std::memory_order_release);
 }
 
-bool IdleFilterState::CheckTimer() {
-  uintptr_t state = state_.load(std::memory_order_relaxed);
-  uintptr_t new_state;
-  bool start_timer;
-  do {
-    if ((state >> kCallsInProgressShift) != 0) {
-      // Still calls in progress: nothing needs updating, just return
-      // and keep the timer going!
-      return true;
-    }
-    new_state = state;
-    bool is_active = false;
-    if (new_state & kCallsStartedSinceLastTimerCheck) {
-      // If any calls started since the last time we checked, then consider the
-      // channel still active and try again.
-      is_active = true;
-      new_state &= ~kCallsStartedSinceLastTimerCheck;
-    }
-    if (is_active) {
-      // If we are still active, we should signal that the timer should start
-      // again.
-      start_timer = true;
-    } else {
-      // Otherwise, we should not start the timer again, and we should signal
-      // that in the updated state.
-      start_timer = false;
-      new_state &= ~kTimerStarted;
-    }
-  } while (!state_.compare_exchange_weak(
-      state, new_state, std::memory_order_acq_rel, std::memory_order_relaxed));
-  return start_timer;
+absl::optional<Timestamp> IdleFilterState::IdleAfter(Duration idle_timeout) {
+  intptr_t calls = 0;
+  int64_t last_finished = 0;
+  for (Shard& shard : shards_) {
+    calls += shard.calls.load(std::memory_order_seq_cst);
+    last_finished = std::max(
+        last_finished, shard.last_finished.load(std::memory_order_relaxed));
+  }
+  if (calls != 0) return absl::nullopt;
+  return Timestamp::FromMillisecondsAfterProcessEpoch(last_finished) +
+         idle_timeout;
+}
+
+absl::optional<Timestamp> IdleFilterState::CheckTimer(Duration idle_timeout) {
+  const Timestamp now = Timestamp::Now();
+  absl::optional<Timestamp> idle_after = IdleAfter(idle_timeout);
+  // Still calls in progress: check again a full timeout from now, since the
+  // channel cannot go idle any sooner.
+  if (!idle_after.has_value()) return now + idle_timeout;
+  // A call finished less than a timeout ago: check again once it is a
+  // timeout ago.
+  if (*idle_after > now) return *idle_after;
+  // Otherwise, we should not start the timer again, and we should signal
+  // that in the updated state.
+  timer_started_.store(false, std::memory_order_seq_cst);
+  // A call may have started after the shards were added up, and seen the
+  // timer still started.  If so, take the timer back for it, unless another
+  // one has been started since.
+  idle_after = IdleAfter(idle_timeout);
+  if (idle_after.has_value() && *idle_after <= now) return absl::nullopt;
+  bool expected = false;
+  if (!timer_started_.compare_exchange_strong(expected, true,
+                                              std::memory_order_seq_cst)) {
+    return absl::nullopt;
+  }
+  return idle_after.value_or(now + idle_timeout);
 }
 
 }  // namespace grpc_core
@@ -17,15 +17,27 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <atomic>
 
+#include "absl/types/optional.h"
+
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/time.h"
+
 namespace grpc_core {
 
 // State machine for the idle filter.
 // Keeps track of how many calls are in progress, whether there is a timer
-// started, and whether we've seen calls since the previous timer fired.
+// started, and when the last call finished.
+//
+// Calls only update a per-CPU shard; the shards are added up when the timer
+// fires.  So the timer is started by the first call, rather than by the last
+// one to finish, and runs for as long as the channel is in use.
 class IdleFilterState {
  public:
   explicit IdleFilterState(bool start_timer);
@@ -35,32 +47,39 @@ class IdleFilterState {
   IdleFilterState& operator=(const IdleFilterState&) = delete;
 
   // Increment the number of calls in progress.
-  void IncreaseCallCount();
+  // Return true if there was no timer started: the caller must start one.
+  GRPC_MUST_USE_RESULT bool IncreaseCallCount();
 
   // Decrement the number of calls in progress.
-  // Return true if we reached idle with no timer started.
-  GRPC_MUST_USE_RESULT bool DecreaseCallCount();
+  void DecreaseCallCount();
 
-  // Check if there's been any activity since the last timer check.
-  // If there was, reset the activity flag and return true to indicated that
-  // a new timer should be started.
-  // If there was not, reset the timer flag and return false - in this case
-  // we know that the channel is idle and has been for one full cycle.
-  GRPC_MUST_USE_RESULT bool CheckTimer();
+  // Check whether the channel has been idle for \a idle_timeout: no calls in
+  // progress, and none finished in that time.
+  // If it has not, return when the timer should next fire.
+  // If it has, reset the timer flag and return nullopt - the channel is idle.
+  GRPC_MUST_USE_RESULT absl::optional<Timestamp> CheckTimer(
+      Duration idle_timeout);
 
  private:
-  // Bit in state_ indicating that the timer has been started.
-  static constexpr uintptr_t kTimerStarted = 1;
-  // Bit in state_ indicating that we've seen a call start or stop since the
-  // last timer.
-  static constexpr uintptr_t kCallsStartedSinceLastTimerCheck = 2;
-  // How much should we shift to get the number of calls in progress.
-  static constexpr uintptr_t kCallsInProgressShift = 2;
-  // How much to increment/decrement the state_ when a call is started/stopped.
-  // Ensures we don't clobber the preceding bits.
-  static constexpr uintptr_t kCallIncrement = uintptr_t{1}
-                                              << kCallsInProgressShift;
-  std::atomic<uintptr_t> state_;
+  // Channels are numerous: past this many CPUs, shards are shared.
+  static constexpr size_t kMaxShards = 16;
+
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    // Calls started minus calls finished on this CPU. Calls may finish on
+    // another CPU than they started on, so only the sum over all shards is
+    // meaningful.
+    std::atomic<intptr_t> calls{0};
+    // When a call last finished on this CPU, in milliseconds after the
+    // process epoch.
+    std::atomic<int64_t> last_finished{0};
+  };
+
+  // When the channel can go idle at the earliest, or nullopt while calls are
+  // in progress.
+  absl::optional<Timestamp> IdleAfter(Duration idle_timeout);
+
+  PerCpu<Shard> shards_{kMaxShards};
+  std::atomic<bool> timer_started_;
 };
 
 }  // namespace grpc_core
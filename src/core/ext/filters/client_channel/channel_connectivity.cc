@@ -244,6 +244,54 @@ class StateWatcher : public DualRefCounted<StateWatcher> {
   bool timer_fired_ = false;
 };
 
+// Completes a grpc_channel_watch_warm() call on its CQ.
+class WarmWatcher {
+ public:
+  WarmWatcher(grpc_channel* c_channel, grpc_completion_queue* cq, void* tag,
+              double fraction, gpr_timespec deadline)
+      : channel_(Channel::FromC(c_channel)->Ref()), cq_(cq), tag_(tag) {
+    GPR_ASSERT(grpc_cq_begin_op(cq, tag));
+    GRPC_CLOSURE_INIT(&on_complete_, WatchComplete, this, nullptr);
+    ClientChannel* client_channel =
+        ClientChannel::GetFromChannel(channel_.get());
+    if (client_channel == nullptr) {
+      // A lame channel has no backends to connect to.
+      if (IsLameChannel(channel_.get())) {
+        ExecCtx::Run(DEBUG_LOCATION, &on_complete_,
+                     GRPC_ERROR_CREATE("Lame channel cannot warm up"));
+        return;
+      }
+      Crash(
+          "grpc_channel_watch_warm called on something that is not a client "
+          "channel");
+    }
+    client_channel->AddWarmWatcher(
+        grpc_polling_entity_create_from_pollset(grpc_cq_pollset(cq)), fraction,
+        Timestamp::FromTimespecRoundUp(deadline), &on_complete_);
+  }
+
+ private:
+  static void WatchComplete(void* arg, grpc_error_handle error) {
+    auto* self = static_cast<WarmWatcher*>(arg);
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_operation_failures)) {
+      GRPC_LOG_IF_ERROR("warm_watch_completion_error", error);
+    }
+    grpc_cq_end_op(self->cq_, self->tag_, error, FinishedCompletion, self,
+                   &self->completion_storage_);
+  }
+
+  // Called when the completion is returned to the CQ.
+  static void FinishedCompletion(void* arg, grpc_cq_completion* /*ignored*/) {
+    delete static_cast<WarmWatcher*>(arg);
+  }
+
+  RefCountedPtr<Channel> channel_;
+  grpc_completion_queue* cq_;
+  void* tag_;
+  grpc_cq_completion completion_storage_;
+  grpc_closure on_complete_;
+};
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -263,3 +311,20 @@ void grpc_channel_watch_connectivity_state(
        (int)deadline.clock_type, cq, tag));
   new grpc_core::StateWatcher(channel, cq, tag, last_observed_state, deadline);
 }
+
+void grpc_channel_watch_warm(grpc_channel* channel, double fraction,
+                             gpr_timespec deadline, grpc_completion_queue* cq,
+                             void* tag) {
+  grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+  grpc_core::ExecCtx exec_ctx;
+  GRPC_API_TRACE(
+      "grpc_channel_watch_warm("
+      "channel=%p, fraction=%f, "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "cq=%p, tag=%p)",
+      7,
+      (channel, fraction, deadline.tv_sec, deadline.tv_nsec,
+       (int)deadline.clock_type, cq, tag));
+  new grpc_core::WarmWatcher(channel, cq, tag, fraction, deadline);
+}
@@ -49,6 +49,7 @@
 #include "src/core/ext/filters/client_channel/client_channel_channelz.h"
 #include "src/core/ext/filters/client_channel/client_channel_service_config.h"
 #include "src/core/ext/filters/client_channel/config_selector.h"
+#include "src/core/ext/filters/client_channel/connection_attempt_scheduler.h"
 #include "src/core/ext/filters/client_channel/dynamic_filters.h"
 #include "src/core/ext/filters/client_channel/global_subchannel_pool.h"
 #include "src/core/ext/filters/client_channel/lb_policy/child_policy_handler.h"
@@ -460,6 +461,7 @@ class ClientChannel::SubchannelWrapper : public SubchannelInterface {
               chand_, this, subchannel_.get());
     }
     chand_->subchannel_wrappers_.erase(this);
+    chand_->CheckWarmWatchersLocked();
     if (chand_->channelz_node_ != nullptr) {
       auto* subchannel_node = subchannel_->channelz_node();
       if (subchannel_node != nullptr) {
@@ -502,8 +504,16 @@ class ClientChannel::SubchannelWrapper : public SubchannelInterface {
     return subchannel_->connected_subchannel();
   }
 
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannel() const {
+    return subchannel_->PickConnectedSubchannel();
+  }
+
   void RequestConnection() override { subchannel_->RequestConnection(); }
 
+  void PrioritizeConnectionAttempt() {
+    subchannel_->PrioritizeConnectionAttempt();
+  }
+
   void ResetBackoff() override { subchannel_->ResetBackoff(); }
 
   void AddDataWatcher(std::unique_ptr<DataWatcherInterface> watcher) override
@@ -519,6 +529,11 @@ class ClientChannel::SubchannelWrapper : public SubchannelInterface {
     subchannel_->ThrottleKeepaliveTime(new_keepalive_time);
   }
 
+  grpc_connectivity_state state() const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*chand_->work_serializer_) {
+    return state_;
+  }
+
  private:
   // Subchannel and SubchannelInterface have different interfaces for
   // their respective ConnectivityStateWatcherInterface classes.
@@ -632,6 +647,14 @@ class ClientChannel::SubchannelWrapper : public SubchannelInterface {
         watcher_->OnConnectivityStateChange(
             state, state == GRPC_CHANNEL_TRANSIENT_FAILURE ? status
                                                            : absl::OkStatus());
+        parent_->state_ = state;
+        // While warm watchers are pending, reconnect as soon as possible.
+        if (!parent_->chand_->warm_watchers_.empty()) {
+          if (state == GRPC_CHANNEL_IDLE) {
+            parent_->subchannel_->RequestConnection();
+          }
+          parent_->chand_->CheckWarmWatchersLocked();
+        }
       }
     }
 
@@ -644,6 +667,9 @@ class ClientChannel::SubchannelWrapper : public SubchannelInterface {
   ClientChannel* chand_;
   RefCountedPtr<Subchannel> subchannel_;
   absl::optional<std::string> health_check_service_name_;
+  // The last state reported to the LB policy, for warm watchers.
+  grpc_connectivity_state state_ ABSL_GUARDED_BY(*chand_->work_serializer_) =
+      GRPC_CHANNEL_IDLE;
   // Maps from the address of the watcher passed to us by the LB policy
   // to the address of the WrapperWatcher that we passed to the underlying
   // subchannel.  This is needed so that when the LB policy calls
@@ -1060,6 +1086,10 @@ ClientChannel::~ClientChannel() {
     gpr_log(GPR_INFO, "chand=%p: destroying channel", this);
   }
   DestroyResolverAndLbPolicyLocked();
+  // No calls are left to read the picker.
+  LoadBalancingPolicy::SubchannelPicker* picker =
+      picker_.exchange(nullptr, std::memory_order_relaxed);
+  if (picker != nullptr) picker->Unref();
   // Stop backup polling.
   grpc_client_channel_stop_backup_polling(interested_parties_);
   grpc_pollset_set_destroy(interested_parties_);
@@ -1268,7 +1298,8 @@ void ClientChannel::OnResolverResultChangedLocked(Resolver::Result result) {
     // Create or update LB policy, as needed.
     resolver_result_status = CreateOrUpdateLbPolicyLocked(
         std::move(lb_policy_config),
-        parsed_service_config->health_check_service_name(), std::move(result));
+        parsed_service_config->health_check_service_name(), std::move(result),
+        /*config_changed=*/service_config_changed || config_selector_changed);
     if (service_config_changed || config_selector_changed) {
       // Start using new service config for calls.
       // This needs to happen after the LB policy has been updated, since
@@ -1331,7 +1362,7 @@ void ClientChannel::OnResolverErrorLocked(absl::Status status) {
 absl::Status ClientChannel::CreateOrUpdateLbPolicyLocked(
     RefCountedPtr<LoadBalancingPolicy::Config> lb_policy_config,
     const absl::optional<std::string>& health_check_service_name,
-    Resolver::Result result) {
+    Resolver::Result result, bool config_changed) {
   // Construct update.
   LoadBalancingPolicy::UpdateArgs update_args;
   update_args.addresses = std::move(result.addresses);
@@ -1346,6 +1377,29 @@ absl::Status ClientChannel::CreateOrUpdateLbPolicyLocked(
     update_args.args = update_args.args.Set(GRPC_ARG_HEALTH_CHECK_SERVICE_NAME,
                                             *health_check_service_name);
   }
+  // Polling resolvers report the same result each time they re-resolve.
+  // Drop results that repeat the last update the LB policy accepted,
+  // since applying one walks the whole policy tree.
+  if (!config_changed && lb_policy_ != nullptr &&
+      last_accepted_lb_update_.has_value() && update_args.addresses.ok() &&
+      *update_args.addresses == last_accepted_lb_update_->addresses &&
+      update_args.resolution_note ==
+          last_accepted_lb_update_->resolution_note &&
+      update_args.args == last_accepted_lb_update_->args) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_trace)) {
+      gpr_log(GPR_INFO,
+              "chand=%p: resolver result unchanged; not updating child "
+              "policy %p",
+              this, lb_policy_.get());
+    }
+    return absl::OkStatus();
+  }
+  absl::optional<AcceptedLbUpdate> accepted_update;
+  if (update_args.addresses.ok()) {
+    accepted_update = AcceptedLbUpdate{
+        *update_args.addresses, update_args.resolution_note, update_args.args};
+  }
+  last_accepted_lb_update_.reset();
   // Create policy if needed.
   if (lb_policy_ == nullptr) {
     lb_policy_ = CreateLbPolicyLocked(update_args.args);
@@ -1355,7 +1409,9 @@ absl::Status ClientChannel::CreateOrUpdateLbPolicyLocked(
     gpr_log(GPR_INFO, "chand=%p: Updating child policy %p", this,
             lb_policy_.get());
   }
-  return lb_policy_->UpdateLocked(std::move(update_args));
+  absl::Status status = lb_policy_->UpdateLocked(std::move(update_args));
+  if (status.ok()) last_accepted_lb_update_ = std::move(accepted_update);
+  return status;
 }
 
 // Creates a new LB policy.
@@ -1526,6 +1582,7 @@ void ClientChannel::DestroyResolverAndLbPolicyLocked() {
       grpc_pollset_set_del_pollset_set(lb_policy_->interested_parties(),
                                        interested_parties_);
       lb_policy_.reset();
+      last_accepted_lb_update_.reset();
     }
   }
 }
@@ -1562,32 +1619,136 @@ void ClientChannel::UpdateStateAndPickerLocked(
             channelz::ChannelNode::GetChannelConnectivityStateChangeString(
                 state)));
   }
-  // Grab data plane lock to update the picker.
+  // Grab data plane lock to update the picker and to hand the queued
+  // picks over to it.  The queued picks are done in their own callbacks,
+  // after the lock is released.
   {
     MutexLock lock(&data_plane_mu_);
     // Swap out the picker.
-    // Note: Original value will be destroyed after the lock is released.
-    picker_.swap(picker);
+    // Note: Picks may still be using the original value, so it is only
+    // released once they are done, by ReclaimPickersLocked().
+    picker = RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>(
+        picker_.exchange(picker.release(), std::memory_order_seq_cst));
     // Re-process queued picks.
-    for (LbQueuedCall* call = lb_queued_calls_; call != nullptr;
-         call = call->next) {
-      // If there are a lot of queued calls here, resuming them all may cause us
-      // to stay inside C-core for a long period of time. All of that work would
-      // be done using the same ExecCtx instance and therefore the same cached
-      // value of "now". The longer it takes to finish all of this work and exit
-      // from C-core, the more stale the cached value of "now" may become. This
-      // can cause problems whereby (e.g.) we calculate a timer deadline based
-      // on the stale value, which results in the timer firing too early. To
-      // avoid this, we invalidate the cached value for each call we process.
-      ExecCtx::Get()->InvalidateNow();
-      grpc_error_handle error;
-      if (call->lb_call->PickSubchannelLocked(&error)) {
-        call->lb_call->AsyncPickDone(error);
+    LbQueuedCall* call = lb_queued_calls_;
+    while (call != nullptr) {
+      LbQueuedCall* next = call->next;
+      call->lb_call->RetryPickLocked();
+      call = next;
+    }
+  }
+  if (picker != nullptr) replaced_pickers_.push_back(std::move(picker));
+  ReclaimPickersLocked();
+}
+
+//
+// ClientChannel::PickerReader
+//
+
+// The picker is published to the data plane without a lock, using two
+// alternating epochs: each reader is counted in the epoch it saw when it
+// started, and a picker replaced in one epoch is released once the next
+// one has started and every reader counted in the old one has left.
+// A reader that sees the epoch change while entering leaves and enters
+// again, so that none can enter an epoch after its readers were counted.
+ClientChannel::PickerReader::PickerReader(ClientChannel* chand)
+    : chand_(chand) {
+  PickerReaderCount& readers = chand_->picker_readers_.this_cpu();
+  while (true) {
+    epoch_ = chand_->picker_epoch_.load(std::memory_order_seq_cst);
+    count_ = &readers.count[epoch_ & 1];
+    count_->fetch_add(1, std::memory_order_seq_cst);
+    if (GPR_LIKELY(chand_->picker_epoch_.load(std::memory_order_seq_cst) ==
+                   epoch_)) {
+      break;
+    }
+    Leave();
+  }
+  picker_ = chand_->picker_.load(std::memory_order_seq_cst);
+}
+
+void ClientChannel::PickerReader::Leave() {
+  count_->fetch_sub(1, std::memory_order_seq_cst);
+  // The last readers of an old epoch have to let the control plane know
+  // that the pickers replaced in it can be released.
+  if (GPR_UNLIKELY(chand_->picker_epoch_.load(std::memory_order_seq_cst) !=
+                   epoch_)) {
+    chand_->ScheduleReclaimPickers();
+  }
+}
+
+void ClientChannel::ReclaimPickersLocked() {
+  while (true) {
+    if (!retiring_pickers_.empty()) {
+      const uint32_t previous_epoch =
+          picker_epoch_.load(std::memory_order_relaxed) - 1;
+      intptr_t readers = 0;
+      for (const PickerReaderCount& count : picker_readers_) {
+        readers += count.count[previous_epoch & 1].load(
+            std::memory_order_seq_cst);
       }
+      if (readers != 0) return;
+      retiring_pickers_.clear();
     }
+    if (replaced_pickers_.empty()) return;
+    retiring_pickers_.swap(replaced_pickers_);
+    picker_epoch_.fetch_add(1, std::memory_order_seq_cst);
   }
 }
 
+void ClientChannel::ScheduleReclaimPickers() {
+  if (picker_reclamation_scheduled_.exchange(true,
+                                             std::memory_order_acq_rel)) {
+    return;
+  }
+  // Readers may be holding the data plane mutex or the call combiner, so
+  // bounce through the ExecCtx before entering the WorkSerializer.
+  GRPC_CHANNEL_STACK_REF(owning_stack_, "ReclaimPickers");
+  ExecCtx::Run(
+      DEBUG_LOCATION,
+      GRPC_CLOSURE_CREATE(
+          [](void* arg, grpc_error_handle /*error*/) {
+            auto* chand = static_cast<ClientChannel*>(arg);
+            chand->work_serializer_->Run(
+                [chand]()
+                    ABSL_EXCLUSIVE_LOCKS_REQUIRED(*chand->work_serializer_) {
+                      chand->picker_reclamation_scheduled_.store(
+                          false, std::memory_order_seq_cst);
+                      chand->ReclaimPickersLocked();
+                      GRPC_CHANNEL_STACK_UNREF(chand->owning_stack_,
+                                               "ReclaimPickers");
+                    },
+                DEBUG_LOCATION);
+          },
+          this, nullptr),
+      absl::OkStatus());
+}
+
+void ClientChannel::SchedulePrioritizeConnectionAttempts() {
+  // Called with the data plane mutex held, so bounce through the ExecCtx
+  // before entering the WorkSerializer.
+  GRPC_CHANNEL_STACK_REF(owning_stack_, "PrioritizeConnectionAttempts");
+  ExecCtx::Run(
+      DEBUG_LOCATION,
+      GRPC_CLOSURE_CREATE(
+          [](void* arg, grpc_error_handle /*error*/) {
+            auto* chand = static_cast<ClientChannel*>(arg);
+            chand->work_serializer_->Run(
+                [chand]()
+                    ABSL_EXCLUSIVE_LOCKS_REQUIRED(*chand->work_serializer_) {
+                      for (SubchannelWrapper* subchannel_wrapper :
+                           chand->subchannel_wrappers_) {
+                        subchannel_wrapper->PrioritizeConnectionAttempt();
+                      }
+                      GRPC_CHANNEL_STACK_UNREF(chand->owning_stack_,
+                                               "PrioritizeConnectionAttempts");
+                    },
+                DEBUG_LOCATION);
+          },
+          this, nullptr),
+      absl::OkStatus());
+}
+
 namespace {
 
 // TODO(roth): Remove this in favor of the gprpp Match() function once
@@ -1626,11 +1787,11 @@ grpc_error_handle ClientChannel::DoPingLocked(grpc_transport_op* op) {
   if (state_tracker_.state() != GRPC_CHANNEL_READY) {
     return GRPC_ERROR_CREATE("channel not connected");
   }
-  LoadBalancingPolicy::PickResult result;
-  {
-    MutexLock lock(&data_plane_mu_);
-    result = picker_->Pick(LoadBalancingPolicy::PickArgs());
-  }
+  // The picker is only replaced in the WorkSerializer, so it cannot be
+  // released while this runs.
+  LoadBalancingPolicy::PickResult result =
+      picker_.load(std::memory_order_relaxed)
+          ->Pick(LoadBalancingPolicy::PickArgs());
   return HandlePickResult<grpc_error_handle>(
       &result,
       // Complete pick.
@@ -1712,6 +1873,10 @@ void ClientChannel::StartTransportOpLocked(grpc_transport_op* op) {
           GRPC_CHANNEL_SHUTDOWN, absl::Status(), "shutdown from API",
           MakeRefCounted<LoadBalancingPolicy::TransientFailurePicker>(
               grpc_error_to_absl_status(op->disconnect_with_error)));
+      while (!warm_watchers_.empty()) {
+        FinishWarmWatcherLocked(warm_watchers_.begin()->first,
+                                disconnect_error_);
+      }
     }
   }
   GRPC_CHANNEL_STACK_UNREF(owning_stack_, "start_transport_op");
@@ -1750,6 +1915,12 @@ void ClientChannel::GetChannelInfo(grpc_channel_element* elem,
 
 void ClientChannel::AddLbQueuedCall(LbQueuedCall* call,
                                     grpc_polling_entity* pollent) {
+  // If connection attempts are waiting their turn, the ones for this
+  // channel now have calls waiting on them.
+  if (lb_queued_calls_ == nullptr &&
+      ConnectionAttemptScheduler::Get()->HasWaitingAttempts()) {
+    SchedulePrioritizeConnectionAttempts();
+  }
   // Add call to queued picks list.
   call->next = lb_queued_calls_;
   lb_queued_calls_ = call;
@@ -1797,6 +1968,89 @@ grpc_connectivity_state ClientChannel::CheckConnectivityState(
   return out;
 }
 
+void ClientChannel::AddWarmWatcher(grpc_polling_entity pollent,
+                                   double fraction, Timestamp deadline,
+                                   grpc_closure* on_complete) {
+  grpc_polling_entity_add_to_pollset_set(&pollent, interested_parties_);
+  GRPC_CHANNEL_STACK_REF(owning_stack_, "WarmWatcher");
+  work_serializer_->Run(
+      [this, watcher = WarmWatcher{pollent, fraction, on_complete, {}},
+       deadline]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_) {
+        AddWarmWatcherLocked(watcher, deadline);
+      },
+      DEBUG_LOCATION);
+}
+
+void ClientChannel::AddWarmWatcherLocked(WarmWatcher watcher,
+                                         Timestamp deadline) {
+  const uint64_t id = next_warm_watcher_id_++;
+  warm_watchers_.emplace(id, watcher);
+  if (!disconnect_error_.ok()) {
+    FinishWarmWatcherLocked(id, disconnect_error_);
+    return;
+  }
+  GRPC_CHANNEL_STACK_REF(owning_stack_, "WarmWatcherTimer");
+  warm_watchers_[id].timer_handle = owning_stack_->EventEngine()->RunAfter(
+      deadline - Timestamp::Now(), [this, id] {
+        ApplicationCallbackExecCtx callback_exec_ctx;
+        ExecCtx exec_ctx;
+        work_serializer_->Run(
+            [this, id]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_) {
+              auto it = warm_watchers_.find(id);
+              if (it != warm_watchers_.end()) {
+                it->second.timer_handle.reset();
+                FinishWarmWatcherLocked(
+                    id, GRPC_ERROR_CREATE(
+                            "Timed out waiting for channel to warm up"));
+              }
+              GRPC_CHANNEL_STACK_UNREF(owning_stack_, "WarmWatcherTimer");
+            },
+            DEBUG_LOCATION);
+      });
+  // Have the resolver and LB policy start, then connect every subchannel
+  // we know of.  Subchannels created later are connected when they first
+  // report IDLE.
+  if (lb_policy_ != nullptr) {
+    lb_policy_->ExitIdleLocked();
+  } else if (resolver_ == nullptr) {
+    CreateResolverLocked();
+  }
+  for (SubchannelWrapper* subchannel_wrapper : subchannel_wrappers_) {
+    subchannel_wrapper->RequestConnection();
+  }
+  CheckWarmWatchersLocked();
+}
+
+void ClientChannel::CheckWarmWatchersLocked() {
+  if (warm_watchers_.empty() || subchannel_wrappers_.empty()) return;
+  size_t ready = 0;
+  for (SubchannelWrapper* subchannel_wrapper : subchannel_wrappers_) {
+    if (subchannel_wrapper->state() == GRPC_CHANNEL_READY) ++ready;
+  }
+  const double ready_fraction =
+      static_cast<double>(ready) / subchannel_wrappers_.size();
+  std::vector<uint64_t> warm;
+  for (const auto& p : warm_watchers_) {
+    if (ready_fraction >= p.second.fraction) warm.push_back(p.first);
+  }
+  for (uint64_t id : warm) FinishWarmWatcherLocked(id, absl::OkStatus());
+}
+
+void ClientChannel::FinishWarmWatcherLocked(uint64_t id,
+                                            grpc_error_handle error) {
+  auto it = warm_watchers_.find(id);
+  WarmWatcher& watcher = it->second;
+  if (watcher.timer_handle.has_value() &&
+      owning_stack_->EventEngine()->Cancel(*watcher.timer_handle)) {
+    GRPC_CHANNEL_STACK_UNREF(owning_stack_, "WarmWatcherTimer");
+  }
+  grpc_polling_entity_del_from_pollset_set(&watcher.pollent,
+                                           interested_parties_);
+  ExecCtx::Run(DEBUG_LOCATION, watcher.on_complete, error);
+  warm_watchers_.erase(it);
+  GRPC_CHANNEL_STACK_UNREF(owning_stack_, "WarmWatcher");
+}
+
 void ClientChannel::AddConnectivityWatcher(
     grpc_connectivity_state initial_state,
     OrphanablePtr<AsyncConnectivityStateWatcherInterface> watcher) {
@@ -2212,6 +2466,16 @@ grpc_error_handle ClientChannel::CallData::ApplyServiceConfigToCallLocked(
           !wait_for_ready->explicitly_set) {
         wait_for_ready->value = method_params->wait_for_ready().value();
       }
+      // If the service config set a write weight and the application did
+      // not send one, use the value from the service config.
+      grpc_metadata_batch* send_initial_metadata =
+          pending_batches_[0]
+              ->payload->send_initial_metadata.send_initial_metadata;
+      if (method_params->write_weight().has_value() &&
+          !send_initial_metadata->get(GrpcWriteWeightMetadata()).has_value()) {
+        send_initial_metadata->Set(GrpcWriteWeightMetadata(),
+                                   *method_params->write_weight());
+      }
     }
     // Set the dynamic filter stack.
     dynamic_filters_ = chand->dynamic_filters_;
@@ -2530,6 +2794,25 @@ CallTracer::CallAttemptTracer* GetCallAttemptTracer(
   return call_tracer->StartNewAttempt(is_transparent_retry);
 }
 
+// Hands the points of the attempt's life that the transport saw over to the
+// tracer.
+void RecordTransportPhases(CallTracer::CallAttemptTracer* tracer,
+                           const grpc_transport_stream_timing& timing) {
+  using Phase = CallTracer::CallAttemptTracer::Phase;
+  auto record = [tracer](Phase phase, const gpr_timespec& time) {
+    if (gpr_time_cmp(time, gpr_inf_past(GPR_CLOCK_MONOTONIC)) != 0) {
+      tracer->RecordPhase(phase, time);
+    }
+  };
+  record(Phase::kInitialMetadataEncoded, timing.initial_metadata_encoded);
+  record(Phase::kFirstFlowControlStall, timing.first_flow_control_stall);
+  record(Phase::kFirstWriteFlushed, timing.first_write_flushed);
+  record(Phase::kLastWriteFlushed, timing.last_write_flushed);
+  record(Phase::kLastWriteSent, timing.last_write_sent);
+  record(Phase::kLastWriteAcked, timing.last_write_acked);
+  record(Phase::kInitialMetadataDecoded, timing.initial_metadata_decoded);
+}
+
 }  // namespace
 
 ClientChannel::LoadBalancedCall::LoadBalancedCall(
@@ -2591,7 +2874,7 @@ void ClientChannel::LoadBalancedCall::Orphan() {
 size_t ClientChannel::LoadBalancedCall::GetBatchIndex(
     grpc_transport_stream_op_batch* batch) {
   // Note: It is important the send_initial_metadata be the first entry
-  // here, since the code in PickSubchannelLocked() assumes it will be.
+  // here, since the code in PickSubchannelImpl() assumes it will be.
   if (batch->send_initial_metadata) return 0;
   if (batch->send_message) return 1;
   if (batch->send_trailing_metadata) return 2;
@@ -2809,15 +3092,15 @@ void ClientChannel::LoadBalancedCall::StartTransportStreamOpBatch(
   }
   // Add the batch to the pending list.
   PendingBatchesAdd(batch);
-  // For batches containing a send_initial_metadata op, acquire the
-  // channel's data plane mutex to pick a subchannel.
+  // For batches containing a send_initial_metadata op, pick a subchannel.
   if (GPR_LIKELY(batch->send_initial_metadata)) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
-      gpr_log(GPR_INFO,
-              "chand=%p lb_call=%p: grabbing data plane mutex to perform pick",
-              chand_, this);
+      gpr_log(GPR_INFO, "chand=%p lb_call=%p: performing pick", chand_, this);
+    }
+    grpc_error_handle error;
+    if (PickSubchannel(/*was_queued=*/false, &error)) {
+      PickDone(this, error);
     }
-    PickSubchannel(this, absl::OkStatus());
   } else {
     // For all other batches, release the call combiner.
     if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
@@ -2912,6 +3195,11 @@ void ClientChannel::LoadBalancedCall::RecordCallCompletion(
     absl::Status status) {
   // If we have a tracer, notify it.
   if (call_attempt_tracer_ != nullptr) {
+    if (recv_trailing_metadata_ != nullptr &&
+        transport_stream_stats_ != nullptr) {
+      RecordTransportPhases(call_attempt_tracer_,
+                            transport_stream_stats_->timing);
+    }
     call_attempt_tracer_->RecordReceivedTrailingMetadata(
         status, recv_trailing_metadata_, transport_stream_stats_);
   }
@@ -3017,14 +3305,10 @@ void ClientChannel::LoadBalancedCall::MaybeRemoveCallFromLbQueuedCallsLocked() {
   queued_pending_lb_pick_ = false;
   // Lame the call combiner canceller.
   lb_call_canceller_ = nullptr;
-  // Add trace annotation
-  if (call_attempt_tracer_ != nullptr) {
-    call_attempt_tracer_->RecordAnnotation("Delayed LB pick complete.");
-  }
 }
 
-void ClientChannel::LoadBalancedCall::MaybeAddCallToLbQueuedCallsLocked() {
-  if (queued_pending_lb_pick_) return;
+void ClientChannel::LoadBalancedCall::AddCallToLbQueuedCallsLocked() {
+  GPR_ASSERT(!queued_pending_lb_pick_);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
     gpr_log(GPR_INFO, "chand=%p lb_call=%p: adding to queued picks list",
             chand_, this);
@@ -3036,10 +3320,30 @@ void ClientChannel::LoadBalancedCall::MaybeAddCallToLbQueuedCallsLocked() {
   lb_call_canceller_ = new LbQueuedCallCanceller(Ref());
 }
 
-void ClientChannel::LoadBalancedCall::AsyncPickDone(grpc_error_handle error) {
+void ClientChannel::LoadBalancedCall::RetryPickLocked() {
+  MaybeRemoveCallFromLbQueuedCallsLocked();
   // TODO(roth): Does this callback need to hold a ref to LoadBalancedCall?
-  GRPC_CLOSURE_INIT(&pick_closure_, PickDone, this, grpc_schedule_on_exec_ctx);
-  ExecCtx::Run(DEBUG_LOCATION, &pick_closure_, error);
+  GRPC_CLOSURE_INIT(
+      &pick_closure_,
+      [](void* arg, grpc_error_handle /*error*/) {
+        auto* self = static_cast<LoadBalancedCall*>(arg);
+        // If there are a lot of queued calls here, resuming them all may
+        // cause us to stay inside C-core for a long period of time. All of
+        // that work would be done using the same ExecCtx instance and
+        // therefore the same cached value of "now". The longer it takes to
+        // finish all of this work and exit from C-core, the more stale the
+        // cached value of "now" may become. This can cause problems whereby
+        // (e.g.) we calculate a timer deadline based on the stale value,
+        // which results in the timer firing too early. To avoid this, we
+        // invalidate the cached value for each call we process.
+        ExecCtx::Get()->InvalidateNow();
+        grpc_error_handle error;
+        if (self->PickSubchannel(/*was_queued=*/true, &error)) {
+          PickDone(self, error);
+        }
+      },
+      this, grpc_schedule_on_exec_ctx);
+  ExecCtx::Run(DEBUG_LOCATION, &pick_closure_, absl::OkStatus());
 }
 
 void ClientChannel::LoadBalancedCall::PickDone(void* arg,
@@ -3058,21 +3362,38 @@ void ClientChannel::LoadBalancedCall::PickDone(void* arg,
   self->CreateSubchannelCall();
 }
 
-void ClientChannel::LoadBalancedCall::PickSubchannel(void* arg,
-                                                     grpc_error_handle error) {
-  auto* self = static_cast<LoadBalancedCall*>(arg);
-  bool pick_complete;
-  {
-    MutexLock lock(&self->chand_->data_plane_mu_);
-    pick_complete = self->PickSubchannelLocked(&error);
+bool ClientChannel::LoadBalancedCall::PickSubchannel(bool was_queued,
+                                                     grpc_error_handle* error) {
+  while (true) {
+    PickerReader reader(chand_);
+    if (PickSubchannelImpl(reader.picker(), error)) break;
+    // The picker cannot complete the pick.  Queue the call for the next
+    // picker, unless that has arrived while we were picking.  The reader
+    // keeps the picker alive, so it cannot be confused with a new one.
+    MutexLock lock(&chand_->data_plane_mu_);
+    if (chand_->picker_.load(std::memory_order_relaxed) != reader.picker()) {
+      continue;
+    }
+    AddCallToLbQueuedCallsLocked();
+    if (!was_queued && call_attempt_tracer_ != nullptr) {
+      call_attempt_tracer_->RecordPhase(
+          CallTracer::CallAttemptTracer::Phase::kLbPickQueued,
+          gpr_now(GPR_CLOCK_MONOTONIC));
+    }
+    return false;
   }
-  if (pick_complete) {
-    PickDone(self, error);
+  // Add trace annotation
+  if (was_queued && call_attempt_tracer_ != nullptr) {
+    call_attempt_tracer_->RecordAnnotation("Delayed LB pick complete.");
+    call_attempt_tracer_->RecordPhase(
+        CallTracer::CallAttemptTracer::Phase::kLbPickComplete,
+        gpr_now(GPR_CLOCK_MONOTONIC));
   }
+  return true;
 }
 
-bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
-    grpc_error_handle* error) {
+bool ClientChannel::LoadBalancedCall::PickSubchannelImpl(
+    LoadBalancingPolicy::SubchannelPicker* picker, grpc_error_handle* error) {
   GPR_ASSERT(connected_subchannel_ == nullptr);
   GPR_ASSERT(subchannel_call_ == nullptr);
   // Grab initial metadata.
@@ -3087,23 +3408,22 @@ bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
   pick_args.call_state = &lb_call_state;
   Metadata initial_metadata(initial_metadata_batch);
   pick_args.initial_metadata = &initial_metadata;
-  auto result = chand_->picker_->Pick(pick_args);
+  auto result = picker->Pick(pick_args);
   return HandlePickResult<bool>(
       &result,
       // CompletePick
-      [this](LoadBalancingPolicy::PickResult::Complete* complete_pick)
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_) {
+      [this](LoadBalancingPolicy::PickResult::Complete* complete_pick) {
             if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
               gpr_log(GPR_INFO,
                       "chand=%p lb_call=%p: LB pick succeeded: subchannel=%p",
                       chand_, this, complete_pick->subchannel.get());
             }
             GPR_ASSERT(complete_pick->subchannel != nullptr);
-            // Grab a ref to the connected subchannel while we're still
-            // holding the data plane mutex.
+            // Grab a ref to the connected subchannel while the picker is
+            // still keeping the subchannel alive.
             SubchannelWrapper* subchannel = static_cast<SubchannelWrapper*>(
                 complete_pick->subchannel.get());
-            connected_subchannel_ = subchannel->connected_subchannel();
+            connected_subchannel_ = subchannel->PickConnectedSubchannel();
             // If the subchannel has no connected subchannel (e.g., if the
             // subchannel has moved out of state READY but the LB policy hasn't
             // yet seen that change and given us a new picker), then just
@@ -3115,7 +3435,6 @@ bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
                         "has no connected subchannel; queueing pick",
                         chand_, this);
               }
-              MaybeAddCallToLbQueuedCallsLocked();
               return false;
             }
             lb_subchannel_call_tracker_ =
@@ -3123,23 +3442,19 @@ bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
             if (lb_subchannel_call_tracker_ != nullptr) {
               lb_subchannel_call_tracker_->Start();
             }
-            MaybeRemoveCallFromLbQueuedCallsLocked();
             return true;
           },
       // QueuePick
-      [this](LoadBalancingPolicy::PickResult::Queue* /*queue_pick*/)
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_) {
+      [this](LoadBalancingPolicy::PickResult::Queue* /*queue_pick*/) {
             if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
               gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick queued", chand_,
                       this);
             }
-            MaybeAddCallToLbQueuedCallsLocked();
             return false;
           },
       // FailPick
       [this, initial_metadata_batch,
-       &error](LoadBalancingPolicy::PickResult::Fail* fail_pick)
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_) {
+       &error](LoadBalancingPolicy::PickResult::Fail* fail_pick) {
             if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
               gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick failed: %s",
                       chand_, this, fail_pick->status.ToString().c_str());
@@ -3150,17 +3465,14 @@ bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
                      ->value) {
               *error = absl_status_to_grpc_error(MaybeRewriteIllegalStatusCode(
                   std::move(fail_pick->status), "LB pick"));
-              MaybeRemoveCallFromLbQueuedCallsLocked();
               return true;
             }
             // If wait_for_ready is true, then queue to retry when we get a new
             // picker.
-            MaybeAddCallToLbQueuedCallsLocked();
             return false;
           },
       // DropPick
-      [this, &error](LoadBalancingPolicy::PickResult::Drop* drop_pick)
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_) {
+      [this, &error](LoadBalancingPolicy::PickResult::Drop* drop_pick) {
             if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_lb_call_trace)) {
               gpr_log(GPR_INFO, "chand=%p lb_call=%p: LB pick dropped: %s",
                       chand_, this, drop_pick->status.ToString().c_str());
@@ -3169,7 +3481,6 @@ bool ClientChannel::LoadBalancedCall::PickSubchannelLocked(
                 absl_status_to_grpc_error(MaybeRewriteIllegalStatusCode(
                     std::move(drop_pick->status), "LB drop")),
                 StatusIntProperty::kLbPolicyDrop, 1);
-            MaybeRemoveCallFromLbQueuedCallsLocked();
             return true;
           });
 }
@@ -20,6 +20,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <atomic>
 #include <map>
@@ -27,12 +28,14 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/connectivity_state.h>
 
@@ -51,6 +54,7 @@
 #include "src/core/lib/channel/context.h"
 #include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -64,6 +68,7 @@
 #include "src/core/lib/iomgr/polling_entity.h"
 #include "src/core/lib/load_balancing/lb_policy.h"
 #include "src/core/lib/resolver/resolver.h"
+#include "src/core/lib/resolver/server_address.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/service_config/service_config.h"
 #include "src/core/lib/service_config/service_config_call_data.h"
@@ -144,6 +149,16 @@ class ClientChannel {
         this, on_complete, /*cancel=*/true);
   }
 
+  // Connects every subchannel the LB policy has, or creates while the
+  // watch is pending, and schedules on_complete once at least \a fraction
+  // of them are READY.  If the deadline passes or the channel shuts down
+  // first, schedules on_complete with an error instead.  I/O will be
+  // serviced via pollent.
+  //
+  // This is intended to be used via grpc_channel_watch_warm().
+  void AddWarmWatcher(grpc_polling_entity pollent, double fraction,
+                      Timestamp deadline, grpc_closure* on_complete);
+
   int NumExternalConnectivityWatchers() const {
     MutexLock lock(&external_watchers_mu_);
     return static_cast<int>(external_watchers_.size());
@@ -221,6 +236,15 @@ class ClientChannel {
     std::atomic<bool> done_{false};
   };
 
+  // A pending AddWarmWatcher() call.
+  struct WarmWatcher {
+    grpc_polling_entity pollent;
+    double fraction;
+    grpc_closure* on_complete;
+    absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+        timer_handle;
+  };
+
   struct ResolverQueuedCall {
     grpc_call_element* elem;
     ResolverQueuedCall* next = nullptr;
@@ -230,6 +254,34 @@ class ClientChannel {
     LbQueuedCall* next = nullptr;
   };
 
+  // Gives a pick access to the current picker without taking a lock.
+  // While a PickerReader exists, it is counted as a reader of the current
+  // picker epoch, and the picker it returns will not be released.
+  class PickerReader {
+   public:
+    explicit PickerReader(ClientChannel* chand);
+    ~PickerReader() { Leave(); }
+
+    PickerReader(const PickerReader&) = delete;
+    PickerReader& operator=(const PickerReader&) = delete;
+
+    LoadBalancingPolicy::SubchannelPicker* picker() const { return picker_; }
+
+   private:
+    void Leave();
+
+    ClientChannel* chand_;
+    uint32_t epoch_;
+    std::atomic<intptr_t>* count_;
+    LoadBalancingPolicy::SubchannelPicker* picker_;
+  };
+
+  // Number of PickerReaders on a CPU, for even and odd picker epochs.
+  // Readers leave on the count they entered, even if they moved since.
+  struct alignas(GPR_CACHELINE_SIZE) PickerReaderCount {
+    std::atomic<intptr_t> count[2] = {{0}, {0}};
+  };
+
   ClientChannel(grpc_channel_element_args* args, grpc_error_handle* error);
   ~ClientChannel();
 
@@ -250,10 +302,14 @@ class ClientChannel {
   void OnResolverErrorLocked(absl::Status status)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
 
+  // If \a config_changed is false, and the addresses, resolution note and
+  // args in \a result match the last update that the LB policy accepted,
+  // the update is dropped and OK is returned.
   absl::Status CreateOrUpdateLbPolicyLocked(
       RefCountedPtr<LoadBalancingPolicy::Config> lb_policy_config,
       const absl::optional<std::string>& health_check_service_name,
-      Resolver::Result result) ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
+      Resolver::Result result, bool config_changed)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
   OrphanablePtr<LoadBalancingPolicy> CreateLbPolicyLocked(
       const ChannelArgs& args) ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
 
@@ -275,6 +331,15 @@ class ClientChannel {
   void DestroyResolverAndLbPolicyLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
 
+  // Releases replaced pickers that no PickerReader can still be using,
+  // and starts a new picker epoch for the ones replaced since.
+  void ReclaimPickersLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
+  // Has ReclaimPickersLocked() run soon, for readers of an old epoch.
+  void ScheduleReclaimPickers();
+  // Has every subchannel's waiting connection attempt, if any, go ahead of
+  // those for channels without queued calls.
+  void SchedulePrioritizeConnectionAttempts();
+
   grpc_error_handle DoPingLocked(grpc_transport_op* op)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
 
@@ -283,6 +348,14 @@ class ClientChannel {
 
   void TryToConnectLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
 
+  void AddWarmWatcherLocked(WarmWatcher watcher, Timestamp deadline)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
+  // Completes the warm watchers whose fraction of subchannels is READY.
+  void CheckWarmWatchersLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
+  void FinishWarmWatcherLocked(uint64_t id, grpc_error_handle error)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(*work_serializer_);
+
   // These methods all require holding resolution_mu_.
   void AddResolverQueuedCall(ResolverQueuedCall* call,
                              grpc_polling_entity* pollent)
@@ -332,8 +405,12 @@ class ClientChannel {
   // Fields used in the data plane.  Guarded by data_plane_mu_.
   //
   mutable Mutex data_plane_mu_;
-  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_
-      ABSL_GUARDED_BY(data_plane_mu_);
+  // Holds a ref.  Replaced while holding data_plane_mu_ in the
+  // WorkSerializer, but picks read it without a lock, via PickerReader.
+  std::atomic<LoadBalancingPolicy::SubchannelPicker*> picker_{nullptr};
+  std::atomic<uint32_t> picker_epoch_{0};
+  PerCpu<PickerReaderCount> picker_readers_;
+  std::atomic<bool> picker_reclamation_scheduled_{false};
   // Linked list of calls queued waiting for LB pick.
   LbQueuedCall* lb_queued_calls_ ABSL_GUARDED_BY(data_plane_mu_) = nullptr;
 
@@ -349,6 +426,21 @@ class ClientChannel {
       ABSL_GUARDED_BY(*work_serializer_);
   RefCountedPtr<ConfigSelector> saved_config_selector_
       ABSL_GUARDED_BY(*work_serializer_);
+  // What the LB policy was last updated with, if it accepted the update.
+  struct AcceptedLbUpdate {
+    ServerAddressList addresses;
+    std::string resolution_note;
+    ChannelArgs args;
+  };
+  absl::optional<AcceptedLbUpdate> last_accepted_lb_update_
+      ABSL_GUARDED_BY(*work_serializer_);
+  // Pickers replaced in the current picker epoch, to be released once
+  // the next epoch has started and readers of this one have left.
+  std::vector<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>>
+      replaced_pickers_ ABSL_GUARDED_BY(*work_serializer_);
+  // Pickers replaced in the previous epoch, waiting for its readers.
+  std::vector<RefCountedPtr<LoadBalancingPolicy::SubchannelPicker>>
+      retiring_pickers_ ABSL_GUARDED_BY(*work_serializer_);
   OrphanablePtr<LoadBalancingPolicy> lb_policy_
       ABSL_GUARDED_BY(*work_serializer_);
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_
@@ -361,6 +453,10 @@ class ClientChannel {
   // work_serializer when the SubchannelWrappers are created and destroyed.
   std::set<SubchannelWrapper*> subchannel_wrappers_
       ABSL_GUARDED_BY(*work_serializer_);
+  // Pending AddWarmWatcher() calls, by ID for their timers to find.
+  std::map<uint64_t, WarmWatcher> warm_watchers_
+      ABSL_GUARDED_BY(*work_serializer_);
+  uint64_t next_warm_watcher_id_ ABSL_GUARDED_BY(*work_serializer_) = 0;
   int keepalive_time_ ABSL_GUARDED_BY(*work_serializer_) = -1;
   grpc_error_handle disconnect_error_ ABSL_GUARDED_BY(*work_serializer_);
 
@@ -422,21 +518,26 @@ class ClientChannel::LoadBalancedCall
   void StartTransportStreamOpBatch(grpc_transport_stream_op_batch* batch);
 
   // Invoked by channel for queued LB picks when the picker is updated.
-  static void PickSubchannel(void* arg, grpc_error_handle error);
-  // Helper function for performing an LB pick while holding the data plane
-  // mutex.  Returns true if the pick is complete, in which case the caller
-  // must invoke PickDone() or AsyncPickDone() with the returned error.
-  bool PickSubchannelLocked(grpc_error_handle* error)
+  // Takes the call off the queue, and schedules a callback to pick again
+  // with the new picker outside of the data plane mutex.
+  void RetryPickLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_);
-  // Schedules a callback to process the completed pick.  The callback
-  // will not run until after this method returns.
-  void AsyncPickDone(grpc_error_handle error);
 
   RefCountedPtr<SubchannelCall> subchannel_call() const {
     return subchannel_call_;
   }
 
  private:
+  // Performs an LB pick without holding the data plane mutex, and
+  // queues the call if the picker cannot complete it.  Returns true if
+  // the pick is complete, in which case the caller must invoke PickDone()
+  // with the returned error.
+  bool PickSubchannel(bool was_queued, grpc_error_handle* error);
+  // Performs a pick with \a picker.  Returns false if the call should be
+  // queued until the next picker.
+  bool PickSubchannelImpl(LoadBalancingPolicy::SubchannelPicker* picker,
+                          grpc_error_handle* error);
+
   class LbQueuedCallCanceller;
   class Metadata;
   class BackendMetricAccessor;
@@ -483,8 +584,8 @@ class ClientChannel::LoadBalancedCall
   // Removes the call from the channel's list of queued picks if present.
   void MaybeRemoveCallFromLbQueuedCallsLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_);
-  // Adds the call to the channel's list of queued picks if not already present.
-  void MaybeAddCallToLbQueuedCallsLocked()
+  // Adds the call to the channel's list of queued picks.
+  void AddCallToLbQueuedCallsLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannel::data_plane_mu_);
 
   ClientChannel* chand_;
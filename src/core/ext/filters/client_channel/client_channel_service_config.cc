@@ -115,10 +115,21 @@ const JsonLoaderInterface* ClientChannelMethodParsedConfig::JsonLoader(
           .OptionalField("timeout", &ClientChannelMethodParsedConfig::timeout_)
           .OptionalField("waitForReady",
                          &ClientChannelMethodParsedConfig::wait_for_ready_)
+          .OptionalField("writeWeight",
+                         &ClientChannelMethodParsedConfig::write_weight_)
           .Finish();
   return loader;
 }
 
+void ClientChannelMethodParsedConfig::JsonPostLoad(const Json&,
+                                                   const JsonArgs&,
+                                                   ValidationErrors* errors) {
+  if (write_weight_.has_value() && *write_weight_ == 0) {
+    ValidationErrors::ScopedField field(errors, ".writeWeight");
+    errors->AddError("must be greater than 0");
+  }
+}
+
 //
 // ClientChannelServiceConfigParser
 //
@@ -0,0 +1,140 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/connection_attempt_scheduler.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+
+namespace grpc_core {
+
+ConnectionAttemptScheduler* ConnectionAttemptScheduler::Get() {
+  static NoDestruct<ConnectionAttemptScheduler> scheduler;
+  return scheduler.get();
+}
+
+absl::optional<ConnectionAttemptScheduler::AttemptId>
+ConnectionAttemptScheduler::RequestAttempt(const std::string& address,
+                                           size_t max_concurrent, bool urgent,
+                                           absl::AnyInvocable<void()> start) {
+  MutexLock lock(&mu_);
+  Destination& destination = destinations_[address];
+  // The most recent limit wins; channels to one address normally agree.
+  destination.max_concurrent = std::max<size_t>(1, max_concurrent);
+  if (destination.in_progress < destination.max_concurrent &&
+      destination.urgent.empty() && destination.normal.empty()) {
+    ++destination.in_progress;
+    return absl::nullopt;
+  }
+  const AttemptId id = next_id_++;
+  (urgent ? destination.urgent : destination.normal)
+      .push_back({id, std::move(start)});
+  num_waiting_.fetch_add(1, std::memory_order_relaxed);
+  return id;
+}
+
+void ConnectionAttemptScheduler::MakeUrgent(const std::string& address,
+                                            AttemptId id) {
+  MutexLock lock(&mu_);
+  auto it = destinations_.find(address);
+  if (it == destinations_.end()) return;
+  std::deque<Waiter>& normal = it->second.normal;
+  auto waiter = std::find_if(normal.begin(), normal.end(),
+                             [id](const Waiter& w) { return w.id == id; });
+  if (waiter == normal.end()) return;
+  it->second.urgent.push_back(std::move(*waiter));
+  normal.erase(waiter);
+}
+
+bool ConnectionAttemptScheduler::CancelAttempt(const std::string& address,
+                                               AttemptId id) {
+  absl::optional<Waiter> cancelled;
+  {
+    MutexLock lock(&mu_);
+    auto it = destinations_.find(address);
+    if (it == destinations_.end()) return false;
+    for (std::deque<Waiter>* queue : {&it->second.urgent, &it->second.normal}) {
+      auto waiter = std::find_if(queue->begin(), queue->end(),
+                                 [id](const Waiter& w) { return w.id == id; });
+      if (waiter != queue->end()) {
+        cancelled = std::move(*waiter);
+        queue->erase(waiter);
+        num_waiting_.fetch_sub(1, std::memory_order_relaxed);
+        break;
+      }
+    }
+    if (!cancelled.has_value()) return false;
+    if (it->second.in_progress == 0 && it->second.urgent.empty() &&
+        it->second.normal.empty()) {
+      destinations_.erase(it);
+    }
+  }
+  // The callback may hold the last ref to its subchannel, so destroy it
+  // outside of the lock.
+  cancelled.reset();
+  return true;
+}
+
+void ConnectionAttemptScheduler::FinishAttempt(const std::string& address) {
+  absl::optional<Waiter> next;
+  {
+    MutexLock lock(&mu_);
+    auto it = destinations_.find(address);
+    GPR_ASSERT(it != destinations_.end());
+    GPR_ASSERT(it->second.in_progress > 0);
+    --it->second.in_progress;
+    next = NextLocked(it);
+  }
+  if (next.has_value()) {
+    // The caller may hold its subchannel's lock, and the next attempt will
+    // want its own, so start it on another thread.
+    grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+        [start = std::move(next->start)]() mutable { start(); });
+  }
+}
+
+absl::optional<ConnectionAttemptScheduler::Waiter>
+ConnectionAttemptScheduler::NextLocked(
+    std::map<std::string, Destination>::iterator it) {
+  Destination& destination = it->second;
+  if (destination.in_progress >= destination.max_concurrent) {
+    return absl::nullopt;
+  }
+  std::deque<Waiter>* queue = !destination.urgent.empty() ? &destination.urgent
+                              : !destination.normal.empty()
+                                  ? &destination.normal
+                                  : nullptr;
+  if (queue == nullptr) {
+    if (destination.in_progress == 0) destinations_.erase(it);
+    return absl::nullopt;
+  }
+  Waiter next = std::move(queue->front());
+  queue->pop_front();
+  num_waiting_.fetch_sub(1, std::memory_order_relaxed);
+  ++destination.in_progress;
+  return next;
+}
+
+}  // namespace grpc_core
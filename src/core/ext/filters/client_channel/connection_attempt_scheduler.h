@@ -0,0 +1,102 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_CONNECTION_ATTEMPT_SCHEDULER_H
+#define GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_CONNECTION_ATTEMPT_SCHEDULER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/types/optional.h"
+
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+// Limits how many subchannel connection attempts, handshakes included, may
+// be in progress to one address at a time, across every channel in the
+// process, so that a restarting backend is not hit by every client's
+// reconnects at once.  Attempts beyond the limit wait their turn, with
+// those for channels that have queued picks going first.
+class ConnectionAttemptScheduler {
+ public:
+  using AttemptId = uint64_t;
+
+  static ConnectionAttemptScheduler* Get();
+
+  // If fewer than \a max_concurrent attempts to \a address are in
+  // progress, counts a new one and returns nullopt; the caller then starts
+  // it right away.  Otherwise queues \a start, to be run on an EventEngine
+  // thread once the attempt's turn comes, and returns the attempt's ID.
+  // Either way, the attempt must be ended with FinishAttempt() once it has
+  // started.
+  absl::optional<AttemptId> RequestAttempt(const std::string& address,
+                                           size_t max_concurrent, bool urgent,
+                                           absl::AnyInvocable<void()> start);
+
+  // Moves a waiting attempt ahead of every waiting attempt that is not
+  // urgent.  Does nothing if the attempt is no longer waiting.
+  void MakeUrgent(const std::string& address, AttemptId id);
+
+  // Removes an attempt that is waiting its turn.  Returns false if its
+  // start callback has already been scheduled, in which case the attempt
+  // must still be finished.
+  bool CancelAttempt(const std::string& address, AttemptId id);
+
+  // Ends an attempt that has started, letting the next one in line start.
+  void FinishAttempt(const std::string& address);
+
+  // Whether any attempt is waiting its turn.  May be stale.
+  bool HasWaitingAttempts() const {
+    return num_waiting_.load(std::memory_order_relaxed) > 0;
+  }
+
+ private:
+  struct Waiter {
+    AttemptId id;
+    absl::AnyInvocable<void()> start;
+  };
+
+  struct Destination {
+    size_t in_progress = 0;
+    size_t max_concurrent = 0;
+    std::deque<Waiter> urgent;
+    std::deque<Waiter> normal;
+  };
+
+  // Takes the next waiter for \a address, if there is room for it.
+  absl::optional<Waiter> NextLocked(
+      std::map<std::string, Destination>::iterator it)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  Mutex mu_;
+  std::map<std::string, Destination> destinations_ ABSL_GUARDED_BY(mu_);
+  AttemptId next_id_ ABSL_GUARDED_BY(mu_) = 1;
+  std::atomic<size_t> num_waiting_{0};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_CONNECTION_ATTEMPT_SCHEDULER_H
@@ -77,6 +77,13 @@ class SubchannelConnector : public InternallyRefCounted<SubchannelConnector> {
   // connector.
   virtual void Shutdown(grpc_error_handle error) = 0;
 
+  // Returns a new connector of the same kind, for making a connection to
+  // the same address in parallel with this one, or null if this connector
+  // does not support that.
+  virtual OrphanablePtr<SubchannelConnector> CreateSibling() {
+    return nullptr;
+  }
+
   void Orphan() override {
     Shutdown(GRPC_ERROR_CREATE("Subchannel disconnected"));
     Unref();
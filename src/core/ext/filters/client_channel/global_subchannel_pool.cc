@@ -22,6 +22,9 @@
 
 #include <utility>
 
+#include "absl/hash/hash.h"
+#include "absl/strings/string_view.h"
+
 #include "src/core/ext/filters/client_channel/subchannel.h"
 
 namespace grpc_core {
@@ -31,34 +34,52 @@ RefCountedPtr<GlobalSubchannelPool> GlobalSubchannelPool::instance() {
   return p->Ref();
 }
 
+constexpr size_t GlobalSubchannelPool::kNumShards;
+
+GlobalSubchannelPool::Shard& GlobalSubchannelPool::ShardForKey(
+    const SubchannelKey& key) {
+  // Only the address is hashed: keys that differ just in their channel
+  // args share a shard, which is rare and harmless.
+  const grpc_resolved_address& address = key.address();
+  const size_t hash = absl::Hash<absl::string_view>()(
+      absl::string_view(address.addr, address.len));
+  return shards_[hash % kNumShards];
+}
+
 RefCountedPtr<Subchannel> GlobalSubchannelPool::RegisterSubchannel(
     const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) {
-  MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
-  if (it != subchannel_map_.end()) {
+  Shard& shard = ShardForKey(key);
+  MutexLock lock(&shard.mu);
+  auto it = shard.subchannel_map.find(key);
+  if (it != shard.subchannel_map.end()) {
     RefCountedPtr<Subchannel> existing = it->second->RefIfNonZero();
     if (existing != nullptr) return existing;
   }
-  subchannel_map_[key] = constructed.get();
+  shard.subchannel_map[key] = constructed.get();
   return constructed;
 }
 
 void GlobalSubchannelPool::UnregisterSubchannel(const SubchannelKey& key,
                                                 Subchannel* subchannel) {
-  MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
+  Shard& shard = ShardForKey(key);
+  MutexLock lock(&shard.mu);
+  auto it = shard.subchannel_map.find(key);
   // delete only if key hasn't been re-registered to a different subchannel
   // between strong-unreffing and unregistration of subchannel.
-  if (it != subchannel_map_.end() && it->second == subchannel) {
-    subchannel_map_.erase(it);
+  if (it != shard.subchannel_map.end() && it->second == subchannel) {
+    shard.subchannel_map.erase(it);
   }
 }
 
 RefCountedPtr<Subchannel> GlobalSubchannelPool::FindSubchannel(
     const SubchannelKey& key) {
-  MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
-  if (it == subchannel_map_.end()) return nullptr;
+  // The shard lock also keeps the subchannel from being destroyed between
+  // the lookup and RefIfNonZero(), since UnregisterSubchannel() must take
+  // it before the subchannel goes away.
+  Shard& shard = ShardForKey(key);
+  MutexLock lock(&shard.mu);
+  auto it = shard.subchannel_map.find(key);
+  if (it == shard.subchannel_map.end()) return nullptr;
   return it->second->RefIfNonZero();
 }
 
@@ -21,6 +21,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
 #include <map>
 
 #include "absl/base/thread_annotations.h"
@@ -33,6 +35,10 @@ namespace grpc_core {
 
 // The global subchannel pool. It shares subchannels among channels. There
 // should be only one instance of this class.
+//
+// The pool is split into shards by a hash of the subchannel address, each
+// with its own lock, so that many channels creating subchannels at once
+// (e.g. all reacting to the same resolver update) mostly don't contend.
 class GlobalSubchannelPool final : public SubchannelPoolInterface {
  public:
   // Gets the singleton instance.
@@ -40,22 +46,27 @@ class GlobalSubchannelPool final : public SubchannelPoolInterface {
 
   // Implements interface methods.
   RefCountedPtr<Subchannel> RegisterSubchannel(
-      const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) override
-      ABSL_LOCKS_EXCLUDED(mu_);
+      const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) override;
   void UnregisterSubchannel(const SubchannelKey& key,
-                            Subchannel* subchannel) override
-      ABSL_LOCKS_EXCLUDED(mu_);
-  RefCountedPtr<Subchannel> FindSubchannel(const SubchannelKey& key) override
-      ABSL_LOCKS_EXCLUDED(mu_);
+                            Subchannel* subchannel) override;
+  RefCountedPtr<Subchannel> FindSubchannel(const SubchannelKey& key) override;
 
  private:
+  static constexpr size_t kNumShards = 16;
+
+  struct Shard {
+    // To protect subchannel_map.
+    Mutex mu;
+    // A map from subchannel key to subchannel.
+    std::map<SubchannelKey, Subchannel*> subchannel_map ABSL_GUARDED_BY(mu);
+  };
+
   GlobalSubchannelPool() {}
   ~GlobalSubchannelPool() override {}
 
-  // A map from subchannel key to subchannel.
-  std::map<SubchannelKey, Subchannel*> subchannel_map_ ABSL_GUARDED_BY(mu_);
-  // To protect subchannel_map_.
-  Mutex mu_;
+  Shard& ShardForKey(const SubchannelKey& key);
+
+  Shard shards_[kNumShards];
 };
 
 }  // namespace grpc_core
@@ -386,14 +386,14 @@ class GrpcLb : public LoadBalancingPolicy {
     // no backend address entries.
     bool ContainsAllDropEntries() const;
 
-    // Returns the LB token to use for a drop, or null if the call
-    // should not be dropped.
+    // Returns the index of the serverlist entry to use for a drop, or
+    // nullopt if the call should not be dropped.
     //
     // Note: This is called from the picker, so it will be invoked in
     // the channel's data plane mutex, NOT the control plane
     // work_serializer.  It should not be accessed by any other part of the LB
     // policy.
-    const char* ShouldDrop();
+    absl::optional<size_t> ShouldDrop();
 
    private:
     std::vector<GrpcLbServer> serverlist_;
@@ -408,10 +408,7 @@ class GrpcLb : public LoadBalancingPolicy {
    public:
     Picker(RefCountedPtr<Serverlist> serverlist,
            RefCountedPtr<SubchannelPicker> child_picker,
-           RefCountedPtr<GrpcLbClientStats> client_stats)
-        : serverlist_(std::move(serverlist)),
-          child_picker_(std::move(child_picker)),
-          client_stats_(std::move(client_stats)) {}
+           RefCountedPtr<GrpcLbClientStats> client_stats);
 
     PickResult Pick(PickArgs args) override;
 
@@ -454,6 +451,10 @@ class GrpcLb : public LoadBalancingPolicy {
 
     RefCountedPtr<SubchannelPicker> child_picker_;
     RefCountedPtr<GrpcLbClientStats> client_stats_;
+    // The client_stats_ slot for the token of each serverlist entry, looked
+    // up once here rather than on each dropped call.  Empty if there are no
+    // client stats or no serverlist.
+    std::vector<size_t> drop_token_slots_;
   };
 
   class Helper : public ChannelControlHelper {
@@ -715,29 +716,48 @@ bool GrpcLb::Serverlist::ContainsAllDropEntries() const {
   return true;
 }
 
-const char* GrpcLb::Serverlist::ShouldDrop() {
-  if (serverlist_.empty()) return nullptr;
-  GrpcLbServer& server = serverlist_[drop_index_];
+absl::optional<size_t> GrpcLb::Serverlist::ShouldDrop() {
+  if (serverlist_.empty()) return absl::nullopt;
+  size_t index = drop_index_;
   drop_index_ = (drop_index_ + 1) % serverlist_.size();
-  return server.drop ? server.load_balance_token : nullptr;
+  if (!serverlist_[index].drop) return absl::nullopt;
+  return index;
 }
 
 //
 // GrpcLb::Picker
 //
 
+GrpcLb::Picker::Picker(RefCountedPtr<Serverlist> serverlist,
+                       RefCountedPtr<SubchannelPicker> child_picker,
+                       RefCountedPtr<GrpcLbClientStats> client_stats)
+    : serverlist_(std::move(serverlist)),
+      child_picker_(std::move(child_picker)),
+      client_stats_(std::move(client_stats)) {
+  if (serverlist_ == nullptr || client_stats_ == nullptr) return;
+  const std::vector<GrpcLbServer>& servers = serverlist_->serverlist();
+  drop_token_slots_.reserve(servers.size());
+  for (const GrpcLbServer& server : servers) {
+    drop_token_slots_.push_back(
+        server.drop ? client_stats_->InternDropToken(server.load_balance_token)
+                    : GrpcLbClientStats::kNoDropTokenSlot);
+  }
+}
+
 GrpcLb::PickResult GrpcLb::Picker::Pick(PickArgs args) {
   // Check if we should drop the call.
-  const char* drop_token =
-      serverlist_ == nullptr ? nullptr : serverlist_->ShouldDrop();
-  if (drop_token != nullptr) {
+  absl::optional<size_t> drop_index =
+      serverlist_ == nullptr ? absl::nullopt : serverlist_->ShouldDrop();
+  if (drop_index.has_value()) {
     // Update client load reporting stats to indicate the number of
     // dropped calls.  Note that we have to do this here instead of in
     // the client_load_reporting filter, because we do not create a
     // subchannel call (and therefore no client_load_reporting filter)
     // for dropped calls.
     if (client_stats_ != nullptr) {
-      client_stats_->AddCallDropped(drop_token);
+      client_stats_->AddCallDropped(
+          drop_token_slots_[*drop_index],
+          serverlist_->serverlist()[*drop_index].load_balance_token);
     }
     return PickResult::Drop(
         absl::UnavailableError("drop directed by grpclb balancer"));
@@ -1904,8 +1924,10 @@ class GrpcLbFactory : public LoadBalancingPolicyFactory {
 //
 
 void RegisterGrpcLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<GrpcLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      kGrpclb, []() -> std::unique_ptr<LoadBalancingPolicyFactory> {
+        return std::make_unique<GrpcLbFactory>();
+      });
   builder->channel_init()->RegisterStage(
       GRPC_CLIENT_SUBCHANNEL, GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
       [](ChannelStackBuilder* builder) {
@@ -22,69 +22,120 @@
 
 #include <string.h>
 
-#include <grpc/support/atm.h>
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/gprpp/sync.h"
 
 namespace grpc_core {
 
+namespace {
+
+void AddDropTokenCount(GrpcLbClientStats::DroppedCallCounts* counts,
+                       const char* token, int64_t count) {
+  for (size_t i = 0; i < counts->size(); ++i) {
+    if (strcmp((*counts)[i].token.get(), token) == 0) {
+      (*counts)[i].count += count;
+      return;
+    }
+  }
+  // Not found, so add a new entry.
+  counts->emplace_back(UniquePtr<char>(gpr_strdup(token)), count);
+}
+
+int64_t GetAndResetCounter(std::atomic<int64_t>* counter) {
+  return counter->exchange(0, std::memory_order_relaxed);
+}
+
+}  // namespace
+
 void GrpcLbClientStats::AddCallStarted() {
-  gpr_atm_full_fetch_add(&num_calls_started_, (gpr_atm)1);
+  call_counters_.this_cpu().num_calls_started.fetch_add(
+      1, std::memory_order_relaxed);
 }
 
 void GrpcLbClientStats::AddCallFinished(
     bool finished_with_client_failed_to_send, bool finished_known_received) {
-  gpr_atm_full_fetch_add(&num_calls_finished_, (gpr_atm)1);
+  CallCounters& counters = call_counters_.this_cpu();
+  counters.num_calls_finished.fetch_add(1, std::memory_order_relaxed);
   if (finished_with_client_failed_to_send) {
-    gpr_atm_full_fetch_add(&num_calls_finished_with_client_failed_to_send_,
-                           (gpr_atm)1);
+    counters.num_calls_finished_with_client_failed_to_send.fetch_add(
+        1, std::memory_order_relaxed);
   }
   if (finished_known_received) {
-    gpr_atm_full_fetch_add(&num_calls_finished_known_received_, (gpr_atm)1);
+    counters.num_calls_finished_known_received.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+}
+
+size_t GrpcLbClientStats::InternDropToken(const char* token) {
+  MutexLock lock(&drop_token_mu_);
+  for (size_t i = 0; i < drop_tokens_.size(); ++i) {
+    if (strcmp(drop_tokens_[i].get(), token) == 0) return i;
+  }
+  if (drop_tokens_.size() == kMaxDropTokenSlots) return kNoDropTokenSlot;
+  drop_tokens_.emplace_back(gpr_strdup(token));
+  return drop_tokens_.size() - 1;
+}
+
+void GrpcLbClientStats::AddCallDropped(size_t token_slot, const char* token) {
+  if (token_slot == kNoDropTokenSlot) {
+    AddCallDropped(token);
+    return;
   }
+  // Increment num_calls_started and num_calls_finished, and record the drop.
+  CallCounters& counters = call_counters_.this_cpu();
+  counters.num_calls_started.fetch_add(1, std::memory_order_relaxed);
+  counters.num_calls_finished.fetch_add(1, std::memory_order_relaxed);
+  counters.num_drops[token_slot].fetch_add(1, std::memory_order_relaxed);
 }
 
 void GrpcLbClientStats::AddCallDropped(const char* token) {
   // Increment num_calls_started and num_calls_finished.
-  gpr_atm_full_fetch_add(&num_calls_started_, (gpr_atm)1);
-  gpr_atm_full_fetch_add(&num_calls_finished_, (gpr_atm)1);
+  CallCounters& counters = call_counters_.this_cpu();
+  counters.num_calls_started.fetch_add(1, std::memory_order_relaxed);
+  counters.num_calls_finished.fetch_add(1, std::memory_order_relaxed);
   // Record the drop.
   MutexLock lock(&drop_count_mu_);
   if (drop_token_counts_ == nullptr) {
     drop_token_counts_ = std::make_unique<DroppedCallCounts>();
   }
-  for (size_t i = 0; i < drop_token_counts_->size(); ++i) {
-    if (strcmp((*drop_token_counts_)[i].token.get(), token) == 0) {
-      ++(*drop_token_counts_)[i].count;
-      return;
-    }
-  }
-  // Not found, so add a new entry.
-  drop_token_counts_->emplace_back(UniquePtr<char>(gpr_strdup(token)), 1);
-}
-
-namespace {
-
-void AtomicGetAndResetCounter(int64_t* value, gpr_atm* counter) {
-  *value = static_cast<int64_t>(gpr_atm_full_xchg(counter, (gpr_atm)0));
+  AddDropTokenCount(drop_token_counts_.get(), token, 1);
 }
 
-}  // namespace
-
 void GrpcLbClientStats::Get(
     int64_t* num_calls_started, int64_t* num_calls_finished,
     int64_t* num_calls_finished_with_client_failed_to_send,
     int64_t* num_calls_finished_known_received,
     std::unique_ptr<DroppedCallCounts>* drop_token_counts) {
-  AtomicGetAndResetCounter(num_calls_started, &num_calls_started_);
-  AtomicGetAndResetCounter(num_calls_finished, &num_calls_finished_);
-  AtomicGetAndResetCounter(num_calls_finished_with_client_failed_to_send,
-                           &num_calls_finished_with_client_failed_to_send_);
-  AtomicGetAndResetCounter(num_calls_finished_known_received,
-                           &num_calls_finished_known_received_);
-  MutexLock lock(&drop_count_mu_);
-  *drop_token_counts = std::move(drop_token_counts_);
+  *num_calls_started = 0;
+  *num_calls_finished = 0;
+  *num_calls_finished_with_client_failed_to_send = 0;
+  *num_calls_finished_known_received = 0;
+  int64_t num_drops[kMaxDropTokenSlots] = {};
+  for (CallCounters& counters : call_counters_) {
+    *num_calls_started += GetAndResetCounter(&counters.num_calls_started);
+    *num_calls_finished += GetAndResetCounter(&counters.num_calls_finished);
+    *num_calls_finished_with_client_failed_to_send += GetAndResetCounter(
+        &counters.num_calls_finished_with_client_failed_to_send);
+    *num_calls_finished_known_received +=
+        GetAndResetCounter(&counters.num_calls_finished_known_received);
+    for (size_t i = 0; i < kMaxDropTokenSlots; ++i) {
+      num_drops[i] += GetAndResetCounter(&counters.num_drops[i]);
+    }
+  }
+  {
+    MutexLock lock(&drop_count_mu_);
+    *drop_token_counts = std::move(drop_token_counts_);
+  }
+  MutexLock lock(&drop_token_mu_);
+  for (size_t i = 0; i < drop_tokens_.size(); ++i) {
+    if (num_drops[i] == 0) continue;
+    if (*drop_token_counts == nullptr) {
+      *drop_token_counts = std::make_unique<DroppedCallCounts>();
+    }
+    AddDropTokenCount(drop_token_counts->get(), drop_tokens_[i].get(),
+                      num_drops[i]);
+  }
 }
 
 }  // namespace grpc_core
@@ -21,17 +21,18 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <utility>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/inlined_vector.h"
 
-#include <grpc/support/atm.h>
-
 #include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/sync.h"
 
@@ -49,10 +50,23 @@ class GrpcLbClientStats : public RefCounted<GrpcLbClientStats> {
 
   typedef absl::InlinedVector<DropTokenCount, 10> DroppedCallCounts;
 
+  // Drops are counted per CPU for up to this many distinct tokens.
+  static constexpr size_t kMaxDropTokenSlots = 16;
+  // Returned by InternDropToken() once all slots are taken.
+  static constexpr size_t kNoDropTokenSlot = kMaxDropTokenSlots;
+
   void AddCallStarted();
   void AddCallFinished(bool finished_with_client_failed_to_send,
                        bool finished_known_received);
 
+  // Returns the slot to count drops for \a token in, assigning one if the
+  // token has none yet.  Meant to be called when a serverlist is received,
+  // so that the picker need not look up the token for each dropped call.
+  size_t InternDropToken(const char* token);
+
+  // Records a drop in \a token_slot, as returned by InternDropToken() for
+  // \a token.  Drops for kNoDropTokenSlot are counted under a lock.
+  void AddCallDropped(size_t token_slot, const char* token);
   void AddCallDropped(const char* token);
 
   void Get(int64_t* num_calls_started, int64_t* num_calls_finished,
@@ -67,10 +81,22 @@ class GrpcLbClientStats : public RefCounted<GrpcLbClientStats> {
   }
 
  private:
-  gpr_atm num_calls_started_ = 0;
-  gpr_atm num_calls_finished_ = 0;
-  gpr_atm num_calls_finished_with_client_failed_to_send_ = 0;
-  gpr_atm num_calls_finished_known_received_ = 0;
+  // Counted per CPU, as every call updates them, and summed for load
+  // reports.
+  struct alignas(GPR_CACHELINE_SIZE) CallCounters {
+    std::atomic<int64_t> num_calls_started{0};
+    std::atomic<int64_t> num_calls_finished{0};
+    std::atomic<int64_t> num_calls_finished_with_client_failed_to_send{0};
+    std::atomic<int64_t> num_calls_finished_known_received{0};
+    std::atomic<int64_t> num_drops[kMaxDropTokenSlots] = {};
+  };
+  PerCpu<CallCounters> call_counters_;
+  // Guards drop_tokens_.  Slots are only ever added, so a slot handed out
+  // by InternDropToken() keeps its token.
+  Mutex drop_token_mu_;
+  absl::InlinedVector<UniquePtr<char>, kMaxDropTokenSlots> drop_tokens_
+      ABSL_GUARDED_BY(drop_token_mu_);
+  // Drops for tokens that did not get a slot.
   Mutex drop_count_mu_;  // Guards drop_token_counts_.
   std::unique_ptr<DroppedCallCounts> drop_token_counts_
       ABSL_GUARDED_BY(drop_count_mu_);
@@ -0,0 +1,833 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include <inttypes.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/backend_metric_data.h"
+#include "src/core/ext/filters/client_channel/lb_policy/oob_backend_metric.h"
+#include "src/core/ext/filters/client_channel/lb_policy/subchannel_list.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_object_loader.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+#include "src/core/lib/load_balancing/lb_policy_factory.h"
+#include "src/core/lib/load_balancing/subchannel_interface.h"
+#include "src/core/lib/resolver/server_address.h"
+#include "src/core/lib/transport/connectivity_state.h"
+
+namespace grpc_core {
+
+TraceFlag grpc_lb_least_request_trace(false, "least_request_lb");
+
+namespace {
+
+constexpr absl::string_view kLeastRequest = "least_request_experimental";
+
+// Config for least_request policy.
+class LeastRequestConfig : public LoadBalancingPolicy::Config {
+ public:
+  LeastRequestConfig() = default;
+
+  LeastRequestConfig(const LeastRequestConfig&) = delete;
+  LeastRequestConfig& operator=(const LeastRequestConfig&) = delete;
+
+  LeastRequestConfig(LeastRequestConfig&&) = delete;
+  LeastRequestConfig& operator=(LeastRequestConfig&&) = delete;
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  uint32_t choice_count() const { return choice_count_; }
+  double utilization_weight() const { return utilization_weight_; }
+  bool enable_oob_load_report() const { return enable_oob_load_report_; }
+  Duration oob_reporting_period() const { return oob_reporting_period_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<LeastRequestConfig>()
+            .OptionalField("choiceCount", &LeastRequestConfig::choice_count_)
+            .OptionalField("utilizationWeight",
+                           &LeastRequestConfig::utilization_weight_)
+            .OptionalField("enableOobLoadReport",
+                           &LeastRequestConfig::enable_oob_load_report_)
+            .OptionalField("oobReportingPeriod",
+                           &LeastRequestConfig::oob_reporting_period_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    // Same bounds as the xDS least_request policy.
+    if (choice_count_ < 2) {
+      ValidationErrors::ScopedField field(errors, ".choiceCount");
+      errors->AddError("must be at least 2");
+    }
+    choice_count_ = std::min<uint32_t>(choice_count_, 10);
+    if (utilization_weight_ < 0) {
+      ValidationErrors::ScopedField field(errors, ".utilizationWeight");
+      errors->AddError("must not be negative");
+    }
+  }
+
+ private:
+  uint32_t choice_count_ = 2;
+  double utilization_weight_ = 0;
+  bool enable_oob_load_report_ = false;
+  Duration oob_reporting_period_ = Duration::Seconds(10);
+};
+
+// least_request LB policy.
+//
+// Each pick samples choiceCount READY subchannels at random and sends the
+// call to the one with the fewest calls in flight, which reacts to a slow
+// backend within a few calls instead of a weight update period.  If
+// utilizationWeight is non-zero, the in-flight count is scaled by the
+// backend's last reported CPU utilization, so that two backends with the
+// same queue depth but different headroom are told apart.
+class LeastRequest : public LoadBalancingPolicy {
+ public:
+  explicit LeastRequest(Args args);
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ private:
+  // Load seen by the channel for a given address.  Shared by every
+  // subchannel list and picker that contains the address, so that calls
+  // started from an old picker are still counted after an update.
+  class AddressLoad : public RefCounted<AddressLoad> {
+   public:
+    AddressLoad(RefCountedPtr<LeastRequest> least_request, std::string key)
+        : least_request_(std::move(least_request)), key_(std::move(key)) {}
+    ~AddressLoad() override;
+
+    void CallStarted() { in_flight_.fetch_add(1, std::memory_order_relaxed); }
+    void CallFinished() { in_flight_.fetch_sub(1, std::memory_order_relaxed); }
+
+    void UpdateUtilization(double cpu_utilization);
+    void ResetUtilization() {
+      utilization_.store(0, std::memory_order_relaxed);
+    }
+
+    // Returns the cost of sending one more call to this address.
+    double Score(double utilization_weight) const {
+      double score = in_flight_.load(std::memory_order_relaxed) + 1;
+      if (utilization_weight > 0) {
+        score *= 1 + utilization_weight *
+                         utilization_.load(std::memory_order_relaxed);
+      }
+      return score;
+    }
+
+    uint64_t in_flight() const {
+      return in_flight_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    RefCountedPtr<LeastRequest> least_request_;
+    const std::string key_;
+
+    std::atomic<uint64_t> in_flight_{0};
+    std::atomic<double> utilization_{0};
+  };
+
+  // Forward declaration.
+  class LeastRequestSubchannelList;
+
+  // Data for a particular subchannel in a subchannel list.
+  // This subclass adds the following functionality:
+  // - Tracks the previous connectivity state of the subchannel, so that
+  //   we know how many subchannels are in each state.
+  // - Holds the load for the subchannel's address.
+  class LeastRequestSubchannelData
+      : public SubchannelData<LeastRequestSubchannelList,
+                              LeastRequestSubchannelData> {
+   public:
+    LeastRequestSubchannelData(
+        SubchannelList<LeastRequestSubchannelList, LeastRequestSubchannelData>*
+            subchannel_list,
+        const ServerAddress& address, RefCountedPtr<SubchannelInterface> sc);
+
+    absl::optional<grpc_connectivity_state> connectivity_state() const {
+      return logical_connectivity_state_;
+    }
+
+    RefCountedPtr<AddressLoad> load() const { return load_; }
+
+   private:
+    class OobWatcher : public OobBackendMetricWatcher {
+     public:
+      explicit OobWatcher(RefCountedPtr<AddressLoad> load)
+          : load_(std::move(load)) {}
+
+      void OnBackendMetricReport(
+          const BackendMetricData& backend_metric_data) override {
+        load_->UpdateUtilization(backend_metric_data.cpu_utilization);
+      }
+
+     private:
+      RefCountedPtr<AddressLoad> load_;
+    };
+
+    // Performs connectivity state updates that need to be done only
+    // after we have started watching.
+    void ProcessConnectivityChangeLocked(
+        absl::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state) override;
+
+    // Updates the logical connectivity state.
+    void UpdateLogicalConnectivityStateLocked(
+        grpc_connectivity_state connectivity_state);
+
+    // The logical connectivity state of the subchannel.
+    // Note that the logical connectivity state may differ from the
+    // actual reported state in some cases (e.g., after we see
+    // TRANSIENT_FAILURE, we ignore any subsequent state changes until
+    // we see READY).
+    absl::optional<grpc_connectivity_state> logical_connectivity_state_;
+
+    RefCountedPtr<AddressLoad> load_;
+  };
+
+  // A list of subchannels.
+  class LeastRequestSubchannelList
+      : public SubchannelList<LeastRequestSubchannelList,
+                              LeastRequestSubchannelData> {
+   public:
+    LeastRequestSubchannelList(LeastRequest* policy,
+                               ServerAddressList addresses,
+                               const ChannelArgs& args)
+        : SubchannelList(policy,
+                         (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)
+                              ? "LeastRequestSubchannelList"
+                              : nullptr),
+                         std::move(addresses), policy->channel_control_helper(),
+                         args) {
+      // Need to maintain a ref to the LB policy as long as we maintain
+      // any references to subchannels, since the subchannels'
+      // pollset_sets will include the LB policy's pollset_set.
+      policy->Ref(DEBUG_LOCATION, "subchannel_list").release();
+    }
+
+    ~LeastRequestSubchannelList() override {
+      LeastRequest* p = static_cast<LeastRequest*>(policy());
+      p->Unref(DEBUG_LOCATION, "subchannel_list");
+    }
+
+    // Updates the counters of subchannels in each state when a
+    // subchannel transitions from old_state to new_state.
+    void UpdateStateCountersLocked(
+        absl::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state);
+
+    // Ensures that the right subchannel list is used and then updates
+    // the aggregated connectivity state based on the subchannel list's
+    // state counters.
+    void MaybeUpdateAggregatedConnectivityStateLocked(
+        absl::Status status_for_tf);
+
+   private:
+    std::string CountersString() const {
+      return absl::StrCat("num_subchannels=", num_subchannels(),
+                          " num_ready=", num_ready_,
+                          " num_connecting=", num_connecting_,
+                          " num_transient_failure=", num_transient_failure_);
+    }
+
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    absl::Status last_failure_;
+  };
+
+  // A picker that does power-of-choices picks over the READY subchannels.
+  // Picks only touch atomics, so concurrent picks never contend on a lock.
+  class Picker : public SubchannelPicker {
+   public:
+    Picker(LeastRequest* parent, LeastRequestSubchannelList* subchannel_list);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // Counts the call against its address for as long as it is in flight,
+    // and optionally collects the utilization reported with the response.
+    class SubchannelCallTracker : public SubchannelCallTrackerInterface {
+     public:
+      SubchannelCallTracker(RefCountedPtr<AddressLoad> load,
+                            bool use_per_rpc_utilization)
+          : load_(std::move(load)),
+            use_per_rpc_utilization_(use_per_rpc_utilization) {}
+
+      void Start() override { load_->CallStarted(); }
+
+      void Finish(FinishArgs args) override;
+
+     private:
+      RefCountedPtr<AddressLoad> load_;
+      const bool use_per_rpc_utilization_;
+    };
+
+    // Info stored about each subchannel.
+    struct SubchannelInfo {
+      SubchannelInfo(RefCountedPtr<SubchannelInterface> subchannel,
+                     RefCountedPtr<AddressLoad> load)
+          : subchannel(std::move(subchannel)), load(std::move(load)) {}
+
+      RefCountedPtr<SubchannelInterface> subchannel;
+      RefCountedPtr<AddressLoad> load;
+    };
+
+    // Returns a pseudo-random number without taking a lock.
+    uint64_t NextRandom();
+
+    // Returns the index into subchannels_ to be picked.
+    size_t PickIndex();
+
+    // Using pointer value only, no ref held -- do not dereference!
+    LeastRequest* parent_;
+
+    const uint32_t choice_count_;
+    const double utilization_weight_;
+    const bool use_per_rpc_utilization_;
+    std::vector<SubchannelInfo> subchannels_;
+
+    std::atomic<uint64_t> random_state_;
+  };
+
+  ~LeastRequest() override;
+
+  void ShutdownLocked() override;
+
+  RefCountedPtr<AddressLoad> GetOrCreateLoad(
+      const grpc_resolved_address& address);
+
+  RefCountedPtr<LeastRequestConfig> config_;
+
+  // List of subchannels.
+  RefCountedPtr<LeastRequestSubchannelList> subchannel_list_;
+  // Latest pending subchannel list.
+  // When we get an updated address list, we create a new subchannel list
+  // for it here, and we wait to swap it into subchannel_list_ until the new
+  // list becomes READY.
+  RefCountedPtr<LeastRequestSubchannelList> latest_pending_subchannel_list_;
+
+  Mutex address_load_map_mu_;
+  std::map<std::string, AddressLoad*, std::less<>> address_load_map_
+      ABSL_GUARDED_BY(&address_load_map_mu_);
+
+  bool shutdown_ = false;
+
+  absl::BitGen bit_gen_;
+};
+
+//
+// LeastRequest::AddressLoad
+//
+
+LeastRequest::AddressLoad::~AddressLoad() {
+  MutexLock lock(&least_request_->address_load_map_mu_);
+  auto it = least_request_->address_load_map_.find(key_);
+  if (it != least_request_->address_load_map_.end() && it->second == this) {
+    least_request_->address_load_map_.erase(it);
+  }
+}
+
+void LeastRequest::AddressLoad::UpdateUtilization(double cpu_utilization) {
+  // Backends that do not report utilization send 0, which would make them
+  // look idle; only take real reports into account.
+  if (cpu_utilization <= 0) return;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+    gpr_log(GPR_INFO,
+            "[LR %p] subchannel %s: cpu_utilization=%f in_flight=%" PRIu64,
+            least_request_.get(), key_.c_str(), cpu_utilization, in_flight());
+  }
+  utilization_.store(cpu_utilization, std::memory_order_relaxed);
+}
+
+//
+// LeastRequest::Picker::SubchannelCallTracker
+//
+
+void LeastRequest::Picker::SubchannelCallTracker::Finish(FinishArgs args) {
+  load_->CallFinished();
+  if (!use_per_rpc_utilization_) return;
+  auto* backend_metric_data =
+      args.backend_metric_accessor->GetBackendMetricData();
+  if (backend_metric_data != nullptr) {
+    load_->UpdateUtilization(backend_metric_data->cpu_utilization);
+  }
+}
+
+//
+// LeastRequest::Picker
+//
+
+LeastRequest::Picker::Picker(LeastRequest* parent,
+                             LeastRequestSubchannelList* subchannel_list)
+    : parent_(parent),
+      choice_count_(parent->config_->choice_count()),
+      utilization_weight_(parent->config_->utilization_weight()),
+      use_per_rpc_utilization_(parent->config_->utilization_weight() > 0 &&
+                               !parent->config_->enable_oob_load_report()),
+      random_state_(absl::Uniform<uint64_t>(parent->bit_gen_)) {
+  for (size_t i = 0; i < subchannel_list->num_subchannels(); ++i) {
+    LeastRequestSubchannelData* sd = subchannel_list->subchannel(i);
+    if (sd->connectivity_state() == GRPC_CHANNEL_READY) {
+      subchannels_.emplace_back(sd->subchannel()->Ref(), sd->load());
+    }
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+    gpr_log(GPR_INFO,
+            "[LR %p picker %p] created picker from subchannel_list=%p "
+            "with %" PRIuPTR " READY subchannels; choice_count=%" PRIu32,
+            parent_, this, subchannel_list, subchannels_.size(),
+            choice_count_);
+  }
+}
+
+LeastRequest::PickResult LeastRequest::Picker::Pick(PickArgs /*args*/) {
+  size_t index = PickIndex();
+  GPR_ASSERT(index < subchannels_.size());
+  auto& subchannel_info = subchannels_[index];
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+    gpr_log(GPR_INFO,
+            "[LR %p picker %p] returning index %" PRIuPTR
+            ", subchannel=%p, in_flight=%" PRIu64,
+            parent_, this, index, subchannel_info.subchannel.get(),
+            subchannel_info.load->in_flight());
+  }
+  return PickResult::Complete(
+      subchannel_info.subchannel,
+      std::make_unique<SubchannelCallTracker>(subchannel_info.load,
+                                              use_per_rpc_utilization_));
+}
+
+uint64_t LeastRequest::Picker::NextRandom() {
+  // splitmix64 over an atomic counter: each caller gets its own step of
+  // the sequence, so no lock is needed to keep picks independent.
+  uint64_t z = random_state_.fetch_add(0x9e3779b97f4a7c15,
+                                       std::memory_order_relaxed) +
+               0x9e3779b97f4a7c15;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31);
+}
+
+size_t LeastRequest::Picker::PickIndex() {
+  const size_t num_subchannels = subchannels_.size();
+  if (num_subchannels == 1) return 0;
+  size_t best_index = 0;
+  double best_score = 0;
+  if (num_subchannels <= choice_count_) {
+    // Few enough subchannels to look at all of them.  Start at a random
+    // offset so that ties do not all go to the first one.
+    const size_t start = NextRandom() % num_subchannels;
+    for (size_t i = 0; i < num_subchannels; ++i) {
+      const size_t index = (start + i) % num_subchannels;
+      const double score = subchannels_[index].load->Score(utilization_weight_);
+      if (i == 0 || score < best_score) {
+        best_index = index;
+        best_score = score;
+      }
+    }
+    return best_index;
+  }
+  for (uint32_t i = 0; i < choice_count_; ++i) {
+    const size_t index = NextRandom() % num_subchannels;
+    const double score = subchannels_[index].load->Score(utilization_weight_);
+    if (i == 0 || score < best_score) {
+      best_index = index;
+      best_score = score;
+    }
+  }
+  return best_index;
+}
+
+//
+// LeastRequest
+//
+
+LeastRequest::LeastRequest(Args args) : LoadBalancingPolicy(std::move(args)) {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+    gpr_log(GPR_INFO, "[LR %p] Created", this);
+  }
+}
+
+LeastRequest::~LeastRequest() {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+    gpr_log(GPR_INFO, "[LR %p] Destroying least_request policy", this);
+  }
+  GPR_ASSERT(subchannel_list_ == nullptr);
+  GPR_ASSERT(latest_pending_subchannel_list_ == nullptr);
+}
+
+void LeastRequest::ShutdownLocked() {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+    gpr_log(GPR_INFO, "[LR %p] Shutting down", this);
+  }
+  shutdown_ = true;
+  subchannel_list_.reset();
+  latest_pending_subchannel_list_.reset();
+}
+
+void LeastRequest::ResetBackoffLocked() {
+  subchannel_list_->ResetBackoffLocked();
+  if (latest_pending_subchannel_list_ != nullptr) {
+    latest_pending_subchannel_list_->ResetBackoffLocked();
+  }
+}
+
+absl::Status LeastRequest::UpdateLocked(UpdateArgs args) {
+  config_ = std::move(args.config);
+  ServerAddressList addresses;
+  if (args.addresses.ok()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+      gpr_log(GPR_INFO, "[LR %p] received update with %" PRIuPTR " addresses",
+              this, args.addresses->size());
+    }
+    addresses = std::move(*args.addresses);
+  } else {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+      gpr_log(GPR_INFO, "[LR %p] received update with address error: %s", this,
+              args.addresses.status().ToString().c_str());
+    }
+    // If we already have a subchannel list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (subchannel_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new subchannel list, replacing the previous pending list, if any.
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace) &&
+      latest_pending_subchannel_list_ != nullptr) {
+    gpr_log(GPR_INFO, "[LR %p] replacing previous pending subchannel list %p",
+            this, latest_pending_subchannel_list_.get());
+  }
+  latest_pending_subchannel_list_ = MakeRefCounted<LeastRequestSubchannelList>(
+      this, std::move(addresses), args.args);
+  latest_pending_subchannel_list_->StartWatchingLocked();
+  // If the new list is empty, immediately promote it to
+  // subchannel_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_subchannel_list_->num_subchannels() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace) &&
+        subchannel_list_ != nullptr) {
+      gpr_log(GPR_INFO, "[LR %p] replacing previous subchannel list %p", this,
+              subchannel_list_.get());
+    }
+    subchannel_list_ = std::move(latest_pending_subchannel_list_);
+    absl::Status status =
+        args.addresses.ok() ? absl::UnavailableError(absl::StrCat(
+                                  "empty address list: ", args.resolution_note))
+                            : args.addresses.status();
+    channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE, status,
+        MakeRefCounted<TransientFailurePicker>(status));
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // subchannel_list_ and report CONNECTING.
+  if (subchannel_list_.get() == nullptr) {
+    subchannel_list_ = std::move(latest_pending_subchannel_list_);
+    channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::Status(),
+        MakeRefCounted<QueuePicker>(Ref(DEBUG_LOCATION, "QueuePicker")));
+  }
+  return absl::OkStatus();
+}
+
+RefCountedPtr<LeastRequest::AddressLoad> LeastRequest::GetOrCreateLoad(
+    const grpc_resolved_address& address) {
+  auto key = grpc_sockaddr_to_uri(&address);
+  if (!key.ok()) return nullptr;
+  MutexLock lock(&address_load_map_mu_);
+  auto it = address_load_map_.find(*key);
+  if (it != address_load_map_.end()) {
+    auto load = it->second->RefIfNonZero();
+    if (load != nullptr) return load;
+  }
+  auto load =
+      MakeRefCounted<AddressLoad>(Ref(DEBUG_LOCATION, "AddressLoad"), *key);
+  address_load_map_[*key] = load.get();
+  return load;
+}
+
+//
+// LeastRequest::LeastRequestSubchannelList
+//
+
+void LeastRequest::LeastRequestSubchannelList::UpdateStateCountersLocked(
+    absl::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  if (old_state.has_value()) {
+    GPR_ASSERT(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      GPR_ASSERT(num_ready_ > 0);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING) {
+      GPR_ASSERT(num_connecting_ > 0);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      GPR_ASSERT(num_transient_failure_ > 0);
+      --num_transient_failure_;
+    }
+  }
+  GPR_ASSERT(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void LeastRequest::LeastRequestSubchannelList::
+    MaybeUpdateAggregatedConnectivityStateLocked(absl::Status status_for_tf) {
+  LeastRequest* p = static_cast<LeastRequest*>(policy());
+  // If this is latest_pending_subchannel_list_, then swap it into
+  // subchannel_list_ in the following cases:
+  // - subchannel_list_ has no READY subchannels.
+  // - This list has at least one READY subchannel and we have seen the
+  //   initial connectivity state notification for all subchannels.
+  // - All of the subchannels in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (p->latest_pending_subchannel_list_.get() == this &&
+      (p->subchannel_list_->num_ready_ == 0 ||
+       (num_ready_ > 0 && AllSubchannelsSeenInitialState()) ||
+       num_transient_failure_ == num_subchannels())) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+      const std::string old_counters_string =
+          p->subchannel_list_ != nullptr ? p->subchannel_list_->CountersString()
+                                         : "";
+      gpr_log(
+          GPR_INFO,
+          "[LR %p] swapping out subchannel list %p (%s) in favor of %p (%s)", p,
+          p->subchannel_list_.get(), old_counters_string.c_str(), this,
+          CountersString().c_str());
+    }
+    p->subchannel_list_ = std::move(p->latest_pending_subchannel_list_);
+  }
+  // Only set connectivity state if this is the current subchannel list.
+  if (p->subchannel_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY subchannel is READY => policy is READY.
+  // 2) ANY subchannel is CONNECTING => policy is CONNECTING.
+  // 3) ALL subchannels are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+      gpr_log(GPR_INFO, "[LR %p] reporting READY with subchannel list %p", p,
+              this);
+    }
+    p->channel_control_helper()->UpdateState(GRPC_CHANNEL_READY, absl::Status(),
+                                             MakeRefCounted<Picker>(p, this));
+  } else if (num_connecting_ > 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+      gpr_log(GPR_INFO, "[LR %p] reporting CONNECTING with subchannel list %p",
+              p, this);
+    }
+    p->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::Status(),
+        MakeRefCounted<QueuePicker>(p->Ref(DEBUG_LOCATION, "QueuePicker")));
+  } else if (num_transient_failure_ == num_subchannels()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+      gpr_log(GPR_INFO,
+              "[LR %p] reporting TRANSIENT_FAILURE with subchannel list %p: %s",
+              p, this, status_for_tf.ToString().c_str());
+    }
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.ToString()));
+    }
+    p->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE, last_failure_,
+        MakeRefCounted<TransientFailurePicker>(last_failure_));
+  }
+}
+
+//
+// LeastRequest::LeastRequestSubchannelData
+//
+
+LeastRequest::LeastRequestSubchannelData::LeastRequestSubchannelData(
+    SubchannelList<LeastRequestSubchannelList, LeastRequestSubchannelData>*
+        subchannel_list,
+    const ServerAddress& address, RefCountedPtr<SubchannelInterface> sc)
+    : SubchannelData(subchannel_list, address, std::move(sc)),
+      load_(static_cast<LeastRequest*>(subchannel_list->policy())
+                ->GetOrCreateLoad(address.address())) {
+  // Start OOB watch if configured.
+  LeastRequest* p = static_cast<LeastRequest*>(subchannel_list->policy());
+  if (p->config_->enable_oob_load_report() &&
+      p->config_->utilization_weight() > 0) {
+    subchannel()->AddDataWatcher(
+        MakeOobBackendMetricWatcher(p->config_->oob_reporting_period(),
+                                    std::make_unique<OobWatcher>(load_)));
+  }
+}
+
+void LeastRequest::LeastRequestSubchannelData::ProcessConnectivityChangeLocked(
+    absl::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  LeastRequest* p = static_cast<LeastRequest*>(subchannel_list()->policy());
+  GPR_ASSERT(subchannel() != nullptr);
+  // If this is not the initial state notification and the new state is
+  // TRANSIENT_FAILURE or IDLE, re-resolve.
+  // Note that we don't want to do this on the initial state notification,
+  // because that would result in an endless loop of re-resolution.
+  if (old_state.has_value() && (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
+                                new_state == GRPC_CHANNEL_IDLE)) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+      gpr_log(GPR_INFO,
+              "[LR %p] Subchannel %p reported %s; requesting re-resolution", p,
+              subchannel(), ConnectivityStateName(new_state));
+    }
+    p->channel_control_helper()->RequestReresolution();
+  }
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+      gpr_log(GPR_INFO,
+              "[LR %p] Subchannel %p reported IDLE; requesting connection", p,
+              subchannel());
+    }
+    subchannel()->RequestConnection();
+  } else if (new_state == GRPC_CHANNEL_READY) {
+    // Utilization reported over a previous connection may describe a
+    // backend that has since restarted, so start from scratch.
+    load_->ResetUtilization();
+  }
+  // Update logical connectivity state.
+  UpdateLogicalConnectivityStateLocked(new_state);
+  // Update the policy state.
+  subchannel_list()->MaybeUpdateAggregatedConnectivityStateLocked(
+      connectivity_status());
+}
+
+void LeastRequest::LeastRequestSubchannelData::
+    UpdateLogicalConnectivityStateLocked(
+        grpc_connectivity_state connectivity_state) {
+  LeastRequest* p = static_cast<LeastRequest*>(subchannel_list()->policy());
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+    gpr_log(
+        GPR_INFO,
+        "[LR %p] connectivity changed for subchannel %p, subchannel_list %p "
+        "(index %" PRIuPTR " of %" PRIuPTR "): prev_state=%s new_state=%s",
+        p, subchannel(), subchannel_list(), Index(),
+        subchannel_list()->num_subchannels(),
+        (logical_connectivity_state_.has_value()
+             ? ConnectivityStateName(*logical_connectivity_state_)
+             : "N/A"),
+        ConnectivityStateName(connectivity_state));
+  }
+  // Decide what state to report for aggregation purposes.
+  // If the last logical state was TRANSIENT_FAILURE, then ignore the
+  // state change unless the new state is READY.
+  if (logical_connectivity_state_.has_value() &&
+      *logical_connectivity_state_ == GRPC_CHANNEL_TRANSIENT_FAILURE &&
+      connectivity_state != GRPC_CHANNEL_READY) {
+    return;
+  }
+  // If the new state is IDLE, treat it as CONNECTING, since it will
+  // immediately transition into CONNECTING anyway.
+  if (connectivity_state == GRPC_CHANNEL_IDLE) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_least_request_trace)) {
+      gpr_log(GPR_INFO,
+              "[LR %p] subchannel %p, subchannel_list %p (index %" PRIuPTR
+              " of %" PRIuPTR "): treating IDLE as CONNECTING",
+              p, subchannel(), subchannel_list(), Index(),
+              subchannel_list()->num_subchannels());
+    }
+    connectivity_state = GRPC_CHANNEL_CONNECTING;
+  }
+  // If no change, return false.
+  if (logical_connectivity_state_.has_value() &&
+      *logical_connectivity_state_ == connectivity_state) {
+    return;
+  }
+  // Otherwise, update counters and logical state.
+  subchannel_list()->UpdateStateCountersLocked(logical_connectivity_state_,
+                                               connectivity_state);
+  logical_connectivity_state_ = connectivity_state;
+}
+
+//
+// factory
+//
+
+class LeastRequestFactory : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<LeastRequest>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    // All fields are optional, so the policy may be named without a config.
+    if (json.type() == Json::Type::JSON_NULL) {
+      return MakeRefCounted<LeastRequestConfig>();
+    }
+    return LoadRefCountedFromJson<LeastRequestConfig>(
+        json, JsonArgs(), "errors validating least_request LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterLeastRequestLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<LeastRequestFactory>());
+}
+
+}  // namespace grpc_core
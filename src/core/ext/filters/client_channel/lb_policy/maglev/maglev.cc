@@ -0,0 +1,814 @@
+//
+// Copyright 2018 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/attributes.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/filters/client_channel/client_channel.h"
+#include "src/core/ext/filters/client_channel/lb_policy/maglev/maglev_table.h"
+#include "src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.h"
+#include "src/core/ext/filters/client_channel/lb_policy/subchannel_list.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/gprpp/work_serializer.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_object_loader.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+#include "src/core/lib/load_balancing/lb_policy_factory.h"
+#include "src/core/lib/load_balancing/subchannel_interface.h"
+#include "src/core/lib/resolver/server_address.h"
+#include "src/core/lib/transport/connectivity_state.h"
+
+namespace grpc_core {
+
+TraceFlag grpc_lb_maglev_trace(false, "maglev_lb");
+
+namespace {
+
+constexpr absl::string_view kMaglev = "maglev_experimental";
+
+class MaglevLbConfig : public LoadBalancingPolicy::Config {
+ public:
+  MaglevLbConfig() = default;
+
+  MaglevLbConfig(const MaglevLbConfig&) = delete;
+  MaglevLbConfig& operator=(const MaglevLbConfig&) = delete;
+
+  MaglevLbConfig(MaglevLbConfig&&) = delete;
+  MaglevLbConfig& operator=(MaglevLbConfig&&) = delete;
+
+  absl::string_view name() const override { return kMaglev; }
+
+  uint64_t table_size() const { return table_size_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<MaglevLbConfig>()
+            .OptionalField("tableSize", &MaglevLbConfig::table_size_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    ValidationErrors::ScopedField field(errors, ".tableSize");
+    if (!errors->FieldHasErrors() &&
+        (table_size_ > MaglevTable::kMaxTableSize ||
+         !MaglevTable::IsPrime(table_size_))) {
+      errors->AddError(absl::StrCat("must be a prime no larger than ",
+                                    MaglevTable::kMaxTableSize));
+    }
+  }
+
+ private:
+  uint64_t table_size_ = MaglevTable::kDefaultTableSize;
+};
+
+//
+// maglev LB policy
+//
+// Picks the same way as ring_hash, but looks the request hash up in a
+// MaglevTable instead of binary-searching a ring, so each pick is a single
+// array access however many endpoints there are.
+//
+
+class Maglev : public LoadBalancingPolicy {
+ public:
+  explicit Maglev(Args args);
+
+  absl::string_view name() const override { return kMaglev; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ private:
+  ~Maglev() override;
+
+  // Forward declaration.
+  class MaglevSubchannelList;
+
+  // Data for a particular subchannel in a subchannel list.
+  // This subclass adds the following functionality:
+  // - Tracks the previous connectivity state of the subchannel, so that
+  //   we know how many subchannels are in each state.
+  class MaglevSubchannelData
+      : public SubchannelData<MaglevSubchannelList, MaglevSubchannelData> {
+   public:
+    MaglevSubchannelData(
+        SubchannelList<MaglevSubchannelList, MaglevSubchannelData>*
+            subchannel_list,
+        const ServerAddress& address,
+        RefCountedPtr<SubchannelInterface> subchannel)
+        : SubchannelData(subchannel_list, address, std::move(subchannel)) {}
+
+    grpc_connectivity_state GetConnectivityState() const {
+      return connectivity_state_.load(std::memory_order_relaxed);
+    }
+
+    absl::Status GetConnectivityStatus() const {
+      MutexLock lock(&mu_);
+      return connectivity_status_;
+    }
+
+   private:
+    // Performs connectivity state updates that need to be done only
+    // after we have started watching.
+    void ProcessConnectivityChangeLocked(
+        absl::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state) override;
+
+    // Last logical connectivity state seen.
+    // Note that this may differ from the state actually reported by the
+    // subchannel in some cases; for example, once this is set to
+    // TRANSIENT_FAILURE, we do not change it again until we get READY,
+    // so we skip any interim stops in CONNECTING.
+    // Uses an atomic so that it can be accessed outside of the WorkSerializer.
+    std::atomic<grpc_connectivity_state> connectivity_state_{GRPC_CHANNEL_IDLE};
+
+    mutable Mutex mu_;
+    absl::Status connectivity_status_ ABSL_GUARDED_BY(&mu_);
+  };
+
+  // A list of subchannels and the lookup table for those subchannels.
+  class MaglevSubchannelList
+      : public SubchannelList<MaglevSubchannelList, MaglevSubchannelData> {
+   public:
+    MaglevSubchannelList(Maglev* policy, ServerAddressList addresses,
+                           const ChannelArgs& args,
+                           MaglevSubchannelList* previous);
+
+    ~MaglevSubchannelList() override {
+      Maglev* p = static_cast<Maglev*>(policy());
+      p->Unref(DEBUG_LOCATION, "subchannel_list");
+    }
+
+    const MaglevTable& table() const { return *table_; }
+
+    // Updates the counters of subchannels in each state when a
+    // subchannel transitions from old_state to new_state.
+    void UpdateStateCountersLocked(grpc_connectivity_state old_state,
+                                   grpc_connectivity_state new_state);
+
+    // Updates the maglev policy's connectivity state based on the
+    // subchannel list's state counters, creating new picker.
+    // The index parameter indicates the index into the list of the subchannel
+    // whose status report triggered the call to
+    // UpdateMaglevConnectivityStateLocked().
+    // connection_attempt_complete is true if the subchannel just
+    // finished a connection attempt.
+    void UpdateMaglevConnectivityStateLocked(size_t index,
+                                               bool connection_attempt_complete,
+                                               absl::Status status);
+
+   private:
+    size_t num_idle_;
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    // Shared with the policy, which may hand it to the next list.
+    std::shared_ptr<const MaglevTable> table_;
+
+    // The index of the subchannel currently doing an internally
+    // triggered connection attempt, if any.
+    absl::optional<size_t> internally_triggered_connection_index_;
+
+    // TODO(roth): If we ever change the helper UpdateState() API to not
+    // need the status reported for TRANSIENT_FAILURE state (because
+    // it's not currently actually used for anything outside of the picker),
+    // then we will no longer need this data member.
+    absl::Status last_failure_;
+  };
+
+  class Picker : public SubchannelPicker {
+   public:
+    explicit Picker(RefCountedPtr<MaglevSubchannelList> subchannel_list)
+        : subchannel_list_(std::move(subchannel_list)) {}
+
+    ~Picker() override {
+      // Hop into WorkSerializer to unref the subchannel list, since that may
+      // trigger the unreffing of the underlying subchannels.
+      MakeOrphanable<WorkSerializerRunner>(std::move(subchannel_list_));
+    }
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // An interface for running a callback in the control plane WorkSerializer.
+    class WorkSerializerRunner : public Orphanable {
+     public:
+      explicit WorkSerializerRunner(
+          RefCountedPtr<MaglevSubchannelList> subchannel_list)
+          : subchannel_list_(std::move(subchannel_list)) {
+        GRPC_CLOSURE_INIT(&closure_, RunInExecCtx, this, nullptr);
+      }
+
+      void Orphan() override {
+        // Hop into ExecCtx, so that we're not holding the data plane mutex
+        // while we run control-plane code.
+        ExecCtx::Run(DEBUG_LOCATION, &closure_, absl::OkStatus());
+      }
+
+      // Will be invoked inside of the WorkSerializer.
+      virtual void Run() {}
+
+     protected:
+      Maglev* maglev_lb() const {
+        return static_cast<Maglev*>(subchannel_list_->policy());
+      }
+
+     private:
+      static void RunInExecCtx(void* arg, grpc_error_handle /*error*/) {
+        auto* self = static_cast<WorkSerializerRunner*>(arg);
+        self->maglev_lb()->work_serializer()->Run(
+            [self]() {
+              self->Run();
+              delete self;
+            },
+            DEBUG_LOCATION);
+      }
+
+      RefCountedPtr<MaglevSubchannelList> subchannel_list_;
+      grpc_closure closure_;
+    };
+
+    // A fire-and-forget class that schedules subchannel connection attempts
+    // on the control plane WorkSerializer.
+    class SubchannelConnectionAttempter : public WorkSerializerRunner {
+     public:
+      explicit SubchannelConnectionAttempter(
+          RefCountedPtr<MaglevSubchannelList> subchannel_list)
+          : WorkSerializerRunner(std::move(subchannel_list)) {}
+
+      void AddSubchannel(RefCountedPtr<SubchannelInterface> subchannel) {
+        subchannels_.push_back(std::move(subchannel));
+      }
+
+      void Run() override {
+        if (!maglev_lb()->shutdown_) {
+          for (auto& subchannel : subchannels_) {
+            subchannel->RequestConnection();
+          }
+        }
+      }
+
+     private:
+      std::vector<RefCountedPtr<SubchannelInterface>> subchannels_;
+    };
+
+    RefCountedPtr<MaglevSubchannelList> subchannel_list_;
+  };
+
+  // An endpoint's hash key and weight.
+  using TableEndpoint = std::pair<std::string, uint32_t>;
+
+  void ShutdownLocked() override;
+
+  // Returns a table for the given endpoints, reusing the last one built if
+  // neither the endpoints nor the table size have changed.
+  std::shared_ptr<const MaglevTable> GetOrBuildTableLocked(
+      std::vector<TableEndpoint> endpoints);
+
+  // Current config from resolver.
+  RefCountedPtr<MaglevLbConfig> config_;
+
+  // list of subchannels.
+  RefCountedPtr<MaglevSubchannelList> subchannel_list_;
+  RefCountedPtr<MaglevSubchannelList> latest_pending_subchannel_list_;
+  // The last table built and what it was built from.  Most resolver
+  // updates (e.g. xDS EDS updates that only touch other localities or
+  // metadata) do not change the endpoints, and rebuilding a large table for
+  // them would be wasted work on the control plane.
+  std::vector<TableEndpoint> table_endpoints_;
+  uint64_t table_size_ = 0;
+  std::shared_ptr<const MaglevTable> table_;
+  // indicating if we are shutting down.
+  bool shutdown_ = false;
+};
+
+//
+// Maglev::Picker
+//
+
+Maglev::PickResult Maglev::Picker::Pick(PickArgs args) {
+  auto* call_state = static_cast<ClientChannel::LoadBalancedCall::LbCallState*>(
+      args.call_state);
+  auto hash = call_state->GetCallAttribute(RequestHashAttributeName());
+  uint64_t h;
+  if (!absl::SimpleAtoi(hash, &h)) {
+    return PickResult::Fail(
+        absl::InternalError("maglev hash value is not a number"));
+  }
+  const MaglevTable& table = subchannel_list_->table();
+  const size_t first_index = h % table.size();
+  MaglevSubchannelData* first = subchannel_list_->subchannel(table[first_index]);
+  OrphanablePtr<SubchannelConnectionAttempter> subchannel_connection_attempter;
+  auto ScheduleSubchannelConnectionAttempt =
+      [&](RefCountedPtr<SubchannelInterface> subchannel) {
+        if (subchannel_connection_attempter == nullptr) {
+          subchannel_connection_attempter =
+              MakeOrphanable<SubchannelConnectionAttempter>(
+                  subchannel_list_->Ref(DEBUG_LOCATION,
+                                        "SubchannelConnectionAttempter"));
+        }
+        subchannel_connection_attempter->AddSubchannel(std::move(subchannel));
+      };
+  switch (first->GetConnectivityState()) {
+    case GRPC_CHANNEL_READY:
+      return PickResult::Complete(first->subchannel()->Ref());
+    case GRPC_CHANNEL_IDLE:
+      ScheduleSubchannelConnectionAttempt(first->subchannel()->Ref());
+      ABSL_FALLTHROUGH_INTENDED;
+    case GRPC_CHANNEL_CONNECTING:
+      return PickResult::Queue();
+    default:  // GRPC_CHANNEL_TRANSIENT_FAILURE
+      break;
+  }
+  ScheduleSubchannelConnectionAttempt(first->subchannel()->Ref());
+  // Walk the slots after the chosen one to find a subchannel in READY,
+  // the same way ring_hash walks its ring.  On the way, we make sure the
+  // right set of connection attempts will happen.  Every subchannel owns
+  // many slots, so stop once each one has been looked at.
+  const size_t num_subchannels = subchannel_list_->num_subchannels();
+  std::vector<bool> seen(num_subchannels, false);
+  seen[table[first_index]] = true;
+  size_t num_seen = 1;
+  bool found_second_subchannel = false;
+  bool found_first_non_failed = false;
+  for (size_t i = 1; i < table.size() && num_seen < num_subchannels; ++i) {
+    const uint32_t index = table[(first_index + i) % table.size()];
+    if (seen[index]) continue;
+    seen[index] = true;
+    ++num_seen;
+    MaglevSubchannelData* entry = subchannel_list_->subchannel(index);
+    grpc_connectivity_state connectivity_state = entry->GetConnectivityState();
+    if (connectivity_state == GRPC_CHANNEL_READY) {
+      return PickResult::Complete(entry->subchannel()->Ref());
+    }
+    if (!found_second_subchannel) {
+      switch (connectivity_state) {
+        case GRPC_CHANNEL_IDLE:
+          ScheduleSubchannelConnectionAttempt(entry->subchannel()->Ref());
+          ABSL_FALLTHROUGH_INTENDED;
+        case GRPC_CHANNEL_CONNECTING:
+          return PickResult::Queue();
+        default:
+          break;
+      }
+      found_second_subchannel = true;
+    }
+    if (!found_first_non_failed) {
+      if (connectivity_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+        ScheduleSubchannelConnectionAttempt(entry->subchannel()->Ref());
+      } else {
+        if (connectivity_state == GRPC_CHANNEL_IDLE) {
+          ScheduleSubchannelConnectionAttempt(entry->subchannel()->Ref());
+        }
+        found_first_non_failed = true;
+      }
+    }
+  }
+  return PickResult::Fail(absl::UnavailableError(absl::StrCat(
+      "maglev cannot find a connected subchannel; first failure: ",
+      first->GetConnectivityStatus().ToString())));
+}
+
+//
+// Maglev::MaglevSubchannelList
+//
+
+Maglev::MaglevSubchannelList::MaglevSubchannelList(
+    Maglev* policy, ServerAddressList addresses, const ChannelArgs& args,
+    MaglevSubchannelList* previous)
+    : SubchannelList(policy,
+                     (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)
+                          ? "MaglevSubchannelList"
+                          : nullptr),
+                     std::move(addresses), policy->channel_control_helper(),
+                     args, previous),
+      num_idle_(num_subchannels()) {
+  // Need to maintain a ref to the LB policy as long as we maintain
+  // any references to subchannels, since the subchannels'
+  // pollset_sets will include the LB policy's pollset_set.
+  policy->Ref(DEBUG_LOCATION, "subchannel_list").release();
+  if (num_subchannels() == 0) return;
+  // Build the table, keyed the same way as ring_hash's ring.
+  std::vector<TableEndpoint> endpoints;
+  endpoints.reserve(num_subchannels());
+  for (size_t i = 0; i < num_subchannels(); ++i) {
+    MaglevSubchannelData* sd = subchannel(i);
+    const ServerAddressWeightAttribute* weight_attribute = static_cast<
+        const ServerAddressWeightAttribute*>(sd->address().GetAttribute(
+        ServerAddressWeightAttribute::kServerAddressWeightAttributeKey));
+    endpoints.emplace_back(
+        grpc_sockaddr_to_string(&sd->address().address(), false).value(),
+        weight_attribute != nullptr ? weight_attribute->weight() : 1);
+  }
+  table_ = policy->GetOrBuildTableLocked(std::move(endpoints));
+}
+
+void Maglev::MaglevSubchannelList::UpdateStateCountersLocked(
+    grpc_connectivity_state old_state, grpc_connectivity_state new_state) {
+  if (old_state == GRPC_CHANNEL_IDLE) {
+    GPR_ASSERT(num_idle_ > 0);
+    --num_idle_;
+  } else if (old_state == GRPC_CHANNEL_READY) {
+    GPR_ASSERT(num_ready_ > 0);
+    --num_ready_;
+  } else if (old_state == GRPC_CHANNEL_CONNECTING) {
+    GPR_ASSERT(num_connecting_ > 0);
+    --num_connecting_;
+  } else if (old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    GPR_ASSERT(num_transient_failure_ > 0);
+    --num_transient_failure_;
+  }
+  GPR_ASSERT(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    ++num_idle_;
+  } else if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void Maglev::MaglevSubchannelList::UpdateMaglevConnectivityStateLocked(
+    size_t index, bool connection_attempt_complete, absl::Status status) {
+  Maglev* p = static_cast<Maglev*>(policy());
+  // If this is latest_pending_subchannel_list_, then swap it into
+  // subchannel_list_ as soon as we get the initial connectivity state
+  // report for every subchannel in the list.
+  if (p->latest_pending_subchannel_list_.get() == this &&
+      AllSubchannelsSeenInitialState()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)) {
+      gpr_log(GPR_INFO, "[MG %p] replacing subchannel list %p with %p", p,
+              p->subchannel_list_.get(), this);
+    }
+    p->subchannel_list_ = std::move(p->latest_pending_subchannel_list_);
+  }
+  // Only set connectivity state if this is the current subchannel list.
+  if (p->subchannel_list_.get() != this) return;
+  // The overall aggregation rules here are:
+  // 1. If there is at least one subchannel in READY state, report READY.
+  // 2. If there are 2 or more subchannels in TRANSIENT_FAILURE state, report
+  //    TRANSIENT_FAILURE.
+  // 3. If there is at least one subchannel in CONNECTING state, report
+  //    CONNECTING.
+  // 4. If there is one subchannel in TRANSIENT_FAILURE state and there is
+  //    more than one subchannel, report CONNECTING.
+  // 5. If there is at least one subchannel in IDLE state, report IDLE.
+  // 6. Otherwise, report TRANSIENT_FAILURE.
+  //
+  // We set start_connection_attempt to true if we match rules 2, 3, or 6.
+  grpc_connectivity_state state;
+  bool start_connection_attempt = false;
+  if (num_ready_ > 0) {
+    state = GRPC_CHANNEL_READY;
+  } else if (num_transient_failure_ >= 2) {
+    state = GRPC_CHANNEL_TRANSIENT_FAILURE;
+    start_connection_attempt = true;
+  } else if (num_connecting_ > 0) {
+    state = GRPC_CHANNEL_CONNECTING;
+  } else if (num_transient_failure_ == 1 && num_subchannels() > 1) {
+    state = GRPC_CHANNEL_CONNECTING;
+    start_connection_attempt = true;
+  } else if (num_idle_ > 0) {
+    state = GRPC_CHANNEL_IDLE;
+  } else {
+    state = GRPC_CHANNEL_TRANSIENT_FAILURE;
+    start_connection_attempt = true;
+  }
+  // In TRANSIENT_FAILURE, report the last reported failure.
+  // Otherwise, report OK.
+  if (state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    if (!status.ok()) {
+      last_failure_ = absl::UnavailableError(absl::StrCat(
+          "no reachable subchannels; last error: ", status.ToString()));
+    }
+    status = last_failure_;
+  } else {
+    status = absl::OkStatus();
+  }
+  // Generate new picker and return it to the channel.
+  // Note that we use our own picker regardless of connectivity state.
+  p->channel_control_helper()->UpdateState(
+      state, status,
+      MakeRefCounted<Picker>(Ref(DEBUG_LOCATION, "MaglevPicker")));
+  // While the maglev policy is reporting TRANSIENT_FAILURE, it will
+  // not be getting any pick requests from the priority policy.
+  // However, because the maglev policy does not attempt to
+  // reconnect to subchannels unless it is getting pick requests,
+  // it will need special handling to ensure that it will eventually
+  // recover from TRANSIENT_FAILURE state once the problem is resolved.
+  // Specifically, it will make sure that it is attempting to connect to
+  // at least one subchannel at any given time.  After a given subchannel
+  // fails a connection attempt, it will move on to the next subchannel
+  // in the list.  It will keep doing this until one of the subchannels
+  // successfully connects, at which point it will report READY and stop
+  // proactively trying to connect.  The policy will remain in
+  // TRANSIENT_FAILURE until at least one subchannel becomes connected,
+  // even if subchannels are in state CONNECTING during that time.
+  //
+  // Note that we do the same thing when the policy is in state
+  // CONNECTING, just to ensure that we don't remain in CONNECTING state
+  // indefinitely if there are no new picks coming in.
+  if (internally_triggered_connection_index_.has_value() &&
+      *internally_triggered_connection_index_ == index &&
+      connection_attempt_complete) {
+    internally_triggered_connection_index_.reset();
+  }
+  if (start_connection_attempt &&
+      !internally_triggered_connection_index_.has_value()) {
+    size_t next_index = (index + 1) % num_subchannels();
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)) {
+      gpr_log(GPR_INFO,
+              "[MG %p] triggering internal connection attempt for subchannel "
+              "%p, subchannel_list %p (index %" PRIuPTR " of %" PRIuPTR ")",
+              p, subchannel(next_index)->subchannel(), this, next_index,
+              num_subchannels());
+    }
+    internally_triggered_connection_index_ = next_index;
+    subchannel(next_index)->subchannel()->RequestConnection();
+  }
+}
+
+//
+// Maglev::MaglevSubchannelData
+//
+
+void Maglev::MaglevSubchannelData::ProcessConnectivityChangeLocked(
+    absl::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  Maglev* p = static_cast<Maglev*>(subchannel_list()->policy());
+  grpc_connectivity_state last_connectivity_state = GetConnectivityState();
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)) {
+    gpr_log(
+        GPR_INFO,
+        "[MG %p] connectivity changed for subchannel %p, subchannel_list %p "
+        "(index %" PRIuPTR " of %" PRIuPTR "): prev_state=%s new_state=%s",
+        p, subchannel(), subchannel_list(), Index(),
+        subchannel_list()->num_subchannels(),
+        ConnectivityStateName(last_connectivity_state),
+        ConnectivityStateName(new_state));
+  }
+  GPR_ASSERT(subchannel() != nullptr);
+  // If this is not the initial state notification and the new state is
+  // TRANSIENT_FAILURE or IDLE, re-resolve.
+  // Note that we don't want to do this on the initial state notification,
+  // because that would result in an endless loop of re-resolution.
+  if (old_state.has_value() && (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
+                                new_state == GRPC_CHANNEL_IDLE)) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)) {
+      gpr_log(GPR_INFO,
+              "[MG %p] Subchannel %p reported %s; requesting re-resolution", p,
+              subchannel(), ConnectivityStateName(new_state));
+    }
+    p->channel_control_helper()->RequestReresolution();
+  }
+  const bool connection_attempt_complete = new_state != GRPC_CHANNEL_CONNECTING;
+  // Decide what state to report for the purposes of aggregation and
+  // picker behavior.
+  // If the last recorded state was TRANSIENT_FAILURE, ignore the update
+  // unless the new state is READY.
+  bool update_status = true;
+  absl::Status status = connectivity_status();
+  if (last_connectivity_state == GRPC_CHANNEL_TRANSIENT_FAILURE &&
+      new_state != GRPC_CHANNEL_READY &&
+      new_state != GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    new_state = GRPC_CHANNEL_TRANSIENT_FAILURE;
+    {
+      MutexLock lock(&mu_);
+      status = connectivity_status_;
+    }
+    update_status = false;
+  }
+  // Update state counters used for aggregation.
+  subchannel_list()->UpdateStateCountersLocked(last_connectivity_state,
+                                               new_state);
+  // Update status seen by picker if needed.
+  if (update_status) {
+    MutexLock lock(&mu_);
+    connectivity_status_ = connectivity_status();
+  }
+  // Update last seen state, also used by picker.
+  connectivity_state_.store(new_state, std::memory_order_relaxed);
+  // Update the maglev policy's connectivity state, creating new picker.
+  subchannel_list()->UpdateMaglevConnectivityStateLocked(
+      Index(), connection_attempt_complete, status);
+}
+
+//
+// Maglev
+//
+
+Maglev::Maglev(Args args) : LoadBalancingPolicy(std::move(args)) {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)) {
+    gpr_log(GPR_INFO, "[MG %p] Created", this);
+  }
+}
+
+Maglev::~Maglev() {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)) {
+    gpr_log(GPR_INFO, "[MG %p] Destroying Maglev policy", this);
+  }
+  GPR_ASSERT(subchannel_list_ == nullptr);
+  GPR_ASSERT(latest_pending_subchannel_list_ == nullptr);
+}
+
+void Maglev::ShutdownLocked() {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)) {
+    gpr_log(GPR_INFO, "[MG %p] Shutting down", this);
+  }
+  shutdown_ = true;
+  subchannel_list_.reset();
+  latest_pending_subchannel_list_.reset();
+  table_.reset();
+}
+
+void Maglev::ResetBackoffLocked() {
+  subchannel_list_->ResetBackoffLocked();
+  if (latest_pending_subchannel_list_ != nullptr) {
+    latest_pending_subchannel_list_->ResetBackoffLocked();
+  }
+}
+
+absl::Status Maglev::UpdateLocked(UpdateArgs args) {
+  config_ = std::move(args.config);
+  ServerAddressList addresses;
+  if (args.addresses.ok()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)) {
+      gpr_log(GPR_INFO, "[MG %p] received update with %" PRIuPTR " addresses",
+              this, args.addresses->size());
+    }
+    // Sort the addresses so that an update that only reorders them
+    // produces the same subchannel indexes and can reuse the table.
+    addresses = *std::move(args.addresses);
+    std::stable_sort(addresses.begin(), addresses.end(),
+                     [](const ServerAddress& address1,
+                        const ServerAddress& address2) {
+                       const grpc_resolved_address& addr1 = address1.address();
+                       const grpc_resolved_address& addr2 = address2.address();
+                       if (addr1.len != addr2.len) return addr1.len < addr2.len;
+                       return memcmp(addr1.addr, addr2.addr, addr1.len) < 0;
+                     });
+  } else {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)) {
+      gpr_log(GPR_INFO, "[MG %p] received update with addresses error: %s",
+              this, args.addresses.status().ToString().c_str());
+    }
+    // If we already have a subchannel list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (subchannel_list_ != nullptr) return args.addresses.status();
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace) &&
+      latest_pending_subchannel_list_ != nullptr) {
+    gpr_log(GPR_INFO, "[MG %p] replacing latest pending subchannel list %p",
+            this, latest_pending_subchannel_list_.get());
+  }
+  // Reuse subchannels from the newest list we have.
+  latest_pending_subchannel_list_ = MakeRefCounted<MaglevSubchannelList>(
+      this, std::move(addresses), args.args,
+      latest_pending_subchannel_list_ != nullptr
+          ? latest_pending_subchannel_list_.get()
+          : subchannel_list_.get());
+  latest_pending_subchannel_list_->StartWatchingLocked();
+  // If we have no existing list or the new list is empty, immediately
+  // promote the new list.
+  // Otherwise, do nothing; the new list will be promoted when the
+  // initial subchannel states are reported.
+  if (subchannel_list_ == nullptr ||
+      latest_pending_subchannel_list_->num_subchannels() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace) &&
+        subchannel_list_ != nullptr) {
+      gpr_log(GPR_INFO,
+              "[MG %p] empty address list, replacing subchannel list %p", this,
+              subchannel_list_.get());
+    }
+    subchannel_list_ = std::move(latest_pending_subchannel_list_);
+    // If the new list is empty, report TRANSIENT_FAILURE.
+    if (subchannel_list_->num_subchannels() == 0) {
+      absl::Status status =
+          args.addresses.ok()
+              ? absl::UnavailableError(
+                    absl::StrCat("empty address list: ", args.resolution_note))
+              : args.addresses.status();
+      channel_control_helper()->UpdateState(
+          GRPC_CHANNEL_TRANSIENT_FAILURE, status,
+          MakeRefCounted<TransientFailurePicker>(status));
+      return status;
+    }
+    // Otherwise, report IDLE.
+    subchannel_list_->UpdateMaglevConnectivityStateLocked(
+        /*index=*/0, /*connection_attempt_complete=*/false, absl::OkStatus());
+  }
+  return absl::OkStatus();
+}
+
+std::shared_ptr<const MaglevTable> Maglev::GetOrBuildTableLocked(
+    std::vector<TableEndpoint> endpoints) {
+  const uint64_t table_size = config_->table_size();
+  if (table_ != nullptr && table_size == table_size_ &&
+      endpoints == table_endpoints_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)) {
+      gpr_log(GPR_INFO, "[MG %p] endpoints unchanged, reusing table %p", this,
+              table_.get());
+    }
+    return table_;
+  }
+  std::vector<MaglevTable::Endpoint> table_endpoints;
+  table_endpoints.reserve(endpoints.size());
+  for (const auto& endpoint : endpoints) {
+    table_endpoints.push_back({endpoint.first, endpoint.second});
+  }
+  table_ = std::make_shared<const MaglevTable>(table_endpoints, table_size);
+  table_endpoints_ = std::move(endpoints);
+  table_size_ = table_size;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_maglev_trace)) {
+    gpr_log(GPR_INFO,
+            "[MG %p] built table %p with %" PRIu64 " slots for %" PRIuPTR
+            " endpoints",
+            this, table_.get(), table_size, table_endpoints_.size());
+  }
+  return table_;
+}
+
+//
+// factory
+//
+
+class MaglevFactory : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<Maglev>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kMaglev; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    // All fields are optional, so the policy may be named without a config.
+    if (json.type() == Json::Type::JSON_NULL) {
+      return MakeRefCounted<MaglevLbConfig>();
+    }
+    return LoadRefCountedFromJson<MaglevLbConfig>(
+        json, JsonArgs(), "errors validating maglev LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterMaglevLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<MaglevFactory>());
+}
+
+}  // namespace grpc_core
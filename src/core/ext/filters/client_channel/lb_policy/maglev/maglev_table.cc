@@ -0,0 +1,98 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/maglev/maglev_table.h"
+
+#include <algorithm>
+#include <limits>
+
+#define XXH_INLINE_ALL
+#include "xxhash.h"
+
+#include <grpc/support/log.h>
+
+namespace grpc_core {
+
+namespace {
+
+constexpr uint32_t kEmptySlot = std::numeric_limits<uint32_t>::max();
+
+}  // namespace
+
+constexpr uint64_t MaglevTable::kDefaultTableSize;
+constexpr uint64_t MaglevTable::kMaxTableSize;
+
+bool MaglevTable::IsPrime(uint64_t n) {
+  if (n < 2) return false;
+  if (n % 2 == 0) return n == 2;
+  for (uint64_t d = 3; d * d <= n; d += 2) {
+    if (n % d == 0) return false;
+  }
+  return true;
+}
+
+MaglevTable::MaglevTable(absl::Span<const Endpoint> endpoints,
+                         uint64_t table_size) {
+  GPR_ASSERT(!endpoints.empty());
+  GPR_ASSERT(IsPrime(table_size));
+  // Per-endpoint state for walking its permutation of the slots.  Since
+  // the table size is prime, any skip in [1, table_size) visits every
+  // slot exactly once before repeating.
+  struct BuildEntry {
+    uint64_t position;
+    uint64_t skip;
+    uint64_t weight;
+    // The entry claims its next slot in the first round r for which
+    // r * weight >= target.
+    uint64_t target;
+  };
+  std::vector<BuildEntry> entries;
+  entries.reserve(endpoints.size());
+  uint64_t max_weight = 0;
+  for (const Endpoint& endpoint : endpoints) {
+    BuildEntry entry;
+    entry.position =
+        XXH64(endpoint.key.data(), endpoint.key.size(), 0) % table_size;
+    entry.skip =
+        XXH64(endpoint.key.data(), endpoint.key.size(), 1) % (table_size - 1) +
+        1;
+    entry.weight = std::max<uint64_t>(endpoint.weight, 1);
+    max_weight = std::max(max_weight, entry.weight);
+    entries.push_back(entry);
+  }
+  for (BuildEntry& entry : entries) entry.target = max_weight;
+  table_.assign(table_size, kEmptySlot);
+  uint64_t filled = 0;
+  // The heaviest endpoints claim a slot in every round, and lighter ones
+  // only once their accumulated weight has caught up with the heaviest.
+  for (uint64_t round = 1; filled < table_size; ++round) {
+    for (size_t i = 0; i < entries.size() && filled < table_size; ++i) {
+      BuildEntry& entry = entries[i];
+      if (round * entry.weight < entry.target) continue;
+      entry.target += max_weight;
+      while (table_[entry.position] != kEmptySlot) {
+        entry.position = (entry.position + entry.skip) % table_size;
+      }
+      table_[entry.position] = static_cast<uint32_t>(i);
+      entry.position = (entry.position + entry.skip) % table_size;
+      ++filled;
+    }
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,79 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_MAGLEV_MAGLEV_TABLE_H
+#define GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_MAGLEV_MAGLEV_TABLE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace grpc_core {
+
+// A Maglev lookup table, as described in "Maglev: A Fast and Reliable
+// Software Network Load Balancer" (Eisenbud et al., NSDI 2016), with the
+// weighted population scheme used by Envoy.
+//
+// Each endpoint walks its own permutation of the table slots, derived from
+// hashing its key, and the endpoints take turns claiming the next free slot
+// on their permutation.  This spreads the slots evenly (in proportion to
+// the weights), and when an endpoint is added or removed most slots keep
+// their previous owner.
+//
+// Construction is O(M log M) for a table of size M.  Lookup is a single
+// array access.  Stores four bytes per slot.
+class MaglevTable {
+ public:
+  struct Endpoint {
+    // Hashed to place the endpoint.  Need not outlive the constructor.
+    absl::string_view key;
+    // Relative weight.  Zero is treated as one.
+    uint32_t weight = 1;
+  };
+
+  static constexpr uint64_t kDefaultTableSize = 65537;
+  static constexpr uint64_t kMaxTableSize = 5000011;
+
+  // Builds a table with table_size slots, each holding an index into
+  // endpoints.  table_size must be prime, and should be much larger than
+  // the number of endpoints for the weights to be honored closely.
+  // endpoints must not be empty.
+  MaglevTable(absl::Span<const Endpoint> endpoints, uint64_t table_size);
+
+  // Returns whether n is prime, for validating table sizes.
+  static bool IsPrime(uint64_t n);
+
+  // Returns the index of the endpoint that owns hash.
+  uint32_t Lookup(uint64_t hash) const { return table_[hash % table_.size()]; }
+
+  // Returns the index of the endpoint that owns slot i.
+  uint32_t operator[](size_t i) const { return table_[i]; }
+
+  size_t size() const { return table_.size(); }
+
+ private:
+  std::vector<uint32_t> table_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_LB_POLICY_MAGLEV_MAGLEV_TABLE_H
@@ -49,6 +49,7 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/validation_errors.h"
@@ -215,29 +216,66 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
 
   class SubchannelState : public RefCounted<SubchannelState> {
    public:
-    struct Bucket {
-      std::atomic<uint64_t> successes;
-      std::atomic<uint64_t> failures;
+    // Call counts, sharded by CPU so that calls to the same endpoint from
+    // different CPUs don't contend, and summed at each ejection interval.
+    // There is a bucket for every endpoint, so CPUs share shards beyond
+    // kMaxBucketShards.
+    class Bucket {
+     public:
+      void AddSuccess() {
+        shards_.this_cpu().successes.fetch_add(1, std::memory_order_relaxed);
+      }
+      void AddFailure() {
+        shards_.this_cpu().failures.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      uint64_t successes() const {
+        uint64_t successes = 0;
+        for (const Shard& shard : shards_) {
+          successes += shard.successes.load(std::memory_order_relaxed);
+        }
+        return successes;
+      }
+      uint64_t failures() const {
+        uint64_t failures = 0;
+        for (const Shard& shard : shards_) {
+          failures += shard.failures.load(std::memory_order_relaxed);
+        }
+        return failures;
+      }
+
+      void Reset() {
+        for (Shard& shard : shards_) {
+          shard.successes.store(0, std::memory_order_relaxed);
+          shard.failures.store(0, std::memory_order_relaxed);
+        }
+      }
+
+     private:
+      static constexpr size_t kMaxBucketShards = 4;
+
+      struct alignas(GPR_CACHELINE_SIZE) Shard {
+        std::atomic<uint64_t> successes{0};
+        std::atomic<uint64_t> failures{0};
+      };
+
+      PerCpu<Shard> shards_{kMaxBucketShards};
     };
 
     void RotateBucket() {
-      backup_bucket_->successes = 0;
-      backup_bucket_->failures = 0;
+      backup_bucket_->Reset();
       current_bucket_.swap(backup_bucket_);
       active_bucket_.store(current_bucket_.get());
     }
 
     absl::optional<std::pair<double, uint64_t>> GetSuccessRateAndVolume() {
-      uint64_t total_request =
-          backup_bucket_->successes + backup_bucket_->failures;
+      const uint64_t successes = backup_bucket_->successes();
+      const uint64_t total_request = successes + backup_bucket_->failures();
       if (total_request == 0) {
         return absl::nullopt;
       }
-      double success_rate =
-          backup_bucket_->successes * 100.0 /
-          (backup_bucket_->successes + backup_bucket_->failures);
-      return {
-          {success_rate, backup_bucket_->successes + backup_bucket_->failures}};
+      double success_rate = successes * 100.0 / total_request;
+      return {{success_rate, total_request}};
     }
 
     void AddSubchannel(SubchannelWrapper* wrapper) {
@@ -248,9 +286,9 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
       subchannels_.erase(wrapper);
     }
 
-    void AddSuccessCount() { active_bucket_.load()->successes.fetch_add(1); }
+    void AddSuccessCount() { active_bucket_.load()->AddSuccess(); }
 
-    void AddFailureCount() { active_bucket_.load()->failures.fetch_add(1); }
+    void AddFailureCount() { active_bucket_.load()->AddFailure(); }
 
     absl::optional<Timestamp> ejection_time() const { return ejection_time_; }
 
@@ -31,17 +31,22 @@
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/log.h>
 
 #include "src/core/ext/filters/client_channel/lb_policy/subchannel_list.h"
+#include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/sockaddr.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/load_balancing/lb_policy.h"
 #include "src/core/lib/load_balancing/lb_policy_factory.h"
@@ -100,13 +105,15 @@ class PickFirst : public LoadBalancingPolicy {
                               PickFirstSubchannelData> {
    public:
     PickFirstSubchannelList(PickFirst* policy, ServerAddressList addresses,
-                            const ChannelArgs& args)
+                            const ChannelArgs& args,
+                            Duration connection_attempt_delay)
         : SubchannelList(policy,
                          (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)
                               ? "PickFirstSubchannelList"
                               : nullptr),
                          std::move(addresses), policy->channel_control_helper(),
-                         args) {
+                         args),
+          connection_attempt_delay_(connection_attempt_delay) {
       // Need to maintain a ref to the LB policy as long as we maintain
       // any references to subchannels, since the subchannels'
       // pollset_sets will include the LB policy's pollset_set.
@@ -129,7 +136,24 @@ class PickFirst : public LoadBalancingPolicy {
     size_t attempting_index() const { return attempting_index_; }
     void set_attempting_index(size_t index) { attempting_index_ = index; }
 
+    void Orphan() override {
+      CancelConnectionAttemptTimerLocked();
+      SubchannelList::Orphan();
+    }
+
+    // If connection attempts are being raced, (re)starts the timer after
+    // which the next address is tried without waiting for the current
+    // attempt to finish.  Does nothing once every address has been tried.
+    void StartConnectionAttemptTimerLocked();
+    void CancelConnectionAttemptTimerLocked();
+
    private:
+    void OnConnectionAttemptTimerLocked();
+
+    // Zero if connection attempts are not raced.
+    const Duration connection_attempt_delay_;
+    absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+        connection_attempt_timer_handle_;
     bool in_transient_failure_ = false;
     size_t attempting_index_ = 0;
   };
@@ -165,6 +189,35 @@ class PickFirst : public LoadBalancingPolicy {
   bool shutdown_ = false;
 };
 
+// Reorders addresses so that IPv6 and other addresses alternate, starting
+// with the family of the first address, as recommended by RFC 8305
+// section 4.  Otherwise preserves the order within each family.
+ServerAddressList InterleaveAddressFamilies(ServerAddressList addresses) {
+  if (addresses.size() < 2) return addresses;
+  auto is_ipv6 = [](const ServerAddress& address) {
+    return grpc_sockaddr_get_family(&address.address()) == GRPC_AF_INET6;
+  };
+  const bool first_is_ipv6 = is_ipv6(addresses.front());
+  ServerAddressList first_family;
+  ServerAddressList other_family;
+  for (auto& address : addresses) {
+    (is_ipv6(address) == first_is_ipv6 ? first_family : other_family)
+        .push_back(std::move(address));
+  }
+  ServerAddressList interleaved;
+  interleaved.reserve(addresses.size());
+  for (size_t i = 0; i < first_family.size() || i < other_family.size();
+       ++i) {
+    if (i < first_family.size()) {
+      interleaved.push_back(std::move(first_family[i]));
+    }
+    if (i < other_family.size()) {
+      interleaved.push_back(std::move(other_family[i]));
+    }
+  }
+  return interleaved;
+}
+
 PickFirst::PickFirst(Args args) : LoadBalancingPolicy(std::move(args)) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
     gpr_log(GPR_INFO, "Pick First %p created.", this);
@@ -212,6 +265,15 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
   if (latest_update_args_.addresses.ok()) {
     addresses = *latest_update_args_.addresses;
   }
+  const Duration connection_attempt_delay = std::max(
+      Duration::Zero(),
+      latest_update_args_.args
+          .GetDurationFromIntMillis(
+              GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS)
+          .value_or(Duration::Zero()));
+  if (connection_attempt_delay > Duration::Zero()) {
+    addresses = InterleaveAddressFamilies(std::move(addresses));
+  }
   // Replace latest_pending_subchannel_list_.
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace) &&
       latest_pending_subchannel_list_ != nullptr) {
@@ -220,7 +282,8 @@ void PickFirst::AttemptToConnectUsingLatestUpdateArgsLocked() {
             latest_pending_subchannel_list_.get());
   }
   latest_pending_subchannel_list_ = MakeRefCounted<PickFirstSubchannelList>(
-      this, std::move(addresses), latest_update_args_.args);
+      this, std::move(addresses), latest_update_args_.args,
+      connection_attempt_delay);
   latest_pending_subchannel_list_->StartWatchingLocked();
   // Empty update or no valid subchannels.  Put the channel in
   // TRANSIENT_FAILURE and request re-resolution.
@@ -378,6 +441,7 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
   if (!old_state.has_value()) {
     if (subchannel_list()->AllSubchannelsSeenInitialState()) {
       subchannel_list()->subchannel(0)->subchannel()->RequestConnection();
+      subchannel_list()->StartConnectionAttemptTimerLocked();
     }
     return;
   }
@@ -439,6 +503,9 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
       if (sd_state.has_value() && *sd_state == GRPC_CHANNEL_IDLE) {
         sd->subchannel()->RequestConnection();
       }
+      // The next attempt gets the full delay before another one is raced
+      // against it.
+      subchannel_list()->StartConnectionAttemptTimerLocked();
       break;
     }
     case GRPC_CHANNEL_IDLE: {
@@ -490,6 +557,7 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
     gpr_log(GPR_INFO, "Pick First %p selected subchannel %p", p, subchannel());
   }
   p->selected_ = this;
+  subchannel_list()->CancelConnectionAttemptTimerLocked();
   p->channel_control_helper()->UpdateState(
       GRPC_CHANNEL_READY, absl::Status(),
       MakeRefCounted<Picker>(subchannel()->Ref()));
@@ -500,6 +568,66 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
   }
 }
 
+//
+// PickFirst::PickFirstSubchannelList
+//
+
+void PickFirst::PickFirstSubchannelList::StartConnectionAttemptTimerLocked() {
+  CancelConnectionAttemptTimerLocked();
+  if (connection_attempt_delay_ == Duration::Zero() || in_transient_failure_ ||
+      attempting_index_ + 1 >= num_subchannels()) {
+    return;
+  }
+  PickFirst* p = static_cast<PickFirst*>(policy());
+  connection_attempt_timer_handle_ =
+      p->channel_control_helper()->GetEventEngine()->RunAfter(
+          connection_attempt_delay_,
+          [self = WeakRef(DEBUG_LOCATION, "ConnectionAttemptTimer")]() mutable {
+            ApplicationCallbackExecCtx callback_exec_ctx;
+            ExecCtx exec_ctx;
+            auto* pick_first = static_cast<PickFirst*>(self->policy());
+            pick_first->work_serializer()->Run(
+                [self = std::move(self)]() {
+                  self->OnConnectionAttemptTimerLocked();
+                },
+                DEBUG_LOCATION);
+          });
+}
+
+void PickFirst::PickFirstSubchannelList::CancelConnectionAttemptTimerLocked() {
+  if (connection_attempt_timer_handle_.has_value()) {
+    PickFirst* p = static_cast<PickFirst*>(policy());
+    p->channel_control_helper()->GetEventEngine()->Cancel(
+        *connection_attempt_timer_handle_);
+    connection_attempt_timer_handle_.reset();
+  }
+}
+
+void PickFirst::PickFirstSubchannelList::OnConnectionAttemptTimerLocked() {
+  if (!connection_attempt_timer_handle_.has_value()) return;
+  connection_attempt_timer_handle_.reset();
+  if (shutting_down() || in_transient_failure_ ||
+      attempting_index_ + 1 >= num_subchannels()) {
+    return;
+  }
+  // Leave the current attempt running and start the next one alongside it.
+  // Whichever subchannel reports READY first is selected, and the others
+  // are shut down.
+  ++attempting_index_;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+    gpr_log(GPR_INFO,
+            "Pick First %p subchannel list %p: connection attempt delay "
+            "passed, also trying index %" PRIuPTR,
+            policy(), this, attempting_index_);
+  }
+  PickFirstSubchannelData* sd = subchannel(attempting_index_);
+  auto sd_state = sd->connectivity_state();
+  if (sd_state.has_value() && *sd_state == GRPC_CHANNEL_IDLE) {
+    sd->subchannel()->RequestConnection();
+  }
+  StartConnectionAttemptTimerLocked();
+}
+
 class PickFirstConfig : public LoadBalancingPolicy::Config {
  public:
   absl::string_view name() const override { return kPickFirst; }
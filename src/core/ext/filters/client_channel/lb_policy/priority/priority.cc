@@ -283,6 +283,10 @@ class PriorityLb : public LoadBalancingPolicy {
   std::map<std::string, OrphanablePtr<ChildPriority>> children_;
   // The priority that is being used.
   uint32_t current_priority_ = UINT32_MAX;
+  // What was last reported to the parent, to skip reporting it again.
+  absl::optional<grpc_connectivity_state> last_reported_state_;
+  absl::Status last_reported_status_;
+  RefCountedPtr<SubchannelPicker> last_reported_picker_;
 };
 
 //
@@ -312,6 +316,7 @@ void PriorityLb::ShutdownLocked() {
     gpr_log(GPR_INFO, "[priority_lb %p] shutting down", this);
   }
   shutting_down_ = true;
+  last_reported_picker_.reset();
   children_.clear();
 }
 
@@ -392,6 +397,8 @@ void PriorityLb::ChoosePriorityLocked() {
   if (config_->priorities().empty()) {
     absl::Status status =
         absl::UnavailableError("priority policy has empty priority list");
+    last_reported_state_.reset();
+    last_reported_picker_.reset();
     channel_control_helper()->UpdateState(
         GRPC_CHANNEL_TRANSIENT_FAILURE, status,
         MakeRefCounted<TransientFailurePicker>(status));
@@ -497,9 +504,26 @@ void PriorityLb::SetCurrentPriorityLocked(int32_t priority,
   }
   auto& child = children_[config_->priorities()[priority]];
   GPR_ASSERT(child != nullptr);
+  // Choosing a priority again after another child's state changed
+  // often selects the same child with the same picker.  Reporting it
+  // again would only make the channel re-pick its queued calls.
+  RefCountedPtr<SubchannelPicker> picker = child->GetPicker();
+  if (child->connectivity_state() == last_reported_state_ &&
+      child->connectivity_status() == last_reported_status_ &&
+      picker == last_reported_picker_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_priority_trace)) {
+      gpr_log(GPR_INFO,
+              "[priority_lb %p] state and picker unchanged; not reporting",
+              this);
+    }
+    return;
+  }
+  last_reported_state_ = child->connectivity_state();
+  last_reported_status_ = child->connectivity_status();
+  last_reported_picker_ = picker;
   channel_control_helper()->UpdateState(child->connectivity_state(),
                                         child->connectivity_status(),
-                                        child->GetPicker());
+                                        std::move(picker));
 }
 
 //
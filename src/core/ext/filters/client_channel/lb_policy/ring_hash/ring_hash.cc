@@ -160,10 +160,7 @@ class RingHash : public LoadBalancingPolicy {
             subchannel_list,
         const ServerAddress& address,
         RefCountedPtr<SubchannelInterface> subchannel)
-        : SubchannelData(subchannel_list, address, std::move(subchannel)),
-          address_(address) {}
-
-    const ServerAddress& address() const { return address_; }
+        : SubchannelData(subchannel_list, address, std::move(subchannel)) {}
 
     grpc_connectivity_state GetConnectivityState() const {
       return connectivity_state_.load(std::memory_order_relaxed);
@@ -181,8 +178,6 @@ class RingHash : public LoadBalancingPolicy {
         absl::optional<grpc_connectivity_state> old_state,
         grpc_connectivity_state new_state) override;
 
-    ServerAddress address_;
-
     // Last logical connectivity state seen.
     // Note that this may differ from the state actually reported by the
     // subchannel in some cases; for example, once this is set to
@@ -205,7 +200,8 @@ class RingHash : public LoadBalancingPolicy {
     };
 
     RingHashSubchannelList(RingHash* policy, ServerAddressList addresses,
-                           const ChannelArgs& args);
+                           const ChannelArgs& args,
+                           RingHashSubchannelList* previous);
 
     ~RingHashSubchannelList() override {
       RingHash* p = static_cast<RingHash*>(policy());
@@ -458,13 +454,14 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
 //
 
 RingHash::RingHashSubchannelList::RingHashSubchannelList(
-    RingHash* policy, ServerAddressList addresses, const ChannelArgs& args)
+    RingHash* policy, ServerAddressList addresses, const ChannelArgs& args,
+    RingHashSubchannelList* previous)
     : SubchannelList(policy,
                      (GRPC_TRACE_FLAG_ENABLED(grpc_lb_ring_hash_trace)
                           ? "RingHashSubchannelList"
                           : nullptr),
                      std::move(addresses), policy->channel_control_helper(),
-                     args),
+                     args, previous),
       num_idle_(num_subchannels()) {
   // Need to maintain a ref to the LB policy as long as we maintain
   // any references to subchannels, since the subchannels'
@@ -822,8 +819,12 @@ absl::Status RingHash::UpdateLocked(UpdateArgs args) {
     gpr_log(GPR_INFO, "[RH %p] replacing latest pending subchannel list %p",
             this, latest_pending_subchannel_list_.get());
   }
+  // Reuse subchannels from the newest list we have.
   latest_pending_subchannel_list_ = MakeRefCounted<RingHashSubchannelList>(
-      this, std::move(addresses), args.args);
+      this, std::move(addresses), args.args,
+      latest_pending_subchannel_list_ != nullptr
+          ? latest_pending_subchannel_list_.get()
+          : subchannel_list_.get());
   latest_pending_subchannel_list_->StartWatchingLocked();
   // If we have no existing list or the new list is empty, immediately
   // promote the new list.
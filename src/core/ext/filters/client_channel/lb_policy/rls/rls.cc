@@ -27,6 +27,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <initializer_list>
 #include <list>
@@ -49,6 +50,7 @@
 #include "absl/strings/str_join.h"
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
+#include "absl/synchronization/mutex.h"
 #include "absl/types/optional.h"
 #include "upb/upb.h"
 #include "upb/upb.hpp"
@@ -278,7 +280,7 @@ class RlsLb : public LoadBalancingPolicy {
 
     const std::string& target() const { return target_; }
 
-    PickResult Pick(PickArgs args) ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+    PickResult Pick(PickArgs args) ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_) {
       return picker_->Pick(args);
     }
 
@@ -316,7 +318,7 @@ class RlsLb : public LoadBalancingPolicy {
     // TRANSIENT_FAILURE state instead of the actual state of the child policy
     // until the child policy reports another READY state.
     grpc_connectivity_state connectivity_state() const
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+        ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_) {
       return connectivity_state_;
     }
 
@@ -360,21 +362,6 @@ class RlsLb : public LoadBalancingPolicy {
         ABSL_GUARDED_BY(&RlsLb::mu_);
   };
 
-  // A picker that uses the cache and the request map in the LB policy
-  // (synchronized via a mutex) to determine how to route requests.
-  class Picker : public LoadBalancingPolicy::SubchannelPicker {
-   public:
-    explicit Picker(RefCountedPtr<RlsLb> lb_policy);
-    ~Picker() override;
-
-    PickResult Pick(PickArgs args) override;
-
-   private:
-    RefCountedPtr<RlsLb> lb_policy_;
-    RefCountedPtr<RlsLbConfig> config_;
-    RefCountedPtr<ChildPolicyWrapper> default_child_policy_;
-  };
-
   // An LRU cache with adjustable size.
   class Cache {
    public:
@@ -391,11 +378,11 @@ class RlsLb : public LoadBalancingPolicy {
       void Orphan() override ABSL_NO_THREAD_SAFETY_ANALYSIS;
 
       const absl::Status& status() const
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+          ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_) {
         return status_;
       }
       Timestamp backoff_time() const
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+          ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_) {
         return backoff_time_;
       }
       Timestamp backoff_expiration_time() const
@@ -403,14 +390,14 @@ class RlsLb : public LoadBalancingPolicy {
         return backoff_expiration_time_;
       }
       Timestamp data_expiration_time() const
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+          ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_) {
         return data_expiration_time_;
       }
       const std::string& header_data() const
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+          ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_) {
         return header_data_;
       }
-      Timestamp stale_time() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+      Timestamp stale_time() const ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_) {
         return stale_time_;
       }
       Timestamp min_expiration_time() const
@@ -427,7 +414,7 @@ class RlsLb : public LoadBalancingPolicy {
       size_t Size() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
       // Pick subchannel for request based on the entry's state.
-      PickResult Pick(PickArgs args) ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+      PickResult Pick(PickArgs args) ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_);
 
       // If the cache entry is in backoff state, resets the backoff and, if
       // applicable, its backoff timer. The method does not update the LB
@@ -451,6 +438,21 @@ class RlsLb : public LoadBalancingPolicy {
       // Moves entry to the end of the LRU list.
       void MarkUsed() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
+      // Notes that the entry was used by a pick, which may hold the lock
+      // only for reading.  The entry is moved to the end of the LRU list
+      // when it next comes up for eviction, instead of on every pick.
+      void MarkReferenced() ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_) {
+        if (!referenced_.load(std::memory_order_relaxed)) {
+          referenced_.store(true, std::memory_order_relaxed);
+        }
+      }
+
+      // Clears the mark set by MarkReferenced(), returning whether it
+      // was set.
+      bool TakeReferenced() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+        return referenced_.exchange(false, std::memory_order_relaxed);
+      }
+
      private:
       class BackoffTimer : public InternallyRefCounted<BackoffTimer> {
        public:
@@ -492,15 +494,16 @@ class RlsLb : public LoadBalancingPolicy {
 
       Timestamp min_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_);
       Cache::Iterator lru_iterator_ ABSL_GUARDED_BY(&RlsLb::mu_);
+      std::atomic<bool> referenced_{false};
     };
 
     explicit Cache(RlsLb* lb_policy);
 
     // Finds an entry from the cache that corresponds to a key. If an entry is
     // not found, nullptr is returned. Otherwise, the entry is considered
-    // recently used and its order in the LRU list of the cache is updated.
-    Entry* Find(const RequestKey& key)
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
+    // recently used, which only needs the lock to be held for reading: it
+    // gets a second chance when next at the front of the LRU list.
+    Entry* Find(const RequestKey& key) ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_);
 
     // Finds an entry from the cache that corresponds to a key. If an entry is
     // not found, an entry is created, inserted in the cache, and returned to
@@ -546,6 +549,30 @@ class RlsLb : public LoadBalancingPolicy {
     absl::optional<EventEngine::TaskHandle> cleanup_timer_handle_;
   };
 
+  // A picker that uses the cache and the request map in the LB policy
+  // (synchronized via a mutex) to determine how to route requests.
+  class Picker : public LoadBalancingPolicy::SubchannelPicker {
+   public:
+    explicit Picker(RefCountedPtr<RlsLb> lb_policy);
+    ~Picker() override;
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // Whether a pick for \a key needs a new RLS request to be started.
+    bool NeedsRlsCall(const RequestKey& key, Cache::Entry* entry,
+                      Timestamp now) const
+        ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_);
+
+    // Picks using \a entry, once any RLS request needed has been started.
+    PickResult PickFromEntry(PickArgs args, Cache::Entry* entry, Timestamp now)
+        ABSL_SHARED_LOCKS_REQUIRED(&RlsLb::mu_);
+
+    RefCountedPtr<RlsLb> lb_policy_;
+    RefCountedPtr<RlsLbConfig> config_;
+    RefCountedPtr<ChildPolicyWrapper> default_child_policy_;
+  };
+
   // Channel for communicating with the RLS server.
   // Contains throttling logic for RLS requests.
   class RlsChannel : public InternallyRefCounted<RlsChannel> {
@@ -699,7 +726,9 @@ class RlsLb : public LoadBalancingPolicy {
   std::string server_name_;
 
   // Mutex to guard LB policy state that is accessed by the picker.
-  Mutex mu_;
+  // Picks that need no change to the cache or the request map hold this
+  // only for reading, so that they do not convoy behind one another.
+  absl::Mutex mu_;
   bool is_shutdown_ ABSL_GUARDED_BY(mu_) = false;
   bool update_in_progress_ = false;
   Cache cache_ ABSL_GUARDED_BY(mu_);
@@ -889,7 +918,7 @@ void RlsLb::ChildPolicyWrapper::ChildPolicyHelper::UpdateState(
             status.ToString().c_str(), picker.get());
   }
   {
-    MutexLock lock(&wrapper_->lb_policy_->mu_);
+    absl::MutexLock lock(&wrapper_->lb_policy_->mu_);
     if (wrapper_->is_shutdown_) return;
     if (wrapper_->connectivity_state_ == GRPC_CHANNEL_TRANSIENT_FAILURE &&
         state != GRPC_CHANNEL_READY) {
@@ -1031,19 +1060,28 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
             lb_policy_.get(), this, key.ToString().c_str());
   }
   Timestamp now = Timestamp::Now();
-  MutexLock lock(&lb_policy_->mu_);
+  // Most picks find fresh data in the cache, or an RLS request already
+  // pending for their key, and need only a read lock.
+  {
+    absl::ReaderMutexLock lock(&lb_policy_->mu_);
+    if (lb_policy_->is_shutdown_) {
+      return PickResult::Fail(
+          absl::UnavailableError("LB policy already shut down"));
+    }
+    Cache::Entry* entry = lb_policy_->cache_.Find(key);
+    if (!NeedsRlsCall(key, entry, now)) {
+      return PickFromEntry(args, entry, now);
+    }
+  }
+  absl::MutexLock lock(&lb_policy_->mu_);
   if (lb_policy_->is_shutdown_) {
     return PickResult::Fail(
         absl::UnavailableError("LB policy already shut down"));
   }
-  // Check if there's a cache entry.
+  // Check again, since another pick may have started the RLS request
+  // while the lock was released.
   Cache::Entry* entry = lb_policy_->cache_.Find(key);
-  // If there is no cache entry, or if the cache entry is not in backoff
-  // and has a stale time in the past, and there is not already a
-  // pending RLS request for this key, then try to start a new RLS request.
-  if ((entry == nullptr ||
-       (entry->stale_time() < now && entry->backoff_time() < now)) &&
-      lb_policy_->request_map_.find(key) == lb_policy_->request_map_.end()) {
+  if (NeedsRlsCall(key, entry, now)) {
     // Check if requests are being throttled.
     if (lb_policy_->rls_channel_->ShouldThrottle()) {
       // Request is throttled.
@@ -1073,6 +1111,21 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
         key, (entry == nullptr || entry->data_expiration_time() < now) ? nullptr
                                                                        : entry);
   }
+  return PickFromEntry(args, entry, now);
+}
+
+bool RlsLb::Picker::NeedsRlsCall(const RequestKey& key, Cache::Entry* entry,
+                                 Timestamp now) const {
+  // If there is no cache entry, or if the cache entry is not in backoff
+  // and has a stale time in the past, and there is not already a
+  // pending RLS request for this key, then try to start a new RLS request.
+  return (entry == nullptr ||
+          (entry->stale_time() < now && entry->backoff_time() < now)) &&
+         lb_policy_->request_map_.find(key) == lb_policy_->request_map_.end();
+}
+
+LoadBalancingPolicy::PickResult RlsLb::Picker::PickFromEntry(
+    PickArgs args, Cache::Entry* entry, Timestamp now) {
   // If the cache entry exists, see if it has usable data.
   if (entry != nullptr) {
     // If the entry has non-expired data, use it.
@@ -1149,7 +1202,7 @@ void RlsLb::Cache::Entry::BackoffTimer::Orphan() {
 
 void RlsLb::Cache::Entry::BackoffTimer::OnBackoffTimerLocked() {
   {
-    MutexLock lock(&entry_->lb_policy_->mu_);
+    absl::MutexLock lock(&entry_->lb_policy_->mu_);
     if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_rls_trace)) {
       gpr_log(GPR_INFO, "[rlslb %p] cache entry=%p %s, backoff timer fired",
               entry_->lb_policy_.get(), entry_.get(),
@@ -1374,7 +1427,7 @@ RlsLb::Cache::Cache(RlsLb* lb_policy) : lb_policy_(lb_policy) {
 RlsLb::Cache::Entry* RlsLb::Cache::Find(const RequestKey& key) {
   auto it = map_.find(key);
   if (it == map_.end()) return nullptr;
-  it->second->MarkUsed();
+  it->second->MarkReferenced();
   return it->second.get();
 }
 
@@ -1453,7 +1506,7 @@ void RlsLb::Cache::OnCleanupTimer() {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_rls_trace)) {
     gpr_log(GPR_INFO, "[rlslb %p] cache cleanup timer fired", lb_policy_);
   }
-  MutexLock lock(&lb_policy_->mu_);
+  absl::MutexLock lock(&lb_policy_->mu_);
   if (!cleanup_timer_handle_.has_value()) return;
   if (lb_policy_->is_shutdown_) return;
   for (auto it = map_.begin(); it != map_.end();) {
@@ -1479,6 +1532,12 @@ void RlsLb::Cache::MaybeShrinkSize(size_t bytes) {
     auto map_it = map_.find(*lru_it);
     GPR_ASSERT(map_it != map_.end());
     if (!map_it->second->CanEvict()) break;
+    // Entries used by picks since they last came up get another round.
+    // The mark is cleared, so each entry is skipped at most once per pass.
+    if (map_it->second->TakeReferenced()) {
+      map_it->second->MarkUsed();
+      continue;
+    }
     if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_rls_trace)) {
       gpr_log(GPR_INFO, "[rlslb %p] LRU eviction: removing entry %p %s",
               lb_policy_, map_it->second.get(), lru_it->ToString().c_str());
@@ -1509,7 +1568,7 @@ void RlsLb::RlsChannel::StateWatcher::OnConnectivityStateChange(
             ConnectivityStateName(new_state), status.ToString().c_str());
   }
   if (rls_channel_->is_shutdown_) return;
-  MutexLock lock(&lb_policy->mu_);
+  absl::MutexLock lock(&lb_policy->mu_);
   if (new_state == GRPC_CHANNEL_READY && was_transient_failure_) {
     was_transient_failure_ = false;
     // Reset the backoff of all cache entries, so that we don't
@@ -1732,7 +1791,7 @@ void RlsLb::RlsRequest::StartCall(void* arg, grpc_error_handle /*error*/) {
 
 void RlsLb::RlsRequest::StartCallLocked() {
   {
-    MutexLock lock(&lb_policy_->mu_);
+    absl::MutexLock lock(&lb_policy_->mu_);
     if (lb_policy_->is_shutdown_) return;
   }
   Timestamp now = Timestamp::Now();
@@ -1824,7 +1883,7 @@ void RlsLb::RlsRequest::OnRlsCallCompleteLocked(grpc_error_handle error) {
   }
   std::vector<ChildPolicyWrapper*> child_policies_to_finish_update;
   {
-    MutexLock lock(&lb_policy_->mu_);
+    absl::MutexLock lock(&lb_policy_->mu_);
     if (lb_policy_->is_shutdown_) return;
     rls_channel_->ReportResponseLocked(response.status.ok());
     Cache::Entry* cache_entry = lb_policy_->cache_.FindOrInsert(key_);
@@ -1987,7 +2046,7 @@ absl::Status RlsLb::UpdateLocked(UpdateArgs args) {
   }
   // Now grab the lock to swap out the state it guards.
   {
-    MutexLock lock(&mu_);
+    absl::MutexLock lock(&mu_);
     // Swap out RLS channel if needed.
     if (old_config == nullptr ||
         config_->lookup_service() != old_config->lookup_service()) {
@@ -2056,7 +2115,7 @@ absl::Status RlsLb::UpdateLocked(UpdateArgs args) {
 }
 
 void RlsLb::ExitIdleLocked() {
-  MutexLock lock(&mu_);
+  absl::MutexLock lock(&mu_);
   for (auto& child_entry : child_policy_map_) {
     child_entry.second->ExitIdleLocked();
   }
@@ -2064,7 +2123,7 @@ void RlsLb::ExitIdleLocked() {
 
 void RlsLb::ResetBackoffLocked() {
   {
-    MutexLock lock(&mu_);
+    absl::MutexLock lock(&mu_);
     rls_channel_->ResetBackoff();
     cache_.ResetAllBackoff();
   }
@@ -2077,7 +2136,7 @@ void RlsLb::ShutdownLocked() {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_rls_trace)) {
     gpr_log(GPR_INFO, "[rlslb %p] policy shutdown", this);
   }
-  MutexLock lock(&mu_);
+  absl::MutexLock lock(&mu_);
   is_shutdown_ = true;
   config_.reset(DEBUG_LOCATION, "ShutdownLocked");
   channel_args_ = ChannelArgs();
@@ -2126,7 +2185,7 @@ void RlsLb::UpdatePickerLocked() {
     int num_idle = 0;
     int num_connecting = 0;
     {
-      MutexLock lock(&mu_);
+      absl::MutexLock lock(&mu_);
       if (is_shutdown_) return;
       for (auto& p : child_policy_map_) {
         grpc_connectivity_state child_state = p.second->connectivity_state();
@@ -2520,8 +2579,10 @@ class RlsLbFactory : public LoadBalancingPolicyFactory {
 }  //  namespace
 
 void RegisterRlsLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<RlsLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      kRls, []() -> std::unique_ptr<LoadBalancingPolicyFactory> {
+        return std::make_unique<RlsLbFactory>();
+      });
 }
 
 }  // namespace grpc_core
@@ -119,13 +119,14 @@ class RoundRobin : public LoadBalancingPolicy {
                               RoundRobinSubchannelData> {
    public:
     RoundRobinSubchannelList(RoundRobin* policy, ServerAddressList addresses,
-                             const ChannelArgs& args)
+                             const ChannelArgs& args,
+                             RoundRobinSubchannelList* previous)
         : SubchannelList(policy,
                          (GRPC_TRACE_FLAG_ENABLED(grpc_lb_round_robin_trace)
                               ? "RoundRobinSubchannelList"
                               : nullptr),
                          std::move(addresses), policy->channel_control_helper(),
-                         args) {
+                         args, previous) {
       // Need to maintain a ref to the LB policy as long as we maintain
       // any references to subchannels, since the subchannels'
       // pollset_sets will include the LB policy's pollset_set.
@@ -287,8 +288,12 @@ absl::Status RoundRobin::UpdateLocked(UpdateArgs args) {
     gpr_log(GPR_INFO, "[RR %p] replacing previous pending subchannel list %p",
             this, latest_pending_subchannel_list_.get());
   }
+  // Reuse subchannels from the newest list we have.
   latest_pending_subchannel_list_ = MakeRefCounted<RoundRobinSubchannelList>(
-      this, std::move(addresses), args.args);
+      this, std::move(addresses), args.args,
+      latest_pending_subchannel_list_ != nullptr
+          ? latest_pending_subchannel_list_.get()
+          : subchannel_list_.get());
   latest_pending_subchannel_list_->StartWatchingLocked();
   // If the new list is empty, immediately promote it to
   // subchannel_list_ and report TRANSIENT_FAILURE.
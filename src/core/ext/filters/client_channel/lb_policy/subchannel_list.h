@@ -24,6 +24,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -94,6 +95,9 @@ class SubchannelData {
   // Returns a pointer to the subchannel.
   SubchannelInterface* subchannel() const { return subchannel_.get(); }
 
+  // Returns the address of the subchannel.
+  const ServerAddress& address() const { return address_; }
+
   // Returns the cached connectivity state, if any.
   absl::optional<grpc_connectivity_state> connectivity_state() {
     return connectivity_state_;
@@ -164,6 +168,7 @@ class SubchannelData {
 
   // Backpointer to owning subchannel list.  Not owned.
   SubchannelList<SubchannelListType, SubchannelDataType>* subchannel_list_;
+  const ServerAddress address_;
   // The subchannel.
   RefCountedPtr<SubchannelInterface> subchannel_;
   // Will be non-null when the subchannel's state is being watched.
@@ -207,10 +212,15 @@ class SubchannelList : public DualRefCounted<SubchannelListType> {
   void Orphan() override;
 
  protected:
+  // If \a previous is non-null, addresses that it has a subchannel for,
+  // with the same attributes and channel args, reuse that subchannel
+  // instead of asking \a helper for a new one.  Only suitable for
+  // policies that do not attach per-list data watchers to subchannels.
   SubchannelList(LoadBalancingPolicy* policy, const char* tracer,
                  ServerAddressList addresses,
                  LoadBalancingPolicy::ChannelControlHelper* helper,
-                 const ChannelArgs& args);
+                 const ChannelArgs& args,
+                 SubchannelListType* previous = nullptr);
 
   virtual ~SubchannelList();
 
@@ -223,6 +233,9 @@ class SubchannelList : public DualRefCounted<SubchannelListType> {
 
   const char* tracer_;
 
+  // The channel args that subchannels were created with.
+  ChannelArgs args_;
+
   // The list of subchannels.
   // We use ManualConstructor here to support SubchannelDataType classes
   // that are not copyable.
@@ -280,9 +293,10 @@ void SubchannelData<SubchannelListType, SubchannelDataType>::Watcher::
 template <typename SubchannelListType, typename SubchannelDataType>
 SubchannelData<SubchannelListType, SubchannelDataType>::SubchannelData(
     SubchannelList<SubchannelListType, SubchannelDataType>* subchannel_list,
-    const ServerAddress& /*address*/,
-    RefCountedPtr<SubchannelInterface> subchannel)
-    : subchannel_list_(subchannel_list), subchannel_(std::move(subchannel)) {}
+    const ServerAddress& address, RefCountedPtr<SubchannelInterface> subchannel)
+    : subchannel_list_(subchannel_list),
+      address_(address),
+      subchannel_(std::move(subchannel)) {}
 
 template <typename SubchannelListType, typename SubchannelDataType>
 SubchannelData<SubchannelListType, SubchannelDataType>::~SubchannelData() {
@@ -364,20 +378,46 @@ template <typename SubchannelListType, typename SubchannelDataType>
 SubchannelList<SubchannelListType, SubchannelDataType>::SubchannelList(
     LoadBalancingPolicy* policy, const char* tracer,
     ServerAddressList addresses,
-    LoadBalancingPolicy::ChannelControlHelper* helper, const ChannelArgs& args)
+    LoadBalancingPolicy::ChannelControlHelper* helper, const ChannelArgs& args,
+    SubchannelListType* previous)
     : DualRefCounted<SubchannelListType>(tracer),
       policy_(policy),
-      tracer_(tracer) {
+      tracer_(tracer),
+      args_(args) {
   if (GPR_UNLIKELY(tracer_ != nullptr)) {
     gpr_log(GPR_INFO,
             "[%s %p] Creating subchannel list %p for %" PRIuPTR " subchannels",
             tracer_, policy, this, addresses.size());
   }
+  // Index the previous list's subchannels by address, so that an update
+  // that adds or removes a few endpoints does not go through the channel
+  // for every one of them.
+  std::unordered_map<std::string, SubchannelDataType*> reusable;
+  if (previous != nullptr && !previous->shutting_down() &&
+      previous->args_ == args) {
+    reusable.reserve(previous->num_subchannels());
+    for (size_t i = 0; i < previous->num_subchannels(); ++i) {
+      SubchannelDataType* sd = previous->subchannel(i);
+      if (sd->subchannel() == nullptr) continue;
+      const grpc_resolved_address& addr = sd->address().address();
+      reusable.emplace(std::string(addr.addr, addr.len), sd);
+    }
+  }
   subchannels_.reserve(addresses.size());
   // Create a subchannel for each address.
   for (ServerAddress address : addresses) {
-    RefCountedPtr<SubchannelInterface> subchannel =
-        helper->CreateSubchannel(address, args);
+    RefCountedPtr<SubchannelInterface> subchannel;
+    if (!reusable.empty()) {
+      const grpc_resolved_address& addr = address.address();
+      auto it = reusable.find(std::string(addr.addr, addr.len));
+      if (it != reusable.end() && it->second->address() == address) {
+        subchannel = it->second->subchannel()->Ref();
+        reusable.erase(it);
+      }
+    }
+    if (subchannel == nullptr) {
+      subchannel = helper->CreateSubchannel(address, args);
+    }
     if (subchannel == nullptr) {
       // Subchannel could not be created.
       if (GPR_UNLIKELY(tracer_ != nullptr)) {
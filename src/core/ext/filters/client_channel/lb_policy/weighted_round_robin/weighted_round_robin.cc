@@ -333,6 +333,9 @@ class WeightedRoundRobin : public LoadBalancingPolicy {
     Mutex timer_mu_ ABSL_ACQUIRED_BEFORE(&scheduler_mu_);
     absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
         timer_handle_ ABSL_GUARDED_BY(&timer_mu_);
+    // The weights scheduler_ was last built from.  When a timer tick sees
+    // the same weights again, the existing scheduler is kept.
+    std::vector<float> last_weights_ ABSL_GUARDED_BY(&timer_mu_);
 
     // Used when falling back to RR.
     std::atomic<size_t> last_picked_index_;
@@ -550,20 +553,31 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
     weights.push_back(subchannel.weight->GetWeight(
         now, weight_expiration_period_, blackout_period_));
   }
-  if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
-    gpr_log(GPR_INFO, "[WRR %p picker %p] new weights: %s", wrr_.get(), this,
-            absl::StrJoin(weights, " ").c_str());
-  }
-  auto scheduler_or = StaticStrideScheduler::Make(
-      weights, [this]() { return wrr_->scheduler_state_.fetch_add(1); });
-  std::shared_ptr<StaticStrideScheduler> scheduler;
-  if (scheduler_or.has_value()) {
-    scheduler =
-        std::make_shared<StaticStrideScheduler>(std::move(*scheduler_or));
-  }
-  {
-    MutexLock lock(&scheduler_mu_);
-    scheduler_ = std::move(scheduler);
+  // Weights only move when backends report load, so on quiet channels
+  // most ticks see exactly the previous weights.  Skip the rebuild (and
+  // the allocation and lock that come with it) in that case.
+  if (weights == last_weights_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+      gpr_log(GPR_INFO, "[WRR %p picker %p] weights unchanged", wrr_.get(),
+              this);
+    }
+  } else {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_wrr_trace)) {
+      gpr_log(GPR_INFO, "[WRR %p picker %p] new weights: %s", wrr_.get(),
+              this, absl::StrJoin(weights, " ").c_str());
+    }
+    auto scheduler_or = StaticStrideScheduler::Make(
+        weights, [this]() { return wrr_->scheduler_state_.fetch_add(1); });
+    std::shared_ptr<StaticStrideScheduler> scheduler;
+    if (scheduler_or.has_value()) {
+      scheduler =
+          std::make_shared<StaticStrideScheduler>(std::move(*scheduler_or));
+    }
+    {
+      MutexLock lock(&scheduler_mu_);
+      scheduler_ = std::move(scheduler);
+    }
+    last_weights_ = std::move(weights);
   }
   // Start timer.
   WeakRefCountedPtr<Picker> self = WeakRef();
@@ -125,19 +125,27 @@ class WeightedTargetLb : public LoadBalancingPolicy {
   class WeightedPicker : public SubchannelPicker {
    public:
     // Maintains a weighted list of pickers from each child that is in
-    // ready state. The first element in the pair represents the end of a
-    // range proportional to the child's weight. The start of the range
-    // is the previous value in the vector and is 0 for the first element.
+    // ready state. The first element in the pair is the child's weight.
     using PickerList =
-        std::vector<std::pair<uint64_t, RefCountedPtr<SubchannelPicker>>>;
+        std::vector<std::pair<uint32_t, RefCountedPtr<SubchannelPicker>>>;
 
-    explicit WeightedPicker(PickerList pickers)
-        : pickers_(std::move(pickers)) {}
+    explicit WeightedPicker(PickerList pickers);
 
     PickResult Pick(PickArgs args) override;
 
    private:
+    // A slot in the alias table.  A pick chooses a slot uniformly at random
+    // and then uses the slot's own picker with probability
+    // threshold / total_weight_, or else the alias's picker, so that each
+    // picker is chosen in proportion to its weight in O(1).
+    struct Slot {
+      uint64_t threshold;
+      size_t alias;
+    };
+
     PickerList pickers_;
+    std::vector<Slot> slots_;
+    uint64_t total_weight_ = 0;
     absl::BitGen bit_gen_;
   };
 
@@ -228,6 +236,7 @@ class WeightedTargetLb : public LoadBalancingPolicy {
   void ShutdownLocked() override;
 
   void UpdateStateLocked();
+  void CancelPickerUpdateTimerLocked();
 
   // Current config from the resolver.
   RefCountedPtr<WeightedTargetLbConfig> config_;
@@ -236,6 +245,15 @@ class WeightedTargetLb : public LoadBalancingPolicy {
   bool shutting_down_ = false;
   bool update_in_progress_ = false;
 
+  // What was last reported to the parent, to skip reporting it again.
+  absl::optional<grpc_connectivity_state> last_reported_state_;
+  WeightedPicker::PickerList last_reported_pickers_;
+  // Picker updates while READY are held back until this long after
+  // the last one.  Zero means no coalescing.
+  Duration picker_update_coalescing_window_;
+  Timestamp last_picker_update_time_ = Timestamp::InfPast();
+  absl::optional<EventEngine::TaskHandle> picker_update_timer_handle_;
+
   // Children.
   std::map<std::string, OrphanablePtr<WeightedChild>> targets_;
 };
@@ -244,29 +262,44 @@ class WeightedTargetLb : public LoadBalancingPolicy {
 // WeightedTargetLb::WeightedPicker
 //
 
-WeightedTargetLb::PickResult WeightedTargetLb::WeightedPicker::Pick(
-    PickArgs args) {
-  // Generate a random number in [0, total weight).
-  const uint64_t key =
-      absl::Uniform<uint64_t>(bit_gen_, 0, pickers_.back().first);
-  // Find the index in pickers_ corresponding to key.
-  size_t mid = 0;
-  size_t start_index = 0;
-  size_t end_index = pickers_.size() - 1;
-  size_t index = 0;
-  while (end_index > start_index) {
-    mid = (start_index + end_index) / 2;
-    if (pickers_[mid].first > key) {
-      end_index = mid;
-    } else if (pickers_[mid].first < key) {
-      start_index = mid + 1;
-    } else {
-      index = mid + 1;
-      break;
+WeightedTargetLb::WeightedPicker::WeightedPicker(PickerList pickers)
+    : pickers_(std::move(pickers)) {
+  GPR_ASSERT(!pickers_.empty());
+  const size_t n = pickers_.size();
+  for (const auto& p : pickers_) total_weight_ += p.first;
+  // Build the alias table (Vose's method), in integers so that it is
+  // exact: each slot holds total_weight_ units, and each picker has
+  // weight * n units to spread over its own slot and those it aliases.
+  std::vector<uint64_t> units(n);
+  std::vector<size_t> small;
+  std::vector<size_t> large;
+  slots_.resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    units[i] = static_cast<uint64_t>(pickers_[i].first) * n;
+    slots_[i] = {total_weight_, i};
+    (units[i] < total_weight_ ? small : large).push_back(i);
+  }
+  while (!small.empty() && !large.empty()) {
+    const size_t s = small.back();
+    small.pop_back();
+    const size_t l = large.back();
+    slots_[s] = {units[s], l};
+    units[l] -= total_weight_ - units[s];
+    if (units[l] < total_weight_) {
+      large.pop_back();
+      small.push_back(l);
     }
   }
-  if (index == 0) index = start_index;
-  GPR_ASSERT(pickers_[index].first > key);
+}
+
+WeightedTargetLb::PickResult WeightedTargetLb::WeightedPicker::Pick(
+    PickArgs args) {
+  const size_t slot = absl::Uniform<size_t>(bit_gen_, 0, slots_.size());
+  const size_t index =
+      absl::Uniform<uint64_t>(bit_gen_, 0, total_weight_) <
+              slots_[slot].threshold
+          ? slot
+          : slots_[slot].alias;
   // Delegate to the child picker.
   return pickers_[index].second->Pick(args);
 }
@@ -295,6 +328,8 @@ void WeightedTargetLb::ShutdownLocked() {
     gpr_log(GPR_INFO, "[weighted_target_lb %p] shutting down", this);
   }
   shutting_down_ = true;
+  CancelPickerUpdateTimerLocked();
+  last_reported_pickers_.clear();
   targets_.clear();
 }
 
@@ -308,6 +343,12 @@ absl::Status WeightedTargetLb::UpdateLocked(UpdateArgs args) {
     gpr_log(GPR_INFO, "[weighted_target_lb %p] Received update", this);
   }
   update_in_progress_ = true;
+  picker_update_coalescing_window_ =
+      std::max(Duration::Zero(),
+               args.args
+                   .GetDurationFromIntMillis(
+                       GRPC_ARG_LB_PICKER_UPDATE_COALESCING_WINDOW_MS)
+                   .value_or(Duration::Zero()));
   // Update config.
   config_ = std::move(args.config);
   // Deactivate the targets not in the new config.
@@ -348,6 +389,8 @@ absl::Status WeightedTargetLb::UpdateLocked(UpdateArgs args) {
   if (config_->target_map().empty()) {
     absl::Status status = absl::UnavailableError(absl::StrCat(
         "no children in weighted_target policy: ", args.resolution_note));
+    last_reported_state_.reset();
+    last_reported_pickers_.clear();
     channel_control_helper()->UpdateState(
         GRPC_CHANNEL_TRANSIENT_FAILURE, status,
         MakeRefCounted<TransientFailurePicker>(status));
@@ -381,9 +424,7 @@ void WeightedTargetLb::UpdateStateLocked() {
   // the range proportional to its weight, such that the total range is the
   // sum of the weights of all children.
   WeightedPicker::PickerList ready_picker_list;
-  uint64_t ready_end = 0;
   WeightedPicker::PickerList tf_picker_list;
-  uint64_t tf_end = 0;
   // Also count the number of children in CONNECTING and IDLE, to determine
   // the aggregated state.
   size_t num_connecting = 0;
@@ -406,8 +447,7 @@ void WeightedTargetLb::UpdateStateLocked() {
     switch (child->connectivity_state()) {
       case GRPC_CHANNEL_READY: {
         GPR_ASSERT(child->weight() > 0);
-        ready_end += child->weight();
-        ready_picker_list.emplace_back(ready_end, std::move(child_picker));
+        ready_picker_list.emplace_back(child->weight(), std::move(child_picker));
         break;
       }
       case GRPC_CHANNEL_CONNECTING: {
@@ -420,8 +460,7 @@ void WeightedTargetLb::UpdateStateLocked() {
       }
       case GRPC_CHANNEL_TRANSIENT_FAILURE: {
         GPR_ASSERT(child->weight() > 0);
-        tf_end += child->weight();
-        tf_picker_list.emplace_back(tf_end, std::move(child_picker));
+        tf_picker_list.emplace_back(child->weight(), std::move(child_picker));
         break;
       }
       default:
@@ -443,6 +482,64 @@ void WeightedTargetLb::UpdateStateLocked() {
     gpr_log(GPR_INFO, "[weighted_target_lb %p] connectivity changed to %s",
             this, ConnectivityStateName(connectivity_state));
   }
+  WeightedPicker::PickerList* picker_list = nullptr;
+  if (connectivity_state == GRPC_CHANNEL_READY) {
+    picker_list = &ready_picker_list;
+  } else if (connectivity_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    picker_list = &tf_picker_list;
+  }
+  // If the children's pickers and weights are the ones we last reported,
+  // a new picker would only make the channel re-pick its queued calls.
+  if (picker_list != nullptr && connectivity_state == last_reported_state_ &&
+      *picker_list == last_reported_pickers_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_weighted_target_trace)) {
+      gpr_log(GPR_INFO,
+              "[weighted_target_lb %p] child pickers unchanged; not "
+              "reporting a new picker",
+              this);
+    }
+    return;
+  }
+  // While READY, coalesce picker updates that come within the configured
+  // window of the last one, as when many localities flap at once.
+  if (connectivity_state == GRPC_CHANNEL_READY &&
+      last_reported_state_ == GRPC_CHANNEL_READY &&
+      picker_update_coalescing_window_ > Duration::Zero()) {
+    const Timestamp next_update_time =
+        last_picker_update_time_ + picker_update_coalescing_window_;
+    const Timestamp now = Timestamp::Now();
+    if (next_update_time > now) {
+      if (!picker_update_timer_handle_.has_value()) {
+        picker_update_timer_handle_ =
+            channel_control_helper()->GetEventEngine()->RunAfter(
+                next_update_time - now,
+                [self = Ref(DEBUG_LOCATION, "PickerUpdateTimer")]() mutable {
+                  ApplicationCallbackExecCtx app_exec_ctx;
+                  ExecCtx exec_ctx;
+                  auto* self_ptr = static_cast<WeightedTargetLb*>(self.get());
+                  self_ptr->work_serializer()->Run(
+                      [self = std::move(self)]() {
+                        auto* policy = static_cast<WeightedTargetLb*>(
+                            self.get());
+                        policy->picker_update_timer_handle_.reset();
+                        if (!policy->shutting_down_) {
+                          policy->UpdateStateLocked();
+                        }
+                      },
+                      DEBUG_LOCATION);
+                });
+      }
+      return;
+    }
+  }
+  CancelPickerUpdateTimerLocked();
+  last_reported_state_ = connectivity_state;
+  last_picker_update_time_ = Timestamp::Now();
+  if (picker_list != nullptr) {
+    last_reported_pickers_ = *picker_list;
+  } else {
+    last_reported_pickers_.clear();
+  }
   RefCountedPtr<SubchannelPicker> picker;
   absl::Status status;
   switch (connectivity_state) {
@@ -460,6 +557,14 @@ void WeightedTargetLb::UpdateStateLocked() {
                                         std::move(picker));
 }
 
+void WeightedTargetLb::CancelPickerUpdateTimerLocked() {
+  if (picker_update_timer_handle_.has_value()) {
+    channel_control_helper()->GetEventEngine()->Cancel(
+        *picker_update_timer_handle_);
+    picker_update_timer_handle_.reset();
+  }
+}
+
 //
 // WeightedTargetLb::WeightedChild::DelayedRemovalTimer
 //
@@ -787,8 +787,10 @@ class XdsClusterImplLbFactory : public LoadBalancingPolicyFactory {
 }  // namespace
 
 void RegisterXdsClusterImplLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsClusterImplLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      kXdsClusterImpl, []() -> std::unique_ptr<LoadBalancingPolicyFactory> {
+        return std::make_unique<XdsClusterImplLbFactory>();
+      });
 }
 
 }  // namespace grpc_core
@@ -692,8 +692,10 @@ class XdsClusterManagerLbFactory : public LoadBalancingPolicyFactory {
 }  // namespace
 
 void RegisterXdsClusterManagerLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsClusterManagerLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      kXdsClusterManager, []() -> std::unique_ptr<LoadBalancingPolicyFactory> {
+        return std::make_unique<XdsClusterManagerLbFactory>();
+      });
 }
 
 }  // namespace grpc_core
@@ -1222,8 +1222,10 @@ class XdsClusterResolverLbFactory : public LoadBalancingPolicyFactory {
 }  // namespace
 
 void RegisterXdsClusterResolverLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsClusterResolverLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      kXdsClusterResolver, []() -> std::unique_ptr<LoadBalancingPolicyFactory> {
+        return std::make_unique<XdsClusterResolverLbFactory>();
+      });
 }
 
 }  // namespace grpc_core
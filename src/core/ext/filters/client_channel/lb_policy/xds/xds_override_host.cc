@@ -578,7 +578,9 @@ void XdsOverrideHostLb::UnsetSubchannel(absl::string_view key,
 RefCountedPtr<XdsOverrideHostLb::SubchannelWrapper>
 XdsOverrideHostLb::GetSubchannelByAddress(
     absl::string_view address, XdsHealthStatusSet overriden_health_statuses) {
-  MutexLock lock(&subchannel_map_mu_);
+  // Pickers on every data plane thread look up here, while the map only
+  // changes on updates from the control plane, so they share the lock.
+  absl::ReaderMutexLock lock(&subchannel_map_mu_);
   auto it = subchannel_map_.find(address);
   if (it == subchannel_map_.end() || it->second.GetSubchannel() == nullptr) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_xds_override_host_trace)) {
@@ -757,8 +759,10 @@ class XdsOverrideHostLbFactory : public LoadBalancingPolicyFactory {
 }  // namespace
 
 void RegisterXdsOverrideHostLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsOverrideHostLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      XdsOverrideHostLbConfig::Name(), []() -> std::unique_ptr<LoadBalancingPolicyFactory> {
+        return std::make_unique<XdsOverrideHostLbFactory>();
+      });
 }
 
 // XdsOverrideHostLbConfig
@@ -362,8 +362,10 @@ class XdsWrrLocalityLbFactory : public LoadBalancingPolicyFactory {
 }  // namespace
 
 void RegisterXdsWrrLocalityLbPolicy(CoreConfiguration::Builder* builder) {
-  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
-      std::make_unique<XdsWrrLocalityLbFactory>());
+  builder->lb_policy_registry()->RegisterLazyLoadBalancingPolicyFactory(
+      kXdsWrrLocality, []() -> std::unique_ptr<LoadBalancingPolicyFactory> {
+        return std::make_unique<XdsWrrLocalityLbFactory>();
+      });
 }
 
 }  // namespace grpc_core
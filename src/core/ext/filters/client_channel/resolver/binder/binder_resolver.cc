@@ -139,8 +139,10 @@ class BinderResolverFactory : public ResolverFactory {
 }  // namespace
 
 void RegisterBinderResolver(CoreConfiguration::Builder* builder) {
-  builder->resolver_registry()->RegisterResolverFactory(
-      std::make_unique<BinderResolverFactory>());
+  builder->resolver_registry()->RegisterLazyResolverFactory(
+      "binder", []() -> std::unique_ptr<ResolverFactory> {
+        return std::make_unique<BinderResolverFactory>();
+      });
 }
 
 }  // namespace grpc_core
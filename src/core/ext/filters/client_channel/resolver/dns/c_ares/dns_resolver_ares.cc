@@ -34,6 +34,7 @@
 #include "absl/strings/strip.h"
 #include "absl/types/optional.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
@@ -71,6 +72,7 @@
 #include "src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_balancer_addresses.h"
 #include "src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_wrapper.h"
 #include "src/core/ext/filters/client_channel/resolver/dns/dns_resolver_selection.h"
+#include "src/core/ext/filters/client_channel/resolver/dns/dns_result_cache.h"
 #include "src/core/ext/filters/client_channel/resolver/polling_resolver.h"
 #include "src/core/lib/backoff/backoff.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -100,11 +102,17 @@ class AresClientChannelDNSResolver : public PollingResolver {
   OrphanablePtr<Orphanable> StartRequest() override;
 
  private:
+  // Queries addresses and, if enabled, SRV and TXT records for a name, and
+  // combines them into one DNS result.
   class AresRequestWrapper : public InternallyRefCounted<AresRequestWrapper> {
    public:
-    explicit AresRequestWrapper(
-        RefCountedPtr<AresClientChannelDNSResolver> resolver)
-        : resolver_(std::move(resolver)) {
+    AresRequestWrapper(const std::string& authority,
+                       const std::string& name_to_resolve,
+                       bool enable_srv_queries, bool request_service_config,
+                       int query_timeout_ms,
+                       grpc_pollset_set* interested_parties,
+                       std::function<void(DnsResultCache::Result)> on_done)
+        : on_done_(std::move(on_done)) {
       // TODO(hork): replace this callback bookkeeping with promises.
       // Locking to prevent completion before all records are queried
       MutexLock lock(&on_resolved_mu_);
@@ -112,42 +120,35 @@ class AresClientChannelDNSResolver : public PollingResolver {
       GRPC_CLOSURE_INIT(&on_hostname_resolved_, OnHostnameResolved, this,
                         nullptr);
       hostname_request_.reset(grpc_dns_lookup_hostname_ares(
-          resolver_->authority().c_str(), resolver_->name_to_resolve().c_str(),
-          kDefaultSecurePort, resolver_->interested_parties(),
-          &on_hostname_resolved_, &addresses_, resolver_->query_timeout_ms_));
+          authority.c_str(), name_to_resolve.c_str(), kDefaultSecurePort,
+          interested_parties, &on_hostname_resolved_, &addresses_,
+          query_timeout_ms));
       GRPC_CARES_TRACE_LOG(
-          "resolver:%p Started resolving hostnames. hostname_request_:%p",
-          resolver_.get(), hostname_request_.get());
-      if (resolver_->enable_srv_queries_) {
+          "request:%p Started resolving hostnames. hostname_request_:%p", this,
+          hostname_request_.get());
+      if (enable_srv_queries) {
         Ref(DEBUG_LOCATION, "OnSRVResolved").release();
         GRPC_CLOSURE_INIT(&on_srv_resolved_, OnSRVResolved, this, nullptr);
         srv_request_.reset(grpc_dns_lookup_srv_ares(
-            resolver_->authority().c_str(),
-            resolver_->name_to_resolve().c_str(),
-            resolver_->interested_parties(), &on_srv_resolved_,
-            &balancer_addresses_, resolver_->query_timeout_ms_));
+            authority.c_str(), name_to_resolve.c_str(), interested_parties,
+            &on_srv_resolved_, &balancer_addresses_, query_timeout_ms));
         GRPC_CARES_TRACE_LOG(
-            "resolver:%p Started resolving SRV records. srv_request_:%p",
-            resolver_.get(), srv_request_.get());
+            "request:%p Started resolving SRV records. srv_request_:%p", this,
+            srv_request_.get());
       }
-      if (resolver_->request_service_config_) {
+      if (request_service_config) {
         Ref(DEBUG_LOCATION, "OnTXTResolved").release();
         GRPC_CLOSURE_INIT(&on_txt_resolved_, OnTXTResolved, this, nullptr);
         txt_request_.reset(grpc_dns_lookup_txt_ares(
-            resolver_->authority().c_str(),
-            resolver_->name_to_resolve().c_str(),
-            resolver_->interested_parties(), &on_txt_resolved_,
-            &service_config_json_, resolver_->query_timeout_ms_));
+            authority.c_str(), name_to_resolve.c_str(), interested_parties,
+            &on_txt_resolved_, &service_config_json_, query_timeout_ms));
         GRPC_CARES_TRACE_LOG(
-            "resolver:%p Started resolving TXT records. txt_request_:%p",
-            resolver_.get(), txt_request_.get());
+            "request:%p Started resolving TXT records. txt_request_:%p", this,
+            txt_request_.get());
       }
     }
 
-    ~AresRequestWrapper() override {
-      gpr_free(service_config_json_);
-      resolver_.reset(DEBUG_LOCATION, "dns-resolving");
-    }
+    ~AresRequestWrapper() override { gpr_free(service_config_json_); }
 
     // Note that thread safety cannot be analyzed due to this being invoked from
     // OrphanablePtr<>, and there's no way to pass the lock annotation through
@@ -172,11 +173,11 @@ class AresClientChannelDNSResolver : public PollingResolver {
     static void OnHostnameResolved(void* arg, grpc_error_handle error);
     static void OnSRVResolved(void* arg, grpc_error_handle error);
     static void OnTXTResolved(void* arg, grpc_error_handle error);
-    absl::optional<Result> OnResolvedLocked(grpc_error_handle error)
-        ABSL_EXCLUSIVE_LOCKS_REQUIRED(on_resolved_mu_);
+    absl::optional<DnsResultCache::Result> OnResolvedLocked(
+        grpc_error_handle error) ABSL_EXCLUSIVE_LOCKS_REQUIRED(on_resolved_mu_);
 
     Mutex on_resolved_mu_;
-    RefCountedPtr<AresClientChannelDNSResolver> resolver_;
+    std::function<void(DnsResultCache::Result)> on_done_;
     grpc_closure on_hostname_resolved_;
     std::unique_ptr<grpc_ares_request> hostname_request_
         ABSL_GUARDED_BY(on_resolved_mu_);
@@ -194,6 +195,8 @@ class AresClientChannelDNSResolver : public PollingResolver {
     char* service_config_json_ ABSL_GUARDED_BY(on_resolved_mu_) = nullptr;
   };
 
+  void OnResolved(const DnsResultCache::Result& dns_result);
+
   ~AresClientChannelDNSResolver() override;
 
   /// whether to request the service config
@@ -202,6 +205,8 @@ class AresClientChannelDNSResolver : public PollingResolver {
   const bool enable_srv_queries_;
   // timeout in milliseconds for active DNS queries
   const int query_timeout_ms_;
+  // max age of cached DNS results to use
+  const Duration cache_max_age_;
 };
 
 AresClientChannelDNSResolver::AresClientChannelDNSResolver(
@@ -228,7 +233,11 @@ AresClientChannelDNSResolver::AresClientChannelDNSResolver(
                               .value_or(false)),
       query_timeout_ms_(
           std::max(0, channel_args.GetInt(GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS)
-                          .value_or(GRPC_DNS_ARES_DEFAULT_QUERY_TIMEOUT_MS))) {}
+                          .value_or(GRPC_DNS_ARES_DEFAULT_QUERY_TIMEOUT_MS))),
+      cache_max_age_(std::max(
+          Duration::Zero(),
+          channel_args.GetDurationFromIntMillis(GRPC_ARG_DNS_CACHE_MAX_AGE_MS)
+              .value_or(Duration::Zero()))) {}
 
 AresClientChannelDNSResolver::~AresClientChannelDNSResolver() {
   GRPC_CARES_TRACE_LOG("resolver:%p destroying AresClientChannelDNSResolver",
@@ -236,8 +245,26 @@ AresClientChannelDNSResolver::~AresClientChannelDNSResolver() {
 }
 
 OrphanablePtr<Orphanable> AresClientChannelDNSResolver::StartRequest() {
-  return MakeOrphanable<AresRequestWrapper>(
-      Ref(DEBUG_LOCATION, "dns-resolving"));
+  // Channels share lookups only if they would issue the same queries.
+  std::string key = absl::StrCat("ares:", authority(), "/", name_to_resolve(),
+                                 ";srv=", enable_srv_queries_, ";txt=",
+                                 request_service_config_, ";timeout=",
+                                 query_timeout_ms_);
+  return DnsResultCache::Get()->Lookup(
+      std::move(key), cache_max_age_, interested_parties(),
+      channel_args().GetObject<grpc_event_engine::experimental::EventEngine>(),
+      [this](grpc_pollset_set* interested_parties,
+             std::function<void(DnsResultCache::Result)> on_done) {
+        return MakeOrphanable<AresRequestWrapper>(
+            authority(), name_to_resolve(), enable_srv_queries_,
+            request_service_config_, query_timeout_ms_, interested_parties,
+            std::move(on_done));
+      },
+      [self = RefCountedPtr<AresClientChannelDNSResolver>(
+           Ref(DEBUG_LOCATION, "dns-resolving"))](
+          const DnsResultCache::Result& dns_result) {
+        self->OnResolved(dns_result);
+      });
 }
 
 bool ValueInJsonArray(const Json::Array& array, const char* value) {
@@ -249,7 +276,7 @@ bool ValueInJsonArray(const Json::Array& array, const char* value) {
   return false;
 }
 
-std::string ChooseServiceConfig(char* service_config_choice_json,
+std::string ChooseServiceConfig(absl::string_view service_config_choice_json,
                                 grpc_error_handle* error) {
   auto json = Json::Parse(service_config_choice_json);
   if (!json.ok()) {
@@ -334,80 +361,95 @@ std::string ChooseServiceConfig(char* service_config_choice_json,
 void AresClientChannelDNSResolver::AresRequestWrapper::OnHostnameResolved(
     void* arg, grpc_error_handle error) {
   auto* self = static_cast<AresRequestWrapper*>(arg);
-  absl::optional<Result> result;
+  absl::optional<DnsResultCache::Result> result;
   {
     MutexLock lock(&self->on_resolved_mu_);
     self->hostname_request_.reset();
     result = self->OnResolvedLocked(error);
   }
-  if (result.has_value()) {
-    self->resolver_->OnRequestComplete(std::move(*result));
-  }
+  if (result.has_value()) self->on_done_(std::move(*result));
   self->Unref(DEBUG_LOCATION, "OnHostnameResolved");
 }
 
 void AresClientChannelDNSResolver::AresRequestWrapper::OnSRVResolved(
     void* arg, grpc_error_handle error) {
   auto* self = static_cast<AresRequestWrapper*>(arg);
-  absl::optional<Result> result;
+  absl::optional<DnsResultCache::Result> result;
   {
     MutexLock lock(&self->on_resolved_mu_);
     self->srv_request_.reset();
     result = self->OnResolvedLocked(error);
   }
-  if (result.has_value()) {
-    self->resolver_->OnRequestComplete(std::move(*result));
-  }
+  if (result.has_value()) self->on_done_(std::move(*result));
   self->Unref(DEBUG_LOCATION, "OnSRVResolved");
 }
 
 void AresClientChannelDNSResolver::AresRequestWrapper::OnTXTResolved(
     void* arg, grpc_error_handle error) {
   auto* self = static_cast<AresRequestWrapper*>(arg);
-  absl::optional<Result> result;
+  absl::optional<DnsResultCache::Result> result;
   {
     MutexLock lock(&self->on_resolved_mu_);
     self->txt_request_.reset();
     result = self->OnResolvedLocked(error);
   }
-  if (result.has_value()) {
-    self->resolver_->OnRequestComplete(std::move(*result));
-  }
+  if (result.has_value()) self->on_done_(std::move(*result));
   self->Unref(DEBUG_LOCATION, "OnTXTResolved");
 }
 
-// Returns a Result if resolution is complete.
-// callers must release the lock and call OnRequestComplete if a Result is
-// returned. This is because OnRequestComplete may Orphan the resolver, which
+// Returns a result if resolution is complete.
+// callers must release the lock and invoke on_done_ if a result is
+// returned. This is because on_done_ may Orphan the resolver, which
 // requires taking the lock.
-absl::optional<AresClientChannelDNSResolver::Result>
+absl::optional<DnsResultCache::Result>
 AresClientChannelDNSResolver::AresRequestWrapper::OnResolvedLocked(
     grpc_error_handle error) ABSL_EXCLUSIVE_LOCKS_REQUIRED(on_resolved_mu_) {
   if (hostname_request_ != nullptr || srv_request_ != nullptr ||
       txt_request_ != nullptr) {
     GRPC_CARES_TRACE_LOG(
-        "resolver:%p OnResolved() waiting for results (hostname: %s, srv: %s, "
+        "request:%p OnResolved() waiting for results (hostname: %s, srv: %s, "
         "txt: %s)",
         this, hostname_request_ != nullptr ? "waiting" : "done",
         srv_request_ != nullptr ? "waiting" : "done",
         txt_request_ != nullptr ? "waiting" : "done");
     return absl::nullopt;
   }
-  GRPC_CARES_TRACE_LOG("resolver:%p OnResolved() proceeding", this);
-  Result result;
-  result.args = resolver_->channel_args();
-  // TODO(roth): Change logic to be able to report failures for addresses
-  // and service config independently of each other.
+  GRPC_CARES_TRACE_LOG("request:%p OnResolved() proceeding", this);
+  DnsResultCache::Result result;
   if (addresses_ != nullptr || balancer_addresses_ != nullptr) {
     if (addresses_ != nullptr) {
       result.addresses = std::move(*addresses_);
     } else {
       result.addresses = ServerAddressList();
     }
+    if (balancer_addresses_ != nullptr) {
+      result.balancer_addresses = std::move(*balancer_addresses_);
+    }
     if (service_config_json_ != nullptr) {
+      result.service_config_json = service_config_json_;
+    }
+  } else {
+    GRPC_CARES_TRACE_LOG("request:%p dns resolution failed: %s", this,
+                         StatusToString(error).c_str());
+    std::string error_message;
+    grpc_error_get_str(error, StatusStrProperty::kDescription, &error_message);
+    result.addresses = absl::UnavailableError(error_message);
+  }
+  return std::move(result);
+}
+
+void AresClientChannelDNSResolver::OnResolved(
+    const DnsResultCache::Result& dns_result) {
+  Result result;
+  result.args = channel_args();
+  // TODO(roth): Change logic to be able to report failures for addresses
+  // and service config independently of each other.
+  if (dns_result.addresses.ok()) {
+    result.addresses = *dns_result.addresses;
+    if (dns_result.service_config_json.has_value()) {
       grpc_error_handle service_config_error;
-      std::string service_config_string =
-          ChooseServiceConfig(service_config_json_, &service_config_error);
+      std::string service_config_string = ChooseServiceConfig(
+          *dns_result.service_config_json, &service_config_error);
       if (!service_config_error.ok()) {
         result.service_config = absl::UnavailableError(
             absl::StrCat("failed to parse service config: ",
@@ -415,8 +457,8 @@ AresClientChannelDNSResolver::AresRequestWrapper::OnResolvedLocked(
       } else if (!service_config_string.empty()) {
         GRPC_CARES_TRACE_LOG("resolver:%p selected service config choice: %s",
                              this, service_config_string.c_str());
-        result.service_config = ServiceConfigImpl::Create(
-            resolver_->channel_args(), service_config_string);
+        result.service_config =
+            ServiceConfigImpl::Create(channel_args(), service_config_string);
         if (!result.service_config.ok()) {
           result.service_config = absl::UnavailableError(
               absl::StrCat("failed to parse service config: ",
@@ -424,23 +466,20 @@ AresClientChannelDNSResolver::AresRequestWrapper::OnResolvedLocked(
         }
       }
     }
-    if (balancer_addresses_ != nullptr) {
+    if (dns_result.balancer_addresses.has_value()) {
       result.args = SetGrpcLbBalancerAddresses(
-          result.args, ServerAddressList(*balancer_addresses_));
+          result.args, ServerAddressList(*dns_result.balancer_addresses));
     }
   } else {
     GRPC_CARES_TRACE_LOG("resolver:%p dns resolution failed: %s", this,
-                         StatusToString(error).c_str());
-    std::string error_message;
-    grpc_error_get_str(error, StatusStrProperty::kDescription, &error_message);
+                         dns_result.addresses.status().ToString().c_str());
     absl::Status status = absl::UnavailableError(
-        absl::StrCat("DNS resolution failed for ", resolver_->name_to_resolve(),
-                     ": ", error_message));
+        absl::StrCat("DNS resolution failed for ", name_to_resolve(), ": ",
+                     dns_result.addresses.status().message()));
     result.addresses = status;
     result.service_config = status;
   }
-
-  return std::move(result);
+  OnRequestComplete(std::move(result));
 }
 
 //
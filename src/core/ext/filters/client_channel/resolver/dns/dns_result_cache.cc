@@ -0,0 +1,269 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/client_channel/resolver/dns/dns_result_cache.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/pollset_set.h"
+
+namespace grpc_core {
+
+//
+// DnsResultCache::Request
+//
+
+class DnsResultCache::Request : public InternallyRefCounted<Request> {
+ public:
+  Request(DnsResultCache* cache, grpc_pollset_set* interested_parties,
+          OnDone on_done)
+      : cache_(cache),
+        interested_parties_(interested_parties),
+        on_done_(std::move(on_done)) {}
+
+  using InternallyRefCounted<Request>::Ref;
+
+  void Orphan() override;
+
+  // Invokes on_done, unless the request was cancelled.
+  void Deliver(const Result& result) {
+    OnDone on_done;
+    {
+      MutexLock lock(&mu_);
+      on_done = std::move(on_done_);
+      on_done_ = nullptr;
+    }
+    if (on_done != nullptr) on_done(result);
+  }
+
+  grpc_pollset_set* interested_parties() const { return interested_parties_; }
+
+  // The lookup this request is waiting for, if any.  Guarded by the
+  // cache's mu_.
+  RefCountedPtr<InFlightLookup> lookup;
+
+ private:
+  DnsResultCache* const cache_;
+  grpc_pollset_set* const interested_parties_;
+  Mutex mu_;
+  OnDone on_done_ ABSL_GUARDED_BY(mu_);
+};
+
+//
+// DnsResultCache::InFlightLookup
+//
+
+// The methods ending in Locked must be called with the cache's mu_ held.
+class DnsResultCache::InFlightLookup : public RefCounted<InFlightLookup> {
+ public:
+  InFlightLookup(DnsResultCache* cache, std::string key)
+      : cache_(cache),
+        key_(std::move(key)),
+        interested_parties_(grpc_pollset_set_create()) {}
+
+  ~InFlightLookup() override { grpc_pollset_set_destroy(interested_parties_); }
+
+  const std::string& key() const { return key_; }
+  grpc_pollset_set* interested_parties() const { return interested_parties_; }
+
+  void AddRequestLocked(RefCountedPtr<Request> request, Duration max_age) {
+    max_age_ = std::max(max_age_, max_age);
+    Request* request_ptr = request.get();
+    requests_.emplace(request_ptr, std::move(request));
+  }
+
+  // Returns true if no requests remain.
+  bool RemoveRequestLocked(Request* request) {
+    requests_.erase(request);
+    return requests_.empty();
+  }
+
+  bool HasRequestsLocked() const { return !requests_.empty(); }
+
+  // Stores the handle for the lookup once it has been started.
+  void SetLookupLocked(OrphanablePtr<Orphanable> lookup) {
+    lookup_ = std::move(lookup);
+  }
+
+  OrphanablePtr<Orphanable> TakeLookupLocked() { return std::move(lookup_); }
+
+  void OnLookupDone(Result result);
+
+ private:
+  DnsResultCache* const cache_;
+  const std::string key_;
+  // Polled by the interested_parties of every waiting request.
+  grpc_pollset_set* const interested_parties_;
+  OrphanablePtr<Orphanable> lookup_;
+  absl::flat_hash_map<Request*, RefCountedPtr<Request>> requests_;
+  // The longest max age of the requests, used to expire the result.
+  Duration max_age_ = Duration::Zero();
+};
+
+void DnsResultCache::InFlightLookup::OnLookupDone(Result result) {
+  absl::flat_hash_map<Request*, RefCountedPtr<Request>> requests;
+  OrphanablePtr<Orphanable> lookup;
+  {
+    MutexLock lock(&cache_->mu_);
+    // The lookup may have been cancelled and replaced by a new one.
+    auto it = cache_->in_flight_.find(key_);
+    if (it != cache_->in_flight_.end() && it->second.get() == this) {
+      cache_->in_flight_.erase(it);
+    }
+    requests = std::move(requests_);
+    requests_.clear();
+    for (auto& p : requests) p.second->lookup.reset();
+    lookup = std::move(lookup_);
+    if (result.addresses.ok() && max_age_ > Duration::Zero()) {
+      Timestamp now = Timestamp::Now();
+      CacheEntry& entry = cache_->cache_[key_];
+      entry.result = result;
+      entry.completion_time = now;
+      entry.expiration = now + max_age_;
+      if (cache_->cache_.size() >= cache_->next_sweep_size_) {
+        cache_->RemoveExpiredEntriesLocked(now);
+      }
+    }
+  }
+  for (auto& p : requests) {
+    grpc_pollset_set_del_pollset_set(interested_parties_,
+                                     p.second->interested_parties());
+    p.second->Deliver(result);
+  }
+}
+
+void DnsResultCache::Request::Orphan() {
+  RefCountedPtr<InFlightLookup> in_flight;
+  OrphanablePtr<Orphanable> lookup_to_cancel;
+  {
+    MutexLock lock(&cache_->mu_);
+    in_flight = std::move(lookup);
+    if (in_flight != nullptr && in_flight->RemoveRequestLocked(this)) {
+      // No-one else is waiting, so cancel the lookup.
+      auto it = cache_->in_flight_.find(in_flight->key());
+      if (it != cache_->in_flight_.end() && it->second == in_flight) {
+        cache_->in_flight_.erase(it);
+      }
+      lookup_to_cancel = in_flight->TakeLookupLocked();
+    }
+  }
+  if (in_flight != nullptr) {
+    grpc_pollset_set_del_pollset_set(in_flight->interested_parties(),
+                                     interested_parties_);
+  }
+  lookup_to_cancel.reset();
+  OnDone on_done;
+  {
+    MutexLock lock(&mu_);
+    on_done = std::move(on_done_);
+    on_done_ = nullptr;
+  }
+  on_done = nullptr;
+  Unref();
+}
+
+//
+// DnsResultCache
+//
+
+DnsResultCache* DnsResultCache::Get() {
+  static NoDestruct<DnsResultCache> cache;
+  return cache.get();
+}
+
+OrphanablePtr<Orphanable> DnsResultCache::Lookup(
+    std::string key, Duration max_age, grpc_pollset_set* interested_parties,
+    grpc_event_engine::experimental::EventEngine* event_engine,
+    StartLookup start_lookup, OnDone on_done) {
+  auto request =
+      MakeOrphanable<Request>(this, interested_parties, std::move(on_done));
+  RefCountedPtr<InFlightLookup> new_lookup;
+  {
+    MutexLock lock(&mu_);
+    // Use a cached result if it is fresh enough.
+    if (max_age > Duration::Zero()) {
+      auto it = cache_.find(key);
+      if (it != cache_.end() &&
+          Timestamp::Now() - it->second.completion_time <= max_age) {
+        global_stats().IncrementDnsCacheHits();
+        event_engine->Run([request = request->Ref(),
+                           result = it->second.result]() {
+          ApplicationCallbackExecCtx callback_exec_ctx;
+          ExecCtx exec_ctx;
+          request->Deliver(result);
+        });
+        return request;
+      }
+    }
+    // Otherwise wait for the lookup in flight, or start one.
+    auto& in_flight = in_flight_[key];
+    if (in_flight == nullptr) {
+      global_stats().IncrementDnsCacheMisses();
+      in_flight = MakeRefCounted<InFlightLookup>(this, key);
+      new_lookup = in_flight;
+    } else {
+      global_stats().IncrementDnsCacheSharedLookups();
+    }
+    in_flight->AddRequestLocked(request->Ref(), max_age);
+    request->lookup = in_flight;
+    grpc_pollset_set_add_pollset_set(in_flight->interested_parties(),
+                                     interested_parties);
+  }
+  if (new_lookup != nullptr) {
+    OrphanablePtr<Orphanable> lookup = start_lookup(
+        new_lookup->interested_parties(),
+        [new_lookup](Result result) mutable {
+          new_lookup->OnLookupDone(std::move(result));
+          new_lookup.reset();
+        });
+    {
+      MutexLock lock(&mu_);
+      // If every request was cancelled (or the lookup finished) while it
+      // was being started, the handle is no longer needed.
+      if (new_lookup->HasRequestsLocked()) {
+        new_lookup->SetLookupLocked(std::move(lookup));
+      }
+    }
+    // Destroys the handle, if it was not stored.
+    lookup.reset();
+  }
+  return request;
+}
+
+void DnsResultCache::Clear() {
+  MutexLock lock(&mu_);
+  cache_.clear();
+}
+
+void DnsResultCache::RemoveExpiredEntriesLocked(Timestamp now) {
+  for (auto it = cache_.begin(); it != cache_.end();) {
+    if (it->second.expiration <= now) {
+      cache_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  next_sweep_size_ = std::max<size_t>(64, cache_.size() * 2);
+}
+
+}  // namespace grpc_core
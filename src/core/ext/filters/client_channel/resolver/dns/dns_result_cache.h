@@ -0,0 +1,119 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_RESOLVER_DNS_DNS_RESULT_CACHE_H
+#define GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_RESOLVER_DNS_DNS_RESULT_CACHE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <functional>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/statusor.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/iomgr_fwd.h"
+#include "src/core/lib/resolver/server_address.h"
+
+namespace grpc_core {
+
+// A process-wide cache of DNS lookups, shared by the DNS resolvers of all
+// channels.
+//
+// Concurrent requests for the same key share one lookup, so many channels
+// to the same name that re-resolve at the same time issue a single query.
+// Successful results are also kept for later requests, each of which only
+// takes a cached result that is younger than its own max age.  Neither the
+// native resolver nor the c-ares address queries report record TTLs, so the
+// max age comes from the GRPC_ARG_DNS_CACHE_MAX_AGE_MS channel arg; it
+// defaults to zero, which only shares lookups that are in flight.
+class DnsResultCache {
+ public:
+  // The result of a lookup.  Each resolver turns it into a Resolver::Result
+  // for its own channel.
+  struct Result {
+    absl::StatusOr<ServerAddressList> addresses;
+    // The grpclb balancer addresses, if SRV records were queried.
+    absl::optional<ServerAddressList> balancer_addresses;
+    // The service config choices from TXT records, if any were found.
+    absl::optional<std::string> service_config_json;
+  };
+
+  // Invoked when the result for a request is available.
+  using OnDone = absl::AnyInvocable<void(const Result&)>;
+  // Starts a DNS lookup whose fds are polled through interested_parties.
+  // The lookup must invoke on_done exactly once, even when it is cancelled
+  // by orphaning the returned object.
+  using StartLookup = absl::AnyInvocable<OrphanablePtr<Orphanable>(
+      grpc_pollset_set* interested_parties,
+      std::function<void(Result)> on_done)>;
+
+  static DnsResultCache* Get();
+
+  // Delivers the result for key to on_done: from the cache if it holds a
+  // result no older than max_age, from an in-flight lookup for key, or else
+  // from a new lookup started with start_lookup.  The fds of the lookup are
+  // polled by interested_parties while the request waits.  on_done is never
+  // invoked from within Lookup(); cached results are delivered via
+  // event_engine.
+  //
+  // Orphaning the returned object cancels the request, and cancels the
+  // lookup if no other request is waiting for it.  on_done may still be
+  // invoked if the result was already being delivered.
+  OrphanablePtr<Orphanable> Lookup(
+      std::string key, Duration max_age, grpc_pollset_set* interested_parties,
+      grpc_event_engine::experimental::EventEngine* event_engine,
+      StartLookup start_lookup, OnDone on_done);
+
+  // Drops all cached results.  For tests.
+  void Clear();
+
+ private:
+  class InFlightLookup;
+  class Request;
+
+  struct CacheEntry {
+    Result result;
+    Timestamp completion_time;
+    // The entry is not used after this, and may be removed.
+    Timestamp expiration;
+  };
+
+  void RemoveExpiredEntriesLocked(Timestamp now)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  Mutex mu_;
+  absl::flat_hash_map<std::string, RefCountedPtr<InFlightLookup>> in_flight_
+      ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<std::string, CacheEntry> cache_ ABSL_GUARDED_BY(mu_);
+  // Expired entries are removed whenever the cache grows to this size.
+  size_t next_sweep_size_ ABSL_GUARDED_BY(mu_) = 64;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_CLIENT_CHANNEL_RESOLVER_DNS_DNS_RESULT_CACHE_H
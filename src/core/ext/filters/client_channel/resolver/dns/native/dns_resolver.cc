@@ -17,12 +17,12 @@
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "absl/functional/bind_front.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -30,10 +30,12 @@
 #include "absl/strings/strip.h"
 #include "absl/types/optional.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/support/log.h>
 
 #include "src/core/ext/filters/client_channel/resolver/dns/dns_resolver_selection.h"
+#include "src/core/ext/filters/client_channel/resolver/dns/dns_result_cache.h"
 #include "src/core/ext/filters/client_channel/resolver/polling_resolver.h"
 #include "src/core/lib/backoff/backoff.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -73,9 +75,9 @@ class NativeClientChannelDNSResolver : public PollingResolver {
   OrphanablePtr<Orphanable> StartRequest() override;
 
  private:
-  // No-op request class, used so that the PollingResolver code knows
-  // when there is a request in flight, even if the request is not
-  // actually cancellable.
+  // No-op request class, used so that the DNS result cache knows when
+  // there is a lookup in flight, even if the lookup is not actually
+  // cancellable.
   class Request : public Orphanable {
    public:
     Request() = default;
@@ -83,8 +85,10 @@ class NativeClientChannelDNSResolver : public PollingResolver {
     void Orphan() override { delete this; }
   };
 
-  void OnResolved(
-      absl::StatusOr<std::vector<grpc_resolved_address>> addresses_or);
+  void OnResolved(const DnsResultCache::Result& dns_result);
+
+  // max age of cached DNS results to use
+  const Duration cache_max_age_;
 };
 
 NativeClientChannelDNSResolver::NativeClientChannelDNSResolver(
@@ -103,7 +107,11 @@ NativeClientChannelDNSResolver::NativeClientChannelDNSResolver(
               .set_jitter(GRPC_DNS_RECONNECT_JITTER)
               .set_max_backoff(Duration::Milliseconds(
                   GRPC_DNS_RECONNECT_MAX_BACKOFF_SECONDS * 1000)),
-          &grpc_trace_dns_resolver) {
+          &grpc_trace_dns_resolver),
+      cache_max_age_(std::max(
+          Duration::Zero(),
+          channel_args.GetDurationFromIntMillis(GRPC_ARG_DNS_CACHE_MAX_AGE_MS)
+              .value_or(Duration::Zero()))) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_dns_resolver)) {
     gpr_log(GPR_DEBUG, "[dns_resolver=%p] created", this);
   }
@@ -116,40 +124,60 @@ NativeClientChannelDNSResolver::~NativeClientChannelDNSResolver() {
 }
 
 OrphanablePtr<Orphanable> NativeClientChannelDNSResolver::StartRequest() {
-  Ref(DEBUG_LOCATION, "dns_request").release();
-  auto dns_request_handle = GetDNSResolver()->LookupHostname(
-      absl::bind_front(&NativeClientChannelDNSResolver::OnResolved, this),
-      name_to_resolve(), kDefaultSecurePort, kDefaultDNSRequestTimeout,
-      interested_parties(), /*name_server=*/"");
-  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_dns_resolver)) {
-    gpr_log(GPR_DEBUG, "[dns_resolver=%p] starting request=%p", this,
-            DNSResolver::HandleToString(dns_request_handle).c_str());
-  }
-  return MakeOrphanable<Request>();
+  return DnsResultCache::Get()->Lookup(
+      absl::StrCat("native:", name_to_resolve()), cache_max_age_,
+      interested_parties(),
+      channel_args().GetObject<grpc_event_engine::experimental::EventEngine>(),
+      [this](grpc_pollset_set* interested_parties,
+             std::function<void(DnsResultCache::Result)> on_done) {
+        auto dns_request_handle = GetDNSResolver()->LookupHostname(
+            [on_done = std::move(on_done)](
+                absl::StatusOr<std::vector<grpc_resolved_address>>
+                    addresses_or) {
+              // Convert result from iomgr DNS API.
+              DnsResultCache::Result dns_result;
+              if (addresses_or.ok()) {
+                ServerAddressList addresses;
+                for (auto& addr : *addresses_or) {
+                  addresses.emplace_back(addr, ChannelArgs());
+                }
+                dns_result.addresses = std::move(addresses);
+              } else {
+                dns_result.addresses = addresses_or.status();
+              }
+              on_done(std::move(dns_result));
+            },
+            name_to_resolve(), kDefaultSecurePort, kDefaultDNSRequestTimeout,
+            interested_parties, /*name_server=*/"");
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_dns_resolver)) {
+          gpr_log(GPR_DEBUG, "[dns_resolver=%p] starting request=%p", this,
+                  DNSResolver::HandleToString(dns_request_handle).c_str());
+        }
+        return MakeOrphanable<Request>();
+      },
+      [self = RefCountedPtr<NativeClientChannelDNSResolver>(
+           Ref(DEBUG_LOCATION, "dns_request"))](
+          const DnsResultCache::Result& dns_result) {
+        self->OnResolved(dns_result);
+      });
 }
 
 void NativeClientChannelDNSResolver::OnResolved(
-    absl::StatusOr<std::vector<grpc_resolved_address>> addresses_or) {
+    const DnsResultCache::Result& dns_result) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_dns_resolver)) {
     gpr_log(GPR_DEBUG, "[dns_resolver=%p] request complete, status=\"%s\"",
-            this, addresses_or.status().ToString().c_str());
+            this, dns_result.addresses.status().ToString().c_str());
   }
-  // Convert result from iomgr DNS API into Resolver::Result.
   Result result;
-  if (addresses_or.ok()) {
-    ServerAddressList addresses;
-    for (auto& addr : *addresses_or) {
-      addresses.emplace_back(addr, ChannelArgs());
-    }
-    result.addresses = std::move(addresses);
+  if (dns_result.addresses.ok()) {
+    result.addresses = *dns_result.addresses;
   } else {
     result.addresses = absl::UnavailableError(
         absl::StrCat("DNS resolution failed for ", name_to_resolve(), ": ",
-                     addresses_or.status().ToString()));
+                     dns_result.addresses.status().ToString()));
   }
   result.args = channel_args();
   OnRequestComplete(std::move(result));
-  Unref(DEBUG_LOCATION, "dns_request");
 }
 
 //
@@ -22,6 +22,7 @@
 #include <limits.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <memory>
 #include <new>
 #include <string>
@@ -131,6 +132,7 @@ namespace grpc_core {
 
 namespace {
 
+using internal::HedgingPolicy;
 using internal::RetryGlobalConfig;
 using internal::RetryMethodConfig;
 using internal::RetryServiceConfigParser;
@@ -261,14 +263,27 @@ class RetryFilter::CallData {
     // Cancels the call attempt.
     void CancelFromSurface(grpc_transport_stream_op_batch* cancel_batch);
 
+    // Adds whatever batches are needed on this attempt to closures.
+    void AddRetriableBatches(CallCombinerClosureList* closures);
+
+    // Abandons the call attempt and adds a batch to closures to cancel it.
+    // Used when the call has been committed to another hedged attempt.
+    void CancelLosingHedgedAttempt(CallCombinerClosureList* closures);
+
+    size_t started_send_message_count() const {
+      return started_send_message_count_;
+    }
+
    private:
     // State used for starting a retryable batch on the call attempt's LB call.
     // This provides its own grpc_transport_stream_op_batch and other data
     // structures needed to populate the ops in the batch.
     // We allocate one struct on the arena for each attempt at starting a
     // batch on a given LB call.
-    class BatchData
-        : public RefCounted<BatchData, PolymorphicRefCount, kUnrefCallDtor> {
+    // Its refs are only taken and dropped in the call combiner, where the
+    // batch's callbacks run, so they need not be atomic.
+    class BatchData : public RefCounted<BatchData, PolymorphicRefCount,
+                                        kUnrefCallDtor, NonAtomicRefCount> {
      public:
       BatchData(RefCountedPtr<CallAttempt> call_attempt, int refcount,
                 bool set_on_complete);
@@ -372,7 +387,9 @@ class RetryFilter::CallData {
       void Commit() override {
         call_attempt_->lb_call_committed_ = true;
         auto* calld = call_attempt_->calld_;
-        if (calld->retry_committed_) {
+        // If the call was committed to a different attempt, that attempt
+        // reports the commit instead.
+        if (calld->retry_committed_ && !call_attempt_->abandoned_) {
           auto* service_config_call_data =
               static_cast<ClientChannelServiceConfigCallData*>(
                   calld->call_context_[GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA]
@@ -419,9 +436,6 @@ class RetryFilter::CallData {
     // Adds batches for pending batches to closures.
     void AddBatchesForPendingBatches(CallCombinerClosureList* closures);
 
-    // Adds whatever batches are needed on this attempt to closures.
-    void AddRetriableBatches(CallCombinerClosureList* closures);
-
     // Returns true if any send op in the batch was not yet started on this
     // attempt.
     bool PendingBatchContainsUnstartedSendOps(PendingBatch* pending);
@@ -438,6 +452,10 @@ class RetryFilter::CallData {
     bool ShouldRetry(absl::optional<grpc_status_code> status,
                      absl::optional<Duration> server_pushback_ms);
 
+    // Returns true if, under a hedging policy, the call should carry on with
+    // its other attempts instead of failing with this attempt's status.
+    bool ShouldContinueHedging(grpc_status_code status);
+
     // Abandons the call attempt.  Unrefs any deferred batches.
     void Abandon();
 
@@ -449,6 +467,8 @@ class RetryFilter::CallData {
     AttemptDispatchController attempt_dispatch_controller_;
     OrphanablePtr<ClientChannel::LoadBalancedCall> lb_call_;
     bool lb_call_committed_ = false;
+    // Value of the grpc-previous-rpc-attempts header sent on this attempt.
+    const int num_previous_attempts_;
 
     grpc_timer per_attempt_recv_timer_;
     grpc_closure on_per_attempt_recv_timer_;
@@ -458,6 +478,8 @@ class RetryFilter::CallData {
     grpc_transport_stream_op_batch_payload batch_payload_;
     // For send_initial_metadata.
     grpc_metadata_batch send_initial_metadata_{calld_->arena_};
+    // For send_message.  Only one send_message op is in flight at a time.
+    SliceBuffer send_message_;
     // For send_trailing_metadata.
     grpc_metadata_batch send_trailing_metadata_{calld_->arena_};
     // For intercepting recv_initial_metadata.
@@ -541,6 +563,7 @@ class RetryFilter::CallData {
   void FreeAllCachedSendOpData();
 
   // Commits the call so that no further retry attempts will be performed.
+  // With hedging, this also cancels every attempt other than call_attempt.
   void RetryCommit(CallAttempt* call_attempt);
 
   // Starts a timer to retry after appropriate back-off.
@@ -559,11 +582,28 @@ class RetryFilter::CallData {
       bool is_transparent_retry);
 
   void CreateCallAttempt(bool is_transparent_retry);
+  // Drops calld's ref to call_attempt, which must no longer be in flight.
+  void RemoveCallAttempt(CallAttempt* call_attempt);
+
+  // Returns true if another hedged attempt may be started now.
+  bool CanStartHedgedAttempt();
+  // Starts the timer for the next hedged attempt, if there may be one.
+  void MaybeStartHedgingTimer();
+  void MaybeCancelHedgingTimer();
+  static void OnHedgingTimer(void* arg, grpc_error_handle error);
+  static void OnHedgingTimerLocked(void* arg, grpc_error_handle error);
+  // Adds a closure to closures to start another hedged attempt right away,
+  // without waiting for the hedging delay, unless one is already queued.
+  void MaybeAddClosureToStartHedgedAttempt(bool is_transparent_retry,
+                                           CallCombinerClosureList* closures);
+  static void StartHedgedAttempt(void* arg, grpc_error_handle error);
 
   RetryFilter* chand_;
   grpc_polling_entity* pollent_;
   RefCountedPtr<ServerRetryThrottleData> retry_throttle_data_;
+  // Exactly one of these is set if the method has a retry or hedging policy.
   const RetryMethodConfig* retry_policy_ = nullptr;
+  const HedgingPolicy* hedging_policy_ = nullptr;
   BackOff retry_backoff_;
 
   grpc_slice path_;  // Request path.
@@ -577,10 +617,9 @@ class RetryFilter::CallData {
 
   RefCountedPtr<CallStackDestructionBarrier> call_stack_destruction_barrier_;
 
-  // TODO(roth): As part of implementing hedging, we will need to maintain a
-  // list of all pending attempts, so that we can cancel them all if the call
-  // gets cancelled.
-  RefCountedPtr<CallAttempt> call_attempt_;
+  // The call attempts in flight.  Without hedging there is at most one.
+  // Attempts are dropped from this list as soon as they are abandoned.
+  absl::InlinedVector<RefCountedPtr<CallAttempt>, 1> call_attempts_;
 
   // LB call used when we've committed to a call attempt and the retry
   // state for that attempt is no longer needed.  This provides a fast
@@ -607,6 +646,16 @@ class RetryFilter::CallData {
   grpc_timer retry_timer_;
   grpc_closure retry_closure_;
 
+  // Hedging state.
+  // Hedged attempts started immediately (rather than by the hedging timer)
+  // use retry_closure_, since the retry timer is never used with hedging.
+  bool hedging_timer_pending_ : 1;
+  bool hedged_attempt_start_pending_ : 1;
+  bool hedged_attempt_start_is_transparent_retry_ : 1;
+  int num_attempts_started_ = 0;
+  grpc_timer hedging_timer_;
+  grpc_closure hedging_closure_;
+
   // Cached data for retrying send ops.
   // send_initial_metadata
   bool seen_send_initial_metadata_ = false;
@@ -691,6 +740,9 @@ RetryFilter::CallData::CallAttempt::CallAttempt(CallData* calld,
                                                            : nullptr),
       calld_(calld),
       attempt_dispatch_controller_(this),
+      num_previous_attempts_(calld->hedging_policy_ != nullptr
+                                 ? calld->num_attempts_started_
+                                 : calld->num_attempts_completed_),
       batch_payload_(calld->call_context_),
       started_send_initial_metadata_(false),
       completed_send_initial_metadata_(false),
@@ -741,10 +793,8 @@ RetryFilter::CallData::CallAttempt::~CallAttempt() {
 }
 
 void RetryFilter::CallData::CallAttempt::FreeCachedSendOpDataAfterCommit() {
-  // TODO(roth): When we implement hedging, this logic will need to get
-  // a bit more complex, because there may be other (now abandoned) call
-  // attempts still using this data.  We may need to do some sort of
-  // ref-counting instead.
+  // Attempts send their own copies of the cached data, so this is safe even
+  // if attempts abandoned on commit still have batches in flight.
   if (completed_send_initial_metadata_) {
     calld_->FreeCachedSendInitialMetadata();
   }
@@ -785,11 +835,9 @@ bool RetryFilter::CallData::CallAttempt::HaveSendOpsToReplay() {
 
 void RetryFilter::CallData::CallAttempt::MaybeSwitchToFastPath() {
   // If we're not yet committed, we can't switch yet.
-  // TODO(roth): As part of implementing hedging, this logic needs to
-  // check that *this* call attempt is the one that we've committed to.
-  // Might need to replace abandoned_ with an enum indicating whether we're
-  // in flight, abandoned, or the winning call attempt.
-  if (!calld_->retry_committed_) return;
+  // Every hedged attempt other than the one we committed to is abandoned
+  // on commit, so an abandoned attempt can never switch.
+  if (!calld_->retry_committed_ || abandoned_) return;
   // If we've already switched to fast path, there's nothing to do here.
   if (calld_->committed_call_ != nullptr) return;
   // If the perAttemptRecvTimeout timer is pending, we can't switch yet.
@@ -807,7 +855,7 @@ void RetryFilter::CallData::CallAttempt::MaybeSwitchToFastPath() {
             calld_->chand_, calld_, this);
   }
   calld_->committed_call_ = std::move(lb_call_);
-  calld_->call_attempt_.reset(DEBUG_LOCATION, "MaybeSwitchToFastPath");
+  calld_->RemoveCallAttempt(this);
 }
 
 // If there are any cached send ops that need to be replayed on the
@@ -1112,6 +1160,23 @@ void RetryFilter::CallData::CallAttempt::CancelFromSurface(
   lb_call_->StartTransportStreamOpBatch(cancel_batch);
 }
 
+void RetryFilter::CallData::CallAttempt::CancelLosingHedgedAttempt(
+    CallCombinerClosureList* closures) {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p attempt=%p: cancelling hedged attempt that "
+            "was not committed to",
+            calld_->chand_, calld_, this);
+  }
+  MaybeCancelPerAttemptRecvTimer();
+  MaybeAddBatchForCancelOp(
+      grpc_error_set_int(GRPC_ERROR_CREATE("call committed to another "
+                                           "hedged attempt"),
+                         StatusIntProperty::kRpcStatus, GRPC_STATUS_CANCELLED),
+      closures);
+  Abandon();
+}
+
 bool RetryFilter::CallData::CallAttempt::ShouldRetry(
     absl::optional<grpc_status_code> status,
     absl::optional<Duration> server_pushback) {
@@ -1213,6 +1278,45 @@ bool RetryFilter::CallData::CallAttempt::ShouldRetry(
   return true;
 }
 
+bool RetryFilter::CallData::CallAttempt::ShouldContinueHedging(
+    grpc_status_code status) {
+  if (GPR_LIKELY(status == GRPC_STATUS_OK)) {
+    if (calld_->retry_throttle_data_ != nullptr) {
+      calld_->retry_throttle_data_->RecordSuccess();
+    }
+    return false;
+  }
+  if (!calld_->hedging_policy_->non_fatal_status_codes().Contains(status)) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO,
+              "chand=%p calld=%p attempt=%p: status %s not configured as "
+              "non-fatal for hedging",
+              calld_->chand_, calld_, this, grpc_status_code_to_string(status));
+    }
+    return false;
+  }
+  // As for retries, only failures with matching status codes count against
+  // the throttle.  Whether more hedged attempts are permitted is checked
+  // when they are started.
+  if (calld_->retry_throttle_data_ != nullptr) {
+    calld_->retry_throttle_data_->RecordFailure();
+  }
+  if (calld_->retry_committed_) return false;
+  // If this is the last attempt and there will be no others, its status
+  // is the status of the call.
+  if (calld_->call_attempts_.size() <= 1 &&
+      !calld_->hedged_attempt_start_pending_ &&
+      !calld_->CanStartHedgedAttempt()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO,
+              "chand=%p calld=%p attempt=%p: no hedged attempts left after %d",
+              calld_->chand_, calld_, this, calld_->num_attempts_started_);
+    }
+    return false;
+  }
+  return true;
+}
+
 void RetryFilter::CallData::CallAttempt::Abandon() {
   abandoned_ = true;
   // Unref batches for deferred completion callbacks that will now never
@@ -1348,10 +1452,7 @@ RetryFilter::CallData::CallAttempt::BatchData::~BatchData() {
 void RetryFilter::CallData::CallAttempt::BatchData::
     FreeCachedSendOpDataForCompletedBatch() {
   auto* calld = call_attempt_->calld_;
-  // TODO(roth): When we implement hedging, this logic will need to get
-  // a bit more complex, because there may be other (now abandoned) call
-  // attempts still using this data.  We may need to do some sort of
-  // ref-counting instead.
+  // See CallAttempt::FreeCachedSendOpDataAfterCommit().
   if (batch_.send_initial_metadata) {
     calld->FreeCachedSendInitialMetadata();
   }
@@ -1756,10 +1857,16 @@ void RetryFilter::CallData::CallAttempt::BatchData::RecvTrailingMetadataReady(
         retry = kTransparentRetry;
       }
     }
-    // If not transparently retrying, check for configurable retry.
-    if (retry == kNoRetry &&
-        call_attempt->ShouldRetry(status, server_pushback)) {
-      retry = kConfigurableRetry;
+    // If not transparently retrying, check for configurable retry, or
+    // whether the other hedged attempts can carry on without this one.
+    if (retry == kNoRetry) {
+      if (calld->hedging_policy_ != nullptr) {
+        if (call_attempt->ShouldContinueHedging(status)) {
+          retry = kConfigurableRetry;
+        }
+      } else if (call_attempt->ShouldRetry(status, server_pushback)) {
+        retry = kConfigurableRetry;
+      }
     }
     // If we're retrying, do so.
     if (retry != kNoRetry) {
@@ -1771,10 +1878,17 @@ void RetryFilter::CallData::CallAttempt::BatchData::RecvTrailingMetadataReady(
                            StatusIntProperty::kRpcStatus, GRPC_STATUS_CANCELLED)
                      : error,
           &closures);
+      // With hedging, this attempt is done but the others carry on: if
+      // possible, start the next hedged attempt now instead of waiting for
+      // the hedging delay.
       // For transparent retries, add a closure to immediately start a new
       // call attempt.
       // For configurable retries, start retry timer.
-      if (retry == kTransparentRetry) {
+      if (calld->hedging_policy_ != nullptr) {
+        calld->RemoveCallAttempt(call_attempt);
+        calld->MaybeAddClosureToStartHedgedAttempt(
+            retry == kTransparentRetry, &closures);
+      } else if (retry == kTransparentRetry) {
         calld->AddClosureToStartTransparentRetry(&closures);
       } else {
         calld->StartRetryTimer(server_pushback);
@@ -1807,10 +1921,20 @@ void RetryFilter::CallData::CallAttempt::BatchData::
       "completed", [this](grpc_transport_stream_op_batch* batch) {
         // Match the pending batch with the same set of send ops as the
         // batch we've just completed.
+        // A send_message op only matches if it carried the surface's latest
+        // message, which has been cached (MaybeCacheSendOpsForBatch() takes
+        // the payload out of the batch), since with hedging another attempt
+        // may already have completed an earlier message, letting the surface
+        // send its next one.
         return batch->on_complete != nullptr &&
                batch_.send_initial_metadata == batch->send_initial_metadata &&
                batch_.send_message == batch->send_message &&
-               batch_.send_trailing_metadata == batch->send_trailing_metadata;
+               batch_.send_trailing_metadata ==
+                   batch->send_trailing_metadata &&
+               (!batch_.send_message ||
+                (batch->payload->send_message.send_message == nullptr &&
+                 call_attempt_->completed_send_message_count_ ==
+                     call_attempt_->calld_->send_messages_.size()));
       });
   // If batch_data is a replay batch, then there will be no pending
   // batch to complete.
@@ -1962,12 +2086,19 @@ void RetryFilter::CallData::CallAttempt::BatchData::
   // the filters in the subchannel stack may modify this batch, and we don't
   // want those modifications to be passed forward to subsequent attempts.
   //
+  // Once the call is committed, no other attempt will use the cached
+  // batch, so it is moved instead.  Copies share the metadata values by
+  // ref.
+  //
   // If we've already completed one or more attempts, add the
   // grpc-retry-attempts header.
-  call_attempt_->send_initial_metadata_ = calld->send_initial_metadata_.Copy();
-  if (GPR_UNLIKELY(calld->num_attempts_completed_ > 0)) {
-    call_attempt_->send_initial_metadata_.Set(GrpcPreviousRpcAttemptsMetadata(),
-                                              calld->num_attempts_completed_);
+  call_attempt_->send_initial_metadata_ =
+      calld->retry_committed_ ? std::move(calld->send_initial_metadata_)
+                              : calld->send_initial_metadata_.Copy();
+  if (GPR_UNLIKELY(call_attempt_->num_previous_attempts_ > 0)) {
+    call_attempt_->send_initial_metadata_.Set(
+        GrpcPreviousRpcAttemptsMetadata(),
+        call_attempt_->num_previous_attempts_);
   } else {
     call_attempt_->send_initial_metadata_.Remove(
         GrpcPreviousRpcAttemptsMetadata());
@@ -1992,8 +2123,14 @@ void RetryFilter::CallData::CallAttempt::BatchData::
   CachedSendMessage cache =
       calld->send_messages_[call_attempt_->started_send_message_count_];
   ++call_attempt_->started_send_message_count_;
+  // Each attempt sends its own SliceBuffer, which refs the cached slices
+  // rather than copying their bytes, so that the cache can be freed on
+  // commit while abandoned attempts still have the message in flight.
+  call_attempt_->send_message_ = calld->retry_committed_
+                                     ? std::move(*cache.slices)
+                                     : cache.slices->Copy();
   batch_.send_message = true;
-  batch_.payload->send_message.send_message = cache.slices;
+  batch_.payload->send_message.send_message = &call_attempt_->send_message_;
   batch_.payload->send_message.flags = cache.flags;
 }
 
@@ -2003,8 +2140,10 @@ void RetryFilter::CallData::CallAttempt::BatchData::
   // We need to make a copy of the metadata batch for each attempt, since
   // the filters in the subchannel stack may modify this batch, and we don't
   // want those modifications to be passed forward to subsequent attempts.
+  // See AddRetriableSendInitialMetadataOp() for the committed case.
   call_attempt_->send_trailing_metadata_ =
-      calld->send_trailing_metadata_.Copy();
+      calld->retry_committed_ ? std::move(calld->send_trailing_metadata_)
+                              : calld->send_trailing_metadata_.Copy();
   call_attempt_->started_send_trailing_metadata_ = true;
   batch_.send_trailing_metadata = true;
   batch_.payload->send_trailing_metadata.send_trailing_metadata =
@@ -2151,7 +2290,17 @@ RetryFilter::CallData::CallData(RetryFilter* chand,
       retry_committed_(false),
       retry_timer_pending_(false),
       retry_codepath_started_(false),
-      sent_transparent_retry_not_seen_by_server_(false) {}
+      sent_transparent_retry_not_seen_by_server_(false),
+      hedging_timer_pending_(false),
+      hedged_attempt_start_pending_(false),
+      hedged_attempt_start_is_transparent_retry_(false) {
+  // A hedging policy takes the place of the retry policy.
+  if (retry_policy_ != nullptr &&
+      retry_policy_->hedging_policy() != nullptr) {
+    hedging_policy_ = retry_policy_->hedging_policy();
+    retry_policy_ = nullptr;
+  }
+}
 
 RetryFilter::CallData::~CallData() {
   FreeAllCachedSendOpData();
@@ -2196,16 +2345,16 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
     // If we have a current call attempt, commit the call, then send
     // the cancellation down to that attempt.  When the call fails, it
     // will not be retried, because we have committed it here.
-    if (call_attempt_ != nullptr) {
-      RetryCommit(call_attempt_.get());
-      // TODO(roth): When implementing hedging, this will get more
-      // complex, because instead of just passing the batch down to a
-      // single call attempt, we'll need to cancel multiple call
-      // attempts and wait for the cancellation on_complete from each call
-      // attempt before we propagate the on_complete from this batch
-      // back to the surface.
+    // With hedging, committing cancels all of the other attempts.  We do
+    // not wait for their cancellations to complete before returning the
+    // on_complete for this batch, since they hold their own refs to the
+    // call stack.
+    MaybeCancelHedgingTimer();
+    if (!call_attempts_.empty()) {
+      RefCountedPtr<CallAttempt> call_attempt = call_attempts_.front();
+      RetryCommit(call_attempt.get());
       // Note: This will release the call combiner.
-      call_attempt_->CancelFromSurface(batch);
+      call_attempt->CancelFromSurface(batch);
       return;
     }
     // Cancel retry timer if needed.
@@ -2229,13 +2378,16 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
   PendingBatch* pending = PendingBatchesAdd(batch);
   // If the timer is pending, yield the call combiner and wait for it to
   // run, since we don't want to start another call attempt until it does.
-  if (retry_timer_pending_) {
+  // The same goes for a hedged attempt that is about to be started when
+  // there is no other attempt in flight.
+  if (retry_timer_pending_ ||
+      (hedged_attempt_start_pending_ && call_attempts_.empty())) {
     GRPC_CALL_COMBINER_STOP(call_combiner_,
                             "added pending batch while retry timer pending");
     return;
   }
   // If we do not yet have a call attempt, create one.
-  if (call_attempt_ == nullptr) {
+  if (call_attempts_.empty()) {
     // If this is the first batch and retries are already committed
     // (e.g., if this batch put the call above the buffer size limit), then
     // immediately create an LB call and delegate the batch to it.  This
@@ -2282,11 +2434,28 @@ void RetryFilter::CallData::StartTransportStreamOpBatch(
     return;
   }
   // Send batches to call attempt.
+  if (call_attempts_.size() == 1) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: starting batch on attempt=%p",
+              chand_, this, call_attempts_.front().get());
+    }
+    call_attempts_.front()->StartRetriableBatches();
+    return;
+  }
+  // With hedging, every attempt in flight gets the batch.  Collect the
+  // batches of all of them, so that we yield the call combiner only once.
   if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
-    gpr_log(GPR_INFO, "chand=%p calld=%p: starting batch on attempt=%p", chand_,
-            this, call_attempt_.get());
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p: starting batch on %" PRIuPTR
+            " hedged attempts",
+            chand_, this, call_attempts_.size());
   }
-  call_attempt_->StartRetriableBatches();
+  CallCombinerClosureList closures;
+  for (auto& call_attempt : call_attempts_) {
+    call_attempt->AddRetriableBatches(&closures);
+  }
+  // Note: This will yield the call combiner.
+  closures.RunClosures(call_combiner_);
 }
 
 OrphanablePtr<ClientChannel::LoadBalancedCall>
@@ -2305,8 +2474,25 @@ RetryFilter::CallData::CreateLoadBalancedCall(
 }
 
 void RetryFilter::CallData::CreateCallAttempt(bool is_transparent_retry) {
-  call_attempt_ = MakeRefCounted<CallAttempt>(this, is_transparent_retry);
-  call_attempt_->StartRetriableBatches();
+  // Without hedging, a new attempt replaces the previous one.
+  if (hedging_policy_ == nullptr) call_attempts_.clear();
+  auto call_attempt =
+      MakeRefCounted<CallAttempt>(this, is_transparent_retry);
+  call_attempts_.push_back(call_attempt);
+  if (hedging_policy_ != nullptr) {
+    if (!is_transparent_retry) ++num_attempts_started_;
+    MaybeStartHedgingTimer();
+  }
+  call_attempt->StartRetriableBatches();
+}
+
+void RetryFilter::CallData::RemoveCallAttempt(CallAttempt* call_attempt) {
+  for (auto it = call_attempts_.begin(); it != call_attempts_.end(); ++it) {
+    if (it->get() == call_attempt) {
+      call_attempts_.erase(it);
+      return;
+    }
+  }
 }
 
 //
@@ -2423,9 +2609,6 @@ RetryFilter::CallData::PendingBatch* RetryFilter::CallData::PendingBatchesAdd(
   if (batch->send_trailing_metadata) {
     pending_send_trailing_metadata_ = true;
   }
-  // TODO(roth): When we implement hedging, if there are currently attempts
-  // in flight, we will need to pick the one on which the max number of send
-  // ops have already been sent, and we commit to that attempt.
   if (GPR_UNLIKELY(bytes_buffered_for_retry_ >
                    chand_->per_rpc_retry_buffer_size_)) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
@@ -2433,7 +2616,17 @@ RetryFilter::CallData::PendingBatch* RetryFilter::CallData::PendingBatchesAdd(
               "chand=%p calld=%p: exceeded retry buffer size, committing",
               chand_, this);
     }
-    RetryCommit(call_attempt_.get());
+    // If there are several hedged attempts in flight, commit to the one on
+    // which the most send ops have already been sent.
+    CallAttempt* call_attempt = nullptr;
+    for (auto& attempt : call_attempts_) {
+      if (call_attempt == nullptr ||
+          attempt->started_send_message_count() >
+              call_attempt->started_send_message_count()) {
+        call_attempt = attempt.get();
+      }
+    }
+    RetryCommit(call_attempt);
   }
   return pending;
 }
@@ -2556,12 +2749,30 @@ void RetryFilter::CallData::RetryCommit(CallAttempt* call_attempt) {
     // Free cached send ops.
     call_attempt->FreeCachedSendOpDataAfterCommit();
   }
+  // With hedging, stop starting new attempts and cancel all of the ones
+  // we did not commit to.
+  if (hedging_policy_ != nullptr) {
+    MaybeCancelHedgingTimer();
+    CallCombinerClosureList closures;
+    for (auto& attempt : call_attempts_) {
+      if (attempt.get() != call_attempt) {
+        attempt->CancelLosingHedgedAttempt(&closures);
+      }
+    }
+    call_attempts_.erase(
+        std::remove_if(call_attempts_.begin(), call_attempts_.end(),
+                       [call_attempt](const RefCountedPtr<CallAttempt>& a) {
+                         return a.get() != call_attempt;
+                       }),
+        call_attempts_.end());
+    closures.RunClosuresWithoutYielding(call_combiner_);
+  }
 }
 
 void RetryFilter::CallData::StartRetryTimer(
     absl::optional<Duration> server_pushback) {
   // Reset call attempt.
-  call_attempt_.reset(DEBUG_LOCATION, "StartRetryTimer");
+  call_attempts_.clear();
   // Compute backoff delay.
   Timestamp next_attempt_time;
   if (server_pushback.has_value()) {
@@ -2625,6 +2836,122 @@ void RetryFilter::CallData::StartTransparentRetry(void* arg,
   GRPC_CALL_STACK_UNREF(calld->owning_call_, "OnRetryTimer");
 }
 
+//
+// hedging code
+//
+
+bool RetryFilter::CallData::CanStartHedgedAttempt() {
+  if (hedging_policy_ == nullptr || retry_committed_ ||
+      !cancelled_from_surface_.ok() ||
+      num_attempts_started_ >= hedging_policy_->max_attempts()) {
+    return false;
+  }
+  if (retry_throttle_data_ != nullptr &&
+      !retry_throttle_data_->RetriesPermitted()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: hedged attempts throttled", chand_,
+              this);
+    }
+    return false;
+  }
+  auto* service_config_call_data =
+      static_cast<ClientChannelServiceConfigCallData*>(
+          call_context_[GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA].value);
+  return service_config_call_data->call_dispatch_controller()->ShouldRetry();
+}
+
+void RetryFilter::CallData::MaybeStartHedgingTimer() {
+  if (hedging_timer_pending_ || !CanStartHedgedAttempt()) return;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p: starting hedged attempt %d in %" PRId64 " ms",
+            chand_, this, num_attempts_started_ + 1,
+            hedging_policy_->hedging_delay().millis());
+  }
+  GRPC_CLOSURE_INIT(&hedging_closure_, OnHedgingTimer, this, nullptr);
+  GRPC_CALL_STACK_REF(owning_call_, "OnHedgingTimer");
+  hedging_timer_pending_ = true;
+  grpc_timer_init(&hedging_timer_,
+                  Timestamp::Now() + hedging_policy_->hedging_delay(),
+                  &hedging_closure_);
+}
+
+void RetryFilter::CallData::MaybeCancelHedgingTimer() {
+  if (hedging_timer_pending_) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+      gpr_log(GPR_INFO, "chand=%p calld=%p: cancelling hedging timer", chand_,
+              this);
+    }
+    hedging_timer_pending_ = false;  // Lame timer callback.
+    grpc_timer_cancel(&hedging_timer_);
+  }
+}
+
+void RetryFilter::CallData::OnHedgingTimer(void* arg, grpc_error_handle error) {
+  auto* calld = static_cast<CallData*>(arg);
+  GRPC_CLOSURE_INIT(&calld->hedging_closure_, OnHedgingTimerLocked, calld,
+                    nullptr);
+  GRPC_CALL_COMBINER_START(calld->call_combiner_, &calld->hedging_closure_,
+                           error, "hedging timer fired");
+}
+
+void RetryFilter::CallData::OnHedgingTimerLocked(void* arg,
+                                                 grpc_error_handle error) {
+  auto* calld = static_cast<CallData*>(arg);
+  if (error.ok() && calld->hedging_timer_pending_) {
+    calld->hedging_timer_pending_ = false;
+    // An attempt that failed in the meantime may have started the next
+    // hedged attempt already, or used up the last one.
+    if (calld->CanStartHedgedAttempt()) {
+      calld->CreateCallAttempt(/*is_transparent_retry=*/false);
+    } else {
+      GRPC_CALL_COMBINER_STOP(calld->call_combiner_,
+                              "no hedged attempt left to start");
+    }
+  } else {
+    GRPC_CALL_COMBINER_STOP(calld->call_combiner_, "hedging timer cancelled");
+  }
+  GRPC_CALL_STACK_UNREF(calld->owning_call_, "OnHedgingTimer");
+}
+
+void RetryFilter::CallData::MaybeAddClosureToStartHedgedAttempt(
+    bool is_transparent_retry, CallCombinerClosureList* closures) {
+  if (hedged_attempt_start_pending_) return;
+  // A transparent retry replaces the failed attempt, so it does not count
+  // against maxAttempts or the retry throttle.
+  if (!is_transparent_retry && !CanStartHedgedAttempt()) return;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_retry_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p calld=%p: scheduling hedged attempt (transparent=%d)",
+            chand_, this, is_transparent_retry);
+  }
+  hedged_attempt_start_pending_ = true;
+  hedged_attempt_start_is_transparent_retry_ = is_transparent_retry;
+  GRPC_CALL_STACK_REF(owning_call_, "StartHedgedAttempt");
+  GRPC_CLOSURE_INIT(&retry_closure_, StartHedgedAttempt, this, nullptr);
+  closures->Add(&retry_closure_, absl::OkStatus(), "start hedged attempt");
+}
+
+void RetryFilter::CallData::StartHedgedAttempt(void* arg,
+                                               grpc_error_handle /*error*/) {
+  auto* calld = static_cast<CallData*>(arg);
+  calld->hedged_attempt_start_pending_ = false;
+  // Don't start the attempt if the call was cancelled, or if another
+  // attempt has been committed to in the meantime.  If the call was
+  // committed with no attempt in flight (e.g., because the retry buffer
+  // size was exceeded), the new attempt is the one the call commits to.
+  if (calld->cancelled_from_surface_.ok() &&
+      (!calld->retry_committed_ ||
+       (calld->call_attempts_.empty() && calld->committed_call_ == nullptr))) {
+    calld->CreateCallAttempt(
+        calld->hedged_attempt_start_is_transparent_retry_);
+  } else {
+    GRPC_CALL_COMBINER_STOP(calld->call_combiner_,
+                            "hedged attempt no longer needed");
+  }
+  GRPC_CALL_STACK_UNREF(calld->owning_call_, "StartHedgedAttempt");
+}
+
 }  // namespace
 
 const grpc_channel_filter kRetryFilterVtable = {
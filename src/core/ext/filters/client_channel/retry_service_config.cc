@@ -25,6 +25,7 @@
 
 #include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
 #include <grpc/grpc.h>
@@ -112,6 +113,66 @@ void RetryGlobalConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
   }
 }
 
+namespace {
+
+// Parses the optional list of status code names in field_name into codes.
+void ParseStatusCodeList(const Json& json, const JsonArgs& args,
+                         absl::string_view field_name, StatusCodeSet* codes,
+                         ValidationErrors* errors) {
+  auto status_code_list = LoadJsonObjectField<std::vector<std::string>>(
+      json.object_value(), args, field_name, errors, /*required=*/false);
+  if (!status_code_list.has_value()) return;
+  for (size_t i = 0; i < status_code_list->size(); ++i) {
+    ValidationErrors::ScopedField field(
+        errors, absl::StrCat(".", field_name, "[", i, "]"));
+    grpc_status_code status;
+    if (!grpc_status_code_from_string((*status_code_list)[i].c_str(),
+                                      &status)) {
+      errors->AddError("failed to parse status code");
+    } else {
+      codes->Add(status);
+    }
+  }
+}
+
+// Validates a maxAttempts field, clamping it to MAX_MAX_RETRY_ATTEMPTS.
+void ValidateMaxAttempts(const char* policy_name, int* max_attempts,
+                         ValidationErrors* errors) {
+  ValidationErrors::ScopedField field(errors, ".maxAttempts");
+  if (errors->FieldHasErrors()) return;
+  if (*max_attempts <= 1) {
+    errors->AddError("must be at least 2");
+  } else if (*max_attempts > MAX_MAX_RETRY_ATTEMPTS) {
+    gpr_log(GPR_ERROR, "service config: clamped %s.maxAttempts at %d",
+            policy_name, MAX_MAX_RETRY_ATTEMPTS);
+    *max_attempts = MAX_MAX_RETRY_ATTEMPTS;
+  }
+}
+
+}  // namespace
+
+//
+// HedgingPolicy
+//
+
+const JsonLoaderInterface* HedgingPolicy::JsonLoader(const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<HedgingPolicy>()
+          // Note: The "nonFatalStatusCodes" field requires custom parsing,
+          // so it's handled in JsonPostLoad() instead.
+          .Field("maxAttempts", &HedgingPolicy::max_attempts_)
+          .OptionalField("hedgingDelay", &HedgingPolicy::hedging_delay_)
+          .Finish();
+  return loader;
+}
+
+void HedgingPolicy::JsonPostLoad(const Json& json, const JsonArgs& args,
+                                 ValidationErrors* errors) {
+  ValidateMaxAttempts("hedgingPolicy", &max_attempts_, errors);
+  ParseStatusCodeList(json, args, "nonFatalStatusCodes",
+                      &non_fatal_status_codes_, errors);
+}
+
 //
 // RetryMethodConfig
 //
@@ -135,19 +196,7 @@ const JsonLoaderInterface* RetryMethodConfig::JsonLoader(const JsonArgs&) {
 void RetryMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
                                      ValidationErrors* errors) {
   // Validate maxAttempts.
-  {
-    ValidationErrors::ScopedField field(errors, ".maxAttempts");
-    if (!errors->FieldHasErrors()) {
-      if (max_attempts_ <= 1) {
-        errors->AddError("must be at least 2");
-      } else if (max_attempts_ > MAX_MAX_RETRY_ATTEMPTS) {
-        gpr_log(GPR_ERROR,
-                "service config: clamped retryPolicy.maxAttempts at %d",
-                MAX_MAX_RETRY_ATTEMPTS);
-        max_attempts_ = MAX_MAX_RETRY_ATTEMPTS;
-      }
-    }
-  }
+  ValidateMaxAttempts("retryPolicy", &max_attempts_, errors);
   // Validate initialBackoff.
   {
     ValidationErrors::ScopedField field(errors, ".initialBackoff");
@@ -170,22 +219,8 @@ void RetryMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
     }
   }
   // Parse retryableStatusCodes.
-  auto status_code_list = LoadJsonObjectField<std::vector<std::string>>(
-      json.object_value(), args, "retryableStatusCodes", errors,
-      /*required=*/false);
-  if (status_code_list.has_value()) {
-    for (size_t i = 0; i < status_code_list->size(); ++i) {
-      ValidationErrors::ScopedField field(
-          errors, absl::StrCat(".retryableStatusCodes[", i, "]"));
-      grpc_status_code status;
-      if (!grpc_status_code_from_string((*status_code_list)[i].c_str(),
-                                        &status)) {
-        errors->AddError("failed to parse status code");
-      } else {
-        retryable_status_codes_.Add(status);
-      }
-    }
-  }
+  ParseStatusCodeList(json, args, "retryableStatusCodes",
+                      &retryable_status_codes_, errors);
   // Validate perAttemptRecvTimeout.
   if (args.IsEnabled(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING)) {
     if (per_attempt_recv_timeout_.has_value()) {
@@ -257,14 +292,24 @@ namespace {
 
 struct MethodConfig {
   std::unique_ptr<RetryMethodConfig> retry_policy;
+  absl::optional<HedgingPolicy> hedging_policy;
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
     static const auto* loader =
         JsonObjectLoader<MethodConfig>()
             .OptionalField("retryPolicy", &MethodConfig::retry_policy)
+            .OptionalField("hedgingPolicy", &MethodConfig::hedging_policy,
+                           GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING)
             .Finish();
     return loader;
   }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (retry_policy != nullptr && hedging_policy.has_value()) {
+      ValidationErrors::ScopedField field(errors, ".hedgingPolicy");
+      errors->AddError("may not be set when retryPolicy is set");
+    }
+  }
 };
 
 }  // namespace
@@ -275,8 +320,17 @@ RetryServiceConfigParser::ParsePerMethodParams(const ChannelArgs& args,
                                                ValidationErrors* errors) {
   auto method_params =
       LoadFromJson<MethodConfig>(json, JsonChannelArgs(args), errors);
+  if (method_params.hedging_policy.has_value()) {
+    return std::make_unique<RetryMethodConfig>(
+        std::move(*method_params.hedging_policy));
+  }
   return std::move(method_params.retry_policy);
 }
 
+std::vector<absl::string_view> RetryServiceConfigParser::ChannelArgsUsed()
+    const {
+  return {GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING};
+}
+
 }  // namespace internal
 }  // namespace grpc_core
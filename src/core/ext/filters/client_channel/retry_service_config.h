@@ -23,6 +23,8 @@
 #include <stdint.h>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
@@ -54,8 +56,32 @@ class RetryGlobalConfig : public ServiceConfigParser::ParsedConfig {
   uintptr_t milli_token_ratio_ = 0;
 };
 
+// The hedgingPolicy of a method: sends up to max_attempts copies of the
+// same call, hedging_delay apart, and uses whichever finishes first.
+class HedgingPolicy {
+ public:
+  int max_attempts() const { return max_attempts_; }
+  Duration hedging_delay() const { return hedging_delay_; }
+  StatusCodeSet non_fatal_status_codes() const {
+    return non_fatal_status_codes_;
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+  void JsonPostLoad(const Json& json, const JsonArgs& args,
+                    ValidationErrors* errors);
+
+ private:
+  int max_attempts_ = 0;
+  Duration hedging_delay_;
+  StatusCodeSet non_fatal_status_codes_;
+};
+
 class RetryMethodConfig : public ServiceConfigParser::ParsedConfig {
  public:
+  RetryMethodConfig() = default;
+  explicit RetryMethodConfig(HedgingPolicy hedging_policy)
+      : hedging_policy_(std::move(hedging_policy)) {}
+
   int max_attempts() const { return max_attempts_; }
   Duration initial_backoff() const { return initial_backoff_; }
   Duration max_backoff() const { return max_backoff_; }
@@ -66,6 +92,11 @@ class RetryMethodConfig : public ServiceConfigParser::ParsedConfig {
   absl::optional<Duration> per_attempt_recv_timeout() const {
     return per_attempt_recv_timeout_;
   }
+  // Non-null if the method is configured for hedging rather than retries,
+  // in which case none of the retry fields above are set.
+  const HedgingPolicy* hedging_policy() const {
+    return hedging_policy_.has_value() ? &*hedging_policy_ : nullptr;
+  }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
   void JsonPostLoad(const Json& json, const JsonArgs& args,
@@ -78,6 +109,7 @@ class RetryMethodConfig : public ServiceConfigParser::ParsedConfig {
   float backoff_multiplier_ = 0;
   StatusCodeSet retryable_status_codes_;
   absl::optional<Duration> per_attempt_recv_timeout_;
+  absl::optional<HedgingPolicy> hedging_policy_;
 };
 
 class RetryServiceConfigParser : public ServiceConfigParser::Parser {
@@ -92,6 +124,8 @@ class RetryServiceConfigParser : public ServiceConfigParser::Parser {
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override;
 
+  std::vector<absl::string_view> ChannelArgsUsed() const override;
+
   static size_t ParserIndex();
   static void Register(CoreConfiguration::Builder* builder);
 
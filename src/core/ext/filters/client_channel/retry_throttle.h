@@ -51,6 +51,10 @@ class ServerRetryThrottleData : public RefCounted<ServerRetryThrottleData> {
   /// Records a success.
   void RecordSuccess();
 
+  /// Returns true if it's okay to send a retry or a hedged attempt,
+  /// without recording anything.
+  bool RetriesPermitted();
+
   uintptr_t max_milli_tokens() const { return max_milli_tokens_; }
   uintptr_t milli_token_ratio() const { return milli_token_ratio_; }
 
@@ -36,6 +36,7 @@
 #include <grpc/status.h>
 #include <grpc/support/log.h>
 
+#include "src/core/ext/filters/client_channel/connection_attempt_scheduler.h"
 #include "src/core/ext/filters/client_channel/health/health_check_client.h"
 #include "src/core/ext/filters/client_channel/subchannel_pool_interface.h"
 #include "src/core/ext/filters/client_channel/subchannel_stream_client.h"
@@ -72,6 +73,11 @@
 #define GRPC_SUBCHANNEL_RECONNECT_MIN_TIMEOUT_SECONDS 20
 #define GRPC_SUBCHANNEL_RECONNECT_MAX_BACKOFF_SECONDS 120
 #define GRPC_SUBCHANNEL_RECONNECT_JITTER 0.2
+#define GRPC_SUBCHANNEL_DECORRELATED_JITTER_MULTIPLIER 3.0
+
+// Extra connection parameters.
+#define GRPC_SUBCHANNEL_EXTRA_CONNECTION_IDLE_TIMEOUT_SECONDS 30
+#define GRPC_SUBCHANNEL_EXTRA_CONNECTION_RETRY_SECONDS 1
 
 // Conversion between subchannel call and call stack.
 #define SUBCHANNEL_CALL_TO_CALL_STACK(call) \
@@ -94,14 +100,16 @@ DebugOnlyTraceFlag grpc_trace_subchannel_refcount(false, "subchannel_refcount");
 
 ConnectedSubchannel::ConnectedSubchannel(
     grpc_channel_stack* channel_stack, const ChannelArgs& args,
-    RefCountedPtr<channelz::SubchannelNode> channelz_subchannel)
+    RefCountedPtr<channelz::SubchannelNode> channelz_subchannel,
+    RefCountedPtr<TransportStreamLimit> stream_limit)
     : RefCounted<ConnectedSubchannel>(
           GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel_refcount)
               ? "ConnectedSubchannel"
               : nullptr),
       channel_stack_(channel_stack),
       args_(args),
-      channelz_subchannel_(std::move(channelz_subchannel)) {}
+      channelz_subchannel_(std::move(channelz_subchannel)),
+      stream_limit_(std::move(stream_limit)) {}
 
 ConnectedSubchannel::~ConnectedSubchannel() {
   GRPC_CHANNEL_STACK_UNREF(channel_stack_, "connected_subchannel_dtor");
@@ -149,6 +157,7 @@ RefCountedPtr<SubchannelCall> SubchannelCall::Create(Args args,
 SubchannelCall::SubchannelCall(Args args, grpc_error_handle* error)
     : connected_subchannel_(std::move(args.connected_subchannel)),
       deadline_(args.deadline) {
+  connected_subchannel_->active_calls_.fetch_add(1, std::memory_order_relaxed);
   grpc_call_stack* callstk = SUBCHANNEL_CALL_TO_CALL_STACK(this);
   const grpc_call_element_args call_args = {
       callstk,              // call_stack
@@ -218,6 +227,7 @@ void SubchannelCall::Destroy(void* arg, grpc_error_handle /*error*/) {
   grpc_closure* after_call_stack_destroy = self->after_call_stack_destroy_;
   RefCountedPtr<ConnectedSubchannel> connected_subchannel =
       std::move(self->connected_subchannel_);
+  connected_subchannel->active_calls_.fetch_sub(1, std::memory_order_relaxed);
   // Destroy the subchannel call.
   self->~SubchannelCall();
   // Destroy the call stack. This should be after destroying the subchannel
@@ -300,8 +310,9 @@ class Subchannel::ConnectedSubchannelStateWatcher
     : public AsyncConnectivityStateWatcherInterface {
  public:
   // Must be instantiated while holding c->mu.
-  explicit ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c)
-      : subchannel_(std::move(c)) {}
+  ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c,
+                                  uint64_t connection_id)
+      : subchannel_(std::move(c)), connection_id_(connection_id) {}
 
   ~ConnectedSubchannelStateWatcher() override {
     subchannel_.reset(DEBUG_LOCATION, "state_watcher");
@@ -313,33 +324,14 @@ class Subchannel::ConnectedSubchannelStateWatcher
     Subchannel* c = subchannel_.get();
     {
       MutexLock lock(&c->mu_);
-      // If we're either shutting down or have already seen this connection
-      // failure (i.e., c->connected_subchannel_ is null), do nothing.
-      //
       // The transport reports TRANSIENT_FAILURE upon GOAWAY but SHUTDOWN
       // upon connection close.  So if the server gracefully shuts down,
       // we will see TRANSIENT_FAILURE followed by SHUTDOWN, but if not, we
       // will see only SHUTDOWN.  Either way, we react to the first one we
       // see, ignoring anything that happens after that.
-      if (c->connected_subchannel_ == nullptr) return;
       if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
           new_state == GRPC_CHANNEL_SHUTDOWN) {
-        if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
-          gpr_log(GPR_INFO,
-                  "subchannel %p %s: Connected subchannel %p reports %s: %s", c,
-                  c->key_.ToString().c_str(), c->connected_subchannel_.get(),
-                  ConnectivityStateName(new_state), status.ToString().c_str());
-        }
-        c->connected_subchannel_.reset();
-        if (c->channelz_node() != nullptr) {
-          c->channelz_node()->SetChildSocket(nullptr);
-        }
-        // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
-        // pass along the status from the transport, since it may have
-        // keepalive info attached to it that the channel needs.
-        // TODO(roth): Consider whether there's a cleaner way to do this.
-        c->SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
-        c->backoff_.Reset();
+        c->OnConnectionFailedLocked(connection_id_, new_state, status);
       }
     }
     // Drain any connectivity state notifications after releasing the mutex.
@@ -347,6 +339,7 @@ class Subchannel::ConnectedSubchannelStateWatcher
   }
 
   WeakRefCountedPtr<Subchannel> subchannel_;
+  const uint64_t connection_id_;
 };
 
 //
@@ -456,8 +449,13 @@ class Subchannel::HealthWatcherMap::HealthWatcher
                                  const absl::Status& status) override {
     {
       MutexLock lock(&subchannel_->mu_);
+      // This health check stream is shared by every watcher for this
+      // service name, possibly from many channels, and a notification
+      // makes each of their LB policies update.  So only pass on changes:
+      // servers may repeat the same status on the stream.
       if (new_state != GRPC_CHANNEL_SHUTDOWN &&
-          health_check_client_ != nullptr) {
+          health_check_client_ != nullptr &&
+          (new_state != state_ || status != status_)) {
         state_ = new_state;
         status_ = status;
         watcher_list_.NotifyLocked(new_state, status);
@@ -579,6 +577,14 @@ BackOff::Options ParseArgsForBackoffValues(const ChannelArgs& args,
                args.GetDurationFromIntMillis(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS)
                    .value_or(Duration::Seconds(
                        GRPC_SUBCHANNEL_RECONNECT_MAX_BACKOFF_SECONDS)));
+  if (args.GetBool(GRPC_ARG_DECORRELATED_RECONNECT_JITTER).value_or(false)) {
+    return BackOff::Options()
+        .set_initial_backoff(initial_backoff)
+        .set_multiplier(GRPC_SUBCHANNEL_DECORRELATED_JITTER_MULTIPLIER)
+        .set_jitter(0.0)
+        .set_max_backoff(max_backoff)
+        .set_decorrelated_jitter(true);
+  }
   return BackOff::Options()
       .set_initial_backoff(initial_backoff)
       .set_multiplier(GRPC_SUBCHANNEL_RECONNECT_BACKOFF_MULTIPLIER)
@@ -600,6 +606,21 @@ Subchannel::Subchannel(SubchannelKey key,
       connector_(std::move(connector)),
       watcher_list_(this),
       backoff_(ParseArgsForBackoffValues(args_, &min_connect_timeout_)),
+      max_concurrent_connects_per_address_(std::max(
+          0, args_.GetInt(GRPC_ARG_MAX_CONCURRENT_CONNECTS_PER_ADDRESS)
+                 .value_or(0))),
+      max_connections_(std::max(
+          1, args_.GetInt(GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS).value_or(1))),
+      warm_standby_connections_(std::max(
+          0, args_.GetInt(GRPC_ARG_SUBCHANNEL_WARM_STANDBY_CONNECTIONS)
+                 .value_or(0))),
+      extra_connection_idle_timeout_(std::max(
+          Duration::Milliseconds(100),
+          args_
+              .GetDurationFromIntMillis(
+                  GRPC_ARG_SUBCHANNEL_EXTRA_CONNECTION_IDLE_TIMEOUT_MS)
+              .value_or(Duration::Seconds(
+                  GRPC_SUBCHANNEL_EXTRA_CONNECTION_IDLE_TIMEOUT_SECONDS)))),
       event_engine_(args_.GetObjectRef<EventEngine>()) {
   // A grpc_init is added here to ensure that grpc_shutdown does not happen
   // until the subchannel is destroyed. Subchannels can persist longer than
@@ -611,14 +632,21 @@ Subchannel::Subchannel(SubchannelKey key,
   // here and a grpc_shutdown in the subchannel destructor.
   InitInternally();
   global_stats().IncrementClientSubchannelsCreated();
+  max_connections_ = std::max(max_connections_, 1 + warm_standby_connections_);
   GRPC_CLOSURE_INIT(&on_connecting_finished_, OnConnectingFinished, this,
                     grpc_schedule_on_exec_ctx);
+  GRPC_CLOSURE_INIT(&on_extra_connecting_finished_, OnExtraConnectingFinished,
+                    this, grpc_schedule_on_exec_ctx);
   // Check proxy mapper to determine address to connect to and channel
   // args to use.
   address_for_connect_ = CoreConfiguration::Get()
                              .proxy_mapper_registry()
                              .MapAddress(key_.address(), &args_)
                              .value_or(key_.address());
+  if (max_concurrent_connects_per_address_ > 0) {
+    connect_address_ = grpc_sockaddr_to_string(&address_for_connect_, false)
+                           .value_or("<unknown address type>");
+  }
   // Initialize channelz.
   const bool channelz_enabled = args_.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
                                     .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT);
@@ -776,8 +804,21 @@ void Subchannel::Orphan() {
     MutexLock lock(&mu_);
     GPR_ASSERT(!shutdown_);
     shutdown_ = true;
+    if (waiting_connection_attempt_.has_value()) {
+      // If the attempt's turn has already come, its callback finishes it.
+      if (ConnectionAttemptScheduler::Get()->CancelAttempt(
+              connect_address_, *waiting_connection_attempt_)) {
+        waiting_connection_attempt_.reset();
+      }
+    }
     connector_.reset();
     connected_subchannel_.reset();
+    extra_connector_.reset();
+    extra_connections_.clear();
+    if (idle_check_timer_handle_.has_value()) {
+      event_engine_->Cancel(*idle_check_timer_handle_);
+      idle_check_timer_handle_.reset();
+    }
     health_watcher_map_.ShutdownLocked();
   }
   // Drain any connectivity state notifications after releasing the mutex.
@@ -852,16 +893,82 @@ void Subchannel::OnRetryTimerLocked() {
 
 void Subchannel::StartConnectingLocked() {
   // Set next attempt time.
-  const Timestamp min_deadline = min_connect_timeout_ + Timestamp::Now();
   next_attempt_time_ = backoff_.NextAttemptTime();
   // Report CONNECTING.
   SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
-  // Start connection attempt.
+  // Wait for our turn if other attempts to the address are in progress.
+  if (max_concurrent_connects_per_address_ > 0) {
+    waiting_connection_attempt_ =
+        ConnectionAttemptScheduler::Get()->RequestAttempt(
+            connect_address_, max_concurrent_connects_per_address_,
+            /*urgent=*/false,
+            [self = WeakRef(DEBUG_LOCATION, "ConnectionAttemptTurn")]() mutable {
+              {
+                ApplicationCallbackExecCtx callback_exec_ctx;
+                ExecCtx exec_ctx;
+                {
+                  MutexLock lock(&self->mu_);
+                  self->OnConnectionAttemptTurnLocked();
+                }
+                self->work_serializer_.DrainQueue();
+                // See the comment in the retry timer callback.
+                self.reset();
+              }
+            });
+    if (waiting_connection_attempt_.has_value()) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+        gpr_log(GPR_INFO,
+                "subchannel %p %s: waiting for other connection attempts to "
+                "%s",
+                this, key_.ToString().c_str(), connect_address_.c_str());
+      }
+      connection_attempt_requested_time_ = Timestamp::Now();
+      return;
+    }
+    holds_connection_attempt_ = true;
+  }
+  ConnectLocked();
+}
+
+void Subchannel::OnConnectionAttemptTurnLocked() {
+  waiting_connection_attempt_.reset();
+  holds_connection_attempt_ = true;
+  if (shutdown_) {
+    FinishConnectionAttemptLocked();
+    return;
+  }
+  // Count backoff from when this attempt actually starts.
+  next_attempt_time_ += Timestamp::Now() - connection_attempt_requested_time_;
+  ConnectLocked();
+}
+
+void Subchannel::FinishConnectionAttemptLocked() {
+  if (!holds_connection_attempt_) return;
+  holds_connection_attempt_ = false;
+  ConnectionAttemptScheduler::Get()->FinishAttempt(connect_address_);
+}
+
+void Subchannel::PrioritizeConnectionAttempt() {
+  MutexLock lock(&mu_);
+  if (waiting_connection_attempt_.has_value()) {
+    ConnectionAttemptScheduler::Get()->MakeUrgent(
+        connect_address_, *waiting_connection_attempt_);
+  }
+}
+
+void Subchannel::ConnectLocked() {
   SubchannelConnector::Args args;
   args.address = &address_for_connect_;
   args.interested_parties = pollset_set_;
-  args.deadline = std::max(next_attempt_time_, min_deadline);
+  args.deadline =
+      std::max(next_attempt_time_, Timestamp::Now() + min_connect_timeout_);
   args.channel_args = args_;
+  // Have the transport report the peer's stream limit, so that we know
+  // when to open another connection.
+  if (max_connections_ > 1) {
+    args.channel_args =
+        args.channel_args.SetObject(MakeRefCounted<TransportStreamLimit>());
+  }
   WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
   connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
 }
@@ -878,6 +985,7 @@ void Subchannel::OnConnectingFinished(void* arg, grpc_error_handle error) {
 }
 
 void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
+  FinishConnectionAttemptLocked();
   if (shutdown_) {
     connecting_result_.Reset();
     return;
@@ -917,46 +1025,299 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
 }
 
 bool Subchannel::PublishTransportLocked() {
+  RefCountedPtr<channelz::SocketNode> socket;
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel =
+      CreateConnectedSubchannelLocked(&connecting_result_, &socket);
+  if (connected_subchannel == nullptr) return false;
+  // Publish.
+  connected_subchannel_ = std::move(connected_subchannel);
+  connected_subchannel_id_ = next_connection_id_++;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+    gpr_log(GPR_INFO, "subchannel %p %s: new connected subchannel at %p", this,
+            key_.ToString().c_str(), connected_subchannel_.get());
+  }
+  if (channelz_node_ != nullptr) {
+    channelz_node_->SetChildSocket(std::move(socket));
+  }
+  // Start watching connected subchannel.
+  connected_subchannel_->StartWatch(
+      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
+                        WeakRef(DEBUG_LOCATION, "state_watcher"),
+                        connected_subchannel_id_));
+  // Report initial state.
+  SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
+  MaybeStartStandbyConnectionLocked();
+  return true;
+}
+
+RefCountedPtr<ConnectedSubchannel> Subchannel::CreateConnectedSubchannelLocked(
+    SubchannelConnector::Result* result,
+    RefCountedPtr<channelz::SocketNode>* socket) {
   // Construct channel stack.
   ChannelStackBuilderImpl builder("subchannel", GRPC_CLIENT_SUBCHANNEL,
-                                  connecting_result_.channel_args);
-  builder.SetTransport(connecting_result_.transport);
+                                  result->channel_args);
+  builder.SetTransport(result->transport);
   if (!CoreConfiguration::Get().channel_init().CreateStack(&builder)) {
-    return false;
+    return nullptr;
   }
   absl::StatusOr<RefCountedPtr<grpc_channel_stack>> stk = builder.Build();
   if (!stk.ok()) {
     auto error = absl_status_to_grpc_error(stk.status());
-    connecting_result_.Reset();
+    result->Reset();
     gpr_log(GPR_ERROR,
             "subchannel %p %s: error initializing subchannel stack: %s", this,
             key_.ToString().c_str(), StatusToString(error).c_str());
-    return false;
+    return nullptr;
   }
   // Release the ownership since it is now owned by the connected filter in the
   // channel stack (published).
-  connecting_result_.transport = nullptr;
-  RefCountedPtr<channelz::SocketNode> socket =
-      std::move(connecting_result_.socket_node);
-  connecting_result_.Reset();
-  if (shutdown_) return false;
-  // Publish.
-  connected_subchannel_.reset(
-      new ConnectedSubchannel(stk->release(), args_, channelz_node_));
+  result->transport = nullptr;
+  *socket = std::move(result->socket_node);
+  auto stream_limit = result->channel_args.GetObjectRef<TransportStreamLimit>();
+  result->Reset();
+  if (shutdown_) return nullptr;
+  return MakeRefCounted<ConnectedSubchannel>(
+      stk->release(), args_, channelz_node_, std::move(stream_limit));
+}
+
+void Subchannel::OnConnectionFailedLocked(uint64_t connection_id,
+                                          grpc_connectivity_state state,
+                                          const absl::Status& status) {
+  if (connection_id != connected_subchannel_id_) {
+    // An extra connection, which we simply forget.  If it is not in the
+    // list, it was already closed for being idle or along with the primary
+    // connection.
+    auto it = std::find_if(extra_connections_.begin(), extra_connections_.end(),
+                           [connection_id](const ExtraConnection& extra) {
+                             return extra.id == connection_id;
+                           });
+    if (it != extra_connections_.end()) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+        gpr_log(GPR_INFO,
+                "subchannel %p %s: extra connection %p reports %s: %s", this,
+                key_.ToString().c_str(), it->connected_subchannel.get(),
+                ConnectivityStateName(state), status.ToString().c_str());
+      }
+      extra_connections_.erase(it);
+      MaybeStartStandbyConnectionLocked();
+    }
+    return;
+  }
+  // If we're either shutting down or have already seen this connection
+  // failure (i.e., connected_subchannel_ is null), do nothing.
+  if (connected_subchannel_ == nullptr) return;
   if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
-    gpr_log(GPR_INFO, "subchannel %p %s: new connected subchannel at %p", this,
-            key_.ToString().c_str(), connected_subchannel_.get());
+    gpr_log(GPR_INFO,
+            "subchannel %p %s: Connected subchannel %p reports %s: %s", this,
+            key_.ToString().c_str(), connected_subchannel_.get(),
+            ConnectivityStateName(state), status.ToString().c_str());
   }
-  if (channelz_node_ != nullptr) {
-    channelz_node_->SetChildSocket(std::move(socket));
+  connected_subchannel_.reset();
+  connected_subchannel_id_ = 0;
+  if (channelz_node() != nullptr) {
+    channelz_node()->SetChildSocket(nullptr);
   }
-  // Start watching connected subchannel.
-  connected_subchannel_->StartWatch(
+  // If we keep warm standbys, promote one to take the place of this
+  // connection while it drains, so that new calls need not wait for a
+  // connection to be established.
+  if (warm_standby_connections_ > 0 && !extra_connections_.empty()) {
+    connected_subchannel_ =
+        std::move(extra_connections_.front().connected_subchannel);
+    connected_subchannel_id_ = extra_connections_.front().id;
+    extra_connections_.erase(extra_connections_.begin());
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+      gpr_log(GPR_INFO,
+              "subchannel %p %s: promoted standby connection %p to primary",
+              this, key_.ToString().c_str(), connected_subchannel_.get());
+    }
+    // Health checks and data producers are bound to the old connection;
+    // passing through IDLE has them start over on the new one.
+    SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
+    SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::OkStatus());
+    MaybeStartStandbyConnectionLocked();
+    return;
+  }
+  // Health checks and data producers are bound to this connection, so
+  // rather than hand them another one, start over.  Calls already using
+  // the extra connections keep them alive until they finish.
+  extra_connections_.clear();
+  // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
+  // pass along the status from the transport, since it may have
+  // keepalive info attached to it that the channel needs.
+  // TODO(roth): Consider whether there's a cleaner way to do this.
+  SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
+  backoff_.Reset();
+  // With warm standbys, reconnect now rather than on the next call.
+  if (warm_standby_connections_ > 0) StartConnectingLocked();
+}
+
+RefCountedPtr<ConnectedSubchannel> Subchannel::PickConnectedSubchannel() {
+  MutexLock lock(&mu_);
+  if (max_connections_ <= 1 || connected_subchannel_ == nullptr) {
+    return connected_subchannel_;
+  }
+  // Pick the connection with the most streams to spare.
+  auto spare_streams = [](const ConnectedSubchannel& connected_subchannel) {
+    return static_cast<int64_t>(connected_subchannel.stream_limit()) -
+           static_cast<int64_t>(connected_subchannel.active_calls());
+  };
+  ConnectedSubchannel* best = connected_subchannel_.get();
+  ExtraConnection* best_extra = nullptr;
+  int64_t best_spare_streams = spare_streams(*best);
+  for (ExtraConnection& extra : extra_connections_) {
+    const int64_t spare = spare_streams(*extra.connected_subchannel);
+    if (spare > best_spare_streams) {
+      best = extra.connected_subchannel.get();
+      best_extra = &extra;
+      best_spare_streams = spare;
+    }
+  }
+  if (best_extra != nullptr) best_extra->last_used = Timestamp::Now();
+  // If this call would have to wait for a stream, open another connection
+  // for the calls that come after it.
+  if (best_spare_streams <= 0) {
+    MaybeStartExtraConnectionLocked();
+  } else {
+    // Retry any standby whose last attempt failed.
+    MaybeStartStandbyConnectionLocked();
+  }
+  return best->Ref();
+}
+
+void Subchannel::MaybeStartExtraConnectionLocked() {
+  if (shutdown_ || extra_connecting_ ||
+      1 + extra_connections_.size() >= max_connections_ ||
+      Timestamp::Now() < next_extra_attempt_time_) {
+    return;
+  }
+  if (extra_connector_ == nullptr) {
+    extra_connector_ = connector_->CreateSibling();
+    if (extra_connector_ == nullptr) {
+      // This transport cannot make more than one connection at a time.
+      max_connections_ = 1;
+      return;
+    }
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+    gpr_log(GPR_INFO, "subchannel %p %s: starting extra connection (%" PRIuPTR
+            " open, %" PRIuPTR " standby wanted)",
+            this, key_.ToString().c_str(), extra_connections_.size(),
+            warm_standby_connections_);
+  }
+  extra_connecting_ = true;
+  SubchannelConnector::Args args;
+  args.address = &address_for_connect_;
+  args.interested_parties = pollset_set_;
+  args.deadline = Timestamp::Now() + min_connect_timeout_;
+  args.channel_args = args_.SetObject(MakeRefCounted<TransportStreamLimit>());
+  WeakRef(DEBUG_LOCATION, "ExtraConnect").release();  // Ref held by callback.
+  extra_connector_->Connect(args, &extra_connecting_result_,
+                            &on_extra_connecting_finished_);
+}
+
+void Subchannel::MaybeStartStandbyConnectionLocked() {
+  if (state_ == GRPC_CHANNEL_READY &&
+      extra_connections_.size() < warm_standby_connections_) {
+    MaybeStartExtraConnectionLocked();
+  }
+}
+
+void Subchannel::OnExtraConnectingFinished(void* arg,
+                                           grpc_error_handle error) {
+  WeakRefCountedPtr<Subchannel> c(static_cast<Subchannel*>(arg));
+  {
+    MutexLock lock(&c->mu_);
+    c->OnExtraConnectingFinishedLocked(error);
+  }
+  // Drain any connectivity state notifications after releasing the mutex.
+  c->work_serializer_.DrainQueue();
+  c.reset(DEBUG_LOCATION, "ExtraConnect");
+}
+
+void Subchannel::OnExtraConnectingFinishedLocked(grpc_error_handle error) {
+  extra_connecting_ = false;
+  // Extra connections are only useful alongside a primary one; if that
+  // went away in the meantime, let the usual reconnection logic handle it.
+  if (shutdown_ || state_ != GRPC_CHANNEL_READY) {
+    extra_connecting_result_.Reset();
+    return;
+  }
+  RefCountedPtr<channelz::SocketNode> socket;
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel;
+  if (extra_connecting_result_.transport != nullptr) {
+    connected_subchannel =
+        CreateConnectedSubchannelLocked(&extra_connecting_result_, &socket);
+  }
+  if (connected_subchannel == nullptr) {
+    gpr_log(GPR_INFO, "subchannel %p %s: extra connection failed (%s)", this,
+            key_.ToString().c_str(), StatusToString(error).c_str());
+    extra_connecting_result_.Reset();
+    next_extra_attempt_time_ =
+        Timestamp::Now() +
+        Duration::Seconds(GRPC_SUBCHANNEL_EXTRA_CONNECTION_RETRY_SECONDS);
+    return;
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+    gpr_log(GPR_INFO, "subchannel %p %s: new extra connection at %p", this,
+            key_.ToString().c_str(), connected_subchannel.get());
+  }
+  const uint64_t id = next_connection_id_++;
+  connected_subchannel->StartWatch(
       pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
-                        WeakRef(DEBUG_LOCATION, "state_watcher")));
-  // Report initial state.
-  SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
-  return true;
+                        WeakRef(DEBUG_LOCATION, "state_watcher"), id));
+  extra_connections_.push_back(
+      {id, std::move(connected_subchannel), Timestamp::Now()});
+  if (!idle_check_timer_handle_.has_value() &&
+      extra_connections_.size() > warm_standby_connections_) {
+    ScheduleIdleCheckLocked();
+  }
+  MaybeStartStandbyConnectionLocked();
+}
+
+void Subchannel::ScheduleIdleCheckLocked() {
+  idle_check_timer_handle_ = event_engine_->RunAfter(
+      extra_connection_idle_timeout_,
+      [self = WeakRef(DEBUG_LOCATION, "IdleCheck")]() mutable {
+        {
+          ApplicationCallbackExecCtx callback_exec_ctx;
+          ExecCtx exec_ctx;
+          {
+            MutexLock lock(&self->mu_);
+            self->OnIdleCheckLocked();
+          }
+          // See the comment in the retry timer callback.
+          self.reset();
+        }
+      });
+}
+
+void Subchannel::OnIdleCheckLocked() {
+  idle_check_timer_handle_.reset();
+  if (shutdown_) return;
+  // Close extra connections that have had no calls for the whole timeout,
+  // keeping the warm standbys.
+  const Timestamp now = Timestamp::Now();
+  size_t closable = extra_connections_.size() > warm_standby_connections_
+                        ? extra_connections_.size() - warm_standby_connections_
+                        : 0;
+  extra_connections_.erase(
+      std::remove_if(extra_connections_.begin(), extra_connections_.end(),
+                     [&](ExtraConnection& extra) {
+                       if (extra.connected_subchannel->active_calls() > 0) {
+                         extra.last_used = now;
+                         return false;
+                       }
+                       if (closable == 0 || now - extra.last_used <
+                                                extra_connection_idle_timeout_) {
+                         return false;
+                       }
+                       --closable;
+                       return true;
+                     }),
+      extra_connections_.end());
+  if (extra_connections_.size() > warm_standby_connections_) {
+    ScheduleIdleCheckLocked();
+  }
 }
 
 }  // namespace grpc_core
@@ -20,11 +20,14 @@
 #include <grpc/support/port_platform.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
@@ -60,6 +63,7 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/lib/transport/stream_limit.h"
 #include "src/core/lib/transport/transport.h"
 
 namespace grpc_core {
@@ -70,7 +74,8 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
  public:
   ConnectedSubchannel(
       grpc_channel_stack* channel_stack, const ChannelArgs& args,
-      RefCountedPtr<channelz::SubchannelNode> channelz_subchannel);
+      RefCountedPtr<channelz::SubchannelNode> channelz_subchannel,
+      RefCountedPtr<TransportStreamLimit> stream_limit = nullptr);
   ~ConnectedSubchannel() override;
 
   void StartWatch(grpc_pollset_set* interested_parties,
@@ -86,12 +91,26 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
 
   size_t GetInitialCallSizeEstimate() const;
 
+  // Number of SubchannelCalls currently using this connection.
+  size_t active_calls() const {
+    return active_calls_.load(std::memory_order_relaxed);
+  }
+  // The most concurrent streams the peer allows on this connection, if the
+  // transport reports it.
+  uint32_t stream_limit() const {
+    return stream_limit_ == nullptr ? UINT32_MAX : stream_limit_->peer_limit();
+  }
+
  private:
+  friend class SubchannelCall;
+
   grpc_channel_stack* channel_stack_;
   ChannelArgs args_;
   // ref counted pointer to the channelz node in this connected subchannel's
   // owning subchannel.
   RefCountedPtr<channelz::SubchannelNode> channelz_subchannel_;
+  RefCountedPtr<TransportStreamLimit> stream_limit_;
+  std::atomic<size_t> active_calls_{0};
 };
 
 // Implements the interface of RefCounted<>.
@@ -237,9 +256,21 @@ class Subchannel : public DualRefCounted<Subchannel> {
     return connected_subchannel_;
   }
 
+  // Returns the connection a new call should use, or null if not connected.
+  // When the subchannel may open more than one connection, this is the one
+  // with the most streams to spare, and another connection is started if
+  // none has any.
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannel()
+      ABSL_LOCKS_EXCLUDED(mu_);
+
   // Attempt to connect to the backend.  Has no effect if already connected.
   void RequestConnection() ABSL_LOCKS_EXCLUDED(mu_);
 
+  // If a connection attempt is waiting for others to the same address
+  // (see GRPC_ARG_MAX_CONCURRENT_CONNECTS_PER_ADDRESS), moves it ahead of
+  // attempts that are not urgent.  For when calls are waiting on it.
+  void PrioritizeConnectionAttempt() ABSL_LOCKS_EXCLUDED(mu_);
+
   // Resets the connection backoff of the subchannel.
   void ResetBackoff() ABSL_LOCKS_EXCLUDED(mu_);
 
@@ -332,6 +363,15 @@ class Subchannel : public DualRefCounted<Subchannel> {
 
   class ConnectedSubchannelStateWatcher;
 
+  // A connection in addition to connected_subchannel_, opened because every
+  // existing connection was using all the streams its peer allowed.
+  struct ExtraConnection {
+    uint64_t id;
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel;
+    // When a call last used or was picked for this connection.
+    Timestamp last_used;
+  };
+
   // Sets the subchannel's connectivity state to \a state.
   void SetConnectivityStateLocked(grpc_connectivity_state state,
                                   const absl::Status& status)
@@ -341,11 +381,38 @@ class Subchannel : public DualRefCounted<Subchannel> {
   void OnRetryTimer() ABSL_LOCKS_EXCLUDED(mu_);
   void OnRetryTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   void StartConnectingLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Called when ConnectionAttemptScheduler lets a waiting attempt start.
+  void OnConnectionAttemptTurnLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void FinishConnectionAttemptLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void ConnectLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   static void OnConnectingFinished(void* arg, grpc_error_handle error)
       ABSL_LOCKS_EXCLUDED(mu_);
   void OnConnectingFinishedLocked(grpc_error_handle error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   bool PublishTransportLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Builds a ConnectedSubchannel for the transport in *result, consuming
+  // it.  Returns null on failure.
+  RefCountedPtr<ConnectedSubchannel> CreateConnectedSubchannelLocked(
+      SubchannelConnector::Result* result,
+      RefCountedPtr<channelz::SocketNode>* socket)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Handles the loss of the connection with the given ID.
+  void OnConnectionFailedLocked(uint64_t connection_id,
+                                grpc_connectivity_state state,
+                                const absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Methods for extra connections.
+  void MaybeStartExtraConnectionLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Starts an extra connection if there are fewer than
+  // warm_standby_connections_.
+  void MaybeStartStandbyConnectionLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  static void OnExtraConnectingFinished(void* arg, grpc_error_handle error)
+      ABSL_LOCKS_EXCLUDED(mu_);
+  void OnExtraConnectingFinishedLocked(grpc_error_handle error)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void ScheduleIdleCheckLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnIdleCheckLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   // The subchannel pool this subchannel is in.
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_;
@@ -391,6 +458,8 @@ class Subchannel : public DualRefCounted<Subchannel> {
 
   // Active connection, or null.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_ ABSL_GUARDED_BY(mu_);
+  uint64_t connected_subchannel_id_ ABSL_GUARDED_BY(mu_) = 0;
+  uint64_t next_connection_id_ ABSL_GUARDED_BY(mu_) = 1;
 
   // Backoff state.
   BackOff backoff_ ABSL_GUARDED_BY(mu_);
@@ -398,6 +467,30 @@ class Subchannel : public DualRefCounted<Subchannel> {
   grpc_event_engine::experimental::EventEngine::TaskHandle retry_timer_handle_
       ABSL_GUARDED_BY(mu_);
 
+  // Limit on connection attempts to address_for_connect_, which is
+  // connect_address_ in string form; 0 if there is none.
+  const size_t max_concurrent_connects_per_address_;
+  std::string connect_address_;
+  // The ConnectionAttemptScheduler ID of the attempt waiting its turn.
+  absl::optional<uint64_t> waiting_connection_attempt_ ABSL_GUARDED_BY(mu_);
+  Timestamp connection_attempt_requested_time_ ABSL_GUARDED_BY(mu_);
+  // Whether an attempt counted by the ConnectionAttemptScheduler is ours.
+  bool holds_connection_attempt_ ABSL_GUARDED_BY(mu_) = false;
+
+  // Extra connections, used only when max_connections_ is more than 1.
+  size_t max_connections_ ABSL_GUARDED_BY(mu_);
+  // How many extra connections to keep open even when idle.
+  size_t warm_standby_connections_ ABSL_GUARDED_BY(mu_);
+  Duration extra_connection_idle_timeout_;
+  OrphanablePtr<SubchannelConnector> extra_connector_ ABSL_GUARDED_BY(mu_);
+  SubchannelConnector::Result extra_connecting_result_;
+  grpc_closure on_extra_connecting_finished_;
+  bool extra_connecting_ ABSL_GUARDED_BY(mu_) = false;
+  Timestamp next_extra_attempt_time_ ABSL_GUARDED_BY(mu_);
+  std::vector<ExtraConnection> extra_connections_ ABSL_GUARDED_BY(mu_);
+  absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      idle_check_timer_handle_ ABSL_GUARDED_BY(mu_);
+
   // Keepalive time period (-1 for unset)
   int keepalive_time_ ABSL_GUARDED_BY(mu_) = -1;
 
@@ -18,6 +18,8 @@
 
 #include "src/core/ext/filters/deadline/deadline_filter.h"
 
+#include <string.h>
+
 #include <functional>
 #include <memory>
 #include <new>
@@ -33,6 +35,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/iomgr/error.h"
@@ -44,6 +47,7 @@
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/lib/transport/transport_impl.h"
 
 namespace grpc_core {
 
@@ -55,7 +59,11 @@ class TimerState {
       : deadline_state_(deadline_state) {
     GRPC_CALL_STACK_REF(deadline_state->call_stack, "DeadlineTimerState");
     GRPC_CLOSURE_INIT(&closure_, TimerCallback, this, nullptr);
-    grpc_timer_init(&timer_, deadline, &closure_);
+    // Most deadlines never fire, and those that do may fire a little late.
+    grpc_timer_init(&timer_,
+                    CoarseDeadline(deadline,
+                                   TimerSlack(deadline - Timestamp::Now())),
+                    &closure_);
   }
 
   void Cancel() { grpc_timer_cancel(&timer_); }
@@ -391,6 +399,23 @@ bool grpc_deadline_checking_enabled(
 }
 
 namespace grpc_core {
+namespace {
+// Whether the transport at the bottom of the stack enforces call deadlines
+// itself, making \a filter redundant.
+bool TransportEnforcesDeadlines(ChannelStackBuilder* builder,
+                                const grpc_channel_filter* filter) {
+  if (!IsChttp2TransportDeadlinesEnabled()) return false;
+  // Promise based server calls learn their deadline from the server filter.
+  if (filter == &grpc_server_deadline_filter &&
+      IsPromiseBasedServerCallEnabled()) {
+    return false;
+  }
+  grpc_transport* transport = builder->transport();
+  return transport != nullptr &&
+         strcmp(transport->vtable->name, "chttp2") == 0;
+}
+}  // namespace
+
 void RegisterDeadlineFilter(CoreConfiguration::Builder* builder) {
   auto register_filter = [builder](grpc_channel_stack_type type,
                                    const grpc_channel_filter* filter) {
@@ -398,7 +423,8 @@ void RegisterDeadlineFilter(CoreConfiguration::Builder* builder) {
         type, GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
         [filter](ChannelStackBuilder* builder) {
           auto args = builder->channel_args();
-          if (grpc_deadline_checking_enabled(args)) {
+          if (grpc_deadline_checking_enabled(args) &&
+              !TransportEnforcesDeadlines(builder, filter)) {
             builder->PrependFilter(filter);
           }
           return true;
@@ -27,6 +27,7 @@
 #include "absl/random/random.h"
 #include "absl/status/statusor.h"
 
+#include "src/core/ext/filters/fault_injection/fault_injection_service_config_parser.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
@@ -55,7 +56,12 @@ class FaultInjectionFilter : public ChannelFilter {
   explicit FaultInjectionFilter(ChannelFilter::Args filter_args);
 
   class InjectionDecision;
+  // Returns the policy for this filter instance on the current call, or
+  // null if that policy can never inject a fault.
+  const FaultInjectionMethodParsedConfig::FaultInjectionPolicy*
+  GetActivePolicy() const;
   InjectionDecision MakeInjectionDecision(
+      const FaultInjectionMethodParsedConfig::FaultInjectionPolicy* fi_policy,
       const ClientMetadataHandle& initial_metadata);
 
   // The relative index of instances of the same filter.
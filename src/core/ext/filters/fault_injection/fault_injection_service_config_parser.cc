@@ -78,6 +78,14 @@ void FaultInjectionMethodParsedConfig::FaultInjectionPolicy::JsonPostLoad(
     ValidationErrors::ScopedField field(errors, ".delayPercentageDenominator");
     errors->AddError("must be one of 100, 10000, or 1000000");
   }
+  // Headers can only lower the percentages, and only supply an abort code or
+  // a delay when the policy has none of its own.
+  const bool may_abort =
+      abort_percentage_numerator > 0 &&
+      (abort_code != GRPC_STATUS_OK || !abort_code_header.empty());
+  const bool may_delay = delay_percentage_numerator > 0 &&
+                         (delay != Duration::Zero() || !delay_header.empty());
+  may_inject_faults = may_abort || may_delay;
 }
 
 const JsonLoaderInterface* FaultInjectionMethodParsedConfig::JsonLoader(
@@ -66,6 +66,11 @@ class FaultInjectionMethodParsedConfig
     // By default, the max allowed active faults are unlimited.
     uint32_t max_faults = std::numeric_limits<uint32_t>::max();
 
+    // False if no call can ever be delayed or aborted by this policy, in
+    // which case the filter passes calls through untouched.  Computed when
+    // the policy is parsed, whenever the route configuration changes.
+    bool may_inject_faults = false;
+
     static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
     void JsonPostLoad(const Json& json, const JsonArgs&,
                       ValidationErrors* errors);
@@ -98,6 +103,10 @@ class FaultInjectionServiceConfigParser final
   std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override;
+  // Returns the channel arg that enables parsing.
+  std::vector<absl::string_view> ChannelArgsUsed() const override {
+    return {GRPC_ARG_PARSE_FAULT_INJECTION_METHOD_CONFIG};
+  }
   // Returns the parser index for FaultInjectionServiceConfigParser.
   static size_t ParserIndex();
   // Registers FaultInjectionServiceConfigParser to ServiceConfigParser.
@@ -109,11 +109,7 @@ Slice UserAgentFromArgs(const ChannelArgs& args, const char* transport_name) {
 ArenaPromise<ServerMetadataHandle> HttpClientFilter::MakeCallPromise(
     CallArgs call_args, NextPromiseFactory next_promise_factory) {
   auto& md = call_args.client_initial_metadata;
-  if (test_only_use_put_requests_) {
-    md->Set(HttpMethodMetadata(), HttpMethodMetadata::kPut);
-  } else {
-    md->Set(HttpMethodMetadata(), HttpMethodMetadata::kPost);
-  }
+  md->Set(HttpMethodMetadata(), method_);
   md->Set(HttpSchemeMetadata(), scheme_);
   md->Set(TeMetadata(), TeMetadata::kTrailers);
   md->Set(ContentTypeMetadata(), ContentTypeMetadata::kApplicationGrpc);
@@ -145,9 +141,10 @@ ArenaPromise<ServerMetadataHandle> HttpClientFilter::MakeCallPromise(
 HttpClientFilter::HttpClientFilter(HttpSchemeMetadata::ValueType scheme,
                                    Slice user_agent,
                                    bool test_only_use_put_requests)
-    : scheme_(scheme),
-      user_agent_(std::move(user_agent)),
-      test_only_use_put_requests_(test_only_use_put_requests) {}
+    : method_(test_only_use_put_requests ? HttpMethodMetadata::kPut
+                                         : HttpMethodMetadata::kPost),
+      scheme_(scheme),
+      user_agent_(std::move(user_agent)) {}
 
 absl::StatusOr<HttpClientFilter> HttpClientFilter::Create(
     const ChannelArgs& args, ChannelFilter::Args) {
@@ -47,9 +47,11 @@ class HttpClientFilter : public ChannelFilter {
   HttpClientFilter(HttpSchemeMetadata::ValueType scheme, Slice user_agent,
                    bool test_only_use_put_requests);
 
+  // The headers every call on the channel is sent with, fixed when the
+  // channel is created.
+  HttpMethodMetadata::ValueType method_;
   HttpSchemeMetadata::ValueType scheme_;
   Slice user_agent_;
-  bool test_only_use_put_requests_;
 };
 
 // A test-only channel arg to allow testing gRPC Core server behavior on PUT
@@ -18,6 +18,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <limits.h>
 #include <string.h>
 
 #include "absl/types/optional.h"
@@ -25,11 +26,13 @@
 #include <grpc/grpc.h>
 
 #include "src/core/ext/filters/http/client/http_client_filter.h"
+#include "src/core/ext/filters/http/client_authority_filter.h"
 #include "src/core/ext/filters/http/message_compress/compression_filter.h"
 #include "src/core/ext/filters/http/server/http_server_filter.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/channel/fused_call_promise.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/surface/channel_stack_type.h"
@@ -44,6 +47,7 @@ static bool is_building_http_like_transport(
 
 namespace grpc_core {
 void RegisterHttpFilters(CoreConfiguration::Builder* builder) {
+  CompressionParser::Register(builder);
   auto compression = [builder](grpc_channel_stack_type channel_type,
                                const grpc_channel_filter* filter) {
     builder->channel_init()->RegisterStage(
@@ -77,5 +81,13 @@ void RegisterHttpFilters(CoreConfiguration::Builder* builder) {
   http(GRPC_CLIENT_SUBCHANNEL, &HttpClientFilter::kFilter);
   http(GRPC_CLIENT_DIRECT_CHANNEL, &HttpClientFilter::kFilter);
   http(GRPC_SERVER_CHANNEL, &HttpServerFilter::kFilter);
+  // Registered after the client authority filter's stage, so this sees the
+  // top of the stack as it will be built.
+  for (auto type : {GRPC_CLIENT_SUBCHANNEL, GRPC_CLIENT_DIRECT_CHANNEL}) {
+    builder->channel_init()->RegisterStage(
+        type, INT_MAX,
+        MaybeUseFusedClientCallPromise<ClientAuthorityFilter, HttpClientFilter,
+                                       ClientCompressionFilter>);
+  }
 }
 }  // namespace grpc_core
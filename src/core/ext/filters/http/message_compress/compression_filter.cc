@@ -18,19 +18,24 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <initializer_list>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "absl/functional/any_invocable.h"
 #include "absl/meta/type_traits.h"
 #include "absl/status/status.h"
+#include "absl/strings/escaping.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/types/optional.h"
 
 #include <grpc/compression.h>
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/compression_types.h>
 #include <grpc/support/log.h>
@@ -43,13 +48,20 @@
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_object_loader.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/latch.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/pipe.h"
 #include "src/core/lib/promise/poll.h"
+#include "src/core/lib/promise/promise.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/service_config/service_config_call_data.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/surface/call_trace.h"
@@ -58,6 +70,107 @@
 
 namespace grpc_core {
 
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+
+// Promise that runs work on the EventEngine and resolves to its result.
+// Holds an owning waker until the work is done, which keeps the call (and so
+// its arena and channel stack) alive while the work runs.
+template <typename T>
+class Offload {
+ public:
+  explicit Offload(absl::AnyInvocable<T()> work)
+      : state_(MakeRefCounted<State>()) {
+    GetContext<EventEngine>()->Run(
+        [state = state_, work = std::move(work)]() mutable {
+          ApplicationCallbackExecCtx callback_exec_ctx;
+          ExecCtx exec_ctx;
+          state->result.emplace(work());
+          // Whatever the work captured must go while the call is still alive.
+          work = nullptr;
+          Waker waker = std::move(state->waker);
+          state->done.store(true, std::memory_order_release);
+          state.reset();
+          waker.Wakeup();
+        });
+  }
+
+  Poll<T> operator()() {
+    if (!state_->done.load(std::memory_order_acquire)) return Pending{};
+    return std::move(*state_->result);
+  }
+
+ private:
+  struct State : public RefCounted<State> {
+    Waker waker = Activity::current()->MakeOwningWaker();
+    std::atomic<bool> done{false};
+    absl::optional<T> result;
+  };
+
+  RefCountedPtr<State> state_;
+};
+
+}  // namespace
+
+//
+// CompressionParsedConfig
+//
+
+const CompressionParsedConfig* CompressionParsedConfig::GetFromCallContext(
+    const grpc_call_context_element* context,
+    size_t service_config_parser_index) {
+  if (context == nullptr) return nullptr;
+  auto* svc_cfg_call_data = static_cast<ServiceConfigCallData*>(
+      context[GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA].value);
+  if (svc_cfg_call_data == nullptr) return nullptr;
+  return static_cast<const CompressionParsedConfig*>(
+      svc_cfg_call_data->GetMethodParsedConfig(service_config_parser_index));
+}
+
+//
+// CompressionParser
+//
+
+std::unique_ptr<ServiceConfigParser::ParsedConfig>
+CompressionParser::ParsePerMethodParams(const ChannelArgs& /*args*/,
+                                        const Json& json,
+                                        ValidationErrors* errors) {
+  auto encoded = LoadJsonObjectField<std::string>(
+      json.object_value(), JsonArgs(), "zstdDictionary", errors,
+      /*required=*/false);
+  if (!encoded.has_value()) return nullptr;
+  ValidationErrors::ScopedField field(errors, ".zstdDictionary");
+  std::string data;
+  if (!absl::Base64Unescape(*encoded, &data)) {
+    errors->AddError("not valid base64");
+    return nullptr;
+  }
+  // Without zstd the dictionary could never be used: ignore it rather than
+  // rejecting configs that are shared with builds that have zstd.
+  if (!IsCompressionAlgorithmSupported(GRPC_COMPRESS_ZSTD)) return nullptr;
+  auto dictionary = CompressionDictionary::Create(data);
+  if (!dictionary.ok()) {
+    errors->AddError(dictionary.status().message());
+    return nullptr;
+  }
+  return std::make_unique<CompressionParsedConfig>(std::move(*dictionary));
+}
+
+void CompressionParser::Register(CoreConfiguration::Builder* builder) {
+  builder->service_config_parser()->RegisterParser(
+      std::make_unique<CompressionParser>());
+}
+
+size_t CompressionParser::ParserIndex() {
+  return CoreConfiguration::Get().service_config_parser().GetParserIndex(
+      parser_name());
+}
+
+//
+// CompressionFilter
+//
+
 const grpc_channel_filter ClientCompressionFilter::kFilter =
     MakePromiseBasedFilter<ClientCompressionFilter, FilterEndpoint::kClient,
                            kFilterExaminesServerInitialMetadata |
@@ -83,6 +196,8 @@ CompressionFilter::CompressionFilter(const ChannelArgs& args)
     : max_recv_size_(GetMaxRecvSizeFromChannelArgs(args)),
       message_size_service_config_parser_index_(
           MessageSizeParser::ParserIndex()),
+      compression_service_config_parser_index_(
+          CompressionParser::ParserIndex()),
       default_compression_algorithm_(
           DefaultCompressionAlgorithmFromChannelArgs(args).value_or(
               GRPC_COMPRESS_NONE)),
@@ -92,7 +207,12 @@ CompressionFilter::CompressionFilter(const ChannelArgs& args)
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION).value_or(true)),
       enable_decompression_(
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION)
-              .value_or(true)) {
+              .value_or(true)),
+      enable_stream_compression_(
+          args.GetBool(GRPC_ARG_ENABLE_STREAM_COMPRESSION).value_or(false)),
+      offload_threshold_(std::max(
+          0, args.GetInt(GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD).value_or(0))),
+      dictionaries_(args.GetObjectRef<CompressionDictionarySet>()) {
   // Make sure the default is enabled.
   if (!enabled_compression_algorithms_.IsSet(default_compression_algorithm_)) {
     const char* name;
@@ -107,8 +227,9 @@ CompressionFilter::CompressionFilter(const ChannelArgs& args)
   }
 }
 
-MessageHandle CompressionFilter::CompressMessage(
-    MessageHandle message, grpc_compression_algorithm algorithm) const {
+MessageHandle CompressionFilter::CompressMessage(MessageHandle message,
+                                                 CompressArgs args) const {
+  const grpc_compression_algorithm algorithm = args.algorithm;
   if (GRPC_TRACE_FLAG_ENABLED(grpc_compression_trace)) {
     gpr_log(GPR_ERROR, "CompressMessage: len=%" PRIdPTR " alg=%d flags=%d",
             message->payload()->Length(), algorithm, message->flags());
@@ -124,8 +245,19 @@ MessageHandle CompressionFilter::CompressMessage(
   // Try to compress the payload.
   SliceBuffer tmp;
   SliceBuffer* payload = message->payload();
-  bool did_compress = grpc_msg_compress(algorithm, payload->c_slice_buffer(),
-                                        tmp.c_slice_buffer());
+  bool did_compress;
+  if (algorithm == GRPC_COMPRESS_DEFLATE && args.stream_compressor != nullptr) {
+    did_compress = args.stream_compressor->Compress(
+        args.level, payload->c_slice_buffer(), tmp.c_slice_buffer());
+  } else if (algorithm == GRPC_COMPRESS_ZSTD && args.dictionary != nullptr) {
+    did_compress = dictionary_compressor_->Compress(
+        *args.dictionary, args.level, payload->c_slice_buffer(),
+        tmp.c_slice_buffer());
+  } else {
+    did_compress = grpc_msg_compress_with_level(algorithm, args.level,
+                                                payload->c_slice_buffer(),
+                                                tmp.c_slice_buffer());
+  }
   // If we achieved compression send it as compressed, otherwise send it as (to
   // avoid spending cycles on the receiver decompressing).
   if (did_compress) {
@@ -179,8 +311,24 @@ absl::StatusOr<MessageHandle> CompressionFilter::DecompressMessage(
   }
   // Try to decompress the payload.
   SliceBuffer decompressed_slices;
-  if (grpc_msg_decompress(args.algorithm, message->payload()->c_slice_buffer(),
-                          decompressed_slices.c_slice_buffer()) == 0) {
+  bool did_decompress;
+  if (args.algorithm == GRPC_COMPRESS_DEFLATE &&
+      args.stream_decompressor != nullptr) {
+    did_decompress = args.stream_decompressor->Decompress(
+        message->payload()->c_slice_buffer(),
+        decompressed_slices.c_slice_buffer());
+  } else if (args.algorithm == GRPC_COMPRESS_ZSTD &&
+             args.dictionary != nullptr) {
+    did_decompress = dictionary_compressor_->Decompress(
+        *args.dictionary, message->payload()->c_slice_buffer(),
+        decompressed_slices.c_slice_buffer());
+  } else {
+    did_decompress =
+        grpc_msg_decompress(args.algorithm,
+                            message->payload()->c_slice_buffer(),
+                            decompressed_slices.c_slice_buffer()) != 0;
+  }
+  if (!did_decompress) {
     return absl::InternalError(
         absl::StrCat("Unexpected error decompressing data for algorithm ",
                      CompressionAlgorithmAsString(args.algorithm)));
@@ -192,17 +340,68 @@ absl::StatusOr<MessageHandle> CompressionFilter::DecompressMessage(
   return std::move(message);
 }
 
-grpc_compression_algorithm CompressionFilter::HandleOutgoingMetadata(
-    grpc_metadata_batch& outgoing_metadata) {
+ArenaPromise<MessageHandle> CompressionFilter::CompressMessageAsync(
+    MessageHandle message, CompressArgs args) const {
+  if (offload_threshold_ == 0 ||
+      message->payload()->Length() < offload_threshold_ ||
+      args.algorithm == GRPC_COMPRESS_NONE || !enable_compression_) {
+    return Immediate(CompressMessage(std::move(message), args));
+  }
+  return Offload<MessageHandle>(
+      [this, message = std::move(message), args]() mutable {
+        return CompressMessage(std::move(message), args);
+      });
+}
+
+ArenaPromise<absl::StatusOr<MessageHandle>>
+CompressionFilter::DecompressMessageAsync(MessageHandle message,
+                                          DecompressArgs args) const {
+  if (offload_threshold_ == 0 ||
+      message->payload()->Length() < offload_threshold_ ||
+      (message->flags() & GRPC_WRITE_INTERNAL_COMPRESS) == 0 ||
+      !enable_decompression_) {
+    return Immediate(DecompressMessage(std::move(message), args));
+  }
+  return Offload<absl::StatusOr<MessageHandle>>(
+      [this, message = std::move(message), args]() mutable {
+        return DecompressMessage(std::move(message), args);
+      });
+}
+
+const CompressionDictionary* CompressionFilter::ConfiguredDictionary() const {
+  const CompressionParsedConfig* config =
+      CompressionParsedConfig::GetFromCallContext(
+          GetContext<grpc_call_context_element>(),
+          compression_service_config_parser_index_);
+  if (config == nullptr) return nullptr;
+  return config->zstd_dictionary();
+}
+
+const CompressionDictionary* CompressionFilter::PeerDictionary(
+    grpc_metadata_batch& incoming_metadata) const {
+  auto id = incoming_metadata.Take(GrpcZstdDictionaryMetadata());
+  if (!id.has_value() || dictionaries_ == nullptr) return nullptr;
+  return dictionaries_->Find(*id);
+}
+
+CompressionFilter::CompressArgs CompressionFilter::HandleOutgoingMetadata(
+    grpc_metadata_batch& outgoing_metadata,
+    const CompressionDictionary* dictionary) {
   const auto algorithm = outgoing_metadata.Take(GrpcInternalEncodingRequest())
                              .value_or(default_compression_algorithm());
+  const auto level =
+      outgoing_metadata.Take(GrpcInternalCompressionLevelRequest())
+          .value_or(GRPC_COMPRESS_LEVEL_NONE);
   // Convey supported compression algorithms.
   outgoing_metadata.Set(GrpcAcceptEncodingMetadata(),
                         enabled_compression_algorithms());
   if (algorithm != GRPC_COMPRESS_NONE) {
     outgoing_metadata.Set(GrpcEncodingMetadata(), algorithm);
   }
-  return algorithm;
+  if (dictionary != nullptr) {
+    outgoing_metadata.Set(GrpcZstdDictionaryMetadata(), dictionary->id());
+  }
+  return CompressArgs{algorithm, level, dictionary};
 }
 
 CompressionFilter::DecompressArgs CompressionFilter::HandleIncomingMetadata(
@@ -220,38 +419,65 @@ CompressionFilter::DecompressArgs CompressionFilter::HandleIncomingMetadata(
   }
   return DecompressArgs{incoming_metadata.get(GrpcEncodingMetadata())
                             .value_or(GRPC_COMPRESS_NONE),
-                        max_recv_message_length};
+                        max_recv_message_length, nullptr};
 }
 
 ArenaPromise<ServerMetadataHandle> ClientCompressionFilter::MakeCallPromise(
     CallArgs call_args, NextPromiseFactory next_promise_factory) {
-  auto compression_algorithm =
-      HandleOutgoingMetadata(*call_args.client_initial_metadata);
+  // Announce the configured dictionary, but don't compress with it until the
+  // server confirms it has it too: until then it could not read our messages.
+  const CompressionDictionary* dictionary = ConfiguredDictionary();
+  auto* compress_args = GetContext<Arena>()->New<CompressArgs>(
+      HandleOutgoingMetadata(*call_args.client_initial_metadata, dictionary));
+  compress_args->dictionary = nullptr;
+  // Offer to read the server's messages with a single deflate context.
+  DeflateStreamDecompressor* stream_decompressor = nullptr;
+  if (enable_stream_compression() && enable_decompression_ &&
+      enabled_compression_algorithms().IsSet(GRPC_COMPRESS_DEFLATE)) {
+    call_args.client_initial_metadata->Set(GrpcStreamEncodingMetadata(),
+                                           GRPC_COMPRESS_DEFLATE);
+    stream_decompressor =
+        GetContext<Arena>()->ManagedNew<DeflateStreamDecompressor>();
+  }
   call_args.client_to_server_messages->InterceptAndMap(
-      [compression_algorithm,
-       this](MessageHandle message) -> absl::optional<MessageHandle> {
-        return CompressMessage(std::move(message), compression_algorithm);
+      [compress_args, this](MessageHandle message) {
+        return CompressMessageAsync(std::move(message), *compress_args);
       });
   auto* decompress_args = GetContext<Arena>()->New<DecompressArgs>(
-      DecompressArgs{GRPC_COMPRESS_NONE, absl::nullopt});
+      DecompressArgs{GRPC_COMPRESS_NONE, absl::nullopt, nullptr});
   auto* decompress_err =
       GetContext<Arena>()->New<Latch<ServerMetadataHandle>>();
   call_args.server_initial_metadata->InterceptAndMap(
-      [decompress_args, this](ServerMetadataHandle server_initial_metadata)
+      [compress_args, decompress_args, dictionary, stream_decompressor,
+       this](ServerMetadataHandle server_initial_metadata)
           -> absl::optional<ServerMetadataHandle> {
         if (server_initial_metadata == nullptr) return absl::nullopt;
         *decompress_args = HandleIncomingMetadata(*server_initial_metadata);
+        if (server_initial_metadata->Take(GrpcStreamEncodingMetadata()) ==
+            GRPC_COMPRESS_DEFLATE) {
+          decompress_args->stream_decompressor = stream_decompressor;
+        }
+        // Frames compressed without the dictionary are still read correctly,
+        // so it can be used for decompression regardless of the answer.
+        decompress_args->dictionary = dictionary;
+        auto id = server_initial_metadata->Take(GrpcZstdDictionaryMetadata());
+        if (dictionary != nullptr && id == dictionary->id()) {
+          compress_args->dictionary = dictionary;
+        }
         return std::move(server_initial_metadata);
       });
   call_args.server_to_client_messages->InterceptAndMap(
-      [decompress_err, decompress_args,
-       this](MessageHandle message) -> absl::optional<MessageHandle> {
-        auto r = DecompressMessage(std::move(message), *decompress_args);
-        if (!r.ok()) {
-          decompress_err->Set(ServerMetadataFromStatus(r.status()));
-          return absl::nullopt;
-        }
-        return std::move(*r);
+      [decompress_err, decompress_args, this](MessageHandle message) {
+        return Map(
+            DecompressMessageAsync(std::move(message), *decompress_args),
+            [decompress_err](absl::StatusOr<MessageHandle> r)
+                -> absl::optional<MessageHandle> {
+              if (!r.ok()) {
+                decompress_err->Set(ServerMetadataFromStatus(r.status()));
+                return absl::nullopt;
+              }
+              return std::move(*r);
+            });
       });
   // Run the next filter, and race it with getting an error from decompression.
   return Race(next_promise_factory(std::move(call_args)),
@@ -262,38 +488,58 @@ ArenaPromise<ServerMetadataHandle> ServerCompressionFilter::MakeCallPromise(
     CallArgs call_args, NextPromiseFactory next_promise_factory) {
   auto decompress_args =
       HandleIncomingMetadata(*call_args.client_initial_metadata);
+  const CompressionDictionary* dictionary =
+      PeerDictionary(*call_args.client_initial_metadata);
+  decompress_args.dictionary = dictionary;
+  // Compress our messages with a single deflate context if the client offered
+  // to read them that way.
+  DeflateStreamCompressor* stream_compressor = nullptr;
+  if (call_args.client_initial_metadata->Take(GrpcStreamEncodingMetadata()) ==
+          GRPC_COMPRESS_DEFLATE &&
+      enable_stream_compression()) {
+    stream_compressor =
+        GetContext<Arena>()->ManagedNew<DeflateStreamCompressor>();
+  }
   auto* decompress_err =
       GetContext<Arena>()->New<Latch<ServerMetadataHandle>>();
   call_args.client_to_server_messages->InterceptAndMap(
-      [decompress_err, decompress_args,
-       this](MessageHandle message) -> absl::optional<MessageHandle> {
-        auto r = DecompressMessage(std::move(message), decompress_args);
-        if (grpc_call_trace.enabled()) {
-          gpr_log(GPR_DEBUG, "DecompressMessage returned %s",
-                  r.status().ToString().c_str());
-        }
-        if (!r.ok()) {
-          decompress_err->Set(ServerMetadataFromStatus(r.status()));
-          return absl::nullopt;
-        }
-        return std::move(*r);
+      [decompress_err, decompress_args, this](MessageHandle message) {
+        return Map(
+            DecompressMessageAsync(std::move(message), decompress_args),
+            [decompress_err](absl::StatusOr<MessageHandle> r)
+                -> absl::optional<MessageHandle> {
+              if (grpc_call_trace.enabled()) {
+                gpr_log(GPR_DEBUG, "DecompressMessage returned %s",
+                        r.status().ToString().c_str());
+              }
+              if (!r.ok()) {
+                decompress_err->Set(ServerMetadataFromStatus(r.status()));
+                return absl::nullopt;
+              }
+              return std::move(*r);
+            });
       });
-  auto* compression_algorithm =
-      GetContext<Arena>()->New<grpc_compression_algorithm>();
+  auto* compress_args = GetContext<Arena>()->New<CompressArgs>(
+      CompressArgs{GRPC_COMPRESS_NONE, GRPC_COMPRESS_LEVEL_NONE, nullptr});
   call_args.server_initial_metadata->InterceptAndMap(
-      [this, compression_algorithm](ServerMetadataHandle md) {
+      [this, compress_args, dictionary, stream_compressor](
+          ServerMetadataHandle md) {
         if (grpc_call_trace.enabled()) {
           gpr_log(GPR_INFO, "%s[compression] Write metadata",
                   Activity::current()->DebugTag().c_str());
         }
         // Find the compression algorithm.
-        *compression_algorithm = HandleOutgoingMetadata(*md);
+        *compress_args = HandleOutgoingMetadata(*md, dictionary);
+        if (stream_compressor != nullptr &&
+            compress_args->algorithm == GRPC_COMPRESS_DEFLATE) {
+          md->Set(GrpcStreamEncodingMetadata(), GRPC_COMPRESS_DEFLATE);
+          compress_args->stream_compressor = stream_compressor;
+        }
         return md;
       });
   call_args.server_to_client_messages->InterceptAndMap(
-      [compression_algorithm,
-       this](MessageHandle message) -> absl::optional<MessageHandle> {
-        return CompressMessage(std::move(message), *compression_algorithm);
+      [compress_args, this](MessageHandle message) {
+        return CompressMessageAsync(std::move(message), *compress_args);
       });
   // Concurrently:
   // - call the next filter
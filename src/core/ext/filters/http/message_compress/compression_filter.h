@@ -24,21 +24,72 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <memory>
+#include <utility>
+
 #include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
 #include <grpc/impl/compression_types.h>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
+#include "src/core/lib/channel/context.h"
 #include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/compression/compression_dictionary.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/json/json.h"
 #include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/service_config/service_config_parser.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
 
 namespace grpc_core {
 
+// Per-method compression settings from the service config:
+//   "zstdDictionary": "<base64 encoded dictionary from `zstd --train`>"
+// zstd-compressed messages of such methods use the dictionary once the server
+// confirms it has the same one (see CompressionDictionarySet).
+// Ignored in builds without zstd.
+class CompressionParsedConfig : public ServiceConfigParser::ParsedConfig {
+ public:
+  explicit CompressionParsedConfig(
+      RefCountedPtr<CompressionDictionary> zstd_dictionary)
+      : zstd_dictionary_(std::move(zstd_dictionary)) {}
+
+  const CompressionDictionary* zstd_dictionary() const {
+    return zstd_dictionary_.get();
+  }
+
+  static const CompressionParsedConfig* GetFromCallContext(
+      const grpc_call_context_element* context,
+      size_t service_config_parser_index);
+
+ private:
+  RefCountedPtr<CompressionDictionary> zstd_dictionary_;
+};
+
+class CompressionParser : public ServiceConfigParser::Parser {
+ public:
+  absl::string_view name() const override { return parser_name(); }
+
+  std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
+      const ChannelArgs& /*args*/, const Json& json,
+      ValidationErrors* errors) override;
+
+  static void Register(CoreConfiguration::Builder* builder);
+
+  static size_t ParserIndex();
+
+ private:
+  static absl::string_view parser_name() { return "compression"; }
+};
+
 /// Compression filter for messages.
 ///
 /// See <grpc/compression.h> for the available compression settings.
@@ -48,6 +99,8 @@ namespace grpc_core {
 /// - The metadata accompanying the outgoing data to be compressed. This is
 ///   taken as a request only. We may choose not to honor it. The metadata key
 ///   is given by \a GRPC_COMPRESSION_REQUEST_ALGORITHM_MD_KEY.
+/// - The compression level requested for the call, which selects the effort
+///   the chosen codec spends (e.g. zstd level 1, 3 or 9).
 ///
 /// Compression can be disabled for concrete messages (for instance in order to
 /// prevent CRIME/BEAST type attacks) by having the GRPC_WRITE_NO_COMPRESS set
@@ -60,12 +113,43 @@ namespace grpc_core {
 /// to incorporate GRPC_WRITE_INTERNAL_COMPRESS. Otherwise, and regardless of
 /// the aforementioned 'grpc-encoding' metadata value, data will pass through
 /// uncompressed.
+///
+/// A client whose method config names a zstd dictionary sends its ID in
+/// 'grpc-zstd-dictionary'. A server that has that dictionary (channel arg
+/// CompressionDictionarySet) echoes the ID and uses the dictionary for zstd in
+/// both directions. zstd contexts are cached per filter instance, i.e. per
+/// connection, so that binding a dictionary is cheap.
+///
+/// With GRPC_ARG_ENABLE_STREAM_COMPRESSION, a client offers in
+/// 'grpc-stream-encoding' to read deflate messages that share one context for
+/// the whole stream. A server that also has the arg and compresses with
+/// deflate confirms it the same way, and then does so for all of its
+/// messages on the stream. Client messages are still compressed one by one:
+/// the client can't know what the server supports before it starts sending.
+///
+/// Messages of at least GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD bytes are
+/// compressed and decompressed on the EventEngine, and the call resumes once
+/// that is done.
 
 class CompressionFilter : public ChannelFilter {
  protected:
+  struct CompressArgs {
+    grpc_compression_algorithm algorithm;
+    // Mapped onto the codec's own effort setting.
+    grpc_compression_level level;
+    // Used with zstd, if set.
+    const CompressionDictionary* dictionary;
+    // Used in place of per-message deflate, if set.
+    DeflateStreamCompressor* stream_compressor = nullptr;
+  };
+
   struct DecompressArgs {
     grpc_compression_algorithm algorithm;
     absl::optional<uint32_t> max_recv_message_length;
+    // Used with zstd, if set.
+    const CompressionDictionary* dictionary;
+    // Used in place of per-message deflate, if set.
+    DeflateStreamDecompressor* stream_decompressor = nullptr;
   };
 
   explicit CompressionFilter(const ChannelArgs& args);
@@ -78,22 +162,38 @@ class CompressionFilter : public ChannelFilter {
     return enabled_compression_algorithms_;
   }
 
-  grpc_compression_algorithm HandleOutgoingMetadata(
-      grpc_metadata_batch& outgoing_metadata);
+  // Whether streams may use a single deflate context for the server's
+  // messages (GRPC_ARG_ENABLE_STREAM_COMPRESSION).
+  bool enable_stream_compression() const { return enable_stream_compression_; }
+
+  // dictionary, if set, is announced to the peer and used for zstd.
+  CompressArgs HandleOutgoingMetadata(grpc_metadata_batch& outgoing_metadata,
+                                      const CompressionDictionary* dictionary);
   DecompressArgs HandleIncomingMetadata(
       const grpc_metadata_batch& incoming_metadata);
 
   // Compress one message synchronously.
-  MessageHandle CompressMessage(MessageHandle message,
-                                grpc_compression_algorithm algorithm) const;
+  MessageHandle CompressMessage(MessageHandle message, CompressArgs args) const;
   // Decompress one message synchronously.
   absl::StatusOr<MessageHandle> DecompressMessage(MessageHandle message,
                                                   DecompressArgs args) const;
+  // As above, but large messages are processed on the EventEngine.
+  ArenaPromise<MessageHandle> CompressMessageAsync(MessageHandle message,
+                                                   CompressArgs args) const;
+  ArenaPromise<absl::StatusOr<MessageHandle>> DecompressMessageAsync(
+      MessageHandle message, DecompressArgs args) const;
+
+  // The dictionary the service config configures for the current call.
+  const CompressionDictionary* ConfiguredDictionary() const;
+  // The dictionary announced by the peer in metadata, if we have it too.
+  const CompressionDictionary* PeerDictionary(
+      grpc_metadata_batch& incoming_metadata) const;
 
  private:
   // Max receive message length, if set.
   absl::optional<uint32_t> max_recv_size_;
   size_t message_size_service_config_parser_index_;
+  size_t compression_service_config_parser_index_;
   // The default, channel-level, compression algorithm.
   grpc_compression_algorithm default_compression_algorithm_;
   // Enabled compression algorithms.
@@ -102,6 +202,15 @@ class CompressionFilter : public ChannelFilter {
   bool enable_compression_;
   // Is decompression enabled?
   bool enable_decompression_;
+  // May the server's messages share a deflate context?
+  bool enable_stream_compression_;
+  // Messages at least this large are (de)compressed on the EventEngine.
+  // Zero disables offloading.
+  size_t offload_threshold_;
+  // Dictionaries a peer may ask for.
+  RefCountedPtr<CompressionDictionarySet> dictionaries_;
+  std::unique_ptr<DictionaryCompressor> dictionary_compressor_ =
+      std::make_unique<DictionaryCompressor>();
 };
 
 class ClientCompressionFilter final : public CompressionFilter {
@@ -25,7 +25,6 @@
 #include <string>
 #include <utility>
 
-#include "absl/base/attributes.h"
 #include "absl/meta/type_traits.h"
 #include "absl/status/status.h"
 #include "absl/types/optional.h"
@@ -59,76 +58,52 @@ void FilterOutgoingMetadata(ServerMetadata* md) {
                                        PercentEncodingType::Compatible);
   }
 }
-}  // namespace
-
-ArenaPromise<ServerMetadataHandle> HttpServerFilter::MakeCallPromise(
-    CallArgs call_args, NextPromiseFactory next_promise_factory) {
-  const auto& md = call_args.client_initial_metadata;
 
+// Checks the headers of a request in one pass, dropping those nothing above
+// this filter reads.  Returns the error to fail the call with.
+absl::Status CheckRequestHeaders(ClientMetadata* md, bool allow_put_requests) {
   auto method = md->get(HttpMethodMetadata());
-  if (method.has_value()) {
-    switch (*method) {
-      case HttpMethodMetadata::kPost:
-        break;
-      case HttpMethodMetadata::kPut:
-        if (allow_put_requests_) {
-          break;
-        }
-        ABSL_FALLTHROUGH_INTENDED;
-      case HttpMethodMetadata::kInvalid:
-      case HttpMethodMetadata::kGet:
-        return Immediate(
-            ServerMetadataFromStatus(absl::UnknownError("Bad method header")));
-    }
-  } else {
-    return Immediate(
-        ServerMetadataFromStatus(absl::UnknownError("Missing :method header")));
+  if (!method.has_value()) return absl::UnknownError("Missing :method header");
+  if (*method != HttpMethodMetadata::kPost &&
+      (*method != HttpMethodMetadata::kPut || !allow_put_requests)) {
+    return absl::UnknownError("Bad method header");
   }
 
   auto te = md->Take(TeMetadata());
-  if (te == TeMetadata::kTrailers) {
-    // Do nothing, ok.
-  } else if (!te.has_value()) {
-    return Immediate(
-        ServerMetadataFromStatus(absl::UnknownError("Missing :te header")));
-  } else {
-    return Immediate(
-        ServerMetadataFromStatus(absl::UnknownError("Bad :te header")));
-  }
+  if (!te.has_value()) return absl::UnknownError("Missing :te header");
+  if (*te != TeMetadata::kTrailers) return absl::UnknownError("Bad :te header");
 
   auto scheme = md->Take(HttpSchemeMetadata());
-  if (scheme.has_value()) {
-    if (*scheme == HttpSchemeMetadata::kInvalid) {
-      return Immediate(
-          ServerMetadataFromStatus(absl::UnknownError("Bad :scheme header")));
-    }
-  } else {
-    return Immediate(
-        ServerMetadataFromStatus(absl::UnknownError("Missing :scheme header")));
+  if (!scheme.has_value()) return absl::UnknownError("Missing :scheme header");
+  if (*scheme == HttpSchemeMetadata::kInvalid) {
+    return absl::UnknownError("Bad :scheme header");
   }
 
   md->Remove(ContentTypeMetadata());
 
-  Slice* path_slice = md->get_pointer(HttpPathMetadata());
-  if (path_slice == nullptr) {
-    return Immediate(
-        ServerMetadataFromStatus(absl::UnknownError("Missing :path header")));
+  if (md->get_pointer(HttpPathMetadata()) == nullptr) {
+    return absl::UnknownError("Missing :path header");
   }
 
   if (md->get_pointer(HttpAuthorityMetadata()) == nullptr) {
     absl::optional<Slice> host = md->Take(HostMetadata());
-    if (host.has_value()) {
-      md->Set(HttpAuthorityMetadata(), std::move(*host));
+    if (!host.has_value()) {
+      return absl::UnknownError("Missing :authority header");
     }
+    md->Set(HttpAuthorityMetadata(), std::move(*host));
   }
+  return absl::OkStatus();
+}
+}  // namespace
 
-  if (md->get_pointer(HttpAuthorityMetadata()) == nullptr) {
-    return Immediate(ServerMetadataFromStatus(
-        absl::UnknownError("Missing :authority header")));
-  }
+ArenaPromise<ServerMetadataHandle> HttpServerFilter::MakeCallPromise(
+    CallArgs call_args, NextPromiseFactory next_promise_factory) {
+  absl::Status status = CheckRequestHeaders(
+      call_args.client_initial_metadata.get(), allow_put_requests_);
+  if (!status.ok()) return Immediate(ServerMetadataFromStatus(status));
 
   if (!surface_user_agent_) {
-    md->Remove(UserAgentMetadata());
+    call_args.client_initial_metadata->Remove(UserAgentMetadata());
   }
 
   call_args.server_initial_metadata->InterceptAndMap(
@@ -94,19 +94,28 @@ absl::StatusOr<ServerLoadReportingFilter> ServerLoadReportingFilter::Create(
   return std::move(filter);
 }
 
-namespace {
-std::string GetCensusSafeClientIpString(
-    const ClientMetadataHandle& initial_metadata) {
-  // Find the client URI string.
-  Slice* client_uri_slice = initial_metadata->get_pointer(PeerString());
-  if (client_uri_slice == nullptr) {
-    gpr_log(GPR_ERROR,
-            "Unable to extract client URI string (peer string) from gRPC "
-            "metadata.");
-    return "";
+const std::string* ServerLoadReportingFilter::ClientIpCache::Get(
+    absl::string_view peer) const {
+  const Entry* entry = entry_.load(std::memory_order_acquire);
+  if (entry == nullptr || entry->peer != peer) return nullptr;
+  return &entry->client_ip;
+}
+
+void ServerLoadReportingFilter::ClientIpCache::Set(absl::string_view peer,
+                                                   std::string client_ip) {
+  // Only the first peer is kept: it is the only one a server channel sees.
+  const Entry* expected = nullptr;
+  auto* entry = new Entry{std::string(peer), std::move(client_ip)};
+  if (!entry_.compare_exchange_strong(expected, entry,
+                                      std::memory_order_acq_rel,
+                                      std::memory_order_acquire)) {
+    delete entry;
   }
-  absl::StatusOr<URI> client_uri =
-      URI::Parse(client_uri_slice->as_string_view());
+}
+
+namespace {
+std::string ParseCensusSafeClientIpString(absl::string_view client_uri_str) {
+  absl::StatusOr<URI> client_uri = URI::Parse(client_uri_str);
   if (!client_uri.ok()) {
     gpr_log(GPR_ERROR,
             "Unable to parse the client URI string (peer string) to a client "
@@ -142,9 +151,8 @@ std::string GetCensusSafeClientIpString(
   }
 }
 
-std::string MakeClientIpAndLrToken(
-    absl::string_view lr_token, const ClientMetadataHandle& initial_metadata) {
-  std::string client_ip = GetCensusSafeClientIpString(initial_metadata);
+std::string MakeClientIpAndLrToken(absl::string_view lr_token,
+                                   absl::string_view client_ip) {
   absl::string_view prefix;
   switch (client_ip.length()) {
     case 0:
@@ -162,6 +170,28 @@ std::string MakeClientIpAndLrToken(
   return absl::StrCat(prefix, client_ip, lr_token);
 }
 
+}  // namespace
+
+std::string ServerLoadReportingFilter::GetCensusSafeClientIpString(
+    const ClientMetadataHandle& initial_metadata) {
+  // Find the client URI string.
+  Slice* client_uri_slice = initial_metadata->get_pointer(PeerString());
+  if (client_uri_slice == nullptr) {
+    gpr_log(GPR_ERROR,
+            "Unable to extract client URI string (peer string) from gRPC "
+            "metadata.");
+    return "";
+  }
+  absl::string_view peer = client_uri_slice->as_string_view();
+  const std::string* cached = client_ip_cache_->Get(peer);
+  if (cached != nullptr) return *cached;
+  std::string client_ip = ParseCensusSafeClientIpString(peer);
+  // Peers that failed to parse are not cached so that each call logs why.
+  if (!client_ip.empty()) client_ip_cache_->Set(peer, client_ip);
+  return client_ip;
+}
+
+namespace {
 const char* GetStatusTagForStatus(grpc_status_code status) {
   switch (status) {
     case GRPC_STATUS_OK:
@@ -195,8 +225,10 @@ ArenaPromise<ServerMetadataHandle> ServerLoadReportingFilter::MakeCallPromise(
   std::string client_ip_and_lr_token;
   auto lb_token = call_args.client_initial_metadata->Take(LbTokenMetadata())
                       .value_or(Slice());
-  client_ip_and_lr_token = MakeClientIpAndLrToken(
-      lb_token.as_string_view(), call_args.client_initial_metadata);
+  client_ip_and_lr_token =
+      MakeClientIpAndLrToken(lb_token.as_string_view(),
+                             GetCensusSafeClientIpString(
+                                 call_args.client_initial_metadata));
   // Record the beginning of the request
   opencensus::stats::Record(
       {{::grpc::load_reporter::MeasureStartCount(), 1}},
@@ -212,8 +244,9 @@ ArenaPromise<ServerMetadataHandle> ServerLoadReportingFilter::MakeCallPromise(
       // Call down the stack
       next_promise_factory(std::move(call_args)),
       // And then record the call result
-      [this, client_ip_and_lr_token,
-       target_host](ServerMetadataHandle trailing_metadata) {
+      [this, client_ip_and_lr_token = std::move(client_ip_and_lr_token),
+       target_host = std::move(target_host)](
+          ServerMetadataHandle trailing_metadata) mutable {
         const auto& costs = trailing_metadata->Take(LbCostBinMetadata());
         for (const auto& cost : costs) {
           opencensus::stats::Record(
@@ -228,31 +261,33 @@ ArenaPromise<ServerMetadataHandle> ServerLoadReportingFilter::MakeCallPromise(
                {::grpc::load_reporter::TagKeyMetricName(),
                 {cost.name.data(), cost.name.length()}}});
         }
-        GetContext<CallFinalization>()->Add([this, client_ip_and_lr_token,
-                                             target_host](
-                                                const grpc_call_final_info*
-                                                    final_info) {
-          if (final_info == nullptr) return;
-          // After the last bytes have been placed on the wire we record
-          // final measurements
-          opencensus::stats::Record(
-              {{::grpc::load_reporter::MeasureEndCount(), 1},
-               {::grpc::load_reporter::MeasureEndBytesSent(),
-                final_info->stats.transport_stream_stats.outgoing.data_bytes},
-               {::grpc::load_reporter::MeasureEndBytesReceived(),
-                final_info->stats.transport_stream_stats.incoming.data_bytes},
-               {::grpc::load_reporter::MeasureEndLatencyMs(),
-                gpr_time_to_millis(final_info->stats.latency)}},
-              {{::grpc::load_reporter::TagKeyToken(),
-                {client_ip_and_lr_token.data(),
-                 client_ip_and_lr_token.length()}},
-               {::grpc::load_reporter::TagKeyHost(),
-                {target_host.data(), target_host.length()}},
-               {::grpc::load_reporter::TagKeyUserId(),
-                {peer_identity_.data(), peer_identity_.length()}},
-               {::grpc::load_reporter::TagKeyStatus(),
-                GetStatusTagForStatus(final_info->final_status)}});
-        });
+        GetContext<CallFinalization>()->Add(
+            [this, client_ip_and_lr_token = std::move(client_ip_and_lr_token),
+             target_host = std::move(target_host)](
+                const grpc_call_final_info* final_info) {
+              if (final_info == nullptr) return;
+              // After the last bytes have been placed on the wire we record
+              // final measurements
+              opencensus::stats::Record(
+                  {{::grpc::load_reporter::MeasureEndCount(), 1},
+                   {::grpc::load_reporter::MeasureEndBytesSent(),
+                    final_info->stats.transport_stream_stats.outgoing
+                        .data_bytes},
+                   {::grpc::load_reporter::MeasureEndBytesReceived(),
+                    final_info->stats.transport_stream_stats.incoming
+                        .data_bytes},
+                   {::grpc::load_reporter::MeasureEndLatencyMs(),
+                    gpr_time_to_millis(final_info->stats.latency)}},
+                  {{::grpc::load_reporter::TagKeyToken(),
+                    {client_ip_and_lr_token.data(),
+                     client_ip_and_lr_token.length()}},
+                   {::grpc::load_reporter::TagKeyHost(),
+                    {target_host.data(), target_host.length()}},
+                   {::grpc::load_reporter::TagKeyUserId(),
+                    {peer_identity_.data(), peer_identity_.length()}},
+                   {::grpc::load_reporter::TagKeyStatus(),
+                    GetStatusTagForStatus(final_info->final_status)}});
+            });
         return Immediate(std::move(trailing_metadata));
       }));
 }
@@ -23,9 +23,12 @@
 
 #include <stddef.h>
 
+#include <atomic>
+#include <memory>
 #include <string>
 
 #include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/promise_based_filter.h"
@@ -48,8 +51,31 @@ class ServerLoadReportingFilter : public ChannelFilter {
       CallArgs call_args, NextPromiseFactory next_promise_factory) override;
 
  private:
+  // Remembers the census-safe IP string of the connection's client.  All
+  // calls on a server channel come from the same peer, so the peer URI is
+  // parsed on the first call only.
+  class ClientIpCache {
+   public:
+    ~ClientIpCache() { delete entry_.load(std::memory_order_relaxed); }
+    // Returns nullptr if \a peer is not the one cached.
+    const std::string* Get(absl::string_view peer) const;
+    void Set(absl::string_view peer, std::string client_ip);
+
+   private:
+    struct Entry {
+      std::string peer;
+      std::string client_ip;
+    };
+    std::atomic<const Entry*> entry_{nullptr};
+  };
+
+  std::string GetCensusSafeClientIpString(
+      const ClientMetadataHandle& initial_metadata);
+
   // The peer's authenticated identity.
   std::string peer_identity_;
+  std::unique_ptr<ClientIpCache> client_ip_cache_ =
+      std::make_unique<ClientIpCache>();
 };
 
 }  // namespace grpc_core
@@ -18,6 +18,8 @@
 
 #include "src/core/ext/filters/message_size/message_size_filter.h"
 
+#include <string.h>
+
 #include <initializer_list>
 #include <new>
 
@@ -32,6 +34,7 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/iomgr/call_combiner.h"
@@ -42,6 +45,7 @@
 #include "src/core/lib/surface/channel_init.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/lib/transport/transport_impl.h"
 
 static void recv_message_ready(void* user_data, grpc_error_handle error);
 static void recv_trailing_metadata_ready(void* user_data,
@@ -340,20 +344,36 @@ static bool maybe_add_message_size_filter_subchannel(
   return true;
 }
 
+// Whether the transport at the bottom of the stack checks the channel's
+// message size limits itself, from the length prefix of each message.
+static bool transport_enforces_message_sizes(
+    grpc_core::ChannelStackBuilder* builder) {
+  if (!grpc_core::IsChttp2MessageSizeLimitsEnabled()) return false;
+  grpc_transport* transport = builder->transport();
+  return transport != nullptr &&
+         strcmp(transport->vtable->name, "chttp2") == 0;
+}
+
 // Used for GRPC_CLIENT_DIRECT_CHANNEL and GRPC_SERVER_CHANNEL. Adds the filter
-// only if message size limits or service config is specified.
+// only if message size limits or service config is specified, and the
+// transport does not already enforce those limits.  A service config may set
+// per-method limits that only the filter knows about.
 static bool maybe_add_message_size_filter(
     grpc_core::ChannelStackBuilder* builder) {
   auto channel_args = builder->channel_args();
   if (channel_args.WantMinimalStack()) {
     return true;
   }
+  const bool has_service_config =
+      channel_args.GetString(GRPC_ARG_SERVICE_CONFIG).has_value();
+  if (!has_service_config && transport_enforces_message_sizes(builder)) {
+    return true;
+  }
   grpc_core::MessageSizeParsedConfig limits =
       grpc_core::MessageSizeParsedConfig::GetFromChannelArgs(channel_args);
   const bool enable =
       limits.max_send_size().has_value() ||
-      limits.max_recv_size().has_value() ||
-      channel_args.GetString(GRPC_ARG_SERVICE_CONFIG).has_value();
+      limits.max_recv_size().has_value() || has_service_config;
   if (enable) builder->PrependFilter(&grpc_message_size_filter);
   return true;
 }
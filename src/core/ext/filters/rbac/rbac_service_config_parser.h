@@ -72,6 +72,10 @@ class RbacServiceConfigParser : public ServiceConfigParser::Parser {
   std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override;
+  // Returns the channel arg that enables parsing.
+  std::vector<absl::string_view> ChannelArgsUsed() const override {
+    return {GRPC_ARG_PARSE_RBAC_METHOD_CONFIG};
+  }
   // Returns the parser index for RbacServiceConfigParser.
   static size_t ParserIndex();
   // Registers RbacServiceConfigParser to ServiceConfigParser.
@@ -30,7 +30,6 @@
 #include "absl/strings/escaping.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
-#include "absl/strings/str_join.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
@@ -94,18 +93,12 @@ void MaybeUpdateServerInitialMetadata(
   // If there was no cookie or if the address changed, set the cookie.
   if (!cookie_value.has_value() ||
       peer_string->as_string_view() != *cookie_value) {
-    std::vector<std::string> parts = {absl::StrCat(
-        *cookie_config->name, "=",
-        absl::Base64Escape(peer_string->as_string_view()), "; HttpOnly")};
-    if (!cookie_config->path.empty()) {
-      parts.emplace_back(absl::StrCat("Path=", cookie_config->path));
-    }
-    if (cookie_config->ttl > Duration::Zero()) {
-      parts.emplace_back(
-          absl::StrCat("Max-Age=", cookie_config->ttl.as_timespec().tv_sec));
-    }
     server_initial_metadata->Append(
-        "set-cookie", Slice::FromCopiedString(absl::StrJoin(parts, "; ")),
+        "set-cookie",
+        Slice::FromCopiedString(absl::StrCat(
+            *cookie_config->name, "=",
+            absl::Base64Escape(peer_string->as_string_view()),
+            cookie_config->set_cookie_attributes)),
         [](absl::string_view error, const Slice&) {
           Crash(absl::StrCat("ERROR ADDING set-cookie METADATA: ", error));
         });
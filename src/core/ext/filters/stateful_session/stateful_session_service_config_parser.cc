@@ -20,6 +20,7 @@
 
 #include <vector>
 
+#include "absl/strings/str_cat.h"
 #include "absl/types/optional.h"
 
 #include "src/core/lib/channel/channel_args.h"
@@ -43,6 +44,12 @@ void StatefulSessionMethodParsedConfig::CookieConfig::JsonPostLoad(
     ValidationErrors::ScopedField field(errors, ".name");
     errors->AddError("must be non-empty");
   }
+  set_cookie_attributes = "; HttpOnly";
+  if (!path.empty()) absl::StrAppend(&set_cookie_attributes, "; Path=", path);
+  if (ttl > Duration::Zero()) {
+    absl::StrAppend(&set_cookie_attributes,
+                    "; Max-Age=", ttl.as_timespec().tv_sec);
+  }
 }
 
 const JsonLoaderInterface* StatefulSessionMethodParsedConfig::JsonLoader(
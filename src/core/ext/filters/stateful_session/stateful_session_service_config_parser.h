@@ -50,6 +50,9 @@ class StatefulSessionMethodParsedConfig
     absl::optional<std::string> name;  // Will be unset if disabled.
     std::string path;
     Duration ttl;
+    // The part of the set-cookie value after the cookie itself ("; HttpOnly"
+    // and the path and ttl attributes), computed once when parsing.
+    std::string set_cookie_attributes;
 
     static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
     void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors);
@@ -79,6 +82,10 @@ class StatefulSessionServiceConfigParser final
   std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
       const ChannelArgs& args, const Json& json,
       ValidationErrors* errors) override;
+  // Returns the channel arg that enables parsing.
+  std::vector<absl::string_view> ChannelArgsUsed() const override {
+    return {GRPC_ARG_PARSE_STATEFUL_SESSION_METHOD_CONFIG};
+  }
   // Returns the parser index for the parser.
   static size_t ParserIndex();
   // Registers the parser.
@@ -29,6 +29,7 @@
 #include "src/core/ext/transport/binder/transport/binder_transport.h"
 #include "src/core/ext/transport/binder/utils/ndk_binder.h"
 #include "src/core/ext/transport/binder/wire_format/binder_android.h"
+#include "src/core/ext/transport/binder/wire_format/shared_memory.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/surface/server.h"
 #include "src/core/lib/transport/error_utils.h"
@@ -207,11 +208,17 @@ class BinderServerListener : public Server::ListenerInterface {
     if (!client_binder) {
       return absl::InvalidArgumentError("NULL binder read from the parcel");
     }
+    // Clients that predate the feature set end the parcel here.
+    int32_t features = 0;
+    if (grpc_binder::AdvertisedTransportFeatures() == 0 ||
+        !parcel->ReadInt32(&features).ok()) {
+      features = 0;
+    }
     client_binder->Initialize();
     // Finish the second half of SETUP_TRANSPORT in
     // grpc_create_binder_transport_server().
     grpc_transport* server_transport = grpc_create_binder_transport_server(
-        std::move(client_binder), security_policy_);
+        std::move(client_binder), security_policy_, features);
     GPR_ASSERT(server_transport);
     grpc_error_handle error = server_->SetupTransport(
         server_transport, nullptr, server_->channel_args(), nullptr);
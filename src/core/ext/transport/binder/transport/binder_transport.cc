@@ -709,7 +709,8 @@ static const grpc_transport_vtable* get_vtable() { return &vtable; }
 
 grpc_binder_transport::grpc_binder_transport(
     std::unique_ptr<grpc_binder::Binder> binder, bool is_client,
-    std::shared_ptr<grpc::experimental::binder::SecurityPolicy> security_policy)
+    std::shared_ptr<grpc::experimental::binder::SecurityPolicy> security_policy,
+    int32_t peer_features)
     : is_client(is_client),
       combiner(grpc_combiner_create()),
       state_tracker(
@@ -734,7 +735,8 @@ grpc_binder_transport::grpc_binder_transport(
       [this] {
         // Unref transport when destructed.
         GRPC_BINDER_UNREF_TRANSPORT(this, "wire reader");
-      });
+      },
+      peer_features);
   wire_writer = wire_reader->SetupTransport(std::move(binder));
 }
 
@@ -760,14 +762,16 @@ grpc_transport* grpc_create_binder_transport_client(
 grpc_transport* grpc_create_binder_transport_server(
     std::unique_ptr<grpc_binder::Binder> client_binder,
     std::shared_ptr<grpc::experimental::binder::SecurityPolicy>
-        security_policy) {
+        security_policy,
+    int32_t peer_features) {
   gpr_log(GPR_INFO, __func__);
 
   GPR_ASSERT(client_binder != nullptr);
   GPR_ASSERT(security_policy != nullptr);
 
-  grpc_binder_transport* t = new grpc_binder_transport(
-      std::move(client_binder), /*is_client=*/false, security_policy);
+  grpc_binder_transport* t =
+      new grpc_binder_transport(std::move(client_binder), /*is_client=*/false,
+                                security_policy, peer_features);
 
   return &t->base;
 }
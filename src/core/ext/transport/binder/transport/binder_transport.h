@@ -47,7 +47,8 @@ struct grpc_binder_transport {
   explicit grpc_binder_transport(
       std::unique_ptr<grpc_binder::Binder> binder, bool is_client,
       std::shared_ptr<grpc::experimental::binder::SecurityPolicy>
-          security_policy);
+          security_policy,
+      int32_t peer_features = 0);
   ~grpc_binder_transport();
 
   int NewStreamTxCode() {
@@ -91,9 +92,12 @@ grpc_transport* grpc_create_binder_transport_client(
     std::unique_ptr<grpc_binder::Binder> endpoint_binder,
     std::shared_ptr<grpc::experimental::binder::SecurityPolicy>
         security_policy);
+// \a peer_features is the feature set the client advertised in the
+// SETUP_TRANSPORT that brought \a client_binder.
 grpc_transport* grpc_create_binder_transport_server(
     std::unique_ptr<grpc_binder::Binder> client_binder,
     std::shared_ptr<grpc::experimental::binder::SecurityPolicy>
-        security_policy);
+        security_policy,
+    int32_t peer_features = 0);
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_TRANSPORT_BINDER_TRANSPORT_H
@@ -204,6 +204,15 @@ binder_status_t AParcel_writeByteArray(AParcel* parcel, const int8_t* arrayData,
   FORWARD(AParcel_writeByteArray)(parcel, arrayData, length);
 }
 
+binder_status_t AParcel_writeParcelFileDescriptor(AParcel* parcel, int fd) {
+  FORWARD(AParcel_writeParcelFileDescriptor)(parcel, fd);
+}
+
+binder_status_t AParcel_readParcelFileDescriptor(const AParcel* parcel,
+                                                 int* fd) {
+  FORWARD(AParcel_readParcelFileDescriptor)(parcel, fd);
+}
+
 binder_status_t AIBinder_prepareTransaction(AIBinder* binder, AParcel** in) {
   FORWARD(AIBinder_prepareTransaction)(binder, in);
 }
@@ -95,6 +95,9 @@ binder_status_t AParcel_readStrongBinder(const AParcel* parcel,
                                          AIBinder** binder);
 binder_status_t AParcel_writeByteArray(AParcel* parcel, const int8_t* arrayData,
                                        int32_t length);
+binder_status_t AParcel_writeParcelFileDescriptor(AParcel* parcel, int fd);
+binder_status_t AParcel_readParcelFileDescriptor(const AParcel* parcel,
+                                                 int* fd);
 binder_status_t AIBinder_prepareTransaction(AIBinder* binder, AParcel** in);
 jobject AIBinder_toJavaBinder(JNIEnv* env, AIBinder* binder);
 
@@ -50,6 +50,11 @@ class WritableParcel {
   virtual absl::Status WriteBinder(HasRawBinder* binder) = 0;
   virtual absl::Status WriteString(absl::string_view s) = 0;
   virtual absl::Status WriteByteArray(const int8_t* buffer, int32_t length) = 0;
+  // Writes a file descriptor that the reader receives a duplicate of. The
+  // parcel does not take ownership of \a fd.
+  virtual absl::Status WriteFileDescriptor(int /*fd*/) {
+    return absl::UnimplementedError("WriteFileDescriptor");
+  }
 
   absl::Status WriteByteArrayWithLength(absl::string_view buffer) {
     absl::Status status = WriteInt32(buffer.length());
@@ -72,6 +77,10 @@ class ReadableParcel {
   virtual absl::Status ReadBinder(std::unique_ptr<Binder>* data) = 0;
   virtual absl::Status ReadByteArray(std::string* data) = 0;
   virtual absl::Status ReadString(std::string* str) = 0;
+  // The caller owns, and must close, the file descriptor read into \a fd.
+  virtual absl::Status ReadFileDescriptor(int* /*fd*/) {
+    return absl::UnimplementedError("ReadFileDescriptor");
+  }
 };
 
 class TransactionReceiver : public HasRawBinder {
@@ -261,6 +261,13 @@ absl::Status WritableParcelAndroid::WriteByteArray(const int8_t* buffer,
              : absl::InternalError("AParcel_writeByteArray failed");
 }
 
+absl::Status WritableParcelAndroid::WriteFileDescriptor(int fd) {
+  return ndk_util::AParcel_writeParcelFileDescriptor(parcel_, fd) ==
+                 ndk_util::STATUS_OK
+             ? absl::OkStatus()
+             : absl::InternalError("AParcel_writeParcelFileDescriptor failed");
+}
+
 int32_t ReadableParcelAndroid::GetDataSize() const {
   return ndk_util::AParcel_getDataSize(parcel_);
 }
@@ -305,6 +312,13 @@ absl::Status ReadableParcelAndroid::ReadString(std::string* str) {
              : absl::InternalError("AParcel_readString failed");
 }
 
+absl::Status ReadableParcelAndroid::ReadFileDescriptor(int* fd) {
+  return ndk_util::AParcel_readParcelFileDescriptor(parcel_, fd) ==
+                 ndk_util::STATUS_OK
+             ? absl::OkStatus()
+             : absl::InternalError("AParcel_readParcelFileDescriptor failed");
+}
+
 }  // namespace grpc_binder
 
 #endif  // GPR_SUPPORT_BINDER_TRANSPORT
@@ -25,5 +25,7 @@ namespace grpc_binder {
 
 ABSL_CONST_INIT const int kFirstCallId = FIRST_CALL_TRANSACTION + 1000;
 
+ABSL_CONST_INIT const int32_t kFeatureSharedMemoryMessages = 0x1;
+
 }  // namespace grpc_binder
 #endif
@@ -38,6 +38,10 @@ enum class BinderTransportTxCode : int32_t {
 
 ABSL_CONST_INIT extern const int kFirstCallId;
 
+// Optional features, as a bit set following the binder in SETUP_TRANSPORT.
+// Peers that do not send one support none of them.
+ABSL_CONST_INIT extern const int32_t kFeatureSharedMemoryMessages;
+
 }  // namespace grpc_binder
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_WIRE_FORMAT_BINDER_CONSTANTS_H
@@ -0,0 +1,202 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif  // _GNU_SOURCE
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/binder/wire_format/shared_memory.h"
+
+#ifndef GRPC_NO_BINDER
+
+#include <errno.h>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+
+#include "src/core/ext/transport/binder/wire_format/binder_constants.h"
+#include "src/core/lib/gprpp/strerror.h"
+#include "src/core/lib/iomgr/port.h"
+
+// memfd_create() reached bionic in API level 30.
+#if defined(GRPC_LINUX_MEMFD) || \
+    (defined(GPR_ANDROID) && __ANDROID_API__ >= 30)
+#define GRPC_BINDER_SHARED_MEMORY 1
+#endif
+
+#ifdef GRPC_BINDER_SHARED_MEMORY
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // GRPC_BINDER_SHARED_MEMORY
+
+namespace grpc_binder {
+
+#ifdef GRPC_BINDER_SHARED_MEMORY
+
+namespace {
+
+// Regions come in powers of two from this size up, so that messages of
+// similar sizes can share them.
+constexpr size_t kMinRegionSize = 64 * 1024;
+
+absl::Status ErrnoError(const char* what) {
+  return absl::UnavailableError(
+      absl::StrCat(what, ": ", grpc_core::StrError(errno)));
+}
+
+size_t RegionSizeFor(size_t size) {
+  size_t capacity = kMinRegionSize;
+  while (capacity < size) capacity *= 2;
+  return capacity;
+}
+
+absl::StatusOr<SharedMemoryRegion> CreateRegion(size_t capacity) {
+  int fd = memfd_create("grpc_binder", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (fd < 0) return ErrnoError("memfd_create");
+  SharedMemoryRegion region;
+  region.fd = fd;
+  region.capacity = capacity;
+  if (ftruncate(fd, capacity) != 0) {
+    absl::Status status = ErrnoError("ftruncate");
+    close(fd);
+    return status;
+  }
+  // The reader checks for these, so that we cannot make it fault by
+  // truncating the memory under it.
+  if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0) {
+    absl::Status status = ErrnoError("sealing shared memory");
+    close(fd);
+    return status;
+  }
+  region.data =
+      mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (region.data == MAP_FAILED) {
+    absl::Status status = ErrnoError("mmap");
+    close(fd);
+    return status;
+  }
+  return region;
+}
+
+absl::StatusOr<std::string> CopySharedMemory(int fd, int64_t size) {
+  if (size < 0) {
+    return absl::InvalidArgumentError("negative shared memory size");
+  }
+  int seals = fcntl(fd, F_GET_SEALS);
+  if (seals < 0) return ErrnoError("reading shared memory seals");
+  if ((seals & F_SEAL_SHRINK) == 0) {
+    return absl::InvalidArgumentError("shared memory can be shrunk");
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) return ErrnoError("fstat");
+  if (st.st_size < size) {
+    return absl::InvalidArgumentError("message larger than its shared memory");
+  }
+  std::string data;
+  if (size == 0) return data;
+  void* memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  if (memory == MAP_FAILED) return ErrnoError("mmap");
+  data.assign(static_cast<const char*>(memory), size);
+  munmap(memory, size);
+  return data;
+}
+
+}  // namespace
+
+SharedMemoryPool::~SharedMemoryPool() {
+  grpc_core::MutexLock lock(&mu_);
+  for (SharedMemoryRegion& region : free_) Release(region);
+}
+
+bool SharedMemoryPool::IsSupported() { return true; }
+
+absl::StatusOr<SharedMemoryRegion> SharedMemoryPool::Get(size_t size) {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    // Take the smallest free region that fits.
+    auto best = free_.end();
+    for (auto it = free_.begin(); it != free_.end(); ++it) {
+      if (it->capacity >= size &&
+          (best == free_.end() || it->capacity < best->capacity)) {
+        best = it;
+      }
+    }
+    if (best != free_.end()) {
+      SharedMemoryRegion region = *best;
+      free_.erase(best);
+      return region;
+    }
+  }
+  return CreateRegion(RegionSizeFor(size));
+}
+
+void SharedMemoryPool::Put(SharedMemoryRegion region) {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_.size() < kMaxFreeRegions) {
+      free_.push_back(region);
+      return;
+    }
+  }
+  Release(region);
+}
+
+void SharedMemoryPool::Release(SharedMemoryRegion region) {
+  munmap(region.data, region.capacity);
+  close(region.fd);
+}
+
+absl::StatusOr<std::string> ReadSharedMemory(int fd, int64_t size) {
+  absl::StatusOr<std::string> data = CopySharedMemory(fd, size);
+  close(fd);
+  return data;
+}
+
+#else  // GRPC_BINDER_SHARED_MEMORY
+
+SharedMemoryPool::~SharedMemoryPool() {}
+
+bool SharedMemoryPool::IsSupported() { return false; }
+
+absl::StatusOr<SharedMemoryRegion> SharedMemoryPool::Get(size_t /*size*/) {
+  return absl::UnimplementedError("shared memory is not supported");
+}
+
+void SharedMemoryPool::Put(SharedMemoryRegion /*region*/) {}
+
+void SharedMemoryPool::Release(SharedMemoryRegion /*region*/) {}
+
+// No file descriptors arrive where shared memory is unsupported, since
+// ReadableParcel::ReadFileDescriptor() is unimplemented there too.
+absl::StatusOr<std::string> ReadSharedMemory(int /*fd*/, int64_t /*size*/) {
+  return absl::UnimplementedError("shared memory is not supported");
+}
+
+#endif  // GRPC_BINDER_SHARED_MEMORY
+
+int32_t AdvertisedTransportFeatures() {
+#ifdef GPR_SUPPORT_BINDER_TRANSPORT
+  return SharedMemoryPool::IsSupported() ? kFeatureSharedMemoryMessages : 0;
+#else
+  return 0;
+#endif
+}
+
+}  // namespace grpc_binder
+
+#endif  // GRPC_NO_BINDER
@@ -0,0 +1,86 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_WIRE_FORMAT_SHARED_MEMORY_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_WIRE_FORMAT_SHARED_MEMORY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/statusor.h"
+
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_binder {
+
+// A sealed memfd, mapped for writing by the side that created it. The size
+// of the file is fixed at creation, so a reader can map it without fearing
+// that it shrinks underneath.
+struct SharedMemoryRegion {
+  int fd = -1;
+  size_t capacity = 0;
+  void* data = nullptr;
+};
+
+// Regions a wire writer copies large messages into. A region is handed out
+// by Get(), travels to the other end as a file descriptor, and is given back
+// with Put() once the other end has acknowledged consuming it, so that
+// steady streams of large messages reuse a few regions instead of creating
+// one per message.
+class SharedMemoryPool {
+ public:
+  SharedMemoryPool() = default;
+  ~SharedMemoryPool();
+
+  SharedMemoryPool(const SharedMemoryPool&) = delete;
+  SharedMemoryPool& operator=(const SharedMemoryPool&) = delete;
+
+  // Whether this platform can create regions at all.
+  static bool IsSupported();
+
+  // Returns a region of at least \a size bytes, reusing a free one if there
+  // is one large enough.
+  absl::StatusOr<SharedMemoryRegion> Get(size_t size);
+  // Gives \a region back for reuse. Regions beyond kMaxFreeRegions are
+  // released instead.
+  void Put(SharedMemoryRegion region);
+
+  // Releases \a region without returning it to any pool.
+  static void Release(SharedMemoryRegion region);
+
+ private:
+  static constexpr size_t kMaxFreeRegions = 4;
+
+  grpc_core::Mutex mu_;
+  std::vector<SharedMemoryRegion> free_ ABSL_GUARDED_BY(mu_);
+};
+
+// Copies \a size bytes out of the region behind \a fd, which the other end
+// sent with a message. Takes ownership of, and closes, \a fd.
+absl::StatusOr<std::string> ReadSharedMemory(int fd, int64_t size);
+
+// The features this end advertises in SETUP_TRANSPORT. Only the Android
+// binder advertises any, so that other Binder implementations see exactly the
+// SETUP_TRANSPORT fields they always have.
+int32_t AdvertisedTransportFeatures();
+
+}  // namespace grpc_binder
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_WIRE_FORMAT_SHARED_MEMORY_H
@@ -36,6 +36,10 @@ ABSL_CONST_INIT extern const int kFlagExpectSingleMessage;
 ABSL_CONST_INIT extern const int kFlagStatusDescription;
 ABSL_CONST_INIT extern const int kFlagMessageDataIsParcelable;
 ABSL_CONST_INIT extern const int kFlagMessageDataIsPartial;
+// The message data is a length and a file descriptor to shared memory holding
+// that many bytes, rather than bytes in the parcel. Only sent to peers that
+// advertised kFeatureSharedMemoryMessages.
+ABSL_CONST_INIT extern const int kFlagMessageDataInSharedMemory;
 
 using Metadata = std::vector<std::pair<std::string, std::string>>;
 
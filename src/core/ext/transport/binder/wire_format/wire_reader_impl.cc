@@ -31,6 +31,7 @@
 
 #include "src/core/ext/transport/binder/utils/transport_stream_receiver.h"
 #include "src/core/ext/transport/binder/wire_format/binder.h"
+#include "src/core/ext/transport/binder/wire_format/shared_memory.h"
 #include "src/core/ext/transport/binder/wire_format/wire_writer.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/status_helper.h"
@@ -67,8 +68,9 @@ WireReaderImpl::WireReaderImpl(
     std::shared_ptr<TransportStreamReceiver> transport_stream_receiver,
     bool is_client,
     std::shared_ptr<grpc::experimental::binder::SecurityPolicy> security_policy,
-    std::function<void()> on_destruct_callback)
+    std::function<void()> on_destruct_callback, int32_t peer_features)
     : transport_stream_receiver_(std::move(transport_stream_receiver)),
+      peer_features_(peer_features),
       is_client_(is_client),
       security_policy_(security_policy),
       on_destruct_callback_(on_destruct_callback) {}
@@ -86,7 +88,8 @@ std::shared_ptr<WireWriter> WireReaderImpl::SetupTransport(
     SendSetupTransport(binder.get());
     {
       grpc_core::MutexLock lock(&mu_);
-      wire_writer_ = std::make_shared<WireWriterImpl>(std::move(binder));
+      wire_writer_ =
+          std::make_shared<WireWriterImpl>(std::move(binder), peer_features_);
     }
     wire_writer_ready_notification_.Notify();
     return wire_writer_;
@@ -96,8 +99,8 @@ std::shared_ptr<WireWriter> WireReaderImpl::SetupTransport(
     {
       grpc_core::MutexLock lock(&mu_);
       connected_ = true;
-      wire_writer_ =
-          std::make_shared<WireWriterImpl>(std::move(other_end_binder));
+      wire_writer_ = std::make_shared<WireWriterImpl>(
+          std::move(other_end_binder), peer_features_);
     }
     wire_writer_ready_notification_.Notify();
     return wire_writer_;
@@ -127,6 +130,11 @@ void WireReaderImpl::SendSetupTransport(Binder* binder) {
   gpr_log(GPR_DEBUG, "tx_receiver = %p", tx_receiver_->GetRawBinder());
   gpr_log(GPR_DEBUG, "AParcel_writeStrongBinder = %d",
           writable_parcel->WriteBinder(tx_receiver_.get()).ok());
+  int32_t features = AdvertisedTransportFeatures();
+  if (features != 0) {
+    gpr_log(GPR_DEBUG, "write features = %d",
+            writable_parcel->WriteInt32(features).ok());
+  }
   gpr_log(GPR_DEBUG, "AIBinder_transact = %d",
           binder->Transact(BinderTransportTxCode::SETUP_TRANSPORT).ok());
 }
@@ -202,6 +210,13 @@ absl::Status WireReaderImpl::ProcessTransaction(transaction_code_t code,
       if (!binder) {
         return absl::InternalError("Read NULL binder from the parcel");
       }
+      // Peers that predate the feature set end the parcel here.
+      if (AdvertisedTransportFeatures() == 0 ||
+          !parcel->ReadInt32(&peer_features_).ok()) {
+        peer_features_ = 0;
+      }
+      gpr_log(GPR_DEBUG, "The other end supports features = %d",
+              peer_features_);
       binder->Initialize();
       other_end_binder_ = std::move(binder);
       connection_noti_.Notify();
@@ -385,12 +400,25 @@ absl::Status WireReaderImpl::ProcessStreamingTransactionImpl(
     *cancellation_flags &= ~kFlagPrefix;
   }
   if (flags & kFlagMessageData) {
-    int count;
-    GRPC_RETURN_IF_ERROR(parcel->ReadInt32(&count));
-    gpr_log(GPR_DEBUG, "count = %d", count);
     std::string msg_data{};
-    if (count > 0) {
-      GRPC_RETURN_IF_ERROR(parcel->ReadByteArray(&msg_data));
+    if (flags & kFlagMessageDataInSharedMemory) {
+      int64_t size;
+      GRPC_RETURN_IF_ERROR(parcel->ReadInt64(&size));
+      int fd;
+      GRPC_RETURN_IF_ERROR(parcel->ReadFileDescriptor(&fd));
+      gpr_log(GPR_DEBUG, "shared memory size = %" PRId64, size);
+      absl::StatusOr<std::string> data = ReadSharedMemory(fd, size);
+      if (!data.ok()) return data.status();
+      msg_data = std::move(*data);
+      // The other end counts these bytes against its flow control window.
+      num_incoming_bytes_ += size;
+    } else {
+      int count;
+      GRPC_RETURN_IF_ERROR(parcel->ReadInt32(&count));
+      gpr_log(GPR_DEBUG, "count = %d", count);
+      if (count > 0) {
+        GRPC_RETURN_IF_ERROR(parcel->ReadByteArray(&msg_data));
+      }
     }
     message_buffer_[code] += msg_data;
     if ((flags & kFlagMessageDataIsPartial) == 0) {
@@ -39,7 +39,8 @@ class WireReaderImpl : public WireReader {
       bool is_client,
       std::shared_ptr<grpc::experimental::binder::SecurityPolicy>
           security_policy,
-      std::function<void()> on_destruct_callback = nullptr);
+      std::function<void()> on_destruct_callback = nullptr,
+      int32_t peer_features = 0);
   ~WireReaderImpl() override;
 
   void Orphan() override { Unref(); }
@@ -109,6 +110,9 @@ class WireReaderImpl : public WireReader {
   grpc_core::Mutex mu_;
   std::atomic_bool connected_{false};
   bool recvd_setup_transport_ ABSL_GUARDED_BY(mu_) = false;
+  // Features the other end advertised in its SETUP_TRANSPORT. The server
+  // reads the client's before constructing the transport, and passes them in.
+  int32_t peer_features_ ABSL_GUARDED_BY(mu_);
   // NOTE: other_end_binder_ will be moved out when RecvSetupTransport() is
   // called. Be cautious not to access it afterward.
   std::unique_ptr<Binder> other_end_binder_;
@@ -18,6 +18,8 @@
 
 #ifndef GRPC_NO_BINDER
 
+#include <string.h>
+
 #include <utility>
 
 #include "absl/cleanup/cleanup.h"
@@ -83,8 +85,13 @@ absl::Status WriteTrailingMetadata(const Transaction& tx,
   return absl::OkStatus();
 }
 
-WireWriterImpl::WireWriterImpl(std::unique_ptr<Binder> binder)
-    : binder_(std::move(binder)), combiner_(grpc_combiner_create()) {}
+WireWriterImpl::WireWriterImpl(std::unique_ptr<Binder> binder,
+                               int32_t peer_features)
+    : binder_(std::move(binder)),
+      use_shared_memory_(
+          (peer_features & kFeatureSharedMemoryMessages) != 0 &&
+          SharedMemoryPool::IsSupported()),
+      combiner_(grpc_combiner_create()) {}
 
 WireWriterImpl::~WireWriterImpl() {
   GRPC_COMBINER_UNREF(combiner_, "wire_writer_impl");
@@ -92,16 +99,21 @@ WireWriterImpl::~WireWriterImpl() {
     delete pending_outgoing_tx_.front();
     pending_outgoing_tx_.pop();
   }
+  for (auto& region : regions_in_flight_) {
+    SharedMemoryPool::Release(region.second);
+  }
 }
 
 // Flow control constant are specified at
 // https://github.com/grpc/proposal/blob/master/L73-java-binderchannel/wireformat.md#flow-control
 const int64_t WireWriterImpl::kBlockSize = 16 * 1024;
 const int64_t WireWriterImpl::kFlowControlWindowSize = 128 * 1024;
+const int64_t WireWriterImpl::kSharedMemoryThreshold = 64 * 1024;
 
 absl::Status WireWriterImpl::MakeBinderTransaction(
     BinderTransportTxCode tx_code,
-    std::function<absl::Status(WritableParcel*)> fill_parcel) {
+    std::function<absl::Status(WritableParcel*)> fill_parcel,
+    int64_t out_of_parcel_bytes) {
   grpc_core::MutexLock lock(&write_mu_);
   RETURN_IF_ERROR(binder_->PrepareTransaction());
   WritableParcel* parcel = binder_->GetWritableParcel();
@@ -116,7 +128,7 @@ absl::Status WireWriterImpl::MakeBinderTransaction(
               "transaction buffer. Size: %" PRId64 " bytes",
               parcel_size);
     }
-    num_outgoing_bytes_ += parcel_size;
+    num_outgoing_bytes_ += parcel_size + out_of_parcel_bytes;
     gpr_log(GPR_INFO, "Total outgoing bytes: %" PRId64,
             num_outgoing_bytes_.load());
   }
@@ -148,6 +160,48 @@ absl::Status WireWriterImpl::RpcCallFastPath(std::unique_ptr<Transaction> tx) {
       });
 }
 
+absl::Status WireWriterImpl::RpcCallSharedMemory(
+    std::unique_ptr<Transaction> tx, SharedMemoryRegion region) {
+  absl::string_view data = tx->GetMessageData();
+  GPR_ASSERT(data.size() <= region.capacity);
+  memcpy(region.data, data.data(), data.size());
+  const int64_t size = data.size();
+  absl::Status result = MakeBinderTransaction(
+      static_cast<BinderTransportTxCode>(tx->GetTxCode()),
+      [this, tx = tx.get(), size, fd = region.fd](
+          WritableParcel* parcel) ABSL_EXCLUSIVE_LOCKS_REQUIRED(write_mu_) {
+        const int flags = tx->GetFlags() | kFlagMessageDataInSharedMemory;
+        RETURN_IF_ERROR(parcel->WriteInt32(flags));
+        RETURN_IF_ERROR(parcel->WriteInt32(next_seq_num_[tx->GetTxCode()]++));
+        if (tx->GetFlags() & kFlagPrefix) {
+          RETURN_IF_ERROR(WriteInitialMetadata(*tx, parcel));
+        }
+        RETURN_IF_ERROR(parcel->WriteInt64(size));
+        RETURN_IF_ERROR(parcel->WriteFileDescriptor(fd));
+        if (tx->GetFlags() & kFlagSuffix) {
+          RETURN_IF_ERROR(WriteTrailingMetadata(*tx, parcel));
+        }
+        return absl::OkStatus();
+      },
+      /*out_of_parcel_bytes=*/size);
+  if (!result.ok()) {
+    shared_memory_pool_.Put(region);
+    return result;
+  }
+  // Stream transactions are only made from the combiner, so nothing else has
+  // been counted in `num_outgoing_bytes_` since this one.
+  const int64_t acked_when = num_outgoing_bytes_;
+  bool done;
+  {
+    grpc_core::MutexLock lock(&flow_control_mu_);
+    // The other end may already have acknowledged it.
+    done = num_acknowledged_bytes_ >= acked_when;
+    if (!done) regions_in_flight_.emplace_back(acked_when, region);
+  }
+  if (done) shared_memory_pool_.Put(region);
+  return absl::OkStatus();
+}
+
 absl::Status WireWriterImpl::RunStreamTx(
     RunScheduledTxArgs::StreamTx* stream_tx, WritableParcel* parcel,
     bool* is_last_chunk) {
@@ -236,6 +290,26 @@ void WireWriterImpl::RunScheduledTxInternal(RunScheduledTxArgs* args) {
     // New transaction might be ready to be scheduled.
     TryScheduleTransaction();
   });
+  if (use_shared_memory_ && stream_tx->bytes_sent == 0 &&
+      (stream_tx->tx->GetFlags() & kFlagMessageData) != 0 &&
+      static_cast<int64_t>(stream_tx->tx->GetMessageData().size()) >=
+          kSharedMemoryThreshold) {
+    absl::StatusOr<SharedMemoryRegion> region =
+        shared_memory_pool_.Get(stream_tx->tx->GetMessageData().size());
+    if (region.ok()) {
+      absl::Status result =
+          RpcCallSharedMemory(std::move(stream_tx->tx), *region);
+      if (!result.ok()) {
+        gpr_log(GPR_ERROR, "Failed to send RPC call in shared memory %s",
+                result.ToString().c_str());
+      }
+      delete args;
+      return;
+    }
+    // Fall back to sending the message in chunks.
+    gpr_log(GPR_ERROR, "Failed to get shared memory %s",
+            region.status().ToString().c_str());
+  }
   if (CanBeSentInOneTransaction(*stream_tx->tx.get())) {  // NOLINT
     absl::Status result = RpcCallFastPath(std::move(stream_tx->tx));
     if (!result.ok()) {
@@ -330,6 +404,7 @@ void WireWriterImpl::OnAckReceived(int64_t num_bytes) {
   // the callback to notify us about new incoming binder transaction when we are
   // sending transaction. i.e. `write_mu_` might have already been acquired by
   // this thread.
+  std::vector<SharedMemoryRegion> consumed_regions;
   {
     grpc_core::MutexLock lock(&flow_control_mu_);
     num_acknowledged_bytes_ = std::max(num_acknowledged_bytes_, num_bytes);
@@ -340,6 +415,14 @@ void WireWriterImpl::OnAckReceived(int64_t num_bytes) {
               "%" PRId64 " > %" PRId64,
               num_acknowledged_bytes_, num_outgoing_bytes);
     }
+    while (!regions_in_flight_.empty() &&
+           regions_in_flight_.front().first <= num_acknowledged_bytes_) {
+      consumed_regions.push_back(regions_in_flight_.front().second);
+      regions_in_flight_.pop_front();
+    }
+  }
+  for (const SharedMemoryRegion& region : consumed_regions) {
+    shared_memory_pool_.Put(region);
   }
   TryScheduleTransaction();
 }
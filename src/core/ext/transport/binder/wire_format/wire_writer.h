@@ -17,13 +17,16 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <deque>
 #include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
 
 #include "src/core/ext/transport/binder/wire_format/binder.h"
+#include "src/core/ext/transport/binder/wire_format/shared_memory.h"
 #include "src/core/ext/transport/binder/wire_format/transaction.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/combiner.h"
@@ -41,7 +44,10 @@ class WireWriter {
 
 class WireWriterImpl : public WireWriter {
  public:
-  explicit WireWriterImpl(std::unique_ptr<Binder> binder);
+  // \a peer_features is the feature set the other end advertised in
+  // SETUP_TRANSPORT.
+  explicit WireWriterImpl(std::unique_ptr<Binder> binder,
+                          int32_t peer_features = 0);
   ~WireWriterImpl() override;
   absl::Status RpcCall(std::unique_ptr<Transaction> tx) override;
   absl::Status SendAck(int64_t num_bytes) override;
@@ -73,15 +79,27 @@ class WireWriterImpl : public WireWriter {
   // Flow control allows sending at most 128k between acknowledgements.
   static const int64_t kFlowControlWindowSize;
 
+  // Messages of at least this size are written once into shared memory, and
+  // sent as a file descriptor instead of in `kBlockSize` chunks, when the
+  // other end supports it.
+  static const int64_t kSharedMemoryThreshold;
+
  private:
   // Fast path: send data in one transaction.
   absl::Status RpcCallFastPath(std::unique_ptr<Transaction> tx);
 
+  // Send the message data of `tx` in `region`, in one transaction.
+  absl::Status RpcCallSharedMemory(std::unique_ptr<Transaction> tx,
+                                   SharedMemoryRegion region);
+
   // This function will acquire `write_mu_` to make sure the binder is not used
   // concurrently, so this can be called by different threads safely.
+  // `out_of_parcel_bytes` is the size of data the transaction refers to but
+  // does not carry, which flow control accounts for like bytes in the parcel.
   absl::Status MakeBinderTransaction(
       BinderTransportTxCode tx_code,
-      std::function<absl::Status(WritableParcel*)> fill_parcel);
+      std::function<absl::Status(WritableParcel*)> fill_parcel,
+      int64_t out_of_parcel_bytes = 0);
 
   // Send a stream to `binder_`. Set `is_last_chunk` to `true` if the stream
   // transaction has been sent completely. Otherwise set to `false`.
@@ -114,6 +132,14 @@ class WireWriterImpl : public WireWriter {
       ABSL_GUARDED_BY(flow_control_mu_);
   int num_non_acked_tx_in_combiner_ ABSL_GUARDED_BY(flow_control_mu_) = 0;
 
+  const bool use_shared_memory_;
+  SharedMemoryPool shared_memory_pool_;
+  // Regions sent to the other end, each with the value `num_outgoing_bytes_`
+  // had after sending it. A region goes back to the pool once the other end
+  // acknowledges that many bytes, since it has then copied the message out.
+  std::deque<std::pair<int64_t, SharedMemoryRegion>> regions_in_flight_
+      ABSL_GUARDED_BY(flow_control_mu_);
+
   // Helper variable for determining if we are currently calling into
   // `Binder::Transact`. Useful for avoiding the attempt of acquiring
   // `write_mu_` multiple times on the same thread.
@@ -0,0 +1,430 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/chaotic_good/client_transport.h"
+
+#include <deque>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
+#include "absl/types/variant.h"
+
+#include <grpc/slice_buffer.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/event_engine/default_event_engine.h"  // IWYU pragma: keep
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/party.h"
+#include "src/core/lib/promise/pipe.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/promise/try_join.h"
+#include "src/core/lib/promise/try_seq.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice_buffer.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+using grpc_event_engine::experimental::EventEngine;
+
+namespace {
+// Holds the allocator backing a party's arena, so that it outlives the arena
+// regardless of what the participants of the party keep alive.
+class PartyAllocatorOwner {
+ protected:
+  MemoryAllocator memory_allocator_ = MemoryAllocator(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+          "chaotic_good_client_transport_party"));
+};
+}  // namespace
+
+// Runs the reader and writer loops of the transport.
+class ClientTransport::TransportParty final : private PartyAllocatorOwner,
+                                              public Party {
+ public:
+  explicit TransportParty(std::shared_ptr<EventEngine> event_engine)
+      : Party(Arena::Create(1024, &memory_allocator_)),
+        event_engine_(std::move(event_engine)) {}
+
+  std::string DebugTag() const override {
+    return "ChaoticGoodClientTransport";
+  }
+
+  void Run() override {
+    promise_detail::Context<EventEngine> event_engine_ctx(event_engine_.get());
+    Party::Run();
+  }
+
+ private:
+  const std::shared_ptr<EventEngine> event_engine_;
+};
+
+// One call on the transport.
+// Allocated on the call arena and polled from the call activity.
+class ClientTransport::Stream final : public Orphanable {
+ public:
+  Stream(RefCountedPtr<ClientTransport> transport, CallArgs call_args)
+      : transport_(std::move(transport)),
+        arena_(GetContext<Arena>()),
+        client_initial_metadata_(std::move(call_args.client_initial_metadata)),
+        server_initial_metadata_(call_args.server_initial_metadata),
+        client_to_server_messages_(call_args.client_to_server_messages),
+        server_to_client_messages_(call_args.server_to_client_messages) {
+    MutexLock lock(&transport_->mu_);
+    id_ = transport_->next_stream_id_++;
+    transport_->streams_.emplace(id_, this);
+  }
+
+  void Orphan() override {
+    Waker writer_waker;
+    {
+      MutexLock lock(&transport_->mu_);
+      transport_->streams_.erase(id_);
+      // Let the server know we are no longer interested in a call it has heard
+      // of and not yet finished.
+      if (!finished_ && client_initial_metadata_ == nullptr) {
+        CancelFrame frame;
+        frame.stream_id = id_;
+        writer_waker = transport_->QueueFrame(frame);
+      }
+      incoming_.clear();
+    }
+    writer_waker.Wakeup();
+    this->~Stream();
+  }
+
+  Arena* arena() const { return arena_; }
+
+  Poll<ServerMetadataHandle> PollOnce() {
+    PollSend();
+    return PollReceive();
+  }
+
+ private:
+  friend class ClientTransport;
+
+  void PollSend() {
+    if (sent_end_of_stream_) return;
+    ClientFragmentFrame frame;
+    frame.stream_id = id_;
+    if (client_initial_metadata_ != nullptr) {
+      frame.headers = std::move(client_initial_metadata_);
+      Queue(frame);
+      frame.headers.reset();
+    }
+    while (!sent_end_of_stream_) {
+      if (!next_message_.has_value()) {
+        {
+          MutexLock lock(&transport_->mu_);
+          if (!transport_->PollWriteSpace()) return;
+        }
+        next_message_.emplace(client_to_server_messages_->Next());
+      }
+      auto r = (*next_message_)();
+      auto* p = absl::get_if<NextResult<MessageHandle>>(&r);
+      if (p == nullptr) return;
+      // No value => half close from above.
+      if (p->has_value()) {
+        frame.message = std::move(**p);
+      } else {
+        frame.end_of_stream = true;
+        sent_end_of_stream_ = true;
+      }
+      next_message_.reset();
+      Queue(frame);
+      frame.message.reset();
+    }
+  }
+
+  void Queue(const ClientFragmentFrame& frame) {
+    Waker writer_waker;
+    {
+      MutexLock lock(&transport_->mu_);
+      writer_waker = transport_->QueueFrame(frame);
+    }
+    writer_waker.Wakeup();
+  }
+
+  Poll<ServerMetadataHandle> PollReceive() {
+    while (true) {
+      if (push_server_initial_metadata_.has_value()) {
+        auto r = (*push_server_initial_metadata_)();
+        if (absl::holds_alternative<Pending>(r)) return Pending{};
+        push_server_initial_metadata_.reset();
+      }
+      if (push_message_.has_value()) {
+        auto r = (*push_message_)();
+        if (absl::holds_alternative<Pending>(r)) return Pending{};
+        push_message_.reset();
+      }
+      if (!frame_.has_value()) {
+        ReleasableMutexLock lock(&transport_->mu_);
+        if (!incoming_.empty()) {
+          frame_.emplace(std::move(incoming_.front()));
+          incoming_.pop_front();
+        } else if (!transport_->error_.ok()) {
+          absl::Status error = transport_->error_;
+          lock.Release();
+          finished_ = true;
+          return ServerMetadataFromStatus(error);
+        } else {
+          waker_ = Activity::current()->MakeNonOwningWaker();
+          return Pending{};
+        }
+      }
+      // Deliver the parts of each frame in the order the server sent them.
+      if (frame_->headers != nullptr) {
+        received_server_initial_metadata_ = true;
+        push_server_initial_metadata_.emplace(
+            server_initial_metadata_->Push(std::move(frame_->headers)));
+        continue;
+      }
+      if (frame_->message != nullptr) {
+        push_message_.emplace(
+            server_to_client_messages_->Push(std::move(frame_->message)));
+        continue;
+      }
+      if (frame_->trailers != nullptr) {
+        ServerMetadataHandle trailers = std::move(frame_->trailers);
+        frame_.reset();
+        finished_ = true;
+        if (!received_server_initial_metadata_) {
+          server_initial_metadata_->Close();
+        }
+        server_to_client_messages_->Close();
+        return std::move(trailers);
+      }
+      frame_.reset();
+    }
+  }
+
+  const RefCountedPtr<ClientTransport> transport_;
+  Arena* const arena_;
+  uint32_t id_;
+  ClientMetadataHandle client_initial_metadata_;
+  PipeSender<ServerMetadataHandle>* const server_initial_metadata_;
+  PipeReceiver<MessageHandle>* const client_to_server_messages_;
+  PipeSender<MessageHandle>* const server_to_client_messages_;
+  absl::optional<PipeReceiverNextType<MessageHandle>> next_message_;
+  bool sent_end_of_stream_ = false;
+  // Frames received for this call and not yet delivered, guarded by
+  // transport_->mu_.
+  std::deque<ServerFragmentFrame> incoming_;
+  // Woken when a frame is received, guarded by transport_->mu_.
+  Waker waker_;
+  // The frame being delivered.
+  absl::optional<ServerFragmentFrame> frame_;
+  absl::optional<PipeSender<ServerMetadataHandle>::PushType>
+      push_server_initial_metadata_;
+  absl::optional<PipeSender<MessageHandle>::PushType> push_message_;
+  bool received_server_initial_metadata_ = false;
+  bool finished_ = false;
+};
+
+class ClientTransport::CallPromise {
+ public:
+  CallPromise(RefCountedPtr<ClientTransport> transport, CallArgs call_args)
+      : impl_(GetContext<Arena>()->New<Stream>(std::move(transport),
+                                               std::move(call_args))) {}
+
+  CallPromise(const CallPromise&) = delete;
+  CallPromise& operator=(const CallPromise&) = delete;
+  CallPromise(CallPromise&& other) noexcept = default;
+  CallPromise& operator=(CallPromise&& other) noexcept = default;
+
+  Poll<ServerMetadataHandle> operator()() { return impl_->PollOnce(); }
+
+ private:
+  OrphanablePtr<Stream> impl_;
+};
+
+auto ClientTransport::NextWrite() {
+  return [this]() -> Poll<BufferPair> {
+    ReleasableMutexLock lock(&mu_);
+    if (outgoing_.control.Length() == 0 && outgoing_.data.Length() == 0) {
+      writer_waker_ = Activity::current()->MakeNonOwningWaker();
+      return Pending{};
+    }
+    // Take everything queued so far: all frames go out in one write per
+    // endpoint.
+    BufferPair buffers{std::move(outgoing_.control), std::move(outgoing_.data)};
+    auto wakeup = write_space_waiters_.TakeWakeupSet();
+    lock.Release();
+    wakeup.Wakeup();
+    return std::move(buffers);
+  };
+}
+
+auto ClientTransport::WriteLoop() {
+  return Loop([self = Ref()]() {
+    return TrySeq(
+        self->NextWrite(),
+        [self](BufferPair buffers) {
+          return TryJoin(
+              self->control_endpoint_->Write(std::move(buffers.control)),
+              self->data_endpoint_->Write(std::move(buffers.data)));
+        },
+        []() -> absl::StatusOr<LoopCtl<absl::Status>> { return Continue{}; });
+  });
+}
+
+auto ClientTransport::ReadLoop() {
+  return Loop([self = Ref()]() {
+    return TrySeq(
+        self->control_endpoint_->Read(64),
+        [](SliceBuffer header_bytes) {
+          uint8_t buffer[64];
+          header_bytes.MoveFirstNBytesIntoBuffer(64, buffer);
+          return FrameHeader::Parse(buffer);
+        },
+        [self](FrameHeader header) {
+          const FrameSizes sizes = header.ComputeFrameSizes();
+          return Map(
+              TryJoin(self->control_endpoint_->Read(sizes.control_length),
+                      self->data_endpoint_->Read(sizes.data_length)),
+              [self, header](
+                  absl::StatusOr<std::tuple<SliceBuffer, SliceBuffer>> buffers)
+                  -> absl::StatusOr<LoopCtl<absl::Status>> {
+                if (!buffers.ok()) return buffers.status();
+                absl::Status status = self->DispatchFrame(
+                    header, BufferPair{std::move(std::get<0>(*buffers)),
+                                       std::move(std::get<1>(*buffers))});
+                if (!status.ok()) return status;
+                return Continue{};
+              });
+        });
+  });
+}
+
+ClientTransport::ClientTransport(
+    std::unique_ptr<PromiseEndpoint> control_endpoint,
+    std::unique_ptr<PromiseEndpoint> data_endpoint,
+    std::shared_ptr<EventEngine> event_engine)
+    : control_endpoint_(std::move(control_endpoint)),
+      data_endpoint_(std::move(data_endpoint)),
+      event_engine_(std::move(event_engine)),
+      memory_allocator_(
+          ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+              "chaotic_good_client_transport")),
+      party_(MakeOrphanable<TransportParty>(event_engine_)) {
+  party_->Spawn(WriteLoop(), [self = Ref()](absl::Status status) {
+    self->AbortWithError(std::move(status));
+  });
+  party_->Spawn(ReadLoop(), [self = Ref()](absl::Status status) {
+    self->AbortWithError(std::move(status));
+  });
+}
+
+ClientTransport::~ClientTransport() = default;
+
+void ClientTransport::Orphan() {
+  AbortWithError(absl::UnavailableError("Transport closed"));
+  party_.reset();
+  Unref();
+}
+
+ArenaPromise<ServerMetadataHandle> ClientTransport::MakeCallPromise(
+    CallArgs call_args) {
+  return CallPromise(Ref(), std::move(call_args));
+}
+
+Waker ClientTransport::QueueFrame(const FrameInterface& frame) {
+  if (!error_.ok()) return Waker();
+  BufferPair buffers = frame.Serialize(&hpack_compressor_);
+  grpc_slice_buffer_move_into(buffers.control.c_slice_buffer(),
+                              outgoing_.control.c_slice_buffer());
+  grpc_slice_buffer_move_into(buffers.data.c_slice_buffer(),
+                              outgoing_.data.c_slice_buffer());
+  return std::move(writer_waker_);
+}
+
+bool ClientTransport::PollWriteSpace() {
+  if (!error_.ok() ||
+      outgoing_.control.Length() + outgoing_.data.Length() < kMaxQueuedBytes) {
+    return true;
+  }
+  write_space_waiters_.AddPending(Activity::current()->MakeNonOwningWaker());
+  return false;
+}
+
+absl::Status ClientTransport::DispatchFrame(const FrameHeader& header,
+                                            BufferPair buffers) {
+  switch (header.type) {
+    case FrameType::kFragment:
+      break;
+    case FrameType::kSettings:
+      // No settings are defined yet.
+      return absl::OkStatus();
+    default:
+      return absl::InternalError(
+          absl::StrCat("Unexpected frame type from server: ",
+                       static_cast<int>(header.type)));
+  }
+  ReleasableMutexLock lock(&mu_);
+  auto it = streams_.find(header.stream_id);
+  Stream* stream = it == streams_.end() ? nullptr : it->second;
+  // Frames for calls that are gone must still be parsed to keep the HPACK
+  // table in sync with the server.
+  ScopedArenaPtr scratch_arena;
+  Arena* arena;
+  if (stream != nullptr) {
+    arena = stream->arena();
+  } else {
+    scratch_arena = MakeScopedArena(1024, &memory_allocator_);
+    arena = scratch_arena.get();
+  }
+  ServerFragmentFrame frame;
+  {
+    promise_detail::Context<Arena> arena_ctx(arena);
+    absl::Status status = frame.Deserialize(&hpack_parser_, header, buffers);
+    if (!status.ok()) return status;
+  }
+  if (stream == nullptr) return absl::OkStatus();
+  stream->incoming_.push_back(std::move(frame));
+  Waker waker = std::move(stream->waker_);
+  lock.Release();
+  waker.Wakeup();
+  return absl::OkStatus();
+}
+
+void ClientTransport::AbortWithError(absl::Status status) {
+  if (status.ok()) status = absl::UnavailableError("Transport closed");
+  std::vector<Waker> wakers;
+  ReleasableMutexLock lock(&mu_);
+  if (!error_.ok()) return;
+  error_ = std::move(status);
+  for (auto& stream : streams_) {
+    wakers.push_back(std::move(stream.second->waker_));
+  }
+  auto wakeup = write_space_waiters_.TakeWakeupSet();
+  outgoing_.control.Clear();
+  outgoing_.data.Clear();
+  lock.Release();
+  wakeup.Wakeup();
+  for (auto& waker : wakers) waker.Wakeup();
+}
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
@@ -0,0 +1,118 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CLIENT_TRANSPORT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CLIENT_TRANSPORT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/ext/transport/chaotic_good/frame.h"
+#include "src/core/ext/transport/chaotic_good/frame_header.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/promise/wait_set.h"
+#include "src/core/lib/transport/promise_endpoint.h"
+#include "src/core/lib/transport/transport.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+// Client side of a chaotic good connection.
+// Frame headers and metadata travel on the control endpoint, message payloads
+// on the data endpoint, so that a large message never delays the metadata of
+// other calls and is never copied on its way through the transport.
+// One reader and one writer loop run on an internal party; calls serialize
+// their frames directly into a shared write queue that the writer drains with
+// a single write per endpoint, however many frames are pending.
+class ClientTransport final : public InternallyRefCounted<ClientTransport> {
+ public:
+  ClientTransport(
+      std::unique_ptr<PromiseEndpoint> control_endpoint,
+      std::unique_ptr<PromiseEndpoint> data_endpoint,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+  ~ClientTransport() override;
+
+  // Fails all outstanding calls and stops the reader and writer loops.
+  void Orphan() override;
+
+  // Start a call on this transport.
+  // Must be called from within the call's activity, with an arena context.
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(CallArgs call_args);
+
+ private:
+  class Stream;
+  class CallPromise;
+  class TransportParty;
+
+  // Once this many bytes are queued for writing calls stop sending messages
+  // until the writer catches up.
+  static constexpr size_t kMaxQueuedBytes = 4 * 1024 * 1024;
+
+  auto NextWrite();
+  auto WriteLoop();
+  auto ReadLoop();
+
+  // Serialize frame and queue it for the writer loop.
+  // Returns the waker of the writer loop, to be woken once mu_ is released.
+  GRPC_MUST_USE_RESULT Waker QueueFrame(const FrameInterface& frame)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Returns true if a call may queue more messages, otherwise arranges for the
+  // current activity to be woken once it can.
+  bool PollWriteSpace() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Hand one frame read from the endpoints to the stream it belongs to.
+  absl::Status DispatchFrame(const FrameHeader& header, BufferPair buffers)
+      ABSL_LOCKS_EXCLUDED(mu_);
+  // Mark the transport as broken and wake up everything waiting on it.
+  void AbortWithError(absl::Status status) ABSL_LOCKS_EXCLUDED(mu_);
+
+  const std::unique_ptr<PromiseEndpoint> control_endpoint_;
+  const std::unique_ptr<PromiseEndpoint> data_endpoint_;
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+  MemoryAllocator memory_allocator_;
+  Mutex mu_;
+  uint32_t next_stream_id_ ABSL_GUARDED_BY(mu_) = 1;
+  absl::flat_hash_map<uint32_t, Stream*> streams_ ABSL_GUARDED_BY(mu_);
+  // Set once and for all when the transport breaks.
+  absl::Status error_ ABSL_GUARDED_BY(mu_);
+  HPackCompressor hpack_compressor_ ABSL_GUARDED_BY(mu_);
+  // Frames serialized but not yet handed to the endpoints.
+  BufferPair outgoing_ ABSL_GUARDED_BY(mu_);
+  Waker writer_waker_ ABSL_GUARDED_BY(mu_);
+  WaitSet write_space_waiters_ ABSL_GUARDED_BY(mu_);
+  // Only used by the reader loop.
+  HPackParser hpack_parser_;
+  OrphanablePtr<TransportParty> party_;
+};
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CLIENT_TRANSPORT_H
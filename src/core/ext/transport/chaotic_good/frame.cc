@@ -48,93 +48,97 @@ class FrameSerializer {
  public:
   explicit FrameSerializer(FrameType type, uint32_t stream_id)
       : header_{type, {}, stream_id, 0, 0, 0} {
-    output_.AppendIndexed(kZeroSlice->Copy());
+    output_.control.AppendIndexed(kZeroSlice->Copy());
   }
   // If called, must be called before AddMessage, AddTrailers, Finish
   SliceBuffer& AddHeaders() {
     GPR_ASSERT(last_added_ == nullptr);
     header_.flags.set(0);
-    return Start(&header_.header_length);
+    return Start(&output_.control, &header_.header_length);
   }
   // If called, must be called before AddTrailers, Finish
   SliceBuffer& AddMessage() {
     MaybeCommitLast();
     header_.flags.set(1);
-    return Start(&header_.message_length);
+    return Start(&output_.data, &header_.message_length);
   }
   // If called, must be called before Finish
   SliceBuffer& AddTrailers() {
     MaybeCommitLast();
     header_.flags.set(2);
-    return Start(&header_.trailer_length);
+    return Start(&output_.control, &header_.trailer_length);
   }
 
-  SliceBuffer Finish() {
+  BufferPair Finish() {
     MaybeCommitLast();
     header_.Serialize(
-        GRPC_SLICE_START_PTR(output_.c_slice_buffer()->slices[0]));
+        GRPC_SLICE_START_PTR(output_.control.c_slice_buffer()->slices[0]));
     return std::move(output_);
   }
 
  private:
-  SliceBuffer& Start(uint32_t* length_field) {
+  SliceBuffer& Start(SliceBuffer* buffer, uint32_t* length_field) {
     last_added_ = length_field;
-    length_at_last_added_ = output_.Length();
-    return output_;
+    last_buffer_ = buffer;
+    length_at_last_added_ = buffer->Length();
+    return *buffer;
   }
 
   void MaybeCommitLast() {
     if (last_added_ == nullptr) return;
-    *last_added_ = output_.Length() - length_at_last_added_;
-    if (output_.Length() % 64 != 0) {
-      output_.Append(kZeroSlice->RefSubSlice(0, 64 - output_.Length() % 64));
+    *last_added_ = last_buffer_->Length() - length_at_last_added_;
+    if (last_buffer_->Length() % 64 != 0) {
+      last_buffer_->Append(
+          kZeroSlice->RefSubSlice(0, 64 - last_buffer_->Length() % 64));
     }
   }
 
   FrameHeader header_;
 
   uint32_t* last_added_ = nullptr;
+  SliceBuffer* last_buffer_ = nullptr;
   size_t length_at_last_added_;
-  SliceBuffer output_;
+  BufferPair output_;
 };
 
 class FrameDeserializer {
  public:
-  FrameDeserializer(const FrameHeader& header, SliceBuffer& input)
+  FrameDeserializer(const FrameHeader& header, BufferPair& input)
       : header_(header), input_(input) {}
   const FrameHeader& header() const { return header_; }
   // If called, must be called before ReceiveMessage, ReceiveTrailers
   absl::StatusOr<SliceBuffer> ReceiveHeaders() {
-    return Take(header_.header_length);
+    return Take(input_.control, header_.header_length);
   }
   // If called, must be called before ReceiveTrailers
   absl::StatusOr<SliceBuffer> ReceiveMessage() {
-    return Take(header_.message_length);
+    return Take(input_.data, header_.message_length);
   }
   // If called, must be called before Finish
   absl::StatusOr<SliceBuffer> ReceiveTrailers() {
-    return Take(header_.trailer_length);
+    return Take(input_.control, header_.trailer_length);
   }
 
   absl::Status Finish() { return absl::OkStatus(); }
 
  private:
-  absl::StatusOr<SliceBuffer> Take(uint32_t length) {
+  static absl::StatusOr<SliceBuffer> Take(SliceBuffer& input,
+                                          uint32_t length) {
     if (length == 0) return SliceBuffer{};
-    if (input_.Length() < length) {
+    if (input.Length() < length) {
       return absl::InvalidArgumentError(
           "Frame too short (insufficient payload)");
     }
     SliceBuffer out;
-    input_.MoveFirstNBytesIntoSliceBuffer(length, out);
+    input.MoveFirstNBytesIntoSliceBuffer(length, out);
     if (length % 64 != 0) {
       const uint32_t padding_length = 64 - length % 64;
-      if (input_.Length() < padding_length) {
+      if (input.Length() < padding_length) {
         return absl::InvalidArgumentError(
             "Frame too short (insufficient padding)");
       }
       uint8_t padding[64];
-      input_.MoveFirstNBytesIntoBuffer(padding_length, padding);
+      input.MoveFirstNBytesIntoBuffer(padding_length, padding);
       for (uint32_t i = 0; i < padding_length; i++) {
         if (padding[i] != 0) {
           return absl::InvalidArgumentError("Frame padding not zero");
@@ -144,7 +148,7 @@ class FrameDeserializer {
     return std::move(out);
   }
   FrameHeader header_;
-  SliceBuffer& input_;
+  BufferPair& input_;
 };
 
 template <typename Metadata>
@@ -153,7 +157,8 @@ absl::StatusOr<Arena::PoolPtr<Metadata>> ReadMetadata(
     uint32_t stream_id, bool is_header, bool is_client) {
   if (!maybe_slices.ok()) return maybe_slices.status();
   auto& slices = *maybe_slices;
-  Arena::PoolPtr<Metadata> metadata;
+  Arena* arena = GetContext<Arena>();
+  Arena::PoolPtr<Metadata> metadata = arena->MakePooled<Metadata>(arena);
   parser->BeginFrame(
       metadata.get(), std::numeric_limits<uint32_t>::max(),
       is_header ? HPackParser::Boundary::EndOfHeaders
@@ -173,25 +178,25 @@ absl::StatusOr<Arena::PoolPtr<Metadata>> ReadMetadata(
 }  // namespace
 
 absl::Status SettingsFrame::Deserialize(HPackParser*, const FrameHeader& header,
-                                        SliceBuffer& slice_buffer) {
+                                        BufferPair& buffers) {
   if (header.type != FrameType::kSettings) {
     return absl::InvalidArgumentError("Expected settings frame");
   }
   if (header.flags.any()) {
     return absl::InvalidArgumentError("Unexpected flags");
   }
-  FrameDeserializer deserializer(header, slice_buffer);
+  FrameDeserializer deserializer(header, buffers);
   return deserializer.Finish();
 }
 
-SliceBuffer SettingsFrame::Serialize(HPackCompressor*) const {
+BufferPair SettingsFrame::Serialize(HPackCompressor*) const {
   FrameSerializer serializer(FrameType::kSettings, 0);
   return serializer.Finish();
 }
 
 absl::Status ClientFragmentFrame::Deserialize(HPackParser* parser,
                                               const FrameHeader& header,
-                                              SliceBuffer& slice_buffer) {
+                                              BufferPair& buffers) {
   if (header.stream_id == 0) {
     return absl::InvalidArgumentError("Expected non-zero stream id");
   }
@@ -199,11 +204,12 @@ absl::Status ClientFragmentFrame::Deserialize(HPackParser* parser,
   if (header.type != FrameType::kFragment) {
     return absl::InvalidArgumentError("Expected fragment frame");
   }
-  FrameDeserializer deserializer(header, slice_buffer);
+  FrameDeserializer deserializer(header, buffers);
   if (header.flags.is_set(0)) {
     auto r = ReadMetadata<ClientMetadata>(parser, deserializer.ReceiveHeaders(),
                                           header.stream_id, true, true);
     if (!r.ok()) return r.status();
+    headers = std::move(*r);
   }
   if (header.flags.is_set(1)) {
     message = GetContext<Arena>()->MakePooled<Message>();
@@ -222,7 +228,7 @@ absl::Status ClientFragmentFrame::Deserialize(HPackParser* parser,
   return deserializer.Finish();
 }
 
-SliceBuffer ClientFragmentFrame::Serialize(HPackCompressor* encoder) const {
+BufferPair ClientFragmentFrame::Serialize(HPackCompressor* encoder) const {
   GPR_ASSERT(stream_id != 0);
   FrameSerializer serializer(FrameType::kFragment, stream_id);
   if (headers.get() != nullptr) {
@@ -239,7 +245,7 @@ SliceBuffer ClientFragmentFrame::Serialize(HPackCompressor* encoder) const {
 
 absl::Status ServerFragmentFrame::Deserialize(HPackParser* parser,
                                               const FrameHeader& header,
-                                              SliceBuffer& slice_buffer) {
+                                              BufferPair& buffers) {
   if (header.stream_id == 0) {
     return absl::InvalidArgumentError("Expected non-zero stream id");
   }
@@ -247,11 +253,12 @@ absl::Status ServerFragmentFrame::Deserialize(HPackParser* parser,
   if (header.type != FrameType::kFragment) {
     return absl::InvalidArgumentError("Expected fragment frame");
   }
-  FrameDeserializer deserializer(header, slice_buffer);
+  FrameDeserializer deserializer(header, buffers);
   if (header.flags.is_set(0)) {
     auto r = ReadMetadata<ServerMetadata>(parser, deserializer.ReceiveHeaders(),
                                           header.stream_id, true, false);
     if (!r.ok()) return r.status();
+    headers = std::move(*r);
   }
   if (header.flags.is_set(1)) {
     message = GetContext<Arena>()->MakePooled<Message>();
@@ -262,11 +269,13 @@ absl::Status ServerFragmentFrame::Deserialize(HPackParser* parser,
   if (header.flags.is_set(2)) {
     auto r = ReadMetadata<ServerMetadata>(
         parser, deserializer.ReceiveTrailers(), header.stream_id, false, false);
+    if (!r.ok()) return r.status();
+    trailers = std::move(*r);
   }
   return deserializer.Finish();
 }
 
-SliceBuffer ServerFragmentFrame::Serialize(HPackCompressor* encoder) const {
+BufferPair ServerFragmentFrame::Serialize(HPackCompressor* encoder) const {
   GPR_ASSERT(stream_id != 0);
   FrameSerializer serializer(FrameType::kFragment, stream_id);
   if (headers.get() != nullptr) {
@@ -282,7 +291,7 @@ SliceBuffer ServerFragmentFrame::Serialize(HPackCompressor* encoder) const {
 }
 
 absl::Status CancelFrame::Deserialize(HPackParser*, const FrameHeader& header,
-                                      SliceBuffer& slice_buffer) {
+                                      BufferPair& buffers) {
   if (header.type != FrameType::kCancel) {
     return absl::InvalidArgumentError("Expected cancel frame");
   }
@@ -292,12 +301,12 @@ absl::Status CancelFrame::Deserialize(HPackParser*, const FrameHeader& header,
   if (header.stream_id == 0) {
     return absl::InvalidArgumentError("Expected non-zero stream id");
   }
-  FrameDeserializer deserializer(header, slice_buffer);
+  FrameDeserializer deserializer(header, buffers);
   stream_id = header.stream_id;
   return deserializer.Finish();
 }
 
-SliceBuffer CancelFrame::Serialize(HPackCompressor*) const {
+BufferPair CancelFrame::Serialize(HPackCompressor*) const {
   GPR_ASSERT(stream_id != 0);
   FrameSerializer serializer(FrameType::kCancel, stream_id);
   return serializer.Finish();
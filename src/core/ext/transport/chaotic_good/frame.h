@@ -35,12 +35,24 @@
 namespace grpc_core {
 namespace chaotic_good {
 
+// The bytes of a frame, split across the two endpoints of a connection.
+// The control endpoint carries the frame header and the metadata, the data
+// endpoint carries message payloads, so that large messages can be moved
+// around without ever being copied or parsed.
+struct BufferPair {
+  SliceBuffer control;
+  SliceBuffer data;
+};
+
 class FrameInterface {
  public:
+  // Deserialize a frame from its header and the bytes following it on each
+  // endpoint, as sized by header.ComputeFrameSizes().
   virtual absl::Status Deserialize(HPackParser* parser,
                                    const FrameHeader& header,
-                                   SliceBuffer& slice_buffer) = 0;
-  virtual SliceBuffer Serialize(HPackCompressor* encoder) const = 0;
+                                   BufferPair& buffers) = 0;
+  // Serialize a frame. The control buffer starts with the frame header.
+  virtual BufferPair Serialize(HPackCompressor* encoder) const = 0;
 
  protected:
   static bool EqVal(const Message& a, const Message& b) {
@@ -62,16 +74,16 @@ class FrameInterface {
 
 struct SettingsFrame final : public FrameInterface {
   absl::Status Deserialize(HPackParser* parser, const FrameHeader& header,
-                           SliceBuffer& slice_buffer) override;
-  SliceBuffer Serialize(HPackCompressor* encoder) const override;
+                           BufferPair& buffers) override;
+  BufferPair Serialize(HPackCompressor* encoder) const override;
 
   bool operator==(const SettingsFrame&) const { return true; }
 };
 
 struct ClientFragmentFrame final : public FrameInterface {
   absl::Status Deserialize(HPackParser* parser, const FrameHeader& header,
-                           SliceBuffer& slice_buffer) override;
-  SliceBuffer Serialize(HPackCompressor* encoder) const override;
+                           BufferPair& buffers) override;
+  BufferPair Serialize(HPackCompressor* encoder) const override;
 
   uint32_t stream_id;
   ClientMetadataHandle headers;
@@ -87,8 +99,8 @@ struct ClientFragmentFrame final : public FrameInterface {
 
 struct ServerFragmentFrame final : public FrameInterface {
   absl::Status Deserialize(HPackParser* parser, const FrameHeader& header,
-                           SliceBuffer& slice_buffer) override;
-  SliceBuffer Serialize(HPackCompressor* encoder) const override;
+                           BufferPair& buffers) override;
+  BufferPair Serialize(HPackCompressor* encoder) const override;
 
   uint32_t stream_id;
   ServerMetadataHandle headers;
@@ -103,8 +115,8 @@ struct ServerFragmentFrame final : public FrameInterface {
 
 struct CancelFrame final : public FrameInterface {
   absl::Status Deserialize(HPackParser* parser, const FrameHeader& header,
-                           SliceBuffer& slice_buffer) override;
-  SliceBuffer Serialize(HPackCompressor* encoder) const override;
+                           BufferPair& buffers) override;
+  BufferPair Serialize(HPackCompressor* encoder) const override;
 
   uint32_t stream_id;
 
@@ -32,15 +32,17 @@ enum class FrameType : uint8_t {
   kCancel = 0x81,
 };
 
+// Sizes of the parts of a frame that follow its header. Each part is padded
+// to a multiple of 64 bytes.
 struct FrameSizes {
-  uint64_t message_offset;
-  uint64_t trailer_offset;
-  uint64_t frame_length;
+  // Bytes on the control endpoint: the headers, then the trailers.
+  uint64_t control_length;
+  // Bytes on the data endpoint: the message.
+  uint64_t data_length;
 
   bool operator==(const FrameSizes& other) const {
-    return message_offset == other.message_offset &&
-           trailer_offset == other.trailer_offset &&
-           frame_length == other.frame_length;
+    return control_length == other.control_length &&
+           data_length == other.data_length;
   }
 };
 
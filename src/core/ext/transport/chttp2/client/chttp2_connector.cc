@@ -142,6 +142,10 @@ void Chttp2Connector::Shutdown(grpc_error_handle error) {
   }
 }
 
+OrphanablePtr<SubchannelConnector> Chttp2Connector::CreateSibling() {
+  return MakeOrphanable<Chttp2Connector>();
+}
+
 void Chttp2Connector::OnHandshakeDone(void* arg, grpc_error_handle error) {
   auto* args = static_cast<HandshakerArgs*>(arg);
   Chttp2Connector* self = static_cast<Chttp2Connector*>(args->user_data);
@@ -27,6 +27,7 @@
 #include <grpc/event_engine/event_engine.h>
 
 #include "src/core/ext/filters/client_channel/connector.h"
+#include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/closure.h"
@@ -42,6 +43,7 @@ class Chttp2Connector : public SubchannelConnector {
 
   void Connect(const Args& args, Result* result, grpc_closure* notify) override;
   void Shutdown(grpc_error_handle error) override;
+  OrphanablePtr<SubchannelConnector> CreateSibling() override;
 
  private:
   static void OnHandshakeDone(void* arg, grpc_error_handle error);
@@ -49,6 +49,7 @@
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
 #include "src/core/ext/transport/chttp2/transport/frame.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/shm/shm_handshaker.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channelz.h"
@@ -78,9 +79,11 @@
 #include "src/core/lib/security/security_connector/security_connector.h"
 #include "src/core/lib/surface/api_trace.h"
 #include "src/core/lib/surface/server.h"
+#include "src/core/lib/surface/server_connection_rebalancer.h"
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/handshaker.h"
 #include "src/core/lib/transport/handshaker_registry.h"
+#include "src/core/lib/transport/http2_errors.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/lib/transport/transport_fwd.h"
 #include "src/core/lib/uri/uri_parser.h"
@@ -96,6 +99,7 @@ namespace {
 
 const char kUnixUriPrefix[] = "unix:";
 const char kUnixAbstractUriPrefix[] = "unix-abstract:";
+const char kShmUriPrefix[] = "shm:";
 
 class Chttp2ServerListener : public Server::ListenerInterface {
  public:
@@ -184,7 +188,13 @@ class Chttp2ServerListener : public Server::ListenerInterface {
 
     void Orphan() override;
 
-    void SendGoAway();
+    // Sends a GOAWAY with error, and disconnects the transport if it is
+    // still up once the drain grace time is over.
+    void SendGoAway(grpc_error_handle error);
+
+    // Returns when the transport was set up, or nullopt while handshaking
+    // or once the connection has been shut down.
+    absl::optional<Timestamp> EstablishedTime();
 
     void Start(RefCountedPtr<Chttp2ServerListener> listener,
                grpc_endpoint* endpoint, const ChannelArgs& args);
@@ -205,6 +215,7 @@ class Chttp2ServerListener : public Server::ListenerInterface {
     // Set by HandshakingState when handshaking is done and a valid transport
     // is created.
     grpc_chttp2_transport* transport_ ABSL_GUARDED_BY(&mu_) = nullptr;
+    Timestamp established_time_ ABSL_GUARDED_BY(&mu_);
     grpc_closure on_close_;
     grpc_timer drain_grace_timer_;
     grpc_closure on_drain_grace_time_expiry_;
@@ -225,6 +236,12 @@ class Chttp2ServerListener : public Server::ListenerInterface {
 
   static void TcpServerShutdownComplete(void* arg, grpc_error_handle error);
 
+  void StartRebalanceTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  static void OnRebalanceTimer(void* arg, grpc_error_handle error);
+  // Sends GOAWAY to the oldest established connections, as many as
+  // connection_rebalancer_ asks for.
+  void ShedConnections();
+
   static void DestroyListener(Server* /*server*/, void* arg,
                               grpc_closure* destroy_done);
 
@@ -261,6 +278,9 @@ class Chttp2ServerListener : public Server::ListenerInterface {
   Chttp2ServerArgsModifier const args_modifier_;
   ConfigFetcherWatcher* config_fetcher_watcher_ = nullptr;
   ChannelArgs args_;
+  // Null unless the server sheds connections under load. Established
+  // connections then stay in connections_ until they close.
+  RefCountedPtr<ServerConnectionRebalancer> const connection_rebalancer_;
   Mutex mu_;
   RefCountedPtr<grpc_server_config_fetcher::ConnectionManager>
       connection_manager_ ABSL_GUARDED_BY(mu_);
@@ -276,6 +296,9 @@ class Chttp2ServerListener : public Server::ListenerInterface {
       ABSL_GUARDED_BY(mu_);
   grpc_closure tcp_server_shutdown_complete_ ABSL_GUARDED_BY(mu_);
   grpc_closure* on_destroy_done_ ABSL_GUARDED_BY(mu_) = nullptr;
+  grpc_timer rebalance_timer_ ABSL_GUARDED_BY(mu_);
+  grpc_closure on_rebalance_timer_ ABSL_GUARDED_BY(mu_);
+  bool rebalance_timer_pending_ ABSL_GUARDED_BY(mu_) = false;
   RefCountedPtr<channelz::ListenSocketNode> channelz_listen_socket_;
   MemoryQuotaRefPtr memory_quota_;
 };
@@ -295,7 +318,8 @@ void Chttp2ServerListener::ConfigFetcherWatcher::UpdateConnectionManager(
       // Send GOAWAYs on the transports so that they get disconnected when
       // existing RPCs finish, and so that no new RPC is started on them.
       for (auto& connection : connections_) {
-        connection.first->SendGoAway();
+        connection.first->SendGoAway(
+            GRPC_ERROR_CREATE("Server is stopping to serve requests."));
       }
     }
 
@@ -348,7 +372,8 @@ void Chttp2ServerListener::ConfigFetcherWatcher::StopServing() {
   // Send GOAWAYs on the transports so that they disconnected when existing
   // RPCs finish.
   for (auto& connection : connections) {
-    connection.first->SendGoAway();
+    connection.first->SendGoAway(
+        GRPC_ERROR_CREATE("Server is stopping to serve requests."));
   }
 }
 
@@ -481,23 +506,27 @@ void Chttp2ServerListener::ActiveConnection::HandshakingState::OnHandshakeDone(
           // transport API.
           self->connection_->transport_ =
               reinterpret_cast<grpc_chttp2_transport*>(transport);
+          self->connection_->established_time_ = Timestamp::Now();
           GRPC_CHTTP2_REF_TRANSPORT(self->connection_->transport_,
                                     "ActiveConnection");  // Held by connection_
           self->Ref().release();  // Held by OnReceiveSettings().
           GRPC_CLOSURE_INIT(&self->on_receive_settings_, OnReceiveSettings,
                             self, grpc_schedule_on_exec_ctx);
-          // If the listener has been configured with a config fetcher, we
-          // need to watch on the transport being closed so that we can an
-          // updated list of active connections.
+          // If the listener has been configured with a config fetcher or
+          // sheds connections under load, we need to watch on the transport
+          // being closed so that we can an updated list of active
+          // connections.
           grpc_closure* on_close = nullptr;
           if (self->connection_->listener_->config_fetcher_watcher_ !=
-              nullptr) {
+                  nullptr ||
+              self->connection_->listener_->connection_rebalancer_ !=
+                  nullptr) {
             // Refs helds by OnClose()
             self->connection_->Ref().release();
             on_close = &self->connection_->on_close_;
           } else {
             // Remove the connection from the connections_ map since OnClose()
-            // will not be invoked when a config fetcher is set.
+            // will not be invoked.
             cleanup_connection = true;
           }
           grpc_chttp2_transport_start_reading(transport, args->read_buffer,
@@ -573,7 +602,8 @@ void Chttp2ServerListener::ActiveConnection::Orphan() {
   Unref();
 }
 
-void Chttp2ServerListener::ActiveConnection::SendGoAway() {
+void Chttp2ServerListener::ActiveConnection::SendGoAway(
+    grpc_error_handle error) {
   grpc_chttp2_transport* transport = nullptr;
   {
     MutexLock lock(&mu_);
@@ -598,12 +628,18 @@ void Chttp2ServerListener::ActiveConnection::SendGoAway() {
   }
   if (transport != nullptr) {
     grpc_transport_op* op = grpc_make_transport_op(nullptr);
-    op->goaway_error =
-        GRPC_ERROR_CREATE("Server is stopping to serve requests.");
+    op->goaway_error = std::move(error);
     grpc_transport_perform_op(&transport->base, op);
   }
 }
 
+absl::optional<Timestamp>
+Chttp2ServerListener::ActiveConnection::EstablishedTime() {
+  MutexLock lock(&mu_);
+  if (transport_ == nullptr || shutdown_) return absl::nullopt;
+  return established_time_;
+}
+
 void Chttp2ServerListener::ActiveConnection::Start(
     RefCountedPtr<Chttp2ServerListener> listener, grpc_endpoint* endpoint,
     const ChannelArgs& args) {
@@ -745,6 +781,7 @@ Chttp2ServerListener::Chttp2ServerListener(
     : server_(server),
       args_modifier_(args_modifier),
       args_(args),
+      connection_rebalancer_(server->connection_rebalancer()),
       memory_quota_(args.GetObject<ResourceQuota>()->memory_quota()) {
   GRPC_CLOSURE_INIT(&tcp_server_shutdown_complete_, TcpServerShutdownComplete,
                     this, grpc_schedule_on_exec_ctx);
@@ -763,6 +800,10 @@ Chttp2ServerListener::~Chttp2ServerListener() {
 // Server callback: start listening on our ports
 void Chttp2ServerListener::Start(
     Server* /*server*/, const std::vector<grpc_pollset*>* /* pollsets */) {
+  if (connection_rebalancer_ != nullptr) {
+    MutexLock lock(&mu_);
+    StartRebalanceTimerLocked();
+  }
   if (server_->config_fetcher() != nullptr) {
     auto watcher = std::make_unique<ConfigFetcherWatcher>(Ref());
     config_fetcher_watcher_ = watcher.get();
@@ -860,6 +901,61 @@ void Chttp2ServerListener::OnAccept(void* arg, grpc_endpoint* tcp,
   }
 }
 
+void Chttp2ServerListener::StartRebalanceTimerLocked() {
+  Ref().release();  // Held by OnRebalanceTimer().
+  GRPC_CLOSURE_INIT(&on_rebalance_timer_, OnRebalanceTimer, this, nullptr);
+  grpc_timer_init(&rebalance_timer_,
+                  Timestamp::Now() + ServerConnectionRebalancer::kCheckInterval,
+                  &on_rebalance_timer_);
+  rebalance_timer_pending_ = true;
+}
+
+void Chttp2ServerListener::OnRebalanceTimer(void* arg,
+                                            grpc_error_handle error) {
+  Chttp2ServerListener* self = static_cast<Chttp2ServerListener*>(arg);
+  // The timer is cancelled when the listener is orphaned.
+  if (error.ok()) self->ShedConnections();
+  self->Unref();
+}
+
+void Chttp2ServerListener::ShedConnections() {
+  std::vector<OrphanablePtr<ActiveConnection>> connections_to_shed;
+  {
+    MutexLock lock(&mu_);
+    rebalance_timer_pending_ = false;
+    if (shutdown_) return;
+    StartRebalanceTimerLocked();
+    if (!is_serving_) return;
+    std::vector<std::pair<Timestamp, ActiveConnection*>> established;
+    for (const auto& connection : connections_) {
+      absl::optional<Timestamp> established_time =
+          connection.first->EstablishedTime();
+      if (established_time.has_value()) {
+        established.emplace_back(*established_time, connection.first);
+      }
+    }
+    const size_t num_to_shed = connection_rebalancer_->ConnectionsToShed(
+        established.size(), Timestamp::Now());
+    if (num_to_shed == 0) return;
+    // The oldest connections are the likeliest to have been made before the
+    // other servers came up.
+    std::partial_sort(established.begin(), established.begin() + num_to_shed,
+                      established.end());
+    for (size_t i = 0; i < num_to_shed; ++i) {
+      auto it = connections_.find(established[i].second);
+      connections_to_shed.push_back(std::move(it->second));
+      connections_.erase(it);
+    }
+  }
+  // A graceful GOAWAY lets the calls in flight finish, and makes the client
+  // pick a connection elsewhere for its next ones.
+  for (auto& connection : connections_to_shed) {
+    connection->SendGoAway(grpc_error_set_int(
+        GRPC_ERROR_CREATE("Server is shedding load"),
+        StatusIntProperty::kHttp2Error, GRPC_HTTP2_NO_ERROR));
+  }
+}
+
 void Chttp2ServerListener::TcpServerShutdownComplete(
     void* arg, grpc_error_handle /*error*/) {
   Chttp2ServerListener* self = static_cast<Chttp2ServerListener*>(arg);
@@ -881,6 +977,7 @@ void Chttp2ServerListener::Orphan() {
     MutexLock lock(&mu_);
     shutdown_ = true;
     is_serving_ = false;
+    if (rebalance_timer_pending_) grpc_timer_cancel(&rebalance_timer_);
     // Orphan the connections so that they can start cleaning up.
     connections = std::move(connections_);
     // If the listener is currently set to be serving but has not been started
@@ -917,11 +1014,15 @@ grpc_error_handle Chttp2ServerAddPort(Server* server, const char* addr,
   std::vector<grpc_error_handle> error_list;
   std::string parsed_addr = URI::PercentDecode(addr);
   absl::string_view parsed_addr_unprefixed{parsed_addr};
+  ChannelArgs listener_args = args;
   // Using lambda to avoid use of goto.
   grpc_error_handle error = [&]() {
     grpc_error_handle error;
     if (absl::ConsumePrefix(&parsed_addr_unprefixed, kUnixUriPrefix)) {
       resolved_or = grpc_resolve_unix_domain_address(parsed_addr_unprefixed);
+    } else if (absl::ConsumePrefix(&parsed_addr_unprefixed, kShmUriPrefix)) {
+      resolved_or = grpc_resolve_unix_domain_address(parsed_addr_unprefixed);
+      listener_args = args.Set(GRPC_ARG_SHM_TRANSPORT, true);
     } else if (absl::ConsumePrefix(&parsed_addr_unprefixed,
                                    kUnixAbstractUriPrefix)) {
       resolved_or =
@@ -941,8 +1042,8 @@ grpc_error_handle Chttp2ServerAddPort(Server* server, const char* addr,
         grpc_sockaddr_set_port(&addr, *port_num);
       }
       int port_temp = -1;
-      error = Chttp2ServerListener::Create(server, &addr, args, args_modifier,
-                                           &port_temp);
+      error = Chttp2ServerListener::Create(server, &addr, listener_args,
+                                           args_modifier, &port_temp);
       if (!error.ok()) {
         error_list.push_back(error);
       } else {
@@ -93,13 +93,49 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   return output;
 }
 
+// Bits are accumulated at the least significant end of 'temp' and written
+// out most significant bit first. Output is flushed 32 bits at a time so that
+// encoding a symbol usually costs just a shift and an or.
+struct huff_out {
+  uint64_t temp;
+  uint32_t temp_length;
+  uint8_t* out;
+};
+
+static void enc_flush_word(huff_out* out) {
+  if (out->temp_length >= 32) {
+    out->temp_length -= 32;
+    const uint32_t word = static_cast<uint32_t>(out->temp >> out->temp_length);
+    out->out[0] = static_cast<uint8_t>(word >> 24);
+    out->out[1] = static_cast<uint8_t>(word >> 16);
+    out->out[2] = static_cast<uint8_t>(word >> 8);
+    out->out[3] = static_cast<uint8_t>(word);
+    out->out += 4;
+  }
+}
+
+static void enc_flush_final(huff_out* out) {
+  while (out->temp_length >= 8) {
+    out->temp_length -= 8;
+    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
+  }
+  if (out->temp_length) {
+    // NB: the following integer arithmetic operation needs to be in its
+    // expanded form due to the "integral promotion" performed (see section
+    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
+    // is then required to avoid the compiler warning
+    *out->out++ = static_cast<uint8_t>(
+        static_cast<uint8_t>(out->temp << (8u - out->temp_length)) |
+        static_cast<uint8_t>(0xffu >> out->temp_length));
+    out->temp_length = 0;
+  }
+}
+
 grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
   size_t nbits;
   const uint8_t* in;
-  uint8_t* out;
   grpc_slice output;
-  uint64_t temp = 0;
-  uint32_t temp_length = 0;
+  huff_out out;
 
   nbits = 0;
   for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
@@ -108,47 +144,24 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
   }
 
   output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
-  out = GRPC_SLICE_START_PTR(output);
+  out.temp = 0;
+  out.temp_length = 0;
+  out.out = GRPC_SLICE_START_PTR(output);
   for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
        ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
-    }
+    // Symbols are at most 30 bits long, so at most 61 bits are ever pending.
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[*in];
+    out.temp = (out.temp << sym.length) | sym.bits;
+    out.temp_length += sym.length;
+    enc_flush_word(&out);
   }
+  enc_flush_final(&out);
 
-  if (temp_length) {
-    // NB: the following integer arithmetic operation needs to be in its
-    // expanded form due to the "integral promotion" performed (see section
-    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-    // is then required to avoid the compiler warning
-    *out++ =
-        static_cast<uint8_t>(static_cast<uint8_t>(temp << (8u - temp_length)) |
-                             static_cast<uint8_t>(0xffu >> temp_length));
-  }
-
-  GPR_ASSERT(out == GRPC_SLICE_END_PTR(output));
+  GPR_ASSERT(out.out == GRPC_SLICE_END_PTR(output));
 
   return output;
 }
 
-struct huff_out {
-  uint32_t temp;
-  uint32_t temp_length;
-  uint8_t* out;
-};
-static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
-  }
-}
-
 static void enc_add2(huff_out* out, uint8_t a, uint8_t b) {
   b64_huff_sym sa = huff_alphabet[a];
   b64_huff_sym sb = huff_alphabet[b];
@@ -156,14 +169,14 @@ static void enc_add2(huff_out* out, uint8_t a, uint8_t b) {
               (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
   out->temp_length +=
       static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
-  enc_flush_some(out);
+  enc_flush_word(out);
 }
 
 static void enc_add1(huff_out* out, uint8_t a) {
   b64_huff_sym sa = huff_alphabet[a];
   out->temp = (out->temp << sa.length) | sa.bits;
   out->temp_length += sa.length;
-  enc_flush_some(out);
+  enc_flush_word(out);
 }
 
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
@@ -214,15 +227,7 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     }
   }
 
-  if (out.temp_length) {
-    // NB: the following integer arithmetic operation needs to be in its
-    // expanded form due to the "integral promotion" performed (see section
-    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-    // is then required to avoid the compiler warning
-    *out.out++ = static_cast<uint8_t>(
-        static_cast<uint8_t>(out.temp << (8u - out.temp_length)) |
-        static_cast<uint8_t>(0xffu >> out.temp_length));
-  }
+  enc_flush_final(&out);
 
   GPR_ASSERT(out.out <= GRPC_SLICE_END_PTR(output));
   GRPC_SLICE_SET_LENGTH(output, out.out - start_out);
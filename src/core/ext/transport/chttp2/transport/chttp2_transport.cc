@@ -63,6 +63,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/bitset.h"
 #include "src/core/lib/gprpp/crash.h"
@@ -71,6 +72,7 @@
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/http/parser.h"
+#include "src/core/lib/iomgr/buffer_list.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -96,6 +98,7 @@
 #define DEFAULT_CONNECTION_WINDOW_TARGET (1024 * 1024)
 #define MAX_WINDOW 0x7fffffffu
 #define MAX_WRITE_BUFFER_SIZE (64 * 1024 * 1024)
+#define MAX_WRITE_WEIGHT 1000u
 #define DEFAULT_MAX_HEADER_LIST_SIZE (8 * 1024)
 
 #define DEFAULT_CLIENT_KEEPALIVE_TIME_MS INT_MAX
@@ -139,6 +142,10 @@ static void write_action_begin_locked(void* t, grpc_error_handle error);
 static void write_action(void* t, grpc_error_handle error);
 static void write_action_end(void* t, grpc_error_handle error);
 static void write_action_end_locked(void* t, grpc_error_handle error);
+static bool hold_write_for_coalescing_locked(
+    grpc_chttp2_transport* t, const grpc_chttp2_begin_write_result& r);
+static void write_coalescing_timer_expired_locked(grpc_chttp2_transport* t,
+                                                  uint64_t seq);
 
 static void read_action(void* t, grpc_error_handle error);
 static void read_action_locked(void* t, grpc_error_handle error);
@@ -159,11 +166,14 @@ static void connectivity_state_set(grpc_chttp2_transport* t,
                                    const absl::Status& status,
                                    const char* reason);
 
-static void benign_reclaimer_locked(void* arg, grpc_error_handle error);
+static void shrink_reclaimer_locked(void* arg, grpc_error_handle error);
+static void idle_reclaimer_locked(void* arg, grpc_error_handle error);
 static void destructive_reclaimer_locked(void* arg, grpc_error_handle error);
 
-static void post_benign_reclaimer(grpc_chttp2_transport* t);
+static void post_shrink_reclaimer(grpc_chttp2_transport* t);
+static void post_idle_reclaimer(grpc_chttp2_transport* t);
 static void post_destructive_reclaimer(grpc_chttp2_transport* t);
+static void restore_header_table_size(grpc_chttp2_transport* t);
 
 static void close_transport_locked(grpc_chttp2_transport* t,
                                    grpc_error_handle error);
@@ -197,6 +207,12 @@ static void keepalive_watchdog_fired_locked(
     void* arg, GRPC_UNUSED grpc_error_handle error);
 static void maybe_reset_keepalive_ping_timer_locked(grpc_chttp2_transport* t);
 
+// deadline-relevant functions
+static void maybe_arm_deadline_timer_locked(grpc_chttp2_transport* t);
+static void deadline_timer_fired(grpc_chttp2_transport* t);
+static void deadline_timer_fired_locked(void* arg,
+                                        GRPC_UNUSED grpc_error_handle error);
+
 namespace grpc_core {
 
 namespace {
@@ -278,6 +294,16 @@ grpc_chttp2_transport::~grpc_chttp2_transport() {
 
 static const grpc_transport_vtable* get_vtable(void);
 
+// Reads a message size limit the same way the message size filter does.
+static absl::optional<uint32_t> message_size_limit_from_channel_args(
+    const grpc_core::ChannelArgs& channel_args, absl::string_view name,
+    int default_value) {
+  if (channel_args.WantMinimalStack()) return absl::nullopt;
+  int size = channel_args.GetInt(name).value_or(default_value);
+  if (size < 0) return absl::nullopt;
+  return static_cast<uint32_t>(size);
+}
+
 static void read_channel_args(grpc_chttp2_transport* t,
                               const grpc_core::ChannelArgs& channel_args,
                               bool is_client) {
@@ -315,6 +341,55 @@ static void read_channel_args(grpc_chttp2_transport* t,
   t->write_buffer_size =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)
                       .value_or(grpc_core::chttp2::kDefaultWindow));
+  const int notsent_lowat =
+      channel_args.GetInt(GRPC_ARG_TCP_NOTSENT_LOWAT).value_or(0);
+  if (notsent_lowat > 0) {
+    t->target_write_size = static_cast<uint32_t>(notsent_lowat);
+  } else {
+    t->tune_target_write_size = grpc_core::IsTcpFrameSizeTuningEnabled();
+  }
+  if (channel_args.GetBool(GRPC_ARG_TCP_WRITE_TIMESTAMPS).value_or(false)) {
+    t->write_timestamps = true;
+    // The endpoint's callback is process-wide, and ContextList::Execute is
+    // the only one ever set.
+    static const bool kTimestampsCallbackSet = []() {
+      grpc_core::grpc_tcp_set_write_timestamps_callback(
+          grpc_core::ContextList::Execute);
+      return true;
+    }();
+    (void)kTimestampsCallbackSet;
+  }
+  t->write_coalescing_budget = std::chrono::microseconds(std::max(
+      0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_BUDGET_US)
+             .value_or(0)));
+  t->write_coalescing_bytes = static_cast<uint32_t>(
+      std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_BYTES)
+                      .value_or(t->write_coalescing_bytes)));
+  t->stream_limit =
+      channel_args.GetObjectRef<grpc_core::TransportStreamLimit>();
+  // Only clients connect to the same peer address repeatedly.
+  if (is_client && t->flow_control.bdp_probe() &&
+      channel_args.GetBool(GRPC_ARG_HTTP2_BDP_HISTORY).value_or(false)) {
+    t->bdp_history = true;
+    t->flow_control.SetPredictiveBdp(
+        grpc_core::chttp2::BdpHistory::Get()->Lookup(
+            t->peer_string.as_string_view()));
+  }
+  const absl::optional<absl::string_view> write_scheduler =
+      channel_args.GetString(GRPC_ARG_HTTP2_WRITE_SCHEDULER);
+  if (write_scheduler.has_value()) {
+    if (*write_scheduler == "fifo") {
+      t->write_scheduler = GRPC_CHTTP2_WRITE_SCHEDULER_FIFO;
+    } else if (*write_scheduler == "round_robin") {
+      t->write_scheduler = GRPC_CHTTP2_WRITE_SCHEDULER_ROUND_ROBIN;
+    } else if (*write_scheduler == "weighted_fair") {
+      t->write_scheduler = GRPC_CHTTP2_WRITE_SCHEDULER_WEIGHTED_FAIR;
+    } else {
+      gpr_log(GPR_ERROR, "%s: unknown write scheduler \"%s\"",
+              GRPC_ARG_HTTP2_WRITE_SCHEDULER,
+              std::string(*write_scheduler).c_str());
+    }
+  }
   t->keepalive_time =
       std::max(grpc_core::Duration::Milliseconds(1),
                channel_args.GetDurationFromIntMillis(GRPC_ARG_KEEPALIVE_TIME_MS)
@@ -337,6 +412,19 @@ static void read_channel_args(grpc_chttp2_transport* t,
       channel_args
           .GetBool(GRPC_ARG_EXPERIMENTAL_HTTP2_PREFERRED_CRYPTO_FRAME_SIZE)
           .value_or(false);
+  // Same default as the deadline filter this stands in for.
+  t->enforce_stream_deadlines =
+      grpc_core::IsChttp2TransportDeadlinesEnabled() &&
+      channel_args.GetBool(GRPC_ARG_ENABLE_DEADLINE_CHECKS)
+          .value_or(!channel_args.WantMinimalStack());
+  if (grpc_core::IsChttp2MessageSizeLimitsEnabled()) {
+    t->max_recv_message_size = message_size_limit_from_channel_args(
+        channel_args, GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH,
+        GRPC_DEFAULT_MAX_RECV_MESSAGE_LENGTH);
+    t->max_send_message_size = message_size_limit_from_channel_args(
+        channel_args, GRPC_ARG_MAX_SEND_MESSAGE_LENGTH,
+        GRPC_DEFAULT_MAX_SEND_MESSAGE_LENGTH);
+  }
 
   if (channel_args.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
           .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT)) {
@@ -462,8 +550,8 @@ static void init_keepalive_pings_if_enabled_locked(
   if (t->keepalive_time != grpc_core::Duration::Infinity()) {
     t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_WAITING;
     GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
-    t->keepalive_ping_timer_handle =
-        t->event_engine->RunAfter(t->keepalive_time, [t] {
+    t->keepalive_ping_timer_handle = t->event_engine->RunAfter(
+        grpc_core::CoarseTimeout(t->keepalive_time), [t] {
           grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
           grpc_core::ExecCtx exec_ctx;
           init_keepalive_ping(t);
@@ -565,7 +653,8 @@ grpc_chttp2_transport::grpc_chttp2_transport(
   }
 
   grpc_chttp2_initiate_write(this, GRPC_CHTTP2_INITIATE_WRITE_INITIAL_WRITE);
-  post_benign_reclaimer(this);
+  post_shrink_reclaimer(this);
+  post_idle_reclaimer(this);
   if (grpc_core::test_only_init_callback != nullptr) {
     grpc_core::test_only_init_callback();
   }
@@ -624,6 +713,12 @@ static void close_transport_locked(grpc_chttp2_transport* t,
         t->next_bdp_ping_timer_handle.reset();
       }
     }
+    if (t->deadline_timer_handle.has_value()) {
+      if (t->event_engine->Cancel(*t->deadline_timer_handle)) {
+        GRPC_CHTTP2_UNREF_TRANSPORT(t, "deadline_timer");
+        t->deadline_timer_handle.reset();
+      }
+    }
     switch (t->keepalive_state) {
       case GRPC_CHTTP2_KEEPALIVE_STATE_WAITING:
         if (t->keepalive_ping_timer_handle.has_value()) {
@@ -714,14 +809,25 @@ grpc_chttp2_stream::grpc_chttp2_stream(grpc_chttp2_transport* t,
     }
     *t->accepting_stream = this;
     grpc_chttp2_stream_map_add(&t->stream_map, id, this);
+    restore_header_table_size(t);
     post_destructive_reclaimer(t);
   }
 
   grpc_slice_buffer_init(&frame_storage);
   grpc_slice_buffer_init(&flow_controlled_buffer);
+  if (t->write_timestamps) {
+    write_timestamps =
+        grpc_core::MakeRefCounted<grpc_core::StreamWriteTimestamps>();
+  }
+  if (grpc_core::IsChttp2ParallelStreamRecvEnabled()) {
+    recv_closure_queue =
+        grpc_core::MakeRefCounted<grpc_core::chttp2::RecvClosureQueue>(
+            t->event_engine);
+  }
 }
 
 grpc_chttp2_stream::~grpc_chttp2_stream() {
+  grpc_chttp2_untrack_stream_deadline(t, this);
   grpc_chttp2_list_remove_stalled_by_stream(t, this);
   grpc_chttp2_list_remove_stalled_by_transport(t, this);
 
@@ -842,6 +948,7 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
     case GRPC_CHTTP2_WRITE_STATE_IDLE:
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
+      t->write_initiated_cycle = gpr_get_cycle_counter();
       GRPC_CHTTP2_REF_TRANSPORT(t, "writing");
       // Note that the 'write_action_begin_locked' closure is being scheduled
       // on the 'finally_scheduler' of t->combiner. This means that
@@ -867,6 +974,16 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
     case GRPC_CHTTP2_WRITE_STATE_WRITING:
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE,
                       grpc_chttp2_initiate_write_reason_string(reason));
+      // A write that is being held back has not reached the endpoint yet:
+      // gather the new frames into it rather than waiting for it to finish.
+      // While held, WRITING_WITH_MORE means that this gathering is scheduled.
+      if (t->write_coalescing_timer_handle.has_value()) {
+        grpc_core::global_stats().IncrementHttp2WriteCoalescingMerges();
+        t->combiner->FinallyRun(
+            GRPC_CLOSURE_INIT(&t->write_action_begin_locked,
+                              write_action_begin_locked, t, nullptr),
+            absl::OkStatus());
+      }
       break;
     case GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE:
       break;
@@ -898,6 +1015,11 @@ static void write_action_begin_locked(void* gt,
   } else {
     r = grpc_chttp2_begin_write(t);
   }
+  if (r.writing && hold_write_for_coalescing_locked(t, r)) {
+    set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
+                    "hold write for coalescing");
+    return;
+  }
   if (r.writing) {
     set_write_state(t,
                     r.partial ? GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE
@@ -923,6 +1045,67 @@ static void write_action_begin_locked(void* gt,
   }
 }
 
+// Decides whether the write gathered into t->outbuf should wait for more
+// frames before being handed to the endpoint. Writes are held back once, for
+// at most t->write_coalescing_budget, and only while they are smaller than
+// t->write_coalescing_bytes. Writes carrying PINGs or PING acks are never held,
+// so that neither peer's keepalive or BDP round trips include the budget.
+// Returns true if the write must wait.
+static bool hold_write_for_coalescing_locked(
+    grpc_chttp2_transport* t, const grpc_chttp2_begin_write_result& r) {
+  const bool small = !r.partial && !r.pings &&
+                     t->outbuf.length < t->write_coalescing_bytes;
+  if (t->write_coalescing_timer_handle.has_value()) {
+    // Frames were gathered into a held back write.
+    if (small) return true;
+    grpc_core::global_stats().IncrementHttp2WriteCoalescingFlushes();
+    if (t->event_engine->Cancel(*t->write_coalescing_timer_handle)) {
+      GRPC_CHTTP2_UNREF_TRANSPORT(t, "write_coalescing");
+    }
+    t->write_coalescing_timer_handle.reset();
+    t->write_coalescing_held = false;
+    return false;
+  }
+  if (t->write_coalescing_held || !small ||
+      t->write_coalescing_budget ==
+          grpc_event_engine::experimental::EventEngine::Duration::zero()) {
+    t->write_coalescing_held = false;
+    return false;
+  }
+  grpc_core::global_stats().IncrementHttp2WriteCoalescingHolds();
+  t->write_coalescing_held = true;
+  const uint64_t seq = ++t->write_coalescing_seq;
+  GRPC_CHTTP2_REF_TRANSPORT(t, "write_coalescing");
+  t->write_coalescing_timer_handle =
+      t->event_engine->RunAfter(t->write_coalescing_budget, [t, seq] {
+        grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+        grpc_core::ExecCtx exec_ctx;
+        t->combiner->Run(
+            grpc_core::NewClosure([t, seq](grpc_error_handle /*error*/) {
+              write_coalescing_timer_expired_locked(t, seq);
+            }),
+            absl::OkStatus());
+      });
+  return true;
+}
+
+static void write_coalescing_timer_expired_locked(grpc_chttp2_transport* t,
+                                                  uint64_t seq) {
+  if (t->write_coalescing_timer_handle.has_value() &&
+      t->write_coalescing_seq == seq) {
+    t->write_coalescing_timer_handle.reset();
+    // Unless new frames are already being gathered (which will now start the
+    // write), start the held back write.
+    if (t->write_state == GRPC_CHTTP2_WRITE_STATE_WRITING) {
+      t->combiner->FinallyRun(
+          GRPC_CLOSURE_INIT(&t->write_action_begin_locked,
+                            write_action_begin_locked, t, nullptr),
+          absl::OkStatus());
+    }
+  }
+  GRPC_CHTTP2_UNREF_TRANSPORT(t, "write_coalescing");
+}
+
 static void write_action(void* gt, grpc_error_handle /*error*/) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(gt);
   void* cl = t->cl;
@@ -947,6 +1130,9 @@ static void write_action(void* gt, grpc_error_handle /*error*/) {
 
 static void write_action_end(void* tp, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  grpc_core::global_stats().IncrementHttp2WriteFlushDelayUs(
+      grpc_core::MicrosecondsSince(t->write_initiated_cycle));
+  t->write_action_end_queued_cycle = gpr_get_cycle_counter();
   t->combiner->Run(GRPC_CLOSURE_INIT(&t->write_action_end_locked,
                                      write_action_end_locked, t, nullptr),
                    error);
@@ -956,6 +1142,8 @@ static void write_action_end(void* tp, grpc_error_handle error) {
 // sendmsg
 static void write_action_end_locked(void* tp, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  grpc_core::global_stats().IncrementHttp2CombinerQueueTimeUs(
+      grpc_core::MicrosecondsSince(t->write_action_end_queued_cycle));
 
   bool closed = false;
   if (!error.ok()) {
@@ -979,6 +1167,7 @@ static void write_action_end_locked(void* tp, grpc_error_handle error) {
       break;
     case GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE:
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING, "continue writing");
+      t->write_initiated_cycle = gpr_get_cycle_counter();
       GRPC_CHTTP2_REF_TRANSPORT(t, "writing");
       // If the transport is closed, we will retry writing on the endpoint
       // and next write may contain part of the currently serialized frames.
@@ -1016,6 +1205,15 @@ static void queue_setting_update(grpc_chttp2_transport* t,
   }
 }
 
+// Undo the HEADER_TABLE_SIZE change of an idle shrink once streams resume.
+static void restore_header_table_size(grpc_chttp2_transport* t) {
+  if (t->header_table_size_before_shrink.has_value()) {
+    queue_setting_update(t, GRPC_CHTTP2_SETTINGS_HEADER_TABLE_SIZE,
+                         *std::exchange(t->header_table_size_before_shrink,
+                                        absl::nullopt));
+  }
+}
+
 // Cancel out streams that haven't yet started if we have received a GOAWAY
 static void cancel_unstarted_streams(grpc_chttp2_transport* t,
                                      grpc_error_handle error) {
@@ -1137,6 +1335,7 @@ static void maybe_start_some_streams(grpc_chttp2_transport* t) {
     }
 
     grpc_chttp2_stream_map_add(&t->stream_map, s->id, s);
+    restore_header_table_size(t);
     post_destructive_reclaimer(t);
     grpc_chttp2_mark_stream_writable(t, s);
     grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM);
@@ -1169,9 +1368,71 @@ static grpc_closure* add_closure_barrier(grpc_closure* closure) {
   return closure;
 }
 
-static void null_then_sched_closure(grpc_closure** closure) {
+namespace grpc_core {
+namespace chttp2 {
+
+RecvClosureQueue::RecvClosureQueue(
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine)
+    : event_engine_(std::move(event_engine)) {
+  GRPC_CLOSURE_INIT(&kick_, Kick, this, nullptr);
+}
+
+void RecvClosureQueue::Push(grpc_closure* closure) {
+  {
+    MutexLock lock(&mu_);
+    grpc_closure_list_append(&closures_, closure, absl::OkStatus());
+    if (draining_) return;
+    draining_ = true;
+  }
+  // Hand off to the EventEngine only once the caller is done, for the same
+  // reason null_then_sched_closure does not run closures inline.
+  Ref().release();
+  ExecCtx::Run(DEBUG_LOCATION, &kick_, absl::OkStatus());
+}
+
+void RecvClosureQueue::Kick(void* arg, grpc_error_handle /*error*/) {
+  RefCountedPtr<RecvClosureQueue> self(static_cast<RecvClosureQueue*>(arg));
+  self->event_engine_->Run([self]() {
+    ApplicationCallbackExecCtx callback_exec_ctx;
+    ExecCtx exec_ctx;
+    self->Drain();
+  });
+}
+
+void RecvClosureQueue::Drain() {
+  while (true) {
+    grpc_closure_list closures = GRPC_CLOSURE_LIST_INIT;
+    {
+      MutexLock lock(&mu_);
+      if (grpc_closure_list_empty(closures_)) {
+        draining_ = false;
+        return;
+      }
+      std::swap(closures, closures_);
+    }
+    grpc_closure* c = closures.head;
+    while (c != nullptr) {
+      grpc_closure* next = c->next_data.next;
+      Closure::Run(DEBUG_LOCATION, c, absl::OkStatus());
+      // Let the closure's own follow-up work finish before the next
+      // completion of this stream is delivered.
+      ExecCtx::Get()->Flush();
+      c = next;
+    }
+  }
+}
+
+}  // namespace chttp2
+}  // namespace grpc_core
+
+static void null_then_sched_closure(grpc_chttp2_stream* s,
+                                    grpc_closure** closure) {
   grpc_closure* c = *closure;
   *closure = nullptr;
+  if (s->recv_closure_queue != nullptr) {
+    s->recv_closure_queue->Push(c);
+    return;
+  }
   // null_then_schedule_closure might be run during a start_batch which might
   // subsequently examine the batch for more operations contained within.
   // However, the closure run might make it back to the call object, push a
@@ -1305,10 +1566,15 @@ static void perform_stream_op_locked(void* stream_op,
           s->deadline,
           s->send_initial_metadata->get(grpc_core::GrpcTimeoutMetadata())
               .value_or(grpc_core::Timestamp::InfFuture()));
+      grpc_chttp2_track_stream_deadline(t, s);
     }
     if (contains_non_ok_status(s->send_initial_metadata)) {
       s->seen_error = true;
     }
+    s->write_weight = grpc_core::Clamp(
+        s->send_initial_metadata->get(grpc_core::GrpcWriteWeightMetadata())
+            .value_or(1),
+        1u, MAX_WRITE_WEIGHT);
     if (!s->write_closed) {
       if (t->is_client) {
         if (t->closed_with_error.ok()) {
@@ -1353,6 +1619,21 @@ static void perform_stream_op_locked(void* stream_op,
         op->payload->send_message.send_message->Length());
     on_complete->next_data.scratch |= CLOSURE_BARRIER_MAY_COVER_WRITE;
     s->send_message_finished = add_closure_barrier(op->on_complete);
+    if (t->max_send_message_size.has_value() &&
+        op_payload->send_message.send_message->Length() >
+            *t->max_send_message_size) {
+      // Fail the call as the message size filter would; the stream is then
+      // closed for writes, which fails the send below.
+      grpc_chttp2_cancel_stream(
+          t, s,
+          grpc_error_set_int(
+              GRPC_ERROR_CREATE(absl::StrFormat(
+                  "Sent message larger than max (%u vs. %d)",
+                  op_payload->send_message.send_message->Length(),
+                  *t->max_send_message_size)),
+              grpc_core::StatusIntProperty::kRpcStatus,
+              GRPC_STATUS_RESOURCE_EXHAUSTED));
+    }
     const uint32_t flags = op_payload->send_message.flags;
     if (s->write_closed) {
       op->payload->send_message.stream_write_closed = true;
@@ -1391,6 +1672,7 @@ static void perform_stream_op_locked(void* stream_op,
         grpc_slice_buffer_add(&s->flow_controlled_buffer,
                               grpc_core::CSliceRef(*slice));
       }
+      grpc_chttp2_publish_write_window_hint(t, s);
 
       int64_t notify_offset = s->next_message_end_offset;
       if (notify_offset <= s->flow_controlled_bytes_written) {
@@ -1615,6 +1897,7 @@ void grpc_chttp2_ack_ping(grpc_chttp2_transport* t, uint64_t id) {
             std::string(t->peer_string.as_string_view()).c_str(), id);
     return;
   }
+  t->ping_ack_read_time = t->read_completed_time;
   grpc_core::ExecCtx::RunList(DEBUG_LOCATION,
                               &pq->lists[GRPC_CHTTP2_PCL_INFLIGHT]);
   if (!grpc_closure_list_empty(pq->lists[GRPC_CHTTP2_PCL_NEXT])) {
@@ -1858,13 +2141,15 @@ void grpc_chttp2_maybe_complete_recv_initial_metadata(grpc_chttp2_transport* t,
       *s->trailing_metadata_available = true;
       s->trailing_metadata_available = nullptr;
     }
-    null_then_sched_closure(&s->recv_initial_metadata_ready);
+    null_then_sched_closure(s, &s->recv_initial_metadata_ready);
   }
 }
 
 void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
                                              grpc_chttp2_stream* s) {
   if (s->recv_message_ready == nullptr) return;
+  // Cancelling the stream completes recv_message itself.
+  if (grpc_chttp2_reject_oversized_incoming_message(t, s)) return;
 
   grpc_core::chttp2::StreamFlowControl::IncomingUpdateContext upd(
       &s->flow_control);
@@ -1928,13 +2213,13 @@ void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
     // save the length of the buffer before handing control back to application
     // threads. Needed to support correct flow control bookkeeping
     if (error.ok() && s->recv_message->has_value()) {
-      null_then_sched_closure(&s->recv_message_ready);
+      null_then_sched_closure(s, &s->recv_message_ready);
     } else if (s->published_metadata[1] != GRPC_METADATA_NOT_PUBLISHED) {
       if (s->call_failed_before_recv_message != nullptr) {
         *s->call_failed_before_recv_message =
             (s->published_metadata[1] != GRPC_METADATA_PUBLISHED_AT_CLOSE);
       }
-      null_then_sched_closure(&s->recv_message_ready);
+      null_then_sched_closure(s, &s->recv_message_ready);
     }
   }();
 
@@ -1960,10 +2245,13 @@ void grpc_chttp2_maybe_complete_recv_trailing_metadata(grpc_chttp2_transport* t,
     }
     if (s->read_closed && s->frame_storage.length == 0 &&
         s->recv_trailing_metadata_finished != nullptr) {
+      if (s->write_timestamps != nullptr) {
+        s->write_timestamps->Fill(&s->stats.timing);
+      }
       grpc_transport_move_stats(&s->stats, s->collecting_stats);
       s->collecting_stats = nullptr;
       *s->recv_trailing_metadata = std::move(s->trailing_metadata_buffer);
-      null_then_sched_closure(&s->recv_trailing_metadata_finished);
+      null_then_sched_closure(s, &s->recv_trailing_metadata_finished);
     }
   }
 }
@@ -1979,7 +2267,8 @@ static void remove_stream(grpc_chttp2_transport* t, uint32_t id,
   }
 
   if (grpc_chttp2_stream_map_size(&t->stream_map) == 0) {
-    post_benign_reclaimer(t);
+    post_shrink_reclaimer(t);
+    post_idle_reclaimer(t);
     if (t->sent_goaway_state == GRPC_CHTTP2_FINAL_GOAWAY_SENT) {
       close_transport_locked(
           t, GRPC_ERROR_CREATE_REFERENCING(
@@ -2142,6 +2431,7 @@ void grpc_chttp2_mark_stream_closed(grpc_chttp2_transport* t,
   }
   if (s->read_closed && s->write_closed) {
     became_closed = true;
+    grpc_chttp2_untrack_stream_deadline(t, s);
     grpc_error_handle overall_error = removal_error(error, s, "Stream removed");
     if (s->id != 0) {
       remove_stream(t, s->id, overall_error);
@@ -2438,6 +2728,8 @@ static grpc_error_handle try_http_parsing(grpc_chttp2_transport* t) {
 
 static void read_action(void* tp, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  t->read_action_queued_cycle = gpr_get_cycle_counter();
+  t->read_completed_time = gpr_now(GPR_CLOCK_MONOTONIC);
   t->combiner->Run(
       GRPC_CLOSURE_INIT(&t->read_action_locked, read_action_locked, t, nullptr),
       error);
@@ -2445,6 +2737,8 @@ static void read_action(void* tp, grpc_error_handle error) {
 
 static void read_action_locked(void* tp, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(tp);
+  grpc_core::global_stats().IncrementHttp2CombinerQueueTimeUs(
+      grpc_core::MicrosecondsSince(t->read_action_queued_cycle));
 
   grpc_error_handle err = error;
   if (!err.ok()) {
@@ -2559,7 +2853,7 @@ static void start_bdp_ping_locked(void* tp, grpc_error_handle error) {
   if (t->keepalive_state == GRPC_CHTTP2_KEEPALIVE_STATE_WAITING) {
     maybe_reset_keepalive_ping_timer_locked(t);
   }
-  t->flow_control.bdp_estimator()->StartPing();
+  t->flow_control.bdp_estimator()->StartPing(t->ping_write_time);
   t->bdp_ping_started = true;
 }
 
@@ -2591,12 +2885,18 @@ static void finish_bdp_ping_locked(void* tp, grpc_error_handle error) {
   }
   t->bdp_ping_started = false;
   grpc_core::Timestamp next_ping =
-      t->flow_control.bdp_estimator()->CompletePing();
+      t->flow_control.bdp_estimator()->CompletePing(t->ping_ack_read_time);
+  if (t->bdp_history) {
+    grpc_core::chttp2::BdpHistory::Get()->Record(
+        t->peer_string.as_string_view(),
+        {t->flow_control.bdp_estimator()->EstimateBdp(),
+         t->flow_control.bdp_estimator()->EstimateBandwidth()});
+  }
   grpc_chttp2_act_on_flowctl_action(t->flow_control.PeriodicUpdate(), t,
                                     nullptr);
   GPR_ASSERT(!t->next_bdp_ping_timer_handle.has_value());
-  t->next_bdp_ping_timer_handle =
-      t->event_engine->RunAfter(next_ping - grpc_core::Timestamp::Now(), [t] {
+  t->next_bdp_ping_timer_handle = t->event_engine->RunAfter(
+      grpc_core::CoarseTimeout(next_ping - grpc_core::Timestamp::Now()), [t] {
         grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
         grpc_core::ExecCtx exec_ctx;
         next_bdp_ping_timer_expired(t);
@@ -2708,8 +3008,8 @@ static void init_keepalive_ping_locked(void* arg,
       grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_KEEPALIVE_PING);
     } else {
       GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
-      t->keepalive_ping_timer_handle =
-          t->event_engine->RunAfter(t->keepalive_time, [t] {
+      t->keepalive_ping_timer_handle = t->event_engine->RunAfter(
+          grpc_core::CoarseTimeout(t->keepalive_time), [t] {
             grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
             grpc_core::ExecCtx exec_ctx;
             init_keepalive_ping(t);
@@ -2740,8 +3040,8 @@ static void start_keepalive_ping_locked(void* arg, grpc_error_handle error) {
             std::string(t->peer_string.as_string_view()).c_str());
   }
   GRPC_CHTTP2_REF_TRANSPORT(t, "keepalive watchdog");
-  t->keepalive_watchdog_timer_handle =
-      t->event_engine->RunAfter(t->keepalive_timeout, [t] {
+  t->keepalive_watchdog_timer_handle = t->event_engine->RunAfter(
+      grpc_core::CoarseTimeout(t->keepalive_timeout), [t] {
         grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
         grpc_core::ExecCtx exec_ctx;
         keepalive_watchdog_fired(t);
@@ -2784,8 +3084,8 @@ static void finish_keepalive_ping_locked(void* arg, grpc_error_handle error) {
       }
       GPR_ASSERT(!t->keepalive_ping_timer_handle.has_value());
       GRPC_CHTTP2_REF_TRANSPORT(t, "init keepalive ping");
-      t->keepalive_ping_timer_handle =
-          t->event_engine->RunAfter(t->keepalive_time, [t] {
+      t->keepalive_ping_timer_handle = t->event_engine->RunAfter(
+          grpc_core::CoarseTimeout(t->keepalive_time), [t] {
             grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
             grpc_core::ExecCtx exec_ctx;
             init_keepalive_ping(t);
@@ -2836,8 +3136,8 @@ static void maybe_reset_keepalive_ping_timer_locked(grpc_chttp2_transport* t) {
         gpr_log(GPR_INFO, "%s: Keepalive ping cancelled. Resetting timer.",
                 std::string(t->peer_string.as_string_view()).c_str());
       }
-      t->keepalive_ping_timer_handle =
-          t->event_engine->RunAfter(t->keepalive_time, [t] {
+      t->keepalive_ping_timer_handle = t->event_engine->RunAfter(
+          grpc_core::CoarseTimeout(t->keepalive_time), [t] {
             grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
             grpc_core::ExecCtx exec_ctx;
             init_keepalive_ping(t);
@@ -2846,6 +3146,84 @@ static void maybe_reset_keepalive_ping_timer_locked(grpc_chttp2_transport* t) {
   }
 }
 
+//
+// DEADLINES
+//
+
+void grpc_chttp2_track_stream_deadline(grpc_chttp2_transport* t,
+                                       grpc_chttp2_stream* s) {
+  if (!t->enforce_stream_deadlines || s->deadline_tracked ||
+      s->deadline == grpc_core::Timestamp::InfFuture() ||
+      (s->read_closed && s->write_closed)) {
+    return;
+  }
+  s->deadline_tracked = true;
+  t->stream_deadlines.emplace(s->deadline, s);
+  maybe_arm_deadline_timer_locked(t);
+}
+
+void grpc_chttp2_untrack_stream_deadline(grpc_chttp2_transport* t,
+                                         grpc_chttp2_stream* s) {
+  if (!s->deadline_tracked) return;
+  s->deadline_tracked = false;
+  t->stream_deadlines.erase(std::make_pair(s->deadline, s));
+  // An armed timer is left to fire: it finds nothing expired and re-arms for
+  // whatever deadline is earliest then.
+}
+
+// Arms the transport's one deadline timer for its earliest stream deadline,
+// unless it is armed for that deadline (or an earlier one) already.
+static void maybe_arm_deadline_timer_locked(grpc_chttp2_transport* t) {
+  if (t->stream_deadlines.empty() || !t->closed_with_error.ok()) return;
+  grpc_core::Timestamp earliest = t->stream_deadlines.begin()->first;
+  if (t->deadline_timer_handle.has_value()) {
+    if (t->deadline_timer_deadline <= earliest) return;
+    // If the timer is already running, it re-arms once it gets the combiner.
+    if (!t->event_engine->Cancel(*t->deadline_timer_handle)) return;
+    GRPC_CHTTP2_UNREF_TRANSPORT(t, "deadline_timer");
+  }
+  t->deadline_timer_deadline = earliest;
+  GRPC_CHTTP2_REF_TRANSPORT(t, "deadline_timer");
+  t->deadline_timer_handle = t->event_engine->RunAfter(
+      std::max(grpc_core::Duration::Zero(),
+               earliest - grpc_core::Timestamp::Now()),
+      [t] {
+        grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+        grpc_core::ExecCtx exec_ctx;
+        deadline_timer_fired(t);
+      });
+}
+
+static void deadline_timer_fired(grpc_chttp2_transport* t) {
+  t->combiner->Run(
+      GRPC_CLOSURE_INIT(&t->deadline_timer_fired_locked,
+                        deadline_timer_fired_locked, t, nullptr),
+      absl::OkStatus());
+}
+
+static void deadline_timer_fired_locked(void* arg,
+                                        GRPC_UNUSED grpc_error_handle error) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(arg);
+  GPR_ASSERT(t->deadline_timer_handle.has_value());
+  t->deadline_timer_handle.reset();
+  if (t->closed_with_error.ok()) {
+    grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+    while (!t->stream_deadlines.empty() &&
+           t->stream_deadlines.begin()->first <= now) {
+      grpc_chttp2_stream* s = t->stream_deadlines.begin()->second;
+      grpc_chttp2_untrack_stream_deadline(t, s);
+      // The same error the deadline filter cancels calls with.
+      grpc_chttp2_cancel_stream(
+          t, s,
+          grpc_error_set_int(GRPC_ERROR_CREATE("Deadline Exceeded"),
+                             grpc_core::StatusIntProperty::kRpcStatus,
+                             GRPC_STATUS_DEADLINE_EXCEEDED));
+    }
+    maybe_arm_deadline_timer_locked(t);
+  }
+  GRPC_CHTTP2_UNREF_TRANSPORT(t, "deadline_timer");
+}
+
 //
 // CALLBACK LOOP
 //
@@ -2879,21 +3257,40 @@ static void set_pollset_set(grpc_transport* gt, grpc_stream* /*gs*/,
 // RESOURCE QUOTAS
 //
 
-static void post_benign_reclaimer(grpc_chttp2_transport* t) {
-  if (!t->benign_reclaimer_registered) {
-    t->benign_reclaimer_registered = true;
-    GRPC_CHTTP2_REF_TRANSPORT(t, "benign_reclaimer");
+static void post_shrink_reclaimer(grpc_chttp2_transport* t) {
+  if (!t->shrink_reclaimer_registered) {
+    t->shrink_reclaimer_registered = true;
+    GRPC_CHTTP2_REF_TRANSPORT(t, "shrink_reclaimer");
     t->memory_owner.PostReclaimer(
         grpc_core::ReclamationPass::kBenign,
         [t](absl::optional<grpc_core::ReclamationSweep> sweep) {
           if (sweep.has_value()) {
-            GRPC_CLOSURE_INIT(&t->benign_reclaimer_locked,
-                              benign_reclaimer_locked, t,
+            GRPC_CLOSURE_INIT(&t->shrink_reclaimer_locked,
+                              shrink_reclaimer_locked, t,
                               grpc_schedule_on_exec_ctx);
             t->active_reclamation = std::move(*sweep);
-            t->combiner->Run(&t->benign_reclaimer_locked, absl::OkStatus());
+            t->combiner->Run(&t->shrink_reclaimer_locked, absl::OkStatus());
+          } else {
+            GRPC_CHTTP2_UNREF_TRANSPORT(t, "shrink_reclaimer");
+          }
+        });
+  }
+}
+
+static void post_idle_reclaimer(grpc_chttp2_transport* t) {
+  if (!t->idle_reclaimer_registered) {
+    t->idle_reclaimer_registered = true;
+    GRPC_CHTTP2_REF_TRANSPORT(t, "idle_reclaimer");
+    t->memory_owner.PostReclaimer(
+        grpc_core::ReclamationPass::kIdle,
+        [t](absl::optional<grpc_core::ReclamationSweep> sweep) {
+          if (sweep.has_value()) {
+            GRPC_CLOSURE_INIT(&t->idle_reclaimer_locked, idle_reclaimer_locked,
+                              t, grpc_schedule_on_exec_ctx);
+            t->active_reclamation = std::move(*sweep);
+            t->combiner->Run(&t->idle_reclaimer_locked, absl::OkStatus());
           } else {
-            GRPC_CHTTP2_UNREF_TRANSPORT(t, "benign_reclaimer");
+            GRPC_CHTTP2_UNREF_TRANSPORT(t, "idle_reclaimer");
           }
         });
   }
@@ -2920,7 +3317,41 @@ static void post_destructive_reclaimer(grpc_chttp2_transport* t) {
   }
 }
 
-static void benign_reclaimer_locked(void* arg, grpc_error_handle error) {
+static void shrink_reclaimer_locked(void* arg, grpc_error_handle error) {
+  grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(arg);
+  if (error.ok() && grpc_chttp2_stream_map_size(&t->stream_map) == 0) {
+    // Channel with no active streams: drop what it keeps around for the next
+    // ones, but stay connected
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_resource_quota_trace)) {
+      gpr_log(GPR_INFO, "HTTP2: %s - shrink idle buffers to free memory",
+              std::string(t->peer_string.as_string_view()).c_str());
+    }
+    // Have the peer empty our decoder table: the parser evicts everything
+    // once the smaller size is acknowledged.
+    const uint32_t header_table_size =
+        t->settings[GRPC_LOCAL_SETTINGS]
+                   [GRPC_CHTTP2_SETTINGS_HEADER_TABLE_SIZE];
+    if (!t->header_table_size_before_shrink.has_value() &&
+        header_table_size != 0) {
+      t->header_table_size_before_shrink = header_table_size;
+      queue_setting_update(t, GRPC_CHTTP2_SETTINGS_HEADER_TABLE_SIZE, 0);
+      grpc_chttp2_initiate_write(t, GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS);
+    }
+    t->hpack_compressor.EvictAll();
+    grpc_slice_buffer_shrink_to_fit(&t->qbuf);
+    // The endpoint reads outbuf until the write completes.
+    if (t->write_state == GRPC_CHTTP2_WRITE_STATE_IDLE) {
+      grpc_slice_buffer_shrink_to_fit(&t->outbuf);
+    }
+  }
+  t->shrink_reclaimer_registered = false;
+  if (error != absl::CancelledError()) {
+    t->active_reclamation.Finish();
+  }
+  GRPC_CHTTP2_UNREF_TRANSPORT(t, "shrink_reclaimer");
+}
+
+static void idle_reclaimer_locked(void* arg, grpc_error_handle error) {
   grpc_chttp2_transport* t = static_cast<grpc_chttp2_transport*>(arg);
   if (error.ok() && grpc_chttp2_stream_map_size(&t->stream_map) == 0) {
     // Channel with no active streams: send a goaway to try and make it
@@ -2936,16 +3367,16 @@ static void benign_reclaimer_locked(void* arg, grpc_error_handle error) {
                 /*immediate_disconnect_hint=*/true);
   } else if (error.ok() && GRPC_TRACE_FLAG_ENABLED(grpc_resource_quota_trace)) {
     gpr_log(GPR_INFO,
-            "HTTP2: %s - skip benign reclamation, there are still %" PRIdPTR
+            "HTTP2: %s - skip idle reclamation, there are still %" PRIdPTR
             " streams",
             std::string(t->peer_string.as_string_view()).c_str(),
             grpc_chttp2_stream_map_size(&t->stream_map));
   }
-  t->benign_reclaimer_registered = false;
+  t->idle_reclaimer_registered = false;
   if (error != absl::CancelledError()) {
     t->active_reclamation.Finish();
   }
-  GRPC_CHTTP2_UNREF_TRANSPORT(t, "benign_reclaimer");
+  GRPC_CHTTP2_UNREF_TRANSPORT(t, "idle_reclaimer");
 }
 
 static void destructive_reclaimer_locked(void* arg, grpc_error_handle error) {
@@ -3078,6 +3509,8 @@ void grpc_chttp2_transport_start_reading(
   }
   t->notify_on_receive_settings = notify_on_receive_settings;
   t->notify_on_close = notify_on_close;
+  t->read_action_queued_cycle = gpr_get_cycle_counter();
+  t->read_completed_time = gpr_now(GPR_CLOCK_MONOTONIC);
   t->combiner->Run(
       GRPC_CLOSURE_INIT(&t->read_action_locked, read_action_locked, t, nullptr),
       absl::OkStatus());
@@ -32,13 +32,16 @@ void* (*get_copied_context_fn_g)(void*) = nullptr;
 
 namespace grpc_core {
 void ContextList::Append(ContextList** head, grpc_chttp2_stream* s) {
-  if (get_copied_context_fn_g == nullptr ||
-      write_timestamps_callback_g == nullptr) {
-    return;
-  }
+  const bool traced = get_copied_context_fn_g != nullptr &&
+                      write_timestamps_callback_g != nullptr;
+  if (!traced && s->write_timestamps == nullptr) return;
   // Create a new element in the list and add it at the front
   ContextList* elem = new ContextList();
-  elem->trace_context_ = get_copied_context_fn_g(s->context);
+  if (traced) {
+    elem->trace_context_ = get_copied_context_fn_g(s->context);
+    elem->traced_ = true;
+  }
+  elem->write_timestamps_ = s->write_timestamps;
   elem->byte_offset_ = s->byte_counter;
   elem->next_ = *head;
   *head = elem;
@@ -48,7 +51,10 @@ void ContextList::Execute(void* arg, Timestamps* ts, grpc_error_handle error) {
   ContextList* head = static_cast<ContextList*>(arg);
   ContextList* to_be_freed;
   while (head != nullptr) {
-    if (write_timestamps_callback_g) {
+    if (head->write_timestamps_ != nullptr && ts != nullptr) {
+      head->write_timestamps_->Record(*ts);
+    }
+    if (head->traced_ && write_timestamps_callback_g) {
       if (ts) {
         ts->byte_offset = static_cast<uint32_t>(head->byte_offset_);
       }
@@ -60,6 +66,20 @@ void ContextList::Execute(void* arg, Timestamps* ts, grpc_error_handle error) {
   }
 }
 
+void StreamWriteTimestamps::Record(const Timestamps& ts) {
+  // The endpoint reports the ACKs of a connection's writes in order, so the
+  // last one recorded is the latest.
+  MutexLock lock(&mu_);
+  sent_ = gpr_convert_clock_type(ts.sent_time.time, GPR_CLOCK_MONOTONIC);
+  acked_ = gpr_convert_clock_type(ts.acked_time.time, GPR_CLOCK_MONOTONIC);
+}
+
+void StreamWriteTimestamps::Fill(grpc_transport_stream_timing* timing) {
+  MutexLock lock(&mu_);
+  timing->last_write_sent = sent_;
+  timing->last_write_acked = acked_;
+}
+
 void grpc_http2_set_write_timestamps_callback(
     void (*fn)(void*, Timestamps*, grpc_error_handle error)) {
   write_timestamps_callback_g = fn;
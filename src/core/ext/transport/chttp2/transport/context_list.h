@@ -23,11 +23,37 @@
 
 #include <stddef.h>
 
+#include "absl/base/thread_annotations.h"
+
+#include <grpc/support/time.h>
+
 #include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/buffer_list.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/transport/transport.h"
 
 namespace grpc_core {
+// The kernel timestamps of the latest write of a stream that the peer has
+// ACKed, for streams of a transport with GRPC_ARG_TCP_WRITE_TIMESTAMPS. Shared
+// between the stream and the ContextList entries of its writes, since the
+// ACKs are reported by the endpoint and may outlive the stream.
+class StreamWriteTimestamps : public RefCounted<StreamWriteTimestamps> {
+ public:
+  void Record(const Timestamps& ts);
+  // Sets last_write_sent and last_write_acked in \a timing. They are in the
+  // infinite past until a write has been ACKed.
+  void Fill(grpc_transport_stream_timing* timing);
+
+ private:
+  Mutex mu_;
+  // GPR_CLOCK_MONOTONIC, like the other stream timings.
+  gpr_timespec sent_ ABSL_GUARDED_BY(mu_) = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  gpr_timespec acked_ ABSL_GUARDED_BY(mu_) = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+};
+
 /// A list of RPC Contexts
 class ContextList {
  public:
@@ -42,6 +68,9 @@ class ContextList {
 
  private:
   void* trace_context_ = nullptr;
+  // Whether the context was copied for write_timestamps_callback_g.
+  bool traced_ = false;
+  RefCountedPtr<StreamWriteTimestamps> write_timestamps_;
   ContextList* next_ = nullptr;
   size_t byte_offset_ = 0;
 };
@@ -40,6 +40,7 @@
 #include "src/core/ext/transport/chttp2/transport/http2_settings.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 
 grpc_core::TraceFlag grpc_flowctl_trace(false, "flowctl");
@@ -117,6 +118,14 @@ TransportFlowControl::TransportFlowControl(absl::string_view name,
                           .set_integral_range(10)),
       last_pid_update_(Timestamp::Now()) {}
 
+void TransportFlowControl::SetPredictiveBdp(
+    absl::optional<BdpHistory::Sample> initial) {
+  predictive_bdp_ = true;
+  if (initial.has_value()) {
+    bdp_estimator_.Seed(initial->bdp, initial->bandwidth);
+  }
+}
+
 uint32_t TransportFlowControl::MaybeSendUpdate(bool writing_anyway) {
   const uint32_t target_announced_window =
       static_cast<uint32_t>(target_window());
@@ -131,6 +140,31 @@ uint32_t TransportFlowControl::MaybeSendUpdate(bool writing_anyway) {
   return 0;
 }
 
+BdpHistory* BdpHistory::Get() { return NoDestructSingleton<BdpHistory>::Get(); }
+
+absl::optional<BdpHistory::Sample> BdpHistory::Lookup(absl::string_view peer) {
+  MutexLock lock(&mu_);
+  auto it = entries_.find(peer);
+  if (it == entries_.end()) return absl::nullopt;
+  return it->second.sample;
+}
+
+void BdpHistory::Record(absl::string_view peer, Sample sample) {
+  MutexLock lock(&mu_);
+  auto it = entries_.find(peer);
+  if (it == entries_.end()) {
+    if (entries_.size() >= kMaxPeers) {
+      entries_.erase(std::min_element(
+          entries_.begin(), entries_.end(), [](const auto& a, const auto& b) {
+            return a.second.recorded_at < b.second.recorded_at;
+          }));
+    }
+    it = entries_.emplace(std::string(peer), Entry()).first;
+  }
+  it->second.sample = sample;
+  it->second.recorded_at = ++records_;
+}
+
 StreamFlowControl::StreamFlowControl(TransportFlowControl* tfc) : tfc_(tfc) {}
 
 absl::Status StreamFlowControl::IncomingUpdateContext::RecvData(
@@ -270,6 +304,16 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   }
 }
 
+double TransportFlowControl::TargetInitialWindowSize() {
+  if (IsMemoryPressureControllerEnabled()) {
+    return TargetInitialWindowSizeBasedOnMemoryPressureAndBdp();
+  }
+  // TargetLogBdp() already backs off under memory pressure, so following it
+  // directly stays within what the memory quota can spare.
+  if (predictive_bdp_) return pow(2, TargetLogBdp());
+  return pow(2, SmoothLogBdp(TargetLogBdp()));
+}
+
 void TransportFlowControl::UpdateSetting(
     grpc_chttp2_setting_id id, int64_t* desired_value,
     uint32_t new_desired_value, FlowControlAction* action,
@@ -332,11 +376,9 @@ FlowControlAction TransportFlowControl::PeriodicUpdate() {
       // target might change based on how much memory pressure we are under
       // TODO(ncteisen): experiment with setting target to be huge under low
       // memory pressure.
-      uint32_t target = static_cast<uint32_t>(RoundUpToPowerOf2(
-          Clamp(IsMemoryPressureControllerEnabled()
-                    ? TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
-                    : pow(2, SmoothLogBdp(TargetLogBdp())),
-                0.0, static_cast<double>(kMaxInitialWindowSize))));
+      uint32_t target = static_cast<uint32_t>(
+          RoundUpToPowerOf2(Clamp(TargetInitialWindowSize(), 0.0,
+                                  static_cast<double>(kMaxInitialWindowSize))));
       if (target < kMinPositiveInitialWindowSize) target = 0;
       if (g_test_only_transport_target_window_estimates_mocker != nullptr) {
         // Hook for simulating unusual flow control situations in tests.
@@ -358,9 +400,7 @@ FlowControlAction TransportFlowControl::PeriodicUpdate() {
       // target might change based on how much memory pressure we are under
       // TODO(ncteisen): experiment with setting target to be huge under low
       // memory pressure.
-      double target = IsMemoryPressureControllerEnabled()
-                          ? TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
-                          : pow(2, SmoothLogBdp(TargetLogBdp()));
+      double target = TargetInitialWindowSize();
       if (g_test_only_transport_target_window_estimates_mocker != nullptr) {
         // Hook for simulating unusual flow control situations in tests.
         target = g_test_only_transport_target_window_estimates_mocker
@@ -24,7 +24,9 @@
 #include <limits.h>
 #include <stdint.h>
 
+#include <functional>
 #include <iosfwd>
+#include <map>
 #include <string>
 #include <utility>
 
@@ -37,6 +39,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/http2_settings.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/transport/bdp_estimator.h"
@@ -165,6 +168,37 @@ class GRPC_MUST_USE_RESULT FlowControlAction {
 std::ostream& operator<<(std::ostream& out, FlowControlAction::Urgency urgency);
 std::ostream& operator<<(std::ostream& out, const FlowControlAction& action);
 
+// Remembers the BDP and bandwidth last measured towards each peer, so that a
+// new connection to a peer can start with windows sized for it rather than
+// growing them from the http2 defaults.
+class BdpHistory {
+ public:
+  struct Sample {
+    int64_t bdp;
+    double bandwidth;
+  };
+
+  // The history shared by all transports in the process.
+  static BdpHistory* Get();
+
+  absl::optional<Sample> Lookup(absl::string_view peer);
+  void Record(absl::string_view peer, Sample sample);
+
+ private:
+  struct Entry {
+    Sample sample;
+    uint64_t recorded_at;
+  };
+
+  // Past this many peers, recording a new one forgets the one recorded
+  // longest ago.
+  static constexpr size_t kMaxPeers = 1024;
+
+  Mutex mu_;
+  std::map<std::string, Entry, std::less<>> entries_ ABSL_GUARDED_BY(mu_);
+  uint64_t records_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
 // Implementation of flow control that abides to HTTP/2 spec and attempts
 // to be as performant as possible.
 class TransportFlowControl final {
@@ -175,6 +209,12 @@ class TransportFlowControl final {
 
   bool bdp_probe() const { return enable_bdp_probe_; }
 
+  // Sizes windows for the BDP estimate as soon as it changes, rather than
+  // approaching it gradually; starts the estimate from initial if given,
+  // typically what an earlier connection to the same peer measured.
+  void SetPredictiveBdp(absl::optional<BdpHistory::Sample> initial);
+  bool predictive_bdp() const { return predictive_bdp_; }
+
   // returns an announce if we should send a transport update to our peer,
   // else returns zero; writing_anyway indicates if a write would happen
   // regardless of the send - if it is false and this function returns non-zero,
@@ -282,6 +322,7 @@ class TransportFlowControl final {
   double TargetLogBdp();
   double SmoothLogBdp(double value);
   double TargetInitialWindowSizeBasedOnMemoryPressureAndBdp() const;
+  double TargetInitialWindowSize();
   static void UpdateSetting(grpc_chttp2_setting_id id, int64_t* desired_value,
                             uint32_t new_desired_value,
                             FlowControlAction* action,
@@ -304,6 +345,8 @@ class TransportFlowControl final {
 
   /// should we probe bdp?
   const bool enable_bdp_probe_;
+  /// should windows follow the bdp estimate without smoothing?
+  bool predictive_bdp_ = false;
 
   // bdp estimation
   BdpEstimator bdp_estimator_;
@@ -28,6 +28,7 @@
 #include "absl/strings/str_format.h"
 
 #include <grpc/slice_buffer.h>
+#include <grpc/status.h>
 #include <grpc/support/log.h>
 
 #include "src/core/ext/transport/chttp2/transport/internal.h"
@@ -137,6 +138,32 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
   return absl::OkStatus();
 }
 
+bool grpc_chttp2_reject_oversized_incoming_message(grpc_chttp2_transport* t,
+                                                   grpc_chttp2_stream* s) {
+  if (!t->max_recv_message_size.has_value()) return false;
+  if (s->frame_storage.length < GRPC_HEADER_SIZE_IN_BYTES) return false;
+  uint8_t header[GRPC_HEADER_SIZE_IN_BYTES];
+  grpc_slice_buffer_copy_first_into_buffer(&s->frame_storage,
+                                           GRPC_HEADER_SIZE_IN_BYTES, header);
+  uint32_t length = (static_cast<uint32_t>(header[1]) << 24) |
+                    (static_cast<uint32_t>(header[2]) << 16) |
+                    (static_cast<uint32_t>(header[3]) << 8) |
+                    static_cast<uint32_t>(header[4]);
+  if (length <= *t->max_recv_message_size) return false;
+  // Same error as the message size filter, but raised before the message
+  // has been buffered.
+  grpc_slice_buffer_reset_and_unref(&s->frame_storage);
+  grpc_chttp2_cancel_stream(
+      t, s,
+      grpc_error_set_int(
+          GRPC_ERROR_CREATE(
+              absl::StrFormat("Received message larger than max (%u vs. %d)",
+                              length, *t->max_recv_message_size)),
+          grpc_core::StatusIntProperty::kRpcStatus,
+          GRPC_STATUS_RESOURCE_EXHAUSTED));
+  return true;
+}
+
 grpc_error_handle grpc_chttp2_data_parser_parse(void* /*parser*/,
                                                 grpc_chttp2_transport* t,
                                                 grpc_chttp2_stream* s,
@@ -144,6 +171,9 @@ grpc_error_handle grpc_chttp2_data_parser_parse(void* /*parser*/,
                                                 int is_last) {
   grpc_core::CSliceRef(slice);
   grpc_slice_buffer_add(&s->frame_storage, slice);
+  if (grpc_chttp2_reject_oversized_incoming_message(t, s)) {
+    return absl::OkStatus();
+  }
   grpc_chttp2_maybe_complete_recv_message(t, s);
 
   if (is_last && s->received_last_frame) {
@@ -57,4 +57,10 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
     grpc_chttp2_stream* s, int64_t* min_progress_size,
     grpc_core::SliceBuffer* stream_out, uint32_t* message_flags);
 
+// If the transport enforces a maximum receive message size and the length
+// prefix of the next message in \a s's frame storage exceeds it, drops the
+// buffered data and cancels \a s. Returns true if \a s was cancelled.
+bool grpc_chttp2_reject_oversized_incoming_message(grpc_chttp2_transport* t,
+                                                   grpc_chttp2_stream* s);
+
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_FRAME_DATA_H
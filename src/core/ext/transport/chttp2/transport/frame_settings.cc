@@ -141,6 +141,11 @@ grpc_error_handle grpc_chttp2_settings_parser_parse(void* p,
           if (is_last) {
             memcpy(parser->target_settings, parser->incoming_settings,
                    GRPC_CHTTP2_NUM_SETTINGS * sizeof(uint32_t));
+            if (t->stream_limit != nullptr) {
+              t->stream_limit->SetPeerLimit(
+                  parser->target_settings
+                      [GRPC_CHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS]);
+            }
             t->num_pending_induced_frames++;
             grpc_slice_buffer_add(&t->qbuf, grpc_chttp2_settings_ack_create());
             grpc_chttp2_initiate_write(t,
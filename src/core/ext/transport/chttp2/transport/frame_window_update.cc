@@ -103,6 +103,7 @@ grpc_error_handle grpc_chttp2_window_update_parser_parse(
         grpc_core::chttp2::StreamFlowControl::OutgoingUpdateContext(
             &s->flow_control)
             .RecvUpdate(received_update);
+        grpc_chttp2_publish_write_window_hint(t, s);
         if (grpc_chttp2_list_remove_stalled_by_stream(t, s)) {
           grpc_chttp2_mark_stream_writable(t, s);
           grpc_chttp2_initiate_write(
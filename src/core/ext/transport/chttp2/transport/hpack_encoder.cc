@@ -22,6 +22,10 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "absl/hash/hash.h"
 
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
@@ -225,6 +229,16 @@ void HPackCompressor::Encoder::EmitLitHdrWithNonBinaryStringKeyIncIdx(
   output_.Append(emit.data());
 }
 
+void HPackCompressor::Encoder::EmitLitHdrWithNonBinaryStringKeyIncIdx(
+    uint32_t key_index, Slice value_slice) {
+  NonBinaryStringValue emit(std::move(value_slice));
+  VarintWriter<2> key(key_index);
+  uint8_t* data = output_.AddTiny(key.length() + emit.prefix_length());
+  key.Write(0x40, data);
+  emit.WritePrefix(data + key.length());
+  output_.Append(emit.data());
+}
+
 void HPackCompressor::Encoder::EmitLitHdrWithBinaryStringKeyNotIdx(
     Slice key_slice, Slice value_slice) {
   StringKey key(std::move(key_slice));
@@ -266,6 +280,11 @@ void HPackCompressor::Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(
 }
 
 void HPackCompressor::Encoder::AdvertiseTableSizeChange() {
+  if (std::exchange(compressor_->advertise_table_eviction_, false) &&
+      compressor_->table_.max_size() != 0) {
+    VarintWriter<3> w(0);
+    w.Write(0x20, output_.AddTiny(w.length()));
+  }
   VarintWriter<3> w(compressor_->table_.max_size());
   w.Write(0x20, output_.AddTiny(w.length()));
 }
@@ -316,12 +335,91 @@ void HPackCompressor::SliceIndex::EmitTo(absl::string_view key,
   values_.emplace_back(value.Ref(), index);
 }
 
-void HPackCompressor::Encoder::Encode(const Slice& key, const Slice& value) {
-  if (absl::EndsWith(key.as_string_view(), "-bin")) {
-    EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
-  } else {
-    EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+uint32_t HPackCompressor::AdaptiveIndex::Sketch::Record(
+    absl::string_view key, absl::string_view value) {
+  // Derive one slot per row from a single hash (Kirsch-Mitzenmacher).
+  const uint64_t hash =
+      absl::Hash<std::pair<absl::string_view, absl::string_view>>()(
+          std::make_pair(key, value));
+  const uint32_t h1 = static_cast<uint32_t>(hash);
+  const uint32_t h2 = static_cast<uint32_t>(hash >> 32) | 1;
+  uint8_t* counters[kDepth];
+  uint8_t estimate = std::numeric_limits<uint8_t>::max();
+  for (size_t row = 0; row < kDepth; row++) {
+    counters[row] = &counts_[row][(h1 + row * h2) % kWidth];
+    estimate = std::min(estimate, *counters[row]);
   }
+  // Conservative update: only raise the counters that hold the estimate,
+  // which keeps other pairs' estimates from being inflated.
+  if (estimate < std::numeric_limits<uint8_t>::max()) {
+    for (uint8_t* counter : counters) {
+      if (*counter == estimate) ++*counter;
+    }
+    ++estimate;
+  }
+  if (--sightings_until_aging_ == 0) {
+    sightings_until_aging_ = kAgingPeriod;
+    for (auto& row : counts_) {
+      for (uint8_t& counter : row) counter /= 2;
+    }
+  }
+  return estimate;
+}
+
+void HPackCompressor::AdaptiveIndex::EmitTo(const Slice& key,
+                                            const Slice& value,
+                                            Encoder* encoder) {
+  const absl::string_view key_view = key.as_string_view();
+  const size_t transport_length =
+      hpack_constants::SizeForEntry(key.length(), value.length());
+  // Binary values are not indexed: their table size depends on how they are
+  // encoded. Credentials are never indexed, as indexing them would allow
+  // compression based attacks to guess them (RFC 7541 section 7.1).
+  if (absl::EndsWith(key_view, "-bin")) {
+    encoder->EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    return;
+  }
+  if (transport_length > HPackEncoderTable::MaxEntrySize() ||
+      key_view == "authorization" || key_view == "cookie") {
+    encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    return;
+  }
+  if (sketch_ == nullptr) sketch_ = std::make_unique<Sketch>();
+  if (sketch_->Record(key_view, value.as_string_view()) < 2) {
+    encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    return;
+  }
+  auto& table = encoder->compressor_->table_;
+  lookup_key_.assign(key_view.data(), key_view.size());
+  lookup_key_.push_back('\0');
+  lookup_key_.append(reinterpret_cast<const char*>(value.data()),
+                     value.size());
+  auto it = indices_.find(lookup_key_);
+  if (it != indices_.end() && table.ConvertableToDynamicIndex(it->second)) {
+    encoder->EmitIndexed(table.DynamicIndex(it->second));
+    return;
+  }
+  const uint32_t index = table.AllocateIndex(transport_length);
+  encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(key.Ref(), value.Ref());
+  if (it != indices_.end()) {
+    it->second = index;
+    return;
+  }
+  indices_.emplace(lookup_key_, index);
+  if (indices_.size() > prune_threshold_) {
+    for (auto prune = indices_.begin(); prune != indices_.end();) {
+      if (table.ConvertableToDynamicIndex(prune->second)) {
+        ++prune;
+      } else {
+        indices_.erase(prune++);
+      }
+    }
+    prune_threshold_ = std::max(kMinPruneThreshold, 2 * indices_.size());
+  }
+}
+
+void HPackCompressor::Encoder::Encode(const Slice& key, const Slice& value) {
+  compressor_->adaptive_index_.EmitTo(key, value, this);
 }
 
 void HPackCompressor::Encoder::Encode(HttpPathMetadata, const Slice& value) {
@@ -476,8 +574,15 @@ void HPackCompressor::Encoder::EncodeRepeatingSliceValue(
 
 void HPackCompressor::Encoder::Encode(GrpcTimeoutMetadata, Timestamp deadline) {
   Timeout timeout = Timeout::FromDuration(deadline - Timestamp::Now());
+  // Dynamic index of a previous timeout still in the table, whose name a new
+  // timeout can refer to.
+  uint32_t name_index = 0;
   for (auto it = compressor_->previous_timeouts_.begin();
        it != compressor_->previous_timeouts_.end(); ++it) {
+    if (name_index == 0 &&
+        compressor_->table_.ConvertableToDynamicIndex(it->index)) {
+      name_index = compressor_->table_.DynamicIndex(it->index);
+    }
     double ratio = timeout.RatioVersus(it->timeout);
     // If the timeout we're sending is shorter than a previous timeout, but
     // within 3% of it, we'll consider sending it.
@@ -501,6 +606,12 @@ void HPackCompressor::Encoder::Encode(GrpcTimeoutMetadata, Timestamp deadline) {
       GrpcTimeoutMetadata::key().length() + encoded.length() +
       hpack_constants::kEntryOverhead);
   compressor_->previous_timeouts_.push_back(PreviousTimeout{timeout, index});
+  // The index is resolved by the peer before the new entry is added, even if
+  // adding it evicts the entry referred to.
+  if (name_index != 0) {
+    EmitLitHdrWithNonBinaryStringKeyIncIdx(name_index, std::move(encoded));
+    return;
+  }
   EmitLitHdrWithNonBinaryStringKeyIncIdx(
       Slice::FromStaticString(GrpcTimeoutMetadata::key()), std::move(encoded));
 }
@@ -606,6 +717,21 @@ void HPackCompressor::SetMaxTableSize(uint32_t max_table_size) {
   }
 }
 
+void HPackCompressor::EvictAll() {
+  if (table_.EvictAll()) {
+    advertise_table_size_change_ = true;
+    advertise_table_eviction_ = true;
+  }
+  // Every index still held refers to an evicted entry, so only the memory
+  // they hold matters.
+  user_agent_ = Slice();
+  user_agent_index_ = 0;
+  path_index_ = SliceIndex();
+  authority_index_ = SliceIndex();
+  adaptive_index_ = AdaptiveIndex();
+  previous_timeouts_ = std::vector<PreviousTimeout>();
+}
+
 HPackCompressor::Encoder::Encoder(HPackCompressor* compressor,
                                   bool use_true_binary_metadata,
                                   SliceBuffer& output)
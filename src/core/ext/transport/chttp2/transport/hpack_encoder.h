@@ -24,9 +24,12 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/match.h"
 #include "absl/strings/string_view.h"
 
@@ -48,6 +51,7 @@ namespace grpc_core {
 
 class HPackCompressor {
   class SliceIndex;
+  class AdaptiveIndex;
 
  public:
   HPackCompressor() = default;
@@ -58,6 +62,10 @@ class HPackCompressor {
 
   void SetMaxTableSize(uint32_t max_table_size);
   void SetMaxUsableSize(uint32_t max_table_size);
+  // Evict the whole dynamic table and forget what was sent, to release memory
+  // while the connection is idle. The next header block makes the peer's
+  // decoder evict its table too.
+  void EvictAll();
 
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
@@ -107,6 +115,8 @@ class HPackCompressor {
     void Encode(GrpcAcceptEncodingMetadata, CompressionAlgorithmSet value);
     void Encode(GrpcTagsBinMetadata, const Slice& slice);
     void Encode(GrpcTraceBinMetadata, const Slice& slice);
+    // Only schedules writes on this end of the connection.
+    void Encode(GrpcWriteWeightMetadata, uint32_t) {}
     void Encode(GrpcMessageMetadata, const Slice& slice) {
       if (slice.empty()) return;
       EmitLitHdrWithNonBinaryStringKeyNotIdx(
@@ -126,11 +136,14 @@ class HPackCompressor {
 
    private:
     friend class SliceIndex;
+    friend class AdaptiveIndex;
 
     void AdvertiseTableSizeChange();
     void EmitIndexed(uint32_t index);
     void EmitLitHdrWithNonBinaryStringKeyIncIdx(Slice key_slice,
                                                 Slice value_slice);
+    void EmitLitHdrWithNonBinaryStringKeyIncIdx(uint32_t key_index,
+                                                Slice value_slice);
     void EmitLitHdrWithBinaryStringKeyIncIdx(Slice key_slice,
                                              Slice value_slice);
     void EmitLitHdrWithBinaryStringKeyNotIdx(Slice key_slice,
@@ -166,6 +179,9 @@ class HPackCompressor {
   // if non-zero, advertise to the decoder that we'll start using a table
   // of this size
   bool advertise_table_size_change_ = false;
+  // if true, advertise an empty table before the current size, so that the
+  // decoder evicts everything
+  bool advertise_table_eviction_ = false;
   HPackEncoderTable table_;
 
   class SliceIndex {
@@ -182,6 +198,45 @@ class HPackCompressor {
     std::vector<ValueIndex> values_;
   };
 
+  // Indexes metadata that has no dedicated encoder, but only the key/value
+  // pairs that are likely to be sent again: a count-min sketch estimates how
+  // often each pair has been sent on this connection, and pairs seen for the
+  // first time are sent as literals. High-cardinality values such as request
+  // or trace ids therefore never evict table entries that would be reused.
+  class AdaptiveIndex {
+   public:
+    void EmitTo(const Slice& key, const Slice& value, Encoder* encoder);
+
+   private:
+    class Sketch {
+     public:
+      // Record one more sighting of key/value, and return the estimated
+      // number of sightings so far (including this one).
+      uint32_t Record(absl::string_view key, absl::string_view value);
+
+     private:
+      static constexpr size_t kDepth = 4;
+      static constexpr size_t kWidth = 256;
+      // Halve every counter after this many sightings, so that the sketch
+      // does not fill up and values that stop recurring are forgotten.
+      static constexpr uint32_t kAgingPeriod = 64;
+
+      uint8_t counts_[kDepth][kWidth] = {};
+      uint32_t sightings_until_aging_ = kAgingPeriod;
+    };
+
+    // Allocated with the first pair, leaving connections that only send
+    // metadata with dedicated encoders unaffected.
+    std::unique_ptr<Sketch> sketch_;
+    // Table index of each indexed pair, keyed by key + '\0' + value.
+    absl::flat_hash_map<std::string, uint32_t> indices_;
+    // Scratch space to build lookup keys in without allocating.
+    std::string lookup_key_;
+    // Drop entries evicted from the table once indices_ grows past this.
+    size_t prune_threshold_ = kMinPruneThreshold;
+    static constexpr size_t kMinPruneThreshold = 32;
+  };
+
   struct PreviousTimeout {
     Timeout timeout;
     uint32_t index;
@@ -209,6 +264,7 @@ class HPackCompressor {
   Slice user_agent_;
   SliceIndex path_index_;
   SliceIndex authority_index_;
+  AdaptiveIndex adaptive_index_;
   std::vector<PreviousTimeout> previous_timeouts_;
 };
 
@@ -66,6 +66,20 @@ bool HPackEncoderTable::SetMaxSize(uint32_t max_table_size) {
   return true;
 }
 
+bool HPackEncoderTable::EvictAll() {
+  if (table_elems_ == 0) return false;
+  while (table_elems_ > 0) {
+    EvictOne();
+  }
+  const uint32_t capacity =
+      std::max(hpack_constants::EntriesForBytes(max_table_size_),
+               hpack_constants::kInitialTableEntries);
+  if (capacity < elem_size_.size()) {
+    Rebuild(capacity);
+  }
+  return true;
+}
+
 void HPackEncoderTable::EvictOne() {
   tail_remote_index_++;
   GPR_ASSERT(tail_remote_index_ > 0);
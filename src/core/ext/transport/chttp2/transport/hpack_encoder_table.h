@@ -46,6 +46,9 @@ class HPackEncoderTable {
   uint32_t AllocateIndex(size_t element_size);
   // Set the maximum table size. Return true if it changed.
   bool SetMaxSize(uint32_t max_table_size);
+  // Evict every element, and release the capacity grown past what the
+  // maximum table size needs. Return true if anything was evicted.
+  bool EvictAll();
   // Get the current max table size
   uint32_t max_size() const { return max_table_size_; }
   // Get the current table size
@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <initializer_list>
+#include <limits>
 #include <string>
 #include <utility>
 
@@ -307,44 +308,54 @@ class HPackParser::String {
     GPR_UNREACHABLE_CODE(return absl::string_view());
   }
 
-  // Parse a non-binary string
-  static absl::optional<String> Parse(Input* input) {
-    auto pfx = input->ParseStringPrefix();
-    if (!pfx.has_value()) return {};
-    if (pfx->huff) {
+  // The fewest bytes that a string with prefix pfx can decode to.
+  static size_t MinDecodedLength(Input::StringPrefix pfx, bool is_binary) {
+    // No huffman code is longer than 30 bits, so every four bytes hold at
+    // least one symbol.
+    size_t length = pfx.huff ? pfx.length / 4 : pfx.length;
+    // Base64 turns four bytes into three, less up to two bytes of padding;
+    // true binary only drops its leading zero.
+    if (is_binary) length = length < 2 ? 0 : 3 * (length - 2) / 4;
+    return length;
+  }
+
+  // Parse the rest of a non-binary string with prefix pfx
+  static absl::optional<String> Parse(Input* input, Input::StringPrefix pfx) {
+    if (pfx.huff) {
       // Huffman coded
       std::vector<uint8_t> output;
-      auto v = ParseHuff(input, pfx->length,
+      output.reserve(MaxHuffDecodedLength(input, pfx.length));
+      auto v = ParseHuff(input, pfx.length,
                          [&output](uint8_t c) { output.push_back(c); });
       if (!v) return {};
       return String(std::move(output));
     }
-    return ParseUncompressed(input, pfx->length);
+    return ParseUncompressed(input, pfx.length);
   }
 
-  // Parse a binary string
-  static absl::optional<String> ParseBinary(Input* input) {
-    auto pfx = input->ParseStringPrefix();
-    if (!pfx.has_value()) return {};
-    if (!pfx->huff) {
-      if (pfx->length > 0 && input->peek() == 0) {
+  // Parse the rest of a binary string with prefix pfx
+  static absl::optional<String> ParseBinary(Input* input,
+                                            Input::StringPrefix pfx) {
+    if (!pfx.huff) {
+      if (pfx.length > 0 && input->peek() == 0) {
         // 'true-binary'
         input->Advance(1);
-        return ParseUncompressed(input, pfx->length - 1);
+        return ParseUncompressed(input, pfx.length - 1);
       }
       // Base64 encoded... pull out the string, then unbase64 it
-      auto base64 = ParseUncompressed(input, pfx->length);
+      auto base64 = ParseUncompressed(input, pfx.length);
       if (!base64.has_value()) return {};
       return Unbase64(input, std::move(*base64));
     } else {
       // Huffman encoded...
       std::vector<uint8_t> decompressed;
+      decompressed.reserve(MaxHuffDecodedLength(input, pfx.length));
       // State here says either we don't know if it's base64 or binary, or we do
       // and what is it.
       enum class State { kUnsure, kBinary, kBase64 };
       State state = State::kUnsure;
       auto decompressed_ok =
-          ParseHuff(input, pfx->length, [&state, &decompressed](uint8_t c) {
+          ParseHuff(input, pfx.length, [&state, &decompressed](uint8_t c) {
             if (state == State::kUnsure) {
               // First byte... if it's zero it's binary
               if (c == 0) {
@@ -382,6 +393,13 @@ class HPackParser::String {
   String(grpc_slice_refcount* r, const uint8_t* begin, const uint8_t* end)
       : value_(Slice::FromRefcountAndBytes(r, begin, end)) {}
 
+  // The shortest huffman code is five bits long, which bounds the size of the
+  // decoded string; this is used to size output buffers up front. The length
+  // prefix is only trusted as far as the bytes that are actually available.
+  static size_t MaxHuffDecodedLength(Input* input, uint32_t length) {
+    return std::min<size_t>(input->remaining(), length) * 8 / 5;
+  }
+
   // Parse some huffman encoded bytes, using output(uint8_t b) to emit each
   // decoded byte.
   template <typename Out>
@@ -554,11 +572,11 @@ class HPackParser::Parser {
       case 1:
         switch (cur & 0xf) {
           case 0:  // literal key
-            return FinishHeaderOmitFromTable(ParseLiteralKey());
+            return FinishLiteralHeaderOmitFromTable();
           case 0xf:  // varint encoded key index
-            return FinishHeaderOmitFromTable(ParseVarIdxKey(0xf));
+            return FinishHeaderOmitFromTable(ParseVarIdxKey(0xf, false));
           default:  // inline encoded key index
-            return FinishHeaderOmitFromTable(ParseIdxKey(cur & 0xf));
+            return FinishHeaderOmitFromTable(ParseIdxKey(cur & 0xf, false));
         }
         // Update max table size.
         // First byte format: 001xxxxx
@@ -585,20 +603,20 @@ class HPackParser::Parser {
       case 4:
         if (cur == 0x40) {
           // literal key
-          return FinishHeaderAndAddToTable(ParseLiteralKey());
+          return FinishHeaderAndAddToTable(ParseLiteralKey(true));
         }
         ABSL_FALLTHROUGH_INTENDED;
       case 5:
       case 6:
         // inline encoded key index
-        return FinishHeaderAndAddToTable(ParseIdxKey(cur & 0x3f));
+        return FinishHeaderAndAddToTable(ParseIdxKey(cur & 0x3f, true));
       case 7:
         if (cur == 0x7f) {
           // varint encoded key index
-          return FinishHeaderAndAddToTable(ParseVarIdxKey(0x3f));
+          return FinishHeaderAndAddToTable(ParseVarIdxKey(0x3f, true));
         } else {
           // inline encoded key index
-          return FinishHeaderAndAddToTable(ParseIdxKey(cur & 0x3f));
+          return FinishHeaderAndAddToTable(ParseIdxKey(cur & 0x3f, true));
         }
         // Indexed Header Field Representation
         // First byte format: 1xxxxxxx
@@ -656,7 +674,7 @@ class HPackParser::Parser {
     if (GPR_UNLIKELY(metadata_buffer_ == nullptr)) return true;
     *frame_length_ += md.transport_size();
     if (GPR_UNLIKELY(*frame_length_ > metadata_size_limit_)) {
-      return HandleMetadataSizeLimitExceeded(md);
+      return HandleMetadataSizeLimitExceeded(md.key(), md.transport_size());
     }
 
     metadata_buffer_->Set(md);
@@ -695,16 +713,51 @@ class HPackParser::Parser {
     return EmitHeader(md);
   }
 
+  // Parse a literal key and value that are not added to the hpack table,
+  // and append them straight to the metadata batch: nothing else needs the
+  // parsed header, so skip building a memento for it.
+  bool FinishLiteralHeaderOmitFromTable() {
+    if (GPR_UNLIKELY(metadata_buffer_ == nullptr ||
+                     GRPC_TRACE_FLAG_ENABLED(grpc_trace_chttp2_hpack_parser))) {
+      return FinishHeaderOmitFromTable(ParseLiteralKey(false));
+    }
+    auto key = ParseKeyString();
+    if (!key.has_value()) return false;
+    auto value = ParseValueString(key->string_view(),
+                                  absl::EndsWith(key->string_view(), "-bin"));
+    if (GPR_UNLIKELY(!value.has_value())) return false;
+    auto key_string = key->string_view();
+    auto value_slice = value->Take();
+    const uint32_t transport_size = static_cast<uint32_t>(
+        hpack_constants::SizeForEntry(key_string.size(), value_slice.size()));
+    *frame_length_ += transport_size;
+    if (GPR_UNLIKELY(*frame_length_ > metadata_size_limit_)) {
+      return HandleMetadataSizeLimitExceeded(key_string, transport_size);
+    }
+    metadata_buffer_->Append(
+        key_string, std::move(value_slice),
+        [key_string](absl::string_view error, const Slice& value) {
+          ReportMetadataParseError(key_string, error, value.as_string_view());
+        });
+    return true;
+  }
+
   // Parse a string encoded key and a string encoded value
-  absl::optional<HPackTable::Memento> ParseLiteralKey() {
-    auto key = String::Parse(input_);
+  // If add_to_table is true the result is destined for the hpack table, and
+  // its value may be shared with other connections.
+  absl::optional<HPackTable::Memento> ParseLiteralKey(bool add_to_table) {
+    auto key = ParseKeyString();
     if (!key.has_value()) return {};
-    auto value = ParseValueString(absl::EndsWith(key->string_view(), "-bin"));
+    auto value = ParseValueString(key->string_view(),
+                                  absl::EndsWith(key->string_view(), "-bin"));
     if (GPR_UNLIKELY(!value.has_value())) {
       return {};
     }
     auto key_string = key->string_view();
     auto value_slice = value->Take();
+    if (add_to_table) {
+      value_slice = HPackTable::InternValue(key_string, std::move(value_slice));
+    }
     const auto transport_size = key_string.size() + value_slice.size() +
                                 hpack_constants::kEntryOverhead;
     return grpc_metadata_batch::Parse(
@@ -715,33 +768,74 @@ class HPackParser::Parser {
   }
 
   // Parse an index encoded key and a string encoded value
-  absl::optional<HPackTable::Memento> ParseIdxKey(uint32_t index) {
+  absl::optional<HPackTable::Memento> ParseIdxKey(uint32_t index,
+                                                  bool add_to_table) {
     const auto* elem = table_->Lookup(index);
     if (GPR_UNLIKELY(elem == nullptr)) {
       return InvalidHPackIndexError(index,
                                     absl::optional<HPackTable::Memento>());
     }
-    auto value = ParseValueString(elem->is_binary_header());
+    auto value = ParseValueString(elem->key(), elem->is_binary_header());
     if (GPR_UNLIKELY(!value.has_value())) return {};
+    auto value_slice = value->Take();
+    if (add_to_table) {
+      value_slice =
+          HPackTable::InternValue(elem->key(), std::move(value_slice));
+    }
     return elem->WithNewValue(
-        value->Take(), [=](absl::string_view error, const Slice& value) {
+        std::move(value_slice),
+        [=](absl::string_view error, const Slice& value) {
           ReportMetadataParseError(elem->key(), error, value.as_string_view());
         });
   }
 
   // Parse a varint index encoded key and a string encoded value
-  absl::optional<HPackTable::Memento> ParseVarIdxKey(uint32_t offset) {
+  absl::optional<HPackTable::Memento> ParseVarIdxKey(uint32_t offset,
+                                                     bool add_to_table) {
     auto index = input_->ParseVarint(offset);
     if (GPR_UNLIKELY(!index.has_value())) return {};
-    return ParseIdxKey(*index);
+    return ParseIdxKey(*index, add_to_table);
+  }
+
+  // Parse the length prefix of a string that adds to a header of known_size
+  // bytes so far. Should the header not fit in the metadata size limit
+  // whatever the string decodes to, reject it right away, rather than after
+  // buffering the rest of the string over any number of frames.
+  absl::optional<Input::StringPrefix> ParseStringPrefix(absl::string_view key,
+                                                        size_t known_size,
+                                                        bool is_binary) {
+    auto pfx = input_->ParseStringPrefix();
+    if (!pfx.has_value()) return {};
+    if (GPR_UNLIKELY(metadata_buffer_ == nullptr)) return pfx;
+    const size_t min_size = known_size +
+                            String::MinDecodedLength(*pfx, is_binary) +
+                            hpack_constants::kEntryOverhead;
+    if (GPR_UNLIKELY(*frame_length_ + min_size > metadata_size_limit_)) {
+      *frame_length_ = static_cast<uint32_t>(std::min<size_t>(
+          *frame_length_ + min_size, std::numeric_limits<uint32_t>::max()));
+      return HandleMetadataSizeLimitExceeded(
+          key, min_size, absl::optional<Input::StringPrefix>());
+    }
+    return pfx;
+  }
+
+  // Parse a literal key.
+  absl::optional<String> ParseKeyString() {
+    auto pfx = ParseStringPrefix("literal key", 0, false);
+    if (!pfx.has_value()) return {};
+    return String::Parse(input_, *pfx);
   }
 
-  // Parse a string, figuring out if it's binary or not by the key name.
-  absl::optional<String> ParseValueString(bool is_binary) {
+  // Parse the value of key, figuring out if it's binary or not by the key
+  // name.
+  absl::optional<String> ParseValueString(absl::string_view key,
+                                          bool is_binary) {
+    auto pfx = ParseStringPrefix(key, key.size(), is_binary);
+    if (!pfx.has_value()) return {};
     if (is_binary) {
-      return String::ParseBinary(input_);
+      return String::ParseBinary(input_, *pfx);
     } else {
-      return String::Parse(input_);
+      return String::Parse(input_, *pfx);
     }
   }
 
@@ -817,7 +911,16 @@ class HPackParser::Parser {
   };
 
   GPR_ATTRIBUTE_NOINLINE
-  bool HandleMetadataSizeLimitExceeded(const HPackTable::Memento& md) {
+  bool HandleMetadataSizeLimitExceeded(absl::string_view key,
+                                       size_t transport_size) {
+    return HandleMetadataSizeLimitExceeded(key, transport_size, false);
+  }
+
+  // Set the metadata size limit error if no error has been set. Returns
+  // result unmodified.
+  template <typename R>
+  GPR_ATTRIBUTE_NOINLINE R HandleMetadataSizeLimitExceeded(
+      absl::string_view key, size_t transport_size, R result) {
     // Collect a summary of sizes so far for debugging
     // Do not collect contents, for fear of exposing PII.
     std::string summary;
@@ -826,8 +929,8 @@ class HPackParser::Parser {
       metadata_buffer_->Encode(&encoder);
     }
     summary =
-        absl::StrCat("; adding ", md.key(), " (length ", md.transport_size(),
-                     "B)", summary.empty() ? "" : " to ", summary);
+        absl::StrCat("; adding ", key, " (length ", transport_size, "B)",
+                     summary.empty() ? "" : " to ", summary);
     if (metadata_buffer_ != nullptr) metadata_buffer_->Clear();
     // StreamId is used as a signal to skip this stream but keep the connection
     // alive
@@ -843,7 +946,7 @@ class HPackParser::Parser {
                   GRPC_STATUS_RESOURCE_EXHAUSTED),
               StatusIntProperty::kStreamId, 0);
         },
-        false);
+        std::move(result));
   }
 
   static void ReportMetadataParseError(absl::string_view key,
@@ -897,11 +1000,13 @@ void HPackParser::BeginFrame(grpc_metadata_batch* metadata_buffer,
 
 grpc_error_handle HPackParser::Parse(const grpc_slice& slice, bool is_last) {
   if (GPR_UNLIKELY(!unparsed_bytes_.empty())) {
-    std::vector<uint8_t> buffer = std::move(unparsed_bytes_);
-    buffer.insert(buffer.end(), GRPC_SLICE_START_PTR(slice),
-                  GRPC_SLICE_END_PTR(slice));
-    return ParseInput(
-        Input(nullptr, buffer.data(), buffer.data() + buffer.size()), is_last);
+    // Grow the buffered field in place: its bytes are copied into the buffer
+    // once, however many frames it spans.
+    unparsed_bytes_.insert(unparsed_bytes_.end(), GRPC_SLICE_START_PTR(slice),
+                           GRPC_SLICE_END_PTR(slice));
+    return ParseInput(Input(nullptr, unparsed_bytes_.data(),
+                            unparsed_bytes_.data() + unparsed_bytes_.size()),
+                      is_last);
   }
   return ParseInput(Input(slice.refcount, GRPC_SLICE_START_PTR(slice),
                           GRPC_SLICE_END_PTR(slice)),
@@ -911,15 +1016,28 @@ grpc_error_handle HPackParser::Parse(const grpc_slice& slice, bool is_last) {
 grpc_error_handle HPackParser::ParseInput(Input input, bool is_last) {
   bool parsed_ok = ParseInputInner(&input);
   if (is_last) global_stats().IncrementHttp2MetadataSize(frame_length_);
-  if (parsed_ok) return absl::OkStatus();
+  if (parsed_ok) {
+    unparsed_bytes_.clear();
+    return absl::OkStatus();
+  }
   if (input.eof_error()) {
     if (GPR_UNLIKELY(is_last && is_boundary())) {
+      unparsed_bytes_.clear();
       return GRPC_ERROR_CREATE(
           "Incomplete header at the end of a header/continuation sequence");
     }
-    unparsed_bytes_ = std::vector<uint8_t>(input.frontier(), input.end_ptr());
+    if (unparsed_bytes_.empty()) {
+      unparsed_bytes_.assign(input.frontier(), input.end_ptr());
+    } else {
+      // The input is the buffer itself: drop the fields parsed out of it,
+      // and keep the one that is still incomplete.
+      unparsed_bytes_.erase(
+          unparsed_bytes_.begin(),
+          unparsed_bytes_.begin() + (input.frontier() - unparsed_bytes_.data()));
+    }
     return absl::OkStatus();
   }
+  unparsed_bytes_.clear();
   return input.TakeError();
 }
 
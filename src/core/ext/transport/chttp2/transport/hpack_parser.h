@@ -108,7 +108,9 @@ class HPackParser {
   // Target metadata buffer
   grpc_metadata_batch* metadata_buffer_ = nullptr;
 
-  // Bytes that could not be parsed last parsing round
+  // Bytes of the one field that could not be parsed last parsing round.
+  // Later slices are appended to it until the field is complete; fields
+  // that cannot fit in metadata_size_limit_ are rejected before that.
   std::vector<uint8_t> unparsed_bytes_;
   // Buffer kind of boundary
   // TODO(ctiller): see if we can move this argument to Parse, and avoid
@@ -26,17 +26,24 @@
 #include <cstddef>
 #include <cstring>
 #include <initializer_list>
+#include <string>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/hash/hash.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
 
+#include <grpc/slice.h>
 #include <grpc/support/log.h>
 
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/http_trace.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/slice/slice.h"
 
 namespace grpc_core {
@@ -157,6 +164,64 @@ grpc_error_handle HPackTable::Add(Memento md) {
 }
 
 namespace {
+// Process wide cache of header values, keyed by the hash of (key, value).
+// Each shard holds a bounded number of values; when a shard is full an
+// arbitrary entry is evicted to make room.
+class ValueInternCache {
+ public:
+  static ValueInternCache* Get() {
+    static NoDestruct<ValueInternCache> cache;
+    return cache.get();
+  }
+
+  Slice Intern(absl::string_view key, Slice value) {
+    // Inlined slices don't allocate, so there's nothing to share, and large
+    // values are unlikely to repeat.
+    if (value.size() <= GRPC_SLICE_INLINED_SIZE ||
+        value.size() > kMaxValueSize) {
+      return value;
+    }
+    const size_t hash = absl::HashOf(key, value.as_string_view());
+    Shard& shard = shards_[hash % kNumShards];
+    MutexLock lock(&shard.mu);
+    auto it = shard.entries.find(hash);
+    if (it != shard.entries.end()) {
+      // On a hash collision keep the caller's value: the cached one is as
+      // likely to be seen again.
+      if (it->second.key != key ||
+          it->second.value.as_string_view() != value.as_string_view()) {
+        return value;
+      }
+      return it->second.value.Ref();
+    }
+    if (shard.entries.size() >= kMaxEntriesPerShard) {
+      shard.entries.erase(shard.entries.begin());
+    }
+    // Copy the value: the parsed slice may reference a much larger read
+    // buffer that the cache should not keep alive.
+    Slice interned = Slice::FromCopiedString(value.as_string_view());
+    shard.entries.emplace(hash, Entry{std::string(key), interned.Ref()});
+    return interned;
+  }
+
+ private:
+  static constexpr size_t kNumShards = 16;
+  static constexpr size_t kMaxEntriesPerShard = 256;
+  static constexpr size_t kMaxValueSize = 1024;
+
+  struct Entry {
+    std::string key;
+    Slice value;
+  };
+
+  struct Shard {
+    Mutex mu;
+    absl::flat_hash_map<size_t, Entry> entries ABSL_GUARDED_BY(mu);
+  };
+
+  Shard shards_[kNumShards];
+};
+
 struct StaticTableEntry {
   const char* key;
   const char* value;
@@ -238,6 +303,11 @@ HPackTable::Memento MakeMemento(size_t i) {
 
 }  // namespace
 
+Slice HPackTable::InternValue(absl::string_view key, Slice value) {
+  if (!IsHpackInternCacheEnabled()) return value;
+  return ValueInternCache::Get()->Intern(key, std::move(value));
+}
+
 HPackTable::StaticMementos::StaticMementos() {
   for (uint32_t i = 0; i < hpack_constants::kLastStaticEntry; i++) {
     memento[i] = MakeMemento(i);
@@ -25,9 +25,12 @@
 
 #include <vector>
 
+#include "absl/strings/string_view.h"
+
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/parsed_metadata.h"
 
@@ -68,6 +71,13 @@ class HPackTable {
   // Current entry count in the table.
   uint32_t num_entries() const { return entries_.num_entries(); }
 
+  // Returns a slice with the same contents as value, for a header named key
+  // that is about to be added to a table.
+  // If the hpack_intern_cache experiment is enabled, values that were seen
+  // before (on any connection) are returned as a reference to one shared
+  // slice held by a bounded process wide cache.
+  static Slice InternValue(absl::string_view key, Slice value);
+
  private:
   struct StaticMementos {
     StaticMementos();
@@ -25,7 +25,10 @@
 #include <stdint.h>
 
 #include <memory>
+#include <set>
+#include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
@@ -35,6 +38,7 @@
 #include <grpc/slice.h>
 #include <grpc/support/time.h>
 
+#include "src/core/ext/transport/chttp2/transport/context_list.h"
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
 #include "src/core/ext/transport/chttp2/transport/frame.h"
 #include "src/core/ext/transport/chttp2/transport/frame_goaway.h"
@@ -49,10 +53,12 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/bitset.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/combiner.h"
@@ -65,6 +71,7 @@
 #include "src/core/lib/surface/init_internally.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/lib/transport/stream_limit.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/lib/transport/transport_fwd.h"
 #include "src/core/lib/transport/transport_impl.h"
@@ -96,6 +103,14 @@ typedef enum {
   GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE,
 } grpc_chttp2_write_state;
 
+// How writable streams share the connection: see
+// GRPC_ARG_HTTP2_WRITE_SCHEDULER
+typedef enum {
+  GRPC_CHTTP2_WRITE_SCHEDULER_FIFO,
+  GRPC_CHTTP2_WRITE_SCHEDULER_ROUND_ROBIN,
+  GRPC_CHTTP2_WRITE_SCHEDULER_WEIGHTED_FAIR,
+} grpc_chttp2_write_scheduler;
+
 typedef enum {
   GRPC_CHTTP2_OPTIMIZE_FOR_LATENCY,
   GRPC_CHTTP2_OPTIMIZE_FOR_THROUGHPUT,
@@ -325,6 +340,53 @@ struct grpc_chttp2_transport
   ///
   uint32_t write_buffer_size = grpc_core::chttp2::kDefaultWindow;
 
+  /// how many bytes we would like to put on the wire during a single
+  /// endpoint write; with TCP_NOTSENT_LOWAT, no more than the kernel takes
+  /// ahead of what it has sent, so that frames are picked as late as possible
+  uint32_t target_write_size = 1024 * 1024;
+  /// whether target_write_size follows the TCP congestion window, and when
+  /// it was last fitted to it
+  bool tune_target_write_size = false;
+  grpc_core::Timestamp last_write_size_tuning =
+      grpc_core::Timestamp::InfPast();
+  /// whether the kernel timestamps the writes of each stream, see
+  /// GRPC_ARG_TCP_WRITE_TIMESTAMPS
+  bool write_timestamps = false;
+
+  /// writes smaller than write_coalescing_bytes are held back for up to
+  /// write_coalescing_budget, so that frames flushed shortly after them share
+  /// the same endpoint write. Zero disables coalescing.
+  grpc_event_engine::experimental::EventEngine::Duration
+      write_coalescing_budget =
+          grpc_event_engine::experimental::EventEngine::Duration::zero();
+  uint32_t write_coalescing_bytes = 16384;
+  /// ends the current hold; only set while a write is being held back
+  absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      write_coalescing_timer_handle;
+  /// identifies the current hold, so that a timer firing after its hold was
+  /// ended early is ignored
+  uint64_t write_coalescing_seq = 0;
+  /// has the write being gathered already been held back?
+  bool write_coalescing_held = false;
+  /// when the current write was initiated
+  gpr_cycle_counter write_initiated_cycle = 0;
+  /// when the pending endpoint read and write completions were queued on
+  /// the combiner
+  gpr_cycle_counter read_action_queued_cycle = 0;
+  /// when the last endpoint read completed, before it waited for the combiner
+  gpr_timespec read_completed_time = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  /// when the in flight PING was written, and when the read carrying its ACK
+  /// completed: the round trip as seen by the socket, for BDP estimation
+  gpr_timespec ping_write_time = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  gpr_timespec ping_ack_read_time = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  gpr_cycle_counter write_action_end_queued_cycle = 0;
+  /// how writable streams share the connection
+  grpc_chttp2_write_scheduler write_scheduler =
+      GRPC_CHTTP2_WRITE_SCHEDULER_FIFO;
+  /// if set, kept up to date with the peer's MAX_CONCURRENT_STREAMS for
+  /// whoever created this transport
+  grpc_core::RefCountedPtr<grpc_core::TransportStreamLimit> stream_limit;
+
   /// Set to a grpc_error object if a goaway frame is received. By default, set
   /// to absl::OkStatus()
   grpc_error_handle goaway_error;
@@ -406,6 +468,8 @@ struct grpc_chttp2_transport
   // bdp estimator
   bool bdp_ping_blocked =
       false;  // Is the BDP blocked due to not receiving any data?
+  // Are BDP estimates shared with later connections to the same peer?
+  bool bdp_history = false;
   grpc_closure next_bdp_ping_timer_expired_locked;
   grpc_closure start_bdp_ping_locked;
   grpc_closure finish_bdp_ping_locked;
@@ -417,14 +481,21 @@ struct grpc_chttp2_transport
   grpc_closure_list run_after_write = GRPC_CLOSURE_LIST_INIT;
 
   // buffer pool state
-  /// have we scheduled a benign cleanup?
-  bool benign_reclaimer_registered = false;
+  /// have we scheduled a shrink of idle buffers?
+  bool shrink_reclaimer_registered = false;
+  /// have we scheduled an idle cleanup?
+  bool idle_reclaimer_registered = false;
   /// have we scheduled a destructive cleanup?
   bool destructive_reclaimer_registered = false;
-  /// benign cleanup closure
-  grpc_closure benign_reclaimer_locked;
+  /// shrink closure
+  grpc_closure shrink_reclaimer_locked;
+  /// idle cleanup closure
+  grpc_closure idle_reclaimer_locked;
   /// destructive cleanup closure
   grpc_closure destructive_reclaimer_locked;
+  /// the HEADER_TABLE_SIZE we advertised before an idle shrink asked the peer
+  /// to empty our decoder table, restored once streams resume
+  absl::optional<uint32_t> header_table_size_before_shrink;
 
   /// If start_bdp_ping_locked has been called
   bool bdp_ping_started = false;
@@ -457,6 +528,27 @@ struct grpc_chttp2_transport
   bool keepalive_ping_started = false;
   /// keep-alive state machine state
   grpc_chttp2_keepalive_state keepalive_state;
+
+  // deadline support, when the transport enforces stream deadlines in place
+  // of the deadline filter
+  /// true if stream deadlines are enforced here
+  bool enforce_stream_deadlines = false;
+  /// streams with a deadline to enforce, earliest deadline first
+  std::set<std::pair<grpc_core::Timestamp, grpc_chttp2_stream*>>
+      stream_deadlines;
+  /// Closure to cancel the streams whose deadline has passed
+  grpc_closure deadline_timer_fired_locked;
+  /// timer for the earliest deadline in stream_deadlines
+  absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      deadline_timer_handle;
+  /// the deadline deadline_timer_handle was armed for
+  grpc_core::Timestamp deadline_timer_deadline;
+
+  // message size limits, when the transport enforces them in place of the
+  // message size filter; unset for no limit
+  absl::optional<uint32_t> max_recv_message_size;
+  absl::optional<uint32_t> max_send_message_size;
+
   grpc_core::ContextList* cl = nullptr;
   grpc_core::RefCountedPtr<grpc_core::channelz::SocketNode> channelz_socket;
   uint32_t num_messages_in_next_write = 0;
@@ -481,6 +573,38 @@ typedef enum {
   GRPC_METADATA_PUBLISHED_AT_CLOSE
 } grpc_published_metadata_method;
 
+namespace grpc_core {
+namespace chttp2 {
+
+// Runs the closures completing one stream's receive ops, in the order they
+// are scheduled, on EventEngine threads. What those closures set off (filters
+// such as decompression, call completion, application callbacks) then runs
+// in parallel across the streams of a connection, instead of as part of the
+// one thread that parses everything the connection reads.
+class RecvClosureQueue : public RefCounted<RecvClosureQueue> {
+ public:
+  explicit RecvClosureQueue(
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine);
+
+  // Queues \a closure. Like ExecCtx::Run, it never runs before the caller
+  // returns to its ExecCtx.
+  void Push(grpc_closure* closure);
+
+ private:
+  static void Kick(void* arg, grpc_error_handle error);
+  void Drain();
+
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
+  grpc_closure kick_;
+  Mutex mu_;
+  grpc_closure_list closures_ ABSL_GUARDED_BY(mu_) = GRPC_CLOSURE_LIST_INIT;
+  bool draining_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+}  // namespace chttp2
+}  // namespace grpc_core
+
 struct grpc_chttp2_stream {
   grpc_chttp2_stream(grpc_chttp2_transport* t, grpc_stream_refcount* refcount,
                      const void* server_data, grpc_core::Arena* arena);
@@ -498,6 +622,10 @@ struct grpc_chttp2_stream {
 
   grpc_closure destroy_stream;
   grpc_closure* destroy_stream_arg;
+  // Sends RST_STREAM once the server has ended a stream the client has not
+  // yet finished writing.  Runs at most once per stream, since the stream is
+  // closed for reads right after it is scheduled.
+  grpc_closure force_client_rst_stream;
 
   grpc_chttp2_stream_link links[STREAM_LIST_COUNT];
   grpc_core::BitSet<STREAM_LIST_COUNT> included;
@@ -533,6 +661,9 @@ struct grpc_chttp2_stream {
   grpc_closure* recv_message_ready = nullptr;
   grpc_metadata_batch* recv_trailing_metadata;
   grpc_closure* recv_trailing_metadata_finished = nullptr;
+  /// set if the receive op closures are run on EventEngine threads
+  grpc_core::RefCountedPtr<grpc_core::chttp2::RecvClosureQueue>
+      recv_closure_queue;
 
   grpc_transport_stream_stats* collecting_stats = nullptr;
   grpc_transport_stream_stats stats = grpc_transport_stream_stats();
@@ -549,6 +680,12 @@ struct grpc_chttp2_stream {
   /// Are we buffering writes on this stream? If yes, we won't become writable
   /// until there's enough queued up in the flow_controlled_buffer
   bool write_buffering = false;
+  /// Share of the connection this stream gets under
+  /// GRPC_CHTTP2_WRITE_SCHEDULER_WEIGHTED_FAIR
+  uint32_t write_weight = 1;
+  /// Bytes this stream was allowed but did not yet send under
+  /// GRPC_CHTTP2_WRITE_SCHEDULER_WEIGHTED_FAIR
+  uint64_t write_deficit = 0;
 
   // have we sent or received the EOS bit?
   bool eos_received = false;
@@ -569,6 +706,8 @@ struct grpc_chttp2_stream {
   bool received_last_frame = false;  // protected by t combiner
 
   grpc_core::Timestamp deadline = grpc_core::Timestamp::InfFuture();
+  /// is this stream in t->stream_deadlines?
+  bool deadline_tracked = false;
 
   /// how many header frames have we received?
   uint8_t header_frames_received = 0;
@@ -591,9 +730,14 @@ struct grpc_chttp2_stream {
   bool traced = false;
   /// Byte counter for number of bytes written
   size_t byte_counter = 0;
+  /// Kernel timestamps of the stream's writes, with
+  /// GRPC_ARG_TCP_WRITE_TIMESTAMPS
+  grpc_core::RefCountedPtr<grpc_core::StreamWriteTimestamps> write_timestamps;
 
   // time this stream was created
   gpr_timespec creation_time = gpr_now(GPR_CLOCK_MONOTONIC);
+  // time this stream was last put on a stalled list, while it is on one
+  gpr_timespec flow_control_stalled_since = gpr_inf_past(GPR_CLOCK_MONOTONIC);
 };
 
 /// Transport writing call flow:
@@ -618,6 +762,8 @@ struct grpc_chttp2_begin_write_result {
   bool partial;
   /// did we queue any completions as part of beginning the write
   bool early_results_scheduled;
+  /// does the write carry a PING or PING acks, which are never held back
+  bool pings;
 };
 grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     grpc_chttp2_transport* t);
@@ -787,9 +933,22 @@ void grpc_chttp2_reset_ping_clock(grpc_chttp2_transport* t);
 void grpc_chttp2_mark_stream_writable(grpc_chttp2_transport* t,
                                       grpc_chttp2_stream* s);
 
+/// Publish the stream's send window, less what is queued to be sent, to the
+/// call's WriteWindowHint, if it has one.
+void grpc_chttp2_publish_write_window_hint(grpc_chttp2_transport* t,
+                                           grpc_chttp2_stream* s);
+
 void grpc_chttp2_cancel_stream(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
                                grpc_error_handle due_to_error);
 
+/// Start enforcing s->deadline, if the transport enforces stream deadlines:
+/// the stream is cancelled with DEADLINE_EXCEEDED once it passes
+void grpc_chttp2_track_stream_deadline(grpc_chttp2_transport* t,
+                                       grpc_chttp2_stream* s);
+/// Stop enforcing s->deadline; called as the stream closes
+void grpc_chttp2_untrack_stream_deadline(grpc_chttp2_transport* t,
+                                         grpc_chttp2_stream* s);
+
 void grpc_chttp2_maybe_complete_recv_initial_metadata(grpc_chttp2_transport* t,
                                                       grpc_chttp2_stream* s);
 void grpc_chttp2_maybe_complete_recv_message(grpc_chttp2_transport* t,
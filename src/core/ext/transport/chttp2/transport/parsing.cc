@@ -33,6 +33,7 @@
 
 #include <grpc/slice.h>
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
 #include "src/core/ext/transport/chttp2/transport/frame.h"
@@ -49,6 +50,7 @@
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 #include "src/core/ext/transport/chttp2/transport/stream_map.h"
 #include "src/core/lib/channel/channelz.h"
+#include "src/core/lib/debug/event_ring.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/status_helper.h"
@@ -318,6 +320,10 @@ grpc_error_handle grpc_chttp2_perform_read(grpc_chttp2_transport* t,
                     .c_str(),
                 t->incoming_frame_size, t->incoming_stream_id);
       }
+      grpc_core::EventRing::Record(
+          grpc_core::EventRing::Event::kFrameRead,
+          (static_cast<uint64_t>(t->incoming_frame_type) << 32) |
+              t->incoming_frame_size);
       t->deframe_state = GRPC_DTS_FRAME;
       err = init_frame_parser(t);
       if (!err.ok()) {
@@ -854,6 +860,16 @@ grpc_error_handle grpc_chttp2_header_parser_parse(void* hpack_parser,
         if (s->header_frames_received == 2) {
           return GRPC_ERROR_CREATE("Too many trailer frames");
         }
+        if (s->header_frames_received == 0) {
+          s->stats.timing.initial_metadata_decoded =
+              gpr_now(GPR_CLOCK_MONOTONIC);
+          if (!t->is_client && t->enforce_stream_deadlines) {
+            s->deadline =
+                s->initial_metadata_buffer.get(grpc_core::GrpcTimeoutMetadata())
+                    .value_or(grpc_core::Timestamp::InfFuture());
+            grpc_chttp2_track_stream_deadline(t, s);
+          }
+        }
         s->published_metadata[s->header_frames_received] =
             GRPC_METADATA_PUBLISHED_FROM_WIRE;
         maybe_complete_funcs[s->header_frames_received](t, s);
@@ -867,7 +883,8 @@ grpc_error_handle grpc_chttp2_header_parser_parse(void* hpack_parser,
           // and can avoid the extra write
           GRPC_CHTTP2_STREAM_REF(s, "final_rst");
           t->combiner->FinallyRun(
-              GRPC_CLOSURE_CREATE(force_client_rst_stream, s, nullptr),
+              GRPC_CLOSURE_INIT(&s->force_client_rst_stream,
+                                force_client_rst_stream, s, nullptr),
               absl::OkStatus());
         }
         grpc_chttp2_mark_stream_closed(t, s, true, false, absl::OkStatus());
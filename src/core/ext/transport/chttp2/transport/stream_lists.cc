@@ -19,6 +19,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/transport/chttp2/transport/frame.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
@@ -138,6 +139,50 @@ static bool stream_list_add(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
   return true;
 }
 
+// flow control stall accounting: a stream is stalled while it is on either of
+// the stalled lists
+
+static bool stream_is_stalled(grpc_chttp2_stream* s) {
+  return s->included.is_set(GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT) ||
+         s->included.is_set(GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+}
+
+static void stalled_list_add(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
+                             grpc_chttp2_stream_list_id id) {
+  const bool was_stalled = stream_is_stalled(s);
+  if (!stream_list_add(t, s, id) || was_stalled) return;
+  grpc_transport_stream_timing& timing = s->stats.timing;
+  s->flow_control_stalled_since = gpr_now(GPR_CLOCK_MONOTONIC);
+  if (timing.flow_control_stalls++ == 0) {
+    timing.first_flow_control_stall = s->flow_control_stalled_since;
+  }
+}
+
+static void note_stall_ended(grpc_chttp2_stream* s) {
+  if (stream_is_stalled(s)) return;
+  grpc_transport_stream_timing& timing = s->stats.timing;
+  const gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  timing.flow_control_stalled_time =
+      gpr_time_add(timing.flow_control_stalled_time,
+                   gpr_time_sub(now, s->flow_control_stalled_since));
+}
+
+static bool stalled_list_pop(grpc_chttp2_transport* t,
+                             grpc_chttp2_stream** stream,
+                             grpc_chttp2_stream_list_id id) {
+  if (!stream_list_pop(t, stream, id)) return false;
+  note_stall_ended(*stream);
+  return true;
+}
+
+static bool stalled_list_maybe_remove(grpc_chttp2_transport* t,
+                                      grpc_chttp2_stream* s,
+                                      grpc_chttp2_stream_list_id id) {
+  if (!stream_list_maybe_remove(t, s, id)) return false;
+  note_stall_ended(s);
+  return true;
+}
+
 // wrappers for specializations
 
 bool grpc_chttp2_list_add_writable_stream(grpc_chttp2_transport* t,
@@ -187,30 +232,30 @@ void grpc_chttp2_list_remove_waiting_for_concurrency(grpc_chttp2_transport* t,
 
 void grpc_chttp2_list_add_stalled_by_transport(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream* s) {
-  stream_list_add(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  stalled_list_add(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
 }
 
 bool grpc_chttp2_list_pop_stalled_by_transport(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream** s) {
-  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  return stalled_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
 }
 
 void grpc_chttp2_list_remove_stalled_by_transport(grpc_chttp2_transport* t,
                                                   grpc_chttp2_stream* s) {
-  stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
+  stalled_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT);
 }
 
 void grpc_chttp2_list_add_stalled_by_stream(grpc_chttp2_transport* t,
                                             grpc_chttp2_stream* s) {
-  stream_list_add(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  stalled_list_add(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
 }
 
 bool grpc_chttp2_list_pop_stalled_by_stream(grpc_chttp2_transport* t,
                                             grpc_chttp2_stream** s) {
-  return stream_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  return stalled_list_pop(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
 }
 
 bool grpc_chttp2_list_remove_stalled_by_stream(grpc_chttp2_transport* t,
                                                grpc_chttp2_stream* s) {
-  return stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
+  return stalled_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_STALLED_BY_STREAM);
 }
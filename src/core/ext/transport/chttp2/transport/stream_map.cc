@@ -22,156 +22,168 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
+
+#include "absl/random/random.h"
+
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
-void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
-                                 size_t initial_capacity) {
-  GPR_DEBUG_ASSERT(initial_capacity > 1);
-  map->keys =
-      static_cast<uint32_t*>(gpr_malloc(sizeof(uint32_t) * initial_capacity));
-  map->values =
-      static_cast<void**>(gpr_malloc(sizeof(void*) * initial_capacity));
-  map->count = 0;
-  map->free = 0;
-  map->capacity = initial_capacity;
+// Mixed into every key so that a peer cannot choose stream ids that collide.
+static uint32_t hash_salt() {
+  static const uint32_t salt = absl::Uniform<uint32_t>(absl::BitGen());
+  return salt;
 }
 
-void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map) {
-  gpr_free(map->keys);
-  gpr_free(map->values);
+// The slot a key would occupy in an empty table. Multiplying by 2^32/phi
+// (Fibonacci hashing) spreads runs of consecutive stream ids evenly across
+// the table, and taking the high bits of the product keeps that spread for
+// any capacity.
+static size_t home_slot(uint32_t key, size_t capacity) {
+  const uint32_t hash = (key ^ hash_salt()) * 0x9e3779b9u;
+  return static_cast<size_t>((static_cast<uint64_t>(hash) * capacity) >> 32);
 }
 
-static size_t compact(uint32_t* keys, void** values, size_t count) {
-  size_t i, out;
-
-  for (i = 0, out = 0; i < count; i++) {
-    if (values[i]) {
-      keys[out] = keys[i];
-      values[out] = values[i];
-      out++;
-    }
+static grpc_chttp2_stream_map_entry* alloc_entries(size_t capacity) {
+  auto* entries = static_cast<grpc_chttp2_stream_map_entry*>(
+      gpr_malloc(sizeof(grpc_chttp2_stream_map_entry) * capacity));
+  for (size_t i = 0; i < capacity; i++) {
+    entries[i].key = 0;
+    entries[i].value = nullptr;
   }
-
-  return out;
+  return entries;
 }
 
-void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
-                                void* value) {
-  size_t count = map->count;
-  size_t capacity = map->capacity;
-  uint32_t* keys = map->keys;
-  void** values = map->values;
-
-  // The first assertion ensures that the table is monotonically increasing.
-  GPR_ASSERT(count == 0 || keys[count - 1] < key);
-  GPR_DEBUG_ASSERT(value);
-  // Asserting that the key is not already in the map can be a debug assertion.
-  // Why: we're already checking that the map elements are monotonically
-  // increasing. If we re-add a key, i.e. if the key is already present, then
-  // either it is the most recently added key in the map (in which case the
-  // first assertion fails due to key == last_key) or there is a more recently
-  // added (larger) key at the end of the map: in which case the first assertion
-  // still fails due to key < last_key.
-  GPR_DEBUG_ASSERT(grpc_chttp2_stream_map_find(map, key) == nullptr);
+// Place key in the first empty slot of its probe run. key must not already
+// be present, and there must be an empty slot.
+static void insert(grpc_chttp2_stream_map_entry* entries, size_t capacity,
+                   uint32_t key, void* value) {
+  const size_t mask = capacity - 1;
+  size_t i = home_slot(key, capacity);
+  while (entries[i].key != 0) i = (i + 1) & mask;
+  entries[i].key = key;
+  entries[i].value = value;
+}
 
-  if (count == capacity) {
-    if (map->free > capacity / 4) {
-      count = compact(keys, values, count);
-      map->free = 0;
-    } else {
-      // resize when less than 25% of the table is free, because compaction
-      // won't help much
-      map->capacity = capacity = 2 * capacity;
-      map->keys = keys = static_cast<uint32_t*>(
-          gpr_realloc(keys, capacity * sizeof(uint32_t)));
-      map->values = values =
-          static_cast<void**>(gpr_realloc(values, capacity * sizeof(void*)));
-    }
+// Returns the slot holding key, or capacity if it is not present.
+static size_t find_slot(grpc_chttp2_stream_map* map, uint32_t key) {
+  if (key == 0 || map->count == 0) return map->capacity;
+  const size_t mask = map->capacity - 1;
+  grpc_chttp2_stream_map_entry* entries = map->entries;
+  for (size_t i = home_slot(key, map->capacity);; i = (i + 1) & mask) {
+    if (entries[i].key == key) return i;
+    if (entries[i].key == 0) return map->capacity;
   }
+}
 
-  keys[count] = key;
-  values[count] = value;
-  map->count = count + 1;
+void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
+                                 size_t initial_capacity) {
+  GPR_DEBUG_ASSERT(initial_capacity > 1);
+  size_t capacity = 2;
+  while (capacity < initial_capacity) capacity *= 2;
+  map->entries = alloc_entries(capacity);
+  map->count = 0;
+  map->capacity = capacity;
+  map->last_key = 0;
+}
+
+void grpc_chttp2_stream_map_destroy(grpc_chttp2_stream_map* map) {
+  gpr_free(map->entries);
 }
 
-template <bool strict_find>
-static void** find(grpc_chttp2_stream_map* map, uint32_t key) {
-  size_t min_idx = 0;
-  size_t max_idx = map->count;
-  size_t mid_idx;
-  uint32_t* keys = map->keys;
-  void** values = map->values;
-  uint32_t mid_key;
-
-  GPR_DEBUG_ASSERT(!strict_find || max_idx > 0);
-  if (!strict_find && max_idx == 0) return nullptr;
-
-  while (min_idx < max_idx) {
-    // find the midpoint, avoiding overflow
-    mid_idx = min_idx + ((max_idx - min_idx) / 2);
-    mid_key = keys[mid_idx];
-
-    if (mid_key < key) {
-      min_idx = mid_idx + 1;
-    } else if (mid_key > key) {
-      max_idx = mid_idx;
-    } else  // mid_key == key
-    {
-      return &values[mid_idx];
+void grpc_chttp2_stream_map_add(grpc_chttp2_stream_map* map, uint32_t key,
+                                void* value) {
+  // This assertion ensures that keys are monotonically increasing, and so
+  // that key is not already in the map.
+  GPR_ASSERT(map->last_key < key);
+  GPR_DEBUG_ASSERT(value);
+  map->last_key = key;
+
+  // grow when the table would become more than 75% full, keeping probe runs
+  // short
+  if ((map->count + 1) * 4 > map->capacity * 3) {
+    const size_t old_capacity = map->capacity;
+    grpc_chttp2_stream_map_entry* old_entries = map->entries;
+    map->capacity = 2 * old_capacity;
+    map->entries = alloc_entries(map->capacity);
+    for (size_t i = 0; i < old_capacity; i++) {
+      if (old_entries[i].key != 0) {
+        insert(map->entries, map->capacity, old_entries[i].key,
+               old_entries[i].value);
+      }
     }
+    gpr_free(old_entries);
   }
 
-  GPR_DEBUG_ASSERT(!strict_find);
-  return nullptr;
+  insert(map->entries, map->capacity, key, value);
+  map->count++;
 }
 
 void* grpc_chttp2_stream_map_delete(grpc_chttp2_stream_map* map, uint32_t key) {
-  void** pvalue = find<true>(map, key);
-  GPR_DEBUG_ASSERT(pvalue != nullptr);
-  void* out = *pvalue;
+  size_t hole = find_slot(map, key);
+  GPR_DEBUG_ASSERT(hole != map->capacity);
+  if (hole == map->capacity) return nullptr;
+  grpc_chttp2_stream_map_entry* entries = map->entries;
+  void* out = entries[hole].value;
   GPR_DEBUG_ASSERT(out != nullptr);
-  *pvalue = nullptr;
-  map->free++;
-  // recognize complete emptyness and ensure we can skip
-  // defragmentation later
-  if (map->free == map->count) {
-    map->free = map->count = 0;
+  map->count--;
+  // Shift back any later entry of the probe run that could legally live in
+  // the hole, so that lookups can keep stopping at the first empty slot.
+  const size_t mask = map->capacity - 1;
+  for (size_t i = (hole + 1) & mask; entries[i].key != 0; i = (i + 1) & mask) {
+    const size_t home = home_slot(entries[i].key, map->capacity);
+    // entry i may move to the hole unless its home is cyclically in
+    // (hole, i]
+    if (((i - home) & mask) >= ((i - hole) & mask)) {
+      entries[hole] = entries[i];
+      hole = i;
+    }
   }
+  entries[hole].key = 0;
+  entries[hole].value = nullptr;
   GPR_DEBUG_ASSERT(grpc_chttp2_stream_map_find(map, key) == nullptr);
   return out;
 }
 
 void* grpc_chttp2_stream_map_find(grpc_chttp2_stream_map* map, uint32_t key) {
-  void** pvalue = find<false>(map, key);
-  return pvalue != nullptr ? *pvalue : nullptr;
+  const size_t slot = find_slot(map, key);
+  return slot != map->capacity ? map->entries[slot].value : nullptr;
 }
 
 size_t grpc_chttp2_stream_map_size(grpc_chttp2_stream_map* map) {
-  return map->count - map->free;
+  return map->count;
 }
 
 void* grpc_chttp2_stream_map_rand(grpc_chttp2_stream_map* map) {
-  if (map->count == map->free) {
+  if (map->count == 0) {
     return nullptr;
   }
-  if (map->free != 0) {
-    map->count = compact(map->keys, map->values, map->count);
-    map->free = 0;
-    GPR_ASSERT(map->count > 0);
-  }
-  return map->values[(static_cast<size_t>(rand())) % map->count];
+  // Probe forward from a random slot to the next populated one.
+  const size_t mask = map->capacity - 1;
+  size_t i = static_cast<size_t>(rand()) & mask;
+  while (map->entries[i].key == 0) i = (i + 1) & mask;
+  return map->entries[i].value;
 }
 
 void grpc_chttp2_stream_map_for_each(grpc_chttp2_stream_map* map,
                                      void (*f)(void* user_data, uint32_t key,
                                                void* value),
                                      void* user_data) {
-  size_t i;
-
-  for (i = 0; i < map->count; i++) {
-    if (map->values[i]) {
-      f(user_data, map->keys[i], map->values[i]);
-    }
+  if (map->count == 0) return;
+  // f may delete entries, which moves others around the table, so visit a
+  // snapshot of the keys instead of the table itself.
+  const size_t count = map->count;
+  uint32_t* keys =
+      static_cast<uint32_t*>(gpr_malloc(sizeof(uint32_t) * count));
+  size_t n = 0;
+  for (size_t i = 0; i < map->capacity; i++) {
+    if (map->entries[i].key != 0) keys[n++] = map->entries[i].key;
+  }
+  GPR_DEBUG_ASSERT(n == count);
+  std::sort(keys, keys + n);
+  for (size_t i = 0; i < n; i++) {
+    void* value = grpc_chttp2_stream_map_find(map, keys[i]);
+    if (value != nullptr) f(user_data, keys[i], value);
   }
+  gpr_free(keys);
 }
@@ -26,16 +26,26 @@
 
 // Data structure to map a uint32_t to a data object (represented by a void*)
 
-// Represented as a sorted array of keys, and a corresponding array of values.
-// Lookups are performed with binary search.
+// Represented as an open addressing hash table with linear probing, holding
+// keys and values side by side so that a lookup usually touches a single
+// cache line. Deletes shift later entries of a probe run back rather than
+// leaving tombstones, so lookups never slow down as streams come and go.
 // Adds are restricted to strictly higher keys than previously seen (this is
-// guaranteed by http2).
+// guaranteed by http2), which lets an add take the first empty slot without
+// searching for an existing entry. Key 0 is not a valid stream id and marks
+// an empty slot.
+struct grpc_chttp2_stream_map_entry {
+  uint32_t key;
+  void* value;
+};
 struct grpc_chttp2_stream_map {
-  uint32_t* keys;
-  void** values;
+  grpc_chttp2_stream_map_entry* entries;
+  // number of populated entries
   size_t count;
-  size_t free;
+  // number of slots in entries: always a power of two
   size_t capacity;
+  // the most recently added key
+  uint32_t last_key;
 };
 void grpc_chttp2_stream_map_init(grpc_chttp2_stream_map* map,
                                  size_t initial_capacity);
@@ -53,13 +63,14 @@ void* grpc_chttp2_stream_map_delete(grpc_chttp2_stream_map* map, uint32_t key);
 // Return an existing key, or NULL if it does not exist
 void* grpc_chttp2_stream_map_find(grpc_chttp2_stream_map* map, uint32_t key);
 
-// Return a random entry
+// Return a random entry, or NULL if the map is empty
 void* grpc_chttp2_stream_map_rand(grpc_chttp2_stream_map* map);
 
 // How many (populated) entries are in the stream map?
 size_t grpc_chttp2_stream_map_size(grpc_chttp2_stream_map* map);
 
-// Callback on each stream
+// Callback on each stream, in increasing key order. f may delete entries
+// (including the one it was called for); deleted entries are not visited
 void grpc_chttp2_stream_map_for_each(grpc_chttp2_stream_map* map,
                                      void (*f)(void* user_data, uint32_t key,
                                                void* value),
@@ -22,6 +22,7 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -33,6 +34,7 @@
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/transport/chttp2/transport/http_trace.h"
 
@@ -52,9 +54,12 @@
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 #include "src/core/ext/transport/chttp2/transport/stream_map.h"
 #include "src/core/lib/channel/channelz.h"
+#include "src/core/lib/channel/context.h"
+#include "src/core/lib/debug/event_ring.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -63,6 +68,7 @@
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/socket_utils.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/bdp_estimator.h"
 #include "src/core/lib/transport/http2_errors.h"
@@ -83,11 +89,12 @@ static void finish_write_cb(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
   t->write_cb_pool = cb;
 }
 
-static void maybe_initiate_ping(grpc_chttp2_transport* t) {
+// Returns true if a PING was added to the write.
+static bool maybe_initiate_ping(grpc_chttp2_transport* t) {
   grpc_chttp2_ping_queue* pq = &t->ping_queue;
   if (grpc_closure_list_empty(pq->lists[GRPC_CHTTP2_PCL_NEXT])) {
     // no ping needed: wait
-    return;
+    return false;
   }
   if (!grpc_closure_list_empty(pq->lists[GRPC_CHTTP2_PCL_INFLIGHT])) {
     // ping already in-flight: wait
@@ -98,7 +105,7 @@ static void maybe_initiate_ping(grpc_chttp2_transport* t) {
               t->is_client ? "CLIENT" : "SERVER",
               std::string(t->peer_string.as_string_view()).c_str());
     }
-    return;
+    return false;
   }
   if (t->is_client && t->ping_state.pings_before_data_required == 0 &&
       t->ping_policy.max_pings_without_data != 0) {
@@ -112,7 +119,7 @@ static void maybe_initiate_ping(grpc_chttp2_transport* t) {
               t->ping_state.pings_before_data_required,
               t->ping_policy.max_pings_without_data);
     }
-    return;
+    return false;
   }
   // InvalidateNow to avoid getting stuck re-initializing the ping timer
   // in a loop while draining the currently-held combiner. Also see
@@ -166,7 +173,7 @@ static void maybe_initiate_ping(grpc_chttp2_transport* t) {
             grpc_chttp2_retry_initiate_ping(t);
           });
     }
-    return;
+    return false;
   }
   t->ping_state.last_ping_sent_time = now;
 
@@ -178,6 +185,9 @@ static void maybe_initiate_ping(grpc_chttp2_transport* t) {
                          &pq->lists[GRPC_CHTTP2_PCL_INFLIGHT]);
   grpc_slice_buffer_add(&t->outbuf,
                         grpc_chttp2_ping_create(false, pq->inflight_id));
+  // Writes carrying pings go straight to the endpoint, so this is when the
+  // ping reaches the socket.
+  t->ping_write_time = gpr_now(GPR_CLOCK_MONOTONIC);
   grpc_core::global_stats().IncrementHttp2PingsSent();
   if (GRPC_TRACE_FLAG_ENABLED(grpc_http_trace) ||
       GRPC_TRACE_FLAG_ENABLED(grpc_bdp_estimator_trace) ||
@@ -190,6 +200,7 @@ static void maybe_initiate_ping(grpc_chttp2_transport* t) {
   }
   t->ping_state.pings_before_data_required -=
       (t->ping_state.pings_before_data_required != 0);
+  return true;
 }
 
 static bool update_list(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
@@ -238,8 +249,32 @@ static void report_stall(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
 }
 
 // How many bytes would we like to put on the wire during a single syscall
-static uint32_t target_write_size(grpc_chttp2_transport* /*t*/) {
-  return 1024 * 1024;
+static uint32_t target_write_size(grpc_chttp2_transport* t) {
+  return t->target_write_size;
+}
+
+// Fits target_write_size to what the connection can send in a round trip:
+// smaller writes pay more per-write overhead for nothing, and larger ones
+// hold frames that could still be reordered in the socket buffer.
+// TCP_INFO is sampled at most every 100ms.
+static void maybe_tune_target_write_size(grpc_chttp2_transport* t) {
+  if (!t->tune_target_write_size || t->ep == nullptr) return;
+  const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+  if (now - t->last_write_size_tuning <
+      grpc_core::Duration::Milliseconds(100)) {
+    return;
+  }
+  t->last_write_size_tuning = now;
+  const int fd = grpc_endpoint_get_fd(t->ep);
+  if (fd < 0) {
+    // Not a socket we can ask; keep the default.
+    t->tune_target_write_size = false;
+    return;
+  }
+  const size_t bytes_per_rtt = grpc_socket_bytes_per_rtt(fd);
+  if (bytes_per_rtt == 0) return;
+  t->target_write_size = static_cast<uint32_t>(grpc_core::Clamp<size_t>(
+      bytes_per_rtt, 16 * 1024, 4 * 1024 * 1024));
 }
 
 namespace {
@@ -268,6 +303,31 @@ static bool is_default_initial_metadata(grpc_metadata_batch* initial_metadata) {
   return enc.count() == initial_metadata->count();
 }
 
+// How many bytes of data a stream may send per turn before the next writable
+// stream gets a turn, when write scheduling is fair.
+static uint64_t data_write_quantum(grpc_chttp2_transport* t,
+                                   grpc_chttp2_stream* s) {
+  const uint64_t frame_size =
+      t->settings[GRPC_PEER_SETTINGS][GRPC_CHTTP2_SETTINGS_MAX_FRAME_SIZE];
+  return t->write_scheduler == GRPC_CHTTP2_WRITE_SCHEDULER_WEIGHTED_FAIR
+             ? frame_size * s->write_weight
+             : frame_size;
+}
+
+// How many bytes of data s may send in its current turn.
+static uint64_t data_write_budget(grpc_chttp2_transport* t,
+                                  grpc_chttp2_stream* s) {
+  switch (t->write_scheduler) {
+    case GRPC_CHTTP2_WRITE_SCHEDULER_FIFO:
+      break;
+    case GRPC_CHTTP2_WRITE_SCHEDULER_ROUND_ROBIN:
+      return data_write_quantum(t, s);
+    case GRPC_CHTTP2_WRITE_SCHEDULER_WEIGHTED_FAIR:
+      return s->write_deficit + data_write_quantum(t, s);
+  }
+  return std::numeric_limits<uint64_t>::max();
+}
+
 namespace {
 
 class WriteContext {
@@ -310,6 +370,7 @@ class WriteContext {
   }
 
   void FlushPingAcks() {
+    if (t_->ping_ack_count > 0) NoteWritingPings();
     for (size_t i = 0; i < t_->ping_ack_count; i++) {
       grpc_slice_buffer_add(&t_->outbuf,
                             grpc_chttp2_ping_create(true, t_->ping_acks[i]));
@@ -356,6 +417,8 @@ class WriteContext {
 
   void NoteScheduledResults() { result_.early_results_scheduled = true; }
 
+  void NoteWritingPings() { result_.pings = true; }
+
   grpc_chttp2_transport* transport() const { return t_; }
 
   grpc_chttp2_begin_write_result Result() {
@@ -372,7 +435,7 @@ class WriteContext {
   int initial_metadata_writes_ = 0;
   int trailing_metadata_writes_ = 0;
   int message_writes_ = 0;
-  grpc_chttp2_begin_write_result result_ = {false, false, false};
+  grpc_chttp2_begin_write_result result_ = {false, false, false, false};
 };
 
 class DataSendContext {
@@ -403,10 +466,12 @@ class DataSendContext {
 
   bool AnyOutgoing() const { return max_outgoing() > 0; }
 
-  void FlushBytes() {
-    uint32_t send_bytes =
-        static_cast<uint32_t>(std::min(static_cast<size_t>(max_outgoing()),
-                                       s_->flow_controlled_buffer.length));
+  // Sends at most limit bytes, and returns how many were sent.
+  uint32_t FlushBytes(uint64_t limit) {
+    uint32_t send_bytes = static_cast<uint32_t>(
+        std::min({static_cast<uint64_t>(max_outgoing()),
+                  static_cast<uint64_t>(s_->flow_controlled_buffer.length),
+                  limit}));
     is_last_frame_ = send_bytes == s_->flow_controlled_buffer.length &&
                      s_->send_trailing_metadata != nullptr &&
                      s_->send_trailing_metadata->empty();
@@ -414,6 +479,7 @@ class DataSendContext {
                             is_last_frame_, &s_->stats.outgoing, &t_->outbuf);
     sfc_upd_.SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    return send_bytes;
   }
 
   bool is_last_frame() const { return is_last_frame_; }
@@ -477,6 +543,7 @@ class StreamWriteContext {
               &s_->stats.outgoing                         // stats
           },
           *s_->send_initial_metadata, &t_->outbuf);
+      s_->stats.timing.initial_metadata_encoded = gpr_now(GPR_CLOCK_MONOTONIC);
       grpc_chttp2_reset_ping_clock(t_);
       write_context_->IncInitialMetadataWrites();
     }
@@ -525,15 +592,24 @@ class StreamWriteContext {
       return;  // early out: nothing to do
     }
 
+    uint64_t budget = data_write_budget(t_, s_);
     while (s_->flow_controlled_buffer.length > 0 &&
-           data_send_context.max_outgoing() > 0) {
-      data_send_context.FlushBytes();
+           data_send_context.max_outgoing() > 0 && budget > 0) {
+      budget -= data_send_context.FlushBytes(budget);
+    }
+    if (t_->write_scheduler == GRPC_CHTTP2_WRITE_SCHEDULER_WEIGHTED_FAIR) {
+      // Carry over what flow control kept us from sending, but not beyond a
+      // turn's worth, and nothing once the stream has run out of data.
+      s_->write_deficit = s_->flow_controlled_buffer.length == 0
+                              ? 0
+                              : std::min(budget, data_write_quantum(t_, s_));
     }
     grpc_chttp2_reset_ping_clock(t_);
     if (data_send_context.is_last_frame()) {
       SentLastFrame();
     }
     data_send_context.CallCallbacks();
+    grpc_chttp2_publish_write_window_hint(t_, s_);
     stream_became_writable_ = true;
     if (s_->flow_controlled_buffer.length > 0) {
       GRPC_CHTTP2_STREAM_REF(s_, "chttp2_writing:fork");
@@ -625,8 +701,26 @@ class StreamWriteContext {
 };
 }  // namespace
 
+void grpc_chttp2_publish_write_window_hint(grpc_chttp2_transport* t,
+                                           grpc_chttp2_stream* s) {
+  if (s->context == nullptr) return;
+  auto* hint = static_cast<grpc_core::WriteWindowHint*>(
+      static_cast<grpc_call_context_element*>(
+          s->context)[GRPC_CONTEXT_WRITE_WINDOW_HINT]
+          .value);
+  if (hint == nullptr) return;
+  const int64_t stream_window =
+      s->flow_control.remote_window_delta() +
+      static_cast<int64_t>(
+          t->settings[GRPC_PEER_SETTINGS]
+                     [GRPC_CHTTP2_SETTINGS_INITIAL_WINDOW_SIZE]);
+  hint->Set(std::min(stream_window, t->flow_control.remote_window()),
+            static_cast<int64_t>(s->flow_controlled_buffer.length));
+}
+
 grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     grpc_chttp2_transport* t) {
+  maybe_tune_target_write_size(t);
   WriteContext ctx(t);
   ctx.FlushSettings();
   ctx.FlushPingAcks();
@@ -649,7 +743,8 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
     if (t->outbuf.length > orig_len) {
       // Add this stream to the list of the contexts to be traced at TCP
       s->byte_counter += t->outbuf.length - orig_len;
-      if (s->traced && grpc_endpoint_can_track_err(t->ep)) {
+      if ((s->traced || s->write_timestamps != nullptr) &&
+          grpc_endpoint_can_track_err(t->ep)) {
         grpc_core::ContextList::Append(&t->cl, s);
       }
     }
@@ -667,7 +762,12 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
 
   ctx.FlushWindowUpdates();
 
-  maybe_initiate_ping(t);
+  if (maybe_initiate_ping(t)) ctx.NoteWritingPings();
+
+  if (t->outbuf.length > 0) {
+    grpc_core::EventRing::Record(grpc_core::EventRing::Event::kFrameWrite,
+                                 t->outbuf.length);
+  }
 
   return ctx.Result();
 }
@@ -680,7 +780,16 @@ void grpc_chttp2_end_write(grpc_chttp2_transport* t, grpc_error_handle error) {
   }
   t->num_messages_in_next_write = 0;
 
+  const gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
   while (grpc_chttp2_list_pop_writing_stream(t, &s)) {
+    if (error.ok()) {
+      grpc_transport_stream_timing& timing = s->stats.timing;
+      if (gpr_time_cmp(timing.first_write_flushed,
+                       gpr_inf_past(GPR_CLOCK_MONOTONIC)) == 0) {
+        timing.first_write_flushed = now;
+      }
+      timing.last_write_flushed = now;
+    }
     if (s->sending_bytes != 0) {
       update_list(t, s, static_cast<int64_t>(s->sending_bytes),
                   &s->on_write_finished_cbs, &s->flow_controlled_bytes_written,
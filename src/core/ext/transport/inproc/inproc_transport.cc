@@ -83,6 +83,8 @@ void log_metadata(const grpc_metadata_batch* md_batch, bool is_client,
                   bool is_initial);
 void fill_in_metadata(inproc_stream* s, const grpc_metadata_batch* metadata,
                       grpc_metadata_batch* out_md, bool* markfilled);
+void move_in_metadata(inproc_stream* s, grpc_metadata_batch* metadata,
+                      grpc_metadata_batch* out_md);
 
 void ResetSendMessage(grpc_transport_stream_op_batch* batch) {
   std::exchange(batch->payload->send_message.send_message, nullptr)->Clear();
@@ -341,6 +343,20 @@ void fill_in_metadata(inproc_stream* s, const grpc_metadata_batch* metadata,
   metadata->Encode(&sink);
 }
 
+// Hands metadata held by the transport for \a s to the op receiving it. Both
+// batches live in the stream's arena, so this moves rather than copies; only
+// metadata crossing between the two sides' arenas goes through
+// fill_in_metadata.
+void move_in_metadata(inproc_stream* s, grpc_metadata_batch* metadata,
+                      grpc_metadata_batch* out_md) {
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_inproc_trace)) {
+    log_metadata(metadata, s->t->is_client,
+                 metadata->get_pointer(grpc_core::WaitForReady()) != nullptr);
+  }
+  *out_md = std::move(*metadata);
+  metadata->Clear();
+}
+
 int init_stream(grpc_transport* gt, grpc_stream* gs,
                 grpc_stream_refcount* refcount, const void* server_data,
                 grpc_core::Arena* arena) {
@@ -458,10 +474,9 @@ void fail_helper_locked(inproc_stream* s, grpc_error_handle error) {
       fake_md.Set(grpc_core::HttpAuthorityMetadata(),
                   grpc_core::Slice::FromStaticString("inproc-fail"));
 
-      fill_in_metadata(s, &fake_md,
+      move_in_metadata(s, &fake_md,
                        s->recv_initial_md_op->payload->recv_initial_metadata
-                           .recv_initial_metadata,
-                       nullptr);
+                           .recv_initial_metadata);
       err = absl::OkStatus();
     } else {
       err = error;
@@ -678,10 +693,9 @@ void op_state_machine_locked(inproc_stream* s, grpc_error_handle error) {
 
     if (s->to_read_initial_md_filled) {
       s->initial_md_recvd = true;
-      fill_in_metadata(s, &s->to_read_initial_md,
+      move_in_metadata(s, &s->to_read_initial_md,
                        s->recv_initial_md_op->payload->recv_initial_metadata
-                           .recv_initial_metadata,
-                       nullptr);
+                           .recv_initial_metadata);
       if (s->deadline != grpc_core::Timestamp::InfFuture()) {
         s->recv_initial_md_op->payload->recv_initial_metadata
             .recv_initial_metadata->Set(grpc_core::GrpcTimeoutMetadata(),
@@ -760,10 +774,9 @@ void op_state_machine_locked(inproc_stream* s, grpc_error_handle error) {
     if (s->recv_trailing_md_op != nullptr) {
       // We wanted trailing metadata and we got it
       s->trailing_md_recvd = true;
-      fill_in_metadata(s, &s->to_read_trailing_md,
+      move_in_metadata(s, &s->to_read_trailing_md,
                        s->recv_trailing_md_op->payload->recv_trailing_metadata
-                           .recv_trailing_metadata,
-                       nullptr);
+                           .recv_trailing_metadata);
       s->to_read_trailing_md.Clear();
       s->to_read_trailing_md_filled = false;
 
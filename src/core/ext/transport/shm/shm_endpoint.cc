@@ -0,0 +1,360 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_MEMFD
+
+#include <sys/mman.h>
+
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+namespace grpc_core {
+
+namespace {
+
+class ShmEndpoint {
+ public:
+  ShmEndpoint(grpc_endpoint* wakeup_endpoint, void* memory, bool is_client);
+
+  grpc_endpoint* base() { return &base_; }
+
+ private:
+  static const grpc_endpoint_vtable kVtable;
+
+  static ShmEndpoint* FromBase(grpc_endpoint* ep) {
+    return reinterpret_cast<ShmEndpoint*>(ep);
+  }
+
+  void Ref() { refs_.Ref(); }
+  void Unref();
+
+  void Read(grpc_slice_buffer* slices, grpc_closure* cb);
+  void Write(grpc_slice_buffer* slices, grpc_closure* cb);
+  void Shutdown(grpc_error_handle why);
+
+  // Moves on the pending read or write, if the ring now allows it.
+  void ContinueReadLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void ContinueWriteLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Fails the pending read and write, and every later one, with \a error.
+  void FailLocked(grpc_error_handle error) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Reads from the wakeup socket, unless a read is already in flight.
+  void StartWakeupReadLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Sends the peer a wakeup.  Only one is in flight at a time; wakeups
+  // asked for meanwhile are sent as one once it completes.
+  void SendWakeupLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // The wakeup socket may complete reads and writes inline, so they are
+  // started from the ExecCtx rather than under mu_.
+  static void StartWakeupRead(void* arg, grpc_error_handle error);
+  static void StartWakeupWrite(void* arg, grpc_error_handle error);
+  static void OnWakeupRead(void* arg, grpc_error_handle error);
+  static void OnWakeupWritten(void* arg, grpc_error_handle error);
+
+  // Must be first: grpc_endpoint pointers are cast back to ShmEndpoint.
+  grpc_endpoint base_;
+  RefCount refs_;
+  grpc_endpoint* const wakeup_endpoint_;
+  void* const memory_;
+  ShmRing tx_;
+  ShmRing rx_;
+  grpc_closure start_wakeup_read_;
+  grpc_closure start_wakeup_write_;
+  grpc_closure on_wakeup_read_;
+  grpc_closure on_wakeup_written_;
+  // Owned by the wakeup socket while a read or write is in flight.
+  grpc_slice_buffer wakeup_read_buffer_;
+  grpc_slice_buffer wakeup_write_buffer_;
+
+  Mutex mu_;
+  grpc_error_handle error_ ABSL_GUARDED_BY(mu_);
+  grpc_slice_buffer* read_slices_ ABSL_GUARDED_BY(mu_) = nullptr;
+  grpc_closure* read_cb_ ABSL_GUARDED_BY(mu_) = nullptr;
+  grpc_slice_buffer* write_slices_ ABSL_GUARDED_BY(mu_) = nullptr;
+  grpc_closure* write_cb_ ABSL_GUARDED_BY(mu_) = nullptr;
+  bool wakeup_read_in_flight_ ABSL_GUARDED_BY(mu_) = false;
+  bool wakeup_write_in_flight_ ABSL_GUARDED_BY(mu_) = false;
+  bool wakeup_write_pending_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+ShmEndpoint::ShmEndpoint(grpc_endpoint* wakeup_endpoint, void* memory,
+                         bool is_client)
+    : wakeup_endpoint_(wakeup_endpoint),
+      memory_(memory),
+      tx_(static_cast<char*>(memory) +
+              (is_client ? 0 : ShmRing::MappedSize(kShmRingCapacity)),
+          kShmRingCapacity),
+      rx_(static_cast<char*>(memory) +
+              (is_client ? ShmRing::MappedSize(kShmRingCapacity) : 0),
+          kShmRingCapacity) {
+  base_.vtable = &kVtable;
+  GRPC_CLOSURE_INIT(&start_wakeup_read_, StartWakeupRead, this, nullptr);
+  GRPC_CLOSURE_INIT(&start_wakeup_write_, StartWakeupWrite, this, nullptr);
+  GRPC_CLOSURE_INIT(&on_wakeup_read_, OnWakeupRead, this, nullptr);
+  GRPC_CLOSURE_INIT(&on_wakeup_written_, OnWakeupWritten, this, nullptr);
+  grpc_slice_buffer_init(&wakeup_read_buffer_);
+  grpc_slice_buffer_init(&wakeup_write_buffer_);
+}
+
+void ShmEndpoint::Unref() {
+  if (!refs_.Unref()) return;
+  grpc_endpoint_destroy(wakeup_endpoint_);
+  munmap(memory_, kShmConnectionMemorySize);
+  grpc_slice_buffer_destroy(&wakeup_read_buffer_);
+  grpc_slice_buffer_destroy(&wakeup_write_buffer_);
+  delete this;
+}
+
+void ShmEndpoint::Read(grpc_slice_buffer* slices, grpc_closure* cb) {
+  MutexLock lock(&mu_);
+  GPR_ASSERT(read_cb_ == nullptr);
+  if (!error_.ok()) {
+    ExecCtx::Run(DEBUG_LOCATION, cb, error_);
+    return;
+  }
+  read_slices_ = slices;
+  read_cb_ = cb;
+  ContinueReadLocked();
+}
+
+void ShmEndpoint::ContinueReadLocked() {
+  while (read_cb_ != nullptr) {
+    const int64_t n = rx_.Read(read_slices_, rx_.capacity());
+    if (n < 0) {
+      FailLocked(GRPC_ERROR_CREATE("shm peer published an invalid index"));
+      return;
+    }
+    if (n > 0) {
+      if (rx_.TakeWriterWaiting()) SendWakeupLocked();
+      ExecCtx::Run(DEBUG_LOCATION, std::exchange(read_cb_, nullptr),
+                   absl::OkStatus());
+      read_slices_ = nullptr;
+      return;
+    }
+    if (rx_.WaitForData()) {
+      StartWakeupReadLocked();
+      return;
+    }
+  }
+}
+
+void ShmEndpoint::Write(grpc_slice_buffer* slices, grpc_closure* cb) {
+  MutexLock lock(&mu_);
+  GPR_ASSERT(write_cb_ == nullptr);
+  if (!error_.ok()) {
+    ExecCtx::Run(DEBUG_LOCATION, cb, error_);
+    return;
+  }
+  write_slices_ = slices;
+  write_cb_ = cb;
+  ContinueWriteLocked();
+}
+
+void ShmEndpoint::ContinueWriteLocked() {
+  while (write_cb_ != nullptr) {
+    const int64_t n = tx_.Write(write_slices_);
+    if (n < 0) {
+      FailLocked(GRPC_ERROR_CREATE("shm peer published an invalid index"));
+      return;
+    }
+    if (n > 0 && tx_.TakeReaderWaiting()) SendWakeupLocked();
+    if (write_slices_->length == 0) {
+      ExecCtx::Run(DEBUG_LOCATION, std::exchange(write_cb_, nullptr),
+                   absl::OkStatus());
+      write_slices_ = nullptr;
+      return;
+    }
+    if (tx_.WaitForSpace()) {
+      StartWakeupReadLocked();
+      return;
+    }
+  }
+}
+
+void ShmEndpoint::FailLocked(grpc_error_handle error) {
+  if (error_.ok()) error_ = error;
+  if (read_cb_ != nullptr) {
+    ExecCtx::Run(DEBUG_LOCATION, std::exchange(read_cb_, nullptr), error_);
+    read_slices_ = nullptr;
+  }
+  if (write_cb_ != nullptr) {
+    ExecCtx::Run(DEBUG_LOCATION, std::exchange(write_cb_, nullptr), error_);
+    write_slices_ = nullptr;
+  }
+}
+
+void ShmEndpoint::StartWakeupReadLocked() {
+  if (wakeup_read_in_flight_) return;
+  wakeup_read_in_flight_ = true;
+  Ref();
+  ExecCtx::Run(DEBUG_LOCATION, &start_wakeup_read_, absl::OkStatus());
+}
+
+void ShmEndpoint::StartWakeupRead(void* arg, grpc_error_handle /*error*/) {
+  ShmEndpoint* self = static_cast<ShmEndpoint*>(arg);
+  grpc_endpoint_read(self->wakeup_endpoint_, &self->wakeup_read_buffer_,
+                     &self->on_wakeup_read_, /*urgent=*/true,
+                     /*min_progress_size=*/1);
+}
+
+void ShmEndpoint::OnWakeupRead(void* arg, grpc_error_handle error) {
+  ShmEndpoint* self = static_cast<ShmEndpoint*>(arg);
+  grpc_slice_buffer_reset_and_unref(&self->wakeup_read_buffer_);
+  {
+    MutexLock lock(&self->mu_);
+    self->wakeup_read_in_flight_ = false;
+    if (!error.ok()) {
+      // The peer only closes the socket when it is done with the
+      // connection.
+      self->FailLocked(error);
+    } else if (self->error_.ok()) {
+      // Wakeups do not say which side they are for; try both.
+      self->ContinueReadLocked();
+      self->ContinueWriteLocked();
+    }
+  }
+  self->Unref();
+}
+
+void ShmEndpoint::SendWakeupLocked() {
+  if (wakeup_write_in_flight_) {
+    wakeup_write_pending_ = true;
+    return;
+  }
+  wakeup_write_in_flight_ = true;
+  Ref();
+  ExecCtx::Run(DEBUG_LOCATION, &start_wakeup_write_, absl::OkStatus());
+}
+
+void ShmEndpoint::StartWakeupWrite(void* arg, grpc_error_handle /*error*/) {
+  ShmEndpoint* self = static_cast<ShmEndpoint*>(arg);
+  grpc_slice_buffer_add(&self->wakeup_write_buffer_,
+                        grpc_slice_from_static_string("w"));
+  grpc_endpoint_write(self->wakeup_endpoint_, &self->wakeup_write_buffer_,
+                      &self->on_wakeup_written_, nullptr,
+                      /*max_frame_size=*/1);
+}
+
+void ShmEndpoint::OnWakeupWritten(void* arg, grpc_error_handle error) {
+  ShmEndpoint* self = static_cast<ShmEndpoint*>(arg);
+  grpc_slice_buffer_reset_and_unref(&self->wakeup_write_buffer_);
+  {
+    MutexLock lock(&self->mu_);
+    self->wakeup_write_in_flight_ = false;
+    if (!error.ok()) {
+      self->FailLocked(error);
+    } else if (self->wakeup_write_pending_ && self->error_.ok()) {
+      self->wakeup_write_pending_ = false;
+      self->SendWakeupLocked();
+    }
+  }
+  self->Unref();
+}
+
+void ShmEndpoint::Shutdown(grpc_error_handle why) {
+  {
+    MutexLock lock(&mu_);
+    FailLocked(why.ok() ? GRPC_ERROR_CREATE("shm endpoint shutdown") : why);
+  }
+  // Completes wakeup reads and writes that are still in flight.
+  grpc_endpoint_shutdown(wakeup_endpoint_, why);
+}
+
+const grpc_endpoint_vtable ShmEndpoint::kVtable = {
+    // read
+    [](grpc_endpoint* ep, grpc_slice_buffer* slices, grpc_closure* cb,
+       bool /*urgent*/, int /*min_progress_size*/) {
+      FromBase(ep)->Read(slices, cb);
+    },
+    // write
+    [](grpc_endpoint* ep, grpc_slice_buffer* slices, grpc_closure* cb,
+       void* /*arg*/, int /*max_frame_size*/) {
+      FromBase(ep)->Write(slices, cb);
+    },
+    // add_to_pollset
+    [](grpc_endpoint* ep, grpc_pollset* pollset) {
+      grpc_endpoint_add_to_pollset(FromBase(ep)->wakeup_endpoint_, pollset);
+    },
+    // add_to_pollset_set
+    [](grpc_endpoint* ep, grpc_pollset_set* pollset_set) {
+      grpc_endpoint_add_to_pollset_set(FromBase(ep)->wakeup_endpoint_,
+                                       pollset_set);
+    },
+    // delete_from_pollset_set
+    [](grpc_endpoint* ep, grpc_pollset_set* pollset_set) {
+      grpc_endpoint_delete_from_pollset_set(FromBase(ep)->wakeup_endpoint_,
+                                            pollset_set);
+    },
+    // shutdown
+    [](grpc_endpoint* ep, grpc_error_handle why) {
+      FromBase(ep)->Shutdown(why);
+    },
+    // destroy
+    [](grpc_endpoint* ep) {
+      ShmEndpoint* self = FromBase(ep);
+      self->Shutdown(GRPC_ERROR_CREATE("shm endpoint destroyed"));
+      self->Unref();
+    },
+    // get_peer
+    [](grpc_endpoint* ep) {
+      return grpc_endpoint_get_peer(FromBase(ep)->wakeup_endpoint_);
+    },
+    // get_local_address
+    [](grpc_endpoint* ep) {
+      return grpc_endpoint_get_local_address(FromBase(ep)->wakeup_endpoint_);
+    },
+    // get_fd: the socket only carries wakeups, so nothing may use it
+    // directly.
+    [](grpc_endpoint* /*ep*/) { return -1; },
+    // can_track_err
+    [](grpc_endpoint* /*ep*/) { return false; },
+};
+
+}  // namespace
+
+void InitShmConnectionMemory(void* memory) {
+  ShmRing(memory, kShmRingCapacity).Init();
+  ShmRing(static_cast<char*>(memory) + ShmRing::MappedSize(kShmRingCapacity),
+          kShmRingCapacity)
+      .Init();
+}
+
+grpc_endpoint* CreateShmEndpoint(grpc_endpoint* wakeup_endpoint, void* memory,
+                                 bool is_client) {
+  return (new ShmEndpoint(wakeup_endpoint, memory, is_client))->base();
+}
+
+}  // namespace grpc_core
+
+#endif  // GRPC_LINUX_MEMFD
@@ -0,0 +1,53 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include "src/core/ext/transport/shm/shm_ring.h"
+#include "src/core/lib/iomgr/endpoint.h"
+
+namespace grpc_core {
+
+// Bytes of data each direction of a connection's shared memory holds.
+constexpr size_t kShmRingCapacity = 1024 * 1024;
+
+// Bytes of shared memory a connection uses: one ring per direction.
+constexpr size_t kShmConnectionMemorySize =
+    2 * ShmRing::MappedSize(kShmRingCapacity);
+
+// Initializes a connection's shared memory before it is handed to the peer.
+void InitShmConnectionMemory(void* memory);
+
+// Creates an endpoint that carries a connection's bytes through the rings
+// in \a memory, which must be kShmConnectionMemorySize bytes mapped with
+// mmap().  The client writes the first ring and reads the second; the
+// server does the opposite.
+//
+// \a wakeup_endpoint, the Unix domain socket the connection was set up
+// over, only carries single bytes that wake up a peer waiting for data or
+// space, and tells the endpoint when its peer has gone away.  The endpoint
+// takes ownership of it and of \a memory.
+grpc_endpoint* CreateShmEndpoint(grpc_endpoint* wakeup_endpoint, void* memory,
+                                 bool is_client);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_ENDPOINT_H
@@ -0,0 +1,345 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif  // _GNU_SOURCE
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/shm/shm_handshaker.h"
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_MEMFD
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/support/alloc.h>
+
+#include "src/core/ext/transport/shm/shm_endpoint.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/strerror.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/iomgr_fwd.h"
+#include "src/core/lib/transport/handshaker.h"
+#include "src/core/lib/transport/handshaker_factory.h"
+#include "src/core/lib/transport/handshaker_registry.h"
+
+namespace grpc_core {
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+
+// Sent by the client, along with the shared memory's fd, before anything
+// else goes over the socket.
+constexpr char kShmMagic[8] = {'G', 'R', 'P', 'C', 'S', 'H', 'M', '1'};
+
+// How often the server checks whether the client's shared memory has
+// arrived.  The client sends it as soon as it is connected, so it is
+// normally there on the first try.
+constexpr Duration kReceiveRetryInterval = Duration::Milliseconds(1);
+
+union ControlBuffer {
+  char buf[CMSG_SPACE(sizeof(int))];
+  struct cmsghdr align;
+};
+
+absl::Status ErrnoError(const char* what) {
+  return absl::UnavailableError(absl::StrCat(what, ": ", StrError(errno)));
+}
+
+class ShmHandshaker : public Handshaker {
+ public:
+  explicit ShmHandshaker(bool is_client) : is_client_(is_client) {}
+  void Shutdown(grpc_error_handle why) override;
+  void DoHandshake(grpc_tcp_server_acceptor* /*acceptor*/,
+                   grpc_closure* on_handshake_done,
+                   HandshakerArgs* args) override;
+  const char* name() const override { return "shm"; }
+
+ private:
+  // Client side: creates the connection's shared memory and passes it to
+  // the server over \a fd.
+  static absl::StatusOr<void*> SendMemory(int fd);
+  // Server side: maps the shared memory the client passed over \a fd, or
+  // returns nullptr if it has not arrived yet.
+  static absl::StatusOr<void*> ReceiveMemory(int fd);
+
+  void TryReceiveLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void FinishLocked(absl::StatusOr<void*> memory)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const bool is_client_;
+  Mutex mu_;
+  HandshakerArgs* args_ ABSL_GUARDED_BY(mu_) = nullptr;
+  grpc_closure* on_handshake_done_ ABSL_GUARDED_BY(mu_) = nullptr;
+  int fd_ ABSL_GUARDED_BY(mu_) = -1;
+  std::shared_ptr<EventEngine> event_engine_ ABSL_GUARDED_BY(mu_);
+  absl::optional<EventEngine::TaskHandle> retry_timer_handle_
+      ABSL_GUARDED_BY(mu_);
+};
+
+void ShmHandshaker::Shutdown(grpc_error_handle why) {
+  MutexLock lock(&mu_);
+  if (on_handshake_done_ == nullptr) return;
+  if (retry_timer_handle_.has_value()) {
+    // If the retry is already running, it will find the handshake done.
+    event_engine_->Cancel(*retry_timer_handle_);
+    retry_timer_handle_.reset();
+  }
+  FinishLocked(why.ok() ? GRPC_ERROR_CREATE("shm handshaker shutdown") : why);
+}
+
+void ShmHandshaker::DoHandshake(grpc_tcp_server_acceptor* /*acceptor*/,
+                                grpc_closure* on_handshake_done,
+                                HandshakerArgs* args) {
+  MutexLock lock(&mu_);
+  args_ = args;
+  on_handshake_done_ = on_handshake_done;
+  fd_ = grpc_endpoint_get_fd(args->endpoint);
+  if (fd_ < 0) {
+    FinishLocked(GRPC_ERROR_CREATE("shm transport needs a Unix domain socket"));
+    return;
+  }
+  if (is_client_) {
+    FinishLocked(SendMemory(fd_));
+    return;
+  }
+  if (args->read_buffer->length != 0) {
+    FinishLocked(GRPC_ERROR_CREATE("unexpected bytes before shm handshake"));
+    return;
+  }
+  event_engine_ = args->args.GetObjectRef<EventEngine>();
+  TryReceiveLocked();
+}
+
+void ShmHandshaker::TryReceiveLocked() {
+  absl::StatusOr<void*> memory = ReceiveMemory(fd_);
+  if (!memory.ok() || *memory != nullptr) {
+    FinishLocked(std::move(memory));
+    return;
+  }
+  retry_timer_handle_ =
+      event_engine_->RunAfter(kReceiveRetryInterval, [self = Ref()]() {
+        ApplicationCallbackExecCtx callback_exec_ctx;
+        ExecCtx exec_ctx;
+        auto* handshaker = static_cast<ShmHandshaker*>(self.get());
+        MutexLock lock(&handshaker->mu_);
+        handshaker->retry_timer_handle_.reset();
+        if (handshaker->on_handshake_done_ != nullptr) {
+          handshaker->TryReceiveLocked();
+        }
+      });
+}
+
+void ShmHandshaker::FinishLocked(absl::StatusOr<void*> memory) {
+  if (memory.ok()) {
+    args_->endpoint = CreateShmEndpoint(args_->endpoint, *memory, is_client_);
+  } else {
+    grpc_endpoint_shutdown(args_->endpoint, memory.status());
+    grpc_endpoint_destroy(args_->endpoint);
+    args_->endpoint = nullptr;
+    args_->args = ChannelArgs();
+    grpc_slice_buffer_destroy(args_->read_buffer);
+    gpr_free(args_->read_buffer);
+    args_->read_buffer = nullptr;
+  }
+  ExecCtx::Run(DEBUG_LOCATION, std::exchange(on_handshake_done_, nullptr),
+               memory.status());
+}
+
+absl::StatusOr<void*> ShmHandshaker::SendMemory(int fd) {
+  int memfd = memfd_create("grpc_shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (memfd < 0) return ErrnoError("memfd_create");
+  void* memory = MAP_FAILED;
+  absl::Status status = [&]() {
+    if (ftruncate(memfd, kShmConnectionMemorySize) != 0) {
+      return ErrnoError("ftruncate");
+    }
+    // The server checks for these, so that a client cannot make it fault
+    // by truncating the memory under it.
+    if (fcntl(memfd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) !=
+        0) {
+      return ErrnoError("sealing shm");
+    }
+    memory = mmap(nullptr, kShmConnectionMemorySize, PROT_READ | PROT_WRITE,
+                  MAP_SHARED, memfd, 0);
+    if (memory == MAP_FAILED) return ErrnoError("mmap");
+    InitShmConnectionMemory(memory);
+    struct iovec iov;
+    iov.iov_base = const_cast<char*>(kShmMagic);
+    iov.iov_len = sizeof(kShmMagic);
+    ControlBuffer control;
+    memset(&control, 0, sizeof(control));
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &memfd, sizeof(int));
+    // The socket was just connected and has nothing else queued, so the
+    // few bytes of the handshake fit without waiting.
+    ssize_t sent;
+    do {
+      sent = sendmsg(fd, &msg, MSG_NOSIGNAL);
+    } while (sent < 0 && errno == EINTR);
+    if (sent < 0) return ErrnoError("sending shm");
+    if (sent != sizeof(kShmMagic)) {
+      return absl::UnavailableError("short write sending shm");
+    }
+    return absl::OkStatus();
+  }();
+  close(memfd);
+  if (!status.ok()) {
+    if (memory != MAP_FAILED) munmap(memory, kShmConnectionMemorySize);
+    return status;
+  }
+  return memory;
+}
+
+absl::StatusOr<void*> ShmHandshaker::ReceiveMemory(int fd) {
+  char magic[sizeof(kShmMagic)];
+  struct iovec iov;
+  iov.iov_base = magic;
+  iov.iov_len = sizeof(magic);
+  ControlBuffer control;
+  memset(&control, 0, sizeof(control));
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.buf;
+  msg.msg_controllen = sizeof(control.buf);
+  ssize_t received;
+  do {
+    received = recvmsg(fd, &msg, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+  } while (received < 0 && errno == EINTR);
+  if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    return nullptr;
+  }
+  if (received < 0) return ErrnoError("receiving shm");
+  if (received == 0) {
+    return absl::UnavailableError("connection closed during shm handshake");
+  }
+  int memfd = -1;
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  if (cmsg != nullptr && cmsg->cmsg_level == SOL_SOCKET &&
+      cmsg->cmsg_type == SCM_RIGHTS &&
+      cmsg->cmsg_len == CMSG_LEN(sizeof(int))) {
+    memcpy(&memfd, CMSG_DATA(cmsg), sizeof(int));
+  }
+  void* memory = MAP_FAILED;
+  absl::Status status = [&]() {
+    if (received != sizeof(kShmMagic) ||
+        memcmp(magic, kShmMagic, sizeof(kShmMagic)) != 0) {
+      return absl::UnavailableError("peer did not start an shm handshake");
+    }
+    if (memfd < 0 || (msg.msg_flags & MSG_CTRUNC) != 0) {
+      return absl::UnavailableError("peer did not pass shared memory");
+    }
+    struct stat st;
+    if (fstat(memfd, &st) != 0) return ErrnoError("fstat on shm");
+    if (static_cast<size_t>(st.st_size) != kShmConnectionMemorySize) {
+      return absl::UnavailableError("peer passed shm of the wrong size");
+    }
+    int seals = fcntl(memfd, F_GET_SEALS);
+    if (seals < 0 || (seals & F_SEAL_SHRINK) == 0) {
+      return absl::UnavailableError("peer passed shm that may shrink");
+    }
+    memory = mmap(nullptr, kShmConnectionMemorySize, PROT_READ | PROT_WRITE,
+                  MAP_SHARED, memfd, 0);
+    if (memory == MAP_FAILED) return ErrnoError("mmap");
+    return absl::OkStatus();
+  }();
+  if (memfd >= 0) close(memfd);
+  if (!status.ok()) return status;
+  return memory;
+}
+
+//
+// ShmHandshakerFactory
+//
+
+class ShmHandshakerFactory : public HandshakerFactory {
+ public:
+  explicit ShmHandshakerFactory(bool is_client) : is_client_(is_client) {}
+  void AddHandshakers(const ChannelArgs& args,
+                      grpc_pollset_set* /*interested_parties*/,
+                      HandshakeManager* handshake_mgr) override {
+    if (args.GetBool(GRPC_ARG_SHM_TRANSPORT).value_or(false)) {
+      handshake_mgr->Add(MakeRefCounted<ShmHandshaker>(is_client_));
+    }
+  }
+  HandshakerPriority Priority() override {
+    return HandshakerPriority::kReadAheadSecurityHandshakers;
+  }
+  ~ShmHandshakerFactory() override = default;
+
+ private:
+  const bool is_client_;
+};
+
+}  // namespace
+
+void RegisterShmHandshaker(CoreConfiguration::Builder* builder) {
+  builder->handshaker_registry()->RegisterHandshakerFactory(
+      HANDSHAKER_CLIENT, std::make_unique<ShmHandshakerFactory>(true));
+  builder->handshaker_registry()->RegisterHandshakerFactory(
+      HANDSHAKER_SERVER, std::make_unique<ShmHandshakerFactory>(false));
+}
+
+}  // namespace grpc_core
+
+#else  // GRPC_LINUX_MEMFD
+
+namespace grpc_core {
+
+void RegisterShmHandshaker(CoreConfiguration::Builder* /*builder*/) {}
+
+}  // namespace grpc_core
+
+#endif  // GRPC_LINUX_MEMFD
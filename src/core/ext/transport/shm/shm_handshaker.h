@@ -0,0 +1,39 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_HANDSHAKER_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_HANDSHAKER_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/config/core_configuration.h"
+
+// Set on the addresses the "shm:" resolver returns, and on the listeners of
+// "shm:" server ports.  Connections are made over a Unix domain socket as
+// for "unix:", after which the shm handshaker moves their bytes into
+// shared memory.  Both the client and the server must use "shm:".
+#define GRPC_ARG_SHM_TRANSPORT "grpc.internal.shm_transport"
+
+namespace grpc_core {
+
+// Register the shm handshaker into the configuration builder.  Does
+// nothing on platforms without memfd_create(), where "shm:" connections
+// stay on their Unix domain socket.
+void RegisterShmHandshaker(CoreConfiguration::Builder* builder);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_HANDSHAKER_H
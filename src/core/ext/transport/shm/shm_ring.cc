@@ -0,0 +1,122 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/shm/shm_ring.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <new>
+
+#include <grpc/slice.h>
+#include <grpc/support/log.h>
+
+namespace grpc_core {
+
+constexpr size_t ShmRing::kHeaderSize;
+
+ShmRing::ShmRing(void* memory, size_t capacity)
+    : header_(static_cast<Header*>(memory)),
+      data_(static_cast<uint8_t*>(memory) + kHeaderSize),
+      capacity_(capacity) {
+  GPR_ASSERT(capacity_ > 0 && (capacity_ & (capacity_ - 1)) == 0);
+}
+
+void ShmRing::Init() { new (header_) Header(); }
+
+// The waiting flags pair a store of one side with a load of the other, so
+// the indices are published and read sequentially consistent: a side that
+// marks itself waiting and then finds nothing to do is sure to be seen by a
+// peer that moves its index afterwards.
+
+int64_t ShmRing::Readable() const {
+  const uint64_t tail = header_->tail.load(std::memory_order_seq_cst);
+  const uint64_t readable = tail - local_head_;
+  if (readable > capacity_) return -1;
+  return static_cast<int64_t>(readable);
+}
+
+int64_t ShmRing::Writable() const {
+  const uint64_t head = header_->head.load(std::memory_order_seq_cst);
+  const uint64_t used = local_tail_ - head;
+  if (used > capacity_) return -1;
+  return static_cast<int64_t>(capacity_ - used);
+}
+
+int64_t ShmRing::Write(grpc_slice_buffer* slices) {
+  const int64_t writable = Writable();
+  if (writable <= 0) return writable;
+  const size_t n = std::min(static_cast<size_t>(writable), slices->length);
+  if (n == 0) return 0;
+  const size_t offset = local_tail_ & (capacity_ - 1);
+  const size_t first = std::min(n, capacity_ - offset);
+  grpc_slice_buffer_move_first_into_buffer(slices, first, data_ + offset);
+  if (first < n) {
+    grpc_slice_buffer_move_first_into_buffer(slices, n - first, data_);
+  }
+  local_tail_ += n;
+  header_->tail.store(local_tail_, std::memory_order_seq_cst);
+  return static_cast<int64_t>(n);
+}
+
+bool ShmRing::WaitForSpace() {
+  header_->writer_waiting.store(1, std::memory_order_seq_cst);
+  if (Writable() != 0) {
+    header_->writer_waiting.store(0, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+bool ShmRing::TakeReaderWaiting() {
+  return header_->reader_waiting.load(std::memory_order_seq_cst) != 0 &&
+         header_->reader_waiting.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+int64_t ShmRing::Read(grpc_slice_buffer* slices, size_t max_bytes) {
+  const int64_t readable = Readable();
+  if (readable <= 0) return readable;
+  const size_t n = std::min(static_cast<size_t>(readable), max_bytes);
+  if (n == 0) return 0;
+  const size_t offset = local_head_ & (capacity_ - 1);
+  const size_t first = std::min(n, capacity_ - offset);
+  grpc_slice slice = grpc_slice_malloc_large(n);
+  uint8_t* out = GRPC_SLICE_START_PTR(slice);
+  memcpy(out, data_ + offset, first);
+  if (first < n) memcpy(out + first, data_, n - first);
+  grpc_slice_buffer_add(slices, slice);
+  local_head_ += n;
+  header_->head.store(local_head_, std::memory_order_seq_cst);
+  return static_cast<int64_t>(n);
+}
+
+bool ShmRing::WaitForData() {
+  header_->reader_waiting.store(1, std::memory_order_seq_cst);
+  if (Readable() != 0) {
+    header_->reader_waiting.store(0, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+bool ShmRing::TakeWriterWaiting() {
+  return header_->writer_waiting.load(std::memory_order_seq_cst) != 0 &&
+         header_->writer_waiting.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+}  // namespace grpc_core
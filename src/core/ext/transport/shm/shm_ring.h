@@ -0,0 +1,117 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_RING_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_RING_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include <grpc/slice_buffer.h>
+
+namespace grpc_core {
+
+// A single-producer single-consumer byte ring kept in memory shared by two
+// processes.  One process only ever writes to a ring and the other only
+// ever reads from it.  Neither side trusts the indices its peer publishes:
+// each keeps its own index privately and checks the peer's against it.
+//
+// Sides that find the ring empty (or full) say so with a waiting flag
+// before they block, so that the other side knows to wake them up after
+// its next read or write.  How they are woken is up to the caller.
+class ShmRing {
+ public:
+  // Bytes at the start of a ring's memory used for its indices and flags.
+  static constexpr size_t kHeaderSize = 256;
+
+  // Bytes of shared memory a ring with \a capacity bytes of data occupies.
+  static constexpr size_t MappedSize(size_t capacity) {
+    return kHeaderSize + capacity;
+  }
+
+  // \a memory must be MappedSize(capacity) bytes, aligned to a cache line,
+  // and \a capacity a power of two.  The process that creates the shared
+  // memory must call Init() before either side uses the ring.
+  ShmRing(void* memory, size_t capacity);
+
+  ShmRing(const ShmRing&) = delete;
+  ShmRing& operator=(const ShmRing&) = delete;
+
+  void Init();
+
+  size_t capacity() const { return capacity_; }
+
+  // Writer side.
+
+  // Moves as many bytes from the front of \a slices into the ring as fit,
+  // and returns how many that was.  Returns -1 if the reader has published
+  // an impossible index, in which case the ring must no longer be used.
+  int64_t Write(grpc_slice_buffer* slices);
+  // Marks the writer as waiting for space.  Returns false, with the mark
+  // removed again, if space freed up in the meantime (or the reader's index
+  // turned out impossible, which the next Write() reports).
+  bool WaitForSpace();
+  // Whether the reader is waiting for data and must be woken up.  Clears
+  // the reader's waiting flag.
+  bool TakeReaderWaiting();
+
+  // Reader side.
+
+  // Appends up to \a max_bytes bytes from the ring to \a slices, and
+  // returns how many that was.  Returns -1 if the writer has published an
+  // impossible index, in which case the ring must no longer be used.
+  int64_t Read(grpc_slice_buffer* slices, size_t max_bytes);
+  // Marks the reader as waiting for data.  Returns false, with the mark
+  // removed again, if data arrived in the meantime (or the writer's index
+  // turned out impossible, which the next Read() reports).
+  bool WaitForData();
+  // Whether the writer is waiting for space and must be woken up.  Clears
+  // the writer's waiting flag.
+  bool TakeWriterWaiting();
+
+ private:
+  struct Header {
+    // Total bytes ever read, published by the reader.
+    alignas(64) std::atomic<uint64_t> head;
+    // Total bytes ever written, published by the writer.
+    alignas(64) std::atomic<uint64_t> tail;
+    alignas(64) std::atomic<uint32_t> reader_waiting;
+    std::atomic<uint32_t> writer_waiting;
+  };
+  static_assert(sizeof(Header) <= kHeaderSize, "ShmRing header too large");
+
+  // Bytes the writer has published that the reader has not read yet, or
+  // -1 if the writer's index is impossible.
+  int64_t Readable() const;
+  // Free bytes the reader has left, or -1 if the reader's index is
+  // impossible.
+  int64_t Writable() const;
+
+  Header* const header_;
+  uint8_t* const data_;
+  const size_t capacity_;
+  // This side's own index: head for the reader, tail for the writer.
+  uint64_t local_head_ = 0;
+  uint64_t local_tail_ = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_SHM_SHM_RING_H
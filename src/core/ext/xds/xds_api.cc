@@ -22,6 +22,7 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -40,6 +41,7 @@
 #include "google/protobuf/struct.upb.h"
 #include "google/protobuf/timestamp.upb.h"
 #include "google/rpc/status.upb.h"
+#include "upb/decode.h"
 #include "upb/def.h"
 #include "upb/text_encode.h"
 #include "upb/upb.h"
@@ -51,6 +53,7 @@
 
 #include "src/core/ext/xds/upb_utils.h"
 #include "src/core/ext/xds/xds_client.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/json/json.h"
 
 // IWYU pragma: no_include "upb/msg_internal.h"
@@ -284,14 +287,40 @@ void MaybeLogDiscoveryResponse(
 
 }  // namespace
 
+namespace {
+
+// Decoding a resource takes a few times its serialized size.
+constexpr size_t kResourceArenaBytesPerSerializedByte = 4;
+constexpr size_t kMinResourceArenaBlockSize = 4 * 1024;
+constexpr size_t kMaxResourceArenaBlockSize = 256 * 1024;
+
+}  // namespace
+
+void XdsApi::SizeResourceArenaBlock(size_t largest_resource_size) {
+  const size_t size =
+      Clamp(largest_resource_size * kResourceArenaBytesPerSerializedByte,
+            kMinResourceArenaBlockSize, kMaxResourceArenaBlockSize);
+  // Grow right away, but only give memory back once responses have got
+  // much smaller, so that a server alternating between sizes does not
+  // make us reallocate every time.
+  if (size > resource_arena_block_.size() ||
+      size < resource_arena_block_.size() / 4) {
+    resource_arena_block_ = std::vector<char>(size);
+  }
+}
+
 absl::Status XdsApi::ParseAdsResponse(absl::string_view encoded_response,
                                       AdsResponseParserInterface* parser) {
   upb::Arena arena;
   const XdsApiContext context = {client_, tracer_, symtab_->ptr(), arena.ptr()};
-  // Decode the response.
+  // Decode the response.  Its strings alias encoded_response, which
+  // outlives the parse, so the resources are not copied: only the small
+  // Any messages pointing at them are materialized here, and each
+  // resource is decoded into its own arena below.
   const envoy_service_discovery_v3_DiscoveryResponse* response =
-      envoy_service_discovery_v3_DiscoveryResponse_parse(
-          encoded_response.data(), encoded_response.size(), arena.ptr());
+      envoy_service_discovery_v3_DiscoveryResponse_parse_ex(
+          encoded_response.data(), encoded_response.size(), nullptr,
+          kUpb_DecodeOption_AliasString, arena.ptr());
   // If decoding fails, report a fatal error and return.
   if (response == nullptr) {
     return absl::InvalidArgumentError("Can't decode DiscoveryResponse.");
@@ -314,8 +343,16 @@ absl::Status XdsApi::ParseAdsResponse(absl::string_view encoded_response,
   fields.num_resources = num_resources;
   absl::Status status = parser->ProcessAdsResponseFields(std::move(fields));
   if (!status.ok()) return status;
+  size_t largest_resource_size = 0;
+  for (size_t i = 0; i < num_resources; ++i) {
+    largest_resource_size = std::max(
+        largest_resource_size, google_protobuf_Any_value(resources[i]).size);
+  }
+  SizeResourceArenaBlock(largest_resource_size);
   // Process each resource.
   for (size_t i = 0; i < num_resources; ++i) {
+    upb::Arena resource_arena(resource_arena_block_.data(),
+                              resource_arena_block_.size());
     absl::string_view type_url = absl::StripPrefix(
         UpbStringToAbsl(google_protobuf_Any_type_url(resources[i])),
         "type.googleapis.com/");
@@ -324,8 +361,10 @@ absl::Status XdsApi::ParseAdsResponse(absl::string_view encoded_response,
     // Unwrap Resource messages, if so wrapped.
     absl::string_view resource_name;
     if (type_url == "envoy.service.discovery.v3.Resource") {
-      const auto* resource_wrapper = envoy_service_discovery_v3_Resource_parse(
-          serialized_resource.data(), serialized_resource.size(), arena.ptr());
+      const auto* resource_wrapper =
+          envoy_service_discovery_v3_Resource_parse_ex(
+              serialized_resource.data(), serialized_resource.size(), nullptr,
+              kUpb_DecodeOption_AliasString, resource_arena.ptr());
       if (resource_wrapper == nullptr) {
         parser->ResourceWrapperParsingFailed(i);
         continue;
@@ -340,8 +379,177 @@ absl::Status XdsApi::ParseAdsResponse(absl::string_view encoded_response,
       resource_name = UpbStringToAbsl(
           envoy_service_discovery_v3_Resource_name(resource_wrapper));
     }
-    parser->ParseResource(context.arena, i, type_url, resource_name,
-                          serialized_resource);
+    parser->ParseResource(resource_arena.ptr(), i, type_url, resource_name,
+                          /*resource_version=*/"", serialized_resource);
+  }
+  return absl::OkStatus();
+}
+
+namespace {
+
+void MaybeLogDeltaDiscoveryRequest(
+    const XdsApiContext& context,
+    const envoy_service_discovery_v3_DeltaDiscoveryRequest* request) {
+  if (GRPC_TRACE_FLAG_ENABLED(*context.tracer) &&
+      gpr_should_log(GPR_LOG_SEVERITY_DEBUG)) {
+    const upb_MessageDef* msg_type =
+        envoy_service_discovery_v3_DeltaDiscoveryRequest_getmsgdef(
+            context.symtab);
+    char buf[10240];
+    upb_TextEncode(request, msg_type, nullptr, 0, buf, sizeof(buf));
+    gpr_log(GPR_DEBUG, "[xds_client %p] constructed delta ADS request: %s",
+            context.client, buf);
+  }
+}
+
+void MaybeLogDeltaDiscoveryResponse(
+    const XdsApiContext& context,
+    const envoy_service_discovery_v3_DeltaDiscoveryResponse* response) {
+  if (GRPC_TRACE_FLAG_ENABLED(*context.tracer) &&
+      gpr_should_log(GPR_LOG_SEVERITY_DEBUG)) {
+    const upb_MessageDef* msg_type =
+        envoy_service_discovery_v3_DeltaDiscoveryResponse_getmsgdef(
+            context.symtab);
+    char buf[10240];
+    upb_TextEncode(response, msg_type, nullptr, 0, buf, sizeof(buf));
+    gpr_log(GPR_DEBUG, "[xds_client %p] received delta response: %s",
+            context.client, buf);
+  }
+}
+
+}  // namespace
+
+std::string XdsApi::CreateDeltaAdsRequest(
+    absl::string_view type_url, absl::string_view nonce,
+    const std::vector<std::string>& resource_names_subscribe,
+    const std::vector<std::string>& resource_names_unsubscribe,
+    const std::map<std::string, std::string>& initial_resource_versions,
+    absl::Status status, bool populate_node) {
+  upb::Arena arena;
+  const XdsApiContext context = {client_, tracer_, symtab_->ptr(), arena.ptr()};
+  // Create a request.
+  envoy_service_discovery_v3_DeltaDiscoveryRequest* request =
+      envoy_service_discovery_v3_DeltaDiscoveryRequest_new(arena.ptr());
+  // Set type_url.
+  std::string type_url_str = absl::StrCat("type.googleapis.com/", type_url);
+  envoy_service_discovery_v3_DeltaDiscoveryRequest_set_type_url(
+      request, StdStringToUpbString(type_url_str));
+  // Set nonce.
+  if (!nonce.empty()) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_set_response_nonce(
+        request, StdStringToUpbString(nonce));
+  }
+  // Set error_detail if it's a NACK.
+  std::string error_string_storage;
+  if (!status.ok()) {
+    google_rpc_Status* error_detail =
+        envoy_service_discovery_v3_DeltaDiscoveryRequest_mutable_error_detail(
+            request, arena.ptr());
+    // Hard-code INVALID_ARGUMENT as the status code, as for SotW requests.
+    google_rpc_Status_set_code(error_detail, GRPC_STATUS_INVALID_ARGUMENT);
+    error_string_storage = std::string(status.message());
+    google_rpc_Status_set_message(error_detail,
+                                  StdStringToUpbString(error_string_storage));
+  }
+  // Populate node.
+  if (populate_node) {
+    envoy_config_core_v3_Node* node_msg =
+        envoy_service_discovery_v3_DeltaDiscoveryRequest_mutable_node(
+            request, arena.ptr());
+    PopulateNode(context, node_, user_agent_name_, user_agent_version_,
+                 node_msg);
+  }
+  // Add the subscription changes.
+  for (const std::string& resource_name : resource_names_subscribe) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_add_resource_names_subscribe(
+        request, StdStringToUpbString(resource_name), arena.ptr());
+  }
+  for (const std::string& resource_name : resource_names_unsubscribe) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_add_resource_names_unsubscribe(
+        request, StdStringToUpbString(resource_name), arena.ptr());
+  }
+  // Tell the server which versions we already have, so that it need not
+  // resend them.
+  for (const auto& p : initial_resource_versions) {
+    envoy_service_discovery_v3_DeltaDiscoveryRequest_initial_resource_versions_set(
+        request, StdStringToUpbString(p.first), StdStringToUpbString(p.second),
+        arena.ptr());
+  }
+  MaybeLogDeltaDiscoveryRequest(context, request);
+  size_t output_length;
+  char* output = envoy_service_discovery_v3_DeltaDiscoveryRequest_serialize(
+      request, arena.ptr(), &output_length);
+  return std::string(output, output_length);
+}
+
+absl::Status XdsApi::ParseDeltaAdsResponse(absl::string_view encoded_response,
+                                           AdsResponseParserInterface* parser) {
+  upb::Arena arena;
+  const XdsApiContext context = {client_, tracer_, symtab_->ptr(), arena.ptr()};
+  // Decode the response, aliasing encoded_response as for SotW responses.
+  const envoy_service_discovery_v3_DeltaDiscoveryResponse* response =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_parse_ex(
+          encoded_response.data(), encoded_response.size(), nullptr,
+          kUpb_DecodeOption_AliasString, arena.ptr());
+  // If decoding fails, report a fatal error and return.
+  if (response == nullptr) {
+    return absl::InvalidArgumentError("Can't decode DeltaDiscoveryResponse.");
+  }
+  MaybeLogDeltaDiscoveryResponse(context, response);
+  // Report the type_url, version, nonce, and number of resources to the
+  // parser.  The system version is informational only.
+  AdsResponseParserInterface::AdsResponseFields fields;
+  fields.type_url = std::string(absl::StripPrefix(
+      UpbStringToAbsl(
+          envoy_service_discovery_v3_DeltaDiscoveryResponse_type_url(response)),
+      "type.googleapis.com/"));
+  fields.version = UpbStringToStdString(
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_system_version_info(
+          response));
+  fields.nonce = UpbStringToStdString(
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_nonce(response));
+  size_t num_resources;
+  const envoy_service_discovery_v3_Resource* const* resources =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_resources(
+          response, &num_resources);
+  fields.num_resources = num_resources;
+  absl::Status status = parser->ProcessAdsResponseFields(std::move(fields));
+  if (!status.ok()) return status;
+  size_t largest_resource_size = 0;
+  for (size_t i = 0; i < num_resources; ++i) {
+    const google_protobuf_Any* resource =
+        envoy_service_discovery_v3_Resource_resource(resources[i]);
+    if (resource == nullptr) continue;
+    largest_resource_size = std::max(largest_resource_size,
+                                     google_protobuf_Any_value(resource).size);
+  }
+  SizeResourceArenaBlock(largest_resource_size);
+  // Process each resource.
+  for (size_t i = 0; i < num_resources; ++i) {
+    const google_protobuf_Any* resource =
+        envoy_service_discovery_v3_Resource_resource(resources[i]);
+    // A resource without a payload is a TTL heartbeat, which we do not
+    // support, so there is nothing to update.
+    if (resource == nullptr) continue;
+    upb::Arena resource_arena(resource_arena_block_.data(),
+                              resource_arena_block_.size());
+    absl::string_view type_url = absl::StripPrefix(
+        UpbStringToAbsl(google_protobuf_Any_type_url(resource)),
+        "type.googleapis.com/");
+    parser->ParseResource(
+        resource_arena.ptr(), i, type_url,
+        UpbStringToAbsl(envoy_service_discovery_v3_Resource_name(resources[i])),
+        UpbStringToAbsl(
+            envoy_service_discovery_v3_Resource_version(resources[i])),
+        UpbStringToAbsl(google_protobuf_Any_value(resource)));
+  }
+  // Process removals.
+  size_t num_removed;
+  const upb_StringView* removed =
+      envoy_service_discovery_v3_DeltaDiscoveryResponse_removed_resources(
+          response, &num_removed);
+  for (size_t i = 0; i < num_removed; ++i) {
+    parser->ResourceRemoved(UpbStringToAbsl(removed[i]));
   }
   return absl::OkStatus();
 }
@@ -555,66 +763,61 @@ google_protobuf_Timestamp* EncodeTimestamp(const XdsApiContext& context,
 
 }  // namespace
 
-std::string XdsApi::AssembleClientConfig(
-    const ResourceTypeMetadataMap& resource_type_metadata_map) {
+std::string XdsApi::AssembleClientConfigNode() {
   upb::Arena arena;
-  // Create the ClientConfig for resource metadata from XdsClient
   auto* client_config = envoy_service_status_v3_ClientConfig_new(arena.ptr());
-  // Fill-in the node information
   auto* node = envoy_service_status_v3_ClientConfig_mutable_node(client_config,
                                                                  arena.ptr());
   const XdsApiContext context = {client_, tracer_, symtab_->ptr(), arena.ptr()};
   PopulateNode(context, node_, user_agent_name_, user_agent_version_, node);
-  // Dump each resource.
-  std::vector<std::string> type_url_storage;
-  for (const auto& p : resource_type_metadata_map) {
-    absl::string_view type_url = p.first;
-    const ResourceMetadataMap& resource_metadata_map = p.second;
-    type_url_storage.emplace_back(
-        absl::StrCat("type.googleapis.com/", type_url));
-    for (const auto& q : resource_metadata_map) {
-      absl::string_view resource_name = q.first;
-      const ResourceMetadata& metadata = *q.second;
-      auto* entry =
-          envoy_service_status_v3_ClientConfig_add_generic_xds_configs(
-              client_config, context.arena);
-      envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_type_url(
-          entry, StdStringToUpbString(type_url_storage.back()));
-      envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_name(
-          entry, StdStringToUpbString(resource_name));
-      envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_client_status(
-          entry, metadata.client_status);
-      if (!metadata.serialized_proto.empty()) {
-        envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_version_info(
-            entry, StdStringToUpbString(metadata.version));
-        envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_last_updated(
-            entry, EncodeTimestamp(context, metadata.update_time));
-        auto* any_field =
-            envoy_service_status_v3_ClientConfig_GenericXdsConfig_mutable_xds_config(
-                entry, context.arena);
-        google_protobuf_Any_set_type_url(
-            any_field, StdStringToUpbString(type_url_storage.back()));
-        google_protobuf_Any_set_value(
-            any_field, StdStringToUpbString(metadata.serialized_proto));
-      }
-      if (metadata.client_status == XdsApi::ResourceMetadata::NACKED) {
-        auto* update_failure_state =
-            envoy_admin_v3_UpdateFailureState_new(context.arena);
-        envoy_admin_v3_UpdateFailureState_set_details(
-            update_failure_state,
-            StdStringToUpbString(metadata.failed_details));
-        envoy_admin_v3_UpdateFailureState_set_version_info(
-            update_failure_state,
-            StdStringToUpbString(metadata.failed_version));
-        envoy_admin_v3_UpdateFailureState_set_last_update_attempt(
-            update_failure_state,
-            EncodeTimestamp(context, metadata.failed_update_time));
-        envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_error_state(
-            entry, update_failure_state);
-      }
-    }
+  size_t output_length;
+  char* output = envoy_service_status_v3_ClientConfig_serialize(
+      client_config, arena.ptr(), &output_length);
+  return std::string(output, output_length);
+}
+
+std::string XdsApi::AssembleClientConfigEntry(
+    absl::string_view type_url, absl::string_view resource_name,
+    const ResourceMetadata& metadata) {
+  upb::Arena arena;
+  auto* client_config = envoy_service_status_v3_ClientConfig_new(arena.ptr());
+  const XdsApiContext context = {client_, tracer_, symtab_->ptr(), arena.ptr()};
+  const std::string full_type_url =
+      absl::StrCat("type.googleapis.com/", type_url);
+  auto* entry = envoy_service_status_v3_ClientConfig_add_generic_xds_configs(
+      client_config, context.arena);
+  envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_type_url(
+      entry, StdStringToUpbString(full_type_url));
+  envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_name(
+      entry, StdStringToUpbString(resource_name));
+  envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_client_status(
+      entry, metadata.client_status);
+  if (!metadata.serialized_proto.empty()) {
+    envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_version_info(
+        entry, StdStringToUpbString(metadata.version));
+    envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_last_updated(
+        entry, EncodeTimestamp(context, metadata.update_time));
+    auto* any_field =
+        envoy_service_status_v3_ClientConfig_GenericXdsConfig_mutable_xds_config(
+            entry, context.arena);
+    google_protobuf_Any_set_type_url(any_field,
+                                     StdStringToUpbString(full_type_url));
+    google_protobuf_Any_set_value(
+        any_field, StdStringToUpbString(metadata.serialized_proto));
+  }
+  if (metadata.client_status == XdsApi::ResourceMetadata::NACKED) {
+    auto* update_failure_state =
+        envoy_admin_v3_UpdateFailureState_new(context.arena);
+    envoy_admin_v3_UpdateFailureState_set_details(
+        update_failure_state, StdStringToUpbString(metadata.failed_details));
+    envoy_admin_v3_UpdateFailureState_set_version_info(
+        update_failure_state, StdStringToUpbString(metadata.failed_version));
+    envoy_admin_v3_UpdateFailureState_set_last_update_attempt(
+        update_failure_state,
+        EncodeTimestamp(context, metadata.failed_update_time));
+    envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_error_state(
+        entry, update_failure_state);
   }
-  // Serialize the upb message to bytes
   size_t output_length;
   char* output = envoy_service_status_v3_ClientConfig_serialize(
       client_config, arena.ptr(), &output_length);
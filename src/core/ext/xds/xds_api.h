@@ -68,12 +68,18 @@ class XdsApi {
 
     // Called to parse each individual resource in the ADS response.
     // Note that resource_name is non-empty only when the resource was
-    // wrapped in a Resource wrapper proto.
+    // wrapped in a Resource wrapper proto.  resource_version is non-empty
+    // only in delta responses, where each resource has its own version.
     virtual void ParseResource(upb_Arena* arena, size_t idx,
                                absl::string_view type_url,
                                absl::string_view resource_name,
+                               absl::string_view resource_version,
                                absl::string_view serialized_resource) = 0;
 
+    // Called for each name in the removed_resources field of a delta ADS
+    // response.
+    virtual void ResourceRemoved(absl::string_view resource_name) = 0;
+
     // Called when a resource is wrapped in a Resource wrapper proto but
     // we fail to deserialize the wrapper proto.
     virtual void ResourceWrapperParsingFailed(size_t idx) = 0;
@@ -125,10 +131,6 @@ class XdsApi {
     // Timestamp of the last failed update attempt.
     Timestamp failed_update_time;
   };
-  using ResourceMetadataMap =
-      std::map<std::string /*resource_name*/, const ResourceMetadata*>;
-  using ResourceTypeMetadataMap =
-      std::map<absl::string_view /*type_url*/, ResourceMetadataMap>;
   static_assert(static_cast<ResourceMetadata::ClientResourceStatus>(
                     envoy_admin_v3_REQUESTED) ==
                     ResourceMetadata::ClientResourceStatus::REQUESTED,
@@ -162,6 +164,21 @@ class XdsApi {
   absl::Status ParseAdsResponse(absl::string_view encoded_response,
                                 AdsResponseParserInterface* parser);
 
+  // Creates a delta ADS request.  Only the changes to the subscribed set
+  // since the previous request for type_url on the stream are sent.
+  // initial_resource_versions should be non-empty only for the first
+  // request for type_url on a stream, listing the cached resources.
+  std::string CreateDeltaAdsRequest(
+      absl::string_view type_url, absl::string_view nonce,
+      const std::vector<std::string>& resource_names_subscribe,
+      const std::vector<std::string>& resource_names_unsubscribe,
+      const std::map<std::string, std::string>& initial_resource_versions,
+      absl::Status status, bool populate_node);
+
+  // Like ParseAdsResponse(), but for a DeltaDiscoveryResponse.
+  absl::Status ParseDeltaAdsResponse(absl::string_view encoded_response,
+                                     AdsResponseParserInterface* parser);
+
   // Creates an initial LRS request.
   std::string CreateLrsInitialRequest();
 
@@ -175,17 +192,33 @@ class XdsApi {
                                 std::set<std::string>* cluster_names,
                                 Duration* load_reporting_interval);
 
-  // Assemble the client config proto message and return the serialized result.
-  std::string AssembleClientConfig(
-      const ResourceTypeMetadataMap& resource_type_metadata_map);
+  // The client config proto message is assembled in pieces, so that the
+  // pieces can be cached: serialized messages concatenate into the message
+  // holding their fields merged, and so the client config is the node
+  // followed by one entry per resource.
+  // Returns a serialized client config holding only the node.
+  std::string AssembleClientConfigNode();
+  // Returns a serialized client config holding only the generic xDS config
+  // of one resource.
+  std::string AssembleClientConfigEntry(absl::string_view type_url,
+                                        absl::string_view resource_name,
+                                        const ResourceMetadata& metadata);
 
  private:
+  // Sizes resource_arena_block_ for a response whose largest serialized
+  // resource is largest_resource_size bytes.
+  void SizeResourceArenaBlock(size_t largest_resource_size);
+
   XdsClient* client_;
   TraceFlag* tracer_;
   const XdsBootstrap::Node* node_;  // Do not own.
   upb::SymbolTable* symtab_;        // Do not own.
   const std::string user_agent_name_;
   const std::string user_agent_version_;
+  // Initial block of the arena that each resource of a response is decoded
+  // into, reused from one resource to the next so that decoding a resource
+  // usually allocates nothing.  Only used under the XdsClient's lock.
+  std::vector<char> resource_arena_block_;
 };
 
 }  // namespace grpc_core
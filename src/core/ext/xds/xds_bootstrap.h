@@ -47,6 +47,9 @@ class XdsBootstrap {
 
     virtual const std::string& server_uri() const = 0;
     virtual bool IgnoreResourceDeletion() const = 0;
+    // Whether to use the incremental (delta) ADS protocol instead of the
+    // state-of-the-world one.
+    virtual bool UseDeltaProtocol() const = 0;
 
     virtual bool Equals(const XdsServer& other) const = 0;
 
@@ -81,6 +84,10 @@ class XdsBootstrap {
   // If the server exists in the bootstrap config, returns a pointer to
   // the XdsServer instance in the config.  Otherwise, returns null.
   virtual const XdsServer* FindXdsServer(const XdsServer& server) const = 0;
+
+  // Returns the path of the file in which to persist ACKed resources
+  // across restarts, or the empty string if there is none.
+  virtual const std::string& resource_cache_path() const = 0;
 };
 
 }  // namespace grpc_core
@@ -97,6 +97,8 @@ namespace {
 constexpr absl::string_view kServerFeatureIgnoreResourceDeletion =
     "ignore_resource_deletion";
 
+constexpr absl::string_view kServerFeatureDeltaXds = "delta_xds";
+
 }  // namespace
 
 bool GrpcXdsBootstrap::GrpcXdsServer::IgnoreResourceDeletion() const {
@@ -104,6 +106,11 @@ bool GrpcXdsBootstrap::GrpcXdsServer::IgnoreResourceDeletion() const {
              kServerFeatureIgnoreResourceDeletion)) != server_features_.end();
 }
 
+bool GrpcXdsBootstrap::GrpcXdsServer::UseDeltaProtocol() const {
+  return server_features_.find(std::string(kServerFeatureDeltaXds)) !=
+         server_features_.end();
+}
+
 bool GrpcXdsBootstrap::GrpcXdsServer::Equals(const XdsServer& other) const {
   const auto& o = static_cast<const GrpcXdsServer&>(other);
   return (server_uri_ == o.server_uri_ &&
@@ -162,7 +169,8 @@ void GrpcXdsBootstrap::GrpcXdsServer::JsonPostLoad(const Json& json,
         for (const Json& feature_json : array) {
           if (feature_json.type() == Json::Type::STRING &&
               (feature_json.string_value() ==
-               kServerFeatureIgnoreResourceDeletion)) {
+                   kServerFeatureIgnoreResourceDeletion ||
+               feature_json.string_value() == kServerFeatureDeltaXds)) {
             server_features_.insert(feature_json.string_value());
           }
         }
@@ -240,6 +248,8 @@ const JsonLoaderInterface* GrpcXdsBootstrap::JsonLoader(const JsonArgs&) {
           .OptionalField(
               "server_listener_resource_name_template",
               &GrpcXdsBootstrap::server_listener_resource_name_template_)
+          .OptionalField("resource_cache_path",
+                         &GrpcXdsBootstrap::resource_cache_path_)
           .OptionalField("authorities", &GrpcXdsBootstrap::authorities_,
                          "federation")
           .OptionalField("client_default_listener_resource_name_template",
@@ -305,6 +315,10 @@ std::string GrpcXdsBootstrap::ToString() const {
         absl::StrFormat("server_listener_resource_name_template=\"%s\",\n",
                         server_listener_resource_name_template_));
   }
+  if (!resource_cache_path_.empty()) {
+    parts.push_back(absl::StrFormat("resource_cache_path=\"%s\",\n",
+                                    resource_cache_path_));
+  }
   parts.push_back("authorities={\n");
   for (const auto& entry : authorities_) {
     parts.push_back(absl::StrFormat("  %s={\n", entry.first));
@@ -78,6 +78,7 @@ class GrpcXdsBootstrap : public XdsBootstrap {
     const std::string& server_uri() const override { return server_uri_; }
 
     bool IgnoreResourceDeletion() const override;
+    bool UseDeltaProtocol() const override;
 
     bool Equals(const XdsServer& other) const override;
 
@@ -140,6 +141,9 @@ class GrpcXdsBootstrap : public XdsBootstrap {
   }
   const Authority* LookupAuthority(const std::string& name) const override;
   const XdsServer* FindXdsServer(const XdsServer& server) const override;
+  const std::string& resource_cache_path() const override {
+    return resource_cache_path_;
+  }
 
   const std::string& client_default_listener_resource_name_template() const {
     return client_default_listener_resource_name_template_;
@@ -172,6 +176,7 @@ class GrpcXdsBootstrap : public XdsBootstrap {
   absl::optional<GrpcNode> node_;
   std::string client_default_listener_resource_name_template_;
   std::string server_listener_resource_name_template_;
+  std::string resource_cache_path_;
   std::map<std::string, GrpcAuthority> authorities_;
   CertificateProviderStore::PluginDefinitionMap certificate_providers_;
   XdsHttpFilterRegistry http_filter_registry_;
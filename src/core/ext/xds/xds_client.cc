@@ -39,6 +39,7 @@
 #include "src/core/ext/xds/xds_api.h"
 #include "src/core/ext/xds/xds_bootstrap.h"
 #include "src/core/ext/xds/xds_client_stats.h"
+#include "src/core/ext/xds/xds_resource_cache.h"
 #include "src/core/lib/backoff/backoff.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
@@ -149,9 +150,13 @@ class XdsClient::ChannelState::AdsCallState
 
     void ParseResource(upb_Arena* arena, size_t idx, absl::string_view type_url,
                        absl::string_view resource_name,
+                       absl::string_view resource_version,
                        absl::string_view serialized_resource) override
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
+    void ResourceRemoved(absl::string_view resource_name) override
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
     void ResourceWrapperParsingFailed(size_t idx) override;
 
     Result TakeResult() { return std::move(result_); }
@@ -159,6 +164,11 @@ class XdsClient::ChannelState::AdsCallState
    private:
     XdsClient* xds_client() const { return ads_call_state_->xds_client(); }
 
+    // Returns the state of the resource in the cache, or null if there
+    // is no subscription for it.
+    ResourceState* FindResourceState(const XdsResourceName& name)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
     AdsCallState* ads_call_state_;
     const Timestamp update_time_ = Timestamp::Now();
     Result result_;
@@ -221,10 +231,16 @@ class XdsClient::ChannelState::AdsCallState
       // ADS stream restart).  If so, we don't start the timer, because
       // (a) we already have the resource and (b) the server may
       // optimize by not resending the resource that we already have.
+      // A resource from the on-disk cache still needs the timer, in case
+      // it was deleted while we were not running, unless we are using the
+      // delta protocol, in which the server reports such deletions.
       auto& authority_state =
           ads_calld->xds_client()->authority_state_map_[name_.authority];
       ResourceState& state = authority_state.resource_map[type_][name_.key];
-      if (state.resource != nullptr) return;
+      if (state.resource != nullptr &&
+          (!state.from_resource_cache || ads_calld->UseDeltaProtocol())) {
+        return;
+      }
       // Start timer.
       ads_calld_ = std::move(ads_calld);
       timer_handle_ = ads_calld_->xds_client()->engine()->RunAfter(
@@ -255,7 +271,15 @@ class XdsClient::ChannelState::AdsCallState
         auto& authority_state =
             ads_calld_->xds_client()->authority_state_map_[name_.authority];
         ResourceState& state = authority_state.resource_map[type_][name_.key];
+        // A resource from the on-disk cache may have been deleted while we
+        // were not running.
+        if (state.from_resource_cache) {
+          state.resource.reset();
+          state.from_resource_cache = false;
+          ads_calld_->xds_client()->MaybeScheduleResourceCacheWriteLocked();
+        }
         state.meta.client_status = XdsApi::ResourceMetadata::DOES_NOT_EXIST;
+        state.client_config_entry.reset();
         ads_calld_->xds_client()->NotifyWatchersOnResourceDoesNotExist(
             state.watchers);
       }
@@ -305,10 +329,29 @@ class XdsClient::ChannelState::AdsCallState
     std::map<std::string /*authority*/,
              std::map<XdsResourceKey, OrphanablePtr<ResourceTimer>>>
         subscribed_resources;
+
+    // Delta protocol only: full names of the resources whose subscription
+    // changed since the last request, and whether a request for this type
+    // has been sent on the stream.
+    std::set<std::string> pending_subscribe;
+    std::set<std::string> pending_unsubscribe;
+    bool sent_delta_request = false;
   };
 
+  bool UseDeltaProtocol() const { return chand()->server_.UseDeltaProtocol(); }
+
   void SendMessageLocked(const XdsResourceType* type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  void SendDeltaMessageLocked(const XdsResourceType* type,
+                              ResourceTypeState* state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
+  // Handles the server reporting that a resource does not exist.
+  void ResourceDoesNotExistLocked(const std::string& type_url,
+                                  const std::string& authority,
+                                  const XdsResourceKey& resource_key,
+                                  ResourceState* resource_state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
   void OnRequestSent(bool ok);
   void OnRecvMessage(absl::string_view payload);
@@ -734,9 +777,31 @@ void UpdateResourceMetadataNacked(const std::string& version,
 
 }  // namespace
 
+XdsClient::ResourceState*
+XdsClient::ChannelState::AdsCallState::AdsResponseParser::FindResourceState(
+    const XdsResourceName& name) {
+  // Lookup the authority in the cache.
+  auto authority_it = xds_client()->authority_state_map_.find(name.authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) return nullptr;
+  // Found authority, so look up type.
+  AuthorityState& authority_state = authority_it->second;
+  auto type_it = authority_state.resource_map.find(result_.type);
+  if (type_it == authority_state.resource_map.end()) return nullptr;
+  auto& type_map = type_it->second;
+  // Found type, so look up resource key.
+  auto it = type_map.find(name.key);
+  if (it == type_map.end()) return nullptr;
+  return &it->second;
+}
+
 void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
     upb_Arena* arena, size_t idx, absl::string_view type_url,
-    absl::string_view resource_name, absl::string_view serialized_resource) {
+    absl::string_view resource_name, absl::string_view resource_version,
+    absl::string_view serialized_resource) {
+  // In delta responses each resource has its own version.
+  const absl::string_view version =
+      resource_version.empty() ? absl::string_view(result_.version)
+                               : resource_version;
   std::string error_prefix = absl::StrCat(
       "resource index ", idx, ": ",
       resource_name.empty() ? "" : absl::StrCat(resource_name, ": "));
@@ -747,40 +812,68 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
                      "\" (should be \"", result_.type_url, "\")"));
     return;
   }
-  // Parse the resource.
-  XdsResourceType::DecodeContext context = {
-      xds_client(), ads_call_state_->chand()->server_, &grpc_xds_client_trace,
-      xds_client()->symtab_.ptr(), arena};
-  XdsResourceType::DecodeResult decode_result =
-      result_.type->Decode(context, serialized_resource);
-  // If we didn't already have the resource name from the Resource
-  // wrapper, try to get it from the decoding result.
-  if (resource_name.empty()) {
-    if (decode_result.name.has_value()) {
-      resource_name = *decode_result.name;
-      error_prefix =
-          absl::StrCat("resource index ", idx, ": ", resource_name, ": ");
-    } else {
-      // We don't have any way of determining the resource name, so
-      // there's nothing more we can do here.
-      result_.errors.emplace_back(absl::StrCat(
-          error_prefix, decode_result.resource.status().ToString()));
-      return;
+  // If the Resource wrapper gave us the name, look up the resource before
+  // decoding it, so that we don't pay to decode resources that nobody has
+  // subscribed to or that have not changed.
+  absl::optional<XdsResourceName> parsed_resource_name;
+  ResourceState* resource_state = nullptr;
+  if (!resource_name.empty()) {
+    auto name = xds_client()->ParseXdsResourceName(resource_name, result_.type);
+    if (name.ok()) {
+      resource_state = FindResourceState(*name);
+      if (resource_state == nullptr) {
+        // Skip resource -- we don't have a subscription for it.  Keep the
+        // serialized bytes in case it is watched later.
+        xds_client()->MaybeSaveUnwatchedResourceLocked(
+            result_.type, *name, version, serialized_resource);
+        return;
+      }
+      parsed_resource_name = std::move(*name);
+    }
+  }
+  const bool unchanged =
+      resource_state != nullptr && resource_state->resource != nullptr &&
+      resource_state->meta.serialized_proto == serialized_resource;
+  XdsResourceType::DecodeResult decode_result;
+  if (!unchanged) {
+    // Parse the resource.
+    XdsResourceType::DecodeContext context = {
+        xds_client(), ads_call_state_->chand()->server_,
+        &grpc_xds_client_trace, xds_client()->symtab_.ptr(), arena};
+    decode_result = result_.type->Decode(context, serialized_resource);
+    // If we didn't already have the resource name from the Resource
+    // wrapper, try to get it from the decoding result.
+    if (resource_name.empty()) {
+      if (decode_result.name.has_value()) {
+        resource_name = *decode_result.name;
+        error_prefix =
+            absl::StrCat("resource index ", idx, ": ", resource_name, ": ");
+      } else {
+        // We don't have any way of determining the resource name, so
+        // there's nothing more we can do here.
+        result_.errors.emplace_back(absl::StrCat(
+            error_prefix, decode_result.resource.status().ToString()));
+        return;
+      }
     }
   }
   // If decoding failed, make sure we include the error in the NACK.
-  const absl::Status& decode_status = decode_result.resource.status();
+  const absl::Status decode_status =
+      unchanged ? absl::OkStatus() : decode_result.resource.status();
   if (!decode_status.ok()) {
     result_.errors.emplace_back(
         absl::StrCat(error_prefix, decode_status.ToString()));
   }
   // Check the resource name.
-  auto parsed_resource_name =
-      xds_client()->ParseXdsResourceName(resource_name, result_.type);
-  if (!parsed_resource_name.ok()) {
-    result_.errors.emplace_back(
-        absl::StrCat(error_prefix, "Cannot parse xDS resource name"));
-    return;
+  if (!parsed_resource_name.has_value()) {
+    auto name = xds_client()->ParseXdsResourceName(resource_name, result_.type);
+    if (!name.ok()) {
+      result_.errors.emplace_back(
+          absl::StrCat(error_prefix, "Cannot parse xDS resource name"));
+      return;
+    }
+    parsed_resource_name = std::move(*name);
+    resource_state = FindResourceState(*parsed_resource_name);
   }
   // Cancel resource-does-not-exist timer, if needed.
   auto timer_it = ads_call_state_->state_map_.find(result_.type);
@@ -794,25 +887,14 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
       }
     }
   }
-  // Lookup the authority in the cache.
-  auto authority_it =
-      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
-  if (authority_it == xds_client()->authority_state_map_.end()) {
-    return;  // Skip resource -- we don't have a subscription for it.
-  }
-  // Found authority, so look up type.
-  AuthorityState& authority_state = authority_it->second;
-  auto type_it = authority_state.resource_map.find(result_.type);
-  if (type_it == authority_state.resource_map.end()) {
-    return;  // Skip resource -- we don't have a subscription for it.
-  }
-  auto& type_map = type_it->second;
-  // Found type, so look up resource key.
-  auto it = type_map.find(parsed_resource_name->key);
-  if (it == type_map.end()) {
-    return;  // Skip resource -- we don't have a subscription for it.
+  if (resource_state == nullptr) {
+    // Skip resource -- we don't have a subscription for it.
+    if (decode_status.ok()) {
+      xds_client()->MaybeSaveUnwatchedResourceLocked(
+          result_.type, *parsed_resource_name, version, serialized_resource);
+    }
+    return;
   }
-  ResourceState& resource_state = it->second;
   // If needed, record that we've seen this resource.
   if (result_.type->AllResourcesRequiredInSotW()) {
     result_.resources_seen[parsed_resource_name->authority].insert(
@@ -820,7 +902,7 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
   }
   // If we previously ignored the resource's deletion, log that we're
   // now re-adding it.
-  if (resource_state.ignored_deletion) {
+  if (resource_state->ignored_deletion) {
     gpr_log(GPR_INFO,
             "[xds_client %p] xds server %s: server returned new version of "
             "resource for which we previously ignored a deletion: type %s "
@@ -828,24 +910,27 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
             xds_client(),
             ads_call_state_->chand()->server_.server_uri().c_str(),
             std::string(type_url).c_str(), std::string(resource_name).c_str());
-    resource_state.ignored_deletion = false;
+    resource_state->ignored_deletion = false;
   }
   // Update resource state based on whether the resource is valid.
   if (!decode_status.ok()) {
     xds_client()->NotifyWatchersOnErrorLocked(
-        resource_state.watchers,
+        resource_state->watchers,
         absl::UnavailableError(
             absl::StrCat("invalid resource: ", decode_status.ToString())));
-    UpdateResourceMetadataNacked(result_.version, decode_status.ToString(),
-                                 update_time_, &resource_state.meta);
+    UpdateResourceMetadataNacked(std::string(version), decode_status.ToString(),
+                                 update_time_, &resource_state->meta);
+    resource_state->client_config_entry.reset();
     return;
   }
   // Resource is valid.
   result_.have_valid_resources = true;
+  resource_state->from_resource_cache = false;
   // If it didn't change, ignore it.
-  if (resource_state.resource != nullptr &&
-      result_.type->ResourcesEqual(resource_state.resource.get(),
-                                   decode_result.resource->get())) {
+  if (unchanged ||
+      (resource_state->resource != nullptr &&
+       result_.type->ResourcesEqual(resource_state->resource.get(),
+                                    decode_result.resource->get()))) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
       gpr_log(GPR_INFO,
               "[xds_client %p] %s resource %s identical to current, ignoring.",
@@ -855,13 +940,15 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
     return;
   }
   // Update the resource state.
-  resource_state.resource = std::move(*decode_result.resource);
-  resource_state.meta = CreateResourceMetadataAcked(
-      std::string(serialized_resource), result_.version, update_time_);
+  resource_state->resource = std::move(*decode_result.resource);
+  resource_state->meta = CreateResourceMetadataAcked(
+      std::string(serialized_resource), std::string(version), update_time_);
+  resource_state->client_config_entry.reset();
+  xds_client()->MaybeScheduleResourceCacheWriteLocked();
   // Notify watchers.
-  auto& watchers_list = resource_state.watchers;
+  auto& watchers_list = resource_state->watchers;
   auto* value =
-      result_.type->CopyResource(resource_state.resource.get()).release();
+      result_.type->CopyResource(resource_state->resource.get()).release();
   xds_client()->work_serializer_.Schedule(
       [watchers_list, value]()
           ABSL_EXCLUSIVE_LOCKS_REQUIRED(&xds_client()->work_serializer_) {
@@ -873,6 +960,38 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
       DEBUG_LOCATION);
 }
 
+void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ResourceRemoved(
+    absl::string_view resource_name) {
+  auto parsed_resource_name =
+      xds_client()->ParseXdsResourceName(resource_name, result_.type);
+  if (!parsed_resource_name.ok()) return;
+  // Cancel resource-does-not-exist timer, if needed.
+  auto timer_it = ads_call_state_->state_map_.find(result_.type);
+  if (timer_it != ads_call_state_->state_map_.end()) {
+    auto it = timer_it->second.subscribed_resources.find(
+        parsed_resource_name->authority);
+    if (it != timer_it->second.subscribed_resources.end()) {
+      auto res_it = it->second.find(parsed_resource_name->key);
+      if (res_it != it->second.end()) {
+        res_it->second->MarkSeen();
+      }
+    }
+  }
+  // Look up the resource in the cache.
+  auto authority_it =
+      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) return;
+  auto type_it = authority_it->second.resource_map.find(result_.type);
+  if (type_it == authority_it->second.resource_map.end()) return;
+  auto it = type_it->second.find(parsed_resource_name->key);
+  if (it == type_it->second.end()) return;
+  // Unlike a resource missing from a SotW response, an explicit removal
+  // is authoritative even if we have never received the resource.
+  ads_call_state_->ResourceDoesNotExistLocked(
+      result_.type_url, parsed_resource_name->authority,
+      parsed_resource_name->key, &it->second);
+}
+
 void XdsClient::ChannelState::AdsCallState::AdsResponseParser::
     ResourceWrapperParsingFailed(size_t idx) {
   result_.errors.emplace_back(absl::StrCat(
@@ -893,8 +1012,11 @@ XdsClient::ChannelState::AdsCallState::AdsCallState(
   GPR_ASSERT(xds_client() != nullptr);
   // Init the ADS call.
   const char* method =
-      "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
-      "StreamAggregatedResources";
+      UseDeltaProtocol()
+          ? "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "DeltaAggregatedResources"
+          : "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "StreamAggregatedResources";
   call_ = chand()->transport_->CreateStreamingCall(
       method, std::make_unique<StreamEventHandler>(
                   // Passing the initial ref here.  This ref will go away when
@@ -946,6 +1068,10 @@ void XdsClient::ChannelState::AdsCallState::SendMessageLocked(
     return;
   }
   auto& state = state_map_[type];
+  if (UseDeltaProtocol()) {
+    SendDeltaMessageLocked(type, &state);
+    return;
+  }
   std::string serialized_message = xds_client()->api_.CreateAdsRequest(
       type->type_url(), chand()->resource_type_version_map_[type], state.nonce,
       ResourceNamesForRequest(type), state.status, !sent_initial_message_);
@@ -964,11 +1090,100 @@ void XdsClient::ChannelState::AdsCallState::SendMessageLocked(
   send_message_pending_ = type;
 }
 
+void XdsClient::ChannelState::AdsCallState::SendDeltaMessageLocked(
+    const XdsResourceType* type, ResourceTypeState* state) {
+  // On the first request for this type, tell the server which versions
+  // we have cached from a previous stream, so that it need not resend
+  // resources that have not changed.
+  std::map<std::string, std::string> initial_resource_versions;
+  if (!state->sent_delta_request) {
+    for (const auto& a : xds_client()->authority_state_map_) {
+      if (a.second.channel_state != chand()) continue;
+      auto type_it = a.second.resource_map.find(type);
+      if (type_it == a.second.resource_map.end()) continue;
+      for (const auto& r : type_it->second) {
+        const ResourceState& resource_state = r.second;
+        if (resource_state.resource == nullptr ||
+            resource_state.meta.version.empty()) {
+          continue;
+        }
+        initial_resource_versions.emplace(
+            XdsClient::ConstructFullXdsResourceName(a.first, type->type_url(),
+                                                    r.first),
+            resource_state.meta.version);
+      }
+    }
+  }
+  // Mark the subscriptions as sent, so that the does-not-exist timers
+  // start once the send completes.
+  ResourceNamesForRequest(type);
+  std::string serialized_message = xds_client()->api_.CreateDeltaAdsRequest(
+      type->type_url(), state->nonce,
+      std::vector<std::string>(state->pending_subscribe.begin(),
+                               state->pending_subscribe.end()),
+      std::vector<std::string>(state->pending_unsubscribe.begin(),
+                               state->pending_unsubscribe.end()),
+      initial_resource_versions, state->status, !sent_initial_message_);
+  sent_initial_message_ = true;
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+    gpr_log(GPR_INFO,
+            "[xds_client %p] xds server %s: sending delta ADS request: type=%s "
+            "subscribe=%" PRIuPTR " unsubscribe=%" PRIuPTR
+            " initial_versions=%" PRIuPTR " nonce=%s error=%s",
+            xds_client(), chand()->server_.server_uri().c_str(),
+            std::string(type->type_url()).c_str(),
+            state->pending_subscribe.size(), state->pending_unsubscribe.size(),
+            initial_resource_versions.size(), state->nonce.c_str(),
+            state->status.ToString().c_str());
+  }
+  state->pending_subscribe.clear();
+  state->pending_unsubscribe.clear();
+  state->sent_delta_request = true;
+  state->status = absl::OkStatus();
+  call_->SendMessage(std::move(serialized_message));
+  send_message_pending_ = type;
+}
+
+void XdsClient::ChannelState::AdsCallState::ResourceDoesNotExistLocked(
+    const std::string& type_url, const std::string& authority,
+    const XdsResourceKey& resource_key, ResourceState* resource_state) {
+  if (resource_state->resource != nullptr &&
+      chand()->server_.IgnoreResourceDeletion()) {
+    if (!resource_state->ignored_deletion) {
+      gpr_log(GPR_ERROR,
+              "[xds_client %p] xds server %s: ignoring deletion "
+              "for resource type %s name %s",
+              xds_client(), chand()->server_.server_uri().c_str(),
+              type_url.c_str(),
+              XdsClient::ConstructFullXdsResourceName(
+                  authority, type_url.c_str(), resource_key)
+                  .c_str());
+      resource_state->ignored_deletion = true;
+    }
+    return;
+  }
+  if (resource_state->resource != nullptr) {
+    resource_state->resource.reset();
+    resource_state->from_resource_cache = false;
+    xds_client()->MaybeScheduleResourceCacheWriteLocked();
+  }
+  resource_state->meta.client_status = XdsApi::ResourceMetadata::DOES_NOT_EXIST;
+  resource_state->client_config_entry.reset();
+  xds_client()->NotifyWatchersOnResourceDoesNotExist(resource_state->watchers);
+}
+
 void XdsClient::ChannelState::AdsCallState::SubscribeLocked(
     const XdsResourceType* type, const XdsResourceName& name, bool delay_send) {
-  auto& state = state_map_[type].subscribed_resources[name.authority][name.key];
+  auto& type_state = state_map_[type];
+  auto& state = type_state.subscribed_resources[name.authority][name.key];
   if (state == nullptr) {
     state = MakeOrphanable<ResourceTimer>(type, name);
+    if (UseDeltaProtocol()) {
+      std::string full_name = XdsClient::ConstructFullXdsResourceName(
+          name.authority, type->type_url(), name.key);
+      type_state.pending_unsubscribe.erase(full_name);
+      type_state.pending_subscribe.insert(std::move(full_name));
+    }
     if (!delay_send) SendMessageLocked(type);
   }
 }
@@ -982,6 +1197,12 @@ void XdsClient::ChannelState::AdsCallState::UnsubscribeLocked(
   if (authority_map.empty()) {
     type_state_map.subscribed_resources.erase(name.authority);
   }
+  if (UseDeltaProtocol()) {
+    std::string full_name = XdsClient::ConstructFullXdsResourceName(
+        name.authority, type->type_url(), name.key);
+    type_state_map.pending_subscribe.erase(full_name);
+    type_state_map.pending_unsubscribe.insert(std::move(full_name));
+  }
   // Don't need to send unsubscription message if this was the last
   // resource we were subscribed to, since we'll be closing the stream
   // immediately in that case.
@@ -1036,7 +1257,10 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
     if (!IsCurrentCallOnChannel()) return;
     // Parse and validate the response.
     AdsResponseParser parser(this);
-    absl::Status status = xds_client()->api_.ParseAdsResponse(payload, &parser);
+    absl::Status status =
+        UseDeltaProtocol()
+            ? xds_client()->api_.ParseDeltaAdsResponse(payload, &parser)
+            : xds_client()->api_.ParseAdsResponse(payload, &parser);
     if (!status.ok()) {
       // Ignore unparsable response.
       gpr_log(GPR_ERROR,
@@ -1064,8 +1288,9 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
                 result.type_url.c_str(), result.version.c_str(),
                 state.nonce.c_str(), state.status.ToString().c_str());
       }
-      // Delete resources not seen in update if needed.
-      if (result.type->AllResourcesRequiredInSotW()) {
+      // Delete resources not seen in update if needed.  Delta responses
+      // list removals explicitly instead.
+      if (!UseDeltaProtocol() && result.type->AllResourcesRequiredInSotW()) {
         for (auto& a : xds_client()->authority_state_map_) {
           const std::string& authority = a.first;
           AuthorityState& authority_state = a.second;
@@ -1090,25 +1315,8 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
               // that the resource does not exist.  For that case, we rely on
               // the request timeout instead.
               if (resource_state.resource == nullptr) continue;
-              if (chand()->server_.IgnoreResourceDeletion()) {
-                if (!resource_state.ignored_deletion) {
-                  gpr_log(GPR_ERROR,
-                          "[xds_client %p] xds server %s: ignoring deletion "
-                          "for resource type %s name %s",
-                          xds_client(), chand()->server_.server_uri().c_str(),
-                          result.type_url.c_str(),
-                          XdsClient::ConstructFullXdsResourceName(
-                              authority, result.type_url.c_str(), resource_key)
-                              .c_str());
-                  resource_state.ignored_deletion = true;
-                }
-              } else {
-                resource_state.resource.reset();
-                resource_state.meta.client_status =
-                    XdsApi::ResourceMetadata::DOES_NOT_EXIST;
-                xds_client()->NotifyWatchersOnResourceDoesNotExist(
-                    resource_state.watchers);
-              }
+              ResourceDoesNotExistLocked(result.type_url, authority,
+                                         resource_key, &resource_state);
             }
           }
         }
@@ -1489,6 +1697,22 @@ XdsClient::XdsClient(
     gpr_log(GPR_INFO, "[xds_client %p] xDS node ID: %s", this,
             bootstrap_->node()->id().c_str());
   }
+  if (!bootstrap_->resource_cache_path().empty()) {
+    auto entries = XdsResourceCache::Read(bootstrap_->resource_cache_path());
+    if (entries.ok()) {
+      gpr_log(GPR_INFO,
+              "[xds_client %p] read %" PRIuPTR
+              " resources from xDS resource cache %s",
+              this, entries->size(),
+              bootstrap_->resource_cache_path().c_str());
+      MutexLock lock(&mu_);
+      resource_cache_entries_ = std::move(*entries);
+    } else {
+      gpr_log(GPR_INFO, "[xds_client %p] not using xDS resource cache %s: %s",
+              this, bootstrap_->resource_cache_path().c_str(),
+              entries.status().ToString().c_str());
+    }
+  }
 }
 
 XdsClient::~XdsClient() {
@@ -1503,6 +1727,10 @@ void XdsClient::Orphan() {
   }
   MutexLock lock(&mu_);
   shutting_down_ = true;
+  if (resource_cache_write_timer_.has_value()) {
+    engine_->Cancel(*resource_cache_write_timer_);
+    resource_cache_write_timer_.reset();
+  }
   // Clear cache and any remaining watchers that may not have been cancelled.
   authority_state_map_.clear();
   invalid_watchers_.clear();
@@ -1517,17 +1745,119 @@ void XdsClient::Orphan() {
 
 RefCountedPtr<XdsClient::ChannelState> XdsClient::GetOrCreateChannelStateLocked(
     const XdsBootstrap::XdsServer& server, const char* reason) {
-  auto it = xds_server_channel_map_.find(&server);
+  // Authorities often list the same xDS server as the top-level config or
+  // as each other. Key the channel on the first equal server in the
+  // bootstrap config, so that they all share one channel and ADS stream,
+  // with their subscriptions multiplexed on it.
+  const XdsBootstrap::XdsServer* canonical_server =
+      bootstrap_->FindXdsServer(server);
+  if (canonical_server == nullptr) canonical_server = &server;
+  auto it = xds_server_channel_map_.find(canonical_server);
   if (it != xds_server_channel_map_.end()) {
     return it->second->Ref(DEBUG_LOCATION, reason);
   }
   // Channel not found, so create a new one.
   auto channel_state = MakeRefCounted<ChannelState>(
-      WeakRef(DEBUG_LOCATION, "ChannelState"), server);
-  xds_server_channel_map_[&server] = channel_state.get();
+      WeakRef(DEBUG_LOCATION, "ChannelState"), *canonical_server);
+  xds_server_channel_map_[canonical_server] = channel_state.get();
   return channel_state;
 }
 
+void XdsClient::MaybeLoadResourceFromCacheLocked(
+    const XdsResourceType* type, const XdsBootstrap::XdsServer& xds_server,
+    const std::string& name, ResourceState* resource_state) {
+  auto it = resource_cache_entries_.find(
+      std::make_pair(std::string(type->type_url()), name));
+  if (it == resource_cache_entries_.end()) return;
+  XdsResourceCache::Entry entry = std::move(it->second);
+  resource_cache_entries_.erase(it);
+  upb::Arena arena;
+  XdsResourceType::DecodeContext context = {
+      this, xds_server, &grpc_xds_client_trace, symtab_.ptr(), arena.ptr()};
+  XdsResourceType::DecodeResult decode_result =
+      type->Decode(context, entry.serialized_resource);
+  if (!decode_result.resource.ok()) {
+    gpr_log(GPR_INFO,
+            "[xds_client %p] ignoring invalid cached resource %s: %s", this,
+            name.c_str(), decode_result.resource.status().ToString().c_str());
+    return;
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+    gpr_log(GPR_INFO,
+            "[xds_client %p] using version %s of %s from xDS resource cache",
+            this, entry.version.c_str(), name.c_str());
+  }
+  resource_state->resource = std::move(*decode_result.resource);
+  resource_state->meta = CreateResourceMetadataAcked(
+      std::move(entry.serialized_resource), std::move(entry.version),
+      Timestamp::Now());
+  resource_state->client_config_entry.reset();
+  resource_state->from_resource_cache = true;
+}
+
+void XdsClient::MaybeSaveUnwatchedResourceLocked(
+    const XdsResourceType* type, const XdsResourceName& name,
+    absl::string_view version, absl::string_view serialized_resource) {
+  XdsResourceCache::Entry& entry =
+      resource_cache_entries_[std::make_pair(
+          std::string(type->type_url()),
+          ConstructFullXdsResourceName(name.authority, type->type_url(),
+                                       name.key))];
+  if (entry.serialized_resource == serialized_resource) return;
+  entry.version = std::string(version);
+  entry.serialized_resource = std::string(serialized_resource);
+  MaybeScheduleResourceCacheWriteLocked();
+}
+
+void XdsClient::MaybeScheduleResourceCacheWriteLocked() {
+  if (bootstrap_->resource_cache_path().empty() || shutting_down_ ||
+      resource_cache_write_timer_.has_value()) {
+    return;
+  }
+  // Batch the updates of a burst of responses into one write.
+  resource_cache_write_timer_ = engine_->RunAfter(
+      Duration::Seconds(1),
+      [self = WeakRef(DEBUG_LOCATION, "ResourceCacheWrite")]() {
+        ApplicationCallbackExecCtx callback_exec_ctx;
+        ExecCtx exec_ctx;
+        self->WriteResourceCache();
+      });
+}
+
+void XdsClient::WriteResourceCache() {
+  MutexLock write_lock(&resource_cache_write_mu_);
+  XdsResourceCache::EntryMap entries;
+  {
+    MutexLock lock(&mu_);
+    resource_cache_write_timer_.reset();
+    if (shutting_down_) return;
+    // Keep the cached resources that have not been watched yet, so that
+    // they are still available after the next restart.
+    entries = resource_cache_entries_;
+    for (const auto& a : authority_state_map_) {
+      for (const auto& t : a.second.resource_map) {
+        const XdsResourceType* type = t.first;
+        for (const auto& r : t.second) {
+          const ResourceState& resource_state = r.second;
+          if (resource_state.resource == nullptr) continue;
+          entries[std::make_pair(
+              std::string(type->type_url()),
+              ConstructFullXdsResourceName(a.first, type->type_url(),
+                                           r.first))] = {
+              resource_state.meta.version,
+              resource_state.meta.serialized_proto};
+        }
+      }
+    }
+  }
+  absl::Status status =
+      XdsResourceCache::Write(bootstrap_->resource_cache_path(), entries);
+  if (!status.ok()) {
+    gpr_log(GPR_ERROR, "[xds_client %p] failed to write xDS resource cache: %s",
+            this, status.ToString().c_str());
+  }
+}
+
 void XdsClient::WatchResource(const XdsResourceType* type,
                               absl::string_view name,
                               RefCountedPtr<ResourceWatcherInterface> watcher) {
@@ -1574,6 +1904,17 @@ void XdsClient::WatchResource(const XdsResourceType* type,
     ResourceState& resource_state =
         authority_state.resource_map[type][resource_name->key];
     resource_state.watchers[w] = watcher;
+    // On the first watch, fall back to the resource cache until the server
+    // responds.
+    if (resource_state.resource == nullptr &&
+        resource_state.meta.client_status ==
+            XdsApi::ResourceMetadata::REQUESTED) {
+      MaybeLoadResourceFromCacheLocked(
+          type, *xds_server,
+          ConstructFullXdsResourceName(resource_name->authority,
+                                       type->type_url(), resource_name->key),
+          &resource_state);
+    }
     // If we already have a cached value for the resource, notify the new
     // watcher immediately.
     if (resource_state.resource != nullptr) {
@@ -2022,24 +2363,43 @@ XdsApi::ClusterLoadReportMap XdsClient::BuildLoadReportSnapshotLocked(
 }
 
 std::string XdsClient::DumpClientConfigBinary() {
-  MutexLock lock(&mu_);
-  XdsApi::ResourceTypeMetadataMap resource_type_metadata_map;
-  for (const auto& a : authority_state_map_) {  // authority
-    const std::string& authority = a.first;
-    for (const auto& t : a.second.resource_map) {  // type
-      const XdsResourceType* type = t.first;
-      auto& resource_metadata_map =
-          resource_type_metadata_map[type->type_url()];
-      for (const auto& r : t.second) {  // resource id
-        const XdsResourceKey& resource_key = r.first;
-        const ResourceState& resource_state = r.second;
-        resource_metadata_map[ConstructFullXdsResourceName(
-            authority, type->type_url(), resource_key)] = &resource_state.meta;
+  std::string node;
+  std::vector<std::shared_ptr<const std::string>> entries;
+  {
+    MutexLock lock(&mu_);
+    if (client_config_node_.empty()) {
+      client_config_node_ = api_.AssembleClientConfigNode();
+    }
+    node = client_config_node_;
+    for (auto& a : authority_state_map_) {  // authority
+      const std::string& authority = a.first;
+      for (auto& t : a.second.resource_map) {  // type
+        const XdsResourceType* type = t.first;
+        for (auto& r : t.second) {  // resource id
+          const XdsResourceKey& resource_key = r.first;
+          ResourceState& resource_state = r.second;
+          if (resource_state.client_config_entry == nullptr) {
+            resource_state.client_config_entry =
+                std::make_shared<const std::string>(
+                    api_.AssembleClientConfigEntry(
+                        type->type_url(),
+                        ConstructFullXdsResourceName(
+                            authority, type->type_url(), resource_key),
+                        resource_state.meta));
+          }
+          entries.push_back(resource_state.client_config_entry);
+        }
       }
     }
   }
-  // Assemble config dump messages
-  return api_.AssembleClientConfig(resource_type_metadata_map);
+  // Assemble the config dump outside of the lock.
+  size_t length = node.size();
+  for (const auto& entry : entries) length += entry->size();
+  std::string dump;
+  dump.reserve(length);
+  dump.append(node);
+  for (const auto& entry : entries) dump.append(*entry);
+  return dump;
 }
 
 }  // namespace grpc_core
@@ -30,6 +30,7 @@
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 #include "upb/def.hpp"
 
 #include <grpc/event_engine/event_engine.h>
@@ -37,6 +38,7 @@
 #include "src/core/ext/xds/xds_api.h"
 #include "src/core/ext/xds/xds_bootstrap.h"
 #include "src/core/ext/xds/xds_client_stats.h"
+#include "src/core/ext/xds/xds_resource_cache.h"
 #include "src/core/ext/xds/xds_resource_type.h"
 #include "src/core/ext/xds/xds_transport.h"
 #include "src/core/lib/debug/trace.h"
@@ -145,7 +147,8 @@ class XdsClient : public DualRefCounted<XdsClient> {
   // status (e.g., CLIENT_REQUESTED, CLIENT_ACKED, CLIENT_NACKED).
   //
   // Expected to be invoked by wrapper languages in their CSDS service
-  // implementation.
+  // implementation. Each resource is serialized once per change and reused
+  // by later dumps, so the lock is only held to collect the entries.
   std::string DumpClientConfigBinary();
 
   grpc_event_engine::experimental::EventEngine* engine() {
@@ -240,7 +243,13 @@ class XdsClient : public DualRefCounted<XdsClient> {
     // The latest data seen for the resource.
     std::unique_ptr<XdsResourceType::ResourceData> resource;
     XdsApi::ResourceMetadata meta;
+    // meta, serialized for CSDS by the last config dump. Reset whenever meta
+    // changes, so that the next dump serializes it again.
+    std::shared_ptr<const std::string> client_config_entry;
     bool ignored_deletion = false;
+    // True if resource came from the on-disk cache and the server has not
+    // yet confirmed it.
+    bool from_resource_cache = false;
   };
 
   struct AuthorityState {
@@ -304,6 +313,26 @@ class XdsClient : public DualRefCounted<XdsClient> {
       const XdsBootstrap::XdsServer& server, const char* reason)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  // Populates resource_state from the resource cache, if the cache has a
+  // valid copy of the resource.
+  void MaybeLoadResourceFromCacheLocked(
+      const XdsResourceType* type, const XdsBootstrap::XdsServer& xds_server,
+      const std::string& name, ResourceState* resource_state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Stores the serialized form of a resource that the server sent but
+  // that nobody is watching, so that it is only decoded if a watch for it
+  // is started.
+  void MaybeSaveUnwatchedResourceLocked(const XdsResourceType* type,
+                                        const XdsResourceName& name,
+                                        absl::string_view version,
+                                        absl::string_view serialized_resource)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Arranges for the on-disk resource cache to be rewritten soon, if
+  // it is enabled.
+  void MaybeScheduleResourceCacheWriteLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void WriteResourceCache();
+
   std::unique_ptr<XdsBootstrap> bootstrap_;
   OrphanablePtr<XdsTransportFactory> transport_factory_;
   const Duration request_timeout_;
@@ -326,6 +355,8 @@ class XdsClient : public DualRefCounted<XdsClient> {
 
   std::map<std::string /*authority*/, AuthorityState> authority_state_map_
       ABSL_GUARDED_BY(mu_);
+  // The node part of the CSDS config dump, which does not change.
+  std::string client_config_node_ ABSL_GUARDED_BY(mu_);
 
   // Key is owned by the bootstrap config.
   std::map<const XdsBootstrap::XdsServer*, LoadReportServer>
@@ -336,6 +367,15 @@ class XdsClient : public DualRefCounted<XdsClient> {
   std::map<ResourceWatcherInterface*, RefCountedPtr<ResourceWatcherInterface>>
       invalid_watchers_ ABSL_GUARDED_BY(mu_);
 
+  // Resources that have not been watched yet, read from the on-disk cache
+  // or sent by the server without a subscription.  They are decoded only
+  // when a watch is started.
+  XdsResourceCache::EntryMap resource_cache_entries_ ABSL_GUARDED_BY(mu_);
+  absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      resource_cache_write_timer_ ABSL_GUARDED_BY(mu_);
+  // Serializes writes of the cache file.
+  Mutex resource_cache_write_mu_ ABSL_ACQUIRED_BEFORE(mu_);
+
   bool shutting_down_ ABSL_GUARDED_BY(mu_) = false;
 };
 
@@ -74,14 +74,18 @@ XdsClusterDropStats::~XdsClusterDropStats() {
 
 XdsClusterDropStats::Snapshot XdsClusterDropStats::GetSnapshotAndReset() {
   Snapshot snapshot;
-  snapshot.uncategorized_drops = GetAndResetCounter(&uncategorized_drops_);
+  for (DropCounter& counter : uncategorized_drops_) {
+    snapshot.uncategorized_drops +=
+        GetAndResetCounter(&counter.uncategorized_drops);
+  }
   MutexLock lock(&mu_);
   snapshot.categorized_drops = std::move(categorized_drops_);
   return snapshot;
 }
 
 void XdsClusterDropStats::AddUncategorizedDrops() {
-  uncategorized_drops_.fetch_add(1);
+  uncategorized_drops_.this_cpu().uncategorized_drops.fetch_add(
+      1, std::memory_order_relaxed);
 }
 
 void XdsClusterDropStats::AddCallDropped(const std::string& category) {
@@ -131,29 +135,36 @@ XdsClusterLocalityStats::~XdsClusterLocalityStats() {
 
 XdsClusterLocalityStats::Snapshot
 XdsClusterLocalityStats::GetSnapshotAndReset() {
-  Snapshot snapshot = {
-      GetAndResetCounter(&total_successful_requests_),
-      // Don't reset total_requests_in_progress because it's
-      // not related to a single reporting interval.
-      total_requests_in_progress_.load(std::memory_order_relaxed),
-      GetAndResetCounter(&total_error_requests_),
-      GetAndResetCounter(&total_issued_requests_),
-      {}};
+  Snapshot snapshot = {0, 0, 0, 0, {}};
+  for (CallCounters& counters : call_counters_) {
+    snapshot.total_successful_requests +=
+        GetAndResetCounter(&counters.total_successful_requests);
+    // Don't reset total_requests_in_progress because it's
+    // not related to a single reporting interval.
+    snapshot.total_requests_in_progress +=
+        counters.total_requests_in_progress.load(std::memory_order_relaxed);
+    snapshot.total_error_requests +=
+        GetAndResetCounter(&counters.total_error_requests);
+    snapshot.total_issued_requests +=
+        GetAndResetCounter(&counters.total_issued_requests);
+  }
   MutexLock lock(&backend_metrics_mu_);
   snapshot.backend_metrics = std::move(backend_metrics_);
   return snapshot;
 }
 
 void XdsClusterLocalityStats::AddCallStarted() {
-  total_issued_requests_.fetch_add(1, std::memory_order_relaxed);
-  total_requests_in_progress_.fetch_add(1, std::memory_order_relaxed);
+  CallCounters& counters = call_counters_.this_cpu();
+  counters.total_issued_requests.fetch_add(1, std::memory_order_relaxed);
+  counters.total_requests_in_progress.fetch_add(1, std::memory_order_relaxed);
 }
 
 void XdsClusterLocalityStats::AddCallFinished(bool fail) {
+  CallCounters& counters = call_counters_.this_cpu();
   std::atomic<uint64_t>& to_increment =
-      fail ? total_error_requests_ : total_successful_requests_;
+      fail ? counters.total_error_requests : counters.total_successful_requests;
   to_increment.fetch_add(1, std::memory_order_relaxed);
-  total_requests_in_progress_.fetch_add(-1, std::memory_order_acq_rel);
+  counters.total_requests_in_progress.fetch_add(-1, std::memory_order_acq_rel);
 }
 
 }  // namespace grpc_core
@@ -34,6 +34,7 @@
 
 #include "src/core/ext/xds/xds_bootstrap.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -147,7 +148,11 @@ class XdsClusterDropStats : public RefCounted<XdsClusterDropStats> {
   const XdsBootstrap::XdsServer& lrs_server_;
   absl::string_view cluster_name_;
   absl::string_view eds_service_name_;
-  std::atomic<uint64_t> uncategorized_drops_{0};
+  // Counted per CPU, as every dropped call updates it.
+  struct alignas(GPR_CACHELINE_SIZE) DropCounter {
+    std::atomic<uint64_t> uncategorized_drops{0};
+  };
+  PerCpu<DropCounter> uncategorized_drops_;
   // Protects categorized_drops_. A mutex is necessary because the length of
   // dropped_requests can be accessed by both the picker (from data plane
   // mutex) and the load reporting thread (from the control plane combiner).
@@ -224,10 +229,16 @@ class XdsClusterLocalityStats : public RefCounted<XdsClusterLocalityStats> {
   absl::string_view eds_service_name_;
   RefCountedPtr<XdsLocalityName> name_;
 
-  std::atomic<uint64_t> total_successful_requests_{0};
-  std::atomic<uint64_t> total_requests_in_progress_{0};
-  std::atomic<uint64_t> total_error_requests_{0};
-  std::atomic<uint64_t> total_issued_requests_{0};
+  // Counted per CPU, as every call updates them, and summed for load
+  // reports.  A call may finish on another CPU than it started on, so only
+  // the sum of total_requests_in_progress over all CPUs is meaningful.
+  struct alignas(GPR_CACHELINE_SIZE) CallCounters {
+    std::atomic<uint64_t> total_successful_requests{0};
+    std::atomic<uint64_t> total_requests_in_progress{0};
+    std::atomic<uint64_t> total_error_requests{0};
+    std::atomic<uint64_t> total_issued_requests{0};
+  };
+  PerCpu<CallCounters> call_counters_;
 
   // Protects backend_metrics_. A mutex is necessary because the length of
   // backend_metrics_ can be accessed by both the callback intercepting the
@@ -0,0 +1,153 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/xds/xds_resource_cache.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/strip.h"
+
+#include "src/core/lib/gprpp/load_file.h"
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kMagic = "gRPCxdsc";
+
+void AppendUint32(uint32_t value, std::string* out) {
+  for (int i = 0; i < 4; ++i) {
+    out->push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+void AppendString(absl::string_view value, std::string* out) {
+  AppendUint32(static_cast<uint32_t>(value.size()), out);
+  out->append(value.data(), value.size());
+}
+
+bool ConsumeUint32(absl::string_view* in, uint32_t* value) {
+  if (in->size() < 4) return false;
+  *value = 0;
+  for (int i = 0; i < 4; ++i) {
+    *value |= static_cast<uint32_t>(static_cast<uint8_t>((*in)[i])) << (8 * i);
+  }
+  in->remove_prefix(4);
+  return true;
+}
+
+bool ConsumeString(absl::string_view* in, std::string* value) {
+  uint32_t size;
+  if (!ConsumeUint32(in, &size) || in->size() < size) return false;
+  value->assign(in->data(), size);
+  in->remove_prefix(size);
+  return true;
+}
+
+}  // namespace
+
+constexpr uint32_t XdsResourceCache::kFormatVersion;
+
+std::string XdsResourceCache::Serialize(const EntryMap& entries) {
+  std::string out(kMagic);
+  AppendUint32(kFormatVersion, &out);
+  AppendUint32(static_cast<uint32_t>(entries.size()), &out);
+  for (const auto& p : entries) {
+    AppendString(p.first.first, &out);
+    AppendString(p.first.second, &out);
+    AppendString(p.second.version, &out);
+    AppendString(p.second.serialized_resource, &out);
+  }
+  return out;
+}
+
+absl::StatusOr<XdsResourceCache::EntryMap> XdsResourceCache::Parse(
+    absl::string_view contents) {
+  if (!absl::ConsumePrefix(&contents, kMagic)) {
+    return absl::InvalidArgumentError("not an xDS resource cache file");
+  }
+  uint32_t format_version;
+  uint32_t num_entries;
+  if (!ConsumeUint32(&contents, &format_version) ||
+      !ConsumeUint32(&contents, &num_entries)) {
+    return absl::InvalidArgumentError("truncated xDS resource cache header");
+  }
+  if (format_version != kFormatVersion) {
+    return absl::InvalidArgumentError(absl::StrCat(
+        "unsupported xDS resource cache format version ", format_version));
+  }
+  EntryMap entries;
+  for (uint32_t i = 0; i < num_entries; ++i) {
+    std::string type_url;
+    std::string name;
+    Entry entry;
+    if (!ConsumeString(&contents, &type_url) ||
+        !ConsumeString(&contents, &name) ||
+        !ConsumeString(&contents, &entry.version) ||
+        !ConsumeString(&contents, &entry.serialized_resource)) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("truncated xDS resource cache entry ", i));
+    }
+    entries.emplace(std::make_pair(std::move(type_url), std::move(name)),
+                    std::move(entry));
+  }
+  if (!contents.empty()) {
+    return absl::InvalidArgumentError(
+        "trailing data in xDS resource cache file");
+  }
+  return entries;
+}
+
+absl::StatusOr<XdsResourceCache::EntryMap> XdsResourceCache::Read(
+    const std::string& path) {
+  auto contents = LoadFile(path, /*add_null_terminator=*/false);
+  if (!contents.ok()) return contents.status();
+  return Parse(contents->as_string_view());
+}
+
+absl::Status XdsResourceCache::Write(const std::string& path,
+                                     const EntryMap& entries) {
+  const std::string contents = Serialize(entries);
+  const std::string tmp_path = absl::StrCat(path, ".tmp");
+  FILE* file = fopen(tmp_path.c_str(), "wb");
+  if (file == nullptr) {
+    return absl::InternalError(absl::StrCat(
+        "failed to open ", tmp_path, " for writing: ", strerror(errno)));
+  }
+  bool ok = fwrite(contents.data(), 1, contents.size(), file) ==
+            contents.size();
+  ok = (fclose(file) == 0) && ok;
+  if (!ok) {
+    remove(tmp_path.c_str());
+    return absl::InternalError(absl::StrCat("failed to write ", tmp_path));
+  }
+  if (rename(tmp_path.c_str(), path.c_str()) != 0) {
+    remove(tmp_path.c_str());
+    return absl::InternalError(absl::StrCat("failed to rename ", tmp_path,
+                                            " to ", path, ": ",
+                                            strerror(errno)));
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,75 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_XDS_XDS_RESOURCE_CACHE_H
+#define GRPC_SRC_CORE_EXT_XDS_XDS_RESOURCE_CACHE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+// An on-disk copy of the last ACKed xDS resources, so that a restarted
+// process can serve its watchers before the ADS stream is established.
+//
+// The file starts with a magic string and a format version, followed by
+// the entries.  A file with a different format version is ignored.  The
+// resources are stored in serialized form and are validated again when
+// they are used, so a stale or damaged file can at worst delay startup
+// until the server responds.
+class XdsResourceCache {
+ public:
+  struct Entry {
+    std::string version;
+    std::string serialized_resource;
+
+    bool operator==(const Entry& other) const {
+      return version == other.version &&
+             serialized_resource == other.serialized_resource;
+    }
+  };
+
+  using EntryMap =
+      std::map<std::pair<std::string /*type_url*/, std::string /*name*/>,
+               Entry>;
+
+  static constexpr uint32_t kFormatVersion = 1;
+
+  // Reads the cache file at path.
+  static absl::StatusOr<EntryMap> Read(const std::string& path);
+
+  // Replaces the cache file at path with entries.  The new contents are
+  // written to a temporary file that is then renamed over path, so
+  // readers never see a partially written file.
+  static absl::Status Write(const std::string& path, const EntryMap& entries);
+
+  // Exposed for testing.
+  static std::string Serialize(const EntryMap& entries);
+  static absl::StatusOr<EntryMap> Parse(absl::string_view contents);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_XDS_XDS_RESOURCE_CACHE_H
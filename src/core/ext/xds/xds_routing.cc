@@ -25,12 +25,18 @@
 
 #include <algorithm>
 #include <cctype>
+#include <functional>
+#include <string>
 #include <utility>
+#include <vector>
 
+#include "absl/container/inlined_vector.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
 
 #include <grpc/support/log.h>
 
@@ -139,6 +145,80 @@ absl::optional<size_t> XdsRouting::FindVirtualHostForDomain(
 
 namespace {
 
+// Sorts lengths and removes duplicates.
+void SortLengths(std::vector<size_t>* lengths, bool longest_first) {
+  if (longest_first) {
+    std::sort(lengths->begin(), lengths->end(), std::greater<size_t>());
+  } else {
+    std::sort(lengths->begin(), lengths->end());
+  }
+  lengths->erase(std::unique(lengths->begin(), lengths->end()),
+                 lengths->end());
+}
+
+}  // namespace
+
+XdsRouting::VirtualHostIndex::VirtualHostIndex(
+    const VirtualHostListIterator& vhost_iterator) {
+  // Only the first virtual host with a given pattern is recorded, which
+  // gives the same result as the search above.
+  for (size_t i = 0; i < vhost_iterator.Size(); ++i) {
+    for (const std::string& domain_pattern :
+         vhost_iterator.GetDomainsForVirtualHost(i)) {
+      const MatchType match_type = DomainPatternMatchType(domain_pattern);
+      // This should be caught by RouteConfigParse().
+      GPR_ASSERT(match_type != INVALID_MATCH);
+      std::string pattern = absl::AsciiStrToLower(domain_pattern);
+      switch (match_type) {
+        case EXACT_MATCH:
+          exact_.emplace(std::move(pattern), i);
+          break;
+        case SUFFIX_MATCH:
+          pattern.erase(0, 1);
+          suffix_lengths_.push_back(pattern.size());
+          suffix_.emplace(std::move(pattern), i);
+          break;
+        case PREFIX_MATCH:
+          pattern.pop_back();
+          prefix_lengths_.push_back(pattern.size());
+          prefix_.emplace(std::move(pattern), i);
+          break;
+        case UNIVERSE_MATCH:
+          if (!universe_.has_value()) universe_ = i;
+          break;
+        case INVALID_MATCH:
+          break;
+      }
+    }
+  }
+  SortLengths(&suffix_lengths_, /*longest_first=*/true);
+  SortLengths(&prefix_lengths_, /*longest_first=*/true);
+}
+
+absl::optional<size_t> XdsRouting::FindVirtualHostForDomain(
+    const VirtualHostIndex& vhost_index, absl::string_view domain) {
+  // Same search order as above: exact, suffix, prefix and then universe
+  // match, with the longest match winning within each group.
+  const std::string host = absl::AsciiStrToLower(domain);
+  auto it = vhost_index.exact_.find(host);
+  if (it != vhost_index.exact_.end()) return it->second;
+  // Asterisk must match at least one char.
+  for (size_t length : vhost_index.suffix_lengths_) {
+    if (length >= host.size()) continue;
+    it = vhost_index.suffix_.find(
+        absl::string_view(host).substr(host.size() - length));
+    if (it != vhost_index.suffix_.end()) return it->second;
+  }
+  for (size_t length : vhost_index.prefix_lengths_) {
+    if (length >= host.size()) continue;
+    it = vhost_index.prefix_.find(absl::string_view(host).substr(0, length));
+    if (it != vhost_index.prefix_.end()) return it->second;
+  }
+  return vhost_index.universe_;
+}
+
+namespace {
+
 bool HeadersMatch(const std::vector<HeaderMatcher>& header_matchers,
                   grpc_metadata_batch* initial_metadata) {
   for (const auto& header_matcher : header_matchers) {
@@ -157,24 +237,92 @@ bool UnderFraction(const uint32_t fraction_per_million) {
   return random_number < fraction_per_million;
 }
 
+bool RouteMatches(const XdsRouteConfigResource::Route::Matchers& matchers,
+                  absl::string_view path,
+                  grpc_metadata_batch* initial_metadata) {
+  return matchers.path_matcher.Match(path) &&
+         HeadersMatch(matchers.header_matchers, initial_metadata) &&
+         (!matchers.fraction_per_million.has_value() ||
+          UnderFraction(*matchers.fraction_per_million));
+}
+
 }  // namespace
 
 absl::optional<size_t> XdsRouting::GetRouteForRequest(
     const RouteListIterator& route_list_iterator, absl::string_view path,
     grpc_metadata_batch* initial_metadata) {
   for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
-    const XdsRouteConfigResource::Route::Matchers& matchers =
-        route_list_iterator.GetMatchersForRoute(i);
-    if (matchers.path_matcher.Match(path) &&
-        HeadersMatch(matchers.header_matchers, initial_metadata) &&
-        (!matchers.fraction_per_million.has_value() ||
-         UnderFraction(*matchers.fraction_per_million))) {
+    if (RouteMatches(route_list_iterator.GetMatchersForRoute(i), path,
+                     initial_metadata)) {
       return i;
     }
   }
   return absl::nullopt;
 }
 
+XdsRouting::RouteIndex::RouteIndex(
+    const RouteListIterator& route_list_iterator) {
+  // Matching is done on the lower-cased path, so that case-insensitive
+  // matchers can share the maps.  The index only narrows down the routes
+  // to check; each one is still matched in full.
+  for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
+    const StringMatcher& path_matcher =
+        route_list_iterator.GetMatchersForRoute(i).path_matcher;
+    switch (path_matcher.type()) {
+      case StringMatcher::Type::kExact:
+        exact_[absl::AsciiStrToLower(path_matcher.string_matcher())]
+            .push_back(i);
+        break;
+      case StringMatcher::Type::kPrefix:
+        prefix_lengths_.push_back(path_matcher.string_matcher().size());
+        prefix_[absl::AsciiStrToLower(path_matcher.string_matcher())]
+            .push_back(i);
+        break;
+      default:
+        unindexed_.push_back(i);
+        break;
+    }
+  }
+  SortLengths(&prefix_lengths_, /*longest_first=*/false);
+}
+
+absl::optional<size_t> XdsRouting::GetRouteForRequest(
+    const RouteListIterator& route_list_iterator,
+    const RouteIndex& route_index, absl::string_view path,
+    grpc_metadata_batch* initial_metadata) {
+  // Collect the candidate routes, as lists sorted by route index.
+  const std::string lower_path = absl::AsciiStrToLower(path);
+  absl::InlinedVector<absl::Span<const size_t>, 8> candidates;
+  auto it = route_index.exact_.find(lower_path);
+  if (it != route_index.exact_.end()) candidates.emplace_back(it->second);
+  for (size_t length : route_index.prefix_lengths_) {
+    if (length > lower_path.size()) break;
+    it = route_index.prefix_.find(
+        absl::string_view(lower_path).substr(0, length));
+    if (it != route_index.prefix_.end()) candidates.emplace_back(it->second);
+  }
+  if (!route_index.unindexed_.empty()) {
+    candidates.emplace_back(route_index.unindexed_);
+  }
+  // Check the candidates in route order, so that the first matching
+  // route wins.
+  while (true) {
+    absl::Span<const size_t>* next = nullptr;
+    for (auto& c : candidates) {
+      if (!c.empty() && (next == nullptr || c.front() < next->front())) {
+        next = &c;
+      }
+    }
+    if (next == nullptr) return absl::nullopt;
+    const size_t i = next->front();
+    next->remove_prefix(1);
+    if (RouteMatches(route_list_iterator.GetMatchersForRoute(i), path,
+                     initial_metadata)) {
+      return i;
+    }
+  }
+}
+
 bool XdsRouting::IsValidDomainPattern(absl::string_view domain_pattern) {
   return DomainPatternMatchType(domain_pattern) != INVALID_MATCH;
 }
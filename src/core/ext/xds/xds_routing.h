@@ -27,6 +27,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
@@ -61,15 +62,74 @@ class XdsRouting {
         size_t index) const = 0;
   };
 
+  // An index of the domain patterns of a virtual host list, for callers
+  // that look up a domain for every call.  Must be rebuilt whenever the
+  // list changes.
+  class VirtualHostIndex {
+   public:
+    VirtualHostIndex() = default;
+    explicit VirtualHostIndex(const VirtualHostListIterator& vhost_iterator);
+
+   private:
+    friend class XdsRouting;
+
+    // Lower-cased patterns without the asterisk, mapped to the first
+    // virtual host that has them.
+    using PatternMap = absl::flat_hash_map<std::string, size_t>;
+
+    PatternMap exact_;
+    PatternMap suffix_;
+    PatternMap prefix_;
+    // The distinct lengths of the keys of suffix_ and prefix_, longest
+    // first.
+    std::vector<size_t> suffix_lengths_;
+    std::vector<size_t> prefix_lengths_;
+    absl::optional<size_t> universe_;
+  };
+
+  // An index of the path matchers of a route list, so that a request is
+  // only checked against routes whose path matcher might match it.  Must
+  // be rebuilt whenever the list changes.
+  class RouteIndex {
+   public:
+    RouteIndex() = default;
+    explicit RouteIndex(const RouteListIterator& route_list_iterator);
+
+   private:
+    friend class XdsRouting;
+
+    // Lower-cased exact paths and path prefixes, mapped to the routes
+    // that use them, in increasing order.
+    using PathMap = absl::flat_hash_map<std::string, std::vector<size_t>>;
+
+    PathMap exact_;
+    PathMap prefix_;
+    // The distinct lengths of the keys of prefix_.
+    std::vector<size_t> prefix_lengths_;
+    // Routes with any other path matcher, which are checked for every
+    // request.
+    std::vector<size_t> unindexed_;
+  };
+
   // Returns the index of the selected virtual host in the list.
   static absl::optional<size_t> FindVirtualHostForDomain(
       const VirtualHostListIterator& vhost_iterator, absl::string_view domain);
+  // Same as above, but uses an index built from the list.
+  static absl::optional<size_t> FindVirtualHostForDomain(
+      const VirtualHostIndex& vhost_index, absl::string_view domain);
 
   // Returns the index in route_list_iterator to use for a request with
   // the specified path and metadata, or nullopt if no route matches.
   static absl::optional<size_t> GetRouteForRequest(
       const RouteListIterator& route_list_iterator, absl::string_view path,
       grpc_metadata_batch* initial_metadata);
+  // Same as above, but only checks the routes that route_index selects
+  // for the path.  route_index must have been built from
+  // route_list_iterator.
+  static absl::optional<size_t> GetRouteForRequest(
+      const RouteListIterator& route_list_iterator,
+      const RouteIndex& route_index, absl::string_view path,
+      grpc_metadata_batch* initial_metadata);
 
   // Returns true if \a domain_pattern is a valid domain pattern, false
   // otherwise.
@@ -346,6 +346,7 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
 
     std::vector<std::string> domains;
     std::vector<Route> routes;
+    XdsRouting::RouteIndex route_index;
   };
 
   class VirtualHostListIterator : public XdsRouting::VirtualHostListIterator {
@@ -366,6 +367,7 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   };
 
   std::vector<VirtualHost> virtual_hosts_;
+  XdsRouting::VirtualHostIndex virtual_host_index_;
 };
 
 // An XdsServerConfigSelectorProvider implementation for when the
@@ -1182,7 +1184,11 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
             ServiceConfigImpl::Create(result->args, json.c_str()).value();
       }
     }
+    virtual_host.route_index = XdsRouting::RouteIndex(
+        VirtualHost::RouteListIterator(&virtual_host.routes));
   }
+  config_selector->virtual_host_index_ = XdsRouting::VirtualHostIndex(
+      VirtualHostListIterator(&config_selector->virtual_hosts_));
   return config_selector;
 }
 
@@ -1200,8 +1206,8 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   }
   absl::string_view authority =
       metadata->get_pointer(HttpAuthorityMetadata())->as_string_view();
-  auto vhost_index = XdsRouting::FindVirtualHostForDomain(
-      VirtualHostListIterator(&virtual_hosts_), authority);
+  auto vhost_index =
+      XdsRouting::FindVirtualHostForDomain(virtual_host_index_, authority);
   if (!vhost_index.has_value()) {
     return absl::UnavailableError(
         absl::StrCat("could not find VirtualHost for ", authority,
@@ -1209,7 +1215,8 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   }
   auto& virtual_host = virtual_hosts_[vhost_index.value()];
   auto route_index = XdsRouting::GetRouteForRequest(
-      VirtualHost::RouteListIterator(&virtual_host.routes), path, metadata);
+      VirtualHost::RouteListIterator(&virtual_host.routes),
+      virtual_host.route_index, path, metadata);
   if (route_index.has_value()) {
     auto& route = virtual_host.routes[route_index.value()];
     // Found the matching route
@@ -288,12 +288,17 @@ class AVL {
     if (node == nullptr) {
       return nullptr;
     }
+    // If the key is not in a subtree, keep that subtree (and so every
+    // node above it) as is, so that removing an absent key preserves
+    // identity.
     if (key < node->kv.first) {
-      return Rebalance(node->kv.first, node->kv.second,
-                       RemoveKey(node->left, key), node->right);
+      NodePtr left = RemoveKey(node->left, key);
+      if (left == node->left) return node;
+      return Rebalance(node->kv.first, node->kv.second, left, node->right);
     } else if (node->kv.first < key) {
-      return Rebalance(node->kv.first, node->kv.second, node->left,
-                       RemoveKey(node->right, key));
+      NodePtr right = RemoveKey(node->right, key);
+      if (right == node->right) return node;
+      return Rebalance(node->kv.first, node->kv.second, node->left, right);
     } else {
       if (node->left == nullptr) {
         return node->right;
@@ -457,9 +462,13 @@ class AVL<K, void> {
       return nullptr;
     }
     if (key < node->key) {
-      return Rebalance(node->key, RemoveKey(node->left, key), node->right);
+      NodePtr left = RemoveKey(node->left, key);
+      if (left == node->left) return node;
+      return Rebalance(node->key, left, node->right);
     } else if (node->key < key) {
-      return Rebalance(node->key, node->left, RemoveKey(node->right, key));
+      NodePtr right = RemoveKey(node->right, key);
+      if (right == node->right) return node;
+      return Rebalance(node->key, node->left, right);
     } else {
       if (node->left == nullptr) {
         return node->right;
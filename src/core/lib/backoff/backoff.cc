@@ -31,6 +31,16 @@ Timestamp BackOff::NextAttemptTime() {
     initial_ = false;
     return current_backoff_ + Timestamp::Now();
   }
+  if (options_.decorrelated_jitter()) {
+    const double upper =
+        std::max(options_.initial_backoff().seconds(),
+                 current_backoff_.seconds() * options_.multiplier());
+    current_backoff_ = std::min(
+        Duration::FromSecondsAsDouble(absl::Uniform(
+            rand_gen_, options_.initial_backoff().seconds(), upper)),
+        options_.max_backoff());
+    return Timestamp::Now() + current_backoff_;
+  }
   current_backoff_ = std::min(current_backoff_ * options_.multiplier(),
                               options_.max_backoff());
   const Duration jitter = Duration::FromSecondsAsDouble(
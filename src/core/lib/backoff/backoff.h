@@ -61,6 +61,10 @@ class BackOff {
       max_backoff_ = max_backoff;
       return *this;
     }
+    Options& set_decorrelated_jitter(bool decorrelated_jitter) {
+      decorrelated_jitter_ = decorrelated_jitter;
+      return *this;
+    }
     /// how long to wait after the first failure before retrying
     Duration initial_backoff() const { return initial_backoff_; }
     /// factor with which to multiply backoff after a failed retry
@@ -69,12 +73,19 @@ class BackOff {
     double jitter() const { return jitter_; }
     /// maximum time between retries
     Duration max_backoff() const { return max_backoff_; }
+    /// whether to pick each backoff at random between the initial backoff
+    /// and multiplier times the previous one ("decorrelated jitter"), rather
+    /// than jittering a fixed exponential sequence.  Clients that failed
+    /// together then drift apart instead of retrying in lockstep.  jitter()
+    /// is ignored.
+    bool decorrelated_jitter() const { return decorrelated_jitter_; }
 
    private:
     Duration initial_backoff_;
     double multiplier_;
     double jitter_;
     Duration max_backoff_;
+    bool decorrelated_jitter_ = false;
   };  // class Options
 
  private:
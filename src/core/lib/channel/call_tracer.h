@@ -46,6 +46,29 @@ class CallTracer {
   // as transparent retry attempts.)
   class CallAttemptTracer {
    public:
+    // Points in the life of a call attempt that tell where its latency went.
+    enum class Phase {
+      // The LB pick could not complete right away, e.g. because no subchannel
+      // was connected yet, and was queued.
+      kLbPickQueued,
+      // The queued LB pick completed.
+      kLbPickComplete,
+      // The transport encoded the initial metadata of the attempt.
+      kInitialMetadataEncoded,
+      // The attempt first had data to send but no flow control window.
+      kFirstFlowControlStall,
+      // The first and the last writes carrying data of the attempt completed.
+      kFirstWriteFlushed,
+      kLastWriteFlushed,
+      // The kernel sent the latest write of the attempt that the peer ACKed
+      // before the stream closed, and got the ACK. Only with
+      // GRPC_ARG_TCP_WRITE_TIMESTAMPS.
+      kLastWriteSent,
+      kLastWriteAcked,
+      // The transport decoded the initial metadata received for the attempt.
+      kInitialMetadataDecoded,
+    };
+
     virtual ~CallAttemptTracer() {}
     // Please refer to `grpc_transport_stream_op_batch_payload` for details on
     // arguments.
@@ -74,6 +97,13 @@ class CallTracer {
     // TODO(yashykt): If needed, extend this to attach attributes with
     // annotations.
     virtual void RecordAnnotation(absl::string_view annotation) = 0;
+    // Records that the attempt reached \a phase at \a time, taken from
+    // GPR_CLOCK_MONOTONIC. The transport only hands its phases over when the
+    // stream closes, so they are all recorded just before
+    // RecordReceivedTrailingMetadata(), whose transport_stream_stats also
+    // carries the number and total duration of flow control stalls. The
+    // default implementation ignores phases.
+    virtual void RecordPhase(Phase /*phase*/, const gpr_timespec& /*time*/) {}
   };
 
   virtual ~CallTracer() {}
@@ -154,7 +154,29 @@ ChannelArgs ChannelArgs::Set(absl::string_view name, int value) const {
   return Set(name, Value(value));
 }
 
+namespace {
+
+// Returns true if replacing `current` with `value` would be a no-op.
+// Pointers only match if they are the same pointer with the same vtable,
+// since their cmp functions may treat distinct objects as equal.
+bool SameValue(const ChannelArgs::Value& current,
+               const ChannelArgs::Value& value) {
+  if (current.index() != value.index()) return false;
+  if (const auto* p = absl::get_if<ChannelArgs::Pointer>(&value)) {
+    const auto& c = absl::get<ChannelArgs::Pointer>(current);
+    return c.c_pointer() == p->c_pointer() && c.c_vtable() == p->c_vtable();
+  }
+  return current == value;
+}
+
+}  // namespace
+
 ChannelArgs ChannelArgs::Set(absl::string_view key, Value value) const {
+  // Setting a key to the value it already has keeps the same tree, so
+  // that args derived from a common base by the same sequence of Set()
+  // calls keep sharing storage and compare equal by identity.
+  const Value* current = args_.Lookup(key);
+  if (current != nullptr && SameValue(*current, value)) return *this;
   return ChannelArgs(args_.Add(std::string(key), std::move(value)));
 }
 
@@ -251,8 +273,10 @@ std::string ChannelArgs::ToString() const {
 }
 
 ChannelArgs ChannelArgs::UnionWith(ChannelArgs other) const {
+  if (args_.Empty() || args_.SameIdentity(other.args_)) return other;
+  if (other.args_.Empty()) return *this;
   args_.ForEach([&other](const std::string& key, const Value& value) {
-    other.args_ = other.args_.Add(key, value);
+    other = other.Set(key, value);
   });
   return other;
 }
@@ -23,4 +23,8 @@ typedef struct grpc_call_element grpc_call_element;
 
 typedef struct grpc_call_stack grpc_call_stack;
 
+namespace grpc_core {
+struct FusedCallPromise;
+}  // namespace grpc_core
+
 #endif  // GRPC_SRC_CORE_LIB_CHANNEL_CHANNEL_FWD_H
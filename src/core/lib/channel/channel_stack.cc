@@ -23,12 +23,20 @@
 #include <stdint.h>
 
 #include <memory>
+#include <tuple>
 #include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 
 #include <grpc/support/log.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/fused_call_promise.h"
 #include "src/core/lib/gpr/alloc.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/sync.h"
 
 using grpc_event_engine::experimental::EventEngine;
 
@@ -51,23 +59,82 @@ grpc_core::TraceFlag grpc_trace_channel_stack(false, "channel_stack");
 //   per-filter memory, aligned to GPR_MAX_ALIGNMENT
 // }
 
-size_t grpc_channel_stack_size(const grpc_channel_filter** filters,
-                               size_t filter_count) {
-  // always need the header, and size for the channel elements
-  size_t size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_channel_stack)) +
-                GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filter_count *
-                                               sizeof(grpc_channel_element));
-  size_t i;
+namespace grpc_core {
 
-  GPR_ASSERT((GPR_MAX_ALIGNMENT & (GPR_MAX_ALIGNMENT - 1)) == 0 &&
-             "GPR_MAX_ALIGNMENT must be a power of two");
+namespace {
 
-  // add the size for each filter
-  for (i = 0; i < filter_count; i++) {
-    size += GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filters[i]->sizeof_channel_data);
+// Memoizes ChannelStackLayout, since a channel stack is built for every
+// channel and subchannel but there are only a handful of distinct filter
+// lists. The filter sizes are part of the key so that a filter that is not
+// static (as in tests) can't alias an earlier one at the same address.
+class ChannelStackLayoutCache {
+ public:
+  const ChannelStackLayout& Get(const grpc_channel_filter** filters,
+                                size_t filter_count) {
+    Key key;
+    key.reserve(filter_count);
+    for (size_t i = 0; i < filter_count; i++) {
+      key.emplace_back(filters[i], filters[i]->sizeof_channel_data,
+                       filters[i]->sizeof_call_data);
+    }
+    MutexLock lock(&mu_);
+    auto& layout = layouts_[std::move(key)];
+    if (layout == nullptr) layout = Compute(filters, filter_count);
+    return *layout;
   }
 
-  return size;
+ private:
+  using Key =
+      std::vector<std::tuple<const grpc_channel_filter*, size_t, size_t>>;
+
+  static std::unique_ptr<ChannelStackLayout> Compute(
+      const grpc_channel_filter** filters, size_t filter_count) {
+    GPR_ASSERT((GPR_MAX_ALIGNMENT & (GPR_MAX_ALIGNMENT - 1)) == 0 &&
+               "GPR_MAX_ALIGNMENT must be a power of two");
+    auto layout = std::make_unique<ChannelStackLayout>();
+    // always need the header, and size for the elements
+    size_t channel_size =
+        GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_channel_stack)) +
+        GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filter_count *
+                                       sizeof(grpc_channel_element));
+    size_t call_size =
+        GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_call_stack)) +
+        GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filter_count *
+                                       sizeof(grpc_call_element));
+    layout->channel_data_offsets.reserve(filter_count);
+    layout->call_data_offsets.reserve(filter_count);
+    // add the data for each filter
+    for (size_t i = 0; i < filter_count; i++) {
+      layout->channel_data_offsets.push_back(channel_size);
+      layout->call_data_offsets.push_back(call_size);
+      channel_size +=
+          GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filters[i]->sizeof_channel_data);
+      call_size += GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filters[i]->sizeof_call_data);
+    }
+    layout->channel_stack_size = channel_size;
+    layout->call_stack_size = call_size;
+    return layout;
+  }
+
+  Mutex mu_;
+  absl::flat_hash_map<Key, std::unique_ptr<ChannelStackLayout>> layouts_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace
+
+const ChannelStackLayout& GetChannelStackLayout(
+    const grpc_channel_filter** filters, size_t filter_count) {
+  static NoDestruct<ChannelStackLayoutCache> cache;
+  return cache->Get(filters, filter_count);
+}
+
+}  // namespace grpc_core
+
+size_t grpc_channel_stack_size(const grpc_channel_filter** filters,
+                               size_t filter_count) {
+  return grpc_core::GetChannelStackLayout(filters, filter_count)
+      .channel_stack_size;
 }
 
 #define CHANNEL_ELEMS_FROM_STACK(stk)                                     \
@@ -121,21 +188,18 @@ grpc_error_handle grpc_channel_stack_init(
   stack->on_destroy.Init([]() {});
   stack->event_engine.Init(channel_args.GetObjectRef<EventEngine>());
 
-  size_t call_size =
-      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_call_stack)) +
-      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filter_count * sizeof(grpc_call_element));
+  const grpc_core::ChannelStackLayout& layout =
+      grpc_core::GetChannelStackLayout(filters, filter_count);
   grpc_channel_element* elems;
   grpc_channel_element_args args;
-  char* user_data;
   size_t i;
 
   stack->count = filter_count;
+  stack->fused_call_promise = nullptr;
+  stack->layout = &layout;
   GRPC_STREAM_REF_INIT(&stack->refcount, initial_refs, destroy, destroy_arg,
                        name);
   elems = CHANNEL_ELEMS_FROM_STACK(stack);
-  user_data = (reinterpret_cast<char*>(elems)) +
-              GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filter_count *
-                                             sizeof(grpc_channel_element));
 
   // init per-filter data
   grpc_error_handle first_error;
@@ -145,7 +209,8 @@ grpc_error_handle grpc_channel_stack_init(
     args.is_first = i == 0;
     args.is_last = i == (filter_count - 1);
     elems[i].filter = filters[i];
-    elems[i].channel_data = user_data;
+    elems[i].channel_data =
+        reinterpret_cast<char*>(stack) + layout.channel_data_offsets[i];
     grpc_error_handle error =
         elems[i].filter->init_channel_elem(&elems[i], &args);
     if (!error.ok()) {
@@ -153,16 +218,9 @@ grpc_error_handle grpc_channel_stack_init(
         first_error = error;
       }
     }
-    user_data +=
-        GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filters[i]->sizeof_channel_data);
-    call_size += GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filters[i]->sizeof_call_data);
   }
 
-  GPR_ASSERT(user_data > (char*)stack);
-  GPR_ASSERT((uintptr_t)(user_data - (char*)stack) ==
-             grpc_channel_stack_size(filters, filter_count));
-
-  stack->call_stack_size = call_size;
+  stack->call_stack_size = layout.call_stack_size;
   return first_error;
 }
 
@@ -187,24 +245,22 @@ grpc_error_handle grpc_call_stack_init(
     const grpc_call_element_args* elem_args) {
   grpc_channel_element* channel_elems = CHANNEL_ELEMS_FROM_STACK(channel_stack);
   size_t count = channel_stack->count;
+  const std::vector<size_t>& call_data_offsets =
+      channel_stack->layout->call_data_offsets;
   grpc_call_element* call_elems;
-  char* user_data;
+  char* base = reinterpret_cast<char*>(elem_args->call_stack);
 
   elem_args->call_stack->count = count;
   GRPC_STREAM_REF_INIT(&elem_args->call_stack->refcount, initial_refs, destroy,
                        destroy_arg, "CALL_STACK");
   call_elems = CALL_ELEMS_FROM_STACK(elem_args->call_stack);
-  user_data = (reinterpret_cast<char*>(call_elems)) +
-              GPR_ROUND_UP_TO_ALIGNMENT_SIZE(count * sizeof(grpc_call_element));
 
   // init per-filter data
   grpc_error_handle first_error;
   for (size_t i = 0; i < count; i++) {
     call_elems[i].filter = channel_elems[i].filter;
     call_elems[i].channel_data = channel_elems[i].channel_data;
-    call_elems[i].call_data = user_data;
-    user_data +=
-        GPR_ROUND_UP_TO_ALIGNMENT_SIZE(call_elems[i].filter->sizeof_call_data);
+    call_elems[i].call_data = base + call_data_offsets[i];
   }
   for (size_t i = 0; i < count; i++) {
     grpc_error_handle error =
@@ -284,15 +340,19 @@ grpc_call_stack* grpc_call_stack_from_top_element(grpc_call_element* elem) {
 void grpc_channel_stack_no_post_init(grpc_channel_stack*,
                                      grpc_channel_element*) {}
 
-namespace {
+namespace grpc_core {
 
-grpc_core::NextPromiseFactory ClientNext(grpc_channel_element* elem) {
-  return [elem](grpc_core::CallArgs args) {
+NextPromiseFactory ClientNextPromiseFactory(grpc_channel_element* elem) {
+  return [elem](CallArgs args) {
     return elem->filter->make_call_promise(elem, std::move(args),
-                                           ClientNext(elem + 1));
+                                           ClientNextPromiseFactory(elem + 1));
   };
 }
 
+}  // namespace grpc_core
+
+namespace {
+
 grpc_core::NextPromiseFactory ServerNext(grpc_channel_element* elem) {
   return [elem](grpc_core::CallArgs args) {
     return elem->filter->make_call_promise(elem, std::move(args),
@@ -304,7 +364,12 @@ grpc_core::NextPromiseFactory ServerNext(grpc_channel_element* elem) {
 
 grpc_core::ArenaPromise<grpc_core::ServerMetadataHandle>
 grpc_channel_stack::MakeClientCallPromise(grpc_core::CallArgs call_args) {
-  return ClientNext(grpc_channel_stack_element(this, 0))(std::move(call_args));
+  if (fused_call_promise != nullptr) {
+    return fused_call_promise->make_client_call_promise(
+        grpc_channel_stack_element(this, 0), std::move(call_args));
+  }
+  return grpc_core::ClientNextPromiseFactory(grpc_channel_stack_element(
+      this, 0))(std::move(call_args));
 }
 
 grpc_core::ArenaPromise<grpc_core::ServerMetadataHandle>
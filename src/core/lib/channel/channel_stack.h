@@ -50,6 +50,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
@@ -200,6 +201,24 @@ struct grpc_call_element {
   void* call_data;
 };
 
+namespace grpc_core {
+// Where each filter's data lives in a channel stack and in its call stacks.
+// This depends only on the filters, so it's computed once for each distinct
+// filter list and shared by every stack built from it.
+struct ChannelStackLayout {
+  size_t channel_stack_size;
+  size_t call_stack_size;
+  // Offsets from the start of the channel stack, one per filter.
+  std::vector<size_t> channel_data_offsets;
+  // Offsets from the start of a call stack, one per filter.
+  std::vector<size_t> call_data_offsets;
+};
+
+// Returns the (cached) layout for a stack of filters.
+const ChannelStackLayout& GetChannelStackLayout(
+    const grpc_channel_filter** filters, size_t filter_count);
+}  // namespace grpc_core
+
 // A channel stack tracks a set of related filters for one channel, and
 // guarantees they live within a single malloc() allocation
 struct grpc_channel_stack {
@@ -218,6 +237,13 @@ struct grpc_channel_stack {
       std::shared_ptr<grpc_event_engine::experimental::EventEngine>>
       event_engine;
 
+  // If set, used by MakeClientCallPromise() in place of walking the
+  // elements (see fused_call_promise.h).
+  const grpc_core::FusedCallPromise* fused_call_promise;
+
+  // Layout of this stack's filters, owned by the layout cache.
+  const grpc_core::ChannelStackLayout* layout;
+
   grpc_event_engine::experimental::EventEngine* EventEngine() const {
     return event_engine->get();
   }
@@ -382,6 +408,12 @@ void grpc_call_log_op(const char* file, int line, gpr_log_severity severity,
 void grpc_channel_stack_no_post_init(grpc_channel_stack* stk,
                                      grpc_channel_element* elem);
 
+namespace grpc_core {
+// Returns a factory that makes the client call promise for elem and the
+// elements below it, through their filter vtables.
+NextPromiseFactory ClientNextPromiseFactory(grpc_channel_element* elem);
+}  // namespace grpc_core
+
 extern grpc_core::TraceFlag grpc_trace_channel;
 
 #define GRPC_CALL_LOG_OP(sev, elem, op)                \
@@ -83,6 +83,15 @@ class ChannelStackBuilder {
   // Helper to add a filter to the end of the stack.
   void AppendFilter(const grpc_channel_filter* filter);
 
+  // Selects a fused call promise for the stack (see fused_call_promise.h).
+  // It is dropped at build time if the final stack doesn't match it.
+  void SetFusedCallPromise(const FusedCallPromise* fused_call_promise) {
+    fused_call_promise_ = fused_call_promise;
+  }
+  const FusedCallPromise* fused_call_promise() const {
+    return fused_call_promise_;
+  }
+
   // Determine whether a promise-based call stack is able to be built.
   // Iterates each filter and ensures that there's a promise factory there.
   // This will go away once the promise conversion is completed.
@@ -113,6 +122,8 @@ class ChannelStackBuilder {
   ChannelArgs args_;
   // The in-progress stack
   std::vector<const grpc_channel_filter*> stack_;
+  // Fused call promise for stack_, if any
+  const FusedCallPromise* fused_call_promise_ = nullptr;
 };
 
 }  // namespace grpc_core
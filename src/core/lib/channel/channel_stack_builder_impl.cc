@@ -33,6 +33,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/channel/fused_call_promise.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/error.h"
@@ -114,6 +115,16 @@ ChannelStackBuilderImpl::Build() {
     return status;
   }
 
+  // A fused call promise stands in for walking the stack's vtables, so it
+  // can only be used if nothing was interleaved for tracing, and only for
+  // the stack it was selected for: stages after the selecting one may still
+  // have changed it.
+  const FusedCallPromise* fused = fused_call_promise();
+  if (fused != nullptr && is_client && is_promising &&
+      !client_promise_tracing && fused->matches(stack.data(), stack.size())) {
+    channel_stack->fused_call_promise = fused;
+  }
+
   // run post-initialization functions
   for (size_t i = 0; i < stack.size(); i++) {
     auto* elem = grpc_channel_stack_element(channel_stack, i);
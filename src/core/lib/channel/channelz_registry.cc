@@ -39,7 +39,7 @@ namespace grpc_core {
 namespace channelz {
 namespace {
 
-const int kPaginationLimit = 100;
+const size_t kPaginationLimit = 100;
 
 }  // anonymous namespace
 
@@ -49,57 +49,76 @@ ChannelzRegistry* ChannelzRegistry::Default() {
 }
 
 void ChannelzRegistry::InternalRegister(BaseNode* node) {
-  MutexLock lock(&mu_);
-  node->uuid_ = ++uuid_generator_;
-  node_map_[node->uuid_] = node;
+  node->uuid_ = uuid_generator_.fetch_add(1, std::memory_order_relaxed) + 1;
+  Shard& shard = ShardForUuid(node->uuid_);
+  MutexLock lock(&shard.mu);
+  shard.node_map[node->uuid_] = node;
 }
 
 void ChannelzRegistry::InternalUnregister(intptr_t uuid) {
   GPR_ASSERT(uuid >= 1);
-  MutexLock lock(&mu_);
-  GPR_ASSERT(uuid <= uuid_generator_);
-  node_map_.erase(uuid);
+  GPR_ASSERT(uuid <= uuid_generator_.load(std::memory_order_relaxed));
+  Shard& shard = ShardForUuid(uuid);
+  MutexLock lock(&shard.mu);
+  shard.node_map.erase(uuid);
 }
 
 RefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
-  MutexLock lock(&mu_);
-  if (uuid < 1 || uuid > uuid_generator_) {
+  if (uuid < 1 || uuid > uuid_generator_.load(std::memory_order_relaxed)) {
     return nullptr;
   }
-  auto it = node_map_.find(uuid);
-  if (it == node_map_.end()) return nullptr;
+  Shard& shard = ShardForUuid(uuid);
+  MutexLock lock(&shard.mu);
+  auto it = shard.node_map.find(uuid);
+  if (it == shard.node_map.end()) return nullptr;
   // Found node.  Return only if its refcount is not zero (i.e., when we
   // know that there is no other thread about to destroy it).
   BaseNode* node = it->second;
   return node->RefIfNonZero();
 }
 
-std::string ChannelzRegistry::InternalGetTopChannels(
-    intptr_t start_channel_id) {
-  std::vector<RefCountedPtr<BaseNode>> top_level_channels;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_channel_id);
-         it != node_map_.end(); ++it) {
+std::vector<RefCountedPtr<BaseNode>> ChannelzRegistry::InternalGetNodes(
+    intptr_t start_id, BaseNode::EntityType type, size_t max_nodes) {
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  // Each shard contributes its first max_nodes matches; the first max_nodes
+  // of their union in uuid order are then the overall first max_nodes.
+  for (auto& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    size_t found = 0;
+    for (auto it = shard.node_map.lower_bound(start_id);
+         it != shard.node_map.end() && found < max_nodes; ++it) {
       BaseNode* node = it->second;
       RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kTopLevelChannel &&
+      if (node->type() == type &&
           (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (top_level_channels.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        top_level_channels.emplace_back(std::move(node_ref));
+        nodes.emplace_back(std::move(node_ref));
+        ++found;
       }
     }
   }
+  std::sort(nodes.begin(), nodes.end(),
+            [](const RefCountedPtr<BaseNode>& a,
+               const RefCountedPtr<BaseNode>& b) {
+              return a->uuid() < b->uuid();
+            });
+  // The extra refs are dropped here, outside of the shard locks: unreffing
+  // while holding a lock may lead to a deadlock.
+  if (nodes.size() > max_nodes) nodes.resize(max_nodes);
+  return nodes;
+}
+
+std::string ChannelzRegistry::InternalGetTopChannels(
+    intptr_t start_channel_id) {
+  // Fetch one more than the limit to tell whether to set "end".
+  std::vector<RefCountedPtr<BaseNode>> top_level_channels =
+      InternalGetNodes(start_channel_id,
+                       BaseNode::EntityType::kTopLevelChannel,
+                       kPaginationLimit + 1);
+  RefCountedPtr<BaseNode> node_after_pagination_limit;
+  if (top_level_channels.size() > kPaginationLimit) {
+    node_after_pagination_limit = std::move(top_level_channels.back());
+    top_level_channels.pop_back();
+  }
   Json::Object object;
   if (!top_level_channels.empty()) {
     // Create list of channels.
@@ -115,29 +134,12 @@ std::string ChannelzRegistry::InternalGetTopChannels(
 }
 
 std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
-  std::vector<RefCountedPtr<BaseNode>> servers;
+  std::vector<RefCountedPtr<BaseNode>> servers = InternalGetNodes(
+      start_server_id, BaseNode::EntityType::kServer, kPaginationLimit + 1);
   RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_server_id);
-         it != node_map_.end(); ++it) {
-      BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kServer &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (servers.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        servers.emplace_back(std::move(node_ref));
-      }
-    }
+  if (servers.size() > kPaginationLimit) {
+    node_after_pagination_limit = std::move(servers.back());
+    servers.pop_back();
   }
   Json::Object object;
   if (!servers.empty()) {
@@ -155,9 +157,9 @@ std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
 
 void ChannelzRegistry::InternalLogAllEntities() {
   std::vector<RefCountedPtr<BaseNode>> nodes;
-  {
-    MutexLock lock(&mu_);
-    for (auto& p : node_map_) {
+  for (auto& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    for (auto& p : shard.node_map) {
       RefCountedPtr<BaseNode> node = p.second->RefIfNonZero();
       if (node != nullptr) {
         nodes.emplace_back(std::move(node));
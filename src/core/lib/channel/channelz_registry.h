@@ -21,9 +21,15 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
 
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -63,9 +69,11 @@ class ChannelzRegistry {
   // Test only helper function to reset to initial state.
   static void TestOnlyReset() {
     auto* p = Default();
-    MutexLock lock(&p->mu_);
-    p->node_map_.clear();
-    p->uuid_generator_ = 0;
+    for (auto& shard : p->shards_) {
+      MutexLock lock(&shard.mu);
+      shard.node_map.clear();
+    }
+    p->uuid_generator_.store(0, std::memory_order_relaxed);
   }
 
  private:
@@ -88,10 +96,24 @@ class ChannelzRegistry {
 
   void InternalLogAllEntities();
 
-  // protects members
-  Mutex mu_;
-  std::map<intptr_t, BaseNode*> node_map_;
-  intptr_t uuid_generator_ = 0;
+  // Returns refs to up to max_nodes live nodes of the given type with uuids
+  // of at least start_id, in uuid order.
+  std::vector<RefCountedPtr<BaseNode>> InternalGetNodes(
+      intptr_t start_id, BaseNode::EntityType type, size_t max_nodes);
+
+  // Channels, servers and sockets come and go with connections, so nodes are
+  // spread over shards by uuid rather than all registering under one lock.
+  static constexpr size_t kNumShards = 16;
+  struct Shard {
+    // protects node_map
+    Mutex mu;
+    std::map<intptr_t, BaseNode*> node_map ABSL_GUARDED_BY(mu);
+  };
+
+  Shard& ShardForUuid(intptr_t uuid) { return shards_[uuid % kNumShards]; }
+
+  Shard shards_[kNumShards];
+  std::atomic<intptr_t> uuid_generator_{0};
 };
 
 }  // namespace channelz
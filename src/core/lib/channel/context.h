@@ -49,6 +49,10 @@ typedef enum {
   /// the server.
   GRPC_CONTEXT_BACKEND_METRIC_PROVIDER,
 
+  /// Holds a pointer to the WriteWindowHint the transport publishes its
+  /// send window for this call in.
+  GRPC_CONTEXT_WRITE_WINDOW_HINT,
+
   GRPC_CONTEXT_COUNT
 } grpc_context_index;
 
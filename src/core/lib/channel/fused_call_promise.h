@@ -0,0 +1,125 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_CHANNEL_FUSED_CALL_PROMISE_H
+#define GRPC_SRC_CORE_LIB_CHANNEL_FUSED_CALL_PROMISE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <utility>
+#include <vector>
+
+#include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/transport/transport.h"
+
+// Fused call promises.
+//
+// Normally a promise based call is made by walking the channel stack: each
+// element's make_call_promise vtable entry forwards to a virtual
+// ChannelFilter::MakeCallPromise(), which in turn is handed a factory that
+// repeats the process for the next element.
+//
+// For filter configurations that are known at compile time, a fused call
+// promise instead calls each filter's MakeCallPromise() directly on its
+// concrete type, so the compiler can inline through the filters.  Elements
+// below the fused filters are reached through the vtables as usual.
+//
+// To use one, register MaybeUseFusedClientCallPromise<Filters...> as a
+// channel init stage with a priority after every stage that adds filters.
+// It applies when the stack being built starts with exactly Filters...,
+// each of which must have been created with MakePromiseBasedFilter() and
+// expose its grpc_channel_filter as a static kFilter member.  The fused
+// path is only taken for fully promise based stacks.
+
+namespace grpc_core {
+
+struct FusedCallPromise {
+  // Makes the client call promise for the stack whose top element is elem.
+  ArenaPromise<ServerMetadataHandle> (*make_client_call_promise)(
+      grpc_channel_element* elem, CallArgs call_args);
+  // Returns whether the n filters of a stack are a configuration this
+  // applies to.
+  bool (*matches)(const grpc_channel_filter* const* filters, size_t n);
+};
+
+namespace fused_call_promise_detail {
+
+template <typename... Filters>
+struct FusedClient;
+
+template <>
+struct FusedClient<> {
+  static ArenaPromise<ServerMetadataHandle> Make(grpc_channel_element* elem,
+                                                 CallArgs call_args) {
+    return elem->filter->make_call_promise(elem, std::move(call_args),
+                                           ClientNextPromiseFactory(elem + 1));
+  }
+
+  static bool Matches(const grpc_channel_filter* const*, size_t) {
+    return true;
+  }
+};
+
+template <typename Filter, typename... Rest>
+struct FusedClient<Filter, Rest...> {
+  static ArenaPromise<ServerMetadataHandle> Make(grpc_channel_element* elem,
+                                                 CallArgs call_args) {
+    // The qualified call is not virtual.
+    return static_cast<Filter*>(elem->channel_data)
+        ->Filter::MakeCallPromise(
+            std::move(call_args), [elem](CallArgs next_call_args) {
+              return FusedClient<Rest...>::Make(elem + 1,
+                                                std::move(next_call_args));
+            });
+  }
+
+  static bool Matches(const grpc_channel_filter* const* filters, size_t n) {
+    return n > 0 && filters[0] == &Filter::kFilter &&
+           FusedClient<Rest...>::Matches(filters + 1, n - 1);
+  }
+};
+
+}  // namespace fused_call_promise_detail
+
+template <typename... Filters>
+const FusedCallPromise* FusedClientCallPromise() {
+  static const FusedCallPromise kFused = {
+      fused_call_promise_detail::FusedClient<Filters...>::Make,
+      [](const grpc_channel_filter* const* filters, size_t n) {
+        return n > sizeof...(Filters) &&
+               fused_call_promise_detail::FusedClient<Filters...>::Matches(
+                   filters, n);
+      }};
+  return &kFused;
+}
+
+// A channel init stage that selects the fused call promise for Filters...
+// if the stack starts with them (and has at least one element after them).
+template <typename... Filters>
+bool MaybeUseFusedClientCallPromise(ChannelStackBuilder* builder) {
+  const FusedCallPromise* fused = FusedClientCallPromise<Filters...>();
+  const std::vector<const grpc_channel_filter*>& stack = builder->stack();
+  if (fused->matches(stack.data(), stack.size())) {
+    builder->SetFusedCallPromise(fused);
+  }
+  return true;
+}
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_CHANNEL_FUSED_CALL_PROMISE_H
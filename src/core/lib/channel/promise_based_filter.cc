@@ -1226,29 +1226,24 @@ class ClientCallData::PollContext {
   ~PollContext() {
     self_->poll_ctx_ = nullptr;
     if (have_scoped_activity_) scoped_activity_.Destroy();
-    if (repoll_) {
-      struct NextPoll : public grpc_closure {
-        grpc_call_stack* call_stack;
-        ClientCallData* call_data;
-      };
+    // A re-poll that is already pending polls after this one anyway, so
+    // there is never more than one, and it needs no allocation.
+    if (repoll_ && !self_->repoll_pending_) {
       auto run = [](void* p, grpc_error_handle) {
-        auto* next_poll = static_cast<NextPoll*>(p);
+        auto* call_data = static_cast<ClientCallData*>(p);
+        grpc_call_stack* call_stack = call_data->call_stack();
+        call_data->repoll_pending_ = false;
         {
-          ScopedContext ctx(next_poll->call_data);
-          Flusher flusher(next_poll->call_data);
-          next_poll->call_data->WakeInsideCombiner(&flusher);
+          ScopedContext ctx(call_data);
+          Flusher flusher(call_data);
+          call_data->WakeInsideCombiner(&flusher);
         }
-        GRPC_CALL_STACK_UNREF(next_poll->call_stack, "re-poll");
-        delete next_poll;
+        GRPC_CALL_STACK_UNREF(call_stack, "re-poll");
       };
-      // Unique ptr --> release to suppress clang-tidy warnings about allocating
-      // in a destructor.
-      auto* p = std::make_unique<NextPoll>().release();
-      p->call_stack = self_->call_stack();
-      p->call_data = self_;
+      self_->repoll_pending_ = true;
       GRPC_CALL_STACK_REF(self_->call_stack(), "re-poll");
-      GRPC_CLOSURE_INIT(p, run, p, nullptr);
-      flusher_->AddClosure(p, absl::OkStatus(), "re-poll");
+      GRPC_CLOSURE_INIT(&self_->repoll_, run, self_, nullptr);
+      flusher_->AddClosure(&self_->repoll_, absl::OkStatus(), "re-poll");
     }
   }
 
@@ -1877,27 +1872,23 @@ class ServerCallData::PollContext {
   ~PollContext() {
     self_->poll_ctx_ = nullptr;
     if (have_scoped_activity_) scoped_activity_.Destroy();
-    if (repoll_) {
-      struct NextPoll : public grpc_closure {
-        grpc_call_stack* call_stack;
-        ServerCallData* call_data;
-      };
+    // As for clients, at most one re-poll is pending at a time.
+    if (repoll_ && !self_->repoll_pending_) {
       auto run = [](void* p, grpc_error_handle) {
-        auto* next_poll = static_cast<NextPoll*>(p);
+        auto* call_data = static_cast<ServerCallData*>(p);
+        grpc_call_stack* call_stack = call_data->call_stack();
+        call_data->repoll_pending_ = false;
         {
-          Flusher flusher(next_poll->call_data);
-          ScopedContext context(next_poll->call_data);
-          next_poll->call_data->WakeInsideCombiner(&flusher);
+          Flusher flusher(call_data);
+          ScopedContext context(call_data);
+          call_data->WakeInsideCombiner(&flusher);
         }
-        GRPC_CALL_STACK_UNREF(next_poll->call_stack, "re-poll");
-        delete next_poll;
+        GRPC_CALL_STACK_UNREF(call_stack, "re-poll");
       };
-      auto* p = std::make_unique<NextPoll>().release();
-      p->call_stack = self_->call_stack();
-      p->call_data = self_;
+      self_->repoll_pending_ = true;
       GRPC_CALL_STACK_REF(self_->call_stack(), "re-poll");
-      GRPC_CLOSURE_INIT(p, run, p, nullptr);
-      flusher_->AddClosure(p, absl::OkStatus(), "re-poll");
+      GRPC_CLOSURE_INIT(&self_->repoll_, run, self_, nullptr);
+      flusher_->AddClosure(&self_->repoll_, absl::OkStatus(), "re-poll");
     }
   }
 
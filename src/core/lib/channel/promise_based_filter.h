@@ -664,6 +664,9 @@ class ClientCallData : public BaseCallData {
   RecvTrailingState recv_trailing_state_ = RecvTrailingState::kInitial;
   // Polling related data. Non-null if we're actively polling
   PollContext* poll_ctx_ = nullptr;
+  // Closure for the re-poll a PollContext schedules, if one is pending.
+  grpc_closure repoll_;
+  bool repoll_pending_ = false;
 };
 
 class ServerCallData : public BaseCallData {
@@ -768,6 +771,9 @@ class ServerCallData : public BaseCallData {
   SendTrailingState send_trailing_state_ = SendTrailingState::kInitial;
   // Current poll context (or nullptr if not polling).
   PollContext* poll_ctx_ = nullptr;
+  // Closure for the re-poll a PollContext schedules, if one is pending.
+  grpc_closure repoll_;
+  bool repoll_pending_ = false;
   // Whether to forward the recv_initial_metadata op at the end of promise
   // wakeup.
   bool forward_recv_initial_metadata_callback_ = false;
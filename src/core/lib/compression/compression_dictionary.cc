@@ -0,0 +1,212 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/compression/compression_dictionary.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/status/status.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_core {
+
+namespace {
+// Contexts beyond this many are freed rather than kept for the next message.
+constexpr size_t kMaxCachedContexts = 8;
+
+void CopyInput(grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  for (size_t i = 0; i < input->count; i++) {
+    grpc_slice_buffer_add(output, CSliceRef(input->slices[i]));
+  }
+}
+
+#ifdef HAVE_LIBZSTD
+// ZSTD_FRAMEHEADERSIZE_MAX, which zstd only declares for static linking.
+constexpr size_t kMaxFrameHeaderSize = 18;
+
+// The dictionary ID recorded in the header of the first frame of input, or 0
+// if there is none.
+uint32_t FrameDictionaryId(grpc_slice_buffer* input) {
+  uint8_t header[kMaxFrameHeaderSize];
+  size_t length = 0;
+  for (size_t i = 0; i < input->count && length < sizeof(header); i++) {
+    const size_t n = std::min(GRPC_SLICE_LENGTH(input->slices[i]),
+                              sizeof(header) - length);
+    memcpy(header + length, GRPC_SLICE_START_PTR(input->slices[i]), n);
+    length += n;
+  }
+  return ZSTD_getDictID_fromFrame(header, length);
+}
+#endif
+}  // namespace
+
+//
+// CompressionDictionary
+//
+
+absl::StatusOr<RefCountedPtr<CompressionDictionary>>
+CompressionDictionary::Create(absl::string_view data) {
+#ifdef HAVE_LIBZSTD
+  const uint32_t id = ZSTD_getDictID_fromDict(data.data(), data.size());
+  if (id == 0) {
+    return absl::InvalidArgumentError(
+        "not a zstd dictionary, or dictionary has no ID");
+  }
+  RefCountedPtr<CompressionDictionary> dictionary(
+      new CompressionDictionary(id));
+  for (int level = 0; level < GRPC_COMPRESS_LEVEL_COUNT; level++) {
+    dictionary->cdicts_[level] = ZSTD_createCDict(
+        data.data(), data.size(),
+        grpc_zstd_compression_level(
+            static_cast<grpc_compression_level>(level)));
+    if (dictionary->cdicts_[level] == nullptr) {
+      return absl::InvalidArgumentError("failed to load zstd dictionary");
+    }
+  }
+  dictionary->ddict_ = ZSTD_createDDict(data.data(), data.size());
+  if (dictionary->ddict_ == nullptr) {
+    return absl::InvalidArgumentError("failed to load zstd dictionary");
+  }
+  return dictionary;
+#else
+  (void)data;
+  return absl::UnimplementedError("gRPC was built without zstd support");
+#endif
+}
+
+CompressionDictionary::~CompressionDictionary() {
+#ifdef HAVE_LIBZSTD
+  for (ZSTD_CDict* cdict : cdicts_) ZSTD_freeCDict(cdict);
+  ZSTD_freeDDict(ddict_);
+#endif
+}
+
+//
+// CompressionDictionarySet
+//
+
+void CompressionDictionarySet::Add(
+    RefCountedPtr<CompressionDictionary> dictionary) {
+  const uint32_t id = dictionary->id();
+  dictionaries_[id] = std::move(dictionary);
+}
+
+const CompressionDictionary* CompressionDictionarySet::Find(
+    uint32_t id) const {
+  auto it = dictionaries_.find(id);
+  if (it == dictionaries_.end()) return nullptr;
+  return it->second.get();
+}
+
+//
+// DictionaryCompressor
+//
+
+DictionaryCompressor::~DictionaryCompressor() {
+#ifdef HAVE_LIBZSTD
+  for (ZSTD_CCtx* cctx : free_cctxs_) ZSTD_freeCCtx(cctx);
+  for (ZSTD_DCtx* dctx : free_dctxs_) ZSTD_freeDCtx(dctx);
+#endif
+}
+
+bool DictionaryCompressor::Compress(const CompressionDictionary& dictionary,
+                                    grpc_compression_level level,
+                                    grpc_slice_buffer* input,
+                                    grpc_slice_buffer* output) {
+#ifdef HAVE_LIBZSTD
+  ZSTD_CCtx* cctx = nullptr;
+  {
+    MutexLock lock(&mu_);
+    if (!free_cctxs_.empty()) {
+      cctx = free_cctxs_.back();
+      free_cctxs_.pop_back();
+    }
+  }
+  if (cctx == nullptr) {
+    cctx = ZSTD_createCCtx();
+    GPR_ASSERT(cctx != nullptr);
+  }
+  if (level < GRPC_COMPRESS_LEVEL_NONE || level >= GRPC_COMPRESS_LEVEL_COUNT) {
+    level = GRPC_COMPRESS_LEVEL_NONE;
+  }
+  ZSTD_CCtx_refCDict(cctx, dictionary.cdicts_[level]);
+  const bool compressed = grpc_msg_compress_zstd(cctx, input, output) != 0;
+  {
+    MutexLock lock(&mu_);
+    if (free_cctxs_.size() < kMaxCachedContexts) {
+      free_cctxs_.push_back(cctx);
+      cctx = nullptr;
+    }
+  }
+  ZSTD_freeCCtx(cctx);
+  if (!compressed) CopyInput(input, output);
+  return compressed;
+#else
+  (void)dictionary;
+  (void)level;
+  CopyInput(input, output);
+  return false;
+#endif
+}
+
+bool DictionaryCompressor::Decompress(const CompressionDictionary& dictionary,
+                                      grpc_slice_buffer* input,
+                                      grpc_slice_buffer* output) {
+#ifdef HAVE_LIBZSTD
+  ZSTD_DCtx* dctx = nullptr;
+  {
+    MutexLock lock(&mu_);
+    if (!free_dctxs_.empty()) {
+      dctx = free_dctxs_.back();
+      free_dctxs_.pop_back();
+    }
+  }
+  if (dctx == nullptr) {
+    dctx = ZSTD_createDCtx();
+    GPR_ASSERT(dctx != nullptr);
+  }
+  // A bound dictionary changes how any frame decodes, so only bind it for
+  // frames that were compressed with it; frames naming some other dictionary
+  // fail either way.
+  ZSTD_DCtx_refDDict(dctx, FrameDictionaryId(input) == dictionary.id()
+                               ? dictionary.ddict_
+                               : nullptr);
+  const bool decompressed = grpc_msg_decompress_zstd(dctx, input, output) != 0;
+  {
+    MutexLock lock(&mu_);
+    if (free_dctxs_.size() < kMaxCachedContexts) {
+      free_dctxs_.push_back(dctx);
+      dctx = nullptr;
+    }
+  }
+  ZSTD_freeDCtx(dctx);
+  return decompressed;
+#else
+  (void)dictionary;
+  (void)input;
+  (void)output;
+  return false;
+#endif
+}
+
+}  // namespace grpc_core
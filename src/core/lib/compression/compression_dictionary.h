@@ -0,0 +1,126 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_COMPRESSION_COMPRESSION_DICTIONARY_H
+#define GRPC_SRC_CORE_LIB_COMPRESSION_COMPRESSION_DICTIONARY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/impl/compression_types.h>
+#include <grpc/slice_buffer.h>
+
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+
+#ifdef HAVE_LIBZSTD
+#include <zstd.h>
+#endif
+
+namespace grpc_core {
+
+// A zstd dictionary (as produced by `zstd --train`), digested once so that
+// compressing a message with it only pays for binding it to a context.
+// Peers agree on a dictionary by the ID embedded in it.
+class CompressionDictionary : public RefCounted<CompressionDictionary> {
+ public:
+  // Fails if zstd is not compiled in, or if data is not a zstd dictionary
+  // with a non-zero ID.
+  static absl::StatusOr<RefCountedPtr<CompressionDictionary>> Create(
+      absl::string_view data);
+
+  ~CompressionDictionary() override;
+
+  CompressionDictionary(const CompressionDictionary&) = delete;
+  CompressionDictionary& operator=(const CompressionDictionary&) = delete;
+
+  uint32_t id() const { return id_; }
+
+ private:
+  friend class DictionaryCompressor;
+
+  explicit CompressionDictionary(uint32_t id) : id_(id) {}
+
+  const uint32_t id_;
+#ifdef HAVE_LIBZSTD
+  // One digested copy per compression level, indexed by
+  // grpc_compression_level.
+  ZSTD_CDict* cdicts_[GRPC_COMPRESS_LEVEL_COUNT] = {};
+  ZSTD_DDict* ddict_ = nullptr;
+#endif
+};
+
+// The dictionaries a server is willing to use, keyed by ID.
+// Passed to the server compression filter as a channel arg.
+class CompressionDictionarySet : public RefCounted<CompressionDictionarySet> {
+ public:
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.compression_dictionaries";
+  }
+  static int ChannelArgsCompare(const CompressionDictionarySet* a,
+                                const CompressionDictionarySet* b) {
+    return QsortCompare(a, b);
+  }
+
+  void Add(RefCountedPtr<CompressionDictionary> dictionary);
+  // Returns nullptr if there is no dictionary with this ID.
+  const CompressionDictionary* Find(uint32_t id) const;
+
+ private:
+  absl::flat_hash_map<uint32_t, RefCountedPtr<CompressionDictionary>>
+      dictionaries_;
+};
+
+// Compresses and decompresses messages with a dictionary, keeping zstd
+// contexts alive between messages so that their setup is paid once per
+// connection rather than once per message. Thread safe.
+class DictionaryCompressor {
+ public:
+  DictionaryCompressor() = default;
+  ~DictionaryCompressor();
+
+  DictionaryCompressor(const DictionaryCompressor&) = delete;
+  DictionaryCompressor& operator=(const DictionaryCompressor&) = delete;
+
+  // Same contract as grpc_msg_compress_with_level.
+  bool Compress(const CompressionDictionary& dictionary,
+                grpc_compression_level level, grpc_slice_buffer* input,
+                grpc_slice_buffer* output);
+  // Same contract as grpc_msg_decompress. Also accepts frames compressed
+  // without a dictionary.
+  bool Decompress(const CompressionDictionary& dictionary,
+                  grpc_slice_buffer* input, grpc_slice_buffer* output);
+
+ private:
+#ifdef HAVE_LIBZSTD
+  // Contexts not currently in use by a message.
+  Mutex mu_;
+  std::vector<ZSTD_CCtx*> free_cctxs_ ABSL_GUARDED_BY(mu_);
+  std::vector<ZSTD_DCtx*> free_dctxs_ ABSL_GUARDED_BY(mu_);
+#endif
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_COMPRESSION_COMPRESSION_DICTIONARY_H
@@ -47,6 +47,10 @@ const char* CompressionAlgorithmAsString(grpc_compression_algorithm algorithm) {
       return "deflate";
     case GRPC_COMPRESS_GZIP:
       return "gzip";
+    case GRPC_COMPRESS_ZSTD:
+      return "zstd";
+    case GRPC_COMPRESS_LZ4:
+      return "lz4";
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
     default:
       return nullptr;
@@ -87,7 +91,7 @@ class CommaSeparatedLists {
  private:
   static constexpr size_t kNumLists = 1 << GRPC_COMPRESS_ALGORITHMS_COUNT;
   // Experimentally determined (tweak things until it runs).
-  static constexpr size_t kTextBufferSize = 86;
+  static constexpr size_t kTextBufferSize = 514;
   absl::string_view lists_[kNumLists];
   char text_buffer_[kTextBufferSize];
 };
@@ -95,6 +99,30 @@ class CommaSeparatedLists {
 const CommaSeparatedLists kCommaSeparatedLists;
 }  // namespace
 
+bool IsCompressionAlgorithmSupported(grpc_compression_algorithm algorithm) {
+  switch (algorithm) {
+    case GRPC_COMPRESS_NONE:
+    case GRPC_COMPRESS_DEFLATE:
+    case GRPC_COMPRESS_GZIP:
+      return true;
+    case GRPC_COMPRESS_ZSTD:
+#ifdef HAVE_LIBZSTD
+      return true;
+#else
+      return false;
+#endif
+    case GRPC_COMPRESS_LZ4:
+#ifdef HAVE_LIBLZ4
+      return true;
+#else
+      return false;
+#endif
+    case GRPC_COMPRESS_ALGORITHMS_COUNT:
+    default:
+      return false;
+  }
+}
+
 absl::optional<grpc_compression_algorithm> ParseCompressionAlgorithm(
     absl::string_view algorithm) {
   if (algorithm == "identity") {
@@ -103,6 +131,10 @@ absl::optional<grpc_compression_algorithm> ParseCompressionAlgorithm(
     return GRPC_COMPRESS_DEFLATE;
   } else if (algorithm == "gzip") {
     return GRPC_COMPRESS_GZIP;
+  } else if (algorithm == "zstd") {
+    return GRPC_COMPRESS_ZSTD;
+  } else if (algorithm == "lz4") {
+    return GRPC_COMPRESS_LZ4;
   } else {
     return absl::nullopt;
   }
@@ -128,11 +160,14 @@ CompressionAlgorithmSet::CompressionAlgorithmForLevel(
   // compression.
   // This is simplistic and we will probably want to introduce other dimensions
   // in the future (cpu/memory cost, etc).
+  // Algorithms this binary has no codec for are skipped even if the peer
+  // accepts them.
   absl::InlinedVector<grpc_compression_algorithm,
                       GRPC_COMPRESS_ALGORITHMS_COUNT>
       algos;
-  for (auto algo : {GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE}) {
-    if (set_.is_set(algo)) {
+  for (auto algo : {GRPC_COMPRESS_LZ4, GRPC_COMPRESS_GZIP,
+                    GRPC_COMPRESS_DEFLATE, GRPC_COMPRESS_ZSTD}) {
+    if (set_.is_set(algo) && IsCompressionAlgorithmSupported(algo)) {
       algos.push_back(algo);
     }
   }
@@ -170,9 +205,17 @@ CompressionAlgorithmSet CompressionAlgorithmSet::FromChannelArgs(
   CompressionAlgorithmSet set;
   static const uint32_t kEverything =
       (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1;
-  return CompressionAlgorithmSet::FromUint32(
+  uint32_t value =
       args.GetInt(GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET)
-          .value_or(kEverything));
+          .value_or(kEverything);
+  // Never advertise an algorithm we cannot decompress.
+  for (size_t i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    if (!IsCompressionAlgorithmSupported(
+            static_cast<grpc_compression_algorithm>(i))) {
+      value &= ~(1u << i);
+    }
+  }
+  return CompressionAlgorithmSet::FromUint32(value);
 }
 
 CompressionAlgorithmSet::CompressionAlgorithmSet() = default;
@@ -43,6 +43,9 @@ absl::optional<grpc_compression_algorithm> ParseCompressionAlgorithm(
 // Convert a compression algorithm to a string. Returns nullptr if a name is not
 // known.
 const char* CompressionAlgorithmAsString(grpc_compression_algorithm algorithm);
+// Return true if this binary was built with a codec for algorithm.
+// zstd and lz4 are optional dependencies, everything else is always present.
+bool IsCompressionAlgorithmSupported(grpc_compression_algorithm algorithm);
 // Retrieve the default compression algorithm from channel args, return nullopt
 // if not found.
 absl::optional<grpc_compression_algorithm>
@@ -25,13 +25,23 @@
 #include <zconf.h>
 #include <zlib.h>
 
+#ifdef HAVE_LIBZSTD
+#include <zstd.h>
+#endif
+#ifdef HAVE_LIBLZ4
+#include <lz4frame.h>
+#include <lz4hc.h>
+#endif
+
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/slice/slice.h"
 
 #define OUTPUT_BLOCK_SIZE 1024
+#define MAX_OUTPUT_BLOCK_SIZE (64 * 1024)
 
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
@@ -93,27 +103,42 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
-static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
+// Drop anything appended to output since it held count_before slices.
+static void truncate_output(grpc_slice_buffer* output, size_t count_before,
+                            size_t length_before) {
+  for (size_t i = count_before; i < output->count; i++) {
+    grpc_core::CSliceUnref(output->slices[i]);
+  }
+  output->count = count_before;
+  output->length = length_before;
+}
+
+static int zlib_level(grpc_compression_level level) {
+  switch (level) {
+    case GRPC_COMPRESS_LEVEL_LOW:
+      return Z_BEST_SPEED;
+    case GRPC_COMPRESS_LEVEL_HIGH:
+      return Z_BEST_COMPRESSION;
+    default:
+      return Z_DEFAULT_COMPRESSION;
+  }
+}
+
+static int zlib_compress(grpc_compression_level level,
+                         grpc_slice_buffer* input, grpc_slice_buffer* output,
                          int gzip) {
   z_stream zs;
   int r;
-  size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
   memset(&zs, 0, sizeof(zs));
   zs.zalloc = zalloc_gpr;
   zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
+  r = deflateInit2(&zs, zlib_level(level), Z_DEFLATED, 15 | (gzip ? 16 : 0), 8,
+                   Z_DEFAULT_STRATEGY);
   GPR_ASSERT(r == Z_OK);
   r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_core::CSliceUnref(output->slices[i]);
-    }
-    output->count = count_before;
-    output->length = length_before;
-  }
+  if (!r) truncate_output(output, count_before, length_before);
   deflateEnd(&zs);
   return r;
 }
@@ -122,7 +147,6 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
                            int gzip) {
   z_stream zs;
   int r;
-  size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
   memset(&zs, 0, sizeof(zs));
@@ -131,17 +155,362 @@ static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
   r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
   GPR_ASSERT(r == Z_OK);
   r = zlib_body(&zs, input, output, inflate);
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_core::CSliceUnref(output->slices[i]);
+  if (!r) truncate_output(output, count_before, length_before);
+  inflateEnd(&zs);
+  return r;
+}
+
+// The bytes that end every sync flush, which the deflate stream compressor
+// leaves out of its messages.
+static const uint8_t kSyncFlushTail[] = {0x00, 0x00, 0xff, 0xff};
+
+// Like zlib_body, but feeds the input and then tail_len bytes of tail to
+// flate, ending with a sync flush rather than with the end of the stream.
+static int zlib_sync_flush_body(z_stream* zs, grpc_slice_buffer* input,
+                                const uint8_t* tail, size_t tail_len,
+                                grpc_slice_buffer* output,
+                                int (*flate)(z_stream* zs, int flush)) {
+  const uInt uint_max = ~uInt{0};
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  zs->avail_out = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
+  zs->next_out = GRPC_SLICE_START_PTR(outbuf);
+  // Chunk input->count is the tail, which may be empty: it is always fed,
+  // so that there is always a flush.
+  for (size_t i = 0; i <= input->count; i++) {
+    const bool last = i == input->count;
+    const size_t length =
+        last ? tail_len : GRPC_SLICE_LENGTH(input->slices[i]);
+    GPR_ASSERT(length <= uint_max);
+    zs->avail_in = static_cast<uInt>(length);
+    zs->next_in = last ? const_cast<uint8_t*>(tail)
+                       : GRPC_SLICE_START_PTR(input->slices[i]);
+    do {
+      if (zs->avail_out == 0) {
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+        zs->avail_out = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
+        zs->next_out = GRPC_SLICE_START_PTR(outbuf);
+      }
+      int r = flate(zs, last ? Z_SYNC_FLUSH : Z_NO_FLUSH);
+      // The sender never ends the stream, so Z_STREAM_END is an error too.
+      if ((r < 0 && r != Z_BUF_ERROR /* not fatal */) || r == Z_STREAM_END) {
+        gpr_log(GPR_INFO, "zlib error (%d)", r);
+        grpc_core::CSliceUnref(outbuf);
+        return 0;
+      }
+    } while (zs->avail_out == 0);
+    if (zs->avail_in) {
+      gpr_log(GPR_INFO, "zlib: not all input consumed");
+      grpc_core::CSliceUnref(outbuf);
+      return 0;
     }
-    output->count = count_before;
-    output->length = length_before;
   }
-  inflateEnd(&zs);
+  GPR_ASSERT(outbuf.refcount);
+  outbuf.data.refcounted.length -= zs->avail_out;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  return 1;
+}
+
+namespace grpc_core {
+
+DeflateStreamCompressor::~DeflateStreamCompressor() {
+  if (zs_ == nullptr) return;
+  deflateEnd(zs_);
+  delete zs_;
+}
+
+bool DeflateStreamCompressor::Compress(grpc_compression_level level,
+                                       grpc_slice_buffer* input,
+                                       grpc_slice_buffer* output) {
+  if (failed_) return false;
+  if (zs_ == nullptr) {
+    zs_ = new z_stream();
+    zs_->zalloc = zalloc_gpr;
+    zs_->zfree = zfree_gpr;
+    // Raw deflate: the zlib header would only be useful once per stream.
+    int r = deflateInit2(zs_, zlib_level(level), Z_DEFLATED, -15, 8,
+                         Z_DEFAULT_STRATEGY);
+    GPR_ASSERT(r == Z_OK);
+  }
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  if (!zlib_sync_flush_body(zs_, input, nullptr, 0, output, deflate) ||
+      output->length - length_before < sizeof(kSyncFlushTail)) {
+    truncate_output(output, count_before, length_before);
+    failed_ = true;
+    return false;
+  }
+  grpc_slice_buffer_trim_end(output, sizeof(kSyncFlushTail), nullptr);
+  return true;
+}
+
+DeflateStreamDecompressor::~DeflateStreamDecompressor() {
+  if (zs_ == nullptr) return;
+  inflateEnd(zs_);
+  delete zs_;
+}
+
+bool DeflateStreamDecompressor::Decompress(grpc_slice_buffer* input,
+                                           grpc_slice_buffer* output) {
+  if (failed_) return false;
+  if (zs_ == nullptr) {
+    zs_ = new z_stream();
+    zs_->zalloc = zalloc_gpr;
+    zs_->zfree = zfree_gpr;
+    int r = inflateInit2(zs_, -15);
+    GPR_ASSERT(r == Z_OK);
+  }
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  if (!zlib_sync_flush_body(zs_, input, kSyncFlushTail, sizeof(kSyncFlushTail),
+                            output, inflate)) {
+    truncate_output(output, count_before, length_before);
+    failed_ = true;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace grpc_core
+
+#if defined(HAVE_LIBZSTD) || defined(HAVE_LIBLZ4)
+// Output slices of the zstd and lz4 codecs grow with the input, so that large
+// messages are not produced in many small pieces.
+static grpc_slice alloc_output_block(size_t input_length) {
+  return GRPC_SLICE_MALLOC(grpc_core::Clamp<size_t>(
+      2 * input_length, OUTPUT_BLOCK_SIZE, MAX_OUTPUT_BLOCK_SIZE));
+}
+
+// Append the first used bytes of outbuf to output, taking ownership of it.
+static void add_output_block(grpc_slice_buffer* output, grpc_slice outbuf,
+                             size_t used) {
+  GPR_ASSERT(outbuf.refcount);
+  outbuf.data.refcounted.length = used;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+}
+#endif
+
+#ifdef HAVE_LIBZSTD
+int grpc_zstd_compression_level(grpc_compression_level level) {
+  switch (level) {
+    case GRPC_COMPRESS_LEVEL_LOW:
+      return 1;
+    case GRPC_COMPRESS_LEVEL_HIGH:
+      return 9;
+    default:
+      return ZSTD_CLEVEL_DEFAULT;
+  }
+}
+
+int grpc_msg_compress_zstd(ZSTD_CCtx* cctx, grpc_slice_buffer* input,
+                           grpc_slice_buffer* output) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  // Records the size in the frame header so the receiver can size its output.
+  ZSTD_CCtx_setPledgedSrcSize(cctx, input->length);
+  int r = 1;
+  grpc_slice outbuf = alloc_output_block(input->length);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf),
+                        0};
+  for (size_t i = 0; r && i < input->count; i++) {
+    const bool last = i == input->count - 1;
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    size_t remaining;
+    do {
+      if (out.pos == out.size) {
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = alloc_output_block(input->length);
+        out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf), 0};
+      }
+      remaining = ZSTD_compressStream2(cctx, &out, &in,
+                                       last ? ZSTD_e_end : ZSTD_e_continue);
+      if (ZSTD_isError(remaining)) {
+        gpr_log(GPR_INFO, "zstd error: %s", ZSTD_getErrorName(remaining));
+        r = 0;
+        break;
+      }
+    } while (last ? remaining != 0 : in.pos < in.size);
+  }
+  if (r) {
+    add_output_block(output, outbuf, out.pos);
+    r = output->length - length_before < input->length;
+  } else {
+    grpc_core::CSliceUnref(outbuf);
+  }
+  if (!r) {
+    truncate_output(output, count_before, length_before);
+    // Leave the context ready for the next message.
+    ZSTD_CCtx_reset(cctx, ZSTD_reset_session_only);
+  }
+  return r;
+}
+
+int grpc_msg_decompress_zstd(ZSTD_DCtx* dctx, grpc_slice_buffer* input,
+                             grpc_slice_buffer* output) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  int r = 1;
+  // Non-zero until a whole frame has been decoded and flushed.
+  size_t remaining = 1;
+  grpc_slice outbuf = alloc_output_block(input->length);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf),
+                        0};
+  for (size_t i = 0; r && i < input->count; i++) {
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    // A full output buffer may mean the decoder still holds more output.
+    do {
+      if (out.pos == out.size) {
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = alloc_output_block(input->length);
+        out = {GRPC_SLICE_START_PTR(outbuf), GRPC_SLICE_LENGTH(outbuf), 0};
+      }
+      remaining = ZSTD_decompressStream(dctx, &out, &in);
+      if (ZSTD_isError(remaining)) {
+        gpr_log(GPR_INFO, "zstd error: %s", ZSTD_getErrorName(remaining));
+        r = 0;
+        break;
+      }
+    } while (in.pos < in.size || out.pos == out.size);
+  }
+  if (r && remaining != 0) {
+    gpr_log(GPR_INFO, "zstd: truncated frame");
+    r = 0;
+  }
+  if (r) {
+    add_output_block(output, outbuf, out.pos);
+  } else {
+    grpc_core::CSliceUnref(outbuf);
+    truncate_output(output, count_before, length_before);
+    ZSTD_DCtx_reset(dctx, ZSTD_reset_session_only);
+  }
+  return r;
+}
+
+static int zstd_compress(grpc_compression_level level,
+                         grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  ZSTD_CCtx* cctx = ZSTD_createCCtx();
+  GPR_ASSERT(cctx != nullptr);
+  ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel,
+                         grpc_zstd_compression_level(level));
+  int r = grpc_msg_compress_zstd(cctx, input, output);
+  ZSTD_freeCCtx(cctx);
   return r;
 }
 
+static int zstd_decompress(grpc_slice_buffer* input,
+                           grpc_slice_buffer* output) {
+  ZSTD_DCtx* dctx = ZSTD_createDCtx();
+  GPR_ASSERT(dctx != nullptr);
+  int r = grpc_msg_decompress_zstd(dctx, input, output);
+  ZSTD_freeDCtx(dctx);
+  return r;
+}
+#endif  // HAVE_LIBZSTD
+
+#ifdef HAVE_LIBLZ4
+static int lz4_level(grpc_compression_level level) {
+  switch (level) {
+    case GRPC_COMPRESS_LEVEL_LOW:
+      // Negative levels trade ratio for speed (acceleration).
+      return -1;
+    case GRPC_COMPRESS_LEVEL_HIGH:
+      return LZ4HC_CLEVEL_DEFAULT;
+    default:
+      return 0;
+  }
+}
+
+static int lz4_compress(grpc_compression_level level, grpc_slice_buffer* input,
+                        grpc_slice_buffer* output) {
+  LZ4F_preferences_t prefs;
+  memset(&prefs, 0, sizeof(prefs));
+  prefs.frameInfo.contentSize = input->length;
+  prefs.compressionLevel = lz4_level(level);
+  LZ4F_cctx* cctx;
+  GPR_ASSERT(!LZ4F_isError(LZ4F_createCompressionContext(&cctx, LZ4F_VERSION)));
+  // The bound covers every update plus the frame header and footer, so a
+  // single output slice always suffices.
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(
+      LZ4F_HEADER_SIZE_MAX + LZ4F_compressBound(input->length, &prefs));
+  uint8_t* dst = GRPC_SLICE_START_PTR(outbuf);
+  const size_t capacity = GRPC_SLICE_LENGTH(outbuf);
+  size_t pos = LZ4F_compressBegin(cctx, dst, capacity, &prefs);
+  int r = !LZ4F_isError(pos);
+  for (size_t i = 0; r && i < input->count; i++) {
+    size_t n = LZ4F_compressUpdate(cctx, dst + pos, capacity - pos,
+                                   GRPC_SLICE_START_PTR(input->slices[i]),
+                                   GRPC_SLICE_LENGTH(input->slices[i]),
+                                   nullptr);
+    r = !LZ4F_isError(n);
+    if (r) pos += n;
+  }
+  if (r) {
+    size_t n = LZ4F_compressEnd(cctx, dst + pos, capacity - pos, nullptr);
+    r = !LZ4F_isError(n);
+    if (r) pos += n;
+  }
+  if (r && pos < input->length) {
+    add_output_block(output, outbuf, pos);
+  } else {
+    r = 0;
+    grpc_core::CSliceUnref(outbuf);
+  }
+  LZ4F_freeCompressionContext(cctx);
+  return r;
+}
+
+static int lz4_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  LZ4F_dctx* dctx;
+  GPR_ASSERT(
+      !LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION)));
+  int r = 1;
+  // Non-zero until a whole frame has been decoded and flushed.
+  size_t remaining = 1;
+  grpc_slice outbuf = alloc_output_block(input->length);
+  size_t pos = 0;
+  for (size_t i = 0; r && i < input->count; i++) {
+    const uint8_t* src = GRPC_SLICE_START_PTR(input->slices[i]);
+    size_t src_left = GRPC_SLICE_LENGTH(input->slices[i]);
+    // A full output buffer may mean the decoder still holds more output.
+    do {
+      if (pos == GRPC_SLICE_LENGTH(outbuf)) {
+        grpc_slice_buffer_add_indexed(output, outbuf);
+        outbuf = alloc_output_block(input->length);
+        pos = 0;
+      }
+      size_t dst_size = GRPC_SLICE_LENGTH(outbuf) - pos;
+      size_t src_size = src_left;
+      remaining = LZ4F_decompress(dctx, GRPC_SLICE_START_PTR(outbuf) + pos,
+                                  &dst_size, src, &src_size, nullptr);
+      if (LZ4F_isError(remaining)) {
+        gpr_log(GPR_INFO, "lz4 error: %s", LZ4F_getErrorName(remaining));
+        r = 0;
+        break;
+      }
+      pos += dst_size;
+      src += src_size;
+      src_left -= src_size;
+    } while (src_left > 0 || pos == GRPC_SLICE_LENGTH(outbuf));
+  }
+  if (r && remaining != 0) {
+    gpr_log(GPR_INFO, "lz4: truncated frame");
+    r = 0;
+  }
+  if (r) {
+    add_output_block(output, outbuf, pos);
+  } else {
+    grpc_core::CSliceUnref(outbuf);
+    truncate_output(output, count_before, length_before);
+  }
+  LZ4F_freeDecompressionContext(dctx);
+  return r;
+}
+#endif  // HAVE_LIBLZ4
+
 static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   size_t i;
   for (i = 0; i < input->count; i++) {
@@ -151,6 +520,7 @@ static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
 }
 
 static int compress_inner(grpc_compression_algorithm algorithm,
+                          grpc_compression_level level,
                           grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
@@ -158,9 +528,21 @@ static int compress_inner(grpc_compression_algorithm algorithm,
       // rely on that here
       return 0;
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_compress(input, output, 0);
+      return zlib_compress(level, input, output, 0);
     case GRPC_COMPRESS_GZIP:
-      return zlib_compress(input, output, 1);
+      return zlib_compress(level, input, output, 1);
+    case GRPC_COMPRESS_ZSTD:
+#ifdef HAVE_LIBZSTD
+      return zstd_compress(level, input, output);
+#else
+      break;
+#endif
+    case GRPC_COMPRESS_LZ4:
+#ifdef HAVE_LIBLZ4
+      return lz4_compress(level, input, output);
+#else
+      break;
+#endif
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -170,7 +552,15 @@ static int compress_inner(grpc_compression_algorithm algorithm,
 
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output) {
-  if (!compress_inner(algorithm, input, output)) {
+  return grpc_msg_compress_with_level(algorithm, GRPC_COMPRESS_LEVEL_NONE,
+                                      input, output);
+}
+
+int grpc_msg_compress_with_level(grpc_compression_algorithm algorithm,
+                                 grpc_compression_level level,
+                                 grpc_slice_buffer* input,
+                                 grpc_slice_buffer* output) {
+  if (!compress_inner(algorithm, level, input, output)) {
     copy(input, output);
     return 0;
   }
@@ -186,6 +576,18 @@ int grpc_msg_decompress(grpc_compression_algorithm algorithm,
       return zlib_decompress(input, output, 0);
     case GRPC_COMPRESS_GZIP:
       return zlib_decompress(input, output, 1);
+    case GRPC_COMPRESS_ZSTD:
+#ifdef HAVE_LIBZSTD
+      return zstd_decompress(input, output);
+#else
+      break;
+#endif
+    case GRPC_COMPRESS_LZ4:
+#ifdef HAVE_LIBLZ4
+      return lz4_decompress(input, output);
+#else
+      break;
+#endif
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
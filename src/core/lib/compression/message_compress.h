@@ -30,10 +30,89 @@
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+// As grpc_msg_compress, but with 'level' mapped onto the codec's own effort
+// setting. GRPC_COMPRESS_LEVEL_NONE selects the codec's default, which is
+// what grpc_msg_compress uses.
+int grpc_msg_compress_with_level(grpc_compression_algorithm algorithm,
+                                 grpc_compression_level level,
+                                 grpc_slice_buffer* input,
+                                 grpc_slice_buffer* output);
+
+#ifdef HAVE_LIBZSTD
+#include <zstd.h>
+
+// The zstd level used for 'level'.
+int grpc_zstd_compression_level(grpc_compression_level level);
+
+// Compress 'input' to 'output' as one zstd frame using a context that has
+// already been configured (level, dictionary, ...). Same contract as
+// grpc_msg_compress, except that output is left unchanged on failure.
+// cctx is ready for the next message afterwards.
+int grpc_msg_compress_zstd(ZSTD_CCtx* cctx, grpc_slice_buffer* input,
+                           grpc_slice_buffer* output);
+
+// Decompress zstd frames from 'input' to 'output' using a context that has
+// already been configured. Same contract as grpc_msg_decompress.
+int grpc_msg_decompress_zstd(ZSTD_DCtx* dctx, grpc_slice_buffer* input,
+                             grpc_slice_buffer* output);
+#endif  // HAVE_LIBZSTD
+
 // decompress 'input' to 'output' using 'algorithm'.
 // On success, appends slices to output and returns 1.
 // On failure, output is unchanged, and returns 0.
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+struct z_stream_s;
+
+namespace grpc_core {
+
+// Deflates the messages that one side of a stream sends with a single
+// context, so that each message is compressed against those before it.
+// Each message ends with a sync flush, so the receiver can inflate it as soon
+// as it arrives. The empty block that the flush ends with is left out, as
+// in the WebSocket permessage-deflate extension. Messages must be
+// compressed one at a time, in the order they are sent.
+class DeflateStreamCompressor {
+ public:
+  DeflateStreamCompressor() = default;
+  ~DeflateStreamCompressor();
+
+  DeflateStreamCompressor(const DeflateStreamCompressor&) = delete;
+  DeflateStreamCompressor& operator=(const DeflateStreamCompressor&) = delete;
+
+  // Appends the compressed message to output and returns true, whether or
+  // not it is smaller: the receiver must see every message that went
+  // through the context. level is taken from the first message. On
+  // failure, output is unchanged, and this and all later messages have to
+  // be sent uncompressed.
+  bool Compress(grpc_compression_level level, grpc_slice_buffer* input,
+                grpc_slice_buffer* output);
+
+ private:
+  z_stream_s* zs_ = nullptr;
+  bool failed_ = false;
+};
+
+// Inflates the messages of a DeflateStreamCompressor, in order.
+class DeflateStreamDecompressor {
+ public:
+  DeflateStreamDecompressor() = default;
+  ~DeflateStreamDecompressor();
+
+  DeflateStreamDecompressor(const DeflateStreamDecompressor&) = delete;
+  DeflateStreamDecompressor& operator=(const DeflateStreamDecompressor&) =
+      delete;
+
+  // Same contract as grpc_msg_decompress. Once it fails, later messages
+  // can't be decompressed either.
+  bool Decompress(grpc_slice_buffer* input, grpc_slice_buffer* output);
+
+ private:
+  z_stream_s* zs_ = nullptr;
+  bool failed_ = false;
+};
+
+}  // namespace grpc_core
+
 #endif  // GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
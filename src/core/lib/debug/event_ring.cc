@@ -0,0 +1,199 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/debug/event_ring.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/gprpp/global_config.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_event_ring_sample_rate, 256,
+    "One in how many hot path events (call start and finish, frame reads and "
+    "writes, timer fires, poller wakeups) each thread keeps in the in-memory "
+    "event ring. 0 disables it.");
+
+namespace grpc_core {
+
+namespace {
+
+// Not yet read from GRPC_EVENT_RING_SAMPLE_RATE.
+constexpr uint32_t kSampleRateUnset = std::numeric_limits<uint32_t>::max();
+
+// Each slot is written with relaxed stores and then published by storing the
+// position it was written at, plus one, to seq. Readers check that seq did
+// not move while they copied the slot out, so that a slot overwritten under
+// them is skipped rather than returned torn.
+struct Slot {
+  std::atomic<uint64_t> seq{0};
+  std::atomic<uint64_t> when{0};
+  std::atomic<uint64_t> what{0};
+  std::atomic<uint64_t> arg{0};
+};
+
+struct Ring {
+  std::atomic<uint64_t> next{0};
+  Slot slots[EventRing::kEntriesPerCpu];
+};
+
+class Rings {
+ public:
+  Ring& Get(uint32_t cpu) { return rings_[cpu % cpus_]; }
+  Ring* begin() { return rings_.get(); }
+  Ring* end() { return rings_.get() + cpus_; }
+
+ private:
+  const uint32_t cpus_ = gpr_cpu_num_cores();
+  std::unique_ptr<Ring[]> rings_{new Ring[cpus_]};
+};
+
+Rings& GetRings() {
+  static NoDestruct<Rings> rings;
+  return *rings;
+}
+
+uint64_t CycleCounterBits(gpr_cycle_counter when) {
+  uint64_t bits = 0;
+  static_assert(sizeof(when) == sizeof(bits), "unexpected cycle counter size");
+  memcpy(&bits, &when, sizeof(bits));
+  return bits;
+}
+
+gpr_cycle_counter CycleCounterFromBits(uint64_t bits) {
+  gpr_cycle_counter when;
+  memcpy(&when, &bits, sizeof(bits));
+  return when;
+}
+
+}  // namespace
+
+std::atomic<uint32_t> EventRing::sample_rate_{kSampleRateUnset};
+thread_local uint32_t EventRing::sample_countdown_ = 1;
+
+void EventRing::SetSampleRate(uint32_t one_in) {
+  sample_rate_.store(one_in, std::memory_order_relaxed);
+}
+
+void EventRing::RecordSampled(Event event, uint64_t arg) {
+  uint32_t rate = sample_rate_.load(std::memory_order_relaxed);
+  if (GPR_UNLIKELY(rate == kSampleRateUnset)) {
+    rate = static_cast<uint32_t>(
+        std::max(0, GPR_GLOBAL_CONFIG_GET(grpc_event_ring_sample_rate)));
+    uint32_t expected = kSampleRateUnset;
+    if (!sample_rate_.compare_exchange_strong(expected, rate,
+                                              std::memory_order_relaxed)) {
+      rate = expected;
+    }
+  }
+  if (rate == 0) {
+    sample_countdown_ = kDisabledRecheckInterval;
+    return;
+  }
+  sample_countdown_ = rate;
+  const uint32_t cpu = gpr_cpu_current_cpu();
+  Ring& ring = GetRings().Get(cpu);
+  const uint64_t pos = ring.next.fetch_add(1, std::memory_order_relaxed);
+  Slot& slot = ring.slots[pos % kEntriesPerCpu];
+  slot.seq.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.when.store(CycleCounterBits(gpr_get_cycle_counter()),
+                  std::memory_order_relaxed);
+  slot.what.store((static_cast<uint64_t>(cpu) << 8) |
+                      static_cast<uint64_t>(event),
+                  std::memory_order_relaxed);
+  slot.arg.store(arg, std::memory_order_relaxed);
+  slot.seq.store(pos + 1, std::memory_order_release);
+}
+
+std::vector<EventRing::Entry> EventRing::Snapshot() {
+  std::vector<Entry> entries;
+  for (Ring& ring : GetRings()) {
+    const uint64_t next = ring.next.load(std::memory_order_acquire);
+    const uint64_t first = next > kEntriesPerCpu ? next - kEntriesPerCpu : 0;
+    for (uint64_t pos = first; pos < next; ++pos) {
+      Slot& slot = ring.slots[pos % kEntriesPerCpu];
+      if (slot.seq.load(std::memory_order_acquire) != pos + 1) continue;
+      const uint64_t when = slot.when.load(std::memory_order_relaxed);
+      const uint64_t what = slot.what.load(std::memory_order_relaxed);
+      const uint64_t arg = slot.arg.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) != pos + 1) continue;
+      entries.push_back({CycleCounterFromBits(when),
+                         static_cast<Event>(what & 0xff),
+                         static_cast<uint32_t>(what >> 8), arg});
+    }
+  }
+  std::stable_sort(
+      entries.begin(), entries.end(),
+      [](const Entry& a, const Entry& b) { return a.when < b.when; });
+  return entries;
+}
+
+std::string EventRing::DumpChromeTrace() {
+  std::vector<Entry> entries = Snapshot();
+  std::string result = "{\"traceEvents\":[";
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const Entry& entry = entries[i];
+    const gpr_timespec since_first =
+        gpr_cycle_counter_sub(entry.when, entries[0].when);
+    // Instant events, one track per CPU.
+    absl::StrAppend(&result, i == 0 ? "" : ",", "{\"name\":\"",
+                    EventName(entry.event),
+                    "\",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":", entry.cpu,
+                    ",\"ts\":", gpr_timespec_to_micros(since_first),
+                    ",\"args\":{\"arg\":", entry.arg, "}}");
+  }
+  absl::StrAppend(&result, "]}");
+  return result;
+}
+
+void EventRing::Clear() {
+  for (Ring& ring : GetRings()) {
+    for (Slot& slot : ring.slots) {
+      slot.seq.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+absl::string_view EventRing::EventName(Event event) {
+  switch (event) {
+    case Event::kCallStart:
+      return "call_start";
+    case Event::kCallFinish:
+      return "call_finish";
+    case Event::kFrameRead:
+      return "frame_read";
+    case Event::kFrameWrite:
+      return "frame_write";
+    case Event::kTimerFire:
+      return "timer_fire";
+    case Event::kPollerWakeup:
+      return "poller_wakeup";
+  }
+  return "unknown";
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,100 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_DEBUG_EVENT_RING_H
+#define GRPC_SRC_CORE_LIB_DEBUG_EVENT_RING_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/gpr/time_precise.h"
+
+namespace grpc_core {
+
+// Always-on record of a sample of hot path events, to diagnose latency
+// problems in production without restarting with GRPC_TRACE flags.
+// Unlike EventLog, which collects every event of a test between two points,
+// this keeps the most recent sampled events in fixed size per-CPU rings of
+// binary entries: recording takes no lock and allocates nothing, and the
+// oldest entries get overwritten.
+// One event in GRPC_EVENT_RING_SAMPLE_RATE is recorded on each thread; a rate
+// of 0 disables recording. Events not sampled cost a thread local decrement.
+class EventRing {
+ public:
+  // Each event comes with an argument, as noted.
+  enum class Event : uint8_t {
+    // 1 for client calls, 0 for server calls.
+    kCallStart,
+    kCallFinish,
+    // Frame type in the upper 32 bits, frame length in the lower ones.
+    kFrameRead,
+    // Number of bytes of frames handed to the endpoint.
+    kFrameWrite,
+    // How late the timer fired, in milliseconds.
+    kTimerFire,
+    // Number of events returned by the poller.
+    kPollerWakeup,
+  };
+
+  struct Entry {
+    gpr_cycle_counter when;
+    Event event;
+    uint32_t cpu;
+    uint64_t arg;
+  };
+
+  static constexpr size_t kEntriesPerCpu = 1024;
+
+  // Records \a event, if this one is sampled.
+  static void Record(Event event, uint64_t arg = 0) {
+    if (GPR_LIKELY(--sample_countdown_ != 0)) return;
+    RecordSampled(event, arg);
+  }
+
+  // Changes the sampling rate, overriding GRPC_EVENT_RING_SAMPLE_RATE.
+  // Threads that were not recording pick the change up within
+  // kDisabledRecheckInterval events.
+  static void SetSampleRate(uint32_t one_in);
+
+  // Returns the recorded events, oldest first. Entries overwritten while the
+  // snapshot is taken are skipped.
+  static std::vector<Entry> Snapshot();
+  // Returns Snapshot() in the Chrome trace event JSON format, which Perfetto
+  // and chrome://tracing load directly.
+  static std::string DumpChromeTrace();
+  // Drops all the recorded events.
+  static void Clear();
+
+  static absl::string_view EventName(Event event);
+
+ private:
+  static constexpr uint32_t kDisabledRecheckInterval = 65536;
+
+  static void RecordSampled(Event event, uint64_t arg);
+
+  static std::atomic<uint32_t> sample_rate_;
+  static thread_local uint32_t sample_countdown_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_DEBUG_EVENT_RING_H
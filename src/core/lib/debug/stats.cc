@@ -20,9 +20,11 @@
 
 #include "src/core/lib/debug/stats.h"
 
+#include <limits.h>
 #include <stddef.h>
 
 #include <algorithm>
+#include <memory>
 #include <vector>
 
 #include "absl/strings/str_cat.h"
@@ -30,6 +32,25 @@
 
 namespace grpc_core {
 
+int MicrosecondsSince(gpr_cycle_counter start) {
+  gpr_timespec elapsed = gpr_cycle_counter_sub(gpr_get_cycle_counter(), start);
+  if (elapsed.tv_sec < 0) return 0;
+  if (elapsed.tv_sec >= INT_MAX / GPR_US_PER_SEC) return INT_MAX;
+  return static_cast<int>(elapsed.tv_sec * GPR_US_PER_SEC +
+                          elapsed.tv_nsec / GPR_NS_PER_US);
+}
+
+GlobalStatsScraper::Snapshot GlobalStatsScraper::Scrape() {
+  Snapshot snapshot;
+  MutexLock lock(&mu_);
+  snapshot.total = global_stats().Collect();
+  snapshot.delta = last_ == nullptr
+                       ? std::make_unique<GlobalStats>(*snapshot.total)
+                       : snapshot.total->Diff(*last_);
+  last_ = std::make_unique<GlobalStats>(*snapshot.total);
+  return snapshot;
+}
+
 namespace stats_detail {
 
 namespace {
@@ -23,15 +23,19 @@
 
 #include <stdint.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 
 #include "src/core/lib/debug/histogram_view.h"
 #include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/sync.h"
 
 namespace grpc_core {
 
@@ -39,6 +43,30 @@ inline GlobalStatsCollector& global_stats() {
   return *NoDestructSingleton<GlobalStatsCollector>::Get();
 }
 
+// Returns the microseconds elapsed since start, a gpr_get_cycle_counter()
+// reading, clamped to [0, INT_MAX]. For recording into the *_us histograms.
+int MicrosecondsSince(gpr_cycle_counter start);
+
+// Takes snapshots of global_stats() for exporters.
+// Each Scrape() returns the totals so far, and the change since the previous
+// Scrape() of the same scraper (the first one reports everything), so each
+// exporter can keep its own scraper. Percentiles of a histogram are
+// available from GlobalStats::histogram(). Collecting only reads the
+// per-CPU shards, and never blocks the threads updating them.
+class GlobalStatsScraper {
+ public:
+  struct Snapshot {
+    std::unique_ptr<GlobalStats> total;
+    std::unique_ptr<GlobalStats> delta;
+  };
+
+  Snapshot Scrape() ABSL_LOCKS_EXCLUDED(mu_);
+
+ private:
+  Mutex mu_;
+  std::unique_ptr<GlobalStats> last_ ABSL_GUARDED_BY(mu_);
+};
+
 namespace stats_detail {
 std::string StatsAsJson(absl::Span<const uint64_t> counters,
                         absl::Span<const absl::string_view> counter_name,
@@ -69,15 +69,24 @@ Histogram_80_10 operator-(const Histogram_80_10& left,
 }
 const absl::string_view
     GlobalStats::counter_name[static_cast<int>(Counter::COUNT)] = {
-        "client_calls_created",    "server_calls_created",
-        "client_channels_created", "client_subchannels_created",
-        "server_channels_created", "insecure_connections_created",
-        "syscall_write",           "syscall_read",
-        "tcp_read_alloc_8k",       "tcp_read_alloc_64k",
-        "http2_settings_writes",   "http2_pings_sent",
-        "http2_writes_begun",      "http2_transport_stalls",
-        "http2_stream_stalls",     "cq_pluck_creates",
-        "cq_next_creates",         "cq_callback_creates",
+        "client_calls_created",          "server_calls_created",
+        "client_channels_created",       "client_subchannels_created",
+        "server_channels_created",       "server_calls_queued",
+        "server_calls_stolen",           "server_calls_rejected",
+        "insecure_connections_created",  "handshakes_shed",
+        "syscall_write",                 "syscall_read",
+        "tcp_read_alloc_8k",             "tcp_read_alloc_64k",
+        "http2_settings_writes",         "http2_pings_sent",
+        "http2_writes_begun",            "http2_write_coalescing_holds",
+        "http2_write_coalescing_merges", "http2_write_coalescing_flushes",
+        "http2_transport_stalls",        "http2_stream_stalls",
+        "cq_pluck_creates",              "cq_next_creates",
+        "cq_callback_creates",           "dns_cache_hits",
+        "dns_cache_misses",              "dns_cache_shared_lookups",
+        "slice_pool_hits",               "slice_pool_misses",
+        "slice_pool_frees",              "call_arenas_chained",
+        "call_arena_chained_zones",      "adaptive_mutex_spin_acquires",
+        "adaptive_mutex_parks",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -86,7 +95,14 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of client channels created",
     "Number of client subchannels created",
     "Number of server channels created",
+    "Number of server calls that waited for the application to request them",
+    "Number of waiting server calls matched by a request made on another CPU "
+    "than the one they were queued on",
+    "Number of server calls rejected by admission control because the server "
+    "was overloaded",
     "Number of insecure connections created",
+    "Number of handshakes failed because the handshake executor was "
+    "overloaded",
     "Number of write syscalls (or equivalent - eg sendmsg) made by this "
     "process",
     "Number of read syscalls (or equivalent - eg recvmsg) made by this process",
@@ -95,6 +111,11 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of settings frames sent",
     "Number of HTTP2 pings sent by process",
     "Number of HTTP2 writes initiated",
+    "Number of HTTP2 writes held back to coalesce them with frames flushed "
+    "later",
+    "Number of flush attempts merged into a held back HTTP2 write",
+    "Number of held back HTTP2 writes started before their budget expired "
+    "because they reached the coalescing byte threshold",
     "Number of times sending was completely stalled by the transport flow "
     "control window",
     "Number of times sending was completely stalled by the stream flow control "
@@ -105,22 +126,52 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "usage)",
     "Number of completion queues created for cq_callback (indicates callback "
     "api usage)",
+    "Number of DNS resolutions served from the process-wide DNS result cache",
+    "Number of DNS resolutions that started a new DNS lookup",
+    "Number of DNS resolutions that waited for a DNS lookup already in flight "
+    "for another channel",
+    "Number of pooled slice allocations that reused an idle block",
+    "Number of pooled slice allocations that allocated a new block",
+    "Number of idle pooled slice blocks freed because the pool was full or the "
+    "resource quota reclaimed memory",
+    "Number of calls whose arena outgrew its initial zone",
+    "Number of zones call arenas allocated beyond their initial zone",
+    "Number of contended AdaptiveMutex acquisitions that got the mutex by "
+    "spinning",
+    "Number of contended AdaptiveMutex acquisitions that parked the thread",
 };
 const absl::string_view GlobalStats::histogram_name[static_cast<int>(
     Histogram::COUNT)] = {
-    "call_initial_size",       "tcp_write_size",      "tcp_write_iov_size",
-    "tcp_read_size",           "tcp_read_offer",      "tcp_read_offer_iov_size",
-    "http2_send_message_size", "http2_metadata_size",
+    "call_initial_size",
+    "client_call_initial_metadata_latency_us",
+    "client_call_latency_us",
+    "tcp_write_size",
+    "tcp_write_iov_size",
+    "tcp_read_size",
+    "tcp_read_offer",
+    "tcp_read_offer_iov_size",
+    "http2_send_message_size",
+    "http2_write_flush_delay_us",
+    "http2_combiner_queue_time_us",
+    "http2_metadata_size",
 };
 const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     Histogram::COUNT)] = {
     "Initial size of the grpc_call arena created at call start",
+    "Microseconds from a client call starting until its initial metadata was "
+    "received",
+    "Microseconds from a client call starting until its trailing metadata was "
+    "received",
     "Number of bytes offered to each syscall_write",
     "Number of byte segments offered to each syscall_write",
     "Number of bytes received by each syscall_read",
     "Number of bytes offered to each syscall_read",
     "Number of byte segments offered to each syscall_read",
     "Size of messages received by HTTP2 transport",
+    "Microseconds from an HTTP2 write being initiated until the endpoint "
+    "finished writing it",
+    "Microseconds an endpoint read or write completion waited to run on the "
+    "HTTP2 transport's combiner",
     "Number of bytes consumed by metadata, according to HPACK accounting rules",
 };
 namespace {
@@ -208,7 +259,11 @@ GlobalStats::GlobalStats()
       client_channels_created{0},
       client_subchannels_created{0},
       server_channels_created{0},
+      server_calls_queued{0},
+      server_calls_stolen{0},
+      server_calls_rejected{0},
       insecure_connections_created{0},
+      handshakes_shed{0},
       syscall_write{0},
       syscall_read{0},
       tcp_read_alloc_8k{0},
@@ -216,11 +271,24 @@ GlobalStats::GlobalStats()
       http2_settings_writes{0},
       http2_pings_sent{0},
       http2_writes_begun{0},
+      http2_write_coalescing_holds{0},
+      http2_write_coalescing_merges{0},
+      http2_write_coalescing_flushes{0},
       http2_transport_stalls{0},
       http2_stream_stalls{0},
       cq_pluck_creates{0},
       cq_next_creates{0},
-      cq_callback_creates{0} {}
+      cq_callback_creates{0},
+      dns_cache_hits{0},
+      dns_cache_misses{0},
+      dns_cache_shared_lookups{0},
+      slice_pool_hits{0},
+      slice_pool_misses{0},
+      slice_pool_frees{0},
+      call_arenas_chained{0},
+      call_arena_chained_zones{0},
+      adaptive_mutex_spin_acquires{0},
+      adaptive_mutex_parks{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -228,6 +296,12 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kCallInitialSize:
       return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable0, 26,
                            call_initial_size.buckets()};
+    case Histogram::kClientCallInitialMetadataLatencyUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+                           client_call_initial_metadata_latency_us.buckets()};
+    case Histogram::kClientCallLatencyUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+                           client_call_latency_us.buckets()};
     case Histogram::kTcpWriteSize:
       return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
                            tcp_write_size.buckets()};
@@ -246,6 +320,12 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kHttp2SendMessageSize:
       return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
                            http2_send_message_size.buckets()};
+    case Histogram::kHttp2WriteFlushDelayUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+                           http2_write_flush_delay_us.buckets()};
+    case Histogram::kHttp2CombinerQueueTimeUs:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+                           http2_combiner_queue_time_us.buckets()};
     case Histogram::kHttp2MetadataSize:
       return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable0, 26,
                            http2_metadata_size.buckets()};
@@ -264,8 +344,16 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.client_subchannels_created.load(std::memory_order_relaxed);
     result->server_channels_created +=
         data.server_channels_created.load(std::memory_order_relaxed);
+    result->server_calls_queued +=
+        data.server_calls_queued.load(std::memory_order_relaxed);
+    result->server_calls_stolen +=
+        data.server_calls_stolen.load(std::memory_order_relaxed);
+    result->server_calls_rejected +=
+        data.server_calls_rejected.load(std::memory_order_relaxed);
     result->insecure_connections_created +=
         data.insecure_connections_created.load(std::memory_order_relaxed);
+    result->handshakes_shed +=
+        data.handshakes_shed.load(std::memory_order_relaxed);
     result->syscall_write += data.syscall_write.load(std::memory_order_relaxed);
     result->syscall_read += data.syscall_read.load(std::memory_order_relaxed);
     result->tcp_read_alloc_8k +=
@@ -278,6 +366,12 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.http2_pings_sent.load(std::memory_order_relaxed);
     result->http2_writes_begun +=
         data.http2_writes_begun.load(std::memory_order_relaxed);
+    result->http2_write_coalescing_holds +=
+        data.http2_write_coalescing_holds.load(std::memory_order_relaxed);
+    result->http2_write_coalescing_merges +=
+        data.http2_write_coalescing_merges.load(std::memory_order_relaxed);
+    result->http2_write_coalescing_flushes +=
+        data.http2_write_coalescing_flushes.load(std::memory_order_relaxed);
     result->http2_transport_stalls +=
         data.http2_transport_stalls.load(std::memory_order_relaxed);
     result->http2_stream_stalls +=
@@ -288,13 +382,40 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.cq_next_creates.load(std::memory_order_relaxed);
     result->cq_callback_creates +=
         data.cq_callback_creates.load(std::memory_order_relaxed);
+    result->dns_cache_hits +=
+        data.dns_cache_hits.load(std::memory_order_relaxed);
+    result->dns_cache_misses +=
+        data.dns_cache_misses.load(std::memory_order_relaxed);
+    result->dns_cache_shared_lookups +=
+        data.dns_cache_shared_lookups.load(std::memory_order_relaxed);
+    result->slice_pool_hits +=
+        data.slice_pool_hits.load(std::memory_order_relaxed);
+    result->slice_pool_misses +=
+        data.slice_pool_misses.load(std::memory_order_relaxed);
+    result->slice_pool_frees +=
+        data.slice_pool_frees.load(std::memory_order_relaxed);
+    result->call_arenas_chained +=
+        data.call_arenas_chained.load(std::memory_order_relaxed);
+    result->call_arena_chained_zones +=
+        data.call_arena_chained_zones.load(std::memory_order_relaxed);
+    result->adaptive_mutex_spin_acquires +=
+        data.adaptive_mutex_spin_acquires.load(std::memory_order_relaxed);
+    result->adaptive_mutex_parks +=
+        data.adaptive_mutex_parks.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
+    data.client_call_initial_metadata_latency_us.Collect(
+        &result->client_call_initial_metadata_latency_us);
+    data.client_call_latency_us.Collect(&result->client_call_latency_us);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
     data.tcp_read_size.Collect(&result->tcp_read_size);
     data.tcp_read_offer.Collect(&result->tcp_read_offer);
     data.tcp_read_offer_iov_size.Collect(&result->tcp_read_offer_iov_size);
     data.http2_send_message_size.Collect(&result->http2_send_message_size);
+    data.http2_write_flush_delay_us.Collect(
+        &result->http2_write_flush_delay_us);
+    data.http2_combiner_queue_time_us.Collect(
+        &result->http2_combiner_queue_time_us);
     data.http2_metadata_size.Collect(&result->http2_metadata_size);
   }
   return result;
@@ -311,8 +432,13 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       client_subchannels_created - other.client_subchannels_created;
   result->server_channels_created =
       server_channels_created - other.server_channels_created;
+  result->server_calls_queued = server_calls_queued - other.server_calls_queued;
+  result->server_calls_stolen = server_calls_stolen - other.server_calls_stolen;
+  result->server_calls_rejected =
+      server_calls_rejected - other.server_calls_rejected;
   result->insecure_connections_created =
       insecure_connections_created - other.insecure_connections_created;
+  result->handshakes_shed = handshakes_shed - other.handshakes_shed;
   result->syscall_write = syscall_write - other.syscall_write;
   result->syscall_read = syscall_read - other.syscall_read;
   result->tcp_read_alloc_8k = tcp_read_alloc_8k - other.tcp_read_alloc_8k;
@@ -321,13 +447,38 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       http2_settings_writes - other.http2_settings_writes;
   result->http2_pings_sent = http2_pings_sent - other.http2_pings_sent;
   result->http2_writes_begun = http2_writes_begun - other.http2_writes_begun;
+  result->http2_write_coalescing_holds =
+      http2_write_coalescing_holds - other.http2_write_coalescing_holds;
+  result->http2_write_coalescing_merges =
+      http2_write_coalescing_merges - other.http2_write_coalescing_merges;
+  result->http2_write_coalescing_flushes =
+      http2_write_coalescing_flushes - other.http2_write_coalescing_flushes;
   result->http2_transport_stalls =
       http2_transport_stalls - other.http2_transport_stalls;
   result->http2_stream_stalls = http2_stream_stalls - other.http2_stream_stalls;
   result->cq_pluck_creates = cq_pluck_creates - other.cq_pluck_creates;
   result->cq_next_creates = cq_next_creates - other.cq_next_creates;
   result->cq_callback_creates = cq_callback_creates - other.cq_callback_creates;
+  result->dns_cache_hits = dns_cache_hits - other.dns_cache_hits;
+  result->dns_cache_misses = dns_cache_misses - other.dns_cache_misses;
+  result->dns_cache_shared_lookups =
+      dns_cache_shared_lookups - other.dns_cache_shared_lookups;
+  result->slice_pool_hits = slice_pool_hits - other.slice_pool_hits;
+  result->slice_pool_misses = slice_pool_misses - other.slice_pool_misses;
+  result->slice_pool_frees = slice_pool_frees - other.slice_pool_frees;
+  result->call_arenas_chained = call_arenas_chained - other.call_arenas_chained;
+  result->call_arena_chained_zones =
+      call_arena_chained_zones - other.call_arena_chained_zones;
+  result->adaptive_mutex_spin_acquires =
+      adaptive_mutex_spin_acquires - other.adaptive_mutex_spin_acquires;
+  result->adaptive_mutex_parks =
+      adaptive_mutex_parks - other.adaptive_mutex_parks;
   result->call_initial_size = call_initial_size - other.call_initial_size;
+  result->client_call_initial_metadata_latency_us =
+      client_call_initial_metadata_latency_us -
+      other.client_call_initial_metadata_latency_us;
+  result->client_call_latency_us =
+      client_call_latency_us - other.client_call_latency_us;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
   result->tcp_read_size = tcp_read_size - other.tcp_read_size;
@@ -336,6 +487,10 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       tcp_read_offer_iov_size - other.tcp_read_offer_iov_size;
   result->http2_send_message_size =
       http2_send_message_size - other.http2_send_message_size;
+  result->http2_write_flush_delay_us =
+      http2_write_flush_delay_us - other.http2_write_flush_delay_us;
+  result->http2_combiner_queue_time_us =
+      http2_combiner_queue_time_us - other.http2_combiner_queue_time_us;
   result->http2_metadata_size = http2_metadata_size - other.http2_metadata_size;
   return result;
 }
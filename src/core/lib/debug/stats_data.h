@@ -106,7 +106,11 @@ struct GlobalStats {
     kClientChannelsCreated,
     kClientSubchannelsCreated,
     kServerChannelsCreated,
+    kServerCallsQueued,
+    kServerCallsStolen,
+    kServerCallsRejected,
     kInsecureConnectionsCreated,
+    kHandshakesShed,
     kSyscallWrite,
     kSyscallRead,
     kTcpReadAlloc8k,
@@ -114,21 +118,38 @@ struct GlobalStats {
     kHttp2SettingsWrites,
     kHttp2PingsSent,
     kHttp2WritesBegun,
+    kHttp2WriteCoalescingHolds,
+    kHttp2WriteCoalescingMerges,
+    kHttp2WriteCoalescingFlushes,
     kHttp2TransportStalls,
     kHttp2StreamStalls,
     kCqPluckCreates,
     kCqNextCreates,
     kCqCallbackCreates,
+    kDnsCacheHits,
+    kDnsCacheMisses,
+    kDnsCacheSharedLookups,
+    kSlicePoolHits,
+    kSlicePoolMisses,
+    kSlicePoolFrees,
+    kCallArenasChained,
+    kCallArenaChainedZones,
+    kAdaptiveMutexSpinAcquires,
+    kAdaptiveMutexParks,
     COUNT
   };
   enum class Histogram {
     kCallInitialSize,
+    kClientCallInitialMetadataLatencyUs,
+    kClientCallLatencyUs,
     kTcpWriteSize,
     kTcpWriteIovSize,
     kTcpReadSize,
     kTcpReadOffer,
     kTcpReadOfferIovSize,
     kHttp2SendMessageSize,
+    kHttp2WriteFlushDelayUs,
+    kHttp2CombinerQueueTimeUs,
     kHttp2MetadataSize,
     COUNT
   };
@@ -146,7 +167,11 @@ struct GlobalStats {
       uint64_t client_channels_created;
       uint64_t client_subchannels_created;
       uint64_t server_channels_created;
+      uint64_t server_calls_queued;
+      uint64_t server_calls_stolen;
+      uint64_t server_calls_rejected;
       uint64_t insecure_connections_created;
+      uint64_t handshakes_shed;
       uint64_t syscall_write;
       uint64_t syscall_read;
       uint64_t tcp_read_alloc_8k;
@@ -154,21 +179,38 @@ struct GlobalStats {
       uint64_t http2_settings_writes;
       uint64_t http2_pings_sent;
       uint64_t http2_writes_begun;
+      uint64_t http2_write_coalescing_holds;
+      uint64_t http2_write_coalescing_merges;
+      uint64_t http2_write_coalescing_flushes;
       uint64_t http2_transport_stalls;
       uint64_t http2_stream_stalls;
       uint64_t cq_pluck_creates;
       uint64_t cq_next_creates;
       uint64_t cq_callback_creates;
+      uint64_t dns_cache_hits;
+      uint64_t dns_cache_misses;
+      uint64_t dns_cache_shared_lookups;
+      uint64_t slice_pool_hits;
+      uint64_t slice_pool_misses;
+      uint64_t slice_pool_frees;
+      uint64_t call_arenas_chained;
+      uint64_t call_arena_chained_zones;
+      uint64_t adaptive_mutex_spin_acquires;
+      uint64_t adaptive_mutex_parks;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
   Histogram_65536_26 call_initial_size;
+  Histogram_16777216_20 client_call_initial_metadata_latency_us;
+  Histogram_16777216_20 client_call_latency_us;
   Histogram_16777216_20 tcp_write_size;
   Histogram_80_10 tcp_write_iov_size;
   Histogram_16777216_20 tcp_read_size;
   Histogram_16777216_20 tcp_read_offer;
   Histogram_80_10 tcp_read_offer_iov_size;
   Histogram_16777216_20 http2_send_message_size;
+  Histogram_16777216_20 http2_write_flush_delay_us;
+  Histogram_16777216_20 http2_combiner_queue_time_us;
   Histogram_65536_26 http2_metadata_size;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<GlobalStats> Diff(const GlobalStats& other) const;
@@ -196,10 +238,25 @@ class GlobalStatsCollector {
     data_.this_cpu().server_channels_created.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementServerCallsQueued() {
+    data_.this_cpu().server_calls_queued.fetch_add(1,
+                                                   std::memory_order_relaxed);
+  }
+  void IncrementServerCallsStolen() {
+    data_.this_cpu().server_calls_stolen.fetch_add(1,
+                                                   std::memory_order_relaxed);
+  }
+  void IncrementServerCallsRejected() {
+    data_.this_cpu().server_calls_rejected.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementInsecureConnectionsCreated() {
     data_.this_cpu().insecure_connections_created.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementHandshakesShed() {
+    data_.this_cpu().handshakes_shed.fetch_add(1, std::memory_order_relaxed);
+  }
   void IncrementSyscallWrite() {
     data_.this_cpu().syscall_write.fetch_add(1, std::memory_order_relaxed);
   }
@@ -222,6 +279,18 @@ class GlobalStatsCollector {
   void IncrementHttp2WritesBegun() {
     data_.this_cpu().http2_writes_begun.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementHttp2WriteCoalescingHolds() {
+    data_.this_cpu().http2_write_coalescing_holds.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2WriteCoalescingMerges() {
+    data_.this_cpu().http2_write_coalescing_merges.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2WriteCoalescingFlushes() {
+    data_.this_cpu().http2_write_coalescing_flushes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementHttp2TransportStalls() {
     data_.this_cpu().http2_transport_stalls.fetch_add(
         1, std::memory_order_relaxed);
@@ -240,9 +309,50 @@ class GlobalStatsCollector {
     data_.this_cpu().cq_callback_creates.fetch_add(1,
                                                    std::memory_order_relaxed);
   }
+  void IncrementDnsCacheHits() {
+    data_.this_cpu().dns_cache_hits.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementDnsCacheMisses() {
+    data_.this_cpu().dns_cache_misses.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementDnsCacheSharedLookups() {
+    data_.this_cpu().dns_cache_shared_lookups.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSlicePoolHits() {
+    data_.this_cpu().slice_pool_hits.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementSlicePoolMisses() {
+    data_.this_cpu().slice_pool_misses.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementSlicePoolFrees() {
+    data_.this_cpu().slice_pool_frees.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementCallArenasChained() {
+    data_.this_cpu().call_arenas_chained.fetch_add(1,
+                                                   std::memory_order_relaxed);
+  }
+  void IncrementCallArenaChainedZones() {
+    data_.this_cpu().call_arena_chained_zones.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementAdaptiveMutexSpinAcquires() {
+    data_.this_cpu().adaptive_mutex_spin_acquires.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementAdaptiveMutexParks() {
+    data_.this_cpu().adaptive_mutex_parks.fetch_add(1,
+                                                    std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
+  void IncrementClientCallInitialMetadataLatencyUs(int value) {
+    data_.this_cpu().client_call_initial_metadata_latency_us.Increment(value);
+  }
+  void IncrementClientCallLatencyUs(int value) {
+    data_.this_cpu().client_call_latency_us.Increment(value);
+  }
   void IncrementTcpWriteSize(int value) {
     data_.this_cpu().tcp_write_size.Increment(value);
   }
@@ -261,6 +371,12 @@ class GlobalStatsCollector {
   void IncrementHttp2SendMessageSize(int value) {
     data_.this_cpu().http2_send_message_size.Increment(value);
   }
+  void IncrementHttp2WriteFlushDelayUs(int value) {
+    data_.this_cpu().http2_write_flush_delay_us.Increment(value);
+  }
+  void IncrementHttp2CombinerQueueTimeUs(int value) {
+    data_.this_cpu().http2_combiner_queue_time_us.Increment(value);
+  }
   void IncrementHttp2MetadataSize(int value) {
     data_.this_cpu().http2_metadata_size.Increment(value);
   }
@@ -272,7 +388,11 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> client_channels_created{0};
     std::atomic<uint64_t> client_subchannels_created{0};
     std::atomic<uint64_t> server_channels_created{0};
+    std::atomic<uint64_t> server_calls_queued{0};
+    std::atomic<uint64_t> server_calls_stolen{0};
+    std::atomic<uint64_t> server_calls_rejected{0};
     std::atomic<uint64_t> insecure_connections_created{0};
+    std::atomic<uint64_t> handshakes_shed{0};
     std::atomic<uint64_t> syscall_write{0};
     std::atomic<uint64_t> syscall_read{0};
     std::atomic<uint64_t> tcp_read_alloc_8k{0};
@@ -280,18 +400,35 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> http2_settings_writes{0};
     std::atomic<uint64_t> http2_pings_sent{0};
     std::atomic<uint64_t> http2_writes_begun{0};
+    std::atomic<uint64_t> http2_write_coalescing_holds{0};
+    std::atomic<uint64_t> http2_write_coalescing_merges{0};
+    std::atomic<uint64_t> http2_write_coalescing_flushes{0};
     std::atomic<uint64_t> http2_transport_stalls{0};
     std::atomic<uint64_t> http2_stream_stalls{0};
     std::atomic<uint64_t> cq_pluck_creates{0};
     std::atomic<uint64_t> cq_next_creates{0};
     std::atomic<uint64_t> cq_callback_creates{0};
+    std::atomic<uint64_t> dns_cache_hits{0};
+    std::atomic<uint64_t> dns_cache_misses{0};
+    std::atomic<uint64_t> dns_cache_shared_lookups{0};
+    std::atomic<uint64_t> slice_pool_hits{0};
+    std::atomic<uint64_t> slice_pool_misses{0};
+    std::atomic<uint64_t> slice_pool_frees{0};
+    std::atomic<uint64_t> call_arenas_chained{0};
+    std::atomic<uint64_t> call_arena_chained_zones{0};
+    std::atomic<uint64_t> adaptive_mutex_spin_acquires{0};
+    std::atomic<uint64_t> adaptive_mutex_parks{0};
     HistogramCollector_65536_26 call_initial_size;
+    HistogramCollector_16777216_20 client_call_initial_metadata_latency_us;
+    HistogramCollector_16777216_20 client_call_latency_us;
     HistogramCollector_16777216_20 tcp_write_size;
     HistogramCollector_80_10 tcp_write_iov_size;
     HistogramCollector_16777216_20 tcp_read_size;
     HistogramCollector_16777216_20 tcp_read_offer;
     HistogramCollector_80_10 tcp_read_offer_iov_size;
     HistogramCollector_16777216_20 http2_send_message_size;
+    HistogramCollector_16777216_20 http2_write_flush_delay_us;
+    HistogramCollector_16777216_20 http2_combiner_queue_time_us;
     HistogramCollector_65536_26 http2_metadata_size;
   };
   PerCpu<Data> data_;
@@ -124,6 +124,13 @@ static void parse(const char* s) {
   size_t i;
   split(s, &strings, &nstrings);
 
+  if (!GRPC_TRACERS_COMPILED_IN && nstrings > 0 && strings[0][0] != '\0') {
+    gpr_log(GPR_INFO,
+            "GRPC_TRACE=%s has no effect: tracers are compiled out of this "
+            "build (GRPC_NO_TRACERS)",
+            s);
+  }
+
   for (i = 0; i < nstrings; i++) {
     if (strings[i][0] == '-') {
       grpc_core::TraceFlagList::Set(strings[i] + 1, false);
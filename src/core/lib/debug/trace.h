@@ -67,13 +67,20 @@ class TraceFlag {
 // wrapped language (wr don't want to force recompilation to get tracing).
 // Internally, however, for performance reasons, we compile them out by
 // default, since internal build systems make recompiling trivial.
+// Define GRPC_NO_TRACERS (--define=grpc_no_tracers=true with bazel) to compile
+// them out of opt builds: every GRPC_TRACE_FLAG_ENABLED() check then folds to
+// false, and the tracing code it guards is dropped from the hot paths.
 //
 // Prefer GRPC_TRACE_FLAG_ENABLED() macro instead of using enabled() directly.
+#ifndef GRPC_NO_TRACERS
 #define GRPC_USE_TRACERS  // tracers on by default in OSS
+#endif
 #if defined(GRPC_USE_TRACERS) || !defined(NDEBUG)
+#define GRPC_TRACERS_COMPILED_IN 1
   bool enabled() { return value_.load(std::memory_order_relaxed); }
 #else
-  bool enabled() { return false; }
+#define GRPC_TRACERS_COMPILED_IN 0
+  constexpr bool enabled() const { return false; }
 #endif  // defined(GRPC_USE_TRACERS) || !defined(NDEBUG)
 
  private:
@@ -16,7 +16,17 @@
 
 #ifdef GPR_APPLE
 
+#include <memory>
+#include <utility>
+
+#include "absl/status/status.h"
+
+#include <grpc/support/log.h>
+
 #include "src/core/lib/event_engine/cf_engine/cf_engine.h"
+#include "src/core/lib/event_engine/cf_engine/dns_service_resolver.h"
+#include "src/core/lib/event_engine/cf_engine/nw_endpoint.h"
+#include "src/core/lib/event_engine/cf_engine/nw_listener.h"
 #include "src/core/lib/event_engine/posix_engine/timer_manager.h"
 #include "src/core/lib/event_engine/trace.h"
 #include "src/core/lib/event_engine/utils.h"
@@ -43,6 +53,23 @@ struct CFEventEngine::Closure final : public EventEngine::Closure {
   }
 };
 
+// A connection attempt, deleted once its connection is handed to an endpoint
+// or cancelled. The connection is only cancelled by whoever claims the
+// attempt, so the state outlives anything the claimant does with it.
+struct CFEventEngine::ConnectState {
+  ConnectionHandle handle;
+  OnConnectCallback on_connect;
+  MemoryAllocator memory_allocator;
+  nw_connection_t connection;
+  dispatch_queue_t queue;
+  TaskHandle timeout = kInvalidTaskHandle;
+
+  ~ConnectState() {
+    nw_release(connection);
+    dispatch_release(queue);
+  }
+};
+
 CFEventEngine::CFEventEngine()
     : executor_(std::make_shared<ThreadPool>()), timer_manager_(executor_) {}
 
@@ -64,37 +91,137 @@ CFEventEngine::~CFEventEngine() {
 
 absl::StatusOr<std::unique_ptr<EventEngine::Listener>>
 CFEventEngine::CreateListener(
-    Listener::AcceptCallback /* on_accept */,
-    absl::AnyInvocable<void(absl::Status)> /* on_shutdown */,
+    Listener::AcceptCallback on_accept,
+    absl::AnyInvocable<void(absl::Status)> on_shutdown,
     const EndpointConfig& /* config */,
-    std::unique_ptr<MemoryAllocatorFactory> /* memory_allocator_factory */) {
-  grpc_core::Crash("unimplemented");
+    std::unique_ptr<MemoryAllocatorFactory> memory_allocator_factory) {
+  return std::make_unique<NWListener>(std::move(on_accept),
+                                      std::move(on_shutdown),
+                                      std::move(memory_allocator_factory));
 }
 
 CFEventEngine::ConnectionHandle CFEventEngine::Connect(
-    OnConnectCallback /* on_connect */, const ResolvedAddress& /* addr */,
-    const EndpointConfig& /* args */, MemoryAllocator /* memory_allocator */,
-    Duration /* timeout */) {
-  grpc_core::Crash("unimplemented");
+    OnConnectCallback on_connect, const ResolvedAddress& addr,
+    const EndpointConfig& /* args */, MemoryAllocator memory_allocator,
+    Duration timeout) {
+  nw_endpoint_t remote = nw_endpoint_create_address(addr.address());
+  nw_parameters_t parameters = CreateTcpParameters();
+  auto* state = new ConnectState;
+  state->on_connect = std::move(on_connect);
+  state->memory_allocator = std::move(memory_allocator);
+  state->connection = nw_connection_create(remote, parameters);
+  state->queue =
+      dispatch_queue_create("grpc.cf_engine.connect", DISPATCH_QUEUE_SERIAL);
+  nw_release(remote);
+  nw_release(parameters);
+  ConnectionHandle handle{reinterpret_cast<intptr_t>(state),
+                          aba_token_.fetch_add(1)};
+  state->handle = handle;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    conn_handles_.insert(handle);
+  }
+  GRPC_EVENT_ENGINE_TRACE("CFEventEngine:%p connecting:%s", this,
+                          HandleToString(handle).c_str());
+  // Set before the connection starts, so that a quick outcome can cancel it.
+  state->timeout = RunAfter(timeout, [this, handle]() {
+    ConnectState* state = ClaimConnect(handle);
+    if (state == nullptr) return;
+    state->on_connect(absl::DeadlineExceededError("Connect timed out"));
+    nw_connection_cancel(state->connection);
+  });
+  nw_connection_set_queue(state->connection, state->queue);
+  nw_connection_set_state_changed_handler(
+      state->connection,
+      ^(nw_connection_state_t connection_state, nw_error_t error) {
+        OnConnectStateChanged(state, connection_state, error);
+      });
+  nw_connection_start(state->connection);
+  return handle;
 }
 
-bool CFEventEngine::CancelConnect(ConnectionHandle /* handle */) {
-  grpc_core::Crash("unimplemented");
+void CFEventEngine::OnConnectStateChanged(
+    ConnectState* state, nw_connection_state_t connection_state,
+    nw_error_t error) {
+  switch (connection_state) {
+    case nw_connection_state_ready: {
+      if (ClaimConnect(state->handle) == nullptr) return;
+      Cancel(state->timeout);
+      // The endpoint takes over the connection's state handler, so this
+      // one is not called again.
+      auto endpoint = std::make_unique<NWEndpoint>(
+          state->connection, state->queue, std::move(state->memory_allocator));
+      Run([on_connect = std::move(state->on_connect),
+           endpoint = std::move(endpoint)]() mutable {
+        on_connect(std::move(endpoint));
+      });
+      delete state;
+      return;
+    }
+    // A connection waits when it cannot currently reach the peer, and
+    // would retry until the timeout. Report that straight away instead, the
+    // way a refused connect() does.
+    case nw_connection_state_waiting:
+    case nw_connection_state_failed: {
+      if (ClaimConnect(state->handle) == nullptr) return;
+      Cancel(state->timeout);
+      absl::Status status = NWErrorToStatus(error, "connect");
+      if (status.ok()) status = absl::UnavailableError("connect failed");
+      Run([on_connect = std::move(state->on_connect),
+           status = std::move(status)]() mutable {
+        on_connect(std::move(status));
+      });
+      nw_connection_cancel(state->connection);
+      return;
+    }
+    case nw_connection_state_cancelled:
+      delete state;
+      return;
+    default:
+      return;
+  }
+}
+
+CFEventEngine::ConnectState* CFEventEngine::ClaimConnect(
+    ConnectionHandle handle) {
+  grpc_core::MutexLock lock(&mu_);
+  if (!conn_handles_.contains(handle)) return nullptr;
+  conn_handles_.erase(handle);
+  return reinterpret_cast<ConnectState*>(handle.keys[0]);
+}
+
+bool CFEventEngine::CancelConnect(ConnectionHandle handle) {
+  ConnectState* state = ClaimConnect(handle);
+  if (state == nullptr) return false;
+  GRPC_EVENT_ENGINE_TRACE("CFEventEngine:%p cancelling connect:%s", this,
+                          HandleToString(handle).c_str());
+  Cancel(state->timeout);
+  // on_connect is not run once the attempt is cancelled.
+  state->on_connect = nullptr;
+  nw_connection_cancel(state->connection);
+  return true;
 }
 
 bool CFEventEngine::IsWorkerThread() { grpc_core::Crash("unimplemented"); }
 
 std::unique_ptr<EventEngine::DNSResolver> CFEventEngine::GetDNSResolver(
-    const DNSResolver::ResolverOptions& /* options */) {
-  grpc_core::Crash("unimplemented");
+    const DNSResolver::ResolverOptions& options) {
+  if (!options.dns_server.empty()) {
+    gpr_log(GPR_ERROR,
+            "CFEventEngine:%p cannot resolve through DNS server %s, only "
+            "through the system resolver",
+            this, options.dns_server.c_str());
+    return nullptr;
+  }
+  return std::make_unique<DNSServiceResolver>(shared_from_this());
 }
 
-void CFEventEngine::Run(EventEngine::Closure* /* closure */) {
-  grpc_core::Crash("unimplemented");
+void CFEventEngine::Run(EventEngine::Closure* closure) {
+  executor_->Run(closure);
 }
 
-void CFEventEngine::Run(absl::AnyInvocable<void()> /* closure */) {
-  grpc_core::Crash("unimplemented");
+void CFEventEngine::Run(absl::AnyInvocable<void()> closure) {
+  executor_->Run(std::move(closure));
 }
 
 EventEngine::TaskHandle CFEventEngine::RunAfter(Duration when,
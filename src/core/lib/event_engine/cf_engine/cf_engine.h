@@ -17,6 +17,8 @@
 
 #ifdef GPR_APPLE
 
+#include <Network/Network.h>
+
 #include <grpc/event_engine/event_engine.h>
 
 #include "src/core/lib/event_engine/handle_containers.h"
@@ -58,10 +60,20 @@ class CFEventEngine : public EventEngine,
 
  private:
   struct Closure;
+  struct ConnectState;
   EventEngine::TaskHandle RunAfterInternal(Duration when,
                                            absl::AnyInvocable<void()> cb);
+  // Runs on the connection's queue.
+  void OnConnectStateChanged(ConnectState* state,
+                             nw_connection_state_t connection_state,
+                             nw_error_t error);
+  // Takes \a handle out of conn_handles_ and returns its state, or nullptr if
+  // the attempt already completed or was cancelled. The caller then owns
+  // completing the attempt and cancelling its connection.
+  ConnectState* ClaimConnect(ConnectionHandle handle);
   grpc_core::Mutex mu_;
   TaskHandleSet known_handles_ ABSL_GUARDED_BY(mu_);
+  ConnectionHandleSet conn_handles_ ABSL_GUARDED_BY(mu_);
   std::atomic<intptr_t> aba_token_{0};
   std::shared_ptr<ThreadPool> executor_;
   TimerManager timer_manager_;
@@ -0,0 +1,309 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_APPLE
+
+#include <arpa/inet.h>
+#include <dns_sd.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
+
+#include "src/core/lib/event_engine/cf_engine/dns_service_resolver.h"
+#include "src/core/lib/event_engine/handle_containers.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/trace.h"
+#include "src/core/lib/gprpp/host_port.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+absl::StatusOr<int> ParsePort(absl::string_view port) {
+  int number;
+  if (absl::SimpleAtoi(port, &number) && number >= 0 && number <= 65535) {
+    return number;
+  }
+  if (port == "http") return 80;
+  if (port == "https") return 443;
+  return absl::InvalidArgumentError(absl::StrCat("Unknown port: ", port));
+}
+
+// The DNS service is not needed for addresses given as numbers.
+absl::optional<EventEngine::ResolvedAddress> ParseNumericAddress(
+    const std::string& host, int port) {
+  sockaddr_in addr4;
+  memset(&addr4, 0, sizeof(addr4));
+  if (inet_pton(AF_INET, host.c_str(), &addr4.sin_addr) == 1) {
+    addr4.sin_len = sizeof(addr4);
+    addr4.sin_family = AF_INET;
+    addr4.sin_port = htons(port);
+    return EventEngine::ResolvedAddress(
+        reinterpret_cast<const sockaddr*>(&addr4), sizeof(addr4));
+  }
+  sockaddr_in6 addr6;
+  memset(&addr6, 0, sizeof(addr6));
+  if (inet_pton(AF_INET6, host.c_str(), &addr6.sin6_addr) == 1) {
+    addr6.sin6_len = sizeof(addr6);
+    addr6.sin6_family = AF_INET6;
+    addr6.sin6_port = htons(port);
+    return EventEngine::ResolvedAddress(
+        reinterpret_cast<const sockaddr*>(&addr6), sizeof(addr6));
+  }
+  return absl::nullopt;
+}
+
+}  // namespace
+
+struct DNSServiceResolver::State {
+  struct Request {
+    State* state;
+    LookupTaskHandle handle;
+    LookupHostnameCallback on_resolve;
+    std::string host;
+    int port;
+    DNSServiceRef ref = nullptr;
+    // Whether the answer for each address family has arrived, including a
+    // negative one.
+    bool have_ipv4 = false;
+    bool have_ipv6 = false;
+    std::vector<EventEngine::ResolvedAddress> addresses;
+    EventEngine::TaskHandle timeout = EventEngine::kInvalidTaskHandle;
+  };
+
+  explicit State(std::shared_ptr<EventEngine> engine)
+      : engine(std::move(engine)),
+        queue(dispatch_queue_create("grpc.cf_engine.dns",
+                                    DISPATCH_QUEUE_SERIAL)) {}
+  ~State() { dispatch_release(queue); }
+
+  // The rest runs on queue.
+  void Start(std::shared_ptr<State> self, Request* request, Duration timeout);
+  // Hands \a result to the request's callback and deletes the request.
+  void Finish(Request* request,
+              absl::StatusOr<std::vector<EventEngine::ResolvedAddress>> result);
+  // Deletes the request without running its callback.
+  void Abandon(Request* request);
+  static void OnAddrInfo(DNSServiceRef ref, DNSServiceFlags flags,
+                         uint32_t interface_index,
+                         DNSServiceErrorType error, const char* hostname,
+                         const sockaddr* address, uint32_t ttl,
+                         void* context);
+
+  std::shared_ptr<EventEngine> engine;
+  dispatch_queue_t queue;
+  std::atomic<intptr_t> aba_token{0};
+  // Lookups still in flight. Only touched on queue.
+  LookupTaskHandleSet handles;
+};
+
+void DNSServiceResolver::State::Start(std::shared_ptr<State> self,
+                                      Request* request, Duration timeout) {
+  handles.insert(request->handle);
+  LookupTaskHandle handle = request->handle;
+  std::weak_ptr<State> weak_self = self;
+  request->timeout = engine->RunAfter(timeout, [weak_self, handle]() {
+    std::shared_ptr<State> state = weak_self.lock();
+    if (state == nullptr) return;
+    dispatch_async(state->queue, ^{
+      if (!state->handles.contains(handle)) return;
+      state->Finish(reinterpret_cast<Request*>(handle.keys[0]),
+                    absl::DeadlineExceededError("DNS lookup timed out"));
+    });
+  });
+  DNSServiceErrorType error = DNSServiceGetAddrInfo(
+      &request->ref, kDNSServiceFlagsReturnIntermediates,
+      kDNSServiceInterfaceIndexAny,
+      kDNSServiceProtocol_IPv4 | kDNSServiceProtocol_IPv6,
+      request->host.c_str(), &State::OnAddrInfo, request);
+  if (error != kDNSServiceErr_NoError) {
+    request->ref = nullptr;
+    Finish(request, absl::UnknownError(absl::StrCat(
+                        "DNSServiceGetAddrInfo failed: error ", error)));
+    return;
+  }
+  error = DNSServiceSetDispatchQueue(request->ref, queue);
+  if (error != kDNSServiceErr_NoError) {
+    Finish(request, absl::UnknownError(absl::StrCat(
+                        "DNSServiceSetDispatchQueue failed: error ", error)));
+  }
+}
+
+void DNSServiceResolver::State::Finish(
+    Request* request,
+    absl::StatusOr<std::vector<EventEngine::ResolvedAddress>> result) {
+  GRPC_EVENT_ENGINE_DNS_TRACE("DNSServiceResolver lookup of %s: %s",
+                              request->host.c_str(),
+                              result.status().ToString().c_str());
+  engine->Run([on_resolve = std::move(request->on_resolve),
+               result = std::move(result)]() mutable {
+    on_resolve(std::move(result));
+  });
+  Abandon(request);
+}
+
+void DNSServiceResolver::State::Abandon(Request* request) {
+  handles.erase(request->handle);
+  if (request->ref != nullptr) DNSServiceRefDeallocate(request->ref);
+  engine->Cancel(request->timeout);
+  delete request;
+}
+
+void DNSServiceResolver::State::OnAddrInfo(
+    DNSServiceRef /*ref*/, DNSServiceFlags flags, uint32_t /*interface_index*/,
+    DNSServiceErrorType error, const char* /*hostname*/,
+    const sockaddr* address, uint32_t /*ttl*/, void* context) {
+  auto* request = static_cast<Request*>(context);
+  State* state = request->state;
+  // Negative answers arrive as kDNSServiceErr_NoSuchRecord because of
+  // kDNSServiceFlagsReturnIntermediates, so that a host without IPv6
+  // addresses does not leave the lookup waiting for one.
+  if (error != kDNSServiceErr_NoError &&
+      error != kDNSServiceErr_NoSuchRecord) {
+    state->Finish(request, absl::UnavailableError(absl::StrCat(
+                               "DNS lookup of ", request->host,
+                               " failed: error ", error)));
+    return;
+  }
+  if (address != nullptr) {
+    if (address->sa_family == AF_INET) {
+      request->have_ipv4 = true;
+    } else if (address->sa_family == AF_INET6) {
+      request->have_ipv6 = true;
+    }
+    if (error == kDNSServiceErr_NoError && (flags & kDNSServiceFlagsAdd)) {
+      EventEngine::ResolvedAddress resolved(address, address->sa_len);
+      ResolvedAddressSetPort(resolved, request->port);
+      request->addresses.push_back(resolved);
+    }
+  }
+  if (!request->have_ipv4 || !request->have_ipv6 ||
+      (flags & kDNSServiceFlagsMoreComing)) {
+    return;
+  }
+  if (request->addresses.empty()) {
+    state->Finish(request, absl::NotFoundError(absl::StrCat(
+                               "No addresses found for ", request->host)));
+    return;
+  }
+  state->Finish(request, std::move(request->addresses));
+}
+
+DNSServiceResolver::DNSServiceResolver(std::shared_ptr<EventEngine> engine)
+    : state_(std::make_shared<State>(std::move(engine))) {}
+
+DNSServiceResolver::~DNSServiceResolver() {
+  State* state = state_.get();
+  dispatch_sync(state->queue, ^{
+    std::vector<LookupTaskHandle> handles(state->handles.begin(),
+                                          state->handles.end());
+    for (const LookupTaskHandle& handle : handles) {
+      state->Finish(reinterpret_cast<State::Request*>(handle.keys[0]),
+                    absl::CancelledError("DNS resolver shut down"));
+    }
+  });
+}
+
+EventEngine::DNSResolver::LookupTaskHandle DNSServiceResolver::LookupHostname(
+    LookupHostnameCallback on_resolve, absl::string_view name,
+    absl::string_view default_port, Duration timeout) {
+  std::string host;
+  std::string port_string;
+  absl::StatusOr<int> port;
+  if (!grpc_core::SplitHostPort(name, &host, &port_string) || host.empty()) {
+    port = absl::InvalidArgumentError(
+        absl::StrCat("Unparseable name: ", name));
+  } else {
+    if (port_string.empty()) port_string = std::string(default_port);
+    port = port_string.empty()
+               ? absl::InvalidArgumentError(
+                     absl::StrCat("No port in name ", name,
+                                  " or default_port argument"))
+               : ParsePort(port_string);
+  }
+  if (!port.ok()) {
+    state_->engine->Run([on_resolve = std::move(on_resolve),
+                         status = port.status()]() mutable {
+      on_resolve(status);
+    });
+    return {0, 0};
+  }
+  if (auto address = ParseNumericAddress(host, *port)) {
+    state_->engine->Run(
+        [on_resolve = std::move(on_resolve), address = *address]() mutable {
+          on_resolve(std::vector<EventEngine::ResolvedAddress>{address});
+        });
+    return {0, 0};
+  }
+  auto* request = new State::Request;
+  request->state = state_.get();
+  request->handle = {reinterpret_cast<intptr_t>(request),
+                     state_->aba_token.fetch_add(1)};
+  request->on_resolve = std::move(on_resolve);
+  request->host = std::move(host);
+  request->port = *port;
+  LookupTaskHandle handle = request->handle;
+  std::shared_ptr<State> state = state_;
+  dispatch_async(state->queue, ^{
+    state->Start(state, request, timeout);
+  });
+  return handle;
+}
+
+EventEngine::DNSResolver::LookupTaskHandle DNSServiceResolver::LookupSRV(
+    LookupSRVCallback on_resolve, absl::string_view /*name*/,
+    Duration /*timeout*/) {
+  state_->engine->Run([on_resolve = std::move(on_resolve)]() mutable {
+    on_resolve(absl::UnimplementedError("SRV lookups are not supported"));
+  });
+  return {0, 0};
+}
+
+EventEngine::DNSResolver::LookupTaskHandle DNSServiceResolver::LookupTXT(
+    LookupTXTCallback on_resolve, absl::string_view /*name*/,
+    Duration /*timeout*/) {
+  state_->engine->Run([on_resolve = std::move(on_resolve)]() mutable {
+    on_resolve(absl::UnimplementedError("TXT lookups are not supported"));
+  });
+  return {0, 0};
+}
+
+bool DNSServiceResolver::CancelLookup(LookupTaskHandle handle) {
+  State* state = state_.get();
+  __block bool cancelled = false;
+  dispatch_sync(state->queue, ^{
+    if (!state->handles.contains(handle)) return;
+    state->Abandon(reinterpret_cast<State::Request*>(handle.keys[0]));
+    cancelled = true;
+  });
+  return cancelled;
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GPR_APPLE
@@ -0,0 +1,63 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_CF_ENGINE_DNS_SERVICE_RESOLVER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_CF_ENGINE_DNS_SERVICE_RESOLVER_H
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_APPLE
+
+#include <memory>
+
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// Resolves hostnames with DNSServiceGetAddrInfo(), which goes through the
+// system resolver the way Network.framework's own connections do. Replies
+// are handled on a serial dispatch queue and callbacks run on the engine.
+//
+// SRV and TXT lookups are not supported.
+class DNSServiceResolver : public EventEngine::DNSResolver {
+ public:
+  explicit DNSServiceResolver(std::shared_ptr<EventEngine> engine);
+  ~DNSServiceResolver() override;
+
+  LookupTaskHandle LookupHostname(LookupHostnameCallback on_resolve,
+                                  absl::string_view name,
+                                  absl::string_view default_port,
+                                  Duration timeout) override;
+  LookupTaskHandle LookupSRV(LookupSRVCallback on_resolve,
+                             absl::string_view name,
+                             Duration timeout) override;
+  LookupTaskHandle LookupTXT(LookupTXTCallback on_resolve,
+                             absl::string_view name,
+                             Duration timeout) override;
+  bool CancelLookup(LookupTaskHandle handle) override;
+
+ private:
+  // Shared with pending timeouts, which may fire after the resolver is gone.
+  struct State;
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GPR_APPLE
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_CF_ENGINE_DNS_SERVICE_RESOLVER_H
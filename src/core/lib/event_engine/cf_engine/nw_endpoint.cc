@@ -0,0 +1,199 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_APPLE
+
+#include <errno.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
+
+#include <grpc/slice.h>
+
+#include "src/core/lib/event_engine/cf_engine/nw_endpoint.h"
+#include "src/core/lib/event_engine/trace.h"
+#include "src/core/lib/gprpp/strerror.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+// Reads return whatever has arrived, up to this much unless the caller
+// hints at more.
+constexpr int64_t kDefaultMaxReadSize = 64 * 1024;
+
+void ReleaseDispatchData(void* region) {
+  dispatch_release(static_cast<dispatch_data_t>(region));
+}
+
+absl::optional<EventEngine::ResolvedAddress> EndpointAddress(
+    nw_endpoint_t endpoint) {
+  if (endpoint == nullptr ||
+      nw_endpoint_get_type(endpoint) != nw_endpoint_type_address) {
+    return absl::nullopt;
+  }
+  const sockaddr* address = nw_endpoint_get_address(endpoint);
+  return EventEngine::ResolvedAddress(address, address->sa_len);
+}
+
+}  // namespace
+
+absl::Status NWErrorToStatus(nw_error_t error, absl::string_view what) {
+  if (error == nullptr) return absl::OkStatus();
+  int code = nw_error_get_error_code(error);
+  switch (nw_error_get_error_domain(error)) {
+    case nw_error_domain_posix:
+      if (code == ECANCELED) {
+        return absl::CancelledError(absl::StrCat(what, " cancelled"));
+      }
+      return absl::UnavailableError(
+          absl::StrCat(what, ": ", grpc_core::StrError(code)));
+    case nw_error_domain_dns:
+      return absl::UnavailableError(absl::StrCat(what, ": DNS error ", code));
+    case nw_error_domain_tls:
+      return absl::UnavailableError(absl::StrCat(what, ": TLS error ", code));
+    default:
+      return absl::UnknownError(absl::StrCat(what, ": error ", code));
+  }
+}
+
+nw_parameters_t CreateTcpParameters() {
+  return nw_parameters_create_secure_tcp(
+      NW_PARAMETERS_DISABLE_PROTOCOL, ^(nw_protocol_options_t tcp_options) {
+        nw_tcp_options_set_no_delay(tcp_options, true);
+      });
+}
+
+NWEndpoint::NWEndpoint(nw_connection_t connection, dispatch_queue_t queue,
+                       MemoryAllocator memory_allocator)
+    : connection_(connection),
+      queue_(queue),
+      memory_allocator_(std::move(memory_allocator)) {
+  nw_retain(connection_);
+  dispatch_retain(queue_);
+  // Errors surface through pending reads and writes, so there is nothing
+  // left to do on state changes.
+  nw_connection_set_state_changed_handler(
+      connection_, ^(nw_connection_state_t /*state*/, nw_error_t /*error*/) {
+      });
+  nw_path_t path = nw_connection_copy_current_path(connection_);
+  if (path != nullptr) {
+    nw_endpoint_t remote = nw_path_copy_effective_remote_endpoint(path);
+    nw_endpoint_t local = nw_path_copy_effective_local_endpoint(path);
+    if (auto address = EndpointAddress(remote)) peer_address_ = *address;
+    if (auto address = EndpointAddress(local)) local_address_ = *address;
+    if (remote != nullptr) nw_release(remote);
+    if (local != nullptr) nw_release(local);
+    nw_release(path);
+  }
+}
+
+NWEndpoint::~NWEndpoint() {
+  // Pending receives and sends complete with ECANCELED, which they report to
+  // their callbacks as CANCELLED. They do not refer back to the endpoint.
+  nw_connection_cancel(connection_);
+  nw_release(connection_);
+  dispatch_release(queue_);
+}
+
+void NWEndpoint::Read(absl::AnyInvocable<void(absl::Status)> on_read,
+                      SliceBuffer* buffer, const ReadArgs* args) {
+  buffer->Clear();
+  int64_t max_read_size = kDefaultMaxReadSize;
+  if (args != nullptr) {
+    max_read_size = std::min<int64_t>(
+        std::max(max_read_size, args->read_hint_bytes), UINT32_MAX);
+  }
+  auto* cb = new absl::AnyInvocable<void(absl::Status)>(std::move(on_read));
+  nw_connection_receive(
+      connection_, 1, static_cast<uint32_t>(max_read_size),
+      ^(dispatch_data_t content, nw_content_context_t /*context*/,
+        bool is_complete, nw_error_t error) {
+        if (content != nullptr) {
+          // Each region becomes a slice that keeps the region alive, rather
+          // than being copied out.
+          dispatch_data_apply(
+              content, ^bool(dispatch_data_t region, size_t /*offset*/,
+                             const void* data, size_t size) {
+                dispatch_retain(region);
+                buffer->Append(Slice(grpc_slice_new_with_user_data(
+                    const_cast<void*>(data), size, ReleaseDispatchData,
+                    region)));
+                return true;
+              });
+        }
+        absl::Status status;
+        if (error != nullptr) {
+          status = NWErrorToStatus(error, "read");
+        } else if (content == nullptr && is_complete) {
+          status = absl::UnavailableError("End of TCP stream");
+        }
+        GRPC_EVENT_ENGINE_ENDPOINT_TRACE("NWEndpoint read %zu bytes: %s",
+                                         buffer->Length(),
+                                         status.ToString().c_str());
+        (*cb)(std::move(status));
+        delete cb;
+      });
+}
+
+void NWEndpoint::Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+                       SliceBuffer* data, const WriteArgs* /*args*/) {
+  // Hand the slices to the framework as they are. Each region holds a ref
+  // to its slice and drops it once the bytes are no longer needed.
+  dispatch_data_t content = nullptr;
+  while (data->Count() > 0) {
+    grpc_slice slice = data->TakeFirst().TakeCSlice();
+    dispatch_data_t piece;
+    if (slice.refcount == nullptr) {
+      // Inlined bytes live in the grpc_slice itself, so they are copied.
+      piece = dispatch_data_create(GRPC_SLICE_START_PTR(slice),
+                                   GRPC_SLICE_LENGTH(slice), nullptr,
+                                   DISPATCH_DATA_DESTRUCTOR_DEFAULT);
+    } else {
+      piece = dispatch_data_create(
+          GRPC_SLICE_START_PTR(slice), GRPC_SLICE_LENGTH(slice), nullptr, ^{
+            grpc_slice_unref(slice);
+          });
+    }
+    if (content == nullptr) {
+      content = piece;
+    } else {
+      dispatch_data_t joined = dispatch_data_create_concat(content, piece);
+      dispatch_release(content);
+      dispatch_release(piece);
+      content = joined;
+    }
+  }
+  auto* cb = new absl::AnyInvocable<void(absl::Status)>(std::move(on_writable));
+  nw_connection_send(connection_,
+                     content != nullptr ? content : dispatch_data_empty,
+                     NW_CONNECTION_DEFAULT_STREAM_CONTEXT,
+                     /*is_complete=*/false, ^(nw_error_t error) {
+                       (*cb)(NWErrorToStatus(error, "write"));
+                       delete cb;
+                     });
+  if (content != nullptr) dispatch_release(content);
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GPR_APPLE
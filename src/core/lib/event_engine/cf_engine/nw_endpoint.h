@@ -0,0 +1,75 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_CF_ENGINE_NW_ENDPOINT_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_CF_ENGINE_NW_ENDPOINT_H
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_APPLE
+
+#include <Network/Network.h>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// Returns the status for an error reported by Network.framework.
+absl::Status NWErrorToStatus(nw_error_t error, absl::string_view what);
+
+// TCP parameters shared by the connections and listeners of CFEventEngine.
+// The caller takes the returned reference.
+nw_parameters_t CreateTcpParameters();
+
+// An endpoint over a ready Network.framework connection. Data read is
+// handed up in the dispatch_data regions the framework received it in, and
+// data written is handed down without copying, so nothing passes through
+// an intermediate buffer the way it does with CFStream.
+//
+// Callbacks run on the connection's serial dispatch queue.
+class NWEndpoint : public EventEngine::Endpoint {
+ public:
+  // Takes over \a connection, which must be ready and use \a queue. Both are
+  // retained and released again when the endpoint is destroyed.
+  NWEndpoint(nw_connection_t connection, dispatch_queue_t queue,
+             MemoryAllocator memory_allocator);
+  ~NWEndpoint() override;
+
+  void Read(absl::AnyInvocable<void(absl::Status)> on_read, SliceBuffer* buffer,
+            const ReadArgs* args) override;
+  void Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             SliceBuffer* data, const WriteArgs* args) override;
+  const EventEngine::ResolvedAddress& GetPeerAddress() const override {
+    return peer_address_;
+  }
+  const EventEngine::ResolvedAddress& GetLocalAddress() const override {
+    return local_address_;
+  }
+
+ private:
+  nw_connection_t connection_;
+  dispatch_queue_t queue_;
+  MemoryAllocator memory_allocator_;
+  EventEngine::ResolvedAddress peer_address_;
+  EventEngine::ResolvedAddress local_address_;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GPR_APPLE
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_CF_ENGINE_NW_ENDPOINT_H
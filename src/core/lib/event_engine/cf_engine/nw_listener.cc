@@ -0,0 +1,257 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_APPLE
+
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+
+#include "src/core/lib/event_engine/cf_engine/nw_endpoint.h"
+#include "src/core/lib/event_engine/cf_engine/nw_listener.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/trace.h"
+#include "src/core/lib/gprpp/notification.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+struct NWListener::State {
+  State(AcceptCallback on_accept,
+        absl::AnyInvocable<void(absl::Status)> on_shutdown,
+        std::unique_ptr<MemoryAllocatorFactory> memory_allocator_factory)
+      : on_accept(std::move(on_accept)),
+        on_shutdown(std::move(on_shutdown)),
+        memory_allocator_factory(std::move(memory_allocator_factory)),
+        queue(dispatch_queue_create("grpc.cf_engine.listener",
+                                    DISPATCH_QUEUE_SERIAL)) {}
+  ~State() { dispatch_release(queue); }
+
+  // Starts \a connection on a serial queue of its own and hands it to
+  // on_accept once it is ready. Takes over the caller's reference to
+  // \a connection.
+  static void StartConnection(std::shared_ptr<State> state,
+                              nw_connection_t connection);
+  // Runs on the connection's own queue.
+  void OnConnectionReady(nw_connection_t connection, dispatch_queue_t queue);
+  // Runs on queue.
+  void OnListenerCancelled();
+
+  AcceptCallback on_accept;
+  absl::AnyInvocable<void(absl::Status)> on_shutdown;
+  std::unique_ptr<MemoryAllocatorFactory> memory_allocator_factory;
+  // Listener events are delivered here.
+  dispatch_queue_t queue;
+  grpc_core::Mutex mu;
+  bool started ABSL_GUARDED_BY(mu) = false;
+  bool shutting_down ABSL_GUARDED_BY(mu) = false;
+  std::vector<nw_listener_t> listeners ABSL_GUARDED_BY(mu);
+  // Listeners not yet reported cancelled.
+  size_t live_listeners ABSL_GUARDED_BY(mu) = 0;
+  // Connections that arrived before Start(), each retained.
+  std::vector<nw_connection_t> pending ABSL_GUARDED_BY(mu);
+};
+
+void NWListener::State::OnConnectionReady(nw_connection_t connection,
+                                          dispatch_queue_t connection_queue) {
+  {
+    grpc_core::MutexLock lock(&mu);
+    if (shutting_down) {
+      nw_connection_cancel(connection);
+      return;
+    }
+  }
+  auto endpoint = std::make_unique<NWEndpoint>(
+      connection, connection_queue,
+      memory_allocator_factory->CreateMemoryAllocator("nw-endpoint"));
+  std::string peer_name =
+      ResolvedAddressToString(endpoint->GetPeerAddress()).value_or("unknown");
+  GRPC_EVENT_ENGINE_TRACE("NWListener accepted a connection from %s",
+                          peer_name.c_str());
+  on_accept(std::move(endpoint),
+            memory_allocator_factory->CreateMemoryAllocator(absl::StrCat(
+                "on-accept-tcp-server-connection: ", peer_name)));
+}
+
+void NWListener::State::OnListenerCancelled() {
+  absl::AnyInvocable<void(absl::Status)> cb;
+  {
+    grpc_core::MutexLock lock(&mu);
+    if (--live_listeners > 0 || !shutting_down) return;
+    cb = std::move(on_shutdown);
+  }
+  if (cb != nullptr) cb(absl::OkStatus());
+}
+
+void NWListener::State::StartConnection(std::shared_ptr<State> state,
+                                        nw_connection_t connection) {
+  dispatch_queue_t queue =
+      dispatch_queue_create("grpc.cf_engine.connection", DISPATCH_QUEUE_SERIAL);
+  nw_connection_set_queue(connection, queue);
+  // The endpoint replaces this handler once the connection is ready, so the
+  // references it holds are dropped either there or on cancellation.
+  nw_connection_set_state_changed_handler(
+      connection, ^(nw_connection_state_t connection_state,
+                    nw_error_t /*error*/) {
+        switch (connection_state) {
+          case nw_connection_state_ready:
+            state->OnConnectionReady(connection, queue);
+            nw_release(connection);
+            dispatch_release(queue);
+            break;
+          case nw_connection_state_failed:
+            nw_connection_cancel(connection);
+            break;
+          case nw_connection_state_cancelled:
+            nw_release(connection);
+            dispatch_release(queue);
+            break;
+          default:
+            break;
+        }
+      });
+  nw_connection_start(connection);
+}
+
+NWListener::NWListener(
+    AcceptCallback on_accept,
+    absl::AnyInvocable<void(absl::Status)> on_shutdown,
+    std::unique_ptr<MemoryAllocatorFactory> memory_allocator_factory)
+    : state_(std::make_shared<State>(std::move(on_accept),
+                                     std::move(on_shutdown),
+                                     std::move(memory_allocator_factory))) {}
+
+NWListener::~NWListener() {
+  absl::AnyInvocable<void(absl::Status)> cb;
+  {
+    grpc_core::MutexLock lock(&state_->mu);
+    state_->shutting_down = true;
+    for (nw_listener_t listener : state_->listeners) {
+      nw_listener_cancel(listener);
+      nw_release(listener);
+    }
+    state_->listeners.clear();
+    for (nw_connection_t connection : state_->pending) {
+      nw_connection_cancel(connection);
+      nw_release(connection);
+    }
+    state_->pending.clear();
+    // Otherwise the last listener to be cancelled reports the shutdown.
+    if (state_->live_listeners == 0) cb = std::move(state_->on_shutdown);
+  }
+  if (cb != nullptr) cb(absl::OkStatus());
+}
+
+absl::StatusOr<int> NWListener::Bind(const EventEngine::ResolvedAddress& addr) {
+  {
+    grpc_core::MutexLock lock(&state_->mu);
+    if (state_->started) {
+      return absl::FailedPreconditionError(
+          "Listener is already started, ports can no longer be bound");
+    }
+  }
+  nw_parameters_t parameters = CreateTcpParameters();
+  nw_parameters_set_reuse_local_address(parameters, true);
+  nw_endpoint_t local = nw_endpoint_create_address(addr.address());
+  nw_parameters_set_local_endpoint(parameters, local);
+  nw_listener_t listener = nw_listener_create(parameters);
+  nw_release(local);
+  nw_release(parameters);
+  if (listener == nullptr) {
+    return absl::InternalError("Failed to create a Network.framework listener");
+  }
+  // Shared with the state handler, which may outlive this call.
+  struct BindResult {
+    grpc_core::Notification done;
+    absl::Status status;
+  };
+  auto result = std::make_shared<BindResult>();
+  std::shared_ptr<State> state = state_;
+  nw_listener_set_queue(listener, state->queue);
+  nw_listener_set_new_connection_handler(listener, ^(
+                                              nw_connection_t connection) {
+    nw_retain(connection);
+    {
+      grpc_core::MutexLock lock(&state->mu);
+      if (state->shutting_down) {
+        nw_connection_cancel(connection);
+        nw_release(connection);
+        return;
+      }
+      if (!state->started) {
+        state->pending.push_back(connection);
+        return;
+      }
+    }
+    State::StartConnection(state, connection);
+  });
+  nw_listener_set_state_changed_handler(
+      listener, ^(nw_listener_state_t listener_state, nw_error_t error) {
+        switch (listener_state) {
+          case nw_listener_state_ready:
+            if (!result->done.HasBeenNotified()) result->done.Notify();
+            break;
+          case nw_listener_state_failed:
+            // Bind() drops its reference once notified.
+            nw_listener_cancel(listener);
+            if (!result->done.HasBeenNotified()) {
+              result->status = NWErrorToStatus(error, "bind");
+              result->done.Notify();
+            }
+            break;
+          case nw_listener_state_cancelled:
+            state->OnListenerCancelled();
+            break;
+          default:
+            break;
+        }
+      });
+  {
+    grpc_core::MutexLock lock(&state->mu);
+    ++state->live_listeners;
+  }
+  nw_listener_start(listener);
+  result->done.WaitForNotification();
+  if (!result->status.ok()) {
+    nw_release(listener);
+    return result->status;
+  }
+  {
+    grpc_core::MutexLock lock(&state->mu);
+    state->listeners.push_back(listener);
+  }
+  return nw_listener_get_port(listener);
+}
+
+absl::Status NWListener::Start() {
+  std::vector<nw_connection_t> pending;
+  {
+    grpc_core::MutexLock lock(&state_->mu);
+    if (state_->started) {
+      return absl::FailedPreconditionError("Listener is already started");
+    }
+    state_->started = true;
+    pending.swap(state_->pending);
+  }
+  for (nw_connection_t connection : pending) {
+    State::StartConnection(state_, connection);
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GPR_APPLE
@@ -0,0 +1,68 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_CF_ENGINE_NW_LISTENER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_CF_ENGINE_NW_LISTENER_H
+#include <grpc/support/port_platform.h>
+
+#ifdef GPR_APPLE
+
+#include <Network/Network.h>
+
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/memory_allocator.h>
+
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// A listener over one Network.framework listener per bound address.
+//
+// Network.framework only reports the port it bound once it has started
+// listening, so Bind() starts the listener right away. Connections that
+// arrive before Start() are held until then.
+class NWListener : public EventEngine::Listener {
+ public:
+  NWListener(
+      AcceptCallback on_accept,
+      absl::AnyInvocable<void(absl::Status)> on_shutdown,
+      std::unique_ptr<MemoryAllocatorFactory> memory_allocator_factory);
+  ~NWListener() override;
+
+  absl::StatusOr<int> Bind(
+      const EventEngine::ResolvedAddress& addr) override;
+  absl::Status Start() override;
+
+ private:
+  // Outlives the listener for as long as the framework can still call into
+  // it.
+  struct State;
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GPR_APPLE
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_CF_ENGINE_NW_LISTENER_H
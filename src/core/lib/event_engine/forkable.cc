@@ -55,17 +55,22 @@ void PrepareFork() {
     (*forkable_iter)->PrepareFork();
   }
 }
+// The postfork handlers run in the same order as PrepareFork(), so that
+// what a Forkable repairs in the child (a poller's fds, say) is repaired
+// before the Forkables it was created on (the thread pool) run work again.
 void PostforkParent() {
   grpc_core::MutexLock lock(g_mu.get());
-  for (auto* forkable : *g_forkables) {
-    forkable->PostforkParent();
+  for (auto forkable_iter = g_forkables->rbegin();
+       forkable_iter != g_forkables->rend(); ++forkable_iter) {
+    (*forkable_iter)->PostforkParent();
   }
 }
 
 void PostforkChild() {
   grpc_core::MutexLock lock(g_mu.get());
-  for (auto* forkable : *g_forkables) {
-    forkable->PostforkChild();
+  for (auto forkable_iter = g_forkables->rbegin();
+       forkable_iter != g_forkables->rend(); ++forkable_iter) {
+    (*forkable_iter)->PostforkChild();
   }
 }
 
@@ -0,0 +1,463 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/ares_resolver.h"
+
+#if GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
+
+#include <arpa/inet.h>
+#include <inttypes.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/trace.h"
+#include "src/core/lib/gprpp/host_port.h"
+
+// IWYU pragma: no_include <ratio>
+
+using namespace std::chrono_literals;
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+// The argument of the c-ares callback for a lookup.
+struct QueryArg {
+  AresResolver* resolver;
+  intptr_t id;
+  std::string name;
+};
+
+bool IsFdStillReadable(int fd) {
+  size_t bytes_available = 0;
+  return ioctl(fd, FIONREAD, &bytes_available) == 0 && bytes_available > 0;
+}
+
+// Resolves host as an IPv4 or IPv6 literal with a numeric port, without
+// going through c-ares, as the iomgr resolver does.
+bool ResolveAsIpLiteral(const std::string& host, const std::string& port,
+                        EventEngine::ResolvedAddress* address) {
+  int port_num;
+  if (!absl::SimpleAtoi(port, &port_num) || port_num < 0 ||
+      port_num > 65535) {
+    return false;
+  }
+  sockaddr_in addr4;
+  memset(&addr4, 0, sizeof(addr4));
+  if (inet_pton(AF_INET, host.c_str(), &addr4.sin_addr) == 1) {
+    addr4.sin_family = AF_INET;
+    addr4.sin_port = htons(static_cast<uint16_t>(port_num));
+    *address = EventEngine::ResolvedAddress(
+        reinterpret_cast<sockaddr*>(&addr4), sizeof(addr4));
+    return true;
+  }
+  sockaddr_in6 addr6;
+  memset(&addr6, 0, sizeof(addr6));
+  if (inet_pton(AF_INET6, host.c_str(), &addr6.sin6_addr) == 1) {
+    addr6.sin6_family = AF_INET6;
+    addr6.sin6_port = htons(static_cast<uint16_t>(port_num));
+    *address = EventEngine::ResolvedAddress(
+        reinterpret_cast<sockaddr*>(&addr6), sizeof(addr6));
+    return true;
+  }
+  return false;
+}
+
+// Socket functions for c-ares, other than closing, which the resolver
+// handles itself.
+ares_socket_t Socket(int domain, int type, int protocol, void* /*arg*/) {
+  return socket(domain, type, protocol);
+}
+
+int Connect(ares_socket_t as, const struct sockaddr* target,
+            ares_socklen_t target_len, void* /*arg*/) {
+  return connect(as, target, target_len);
+}
+
+ares_ssize_t RecvFrom(ares_socket_t as, void* data, size_t data_len,
+                      int flags, struct sockaddr* from,
+                      ares_socklen_t* from_len, void* /*arg*/) {
+  return recvfrom(as, data, data_len, flags, from, from_len);
+}
+
+ares_ssize_t SendV(ares_socket_t as, const struct iovec* iov, int iov_count,
+                   void* /*arg*/) {
+  return writev(as, iov, iov_count);
+}
+
+absl::Status AresStatusToAbslStatus(int status, absl::string_view name) {
+  std::string message = absl::StrCat("address lookup failed for ", name, ": ",
+                                     ares_strerror(status));
+  switch (status) {
+    case ARES_ENOTFOUND:
+    case ARES_ENODATA:
+      return absl::NotFoundError(message);
+    case ARES_ETIMEOUT:
+      return absl::DeadlineExceededError(message);
+    case ARES_ECANCELLED:
+    case ARES_EDESTRUCTION:
+      return absl::CancelledError(message);
+    default:
+      return absl::UnavailableError(message);
+  }
+}
+
+}  // namespace
+
+absl::StatusOr<std::shared_ptr<AresResolver>> AresResolver::Create(
+    absl::string_view dns_server, PosixEventPoller* poller,
+    std::shared_ptr<EventEngine> event_engine) {
+  ares_channel channel;
+  ares_options opts;
+  memset(&opts, 0, sizeof(opts));
+  // Unlike the iomgr resolver's per-request channels, this channel lives as
+  // long as the resolver, so sockets are not kept open between queries.
+  int status = ares_init_options(&channel, &opts, 0);
+  if (status != ARES_SUCCESS) {
+    return absl::UnavailableError(absl::StrCat(
+        "Failed to init ares channel. C-ares error: ", ares_strerror(status)));
+  }
+  if (!dns_server.empty()) {
+    status =
+        ares_set_servers_ports_csv(channel, std::string(dns_server).c_str());
+    if (status != ARES_SUCCESS) {
+      ares_destroy(channel);
+      return absl::InvalidArgumentError(
+          absl::StrCat("Invalid DNS server ", dns_server,
+                       ". C-ares error: ", ares_strerror(status)));
+    }
+  }
+  return std::make_shared<AresResolver>(channel, poller,
+                                        std::move(event_engine));
+}
+
+AresResolver::AresResolver(ares_channel channel, PosixEventPoller* poller,
+                           std::shared_ptr<EventEngine> event_engine)
+    : channel_(channel),
+      poller_(poller),
+      event_engine_(std::move(event_engine)) {
+  static const ares_socket_functions kSocketFunctions = {
+      Socket, &AresResolver::CloseSocket, Connect, RecvFrom, SendV};
+  ares_set_socket_functions(channel_, &kSocketFunctions, this);
+}
+
+AresResolver::~AresResolver() {
+  grpc_core::MutexLock lock(&mu_);
+  GPR_ASSERT(fds_.empty());
+  GPR_ASSERT(pending_lookups_.empty());
+  ares_destroy(channel_);
+}
+
+EventEngine::DNSResolver::LookupTaskHandle AresResolver::LookupHostname(
+    EventEngine::DNSResolver::LookupHostnameCallback on_resolve,
+    absl::string_view name, absl::string_view default_port,
+    EventEngine::Duration timeout) {
+  std::string host;
+  std::string port;
+  if (!grpc_core::SplitHostPort(name, &host, &port) || host.empty()) {
+    event_engine_->Run([on_resolve = std::move(on_resolve),
+                        name = std::string(name)]() mutable {
+      on_resolve(absl::InvalidArgumentError(
+          absl::StrCat("Unparseable name: ", name)));
+    });
+    return {0, 0};
+  }
+  if (port.empty()) {
+    if (default_port.empty()) {
+      event_engine_->Run([on_resolve = std::move(on_resolve),
+                          name = std::string(name)]() mutable {
+        on_resolve(absl::InvalidArgumentError(
+            absl::StrCat("No port in name ", name)));
+      });
+      return {0, 0};
+    }
+    port = std::string(default_port);
+  }
+  EventEngine::ResolvedAddress address;
+  if (ResolveAsIpLiteral(host, port, &address)) {
+    event_engine_->Run([on_resolve = std::move(on_resolve), address]() mutable {
+      on_resolve(std::vector<EventEngine::ResolvedAddress>{address});
+    });
+    return {0, 0};
+  }
+  grpc_core::MutexLock lock(&mu_);
+  if (shutting_down_) {
+    event_engine_->Run([on_resolve = std::move(on_resolve)]() mutable {
+      on_resolve(absl::CancelledError("DNS resolver is shutting down"));
+    });
+    return {0, 0};
+  }
+  const intptr_t id = next_lookup_id_++;
+  PendingLookup& lookup = pending_lookups_[id];
+  lookup.on_resolve = std::move(on_resolve);
+  lookup.timeout_handle =
+      event_engine_->RunAfter(timeout, [self = shared_from_this(), id]() {
+        self->OnLookupTimeout(id);
+      });
+  GRPC_EVENT_ENGINE_DNS_TRACE("AresResolver:%p lookup %" PRIdPTR " for %s",
+                              this, id, host.c_str());
+  ares_addrinfo_hints hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  // c-ares may complete the lookup right away, e.g. from /etc/hosts.
+  ares_getaddrinfo(channel_, host.c_str(), port.c_str(), &hints,
+                   &AresResolver::OnHostnameResolved,
+                   new QueryArg{this, id, std::string(name)});
+  UpdateFdsLocked();
+  MaybeStartBackupPollAlarmLocked();
+  return {id, reinterpret_cast<intptr_t>(this)};
+}
+
+bool AresResolver::CancelLookup(
+    EventEngine::DNSResolver::LookupTaskHandle handle) {
+  if (handle.keys[1] != reinterpret_cast<intptr_t>(this)) return false;
+  grpc_core::MutexLock lock(&mu_);
+  auto it = pending_lookups_.find(handle.keys[0]);
+  if (it == pending_lookups_.end()) return false;
+  // The c-ares query goes on, but its result will be dropped.
+  event_engine_->Cancel(it->second.timeout_handle);
+  pending_lookups_.erase(it);
+  return true;
+}
+
+void AresResolver::Shutdown() {
+  grpc_core::MutexLock lock(&mu_);
+  if (shutting_down_) return;
+  shutting_down_ = true;
+  if (backup_poll_alarm_.has_value()) {
+    event_engine_->Cancel(*backup_poll_alarm_);
+    backup_poll_alarm_.reset();
+  }
+  // Fails the pending lookups via OnHostnameResolved().
+  ares_cancel(channel_);
+  for (auto& fdn : fds_) {
+    if (!fdn->already_shutdown) {
+      fdn->already_shutdown = true;
+      fdn->handle->ShutdownHandle(
+          absl::CancelledError("DNS resolver is shutting down"));
+    }
+  }
+  UpdateFdsLocked();
+}
+
+void AresResolver::OnHostnameResolved(void* arg, int status, int /*timeouts*/,
+                                      struct ares_addrinfo* result) {
+  std::unique_ptr<QueryArg> query_arg(static_cast<QueryArg*>(arg));
+  AresResolver* self = query_arg->resolver;
+  // Invoked from c-ares calls made with the resolver's mu_ held.
+  self->mu_.AssertHeld();
+  if (status != ARES_SUCCESS) {
+    self->FinishLookupLocked(query_arg->id,
+                             AresStatusToAbslStatus(status, query_arg->name));
+    return;
+  }
+  std::vector<EventEngine::ResolvedAddress> addresses;
+  for (ares_addrinfo_node* node = result->nodes; node != nullptr;
+       node = node->ai_next) {
+    addresses.emplace_back(node->ai_addr, node->ai_addrlen);
+  }
+  ares_freeaddrinfo(result);
+  if (addresses.empty()) {
+    self->FinishLookupLocked(
+        query_arg->id, AresStatusToAbslStatus(ARES_ENODATA, query_arg->name));
+    return;
+  }
+  self->FinishLookupLocked(query_arg->id, std::move(addresses));
+}
+
+void AresResolver::FinishLookupLocked(
+    intptr_t id,
+    absl::StatusOr<std::vector<EventEngine::ResolvedAddress>> result) {
+  auto it = pending_lookups_.find(id);
+  if (it == pending_lookups_.end()) return;
+  GRPC_EVENT_ENGINE_DNS_TRACE("AresResolver:%p lookup %" PRIdPTR " done: %s",
+                              this, id, result.status().ToString().c_str());
+  event_engine_->Cancel(it->second.timeout_handle);
+  // Run the callback outside of c-ares and the lock.
+  event_engine_->Run([on_resolve = std::move(it->second.on_resolve),
+                      result = std::move(result)]() mutable {
+    on_resolve(std::move(result));
+  });
+  pending_lookups_.erase(it);
+}
+
+void AresResolver::OnLookupTimeout(intptr_t id) {
+  grpc_core::MutexLock lock(&mu_);
+  auto it = pending_lookups_.find(id);
+  if (it == pending_lookups_.end()) return;
+  // The c-ares query goes on, but its result will be dropped.
+  event_engine_->Run([on_resolve = std::move(it->second.on_resolve)]() mutable {
+    on_resolve(absl::DeadlineExceededError("address lookup timed out"));
+  });
+  pending_lookups_.erase(it);
+}
+
+int AresResolver::CloseSocket(ares_socket_t as, void* user_data) {
+  AresResolver* self = static_cast<AresResolver*>(user_data);
+  // Invoked from c-ares calls made with the resolver's mu_ held.
+  self->mu_.AssertHeld();
+  // A socket that is registered with the poller is closed when its handle is
+  // orphaned, so that the fd cannot be reused while the poller still has it.
+  for (const auto& fdn : self->fds_) {
+    if (fdn->as == as) {
+      self->closed_sockets_.insert(as);
+      return 0;
+    }
+  }
+  return close(as);
+}
+
+void AresResolver::OnReadable(FdNode* fdn, absl::Status status) {
+  grpc_core::MutexLock lock(&mu_);
+  GPR_ASSERT(fdn->readable_registered);
+  fdn->readable_registered = false;
+  GRPC_EVENT_ENGINE_DNS_TRACE("AresResolver:%p readable on fd %d", this,
+                              fdn->as);
+  // An error means that the fd was shut down, because c-ares no longer uses
+  // it or the resolver is shutting down.
+  if (status.ok() && !fdn->already_shutdown && !shutting_down_) {
+    do {
+      ares_process_fd(channel_, fdn->as, ARES_SOCKET_BAD);
+    } while (IsFdStillReadable(fdn->as));
+  }
+  UpdateFdsLocked();
+}
+
+void AresResolver::OnWritable(FdNode* fdn, absl::Status status) {
+  grpc_core::MutexLock lock(&mu_);
+  GPR_ASSERT(fdn->writable_registered);
+  fdn->writable_registered = false;
+  GRPC_EVENT_ENGINE_DNS_TRACE("AresResolver:%p writable on fd %d", this,
+                              fdn->as);
+  if (status.ok() && !fdn->already_shutdown && !shutting_down_) {
+    ares_process_fd(channel_, ARES_SOCKET_BAD, fdn->as);
+  }
+  UpdateFdsLocked();
+}
+
+// c-ares retries queries and times them out only when it is called into, so
+// poll it periodically while it has sockets open, as the iomgr resolver
+// does.
+void AresResolver::OnBackupPollAlarm() {
+  grpc_core::MutexLock lock(&mu_);
+  backup_poll_alarm_.reset();
+  if (shutting_down_) return;
+  for (auto& fdn : fds_) {
+    if (!fdn->already_shutdown) {
+      ares_process_fd(channel_, fdn->as, fdn->as);
+    }
+  }
+  UpdateFdsLocked();
+  MaybeStartBackupPollAlarmLocked();
+}
+
+void AresResolver::MaybeStartBackupPollAlarmLocked() {
+  if (shutting_down_ || backup_poll_alarm_.has_value() || fds_.empty()) {
+    return;
+  }
+  backup_poll_alarm_ = event_engine_->RunAfter(
+      1s, [self = shared_from_this()]() { self->OnBackupPollAlarm(); });
+}
+
+void AresResolver::UpdateFdsLocked() {
+  std::list<std::unique_ptr<FdNode>> new_list;
+  if (!shutting_down_) {
+    ares_socket_t socks[ARES_GETSOCK_MAXNUM];
+    int socks_bitmask = ares_getsock(channel_, socks, ARES_GETSOCK_MAXNUM);
+    for (size_t i = 0; i < ARES_GETSOCK_MAXNUM; i++) {
+      const bool readable = ARES_GETSOCK_READABLE(socks_bitmask, i);
+      const bool writable = ARES_GETSOCK_WRITABLE(socks_bitmask, i);
+      if (!readable && !writable) continue;
+      auto it = std::find_if(fds_.begin(), fds_.end(),
+                             [as = socks[i]](const std::unique_ptr<FdNode>& n) {
+                               return n->as == as;
+                             });
+      std::unique_ptr<FdNode> fdn;
+      if (it != fds_.end()) {
+        fdn = std::move(*it);
+        fds_.erase(it);
+      } else {
+        fdn = std::make_unique<FdNode>(
+            socks[i], poller_->CreateHandle(socks[i], "c-ares socket",
+                                            /*track_err=*/false));
+        GRPC_EVENT_ENGINE_DNS_TRACE("AresResolver:%p new fd %d", this,
+                                    socks[i]);
+      }
+      FdNode* fdn_ptr = fdn.get();
+      if (readable && !fdn->readable_registered) {
+        fdn->readable_registered = true;
+        fdn->handle->NotifyOnRead(new PosixEngineClosure(
+            [self = shared_from_this(), fdn_ptr](absl::Status status) {
+              self->OnReadable(fdn_ptr, std::move(status));
+            },
+            /*is_permanent=*/false));
+      }
+      if (writable && !fdn->writable_registered) {
+        fdn->writable_registered = true;
+        fdn->handle->NotifyOnWrite(new PosixEngineClosure(
+            [self = shared_from_this(), fdn_ptr](absl::Status status) {
+              self->OnWritable(fdn_ptr, std::move(status));
+            },
+            /*is_permanent=*/false));
+      }
+      new_list.push_back(std::move(fdn));
+    }
+  }
+  // Any remaining fds were not returned by ares_getsock() and are therefore
+  // no longer in use, so they can be shut down.  They are destroyed once
+  // their pending notifications have run.
+  while (!fds_.empty()) {
+    std::unique_ptr<FdNode> fdn = std::move(fds_.front());
+    fds_.pop_front();
+    if (!fdn->already_shutdown) {
+      fdn->already_shutdown = true;
+      fdn->handle->ShutdownHandle(absl::CancelledError("c-ares fd shutdown"));
+    }
+    if (fdn->readable_registered || fdn->writable_registered) {
+      new_list.push_back(std::move(fdn));
+      continue;
+    }
+    GRPC_EVENT_ENGINE_DNS_TRACE("AresResolver:%p delete fd %d", this, fdn->as);
+    if (closed_sockets_.erase(fdn->as) > 0) {
+      fdn->handle->OrphanHandle(nullptr, nullptr, "c-ares socket closed");
+    } else {
+      // c-ares still has the socket open, and will close it.
+      int release_fd;
+      fdn->handle->OrphanHandle(nullptr, &release_fd, "c-ares fd released");
+    }
+  }
+  fds_ = std::move(new_list);
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
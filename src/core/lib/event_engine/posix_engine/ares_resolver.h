@@ -0,0 +1,131 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_ARES_RESOLVER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_ARES_RESOLVER_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#if GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
+
+#include <stdint.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ares.h>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// Resolves hostnames with c-ares on the posix EventEngine's poller.  The
+// queries' sockets are polled along with the engine's other fds and their
+// retries are driven by engine timers, so lookups do not occupy any thread
+// while they wait, and a single resolver can have any number of them in
+// flight.
+class AresResolver : public std::enable_shared_from_this<AresResolver> {
+ public:
+  // dns_server may be empty, to use the system's DNS servers.
+  static absl::StatusOr<std::shared_ptr<AresResolver>> Create(
+      absl::string_view dns_server, PosixEventPoller* poller,
+      std::shared_ptr<EventEngine> event_engine);
+
+  AresResolver(ares_channel channel, PosixEventPoller* poller,
+               std::shared_ptr<EventEngine> event_engine);
+  ~AresResolver();
+
+  EventEngine::DNSResolver::LookupTaskHandle LookupHostname(
+      EventEngine::DNSResolver::LookupHostnameCallback on_resolve,
+      absl::string_view name, absl::string_view default_port,
+      EventEngine::Duration timeout);
+  bool CancelLookup(EventEngine::DNSResolver::LookupTaskHandle handle);
+
+  // Fails all pending lookups with CANCELLED and stops polling.  Must be
+  // called before the last reference to the resolver is released.
+  void Shutdown();
+
+ private:
+  // A socket of the c-ares channel, and its registration with the poller.
+  struct FdNode {
+    FdNode(ares_socket_t as, EventHandle* handle) : as(as), handle(handle) {}
+
+    const ares_socket_t as;
+    EventHandle* const handle;
+    bool readable_registered = false;
+    bool writable_registered = false;
+    bool already_shutdown = false;
+  };
+
+  struct PendingLookup {
+    EventEngine::DNSResolver::LookupHostnameCallback on_resolve;
+    EventEngine::TaskHandle timeout_handle;
+  };
+
+  // Closes the socket for c-ares, or defers that until the socket has been
+  // removed from the poller.
+  static int CloseSocket(ares_socket_t as, void* user_data);
+  static void OnHostnameResolved(void* arg, int status, int timeouts,
+                                 struct ares_addrinfo* result);
+
+  void OnReadable(FdNode* fdn, absl::Status status);
+  void OnWritable(FdNode* fdn, absl::Status status);
+  void OnBackupPollAlarm();
+  void OnLookupTimeout(intptr_t id);
+  // Completes the lookup, unless it was cancelled or timed out.
+  void FinishLookupLocked(
+      intptr_t id,
+      absl::StatusOr<std::vector<EventEngine::ResolvedAddress>> result)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Registers the sockets c-ares is waiting on with the poller, and drops
+  // the ones it no longer uses.  Must be called after every call into
+  // c-ares that may open or close sockets.
+  void UpdateFdsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void MaybeStartBackupPollAlarmLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  grpc_core::Mutex mu_;
+  ares_channel channel_ ABSL_GUARDED_BY(mu_);
+  PosixEventPoller* const poller_;
+  const std::shared_ptr<EventEngine> event_engine_;
+  std::list<std::unique_ptr<FdNode>> fds_ ABSL_GUARDED_BY(mu_);
+  // Sockets in fds_ that c-ares has closed.
+  absl::flat_hash_set<ares_socket_t> closed_sockets_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<intptr_t, PendingLookup> pending_lookups_
+      ABSL_GUARDED_BY(mu_);
+  intptr_t next_lookup_id_ ABSL_GUARDED_BY(mu_) = 1;
+  absl::optional<EventEngine::TaskHandle> backup_poll_alarm_
+      ABSL_GUARDED_BY(mu_);
+  bool shutting_down_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_ARES_RESOLVER_H
@@ -17,7 +17,9 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <initializer_list>
 #include <memory>
 
@@ -33,6 +35,7 @@
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/time_util.h"
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/iomgr/port.h"
 
 // This polling engine is only relevant on linux kernels supporting epoll
@@ -56,6 +59,12 @@
 
 #define MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION 1
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_poll_busy_spin_us, 0,
+    "How long, in microseconds, the epoll1 poller spins on non-blocking "
+    "epoll_wait calls before blocking, and how long sockets busy poll. "
+    "0 disables busy polling.");
+
 namespace grpc_event_engine {
 namespace experimental {
 
@@ -280,6 +289,28 @@ bool InitEpoll1PollerLinux() {
   return true;
 }
 
+// Asks the kernel to busy poll the device queue of socket \a fd for
+// GRPC_POLL_BUSY_SPIN_US before sleeping when it has no data. Best effort:
+// \a fd may not be a socket, and raising SO_BUSY_POLL above the system-wide
+// default needs CAP_NET_ADMIN.
+void EnableSocketBusyPoll(int fd) {
+#ifdef SO_BUSY_POLL
+  int busy_poll_us = GPR_GLOBAL_CONFIG_GET(grpc_poll_busy_spin_us);
+  if (setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us,
+                 sizeof(busy_poll_us)) != 0 &&
+      errno != ENOTSOCK) {
+    gpr_log(GPR_DEBUG, "setsockopt(SO_BUSY_POLL) failed: %s",
+            grpc_core::StrError(errno).c_str());
+  }
+#endif
+#ifdef SO_PREFER_BUSY_POLL
+  int prefer_busy_poll = 1;
+  setsockopt(fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer_busy_poll,
+             sizeof(prefer_busy_poll));
+#endif
+  (void)fd;
+}
+
 }  // namespace
 
 void Epoll1EventHandle::OrphanHandle(PosixEngineClosure* on_done,
@@ -355,6 +386,8 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
 
 Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
     : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+  busy_poll_budget_ = std::chrono::microseconds(
+      std::max(0, GPR_GLOBAL_CONFIG_GET(grpc_poll_busy_spin_us)));
   g_epoll_set_.epfd = EpollCreateAndCloexec();
   wakeup_fd_ = *CreateWakeupFd();
   GPR_ASSERT(wakeup_fd_ != nullptr);
@@ -423,6 +456,9 @@ EventHandle* Epoll1Poller::CreateHandle(int fd, absl::string_view /*name*/,
     gpr_log(GPR_ERROR, "epoll_ctl failed: %s",
             grpc_core::StrError(errno).c_str());
   }
+  if (busy_poll_budget_ > EventEngine::Duration::zero()) {
+    EnableSocketBusyPoll(fd);
+  }
 
   return new_handle;
 }
@@ -472,12 +508,32 @@ bool Epoll1Poller::ProcessEpollEvents(int max_epoll_events_to_handle,
 //  See ProcessEpollEvents() function for more details. It returns the number
 // of events generated by epoll_wait.
 int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
-  int r;
-  do {
-    r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
-                   static_cast<int>(
-                       grpc_event_engine::experimental::Milliseconds(timeout)));
-  } while (r < 0 && errno == EINTR);
+  auto epoll_wait_for = [this](EventEngine::Duration timeout) {
+    int r;
+    do {
+      r = epoll_wait(
+          g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
+          static_cast<int>(
+              grpc_event_engine::experimental::Milliseconds(timeout)));
+    } while (r < 0 && errno == EINTR);
+    return r;
+  };
+  int r = 0;
+  if (busy_poll_budget_ > EventEngine::Duration::zero() && busy_poll_active_) {
+    // Events that arrive while spinning are picked up without a wakeup or a
+    // context switch. Once the budget is spent, block for the rest of the
+    // timeout as usual.
+    auto spin_start = std::chrono::steady_clock::now();
+    auto spin_end = spin_start + std::min(busy_poll_budget_, timeout);
+    auto now = spin_start;
+    do {
+      r = epoll_wait_for(EventEngine::Duration::zero());
+      now = std::chrono::steady_clock::now();
+    } while (r == 0 && now < spin_end);
+    timeout -= std::min<EventEngine::Duration>(timeout, now - spin_start);
+  }
+  if (r == 0) r = epoll_wait_for(timeout);
+  busy_poll_active_ = r > 0;
   if (r < 0) {
     grpc_core::Crash(absl::StrFormat(
         "(event_engine) Epoll1Poller:%p encountered epoll_wait error: %s", this,
@@ -577,11 +633,29 @@ Epoll1Poller* MakeEpoll1Poller(Scheduler* scheduler) {
 
 void Epoll1Poller::PrepareFork() { Kick(); }
 
-// TODO(vigneshbabu): implement
 void Epoll1Poller::PostforkParent() {}
 
-// TODO(vigneshbabu): implement
-void Epoll1Poller::PostforkChild() {}
+// The child shares the parent's epoll set and wakeup fd, so that each would
+// steal the other's events and kicks. Give the child its own. The fds of the
+// existing handles stay in the parent's set only: the child does not poll the
+// parent's connections.
+void Epoll1Poller::PostforkChild() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+  close(g_epoll_set_.epfd);
+  g_epoll_set_.epfd = EpollCreateAndCloexec();
+  GPR_ASSERT(g_epoll_set_.epfd >= 0);
+  g_epoll_set_.num_events = 0;
+  g_epoll_set_.cursor = 0;
+  wakeup_fd_ = *CreateWakeupFd();
+  GPR_ASSERT(wakeup_fd_ != nullptr);
+  struct epoll_event ev;
+  ev.events = static_cast<uint32_t>(EPOLLIN | EPOLLET);
+  ev.data.ptr = wakeup_fd_.get();
+  GPR_ASSERT(epoll_ctl(g_epoll_set_.epfd, EPOLL_CTL_ADD, wakeup_fd_->ReadFd(),
+                       &ev) == 0);
+  was_kicked_ = false;
+}
 
 }  // namespace experimental
 }  // namespace grpc_event_engine
@@ -127,6 +127,12 @@ class Epoll1Poller : public PosixEventPoller, public Forkable {
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<WakeupFd> wakeup_fd_;
   bool closed_;
+  // How long DoEpollWait() spins before blocking, from
+  // GRPC_POLL_BUSY_SPIN_US. Zero disables busy polling.
+  grpc_event_engine::experimental::EventEngine::Duration busy_poll_budget_;
+  // Whether the last wait found events. Spinning only pays off while events
+  // keep coming, so an idle poller blocks right away until one arrives.
+  bool busy_poll_active_ = true;
 };
 
 // Return an instance of a epoll1 based poller tied to the specified event
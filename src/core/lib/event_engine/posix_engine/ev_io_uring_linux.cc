@@ -0,0 +1,622 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/status.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/time_util.h"
+#include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/iomgr/port.h"
+
+// This polling engine is only relevant on linux kernels supporting io_uring
+// multishot poll requests.
+#ifdef GRPC_IO_URING_POLLER
+#include <errno.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/gprpp/fork.h"
+#include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/gprpp/strerror.h"
+#include "src/core/lib/gprpp/sync.h"
+
+// Size of the submission ring. Submissions are only used for registering,
+// removing and kicking, so this does not bound the number of handles.
+#define IO_URING_SQ_ENTRIES 256
+// Size of the completion ring. Every readiness edge of every registered handle
+// produces a completion, so this is sized generously.
+#define IO_URING_CQ_ENTRIES 16384
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+// user_data values which do not correspond to an IoUringEventHandle. Handle
+// addresses are word aligned and never this small.
+constexpr uint64_t kKickTag = 0;
+constexpr uint64_t kIgnoredTag = 2;
+
+int IoUringSetup(unsigned entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags, void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+}  // namespace
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(int fd, bool track_err, IoUringPoller* poller)
+      : fd_(fd),
+        track_err_(track_err),
+        poller_(poller),
+        read_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        write_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        error_closure_(
+            std::make_unique<LockfreeEvent>(poller->GetScheduler())) {
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+  }
+  void ReInit(int fd, bool track_err) {
+    fd_ = fd;
+    track_err_ = track_err;
+    orphaned_.store(false, std::memory_order_relaxed);
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // Another thread may be executing ExecutePendingActions() at this point,
+    // see Epoll1EventHandle::SetPendingActions for details.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+    return pending_read || pending_write || pending_error;
+  }
+  int WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  inline void ExecutePendingActions() {
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_->SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_->SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_->SetReady();
+    }
+  }
+  // The user_data attached to the poll request of this handle. The least
+  // significant bit stores track_err, in the same way the epoll1 poller does.
+  uint64_t UserData() const {
+    return static_cast<uint64_t>(reinterpret_cast<intptr_t>(this)) |
+           (track_err_ ? 1 : 0);
+  }
+  int fd() const { return fd_; }
+  // Written with the poller's sq_mu_ held.
+  bool orphaned() const { return orphaned_.load(std::memory_order_acquire); }
+  void set_orphaned() { orphaned_.store(true, std::memory_order_release); }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  void HandleShutdownInternal(absl::Status why);
+  // See Epoll1EventHandle::ShutdownHandle for explanation on why a mutex is
+  // required.
+  grpc_core::Mutex mu_;
+  int fd_;
+  bool track_err_;
+  // Set once the handle was orphaned. The handle is only returned to the free
+  // list once the kernel has acknowledged the removal of its poll request, so
+  // no stale completion can ever refer to a recycled handle.
+  std::atomic<bool> orphaned_{false};
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  IoUringPoller* poller_;
+  std::unique_ptr<LockfreeEvent> read_closure_;
+  std::unique_ptr<LockfreeEvent> write_closure_;
+  std::unique_ptr<LockfreeEvent> error_closure_;
+};
+
+namespace {
+
+// Checks that the running kernel supports everything the poller relies on.
+bool InitIoUringPollerLinux() {
+  // The poller does not support tearing down and recreating its rings across
+  // fork(). Use the epoll1 poller instead when fork support is enabled.
+  if (grpc_core::Fork::Enabled()) {
+    return false;
+  }
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  int fd = IoUringSetup(1, &params);
+  if (fd < 0) {
+    gpr_log(GPR_INFO, "io_uring unavailable: %s",
+            grpc_core::StrError(errno).c_str());
+    return false;
+  }
+  close(fd);
+  // Multishot poll requests were added in the same release as resource tags.
+  constexpr uint32_t kRequiredFeatures = IORING_FEAT_SINGLE_MMAP |
+                                         IORING_FEAT_NODROP |
+                                         IORING_FEAT_EXT_ARG |
+                                         IORING_FEAT_RSRC_TAGS;
+  if ((params.features & kRequiredFeatures) != kRequiredFeatures) {
+    gpr_log(GPR_INFO,
+            "io_uring does not support the required features: 0x%x",
+            params.features);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      int* release_fd,
+                                      absl::string_view reason) {
+  if (!read_closure_->IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+  {
+    // Cancel the poll request. The handle is recycled once the completion
+    // for the cancelled request has been reaped.
+    grpc_core::MutexLock lock(&poller_->sq_mu_);
+    set_orphaned();
+    poller_->QueueSubmissionLocked(IORING_OP_POLL_REMOVE, -1, kIgnoredTag,
+                                   UserData(), 0, 0);
+    poller_->FlushSubmissionsLocked();
+  }
+
+  // If release_fd is not NULL, we should be relinquishing control of the file
+  // descriptor fd->fd (but we still own the grpc_fd structure).
+  if (release_fd != nullptr) {
+    *release_fd = fd_;
+  } else {
+    shutdown(fd_, SHUT_RDWR);
+    close(fd_);
+  }
+
+  {
+    // See Epoll1EventHandle::ShutdownHandle for explanation on why a mutex is
+    // required here.
+    grpc_core::MutexLock lock(&mu_);
+    read_closure_->DestroyEvent();
+    write_closure_->DestroyEvent();
+    error_closure_->DestroyEvent();
+  }
+  pending_read_.store(false, std::memory_order_release);
+  pending_write_.store(false, std::memory_order_release);
+  pending_error_.store(false, std::memory_order_release);
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(&why, grpc_core::StatusIntProperty::kRpcStatus,
+                          GRPC_STATUS_UNAVAILABLE);
+  if (read_closure_->SetShutdown(why)) {
+    write_closure_->SetShutdown(why);
+    error_closure_->SetShutdown(why);
+  }
+}
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler)
+    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  params.flags = IORING_SETUP_CQSIZE;
+  params.cq_entries = IO_URING_CQ_ENTRIES;
+  ring_.ring_fd = IoUringSetup(IO_URING_SQ_ENTRIES, &params);
+  GPR_ASSERT(ring_.ring_fd >= 0);
+  gpr_log(GPR_INFO, "grpc io_uring fd: %d", ring_.ring_fd);
+
+  ring_.sq_ring_size =
+      params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ring_.cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  // IORING_FEAT_SINGLE_MMAP is checked in InitIoUringPollerLinux(), so both
+  // rings live in one mapping.
+  ring_.sq_ring_size = std::max(ring_.sq_ring_size, ring_.cq_ring_size);
+  ring_.sq_ring_ptr =
+      mmap(nullptr, ring_.sq_ring_size, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, ring_.ring_fd, IORING_OFF_SQ_RING);
+  GPR_ASSERT(ring_.sq_ring_ptr != MAP_FAILED);
+  ring_.cq_ring_ptr = ring_.sq_ring_ptr;
+  ring_.sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  ring_.sqes = static_cast<struct io_uring_sqe*>(
+      mmap(nullptr, ring_.sqes_size, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, ring_.ring_fd, IORING_OFF_SQES));
+  GPR_ASSERT(ring_.sqes != MAP_FAILED);
+
+  char* sq = static_cast<char*>(ring_.sq_ring_ptr);
+  ring_.sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+  ring_.sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  ring_.sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  ring_.sq_entries =
+      reinterpret_cast<unsigned*>(sq + params.sq_off.ring_entries);
+  ring_.sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+  char* cq = static_cast<char*>(ring_.cq_ring_ptr);
+  ring_.cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  ring_.cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  ring_.cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  ring_.cqes =
+      reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+}
+
+void IoUringPoller::Shutdown() { delete this; }
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+  if (ring_.sqes != nullptr) {
+    munmap(ring_.sqes, ring_.sqes_size);
+    ring_.sqes = nullptr;
+  }
+  if (ring_.sq_ring_ptr != nullptr) {
+    munmap(ring_.sq_ring_ptr, ring_.sq_ring_size);
+    ring_.sq_ring_ptr = nullptr;
+    ring_.cq_ring_ptr = nullptr;
+  }
+  if (ring_.ring_fd >= 0) {
+    // Closing the ring cancels all outstanding poll requests.
+    close(ring_.ring_fd);
+    ring_.ring_fd = -1;
+  }
+  while (!free_io_uring_handles_list_.empty()) {
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        free_io_uring_handles_list_.front());
+    free_io_uring_handles_list_.pop_front();
+    delete handle;
+  }
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+void IoUringPoller::QueueSubmissionLocked(uint8_t opcode, int fd,
+                                          uint64_t user_data, uint64_t addr,
+                                          uint32_t poll_events, uint32_t len) {
+  unsigned tail = *ring_.sq_tail;
+  if (tail - __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE) ==
+      *ring_.sq_entries) {
+    // The submission ring is full, hand the queued entries to the kernel to
+    // make room.
+    FlushSubmissionsLocked();
+  }
+  unsigned index = tail & *ring_.sq_mask;
+  struct io_uring_sqe* sqe = &ring_.sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = opcode;
+  sqe->fd = fd;
+  sqe->addr = addr;
+  sqe->len = len;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  poll_events = __builtin_bswap32(poll_events);
+  poll_events = (poll_events << 16) | (poll_events >> 16);
+#endif
+  sqe->poll32_events = poll_events;
+  sqe->user_data = user_data;
+  ring_.sq_array[index] = index;
+  __atomic_store_n(ring_.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  ++pending_submissions_;
+}
+
+void IoUringPoller::FlushSubmissionsLocked() {
+  while (pending_submissions_ > 0) {
+    int r = IoUringEnter(ring_.ring_fd, pending_submissions_, 0, 0, nullptr, 0);
+    if (r < 0) {
+      if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+        continue;
+      }
+      grpc_core::Crash(absl::StrFormat(
+          "(event_engine) IoUringPoller:%p encountered io_uring_enter error: "
+          "%s",
+          this, grpc_core::StrError(errno).c_str()));
+    }
+    pending_submissions_ -= static_cast<unsigned>(r);
+  }
+}
+
+void IoUringPoller::ArmHandleLocked(IoUringEventHandle* handle) {
+  // Multishot poll requests are edge triggered, which matches the semantics
+  // the lockfree events expect (see the use of EPOLLET in the epoll1 poller).
+  QueueSubmissionLocked(IORING_OP_POLL_ADD, handle->fd(), handle->UserData(),
+                        0, EPOLLIN | EPOLLPRI | EPOLLOUT | EPOLLET,
+                        IORING_POLL_ADD_MULTI);
+}
+
+EventHandle* IoUringPoller::CreateHandle(int fd, absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_io_uring_handles_list_.empty()) {
+      new_handle = new IoUringEventHandle(fd, track_err, this);
+    } else {
+      new_handle = reinterpret_cast<IoUringEventHandle*>(
+          free_io_uring_handles_list_.front());
+      free_io_uring_handles_list_.pop_front();
+      new_handle->ReInit(fd, track_err);
+    }
+  }
+  grpc_core::MutexLock lock(&sq_mu_);
+  ArmHandleLocked(new_handle);
+  FlushSubmissionsLocked();
+  return new_handle;
+}
+
+bool IoUringPoller::CompletionsAvailable() {
+  return *ring_.cq_head != __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+}
+
+bool IoUringPoller::WaitForCompletions(EventEngine::Duration timeout) {
+  struct __kernel_timespec ts;
+  int64_t millis = grpc_event_engine::experimental::Milliseconds(timeout);
+  ts.tv_sec = millis / 1000;
+  ts.tv_nsec = (millis % 1000) * 1000000;
+  struct io_uring_getevents_arg arg;
+  memset(&arg, 0, sizeof(arg));
+  arg.ts = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&ts));
+  int r;
+  do {
+    r = IoUringEnter(ring_.ring_fd, 0, 1,
+                     IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                     sizeof(arg));
+  } while (r < 0 && errno == EINTR && !CompletionsAvailable());
+  if (r < 0 && errno != EINTR) {
+    if (errno == ETIME) {
+      return CompletionsAvailable();
+    }
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p encountered io_uring_enter error: %s",
+        this, grpc_core::StrError(errno).c_str()));
+  }
+  return true;
+}
+
+bool IoUringPoller::ReapCompletions(Events& pending_events) {
+  bool was_kicked = false;
+  unsigned head = *ring_.cq_head;
+  unsigned tail = __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  for (int idx = 0; idx < MAX_IO_URING_COMPLETIONS && head != tail;
+       idx++, head++) {
+    struct io_uring_cqe* cqe = &ring_.cqes[head & *ring_.cq_mask];
+    uint64_t user_data = cqe->user_data;
+    if (user_data == kKickTag) {
+      was_kicked = true;
+      continue;
+    }
+    if (user_data == kIgnoredTag) {
+      continue;
+    }
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        static_cast<intptr_t>(user_data) & ~intptr_t{1});
+    bool track_err = (user_data & uint64_t{1}) != 0;
+    if ((cqe->flags & IORING_CQE_F_MORE) == 0) {
+      // The poll request terminated. Either the handle was orphaned and the
+      // request cancelled, in which case the handle can now be recycled, or
+      // the kernel dropped the request and it must be re-armed.
+      bool recycle;
+      {
+        grpc_core::MutexLock lock(&sq_mu_);
+        recycle = handle->orphaned();
+        if (!recycle) {
+          ArmHandleLocked(handle);
+          FlushSubmissionsLocked();
+        }
+      }
+      if (recycle) {
+        free_io_uring_handles_list_.push_back(handle);
+        continue;
+      }
+    }
+    // Readiness reported after the handle was orphaned is dropped, the
+    // lockfree events have already been destroyed at that point.
+    if (cqe->res <= 0 || handle->orphaned()) {
+      continue;
+    }
+    uint32_t events = static_cast<uint32_t>(cqe->res);
+    bool cancel = (events & EPOLLHUP) != 0;
+    bool error = (events & EPOLLERR) != 0;
+    bool read_ev = (events & (EPOLLIN | EPOLLPRI)) != 0;
+    bool write_ev = (events & EPOLLOUT) != 0;
+    bool err_fallback = error && !track_err;
+    if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                  write_ev || cancel || err_fallback,
+                                  error && !err_fallback)) {
+      pending_events.push_back(handle);
+    }
+  }
+  __atomic_store_n(ring_.cq_head, head, __ATOMIC_RELEASE);
+  return was_kicked;
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  // See Epoll1EventHandle::ShutdownHandle for explanation on why a mutex is
+  // required.
+  grpc_core::MutexLock lock(&mu_);
+  HandleShutdownInternal(why);
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_->IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_->NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_->NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_->NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_->SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_->SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_->SetReady(); }
+
+// Reaps completions until timeout is reached or there is a Kick(). Unlike
+// epoll_wait(), the completion ring may hold entries that do not carry any
+// readiness (e.g. acknowledgements of cancelled poll requests), in which case
+// the poller keeps waiting rather than reporting a spurious Kick.
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  bool was_kicked_ext = false;
+  while (pending_events.empty() && !was_kicked_ext) {
+    if (!CompletionsAvailable() && !WaitForCompletions(timeout)) {
+      return Poller::WorkResult::kDeadlineExceeded;
+    }
+    grpc_core::MutexLock lock(&mu_);
+    if (ReapCompletions(pending_events)) {
+      was_kicked_ = false;
+      was_kicked_ext = true;
+    }
+  }
+  if (pending_events.empty()) {
+    return Poller::WorkResult::kKicked;
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (was_kicked_ || closed_) {
+      return;
+    }
+    was_kicked_ = true;
+  }
+  // A no-op request completes immediately and wakes up the thread blocked in
+  // WaitForCompletions().
+  grpc_core::MutexLock lock(&sq_mu_);
+  QueueSubmissionLocked(IORING_OP_NOP, -1, kKickTag, 0, 0, 0);
+  FlushSubmissionsLocked();
+}
+
+IoUringPoller* MakeIoUringPoller(Scheduler* scheduler) {
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (kIoUringPollerSupported) {
+    return new IoUringPoller(scheduler);
+  }
+  return nullptr;
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#else  // defined(GRPC_IO_URING_POLLER)
+#if defined(GRPC_POSIX_SOCKET_TCP)
+
+namespace grpc_event_engine {
+namespace experimental {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+
+IoUringPoller::IoUringPoller(Scheduler* /* engine */) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Shutdown() { grpc_core::Crash("unimplemented"); }
+
+IoUringPoller::~IoUringPoller() { grpc_core::Crash("unimplemented"); }
+
+EventHandle* IoUringPoller::CreateHandle(int /*fd*/,
+                                         absl::string_view /*name*/,
+                                         bool /*track_err*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Kick() { grpc_core::Crash("unimplemented"); }
+
+// If GRPC_IO_URING_POLLER is not defined, it means io_uring is not available.
+// Return nullptr.
+IoUringPoller* MakeIoUringPoller(Scheduler* /*scheduler*/) { return nullptr; }
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // defined(GRPC_POSIX_SOCKET_TCP)
+#endif  // !defined(GRPC_IO_URING_POLLER)
@@ -0,0 +1,156 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <list>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+// Multishot poll requests and extended io_uring_enter() arguments are both
+// required, they are available in kernel headers from 5.13 onwards.
+#if defined(IORING_POLL_ADD_MULTI) && defined(IORING_FEAT_EXT_ARG)
+#define GRPC_IO_URING_POLLER 1
+#endif
+#endif
+
+// Number of completion queue entries reaped per call to Work(...).
+#define MAX_IO_URING_COMPLETIONS 100
+
+namespace grpc_event_engine {
+namespace experimental {
+
+class IoUringEventHandle;
+
+// Definition of an io_uring based poller.
+//
+// Every handle is registered with a single multishot IORING_OP_POLL_ADD
+// request, so a socket stays armed for its whole lifetime and readiness is
+// reported as completion queue entries. Work(...) reaps completions directly
+// from the shared completion ring and only enters the kernel when the ring is
+// empty, which lets a single io_uring_enter() collect events for any number of
+// sockets. Submissions (registration, removal and kicks) are written to the
+// shared submission ring and flushed in batches.
+class IoUringPoller : public PosixEventPoller {
+ public:
+  explicit IoUringPoller(Scheduler* scheduler);
+  EventHandle* CreateHandle(int fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  Scheduler* GetScheduler() { return scheduler_; }
+  void Shutdown() override;
+  bool CanTrackErrors() const override {
+#ifdef GRPC_POSIX_SOCKET_TCP
+    return KernelSupportsErrqueue();
+#else
+    return false;
+#endif
+  }
+  ~IoUringPoller() override;
+
+ private:
+  // This initial vector size may need to be tuned
+  using Events = absl::InlinedVector<IoUringEventHandle*, 5>;
+  friend class IoUringEventHandle;
+#ifdef GRPC_IO_URING_POLLER
+  struct Ring {
+    int ring_fd = -1;
+    // Submission ring.
+    void* sq_ring_ptr = nullptr;
+    size_t sq_ring_size = 0;
+    unsigned* sq_head = nullptr;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_mask = nullptr;
+    unsigned* sq_entries = nullptr;
+    unsigned* sq_array = nullptr;
+    struct io_uring_sqe* sqes = nullptr;
+    size_t sqes_size = 0;
+    // Completion ring. It shares its mapping with the submission ring when the
+    // kernel supports IORING_FEAT_SINGLE_MMAP.
+    void* cq_ring_ptr = nullptr;
+    size_t cq_ring_size = 0;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned* cq_mask = nullptr;
+    struct io_uring_cqe* cqes = nullptr;
+  };
+#else
+  struct Ring {};
+#endif
+  // Appends a submission queue entry to the submission ring. The entry is not
+  // visible to the kernel until FlushSubmissionsLocked() is called.
+  void QueueSubmissionLocked(uint8_t opcode, int fd, uint64_t user_data,
+                             uint64_t addr, uint32_t poll_events,
+                             uint32_t len) ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Hands all queued submission queue entries to the kernel.
+  void FlushSubmissionsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Arms the multishot poll request associated with the handle.
+  void ArmHandleLocked(IoUringEventHandle* handle)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Returns true if there are completions waiting in the completion ring.
+  bool CompletionsAvailable();
+  // Blocks in io_uring_enter() until at least one completion is available or
+  // the timeout expires. Returns false on timeout.
+  bool WaitForCompletions(
+      grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Consumes up to MAX_IO_URING_COMPLETIONS entries from the completion ring
+  // and appends the handles that have pending actions to pending_events. It
+  // returns true if there was a Kick amongst the consumed completions.
+  bool ReapCompletions(Events& pending_events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void Close();
+
+  grpc_core::Mutex mu_;
+  // Guards the submission ring. Completions are only ever consumed by the
+  // thread executing Work(...) and need no lock.
+  grpc_core::Mutex sq_mu_;
+  Scheduler* scheduler_;
+  Ring ring_;
+  unsigned pending_submissions_ ABSL_GUARDED_BY(sq_mu_) = 0;
+  bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  std::list<EventHandle*> free_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  bool closed_;
+};
+
+// Return an instance of an io_uring based poller tied to the specified
+// scheduler. Returns nullptr if io_uring is unavailable or if fork support is
+// enabled.
+IoUringPoller* MakeIoUringPoller(Scheduler* scheduler);
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
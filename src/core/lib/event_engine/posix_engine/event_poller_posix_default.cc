@@ -18,6 +18,7 @@
 #include "absl/strings/string_view.h"
 
 #include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/ev_poll_posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/gprpp/global_config.h"
@@ -47,7 +48,11 @@ PosixEventPoller* MakeDefaultPoller(Scheduler* scheduler) {
   auto strings = absl::StrSplit(poll_strategy, ',');
   for (auto it = strings.begin(); it != strings.end() && poller == nullptr;
        it++) {
-    if (PollStrategyMatches(*it, "epoll1")) {
+    // The io_uring poller is opt-in only and is not part of "all".
+    if (*it == "io_uring") {
+      poller = MakeIoUringPoller(scheduler);
+    }
+    if (poller == nullptr && PollStrategyMatches(*it, "epoll1")) {
       poller = MakeEpoll1Poller(scheduler);
     }
     if (poller == nullptr && PollStrategyMatches(*it, "poll")) {
@@ -36,6 +36,7 @@
 #include <grpc/event_engine/internal/slice_cast.h>
 #include <grpc/event_engine/slice.h>
 #include <grpc/event_engine/slice_buffer.h>
+#include <grpc/slice.h>
 #include <grpc/status.h>
 #include <grpc/support/log.h>
 
@@ -52,6 +53,7 @@
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_pool.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 #ifdef GRPC_LINUX_ERRQUEUE
@@ -59,8 +61,10 @@
 #include <linux/capability.h>  // IWYU pragma: keep
 #include <linux/errqueue.h>    // IWYU pragma: keep
 #include <linux/netlink.h>     // IWYU pragma: keep
+#include <sys/mman.h>          // IWYU pragma: keep
 #include <sys/prctl.h>         // IWYU pragma: keep
 #include <sys/resource.h>      // IWYU pragma: keep
+#include <unistd.h>            // IWYU pragma: keep
 #endif
 #include <netinet/in.h>  // IWYU pragma: keep
 
@@ -88,6 +92,12 @@
 #define MSG_ZEROCOPY 0x4000000
 #endif
 
+// TCP zero copy receive getsockopt option. Defined here for the same reason as
+// MSG_ZEROCOPY above.
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+
 #define MAX_READ_IOVEC 64
 
 namespace grpc_event_engine {
@@ -108,6 +118,22 @@ ssize_t TcpSend(int fd, const struct msghdr* msg, int* saved_errno,
 
 #ifdef GRPC_LINUX_ERRQUEUE
 
+// Reads expected to carry fewer bytes than this are never attempted with
+// TCP_ZEROCOPY_RECEIVE: mapping pages only beats copying them for large
+// payloads.
+constexpr size_t kZerocopyReceiveThresholdBytes = 256 * 1024;
+// The largest region mapped by a single zero copy receive.
+constexpr size_t kZerocopyReceiveMaxBytes = 16 * 1024 * 1024;
+
+// Argument of getsockopt(TCP_ZEROCOPY_RECEIVE). Mirrors the leading fields of
+// struct tcp_zerocopy_receive from linux/tcp.h, which older kernel headers do
+// not provide. Every kernel supporting the option accepts this layout.
+struct TcpZerocopyReceiveArgs {
+  uint64_t address;         // In: start of the mapped region.
+  uint32_t length;          // In: size of the region. Out: bytes mapped.
+  uint32_t recv_skip_hint;  // Out: bytes that must be read with recvmsg.
+};
+
 #define CAP_IS_SUPPORTED(cap) (prctl(PR_CAPBSET_READ, (cap), 0) > 0)
 
 // Remove spaces and newline characters from the end of a string.
@@ -315,6 +341,17 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   GPR_ASSERT(incoming_buffer_->Length() != 0);
   GPR_DEBUG_ASSERT(min_progress_size_ > 0);
 
+  // Bytes at the head of the receive queue that were mapped rather than
+  // copied. They precede everything read by recvmsg below.
+  Slice zerocopy_slice;
+#ifdef GRPC_LINUX_ERRQUEUE
+  if (zerocopy_receive_enabled_) {
+    zerocopy_slice = TcpZerocopyReceive();
+    AddToEstimate(zerocopy_slice.length());
+  }
+#endif  // GRPC_LINUX_ERRQUEUE
+  const size_t zerocopy_read_bytes = zerocopy_slice.length();
+
   do {
     // Assume there is something on the queue. If we receive TCP_INQ from
     // kernel, we will update this value, otherwise, we have to assume there is
@@ -341,7 +378,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     if (read_bytes < 0 && errno == EAGAIN) {
       // NB: After calling call_read_cb a parallel call of the read handler may
       // be running.
-      if (total_read_bytes > 0) {
+      if (total_read_bytes > 0 || zerocopy_read_bytes > 0) {
         break;
       }
       FinishEstimate();
@@ -351,7 +388,7 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
 
     // We have read something in previous reads. We need to deliver those bytes
     // to the upper layer.
-    if (read_bytes <= 0 && total_read_bytes >= 1) {
+    if (read_bytes <= 0 && total_read_bytes + zerocopy_read_bytes >= 1) {
       inq_ = 1;
       break;
     }
@@ -413,6 +450,11 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
     iov_len = j;
   } while (true);
 
+  if (zerocopy_read_bytes > 0) {
+    incoming_buffer_->Prepend(std::move(zerocopy_slice));
+    total_read_bytes += zerocopy_read_bytes;
+  }
+
   if (inq_ == 0) {
     FinishEstimate();
   }
@@ -452,6 +494,61 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   return true;
 }
 
+#ifdef GRPC_LINUX_ERRQUEUE
+Slice PosixEndpointImpl::TcpZerocopyReceive() {
+  static const size_t kPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  // Map as much as the upper layer is known to want, or as much as is known to
+  // be queued on the socket, in whole pages.
+  size_t map_length = std::min(
+      static_cast<size_t>(std::max(inq_, min_progress_size_)),
+      kZerocopyReceiveMaxBytes);
+  map_length -= map_length % kPageSize;
+  if (map_length < kZerocopyReceiveThresholdBytes) {
+    return Slice();
+  }
+  void* address = mmap(nullptr, map_length, PROT_READ, MAP_SHARED, fd_, 0);
+  if (address == MAP_FAILED) {
+    gpr_log(GPR_DEBUG, "Rx zero-copy disabled, mmap failed fd=%d errno=%d",
+            fd_, errno);
+    zerocopy_receive_enabled_ = false;
+    return Slice();
+  }
+  TcpZerocopyReceiveArgs args{};
+  args.address = reinterpret_cast<uintptr_t>(address);
+  args.length = static_cast<uint32_t>(map_length);
+  socklen_t args_length = sizeof(args);
+  int result;
+  do {
+    result = getsockopt(fd_, SOL_TCP, TCP_ZEROCOPY_RECEIVE, &args,
+                        &args_length);
+  } while (result < 0 && errno == EINTR);
+  if (result < 0) {
+    if (errno != EAGAIN) {
+      gpr_log(GPR_DEBUG,
+              "Rx zero-copy disabled, TCP_ZEROCOPY_RECEIVE failed fd=%d "
+              "errno=%d",
+              fd_, errno);
+      zerocopy_receive_enabled_ = false;
+    }
+    munmap(address, map_length);
+    return Slice();
+  }
+  // The kernel maps whole pages only, so the unused tail of the region is page
+  // aligned as well.
+  if (args.length < map_length) {
+    munmap(static_cast<char*>(address) + args.length,
+           map_length - args.length);
+  }
+  if (args.length == 0) {
+    return Slice();
+  }
+  // The pages stay mapped, and so charged to the socket, until the last
+  // reference to the slice is dropped.
+  return Slice(grpc_slice_new_with_len(
+      address, args.length, [](void* p, size_t len) { munmap(p, len); }));
+}
+#endif  // GRPC_LINUX_ERRQUEUE
+
 void PosixEndpointImpl::PerformReclamation() {
   read_mu_.Lock();
   if (incoming_buffer_ != nullptr) {
@@ -519,6 +616,8 @@ void PosixEndpointImpl::UpdateRcvLowat() {
 void PosixEndpointImpl::MaybeMakeReadSlices() {
   static const int kBigAlloc = 64 * 1024;
   static const int kSmallAlloc = 8 * 1024;
+  // The largest frame HTTP/2 allows.
+  static const int kMaxContiguousAlloc = 16 * 1024 * 1024;
   if (incoming_buffer_->Length() < static_cast<size_t>(min_progress_size_)) {
     size_t allocate_length = min_progress_size_;
     const size_t target_length = static_cast<size_t>(target_length_);
@@ -526,6 +625,17 @@ void PosixEndpointImpl::MaybeMakeReadSlices() {
     // min_progress_size bytes to read, allocate a bit more.
     const bool low_memory_pressure =
         memory_owner_.GetPressureInfo().pressure_control_value < 0.8;
+    // If the upper layer is waiting on a large frame, read its payload into
+    // one buffer of its size, in place of the spare space left over from the
+    // last read, so that the frame reaches the parser as a single slice.
+    if (low_memory_pressure &&
+        min_progress_size_ - static_cast<int>(incoming_buffer_->Length()) >
+            kBigAlloc) {
+      incoming_buffer_->Clear();
+      incoming_buffer_->AppendIndexed(Slice(grpc_core::PooledSliceMalloc(
+          std::min(min_progress_size_, kMaxContiguousAlloc),
+          &memory_owner_)));
+    }
     if (low_memory_pressure && target_length > allocate_length) {
       allocate_length = target_length;
     }
@@ -536,13 +646,13 @@ void PosixEndpointImpl::MaybeMakeReadSlices() {
       while (extra_wanted > 0) {
         extra_wanted -= kBigAlloc;
         incoming_buffer_->AppendIndexed(
-            Slice(memory_owner_.MakeSlice(kBigAlloc)));
+            Slice(grpc_core::PooledSliceMalloc(kBigAlloc, &memory_owner_)));
       }
     } else {
       while (extra_wanted > 0) {
         extra_wanted -= kSmallAlloc;
         incoming_buffer_->AppendIndexed(
-            Slice(memory_owner_.MakeSlice(kSmallAlloc)));
+            Slice(grpc_core::PooledSliceMalloc(kSmallAlloc, &memory_owner_)));
       }
     }
     MaybePostReclaimer();
@@ -1249,6 +1359,9 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   tcp_zerocopy_send_ctx_ = std::make_unique<TcpZerocopySendCtx>(
       zerocopy_enabled, options.tcp_tx_zerocopy_max_simultaneous_sends,
       options.tcp_tx_zerocopy_send_bytes_threshold);
+#ifdef GRPC_LINUX_ERRQUEUE
+  zerocopy_receive_enabled_ = grpc_core::IsTcpRxZerocopyEnabled();
+#endif  // GRPC_LINUX_ERRQUEUE
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
   if (setsockopt(fd_, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
@@ -522,6 +522,10 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
                            int additional_flags);
   absl::Status TcpAnnotateError(absl::Status src_error);
 #ifdef GRPC_LINUX_ERRQUEUE
+  // Maps the head of the socket's receive queue into a slice using
+  // TCP_ZEROCOPY_RECEIVE, if enough bytes are expected for that to pay off.
+  // Returns an empty slice if nothing was mapped.
+  Slice TcpZerocopyReceive() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   bool ProcessErrors();
   // Reads a cmsg to process zerocopy control messages.
   void ProcessZerocopy(struct cmsghdr* cmsg);
@@ -549,6 +553,11 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   int inq_ = 1;
   // cache whether kernel supports inq.
   bool inq_capable_ = false;
+#ifdef GRPC_LINUX_ERRQUEUE
+  // True while large reads should be attempted with TCP_ZEROCOPY_RECEIVE.
+  // Cleared if the socket turns out not to support it.
+  bool zerocopy_receive_enabled_ ABSL_GUARDED_BY(read_mu_) = false;
+#endif  // GRPC_LINUX_ERRQUEUE
 
   grpc_event_engine::experimental::SliceBuffer* outgoing_buffer_ = nullptr;
   // byte within outgoing_buffer's slices[0] to write next.
@@ -43,6 +43,7 @@
 #include "src/core/lib/event_engine/posix_engine/timer.h"
 #include "src/core/lib/event_engine/shim.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/thread_affinity.h"
 #include "src/core/lib/event_engine/trace.h"
 #include "src/core/lib/event_engine/utils.h"
 #include "src/core/lib/gprpp/crash.h"
@@ -305,8 +306,10 @@ PosixEnginePollerManager::PosixEnginePollerManager(PosixEventPoller* poller)
 
 void PosixEnginePollerManager::Run(
     experimental::EventEngine::Closure* closure) {
+  // The poller hands over fd events, which are mostly endpoint reads and
+  // writes.
   if (executor_ != nullptr) {
-    executor_->Run(closure);
+    executor_->Run(closure, ThreadPool::Priority::kTransportIo);
   }
 }
 
@@ -337,6 +340,7 @@ PosixEnginePollerManager::~PosixEnginePollerManager() {
 
 PosixEventEngine::PosixEventEngine(PosixEventPoller* poller)
     : connection_shards_(std::max(2 * gpr_cpu_num_cores(), 1u)),
+      timer_handle_shards_(std::max(2 * gpr_cpu_num_cores(), 1u)),
       executor_(std::make_shared<ThreadPool>()),
       timer_manager_(executor_) {
   if (NeedPosixEngine()) {
@@ -346,6 +350,7 @@ PosixEventEngine::PosixEventEngine(PosixEventPoller* poller)
 
 PosixEventEngine::PosixEventEngine()
     : connection_shards_(std::max(2 * gpr_cpu_num_cores(), 1u)),
+      timer_handle_shards_(std::max(2 * gpr_cpu_num_cores(), 1u)),
       executor_(std::make_shared<ThreadPool>()),
       timer_manager_(executor_) {
   if (NeedPosixEngine()) {
@@ -366,14 +371,23 @@ void PosixEventEngine::PollerWorkInternal(
   // this can be improved by setting the timeout to the next expiring timer.
   PosixEventPoller* poller = poller_manager->Poller();
   ThreadPool* executor = poller_manager->Executor();
+  // Polling hops between thread pool threads, so the thread doing it moves
+  // to the poller CPUs for the duration. That costs a syscall either way,
+  // which is only paid when poller CPUs are configured.
+  const bool pin_poller = HasThreadAffinity(ThreadRole::kPoller);
+  if (pin_poller) SetCurrentThreadAffinity(ThreadRole::kPoller);
   auto result = poller->Work(24h, [executor, &poller_manager]() {
     executor->Run([poller_manager]() mutable {
       PollerWorkInternal(std::move(poller_manager));
     });
   });
-  if (result == Poller::WorkResult::kDeadlineExceeded) {
+  if (pin_poller) SetCurrentThreadAffinity(ThreadRole::kExecutor);
+  if (result == Poller::WorkResult::kDeadlineExceeded ||
+      (result == Poller::WorkResult::kKicked &&
+       !poller_manager->IsShuttingDown())) {
     // The EventEngine is not shutting down but the next asynchronous
-    // PollerWorkInternal did not get scheduled. Schedule it now.
+    // PollerWorkInternal did not get scheduled. Schedule it now. A kick that
+    // is not for shutdown comes from a fork; the poll resumes after it.
     executor->Run([poller_manager = std::move(poller_manager)]() {
       PollerWorkInternal(poller_manager);
     });
@@ -405,8 +419,9 @@ struct PosixEventEngine::ClosureData final : public EventEngine::Closure {
     GRPC_EVENT_ENGINE_TRACE("PosixEventEngine:%p executing callback:%s", engine,
                             HandleToString(handle).c_str());
     {
-      grpc_core::MutexLock lock(&engine->mu_);
-      engine->known_handles_.erase(handle);
+      TimerHandleShard* shard = engine->TimerHandleShardFor(handle);
+      grpc_core::MutexLock lock(&shard->mu);
+      shard->known_handles.erase(handle);
     }
     cb();
     delete this;
@@ -414,10 +429,10 @@ struct PosixEventEngine::ClosureData final : public EventEngine::Closure {
 };
 
 PosixEventEngine::~PosixEventEngine() {
-  {
-    grpc_core::MutexLock lock(&mu_);
+  for (auto& shard : timer_handle_shards_) {
+    grpc_core::MutexLock lock(&shard.mu);
     if (GRPC_TRACE_FLAG_ENABLED(grpc_event_engine_trace)) {
-      for (auto handle : known_handles_) {
+      for (auto handle : shard.known_handles) {
         gpr_log(GPR_ERROR,
                 "(event_engine) PosixEventEngine:%p uncleared "
                 "TaskHandle at "
@@ -425,7 +440,7 @@ PosixEventEngine::~PosixEventEngine() {
                 this, HandleToString(handle).c_str());
       }
     }
-    GPR_ASSERT(GPR_LIKELY(known_handles_.empty()));
+    GPR_ASSERT(GPR_LIKELY(shard.known_handles.empty()));
   }
   timer_manager_.Shutdown();
 #ifdef GRPC_POSIX_SOCKET_TCP
@@ -437,11 +452,12 @@ PosixEventEngine::~PosixEventEngine() {
 }
 
 bool PosixEventEngine::Cancel(EventEngine::TaskHandle handle) {
-  grpc_core::MutexLock lock(&mu_);
-  if (!known_handles_.contains(handle)) return false;
+  TimerHandleShard* shard = TimerHandleShardFor(handle);
+  grpc_core::MutexLock lock(&shard->mu);
+  if (!shard->known_handles.contains(handle)) return false;
   auto* cd = reinterpret_cast<ClosureData*>(handle.keys[0]);
   bool r = timer_manager_.TimerCancel(&cd->timer);
-  known_handles_.erase(handle);
+  shard->known_handles.erase(handle);
   if (r) delete cd;
   return r;
 }
@@ -472,8 +488,9 @@ EventEngine::TaskHandle PosixEventEngine::RunAfterInternal(
   cd->engine = this;
   EventEngine::TaskHandle handle{reinterpret_cast<intptr_t>(cd),
                                  aba_token_.fetch_add(1)};
-  grpc_core::MutexLock lock(&mu_);
-  known_handles_.insert(handle);
+  TimerHandleShard* shard = TimerHandleShardFor(handle);
+  grpc_core::MutexLock lock(&shard->mu);
+  shard->known_handles.insert(handle);
   cd->handle = handle;
   GRPC_EVENT_ENGINE_TRACE("PosixEventEngine:%p scheduling callback:%s", this,
                           HandleToString(handle).c_str());
@@ -481,9 +498,70 @@ EventEngine::TaskHandle PosixEventEngine::RunAfterInternal(
   return handle;
 }
 
+#if GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
+
+PosixEventEngine::PosixDNSResolver::PosixDNSResolver(
+    std::shared_ptr<AresResolver> ares_resolver, EventEngine* event_engine)
+    : ares_resolver_(std::move(ares_resolver)), event_engine_(event_engine) {}
+
+PosixEventEngine::PosixDNSResolver::~PosixDNSResolver() {
+  ares_resolver_->Shutdown();
+}
+
+EventEngine::DNSResolver::LookupTaskHandle
+PosixEventEngine::PosixDNSResolver::LookupHostname(
+    LookupHostnameCallback on_resolve, absl::string_view name,
+    absl::string_view default_port, Duration timeout) {
+  return ares_resolver_->LookupHostname(std::move(on_resolve), name,
+                                        default_port, timeout);
+}
+
+EventEngine::DNSResolver::LookupTaskHandle
+PosixEventEngine::PosixDNSResolver::LookupSRV(LookupSRVCallback on_resolve,
+                                              absl::string_view /*name*/,
+                                              Duration /*timeout*/) {
+  event_engine_->Run([on_resolve = std::move(on_resolve)]() mutable {
+    on_resolve(absl::UnimplementedError("SRV lookups are not supported"));
+  });
+  return {0, 0};
+}
+
+EventEngine::DNSResolver::LookupTaskHandle
+PosixEventEngine::PosixDNSResolver::LookupTXT(LookupTXTCallback on_resolve,
+                                              absl::string_view /*name*/,
+                                              Duration /*timeout*/) {
+  event_engine_->Run([on_resolve = std::move(on_resolve)]() mutable {
+    on_resolve(absl::UnimplementedError("TXT lookups are not supported"));
+  });
+  return {0, 0};
+}
+
+bool PosixEventEngine::PosixDNSResolver::CancelLookup(
+    LookupTaskHandle handle) {
+  return ares_resolver_->CancelLookup(handle);
+}
+
+#endif  // GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
+
 std::unique_ptr<EventEngine::DNSResolver> PosixEventEngine::GetDNSResolver(
-    EventEngine::DNSResolver::ResolverOptions const& /*options*/) {
+    EventEngine::DNSResolver::ResolverOptions const& options) {
+#if GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
+  if (!NeedPosixEngine()) {
+    grpc_core::Crash("unimplemented");
+  }
+  GPR_ASSERT(poller_manager_ != nullptr);
+  auto ares_resolver = AresResolver::Create(
+      options.dns_server, poller_manager_->Poller(), shared_from_this());
+  if (!ares_resolver.ok()) {
+    gpr_log(GPR_ERROR, "Failed to create DNS resolver: %s",
+            ares_resolver.status().ToString().c_str());
+    return nullptr;
+  }
+  return std::make_unique<PosixDNSResolver>(std::move(*ares_resolver), this);
+#else   // GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
+  (void)options;
   grpc_core::Crash("unimplemented");
+#endif  // GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
 }
 
 bool PosixEventEngine::IsWorkerThread() { grpc_core::Crash("unimplemented"); }
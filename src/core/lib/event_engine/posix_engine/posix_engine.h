@@ -36,6 +36,7 @@
 
 #include "src/core/lib/event_engine/handle_containers.h"
 #include "src/core/lib/event_engine/posix.h"
+#include "src/core/lib/event_engine/posix_engine/ares_resolver.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/timer_manager.h"
 #include "src/core/lib/event_engine/thread_pool.h"
@@ -138,6 +139,10 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport,
  public:
   class PosixDNSResolver : public EventEngine::DNSResolver {
    public:
+#if GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
+    PosixDNSResolver(std::shared_ptr<AresResolver> ares_resolver,
+                     EventEngine* event_engine);
+#endif  // GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
     ~PosixDNSResolver() override;
     LookupTaskHandle LookupHostname(LookupHostnameCallback on_resolve,
                                     absl::string_view name,
@@ -150,6 +155,13 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport,
                                absl::string_view name,
                                Duration timeout) override;
     bool CancelLookup(LookupTaskHandle handle) override;
+
+#if GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
+   private:
+    std::shared_ptr<AresResolver> ares_resolver_;
+    // Kept alive by ares_resolver_.
+    EventEngine* event_engine_;
+#endif  // GRPC_ARES == 1 && defined(GRPC_POSIX_SOCKET_TCP)
   };
 
 #ifdef GRPC_POSIX_SOCKET_TCP
@@ -243,8 +255,18 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport,
 
 #endif  // GRPC_POSIX_SOCKET_TCP
 
-  grpc_core::Mutex mu_;
-  TaskHandleSet known_handles_ ABSL_GUARDED_BY(mu_);
+  // Outstanding RunAfter tasks, sharded by ABA token so that timers set,
+  // cancelled and fired on different threads rarely share a lock.
+  struct TimerHandleShard {
+    grpc_core::Mutex mu;
+    TaskHandleSet known_handles ABSL_GUARDED_BY(&mu);
+  };
+  TimerHandleShard* TimerHandleShardFor(const TaskHandle& handle) {
+    return &timer_handle_shards_[static_cast<uintptr_t>(handle.keys[1]) %
+                                 timer_handle_shards_.size()];
+  }
+
+  std::vector<TimerHandleShard> timer_handle_shards_;
   std::atomic<intptr_t> aba_token_{0};
   std::shared_ptr<ThreadPool> executor_;
   TimerManager timer_manager_;
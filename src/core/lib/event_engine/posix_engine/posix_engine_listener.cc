@@ -25,6 +25,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/status/status.h"
@@ -33,6 +34,7 @@
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/event_engine/memory_allocator.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
@@ -94,19 +96,55 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
   // Update the callback. Any subsequent new sockets created and added to
   // acceptors_ in this function will invoke the new callback.
   acceptors_.UpdateOnAppendCallback(std::move(on_bind_new_fd));
+  const int first_socket = acceptors_.Size();
+  absl::StatusOr<int> port;
   if (used_port.has_value()) {
     requested_port = *used_port;
-    return ListenerContainerAddWildcardAddresses(acceptors_, options_,
+    port = ListenerContainerAddWildcardAddresses(acceptors_, options_,
                                                  requested_port);
+  } else {
+    if (ResolvedAddressToV4Mapped(res_addr, &addr6_v4mapped)) {
+      res_addr = addr6_v4mapped;
+    }
+    auto result = CreateAndPrepareListenerSocket(options_, res_addr);
+    GRPC_RETURN_IF_ERROR(result.status());
+    acceptors_.Append(*result);
+    port = result->port;
   }
-  if (ResolvedAddressToV4Mapped(res_addr, &addr6_v4mapped)) {
-    res_addr = addr6_v4mapped;
-  }
+  GRPC_RETURN_IF_ERROR(port.status());
+  GRPC_RETURN_IF_ERROR(AddReusePortSocketsLocked(first_socket));
+  return port;
+}
 
-  auto result = CreateAndPrepareListenerSocket(options_, res_addr);
-  GRPC_RETURN_IF_ERROR(result.status());
-  acceptors_.Append(*result);
-  return result->port;
+absl::Status PosixEngineListenerImpl::AddReusePortSocketsLocked(
+    int first_socket) {
+  if (options_.listeners_per_port <= 1 || !options_.allow_reuse_port ||
+      !PosixSocketWrapper::IsSocketReusePortSupported()) {
+    return absl::OkStatus();
+  }
+  std::vector<ListenerSocketsContainer::ListenerSocket> sockets;
+  int i = 0;
+  for (auto it = acceptors_.begin(); it != acceptors_.end(); ++it, ++i) {
+    if (i >= first_socket &&
+        (*it)->Socket().addr.address()->sa_family != AF_UNIX) {
+      sockets.push_back((*it)->Socket());
+    }
+  }
+  const int num_cpus = static_cast<int>(gpr_cpu_num_cores());
+  for (ListenerSocketsContainer::ListenerSocket& socket : sockets) {
+    // Steering is best effort: without it the kernel still spreads
+    // connections across the sockets, just not by CPU.
+    (void)socket.sock.SetSocketIncomingCpu(0);
+    EventEngine::ResolvedAddress addr = socket.addr;
+    ResolvedAddressSetPort(addr, socket.port);
+    for (int n = 1; n < options_.listeners_per_port; ++n) {
+      auto result = CreateAndPrepareListenerSocket(options_, addr);
+      GRPC_RETURN_IF_ERROR(result.status());
+      (void)result->sock.SetSocketIncomingCpu(n % num_cpus);
+      acceptors_.Append(*result);
+    }
+  }
+  return absl::OkStatus();
 }
 
 void PosixEngineListenerImpl::AsyncConnectionAcceptor::Start() {
@@ -170,6 +170,11 @@ class PosixEngineListenerImpl
   };
   friend class ListenerAsyncAcceptors;
   friend class AsyncConnectionAcceptor;
+  // Opens options_.listeners_per_port - 1 more SO_REUSEPORT sockets for each
+  // socket past the first first_socket ones, and steers the sockets of each
+  // port to different CPUs.
+  absl::Status AddReusePortSocketsLocked(int first_socket)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   // The mutex ensures thread safety when multiple threads try to call Bind
   // and Start in parallel.
   absl::Mutex mu_;
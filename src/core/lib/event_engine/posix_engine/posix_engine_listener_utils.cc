@@ -168,6 +168,8 @@ absl::Status PrepareSocket(const PosixTcpOptions& options,
     GRPC_RETURN_IF_ERROR(socket.sock.SetSocketLowLatency(1));
     GRPC_RETURN_IF_ERROR(socket.sock.SetSocketReuseAddr(1));
     socket.sock.TrySetSocketTcpUserTimeout(options, false);
+    // Accepted connections inherit TCP_NOTSENT_LOWAT from the listener.
+    socket.sock.TrySetSocketTcpNotsentLowat(options);
   }
   GRPC_RETURN_IF_ERROR(socket.sock.SetSocketNoSigpipeIfPossible());
   GRPC_RETURN_IF_ERROR(socket.sock.ApplySocketMutatorInOptions(
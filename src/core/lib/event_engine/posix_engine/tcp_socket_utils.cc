@@ -117,6 +117,8 @@ absl::Status PrepareTcpClientSocket(PosixSocketWrapper sock,
     GRPC_RETURN_IF_ERROR(sock.SetSocketLowLatency(1));
     GRPC_RETURN_IF_ERROR(sock.SetSocketReuseAddr(1));
     sock.TrySetSocketTcpUserTimeout(options, true);
+    sock.TrySetSocketTcpNotsentLowat(options);
+    sock.TrySetSocketTcpFastOpenConnect(options);
   }
   GRPC_RETURN_IF_ERROR(sock.SetSocketNoSigpipeIfPossible());
   GRPC_RETURN_IF_ERROR(sock.ApplySocketMutatorInOptions(
@@ -153,6 +155,11 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_notsent_lowat =
+      AdjustValue(0, 0, INT_MAX, config.GetInt(GRPC_ARG_TCP_NOTSENT_LOWAT));
+  options.tcp_fast_open_connect =
+      (AdjustValue(0, 0, 1, config.GetInt(GRPC_ARG_TCP_FAST_OPEN_CONNECT)) !=
+       0);
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -167,6 +174,9 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
         (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
          0);
   }
+  options.listeners_per_port =
+      AdjustValue(1, 1, PosixTcpOptions::kMaxListenersPerPort,
+                  config.GetInt(GRPC_ARG_TCP_LISTENERS_PER_PORT));
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
   }
@@ -452,6 +462,21 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int reuse) {
 #endif
 }
 
+absl::Status PosixSocketWrapper::SetSocketIncomingCpu(int cpu) {
+#ifndef SO_INCOMING_CPU
+  (void)cpu;
+  return absl::Status(absl::StatusCode::kInternal,
+                      "SO_INCOMING_CPU unavailable on compiling system");
+#else
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_INCOMING_CPU, &cpu, sizeof(cpu))) {
+    return absl::Status(absl::StatusCode::kInternal,
+                        absl::StrCat("setsockopt(SO_INCOMING_CPU): ",
+                                     grpc_core::StrError(errno)));
+  }
+  return absl::OkStatus();
+#endif
+}
+
 bool PosixSocketWrapper::IsSocketReusePortSupported() {
   static bool kSupportSoReusePort = []() -> bool {
     int s = socket(AF_INET, SOCK_STREAM, 0);
@@ -587,6 +612,37 @@ void PosixSocketWrapper::TrySetSocketTcpUserTimeout(
   }
 }
 
+// Set TCP_NOTSENT_LOWAT
+void PosixSocketWrapper::TrySetSocketTcpNotsentLowat(
+    const PosixTcpOptions& options) {
+  if (options.tcp_notsent_lowat <= 0) return;
+#ifdef TCP_NOTSENT_LOWAT
+  if (0 != setsockopt(fd_, IPPROTO_TCP, TCP_NOTSENT_LOWAT,
+                      &options.tcp_notsent_lowat,
+                      sizeof(options.tcp_notsent_lowat))) {
+    // Do not fail on failing to set TCP_NOTSENT_LOWAT
+    gpr_log(GPR_ERROR, "setsockopt(TCP_NOTSENT_LOWAT) %s",
+            grpc_core::StrError(errno).c_str());
+  }
+#endif
+}
+
+// Set TCP_FASTOPEN_CONNECT
+void PosixSocketWrapper::TrySetSocketTcpFastOpenConnect(
+    const PosixTcpOptions& options) {
+  if (!options.tcp_fast_open_connect) return;
+#ifdef TCP_FASTOPEN_CONNECT
+  int val = 1;
+  if (0 != setsockopt(fd_, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &val,
+                      sizeof(val))) {
+    // Do not fail on failing to set TCP_FASTOPEN_CONNECT: the connection
+    // just takes the usual handshake.
+    gpr_log(GPR_ERROR, "setsockopt(TCP_FASTOPEN_CONNECT) %s",
+            grpc_core::StrError(errno).c_str());
+  }
+#endif
+}
+
 // Set a socket using a grpc_socket_mutator
 absl::Status PosixSocketWrapper::SetSocketMutator(
     grpc_fd_usage usage, grpc_socket_mutator* mutator) {
@@ -790,6 +846,16 @@ void PosixSocketWrapper::TrySetSocketTcpUserTimeout(
   grpc_core::Crash("unimplemented");
 }
 
+void PosixSocketWrapper::TrySetSocketTcpNotsentLowat(
+    const PosixTcpOptions& /*options*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void PosixSocketWrapper::TrySetSocketTcpFastOpenConnect(
+    const PosixTcpOptions& /*options*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketNoSigpipeIfPossible() {
   grpc_core::Crash("unimplemented");
 }
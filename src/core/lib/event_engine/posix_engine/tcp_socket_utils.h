@@ -58,16 +58,20 @@ struct PosixTcpOptions {
   static constexpr int kMaxChunkSize = 32 * 1024 * 1024;
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;
+  static constexpr int kMaxListenersPerPort = 1024;
   int tcp_read_chunk_size = kDefaultReadChunkSize;
   int tcp_min_read_chunk_size = kDefaultMinReadChunksize;
   int tcp_max_read_chunk_size = kDefaultMaxReadChunksize;
   int tcp_tx_zerocopy_send_bytes_threshold = kDefaultSendBytesThreshold;
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  int tcp_notsent_lowat = 0;
+  bool tcp_fast_open_connect = false;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
+  int listeners_per_port = 1;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
   PosixTcpOptions() = default;
@@ -128,10 +132,13 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_notsent_lowat = other.tcp_notsent_lowat;
+    tcp_fast_open_connect = other.tcp_fast_open_connect;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
+    listeners_per_port = other.listeners_per_port;
   }
 };
 
@@ -179,10 +186,20 @@ class PosixSocketWrapper {
   // Set SO_REUSEPORT
   absl::Status SetSocketReusePort(int reuse);
 
+  // Set SO_INCOMING_CPU, which steers connections made to a SO_REUSEPORT
+  // group of listening sockets to the one whose cpu handles them.
+  absl::Status SetSocketIncomingCpu(int cpu);
+
   // Override default Tcp user timeout values if necessary.
   void TrySetSocketTcpUserTimeout(const PosixTcpOptions& options,
                                   bool is_client);
 
+  // Sets TCP_NOTSENT_LOWAT if requested in options and available.
+  void TrySetSocketTcpNotsentLowat(const PosixTcpOptions& options);
+
+  // Sets TCP_FASTOPEN_CONNECT if requested in options and available.
+  void TrySetSocketTcpFastOpenConnect(const PosixTcpOptions& options);
+
   // Tries to set SO_NOSIGPIPE if available on this platform.
   // If SO_NO_SIGPIPE is not available, returns not OK status.
   absl::Status SetSocketNoSigpipeIfPossible();
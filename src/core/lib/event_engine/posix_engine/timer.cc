@@ -23,11 +23,14 @@
 #include <algorithm>
 #include <atomic>
 #include <limits>
+#include <memory>
 #include <utility>
 
 #include <grpc/support/cpu.h>
 
 #include "src/core/lib/event_engine/posix_engine/timer_heap.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/time.h"
 
@@ -40,6 +43,10 @@ static const double kMinQueueWindowDuration = 0.01;
 static const double kMaxQueueWindowDuration = 1.0;
 
 grpc_core::Timestamp TimerList::Shard::ComputeMinDeadline() {
+  if (wheel != nullptr) {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+        wheel->NextDeadline());
+  }
   return heap.is_empty()
              ? queue_deadline_cap + grpc_core::Duration::Epsilon()
              : grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
@@ -54,11 +61,16 @@ TimerList::TimerList(TimerListHost* host)
       min_timer_(host_->Now().milliseconds_after_process_epoch()),
       shards_(new Shard[num_shards_]),
       shard_queue_(new Shard*[num_shards_]) {
+  const bool use_timer_wheel = grpc_core::IsEventEngineTimerWheelEnabled();
   for (size_t i = 0; i < num_shards_; i++) {
     Shard& shard = shards_[i];
     shard.queue_deadline_cap =
         grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
             min_timer_.load(std::memory_order_relaxed));
+    if (use_timer_wheel) {
+      shard.wheel = std::make_unique<TimerWheel>(
+          min_timer_.load(std::memory_order_relaxed));
+    }
     shard.shard_queue_index = i;
     shard.list.next = shard.list.prev = &shard.list;
     shard.min_deadline = shard.ComputeMinDeadline();
@@ -124,13 +136,17 @@ void TimerList::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
       deadline = now;
     }
 
-    shard->stats.AddSample((deadline - now).millis() / 1000.0);
-
-    if (deadline < shard->queue_deadline_cap) {
-      is_first_timer = shard->heap.Add(timer);
+    if (shard->wheel != nullptr) {
+      is_first_timer = shard->wheel->Add(timer);
     } else {
-      timer->heap_index = kInvalidHeapIndex;
-      ListJoin(&shard->list, timer);
+      shard->stats.AddSample((deadline - now).millis() / 1000.0);
+
+      if (deadline < shard->queue_deadline_cap) {
+        is_first_timer = shard->heap.Add(timer);
+      } else {
+        timer->heap_index = kInvalidHeapIndex;
+        ListJoin(&shard->list, timer);
+      }
     }
   }
 
@@ -166,7 +182,9 @@ bool TimerList::TimerCancel(Timer* timer) {
 
   if (timer->pending) {
     timer->pending = false;
-    if (timer->heap_index == kInvalidHeapIndex) {
+    if (shard->wheel != nullptr) {
+      shard->wheel->Remove(timer);
+    } else if (timer->heap_index == kInvalidHeapIndex) {
       ListRemove(timer);
     } else {
       shard->heap.Remove(timer);
@@ -231,8 +249,17 @@ void TimerList::Shard::PopTimers(
     grpc_core::Timestamp now, grpc_core::Timestamp* new_min_deadline,
     std::vector<experimental::EventEngine::Closure*>* out) {
   grpc_core::MutexLock lock(&mu);
-  while (Timer* timer = PopOne(now)) {
-    out->push_back(timer->closure);
+  if (wheel != nullptr) {
+    std::vector<Timer*> expired;
+    wheel->PopExpired(now.milliseconds_after_process_epoch(), &expired);
+    for (Timer* timer : expired) {
+      timer->pending = false;
+      out->push_back(timer->closure);
+    }
+  } else {
+    while (Timer* timer = PopOne(now)) {
+      out->push_back(timer->closure);
+    }
   }
   *new_min_deadline = ComputeMinDeadline();
 }
@@ -34,6 +34,7 @@
 #include <grpc/event_engine/event_engine.h>
 
 #include "src/core/lib/event_engine/posix_engine/timer_heap.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/gprpp/time_averaged_stats.h"
@@ -140,6 +141,10 @@ class TimerList {
   // stats maintained in 'stats' and the relevant timers are then moved from the
   // 'list' to 'heap'.
   //
+  // When the event_engine_timer_wheel experiment is enabled, a shard instead
+  // keeps its timers in a hierarchical timing wheel, which makes adding and
+  // cancelling a timer O(1) regardless of the number of pending timers.
+  //
   struct Shard {
     Shard();
 
@@ -164,6 +169,9 @@ class TimerList {
     TimerHeap heap ABSL_GUARDED_BY(mu);
     // This holds timers whose deadline is >= queue_deadline_cap.
     Timer list ABSL_GUARDED_BY(mu);
+    // If the event_engine_timer_wheel experiment is enabled, this holds all
+    // timers of the shard instead of 'heap' and 'list'.
+    std::unique_ptr<TimerWheel> wheel ABSL_GUARDED_BY(mu);
   };
 
   void SwapAdjacentShardsInQueue(uint32_t first_shard_queue_index)
@@ -30,6 +30,7 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/thread_affinity.h"
 #include "src/core/lib/gprpp/thd.h"
 
 static thread_local bool g_timer_thread;
@@ -42,7 +43,7 @@ grpc_core::DebugOnlyTraceFlag grpc_event_engine_timer_trace(false, "timer");
 void TimerManager::RunSomeTimers(
     std::vector<experimental::EventEngine::Closure*> timers) {
   for (auto* timer : timers) {
-    thread_pool_->Run(timer);
+    thread_pool_->Run(timer, ThreadPool::Priority::kTimer);
   }
 }
 
@@ -52,6 +53,16 @@ void TimerManager::RunSomeTimers(
 bool TimerManager::WaitUntil(grpc_core::Timestamp next) {
   grpc_core::MutexLock lock(&mu_);
   if (shutdown_) return false;
+  if (forking_) {
+    // Park, rather than exit, for the duration of a fork: the parent resumes
+    // with this thread, and only the child has to start a new one.
+    parked_ = true;
+    cv_parked_.Signal();
+    while (forking_ && !shutdown_) cv_wait_.Wait(&mu_);
+    parked_ = false;
+    // 'next' may be stale by now.
+    return !shutdown_;
+  }
   // If kicked_ is true at this point, it means there was a kick from the timer
   // system that the timer-manager threads here missed. We cannot trust 'next'
   // here any longer (since there might be an earlier deadline). So if kicked_
@@ -88,6 +99,7 @@ void TimerManager::StartMainLoopThread() {
   main_thread_ = grpc_core::Thread(
       "timer_manager",
       [](void* arg) {
+        SetCurrentThreadAffinity(ThreadRole::kTimer);
         auto self = static_cast<TimerManager*>(arg);
         self->MainLoop();
       },
@@ -137,6 +149,7 @@ void TimerManager::Shutdown() {
     shutdown_ = true;
     // Wait on the main loop to exit.
     cv_wait_.Signal();
+    cv_parked_.Signal();
   }
   main_loop_exit_signal_->WaitForNotification();
   if (grpc_event_engine_timer_trace.enabled()) {
@@ -154,20 +167,31 @@ void TimerManager::Kick() {
   cv_wait_.Signal();
 }
 
-void TimerManager::RestartPostFork() {
+void TimerManager::PrepareFork() {
+  grpc_core::MutexLock lock(&mu_);
+  if (shutdown_) return;
+  forking_ = true;
+  cv_wait_.Signal();
+  while (!parked_ && !shutdown_) cv_parked_.Wait(&mu_);
+}
+
+void TimerManager::PostforkParent() {
   grpc_core::MutexLock lock(&mu_);
-  GPR_ASSERT(GPR_LIKELY(shutdown_));
+  if (!std::exchange(forking_, false)) return;
+  cv_wait_.Signal();
+}
+
+void TimerManager::PostforkChild() {
+  grpc_core::MutexLock lock(&mu_);
+  if (!std::exchange(forking_, false)) return;
   if (grpc_event_engine_timer_trace.enabled()) {
-    gpr_log(GPR_DEBUG, "TimerManager::%p restarting after shutdown", this);
+    gpr_log(GPR_DEBUG, "TimerManager::%p restarting after fork", this);
   }
-  shutdown_ = false;
+  // The parked main loop thread was not forked.
+  parked_ = false;
   main_loop_exit_signal_.emplace();
   StartMainLoopThread();
 }
 
-void TimerManager::PrepareFork() { Shutdown(); }
-void TimerManager::PostforkParent() { RestartPostFork(); }
-void TimerManager::PostforkChild() { RestartPostFork(); }
-
 }  // namespace experimental
 }  // namespace grpc_event_engine
@@ -60,7 +60,7 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
 
   static bool IsTimerManagerThread();
 
-  // Called on destruction, prefork, and manually when needed.
+  // Called on destruction, and manually when needed.
   void Shutdown();
 
   void PrepareFork() override;
@@ -81,7 +81,6 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
   };
 
   void StartMainLoopThread();
-  void RestartPostFork();
   void MainLoop();
   void RunSomeTimers(std::vector<experimental::EventEngine::Closure*> timers);
   bool WaitUntil(grpc_core::Timestamp next);
@@ -97,6 +96,11 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
   Host host_;
   // are we shutting down?
   bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
+  // Signalled when the main thread parks for a fork.
+  grpc_core::CondVar cv_parked_;
+  // is a fork in progress, and is the main thread parked for it?
+  bool forking_ ABSL_GUARDED_BY(mu_) = false;
+  bool parked_ ABSL_GUARDED_BY(mu_) = false;
   // are we shutting down?
   bool kicked_ ABSL_GUARDED_BY(mu_) = false;
   // number of timer wakeups
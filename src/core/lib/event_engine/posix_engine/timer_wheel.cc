@@ -0,0 +1,191 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/gpr/useful.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+constexpr int64_t kNoDeadline = std::numeric_limits<int64_t>::max();
+
+// Index of the lowest set bit of a non-zero value.
+int LowestSetBit(uint64_t bits) {
+  return static_cast<int>(grpc_core::BitCount((bits & (~bits + 1)) - 1));
+}
+}  // namespace
+
+TimerWheel::TimerWheel(int64_t now)
+    : now_(now),
+      min_deadline_(kNoDeadline),
+      overflow_min_deadline_(kNoDeadline) {}
+
+void TimerWheel::ListAdd(size_t list, Timer* timer) {
+  timer->heap_index = list;
+  timer->prev = nullptr;
+  timer->next = lists_[list];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  lists_[list] = timer;
+  if (list < kExpiredSlot) {
+    occupied_[list / kNumSlots] |= uint64_t{1} << (list % kNumSlots);
+  }
+}
+
+void TimerWheel::ListRemove(Timer* timer) {
+  const size_t list = timer->heap_index;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+  } else {
+    lists_[list] = timer->next;
+  }
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (list < kExpiredSlot && lists_[list] == nullptr) {
+    occupied_[list / kNumSlots] &= ~(uint64_t{1} << (list % kNumSlots));
+  }
+}
+
+Timer* TimerWheel::ListTake(size_t list) {
+  Timer* head = lists_[list];
+  lists_[list] = nullptr;
+  if (list < kExpiredSlot) {
+    occupied_[list / kNumSlots] &= ~(uint64_t{1} << (list % kNumSlots));
+  }
+  return head;
+}
+
+void TimerWheel::Place(Timer* timer) {
+  const int64_t deadline = timer->deadline;
+  if (deadline <= now_) {
+    ListAdd(kExpiredSlot, timer);
+    return;
+  }
+  // Computed unsigned so that this cannot overflow for far away deadlines.
+  const uint64_t delta =
+      static_cast<uint64_t>(deadline) - static_cast<uint64_t>(now_);
+  if (delta >= static_cast<uint64_t>(kWheelRange)) {
+    overflow_min_deadline_ = std::min(overflow_min_deadline_, deadline);
+    ListAdd(kOverflowSlot, timer);
+    return;
+  }
+  int level = 0;
+  while (delta >> (kLevelBits * (level + 1)) != 0) ++level;
+  const size_t slot = (deadline >> (kLevelBits * level)) & kSlotMask;
+  ListAdd(level * kNumSlots + slot, timer);
+}
+
+bool TimerWheel::Add(Timer* timer) {
+  Place(timer);
+  ++num_timers_;
+  if (timer->deadline < min_deadline_) {
+    min_deadline_ = timer->deadline;
+    return true;
+  }
+  return false;
+}
+
+void TimerWheel::Remove(Timer* timer) {
+  GPR_ASSERT(timer->heap_index < kNumLists);
+  ListRemove(timer);
+  --num_timers_;
+}
+
+int64_t TimerWheel::NextEventTime() const {
+  int64_t next = kNoDeadline;
+  for (int level = 0; level < kNumLevels; ++level) {
+    const uint64_t bits = occupied_[level];
+    if (bits == 0) continue;
+    // Slots on this level hold the next kNumSlots ticks of the level,
+    // starting with the one after the current tick. Rotate the bitmap so
+    // that bit 0 corresponds to that first tick.
+    const int shift = kLevelBits * level;
+    const int64_t first_tick = (now_ >> shift) + 1;
+    const int first_slot = static_cast<int>(first_tick & kSlotMask);
+    const uint64_t rotated =
+        first_slot == 0
+            ? bits
+            : (bits >> first_slot) | (bits << (kNumSlots - first_slot));
+    next = std::min(next, (first_tick + LowestSetBit(rotated)) << shift);
+  }
+  if (lists_[kOverflowSlot] != nullptr) {
+    next = std::min(next, overflow_min_deadline_ - kWheelRange + 1);
+  }
+  return next;
+}
+
+void TimerWheel::Tick(int64_t t, std::vector<Timer*>* out) {
+  now_ = t;
+  // Cascade one slot from each level whose previous tick has just elapsed,
+  // lowest level first. Timers that become due at t end up in the expired
+  // list.
+  for (int level = 1; level < kNumLevels; ++level) {
+    const int shift = kLevelBits * level;
+    if ((t & ((int64_t{1} << shift) - 1)) != 0) break;
+    Timer* timer = ListTake(level * kNumSlots + ((t >> shift) & kSlotMask));
+    while (timer != nullptr) {
+      Timer* next = timer->next;
+      Place(timer);
+      timer = next;
+    }
+  }
+  if (lists_[kOverflowSlot] != nullptr &&
+      t > overflow_min_deadline_ - kWheelRange) {
+    Timer* timer = ListTake(kOverflowSlot);
+    overflow_min_deadline_ = kNoDeadline;
+    while (timer != nullptr) {
+      Timer* next = timer->next;
+      Place(timer);
+      timer = next;
+    }
+  }
+  for (size_t list : {static_cast<size_t>(t & kSlotMask), kExpiredSlot}) {
+    for (Timer* timer = ListTake(list); timer != nullptr;
+         timer = timer->next) {
+      out->push_back(timer);
+      --num_timers_;
+    }
+  }
+}
+
+void TimerWheel::PopExpired(int64_t now, std::vector<Timer*>* out) {
+  for (Timer* timer = ListTake(kExpiredSlot); timer != nullptr;
+       timer = timer->next) {
+    out->push_back(timer);
+    --num_timers_;
+  }
+  for (;;) {
+    const int64_t next = NextEventTime();
+    if (next > now || next == kNoDeadline) break;
+    Tick(next, out);
+  }
+  now_ = std::max(now_, now);
+}
+
+int64_t TimerWheel::NextDeadline() {
+  min_deadline_ =
+      lists_[kExpiredSlot] != nullptr ? now_ : NextEventTime();
+  return min_deadline_;
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
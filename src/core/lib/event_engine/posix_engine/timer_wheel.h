@@ -0,0 +1,123 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+struct Timer;
+
+// A hierarchical timing wheel with a resolution of one millisecond.
+//
+// The wheel has kNumLevels levels of kNumSlots slots each. Slots on level 0
+// cover one millisecond, slots on level n cover kNumSlots^n milliseconds. A
+// timer is placed on the lowest level whose range covers its deadline, and is
+// moved down ("cascaded") a level at a time as the wheel's clock approaches
+// its deadline. Timers further out than the range of the top level are kept in
+// an unordered overflow list until they come into range.
+//
+// Add and Remove are O(1). Advancing the clock costs O(1) per expired timer
+// plus O(1) per cascaded timer; empty stretches of time are skipped using a
+// bitmap of occupied slots per level.
+//
+// Timers are linked into their slot through Timer::next and Timer::prev, and
+// Timer::heap_index records the slot that holds them. The wheel performs no
+// locking: callers are expected to serialize access.
+class TimerWheel {
+ public:
+  // Creates a wheel whose clock starts at now (in milliseconds after the
+  // process epoch). Timers with deadlines at or before the clock are
+  // considered expired.
+  explicit TimerWheel(int64_t now);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  // Adds a timer to the wheel. Returns true if the timer's deadline is earlier
+  // than the last value reported by NextDeadline() (or any timer added since).
+  bool Add(Timer* timer);
+
+  // Removes a timer that was previously added and has not been popped yet.
+  void Remove(Timer* timer);
+
+  // Advances the wheel's clock to now and appends every timer whose deadline
+  // is at or before now to out. Popped timers are no longer in the wheel.
+  void PopExpired(int64_t now, std::vector<Timer*>* out);
+
+  // Returns a lower bound on the deadline of every timer in the wheel, or
+  // std::numeric_limits<int64_t>::max() if the wheel is empty. The bound is
+  // exact for timers on level 0; for higher levels it is the time at which
+  // the slot holding the earliest timers gets cascaded. After PopExpired(now)
+  // the returned value is always greater than now.
+  int64_t NextDeadline();
+
+  bool is_empty() const { return num_timers_ == 0; }
+
+ private:
+  static constexpr int kLevelBits = 6;
+  static constexpr int kNumSlots = 1 << kLevelBits;
+  static constexpr int kNumLevels = 4;
+  static constexpr int64_t kSlotMask = kNumSlots - 1;
+  // Timers with deadlines at least this far beyond the wheel's clock go into
+  // the overflow list.
+  static constexpr int64_t kWheelRange = int64_t{1}
+                                         << (kLevelBits * kNumLevels);
+  // Values stored in Timer::heap_index for timers that are not in a slot.
+  static constexpr size_t kExpiredSlot = kNumLevels * kNumSlots;
+  static constexpr size_t kOverflowSlot = kExpiredSlot + 1;
+  static constexpr size_t kNumLists = kOverflowSlot + 1;
+
+  // Places timer in the list appropriate for its deadline relative to now_.
+  void Place(Timer* timer);
+  void ListAdd(size_t list, Timer* timer);
+  void ListRemove(Timer* timer);
+  // Detaches and returns the whole content of a list.
+  Timer* ListTake(size_t list);
+  // Returns the time of the next slot collection or cascade after now_ that
+  // involves a non-empty slot, including the time at which the earliest
+  // overflow timer comes into range. Returns the maximum int64_t value if
+  // there is none.
+  int64_t NextEventTime() const;
+  // Moves the clock to t, cascading higher levels as required, and appends the
+  // timers in the level 0 slot for t to out.
+  void Tick(int64_t t, std::vector<Timer*>* out);
+
+  // All timers with deadlines at or before now_ have been popped, or are in
+  // the expired list.
+  int64_t now_;
+  size_t num_timers_ = 0;
+  // Cached value for Add(...) to compare against.
+  int64_t min_deadline_;
+  // Lower bound on the deadlines of timers in the overflow list.
+  int64_t overflow_min_deadline_;
+  // One bit per non-empty slot, for each level.
+  uint64_t occupied_[kNumLevels] = {};
+  // Heads of the doubly-linked lists of timers, indexed by
+  // level * kNumSlots + slot, and then the expired and overflow lists.
+  Timer* lists_[kNumLists] = {};
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
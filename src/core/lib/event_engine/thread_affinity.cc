@@ -0,0 +1,180 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif  // _GNU_SOURCE
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/thread_affinity.h"
+
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/event_engine/thread_local.h"
+#include "src/core/lib/gprpp/global_config.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/strerror.h"
+
+#ifdef GPR_LINUX
+#include <errno.h>
+#include <sched.h>
+#endif
+
+GPR_GLOBAL_CONFIG_DEFINE_STRING(
+    grpc_event_engine_executor_cpus, "",
+    "CPUs that EventEngine thread pool threads run callbacks on, e.g. "
+    "\"0-3,8\". Empty means any CPU.");
+GPR_GLOBAL_CONFIG_DEFINE_STRING(
+    grpc_event_engine_poller_cpus, "",
+    "CPUs that EventEngine thread pool threads poll for I/O on, e.g. the "
+    "cores that handle the NIC's interrupts. Empty means the executor CPUs.");
+GPR_GLOBAL_CONFIG_DEFINE_STRING(
+    grpc_event_engine_timer_cpus, "",
+    "CPUs that the EventEngine timer thread runs on. Empty means any CPU.");
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+constexpr int kNumRoles = 3;
+
+struct AffinityConfig {
+  std::vector<int> cpus[kNumRoles];
+#ifdef GPR_LINUX
+  cpu_set_t process_cpus;
+#endif
+};
+
+std::vector<int> LoadCpuList(const char* name,
+                             grpc_core::UniquePtr<char> value) {
+  if (value == nullptr || value.get()[0] == '\0') return {};
+  auto cpus = ParseCpuList(value.get());
+  if (!cpus.ok()) {
+    gpr_log(GPR_ERROR, "Ignoring %s: %s", name,
+            cpus.status().ToString().c_str());
+    return {};
+  }
+  return std::move(*cpus);
+}
+
+AffinityConfig LoadAffinityConfig() {
+  AffinityConfig config;
+  config.cpus[static_cast<int>(ThreadRole::kExecutor)] =
+      LoadCpuList("GRPC_EVENT_ENGINE_EXECUTOR_CPUS",
+                  GPR_GLOBAL_CONFIG_GET(grpc_event_engine_executor_cpus));
+  config.cpus[static_cast<int>(ThreadRole::kPoller)] =
+      LoadCpuList("GRPC_EVENT_ENGINE_POLLER_CPUS",
+                  GPR_GLOBAL_CONFIG_GET(grpc_event_engine_poller_cpus));
+  config.cpus[static_cast<int>(ThreadRole::kTimer)] =
+      LoadCpuList("GRPC_EVENT_ENGINE_TIMER_CPUS",
+                  GPR_GLOBAL_CONFIG_GET(grpc_event_engine_timer_cpus));
+#ifdef GPR_LINUX
+  // Read before any thread is pinned, so that threads of roles without CPUs
+  // of their own can be given back what the process started with.
+  CPU_ZERO(&config.process_cpus);
+  if (sched_getaffinity(0, sizeof(config.process_cpus),
+                        &config.process_cpus) != 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      CPU_SET(cpu, &config.process_cpus);
+    }
+  }
+#endif
+  return config;
+}
+
+const AffinityConfig& Config() {
+  static const grpc_core::NoDestruct<AffinityConfig> config(
+      LoadAffinityConfig());
+  return *config;
+}
+
+// The role whose CPUs the calling thread was last given, or -1 if it has
+// never been pinned.
+thread_local int g_applied_role = -1;
+
+}  // namespace
+
+absl::StatusOr<std::vector<int>> ParseCpuList(absl::string_view cpus) {
+  std::vector<int> result;
+  for (absl::string_view range : absl::StrSplit(cpus, ',')) {
+    range = absl::StripAsciiWhitespace(range);
+    if (range.empty()) continue;
+    std::pair<absl::string_view, absl::string_view> bounds =
+        absl::StrSplit(range, absl::MaxSplits('-', 1));
+    int first;
+    int last;
+    bool ok = absl::SimpleAtoi(bounds.first, &first) && first >= 0;
+    if (ok && bounds.second.empty()) {
+      last = first;
+    } else if (ok) {
+      ok = absl::SimpleAtoi(bounds.second, &last) && last >= first;
+    }
+    if (!ok) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("invalid CPU range \"", range, "\""));
+    }
+    for (int cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+  }
+  return result;
+}
+
+bool HasThreadAffinity(ThreadRole role) {
+  return !Config().cpus[static_cast<int>(role)].empty();
+}
+
+void SetCurrentThreadAffinity(ThreadRole role) {
+  const int role_index = static_cast<int>(role);
+  if (g_applied_role == role_index) return;
+  const std::vector<int>& cpus = Config().cpus[role_index];
+  // Threads that have never been pinned already have the process's CPUs.
+  if (cpus.empty() && g_applied_role == -1) {
+    g_applied_role = role_index;
+    return;
+  }
+#ifdef GPR_LINUX
+  cpu_set_t set;
+  if (cpus.empty()) {
+    set = Config().process_cpus;
+  } else {
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+      if (cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+    }
+  }
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    gpr_log(GPR_ERROR, "sched_setaffinity failed: %s",
+            grpc_core::StrError(errno).c_str());
+    return;
+  }
+  // The thread has been moved onto one of its CPUs by now.
+  ThreadLocal::SetStartingCpu(cpus.empty() ? ThreadLocal::kNoStartingCpu
+                                           : gpr_cpu_current_cpu());
+#endif
+  g_applied_role = role_index;
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
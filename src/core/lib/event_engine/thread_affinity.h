@@ -0,0 +1,56 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_AFFINITY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_AFFINITY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// The kinds of threads that EventEngines run, each of which may be kept to
+// its own set of CPUs.
+enum class ThreadRole {
+  // Thread pool threads running callbacks (GRPC_EVENT_ENGINE_EXECUTOR_CPUS).
+  kExecutor,
+  // Thread pool threads while they poll for I/O
+  // (GRPC_EVENT_ENGINE_POLLER_CPUS).
+  kPoller,
+  // The timer manager thread (GRPC_EVENT_ENGINE_TIMER_CPUS).
+  kTimer,
+};
+
+// Parses a CPU list in the format of /sys/devices/system/cpu/isolated and
+// taskset -c, e.g. "0-3,8,10-11".
+absl::StatusOr<std::vector<int>> ParseCpuList(absl::string_view cpus);
+
+// Whether a CPU set is configured for \a role.
+bool HasThreadAffinity(ThreadRole role);
+
+// Keeps the calling thread to the CPUs configured for \a role, or, if there
+// are none, returns it to the CPUs the process started with. Pinned threads
+// record the CPU they start on as their starting CPU for per-CPU sharding.
+// Does nothing if the thread already has \a role's CPUs, or on platforms
+// without thread affinity.
+void SetCurrentThreadAffinity(ThreadRole role);
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_AFFINITY_H
@@ -20,10 +20,16 @@ namespace experimental {
 
 namespace {
 thread_local bool g_thread_local{false};
+thread_local unsigned g_starting_cpu{ThreadLocal::kNoStartingCpu};
 }  // namespace
 
+constexpr unsigned ThreadLocal::kNoStartingCpu;
+
 void ThreadLocal::SetIsEventEngineThread(bool is) { g_thread_local = is; }
 bool ThreadLocal::IsEventEngineThread() { return g_thread_local; }
 
+void ThreadLocal::SetStartingCpu(unsigned cpu) { g_starting_cpu = cpu; }
+unsigned ThreadLocal::StartingCpu() { return g_starting_cpu; }
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
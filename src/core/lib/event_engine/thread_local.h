@@ -15,6 +15,8 @@
 #define GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_LOCAL_H
 #include <grpc/support/port_platform.h>
 
+#include <limits>
+
 namespace grpc_event_engine {
 namespace experimental {
 
@@ -24,6 +26,13 @@ class ThreadLocal {
  public:
   static void SetIsEventEngineThread(bool is_local);
   static bool IsEventEngineThread();
+
+  static constexpr unsigned kNoStartingCpu =
+      std::numeric_limits<unsigned>::max();
+  /// The CPU that per-CPU data should use for the calling thread, set by
+  /// threads pinned to a CPU set, or kNoStartingCpu.
+  static void SetStartingCpu(unsigned cpu);
+  static unsigned StartingCpu();
 };
 
 }  // namespace experimental
@@ -20,6 +20,7 @@
 
 #include "src/core/lib/event_engine/thread_pool.h"
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <utility>
@@ -30,6 +31,7 @@
 
 #include <grpc/support/log.h>
 
+#include "src/core/lib/event_engine/thread_affinity.h"
 #include "src/core/lib/event_engine/thread_local.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/gprpp/time.h"
@@ -37,6 +39,13 @@
 namespace grpc_event_engine {
 namespace experimental {
 
+namespace {
+// The local queue of the current thread pool thread, and the state of the pool
+// that owns it.
+thread_local WorkQueue* g_local_queue = nullptr;
+thread_local const void* g_local_queue_owner = nullptr;
+}  // namespace
+
 void ThreadPool::StartThread(StatePtr state, StartThreadReason reason) {
   state->thread_count.Add();
   const auto now = grpc_core::Timestamp::Now();
@@ -72,6 +81,7 @@ void ThreadPool::StartThread(StatePtr state, StartThreadReason reason) {
       [](void* arg) {
         std::unique_ptr<ThreadArg> a(static_cast<ThreadArg*>(arg));
         ThreadLocal::SetIsEventEngineThread(true);
+        SetCurrentThreadAffinity(ThreadRole::kExecutor);
         switch (a->reason) {
           case StartThreadReason::kInitialPool:
             break;
@@ -96,21 +106,46 @@ void ThreadPool::StartThread(StatePtr state, StartThreadReason reason) {
 }
 
 void ThreadPool::ThreadFunc(StatePtr state) {
-  while (state->queue.Step()) {
+  WorkQueue local_queue;
+  state->queue.AddThreadQueue(&local_queue);
+  g_local_queue = &local_queue;
+  g_local_queue_owner = state.get();
+  while (state->queue.Step(&local_queue) ||
+         state->queue.ParkForFork(&state->thread_count)) {
   }
+  g_local_queue = nullptr;
+  g_local_queue_owner = nullptr;
+  state->queue.RemoveThreadQueue(&local_queue);
   state->thread_count.Remove();
 }
 
-bool ThreadPool::Queue::Step() {
+constexpr ThreadPool::Priority ThreadPool::Queue::kDequeueSchedule[];
+
+bool ThreadPool::Queue::Step(WorkQueue* local_queue) {
+  // Work scheduled by this thread is run most-recent-first, without touching
+  // the shared queue lock, unless more urgent work is waiting.
+  EventEngine::Closure* closure = nullptr;
+  if (!forking_hint_.load(std::memory_order_relaxed) &&
+      urgent_callbacks_hint_.load(std::memory_order_relaxed) == 0) {
+    closure = local_queue->PopBack();
+    if (closure != nullptr) {
+      closure->Run();
+      return true;
+    }
+  }
   grpc_core::ReleasableMutexLock lock(&queue_mu_);
   // Wait until work is available or we are shutting down.
-  while (!shutdown_ && !forking_ && callbacks_.empty()) {
+  while (!shutdown_ && !forking_ && num_callbacks_ == 0 &&
+         local_queue->Empty() &&
+         (closure = StealLocked(local_queue)) == nullptr) {
     // If there are too many threads waiting, then quit this thread.
     // TODO(ctiller): wait some time in this case to be sure.
+    threads_waiting_hint_.fetch_add(1, std::memory_order_relaxed);
     if (threads_waiting_ >= reserve_threads_) {
       threads_waiting_++;
       bool timeout = cv_.WaitWithTimeout(&queue_mu_, absl::Seconds(30));
       threads_waiting_--;
+      threads_waiting_hint_.fetch_sub(1, std::memory_order_relaxed);
       if (timeout && threads_waiting_ >= reserve_threads_) {
         return false;
       }
@@ -118,18 +153,86 @@ bool ThreadPool::Queue::Step() {
       threads_waiting_++;
       cv_.Wait(&queue_mu_);
       threads_waiting_--;
+      threads_waiting_hint_.fetch_sub(1, std::memory_order_relaxed);
     }
   }
+  if (closure != nullptr) {
+    lock.Release();
+    closure->Run();
+    return true;
+  }
   if (forking_) return false;
-  if (shutdown_ && callbacks_.empty()) return false;
-  GPR_ASSERT(!callbacks_.empty());
-  auto callback = std::move(callbacks_.front());
-  callbacks_.pop();
+  if (num_callbacks_ == 0) {
+    // Either the local queue has work again, or we are shutting down and
+    // should help drain the other threads' queues before exiting.
+    if (!local_queue->Empty()) return true;
+    closure = StealLocked(local_queue);
+    if (closure == nullptr) return false;
+    lock.Release();
+    closure->Run();
+    return true;
+  }
+  auto callback = PopLocked();
   lock.Release();
   callback();
   return true;
 }
 
+absl::AnyInvocable<void()> ThreadPool::Queue::PopLocked() {
+  size_t priority = static_cast<size_t>(
+      kDequeueSchedule[schedule_pos_++ % GPR_ARRAY_SIZE(kDequeueSchedule)]);
+  if (callbacks_[priority].empty()) {
+    priority = 0;
+    while (callbacks_[priority].empty()) ++priority;
+  }
+  auto callback = std::move(callbacks_[priority].front());
+  callbacks_[priority].pop();
+  --num_callbacks_;
+  if (priority != static_cast<size_t>(Priority::kDefault)) {
+    urgent_callbacks_hint_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  return callback;
+}
+
+EventEngine::Closure* ThreadPool::Queue::StealLocked(WorkQueue* local_queue) {
+  const size_t num_queues = thread_queues_.size();
+  if (num_queues <= 1) return nullptr;
+  // xorshift32: cheap, and good enough to spread stealing across victims.
+  steal_seed_ ^= steal_seed_ << 13;
+  steal_seed_ ^= steal_seed_ >> 17;
+  steal_seed_ ^= steal_seed_ << 5;
+  const size_t start = steal_seed_ % num_queues;
+  for (size_t i = 0; i < num_queues; i++) {
+    WorkQueue* victim = thread_queues_[(start + i) % num_queues];
+    if (victim == local_queue || victim->Empty()) continue;
+    EventEngine::Closure* closure = victim->PopFront();
+    if (closure != nullptr) return closure;
+  }
+  return nullptr;
+}
+
+void ThreadPool::Queue::AddThreadQueue(WorkQueue* queue) {
+  grpc_core::MutexLock lock(&queue_mu_);
+  thread_queues_.push_back(queue);
+}
+
+void ThreadPool::Queue::RemoveThreadQueue(WorkQueue* queue) {
+  grpc_core::MutexLock lock(&queue_mu_);
+  thread_queues_.erase(
+      std::find(thread_queues_.begin(), thread_queues_.end(), queue));
+  // The owning thread is the only one pushing to this queue and it is
+  // exiting; hand whatever is left to the remaining threads. Stealers hold
+  // queue_mu_, so nobody else can be popping concurrently.
+  bool moved = false;
+  while (EventEngine::Closure* closure = queue->PopFront()) {
+    callbacks_[static_cast<size_t>(Priority::kDefault)].push(
+        [closure]() { closure->Run(); });
+    ++num_callbacks_;
+    moved = true;
+  }
+  if (moved) cv_.SignalAll();
+}
+
 ThreadPool::ThreadPool() {
   for (unsigned i = 0; i < reserve_threads_; i++) {
     StartThread(state_, StartThreadReason::kInitialPool);
@@ -157,28 +260,77 @@ ThreadPool::~ThreadPool() {
 
 void ThreadPool::Run(absl::AnyInvocable<void()> callback) {
   GPR_DEBUG_ASSERT(quiesced_.load(std::memory_order_relaxed) == false);
+  if (g_local_queue_owner == state_.get()) {
+    bool was_empty = g_local_queue->Empty();
+    g_local_queue->Add(std::move(callback));
+    if (state_->queue.NotifyLocalWorkAdded(was_empty)) {
+      StartThread(state_, StartThreadReason::kNoWaitersWhenScheduling);
+    }
+    return;
+  }
   if (state_->queue.Add(std::move(callback))) {
     StartThread(state_, StartThreadReason::kNoWaitersWhenScheduling);
   }
 }
 
 void ThreadPool::Run(EventEngine::Closure* closure) {
+  if (g_local_queue_owner == state_.get()) {
+    GPR_DEBUG_ASSERT(quiesced_.load(std::memory_order_relaxed) == false);
+    bool was_empty = g_local_queue->Empty();
+    g_local_queue->Add(closure);
+    if (state_->queue.NotifyLocalWorkAdded(was_empty)) {
+      StartThread(state_, StartThreadReason::kNoWaitersWhenScheduling);
+    }
+    return;
+  }
   Run([closure]() { closure->Run(); });
 }
 
-bool ThreadPool::Queue::Add(absl::AnyInvocable<void()> callback) {
+void ThreadPool::Run(EventEngine::Closure* closure, Priority priority) {
+  if (priority == Priority::kDefault) {
+    Run(closure);
+    return;
+  }
+  GPR_DEBUG_ASSERT(quiesced_.load(std::memory_order_relaxed) == false);
+  // Not on the local queue, where it would wait behind this thread's
+  // backlog.
+  if (state_->queue.Add([closure]() { closure->Run(); }, priority)) {
+    StartThread(state_, StartThreadReason::kNoWaitersWhenScheduling);
+  }
+}
+
+bool ThreadPool::Queue::Add(absl::AnyInvocable<void()> callback,
+                            Priority priority) {
   grpc_core::MutexLock lock(&queue_mu_);
   // Add works to the callbacks list
-  callbacks_.push(std::move(callback));
+  callbacks_[static_cast<size_t>(priority)].push(std::move(callback));
+  ++num_callbacks_;
+  if (priority != Priority::kDefault) {
+    urgent_callbacks_hint_.fetch_add(1, std::memory_order_relaxed);
+  }
   cv_.Signal();
   if (forking_) return false;
-  return callbacks_.size() > threads_waiting_;
+  return num_callbacks_ > threads_waiting_;
+}
+
+bool ThreadPool::Queue::NotifyLocalWorkAdded(bool was_empty) {
+  if (threads_waiting_hint_.load(std::memory_order_relaxed) > 0) {
+    // Signalling without holding queue_mu_ may race with a thread that is
+    // about to sleep. That is benign: the owning thread runs the callback once
+    // its current one returns.
+    cv_.Signal();
+    return false;
+  }
+  // Nobody is idle. If this thread already has a backlog, it may be blocked
+  // on a long-running callback; allow the pool to grow like it would for a
+  // backlogged shared queue.
+  return !was_empty;
 }
 
 bool ThreadPool::Queue::IsBacklogged() {
   grpc_core::MutexLock lock(&queue_mu_);
   if (forking_) return false;
-  return callbacks_.size() > 1;
+  return num_callbacks_ > 1;
 }
 
 void ThreadPool::Queue::SleepIfRunning() {
@@ -198,13 +350,46 @@ void ThreadPool::Queue::SetShutdown(bool is_shutdown) {
   cv_.SignalAll();
 }
 
-void ThreadPool::Queue::SetForking(bool is_forking) {
+void ThreadPool::Queue::BeginFork() {
+  grpc_core::MutexLock lock(&queue_mu_);
+  GPR_ASSERT(!std::exchange(forking_, true));
+  ++forks_;
+  forking_hint_.store(true, std::memory_order_relaxed);
+  cv_.SignalAll();
+}
+
+void ThreadPool::Queue::EndForkInParent(ThreadCount* thread_count) {
+  grpc_core::MutexLock lock(&queue_mu_);
+  GPR_ASSERT(std::exchange(forking_, false));
+  forking_hint_.store(false, std::memory_order_relaxed);
+  last_parent_fork_ = forks_;
+  // Count the parked threads before they run again, so that a Quiesce() right
+  // after the fork waits for them.
+  for (; threads_parked_ > 0; --threads_parked_) thread_count->Add();
+  cv_.SignalAll();
+}
+
+void ThreadPool::Queue::EndForkInChild() {
   grpc_core::MutexLock lock(&queue_mu_);
-  auto was_forking = std::exchange(forking_, is_forking);
-  GPR_ASSERT(is_forking != was_forking);
+  GPR_ASSERT(std::exchange(forking_, false));
+  forking_hint_.store(false, std::memory_order_relaxed);
+  threads_parked_ = 0;
   cv_.SignalAll();
 }
 
+bool ThreadPool::Queue::ParkForFork(ThreadCount* thread_count) {
+  grpc_core::MutexLock lock(&queue_mu_);
+  if (!forking_) return false;
+  const uint64_t fork = forks_;
+  ++threads_parked_;
+  thread_count->Remove();
+  while (forking_ && forks_ == fork) cv_.Wait(&queue_mu_);
+  // A thread still around after the fork ended in the child was not forked
+  // at all (PostforkChild() was called directly); count it again itself.
+  if (last_parent_fork_ != fork) thread_count->Add();
+  return true;
+}
+
 void ThreadPool::ThreadCount::Add() {
   grpc_core::MutexLock lock(&thread_count_mu_);
   ++threads_;
@@ -234,16 +419,16 @@ void ThreadPool::ThreadCount::BlockUntilThreadCount(int threads,
 }
 
 void ThreadPool::PrepareFork() {
-  state_->queue.SetForking(true);
+  state_->queue.BeginFork();
   state_->thread_count.BlockUntilThreadCount(0, "forking");
 }
 
-void ThreadPool::PostforkParent() { Postfork(); }
-
-void ThreadPool::PostforkChild() { Postfork(); }
+void ThreadPool::PostforkParent() {
+  state_->queue.EndForkInParent(&state_->thread_count);
+}
 
-void ThreadPool::Postfork() {
-  state_->queue.SetForking(false);
+void ThreadPool::PostforkChild() {
+  state_->queue.EndForkInChild();
   for (unsigned i = 0; i < reserve_threads_; i++) {
     StartThread(state_, StartThreadReason::kInitialPool);
   }
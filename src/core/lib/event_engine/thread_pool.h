@@ -21,11 +21,13 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <atomic>
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
@@ -35,14 +37,33 @@
 
 #include "src/core/lib/event_engine/executor/executor.h"
 #include "src/core/lib/event_engine/forkable.h"
+#include "src/core/lib/event_engine/work_queue.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/sync.h"
 
 namespace grpc_event_engine {
 namespace experimental {
 
+// Callbacks scheduled from outside of the pool go to a shared queue. Each pool
+// thread additionally owns a WorkQueue: callbacks scheduled from a pool thread
+// are pushed onto that thread's queue and run LIFO, and idle threads steal the
+// oldest entries from a randomly chosen thread before going to sleep.
+//
+// The engine's own transport I/O and timer callbacks can be given a priority
+// class: they go to the shared queue of their class and are run before the
+// threads' local queues. When several classes are backlogged, threads take
+// from them in the proportions of kDequeueSchedule, so that a flood of
+// application callbacks does not hold up reads, writes and timers, nor is
+// starved by them.
 class ThreadPool final : public Forkable, public Executor {
  public:
+  enum class Priority {
+    kTransportIo,
+    kTimer,
+    // Everything else, including all callbacks passed to EventEngine::Run.
+    kDefault,
+  };
+
   ThreadPool();
   // Asserts Quiesce was called.
   ~ThreadPool() override;
@@ -52,9 +73,11 @@ class ThreadPool final : public Forkable, public Executor {
   // Run must not be called after Quiesce completes
   void Run(absl::AnyInvocable<void()> callback) override;
   void Run(EventEngine::Closure* closure) override;
+  void Run(EventEngine::Closure* closure, Priority priority);
 
   // Forkable
-  // Ensures that the thread pool is empty before forking.
+  // Parks all of the pool's threads before forking. The parent resumes them;
+  // the child, which has none of them, starts new ones.
   void PrepareFork() override;
   void PostforkParent() override;
   void PostforkChild() override;
@@ -63,32 +86,89 @@ class ThreadPool final : public Forkable, public Executor {
   static bool IsThreadPoolThread();
 
  private:
+  class ThreadCount;
+
   class Queue {
    public:
     explicit Queue(unsigned reserve_threads)
         : reserve_threads_(reserve_threads) {}
-    bool Step();
+    // Runs one callback, preferring the calling thread's local queue, then the
+    // shared queue, then stealing from other threads. Returns false once the
+    // thread should exit.
+    bool Step(WorkQueue* local_queue);
     // Add a callback to the queue.
     // Return true if we should also spin up a new thread.
-    bool Add(absl::AnyInvocable<void()> callback);
+    bool Add(absl::AnyInvocable<void()> callback,
+             Priority priority = Priority::kDefault);
+    // Called after a callback was added to a thread's local queue. Wakes up a
+    // sleeping thread so that it can steal the callback. Return true if we
+    // should also spin up a new thread.
+    bool NotifyLocalWorkAdded(bool was_empty);
+    // Register and unregister a thread's local queue for stealing. Callbacks
+    // left in a queue when it is removed are moved to the shared queue.
+    void AddThreadQueue(WorkQueue* queue);
+    void RemoveThreadQueue(WorkQueue* queue);
     void SetShutdown(bool is_shutdown);
-    void SetForking(bool is_forking);
+    // Fork handling parks threads instead of exiting them. BeginFork() makes
+    // Step() return false and ParkForFork() hold the thread until the fork is
+    // over; parked threads are not counted in thread_count.
+    void BeginFork();
+    // In the parent the parked threads resume, and are counted again.
+    void EndForkInParent(ThreadCount* thread_count);
+    // In the child the parked threads are gone. Their local queues stay
+    // registered so that the child's new threads steal what was left in them.
+    void EndForkInChild();
+    // Returns false, without parking, if the pool is not forking.
+    bool ParkForFork(ThreadCount* thread_count);
     bool IsBacklogged();
     void SleepIfRunning();
 
    private:
+    static constexpr size_t kNumPriorities =
+        static_cast<size_t>(Priority::kDefault) + 1;
+    // The class each shared-queue dequeue prefers, in turn. A dequeue whose
+    // class is empty takes from the most urgent non-empty one.
+    static constexpr Priority kDequeueSchedule[] = {
+        Priority::kTransportIo, Priority::kTimer,       Priority::kTransportIo,
+        Priority::kDefault,     Priority::kTransportIo, Priority::kTimer,
+        Priority::kTransportIo};
+
+    absl::AnyInvocable<void()> PopLocked()
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(queue_mu_);
+    // Pops the oldest callback of a randomly chosen thread's local queue,
+    // other than local_queue.
+    EventEngine::Closure* StealLocked(WorkQueue* local_queue)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(queue_mu_);
+
     const unsigned reserve_threads_;
     grpc_core::Mutex queue_mu_;
     grpc_core::CondVar cv_;
-    std::queue<absl::AnyInvocable<void()>> callbacks_
+    std::queue<absl::AnyInvocable<void()>> callbacks_[kNumPriorities]
         ABSL_GUARDED_BY(queue_mu_);
+    size_t num_callbacks_ ABSL_GUARDED_BY(queue_mu_) = 0;
+    size_t schedule_pos_ ABSL_GUARDED_BY(queue_mu_) = 0;
+    // Callbacks above Priority::kDefault that are queued, so that Step() can
+    // leave the local queue for later without taking queue_mu_.
+    std::atomic<size_t> urgent_callbacks_hint_{0};
+    std::vector<WorkQueue*> thread_queues_ ABSL_GUARDED_BY(queue_mu_);
     unsigned threads_waiting_ ABSL_GUARDED_BY(queue_mu_) = 0;
+    // Mirrors threads_waiting_ so that local pushes can check for sleeping
+    // threads without taking queue_mu_.
+    std::atomic<unsigned> threads_waiting_hint_{0};
+    // Mirrors forking_ so that Step() does not keep draining the local queue
+    // while the pool is trying to quiesce for a fork.
+    std::atomic<bool> forking_hint_{false};
+    uint32_t steal_seed_ ABSL_GUARDED_BY(queue_mu_) = 2463534242u;
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
     // are running, and similarly possible for a fork event to occur during
     // shutdown.
     bool shutdown_ ABSL_GUARDED_BY(queue_mu_) = false;
     bool forking_ ABSL_GUARDED_BY(queue_mu_) = false;
+    // Number of forks begun, and the last one that ended in the parent.
+    uint64_t forks_ ABSL_GUARDED_BY(queue_mu_) = 0;
+    uint64_t last_parent_fork_ ABSL_GUARDED_BY(queue_mu_) = 0;
+    unsigned threads_parked_ ABSL_GUARDED_BY(queue_mu_) = 0;
   };
 
   class ThreadCount {
@@ -127,7 +207,6 @@ class ThreadPool final : public Forkable, public Executor {
   // not: at thread pool startup we start several threads concurrently, but
   // after that we only start one at a time.
   static void StartThread(StatePtr state, StartThreadReason reason);
-  void Postfork();
 
   const unsigned reserve_threads_ =
       grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 32u);
@@ -22,3 +22,4 @@ grpc_core::TraceFlag grpc_event_engine_endpoint_data_trace(
     false, "event_engine_endpoint_data");
 grpc_core::TraceFlag grpc_event_engine_poller_trace(false,
                                                     "event_engine_poller");
+grpc_core::TraceFlag grpc_event_engine_dns_trace(false, "event_engine_dns");
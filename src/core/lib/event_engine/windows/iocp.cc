@@ -69,41 +69,49 @@ void IOCP::Shutdown() {
 
 Poller::WorkResult IOCP::Work(EventEngine::Duration timeout,
                               absl::FunctionRef<void()> schedule_poll_again) {
-  DWORD bytes = 0;
-  ULONG_PTR completion_key;
-  LPOVERLAPPED overlapped;
+  OVERLAPPED_ENTRY entries[kMaxCompletionsPerWork];
+  ULONG count = 0;
   GRPC_EVENT_ENGINE_POLLER_TRACE("IOCP::%p doing work", this);
-  BOOL success = GetQueuedCompletionStatus(
-      iocp_handle_, &bytes, &completion_key, &overlapped,
-      static_cast<DWORD>(Milliseconds(timeout)));
-  if (success == 0 && overlapped == nullptr) {
+  BOOL success = GetQueuedCompletionStatusEx(
+      iocp_handle_, entries, kMaxCompletionsPerWork, &count,
+      static_cast<DWORD>(Milliseconds(timeout)), FALSE);
+  if (success == 0 || count == 0) {
     GRPC_EVENT_ENGINE_POLLER_TRACE("IOCP::%p deadline exceeded", this);
     return Poller::WorkResult::kDeadlineExceeded;
   }
-  GPR_ASSERT(completion_key && overlapped);
-  if (overlapped == &kick_overlap_) {
+  bool kicked = false;
+  for (ULONG i = 0; i < count; i++) {
+    if (entries[i].lpOverlapped != &kick_overlap_) continue;
     GRPC_EVENT_ENGINE_POLLER_TRACE("IOCP::%p kicked", this);
     outstanding_kicks_.fetch_sub(1);
-    if (completion_key == (ULONG_PTR)&kick_token_) {
-      return Poller::WorkResult::kKicked;
+    if (entries[i].lpCompletionKey != (ULONG_PTR)&kick_token_) {
+      grpc_core::Crash(absl::StrFormat("Unknown custom completion key: %lu",
+                                       entries[i].lpCompletionKey));
     }
-    grpc_core::Crash(
-        absl::StrFormat("Unknown custom completion key: %lu", completion_key));
+    kicked = true;
+  }
+  // Let another thread poll while this one hands out the batch. A kick stops
+  // the polling, as before.
+  if (!kicked) schedule_poll_again();
+  for (ULONG i = 0; i < count; i++) {
+    LPOVERLAPPED overlapped = entries[i].lpOverlapped;
+    if (overlapped == &kick_overlap_) continue;
+    GPR_ASSERT(entries[i].lpCompletionKey && overlapped);
+    GRPC_EVENT_ENGINE_POLLER_TRACE("IOCP::%p got event on OVERLAPPED::%p",
+                                   this, overlapped);
+    // Safety note: socket is guaranteed to exist when managed by a
+    // WindowsEndpoint. If an overlapped event came in, then either a read
+    // event handler is registered, which keeps the socket alive, or the
+    // WindowsEndpoint (which keeps the socket alive) has done an asynchronous
+    // WSARecv and is about to register for notification of an overlapped
+    // event.
+    auto* socket = reinterpret_cast<WinSocket*>(entries[i].lpCompletionKey);
+    WinSocket::OpState* info = socket->GetOpInfoForOverlapped(overlapped);
+    GPR_ASSERT(info != nullptr);
+    info->GetOverlappedResult();
+    info->SetReady();
   }
-  GRPC_EVENT_ENGINE_POLLER_TRACE("IOCP::%p got event on OVERLAPPED::%p", this,
-                                 overlapped);
-  // Safety note: socket is guaranteed to exist when managed by a
-  // WindowsEndpoint. If an overlapped event came in, then either a read event
-  // handler is registered, which keeps the socket alive, or the WindowsEndpoint
-  // (which keeps the socket alive) has done an asynchronous WSARecv and is
-  // about to register for notification of an overlapped event.
-  auto* socket = reinterpret_cast<WinSocket*>(completion_key);
-  WinSocket::OpState* info = socket->GetOpInfoForOverlapped(overlapped);
-  GPR_ASSERT(info != nullptr);
-  info->GetOverlappedResult();
-  info->SetReady();
-  schedule_poll_again();
-  return Poller::WorkResult::kOk;
+  return kicked ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
 }
 
 void IOCP::Kick() {
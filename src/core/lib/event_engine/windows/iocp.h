@@ -51,6 +51,9 @@ class IOCP final : public Poller {
   static DWORD GetDefaultSocketFlags();
 
  private:
+  // Completions dequeued by one Work() call.
+  static constexpr ULONG kMaxCompletionsPerWork = 64;
+
   // Initialize default flags via checking platform support
   static DWORD WSASocketFlagsInit();
 
@@ -24,7 +24,8 @@ const char* const description_tcp_frame_size_tuning =
     "If set, enables TCP to use RPC size estimation made by higher layers. TCP "
     "would not indicate completion of a read operation until a specified "
     "number of bytes have been read over the socket. Buffers are also "
-    "allocated according to estimated RPC sizes.";
+    "allocated according to estimated RPC sizes. HTTP/2 writes are also sized "
+    "to what the connection's congestion window lets it send per round trip.";
 const char* const description_tcp_rcv_lowat =
     "Use SO_RCVLOWAT to avoid wakeups on the read path.";
 const char* const description_peer_state_based_framing =
@@ -54,6 +55,37 @@ const char* const description_transport_supplies_client_latency =
     "opencensus";
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
+const char* const description_event_engine_timer_wheel =
+    "Use a hierarchical timing wheel instead of a heap to store timers in the "
+    "posix EventEngine, making timer insertion and cancellation O(1).";
+const char* const description_tcp_rx_zerocopy =
+    "Map large incoming TCP payloads straight into slices with "
+    "TCP_ZEROCOPY_RECEIVE in the posix EventEngine endpoint instead of "
+    "copying them.";
+const char* const description_hpack_intern_cache =
+    "Share the values of headers added to HPACK dynamic tables across all "
+    "connections through a bounded process wide intern cache.";
+const char* const description_tls_kernel_offload =
+    "Hand the record encryption of TLS 1.3 server connections to the kernel "
+    "(kTLS) once the handshake completes, instead of framing every read and "
+    "write through the secure endpoint.";
+const char* const description_chttp2_parallel_stream_recv =
+    "Run the completion of each chttp2 stream's receive ops on EventEngine "
+    "threads, in order per stream, instead of on the thread that parsed them, "
+    "so that the streams of one busy connection are processed on more than "
+    "one core.";
+const char* const description_chttp2_transport_deadlines =
+    "Enforce call deadlines in the chttp2 transport, from one timer per "
+    "connection armed for its earliest stream deadline, instead of arming a "
+    "timer per call in the deadline filter.";
+const char* const description_chttp2_message_size_limits =
+    "Enforce the maximum send and receive message sizes in the chttp2 "
+    "transport, from the length prefix of each message, instead of in the "
+    "message size filter.";
+const char* const description_combiner_offload_budget =
+    "Let a contended combiner run a few more closures on the exec_ctx that is "
+    "draining it before offloading the rest to the executor, instead of "
+    "offloading as soon as the exec_ctx is ready to finish.";
 }  // namespace
 
 namespace grpc_core {
@@ -75,6 +107,17 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"transport_supplies_client_latency",
      description_transport_supplies_client_latency, false},
     {"event_engine_listener", description_event_engine_listener, false},
+    {"event_engine_timer_wheel", description_event_engine_timer_wheel, false},
+    {"tcp_rx_zerocopy", description_tcp_rx_zerocopy, false},
+    {"hpack_intern_cache", description_hpack_intern_cache, false},
+    {"tls_kernel_offload", description_tls_kernel_offload, false},
+    {"chttp2_parallel_stream_recv", description_chttp2_parallel_stream_recv,
+     false},
+    {"chttp2_transport_deadlines", description_chttp2_transport_deadlines,
+     false},
+    {"chttp2_message_size_limits", description_chttp2_message_size_limits,
+     false},
+    {"combiner_offload_budget", description_combiner_offload_budget, false},
 };
 
 }  // namespace grpc_core
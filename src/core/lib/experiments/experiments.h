@@ -72,6 +72,14 @@ inline bool IsFreeLargeAllocatorEnabled() { return false; }
 inline bool IsPromiseBasedServerCallEnabled() { return false; }
 inline bool IsTransportSuppliesClientLatencyEnabled() { return false; }
 inline bool IsEventEngineListenerEnabled() { return false; }
+inline bool IsEventEngineTimerWheelEnabled() { return false; }
+inline bool IsTcpRxZerocopyEnabled() { return false; }
+inline bool IsHpackInternCacheEnabled() { return false; }
+inline bool IsTlsKernelOffloadEnabled() { return false; }
+inline bool IsChttp2ParallelStreamRecvEnabled() { return false; }
+inline bool IsChttp2TransportDeadlinesEnabled() { return false; }
+inline bool IsChttp2MessageSizeLimitsEnabled() { return false; }
+inline bool IsCombinerOffloadBudgetEnabled() { return false; }
 #else
 #define GRPC_EXPERIMENT_IS_INCLUDED_TCP_FRAME_SIZE_TUNING
 inline bool IsTcpFrameSizeTuningEnabled() { return IsExperimentEnabled(0); }
@@ -107,8 +115,32 @@ inline bool IsTransportSuppliesClientLatencyEnabled() {
 }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() { return IsExperimentEnabled(12); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_TIMER_WHEEL
+inline bool IsEventEngineTimerWheelEnabled() { return IsExperimentEnabled(13); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_TCP_RX_ZEROCOPY
+inline bool IsTcpRxZerocopyEnabled() { return IsExperimentEnabled(14); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_HPACK_INTERN_CACHE
+inline bool IsHpackInternCacheEnabled() { return IsExperimentEnabled(15); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_TLS_KERNEL_OFFLOAD
+inline bool IsTlsKernelOffloadEnabled() { return IsExperimentEnabled(16); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_PARALLEL_STREAM_RECV
+inline bool IsChttp2ParallelStreamRecvEnabled() {
+  return IsExperimentEnabled(17);
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_TRANSPORT_DEADLINES
+inline bool IsChttp2TransportDeadlinesEnabled() {
+  return IsExperimentEnabled(18);
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_CHTTP2_MESSAGE_SIZE_LIMITS
+inline bool IsChttp2MessageSizeLimitsEnabled() {
+  return IsExperimentEnabled(19);
+}
+#define GRPC_EXPERIMENT_IS_INCLUDED_COMBINER_OFFLOAD_BUDGET
+inline bool IsCombinerOffloadBudgetEnabled() {
+  return IsExperimentEnabled(20);
+}
 
-constexpr const size_t kNumExperiments = 13;
+constexpr const size_t kNumExperiments = 21;
 extern const ExperimentMetadata g_experiment_metadata[kNumExperiments];
 
 #endif
@@ -27,6 +27,7 @@
 #include <grpc/support/atm.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gpr/log_sink.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/global_config.h"
@@ -41,6 +42,13 @@ GPR_GLOBAL_CONFIG_DEFINE_STRING(grpc_verbosity,
 GPR_GLOBAL_CONFIG_DEFINE_STRING(grpc_stacktrace_minloglevel, "",
                                 "Messages logged at the same or higher level "
                                 "than this will print stacktrace")
+GPR_GLOBAL_CONFIG_DEFINE_BOOL(grpc_log_async, false,
+                              "If set, the default log function queues lines "
+                              "for a background thread to write (Linux only)")
+GPR_GLOBAL_CONFIG_DEFINE_INT32(grpc_log_rate_limit, 0,
+                               "If positive, the most lines per second the "
+                               "default log function logs from each call "
+                               "site (Linux only)")
 
 static constexpr gpr_atm GPR_LOG_SEVERITY_UNSET = GPR_LOG_SEVERITY_ERROR + 10;
 static constexpr gpr_atm GPR_LOG_SEVERITY_NONE = GPR_LOG_SEVERITY_ERROR + 11;
@@ -146,8 +154,22 @@ void gpr_log_verbosity_init() {
     gpr_atm_no_barrier_store(&g_min_severity_to_print_stacktrace,
                              min_severity_to_print_stacktrace);
   }
+  grpc_core::ConfigureDefaultLogSink(
+      GPR_GLOBAL_CONFIG_GET(grpc_log_async),
+      GPR_GLOBAL_CONFIG_GET(grpc_log_rate_limit));
 }
 
 void gpr_set_log_function(gpr_log_func f) {
   gpr_atm_no_barrier_store(&g_log_func, (gpr_atm)(f ? f : gpr_default_log));
 }
+
+#ifndef GPR_LINUX_LOG
+namespace grpc_core {
+
+// The default log functions of other platforms always write synchronously.
+void ConfigureDefaultLogSink(bool /*async*/, int32_t /*rate_limit*/) {}
+DefaultLogSinkDrops GetDefaultLogSinkDrops() { return DefaultLogSinkDrops(); }
+void FlushDefaultLogSink() {}
+
+}  // namespace grpc_core
+#endif  // !GPR_LINUX_LOG
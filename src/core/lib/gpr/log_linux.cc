@@ -29,28 +29,284 @@
 #ifdef GPR_LINUX_LOG
 
 #include <inttypes.h>
+#include <pthread.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/syscall.h>
 #include <time.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/gpr/log_sink.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/examine_stack.h"
+#include "src/core/lib/gprpp/sync.h"
 
 int gpr_should_log_stacktrace(gpr_log_severity severity);
 
 static long sys_gettid(void) { return syscall(__NR_gettid); }
 
+namespace grpc_core {
+namespace {
+
+std::atomic<bool> g_log_async{false};
+std::atomic<int32_t> g_log_rate_limit{0};
+std::atomic<uint64_t> g_buffer_full_drops{0};
+std::atomic<uint64_t> g_rate_limited_drops{0};
+
+// Lines logged per second by the call sites hashing to each entry.
+struct RateLimitSite {
+  std::atomic<int64_t> second{0};
+  std::atomic<int32_t> lines{0};
+};
+constexpr size_t kRateLimitSites = 1024;
+RateLimitSite g_rate_limit_sites[kRateLimitSites];
+
+// Returns false if the line logged at file:line at now_sec is over
+// \a limit.  Sets *dropped_earlier to the number of lines the call site
+// dropped in the previous second it logged in, so that they can be noted
+// on the first line let through in a new second.  Call sites that hash to
+// the same entry share their limit.
+bool WithinRateLimit(const char* file, int line, int64_t now_sec,
+                     int32_t limit, int32_t* dropped_earlier) {
+  size_t hash = (reinterpret_cast<uintptr_t>(file) >> 3) * 31 +
+                static_cast<size_t>(line);
+  RateLimitSite& site = g_rate_limit_sites[hash % kRateLimitSites];
+  int64_t second = site.second.load(std::memory_order_relaxed);
+  if (second != now_sec && site.second.compare_exchange_strong(
+                               second, now_sec, std::memory_order_relaxed)) {
+    *dropped_earlier = std::max(
+        0, site.lines.exchange(0, std::memory_order_relaxed) - limit);
+  }
+  if (site.lines.fetch_add(1, std::memory_order_relaxed) >= limit) {
+    g_rate_limited_drops.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+// Lines logged by one thread and not yet written.  Only that thread
+// pushes, and only AsyncLogSink::Flush() pops.
+class LogBuffer {
+ public:
+  static constexpr size_t kCapacity = 256;
+
+  bool Push(std::string line) {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == kCapacity) {
+      return false;
+    }
+    lines_[tail % kCapacity] = std::move(line);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Appends the queued lines to *out and releases their memory.
+  void PopAll(std::string* out) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    const size_t tail = tail_.load(std::memory_order_acquire);
+    for (; head != tail; ++head) {
+      std::string& line = lines_[head % kCapacity];
+      out->append(line);
+      std::string().swap(line);
+    }
+    head_.store(head, std::memory_order_release);
+  }
+
+  // Called when the owning thread exits: it will push no more lines.
+  void Abandon() { abandoned_.store(true, std::memory_order_release); }
+  bool abandoned() const { return abandoned_.load(std::memory_order_acquire); }
+
+ private:
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+  std::atomic<bool> abandoned_{false};
+  std::string lines_[kCapacity];
+};
+
+class AsyncLogSink;
+
+struct ThreadLogBuffer {
+  ~ThreadLogBuffer();
+  AsyncLogSink* sink = nullptr;
+  LogBuffer* buffer = nullptr;
+};
+thread_local ThreadLogBuffer g_thread_log_buffer;
+// Set once g_thread_log_buffer is destroyed, for lines logged by
+// thread_local destructors that run after it.
+thread_local bool g_thread_log_buffer_destroyed = false;
+
+ThreadLogBuffer::~ThreadLogBuffer() {
+  if (buffer != nullptr) buffer->Abandon();
+  g_thread_log_buffer_destroyed = true;
+}
+
+// Writes the lines queued by every thread to stderr from a background
+// thread.
+class AsyncLogSink {
+ public:
+  // Returns the sink, starting it if needed, or null if its thread could
+  // not be started.
+  static AsyncLogSink* Get() {
+    AsyncLogSink* sink = g_sink.load(std::memory_order_acquire);
+    if (sink != nullptr) return sink->running() ? sink : nullptr;
+    sink = new AsyncLogSink();
+    AsyncLogSink* expected = nullptr;
+    if (!g_sink.compare_exchange_strong(expected, sink,
+                                        std::memory_order_acq_rel)) {
+      delete sink;
+      return expected->running() ? expected : nullptr;
+    }
+    pthread_once(&g_once, [] {
+      // The child of a fork() does not inherit the writer thread: leak
+      // the parent's sink and start another on the next line logged.
+      pthread_atfork(nullptr, nullptr,
+                     [] { g_sink.store(nullptr, std::memory_order_relaxed); });
+      atexit(FlushDefaultLogSink);
+    });
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_t thread;
+    if (pthread_create(&thread, &attr, WriterThread, sink) == 0) {
+      sink->running_.store(true, std::memory_order_release);
+    }
+    pthread_attr_destroy(&attr);
+    return sink->running() ? sink : nullptr;
+  }
+
+  static AsyncLogSink* GetIfStarted() {
+    return g_sink.load(std::memory_order_acquire);
+  }
+
+  // Queues \a line, or returns false if it must be written synchronously.
+  bool Log(std::string&& line) {
+    if (g_thread_log_buffer_destroyed) return false;
+    LogBuffer* buffer = ThreadBuffer();
+    if (!buffer->Push(std::move(line))) {
+      g_buffer_full_drops.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+    if (!wakeup_pending_.exchange(true, std::memory_order_acq_rel)) {
+      MutexLock lock(&wakeup_mu_);
+      wakeup_cv_.Signal();
+    }
+    return true;
+  }
+
+  void Flush() {
+    MutexLock flush_lock(&flush_mu_);
+    std::string out;
+    {
+      MutexLock lock(&buffers_mu_);
+      for (auto it = buffers_.begin(); it != buffers_.end();) {
+        LogBuffer* buffer = *it;
+        const bool abandoned = buffer->abandoned();
+        buffer->PopAll(&out);
+        if (abandoned) {
+          delete buffer;
+          it = buffers_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+    const uint64_t buffer_full_drops =
+        g_buffer_full_drops.load(std::memory_order_relaxed);
+    if (buffer_full_drops != reported_buffer_full_drops_) {
+      absl::StrAppendFormat(
+          &out,
+          "%" PRIu64 " log lines dropped: their thread's buffer was full\n",
+          buffer_full_drops - reported_buffer_full_drops_);
+      reported_buffer_full_drops_ = buffer_full_drops;
+    }
+    if (!out.empty()) fwrite(out.data(), 1, out.size(), stderr);
+  }
+
+ private:
+  static void* WriterThread(void* arg) {
+    auto* sink = static_cast<AsyncLogSink*>(arg);
+    while (true) {
+      {
+        MutexLock lock(&sink->wakeup_mu_);
+        while (!sink->wakeup_pending_.exchange(false,
+                                               std::memory_order_acq_rel)) {
+          sink->wakeup_cv_.Wait(&sink->wakeup_mu_);
+        }
+      }
+      sink->Flush();
+    }
+    return nullptr;
+  }
+
+  LogBuffer* ThreadBuffer() {
+    if (g_thread_log_buffer.sink != this) {
+      if (g_thread_log_buffer.buffer != nullptr) {
+        g_thread_log_buffer.buffer->Abandon();
+      }
+      g_thread_log_buffer.sink = this;
+      g_thread_log_buffer.buffer = new LogBuffer();
+      MutexLock lock(&buffers_mu_);
+      buffers_.push_back(g_thread_log_buffer.buffer);
+    }
+    return g_thread_log_buffer.buffer;
+  }
+
+  static std::atomic<AsyncLogSink*> g_sink;
+  static pthread_once_t g_once;
+
+  bool running() const { return running_.load(std::memory_order_acquire); }
+
+  std::atomic<bool> running_{false};
+  Mutex flush_mu_;
+  uint64_t reported_buffer_full_drops_ ABSL_GUARDED_BY(flush_mu_) = 0;
+  Mutex buffers_mu_;
+  std::vector<LogBuffer*> buffers_ ABSL_GUARDED_BY(buffers_mu_);
+  Mutex wakeup_mu_;
+  CondVar wakeup_cv_;
+  std::atomic<bool> wakeup_pending_{false};
+};
+
+std::atomic<AsyncLogSink*> AsyncLogSink::g_sink{nullptr};
+pthread_once_t AsyncLogSink::g_once = PTHREAD_ONCE_INIT;
+
+}  // namespace
+
+void ConfigureDefaultLogSink(bool async, int32_t rate_limit) {
+  g_log_async.store(async, std::memory_order_relaxed);
+  g_log_rate_limit.store(rate_limit, std::memory_order_relaxed);
+}
+
+DefaultLogSinkDrops GetDefaultLogSinkDrops() {
+  DefaultLogSinkDrops drops;
+  drops.buffer_full = g_buffer_full_drops.load(std::memory_order_relaxed);
+  drops.rate_limited = g_rate_limited_drops.load(std::memory_order_relaxed);
+  return drops;
+}
+
+void FlushDefaultLogSink() {
+  AsyncLogSink* sink = AsyncLogSink::GetIfStarted();
+  if (sink != nullptr) sink->Flush();
+}
+
+}  // namespace grpc_core
+
 void gpr_log(const char* file, int line, gpr_log_severity severity,
              const char* format, ...) {
   // Avoid message construction if gpr_log_message won't log
@@ -80,6 +336,15 @@ void gpr_default_log(gpr_log_func_args* args) {
   static thread_local long tid(0);
   if (tid == 0) tid = sys_gettid();
 
+  const int32_t rate_limit =
+      grpc_core::g_log_rate_limit.load(std::memory_order_relaxed);
+  int32_t dropped_earlier = 0;
+  if (rate_limit > 0 &&
+      !grpc_core::WithinRateLimit(args->file, args->line, now.tv_sec,
+                                  rate_limit, &dropped_earlier)) {
+    return;
+  }
+
   timer = static_cast<time_t>(now.tv_sec);
   final_slash = strrchr(args->file, '/');
   if (final_slash == nullptr) {
@@ -103,12 +368,18 @@ void gpr_default_log(gpr_log_func_args* args) {
       gpr_should_log_stacktrace(args->severity)
           ? grpc_core::GetCurrentStackTrace()
           : absl::nullopt;
-  if (stack_trace) {
-    fprintf(stderr, "%-70s %s\n%s\n", prefix.c_str(), args->message,
-            stack_trace->c_str());
-  } else {
-    fprintf(stderr, "%-70s %s\n", prefix.c_str(), args->message);
+  std::string line = absl::StrFormat("%-70s %s", prefix, args->message);
+  if (dropped_earlier > 0) {
+    absl::StrAppend(&line, " (", dropped_earlier,
+                    " earlier lines from here dropped by GRPC_LOG_RATE_LIMIT)");
+  }
+  line.push_back('\n');
+  if (stack_trace) absl::StrAppend(&line, *stack_trace, "\n");
+  if (grpc_core::g_log_async.load(std::memory_order_relaxed)) {
+    grpc_core::AsyncLogSink* sink = grpc_core::AsyncLogSink::Get();
+    if (sink != nullptr && sink->Log(std::move(line))) return;
   }
+  fwrite(line.data(), 1, line.size(), stderr);
 }
 
 #endif  // GPR_LINUX_LOG
@@ -0,0 +1,54 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_LIB_GPR_LOG_SINK_H
+#define GRPC_SRC_CORE_LIB_GPR_LOG_SINK_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+// Options for the default log function (the one used unless
+// gpr_set_log_function() installs another).  They only take effect on
+// Linux; elsewhere the default log function always writes to stderr
+// synchronously.
+
+namespace grpc_core {
+
+// If \a async is true, log lines are queued in per-thread buffers and
+// written to stderr by a background thread, so that logging never waits
+// for stderr.  Lines logged while a thread's buffer is full are dropped.
+// If \a rate_limit is positive, each call site logs at most that many
+// lines per second; the rest are dropped.
+// Configured from GRPC_LOG_ASYNC and GRPC_LOG_RATE_LIMIT by grpc_init().
+void ConfigureDefaultLogSink(bool async, int32_t rate_limit);
+
+// Counts of lines the default log function has dropped.
+struct DefaultLogSinkDrops {
+  uint64_t buffer_full = 0;
+  uint64_t rate_limited = 0;
+};
+DefaultLogSinkDrops GetDefaultLogSinkDrops();
+
+// Writes out every line queued so far.  Called before crashing so that
+// the last lines logged are not lost.
+void FlushDefaultLogSink();
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_GPR_LOG_SINK_H
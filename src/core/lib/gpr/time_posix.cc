@@ -145,6 +145,8 @@ static gpr_timespec now_impl(gpr_clock_type clock) {
 
 gpr_timespec (*gpr_now_impl)(gpr_clock_type clock_type) = now_impl;
 
+bool gpr_now_is_system_clock(void) { return gpr_now_impl == now_impl; }
+
 gpr_timespec gpr_now(gpr_clock_type clock_type) {
   // validate clock type
   GPR_ASSERT(clock_type == GPR_CLOCK_MONOTONIC ||
@@ -66,4 +66,8 @@ void gpr_precise_clock_now(gpr_timespec* clk);
 gpr_timespec gpr_cycle_counter_to_time(gpr_cycle_counter cycles);
 gpr_timespec gpr_cycle_counter_sub(gpr_cycle_counter a, gpr_cycle_counter b);
 
+// Returns false once a test has replaced gpr_now() with a fake clock, which
+// clocks derived from the cycle counter would not follow.
+bool gpr_now_is_system_clock(void);
+
 #endif  // GRPC_SRC_CORE_LIB_GPR_TIME_PRECISE_H
@@ -0,0 +1,79 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/adaptive_mutex.h"
+
+#include <algorithm>
+
+namespace grpc_core {
+
+void (*OnAdaptiveMutexContention)(bool parked) = nullptr;
+
+namespace {
+
+// Tell the CPU we are spinning, so that it can favor the lock holder if it
+// runs on a sibling hyperthread.
+inline void CpuRelax() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_ia32_pause();
+#elif defined(__GNUC__) && defined(__aarch64__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+}  // namespace
+
+void AdaptiveMutex::LockSlow() {
+  // Spin for up to twice what it usually takes, as glibc's adaptive mutexes
+  // do, so that a lock that is usually released quickly is waited for.
+  const int max_spins = std::min(
+      kMaxSpins, spin_estimate_.load(std::memory_order_relaxed) * 2 + 10);
+  int spins = 0;
+  for (; spins < max_spins; ++spins) {
+    uint32_t state = state_.load(std::memory_order_relaxed);
+    if (state == kUnlocked &&
+        state_.compare_exchange_weak(state, kLocked, std::memory_order_acquire,
+                                     std::memory_order_relaxed)) {
+      break;
+    }
+    CpuRelax();
+  }
+  const int estimate = spin_estimate_.load(std::memory_order_relaxed);
+  spin_estimate_.store(estimate + (spins - estimate) / 8,
+                       std::memory_order_relaxed);
+  if (spins < max_spins) {
+    spin_acquires_.fetch_add(1, std::memory_order_relaxed);
+    if (OnAdaptiveMutexContention != nullptr) OnAdaptiveMutexContention(false);
+    return;
+  }
+  parks_.fetch_add(1, std::memory_order_relaxed);
+  if (OnAdaptiveMutexContention != nullptr) OnAdaptiveMutexContention(true);
+  // Marking the mutex as having waiters makes the holder wake one up when
+  // it unlocks.  We may not be the only waiter, so keep it marked once we
+  // have the mutex too.
+  MutexLock lock(&park_mu_);
+  while (state_.exchange(kLockedWithWaiters, std::memory_order_acquire) !=
+         kUnlocked) {
+    park_cv_.Wait(&park_mu_);
+  }
+}
+
+void AdaptiveMutex::WakeOne() {
+  MutexLock lock(&park_mu_);
+  park_cv_.Signal();
+}
+
+}  // namespace grpc_core
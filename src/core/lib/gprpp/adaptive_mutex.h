@@ -0,0 +1,133 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_GPRPP_ADAPTIVE_MUTEX_H
+#define GRPC_SRC_CORE_LIB_GPRPP_ADAPTIVE_MUTEX_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "absl/base/thread_annotations.h"
+
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+// Called, if set, on each AdaptiveMutex acquisition that found the mutex
+// held: parked is whether the thread had to park.  grpc_init() points it
+// at global_stats().
+extern void (*OnAdaptiveMutexContention)(bool parked);
+
+// A mutex for critical sections known to be short, such as a hash set
+// insert.  A thread that finds it held spins for a while, since the holder
+// is likely to be about to release it, and only parks once spinning stops
+// paying off.  The number of spins adapts to how long the lock took to be
+// released in the past.
+// Uncontended Lock() and Unlock() are one atomic operation each.
+// Never hold an AdaptiveMutex across anything that may block.
+class ABSL_LOCKABLE AdaptiveMutex {
+ public:
+  // The most times Lock() checks the mutex before parking.
+  static constexpr int kMaxSpins = 100;
+
+  // How often this mutex was contended, for profiling.  global_stats()
+  // counts the same events across all AdaptiveMutexes, as
+  // adaptive_mutex_spin_acquires and adaptive_mutex_parks, through
+  // OnAdaptiveMutexContention.
+  struct ContentionStats {
+    // Acquisitions that found the mutex held, and got it by spinning.
+    uint64_t spin_acquires;
+    // Acquisitions that parked the thread.
+    uint64_t parks;
+  };
+
+  AdaptiveMutex() = default;
+  AdaptiveMutex(const AdaptiveMutex&) = delete;
+  AdaptiveMutex& operator=(const AdaptiveMutex&) = delete;
+
+  void Lock() ABSL_EXCLUSIVE_LOCK_FUNCTION() {
+    uint32_t expected = kUnlocked;
+    if (GPR_LIKELY(state_.compare_exchange_weak(expected, kLocked,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed))) {
+      return;
+    }
+    LockSlow();
+  }
+
+  void Unlock() ABSL_UNLOCK_FUNCTION() {
+    if (GPR_UNLIKELY(state_.exchange(kUnlocked, std::memory_order_release) ==
+                     kLockedWithWaiters)) {
+      WakeOne();
+    }
+  }
+
+  bool TryLock() ABSL_EXCLUSIVE_TRYLOCK_FUNCTION(true) {
+    uint32_t expected = kUnlocked;
+    return state_.compare_exchange_strong(expected, kLocked,
+                                          std::memory_order_acquire,
+                                          std::memory_order_relaxed);
+  }
+
+  void AssertHeld() ABSL_ASSERT_EXCLUSIVE_LOCK() {}
+
+  ContentionStats contention_stats() const {
+    return {spin_acquires_.load(std::memory_order_relaxed),
+            parks_.load(std::memory_order_relaxed)};
+  }
+
+ private:
+  enum : uint32_t {
+    kUnlocked,
+    kLocked,
+    // Locked, and threads may be parked waiting for it.
+    kLockedWithWaiters,
+  };
+
+  void LockSlow();
+  void WakeOne();
+
+  std::atomic<uint32_t> state_{kUnlocked};
+  // A running estimate of the spins it takes to get the mutex.  Updated
+  // without synchronization: it is only a hint.
+  std::atomic<int> spin_estimate_{0};
+  std::atomic<uint64_t> spin_acquires_{0};
+  std::atomic<uint64_t> parks_{0};
+  // Parked threads wait on park_cv_.
+  Mutex park_mu_;
+  CondVar park_cv_;
+};
+
+class ABSL_SCOPED_LOCKABLE AdaptiveMutexLock {
+ public:
+  explicit AdaptiveMutexLock(AdaptiveMutex* mu)
+      ABSL_EXCLUSIVE_LOCK_FUNCTION(mu)
+      : mu_(mu) {
+    mu_->Lock();
+  }
+  ~AdaptiveMutexLock() ABSL_UNLOCK_FUNCTION() { mu_->Unlock(); }
+
+  AdaptiveMutexLock(const AdaptiveMutexLock&) = delete;
+  AdaptiveMutexLock& operator=(const AdaptiveMutexLock&) = delete;
+
+ private:
+  AdaptiveMutex* const mu_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_GPRPP_ADAPTIVE_MUTEX_H
@@ -33,15 +33,38 @@ namespace grpc_core {
 // Expectation is that most usage will fit in one chunk, sometimes two will be
 // needed, and very rarely three. Appending is constant time, calculating the
 // size is O(n_chunks).
-template <typename T, size_t kChunkSize>
+// If kInlineSize is not zero, the first kInlineSize T's are held in the
+// vector itself, and only the chunks after that come from the arena: so a
+// vector that usually stays small never allocates. Moving such a vector
+// moves its inline elements one by one.
+template <typename T, size_t kChunkSize, size_t kInlineSize = 0>
 class ChunkedVector {
  private:
-  // One chunk of allocated memory.
+  // One chunk of memory; data points to capacity T's.
   struct Chunk {
-    Chunk() = default;
     Chunk* next = nullptr;
     size_t count = 0;
-    ManualConstructor<T> data[kChunkSize];
+    size_t capacity;
+    ManualConstructor<T>* data;
+  };
+  // A chunk along with its storage.
+  template <size_t kCapacity>
+  struct SizedChunk : public Chunk {
+    SizedChunk() {
+      this->capacity = kCapacity;
+      this->data = storage;
+    }
+    ManualConstructor<T> storage[kCapacity];
+  };
+  // The inline first chunk, if any.
+  template <size_t kCapacity, typename Dummy = void>
+  struct InlineChunk {
+    Chunk* get() { return &chunk; }
+    SizedChunk<kCapacity> chunk;
+  };
+  template <typename Dummy>
+  struct InlineChunk<0, Dummy> {
+    Chunk* get() { return nullptr; }
   };
 
  public:
@@ -59,20 +82,21 @@ class ChunkedVector {
     Swap(&tmp);
     return *this;
   }
-  ChunkedVector(ChunkedVector&& other) noexcept
-      : arena_(other.arena_), first_(other.first_), append_(other.append_) {
-    other.first_ = nullptr;
-    other.append_ = nullptr;
+  ChunkedVector(ChunkedVector&& other) noexcept : arena_(other.arena_) {
+    TakeFrom(&other);
   }
   ChunkedVector& operator=(ChunkedVector&& other) noexcept {
-    Swap(&other);
+    if (this != &other) {
+      Clear();
+      TakeFrom(&other);
+    }
     return *this;
   }
   ~ChunkedVector() { Clear(); }
   void Swap(ChunkedVector* other) {
-    std::swap(other->arena_, arena_);
-    std::swap(other->first_, first_);
-    std::swap(other->append_, append_);
+    ChunkedVector tmp(std::move(*other));
+    *other = std::move(*this);
+    *this = std::move(tmp);
   }
 
   Arena* arena() const { return arena_; }
@@ -236,20 +260,42 @@ class ChunkedVector {
   ManualConstructor<T>* AppendSlot() {
     if (append_ == nullptr) {
       GPR_ASSERT(first_ == nullptr);
-      first_ = arena_->New<Chunk>();
+      first_ = arena_->New<SizedChunk<kChunkSize>>();
       append_ = first_;
-    } else if (append_->count == kChunkSize) {
+    } else if (append_->count == append_->capacity) {
       if (append_->next == nullptr) {
-        append_->next = arena_->New<Chunk>();
+        append_->next = arena_->New<SizedChunk<kChunkSize>>();
       }
       append_ = append_->next;
     }
     return &append_->data[append_->count++];
   }
 
+  // Take the elements of other, which is left empty; this must be empty.
+  void TakeFrom(ChunkedVector* other) {
+    arena_ = other->arena_;
+    Chunk* chunk = inline_.get();
+    if (chunk == nullptr) {
+      first_ = std::exchange(other->first_, nullptr);
+      append_ = std::exchange(other->append_, nullptr);
+      return;
+    }
+    // The arena chunks can be handed over, the inline ones must be moved.
+    Chunk* other_chunk = other->inline_.get();
+    for (size_t i = 0; i < other_chunk->count; i++) {
+      chunk->data[i].Init(std::move(*other_chunk->data[i]));
+      other_chunk->data[i].Destroy();
+    }
+    chunk->count = std::exchange(other_chunk->count, 0);
+    chunk->next = std::exchange(other_chunk->next, nullptr);
+    append_ = other->append_ == other_chunk ? chunk : other->append_;
+    other->append_ = other_chunk;
+  }
+
   Arena* arena_;
-  Chunk* first_ = nullptr;
-  Chunk* append_ = nullptr;
+  InlineChunk<kInlineSize> inline_;
+  Chunk* first_ = inline_.get();
+  Chunk* append_ = first_;
 };
 
 }  // namespace grpc_core
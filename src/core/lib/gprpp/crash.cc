@@ -22,11 +22,14 @@
 
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gpr/log_sink.h"
+
 namespace grpc_core {
 
 void Crash(absl::string_view message, SourceLocation location) {
   gpr_log(location.file(), location.line(), GPR_LOG_SEVERITY_ERROR, "%s",
           std::string(message).c_str());
+  FlushDefaultLogSink();
   abort();
 }
 
@@ -0,0 +1,111 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/numa.h"
+
+#include <stdio.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/cpu.h>
+
+#include "src/core/lib/gprpp/no_destruct.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Maps each CPU to its NUMA node, as described by the kernel under sysfs.
+class NumaTopology {
+ public:
+  NumaTopology() : cpu_to_node_(gpr_cpu_num_cores(), 0) {
+#ifdef GPR_LINUX
+    for (size_t node = 0;; ++node) {
+      std::string cpulist;
+      if (!ReadCpuList(node, &cpulist)) break;
+      node_count_ = node + 1;
+      // cpulist looks like "0-15,32-47".
+      for (absl::string_view range :
+           absl::StrSplit(cpulist, ',', absl::SkipWhitespace())) {
+        std::pair<absl::string_view, absl::string_view> bounds =
+            absl::StrSplit(absl::StripAsciiWhitespace(range), '-');
+        size_t first;
+        size_t last;
+        if (!absl::SimpleAtoi(bounds.first, &first)) continue;
+        if (bounds.second.empty()) {
+          last = first;
+        } else if (!absl::SimpleAtoi(bounds.second, &last)) {
+          continue;
+        }
+        for (size_t cpu = first; cpu <= last && cpu < cpu_to_node_.size();
+             ++cpu) {
+          cpu_to_node_[cpu] = node;
+        }
+      }
+    }
+#endif  // GPR_LINUX
+  }
+
+  size_t node_count() const { return node_count_; }
+
+  size_t NodeOf(size_t cpu) const {
+    return cpu < cpu_to_node_.size() ? cpu_to_node_[cpu] : 0;
+  }
+
+ private:
+#ifdef GPR_LINUX
+  static bool ReadCpuList(size_t node, std::string* cpulist) {
+    std::string path =
+        absl::StrCat("/sys/devices/system/node/node", node, "/cpulist");
+    FILE* f = fopen(path.c_str(), "r");
+    if (f == nullptr) return false;
+    char buf[4096];
+    size_t n = fread(buf, 1, sizeof(buf), f);
+    fclose(f);
+    cpulist->assign(buf, n);
+    return true;
+  }
+#endif  // GPR_LINUX
+
+  size_t node_count_ = 1;
+  std::vector<size_t> cpu_to_node_;
+};
+
+const NumaTopology& Topology() {
+  static const NoDestruct<NumaTopology> topology;
+  return *topology;
+}
+
+}  // namespace
+
+size_t NumaNodeCount() { return Topology().node_count(); }
+
+size_t CurrentNumaNode() {
+  const NumaTopology& topology = Topology();
+  // Skip the CPU lookup entirely on the common single node host.
+  if (topology.node_count() == 1) return 0;
+  return topology.NodeOf(gpr_cpu_current_cpu());
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,36 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_GPRPP_NUMA_H
+#define GRPC_SRC_CORE_LIB_GPRPP_NUMA_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+namespace grpc_core {
+
+// Number of NUMA nodes on this host.
+// Returns 1 where the topology cannot be determined, so callers can treat
+// every host the same way.
+size_t NumaNodeCount();
+
+// NUMA node of the CPU the calling thread is currently running on, in the
+// range [0, NumaNodeCount()).
+// The thread may migrate at any point, so this is a placement hint only.
+size_t CurrentNumaNode();
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_GPRPP_NUMA_H
@@ -17,6 +17,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 
@@ -29,16 +30,23 @@ namespace grpc_core {
 template <typename T>
 class PerCpu {
  public:
-  T& this_cpu() { return data_[ExecCtx::Get()->starting_cpu()]; }
+  PerCpu() = default;
+  // Shares each instance between several CPUs if there are more than
+  // \a max_shards of them, for instances too numerous to have one per CPU.
+  explicit PerCpu(size_t max_shards)
+      : shards_(std::max<size_t>(
+            1, std::min<size_t>(gpr_cpu_num_cores(), max_shards))) {}
+
+  T& this_cpu() { return data_[ExecCtx::Get()->starting_cpu() % shards_]; }
 
   T* begin() { return data_.get(); }
-  T* end() { return data_.get() + cpus_; }
+  T* end() { return data_.get() + shards_; }
   const T* begin() const { return data_.get(); }
-  const T* end() const { return data_.get() + cpus_; }
+  const T* end() const { return data_.get() + shards_; }
 
  private:
-  const size_t cpus_ = gpr_cpu_num_cores();
-  std::unique_ptr<T[]> data_{new T[cpus_]};
+  const size_t shards_ = gpr_cpu_num_cores();
+  std::unique_ptr<T[]> data_{new T[shards_]};
 };
 
 }  // namespace grpc_core
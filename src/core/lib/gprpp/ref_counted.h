@@ -198,6 +198,81 @@ class RefCount {
   std::atomic<Value> value_{0};
 };
 
+// NonAtomicRefCount has the same interface as RefCount, but without atomic
+// operations.  Use it only for objects that are never reffed or unreffed
+// from two threads at once, for example per-call objects that are only
+// touched from within their call's call combiner or Party: those hand the
+// object from thread to thread with the synchronization it needs.
+class NonAtomicRefCount {
+ public:
+  using Value = intptr_t;
+
+  explicit NonAtomicRefCount(
+      Value init = 1,
+      const char*
+#ifndef NDEBUG
+          // Leave unnamed if NDEBUG to avoid unused parameter warning
+          trace
+#endif
+      = nullptr)
+      :
+#ifndef NDEBUG
+        trace_(trace),
+#endif
+        value_(init) {
+  }
+
+  void Ref(Value n = 1) { Ref(DEBUG_LOCATION, nullptr, n); }
+  void Ref(const DebugLocation& location, const char* reason, Value n = 1) {
+    Trace(location, reason, "ref", n);
+    value_ += n;
+  }
+
+  void RefNonZero() { RefNonZero(DEBUG_LOCATION, nullptr); }
+  void RefNonZero(const DebugLocation& location, const char* reason) {
+    GPR_DEBUG_ASSERT(value_ > 0);
+    Ref(location, reason);
+  }
+
+  bool RefIfNonZero() { return RefIfNonZero(DEBUG_LOCATION, nullptr); }
+  bool RefIfNonZero(const DebugLocation& location, const char* reason) {
+    if (value_ == 0) return false;
+    Ref(location, reason);
+    return true;
+  }
+
+  // Decrements the ref-count and returns true if the ref-count reaches 0.
+  bool Unref() { return Unref(DEBUG_LOCATION, nullptr); }
+  bool Unref(const DebugLocation& location, const char* reason) {
+    GPR_DEBUG_ASSERT(value_ > 0);
+    Trace(location, reason, "unref", -1);
+    return --value_ == 0;
+  }
+
+ private:
+  void Trace(const DebugLocation& location, const char* reason,
+             const char* op, Value delta) const {
+#ifndef NDEBUG
+    if (trace_ != nullptr) {
+      gpr_log(GPR_INFO, "%s:%p %s:%d %s %" PRIdPTR " -> %" PRIdPTR " %s",
+              trace_, this, location.file(), location.line(), op, value_,
+              value_ + delta, reason == nullptr ? "" : reason);
+    }
+#else
+    // Avoid unused-parameter warnings for debug-only parameters
+    (void)location;
+    (void)reason;
+    (void)op;
+    (void)delta;
+#endif
+  }
+
+#ifndef NDEBUG
+  const char* trace_;
+#endif
+  Value value_;
+};
+
 // PolymorphicRefCount enforces polymorphic destruction of RefCounted.
 class PolymorphicRefCount {
  public:
@@ -259,6 +334,9 @@ class Delete<T, kUnrefCallDtor> {
 // Use PolymorphicRefCount and NonPolymorphicRefCount to select between
 // different implementations of RefCounted.
 //
+// RefCountType selects the counter: RefCount by default, or
+// NonAtomicRefCount for objects that qualify for it (see above).
+//
 // Note that NonPolymorphicRefCount does not support polymorphic destruction.
 // So, use NonPolymorphicRefCount only when both of the following conditions
 // are guaranteed to hold:
@@ -276,7 +354,8 @@ class Delete<T, kUnrefCallDtor> {
 //    ch->Unref();
 //
 template <typename Child, typename Impl = PolymorphicRefCount,
-          UnrefBehavior UnrefBehaviorArg = kUnrefDelete>
+          UnrefBehavior UnrefBehaviorArg = kUnrefDelete,
+          typename RefCountType = RefCount>
 class RefCounted : public Impl {
  public:
   using RefCountedChildType = Child;
@@ -341,7 +420,7 @@ class RefCounted : public Impl {
     refs_.Ref(location, reason);
   }
 
-  RefCount refs_;
+  RefCountType refs_;
 };
 
 }  // namespace grpc_core
@@ -0,0 +1,137 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_GPRPP_SHARDED_MPSCQ_H
+#define GRPC_SRC_CORE_LIB_GPRPP_SHARDED_MPSCQ_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include "src/core/lib/gprpp/mpscq.h"
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+// Multiple-producer single-consumer lock free queue, made of one
+// MultiProducerSingleConsumerQueue per CPU, so that producers on different
+// CPUs do not contend on one queue head.  The consumer drains the shards
+// round-robin.
+// Nodes keep their order within a shard only: nodes pushed from different
+// CPUs (including by one thread from ExecCtxs started on different CPUs)
+// may be popped in any order.  Use it only where the consumer does not
+// care about the order.
+// Push requires an ExecCtx, to find the CPU.
+class ShardedMultiProducerSingleConsumerQueue {
+ public:
+  typedef MultiProducerSingleConsumerQueue::Node Node;
+
+  static constexpr size_t kDefaultMaxShards = 16;
+
+  explicit ShardedMultiProducerSingleConsumerQueue(
+      size_t max_shards = kDefaultMaxShards)
+      : shards_(max_shards) {}
+
+  // Push a node
+  // Thread safe - can be called from multiple threads concurrently
+  // Returns true if this was possibly the first node in its shard, and so
+  // possibly the first node in the queue (may return true sporadically,
+  // will not return false sporadically)
+  bool Push(Node* node) { return shards_.this_cpu().queue.Push(node); }
+
+  // Pop a node (returns NULL if no node is ready - which doesn't indicate that
+  // the queue is empty!!)
+  // Thread compatible - can only be called from one thread at a time
+  Node* Pop() {
+    bool empty;
+    return PopAndCheckEnd(&empty);
+  }
+
+  // Pop a node; sets *empty to true if every shard was empty when it was
+  // checked, or false if one was not.
+  Node* PopAndCheckEnd(bool* empty) {
+    const size_t num_shards = shards_.end() - shards_.begin();
+    *empty = true;
+    for (size_t i = 0; i < num_shards; ++i) {
+      Shard& shard = shards_.begin()[next_shard_];
+      next_shard_ = (next_shard_ + 1) % num_shards;
+      bool shard_empty;
+      Node* node = shard.queue.PopAndCheckEnd(&shard_empty);
+      if (node != nullptr) {
+        *empty = false;
+        return node;
+      }
+      if (!shard_empty) *empty = false;
+    }
+    return nullptr;
+  }
+
+ private:
+  struct Shard {
+    MultiProducerSingleConsumerQueue queue;
+    // Keeps the consumer's end of this shard and the producers' end of the
+    // next one off each other's cache lines.
+    char padding[GPR_CACHELINE_SIZE];
+  };
+
+  PerCpu<Shard> shards_;
+  size_t next_shard_ = 0;
+};
+
+// A ShardedMultiProducerSingleConsumerQueue with a lock: it's safe to pop
+// from multiple threads, but only one thread will succeed concurrently.
+class LockedShardedMultiProducerSingleConsumerQueue {
+ public:
+  typedef MultiProducerSingleConsumerQueue::Node Node;
+
+  // Push a node
+  // Thread safe - can be called from multiple threads concurrently
+  // Returns true if this was possibly the first node (may return true
+  // sporadically, will not return false sporadically)
+  bool Push(Node* node) { return queue_.Push(node); }
+
+  // Pop a node (returns NULL if no node is ready - which doesn't indicate that
+  // the queue is empty!!)
+  // Thread safe - can be called from multiple threads concurrently
+  Node* TryPop() {
+    if (mu_.TryLock()) {
+      Node* node = queue_.Pop();
+      mu_.Unlock();
+      return node;
+    }
+    return nullptr;
+  }
+
+  // Pop a node.  Returns NULL only if each shard was empty at some point
+  // after calling this function.  A node pushed concurrently may be missed,
+  // but then its Push() returns true.
+  Node* Pop() {
+    MutexLock lock(&mu_);
+    bool empty = false;
+    Node* node;
+    do {
+      node = queue_.PopAndCheckEnd(&empty);
+    } while (node == nullptr && !empty);
+    return node;
+  }
+
+ private:
+  ShardedMultiProducerSingleConsumerQueue queue_;
+  Mutex mu_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_GPRPP_SHARDED_MPSCQ_H
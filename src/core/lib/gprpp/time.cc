@@ -16,6 +16,15 @@
 
 #include "src/core/lib/gprpp/time.h"
 
+#if defined(GPR_LINUX) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__amd64__))
+// Timestamp::Now() reads the TSC when the CPU says it is invariant.
+#define GRPC_TSC_TIME_SOURCE 1
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <initializer_list>
@@ -37,6 +46,12 @@ namespace {
 
 std::atomic<int64_t> g_process_epoch_seconds;
 std::atomic<gpr_cycle_counter> g_process_epoch_cycles;
+#ifdef GRPC_TSC_TIME_SOURCE
+// The TSC when the process epoch was chosen, and the nanoseconds after the
+// epoch at which it was read.  The TSC frequency is measured from here.
+std::atomic<int64_t> g_process_epoch_tsc;
+std::atomic<int64_t> g_process_epoch_tsc_nanos;
+#endif
 
 class GprNowTimeSource final : public Timestamp::Source {
  public:
@@ -52,10 +67,18 @@ GPR_ATTRIBUTE_NOINLINE std::pair<int64_t, gpr_cycle_counter> InitTime() {
 
   // Check the current time... if we end up with zero, try again after 100ms.
   // If it doesn't advance after sleeping for 2100ms, crash the process.
+#ifdef GRPC_TSC_TIME_SOURCE
+  int64_t tsc = 0;
+  int32_t tsc_nanos = 0;
+#endif
   for (int i = 0; i < 21; i++) {
     cycles_start = gpr_get_cycle_counter();
     gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
     cycles_end = gpr_get_cycle_counter();
+#ifdef GRPC_TSC_TIME_SOURCE
+    tsc = static_cast<int64_t>(__rdtsc());
+    tsc_nanos = now.tv_nsec;
+#endif
     process_epoch_seconds = now.tv_sec;
     if (process_epoch_seconds > 1) {
       break;
@@ -83,6 +106,12 @@ GPR_ATTRIBUTE_NOINLINE std::pair<int64_t, gpr_cycle_counter> InitTime() {
           g_process_epoch_cycles.load(std::memory_order_relaxed);
     } while (process_epoch_cycles == 0);
   } else {
+#ifdef GRPC_TSC_TIME_SOURCE
+    // The epoch is one second before the monotonic clock was read.
+    g_process_epoch_tsc_nanos.store(GPR_NS_PER_SEC + tsc_nanos,
+                                    std::memory_order_relaxed);
+    g_process_epoch_tsc.store(tsc, std::memory_order_release);
+#endif
     g_process_epoch_cycles.store(process_epoch_cycles,
                                  std::memory_order_relaxed);
   }
@@ -147,10 +176,106 @@ int64_t TimespanToMillisRoundDown(gpr_timespec ts) {
   return static_cast<int64_t>(x);
 }
 
+#ifdef GRPC_TSC_TIME_SOURCE
+// TSC frequencies are only measured over at least this much time.
+constexpr int64_t kTscCalibrationNanos = 100 * GPR_NS_PER_MS;
+// How often each thread re-reads the monotonic clock.
+constexpr int64_t kTscResyncNanos = GPR_NS_PER_SEC;
+
+// An invariant TSC ticks at a constant rate in every power state, and is
+// kept in step across cores.
+bool HasInvariantTsc() {
+  unsigned int eax, ebx, ecx, edx;
+  if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) return false;
+  return (edx & (1u << 8)) != 0;
+}
+
+// Returns the TSC frequency, in cycles per nanosecond, or 0 if not enough
+// time has passed since the process epoch to measure it yet.  Measuring from
+// the epoch every time makes the estimate more precise as the process ages.
+double TscCyclesPerNano(int64_t tsc, int64_t nanos) {
+  const int64_t epoch_tsc = g_process_epoch_tsc.load(std::memory_order_acquire);
+  if (epoch_tsc == 0 || tsc <= epoch_tsc) return 0;
+  const int64_t elapsed_nanos =
+      nanos - g_process_epoch_tsc_nanos.load(std::memory_order_relaxed);
+  if (elapsed_nanos < kTscCalibrationNanos) return 0;
+  return static_cast<double>(tsc - epoch_tsc) /
+         static_cast<double>(elapsed_nanos);
+}
+
+// What a thread last read from the monotonic clock.
+struct TscSync {
+  int64_t tsc = 0;
+  int64_t nanos = 0;
+  double cycles_per_nano = 0;
+  // The TSC value after which to read the monotonic clock again.
+  int64_t resync_tsc = 0;
+  // The latest time returned on this thread.
+  int64_t millis = 0;
+};
+
+thread_local TscSync g_tsc_sync;
+
+// Extrapolates from the TSC between reads of gpr_now(GPR_CLOCK_MONOTONIC),
+// which each thread makes once every kTscResyncNanos.  Until the TSC
+// frequency is known, and whenever a test fakes gpr_now(), every call reads
+// gpr_now() instead.
+class TscTimeSource final : public Timestamp::Source {
+ public:
+  Timestamp Now() override {
+    TscSync& sync = g_tsc_sync;
+    if (GPR_UNLIKELY(!gpr_now_is_system_clock())) {
+      sync = TscSync();
+      return Timestamp::FromTimespecRoundDown(gpr_now(GPR_CLOCK_MONOTONIC));
+    }
+    const int64_t tsc = static_cast<int64_t>(__rdtsc());
+    int64_t nanos;
+    if (GPR_LIKELY(tsc >= sync.tsc && tsc < sync.resync_tsc)) {
+      nanos = sync.nanos + static_cast<int64_t>(
+                               static_cast<double>(tsc - sync.tsc) /
+                               sync.cycles_per_nano);
+    } else {
+      nanos = Resync(&sync);
+    }
+    // Don't step back across a resync that corrected for drift.
+    sync.millis = std::max(sync.millis, nanos / GPR_NS_PER_MS);
+    return Timestamp::FromMillisecondsAfterProcessEpoch(sync.millis);
+  }
+
+ private:
+  static int64_t Resync(TscSync* sync) {
+    const gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+    const int64_t tsc = static_cast<int64_t>(__rdtsc());
+    const gpr_timespec since_epoch = gpr_time_sub(now, StartTime());
+    const int64_t nanos =
+        since_epoch.tv_sec * GPR_NS_PER_SEC + since_epoch.tv_nsec;
+    sync->tsc = tsc;
+    sync->nanos = nanos;
+    sync->cycles_per_nano = TscCyclesPerNano(tsc, nanos);
+    sync->resync_tsc =
+        tsc + static_cast<int64_t>(kTscResyncNanos * sync->cycles_per_nano);
+    return nanos;
+  }
+};
+#endif  // GRPC_TSC_TIME_SOURCE
+
+Timestamp::Source* DefaultTimeSource() {
+#ifdef GRPC_TSC_TIME_SOURCE
+  static Timestamp::Source* const source =
+      HasInvariantTsc()
+          ? static_cast<Timestamp::Source*>(
+                NoDestructSingleton<TscTimeSource>::Get())
+          : NoDestructSingleton<GprNowTimeSource>::Get();
+  return source;
+#else
+  return NoDestructSingleton<GprNowTimeSource>::Get();
+#endif
+}
+
 }  // namespace
 
 thread_local Timestamp::Source* Timestamp::thread_local_time_source_{
-    NoDestructSingleton<GprNowTimeSource>::Get()};
+    DefaultTimeSource()};
 
 Timestamp ScopedTimeCache::Now() {
   if (!cached_time_.has_value()) {
@@ -225,6 +350,32 @@ Duration::operator grpc_event_engine::experimental::EventEngine::Duration()
             std::numeric_limits<int64_t>::max() / GPR_NS_PER_MS));
 }
 
+Duration TimerSlack(Duration timeout) {
+  return Clamp(timeout / 100, Duration::Zero(), Duration::Seconds(1));
+}
+
+Timestamp CoarseDeadline(Timestamp deadline, Duration slack) {
+  const int64_t millis = deadline.milliseconds_after_process_epoch();
+  const int64_t slack_millis = slack.millis();
+  if (slack_millis < 2 || millis < 0 ||
+      deadline == Timestamp::InfFuture()) {
+    return deadline;
+  }
+  // Buckets are a power of two milliseconds wide, so that timers with
+  // similar slack land on the same boundaries.
+  int64_t bucket = 1;
+  while (bucket <= slack_millis / 2) bucket *= 2;
+  if (millis > std::numeric_limits<int64_t>::max() - bucket) return deadline;
+  return Timestamp::FromMillisecondsAfterProcessEpoch((millis + bucket - 1) /
+                                                      bucket * bucket);
+}
+
+Duration CoarseTimeout(Duration timeout) {
+  if (timeout == Duration::Infinity()) return timeout;
+  const Timestamp now = Timestamp::Now();
+  return CoarseDeadline(now + timeout, TimerSlack(timeout)) - now;
+}
+
 void TestOnlySetProcessEpoch(gpr_timespec epoch) {
   g_process_epoch_seconds.store(
       gpr_convert_clock_type(epoch, GPR_CLOCK_MONOTONIC).tv_sec);
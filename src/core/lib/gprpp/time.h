@@ -356,6 +356,22 @@ inline Timestamp& Timestamp::operator+=(Duration duration) {
   return *this = (*this + duration);
 }
 
+// Timers that only need to fire roughly on time, such as RPC deadlines and
+// keepalive pings, can be given slack: time by which they may fire late.
+// Rounding their deadlines up to coarse buckets lets many of them share a
+// deadline, and so a timer wakeup.
+
+// The slack for a timer set \a timeout ahead: 1% of it, up to a second.
+Duration TimerSlack(Duration timeout);
+
+// Returns the time at or after \a deadline, and less than \a slack later,
+// at which timers with the same slack are bucketed.
+Timestamp CoarseDeadline(Timestamp deadline, Duration slack);
+
+// Returns \a timeout, stretched by up to TimerSlack(timeout) so that it ends
+// at a coarse deadline, for EventEngine::RunAfter().
+Duration CoarseTimeout(Duration timeout);
+
 void TestOnlySetProcessEpoch(gpr_timespec epoch);
 
 std::ostream& operator<<(std::ostream& out, Timestamp timestamp);
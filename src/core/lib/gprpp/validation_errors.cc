@@ -29,17 +29,44 @@ namespace grpc_core {
 void ValidationErrors::PushField(absl::string_view ext) {
   // Skip leading '.' for top-level field names.
   if (fields_.empty()) absl::ConsumePrefix(&ext, ".");
-  fields_.emplace_back(std::string(ext));
+  fields_.emplace_back();
+  fields_.back().owned = std::string(ext);
+}
+
+void ValidationErrors::PushField(absl::string_view prefix,
+                                 absl::string_view name,
+                                 absl::string_view suffix) {
+  // Skip leading '.' for top-level field names.
+  if (fields_.empty()) absl::ConsumePrefix(&prefix, ".");
+  fields_.emplace_back();
+  Field& field = fields_.back();
+  field.prefix = prefix;
+  field.name = name;
+  field.suffix = suffix;
 }
 
 void ValidationErrors::PopField() { fields_.pop_back(); }
 
+std::string ValidationErrors::CurrentField() const {
+  std::string name;
+  for (const Field& field : fields_) {
+    if (!field.owned.empty()) {
+      name.append(field.owned);
+    } else {
+      absl::StrAppend(&name, field.prefix, field.name, field.suffix);
+    }
+  }
+  return name;
+}
+
 void ValidationErrors::AddError(absl::string_view error) {
-  field_errors_[absl::StrJoin(fields_, "")].emplace_back(error);
+  field_errors_[CurrentField()].emplace_back(error);
 }
 
 bool ValidationErrors::FieldHasErrors() const {
-  return field_errors_.find(absl::StrJoin(fields_, "")) != field_errors_.end();
+  // Most validations succeed, so don't build the field name to find out.
+  if (field_errors_.empty()) return false;
+  return field_errors_.find(CurrentField()) != field_errors_.end();
 }
 
 absl::Status ValidationErrors::status(absl::string_view prefix) const {
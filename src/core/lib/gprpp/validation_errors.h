@@ -71,6 +71,17 @@ class ValidationErrors {
       errors_->PushField(field_name);
     }
 
+    // Like the above, for a field name made of prefix, name and suffix,
+    // without copying them: the caller must keep all three alive until
+    // the ScopedField is destroyed. The name is only put together if an
+    // error is reported for the field, so this is what the hot paths
+    // (such as the JSON object loader) use.
+    ScopedField(ValidationErrors* errors, absl::string_view prefix,
+                absl::string_view name, absl::string_view suffix = "")
+        : errors_(errors) {
+      errors_->PushField(prefix, name, suffix);
+    }
+
     // Not copyable.
     ScopedField(const ScopedField& other) = delete;
     ScopedField& operator=(const ScopedField& other) = delete;
@@ -108,10 +119,25 @@ class ValidationErrors {
   size_t size() const { return field_errors_.size(); }
 
  private:
+  // One level of the stack of field names.
+  struct Field {
+    // Set if the name was copied; otherwise the name is prefix, name and
+    // suffix concatenated.
+    std::string owned;
+    absl::string_view prefix;
+    absl::string_view name;
+    absl::string_view suffix;
+  };
+
   // Pushes a field name onto the stack.
   void PushField(absl::string_view ext) GPR_ATTRIBUTE_NOINLINE;
+  // Pushes a field name that is not copied onto the stack.
+  void PushField(absl::string_view prefix, absl::string_view name,
+                 absl::string_view suffix);
   // Pops a field name off of the stack.
   void PopField() GPR_ATTRIBUTE_NOINLINE;
+  // Returns the name of the field that we are currently validating.
+  std::string CurrentField() const;
 
   // Errors that we have encountered so far, keyed by field name.
   // TODO(roth): If we don't actually have any fields for which we
@@ -119,7 +145,7 @@ class ValidationErrors {
   std::map<std::string /*field_name*/, std::vector<std::string>> field_errors_;
   // Stack of field names indicating the field that we are currently
   // validating.
-  std::vector<std::string> fields_;
+  std::vector<Field> fields_;
 };
 
 }  // namespace grpc_core
@@ -67,7 +67,10 @@ class WorkSerializer::WorkSerializerImpl : public Orphanable {
   // that the queue size is also incremented as part of the fetch_add to allow
   // the callers to add a callback to the queue if another thread already holds
   // the lock to the work serializer.
-  void DrainQueueOwned();
+  //
+  // \a done is the number of callbacks the caller has run, or otherwise
+  // accounted for, that are still counted in the queue size.
+  void DrainQueueOwned(uint64_t done);
 
   // First 16 bits indicate ownership of the WorkSerializer, next 48 bits are
   // queue size (i.e., refs).
@@ -94,6 +97,24 @@ void WorkSerializer::WorkSerializerImpl::Run(std::function<void()> callback,
     gpr_log(GPR_INFO, "WorkSerializer::Run() %p Scheduling callback [%s:%d]",
             this, location.file(), location.line());
   }
+  // Fast path: if the WorkSerializer is idle with nothing queued, take
+  // ownership without counting the callback in the queue size, and give
+  // ownership back with a single compare-and-swap if nothing was queued
+  // while the callback ran.
+  uint64_t expected = MakeRefPair(0, 1);
+  if (refs_.compare_exchange_strong(expected, MakeRefPair(1, 1),
+                                    std::memory_order_acq_rel)) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
+      gpr_log(GPR_INFO, "  Executing immediately");
+    }
+    callback();
+    expected = MakeRefPair(1, 1);
+    if (!refs_.compare_exchange_strong(expected, MakeRefPair(0, 1),
+                                       std::memory_order_acq_rel)) {
+      DrainQueueOwned(0);
+    }
+    return;
+  }
   // Increment queue size for the new callback and owner count to attempt to
   // take ownership of the WorkSerializer.
   const uint64_t prev_ref_pair =
@@ -106,7 +127,7 @@ void WorkSerializer::WorkSerializerImpl::Run(std::function<void()> callback,
       gpr_log(GPR_INFO, "  Executing immediately");
     }
     callback();
-    DrainQueueOwned();
+    DrainQueueOwned(1);
   } else {
     // Another thread is holding the WorkSerializer, so decrement the ownership
     // count we just added and queue the callback.
@@ -159,7 +180,7 @@ void WorkSerializer::WorkSerializerImpl::DrainQueue() {
       refs_.fetch_add(MakeRefPair(1, 1), std::memory_order_acq_rel);
   if (GetOwners(prev_ref_pair) == 0) {
     // We took ownership of the WorkSerializer. Drain the queue.
-    DrainQueueOwned();
+    DrainQueueOwned(1);
   } else {
     // Another thread is holding the WorkSerializer, so decrement the ownership
     // count we just added and queue a no-op callback.
@@ -169,22 +190,23 @@ void WorkSerializer::WorkSerializerImpl::DrainQueue() {
   }
 }
 
-void WorkSerializer::WorkSerializerImpl::DrainQueueOwned() {
+void WorkSerializer::WorkSerializerImpl::DrainQueueOwned(uint64_t done) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
     gpr_log(GPR_INFO, "WorkSerializer::DrainQueueOwned() %p", this);
   }
   while (true) {
-    auto prev_ref_pair = refs_.fetch_sub(MakeRefPair(0, 1));
+    auto prev_ref_pair = refs_.fetch_sub(MakeRefPair(0, done));
+    uint64_t size = GetSize(prev_ref_pair) - done;
     // It is possible that while draining the queue, the last callback ended
     // up orphaning the work serializer. In that case, delete the object.
-    if (GetSize(prev_ref_pair) == 1) {
+    if (size == 0) {
       if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
         gpr_log(GPR_INFO, "  Queue Drained. Destroying");
       }
       delete this;
       return;
     }
-    if (GetSize(prev_ref_pair) == 2) {
+    if (size == 1) {
       // Queue drained. Give up ownership but only if queue remains empty.
       uint64_t expected = MakeRefPair(1, 1);
       if (refs_.compare_exchange_strong(expected, MakeRefPair(0, 1),
@@ -192,7 +214,8 @@ void WorkSerializer::WorkSerializerImpl::DrainQueueOwned() {
         // Queue is drained.
         return;
       }
-      if (GetSize(expected) == 0) {
+      size = GetSize(expected);
+      if (size == 0) {
         // WorkSerializer got orphaned while this was running
         if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
           gpr_log(GPR_INFO, "  Queue Drained. Destroying");
@@ -201,25 +224,30 @@ void WorkSerializer::WorkSerializerImpl::DrainQueueOwned() {
         return;
       }
     }
-    // There is at least one callback on the queue. Pop the callback from the
-    // queue and execute it.
-    CallbackWrapper* cb_wrapper = nullptr;
-    bool empty_unused;
-    while ((cb_wrapper = reinterpret_cast<CallbackWrapper*>(
-                queue_.PopAndCheckEnd(&empty_unused))) == nullptr) {
-      // This can happen due to a race condition within the mpscq
-      // implementation or because of a race with Run()/Schedule().
+    // At least size - 1 callbacks are on the queue, or about to be pushed
+    // to it; one more if the work serializer was orphaned. Run that many
+    // before updating the queue size again, so that callbacks queued from
+    // other threads are drained in batches.
+    done = size > 1 ? size - 1 : 1;
+    for (uint64_t i = 0; i < done; ++i) {
+      CallbackWrapper* cb_wrapper = nullptr;
+      bool empty_unused;
+      while ((cb_wrapper = reinterpret_cast<CallbackWrapper*>(
+                  queue_.PopAndCheckEnd(&empty_unused))) == nullptr) {
+        // This can happen due to a race condition within the mpscq
+        // implementation or because of a race with Run()/Schedule().
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
+          gpr_log(GPR_INFO, "  Queue returned nullptr, trying again");
+        }
+      }
       if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
-        gpr_log(GPR_INFO, "  Queue returned nullptr, trying again");
+        gpr_log(GPR_INFO, "  Running item %p : callback scheduled at [%s:%d]",
+                cb_wrapper, cb_wrapper->location.file(),
+                cb_wrapper->location.line());
       }
+      cb_wrapper->callback();
+      delete cb_wrapper;
     }
-    if (GRPC_TRACE_FLAG_ENABLED(grpc_work_serializer_trace)) {
-      gpr_log(GPR_INFO, "  Running item %p : callback scheduled at [%s:%d]",
-              cb_wrapper, cb_wrapper->location.file(),
-              cb_wrapper->location.line());
-    }
-    cb_wrapper->callback();
-    delete cb_wrapper;
   }
 }
 
@@ -48,6 +48,9 @@ class Combiner {
   // other bits - number of items queued on the lock (STATE_ELEM_COUNT_LOW_BIT)
   gpr_atm state;
   bool time_to_execute_final_list = false;
+  // closures this combiner may still run on the exec_ctx draining it once
+  // it is contended, before offloading (combiner_offload_budget experiment)
+  int closures_before_offload = 0;
   grpc_closure_list final_list;
   grpc_closure offload;
   gpr_refcount refs;
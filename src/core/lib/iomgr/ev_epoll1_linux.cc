@@ -47,6 +47,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/cpu.h>
 
+#include "src/core/lib/debug/event_ring.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/gpr/string.h"
@@ -728,6 +729,9 @@ static grpc_error_handle do_epoll_wait(grpc_pollset* ps,
 
   if (r < 0) return GRPC_OS_ERROR(errno, "epoll_wait");
 
+  grpc_core::EventRing::Record(grpc_core::EventRing::Event::kPollerWakeup,
+                               static_cast<uint64_t>(r));
+
   if (GRPC_TRACE_FLAG_ENABLED(grpc_polling_trace)) {
     gpr_log(GPR_INFO, "ps: %p poll got %d events", ps, r);
   }
@@ -22,6 +22,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <limits>
+#include <new>
 
 #include <grpc/impl/grpc_types.h>
 #include <grpc/support/atm.h>
@@ -29,6 +30,7 @@
 #include <grpc/support/log.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/event_engine/thread_local.h"
 #include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/debug_location.h"
@@ -95,6 +97,11 @@ class Combiner;
 ///               callbacks.
 ///
 class ExecCtx {
+ private:
+  // Passed by PassThroughExecCtx, which has already seen that there is no
+  // ExecCtx active.
+  struct NoneActive {};
+
  public:
   /// Default Constructor
 
@@ -103,6 +110,13 @@ class ExecCtx {
     Set(this);
   }
 
+  /// As the default constructor, without looking up the active ExecCtx again.
+  explicit ExecCtx(NoneActive)
+      : flags_(GRPC_EXEC_CTX_FLAG_IS_FINISHED), last_exec_ctx_(nullptr) {
+    Fork::IncExecCtxCount();
+    Set(this);
+  }
+
   /// Parameterised Constructor
   explicit ExecCtx(uintptr_t fl) : flags_(fl) {
     if (!(GRPC_EXEC_CTX_FLAG_IS_INTERNAL_THREAD & flags_)) {
@@ -126,6 +140,12 @@ class ExecCtx {
   ExecCtx& operator=(const ExecCtx&) = delete;
 
   unsigned starting_cpu() {
+    if (starting_cpu_ == std::numeric_limits<unsigned>::max()) {
+      // Threads pinned to a CPU set keep to the CPU they were placed on, so
+      // that their per-CPU shards stay local and do not follow migrations.
+      starting_cpu_ =
+          grpc_event_engine::experimental::ThreadLocal::StartingCpu();
+    }
     if (starting_cpu_ == std::numeric_limits<unsigned>::max()) {
       starting_cpu_ = gpr_cpu_current_cpu();
     }
@@ -201,6 +221,8 @@ class ExecCtx {
   static void operator delete(void* /* p */) { abort(); }
 
  private:
+  friend class PassThroughExecCtx;
+
   /// Set exec_ctx_ to exec_ctx.
   static void Set(ExecCtx* exec_ctx) { exec_ctx_ = exec_ctx; }
 
@@ -215,6 +237,32 @@ class ExecCtx {
   ExecCtx* last_exec_ctx_ = Get();
 };
 
+/// An ExecCtx for core entry points that may be reached with an ExecCtx
+/// already active on the thread: stage 1 of the TODO above.  A nested entry
+/// passes through to the active ExecCtx, costing one thread-local read, and
+/// the closures it schedules run when that ExecCtx is flushed.  With no
+/// ExecCtx active, it pushes one as ExecCtx does.
+/// Only use it where nothing after the entry point's return depends on the
+/// closures it scheduled having run.
+class PassThroughExecCtx {
+ public:
+  PassThroughExecCtx() : pushed_(ExecCtx::Get() == nullptr) {
+    if (pushed_) new (&exec_ctx_) ExecCtx(ExecCtx::NoneActive());
+  }
+  ~PassThroughExecCtx() {
+    if (pushed_) exec_ctx_.~ExecCtx();
+  }
+
+  PassThroughExecCtx(const PassThroughExecCtx&) = delete;
+  PassThroughExecCtx& operator=(const PassThroughExecCtx&) = delete;
+
+ private:
+  const bool pushed_;
+  union {
+    ExecCtx exec_ctx_;
+  };
+};
+
 /// Application-callback execution context.
 /// A bag of data that collects information along a callstack.
 /// It is created on the stack at core entry points, and stored internally
@@ -265,15 +313,14 @@ class ExecCtx {
 class ApplicationCallbackExecCtx {
  public:
   /// Default Constructor
-  ApplicationCallbackExecCtx() { Set(this, flags_); }
+  ApplicationCallbackExecCtx() : active_(Set(this, flags_)) {}
 
   /// Parameterised Constructor
-  explicit ApplicationCallbackExecCtx(uintptr_t fl) : flags_(fl) {
-    Set(this, flags_);
-  }
+  explicit ApplicationCallbackExecCtx(uintptr_t fl)
+      : flags_(fl), active_(Set(this, flags_)) {}
 
   ~ApplicationCallbackExecCtx() {
-    if (Get() == this) {
+    if (active_) {
       while (head_ != nullptr) {
         auto* f = head_;
         head_ = f->internal_next;
@@ -296,13 +343,15 @@ class ApplicationCallbackExecCtx {
 
   static ApplicationCallbackExecCtx* Get() { return callback_exec_ctx_; }
 
-  static void Set(ApplicationCallbackExecCtx* exec_ctx, uintptr_t flags) {
-    if (Get() == nullptr) {
-      if (!(GRPC_APP_CALLBACK_EXEC_CTX_FLAG_IS_INTERNAL_THREAD & flags)) {
-        Fork::IncExecCtxCount();
-      }
-      callback_exec_ctx_ = exec_ctx;
+  /// Makes exec_ctx the active one if there is none.  Returns true if it
+  /// did.
+  static bool Set(ApplicationCallbackExecCtx* exec_ctx, uintptr_t flags) {
+    if (Get() != nullptr) return false;
+    if (!(GRPC_APP_CALLBACK_EXEC_CTX_FLAG_IS_INTERNAL_THREAD & flags)) {
+      Fork::IncExecCtxCount();
     }
+    callback_exec_ctx_ = exec_ctx;
+    return true;
   }
 
   static void Enqueue(grpc_completion_queue_functor* functor, int is_success) {
@@ -324,6 +373,9 @@ class ApplicationCallbackExecCtx {
 
  private:
   uintptr_t flags_{0u};
+  // Whether this is the active ApplicationCallbackExecCtx: saves looking up
+  // the thread local again on destruction.
+  const bool active_;
   grpc_completion_queue_functor* head_{nullptr};
   grpc_completion_queue_functor* tail_{nullptr};
   static thread_local ApplicationCallbackExecCtx* callback_exec_ctx_;
@@ -72,6 +72,9 @@
 #if __GLIBC_PREREQ(2, 10)
 #define GRPC_LINUX_SOCKETUTILS 1
 #endif
+#if __GLIBC_PREREQ(2, 27)
+#define GRPC_LINUX_MEMFD 1
+#endif
 #if !(__GLIBC_PREREQ(2, 18))
 //
 // TCP_USER_TIMEOUT wasn't imported to glibc until 2.18. Use Linux system
@@ -89,6 +92,11 @@
 #ifndef GRPC_LINUX_EVENTFD
 #define GRPC_POSIX_NO_SPECIAL_WAKEUP_FD 1
 #endif
+#ifdef __has_include
+#if __has_include(<linux/io_uring.h>)
+#define GRPC_LINUX_IO_URING 1
+#endif
+#endif
 #ifndef GRPC_LINUX_SOCKETUTILS
 #define GRPC_POSIX_SOCKETUTILS
 #endif
@@ -30,6 +30,7 @@
 #else
 #include <netinet/tcp.h>
 #endif
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/socket.h>
@@ -61,4 +62,21 @@ const char* grpc_inet_ntop(int af, const void* src, char* dst, size_t size) {
   return inet_ntop(af, src, dst, static_cast<socklen_t>(size));
 }
 
+size_t grpc_socket_bytes_per_rtt(int fd) {
+#if defined(GPR_LINUX) && defined(TCP_INFO)
+  struct tcp_info info;
+  socklen_t len = sizeof(info);
+  if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &len) != 0 ||
+      len < offsetof(struct tcp_info, tcpi_snd_cwnd) +
+                sizeof(info.tcpi_snd_cwnd)) {
+    return 0;
+  }
+  // The congestion window is counted in segments.
+  return static_cast<size_t>(info.tcpi_snd_cwnd) * info.tcpi_snd_mss;
+#else
+  (void)fd;
+  return 0;
+#endif
+}
+
 #endif
@@ -44,4 +44,8 @@ int grpc_inet_pton(int af, const char* src, void* dst);
 // A wrapper for inet_ntop on POSIX systems and InetNtop on Windows systems
 const char* grpc_inet_ntop(int af, const void* src, char* dst, size_t size);
 
+// Returns how many bytes the TCP connection on \a fd can currently send per
+// round trip, from its congestion window, or 0 if that is unknown.
+size_t grpc_socket_bytes_per_rtt(int fd);
+
 #endif  // GRPC_SRC_CORE_LIB_IOMGR_SOCKET_UTILS_H
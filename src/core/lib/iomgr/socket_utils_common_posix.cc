@@ -210,6 +210,19 @@ grpc_error_handle grpc_set_socket_reuse_port(int fd, int reuse) {
 #endif
 }
 
+grpc_error_handle grpc_set_socket_incoming_cpu(int fd, int cpu) {
+#ifndef SO_INCOMING_CPU
+  (void)fd;
+  (void)cpu;
+  return GRPC_ERROR_CREATE("SO_INCOMING_CPU unavailable on compiling system");
+#else
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_INCOMING_CPU, &cpu, sizeof(cpu))) {
+    return GRPC_OS_ERROR(errno, "setsockopt(SO_INCOMING_CPU)");
+  }
+  return absl::OkStatus();
+#endif
+}
+
 static gpr_once g_probe_so_reuesport_once = GPR_ONCE_INIT;
 static int g_support_so_reuseport = false;
 
@@ -371,6 +384,41 @@ grpc_error_handle grpc_set_socket_tcp_user_timeout(
   return absl::OkStatus();
 }
 
+// Set TCP_NOTSENT_LOWAT
+void grpc_set_socket_tcp_notsent_lowat(
+    int fd, const grpc_core::PosixTcpOptions& options) {
+  // Use conditionally-important parameter to avoid warning
+  (void)fd;
+  if (options.tcp_notsent_lowat <= 0) return;
+#ifdef TCP_NOTSENT_LOWAT
+  if (0 != setsockopt(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT,
+                      &options.tcp_notsent_lowat,
+                      sizeof(options.tcp_notsent_lowat))) {
+    // Do not fail on failing to set TCP_NOTSENT_LOWAT
+    gpr_log(GPR_ERROR, "setsockopt(TCP_NOTSENT_LOWAT) %s",
+            grpc_core::StrError(errno).c_str());
+  }
+#endif
+}
+
+// Set TCP_FASTOPEN_CONNECT
+void grpc_set_socket_tcp_fast_open_connect(
+    int fd, const grpc_core::PosixTcpOptions& options) {
+  // Use conditionally-important parameter to avoid warning
+  (void)fd;
+  if (!options.tcp_fast_open_connect) return;
+#ifdef TCP_FASTOPEN_CONNECT
+  int val = 1;
+  if (0 != setsockopt(fd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &val,
+                      sizeof(val))) {
+    // Do not fail on failing to set TCP_FASTOPEN_CONNECT: the connection
+    // just takes the usual handshake.
+    gpr_log(GPR_ERROR, "setsockopt(TCP_FASTOPEN_CONNECT) %s",
+            grpc_core::StrError(errno).c_str());
+  }
+#endif
+}
+
 // set a socket using a grpc_socket_mutator
 grpc_error_handle grpc_set_socket_with_mutator(int fd, grpc_fd_usage usage,
                                                grpc_socket_mutator* mutator) {
@@ -80,6 +80,11 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_notsent_lowat =
+      AdjustValue(0, 0, INT_MAX, config.GetInt(GRPC_ARG_TCP_NOTSENT_LOWAT));
+  options.tcp_fast_open_connect =
+      (AdjustValue(0, 0, 1, config.GetInt(GRPC_ARG_TCP_FAST_OPEN_CONNECT)) !=
+       0);
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
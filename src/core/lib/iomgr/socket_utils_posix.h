@@ -55,6 +55,8 @@ struct PosixTcpOptions {
   int tcp_tx_zerocopy_send_bytes_threshold = kDefaultSendBytesThreshold;
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  int tcp_notsent_lowat = 0;
+  bool tcp_fast_open_connect = false;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
@@ -119,6 +121,8 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_notsent_lowat = other.tcp_notsent_lowat;
+    tcp_fast_open_connect = other.tcp_fast_open_connect;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
@@ -156,6 +160,10 @@ grpc_error_handle grpc_set_socket_low_latency(int fd, int low_latency);
 // set SO_REUSEPORT
 grpc_error_handle grpc_set_socket_reuse_port(int fd, int reuse);
 
+// set SO_INCOMING_CPU, which steers connections made to a SO_REUSEPORT group
+// of listening sockets to the one whose cpu handles them
+grpc_error_handle grpc_set_socket_incoming_cpu(int fd, int cpu);
+
 // Configure the default values for TCP_USER_TIMEOUT
 void config_default_tcp_user_timeout(bool enable, int timeout, bool is_client);
 
@@ -163,6 +171,14 @@ void config_default_tcp_user_timeout(bool enable, int timeout, bool is_client);
 grpc_error_handle grpc_set_socket_tcp_user_timeout(
     int fd, const grpc_core::PosixTcpOptions& options, bool is_client);
 
+// Set TCP_NOTSENT_LOWAT if requested in options and available
+void grpc_set_socket_tcp_notsent_lowat(
+    int fd, const grpc_core::PosixTcpOptions& options);
+
+// Set TCP_FASTOPEN_CONNECT if requested in options and available
+void grpc_set_socket_tcp_fast_open_connect(
+    int fd, const grpc_core::PosixTcpOptions& options);
+
 // Returns true if this system can create AF_INET6 sockets bound to ::1.
 // The value is probed once, and cached for the life of the process.
 
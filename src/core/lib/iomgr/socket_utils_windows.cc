@@ -45,4 +45,6 @@ const char* grpc_inet_ntop(int af, const void* src, char* dst, size_t size) {
   return InetNtopA(af, (void*)src, dst, size);
 }
 
+size_t grpc_socket_bytes_per_rtt(int /*fd*/) { return 0; }
+
 #endif  // GRPC_WINDOWS_SOCKETUTILS
@@ -69,6 +69,7 @@
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/trace.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/slice/slice_pool.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 
 #ifndef SOL_TCP
@@ -1048,6 +1049,8 @@ static void maybe_make_read_slices(grpc_tcp* tcp)
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(tcp->read_mu) {
   static const int kBigAlloc = 64 * 1024;
   static const int kSmallAlloc = 8 * 1024;
+  // The largest frame HTTP/2 allows.
+  static const int kMaxContiguousAlloc = 16 * 1024 * 1024;
   if (tcp->incoming_buffer->length <
       static_cast<size_t>(tcp->min_progress_size)) {
     size_t allocate_length = tcp->min_progress_size;
@@ -1056,6 +1059,20 @@ static void maybe_make_read_slices(grpc_tcp* tcp)
     // min_progress_size bytes to read, allocate a bit more.
     const bool low_memory_pressure =
         tcp->memory_owner.GetPressureInfo().pressure_control_value < 0.8;
+    // If the upper layer is waiting on a large frame, read its payload into
+    // one buffer of its size, in place of the spare space left over from the
+    // last read, so that the frame reaches the parser as a single slice.
+    if (low_memory_pressure &&
+        tcp->min_progress_size -
+                static_cast<int>(tcp->incoming_buffer->length) >
+            kBigAlloc) {
+      grpc_slice_buffer_reset_and_unref(tcp->incoming_buffer);
+      grpc_slice_buffer_add_indexed(
+          tcp->incoming_buffer,
+          grpc_core::PooledSliceMalloc(
+              std::min(tcp->min_progress_size, kMaxContiguousAlloc),
+              &tcp->memory_owner));
+    }
     if (low_memory_pressure && target_length > allocate_length) {
       allocate_length = target_length;
     }
@@ -1065,15 +1082,17 @@ static void maybe_make_read_slices(grpc_tcp* tcp)
         (low_memory_pressure ? kSmallAlloc * 3 / 2 : kBigAlloc)) {
       while (extra_wanted > 0) {
         extra_wanted -= kBigAlloc;
-        grpc_slice_buffer_add_indexed(tcp->incoming_buffer,
-                                      tcp->memory_owner.MakeSlice(kBigAlloc));
+        grpc_slice_buffer_add_indexed(
+            tcp->incoming_buffer,
+            grpc_core::PooledSliceMalloc(kBigAlloc, &tcp->memory_owner));
         grpc_core::global_stats().IncrementTcpReadAlloc64k();
       }
     } else {
       while (extra_wanted > 0) {
         extra_wanted -= kSmallAlloc;
-        grpc_slice_buffer_add_indexed(tcp->incoming_buffer,
-                                      tcp->memory_owner.MakeSlice(kSmallAlloc));
+        grpc_slice_buffer_add_indexed(
+            tcp->incoming_buffer,
+            grpc_core::PooledSliceMalloc(kSmallAlloc, &tcp->memory_owner));
         grpc_core::global_stats().IncrementTcpReadAlloc8k();
       }
     }
@@ -46,6 +46,7 @@
 #include <grpc/byte_buffer.h>
 #include <grpc/event_engine/endpoint_config.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
@@ -215,6 +216,10 @@ static grpc_error_handle tcp_server_create(grpc_closure* shutdown_complete,
   if (value.has_value()) {
     s->expand_wildcard_addrs = (*value != 0);
   }
+  value = config.GetInt(GRPC_ARG_TCP_LISTENERS_PER_PORT);
+  if (value.has_value() && *value > 0) {
+    s->listeners_per_port = *value;
+  }
   gpr_ref_init(&s->refs, 1);
   gpr_mu_init(&s->mu);
   s->active_ports = 0;
@@ -417,10 +422,15 @@ static void on_read(void* arg, grpc_error_handle err) {
     std::string name = absl::StrCat("tcp-server-connection:", addr_uri.value());
     grpc_fd* fdobj = grpc_fd_create(fd, name.c_str(), true);
 
-    read_notifier_pollset = (*(sp->server->pollsets))
-        [static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
-             &sp->server->next_pollset_to_assign, 1)) %
-         sp->server->pollsets->size()];
+    // Keep connections on the pollset of the listener that accepted them,
+    // which the kernel picked to spread connections over the pollsets.
+    read_notifier_pollset =
+        sp->pollset != nullptr
+            ? sp->pollset
+            : (*(sp->server->pollsets))
+                  [static_cast<size_t>(gpr_atm_no_barrier_fetch_add(
+                       &sp->server->next_pollset_to_assign, 1)) %
+                   sp->server->pollsets->size()];
 
     grpc_pollset_add_fd(read_notifier_pollset, fdobj);
 
@@ -557,6 +567,7 @@ static grpc_error_handle clone_port(grpc_tcp_listener* listener,
     sp->port = port;
     sp->port_index = listener->port_index;
     sp->fd_index = listener->fd_index + count - i;
+    sp->pollset = nullptr;
     GPR_ASSERT(sp->emfd);
     while (listener->server->tail->next != nullptr) {
       listener->server->tail = listener->server->tail->next;
@@ -730,14 +741,24 @@ static void tcp_server_start(grpc_tcp_server* s,
     gpr_mu_unlock(&s->mu);
     return;
   }
+  const size_t listeners_per_port = s->listeners_per_port > 0
+                                        ? static_cast<size_t>(
+                                              s->listeners_per_port)
+                                        : pollsets->size();
+  const int num_cpus = static_cast<int>(gpr_cpu_num_cores());
   sp = s->head;
   while (sp != nullptr) {
     if (s->so_reuseport && !grpc_is_unix_socket(&sp->addr) &&
-        pollsets->size() > 1) {
+        listeners_per_port > 1) {
       GPR_ASSERT(GRPC_LOG_IF_ERROR(
-          "clone_port", clone_port(sp, (unsigned)(pollsets->size() - 1))));
-      for (i = 0; i < pollsets->size(); i++) {
-        grpc_pollset_add_fd((*pollsets)[i], sp->emfd);
+          "clone_port", clone_port(sp, (unsigned)(listeners_per_port - 1))));
+      for (i = 0; i < listeners_per_port; i++) {
+        // Steering is best effort: without it the kernel still spreads
+        // connections across the listeners, just not by CPU.
+        (void)grpc_set_socket_incoming_cpu(sp->fd,
+                                           static_cast<int>(i) % num_cpus);
+        sp->pollset = (*pollsets)[i % pollsets->size()];
+        grpc_pollset_add_fd(sp->pollset, sp->emfd);
         GRPC_CLOSURE_INIT(&sp->read_closure, on_read, sp,
                           grpc_schedule_on_exec_ctx);
         grpc_fd_notify_on_read(sp->emfd, &sp->read_closure);
@@ -745,6 +766,7 @@ static void tcp_server_start(grpc_tcp_server* s,
         sp = sp->next;
       }
     } else {
+      sp->pollset = nullptr;
       for (i = 0; i < pollsets->size(); i++) {
         grpc_pollset_add_fd((*pollsets)[i], sp->emfd);
       }
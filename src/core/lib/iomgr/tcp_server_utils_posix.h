@@ -43,6 +43,9 @@ typedef struct grpc_tcp_listener {
   unsigned fd_index;
   grpc_closure read_closure;
   grpc_closure destroyed_closure;
+  // The only pollset polling this listener, which then also polls the
+  // connections it accepts; null if all of the server's pollsets poll it.
+  grpc_pollset* pollset;
   struct grpc_tcp_listener* next;
   // sibling is a linked list of all listeners for a given port. add_port and
   // clone_port place all new listeners in the same sibling list. A member of
@@ -74,6 +77,9 @@ struct grpc_tcp_server {
   bool shutdown_listeners = false;
   // use SO_REUSEPORT
   bool so_reuseport = false;
+  // number of SO_REUSEPORT listeners to open per port, or 0 for one per
+  // pollset
+  int listeners_per_port = 0;
   // expand wildcard addresses to a list of all local addresses
   bool expand_wildcard_addrs = false;
 
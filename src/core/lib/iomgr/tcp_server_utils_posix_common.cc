@@ -122,6 +122,7 @@ static grpc_error_handle add_socket_to_server(grpc_tcp_server* s, int fd,
   sp->port = port;
   sp->port_index = port_index;
   sp->fd_index = fd_index;
+  sp->pollset = nullptr;
   sp->is_sibling = 0;
   sp->sibling = nullptr;
   GPR_ASSERT(sp->emfd);
@@ -214,6 +215,8 @@ grpc_error_handle grpc_tcp_server_prepare_socket(
     err =
         grpc_set_socket_tcp_user_timeout(fd, s->options, false /* is_client */);
     if (!err.ok()) goto error;
+    // Accepted connections inherit TCP_NOTSENT_LOWAT from the listener.
+    grpc_set_socket_tcp_notsent_lowat(fd, s->options);
   }
   err = grpc_set_socket_no_sigpipe_if_possible(fd);
   if (!err.ok()) goto error;
@@ -30,6 +30,7 @@
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/debug/event_ring.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/gpr/useful.h"
@@ -547,6 +548,10 @@ static size_t pop_timers(timer_shard* shard, grpc_core::Timestamp now,
   gpr_mu_lock(&shard->mu);
   while ((timer = pop_one(shard, now))) {
     REMOVE_FROM_HASH_TABLE(timer);
+    const int64_t late_ms =
+        now.milliseconds_after_process_epoch() - timer->deadline;
+    grpc_core::EventRing::Record(grpc_core::EventRing::Event::kTimerFire,
+                                 late_ms > 0 ? late_ms : 0);
     grpc_core::ExecCtx::Run(DEBUG_LOCATION, timer->closure, error);
     n++;
   }
@@ -161,8 +161,7 @@ void LoadMap::LoadInto(const Json& json, const JsonArgs& args, void* dst,
   }
   const LoaderInterface* element_loader = ElementLoader();
   for (const auto& pair : json.object_value()) {
-    ValidationErrors::ScopedField field(errors,
-                                        absl::StrCat("[\"", pair.first, "\"]"));
+    ValidationErrors::ScopedField field(errors, "[\"", pair.first, "\"]");
     void* element = Insert(pair.first, dst);
     element_loader->LoadInto(pair.second, args, element, errors);
   }
@@ -188,8 +187,7 @@ bool LoadObject(const Json& json, const JsonArgs& args, const Element* elements,
     if (element.enable_key != nullptr && !args.IsEnabled(element.enable_key)) {
       continue;
     }
-    ValidationErrors::ScopedField field(errors,
-                                        absl::StrCat(".", element.name));
+    ValidationErrors::ScopedField field(errors, ".", element.name);
     const auto& it = json.object_value().find(element.name);
     if (it == json.object_value().end()) {
       if (element.optional) continue;
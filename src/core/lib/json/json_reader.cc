@@ -18,6 +18,7 @@
 
 #include <inttypes.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <algorithm>
 #include <initializer_list>
@@ -45,6 +46,28 @@ namespace grpc_core {
 
 namespace {
 
+// Returns whether a byte can be copied into a string as is: printable
+// ASCII other than the quote and the backslash.
+inline bool IsPlainStringByte(uint8_t c) {
+  return c >= 0x20 && c < 0x80 && c != '"' && c != '\\';
+}
+
+// Returns whether any of the eight bytes of w is not a plain string byte,
+// using the usual bit tricks to test all of them at once.
+inline bool HasNonPlainStringByte(uint64_t w) {
+  constexpr uint64_t kOnes = 0x0101010101010101;
+  constexpr uint64_t kHighBits = 0x8080808080808080;
+  auto has_zero_byte = [](uint64_t v) {
+    return ((v - kOnes) & ~v & kHighBits) != 0;
+  };
+  return (w & kHighBits) != 0 || ((w - kOnes * 0x20) & ~w & kHighBits) != 0 ||
+         has_zero_byte(w ^ (kOnes * '"')) || has_zero_byte(w ^ (kOnes * '\\'));
+}
+
+inline bool IsWhitespace(uint8_t c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
 class JsonReader {
  public:
   static absl::StatusOr<Json> Parse(absl::string_view input);
@@ -100,6 +123,9 @@ class JsonReader {
 
   Status Run();
   uint32_t ReadChar();
+  // Fast paths for runs of input that need no state change.
+  void ReadPlainStringBytes();
+  void SkipWhitespace();
   bool IsComplete();
 
   size_t CurrentIndex() const { return input_ - original_input_ - 1; }
@@ -228,6 +254,27 @@ uint32_t JsonReader::ReadChar() {
   return r;
 }
 
+void JsonReader::ReadPlainStringBytes() {
+  size_t n = 0;
+  while (n + sizeof(uint64_t) <= remaining_input_) {
+    uint64_t w;
+    memcpy(&w, input_ + n, sizeof(w));
+    if (HasNonPlainStringByte(w)) break;
+    n += sizeof(w);
+  }
+  while (n < remaining_input_ && IsPlainStringByte(input_[n])) ++n;
+  string_.append(reinterpret_cast<const char*>(input_), n);
+  input_ += n;
+  remaining_input_ -= n;
+}
+
+void JsonReader::SkipWhitespace() {
+  while (remaining_input_ > 0 && IsWhitespace(*input_)) {
+    ++input_;
+    --remaining_input_;
+  }
+}
+
 Json* JsonReader::CreateAndLinkValue() {
   Json* value;
   if (stack_.empty()) {
@@ -329,6 +376,28 @@ JsonReader::Status JsonReader::Run() {
 
   // This state-machine is a strict implementation of ECMA-404
   while (true) {
+    // Most of the input is either string contents without escapes or
+    // whitespace between tokens, which the state machine would only
+    // copy or skip one byte at a time.
+    switch (state_) {
+      case State::GRPC_JSON_STATE_OBJECT_KEY_STRING:
+      case State::GRPC_JSON_STATE_VALUE_STRING:
+        if (unicode_high_surrogate_ == 0 && utf8_bytes_remaining_ == 0) {
+          ReadPlainStringBytes();
+        }
+        break;
+
+      case State::GRPC_JSON_STATE_OBJECT_KEY_BEGIN:
+      case State::GRPC_JSON_STATE_OBJECT_KEY_END:
+      case State::GRPC_JSON_STATE_VALUE_BEGIN:
+      case State::GRPC_JSON_STATE_VALUE_END:
+      case State::GRPC_JSON_STATE_END:
+        SkipWhitespace();
+        break;
+
+      default:
+        break;
+    }
     c = ReadChar();
     switch (c) {
       // Let's process the error case first.
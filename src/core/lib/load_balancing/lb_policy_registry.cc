@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <initializer_list>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -46,12 +47,25 @@ void LoadBalancingPolicyRegistry::Builder::RegisterLoadBalancingPolicyFactory(
   gpr_log(GPR_DEBUG, "registering LB policy factory for \"%s\"",
           std::string(factory->name()).c_str());
   GPR_ASSERT(factories_.find(factory->name()) == factories_.end());
+  GPR_ASSERT(lazy_factories_.find(factory->name()) == lazy_factories_.end());
   factories_.emplace(factory->name(), std::move(factory));
 }
 
+void LoadBalancingPolicyRegistry::Builder::
+    RegisterLazyLoadBalancingPolicyFactory(
+        absl::string_view name,
+        std::unique_ptr<LoadBalancingPolicyFactory> (*create)()) {
+  GPR_ASSERT(factories_.find(name) == factories_.end());
+  GPR_ASSERT(lazy_factories_.find(name) == lazy_factories_.end());
+  auto lazy_factory = std::make_unique<LazyFactory>();
+  lazy_factory->create = create;
+  lazy_factories_.emplace(name, std::move(lazy_factory));
+}
+
 LoadBalancingPolicyRegistry LoadBalancingPolicyRegistry::Builder::Build() {
   LoadBalancingPolicyRegistry out;
   out.factories_ = std::move(factories_);
+  out.lazy_factories_ = std::move(lazy_factories_);
   return out;
 }
 
@@ -63,8 +77,17 @@ LoadBalancingPolicyFactory*
 LoadBalancingPolicyRegistry::GetLoadBalancingPolicyFactory(
     absl::string_view name) const {
   auto it = factories_.find(name);
-  if (it == factories_.end()) return nullptr;
-  return it->second.get();
+  if (it != factories_.end()) return it->second.get();
+  auto lazy_it = lazy_factories_.find(name);
+  if (lazy_it == lazy_factories_.end()) return nullptr;
+  Builder::LazyFactory* lazy_factory = lazy_it->second.get();
+  absl::call_once(lazy_factory->once, [lazy_factory, name]() {
+    gpr_log(GPR_DEBUG, "constructing LB policy factory for \"%s\"",
+            std::string(name).c_str());
+    lazy_factory->factory = lazy_factory->create();
+    GPR_ASSERT(lazy_factory->factory->name() == name);
+  });
+  return lazy_factory->factory.get();
 }
 
 OrphanablePtr<LoadBalancingPolicy>
@@ -22,6 +22,7 @@
 #include <map>
 #include <memory>
 
+#include "absl/base/call_once.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 
@@ -45,11 +46,27 @@ class LoadBalancingPolicyRegistry {
     void RegisterLoadBalancingPolicyFactory(
         std::unique_ptr<LoadBalancingPolicyFactory> factory);
 
+    /// Registers an LB policy factory that is only constructed the first time
+    /// the policy named \a name is looked up, for policies that few channels
+    /// use. \a name must have static storage duration, and must match the
+    /// name of the factory that \a create returns.
+    void RegisterLazyLoadBalancingPolicyFactory(
+        absl::string_view name,
+        std::unique_ptr<LoadBalancingPolicyFactory> (*create)());
+
     LoadBalancingPolicyRegistry Build();
 
    private:
+    friend class LoadBalancingPolicyRegistry;
+    struct LazyFactory {
+      std::unique_ptr<LoadBalancingPolicyFactory> (*create)();
+      absl::once_flag once;
+      std::unique_ptr<LoadBalancingPolicyFactory> factory;
+    };
+
     std::map<absl::string_view, std::unique_ptr<LoadBalancingPolicyFactory>>
         factories_;
+    std::map<absl::string_view, std::unique_ptr<LazyFactory>> lazy_factories_;
   };
 
   /// Creates an LB policy of the type specified by \a name.
@@ -75,6 +92,8 @@ class LoadBalancingPolicyRegistry {
 
   std::map<absl::string_view, std::unique_ptr<LoadBalancingPolicyFactory>>
       factories_;
+  std::map<absl::string_view, std::unique_ptr<Builder::LazyFactory>>
+      lazy_factories_;
 };
 
 }  // namespace grpc_core
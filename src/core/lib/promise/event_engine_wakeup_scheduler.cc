@@ -0,0 +1,63 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/promise/event_engine_wakeup_scheduler.h"
+
+namespace grpc_core {
+namespace promise_detail {
+
+thread_local WakeupBatch* WakeupBatch::current_{nullptr};
+
+WakeupBatch::WakeupBatch(
+    grpc_event_engine::experimental::EventEngine* event_engine)
+    : event_engine_(event_engine), previous_(current_) {
+  current_ = this;
+}
+
+WakeupBatch::~WakeupBatch() {
+  // Wakeups run here may queue more wakeups, which count against the same
+  // budget.
+  for (size_t i = 0; i < kMaxBatchSize && head_ != nullptr; ++i) {
+    Pop()->RunBatchedWakeup();
+  }
+  current_ = previous_;
+  while (head_ != nullptr) event_engine_->Run(Pop());
+}
+
+bool WakeupBatch::Enqueue(
+    grpc_event_engine::experimental::EventEngine* event_engine,
+    BatchedWakeup* wakeup) {
+  WakeupBatch* batch = current_;
+  if (batch == nullptr || batch->event_engine_ != event_engine) return false;
+  if (batch->tail_ == nullptr) {
+    batch->head_ = wakeup;
+  } else {
+    batch->tail_->next_ = wakeup;
+  }
+  batch->tail_ = wakeup;
+  return true;
+}
+
+BatchedWakeup* WakeupBatch::Pop() {
+  BatchedWakeup* wakeup = head_;
+  head_ = wakeup->next_;
+  if (head_ == nullptr) tail_ = nullptr;
+  wakeup->next_ = nullptr;
+  return wakeup;
+}
+
+}  // namespace promise_detail
+}  // namespace grpc_core
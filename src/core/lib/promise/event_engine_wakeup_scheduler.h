@@ -17,6 +17,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
 #include <memory>
 #include <utility>
 
@@ -58,6 +60,103 @@ class EventEngineWakeupScheduler {
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
 };
 
+namespace promise_detail {
+
+// A wakeup that can be queued on the run queue of an EventEngine thread.
+class BatchedWakeup
+    : public grpc_event_engine::experimental::EventEngine::Closure {
+ public:
+  // Runs the wakeup on the current thread.
+  virtual void RunBatchedWakeup() = 0;
+
+ protected:
+  ~BatchedWakeup() = default;
+
+ private:
+  friend class WakeupBatch;
+  BatchedWakeup* next_ = nullptr;
+};
+
+// The run queue of an EventEngine thread while it runs a wakeup scheduled by
+// BatchingEventEngineWakeupScheduler. Wakeups scheduled meanwhile, for the same
+// event engine, are queued here instead of being handed to the event engine,
+// and are run back to back when the batch goes out of scope.
+class WakeupBatch {
+ public:
+  // The maximum number of queued wakeups a batch runs. Past that, the rest
+  // are handed back to the event engine, so that other work on the thread
+  // (and other threads) gets a chance to run.
+  static constexpr size_t kMaxBatchSize = 64;
+
+  explicit WakeupBatch(
+      grpc_event_engine::experimental::EventEngine* event_engine);
+  ~WakeupBatch();
+
+  WakeupBatch(const WakeupBatch&) = delete;
+  WakeupBatch& operator=(const WakeupBatch&) = delete;
+
+  // Queues |wakeup| on the batch of the current thread. Returns false if
+  // there is no such batch for |event_engine|.
+  static bool Enqueue(
+      grpc_event_engine::experimental::EventEngine* event_engine,
+      BatchedWakeup* wakeup);
+
+ private:
+  BatchedWakeup* Pop();
+
+  static thread_local WakeupBatch* current_;
+
+  grpc_event_engine::experimental::EventEngine* const event_engine_;
+  WakeupBatch* const previous_;
+  BatchedWakeup* head_ = nullptr;
+  BatchedWakeup* tail_ = nullptr;
+};
+
+}  // namespace promise_detail
+
+// Like EventEngineWakeupScheduler, but wakeups scheduled from a thread that is
+// already running a wakeup of this scheduler are queued on that thread and
+// run right after it, instead of each costing one event engine callback. Up
+// to WakeupBatch::kMaxBatchSize wakeups are run back to back that way.
+class BatchingEventEngineWakeupScheduler {
+ public:
+  explicit BatchingEventEngineWakeupScheduler(
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine)
+      : event_engine_(std::move(event_engine)) {}
+
+  template <typename ActivityType>
+  class BoundScheduler : public promise_detail::BatchedWakeup {
+   protected:
+    explicit BoundScheduler(BatchingEventEngineWakeupScheduler scheduler)
+        : event_engine_(std::move(scheduler.event_engine_)) {}
+    BoundScheduler(const BoundScheduler&) = delete;
+    BoundScheduler& operator=(const BoundScheduler&) = delete;
+    void ScheduleWakeup() {
+      if (!promise_detail::WakeupBatch::Enqueue(event_engine_.get(), this)) {
+        event_engine_->Run(this);
+      }
+    }
+    void Run() final {
+      ApplicationCallbackExecCtx app_exec_ctx;
+      ExecCtx exec_ctx;
+      // The activity may be gone once it ran, so the batch must not refer to
+      // it afterwards.
+      promise_detail::WakeupBatch batch(event_engine_.get());
+      RunBatchedWakeup();
+    }
+    void RunBatchedWakeup() final {
+      static_cast<ActivityType*>(this)->RunScheduledWakeup();
+    }
+
+   private:
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
+  };
+
+ private:
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_LIB_PROMISE_EVENT_ENGINE_WAKEUP_SCHEDULER_H
@@ -23,6 +23,7 @@
 #include <new>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
@@ -187,6 +188,50 @@ class InterceptorList {
     bool is_immediately_resolved_;
   };
 
+  // The result of RunBatch: a promise that runs the entire chain over each
+  // value of a batch in turn.
+  // Resolves to the transformed batch, or to nullopt if any value terminated
+  // the chain.
+  class RunBatchPromise {
+   public:
+    RunBatchPromise(InterceptorList* list, std::vector<T> batch)
+        : list_(list), input_(std::move(batch)) {
+      if (list_->first_map_ != nullptr) output_.reserve(input_.size());
+    }
+
+    RunBatchPromise(const RunBatchPromise&) = delete;
+    RunBatchPromise& operator=(const RunBatchPromise&) = delete;
+    RunBatchPromise(RunBatchPromise&& other) noexcept = default;
+    RunBatchPromise& operator=(RunBatchPromise&& other) noexcept = delete;
+
+    Poll<absl::optional<std::vector<T>>> operator()() {
+      // With no maps installed the batch passes through untouched.
+      if (list_->first_map_ == nullptr) return std::move(input_);
+      while (true) {
+        if (!current_.has_value()) {
+          if (next_ == input_.size()) return std::move(output_);
+          current_.emplace(list_->Run(std::move(input_[next_])));
+          ++next_;
+        }
+        auto r = (*current_)();
+        auto* p = absl::get_if<kPollReadyIdx>(&r);
+        if (p == nullptr) return Pending{};
+        current_.reset();
+        if (!p->has_value()) return absl::nullopt;
+        output_.push_back(std::move(**p));
+      }
+    }
+
+   private:
+    InterceptorList* list_;
+    // Values still to be run through the chain start at input_[next_].
+    std::vector<T> input_;
+    size_t next_ = 0;
+    std::vector<T> output_;
+    // The chain running over input_[next_ - 1], if any.
+    absl::optional<RunPromise> current_;
+  };
+
   InterceptorList() = default;
   InterceptorList(const InterceptorList&) = delete;
   InterceptorList& operator=(const InterceptorList&) = delete;
@@ -197,6 +242,12 @@ class InterceptorList {
                       std::move(initial_value));
   }
 
+  // Run the chain over each value of batch in order.
+  // The list must outlive the returned promise.
+  RunBatchPromise RunBatch(std::vector<T> batch) {
+    return RunBatchPromise(this, std::move(batch));
+  }
+
   // Append a new map to the end of the chain.
   template <typename Fn>
   void AppendMap(Fn fn, DebugLocation from) {
@@ -284,8 +284,8 @@ size_t Party::SituateNewParticipant(Arena::PoolPtr<Participant> participant) {
 
 void Party::ScheduleWakeup(uint64_t participant_index) {
   // Or in the wakeup bit for the participant, AND the locked bit.
-  uint64_t prev_state = state_.fetch_or((1 << participant_index) | kLocked,
-                                        std::memory_order_acquire);
+  uint64_t prev_state = state_.fetch_or(
+      (uint64_t{1} << participant_index) | kLocked, std::memory_order_acquire);
   if (grpc_trace_promise_primitives.enabled()) {
     gpr_log(GPR_DEBUG, "Party::ScheduleWakeup(%" PRIu64 "): prev_state=%s",
             participant_index, StateToString(prev_state).c_str());
@@ -295,6 +295,25 @@ void Party::ScheduleWakeup(uint64_t participant_index) {
 }
 
 void Party::Wakeup(void* arg) {
+  const uint64_t wakeup = uint64_t{1} << reinterpret_cast<uintptr_t>(arg);
+  uint64_t prev_state = state_.load(std::memory_order_relaxed);
+  // If another thread is running the party, or in the wakeup bit and drop the
+  // ref we were handed in a single operation: the running thread will poll the
+  // participant before it unlocks. This keeps cross-thread wakeups to one
+  // atomic operation. The ref must not be the last one though, as only Unref()
+  // may delete the party.
+  while ((prev_state & kLocked) != 0 && (prev_state & kRefMask) > kOneRef) {
+    if (state_.compare_exchange_weak(prev_state, (prev_state | wakeup) - kOneRef,
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_relaxed)) {
+      if (grpc_trace_promise_primitives.enabled()) {
+        gpr_log(GPR_DEBUG, "Party::Wakeup(%" PRIuPTR "): handed off, state=%s",
+                reinterpret_cast<uintptr_t>(arg),
+                StateToString(prev_state).c_str());
+      }
+      return;
+    }
+  }
   ScheduleWakeup(reinterpret_cast<uintptr_t>(arg));
   Unref();
 }
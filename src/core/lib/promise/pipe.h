@@ -17,6 +17,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -24,6 +25,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/strings/str_cat.h"
@@ -56,6 +58,9 @@ class Center;
 template <typename T>
 struct Pipe;
 
+template <typename T, size_t kCapacity = 16>
+struct BatchPipe;
+
 // Result of Pipe::Next - represents a received value.
 // If has_value() is false, the pipe was closed by the time we polled for the
 // next value. No value was received, nor will there ever be.
@@ -603,6 +608,332 @@ struct Pipe {
       : sender(center), receiver(center) {}
 };
 
+
+namespace pipe_detail {
+
+template <typename T, size_t kCapacity>
+class BatchPush;
+template <typename T, size_t kCapacity>
+class BatchNext;
+
+// BatchCenter sits between a sender and a receiver to provide a bounded ring
+// buffer of up to kCapacity Ts.
+// Unlike Center, a push completes as soon as its value is queued, and the
+// receiver takes every queued value at once. The receiver is only woken when
+// the buffer goes from empty to non-empty, and the sender only when it goes
+// from full to non-full, so a burst of messages costs one wakeup each way.
+template <typename T, size_t kCapacity>
+class BatchCenter : public InterceptorList<T> {
+ public:
+  static_assert(kCapacity > 0, "BatchPipe needs room for one value");
+
+  // Initialize with one send ref (held by BatchPipeSender) and one recv ref
+  // (held by BatchPipeReceiver)
+  BatchCenter() = default;
+
+  // Add one ref to this object, and return this.
+  void IncrementRefCount() {
+    refs_++;
+    GPR_DEBUG_ASSERT(refs_ != 0);
+  }
+
+  RefCountedPtr<BatchCenter> Ref() {
+    IncrementRefCount();
+    return RefCountedPtr<BatchCenter>(this);
+  }
+
+  // Drop a ref
+  // If no refs remain, destroy this object
+  void Unref() {
+    GPR_DEBUG_ASSERT(refs_ > 0);
+    refs_--;
+    if (0 == refs_) {
+      this->~BatchCenter();
+    }
+  }
+
+  // Try to queue *value into the pipe.
+  // Return Pending if the buffer is full.
+  // Return true if the value was queued.
+  // Return false if either end is closed.
+  Poll<bool> Push(T* value) {
+    if (grpc_trace_promise_primitives.enabled()) {
+      gpr_log(GPR_INFO, "%s", DebugOpString("Push").c_str());
+    }
+    GPR_DEBUG_ASSERT(refs_ != 0);
+    if (state_ != State::kOpen) return false;
+    if (size_ == kCapacity) return on_not_full_.pending();
+    values_[(head_ + size_) % kCapacity] = std::move(*value);
+    if (size_++ == 0) on_not_empty_.Wake();
+    return true;
+  }
+
+  // Try to receive every queued value from the pipe.
+  // Return Pending if there is no value.
+  // Return the values, oldest first, if any were queued.
+  // Return nullopt if the pipe is closed and drained, or cancelled.
+  Poll<absl::optional<std::vector<T>>> Next() {
+    if (grpc_trace_promise_primitives.enabled()) {
+      gpr_log(GPR_INFO, "%s", DebugOpString("Next").c_str());
+    }
+    GPR_DEBUG_ASSERT(refs_ != 0);
+    if (state_ == State::kCancelled) return absl::nullopt;
+    if (size_ == 0) {
+      if (state_ == State::kClosed) {
+        this->ResetInterceptorList();
+        return absl::nullopt;
+      }
+      return on_not_empty_.pending();
+    }
+    std::vector<T> batch;
+    batch.reserve(size_);
+    for (; size_ != 0; --size_, head_ = (head_ + 1) % kCapacity) {
+      batch.push_back(std::move(values_[head_]));
+    }
+    head_ = 0;
+    on_not_full_.Wake();
+    return std::move(batch);
+  }
+
+  // Values still queued when the sender closes are delivered before the
+  // receiver sees the close.
+  void MarkClosed() {
+    if (grpc_trace_promise_primitives.enabled()) {
+      gpr_log(GPR_INFO, "%s", DebugOpString("MarkClosed").c_str());
+    }
+    if (state_ != State::kOpen) return;
+    state_ = State::kClosed;
+    on_not_empty_.Wake();
+    on_not_full_.Wake();
+  }
+
+  void MarkCancelled() {
+    if (grpc_trace_promise_primitives.enabled()) {
+      gpr_log(GPR_INFO, "%s", DebugOpString("MarkCancelled").c_str());
+    }
+    if (state_ == State::kCancelled) return;
+    this->ResetInterceptorList();
+    state_ = State::kCancelled;
+    size_ = 0;
+    on_not_empty_.Wake();
+    on_not_full_.Wake();
+  }
+
+  bool cancelled() const { return state_ == State::kCancelled; }
+
+  std::string DebugTag() {
+    if (auto* activity = Activity::current()) {
+      return absl::StrCat(activity->DebugTag(), " BATCH_PIPE[0x",
+                          reinterpret_cast<uintptr_t>(this), "]: ");
+    } else {
+      return absl::StrCat("BATCH_PIPE[0x", reinterpret_cast<uintptr_t>(this),
+                          "]: ");
+    }
+  }
+
+ private:
+  enum class State : uint8_t {
+    // Values can be sent and received.
+    kOpen,
+    // Pipe is closed successfully, no more values can be sent
+    // (but queued values can still be received)
+    kClosed,
+    // Pipe is closed unsuccessfully, queued values are dropped
+    kCancelled,
+  };
+
+  std::string DebugOpString(std::string op) {
+    return absl::StrCat(DebugTag(), op, " refs=", refs_,
+                        " state=", static_cast<int>(state_), " size=", size_,
+                        " on_not_empty=", on_not_empty_.DebugString(),
+                        " on_not_full=", on_not_full_.DebugString());
+  }
+
+  T values_[kCapacity];
+  // Index of the oldest queued value.
+  size_t head_ = 0;
+  // Number of queued values.
+  size_t size_ = 0;
+  // Number of refs
+  uint8_t refs_ = 2;
+  State state_ = State::kOpen;
+  IntraActivityWaiter on_not_empty_;
+  IntraActivityWaiter on_not_full_;
+};
+
+}  // namespace pipe_detail
+
+// Send end of a BatchPipe.
+template <typename T, size_t kCapacity>
+class BatchPipeSender {
+ public:
+  using PushType = pipe_detail::BatchPush<T, kCapacity>;
+
+  BatchPipeSender(const BatchPipeSender&) = delete;
+  BatchPipeSender& operator=(const BatchPipeSender&) = delete;
+  BatchPipeSender(BatchPipeSender&& other) noexcept = default;
+  BatchPipeSender& operator=(BatchPipeSender&& other) noexcept = default;
+
+  ~BatchPipeSender() {
+    if (center_ != nullptr) center_->MarkClosed();
+  }
+
+  void Close() {
+    if (center_ != nullptr) {
+      center_->MarkClosed();
+      center_.reset();
+    }
+  }
+
+  // Queue a single message on the pipe.
+  // Returns a promise that will resolve to a bool - true if the message was
+  // queued, false if it could never be sent. Blocks the promise only while
+  // the buffer is full.
+  PushType Push(T value);
+
+  template <typename Fn>
+  void InterceptAndMap(Fn f, DebugLocation from = {}) {
+    center_->PrependMap(std::move(f), from);
+  }
+
+ private:
+  friend struct BatchPipe<T, kCapacity>;
+  explicit BatchPipeSender(pipe_detail::BatchCenter<T, kCapacity>* center)
+      : center_(center) {}
+  RefCountedPtr<pipe_detail::BatchCenter<T, kCapacity>> center_;
+};
+
+// Receive end of a BatchPipe.
+template <typename T, size_t kCapacity>
+class BatchPipeReceiver {
+ public:
+  BatchPipeReceiver(const BatchPipeReceiver&) = delete;
+  BatchPipeReceiver& operator=(const BatchPipeReceiver&) = delete;
+  BatchPipeReceiver(BatchPipeReceiver&& other) noexcept = default;
+  BatchPipeReceiver& operator=(BatchPipeReceiver&& other) noexcept = default;
+  ~BatchPipeReceiver() {
+    if (center_ != nullptr) center_->MarkClosed();
+  }
+
+  // Receive every message queued on the pipe.
+  // Returns a promise that will resolve to an optional<vector<T>> - with at
+  // least one message, oldest first, if any were received, or no value if the
+  // other end of the pipe was closed (and all its messages received) or the
+  // pipe was cancelled.
+  // Interceptors run over each message of the batch in turn; if one of them
+  // drops a message the pipe is cancelled.
+  auto Next();
+
+  template <typename Fn>
+  void InterceptAndMap(Fn f, DebugLocation from = {}) {
+    center_->AppendMap(std::move(f), from);
+  }
+
+ private:
+  friend struct BatchPipe<T, kCapacity>;
+  explicit BatchPipeReceiver(pipe_detail::BatchCenter<T, kCapacity>* center)
+      : center_(center) {}
+  RefCountedPtr<pipe_detail::BatchCenter<T, kCapacity>> center_;
+};
+
+namespace pipe_detail {
+
+// Implementation of BatchPipeSender::Push promise.
+template <typename T, size_t kCapacity>
+class BatchPush {
+ public:
+  BatchPush(const BatchPush&) = delete;
+  BatchPush& operator=(const BatchPush&) = delete;
+  BatchPush(BatchPush&& other) noexcept = default;
+  BatchPush& operator=(BatchPush&& other) noexcept = default;
+
+  Poll<bool> operator()() {
+    if (center_ == nullptr) return false;
+    return center_->Push(&value_);
+  }
+
+ private:
+  friend class BatchPipeSender<T, kCapacity>;
+  BatchPush(RefCountedPtr<BatchCenter<T, kCapacity>> center, T value)
+      : center_(std::move(center)), value_(std::move(value)) {}
+
+  RefCountedPtr<BatchCenter<T, kCapacity>> center_;
+  T value_;
+};
+
+// Implementation of the first step of BatchPipeReceiver::Next promise.
+template <typename T, size_t kCapacity>
+class BatchNext {
+ public:
+  BatchNext(const BatchNext&) = delete;
+  BatchNext& operator=(const BatchNext&) = delete;
+  BatchNext(BatchNext&& other) noexcept = default;
+  BatchNext& operator=(BatchNext&& other) noexcept = default;
+
+  Poll<absl::optional<std::vector<T>>> operator()() { return center_->Next(); }
+
+ private:
+  friend class BatchPipeReceiver<T, kCapacity>;
+  explicit BatchNext(RefCountedPtr<BatchCenter<T, kCapacity>> center)
+      : center_(std::move(center)) {}
+
+  RefCountedPtr<BatchCenter<T, kCapacity>> center_;
+};
+
+}  // namespace pipe_detail
+
+template <typename T, size_t kCapacity>
+pipe_detail::BatchPush<T, kCapacity> BatchPipeSender<T, kCapacity>::Push(
+    T value) {
+  return pipe_detail::BatchPush<T, kCapacity>(
+      center_ == nullptr ? nullptr : center_->Ref(), std::move(value));
+}
+
+template <typename T, size_t kCapacity>
+auto BatchPipeReceiver<T, kCapacity>::Next() {
+  return Seq(
+      pipe_detail::BatchNext<T, kCapacity>(center_->Ref()),
+      [center = center_->Ref()](absl::optional<std::vector<T>> batch) {
+        bool open = batch.has_value();
+        return If(
+            open,
+            [center = std::move(center), batch = std::move(batch)]() mutable {
+              auto run_interceptors = center->RunBatch(std::move(*batch));
+              return Map(std::move(run_interceptors),
+                         [center = std::move(center)](
+                             absl::optional<std::vector<T>> batch) {
+                           if (!batch.has_value()) center->MarkCancelled();
+                           return batch;
+                         });
+            },
+            []() { return absl::optional<std::vector<T>>(); });
+      });
+}
+
+// A BatchPipe is a Pipe variant for streams of small messages: it buffers up
+// to kCapacity messages, and each Next on the receiver takes all of them.
+// The same threading rules apply as for Pipe.
+// Because pushes complete once their message is queued, the sender does not
+// learn when (or whether) a message was received: use Pipe where that
+// acknowledgement is needed.
+template <typename T, size_t kCapacity>
+struct BatchPipe {
+  BatchPipe() : BatchPipe(GetContext<Arena>()) {}
+  explicit BatchPipe(Arena* arena)
+      : BatchPipe(arena->New<pipe_detail::BatchCenter<T, kCapacity>>()) {}
+  BatchPipe(const BatchPipe&) = delete;
+  BatchPipe& operator=(const BatchPipe&) = delete;
+  BatchPipe(BatchPipe&&) noexcept = default;
+  BatchPipe& operator=(BatchPipe&&) noexcept = default;
+
+  BatchPipeSender<T, kCapacity> sender;
+  BatchPipeReceiver<T, kCapacity> receiver;
+
+ private:
+  explicit BatchPipe(pipe_detail::BatchCenter<T, kCapacity>* center)
+      : sender(center), receiver(center) {}
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_LIB_PROMISE_PIPE_H
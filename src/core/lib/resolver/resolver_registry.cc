@@ -19,6 +19,7 @@
 #include "src/core/lib/resolver/resolver_registry.h"
 
 #include <initializer_list>
+#include <memory>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -54,17 +55,31 @@ bool IsLowerCase(absl::string_view str) {
 void ResolverRegistry::Builder::RegisterResolverFactory(
     std::unique_ptr<ResolverFactory> factory) {
   GPR_ASSERT(IsLowerCase(factory->scheme()));
+  GPR_ASSERT(state_.lazy_factories.find(factory->scheme()) ==
+             state_.lazy_factories.end());
   auto p = state_.factories.emplace(factory->scheme(), std::move(factory));
   GPR_ASSERT(p.second);
 }
 
+void ResolverRegistry::Builder::RegisterLazyResolverFactory(
+    absl::string_view scheme, std::unique_ptr<ResolverFactory> (*create)()) {
+  GPR_ASSERT(IsLowerCase(scheme));
+  GPR_ASSERT(state_.factories.find(scheme) == state_.factories.end());
+  auto lazy_factory = std::make_unique<LazyFactory>();
+  lazy_factory->create = create;
+  auto p = state_.lazy_factories.emplace(scheme, std::move(lazy_factory));
+  GPR_ASSERT(p.second);
+}
+
 bool ResolverRegistry::Builder::HasResolverFactory(
     absl::string_view scheme) const {
-  return state_.factories.find(scheme) != state_.factories.end();
+  return state_.factories.find(scheme) != state_.factories.end() ||
+         state_.lazy_factories.find(scheme) != state_.lazy_factories.end();
 }
 
 void ResolverRegistry::Builder::Reset() {
   state_.factories.clear();
+  state_.lazy_factories.clear();
   state_.default_prefix = "dns:///";
 }
 
@@ -123,8 +138,15 @@ std::string ResolverRegistry::AddDefaultPrefixIfNeeded(
 ResolverFactory* ResolverRegistry::LookupResolverFactory(
     absl::string_view scheme) const {
   auto it = state_.factories.find(scheme);
-  if (it == state_.factories.end()) return nullptr;
-  return it->second.get();
+  if (it != state_.factories.end()) return it->second.get();
+  auto lazy_it = state_.lazy_factories.find(scheme);
+  if (lazy_it == state_.lazy_factories.end()) return nullptr;
+  LazyFactory* lazy_factory = lazy_it->second.get();
+  absl::call_once(lazy_factory->once, [lazy_factory, scheme]() {
+    lazy_factory->factory = lazy_factory->create();
+    GPR_ASSERT(lazy_factory->factory->scheme() == scheme);
+  });
+  return lazy_factory->factory.get();
 }
 
 // Returns the factory for the scheme of \a target.  If \a target does
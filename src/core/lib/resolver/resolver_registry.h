@@ -24,6 +24,7 @@
 #include <string>
 #include <utility>
 
+#include "absl/base/call_once.h"
 #include "absl/strings/string_view.h"
 
 #include "src/core/lib/channel/channel_args.h"
@@ -37,9 +38,16 @@ namespace grpc_core {
 
 class ResolverRegistry {
  private:
+  // A factory constructed on first lookup.
+  struct LazyFactory {
+    std::unique_ptr<ResolverFactory> (*create)();
+    absl::once_flag once;
+    std::unique_ptr<ResolverFactory> factory;
+  };
   // Forward declaration needed to use this in Builder.
   struct State {
     std::map<absl::string_view, std::unique_ptr<ResolverFactory>> factories;
+    std::map<absl::string_view, std::unique_ptr<LazyFactory>> lazy_factories;
     std::string default_prefix;
   };
 
@@ -58,6 +66,13 @@ class ResolverRegistry {
     /// resolver for any URI whose scheme matches that of the factory.
     void RegisterResolverFactory(std::unique_ptr<ResolverFactory> factory);
 
+    /// Registers a resolver factory that is only constructed the first time
+    /// a URI with scheme \a scheme is resolved, for schemes that few
+    /// channels use. \a scheme must have static storage duration, and must
+    /// match the scheme of the factory that \a create returns.
+    void RegisterLazyResolverFactory(
+        absl::string_view scheme, std::unique_ptr<ResolverFactory> (*create)());
+
     /// Returns true iff scheme already has a registered factory.
     bool HasResolverFactory(absl::string_view scheme) const;
 
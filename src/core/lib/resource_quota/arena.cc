@@ -24,15 +24,32 @@
 #include <new>
 
 #include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
 
 #include "src/core/lib/gpr/alloc.h"
+#include "src/core/lib/gprpp/numa.h"
 
 namespace {
 
-void* ArenaStorage(size_t initial_size) {
+// Header written over the storage of an arena while it sits in an ArenaCache.
+struct CachedArenaStorage {
+  size_t initial_size;
+};
+
+// Returns storage for an arena, and in *numa_node the node it is placed on.
+// Fresh storage is first touched by the calling thread, which places it on
+// that thread's node.
+void* ArenaStorage(size_t initial_size, grpc_core::ArenaCache* cache,
+                   size_t* numa_node) {
   static constexpr size_t base_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(grpc_core::Arena));
   initial_size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size);
+  *numa_node = 0;
+  if (cache != nullptr) {
+    *numa_node = grpc_core::CurrentNumaNode();
+    void* storage = cache->Take(initial_size, *numa_node);
+    if (storage != nullptr) return storage;
+  }
   size_t alloc_size = base_size + initial_size;
   static constexpr size_t alignment =
       (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
@@ -56,17 +73,23 @@ Arena::~Arena() {
   }
 }
 
-Arena* Arena::Create(size_t initial_size, MemoryAllocator* memory_allocator) {
-  return new (ArenaStorage(initial_size))
-      Arena(initial_size, 0, memory_allocator);
+Arena* Arena::Create(size_t initial_size, MemoryAllocator* memory_allocator,
+                     ArenaCache* cache) {
+  size_t numa_node;
+  void* storage = ArenaStorage(initial_size, cache, &numa_node);
+  return new (storage)
+      Arena(initial_size, 0, memory_allocator, cache, numa_node);
 }
 
 std::pair<Arena*, void*> Arena::CreateWithAlloc(
-    size_t initial_size, size_t alloc_size, MemoryAllocator* memory_allocator) {
+    size_t initial_size, size_t alloc_size, MemoryAllocator* memory_allocator,
+    ArenaCache* cache) {
   static constexpr size_t base_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(Arena));
-  auto* new_arena = new (ArenaStorage(initial_size))
-      Arena(initial_size, alloc_size, memory_allocator);
+  size_t numa_node;
+  void* storage = ArenaStorage(initial_size, cache, &numa_node);
+  auto* new_arena = new (storage)
+      Arena(initial_size, alloc_size, memory_allocator, cache, numa_node);
   void* first_alloc = reinterpret_cast<char*>(new_arena) + base_size;
   return std::make_pair(new_arena, first_alloc);
 }
@@ -83,8 +106,23 @@ void Arena::Destroy() {
     }
   }
   memory_allocator_->Release(total_allocated_.load(std::memory_order_relaxed));
+  ArenaCache* cache = cache_;
+  const size_t initial_size =
+      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_zone_size_);
+  const size_t numa_node = numa_node_;
   this->~Arena();
-  gpr_free_aligned(this);
+  if (cache == nullptr || !cache->Put(this, initial_size, numa_node)) {
+    gpr_free_aligned(this);
+  }
+}
+
+size_t Arena::ChainedZones() const {
+  size_t zones = 0;
+  for (Zone* z = last_zone_.load(std::memory_order_relaxed); z != nullptr;
+       z = z->prev) {
+    ++zones;
+  }
+  return zones;
 }
 
 void* Arena::AllocZone(size_t size) {
@@ -114,6 +152,50 @@ void Arena::ManagedNewObject::Link(std::atomic<ManagedNewObject*>* head) {
   }
 }
 
+ArenaCache::ArenaCache()
+    : numa_nodes_(NumaNodeCount()), nodes_(new NodeSlots[numa_nodes_]) {}
+
+ArenaCache::~ArenaCache() {
+  for (size_t node = 0; node < numa_nodes_; ++node) {
+    for (Slot& slot : nodes_[node].slots) {
+      void* storage = slot.storage.load(std::memory_order_relaxed);
+      if (storage != nullptr) gpr_free_aligned(storage);
+    }
+  }
+}
+
+void* ArenaCache::Take(size_t initial_size, size_t numa_node) {
+  GPR_DEBUG_ASSERT(numa_node < numa_nodes_);
+  for (Slot& slot : nodes_[numa_node].slots) {
+    if (slot.storage.load(std::memory_order_relaxed) == nullptr) continue;
+    void* storage = slot.storage.exchange(nullptr, std::memory_order_acquire);
+    if (storage == nullptr) continue;
+    if (static_cast<CachedArenaStorage*>(storage)->initial_size ==
+        initial_size) {
+      return storage;
+    }
+    // The size estimate moved on since this was cached: it's unlikely to be
+    // asked for again, so let it go.
+    gpr_free_aligned(storage);
+  }
+  return nullptr;
+}
+
+bool ArenaCache::Put(void* storage, size_t initial_size, size_t numa_node) {
+  GPR_DEBUG_ASSERT(numa_node < numa_nodes_);
+  new (storage) CachedArenaStorage{initial_size};
+  for (Slot& slot : nodes_[numa_node].slots) {
+    void* expected = nullptr;
+    if (slot.storage.load(std::memory_order_relaxed) == nullptr &&
+        slot.storage.compare_exchange_strong(expected, storage,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void* Arena::AllocPooled(size_t alloc_size, std::atomic<FreePoolNode*>* head) {
   // ABA mitigation:
   // AllocPooled may be called by multiple threads, and to remove a node from
@@ -28,6 +28,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <atomic>
 #include <limits>
@@ -113,6 +114,8 @@ PoolAndSize ChoosePoolForAllocationSize(
 
 }  // namespace arena_detail
 
+class ArenaCache;
+
 class Arena {
   using PoolSizes = absl::integer_sequence<size_t, 256, 512, 768>;
   struct FreePoolNode {
@@ -121,18 +124,25 @@ class Arena {
 
  public:
   // Create an arena, with \a initial_size bytes in the first allocated buffer.
-  static Arena* Create(size_t initial_size, MemoryAllocator* memory_allocator);
+  // If \a cache is non-null, the first buffer is taken from (and returned to
+  // on destruction) that cache when possible.
+  static Arena* Create(size_t initial_size, MemoryAllocator* memory_allocator,
+                       ArenaCache* cache = nullptr);
 
   // Create an arena, with \a initial_size bytes in the first allocated buffer,
   // and return both a void pointer to the returned arena and a void* with the
   // first allocation.
   static std::pair<Arena*, void*> CreateWithAlloc(
-      size_t initial_size, size_t alloc_size,
-      MemoryAllocator* memory_allocator);
+      size_t initial_size, size_t alloc_size, MemoryAllocator* memory_allocator,
+      ArenaCache* cache = nullptr);
 
   // Destroy an arena.
   void Destroy();
 
+  // Return the number of zones allocated after the initial one because
+  // allocations did not fit in it. Zero for arenas sized well enough.
+  size_t ChainedZones() const;
+
   // Return the total amount of memory allocated by this arena.
   size_t TotalUsedBytes() const {
     return total_used_.load(std::memory_order_relaxed);
@@ -265,11 +275,20 @@ class Arena {
   //   quick optimization (avoiding an atomic fetch-add) for the common case
   //   where we wish to create an arena and then perform an immediate
   //   allocation.
+  //
+  //   cache: Optionally, the cache that the initial zone was taken from and
+  //   should be returned to when the arena is destroyed.
+  //
+  //   numa_node: The NUMA node the initial zone was placed on, which selects
+  //   the part of the cache it is returned to.
   explicit Arena(size_t initial_size, size_t initial_alloc,
-                 MemoryAllocator* memory_allocator)
+                 MemoryAllocator* memory_allocator, ArenaCache* cache,
+                 size_t numa_node)
       : total_used_(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_alloc)),
         initial_zone_size_(initial_size),
-        memory_allocator_(memory_allocator) {}
+        memory_allocator_(memory_allocator),
+        cache_(cache),
+        numa_node_(numa_node) {}
 
   ~Arena();
 
@@ -293,6 +312,56 @@ class Arena {
   std::atomic<FreePoolNode*> pools_[PoolSizes::size()]{};
   // The backing memory quota
   MemoryAllocator* const memory_allocator_;
+  // Where to return the initial zone to on destruction, if anywhere.
+  ArenaCache* const cache_;
+  // NUMA node of the initial zone, only tracked for cached arenas.
+  const size_t numa_node_;
+};
+
+// Keeps the storage of recently destroyed arenas around so that it can be
+// reused for new arenas of the same initial size without a trip to the
+// allocator.
+// Owners (typically a channel) size their arenas from a running estimate that
+// is rounded to a coarse granularity, so consecutive calls usually ask for
+// exactly the same size; storage of a different size is released rather than
+// reused.
+// Storage is kept apart per NUMA node: an arena created on a thread of one
+// node only reuses storage that was first touched on that node, so that calls
+// served there do not work out of remote memory.
+// The cache must outlive every arena created from it.
+class ArenaCache {
+ public:
+  ArenaCache();
+  ~ArenaCache();
+
+  ArenaCache(const ArenaCache&) = delete;
+  ArenaCache& operator=(const ArenaCache&) = delete;
+
+  // Returns cached storage placed on \a numa_node for an arena with
+  // \a initial_size bytes (rounded up to alignment) in its initial zone, or
+  // nullptr if there is none.
+  void* Take(size_t initial_size, size_t numa_node);
+  // Offers the storage of a destroyed arena, placed on \a numa_node, to the
+  // cache. Returns false if the cache is full, in which case the caller still
+  // owns the storage.
+  bool Put(void* storage, size_t initial_size, size_t numa_node);
+
+ private:
+  // Number of arena storage blocks the cache holds on to at most, per node.
+  static constexpr size_t kCachedArenas = 8;
+
+  // Slots are padded to a cache line so that concurrent calls do not contend
+  // on them.
+  struct Slot {
+    std::atomic<void*> storage{nullptr};
+    uint8_t padding[GPR_CACHELINE_SIZE - sizeof(std::atomic<void*>)];
+  };
+  struct NodeSlots {
+    Slot slots[kCachedArenas];
+  };
+
+  const size_t numa_nodes_;
+  std::unique_ptr<NodeSlots[]> nodes_;
 };
 
 // Smart pointer for arenas when the final size is not required.
@@ -167,7 +167,7 @@ GrpcMemoryAllocatorImpl::~GrpcMemoryAllocatorImpl() {
   GPR_ASSERT(free_bytes_.load(std::memory_order_acquire) +
                  sizeof(GrpcMemoryAllocatorImpl) ==
              taken_bytes_.load(std::memory_order_relaxed));
-  memory_quota_->Return(taken_bytes_);
+  memory_quota_->Return(this, taken_bytes_);
 }
 
 void GrpcMemoryAllocatorImpl::Shutdown() {
@@ -271,7 +271,7 @@ void GrpcMemoryAllocatorImpl::MaybeDonateBack() {
                 name_.c_str(), ret);
       }
       GPR_ASSERT(taken_bytes_.fetch_sub(ret, std::memory_order_relaxed) >= ret);
-      memory_quota_->Return(ret);
+      memory_quota_->Return(this, ret);
       return;
     }
   }
@@ -325,9 +325,7 @@ void BasicMemoryQuota::Start() {
   auto reclamation_loop = Loop(Seq(
       [self]() -> Poll<int> {
         // If there's free memory we no longer need to reclaim memory!
-        if (self->free_bytes_.load(std::memory_order_acquire) > 0) {
-          return Pending{};
-        }
+        if (!self->NeedsReclamation()) return Pending{};
         return 0;
       },
       [self]() {
@@ -377,15 +375,19 @@ void BasicMemoryQuota::Start() {
                    [](absl::Status status) {
                      GPR_ASSERT(status.code() == absl::StatusCode::kCancelled);
                    });
+  if (parent_ != nullptr) parent_->AddSubQuota(this);
 }
 
-void BasicMemoryQuota::Stop() { reclaimer_activity_.reset(); }
+void BasicMemoryQuota::Stop() {
+  if (parent_ != nullptr) parent_->RemoveSubQuota(this);
+  reclaimer_activity_.reset();
+}
 
 void BasicMemoryQuota::SetSize(size_t new_size) {
   size_t old_size = quota_size_.exchange(new_size, std::memory_order_relaxed);
   if (old_size < new_size) {
     // We're growing the quota.
-    Return(new_size - old_size);
+    Return(/*allocator=*/nullptr, new_size - old_size);
   } else {
     // We're shrinking the quota.
     Take(/*allocator=*/nullptr, old_size - new_size);
@@ -398,10 +400,14 @@ void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   GPR_DEBUG_ASSERT(amount <= std::numeric_limits<intptr_t>::max());
   // Grab memory from the quota.
   auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
-  // If we push into overcommit, awake the reclaimer.
-  if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
-    if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+  if (allocator != nullptr) {
+    node_taken_bytes_[allocator->numa_node()].fetch_add(
+        amount, std::memory_order_relaxed);
+    // Resizing a sub-quota leaves its parent alone.
+    if (parent_ != nullptr) parent_->Take(allocator, amount);
   }
+  // If we push into overcommit, awake the reclaimers.
+  if (prior >= 0 && prior < static_cast<intptr_t>(amount)) WakeReclaimers();
 
   if (IsFreeLargeAllocatorEnabled()) {
     if (allocator == nullptr) return;
@@ -441,8 +447,52 @@ void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
   }
 }
 
-void BasicMemoryQuota::Return(size_t amount) {
+void BasicMemoryQuota::Return(GrpcMemoryAllocatorImpl* allocator,
+                              size_t amount) {
   free_bytes_.fetch_add(amount, std::memory_order_relaxed);
+  if (allocator != nullptr) {
+    node_taken_bytes_[allocator->numa_node()].fetch_sub(
+        amount, std::memory_order_relaxed);
+    if (parent_ != nullptr) parent_->Return(allocator, amount);
+  }
+}
+
+size_t BasicMemoryQuota::TakenBytes() const {
+  size_t taken = 0;
+  for (size_t i = 0; i < numa_nodes_; ++i) {
+    taken += node_taken_bytes_[i].load(std::memory_order_relaxed);
+  }
+  return taken;
+}
+
+bool BasicMemoryQuota::NeedsReclamation() const {
+  if (free_bytes_.load(std::memory_order_acquire) <= 0) return true;
+  if (parent_ == nullptr || !parent_->NeedsReclamation()) return false;
+  // Reclaim first from the heaviest users of the parent, so that one of them
+  // does not make the others give up their memory.
+  return TakenBytes() *
+             parent_->num_sub_quotas_.load(std::memory_order_relaxed) >=
+         parent_->TakenBytes();
+}
+
+void BasicMemoryQuota::WakeReclaimers() {
+  if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+  MutexLock lock(&sub_quotas_mu_);
+  for (BasicMemoryQuota* sub_quota : sub_quotas_) sub_quota->WakeReclaimers();
+}
+
+void BasicMemoryQuota::AddSubQuota(BasicMemoryQuota* sub_quota) {
+  MutexLock lock(&sub_quotas_mu_);
+  sub_quotas_.push_back(sub_quota);
+  num_sub_quotas_.store(sub_quotas_.size(), std::memory_order_relaxed);
+}
+
+void BasicMemoryQuota::RemoveSubQuota(BasicMemoryQuota* sub_quota) {
+  MutexLock lock(&sub_quotas_mu_);
+  sub_quotas_.erase(
+      std::remove(sub_quotas_.begin(), sub_quotas_.end(), sub_quota),
+      sub_quotas_.end());
+  num_sub_quotas_.store(sub_quotas_.size(), std::memory_order_relaxed);
 }
 
 void BasicMemoryQuota::AddNewAllocator(GrpcMemoryAllocatorImpl* allocator) {
@@ -453,7 +503,7 @@ void BasicMemoryQuota::AddNewAllocator(GrpcMemoryAllocatorImpl* allocator) {
   AllocatorBucket::Shard& shard = small_allocators_.SelectShard(allocator);
 
   {
-    absl::MutexLock l(&shard.shard_mu);
+    AdaptiveMutexLock l(&shard.shard_mu);
     shard.allocators.emplace(allocator);
   }
 }
@@ -467,7 +517,7 @@ void BasicMemoryQuota::RemoveAllocator(GrpcMemoryAllocatorImpl* allocator) {
       small_allocators_.SelectShard(allocator);
 
   {
-    absl::MutexLock l(&small_shard.shard_mu);
+    AdaptiveMutexLock l(&small_shard.shard_mu);
     if (small_shard.allocators.erase(allocator) == 1) {
       return;
     }
@@ -476,7 +526,7 @@ void BasicMemoryQuota::RemoveAllocator(GrpcMemoryAllocatorImpl* allocator) {
   AllocatorBucket::Shard& big_shard = big_allocators_.SelectShard(allocator);
 
   {
-    absl::MutexLock l(&big_shard.shard_mu);
+    AdaptiveMutexLock l(&big_shard.shard_mu);
     big_shard.allocators.erase(allocator);
   }
 }
@@ -513,14 +563,14 @@ void BasicMemoryQuota::MaybeMoveAllocatorBigToSmall(
   AllocatorBucket::Shard& old_shard = big_allocators_.SelectShard(allocator);
 
   {
-    absl::MutexLock l(&old_shard.shard_mu);
+    AdaptiveMutexLock l(&old_shard.shard_mu);
     if (old_shard.allocators.erase(allocator) == 0) return;
   }
 
   AllocatorBucket::Shard& new_shard = small_allocators_.SelectShard(allocator);
 
   {
-    absl::MutexLock l(&new_shard.shard_mu);
+    AdaptiveMutexLock l(&new_shard.shard_mu);
     new_shard.allocators.emplace(allocator);
   }
 }
@@ -534,14 +584,14 @@ void BasicMemoryQuota::MaybeMoveAllocatorSmallToBig(
   AllocatorBucket::Shard& old_shard = small_allocators_.SelectShard(allocator);
 
   {
-    absl::MutexLock l(&old_shard.shard_mu);
+    AdaptiveMutexLock l(&old_shard.shard_mu);
     if (old_shard.allocators.erase(allocator) == 0) return;
   }
 
   AllocatorBucket::Shard& new_shard = big_allocators_.SelectShard(allocator);
 
   {
-    absl::MutexLock l(&new_shard.shard_mu);
+    AdaptiveMutexLock l(&new_shard.shard_mu);
     new_shard.allocators.emplace(allocator);
   }
 }
@@ -563,6 +613,19 @@ BasicMemoryQuota::PressureInfo BasicMemoryQuota::GetPressureInfo() {
         std::min(pressure_info.instantaneous_pressure, 1.0);
   }
   pressure_info.max_recommended_allocation_size = quota_size / 16;
+  // A sub-quota is under at least the pressure of its parent.
+  if (parent_ != nullptr) {
+    PressureInfo parent_info = parent_->GetPressureInfo();
+    pressure_info.instantaneous_pressure = std::max(
+        pressure_info.instantaneous_pressure,
+        parent_info.instantaneous_pressure);
+    pressure_info.pressure_control_value = std::max(
+        pressure_info.pressure_control_value,
+        parent_info.pressure_control_value);
+    pressure_info.max_recommended_allocation_size =
+        std::min(pressure_info.max_recommended_allocation_size,
+                 parent_info.max_recommended_allocation_size);
+  }
   return pressure_info;
 }
 
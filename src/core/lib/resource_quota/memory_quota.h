@@ -29,8 +29,8 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/string_view.h"
-#include "absl/synchronization/mutex.h"
 #include "absl/types/optional.h"
 
 #include <grpc/event_engine/memory_allocator.h>
@@ -40,6 +40,8 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/adaptive_mutex.h"
+#include "src/core/lib/gprpp/numa.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -297,7 +299,20 @@ class BasicMemoryQuota final
     size_t max_recommended_allocation_size = 0;
   };
 
-  explicit BasicMemoryQuota(std::string name) : name_(std::move(name)) {}
+  // If parent is set, this is a sub-quota of it: the memory taken by this
+  // quota's allocators is also taken from the parent, and when the parent is
+  // in overcommit, the sub-quotas using more than an even share of it reclaim
+  // memory before the others.
+  explicit BasicMemoryQuota(std::string name,
+                            std::shared_ptr<BasicMemoryQuota> parent = nullptr)
+      : parent_(std::move(parent)),
+        numa_nodes_(NumaNodeCount()),
+        node_taken_bytes_(new std::atomic<size_t>[numa_nodes_]),
+        name_(std::move(name)) {
+    for (size_t i = 0; i < numa_nodes_; ++i) {
+      node_taken_bytes_[i].store(0, std::memory_order_relaxed);
+    }
+  }
 
   // Start the reclamation activity.
   void Start();
@@ -314,8 +329,8 @@ class BasicMemoryQuota final
   void Take(GrpcMemoryAllocatorImpl* allocator, size_t amount);
   // Finish reclamation pass.
   void FinishReclamation(uint64_t token, Waker waker);
-  // Return some memory to the quota.
-  void Return(size_t amount);
+  // Return some memory that allocator (if any) took from the quota.
+  void Return(GrpcMemoryAllocatorImpl* allocator, size_t amount);
   // Add allocator to list of allocators in small bucket. Returns allocator id.
   void AddNewAllocator(GrpcMemoryAllocatorImpl* allocator);
   // Remove allocator from list of allocators.
@@ -327,6 +342,11 @@ class BasicMemoryQuota final
   PressureInfo GetPressureInfo();
   // Get a reclamation queue
   ReclaimerQueue* reclaimer_queue(size_t i) { return &reclaimers_[i]; }
+  // Number of bytes currently taken by the allocators of NUMA node \a node.
+  size_t GetNumaNodeUsage(size_t node) const {
+    if (node >= numa_nodes_) return 0;
+    return node_taken_bytes_[node].load(std::memory_order_relaxed);
+  }
 
   // The name of this quota
   absl::string_view name() const { return name_; }
@@ -340,7 +360,8 @@ class BasicMemoryQuota final
     struct Shard {
       absl::flat_hash_set<GrpcMemoryAllocatorImpl*> allocators
           ABSL_GUARDED_BY(shard_mu);
-      absl::Mutex shard_mu;
+      // Held only for a set insert, erase or lookup.
+      AdaptiveMutex shard_mu;
     };
 
     Shard& SelectShard(void* key) {
@@ -353,11 +374,31 @@ class BasicMemoryQuota final
 
   static constexpr intptr_t kInitialSize = std::numeric_limits<intptr_t>::max();
 
+  // Number of bytes currently taken by allocators, on all NUMA nodes.
+  size_t TakenBytes() const;
+  // Whether the reclamation loop should run reclaimers: this quota is in
+  // overcommit, or its parent needs reclamation and this quota holds more
+  // than an even share of the parent's memory.
+  bool NeedsReclamation() const;
+  // Wakes the reclamation loops of this quota and of its sub-quotas.
+  void WakeReclaimers();
+  void AddSubQuota(BasicMemoryQuota* sub_quota);
+  void RemoveSubQuota(BasicMemoryQuota* sub_quota);
+
   // Move allocator from big bucket to small bucket.
   void MaybeMoveAllocatorBigToSmall(GrpcMemoryAllocatorImpl* allocator);
   // Move allocator from small bucket to big bucket.
   void MaybeMoveAllocatorSmallToBig(GrpcMemoryAllocatorImpl* allocator);
 
+  // The quota this is a sub-quota of, if any.
+  const std::shared_ptr<BasicMemoryQuota> parent_;
+  // The started sub-quotas of this quota.  Sub-quotas remove themselves when
+  // they stop, so the pointers are valid while the lock is held.
+  Mutex sub_quotas_mu_;
+  absl::InlinedVector<BasicMemoryQuota*, 2> sub_quotas_
+      ABSL_GUARDED_BY(sub_quotas_mu_);
+  std::atomic<size_t> num_sub_quotas_{0};
+
   // The amount of memory that's free in this quota.
   // We use intptr_t as a reasonable proxy for ssize_t that's portable.
   // We allow arbitrary overcommit and so this must allow negative values.
@@ -383,6 +424,10 @@ class BasicMemoryQuota final
   std::atomic<uint64_t> reclamation_counter_{0};
   // Memory pressure smoothing
   memory_quota_detail::PressureTracker pressure_tracker_;
+  // The bytes taken from this quota, split by the NUMA node of the allocators
+  // that took them.
+  const size_t numa_nodes_;
+  std::unique_ptr<std::atomic<size_t>[]> node_taken_bytes_;
   // The name of this quota - used for debugging/tracing/etc..
   std::string name_;
 };
@@ -424,7 +469,7 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
       gpr_log(GPR_INFO, "Allocator %p returning %zu bytes to quota", this, ret);
     }
     taken_bytes_.fetch_sub(ret, std::memory_order_relaxed);
-    memory_quota_->Return(ret);
+    memory_quota_->Return(this, ret);
     memory_quota_->MaybeMoveAllocator(this, /*old_free_bytes=*/ret,
                                       /*new_free_bytes=*/0);
   }
@@ -456,6 +501,10 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
     return chosen_shard_idx_.fetch_add(1, std::memory_order_relaxed);
   }
 
+  // The NUMA node this allocator's usage is accounted to: that of the thread
+  // that created it, which for endpoints is the thread serving the fd.
+  size_t numa_node() const { return numa_node_; }
+
  private:
   static constexpr size_t kMaxQuotaBufferSize = 1024 * 1024;
 
@@ -485,6 +534,7 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
   std::atomic<size_t> taken_bytes_{sizeof(GrpcMemoryAllocatorImpl)};
   // Index used to randomly choose shard to return bytes from.
   std::atomic<size_t> chosen_shard_idx_{0};
+  const size_t numa_node_ = CurrentNumaNode();
   // We try to donate back some memory periodically to the central quota.
   PeriodicUpdate donate_back_{Duration::Seconds(10)};
   Mutex reclaimer_mu_;
@@ -537,6 +587,13 @@ class MemoryOwner final : public MemoryAllocator {
   // Is this object valid (ie has not been moved out of or reset)
   bool is_valid() const { return impl() != nullptr; }
 
+  // A reference to the underlying allocator, for memory that stays charged to
+  // it until released, even once this object is gone (as slices from
+  // MakeSlice do).
+  std::shared_ptr<EventEngineMemoryAllocatorImpl> RefAllocator() {
+    return impl()->shared_from_this();
+  }
+
  private:
   const GrpcMemoryAllocatorImpl* impl() const {
     return static_cast<const GrpcMemoryAllocatorImpl*>(get_internal_impl_ptr());
@@ -559,6 +616,13 @@ class MemoryQuota final
     if (memory_quota_ != nullptr) memory_quota_->Stop();
   }
 
+  // Creates a sub-quota of parent.  See BasicMemoryQuota.
+  MemoryQuota(std::string name, const MemoryQuota& parent)
+      : memory_quota_(std::make_shared<BasicMemoryQuota>(
+            std::move(name), parent.memory_quota_)) {
+    memory_quota_->Start();
+  }
+
   MemoryQuota(const MemoryQuota&) = delete;
   MemoryQuota& operator=(const MemoryQuota&) = delete;
   MemoryQuota(MemoryQuota&&) = default;
@@ -566,10 +630,21 @@ class MemoryQuota final
 
   MemoryAllocator CreateMemoryAllocator(absl::string_view name) override;
   MemoryOwner CreateMemoryOwner(absl::string_view name);
+  // Returns a quota whose allocations also count against this one, with its
+  // own size and reclaimers, e.g. for the calls of one method or tenant.
+  std::shared_ptr<MemoryQuota> CreateSubQuota(std::string name) {
+    return std::make_shared<MemoryQuota>(std::move(name), *this);
+  }
 
   // Resize the quota to new_size.
   void SetSize(size_t new_size) { memory_quota_->SetSize(new_size); }
 
+  // Number of bytes currently taken from this quota by allocators created on
+  // NUMA node \a node.
+  size_t GetNumaNodeUsage(size_t node) const {
+    return memory_quota_->GetNumaNodeUsage(node);
+  }
+
   // Return true if the controlled memory pressure is high.
   bool IsMemoryPressureHigh() const {
     static constexpr double kMemoryPressureHighThreshold = 0.99;
@@ -22,8 +22,18 @@ ResourceQuota::ResourceQuota(std::string name)
     : memory_quota_(MakeMemoryQuota(std::move(name))),
       thread_quota_(MakeRefCounted<ThreadQuota>()) {}
 
+ResourceQuota::ResourceQuota(MemoryQuotaRefPtr memory_quota,
+                             RefCountedPtr<ThreadQuota> thread_quota)
+    : memory_quota_(std::move(memory_quota)),
+      thread_quota_(std::move(thread_quota)) {}
+
 ResourceQuota::~ResourceQuota() = default;
 
+ResourceQuotaRefPtr ResourceQuota::CreateSubQuota(std::string name) {
+  return MakeRefCounted<ResourceQuota>(
+      memory_quota_->CreateSubQuota(std::move(name)), thread_quota_);
+}
+
 ResourceQuotaRefPtr ResourceQuota::Default() {
   static auto default_resource_quota =
       MakeResourceQuota("default_resource_quota").release();
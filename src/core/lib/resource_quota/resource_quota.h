@@ -41,6 +41,8 @@ class ResourceQuota : public RefCounted<ResourceQuota>,
                       public CppImplOf<ResourceQuota, grpc_resource_quota> {
  public:
   explicit ResourceQuota(std::string name);
+  ResourceQuota(MemoryQuotaRefPtr memory_quota,
+                RefCountedPtr<ThreadQuota> thread_quota);
   ~ResourceQuota() override;
 
   ResourceQuota(const ResourceQuota&) = delete;
@@ -52,6 +54,12 @@ class ResourceQuota : public RefCounted<ResourceQuota>,
 
   const RefCountedPtr<ThreadQuota>& thread_quota() { return thread_quota_; }
 
+  // Returns a quota for part of the work under this one, such as the calls
+  // of one method or tenant, that can be sized and reclaimed on its own. Its
+  // memory use also counts against this quota. Threads are not split: the
+  // sub-quota shares this quota's ThreadQuota.
+  RefCountedPtr<ResourceQuota> CreateSubQuota(std::string name);
+
   // The default global resource quota
   static ResourceQuotaRefPtr Default();
 
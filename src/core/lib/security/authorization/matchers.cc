@@ -33,6 +33,36 @@
 
 namespace grpc_core {
 
+namespace {
+
+bool IsFoldablePath(const Rbac::Permission& permission) {
+  return permission.type == Rbac::Permission::RuleType::kPath &&
+         StringMatcherSet::CanHold(permission.string_matcher);
+}
+
+bool IsFoldablePath(const Rbac::Principal& principal) {
+  return principal.type == Rbac::Principal::RuleType::kPath &&
+         StringMatcherSet::CanHold(*principal.string_matcher);
+}
+
+bool IsFoldablePrincipalName(const Rbac::Principal& principal) {
+  return principal.type == Rbac::Principal::RuleType::kPrincipalName &&
+         principal.string_matcher.has_value() &&
+         StringMatcherSet::CanHold(*principal.string_matcher);
+}
+
+// Returns whether more than one of rules satisfies pred, in which case it
+// is worth folding them into a StringMatcherSet.
+template <typename T, typename Pred>
+bool ShouldFold(const std::vector<std::unique_ptr<T>>& rules, Pred pred) {
+  return std::count_if(rules.begin(), rules.end(),
+                       [&](const std::unique_ptr<T>& rule) {
+                         return pred(*rule);
+                       }) > 1;
+}
+
+}  // namespace
+
 std::unique_ptr<AuthorizationMatcher> AuthorizationMatcher::Create(
     Rbac::Permission permission) {
   switch (permission.type) {
@@ -47,7 +77,21 @@ std::unique_ptr<AuthorizationMatcher> AuthorizationMatcher::Create(
     case Rbac::Permission::RuleType::kOr: {
       std::vector<std::unique_ptr<AuthorizationMatcher>> matchers;
       matchers.reserve(permission.permissions.size());
+      // Policies often list many paths, so check those with hash lookups
+      // rather than one by one.
+      const bool fold_paths = ShouldFold(
+          permission.permissions,
+          [](const Rbac::Permission& rule) { return IsFoldablePath(rule); });
+      if (fold_paths) {
+        StringMatcherSet paths;
+        for (const auto& rule : permission.permissions) {
+          if (IsFoldablePath(*rule)) paths.Add(rule->string_matcher);
+        }
+        matchers.push_back(
+            std::make_unique<PathSetAuthorizationMatcher>(std::move(paths)));
+      }
       for (const auto& rule : permission.permissions) {
+        if (fold_paths && IsFoldablePath(*rule)) continue;
         matchers.push_back(AuthorizationMatcher::Create(std::move(*rule)));
       }
       return std::make_unique<OrAuthorizationMatcher>(std::move(matchers));
@@ -91,7 +135,34 @@ std::unique_ptr<AuthorizationMatcher> AuthorizationMatcher::Create(
     case Rbac::Principal::RuleType::kOr: {
       std::vector<std::unique_ptr<AuthorizationMatcher>> matchers;
       matchers.reserve(principal.principals.size());
+      // Same as for permissions, for both paths and principal names.
+      const bool fold_paths = ShouldFold(
+          principal.principals,
+          [](const Rbac::Principal& id) { return IsFoldablePath(id); });
+      const bool fold_names =
+          ShouldFold(principal.principals, [](const Rbac::Principal& id) {
+            return IsFoldablePrincipalName(id);
+          });
+      if (fold_paths) {
+        StringMatcherSet paths;
+        for (const auto& id : principal.principals) {
+          if (IsFoldablePath(*id)) paths.Add(*id->string_matcher);
+        }
+        matchers.push_back(
+            std::make_unique<PathSetAuthorizationMatcher>(std::move(paths)));
+      }
+      if (fold_names) {
+        StringMatcherSet names;
+        for (const auto& id : principal.principals) {
+          if (IsFoldablePrincipalName(*id)) names.Add(*id->string_matcher);
+        }
+        matchers.push_back(
+            std::make_unique<AuthenticatedSetAuthorizationMatcher>(
+                std::move(names)));
+      }
       for (const auto& id : principal.principals) {
+        if (fold_paths && IsFoldablePath(*id)) continue;
+        if (fold_names && IsFoldablePrincipalName(*id)) continue;
         matchers.push_back(AuthorizationMatcher::Create(std::move(*id)));
       }
       return std::make_unique<OrAuthorizationMatcher>(std::move(matchers));
@@ -234,6 +305,60 @@ bool PathAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
   return false;
 }
 
+bool StringMatcherSet::CanHold(const StringMatcher& matcher) {
+  return matcher.case_sensitive() &&
+         (matcher.type() == StringMatcher::Type::kExact ||
+          matcher.type() == StringMatcher::Type::kPrefix);
+}
+
+void StringMatcherSet::Add(const StringMatcher& matcher) {
+  GPR_DEBUG_ASSERT(CanHold(matcher));
+  const std::string& value = matcher.string_matcher();
+  if (matcher.type() == StringMatcher::Type::kExact) {
+    exact_.insert(value);
+    return;
+  }
+  prefixes_.insert(value);
+  auto it = std::lower_bound(prefix_lengths_.begin(), prefix_lengths_.end(),
+                             value.size());
+  if (it == prefix_lengths_.end() || *it != value.size()) {
+    prefix_lengths_.insert(it, value.size());
+  }
+}
+
+bool StringMatcherSet::Match(absl::string_view value) const {
+  if (exact_.contains(value)) return true;
+  for (size_t length : prefix_lengths_) {
+    if (length > value.size()) break;
+    if (prefixes_.contains(value.substr(0, length))) return true;
+  }
+  return false;
+}
+
+bool PathSetAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
+  absl::string_view path = args.GetPath();
+  if (!path.empty()) {
+    return matchers_.Match(path);
+  }
+  return false;
+}
+
+bool AuthenticatedSetAuthorizationMatcher::Matches(
+    const EvaluateArgs& args) const {
+  if (args.GetTransportSecurityType() != GRPC_SSL_TRANSPORT_SECURITY_TYPE &&
+      args.GetTransportSecurityType() != GRPC_TLS_TRANSPORT_SECURITY_TYPE) {
+    // Connection is not authenticated.
+    return false;
+  }
+  for (const auto& uri : args.GetUriSans()) {
+    if (matchers_.Match(uri)) return true;
+  }
+  for (const auto& dns : args.GetDnsSans()) {
+    if (matchers_.Match(dns)) return true;
+  }
+  return matchers_.Match(args.GetSubject());
+}
+
 bool PolicyAuthorizationMatcher::Matches(const EvaluateArgs& args) const {
   return permissions_->Matches(args) && principals_->Matches(args);
 }
@@ -17,12 +17,16 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_set.h"
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
 #include "src/core/lib/iomgr/resolved_address.h"
@@ -195,6 +199,53 @@ class PathAuthorizationMatcher : public AuthorizationMatcher {
   const StringMatcher matcher_;
 };
 
+// Matches a string against a set of case-sensitive exact and prefix string
+// matchers, with one hash lookup per exact value and per distinct prefix
+// length instead of one comparison per matcher.
+class StringMatcherSet {
+ public:
+  // Returns whether Add() accepts matcher.
+  static bool CanHold(const StringMatcher& matcher);
+
+  // Adds matcher, which must satisfy CanHold(), to the set.
+  void Add(const StringMatcher& matcher);
+
+  // Returns whether any of the matchers in the set matches value.
+  bool Match(absl::string_view value) const;
+
+ private:
+  absl::flat_hash_set<std::string> exact_;
+  absl::flat_hash_set<std::string> prefixes_;
+  // The distinct lengths of the entries of prefixes_, in increasing order.
+  std::vector<size_t> prefix_lengths_;
+};
+
+// Matches the path header of HTTP request against many path matchers at
+// once.  Used in place of an OR of PathAuthorizationMatchers.
+class PathSetAuthorizationMatcher : public AuthorizationMatcher {
+ public:
+  explicit PathSetAuthorizationMatcher(StringMatcherSet paths)
+      : matchers_(std::move(paths)) {}
+
+  bool Matches(const EvaluateArgs& args) const override;
+
+ private:
+  const StringMatcherSet matchers_;
+};
+
+// Matches the principal name against many matchers at once.  Used in place
+// of an OR of AuthenticatedAuthorizationMatchers.
+class AuthenticatedSetAuthorizationMatcher : public AuthorizationMatcher {
+ public:
+  explicit AuthenticatedSetAuthorizationMatcher(StringMatcherSet auths)
+      : matchers_(std::move(auths)) {}
+
+  bool Matches(const EvaluateArgs& args) const override;
+
+ private:
+  const StringMatcherSet matchers_;
+};
+
 // Performs a match for policy field in RBAC, which is a collection of
 // permission and principal matchers. Policy matches iff, we find a match in one
 // of its permissions and a match in one of its principals.
@@ -38,6 +38,7 @@
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
@@ -214,6 +215,16 @@ struct grpc_call_credentials
     return min_security_level_;
   }
 
+  // Returns how long the metadata added by GetRequestMetadata() for a given
+  // authority and method stays valid. When this is positive, the client auth
+  // filter of a channel using these credentials reuses that metadata for
+  // later calls to the same authority and method until it expires, instead
+  // of calling GetRequestMetadata() again. Credentials whose metadata may
+  // differ from one call to the next must return zero, which is the default.
+  virtual grpc_core::Duration cacheable_metadata_ttl() const {
+    return grpc_core::Duration::Zero();
+  }
+
   // Compares this grpc_call_credentials object with \a other.
   // If this method returns 0, it means that gRPC can treat the two call
   // credentials as effectively the same..
@@ -71,11 +71,13 @@ grpc_service_account_jwt_access_credentials::GetRequestMetadata(
   absl::optional<grpc_core::Slice> jwt_value;
   {
     gpr_mu_lock(&cache_mu_);
-    if (cached_.has_value() && cached_->service_url == *uri &&
+    auto it = cached_.find(*uri);
+    if (it != cached_.end() &&
         (gpr_time_cmp(
-             gpr_time_sub(cached_->jwt_expiration, gpr_now(GPR_CLOCK_REALTIME)),
+             gpr_time_sub(it->second.jwt_expiration,
+                          gpr_now(GPR_CLOCK_REALTIME)),
              refresh_threshold) > 0)) {
-      jwt_value = cached_->jwt_value.Ref();
+      jwt_value = it->second.jwt_value.Ref();
     }
     gpr_mu_unlock(&cache_mu_);
   }
@@ -84,14 +86,34 @@ grpc_service_account_jwt_access_credentials::GetRequestMetadata(
     char* jwt = nullptr;
     // Generate a new jwt.
     gpr_mu_lock(&cache_mu_);
-    cached_.reset();
+    cached_.erase(*uri);
     jwt = grpc_jwt_encode_and_sign(&key_, uri->c_str(), jwt_lifetime_, nullptr);
     if (jwt != nullptr) {
       std::string md_value = absl::StrCat("Bearer ", jwt);
       gpr_free(jwt);
       jwt_value = grpc_core::Slice::FromCopiedString(md_value);
-      cached_ = {jwt_value->Ref(), std::move(*uri),
-                 gpr_time_add(gpr_now(GPR_CLOCK_REALTIME), jwt_lifetime_)};
+      gpr_timespec now = gpr_now(GPR_CLOCK_REALTIME);
+      if (cached_.size() >= kMaxCachedJwts) {
+        // Makes room by dropping the jwts about to expire, or else the one
+        // expiring first.
+        auto soonest = cached_.end();
+        for (auto it = cached_.begin(); it != cached_.end();) {
+          if (gpr_time_cmp(gpr_time_sub(it->second.jwt_expiration, now),
+                           refresh_threshold) <= 0) {
+            cached_.erase(it++);
+            continue;
+          }
+          if (soonest == cached_.end() ||
+              gpr_time_cmp(it->second.jwt_expiration,
+                           soonest->second.jwt_expiration) < 0) {
+            soonest = it;
+          }
+          ++it;
+        }
+        if (cached_.size() >= kMaxCachedJwts) cached_.erase(soonest);
+      }
+      cached_[std::move(*uri)] = {jwt_value->Ref(),
+                                  gpr_time_add(now, jwt_lifetime_)};
     }
     gpr_mu_unlock(&cache_mu_);
   }
@@ -21,11 +21,13 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <initializer_list>
 #include <string>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
@@ -77,15 +79,16 @@ class grpc_service_account_jwt_access_credentials
         static_cast<const grpc_call_credentials*>(this), other);
   }
 
-  // Have a simple cache for now with just 1 entry. We could have a map based on
-  // the service_url for a more sophisticated one.
+  // The most jwts cached, one per service_url.
+  static constexpr size_t kMaxCachedJwts = 64;
+
   gpr_mu cache_mu_;
   struct Cache {
     grpc_core::Slice jwt_value;
-    std::string service_url;
     gpr_timespec jwt_expiration;
   };
-  absl::optional<Cache> cached_;
+  // Keyed by service_url.
+  absl::flat_hash_map<std::string, Cache> cached_;
 
   grpc_auth_json_key key_;
   gpr_timespec jwt_lifetime_;
@@ -27,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -38,10 +39,13 @@
 #include <openssl/rsa.h>
 #include <openssl/x509.h>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 
+#include <grpc/event_engine/event_engine.h>
+
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
@@ -49,10 +53,14 @@
 #include <grpc/support/string_util.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/http/httpcli.h"
 #include "src/core/lib/http/httpcli_ssl_credentials.h"
 #include "src/core/lib/http/parser.h"
@@ -61,6 +69,7 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/iomgr/polling_entity.h"
+#include "src/core/lib/iomgr/pollset_set.h"
 #include "src/core/lib/security/credentials/credentials.h"
 #include "src/core/lib/slice/b64.h"
 #include "src/core/lib/slice/slice.h"
@@ -351,6 +360,46 @@ grpc_jwt_verifier_status grpc_jwt_claims_check(const grpc_jwt_claims* claims,
   return GRPC_JWT_VERIFIER_OK;
 }
 
+// --- grpc_jwt_verifier object. ---
+
+// The most verification keys a verifier caches.
+constexpr size_t kMaxCachedVerificationKeys = 1024;
+
+struct email_key_mapping {
+  char* email_domain;
+  char* key_url_prefix;
+};
+
+struct cached_verification_key {
+  std::shared_ptr<EVP_PKEY> key;
+  // Once past this time, the key is still used but fetched again in the
+  // background.
+  gpr_timespec refresh_time;
+  gpr_timespec expiration;
+  bool refreshing;
+};
+
+// Verification keys are keyed by issuer, kid and alg.
+using verification_key_id = std::tuple<std::string, std::string, std::string>;
+
+// Each pending verification and key refresh holds a ref, so that they can
+// complete after grpc_jwt_verifier_destroy() drops the caller's.
+struct grpc_jwt_verifier : public grpc_core::RefCounted<grpc_jwt_verifier> {
+  grpc_jwt_verifier()
+      : pollent(grpc_polling_entity_create_from_pollset_set(
+            grpc_pollset_set_create())) {}
+  ~grpc_jwt_verifier() override;
+
+  email_key_mapping* mappings = nullptr;
+  size_t num_mappings = 0;  // Should be very few, linear search ok.
+  size_t allocated_mappings = 0;
+  // Used by the key fetches that have no caller pollset.
+  grpc_polling_entity pollent;
+  grpc_core::Mutex mu;
+  std::map<verification_key_id, cached_verification_key> key_cache
+      ABSL_GUARDED_BY(mu);
+};
+
 // --- verifier_cb_ctx object. ---
 
 typedef enum {
@@ -364,10 +413,12 @@ struct verifier_cb_ctx {
   grpc_polling_entity pollent;
   jose_header* header;
   grpc_jwt_claims* claims;
+  std::string issuer;
   char* audience;
   grpc_slice signature;
   grpc_slice signed_data;
   void* user_data;
+  // nullptr when the ctx only refreshes a cached key.
   grpc_jwt_verification_done_cb user_cb;
   grpc_http_response responses[HTTP_RESPONSE_COUNT];
   grpc_core::OrphanablePtr<grpc_core::HttpRequest> http_request;
@@ -381,8 +432,10 @@ static verifier_cb_ctx* verifier_cb_ctx_create(
   grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
   grpc_core::ExecCtx exec_ctx;
   verifier_cb_ctx* ctx = new verifier_cb_ctx();
-  ctx->verifier = verifier;
-  ctx->pollent = grpc_polling_entity_create_from_pollset(pollset);
+  ctx->verifier = verifier->Ref().release();
+  ctx->pollent = pollset != nullptr
+                     ? grpc_polling_entity_create_from_pollset(pollset)
+                     : verifier->pollent;
   ctx->header = header;
   ctx->audience = gpr_strdup(audience);
   ctx->claims = claims;
@@ -402,11 +455,88 @@ void verifier_cb_ctx_destroy(verifier_cb_ctx* ctx) {
   for (size_t i = 0; i < HTTP_RESPONSE_COUNT; i++) {
     grpc_http_response_destroy(&ctx->responses[i]);
   }
+  // Drops the ref last, as the http request may use the verifier's pollent.
+  ctx->http_request.reset();
+  ctx->verifier->Unref();
   // TODO(unknown): see what to do with claims...
   delete ctx;
 }
 
-// --- grpc_jwt_verifier object. ---
+// --- grpc_jwt_verifier key cache. ---
+
+// Key cache time to live defaults to ten minutes.
+grpc_core::Duration grpc_jwt_verifier_key_cache_ttl =
+    grpc_core::Duration::Minutes(10);
+
+grpc_jwt_verifier::~grpc_jwt_verifier() {
+  if (mappings != nullptr) {
+    for (size_t i = 0; i < num_mappings; i++) {
+      gpr_free(mappings[i].email_domain);
+      gpr_free(mappings[i].key_url_prefix);
+    }
+    gpr_free(mappings);
+  }
+  grpc_pollset_set_destroy(grpc_polling_entity_pollset_set(&pollent));
+}
+
+// Returns the cached key for id if any. Sets *start_refresh to true if the
+// caller needs to fetch the key again in the background.
+static std::shared_ptr<EVP_PKEY> verifier_lookup_key(
+    grpc_jwt_verifier* v, const verification_key_id& id, bool* start_refresh) {
+  *start_refresh = false;
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  grpc_core::MutexLock lock(&v->mu);
+  auto it = v->key_cache.find(id);
+  if (it == v->key_cache.end()) return nullptr;
+  if (gpr_time_cmp(now, it->second.expiration) >= 0) {
+    v->key_cache.erase(it);
+    return nullptr;
+  }
+  if (!it->second.refreshing &&
+      gpr_time_cmp(now, it->second.refresh_time) >= 0) {
+    it->second.refreshing = true;
+    *start_refresh = true;
+  }
+  return it->second.key;
+}
+
+static void verifier_cache_key(grpc_jwt_verifier* v,
+                               const verification_key_id& id,
+                               std::shared_ptr<EVP_PKEY> key) {
+  if (grpc_jwt_verifier_key_cache_ttl <= grpc_core::Duration::Zero()) return;
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  grpc_core::MutexLock lock(&v->mu);
+  if (v->key_cache.size() >= kMaxCachedVerificationKeys &&
+      v->key_cache.find(id) == v->key_cache.end()) {
+    for (auto it = v->key_cache.begin(); it != v->key_cache.end();) {
+      if (gpr_time_cmp(now, it->second.expiration) >= 0) {
+        it = v->key_cache.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    if (v->key_cache.size() >= kMaxCachedVerificationKeys) return;
+  }
+  cached_verification_key& entry = v->key_cache[id];
+  entry.key = std::move(key);
+  entry.refresh_time = gpr_time_add(
+      now, (grpc_jwt_verifier_key_cache_ttl / 2).as_timespec());
+  entry.expiration =
+      gpr_time_add(now, grpc_jwt_verifier_key_cache_ttl.as_timespec());
+  entry.refreshing = false;
+}
+
+// Lets a later verification retry a background refresh that failed.
+static void verifier_end_key_refresh(grpc_jwt_verifier* v,
+                                     const verification_key_id& id) {
+  grpc_core::MutexLock lock(&v->mu);
+  auto it = v->key_cache.find(id);
+  if (it != v->key_cache.end()) it->second.refreshing = false;
+}
+
+static verification_key_id verifier_cb_ctx_key_id(const verifier_cb_ctx* ctx) {
+  return verification_key_id(ctx->issuer, ctx->header->kid, ctx->header->alg);
+}
 
 // Clock skew defaults to one minute.
 gpr_timespec grpc_jwt_verifier_clock_skew = {60, 0, GPR_TIMESPAN};
@@ -415,16 +545,6 @@ gpr_timespec grpc_jwt_verifier_clock_skew = {60, 0, GPR_TIMESPAN};
 grpc_core::Duration grpc_jwt_verifier_max_delay =
     grpc_core::Duration::Minutes(1);
 
-struct email_key_mapping {
-  char* email_domain;
-  char* key_url_prefix;
-};
-struct grpc_jwt_verifier {
-  email_key_mapping* mappings;
-  size_t num_mappings;  // Should be very few, linear search ok.
-  size_t allocated_mappings;
-};
-
 static Json json_from_http(const grpc_http_response* response) {
   if (response == nullptr) {
     gpr_log(GPR_ERROR, "HTTP response is NULL.");
@@ -649,42 +769,59 @@ end:
   return result;
 }
 
+// Checks the signature and the claims of the JWT in ctx, and calls the user
+// callback with the result.
+static void verify_and_call_user_cb(verifier_cb_ctx* ctx,
+                                    EVP_PKEY* verification_key) {
+  grpc_jwt_verifier_status status;
+  grpc_jwt_claims* claims = nullptr;
+  if (!verify_jwt_signature(verification_key, ctx->header->alg, ctx->signature,
+                            ctx->signed_data)) {
+    status = GRPC_JWT_VERIFIER_BAD_SIGNATURE;
+  } else {
+    status = grpc_jwt_claims_check(ctx->claims, ctx->audience);
+    if (status == GRPC_JWT_VERIFIER_OK) {
+      // Pass ownership.
+      claims = ctx->claims;
+      ctx->claims = nullptr;
+    }
+  }
+  ctx->user_cb(ctx->user_data, status, claims);
+}
+
+// Reports a key retrieval error, or ends the key refresh of a refresh ctx,
+// and destroys ctx.
+static void verifier_cb_ctx_fail(verifier_cb_ctx* ctx) {
+  if (ctx->user_cb != nullptr) {
+    ctx->user_cb(ctx->user_data, GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR,
+                 nullptr);
+  } else {
+    verifier_end_key_refresh(ctx->verifier, verifier_cb_ctx_key_id(ctx));
+  }
+  verifier_cb_ctx_destroy(ctx);
+}
+
 static void on_keys_retrieved(void* user_data, grpc_error_handle /*error*/) {
   verifier_cb_ctx* ctx = static_cast<verifier_cb_ctx*>(user_data);
   Json json = json_from_http(&ctx->responses[HTTP_RESPONSE_KEYS]);
-  EVP_PKEY* verification_key = nullptr;
-  grpc_jwt_verifier_status status = GRPC_JWT_VERIFIER_GENERIC_ERROR;
-  grpc_jwt_claims* claims = nullptr;
-
   if (json.type() == Json::Type::JSON_NULL) {
-    status = GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR;
-    goto end;
+    verifier_cb_ctx_fail(ctx);
+    return;
   }
-  verification_key =
-      find_verification_key(json, ctx->header->alg, ctx->header->kid);
+  std::shared_ptr<EVP_PKEY> verification_key(
+      find_verification_key(json, ctx->header->alg, ctx->header->kid),
+      EVP_PKEY_free);
   if (verification_key == nullptr) {
     gpr_log(GPR_ERROR, "Could not find verification key with kid %s.",
             ctx->header->kid);
-    status = GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR;
-    goto end;
-  }
-
-  if (!verify_jwt_signature(verification_key, ctx->header->alg, ctx->signature,
-                            ctx->signed_data)) {
-    status = GRPC_JWT_VERIFIER_BAD_SIGNATURE;
-    goto end;
+    verifier_cb_ctx_fail(ctx);
+    return;
   }
-
-  status = grpc_jwt_claims_check(ctx->claims, ctx->audience);
-  if (status == GRPC_JWT_VERIFIER_OK) {
-    // Pass ownership.
-    claims = ctx->claims;
-    ctx->claims = nullptr;
+  verifier_cache_key(ctx->verifier, verifier_cb_ctx_key_id(ctx),
+                     verification_key);
+  if (ctx->user_cb != nullptr) {
+    verify_and_call_user_cb(ctx, verification_key.get());
   }
-
-end:
-  EVP_PKEY_free(verification_key);
-  ctx->user_cb(ctx->user_data, status, claims);
   verifier_cb_ctx_destroy(ctx);
 }
 
@@ -742,8 +879,7 @@ static void on_openid_config_retrieved(void* user_data,
   return;
 
 error:
-  ctx->user_cb(ctx->user_data, GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR, nullptr);
-  verifier_cb_ctx_destroy(ctx);
+  verifier_cb_ctx_fail(ctx);
 }
 
 static email_key_mapping* verifier_get_mapping(grpc_jwt_verifier* v,
@@ -805,15 +941,35 @@ static void retrieve_key_and_verify(verifier_cb_ctx* ctx) {
 
   GPR_ASSERT(ctx != nullptr && ctx->header != nullptr &&
              ctx->claims != nullptr);
-  iss = ctx->claims->iss;
   if (ctx->header->kid == nullptr) {
     gpr_log(GPR_ERROR, "Missing kid in jose header.");
     goto error;
   }
-  if (iss == nullptr) {
+  if (ctx->claims->iss == nullptr) {
     gpr_log(GPR_ERROR, "Missing iss in claims.");
     goto error;
   }
+  // The claims are handed over to the user callback, so keeps a copy of the
+  // issuer.
+  ctx->issuer = ctx->claims->iss;
+  iss = ctx->issuer.c_str();
+
+  // Uses the cached key if any. When it is due for a refresh, ctx then fetches
+  // it again in the background.
+  {
+    bool start_refresh = false;
+    std::shared_ptr<EVP_PKEY> cached_key = verifier_lookup_key(
+        ctx->verifier, verifier_cb_ctx_key_id(ctx), &start_refresh);
+    if (cached_key != nullptr) {
+      verify_and_call_user_cb(ctx, cached_key.get());
+      if (!start_refresh) {
+        verifier_cb_ctx_destroy(ctx);
+        return;
+      }
+      ctx->user_cb = nullptr;
+      ctx->pollent = ctx->verifier->pollent;
+    }
+  }
 
   // This code relies on:
   // https://openid.net/specs/openid-connect-discovery-1_0.html
@@ -872,8 +1028,7 @@ static void retrieve_key_and_verify(verifier_cb_ctx* ctx) {
   return;
 
 error:
-  ctx->user_cb(ctx->user_data, GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR, nullptr);
-  verifier_cb_ctx_destroy(ctx);
+  verifier_cb_ctx_fail(ctx);
 }
 
 void grpc_jwt_verifier_verify(grpc_jwt_verifier* verifier,
@@ -921,10 +1076,30 @@ error:
   cb(user_data, GRPC_JWT_VERIFIER_BAD_FORMAT, nullptr);
 }
 
+void grpc_jwt_verifier_verify_batch(
+    grpc_jwt_verifier* verifier,
+    const grpc_jwt_verifier_batch_entry* entries, size_t num_entries) {
+  GPR_ASSERT(verifier != nullptr && (entries != nullptr || num_entries == 0));
+  auto event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  for (size_t i = 0; i < num_entries; i++) {
+    const grpc_jwt_verifier_batch_entry& entry = entries[i];
+    GPR_ASSERT(entry.jwt != nullptr && entry.audience != nullptr &&
+               entry.cb != nullptr);
+    event_engine->Run([verifier = verifier->Ref(), jwt = std::string(entry.jwt),
+                       audience = std::string(entry.audience), cb = entry.cb,
+                       user_data = entry.user_data]() {
+      grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+      grpc_core::ExecCtx exec_ctx;
+      grpc_jwt_verifier_verify(verifier.get(), nullptr, jwt.c_str(),
+                               audience.c_str(), cb, user_data);
+    });
+  }
+}
+
 grpc_jwt_verifier* grpc_jwt_verifier_create(
     const grpc_jwt_verifier_email_domain_key_url_mapping* mappings,
     size_t num_mappings) {
-  grpc_jwt_verifier* v = grpc_core::Zalloc<grpc_jwt_verifier>();
+  grpc_jwt_verifier* v = new grpc_jwt_verifier();
 
   // We know at least of one mapping.
   v->allocated_mappings = 1 + num_mappings;
@@ -944,14 +1119,6 @@ grpc_jwt_verifier* grpc_jwt_verifier_create(
 }
 
 void grpc_jwt_verifier_destroy(grpc_jwt_verifier* v) {
-  size_t i;
   if (v == nullptr) return;
-  if (v->mappings != nullptr) {
-    for (i = 0; i < v->num_mappings; i++) {
-      gpr_free(v->mappings[i].email_domain);
-      gpr_free(v->mappings[i].key_url_prefix);
-    }
-    gpr_free(v->mappings);
-  }
-  gpr_free(v);
+  v->Unref();
 }
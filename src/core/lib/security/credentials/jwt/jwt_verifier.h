@@ -85,6 +85,10 @@ struct grpc_jwt_verifier_email_domain_key_url_mapping {
 // Globals to control the verifier. Not thread-safe.
 extern gpr_timespec grpc_jwt_verifier_clock_skew;
 extern grpc_core::Duration grpc_jwt_verifier_max_delay;
+// How long a verifier keeps the verification keys it fetched. A key is fetched
+// again in the background once half of this has elapsed. Zero disables the
+// cache.
+extern grpc_core::Duration grpc_jwt_verifier_key_cache_ttl;
 
 // The verifier can be created with some custom mappings to help with key
 // discovery in the case where the issuer is an email address.
@@ -96,7 +100,7 @@ grpc_jwt_verifier* grpc_jwt_verifier_create(
     const grpc_jwt_verifier_email_domain_key_url_mapping* mappings,
     size_t num_mappings);
 
-// The verifier must not be destroyed if there are still outstanding callbacks.
+// Outstanding verifications complete after the verifier is destroyed.
 void grpc_jwt_verifier_destroy(grpc_jwt_verifier* verifier);
 
 // User provided callback that will be called when the verification of the JWT
@@ -108,12 +112,27 @@ typedef void (*grpc_jwt_verification_done_cb)(void* user_data,
                                               grpc_jwt_claims* claims);
 
 // Verifies for the JWT for the given expected audience.
+// pollset may be NULL, in which case key retrieval is driven by the verifier.
 void grpc_jwt_verifier_verify(grpc_jwt_verifier* verifier,
                               grpc_pollset* pollset, const char* jwt,
                               const char* audience,
                               grpc_jwt_verification_done_cb cb,
                               void* user_data);
 
+struct grpc_jwt_verifier_batch_entry {
+  const char* jwt;
+  const char* audience;
+  grpc_jwt_verification_done_cb cb;
+  void* user_data;
+};
+
+// Verifies each of the num_entries JWTs like grpc_jwt_verifier_verify() does,
+// spread over the threads of the default EventEngine. The JWTs and audiences
+// are copied, and each callback may be called in a different thread.
+void grpc_jwt_verifier_verify_batch(
+    grpc_jwt_verifier* verifier, const grpc_jwt_verifier_batch_entry* entries,
+    size_t num_entries);
+
 // --- TESTING ONLY exposed functions. ---
 
 grpc_jwt_claims* grpc_jwt_claims_from_json(grpc_core::Json json);
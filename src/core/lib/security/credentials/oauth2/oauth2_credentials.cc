@@ -63,6 +63,17 @@
 
 using grpc_core::Json;
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_oauth2_token_refresh_percent, 0,
+    "If between 1 and 99, OAuth2 token fetcher credentials start fetching a "
+    "new token in the background once this percentage of the token lifetime "
+    "has elapsed, while calls keep using the current token.");
+GPR_GLOBAL_CONFIG_DEFINE_BOOL(
+    grpc_oauth2_stale_token_while_revalidate, false,
+    "If true, OAuth2 token fetcher credentials keep using a token that is "
+    "about to expire while a new one is fetched, instead of holding calls "
+    "until the fetch completes.");
+
 //
 // Auth Refresh Token.
 //
@@ -231,6 +242,9 @@ end:
   return status;
 }
 
+// How long to wait before retrying a background token fetch that failed.
+constexpr int64_t kBackgroundTokenFetchRetryDelaySecs = 5;
+
 static void on_oauth2_token_fetcher_http_response(void* user_data,
                                                   grpc_error_handle error) {
   GRPC_LOG_IF_ERROR("oauth_fetch", error);
@@ -252,15 +266,31 @@ void grpc_oauth2_token_fetcher_credentials::on_http_response(
   // Update cache and grab list of pending requests.
   gpr_mu_lock(&mu_);
   token_fetch_pending_ = false;
-  if (access_token_value.has_value()) {
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  if (status == GRPC_CREDENTIALS_OK) {
     access_token_value_ = access_token_value->Ref();
+    token_expiration_ = gpr_time_add(now, token_lifetime.as_timespec());
+    token_refresh_time_ = gpr_time_sub(
+        token_expiration_,
+        gpr_time_from_seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS,
+                              GPR_TIMESPAN));
+    if (token_refresh_percent_ > 0 && token_refresh_percent_ < 100) {
+      token_refresh_time_ = gpr_time_min(
+          token_refresh_time_,
+          gpr_time_add(now, (token_lifetime * token_refresh_percent_ / 100)
+                                .as_timespec()));
+    }
+  } else if (access_token_value_.has_value() &&
+             gpr_time_cmp(token_expiration_, now) > 0) {
+    // A background fetch failed while the current token is still valid. Keeps
+    // using it, and retries on a later call.
+    token_refresh_time_ = gpr_time_add(
+        now, gpr_time_from_seconds(kBackgroundTokenFetchRetryDelaySecs,
+                                   GPR_TIMESPAN));
   } else {
     access_token_value_ = absl::nullopt;
+    token_expiration_ = gpr_inf_past(GPR_CLOCK_MONOTONIC);
   }
-  token_expiration_ = status == GRPC_CREDENTIALS_OK
-                          ? gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
-                                         token_lifetime.as_timespec())
-                          : gpr_inf_past(GPR_CLOCK_MONOTONIC);
   grpc_oauth2_pending_get_request_metadata* pending_request = pending_requests_;
   pending_requests_ = nullptr;
   gpr_mu_unlock(&mu_);
@@ -291,18 +321,37 @@ grpc_core::ArenaPromise<absl::StatusOr<grpc_core::ClientMetadataHandle>>
 grpc_oauth2_token_fetcher_credentials::GetRequestMetadata(
     grpc_core::ClientMetadataHandle initial_metadata,
     const grpc_call_credentials::GetRequestMetadataArgs*) {
-  // Check if we can use the cached token.
+  // Check if we can use the cached token. A token that is about to expire is
+  // only used while a new one is fetched in stale-while-revalidate mode.
   absl::optional<grpc_core::Slice> cached_access_token_value;
+  bool start_background_fetch = false;
   gpr_mu_lock(&mu_);
-  if (access_token_value_.has_value() &&
-      gpr_time_cmp(
-          gpr_time_sub(token_expiration_, gpr_now(GPR_CLOCK_MONOTONIC)),
-          gpr_time_from_seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS,
-                                GPR_TIMESPAN)) > 0) {
-    cached_access_token_value = access_token_value_->Ref();
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  if (access_token_value_.has_value()) {
+    gpr_timespec time_to_expiration = gpr_time_sub(token_expiration_, now);
+    if (gpr_time_cmp(time_to_expiration,
+                     gpr_time_from_seconds(
+                         GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS,
+                         GPR_TIMESPAN)) > 0 ||
+        (stale_token_while_revalidate_ &&
+         gpr_time_cmp(time_to_expiration, gpr_time_0(GPR_TIMESPAN)) > 0)) {
+      cached_access_token_value = access_token_value_->Ref();
+      if (!token_fetch_pending_ &&
+          gpr_time_cmp(now, token_refresh_time_) >= 0) {
+        token_fetch_pending_ = true;
+        start_background_fetch = true;
+      }
+    }
   }
   if (cached_access_token_value.has_value()) {
     gpr_mu_unlock(&mu_);
+    if (start_background_fetch) {
+      fetch_oauth2(new grpc_credentials_metadata_request(Ref()), &pollent_,
+                   on_oauth2_token_fetcher_http_response,
+                   grpc_core::Timestamp::Now() +
+                       grpc_core::Duration::Seconds(
+                           GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS));
+    }
     initial_metadata->Append(
         GRPC_AUTHORIZATION_METADATA_KEY, std::move(*cached_access_token_value),
         [](absl::string_view, const grpc_core::Slice&) { abort(); });
@@ -344,6 +393,11 @@ grpc_oauth2_token_fetcher_credentials::GetRequestMetadata(
 
 grpc_oauth2_token_fetcher_credentials::grpc_oauth2_token_fetcher_credentials()
     : token_expiration_(gpr_inf_past(GPR_CLOCK_MONOTONIC)),
+      token_refresh_time_(gpr_inf_future(GPR_CLOCK_MONOTONIC)),
+      token_refresh_percent_(
+          GPR_GLOBAL_CONFIG_GET(grpc_oauth2_token_refresh_percent)),
+      stale_token_while_revalidate_(
+          GPR_GLOBAL_CONFIG_GET(grpc_oauth2_stale_token_while_revalidate)),
       pollent_(grpc_polling_entity_create_from_pollset_set(
           grpc_pollset_set_create())) {
   gpr_mu_init(&mu_);
@@ -34,6 +34,7 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -52,6 +53,9 @@
 #include "src/core/lib/transport/transport.h"
 #include "src/core/lib/uri/uri_parser.h"
 
+GPR_GLOBAL_CONFIG_DECLARE_INT32(grpc_oauth2_token_refresh_percent);
+GPR_GLOBAL_CONFIG_DECLARE_BOOL(grpc_oauth2_stale_token_while_revalidate);
+
 // Constants.
 #define GRPC_STS_POST_MINIMAL_BODY_FORMAT_STRING                               \
   "grant_type=urn:ietf:params:oauth:grant-type:token-exchange&subject_token=%" \
@@ -140,7 +144,13 @@ class grpc_oauth2_token_fetcher_credentials : public grpc_call_credentials {
   gpr_mu mu_;
   absl::optional<grpc_core::Slice> access_token_value_;
   gpr_timespec token_expiration_;
+  // Once past this time, the next call starts fetching a new token in the
+  // background while it still uses the current one.
+  gpr_timespec token_refresh_time_;
   bool token_fetch_pending_ = false;
+  // Read from the global config when the credentials are created.
+  const int32_t token_refresh_percent_;
+  const bool stale_token_while_revalidate_;
   grpc_oauth2_pending_get_request_metadata* pending_requests_ = nullptr;
   grpc_polling_entity pollent_;
 };
@@ -20,6 +20,9 @@
 
 #include "src/core/lib/security/credentials/plugin/plugin_credentials.h"
 
+#include <inttypes.h>
+
+#include <algorithm>
 #include <atomic>
 #include <memory>
 
@@ -202,8 +205,10 @@ grpc_plugin_credentials::GetRequestMetadata(
 
 grpc_plugin_credentials::grpc_plugin_credentials(
     grpc_metadata_credentials_plugin plugin,
-    grpc_security_level min_security_level)
-    : grpc_call_credentials(min_security_level), plugin_(plugin) {}
+    grpc_security_level min_security_level, grpc_core::Duration metadata_ttl)
+    : grpc_call_credentials(min_security_level),
+      plugin_(plugin),
+      metadata_ttl_(metadata_ttl) {}
 
 grpc_call_credentials* grpc_metadata_credentials_create_from_plugin(
     grpc_metadata_credentials_plugin plugin,
@@ -213,3 +218,22 @@ grpc_call_credentials* grpc_metadata_credentials_create_from_plugin(
   GPR_ASSERT(reserved == nullptr);
   return new grpc_plugin_credentials(plugin, min_security_level);
 }
+
+grpc_call_credentials*
+grpc_metadata_credentials_create_from_plugin_with_metadata_ttl(
+    grpc_metadata_credentials_plugin plugin,
+    grpc_security_level min_security_level, gpr_timespec metadata_ttl,
+    void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_metadata_credentials_create_from_plugin_with_metadata_ttl("
+      "metadata_ttl=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, reserved=%p)",
+      4,
+      (metadata_ttl.tv_sec, static_cast<int>(metadata_ttl.tv_nsec),
+       static_cast<int>(metadata_ttl.clock_type), reserved));
+  GPR_ASSERT(reserved == nullptr);
+  return new grpc_plugin_credentials(
+      plugin, min_security_level,
+      std::max(grpc_core::Duration::FromTimespec(metadata_ttl),
+               grpc_core::Duration::Zero()));
+}
@@ -39,6 +39,7 @@
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/arena_promise.h"
@@ -55,14 +56,20 @@ extern grpc_core::TraceFlag grpc_plugin_credentials_trace;
 // -Wmismatched-tags.
 struct grpc_plugin_credentials final : public grpc_call_credentials {
  public:
-  explicit grpc_plugin_credentials(grpc_metadata_credentials_plugin plugin,
-                                   grpc_security_level min_security_level);
+  explicit grpc_plugin_credentials(
+      grpc_metadata_credentials_plugin plugin,
+      grpc_security_level min_security_level,
+      grpc_core::Duration metadata_ttl = grpc_core::Duration::Zero());
   ~grpc_plugin_credentials() override;
 
   grpc_core::ArenaPromise<absl::StatusOr<grpc_core::ClientMetadataHandle>>
   GetRequestMetadata(grpc_core::ClientMetadataHandle initial_metadata,
                      const GetRequestMetadataArgs* args) override;
 
+  grpc_core::Duration cacheable_metadata_ttl() const override {
+    return metadata_ttl_;
+  }
+
   std::string debug_string() override;
 
   grpc_core::UniqueTypeName type() const override;
@@ -120,6 +127,7 @@ struct grpc_plugin_credentials final : public grpc_call_credentials {
   }
 
   grpc_metadata_credentials_plugin plugin_;
+  const grpc_core::Duration metadata_ttl_;
 };
 
 #endif  // GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_PLUGIN_PLUGIN_CREDENTIALS_H
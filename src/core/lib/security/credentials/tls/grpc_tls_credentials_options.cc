@@ -48,6 +48,26 @@ void grpc_tls_credentials_options_set_verify_server_cert(
   options->set_verify_server_cert(verify_server_cert);
 }
 
+void grpc_tls_credentials_options_set_verified_peer_cache_size(
+    grpc_tls_credentials_options* options, size_t verified_peer_cache_size) {
+  GPR_ASSERT(options != nullptr);
+  options->set_verified_peer_cache_size(verified_peer_cache_size);
+}
+
+void grpc_tls_credentials_options_set_early_data(
+    grpc_tls_credentials_options* options, int enable_early_data) {
+  GPR_ASSERT(options != nullptr);
+  options->set_early_data(enable_early_data != 0);
+}
+
+void grpc_tls_credentials_options_set_early_data_anti_replay_capacity(
+    grpc_tls_credentials_options* options,
+    size_t early_data_anti_replay_capacity) {
+  GPR_ASSERT(options != nullptr);
+  options->set_early_data_anti_replay_capacity(
+      early_data_anti_replay_capacity);
+}
+
 void grpc_tls_credentials_options_set_certificate_provider(
     grpc_tls_credentials_options* options,
     grpc_tls_certificate_provider* provider) {
@@ -96,6 +116,24 @@ void grpc_tls_credentials_options_set_crl_directory(
   options->set_crl_directory(crl_directory);
 }
 
+void grpc_tls_credentials_options_set_session_ticket_key_provider(
+    grpc_tls_credentials_options* options,
+    grpc_tls_session_ticket_key_provider* provider) {
+  GPR_ASSERT(options != nullptr);
+  GPR_ASSERT(provider != nullptr);
+  grpc_core::ExecCtx exec_ctx;
+  options->set_session_ticket_key_provider(provider->Ref());
+}
+
+void grpc_tls_credentials_options_set_private_key_signer(
+    grpc_tls_credentials_options* options,
+    grpc_tls_private_key_signer* signer) {
+  GPR_ASSERT(options != nullptr);
+  GPR_ASSERT(signer != nullptr);
+  grpc_core::ExecCtx exec_ctx;
+  options->set_private_key_signer(signer->Ref());
+}
+
 void grpc_tls_credentials_options_set_check_call_host(
     grpc_tls_credentials_options* options, int check_call_host) {
   GPR_ASSERT(options != nullptr);
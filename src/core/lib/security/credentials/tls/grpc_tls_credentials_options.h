@@ -31,6 +31,8 @@
 #include "src/core/lib/security/credentials/tls/grpc_tls_certificate_distributor.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_certificate_provider.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_certificate_verifier.h"
+#include "src/core/lib/security/credentials/tls/grpc_tls_private_key_signer.h"
+#include "src/core/lib/security/credentials/tls/grpc_tls_session_ticket_key_provider.h"
 #include "src/core/lib/security/security_connector/ssl_utils.h"
 
 // Contains configurable options specified by callers to configure their certain
@@ -61,6 +63,15 @@ struct grpc_tls_credentials_options
   const std::string& identity_cert_name() const { return identity_cert_name_; }
   const std::string& tls_session_key_log_file_path() const { return tls_session_key_log_file_path_; }
   const std::string& crl_directory() const { return crl_directory_; }
+  grpc_tls_session_ticket_key_provider* session_ticket_key_provider() const {
+    return session_ticket_key_provider_.get();
+  }
+  tsi::SslPrivateKeySigner* private_key_signer() const {
+    return private_key_signer_.get();
+  }
+  size_t verified_peer_cache_size() const { return verified_peer_cache_size_; }
+  bool early_data() const { return early_data_; }
+  size_t early_data_anti_replay_capacity() const { return early_data_anti_replay_capacity_; }
 
   // Setters for member fields.
   void set_cert_request_type(grpc_ssl_client_certificate_request_type cert_request_type) { cert_request_type_ = cert_request_type; }
@@ -81,6 +92,16 @@ struct grpc_tls_credentials_options
   void set_tls_session_key_log_file_path(std::string tls_session_key_log_file_path) { tls_session_key_log_file_path_ = std::move(tls_session_key_log_file_path); }
   //  gRPC will enforce CRLs on all handshakes from all hashed CRL files inside of the crl_directory. If not set, an empty string will be used, which will not enable CRL checking. Only supported for OpenSSL version > 1.1.
   void set_crl_directory(std::string crl_directory) { crl_directory_ = std::move(crl_directory); }
+  //  Sets the provider of the keys that the server encrypts and decrypts session tickets with. If not set, the keys are generated by each server handshaker factory and not shared.
+  void set_session_ticket_key_provider(grpc_core::RefCountedPtr<grpc_tls_session_ticket_key_provider> session_ticket_key_provider) { session_ticket_key_provider_ = std::move(session_ticket_key_provider); }
+  //  Sets the signer that signs the server's handshakes, in place of the private keys of its identity key-cert pairs, which may then be empty. Only supported with BoringSSL.
+  void set_private_key_signer(grpc_core::RefCountedPtr<tsi::SslPrivateKeySigner> private_key_signer) { private_key_signer_ = std::move(private_key_signer); }
+  //  Sets how many peers that passed the certificate verifier are remembered, so that new connections to them skip it. The default value is 0, which disables the cache. Only used on the client side.
+  void set_verified_peer_cache_size(size_t verified_peer_cache_size) { verified_peer_cache_size_ = verified_peer_cache_size; }
+  //  Sets whether TLS 1.3 0-RTT early data is sent by clients resuming sessions, and accepted by servers. Early data may be replayed, so clients shall only enable it when all their RPCs are safe to be processed more than once. Only supported with BoringSSL.
+  void set_early_data(bool early_data) { early_data_ = early_data; }
+  //  Sets how many ClientHellos a server accepting early data remembers, to reject the early data of replayed ones. 0 disables replay detection. Only used on the server side.
+  void set_early_data_anti_replay_capacity(size_t early_data_anti_replay_capacity) { early_data_anti_replay_capacity_ = early_data_anti_replay_capacity; }
 
   bool operator==(const grpc_tls_credentials_options& other) const {
     return cert_request_type_ == other.cert_request_type_ &&
@@ -95,7 +116,12 @@ struct grpc_tls_credentials_options
       watch_identity_pair_ == other.watch_identity_pair_ &&
       identity_cert_name_ == other.identity_cert_name_ &&
       tls_session_key_log_file_path_ == other.tls_session_key_log_file_path_ &&
-      crl_directory_ == other.crl_directory_;
+      crl_directory_ == other.crl_directory_ &&
+      session_ticket_key_provider_ == other.session_ticket_key_provider_ &&
+      private_key_signer_ == other.private_key_signer_ &&
+      verified_peer_cache_size_ == other.verified_peer_cache_size_ &&
+      early_data_ == other.early_data_ &&
+      early_data_anti_replay_capacity_ == other.early_data_anti_replay_capacity_;
   }
 
  private:
@@ -112,6 +138,11 @@ struct grpc_tls_credentials_options
   std::string identity_cert_name_;
   std::string tls_session_key_log_file_path_;
   std::string crl_directory_;
+  grpc_core::RefCountedPtr<grpc_tls_session_ticket_key_provider> session_ticket_key_provider_;
+  grpc_core::RefCountedPtr<tsi::SslPrivateKeySigner> private_key_signer_;
+  size_t verified_peer_cache_size_ = 0;
+  bool early_data_ = false;
+  size_t early_data_anti_replay_capacity_ = 10000;
 };
 
 #endif  // GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_CREDENTIALS_OPTIONS_H
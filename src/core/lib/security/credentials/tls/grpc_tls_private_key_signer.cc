@@ -0,0 +1,78 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/security/credentials/tls/grpc_tls_private_key_signer.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/surface/api_trace.h"
+
+namespace grpc_core {
+
+//
+// ExternalPrivateKeySigner
+//
+
+void ExternalPrivateKeySigner::Sign(absl::string_view data,
+                                    uint16_t signature_algorithm,
+                                    OnSignDone on_done) {
+  // Owned by the callback, which the external signer invokes exactly once.
+  auto* callback_arg = new OnSignDone(std::move(on_done));
+  external_signer_.sign(external_signer_.user_data,
+                        reinterpret_cast<const unsigned char*>(data.data()),
+                        data.size(), signature_algorithm, &OnExternalSignDone,
+                        callback_arg);
+}
+
+void ExternalPrivateKeySigner::OnExternalSignDone(
+    void* callback_arg, grpc_status_code status, const char* error_details,
+    const unsigned char* signature, size_t signature_size) {
+  ExecCtx exec_ctx;
+  std::unique_ptr<OnSignDone> on_done(static_cast<OnSignDone*>(callback_arg));
+  if (status != GRPC_STATUS_OK) {
+    (*on_done)(absl::Status(static_cast<absl::StatusCode>(status),
+                            error_details == nullptr ? "" : error_details));
+    return;
+  }
+  (*on_done)(std::string(reinterpret_cast<const char*>(signature),
+                         signature_size));
+}
+
+}  // namespace grpc_core
+
+grpc_tls_private_key_signer* grpc_tls_private_key_signer_external_create(
+    const grpc_tls_private_key_signer_external* external_signer) {
+  GPR_ASSERT(external_signer != nullptr);
+  GPR_ASSERT(external_signer->sign != nullptr);
+  return new grpc_core::ExternalPrivateKeySigner(*external_signer);
+}
+
+void grpc_tls_private_key_signer_release(grpc_tls_private_key_signer* signer) {
+  GRPC_API_TRACE("grpc_tls_private_key_signer_release(signer=%p)", 1,
+                 (signer));
+  grpc_core::ExecCtx exec_ctx;
+  if (signer != nullptr) signer->Unref();
+}
@@ -0,0 +1,66 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_PRIVATE_KEY_SIGNER_H
+#define GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_PRIVATE_KEY_SIGNER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/strings/string_view.h"
+
+#include <grpc/grpc_security.h>
+#include <grpc/status.h>
+
+#include "src/core/tsi/ssl/private_key_signer/ssl_private_key_signer.h"
+
+// The signer set on the TLS credentials options of a server, which the
+// server's handshaker factories sign their handshakes with.
+struct grpc_tls_private_key_signer : public tsi::SslPrivateKeySigner {};
+
+namespace grpc_core {
+
+// A signer that will transform grpc_tls_private_key_signer_external to a
+// signer that extends grpc_tls_private_key_signer.
+class ExternalPrivateKeySigner final : public grpc_tls_private_key_signer {
+ public:
+  explicit ExternalPrivateKeySigner(
+      const grpc_tls_private_key_signer_external& external_signer)
+      : external_signer_(external_signer) {}
+
+  ~ExternalPrivateKeySigner() override {
+    if (external_signer_.destruct != nullptr) {
+      external_signer_.destruct(external_signer_.user_data);
+    }
+  }
+
+  void Sign(absl::string_view data, uint16_t signature_algorithm,
+            OnSignDone on_done) override;
+
+ private:
+  static void OnExternalSignDone(void* callback_arg, grpc_status_code status,
+                                 const char* error_details,
+                                 const unsigned char* signature,
+                                 size_t signature_size);
+
+  const grpc_tls_private_key_signer_external external_signer_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_PRIVATE_KEY_SIGNER_H
@@ -0,0 +1,130 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/security/credentials/tls/grpc_tls_session_ticket_key_provider.h"
+
+#include <stdint.h>
+
+#include <utility>
+
+#include <openssl/crypto.h>
+
+#include <grpc/slice.h>
+#include <grpc/support/log.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/load_file.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/surface/api_trace.h"
+
+namespace grpc_core {
+
+namespace {
+
+gpr_timespec TimeoutSecondsToDeadline(int64_t seconds) {
+  return gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                      gpr_time_from_seconds(seconds, GPR_TIMESPAN));
+}
+
+}  // namespace
+
+FileWatcherSessionTicketKeyProvider::FileWatcherSessionTicketKeyProvider(
+    std::string key_file_path, int64_t refresh_interval_sec)
+    : key_file_path_(std::move(key_file_path)),
+      refresh_interval_sec_(refresh_interval_sec) {
+  GPR_ASSERT(!key_file_path_.empty());
+  gpr_event_init(&shutdown_event_);
+  ForceUpdate();
+  auto thread_lambda = [](void* arg) {
+    FileWatcherSessionTicketKeyProvider* provider =
+        static_cast<FileWatcherSessionTicketKeyProvider*>(arg);
+    GPR_ASSERT(provider != nullptr);
+    while (true) {
+      void* value = gpr_event_wait(
+          &provider->shutdown_event_,
+          TimeoutSecondsToDeadline(provider->refresh_interval_sec_));
+      if (value != nullptr) {
+        return;
+      };
+      provider->ForceUpdate();
+    }
+  };
+  refresh_thread_ =
+      Thread("FileWatcherSessionTicketKeyProvider_refreshing_thread",
+             thread_lambda, this);
+  refresh_thread_.Start();
+}
+
+FileWatcherSessionTicketKeyProvider::~FileWatcherSessionTicketKeyProvider() {
+  gpr_event_set(&shutdown_event_, reinterpret_cast<void*>(1));
+  refresh_thread_.Join();
+}
+
+void FileWatcherSessionTicketKeyProvider::ForceUpdate() {
+  grpc_slice key_slice = grpc_empty_slice();
+  grpc_error_handle error =
+      grpc_load_file(key_file_path_.c_str(), 0, &key_slice);
+  if (!error.ok()) {
+    gpr_log(GPR_ERROR, "Reading file %s failed: %s", key_file_path_.c_str(),
+            StatusToString(error).c_str());
+    return;
+  }
+  if (!SetKeys(StringViewFromSlice(key_slice))) {
+    gpr_log(GPR_ERROR,
+            "Session ticket key file %s is not made of %zu byte keys.",
+            key_file_path_.c_str(), tsi::SslSessionTicketKeyRing::kKeySize);
+  }
+  OPENSSL_cleanse(GRPC_SLICE_START_PTR(key_slice), GRPC_SLICE_LENGTH(key_slice));
+  CSliceUnref(key_slice);
+}
+
+}  // namespace grpc_core
+
+grpc_tls_session_ticket_key_provider*
+grpc_tls_session_ticket_key_provider_in_memory_create(void) {
+  return new grpc_tls_session_ticket_key_provider();
+}
+
+int grpc_tls_session_ticket_key_provider_in_memory_set_keys(
+    grpc_tls_session_ticket_key_provider* provider, const char* keys,
+    size_t keys_size) {
+  GPR_ASSERT(provider != nullptr);
+  if (keys == nullptr) return 0;
+  return provider->SetKeys(absl::string_view(keys, keys_size));
+}
+
+grpc_tls_session_ticket_key_provider*
+grpc_tls_session_ticket_key_provider_file_watcher_create(
+    const char* key_file_path, unsigned int refresh_interval_sec) {
+  GPR_ASSERT(key_file_path != nullptr);
+  grpc_core::ExecCtx exec_ctx;
+  return new grpc_core::FileWatcherSessionTicketKeyProvider(
+      key_file_path, refresh_interval_sec);
+}
+
+void grpc_tls_session_ticket_key_provider_release(
+    grpc_tls_session_ticket_key_provider* provider) {
+  GRPC_API_TRACE("grpc_tls_session_ticket_key_provider_release(provider=%p)",
+                 1, (provider));
+  grpc_core::ExecCtx exec_ctx;
+  if (provider != nullptr) provider->Unref();
+}
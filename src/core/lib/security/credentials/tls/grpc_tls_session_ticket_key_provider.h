@@ -0,0 +1,86 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_SESSION_TICKET_KEY_PROVIDER_H
+#define GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_SESSION_TICKET_KEY_PROVIDER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <string>
+
+#include "absl/strings/string_view.h"
+
+#include <grpc/grpc_security.h>
+#include <grpc/support/sync.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/thd.h"
+#include "src/core/tsi/ssl/session_ticket/ssl_session_ticket_key_ring.h"
+
+// Supplies the keys that TLS servers encrypt and decrypt session tickets
+// with. Servers that are given the same keys, from the same file or secret
+// store, resume the sessions that any of them set up, so clients spread over
+// them by a load balancer skip the full handshake. The keys live in a
+// tsi::SslSessionTicketKeyRing, which the handshaker factories of the servers
+// using this provider share and which sees every key update right away.
+//
+// This provider holds keys that its owner sets through SetKeys(); subclasses
+// may fetch them from elsewhere.
+struct grpc_tls_session_ticket_key_provider
+    : public grpc_core::RefCounted<grpc_tls_session_ticket_key_provider> {
+ public:
+  grpc_tls_session_ticket_key_provider()
+      : key_ring_(grpc_core::MakeRefCounted<tsi::SslSessionTicketKeyRing>()) {}
+
+  // Replaces the keys, see tsi::SslSessionTicketKeyRing::SetKeys().
+  bool SetKeys(absl::string_view keys) { return key_ring_->SetKeys(keys); }
+
+  tsi::SslSessionTicketKeyRing* key_ring() const { return key_ring_.get(); }
+
+ private:
+  grpc_core::RefCountedPtr<tsi::SslSessionTicketKeyRing> key_ring_;
+};
+
+namespace grpc_core {
+
+// A provider that reads the keys from a file, and reads it again every
+// refresh interval so that the keys can be rotated by rewriting the file.
+// The file holds the raw keys back to back, the current key first.
+class FileWatcherSessionTicketKeyProvider final
+    : public grpc_tls_session_ticket_key_provider {
+ public:
+  FileWatcherSessionTicketKeyProvider(std::string key_file_path,
+                                      int64_t refresh_interval_sec);
+
+  ~FileWatcherSessionTicketKeyProvider() override;
+
+ private:
+  // Reads the keys from the file. On failure, the previous keys are kept.
+  void ForceUpdate();
+
+  std::string key_file_path_;
+  int64_t refresh_interval_sec_ = 0;
+
+  Thread refresh_thread_;
+  gpr_event shutdown_event_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_SESSION_TICKET_KEY_PROVIDER_H
@@ -74,7 +74,12 @@ bool CredentialOptionSanityCheck(grpc_tls_credentials_options* options,
 
 TlsCredentials::TlsCredentials(
     grpc_core::RefCountedPtr<grpc_tls_credentials_options> options)
-    : options_(std::move(options)) {}
+    : options_(std::move(options)) {
+  if (options_->verified_peer_cache_size() > 0) {
+    verified_peer_cache_ = grpc_core::MakeRefCounted<
+        grpc_core::TlsVerifiedPeerCache>(options_->verified_peer_cache_size());
+  }
+}
 
 TlsCredentials::~TlsCredentials() {}
 
@@ -90,7 +95,8 @@ TlsCredentials::create_security_connector(
           this->Ref(), options_, std::move(call_creds), target_name,
           overridden_target_name.has_value() ? overridden_target_name->c_str()
                                              : nullptr,
-          ssl_session_cache == nullptr ? nullptr : ssl_session_cache->c_ptr());
+          ssl_session_cache == nullptr ? nullptr : ssl_session_cache->c_ptr(),
+          verified_peer_cache_);
   if (sc == nullptr) {
     return nullptr;
   }
@@ -28,6 +28,7 @@
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/security/credentials/credentials.h"
+#include "src/core/lib/security/credentials/tls/tls_verified_peer_cache.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
 
 class TlsCredentials final : public grpc_channel_credentials {
@@ -49,6 +50,10 @@ class TlsCredentials final : public grpc_channel_credentials {
   int cmp_impl(const grpc_channel_credentials* other) const override;
 
   grpc_core::RefCountedPtr<grpc_tls_credentials_options> options_;
+  // Shared by the security connectors of all the channels using these
+  // credentials. Null if options_->verified_peer_cache_size() is 0.
+  grpc_core::RefCountedPtr<grpc_core::TlsVerifiedPeerCache>
+      verified_peer_cache_;
 };
 
 class TlsServerCredentials final : public grpc_server_credentials {
@@ -0,0 +1,94 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/security/credentials/tls/tls_verified_peer_cache.h"
+
+#include <stdint.h>
+
+#include <utility>
+
+#include <openssl/sha.h>
+
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+
+namespace {
+
+std::string Sha256(absl::string_view data) {
+  uint8_t digest[SHA256_DIGEST_LENGTH];
+  SHA256(reinterpret_cast<const uint8_t*>(data.data()), data.size(), digest);
+  return std::string(reinterpret_cast<const char*>(digest), sizeof(digest));
+}
+
+}  // namespace
+
+std::string TlsVerifiedPeerCache::TrustBundleDigest(
+    absl::string_view pem_root_certs) {
+  return Sha256(pem_root_certs);
+}
+
+std::string TlsVerifiedPeerCache::Key(absl::string_view leaf_cert,
+                                      absl::string_view target_name,
+                                      absl::string_view trust_bundle_digest) {
+  // Both digests have a fixed size, so the key cannot be ambiguous.
+  return absl::StrCat(Sha256(leaf_cert), trust_bundle_digest, target_name);
+}
+
+bool TlsVerifiedPeerCache::Lookup(absl::string_view leaf_cert,
+                                  absl::string_view target_name,
+                                  absl::string_view trust_bundle_digest) {
+  std::string key = Key(leaf_cert, target_name, trust_bundle_digest);
+  MutexLock lock(&mu_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return false;
+  use_order_.splice(use_order_.begin(), use_order_, it->second);
+  return true;
+}
+
+void TlsVerifiedPeerCache::Insert(absl::string_view leaf_cert,
+                                  absl::string_view target_name,
+                                  absl::string_view trust_bundle_digest) {
+  if (capacity_ == 0) return;
+  std::string key = Key(leaf_cert, target_name, trust_bundle_digest);
+  MutexLock lock(&mu_);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    use_order_.splice(use_order_.begin(), use_order_, it->second);
+    return;
+  }
+  if (entries_.size() >= capacity_) {
+    entries_.erase(use_order_.back());
+    use_order_.pop_back();
+  }
+  use_order_.push_front(key);
+  entries_.emplace(std::move(key), use_order_.begin());
+}
+
+void TlsVerifiedPeerCache::Clear() {
+  MutexLock lock(&mu_);
+  entries_.clear();
+  use_order_.clear();
+}
+
+size_t TlsVerifiedPeerCache::Size() {
+  MutexLock lock(&mu_);
+  return entries_.size();
+}
+
+}  // namespace grpc_core
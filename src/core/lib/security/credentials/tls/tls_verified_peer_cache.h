@@ -0,0 +1,85 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_TLS_VERIFIED_PEER_CACHE_H
+#define GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_TLS_VERIFIED_PEER_CACHE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <list>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+// Remembers the peers that passed the custom verification of TLS channels
+// sharing the same credentials, so that new connections to peers already seen
+// skip the certificate verifier. Entries are keyed by the SHA-256 digest of
+// the peer's leaf certificate, the target name it was checked against, and
+// the digest of the trust bundle in use, so that rotating the root
+// certificates makes earlier entries miss. Only successes are cached. When
+// |capacity| entries are cached, the least recently used one is evicted.
+//
+// This class is thread safe.
+class TlsVerifiedPeerCache : public RefCounted<TlsVerifiedPeerCache> {
+ public:
+  explicit TlsVerifiedPeerCache(size_t capacity) : capacity_(capacity) {}
+
+  // Not copyable nor movable.
+  TlsVerifiedPeerCache(const TlsVerifiedPeerCache&) = delete;
+  TlsVerifiedPeerCache& operator=(const TlsVerifiedPeerCache&) = delete;
+
+  // Returns the digest that identifies |pem_root_certs| in the cache keys.
+  static std::string TrustBundleDigest(absl::string_view pem_root_certs);
+
+  // Returns true if |leaf_cert| was verified for |target_name| under the
+  // trust bundle of |trust_bundle_digest|.
+  bool Lookup(absl::string_view leaf_cert, absl::string_view target_name,
+              absl::string_view trust_bundle_digest);
+  // Records that |leaf_cert| was verified for |target_name| under the trust
+  // bundle of |trust_bundle_digest|. This may evict older entries.
+  void Insert(absl::string_view leaf_cert, absl::string_view target_name,
+              absl::string_view trust_bundle_digest);
+  // Drops all the entries, as when the trust bundle is rotated.
+  void Clear();
+
+  // Returns the current number of entries.
+  size_t Size();
+
+ private:
+  static std::string Key(absl::string_view leaf_cert,
+                         absl::string_view target_name,
+                         absl::string_view trust_bundle_digest);
+
+  Mutex mu_;
+  const size_t capacity_;
+  // The keys, most recently used first.
+  std::list<std::string> use_order_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<std::string, std::list<std::string>::iterator> entries_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_TLS_TLS_VERIFIED_PEER_CACHE_H
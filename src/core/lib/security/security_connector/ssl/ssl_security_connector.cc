@@ -36,6 +36,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/host_port.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -263,6 +264,7 @@ class grpc_ssl_server_security_connector
           server_credentials->config().min_tls_version);
       options.max_tls_version = grpc_get_tsi_tls_version(
           server_credentials->config().max_tls_version);
+      options.enable_kernel_tls = grpc_core::IsTlsKernelOffloadEnabled();
       const tsi_result result =
           tsi_create_ssl_server_handshaker_factory_with_options(
               &options, &server_handshaker_factory_);
@@ -376,6 +378,7 @@ class grpc_ssl_server_security_connector
     options.cipher_suites = grpc_get_ssl_cipher_suites();
     options.alpn_protocols = alpn_protocol_strings;
     options.num_alpn_protocols = static_cast<uint16_t>(num_alpn_protocols);
+    options.enable_kernel_tls = grpc_core::IsTlsKernelOffloadEnabled();
     tsi_result result = tsi_create_ssl_server_handshaker_factory_with_options(
         &options, &new_handshaker_factory);
     grpc_tsi_ssl_pem_key_cert_pairs_destroy(
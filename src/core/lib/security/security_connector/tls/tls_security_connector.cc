@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -50,6 +51,7 @@
 #include "src/core/lib/security/security_connector/ssl_utils.h"
 #include "src/core/lib/security/transport/security_handshaker.h"
 #include "src/core/tsi/ssl_transport_security.h"
+#include "src/core/tsi/transport_security.h"
 
 namespace grpc_core {
 
@@ -214,12 +216,15 @@ tsi_ssl_pem_key_cert_pair* ConvertToTsiPemKeyCertPair(
         gpr_zalloc(num_key_cert_pairs * sizeof(tsi_ssl_pem_key_cert_pair)));
   }
   for (size_t i = 0; i < num_key_cert_pairs; i++) {
-    GPR_ASSERT(!cert_pair_list[i].private_key().empty());
     GPR_ASSERT(!cert_pair_list[i].cert_chain().empty());
     tsi_pairs[i].cert_chain =
         gpr_strdup(cert_pair_list[i].cert_chain().c_str());
-    tsi_pairs[i].private_key =
-        gpr_strdup(cert_pair_list[i].private_key().c_str());
+    // A server whose handshakes are signed by a private key signer may not
+    // have the private key.
+    if (!cert_pair_list[i].private_key().empty()) {
+      tsi_pairs[i].private_key =
+          gpr_strdup(cert_pair_list[i].private_key().c_str());
+    }
   }
   return tsi_pairs;
 }
@@ -233,7 +238,8 @@ TlsChannelSecurityConnector::CreateTlsChannelSecurityConnector(
     RefCountedPtr<grpc_tls_credentials_options> options,
     RefCountedPtr<grpc_call_credentials> request_metadata_creds,
     const char* target_name, const char* overridden_target_name,
-    tsi_ssl_session_cache* ssl_session_cache) {
+    tsi_ssl_session_cache* ssl_session_cache,
+    RefCountedPtr<TlsVerifiedPeerCache> verified_peer_cache) {
   if (channel_creds == nullptr) {
     gpr_log(GPR_ERROR,
             "channel_creds is nullptr in "
@@ -255,7 +261,7 @@ TlsChannelSecurityConnector::CreateTlsChannelSecurityConnector(
   return MakeRefCounted<TlsChannelSecurityConnector>(
       std::move(channel_creds), std::move(options),
       std::move(request_metadata_creds), target_name, overridden_target_name,
-      ssl_session_cache);
+      ssl_session_cache, std::move(verified_peer_cache));
 }
 
 TlsChannelSecurityConnector::TlsChannelSecurityConnector(
@@ -263,14 +269,16 @@ TlsChannelSecurityConnector::TlsChannelSecurityConnector(
     RefCountedPtr<grpc_tls_credentials_options> options,
     RefCountedPtr<grpc_call_credentials> request_metadata_creds,
     const char* target_name, const char* overridden_target_name,
-    tsi_ssl_session_cache* ssl_session_cache)
+    tsi_ssl_session_cache* ssl_session_cache,
+    RefCountedPtr<TlsVerifiedPeerCache> verified_peer_cache)
     : grpc_channel_security_connector(GRPC_SSL_URL_SCHEME,
                                       std::move(channel_creds),
                                       std::move(request_metadata_creds)),
       options_(std::move(options)),
       overridden_target_name_(
           overridden_target_name == nullptr ? "" : overridden_target_name),
-      ssl_session_cache_(ssl_session_cache) {
+      ssl_session_cache_(ssl_session_cache),
+      verified_peer_cache_(std::move(verified_peer_cache)) {
   const std::string& tls_session_key_log_file_path =
       options_->tls_session_key_log_file_path();
   if (!tls_session_key_log_file_path.empty()) {
@@ -367,8 +375,28 @@ void TlsChannelSecurityConnector::check_peer(
   *auth_context =
       grpc_ssl_peer_to_auth_context(&peer, GRPC_TLS_TRANSPORT_SECURITY_TYPE);
   GPR_ASSERT(options_->certificate_verifier() != nullptr);
+  std::string trust_bundle_digest;
+  if (verified_peer_cache_ != nullptr) {
+    {
+      MutexLock lock(&mu_);
+      trust_bundle_digest = trust_bundle_digest_;
+    }
+    // The chain was verified by the handshake already. Peers that passed the
+    // certificate verifier before need not go through it again.
+    const tsi_peer_property* leaf_cert =
+        tsi_peer_get_property_by_name(&peer, TSI_X509_PEM_CERT_PROPERTY);
+    if (leaf_cert != nullptr &&
+        verified_peer_cache_->Lookup(
+            absl::string_view(leaf_cert->value.data, leaf_cert->value.length),
+            target_name, trust_bundle_digest)) {
+      ExecCtx::Run(DEBUG_LOCATION, on_peer_checked, absl::OkStatus());
+      tsi_peer_destruct(&peer);
+      return;
+    }
+  }
   auto* pending_request = new ChannelPendingVerifierRequest(
-      Ref(), on_peer_checked, peer, target_name);
+      Ref(), on_peer_checked, peer, target_name,
+      std::move(trust_bundle_digest));
   {
     MutexLock lock(&verifier_request_map_mu_);
     pending_verifier_requests_.emplace(on_peer_checked, pending_request);
@@ -470,9 +498,11 @@ void TlsChannelSecurityConnector::TlsChannelCertificateWatcher::OnError(
 TlsChannelSecurityConnector::ChannelPendingVerifierRequest::
     ChannelPendingVerifierRequest(
         RefCountedPtr<TlsChannelSecurityConnector> security_connector,
-        grpc_closure* on_peer_checked, tsi_peer peer, const char* target_name)
+        grpc_closure* on_peer_checked, tsi_peer peer, const char* target_name,
+        std::string trust_bundle_digest)
     : security_connector_(std::move(security_connector)),
-      on_peer_checked_(on_peer_checked) {
+      on_peer_checked_(on_peer_checked),
+      trust_bundle_digest_(std::move(trust_bundle_digest)) {
   PendingVerifierRequestInit(target_name, peer, &request_);
   tsi_peer_destruct(&peer);
 }
@@ -508,6 +538,11 @@ void TlsChannelSecurityConnector::ChannelPendingVerifierRequest::OnVerifyDone(
         absl::StrCat("Custom verification check failed with error: ",
                      status.ToString())
             .c_str());
+  } else if (security_connector_->verified_peer_cache_ != nullptr &&
+             request_.peer_info.peer_cert != nullptr) {
+    security_connector_->verified_peer_cache_->Insert(
+        request_.peer_info.peer_cert, request_.target_name,
+        trust_bundle_digest_);
   }
   if (run_callback_inline) {
     Closure::Run(DEBUG_LOCATION, on_peer_checked_, error);
@@ -532,6 +567,17 @@ TlsChannelSecurityConnector::UpdateHandshakerFactoryLocked() {
     // std::string and absl::string_view to avoid making another copy here.
     pem_root_certs = std::string(*pem_root_certs_);
   }
+  if (verified_peer_cache_ != nullptr) {
+    std::string trust_bundle_digest =
+        TlsVerifiedPeerCache::TrustBundleDigest(pem_root_certs);
+    // Peers verified under the previous root certificates must be verified
+    // again.
+    if (!trust_bundle_digest_.empty() &&
+        trust_bundle_digest != trust_bundle_digest_) {
+      verified_peer_cache_->Clear();
+    }
+    trust_bundle_digest_ = std::move(trust_bundle_digest);
+  }
   tsi_ssl_pem_key_cert_pair* pem_key_cert_pair = nullptr;
   if (pem_key_cert_pair_list_.has_value()) {
     pem_key_cert_pair = ConvertToTsiPemKeyCertPair(*pem_key_cert_pair_list_);
@@ -545,7 +591,7 @@ TlsChannelSecurityConnector::UpdateHandshakerFactoryLocked() {
       grpc_get_tsi_tls_version(options_->min_tls_version()),
       grpc_get_tsi_tls_version(options_->max_tls_version()), ssl_session_cache_,
       tls_session_key_logger_.get(), options_->crl_directory().c_str(),
-      &client_handshaker_factory_);
+      options_->early_data(), &client_handshaker_factory_);
   // Free memory.
   if (pem_key_cert_pair != nullptr) {
     grpc_tsi_ssl_pem_key_cert_pairs_destroy(pem_key_cert_pair, 1);
@@ -818,7 +864,11 @@ TlsServerSecurityConnector::UpdateHandshakerFactoryLocked() {
       grpc_get_tsi_tls_version(options_->min_tls_version()),
       grpc_get_tsi_tls_version(options_->max_tls_version()),
       tls_session_key_logger_.get(), options_->crl_directory().c_str(),
-      &server_handshaker_factory_);
+      options_->session_ticket_key_provider() == nullptr
+          ? nullptr
+          : options_->session_ticket_key_provider()->key_ring(),
+      options_->private_key_signer(), options_->early_data(),
+      options_->early_data_anti_replay_capacity(), &server_handshaker_factory_);
   // Free memory.
   grpc_tsi_ssl_pem_key_cert_pairs_destroy(pem_key_cert_pairs,
                                           num_key_cert_pairs);
@@ -41,6 +41,7 @@
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_certificate_distributor.h"
+#include "src/core/lib/security/credentials/tls/tls_verified_peer_cache.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
 #include "src/core/lib/security/security_connector/ssl_utils.h"
 #include "src/core/lib/transport/handshaker.h"
@@ -63,14 +64,16 @@ class TlsChannelSecurityConnector final
       RefCountedPtr<grpc_tls_credentials_options> options,
       RefCountedPtr<grpc_call_credentials> request_metadata_creds,
       const char* target_name, const char* overridden_target_name,
-      tsi_ssl_session_cache* ssl_session_cache);
+      tsi_ssl_session_cache* ssl_session_cache,
+      RefCountedPtr<TlsVerifiedPeerCache> verified_peer_cache = nullptr);
 
   TlsChannelSecurityConnector(
       RefCountedPtr<grpc_channel_credentials> channel_creds,
       RefCountedPtr<grpc_tls_credentials_options> options,
       RefCountedPtr<grpc_call_credentials> request_metadata_creds,
       const char* target_name, const char* overridden_target_name,
-      tsi_ssl_session_cache* ssl_session_cache);
+      tsi_ssl_session_cache* ssl_session_cache,
+      RefCountedPtr<TlsVerifiedPeerCache> verified_peer_cache = nullptr);
 
   ~TlsChannelSecurityConnector() override;
 
@@ -131,7 +134,8 @@ class TlsChannelSecurityConnector final
    public:
     ChannelPendingVerifierRequest(
         RefCountedPtr<TlsChannelSecurityConnector> security_connector,
-        grpc_closure* on_peer_checked, tsi_peer peer, const char* target_name);
+        grpc_closure* on_peer_checked, tsi_peer peer, const char* target_name,
+        std::string trust_bundle_digest);
 
     ~ChannelPendingVerifierRequest();
 
@@ -146,6 +150,9 @@ class TlsChannelSecurityConnector final
     RefCountedPtr<TlsChannelSecurityConnector> security_connector_;
     grpc_tls_custom_verification_check_request request_;
     grpc_closure* on_peer_checked_;
+    // The digest of the root certificates the peer was checked under, to
+    // record the peer in |verified_peer_cache_| with if it passes.
+    std::string trust_bundle_digest_;
   };
 
   // Updates |client_handshaker_factory_| when the certificates that
@@ -169,6 +176,9 @@ class TlsChannelSecurityConnector final
   absl::optional<absl::string_view> pem_root_certs_ ABSL_GUARDED_BY(mu_);
   absl::optional<PemKeyCertPairList> pem_key_cert_pair_list_
       ABSL_GUARDED_BY(mu_);
+  RefCountedPtr<TlsVerifiedPeerCache> verified_peer_cache_;
+  // The digest of |pem_root_certs_| in |verified_peer_cache_|.
+  std::string trust_bundle_digest_ ABSL_GUARDED_BY(mu_);
   std::map<grpc_closure* /*on_peer_checked*/, ChannelPendingVerifierRequest*>
       pending_verifier_requests_ ABSL_GUARDED_BY(verifier_request_map_mu_);
 };
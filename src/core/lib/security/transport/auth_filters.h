@@ -21,7 +21,17 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/grpc_security.h>
 #include <grpc/grpc_security_constants.h>
@@ -30,10 +40,14 @@
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/security/credentials/credentials.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/transport.h"
 
 namespace grpc_core {
@@ -55,11 +69,42 @@ class ClientAuthFilter final : public ChannelFilter {
       RefCountedPtr<grpc_channel_security_connector> security_connector,
       RefCountedPtr<grpc_auth_context> auth_context);
 
+  // Remembers the metadata that the channel's call credentials added for
+  // each authority and path, until the TTL declared by the credentials runs
+  // out.
+  class CallCredsMetadataCache : public RefCounted<CallCredsMetadataCache> {
+   public:
+    using Metadata = std::vector<std::pair<std::string, Slice>>;
+
+    // Returns the metadata cached for |key|, or nullptr if there is none or
+    // it expired.
+    std::shared_ptr<const Metadata> Lookup(absl::string_view key,
+                                           Timestamp now);
+    void Insert(std::string key, std::shared_ptr<const Metadata> metadata,
+                Timestamp expiration);
+
+   private:
+    static constexpr size_t kMaxEntries = 256;
+
+    struct Entry {
+      std::shared_ptr<const Metadata> metadata;
+      Timestamp expiration;
+    };
+
+    Mutex mu_;
+    absl::flat_hash_map<std::string, Entry> entries_ ABSL_GUARDED_BY(mu_);
+  };
+
   ArenaPromise<absl::StatusOr<CallArgs>> GetCallCredsMetadata(
       CallArgs call_args);
+  ArenaPromise<absl::StatusOr<CallArgs>> GetCacheableCallCredsMetadata(
+      RefCountedPtr<grpc_call_credentials> creds, CallArgs call_args);
 
   // Contains refs to security connector and auth context.
   grpc_call_credentials::GetRequestMetadataArgs args_;
+  // Metadata added by the channel's call credentials, when they declare a
+  // cacheable metadata TTL.
+  RefCountedPtr<CallCredsMetadataCache> metadata_cache_;
 };
 
 class ServerAuthFilter final : public ChannelFilter {
@@ -22,11 +22,15 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 #include <type_traits>  // IWYU pragma: keep
 #include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/grpc_security.h>
 #include <grpc/grpc_security_constants.h>
@@ -41,6 +45,8 @@
 #include "src/core/lib/channel/status_util.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/detail/basic_seq.h"
@@ -52,6 +58,7 @@
 #include "src/core/lib/security/credentials/credentials.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
 #include "src/core/lib/security/transport/auth_filters.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
 
@@ -104,10 +111,140 @@ bool grpc_check_security_level(grpc_security_level channel_level,
 
 namespace grpc_core {
 
+std::shared_ptr<const ClientAuthFilter::CallCredsMetadataCache::Metadata>
+ClientAuthFilter::CallCredsMetadataCache::Lookup(absl::string_view key,
+                                                 Timestamp now) {
+  MutexLock lock(&mu_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return nullptr;
+  if (it->second.expiration <= now) {
+    entries_.erase(it);
+    return nullptr;
+  }
+  return it->second.metadata;
+}
+
+void ClientAuthFilter::CallCredsMetadataCache::Insert(
+    std::string key, std::shared_ptr<const Metadata> metadata,
+    Timestamp expiration) {
+  MutexLock lock(&mu_);
+  if (entries_.size() >= kMaxEntries && entries_.find(key) == entries_.end()) {
+    // Drop the expired entries first, then the one expiring soonest.
+    Timestamp now = Timestamp::Now();
+    absl::erase_if(entries_, [now](const auto& entry) {
+      return entry.second.expiration <= now;
+    });
+    if (entries_.size() >= kMaxEntries) {
+      auto soonest = entries_.begin();
+      for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->second.expiration < soonest->second.expiration) soonest = it;
+      }
+      entries_.erase(soonest);
+    }
+  }
+  entries_[std::move(key)] = Entry{std::move(metadata), expiration};
+}
+
+namespace {
+
+// Collects what call credentials added to a batch that only held the
+// authority and the path.
+class CallCredsMetadataCollector {
+ public:
+  explicit CallCredsMetadataCollector(
+      std::vector<std::pair<std::string, Slice>>* metadata)
+      : metadata_(metadata) {}
+
+  void Encode(HttpAuthorityMetadata, const Slice&) {}
+  void Encode(HttpPathMetadata, const Slice&) {}
+
+  template <typename Which>
+  void Encode(Which, const typename Which::ValueType& value) {
+    metadata_->emplace_back(std::string(Which::key()),
+                            Slice(Which::Encode(value)));
+  }
+
+  void Encode(const Slice& key, const Slice& value) {
+    metadata_->emplace_back(std::string(key.as_string_view()), value.Ref());
+  }
+
+ private:
+  std::vector<std::pair<std::string, Slice>>* metadata_;
+};
+
+absl::Status AppendCallCredsMetadata(
+    const std::vector<std::pair<std::string, Slice>>& metadata,
+    ClientMetadata* batch) {
+  absl::Status error;
+  for (const auto& md : metadata) {
+    batch->Append(md.first, md.second.Ref(),
+                  [&error](absl::string_view message, const Slice&) {
+                    error = absl::UnavailableError(message);
+                  });
+  }
+  return error;
+}
+
+}  // namespace
+
 ClientAuthFilter::ClientAuthFilter(
     RefCountedPtr<grpc_channel_security_connector> security_connector,
     RefCountedPtr<grpc_auth_context> auth_context)
-    : args_{std::move(security_connector), std::move(auth_context)} {}
+    : args_{std::move(security_connector), std::move(auth_context)},
+      metadata_cache_(MakeRefCounted<CallCredsMetadataCache>()) {}
+
+ArenaPromise<absl::StatusOr<CallArgs>>
+ClientAuthFilter::GetCacheableCallCredsMetadata(
+    RefCountedPtr<grpc_call_credentials> creds, CallArgs call_args) {
+  const Slice& authority =
+      *call_args.client_initial_metadata->get_pointer(HttpAuthorityMetadata());
+  const Slice& path =
+      *call_args.client_initial_metadata->get_pointer(HttpPathMetadata());
+  // The authority cannot contain a '/' and the path starts with one, so the
+  // key cannot be ambiguous.
+  std::string key =
+      absl::StrCat(authority.as_string_view(), path.as_string_view());
+  auto cached = metadata_cache_->Lookup(key, Timestamp::Now());
+  if (cached != nullptr) {
+    absl::Status status =
+        AppendCallCredsMetadata(*cached, call_args.client_initial_metadata.get());
+    if (!status.ok()) return Immediate(absl::StatusOr<CallArgs>(status));
+    return Immediate(absl::StatusOr<CallArgs>(std::move(call_args)));
+  }
+  // Give the credentials a batch holding only what they may depend on, so
+  // that what they add can be told apart and cached.
+  auto* arena = GetContext<Arena>();
+  auto probe = arena->MakePooled<ClientMetadata>(arena);
+  probe->Set(HttpAuthorityMetadata(), authority.Ref());
+  probe->Set(HttpPathMetadata(), path.Ref());
+  const Duration ttl = creds->cacheable_metadata_ttl();
+  return TrySeq(
+      Seq(creds->GetRequestMetadata(std::move(probe), &args_),
+          [](absl::StatusOr<ClientMetadataHandle> new_metadata) mutable {
+            if (!new_metadata.ok()) {
+              return absl::StatusOr<ClientMetadataHandle>(
+                  MaybeRewriteIllegalStatusCode(new_metadata.status(),
+                                                "call credentials"));
+            }
+            return new_metadata;
+          }),
+      [call_args = std::move(call_args), cache = metadata_cache_,
+       key = std::move(key), ttl](ClientMetadataHandle new_metadata) mutable {
+        auto metadata = std::make_shared<CallCredsMetadataCache::Metadata>();
+        CallCredsMetadataCollector collector(metadata.get());
+        new_metadata->Encode(&collector);
+        absl::Status status = AppendCallCredsMetadata(
+            *metadata, call_args.client_initial_metadata.get());
+        if (!status.ok()) {
+          return Immediate<absl::StatusOr<CallArgs>>(
+              absl::StatusOr<CallArgs>(status));
+        }
+        cache->Insert(std::move(key), std::move(metadata),
+                      Timestamp::Now() + ttl);
+        return Immediate<absl::StatusOr<CallArgs>>(
+            absl::StatusOr<CallArgs>(std::move(call_args)));
+      });
+}
 
 ArenaPromise<absl::StatusOr<CallArgs>> ClientAuthFilter::GetCallCredsMetadata(
     CallArgs call_args) {
@@ -158,6 +295,16 @@ ArenaPromise<absl::StatusOr<CallArgs>> ClientAuthFilter::GetCallCredsMetadata(
         "transfer call credential."));
   }
 
+  // Only the channel's own call credentials are cached: per-call credentials
+  // are usually a new object for every call.
+  if (!call_creds_has_md &&
+      creds->cacheable_metadata_ttl() > Duration::Zero() &&
+      call_args.client_initial_metadata->get_pointer(HttpPathMetadata()) !=
+          nullptr) {
+    return GetCacheableCallCredsMetadata(std::move(creds),
+                                         std::move(call_args));
+  }
+
   auto client_initial_metadata = std::move(call_args.client_initial_metadata);
   return TrySeq(
       Seq(creds->GetRequestMetadata(std::move(client_initial_metadata), &args_),
@@ -0,0 +1,180 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/security/transport/handshake_executor.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <utility>
+
+#include <grpc/support/cpu.h>
+
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/thd.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+namespace grpc_core {
+
+//
+// HandshakeExecutor
+//
+
+HandshakeExecutor* HandshakeExecutor::Get() {
+  static NoDestruct<HandshakeExecutor> executor(
+      std::max(1u, gpr_cpu_num_cores() / 2));
+  return executor.get();
+}
+
+HandshakeExecutor::HandshakeExecutor(size_t num_threads)
+    : num_threads_(num_threads) {
+  // The threads live as long as the process.
+  for (size_t i = 0; i < num_threads_; i++) {
+    Thread("grpc_handshake_executor", &ThreadMain, this, nullptr,
+           Thread::Options().set_joinable(false).set_tracked(false))
+        .Start();
+  }
+}
+
+bool HandshakeExecutor::Run(absl::AnyInvocable<void()> step,
+                            Priority priority, size_t max_queued) {
+  MutexLock lock(&mu_);
+  switch (priority) {
+    case Priority::kContinuation:
+      fast_lane_.push_back(std::move(step));
+      break;
+    case Priority::kResumption:
+      if (fast_lane_.size() >= max_queued) return false;
+      fast_lane_.push_back(std::move(step));
+      break;
+    case Priority::kFullHandshake:
+      if (fast_lane_.size() + full_handshakes_.size() >= max_queued) {
+        return false;
+      }
+      full_handshakes_.push_back(std::move(step));
+      break;
+  }
+  cv_.Signal();
+  return true;
+}
+
+void HandshakeExecutor::ThreadMain(void* arg) {
+  HandshakeExecutor* self = static_cast<HandshakeExecutor*>(arg);
+  while (true) {
+    absl::AnyInvocable<void()> step;
+    {
+      MutexLock lock(&self->mu_);
+      while (self->fast_lane_.empty() && self->full_handshakes_.empty()) {
+        self->cv_.Wait(&self->mu_);
+      }
+      std::deque<absl::AnyInvocable<void()>>& lane =
+          self->fast_lane_.empty() ? self->full_handshakes_
+                                   : self->fast_lane_;
+      step = std::move(lane.front());
+      lane.pop_front();
+    }
+    ExecCtx exec_ctx;
+    step();
+  }
+}
+
+//
+// TlsClientHelloOffersResumption
+//
+
+namespace {
+
+// Reads big-endian integers and skips over fields of a TLS message, failing
+// for good once it runs past the end.
+class TlsReader {
+ public:
+  explicit TlsReader(absl::string_view data) : data_(data) {}
+
+  bool ok() const { return ok_; }
+
+  uint32_t Read(size_t size) {
+    if (!ok_ || data_.size() < size) {
+      ok_ = false;
+      return 0;
+    }
+    uint32_t value = 0;
+    for (size_t i = 0; i < size; i++) {
+      value = (value << 8) | static_cast<uint8_t>(data_[i]);
+    }
+    data_.remove_prefix(size);
+    return value;
+  }
+
+  void Skip(size_t size) {
+    if (!ok_ || data_.size() < size) {
+      ok_ = false;
+      return;
+    }
+    data_.remove_prefix(size);
+  }
+
+  // Skips a field prefixed with its length, itself length_size bytes long.
+  void SkipVector(size_t length_size) { Skip(Read(length_size)); }
+
+ private:
+  absl::string_view data_;
+  bool ok_ = true;
+};
+
+constexpr uint32_t kTlsContentTypeHandshake = 22;
+constexpr uint32_t kTlsHandshakeTypeClientHello = 1;
+constexpr uint32_t kTlsExtensionSessionTicket = 35;
+constexpr uint32_t kTlsExtensionPreSharedKey = 41;
+
+}  // namespace
+
+bool TlsClientHelloOffersResumption(absl::string_view data) {
+  TlsReader reader(data);
+  // Record header: content type, legacy version, length. Only the first
+  // record is looked at: ClientHellos that span records are not worth the
+  // trouble.
+  if (reader.Read(1) != kTlsContentTypeHandshake) return false;
+  reader.Skip(2);
+  reader.Skip(2);
+  // Handshake header: type and length.
+  if (reader.Read(1) != kTlsHandshakeTypeClientHello) return false;
+  reader.Skip(3);
+  // Legacy version, random, legacy session id, cipher suites and legacy
+  // compression methods. TLS 1.3 clients send a session id in every
+  // ClientHello, so it says nothing about resumption.
+  reader.Skip(2);
+  reader.Skip(32);
+  reader.SkipVector(1);
+  reader.SkipVector(2);
+  reader.SkipVector(1);
+  uint32_t extensions_size = reader.Read(2);
+  if (!reader.ok()) return false;
+  while (extensions_size >= 4) {
+    uint32_t type = reader.Read(2);
+    uint32_t size = reader.Read(2);
+    if (!reader.ok() || extensions_size - 4 < size) return false;
+    // An empty session ticket extension only asks for a new ticket.
+    if (type == kTlsExtensionPreSharedKey ||
+        (type == kTlsExtensionSessionTicket && size > 0)) {
+      return true;
+    }
+    reader.Skip(size);
+    extensions_size -= 4 + size;
+  }
+  return false;
+}
+
+}  // namespace grpc_core
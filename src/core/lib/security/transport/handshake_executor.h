@@ -0,0 +1,88 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SECURITY_TRANSPORT_HANDSHAKE_EXECUTOR_H
+#define GRPC_SRC_CORE_LIB_SECURITY_TRANSPORT_HANDSHAKE_EXECUTOR_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <deque>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+// A bounded pool of threads that runs the steps of TSI handshakes, which can
+// take milliseconds of CPU each for private key operations and certificate
+// verification, away from the threads serving established connections.
+//
+// Steps are queued in two lanes. The fast lane holds the steps of handshakes
+// already under way, which would waste the work done so far if dropped, and
+// the first steps of TLS handshakes resuming a session, which are cheap. It
+// is always served first. The other lane holds the first steps of new full
+// handshakes, which are the first to be shed when the pool cannot keep up.
+class HandshakeExecutor {
+ public:
+  enum class Priority {
+    // A step of a handshake that already got through its first step. Never
+    // shed.
+    kContinuation,
+    // The first step of a TLS handshake resuming a session. Shed only when
+    // the fast lane itself is full.
+    kResumption,
+    // The first step of any other handshake. Shed when the lanes together
+    // are full.
+    kFullHandshake,
+  };
+
+  // Returns the process-wide executor, with one thread for every two cores.
+  static HandshakeExecutor* Get();
+
+  explicit HandshakeExecutor(size_t num_threads);
+
+  HandshakeExecutor(const HandshakeExecutor&) = delete;
+  HandshakeExecutor& operator=(const HandshakeExecutor&) = delete;
+
+  // Queues step to run on one of the executor's threads, with an ExecCtx.
+  // Returns false, without queuing it, if it is to be shed because
+  // max_queued steps are already waiting.
+  bool Run(absl::AnyInvocable<void()> step, Priority priority,
+           size_t max_queued);
+
+  size_t num_threads() const { return num_threads_; }
+
+ private:
+  static void ThreadMain(void* arg);
+
+  const size_t num_threads_;
+  Mutex mu_;
+  CondVar cv_;
+  std::deque<absl::AnyInvocable<void()>> fast_lane_ ABSL_GUARDED_BY(mu_);
+  std::deque<absl::AnyInvocable<void()>> full_handshakes_ ABSL_GUARDED_BY(mu_);
+};
+
+// Returns true if data starts with a TLS ClientHello offering to resume a
+// session, with a session ticket or a TLS 1.3 pre-shared key. Returns false
+// for anything else, including a ClientHello that is cut short.
+bool TlsClientHelloOffersResumption(absl::string_view data);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SECURITY_TRANSPORT_HANDSHAKE_EXECUTOR_H
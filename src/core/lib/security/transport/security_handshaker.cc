@@ -36,8 +36,10 @@
 
 #include <grpc/grpc_security.h>
 #include <grpc/grpc_security_constants.h>
+#include <grpc/impl/grpc_types.h>
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
+#include <grpc/status.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
@@ -58,6 +60,7 @@
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/iomgr/tcp_server.h"
 #include "src/core/lib/security/context/security_context.h"
+#include "src/core/lib/security/transport/handshake_executor.h"
 #include "src/core/lib/security/transport/secure_endpoint.h"
 #include "src/core/lib/security/transport/tsi_error.h"
 #include "src/core/lib/slice/slice.h"
@@ -68,6 +71,7 @@
 #include "src/core/tsi/transport_security_grpc.h"
 
 #define GRPC_INITIAL_HANDSHAKE_BUFFER_SIZE 256
+#define GRPC_HANDSHAKE_EXECUTOR_DEFAULT_MAX_QUEUED 256
 
 namespace grpc_core {
 
@@ -88,6 +92,8 @@ class SecurityHandshaker : public Handshaker {
  private:
   grpc_error_handle DoHandshakerNextLocked(const unsigned char* bytes_received,
                                            size_t bytes_received_size);
+  grpc_error_handle RunHandshakerNextLocked(
+      const unsigned char* bytes_received, size_t bytes_received_size);
 
   grpc_error_handle OnHandshakeNextDoneLocked(
       tsi_result result, const unsigned char* bytes_to_send,
@@ -135,6 +141,10 @@ class SecurityHandshaker : public Handshaker {
   tsi_handshaker_result* handshaker_result_ = nullptr;
   size_t max_frame_size_ = 0;
   std::string tsi_handshake_error_;
+  // Set if the handshake steps are to run on the HandshakeExecutor, to how
+  // many steps may be waiting for it before a new handshake is shed.
+  absl::optional<size_t> handshake_executor_max_queued_;
+  bool handshake_started_ = false;
 };
 
 SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
@@ -147,6 +157,11 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
           static_cast<uint8_t*>(gpr_malloc(handshake_buffer_size_))),
       max_frame_size_(
           std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))) {
+  if (args.GetBool(GRPC_ARG_HANDSHAKE_EXECUTOR).value_or(false)) {
+    handshake_executor_max_queued_ =
+        std::max(1, args.GetInt(GRPC_ARG_HANDSHAKE_EXECUTOR_MAX_QUEUED)
+                        .value_or(GRPC_HANDSHAKE_EXECUTOR_DEFAULT_MAX_QUEUED));
+  }
   grpc_slice_buffer_init(&outgoing_);
   GRPC_CLOSURE_INIT(&on_peer_checked_, &SecurityHandshaker::OnPeerCheckedFn,
                     this, grpc_schedule_on_exec_ctx);
@@ -255,6 +270,24 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error_handle error) {
     HandshakeFailedLocked(error);
     return;
   }
+  // Hand record protection over to the kernel if the session allows it, in
+  // which case the endpoint needs no wrapping and the unused bytes are
+  // plaintext. Kernel TLS sockets refuse MSG_ZEROCOPY sends, so connections
+  // that use TCP TX zero-copy keep their frame protector.
+  bool kernel_tls = false;
+  const int fd = grpc_endpoint_get_fd(args_->endpoint);
+  if (fd >= 0 &&
+      !args_->args.GetBool(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED).value_or(false)) {
+    tsi_result result =
+        tsi_handshaker_result_enable_kernel_tls(handshaker_result_, fd);
+    if (result == TSI_OK) {
+      kernel_tls = true;
+    } else if (result != TSI_UNIMPLEMENTED) {
+      HandshakeFailedLocked(grpc_set_tsi_error_result(
+          GRPC_ERROR_CREATE("Kernel TLS setup failed"), result));
+      return;
+    }
+  }
   // Get unused bytes.
   const unsigned char* unused_bytes = nullptr;
   size_t unused_bytes_size = 0;
@@ -268,15 +301,17 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error_handle error) {
     return;
   }
   // Check whether we need to wrap the endpoint.
-  tsi_frame_protector_type frame_protector_type;
-  result = tsi_handshaker_result_get_frame_protector_type(
-      handshaker_result_, &frame_protector_type);
-  if (result != TSI_OK) {
-    HandshakeFailedLocked(grpc_set_tsi_error_result(
-        GRPC_ERROR_CREATE("TSI handshaker result does not implement "
-                          "get_frame_protector_type"),
-        result));
-    return;
+  tsi_frame_protector_type frame_protector_type = TSI_FRAME_PROTECTOR_NONE;
+  if (!kernel_tls) {
+    result = tsi_handshaker_result_get_frame_protector_type(
+        handshaker_result_, &frame_protector_type);
+    if (result != TSI_OK) {
+      HandshakeFailedLocked(grpc_set_tsi_error_result(
+          GRPC_ERROR_CREATE("TSI handshaker result does not implement "
+                            "get_frame_protector_type"),
+          result));
+      return;
+    }
   }
   tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
   tsi_frame_protector* protector = nullptr;
@@ -335,8 +370,8 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error_handle error) {
   tsi_handshaker_result_destroy(handshaker_result_);
   handshaker_result_ = nullptr;
   args_->args = args_->args.SetObject(auth_context_);
-  // Add channelz channel args only if frame protector is created.
-  if (has_frame_protector) {
+  // Add channelz channel args only if the connection is protected.
+  if (has_frame_protector || kernel_tls) {
     args_->args = args_->args.SetObject(
         MakeChannelzSecurityFromAuthContext(auth_context_.get()));
   }
@@ -455,6 +490,47 @@ void SecurityHandshaker::OnHandshakeNextDoneGrpcWrapper(
 
 grpc_error_handle SecurityHandshaker::DoHandshakerNextLocked(
     const unsigned char* bytes_received, size_t bytes_received_size) {
+  if (!handshake_executor_max_queued_.has_value()) {
+    return RunHandshakerNextLocked(bytes_received, bytes_received_size);
+  }
+  HandshakeExecutor::Priority priority =
+      HandshakeExecutor::Priority::kContinuation;
+  if (!handshake_started_) {
+    handshake_started_ = true;
+    priority = TlsClientHelloOffersResumption(absl::string_view(
+                   reinterpret_cast<const char*>(bytes_received),
+                   bytes_received_size))
+                   ? HandshakeExecutor::Priority::kResumption
+                   : HandshakeExecutor::Priority::kFullHandshake;
+  }
+  // The step takes over the ref held for the next callback, and the bytes
+  // received, which stay in handshake_buffer_ until the next read.
+  bool queued = HandshakeExecutor::Get()->Run(
+      [this, bytes_received, bytes_received_size]() {
+        RefCountedPtr<SecurityHandshaker> h(this);
+        MutexLock lock(&mu_);
+        grpc_error_handle error =
+            is_shutdown_
+                ? GRPC_ERROR_CREATE("Handshaker shutdown")
+                : RunHandshakerNextLocked(bytes_received, bytes_received_size);
+        if (!error.ok()) {
+          HandshakeFailedLocked(error);
+        } else {
+          h.release();  // Avoid unref
+        }
+      },
+      priority, *handshake_executor_max_queued_);
+  if (!queued) {
+    global_stats().IncrementHandshakesShed();
+    return grpc_error_set_int(
+        GRPC_ERROR_CREATE("Handshake shed: handshake executor overloaded"),
+        StatusIntProperty::kRpcStatus, GRPC_STATUS_RESOURCE_EXHAUSTED);
+  }
+  return absl::OkStatus();
+}
+
+grpc_error_handle SecurityHandshaker::RunHandshakerNextLocked(
+    const unsigned char* bytes_received, size_t bytes_received_size) {
   // Invoke TSI handshaker.
   const unsigned char* bytes_to_send = nullptr;
   size_t bytes_to_send_size = 0;
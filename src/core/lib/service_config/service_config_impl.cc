@@ -18,23 +18,29 @@
 
 #include "src/core/lib/service_config/service_config_impl.h"
 
-#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
 #include "src/core/lib/config/core_configuration.h"
-#include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/gprpp/match.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/validation_errors.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/json/json_args.h"
 #include "src/core/lib/json/json_object_loader.h"
 #include "src/core/lib/service_config/service_config_parser.h"
-#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_internal.h"
 
 namespace grpc_core {
@@ -77,15 +83,89 @@ struct MethodConfig {
   }
 };
 
+// Encodes the values of the channel args in names.
+std::string ChannelArgsKey(const ChannelArgs& args,
+                           const std::vector<std::string>& names) {
+  std::string key;
+  for (const std::string& name : names) {
+    const ChannelArgs::Value* value = args.Get(name);
+    if (value == nullptr) {
+      key.push_back('-');
+      continue;
+    }
+    Match(
+        *value, [&key](int i) { absl::StrAppend(&key, "i", i, ";"); },
+        [&key](const std::string& s) {
+          absl::StrAppend(&key, "s", s.size(), ":", s);
+        },
+        [&key](const ChannelArgs::Pointer& p) {
+          absl::StrAppend(&key, "p",
+                          reinterpret_cast<uintptr_t>(p.c_pointer()), ";");
+        });
+  }
+  return key;
+}
+
 }  // namespace
 
+// A process-wide index of the live service configs created from strings.
+// The cache does not hold refs: each config removes itself when it is
+// destroyed.
+class ServiceConfigImpl::Cache {
+ public:
+  static Cache* Get() {
+    static NoDestruct<Cache> cache;
+    return cache.get();
+  }
+
+  RefCountedPtr<ServiceConfig> Find(absl::string_view json_string,
+                                    absl::string_view args_key) {
+    MutexLock lock(&mu_);
+    auto it = map_.find(Key(json_string, args_key));
+    if (it == map_.end()) return nullptr;
+    // The config may be in the process of being destroyed.
+    return it->second->RefIfNonZero();
+  }
+
+  void Add(ServiceConfigImpl* service_config) {
+    MutexLock lock(&mu_);
+    // Replaces any config with the same key that is being destroyed, or
+    // that was added by a concurrent Create().
+    map_[Key(service_config->json_string_, *service_config->cache_key_)] =
+        service_config;
+  }
+
+  void Remove(ServiceConfigImpl* service_config) {
+    MutexLock lock(&mu_);
+    auto it = map_.find(
+        Key(service_config->json_string_, *service_config->cache_key_));
+    if (it != map_.end() && it->second == service_config) map_.erase(it);
+  }
+
+ private:
+  // Views of the json_string_ and cache_key_ of the config.
+  using Key = std::pair<absl::string_view, absl::string_view>;
+
+  Mutex mu_;
+  absl::flat_hash_map<Key, ServiceConfigImpl*> map_ ABSL_GUARDED_BY(mu_);
+};
+
 absl::StatusOr<RefCountedPtr<ServiceConfig>> ServiceConfigImpl::Create(
     const ChannelArgs& args, absl::string_view json_string) {
+  std::string args_key = ChannelArgsKey(
+      args,
+      CoreConfiguration::Get().service_config_parser().ChannelArgsUsed());
+  RefCountedPtr<ServiceConfig> cached =
+      Cache::Get()->Find(json_string, args_key);
+  if (cached != nullptr) return cached;
   auto json = Json::Parse(json_string);
   if (!json.ok()) return json.status();
   ValidationErrors errors;
   auto service_config = Create(args, *json, json_string, &errors);
   if (!errors.ok()) return errors.status("errors validating service config");
+  auto* impl = static_cast<ServiceConfigImpl*>(service_config.get());
+  impl->cache_key_ = std::move(args_key);
+  Cache::Get()->Add(impl);
   return service_config;
 }
 
@@ -141,16 +221,17 @@ RefCountedPtr<ServiceConfig> ServiceConfigImpl::Create(
           }
           service_config->default_method_config_vector_ = vector_ptr;
         } else {
-          grpc_slice key = grpc_slice_from_cpp_string(std::move(path));
-          // If the key is not already present in the map, this will
-          // store a ref to the key in the map.
-          auto& value = service_config->parsed_method_configs_map_[key];
+          size_t sep = path.rfind('/');
+          auto& service_configs =
+              service_config->parsed_method_configs_map_[absl::string_view(
+                  path.data(), sep + 1)];
+          absl::string_view method = absl::string_view(path).substr(sep + 1);
+          auto& value = method.empty()
+                            ? service_configs.wildcard
+                            : service_configs.method_map[method];
           if (value != nullptr) {
-            errors->AddError(absl::StrCat("multiple method configs for path ",
-                                          StringViewFromSlice(key)));
-            // The map entry already existed, so we need to unref the
-            // key we just created.
-            CSliceUnref(key);
+            errors->AddError(
+                absl::StrCat("multiple method configs for path ", path));
           } else {
             value = vector_ptr;
           }
@@ -162,9 +243,7 @@ RefCountedPtr<ServiceConfig> ServiceConfigImpl::Create(
 }
 
 ServiceConfigImpl::~ServiceConfigImpl() {
-  for (auto& p : parsed_method_configs_map_) {
-    CSliceUnref(p.first);
-  }
+  if (cache_key_.has_value()) Cache::Get()->Remove(this);
 }
 
 const ServiceConfigParser::ParsedConfigVector*
@@ -172,18 +251,20 @@ ServiceConfigImpl::GetMethodParsedConfigVector(const grpc_slice& path) const {
   if (parsed_method_configs_map_.empty()) {
     return default_method_config_vector_;
   }
-  // Try looking up the full path in the map.
-  auto it = parsed_method_configs_map_.find(path);
-  if (it != parsed_method_configs_map_.end()) return it->second;
-  // If we didn't find a match for the path, try looking for a wildcard
-  // entry (i.e., change "/service/method" to "/service/").
-  UniquePtr<char> path_str(grpc_slice_to_c_string(path));
-  char* sep = strrchr(path_str.get(), '/');
-  if (sep == nullptr) return nullptr;  // Shouldn't ever happen.
-  sep[1] = '\0';
-  grpc_slice wildcard_path = grpc_slice_from_static_string(path_str.get());
-  it = parsed_method_configs_map_.find(wildcard_path);
-  if (it != parsed_method_configs_map_.end()) return it->second;
+  // Split "/service/method" into "/service/" and "method".
+  absl::string_view path_view = StringViewFromSlice(path);
+  size_t sep = path_view.rfind('/');
+  if (sep == absl::string_view::npos) return nullptr;  // Shouldn't ever happen.
+  auto it = parsed_method_configs_map_.find(path_view.substr(0, sep + 1));
+  if (it != parsed_method_configs_map_.end()) {
+    // Try looking up the method, then the wildcard entry for the service.
+    const ServiceMethodConfigs& service_configs = it->second;
+    auto method_it = service_configs.method_map.find(path_view.substr(sep + 1));
+    if (method_it != service_configs.method_map.end()) {
+      return method_it->second;
+    }
+    if (service_configs.wildcard != nullptr) return service_configs.wildcard;
+  }
   // Try default method config, if set.
   return default_method_config_vector_;
 }
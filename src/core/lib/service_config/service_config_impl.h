@@ -23,11 +23,12 @@
 
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 
 #include <grpc/slice.h>
 #include <grpc/support/log.h>
@@ -38,7 +39,6 @@
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/service_config/service_config.h"
 #include "src/core/lib/service_config/service_config_parser.h"
-#include "src/core/lib/slice/slice_internal.h"
 
 // The main purpose of the code here is to parse the service config in
 // JSON form, which will look like this:
@@ -69,6 +69,10 @@ namespace grpc_core {
 class ServiceConfigImpl final : public ServiceConfig {
  public:
   /// Creates a new service config from parsing \a json_string.
+  /// Identical configs are shared: if a service config parsed from the same
+  /// string, with the same values for the channel args that the registered
+  /// parsers use, is still alive anywhere in the process, a new ref to it is
+  /// returned instead.
   static absl::StatusOr<RefCountedPtr<ServiceConfig>> Create(
       const ChannelArgs& args, absl::string_view json_string);
 
@@ -101,15 +105,28 @@ class ServiceConfigImpl final : public ServiceConfig {
       const grpc_slice& path) const override;
 
  private:
+  class Cache;
+
   std::string json_string_;
   Json json_;
+  // The values of the channel args used by the parsers, if this config
+  // is in the cache.
+  absl::optional<std::string> cache_key_;
 
   ServiceConfigParser::ParsedConfigVector parsed_global_configs_;
-  // A map from the method name to the parsed config vector. Note that we are
-  // using a raw pointer and not a unique pointer so that we can use the same
-  // vector for multiple names.
-  std::unordered_map<grpc_slice, const ServiceConfigParser::ParsedConfigVector*,
-                     SliceHash>
+  // The method configs for the paths that share the part up to and
+  // including the last '/' (normally "/service/").  Note that we are using
+  // raw pointers and not unique pointers so that we can use the same vector
+  // for multiple names.
+  struct ServiceMethodConfigs {
+    // Config for every method not in method_map (an empty method name).
+    const ServiceConfigParser::ParsedConfigVector* wildcard = nullptr;
+    // A map from the method name to the parsed config vector.
+    absl::flat_hash_map<std::string,
+                        const ServiceConfigParser::ParsedConfigVector*>
+        method_map;
+  };
+  absl::flat_hash_map<std::string, ServiceMethodConfigs>
       parsed_method_configs_map_;
   // Default method config.
   const ServiceConfigParser::ParsedConfigVector* default_method_config_vector_ =
@@ -20,6 +20,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <string>
 
 #include "absl/strings/str_cat.h"
@@ -28,6 +29,20 @@
 
 namespace grpc_core {
 
+ServiceConfigParser::ServiceConfigParser(
+    ServiceConfigParserList registered_parsers)
+    : registered_parsers_(std::move(registered_parsers)) {
+  for (const auto& parser : registered_parsers_) {
+    for (absl::string_view name : parser->ChannelArgsUsed()) {
+      channel_args_used_.emplace_back(name);
+    }
+  }
+  std::sort(channel_args_used_.begin(), channel_args_used_.end());
+  channel_args_used_.erase(
+      std::unique(channel_args_used_.begin(), channel_args_used_.end()),
+      channel_args_used_.end());
+}
+
 ServiceConfigParser ServiceConfigParser::Builder::Build() {
   return ServiceConfigParser(std::move(registered_parsers_));
 }
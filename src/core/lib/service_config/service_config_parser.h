@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -63,6 +64,14 @@ class ServiceConfigParser {
         ValidationErrors* /*errors*/) {
       return nullptr;
     }
+
+    /// Returns the names of the channel args that ParseGlobalParams() and
+    /// ParsePerMethodParams() read.  Parsed service configs are shared
+    /// between channels whose values for these args match, so a parser
+    /// MUST list every channel arg that can change its result.
+    virtual std::vector<absl::string_view> ChannelArgsUsed() const {
+      return {};
+    }
   };
 
   using ServiceConfigParserList = std::vector<std::unique_ptr<Parser>>;
@@ -94,10 +103,17 @@ class ServiceConfigParser {
   // If there is an error, return -1.
   size_t GetParserIndex(absl::string_view name) const;
 
+  // Returns the sorted union of the channel args used by all registered
+  // parsers.
+  const std::vector<std::string>& ChannelArgsUsed() const {
+    return channel_args_used_;
+  }
+
  private:
-  explicit ServiceConfigParser(ServiceConfigParserList registered_parsers)
-      : registered_parsers_(std::move(registered_parsers)) {}
+  explicit ServiceConfigParser(ServiceConfigParserList registered_parsers);
+
   ServiceConfigParserList registered_parsers_;
+  std::vector<std::string> channel_args_used_;
 };
 
 }  // namespace grpc_core
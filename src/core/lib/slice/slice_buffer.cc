@@ -250,6 +250,23 @@ void grpc_slice_buffer_reset_and_unref(grpc_slice_buffer* sb) {
   sb->slices = sb->base_slices;
 }
 
+void grpc_slice_buffer_shrink_to_fit(grpc_slice_buffer* sb) {
+  if (sb->base_slices == sb->inlined) return;
+  if (sb->count <= GRPC_SLICE_BUFFER_INLINE_ELEMENTS) {
+    memcpy(sb->inlined, sb->slices, sb->count * sizeof(grpc_slice));
+    gpr_free(sb->base_slices);
+    sb->base_slices = sb->slices = sb->inlined;
+    sb->capacity = GRPC_SLICE_BUFFER_INLINE_ELEMENTS;
+  } else if (sb->count < sb->capacity) {
+    grpc_slice* slices =
+        static_cast<grpc_slice*>(gpr_malloc(sb->count * sizeof(grpc_slice)));
+    memcpy(slices, sb->slices, sb->count * sizeof(grpc_slice));
+    gpr_free(sb->base_slices);
+    sb->base_slices = sb->slices = slices;
+    sb->capacity = sb->count;
+  }
+}
+
 void grpc_slice_buffer_swap(grpc_slice_buffer* a, grpc_slice_buffer* b) {
   size_t a_offset = static_cast<size_t>(a->slices - a->base_slices);
   size_t b_offset = static_cast<size_t>(b->slices - b->base_slices);
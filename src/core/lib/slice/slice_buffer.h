@@ -47,17 +47,18 @@ class SliceBuffer {
  public:
   explicit SliceBuffer() { grpc_slice_buffer_init(&slice_buffer_); }
   SliceBuffer(const SliceBuffer& other) = delete;
-  SliceBuffer(SliceBuffer&& other) noexcept {
-    grpc_slice_buffer_init(&slice_buffer_);
-    grpc_slice_buffer_swap(&slice_buffer_, &other.slice_buffer_);
-  }
+  SliceBuffer(SliceBuffer&& other) noexcept { MoveFrom(other); }
   /// Upon destruction, the underlying raw slice buffer is cleaned out and all
   /// slices are unreffed.
   ~SliceBuffer() { grpc_slice_buffer_destroy(&slice_buffer_); }
 
   SliceBuffer& operator=(const SliceBuffer&) = delete;
+  /// The slices held before the assignment are unreffed.
   SliceBuffer& operator=(SliceBuffer&& other) noexcept {
-    grpc_slice_buffer_swap(&slice_buffer_, &other.slice_buffer_);
+    if (this != &other) {
+      grpc_slice_buffer_destroy(&slice_buffer_);
+      MoveFrom(other);
+    }
     return *this;
   }
 
@@ -150,6 +151,26 @@ class SliceBuffer {
   }
 
  private:
+  /// Takes the slices of other into slice_buffer_, which must not hold any,
+  /// leaving other empty. Unlike a swap, only the slices in use are copied, which for
+  /// the common one or two slice messages is a cache line or two rather than
+  /// the whole inlined array.
+  void MoveFrom(SliceBuffer& other) {
+    grpc_slice_buffer& src = other.slice_buffer_;
+    if (src.base_slices == src.inlined) {
+      memcpy(slice_buffer_.inlined, src.slices, src.count * sizeof(grpc_slice));
+      slice_buffer_.base_slices = slice_buffer_.slices = slice_buffer_.inlined;
+      slice_buffer_.capacity = GRPC_SLICE_BUFFER_INLINE_ELEMENTS;
+    } else {
+      slice_buffer_.base_slices = src.base_slices;
+      slice_buffer_.slices = src.slices;
+      slice_buffer_.capacity = src.capacity;
+    }
+    slice_buffer_.count = src.count;
+    slice_buffer_.length = src.length;
+    grpc_slice_buffer_init(&src);
+  }
+
   /// The backing raw slice buffer.
   grpc_slice_buffer slice_buffer_;
 
@@ -48,6 +48,11 @@ void grpc_slice_buffer_remove_first(grpc_slice_buffer* sb);
 void grpc_slice_buffer_sub_first(grpc_slice_buffer* sb, size_t begin,
                                  size_t end);
 
+// Releases the slice array capacity the slice buffer no longer uses, moving
+// the slices back into the inlined array when they fit. The slices
+// themselves are untouched.
+void grpc_slice_buffer_shrink_to_fit(grpc_slice_buffer* sb);
+
 // if slice matches a static slice, returns the static slice
 // otherwise returns the passed in slice (without reffing it)
 // used for surface boundaries where we might receive an un-interned static
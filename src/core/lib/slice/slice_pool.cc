@@ -0,0 +1,289 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/slice/slice_pool.h"
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <new>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/internal/memory_allocator_impl.h>
+#include <grpc/event_engine/memory_request.h>
+#include <grpc/support/alloc.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice_refcount.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Power of two size classes, from kSlicePoolMinBlockSize to
+// kSlicePoolMaxBlockSize.
+constexpr int kNumSizeClasses = 9;
+static_assert(kSlicePoolMinBlockSize << (kNumSizeClasses - 1) ==
+                  kSlicePoolMaxBlockSize,
+              "size classes must span the pooled sizes");
+
+// Idle bytes the pool may hold for each CPU, over all size classes.
+constexpr size_t kMaxIdleBytesPerCpu = 2 * 1024 * 1024;
+// The quota reservation for idle blocks is adjusted in steps of this size,
+// rather than on every allocation.
+constexpr size_t kReservationStep = 256 * 1024;
+
+size_t SizeClassBytes(int size_class) {
+  return kSlicePoolMinBlockSize << size_class;
+}
+
+int SizeClassFor(size_t length) {
+  int size_class = 0;
+  while (SizeClassBytes(size_class) < length) ++size_class;
+  return size_class;
+}
+
+// A pooled allocation: the refcount shared by the slices into the block,
+// followed by the block's bytes.
+struct Block {
+  grpc_slice_refcount refcount;
+  int size_class;
+  Block* next;
+  // While in use, the allocator the block's bytes are charged to, if any.
+  std::shared_ptr<EventEngineMemoryAllocatorImpl> charged_to;
+
+  uint8_t* bytes() { return reinterpret_cast<uint8_t*>(this + 1); }
+};
+
+void ReturnBlock(grpc_slice_refcount* refcount);
+
+void FreeBlock(Block* block) {
+  global_stats().IncrementSlicePoolFrees();
+  block->charged_to.~shared_ptr();
+  gpr_free(block);
+}
+
+class SlicePool {
+ public:
+  SlicePool()
+      : memory_owner_(
+            ResourceQuota::Default()->memory_quota()->CreateMemoryOwner(
+                "slice_pool")) {}
+
+  // Returns a block of the given size class, allocating one if this CPU's
+  // pool has none left.
+  Block* Get(int size_class);
+  // Keeps the block for reuse, or frees it if this CPU's pool is full.
+  void Put(Block* block);
+
+ private:
+  struct Shard {
+    Mutex mu;
+    Block* free_lists[kNumSizeClasses] ABSL_GUARDED_BY(mu) = {};
+    size_t idle_bytes ABSL_GUARDED_BY(mu) = 0;
+  };
+
+  // Brings the bytes reserved from the quota to within a couple of steps
+  // above the idle bytes.
+  void UpdateReservation();
+  void MaybePostReclaimer();
+  // Frees all idle blocks.
+  void Reclaim();
+
+  MemoryOwner memory_owner_;
+  PerCpu<Shard> shards_;
+  std::atomic<size_t> idle_bytes_{0};
+  std::atomic<size_t> reserved_bytes_{0};
+  Mutex reservation_mu_;
+  std::atomic<bool> reclaimer_posted_{false};
+};
+
+Block* SlicePool::Get(int size_class) {
+  Shard& shard = shards_.this_cpu();
+  Block* block;
+  {
+    MutexLock lock(&shard.mu);
+    block = shard.free_lists[size_class];
+    if (block != nullptr) {
+      shard.free_lists[size_class] = block->next;
+      shard.idle_bytes -= SizeClassBytes(size_class);
+      idle_bytes_.fetch_sub(SizeClassBytes(size_class),
+                            std::memory_order_relaxed);
+    }
+  }
+  if (block != nullptr) {
+    global_stats().IncrementSlicePoolHits();
+    UpdateReservation();
+  } else {
+    global_stats().IncrementSlicePoolMisses();
+    block = static_cast<Block*>(
+        gpr_malloc(sizeof(Block) + SizeClassBytes(size_class)));
+    block->size_class = size_class;
+    new (&block->charged_to) decltype(block->charged_to)();
+  }
+  new (&block->refcount) grpc_slice_refcount(ReturnBlock);
+  return block;
+}
+
+void SlicePool::Put(Block* block) {
+  const size_t size = SizeClassBytes(block->size_class);
+  Shard& shard = shards_.this_cpu();
+  {
+    MutexLock lock(&shard.mu);
+    if (shard.idle_bytes + size <= kMaxIdleBytesPerCpu) {
+      block->next = shard.free_lists[block->size_class];
+      shard.free_lists[block->size_class] = block;
+      shard.idle_bytes += size;
+      // Under the lock, so that idle_bytes_ cannot drop below zero.
+      idle_bytes_.fetch_add(size, std::memory_order_relaxed);
+      block = nullptr;
+    }
+  }
+  if (block != nullptr) {
+    FreeBlock(block);
+    return;
+  }
+  UpdateReservation();
+  MaybePostReclaimer();
+}
+
+void SlicePool::UpdateReservation() {
+  size_t idle = idle_bytes_.load(std::memory_order_relaxed);
+  size_t reserved = reserved_bytes_.load(std::memory_order_relaxed);
+  if (idle <= reserved && reserved - idle <= 2 * kReservationStep) return;
+  MutexLock lock(&reservation_mu_);
+  idle = idle_bytes_.load(std::memory_order_relaxed);
+  reserved = reserved_bytes_.load(std::memory_order_relaxed);
+  if (idle > reserved) {
+    const size_t n = idle - reserved + kReservationStep;
+    memory_owner_.Reserve(grpc_event_engine::experimental::MemoryRequest(n));
+    reserved += n;
+  } else if (reserved - idle > 2 * kReservationStep) {
+    const size_t n = reserved - idle - kReservationStep;
+    memory_owner_.Release(n);
+    reserved -= n;
+  }
+  reserved_bytes_.store(reserved, std::memory_order_relaxed);
+}
+
+void SlicePool::MaybePostReclaimer() {
+  if (reclaimer_posted_.load(std::memory_order_relaxed) ||
+      reclaimer_posted_.exchange(true, std::memory_order_relaxed)) {
+    return;
+  }
+  memory_owner_.PostReclaimer(
+      ReclamationPass::kBenign,
+      [this](absl::optional<ReclamationSweep> sweep) {
+        if (!sweep.has_value()) return;
+        Reclaim();
+      });
+}
+
+void SlicePool::Reclaim() {
+  // Blocks returned from here on post a new reclaimer.
+  reclaimer_posted_.store(false, std::memory_order_relaxed);
+  for (Shard& shard : shards_) {
+    Block* free_lists[kNumSizeClasses];
+    size_t idle_bytes;
+    {
+      MutexLock lock(&shard.mu);
+      for (int i = 0; i < kNumSizeClasses; ++i) {
+        free_lists[i] = shard.free_lists[i];
+        shard.free_lists[i] = nullptr;
+      }
+      idle_bytes = shard.idle_bytes;
+      shard.idle_bytes = 0;
+      idle_bytes_.fetch_sub(idle_bytes, std::memory_order_relaxed);
+    }
+    if (idle_bytes == 0) continue;
+    for (Block* block : free_lists) {
+      while (block != nullptr) {
+        Block* next = block->next;
+        FreeBlock(block);
+        block = next;
+      }
+    }
+  }
+  UpdateReservation();
+}
+
+SlicePool* Pool() {
+  static NoDestruct<SlicePool> pool;
+  return pool.get();
+}
+
+void ReturnBlock(grpc_slice_refcount* refcount) {
+  // The last reference may be dropped by an application thread, but
+  // PerCpu and the resource quota need an ExecCtx.
+  absl::optional<ExecCtx> exec_ctx;
+  if (ExecCtx::Get() == nullptr) exec_ctx.emplace();
+  Block* block = reinterpret_cast<Block*>(refcount);
+  if (block->charged_to != nullptr) {
+    block->charged_to->Release(SizeClassBytes(block->size_class));
+    block->charged_to.reset();
+  }
+  Pool()->Put(block);
+}
+
+grpc_slice SliceFromBlock(Block* block, size_t length) {
+  grpc_slice slice;
+  slice.refcount = &block->refcount;
+  slice.data.refcounted.bytes = block->bytes();
+  slice.data.refcounted.length = length;
+  return slice;
+}
+
+bool IsPooledLength(size_t length) {
+  return length >= kSlicePoolMinBlockSize && length <= kSlicePoolMaxBlockSize;
+}
+
+}  // namespace
+
+grpc_slice PooledSliceMalloc(size_t length) {
+  if (!IsPooledLength(length)) return grpc_slice_malloc(length);
+  // Callers are typically application threads serializing a message.
+  absl::optional<ExecCtx> exec_ctx;
+  if (ExecCtx::Get() == nullptr) exec_ctx.emplace();
+  return SliceFromBlock(Pool()->Get(SizeClassFor(length)), length);
+}
+
+grpc_slice PooledSliceMalloc(size_t length, MemoryOwner* owner) {
+  if (!IsPooledLength(length)) {
+    return owner->MakeSlice(
+        grpc_event_engine::experimental::MemoryRequest(length));
+  }
+  absl::optional<ExecCtx> exec_ctx;
+  if (ExecCtx::Get() == nullptr) exec_ctx.emplace();
+  const int size_class = SizeClassFor(length);
+  // Charge the whole block, as MakeSlice charges for its refcount too.
+  owner->Reserve(grpc_event_engine::experimental::MemoryRequest(
+      SizeClassBytes(size_class)));
+  Block* block = Pool()->Get(size_class);
+  block->charged_to = owner->RefAllocator();
+  return SliceFromBlock(block, length);
+}
+
+}  // namespace grpc_core
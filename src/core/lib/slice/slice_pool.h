@@ -0,0 +1,51 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SLICE_SLICE_POOL_H
+#define GRPC_SRC_CORE_LIB_SLICE_SLICE_POOL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <grpc/slice.h>
+
+namespace grpc_core {
+
+class MemoryOwner;
+
+// Allocations of this many bytes or more are served from the pool.
+constexpr size_t kSlicePoolMinBlockSize = 4096;
+// Allocations of more than this many bytes are never pooled.
+constexpr size_t kSlicePoolMaxBlockSize = 1024 * 1024;
+
+// Returns a slice of exactly \a length bytes.  When \a length is within the
+// pooled sizes, the slice is backed by a block from power-of-two size
+// classes, which goes back to the pool (of the CPU that releases it) once
+// the last reference to the slice is dropped, so that steady streams of
+// similarly sized messages stop paying for a fresh allocation each time.
+// Other lengths are allocated with grpc_slice_malloc().
+//
+// Idle blocks held by the pool are charged to the default resource quota,
+// and are freed when the quota asks for memory back.
+grpc_slice PooledSliceMalloc(size_t length);
+
+// As above, but the slice's bytes are also charged to \a owner until the last
+// reference to the slice is dropped, as with MemoryAllocator::MakeSlice. For
+// buffers, such as endpoint reads, whose memory is accounted to a connection.
+grpc_slice PooledSliceMalloc(size_t length, MemoryOwner* owner);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SLICE_SLICE_POOL_H
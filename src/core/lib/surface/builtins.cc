@@ -25,6 +25,9 @@
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/surface/lame_client.h"
 #include "src/core/lib/surface/server.h"
+#include "src/core/lib/surface/server_admission_control.h"
+#include "src/core/lib/surface/server_connection_rebalancer.h"
+#include "src/core/lib/surface/server_fair_queuing.h"
 
 namespace grpc_core {
 
@@ -49,6 +52,9 @@ void RegisterBuiltins(CoreConfiguration::Builder* builder) {
         builder->PrependFilter(&Server::kServerTopFilter);
         return true;
       });
+  RegisterServerAdmissionControlFilter(builder);
+  RegisterServerConnectionRebalancingFilter(builder);
+  RegisterServerFairQueuingFilter(builder);
 }
 
 }  // namespace grpc_core
@@ -65,6 +65,7 @@
 #include "src/core/lib/channel/context.h"
 #include "src/core/lib/channel/status_util.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/debug/event_ring.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/experiments/experiments.h"
@@ -108,6 +109,8 @@ grpc_core::DebugOnlyTraceFlag grpc_call_refcount_trace(false, "call_refcount");
 
 namespace grpc_core {
 
+thread_local CallBatchScope* CallBatchScope::current_ = nullptr;
+
 ///////////////////////////////////////////////////////////////////////////////
 // Call
 
@@ -173,13 +176,16 @@ class Call : public CppImplOf<Call, grpc_call> {
   };
 
   Call(Arena* arena, bool is_client, Timestamp send_deadline,
-       RefCountedPtr<Channel> channel)
+       RefCountedPtr<Channel> channel,
+       CallSizeEstimator* method_call_size_estimator)
       : channel_(std::move(channel)),
+        method_call_size_estimator_(method_call_size_estimator),
         arena_(arena),
         send_deadline_(send_deadline),
         is_client_(is_client) {
     GPR_DEBUG_ASSERT(arena_ != nullptr);
     GPR_DEBUG_ASSERT(channel_ != nullptr);
+    EventRing::Record(EventRing::Event::kCallStart, is_client);
   }
   virtual ~Call() = default;
 
@@ -216,6 +222,8 @@ class Call : public CppImplOf<Call, grpc_call> {
 
  private:
   RefCountedPtr<Channel> channel_;
+  // Owned by the channel's call registration table, if set.
+  CallSizeEstimator* const method_call_size_estimator_;
   Arena* const arena_;
   std::atomic<ParentCall*> parent_call_{nullptr};
   ChildCall* child_ = nullptr;
@@ -364,10 +372,19 @@ char* Call::GetPeer() {
 }
 
 void Call::DeleteThis() {
+  EventRing::Record(EventRing::Event::kCallFinish, is_client_);
   RefCountedPtr<Channel> channel = std::move(channel_);
+  CallSizeEstimator* method_call_size_estimator = method_call_size_estimator_;
   Arena* arena = arena_;
   this->~Call();
-  channel->UpdateCallSizeEstimate(arena->TotalUsedBytes());
+  channel->UpdateCallSizeEstimate(arena->TotalUsedBytes(),
+                                  method_call_size_estimator);
+  if (size_t chained_zones = arena->ChainedZones()) {
+    global_stats().IncrementCallArenasChained();
+    for (size_t i = 0; i < chained_zones; ++i) {
+      global_stats().IncrementCallArenaChainedZones();
+    }
+  }
   arena->Destroy();
 }
 
@@ -551,9 +568,11 @@ class FilterStackCall final : public Call {
 
   FilterStackCall(Arena* arena, const grpc_call_create_args& args)
       : Call(arena, args.server_transport_data == nullptr, args.send_deadline,
-             args.channel->Ref()),
+             args.channel->Ref(), args.method_call_size_estimator),
         cq_(args.cq),
-        stream_op_payload_(context_) {}
+        stream_op_payload_(context_) {
+    context_[GRPC_CONTEXT_WRITE_WINDOW_HINT].value = &write_window_hint_;
+  }
 
   static void ReleaseCall(void* call, grpc_error_handle);
   static void DestroyCall(void* call, grpc_error_handle);
@@ -624,6 +643,8 @@ class FilterStackCall final : public Call {
 
   // Contexts for various subsystems (security, tracing, ...).
   grpc_call_context_element context_[GRPC_CONTEXT_COUNT] = {};
+  // Published through context_, for as long as the call lives.
+  WriteWindowHint write_window_hint_;
 
   SliceBuffer send_slice_buffer_;
   absl::optional<SliceBuffer> receiving_slice_buffer_;
@@ -692,14 +713,16 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
   FilterStackCall* call;
   grpc_error_handle error;
   grpc_channel_stack* channel_stack = channel->channel_stack();
-  size_t initial_size = channel->CallSizeEstimate();
+  size_t initial_size =
+      channel->CallSizeEstimate(args->method_call_size_estimator);
   global_stats().IncrementCallInitialSize(initial_size);
   size_t call_alloc_size =
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(FilterStackCall)) +
       channel_stack->call_stack_size;
 
-  std::pair<Arena*, void*> arena_with_call = Arena::CreateWithAlloc(
-      initial_size, call_alloc_size, channel->allocator());
+  std::pair<Arena*, void*> arena_with_call =
+      Arena::CreateWithAlloc(initial_size, call_alloc_size,
+                             channel->allocator(), channel->arena_cache());
   arena = arena_with_call.first;
   call = new (arena_with_call.second) FilterStackCall(arena, *args);
   GPR_DEBUG_ASSERT(FromC(call->c_ptr()) == call);
@@ -914,6 +937,8 @@ void FilterStackCall::SetFinalStatus(grpc_error_handle error) {
     gpr_log(GPR_DEBUG, "%s", StatusToString(error).c_str());
   }
   if (is_client()) {
+    global_stats().IncrementClientCallLatencyUs(
+        MicrosecondsSince(start_time_));
     std::string status_details;
     grpc_error_get_status(error, send_deadline(), final_op_.client.status,
                           &status_details, nullptr,
@@ -1319,6 +1344,10 @@ void FilterStackCall::BatchControl::ReceivingInitialMetadataReady(
   GRPC_CALL_COMBINER_STOP(call->call_combiner(), "recv_initial_metadata_ready");
 
   if (error.ok()) {
+    if (call->is_client()) {
+      global_stats().IncrementClientCallInitialMetadataLatencyUs(
+          MicrosecondsSince(call->start_time_));
+    }
     grpc_metadata_batch* md = &call->recv_initial_metadata_;
     call->RecvInitialFilter(md);
 
@@ -1496,7 +1525,9 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
             effective_compression_level = copts.default_level.level;
           }
         }
-        // Currently, only server side supports compression level setting.
+        // Currently, only server side supports choosing the algorithm from the
+        // compression level. On both sides the level is passed on, and the
+        // compression filter uses it to tune the chosen codec.
         if (level_set && !is_client()) {
           const grpc_compression_algorithm calgo =
               encodings_accepted_by_peer_.CompressionAlgorithmForLevel(
@@ -1506,6 +1537,10 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
           // algorithm.
           send_initial_metadata_.Set(GrpcInternalEncodingRequest(), calgo);
         }
+        if (level_set) {
+          send_initial_metadata_.Set(GrpcInternalCompressionLevelRequest(),
+                                     effective_compression_level);
+        }
         if (op->data.send_initial_metadata.count > INT_MAX) {
           error = GRPC_CALL_ERROR_INVALID_METADATA;
           goto done_with_error;
@@ -2383,8 +2418,9 @@ grpc_error_handle MakePromiseBasedCall(grpc_call_create_args* args,
                                        grpc_call** out_call) {
   Channel* channel = args->channel.get();
 
-  auto alloc = Arena::CreateWithAlloc(channel->CallSizeEstimate(), sizeof(T),
-                                      channel->allocator());
+  auto alloc = Arena::CreateWithAlloc(
+      channel->CallSizeEstimate(args->method_call_size_estimator), sizeof(T),
+      channel->allocator(), channel->arena_cache());
   PromiseBasedCall* call = new (alloc.second) T(alloc.first, args);
   *out_call = call->c_ptr();
   GPR_DEBUG_ASSERT(Call::FromC(*out_call) == call);
@@ -2394,7 +2430,7 @@ grpc_error_handle MakePromiseBasedCall(grpc_call_create_args* args,
 PromiseBasedCall::PromiseBasedCall(Arena* arena, uint32_t initial_external_refs,
                                    const grpc_call_create_args& args)
     : Call(arena, args.server_transport_data == nullptr, args.send_deadline,
-           args.channel->Ref()),
+           args.channel->Ref(), args.method_call_size_estimator),
       refs_(MakeRefPair(initial_external_refs, 0)),
       cq_(args.cq) {
   if (args.cq != nullptr) {
@@ -3542,7 +3578,7 @@ ServerCallContext::MakeTopOfServerCallPromise(
 // C-based API
 
 void* grpc_call_arena_alloc(grpc_call* call, size_t size) {
-  grpc_core::ExecCtx exec_ctx;
+  grpc_core::PassThroughExecCtx exec_ctx;
   return grpc_core::Call::FromC(call)->arena()->Alloc(size);
 }
 
@@ -3577,7 +3613,7 @@ void grpc_call_set_completion_queue(grpc_call* call,
 void grpc_call_ref(grpc_call* c) { grpc_core::Call::FromC(c)->ExternalRef(); }
 
 void grpc_call_unref(grpc_call* c) {
-  grpc_core::ExecCtx exec_ctx;
+  grpc_core::PassThroughExecCtx exec_ctx;
   grpc_core::Call::FromC(c)->ExternalUnref();
 }
 
@@ -3647,6 +3683,8 @@ grpc_call_error grpc_call_start_batch(grpc_call* call, const grpc_op* ops,
 
   if (reserved != nullptr) {
     return GRPC_CALL_ERROR;
+  } else if (grpc_core::CallBatchScope::Active()) {
+    return grpc_core::Call::FromC(call)->StartBatch(ops, nops, tag, false);
   } else {
     grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
     grpc_core::ExecCtx exec_ctx;
@@ -3683,6 +3721,13 @@ bool grpc_call_is_trailers_only(const grpc_call* call) {
   return grpc_core::Call::FromC(call)->is_trailers_only();
 }
 
+int64_t grpc_call_writable_bytes_hint(const grpc_call* call) {
+  auto* hint = static_cast<const grpc_core::WriteWindowHint*>(
+      grpc_core::Call::FromC(call)->ContextGet(GRPC_CONTEXT_WRITE_WINDOW_HINT));
+  if (hint == nullptr) return grpc_core::WriteWindowHint::kUnknown;
+  return hint->writable_bytes();
+}
+
 int grpc_call_failed_before_recv_message(const grpc_call* c) {
   return grpc_core::Call::FromC(c)->failed_before_recv_message();
 }
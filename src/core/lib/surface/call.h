@@ -42,6 +42,7 @@
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/iomgr/polling_entity.h"
 #include "src/core/lib/promise/arena_promise.h"
@@ -73,6 +74,9 @@ typedef struct grpc_call_create_args {
   absl::optional<grpc_core::Slice> authority;
 
   grpc_core::Timestamp send_deadline;
+
+  // If set, tracks the arena sizes of calls to this call's method.
+  grpc_core::CallSizeEstimator* method_call_size_estimator = nullptr;
 } grpc_call_create_args;
 
 namespace grpc_core {
@@ -140,6 +144,35 @@ class CallContext {
 template <>
 struct ContextType<CallContext> {};
 
+// Batches the work of starting many calls on the current thread.  While a
+// CallBatchScope is the innermost ExecCtx, grpc_channel_create_call(),
+// grpc_channel_create_registered_call() and grpc_call_start_batch() run in
+// its ExecCtx instead of flushing one of their own, so the closures they
+// schedule (filter stack work, LB picks, transport writes) run back to back
+// when the scope ends, and the completions of calls that already failed are
+// delivered after all the calls have been started.
+// Nothing in the scope may block waiting for one of these calls.
+class CallBatchScope {
+ public:
+  CallBatchScope() : last_(current_) { current_ = this; }
+  ~CallBatchScope() { current_ = last_; }
+
+  CallBatchScope(const CallBatchScope&) = delete;
+  CallBatchScope& operator=(const CallBatchScope&) = delete;
+
+  // Returns true if the surface API should use the current ExecCtx.
+  static bool Active() {
+    return current_ != nullptr && ExecCtx::Get() == &current_->exec_ctx_;
+  }
+
+ private:
+  static thread_local CallBatchScope* current_;
+
+  ApplicationCallbackExecCtx callback_exec_ctx_;
+  ExecCtx exec_ctx_;
+  CallBatchScope* const last_;
+};
+
 }  // namespace grpc_core
 
 // Create a new call based on \a args.
@@ -201,6 +234,11 @@ grpc_compression_algorithm grpc_call_compression_for_level(
 //                  Move to surface API if requested by other languages.
 bool grpc_call_is_trailers_only(const grpc_call* call);
 
+// How many bytes \a call could send right now without waiting for flow
+// control, or -1 if its transport does not say.
+// TODO(markdroth): This is currently available only to the C++ API.
+int64_t grpc_call_writable_bytes_hint(const grpc_call* call);
+
 // Returns the authority for the call, as seen on the server side.
 absl::string_view grpc_call_server_authority(const grpc_call* call);
 
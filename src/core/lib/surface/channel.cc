@@ -41,6 +41,7 @@
 #include "src/core/lib/channel/channel_stack_builder_impl.h"
 #include "src/core/lib/channel/channel_trace.h"
 #include "src/core/lib/channel/channelz.h"
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/debug/stats_data.h"
@@ -70,8 +71,8 @@ Channel::Channel(bool is_client, bool is_promising, std::string target,
     : is_client_(is_client),
       is_promising_(is_promising),
       compression_options_(compression_options),
-      call_size_estimate_(channel_stack->call_stack_size +
-                          grpc_call_get_initial_size_estimate()),
+      call_size_estimator_(channel_stack->call_stack_size +
+                           grpc_call_get_initial_size_estimate()),
       channelz_node_(channel_args.GetObjectRef<channelz::ChannelNode>()),
       allocator_(channel_args.GetObject<ResourceQuota>()
                      ->memory_quota()
@@ -143,12 +144,11 @@ absl::StatusOr<RefCountedPtr<Channel>> Channel::CreateWithBuilder(
               static_cast<grpc_compression_algorithm>(
                   GRPC_COMPRESS_ALGORITHMS_COUNT - 1));
   }
-  auto enabled_algorithms_bitset =
-      channel_args.GetInt(GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET);
-  if (enabled_algorithms_bitset.has_value()) {
-    compression_options.enabled_algorithms_bitset =
-        *enabled_algorithms_bitset | 1 /* always support no compression */;
-  }
+  // Leaves out algorithms this binary has no codec for.
+  compression_options.enabled_algorithms_bitset =
+      CompressionAlgorithmSet::FromChannelArgs(channel_args)
+          .ToLegacyBitmask() |
+      1 /* always support no compression */;
 
   return RefCountedPtr<Channel>(new Channel(
       grpc_channel_stack_type_is_client(builder->channel_stack_type()),
@@ -230,7 +230,7 @@ absl::StatusOr<RefCountedPtr<Channel>> Channel::Create(
   return CreateWithBuilder(&builder);
 }
 
-void Channel::UpdateCallSizeEstimate(size_t size) {
+void CallSizeEstimator::UpdateCallSizeEstimate(size_t size) {
   size_t cur = call_size_estimate_.load(std::memory_order_relaxed);
   if (cur < size) {
     // size grew: update estimate
@@ -283,7 +283,8 @@ static grpc_call* grpc_channel_create_call_internal(
     grpc_channel* c_channel, grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* cq, grpc_pollset_set* pollset_set_alternative,
     grpc_core::Slice path, absl::optional<grpc_core::Slice> authority,
-    grpc_core::Timestamp deadline) {
+    grpc_core::Timestamp deadline,
+    grpc_core::CallSizeEstimator* method_call_size_estimator = nullptr) {
   auto channel = grpc_core::Channel::FromC(c_channel)->Ref();
   GPR_ASSERT(channel->is_client());
   GPR_ASSERT(!(cq != nullptr && pollset_set_alternative != nullptr));
@@ -299,6 +300,7 @@ static grpc_call* grpc_channel_create_call_internal(
   args.path = std::move(path);
   args.authority = std::move(authority);
   args.send_deadline = deadline;
+  args.method_call_size_estimator = method_call_size_estimator;
 
   grpc_call* call;
   GRPC_LOG_IF_ERROR("call_create", grpc_call_create(&args, &call));
@@ -312,17 +314,19 @@ grpc_call* grpc_channel_create_call(grpc_channel* channel,
                                     grpc_slice method, const grpc_slice* host,
                                     gpr_timespec deadline, void* reserved) {
   GPR_ASSERT(!reserved);
+  auto create_call = [&]() {
+    return grpc_channel_create_call_internal(
+        channel, parent_call, propagation_mask, completion_queue, nullptr,
+        grpc_core::Slice(grpc_core::CSliceRef(method)),
+        host != nullptr
+            ? absl::optional<grpc_core::Slice>(grpc_core::CSliceRef(*host))
+            : absl::nullopt,
+        grpc_core::Timestamp::FromTimespecRoundUp(deadline));
+  };
+  if (grpc_core::CallBatchScope::Active()) return create_call();
   grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
   grpc_core::ExecCtx exec_ctx;
-  grpc_call* call = grpc_channel_create_call_internal(
-      channel, parent_call, propagation_mask, completion_queue, nullptr,
-      grpc_core::Slice(grpc_core::CSliceRef(method)),
-      host != nullptr
-          ? absl::optional<grpc_core::Slice>(grpc_core::CSliceRef(*host))
-          : absl::nullopt,
-      grpc_core::Timestamp::FromTimespecRoundUp(deadline));
-
-  return call;
+  return create_call();
 }
 
 grpc_call* grpc_channel_create_pollset_set_call(
@@ -406,17 +410,20 @@ grpc_call* grpc_channel_create_registered_call(
        registered_call_handle, deadline.tv_sec, deadline.tv_nsec,
        (int)deadline.clock_type, reserved));
   GPR_ASSERT(!reserved);
+  auto create_call = [&]() {
+    return grpc_channel_create_call_internal(
+        channel, parent_call, propagation_mask, completion_queue, nullptr,
+        rc->path.Ref(),
+        rc->authority.has_value()
+            ? absl::optional<grpc_core::Slice>(rc->authority->Ref())
+            : absl::nullopt,
+        grpc_core::Timestamp::FromTimespecRoundUp(deadline),
+        &rc->call_size_estimator);
+  };
+  if (grpc_core::CallBatchScope::Active()) return create_call();
   grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
   grpc_core::ExecCtx exec_ctx;
-  grpc_call* call = grpc_channel_create_call_internal(
-      channel, parent_call, propagation_mask, completion_queue, nullptr,
-      rc->path.Ref(),
-      rc->authority.has_value()
-          ? absl::optional<grpc_core::Slice>(rc->authority->Ref())
-          : absl::nullopt,
-      grpc_core::Timestamp::FromTimespecRoundUp(deadline));
-
-  return call;
+  return create_call();
 }
 
 void grpc_channel_destroy_internal(grpc_channel* c_channel) {
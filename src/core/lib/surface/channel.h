@@ -52,6 +52,7 @@
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
+#include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/channel_stack_type.h"
@@ -85,9 +86,47 @@ void grpc_channel_update_call_size_estimate(grpc_channel* channel, size_t size);
 
 namespace grpc_core {
 
+// Running estimate of the arena size that calls need, used to size the initial
+// zone of new calls' arenas so that they do not have to grow.
+class CallSizeEstimator {
+ public:
+  explicit CallSizeEstimator(size_t initial_estimate)
+      : call_size_estimate_(initial_estimate) {}
+
+  CallSizeEstimator(const CallSizeEstimator&) = delete;
+  CallSizeEstimator& operator=(const CallSizeEstimator&) = delete;
+
+  // An estimator that started from zero has no estimate until its first
+  // update.
+  bool has_estimate() const {
+    return call_size_estimate_.load(std::memory_order_relaxed) != 0;
+  }
+
+  size_t CallSizeEstimate() const {
+    // We round up our current estimate to the NEXT value of kRoundUpSize.
+    // This ensures:
+    //  1. a consistent size allocation when our estimate is drifting slowly
+    //     (which is common) - which tends to help most allocators reuse memory
+    //  2. a small amount of allowed growth over the estimate without hitting
+    //     the arena size doubling case, reducing overall memory usage
+    static constexpr size_t kRoundUpSize = 256;
+    return (call_size_estimate_.load(std::memory_order_relaxed) +
+            2 * kRoundUpSize) &
+           ~(kRoundUpSize - 1);
+  }
+
+  void UpdateCallSizeEstimate(size_t size);
+
+ private:
+  std::atomic<size_t> call_size_estimate_;
+};
+
 struct RegisteredCall {
   Slice path;
   absl::optional<Slice> authority;
+  // Arena sizes of calls to this method, which may need much more (or less)
+  // than the channel's average call.
+  CallSizeEstimator call_size_estimator{0};
 
   explicit RegisteredCall(const char* method_arg, const char* host_arg);
   RegisteredCall(const RegisteredCall& other);
@@ -125,22 +164,28 @@ class Channel : public RefCounted<Channel>,
 
   channelz::ChannelNode* channelz_node() const { return channelz_node_.get(); }
 
-  size_t CallSizeEstimate() {
-    // We round up our current estimate to the NEXT value of kRoundUpSize.
-    // This ensures:
-    //  1. a consistent size allocation when our estimate is drifting slowly
-    //     (which is common) - which tends to help most allocators reuse memory
-    //  2. a small amount of allowed growth over the estimate without hitting
-    //     the arena size doubling case, reducing overall memory usage
-    static constexpr size_t kRoundUpSize = 256;
-    return (call_size_estimate_.load(std::memory_order_relaxed) +
-            2 * kRoundUpSize) &
-           ~(kRoundUpSize - 1);
+  // Initial arena size for a new call. If the call's method has an estimator
+  // of its own, its estimate is used once calls to the method have finished.
+  size_t CallSizeEstimate(
+      const CallSizeEstimator* method_estimator = nullptr) const {
+    if (method_estimator != nullptr && method_estimator->has_estimate()) {
+      return method_estimator->CallSizeEstimate();
+    }
+    return call_size_estimator_.CallSizeEstimate();
   }
 
-  void UpdateCallSizeEstimate(size_t size);
+  // Record the final arena size of a finished call.
+  void UpdateCallSizeEstimate(size_t size,
+                              CallSizeEstimator* method_estimator = nullptr) {
+    call_size_estimator_.UpdateCallSizeEstimate(size);
+    if (method_estimator != nullptr) {
+      method_estimator->UpdateCallSizeEstimate(size);
+    }
+  }
   absl::string_view target() const { return target_; }
   MemoryAllocator* allocator() { return &allocator_; }
+  // Storage of finished calls' arenas, kept for reuse by new calls.
+  ArenaCache* arena_cache() { return &arena_cache_; }
   bool is_client() const { return is_client_; }
   bool is_promising() const { return is_promising_; }
   RegisteredCall* RegisterCall(const char* method, const char* host);
@@ -168,10 +213,11 @@ class Channel : public RefCounted<Channel>,
   const bool is_client_;
   const bool is_promising_;
   const grpc_compression_options compression_options_;
-  std::atomic<size_t> call_size_estimate_;
+  CallSizeEstimator call_size_estimator_;
   CallRegistrationTable registration_table_;
   RefCountedPtr<channelz::ChannelNode> channelz_node_;
   MemoryAllocator allocator_;
+  ArenaCache arena_cache_;
   std::string target_;
   const RefCountedPtr<grpc_channel_stack> channel_stack_;
 };
@@ -20,6 +20,7 @@
 #include "src/core/lib/surface/completion_queue.h"
 
 #include <inttypes.h>
+#include <limits.h>
 #include <stdio.h>
 
 #include <algorithm>
@@ -57,6 +58,13 @@
 #include "src/core/lib/surface/api_trace.h"
 #include "src/core/lib/surface/event_string.h"
 
+#ifdef GPR_LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
 grpc_core::TraceFlag grpc_trace_operation_failures(false, "op_failure");
 grpc_core::DebugOnlyTraceFlag grpc_trace_pending_tags(false, "pending_tags");
 grpc_core::DebugOnlyTraceFlag grpc_trace_cq_refcount(false, "cq_refcount");
@@ -78,6 +86,8 @@ struct plucker {
 struct cq_poller_vtable {
   bool can_get_pollset;
   bool can_listen;
+  // If false, kick() may be called without holding the poller's lock.
+  bool kick_needs_lock;
   size_t (*size)(void);
   void (*init)(grpc_pollset* pollset, gpr_mu** mu);
   grpc_error_handle (*kick)(grpc_pollset* pollset,
@@ -189,17 +199,165 @@ void non_polling_poller_shutdown(grpc_pollset* pollset, grpc_closure* closure) {
   }
 }
 
+// A poller for GRPC_CQ_NON_POLLING_LOCK_FREE completion queues. Like
+// non_polling_poller it does no I/O, but kicking it is lock free: waiters park
+// on a wakeup counter (a futex where available), and kickers only make a
+// syscall if somebody is parked.
+struct parking_poller {
+  // Returned to grpc_cq as the poller's lock. Serializes work() and shutdown().
+  gpr_mu mu;
+  // Bumped by every kick. Waiters park until it changes.
+  std::atomic<uint32_t> wakeups{0};
+  // The value of wakeups last observed by a waiter, guarded by mu. Kicks that
+  // arrive while nobody is waiting make the next work() return immediately.
+  uint32_t observed_wakeups = 0;
+  // Number of threads parked (or about to park) on wakeups.
+  std::atomic<int> parked{0};
+  // Number of threads inside work(), guarded by mu.
+  int workers = 0;
+  grpc_closure* shutdown = nullptr;
+#ifndef GPR_LINUX
+  gpr_mu park_mu;
+  gpr_cv park_cv;
+#endif
+};
+
+// Waits until p->wakeups changes from value, or until deadline.
+void parking_poller_park(parking_poller* p, uint32_t value,
+                         grpc_core::Timestamp deadline) {
+#ifdef GPR_LINUX
+  struct timespec timeout;
+  struct timespec* timeout_ptr = nullptr;
+  if (deadline != grpc_core::Timestamp::InfFuture()) {
+    const int64_t millis = std::max<int64_t>(
+        0, (deadline - grpc_core::Timestamp::Now()).millis());
+    timeout.tv_sec = millis / GPR_MS_PER_SEC;
+    timeout.tv_nsec = (millis % GPR_MS_PER_SEC) * GPR_NS_PER_MS;
+    timeout_ptr = &timeout;
+  }
+  syscall(SYS_futex, &p->wakeups, FUTEX_WAIT_PRIVATE, value, timeout_ptr,
+          nullptr, 0);
+#else
+  gpr_timespec deadline_ts = deadline.as_timespec(GPR_CLOCK_MONOTONIC);
+  gpr_mu_lock(&p->park_mu);
+  while (p->wakeups.load() == value &&
+         !gpr_cv_wait(&p->park_cv, &p->park_mu, deadline_ts)) {
+  }
+  gpr_mu_unlock(&p->park_mu);
+#endif
+}
+
+void parking_poller_wake_all(parking_poller* p) {
+  p->wakeups.fetch_add(1);
+  if (p->parked.load() == 0) return;
+#ifdef GPR_LINUX
+  syscall(SYS_futex, &p->wakeups, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr,
+          nullptr, 0);
+#else
+  gpr_mu_lock(&p->park_mu);
+  gpr_cv_broadcast(&p->park_cv);
+  gpr_mu_unlock(&p->park_mu);
+#endif
+}
+
+size_t parking_poller_size(void) { return sizeof(parking_poller); }
+
+void parking_poller_init(grpc_pollset* pollset, gpr_mu** mu) {
+  parking_poller* p = new (pollset) parking_poller();
+  gpr_mu_init(&p->mu);
+#ifndef GPR_LINUX
+  gpr_mu_init(&p->park_mu);
+  gpr_cv_init(&p->park_cv);
+#endif
+  *mu = &p->mu;
+}
+
+void parking_poller_destroy(grpc_pollset* pollset) {
+  parking_poller* p = reinterpret_cast<parking_poller*>(pollset);
+  gpr_mu_destroy(&p->mu);
+#ifndef GPR_LINUX
+  gpr_mu_destroy(&p->park_mu);
+  gpr_cv_destroy(&p->park_cv);
+#endif
+  p->~parking_poller();
+}
+
+grpc_error_handle parking_poller_work(grpc_pollset* pollset,
+                                      grpc_pollset_worker** worker,
+                                      grpc_core::Timestamp deadline) {
+  parking_poller* p = reinterpret_cast<parking_poller*>(pollset);
+  if (p->shutdown) return absl::OkStatus();
+  uint32_t value = p->wakeups.load();
+  if (value != p->observed_wakeups) {
+    p->observed_wakeups = value;
+    return absl::OkStatus();
+  }
+  // Pluckers only use the worker to kick this poller, and any kick wakes
+  // every waiter.
+  if (worker != nullptr) *worker = reinterpret_cast<grpc_pollset_worker*>(p);
+  ++p->workers;
+  p->parked.fetch_add(1);
+  gpr_mu_unlock(&p->mu);
+  if (deadline > grpc_core::Timestamp::ProcessEpoch()) {
+    parking_poller_park(p, value, deadline);
+  }
+  gpr_mu_lock(&p->mu);
+  p->parked.fetch_sub(1);
+  grpc_core::ExecCtx::Get()->InvalidateNow();
+  p->observed_wakeups = p->wakeups.load();
+  if (--p->workers == 0 && p->shutdown != nullptr) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, p->shutdown, absl::OkStatus());
+  }
+  if (worker != nullptr) *worker = nullptr;
+  return absl::OkStatus();
+}
+
+grpc_error_handle parking_poller_kick(
+    grpc_pollset* pollset, grpc_pollset_worker* specific_worker) {
+  parking_poller* p = reinterpret_cast<parking_poller*>(pollset);
+  if (specific_worker != nullptr) {
+    parking_poller_wake_all(p);
+    return absl::OkStatus();
+  }
+#ifdef GPR_LINUX
+  p->wakeups.fetch_add(1);
+  if (p->parked.load() != 0) {
+    syscall(SYS_futex, &p->wakeups, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr,
+            0);
+  }
+#else
+  parking_poller_wake_all(p);
+#endif
+  return absl::OkStatus();
+}
+
+void parking_poller_shutdown(grpc_pollset* pollset, grpc_closure* closure) {
+  parking_poller* p = reinterpret_cast<parking_poller*>(pollset);
+  GPR_ASSERT(closure != nullptr);
+  p->shutdown = closure;
+  if (p->workers == 0) {
+    grpc_core::ExecCtx::Run(DEBUG_LOCATION, closure, absl::OkStatus());
+  } else {
+    parking_poller_wake_all(p);
+  }
+}
+
 const cq_poller_vtable g_poller_vtable_by_poller_type[] = {
     // GRPC_CQ_DEFAULT_POLLING
-    {true, true, grpc_pollset_size, grpc_pollset_init, grpc_pollset_kick,
+    {true, true, true, grpc_pollset_size, grpc_pollset_init, grpc_pollset_kick,
      grpc_pollset_work, grpc_pollset_shutdown, grpc_pollset_destroy},
     // GRPC_CQ_NON_LISTENING
-    {true, false, grpc_pollset_size, grpc_pollset_init, grpc_pollset_kick,
-     grpc_pollset_work, grpc_pollset_shutdown, grpc_pollset_destroy},
+    {true, false, true, grpc_pollset_size, grpc_pollset_init,
+     grpc_pollset_kick, grpc_pollset_work, grpc_pollset_shutdown,
+     grpc_pollset_destroy},
     // GRPC_CQ_NON_POLLING
-    {false, false, non_polling_poller_size, non_polling_poller_init,
+    {false, false, true, non_polling_poller_size, non_polling_poller_init,
      non_polling_poller_kick, non_polling_poller_work,
      non_polling_poller_shutdown, non_polling_poller_destroy},
+    // GRPC_CQ_NON_POLLING_LOCK_FREE
+    {false, false, false, parking_poller_size, parking_poller_init,
+     parking_poller_kick, parking_poller_work, parking_poller_shutdown,
+     parking_poller_destroy},
 };
 
 }  // namespace
@@ -729,10 +887,11 @@ static void cq_end_op_for_next(
     if (cqd->pending_events.load(std::memory_order_acquire) != 1) {
       // Only kick if this is the first item queued
       if (is_first) {
-        gpr_mu_lock(cq->mu);
+        const bool kick_needs_lock = cq->poller_vtable->kick_needs_lock;
+        if (kick_needs_lock) gpr_mu_lock(cq->mu);
         grpc_error_handle kick_error =
             cq->poller_vtable->kick(POLLSET_FROM_CQ(cq), nullptr);
-        gpr_mu_unlock(cq->mu);
+        if (kick_needs_lock) gpr_mu_unlock(cq->mu);
 
         if (!kick_error.ok()) {
           gpr_log(GPR_ERROR, "Kick failed: %s",
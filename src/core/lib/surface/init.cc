@@ -35,10 +35,13 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/forkable.h"
 #include "src/core/lib/event_engine/posix_engine/timer_manager.h"
 #include "src/core/lib/experiments/config.h"
+#include "src/core/lib/gprpp/adaptive_mutex.h"
 #include "src/core/lib/gprpp/fork.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/thd.h"
@@ -120,6 +123,13 @@ static void do_basic_init(void) {
   grpc_core::IsInitializedInternally = []() {
     return grpc_is_initialized() != 0;
   };
+  grpc_core::OnAdaptiveMutexContention = [](bool parked) {
+    if (parked) {
+      grpc_core::global_stats().IncrementAdaptiveMutexParks();
+    } else {
+      grpc_core::global_stats().IncrementAdaptiveMutexSpinAcquires();
+    }
+  };
   gpr_log_verbosity_init();
   g_init_mu = new grpc_core::Mutex();
   g_shutting_down_cv = new grpc_core::CondVar();
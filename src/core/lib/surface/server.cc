@@ -28,6 +28,7 @@
 #include <list>
 #include <new>
 #include <queue>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -35,6 +36,7 @@
 
 #include "absl/cleanup/cleanup.h"
 #include "absl/status/status.h"
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 #include "absl/types/variant.h"
 
@@ -49,13 +51,18 @@
 #include "src/core/lib/channel/channel_trace.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/match.h"
 #include "src/core/lib/gprpp/mpscq.h"
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sharded_mpscq.h"
 #include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/pollset_set.h"
 #include "src/core/lib/promise/activity.h"
@@ -187,6 +194,13 @@ class Server::RequestMatcherInterface {
   // concept that essentially maps to gRPC completion queues.
   virtual size_t request_queue_count() const = 0;
 
+  // How many incoming RPCs are waiting to be matched to an
+  // application-requested RPC.
+  virtual size_t pending_call_count() const = 0;
+
+  // When the oldest of those RPCs was queued, if there are any.
+  virtual absl::optional<Timestamp> oldest_pending_call_time() = 0;
+
   // This function is invoked when the application requests a new RPC whose
   // information is in the call parameter. The request_queue_index marks the
   // queue onto which to place this RPC, and is typically associated with a gRPC
@@ -205,18 +219,20 @@ class Server::RequestMatcherInterface {
   // RPC if possible or will place it in the pending queue otherwise. To enable
   // some measure of fairness between server CQs, the match is done starting at
   // the start_request_queue_index parameter in a cyclic order rather than
-  // always starting at 0.
+  // always starting at 0. Pending RPCs are queued per tenant (see
+  // ServerFairQueuingPolicy), and tenants take turns to be matched.
   virtual ArenaPromise<absl::StatusOr<MatchResult>> MatchRequest(
-      size_t start_request_queue_index) = 0;
+      size_t start_request_queue_index, absl::string_view tenant) = 0;
 
   // This function is invoked on an incoming RPC, represented by the calld
   // object. The RequestMatcher will try to match it against an
   // application-requested RPC if possible or will place it in the pending queue
   // otherwise. To enable some measure of fairness between server CQs, the match
   // is done starting at the start_request_queue_index parameter in a cyclic
-  // order rather than always starting at 0.
+  // order rather than always starting at 0. Pending RPCs are queued per
+  // tenant, as with MatchRequest().
   virtual void MatchOrQueue(size_t start_request_queue_index,
-                            CallData* calld) = 0;
+                            absl::string_view tenant, CallData* calld) = 0;
 
   // Returns the server associated with this request matcher
   virtual Server* server() const = 0;
@@ -227,29 +243,44 @@ class Server::RequestMatcherInterface {
 // application to explicitly request RPCs and then matching those to incoming
 // RPCs, along with a slow path by which incoming RPCs are put on a locked
 // pending list if they aren't able to be matched to an application request.
+//
+// The pending lists are sharded per CPU, so that incoming RPCs arriving on
+// different transports do not all contend on one lock when the application
+// falls behind. An incoming RPC is queued on the shard of the CPU it arrived
+// on, and an application request that finds pending RPCs takes them from its
+// own CPU's shard first and then from the others.
+//
+// Each pending list is a DeficitRoundRobinQueue over the tenants of the
+// RPCs, which without GRPC_ARG_SERVER_FAIR_QUEUING all have the same empty
+// tenant, making it a FIFO. With fair queuing, every RPC is queued on the
+// first shard, so that tenants take turns across all pending RPCs.
 class Server::RealRequestMatcher : public RequestMatcherInterface {
  public:
   explicit RealRequestMatcher(Server* server)
       : server_(server), requests_per_cq_(server->cqs_.size()) {}
 
   ~RealRequestMatcher() override {
-    for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
+    for (LockedShardedMultiProducerSingleConsumerQueue& queue :
+         requests_per_cq_) {
       GPR_ASSERT(queue.Pop() == nullptr);
     }
   }
 
   void ZombifyPending() override {
-    while (!pending_.empty()) {
-      Match(
-          pending_.front(),
-          [](CallData* calld) {
-            calld->SetState(CallData::CallState::ZOMBIED);
-            calld->KillZombie();
-          },
-          [](const std::shared_ptr<ActivityWaiter>& w) {
-            w->Finish(absl::InternalError("Server closed"));
-          });
-      pending_.pop();
+    for (Shard& shard : shards_) {
+      MutexLock lock(&shard.mu);
+      while (!shard.pending.empty()) {
+        Match(
+            shard.pending.Pop().call,
+            [](CallData* calld) {
+              calld->SetState(CallData::CallState::ZOMBIED);
+              calld->KillZombie();
+            },
+            [](const std::shared_ptr<ActivityWaiter>& w) {
+              w->Finish(absl::InternalError("Server closed"));
+            });
+        num_pending_.fetch_sub(1, std::memory_order_relaxed);
+      }
     }
   }
 
@@ -267,130 +298,101 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     return requests_per_cq_.size();
   }
 
-  void RequestCallWithPossiblePublish(size_t request_queue_index,
-                                      RequestedCall* call) override {
-    if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
-      // this was the first queued request: we need to lock and start
-      // matching calls
-      struct NextPendingCall {
-        RequestedCall* rc = nullptr;
-        PendingCall pending;
-      };
-      auto pop_next_pending = [this, request_queue_index] {
-        NextPendingCall pending_call;
-        {
-          MutexLock lock(&server_->mu_call_);
-          if (!pending_.empty()) {
-            pending_call.rc = reinterpret_cast<RequestedCall*>(
-                requests_per_cq_[request_queue_index].Pop());
-            if (pending_call.rc != nullptr) {
-              pending_call.pending = std::move(pending_.front());
-              pending_.pop();
-            }
-          }
+  size_t pending_call_count() const override {
+    return num_pending_.load(std::memory_order_relaxed);
+  }
+
+  absl::optional<Timestamp> oldest_pending_call_time() override {
+    absl::optional<Timestamp> oldest;
+    if (num_pending_.load(std::memory_order_relaxed) == 0) return oldest;
+    for (Shard& shard : shards_) {
+      MutexLock lock(&shard.mu);
+      shard.pending.ForEachFront([&oldest](const QueuedCall& call) {
+        if (!oldest.has_value() || call.queued_time < *oldest) {
+          oldest = call.queued_time;
         }
-        return pending_call;
-      };
-      while (true) {
-        NextPendingCall next_pending = pop_next_pending();
-        if (next_pending.rc == nullptr) break;
-        auto mr = MatchResult{request_queue_index, next_pending.rc};
-        Match(
-            next_pending.pending,
-            [mr](CallData* calld) {
-              if (!calld->MaybeActivate()) {
-                // Zombied Call
-                calld->KillZombie();
-              } else {
-                calld->Publish(mr.cq_idx, mr.requested_call);
-              }
-            },
-            [mr](const std::shared_ptr<ActivityWaiter>& w) { w->Finish(mr); });
-      }
+      });
     }
+    return oldest;
   }
 
-  void MatchOrQueue(size_t start_request_queue_index,
-                    CallData* calld) override {
-    for (size_t i = 0; i < requests_per_cq_.size(); i++) {
-      size_t cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
-      RequestedCall* rc =
-          reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].TryPop());
-      if (rc != nullptr) {
-        calld->SetState(CallData::CallState::ACTIVATED);
-        calld->Publish(cq_idx, rc);
-        return;
-      }
+  void RequestCallWithPossiblePublish(size_t request_queue_index,
+                                      RequestedCall* call) override {
+    if (!requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
+      return;
     }
-    // No cq to take the request found; queue it on the slow list.
-    // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
-    // an empty request queue, it will block until the call is actually
-    // added to the pending list.
-    RequestedCall* rc = nullptr;
-    size_t cq_idx = 0;
-    size_t loop_count;
-    {
-      MutexLock lock(&server_->mu_call_);
-      for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
-        cq_idx =
-            (start_request_queue_index + loop_count) % requests_per_cq_.size();
-        rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
-        if (rc != nullptr) {
-          break;
+    // This was the first queued request: we need to start matching calls.
+    // Pairs with the fence in PopRequestOrQueue(): either the call being
+    // queued finds this request, or pending_call_count() here counts it.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (num_pending_.load(std::memory_order_relaxed) == 0) return;
+    Shard* const home = &QueueShard();
+    const size_t num_shards = shards_.end() - shards_.begin();
+    const size_t home_index = home - shards_.begin();
+    // Visit every shard, draining each one until it is empty, and stop early
+    // once we run out of requests.
+    for (size_t i = 0; i < num_shards;) {
+      Shard* shard = shards_.begin() + (home_index + i) % num_shards;
+      RequestedCall* rc;
+      PendingCall pending;
+      {
+        MutexLock lock(&shard->mu);
+        if (shard->pending.empty()) {
+          ++i;
+          continue;
         }
+        rc = reinterpret_cast<RequestedCall*>(
+            requests_per_cq_[request_queue_index].Pop());
+        if (rc == nullptr) return;
+        pending = std::move(shard->pending.Pop().call);
+        num_pending_.fetch_sub(1, std::memory_order_relaxed);
       }
-      if (rc == nullptr) {
-        calld->SetState(CallData::CallState::PENDING);
-        pending_.push(calld);
-        return;
-      }
+      if (shard != home) global_stats().IncrementServerCallsStolen();
+      auto mr = MatchResult{request_queue_index, rc};
+      Match(
+          pending,
+          [mr](CallData* calld) {
+            if (!calld->MaybeActivate()) {
+              // Zombied Call
+              calld->KillZombie();
+            } else {
+              calld->Publish(mr.cq_idx, mr.requested_call);
+            }
+          },
+          [mr](const std::shared_ptr<ActivityWaiter>& w) { w->Finish(mr); });
     }
+  }
+
+  void MatchOrQueue(size_t start_request_queue_index, absl::string_view tenant,
+                    CallData* calld) override {
+    size_t cq_idx;
+    RequestedCall* rc = PopRequestOrQueue(
+        start_request_queue_index, tenant, &cq_idx, [calld]() {
+          calld->SetState(CallData::CallState::PENDING);
+          return PendingCall(calld);
+        });
+    if (rc == nullptr) return;
     calld->SetState(CallData::CallState::ACTIVATED);
     calld->Publish(cq_idx, rc);
   }
 
   ArenaPromise<absl::StatusOr<MatchResult>> MatchRequest(
-      size_t start_request_queue_index) override {
-    for (size_t i = 0; i < requests_per_cq_.size(); i++) {
-      size_t cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
-      RequestedCall* rc =
-          reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].TryPop());
-      if (rc != nullptr) {
-        return Immediate(MatchResult{cq_idx, rc});
-      }
-    }
-    // No cq to take the request found; queue it on the slow list.
-    // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
-    // an empty request queue, it will block until the call is actually
-    // added to the pending list.
-    RequestedCall* rc = nullptr;
-    size_t cq_idx = 0;
-    size_t loop_count;
-    {
-      MutexLock lock(&server_->mu_call_);
-      for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
-        cq_idx =
-            (start_request_queue_index + loop_count) % requests_per_cq_.size();
-        rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
-        if (rc != nullptr) {
-          break;
-        }
-      }
-      if (rc == nullptr) {
-        auto w = std::make_shared<ActivityWaiter>(
-            Activity::current()->MakeOwningWaker());
-        pending_.push(w);
-        return [w]() -> Poll<absl::StatusOr<MatchResult>> {
-          std::unique_ptr<absl::StatusOr<MatchResult>> r(
-              w->result.exchange(nullptr, std::memory_order_acq_rel));
-          if (r == nullptr) return Pending{};
-          return std::move(*r);
-        };
-      }
-    }
-    return Immediate(MatchResult{cq_idx, rc});
+      size_t start_request_queue_index, absl::string_view tenant) override {
+    size_t cq_idx;
+    std::shared_ptr<ActivityWaiter> w;
+    RequestedCall* rc = PopRequestOrQueue(
+        start_request_queue_index, tenant, &cq_idx, [&w]() {
+          w = std::make_shared<ActivityWaiter>(
+              Activity::current()->MakeOwningWaker());
+          return PendingCall(w);
+        });
+    if (rc != nullptr) return Immediate(MatchResult{cq_idx, rc});
+    return [w]() -> Poll<absl::StatusOr<MatchResult>> {
+      std::unique_ptr<absl::StatusOr<MatchResult>> r(
+          w->result.exchange(nullptr, std::memory_order_acq_rel));
+      if (r == nullptr) return Pending{};
+      return std::move(*r);
+    };
   }
 
   Server* server() const override { return server_; }
@@ -409,8 +411,70 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
     std::atomic<absl::StatusOr<MatchResult>*> result{nullptr};
   };
   using PendingCall = absl::variant<CallData*, std::shared_ptr<ActivityWaiter>>;
-  std::queue<PendingCall> pending_;
-  std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
+  struct QueuedCall {
+    PendingCall call;
+    Timestamp queued_time;
+  };
+  struct Shard {
+    Mutex mu;
+    DeficitRoundRobinQueue<QueuedCall> pending ABSL_GUARDED_BY(mu);
+  };
+
+  // The shard that RPCs arriving on this CPU are queued on.
+  Shard& QueueShard() {
+    if (server_->fair_queuing_policy_ != nullptr) return *shards_.begin();
+    return shards_.this_cpu();
+  }
+
+  // Returns an application-requested RPC from the request queues, trying
+  // them in a cyclic order from start_request_queue_index, and sets *cq_idx
+  // to its queue. If there is none, queues make_pending() as an RPC of tenant
+  // on QueueShard() and returns nullptr.
+  template <typename MakePending>
+  RequestedCall* PopRequestOrQueue(size_t start_request_queue_index,
+                                   absl::string_view tenant, size_t* cq_idx,
+                                   MakePending make_pending) {
+    for (size_t i = 0; i < requests_per_cq_.size(); i++) {
+      *cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
+      RequestedCall* rc = reinterpret_cast<RequestedCall*>(
+          requests_per_cq_[*cq_idx].TryPop());
+      if (rc != nullptr) return rc;
+    }
+    // No cq to take the request found; queue it on the slow list.
+    // We need to ensure that all the queues are empty.  We do this under
+    // the shard lock to ensure that if something is added to an empty
+    // request queue, the matching that it starts will block on this shard
+    // until the call is actually added to the pending list.
+    Shard& shard = QueueShard();
+    MutexLock lock(&shard.mu);
+    // Counted as pending before checking the queues, so that a request
+    // added concurrently either is found below or sees this call pending.
+    num_pending_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (size_t i = 0; i < requests_per_cq_.size(); i++) {
+      *cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
+      RequestedCall* rc =
+          reinterpret_cast<RequestedCall*>(requests_per_cq_[*cq_idx].Pop());
+      if (rc != nullptr) {
+        num_pending_.fetch_sub(1, std::memory_order_relaxed);
+        return rc;
+      }
+    }
+    global_stats().IncrementServerCallsQueued();
+    shard.pending.Push(tenant,
+                       server_->fair_queuing_policy_ == nullptr
+                           ? 1
+                           : server_->fair_queuing_policy_->WeightOf(tenant),
+                       QueuedCall{make_pending(), Timestamp::Now()});
+    return nullptr;
+  }
+
+  PerCpu<Shard> shards_;
+  // Total number of calls in the shards' pending lists.
+  std::atomic<size_t> num_pending_{0};
+  // Sharded by CPU: every thread requesting calls pushes to these.  The
+  // order requests are matched in does not matter.
+  std::vector<LockedShardedMultiProducerSingleConsumerQueue> requests_per_cq_;
 };
 
 // AllocatingRequestMatchers don't allow the application to request an RPC in
@@ -439,6 +503,12 @@ class Server::AllocatingRequestMatcherBase : public RequestMatcherInterface {
 
   size_t request_queue_count() const override { return 0; }
 
+  size_t pending_call_count() const override { return 0; }
+
+  absl::optional<Timestamp> oldest_pending_call_time() override {
+    return absl::nullopt;
+  }
+
   void RequestCallWithPossiblePublish(size_t /*request_queue_index*/,
                                       RequestedCall* /*call*/) final {
     Crash("unreachable");
@@ -469,7 +539,7 @@ class Server::AllocatingRequestMatcherBatch
         allocator_(std::move(allocator)) {}
 
   void MatchOrQueue(size_t /*start_request_queue_index*/,
-                    CallData* calld) override {
+                    absl::string_view /*tenant*/, CallData* calld) override {
     const bool still_running = server()->ShutdownRefOnRequest();
     auto cleanup_ref =
         absl::MakeCleanup([this] { server()->ShutdownUnrefOnRequest(); });
@@ -489,7 +559,8 @@ class Server::AllocatingRequestMatcherBatch
   }
 
   ArenaPromise<absl::StatusOr<MatchResult>> MatchRequest(
-      size_t /*start_request_queue_index*/) override {
+      size_t /*start_request_queue_index*/,
+      absl::string_view /*tenant*/) override {
     const bool still_running = server()->ShutdownRefOnRequest();
     auto cleanup_ref =
         absl::MakeCleanup([this] { server()->ShutdownUnrefOnRequest(); });
@@ -523,7 +594,7 @@ class Server::AllocatingRequestMatcherRegistered
         allocator_(std::move(allocator)) {}
 
   void MatchOrQueue(size_t /*start_request_queue_index*/,
-                    CallData* calld) override {
+                    absl::string_view /*tenant*/, CallData* calld) override {
     auto cleanup_ref =
         absl::MakeCleanup([this] { server()->ShutdownUnrefOnRequest(); });
     if (server()->ShutdownRefOnRequest()) {
@@ -543,7 +614,8 @@ class Server::AllocatingRequestMatcherRegistered
   }
 
   ArenaPromise<absl::StatusOr<MatchResult>> MatchRequest(
-      size_t /*start_request_queue_index*/) override {
+      size_t /*start_request_queue_index*/,
+      absl::string_view /*tenant*/) override {
     const bool still_running = server()->ShutdownRefOnRequest();
     auto cleanup_ref =
         absl::MakeCleanup([this] { server()->ShutdownUnrefOnRequest(); });
@@ -670,9 +742,17 @@ RefCountedPtr<channelz::ServerNode> CreateChannelzNode(
 }  // namespace
 
 Server::Server(const ChannelArgs& args)
-    : channel_args_(args), channelz_node_(CreateChannelzNode(args)) {}
+    : channel_args_(args),
+      channelz_node_(CreateChannelzNode(args)),
+      // Calls only arrive on the server's channels once Start() has created
+      // the request matchers.
+      admission_controller_(ServerAdmissionController::Create(
+          args, [this]() { return OldestPendingCallTime(); })),
+      fair_queuing_policy_(ServerFairQueuingPolicy::Create(args)),
+      connection_rebalancer_(ServerConnectionRebalancer::Create(args)) {}
 
 Server::~Server() {
+  if (admission_controller_ != nullptr) admission_controller_->Shutdown();
   // Remove the cq pollsets from the config_fetcher.
   if (started_ && config_fetcher_ != nullptr &&
       config_fetcher_->interested_parties() != nullptr) {
@@ -737,8 +817,18 @@ grpc_error_handle Server::SetupTransport(
     const ChannelArgs& args,
     const RefCountedPtr<channelz::SocketNode>& socket_node) {
   // Create channel.
+  ChannelArgs channel_args = args;
+  if (admission_controller_ != nullptr) {
+    channel_args = channel_args.SetObject(admission_controller_);
+  }
+  if (fair_queuing_policy_ != nullptr) {
+    channel_args = channel_args.SetObject(fair_queuing_policy_);
+  }
+  if (connection_rebalancer_ != nullptr) {
+    channel_args = channel_args.SetObject(connection_rebalancer_);
+  }
   absl::StatusOr<RefCountedPtr<Channel>> channel =
-      Channel::Create(nullptr, args, GRPC_SERVER_CHANNEL, transport);
+      Channel::Create(nullptr, channel_args, GRPC_SERVER_CHANNEL, transport);
   if (!channel.ok()) {
     return absl_status_to_grpc_error(channel.status());
   }
@@ -960,6 +1050,24 @@ void Server::ShutdownAndNotify(grpc_completion_queue* cq, void* tag) {
   broadcaster.BroadcastShutdown(/*send_goaway=*/true, absl::OkStatus());
 }
 
+absl::optional<Timestamp> Server::OldestPendingCallTime() {
+  absl::optional<Timestamp> oldest =
+      unregistered_request_matcher_->oldest_pending_call_time();
+  for (std::unique_ptr<RegisteredMethod>& rm : registered_methods_) {
+    absl::optional<Timestamp> t = rm->matcher->oldest_pending_call_time();
+    if (t.has_value() && (!oldest.has_value() || *t < *oldest)) oldest = t;
+  }
+  return oldest;
+}
+
+size_t Server::PendingCallCount() const {
+  size_t count = unregistered_request_matcher_->pending_call_count();
+  for (const std::unique_ptr<RegisteredMethod>& rm : registered_methods_) {
+    count += rm->matcher->pending_call_count();
+  }
+  return count;
+}
+
 void Server::StopListening() {
   for (auto& listener : listeners_) {
     if (listener.listener == nullptr) continue;
@@ -1306,8 +1414,13 @@ ArenaPromise<ServerMetadataHandle> Server::ChannelData::MakeCallPromise(
   } else {
     matcher = server->unregistered_request_matcher_.get();
   }
+  std::string tenant;
+  if (server->fair_queuing_policy_ != nullptr) {
+    tenant = server->fair_queuing_policy_->TenantOf(
+        *call_args.client_initial_metadata, path->as_string_view());
+  }
   return TrySeq(
-      TryJoin(matcher->MatchRequest(chand->cq_idx()),
+      TryJoin(matcher->MatchRequest(chand->cq_idx(), tenant),
               std::move(maybe_read_first_message)),
       [path = std::move(*path), host = std::move(*host_ptr), deadline, server,
        call_args = std::move(call_args)](
@@ -1502,7 +1615,7 @@ void Server::CallData::PublishNewRpc(void* arg, grpc_error_handle error) {
     calld->KillZombie();
     return;
   }
-  rm->MatchOrQueue(chand->cq_idx(), calld);
+  rm->MatchOrQueue(chand->cq_idx(), calld->tenant_, calld);
 }
 
 namespace {
@@ -1599,6 +1712,12 @@ void Server::CallData::RecvInitialMetadataReady(void* arg,
     auto* host =
         calld->recv_initial_metadata_->get_pointer(HttpAuthorityMetadata());
     if (host != nullptr) calld->host_.emplace(host->Ref());
+    const ServerFairQueuingPolicy* fair_queuing_policy =
+        calld->server_->fair_queuing_policy_.get();
+    if (fair_queuing_policy != nullptr && calld->path_.has_value()) {
+      calld->tenant_ = fair_queuing_policy->TenantOf(
+          *calld->recv_initial_metadata_, calld->path_->as_string_view());
+    }
   }
   auto op_deadline = calld->recv_initial_metadata_->get(GrpcTimeoutMetadata());
   if (op_deadline.has_value()) {
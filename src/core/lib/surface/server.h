@@ -60,6 +60,9 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/channel.h"
 #include "src/core/lib/surface/completion_queue.h"
+#include "src/core/lib/surface/server_admission_control.h"
+#include "src/core/lib/surface/server_connection_rebalancer.h"
+#include "src/core/lib/surface/server_fair_queuing.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/lib/transport/transport_fwd.h"
@@ -139,6 +142,12 @@ class Server : public InternallyRefCounted<Server>,
     return config_fetcher_.get();
   }
 
+  // Null unless the server's listeners are to shed connections under load.
+  const RefCountedPtr<ServerConnectionRebalancer>& connection_rebalancer()
+      const {
+    return connection_rebalancer_;
+  }
+
   void set_config_fetcher(
       std::unique_ptr<grpc_server_config_fetcher> config_fetcher) {
     config_fetcher_ = std::move(config_fetcher);
@@ -199,6 +208,12 @@ class Server : public InternallyRefCounted<Server>,
 
   void SendGoaways() ABSL_LOCKS_EXCLUDED(mu_global_, mu_call_);
 
+  // Do not call this before Start(). Returns how many incoming calls, over
+  // all methods, are waiting for the application to request them. This is
+  // cheap enough to poll, e.g. to shed load when the application falls
+  // behind.
+  size_t PendingCallCount() const;
+
  private:
   struct RequestedCall;
 
@@ -327,6 +342,8 @@ class Server : public InternallyRefCounted<Server>,
 
     absl::optional<Slice> path_;
     absl::optional<Slice> host_;
+    // Empty unless GRPC_ARG_SERVER_FAIR_QUEUING is set.
+    std::string tenant_;
     Timestamp deadline_ = Timestamp::InfFuture();
 
     grpc_completion_queue* cq_new_ = nullptr;
@@ -442,8 +459,19 @@ class Server : public InternallyRefCounted<Server>,
     return shutdown_refs_.load(std::memory_order_acquire) == 0;
   }
 
+  // When the oldest incoming call still waiting for the application to
+  // request it was queued, over all methods. Used for admission control.
+  absl::optional<Timestamp> OldestPendingCallTime();
+
   ChannelArgs const channel_args_;
   RefCountedPtr<channelz::ServerNode> channelz_node_;
+  // Null unless GRPC_ARG_SERVER_ADMISSION_CONTROL is set.
+  RefCountedPtr<ServerAdmissionController> admission_controller_;
+  // Null unless GRPC_ARG_SERVER_FAIR_QUEUING is set.
+  RefCountedPtr<ServerFairQueuingPolicy> fair_queuing_policy_;
+  // Null unless GRPC_ARG_SERVER_CONNECTION_REBALANCING_LOAD_THRESHOLD_PERCENT
+  // is set.
+  RefCountedPtr<ServerConnectionRebalancer> connection_rebalancer_;
   std::unique_ptr<grpc_server_config_fetcher> config_fetcher_;
 
   std::vector<grpc_completion_queue*> cqs_;
@@ -0,0 +1,179 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/surface/server_admission_control.h"
+
+#include <limits.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/status/status.h"
+
+#include <grpc/impl/grpc_types.h>
+
+#include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/promise/promise.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/surface/channel_stack_type.h"
+
+namespace grpc_core {
+
+namespace {
+
+// How often Admit() samples the overload signals.
+constexpr Duration kUpdateInterval = Duration::Milliseconds(5);
+
+constexpr Duration kDefaultMaxQueueDelay = Duration::Milliseconds(100);
+constexpr Duration kDefaultMaxEventEngineDelay = Duration::Milliseconds(100);
+
+}  // namespace
+
+//
+// ServerAdmissionController
+//
+
+RefCountedPtr<ServerAdmissionController> ServerAdmissionController::Create(
+    const ChannelArgs& args, OldestPendingCallTime oldest_pending_call_time) {
+  if (!args.GetBool(GRPC_ARG_SERVER_ADMISSION_CONTROL).value_or(false)) {
+    return nullptr;
+  }
+  auto event_engine =
+      args.GetObjectRef<grpc_event_engine::experimental::EventEngine>();
+  if (event_engine == nullptr) {
+    event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  }
+  auto* resource_quota = args.GetObject<ResourceQuota>();
+  return MakeRefCounted<ServerAdmissionController>(
+      std::max(Duration::Zero(),
+               args.GetDurationFromIntMillis(
+                       GRPC_ARG_SERVER_ADMISSION_CONTROL_MAX_QUEUE_DELAY_MS)
+                   .value_or(kDefaultMaxQueueDelay)),
+      std::max(
+          Duration::Zero(),
+          args.GetDurationFromIntMillis(
+                  GRPC_ARG_SERVER_ADMISSION_CONTROL_MAX_EVENT_ENGINE_DELAY_MS)
+              .value_or(kDefaultMaxEventEngineDelay)),
+      resource_quota == nullptr ? ResourceQuota::Default()->memory_quota()
+                                : resource_quota->memory_quota(),
+      std::move(event_engine), std::move(oldest_pending_call_time));
+}
+
+ServerAdmissionController::ServerAdmissionController(
+    Duration max_queue_delay, Duration max_event_engine_delay,
+    MemoryQuotaRefPtr memory_quota,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
+    OldestPendingCallTime oldest_pending_call_time)
+    : max_queue_delay_(max_queue_delay),
+      max_event_engine_delay_(max_event_engine_delay),
+      memory_quota_(std::move(memory_quota)),
+      event_engine_(std::move(event_engine)),
+      oldest_pending_call_time_(std::move(oldest_pending_call_time)) {}
+
+bool ServerAdmissionController::Admit() {
+  const Timestamp now = Timestamp::Now();
+  // Only one caller samples the signals; the others go with the last
+  // decision rather than waiting for it.
+  if (now.milliseconds_after_process_epoch() >=
+          next_update_.load(std::memory_order_relaxed) &&
+      mu_.TryLock()) {
+    UpdateLocked(now);
+    mu_.Unlock();
+  }
+  return !overloaded_.load(std::memory_order_relaxed);
+}
+
+void ServerAdmissionController::Shutdown() {
+  MutexLock lock(&mu_);
+  oldest_pending_call_time_ = nullptr;
+}
+
+void ServerAdmissionController::UpdateLocked(Timestamp now) {
+  next_update_.store((now + kUpdateInterval).milliseconds_after_process_epoch(),
+                     std::memory_order_relaxed);
+  bool overloaded = memory_quota_->IsMemoryPressureHigh();
+  if (!overloaded && oldest_pending_call_time_ != nullptr) {
+    absl::optional<Timestamp> oldest = oldest_pending_call_time_();
+    overloaded = oldest.has_value() && now - *oldest > max_queue_delay_;
+  }
+  // A probe that has not run yet counts for as long as it has waited, so
+  // that a stuck thread pool is noticed before the probe completes.
+  const Duration event_engine_delay =
+      probe_in_flight_ ? now - probe_start_ : probe_delay_;
+  if (event_engine_delay > max_event_engine_delay_) overloaded = true;
+  if (!probe_in_flight_) {
+    probe_in_flight_ = true;
+    probe_start_ = now;
+    event_engine_->Run([self = Ref()]() {
+      MutexLock lock(&self->mu_);
+      self->probe_delay_ = Timestamp::Now() - self->probe_start_;
+      self->probe_in_flight_ = false;
+    });
+  }
+  overloaded_.store(overloaded, std::memory_order_relaxed);
+}
+
+//
+// ServerAdmissionControlFilter
+//
+
+const grpc_channel_filter ServerAdmissionControlFilter::kFilter =
+    MakePromiseBasedFilter<ServerAdmissionControlFilter,
+                           FilterEndpoint::kServer>("server_admission_control");
+
+absl::StatusOr<ServerAdmissionControlFilter>
+ServerAdmissionControlFilter::Create(const ChannelArgs& args,
+                                     ChannelFilter::Args) {
+  auto controller = args.GetObjectRef<ServerAdmissionController>();
+  if (controller == nullptr) {
+    return absl::InvalidArgumentError(
+        "server_admission_control filter needs a ServerAdmissionController");
+  }
+  return ServerAdmissionControlFilter(std::move(controller));
+}
+
+ArenaPromise<ServerMetadataHandle>
+ServerAdmissionControlFilter::MakeCallPromise(
+    CallArgs call_args, NextPromiseFactory next_promise_factory) {
+  if (!controller_->Admit()) {
+    global_stats().IncrementServerCallsRejected();
+    return Immediate(ServerMetadataFromStatus(
+        absl::ResourceExhaustedError("Server overloaded")));
+  }
+  return next_promise_factory(std::move(call_args));
+}
+
+void RegisterServerAdmissionControlFilter(CoreConfiguration::Builder* builder) {
+  builder->channel_init()->RegisterStage(
+      GRPC_SERVER_CHANNEL, INT_MAX, [](ChannelStackBuilder* builder) {
+        if (builder->channel_args().GetObject<ServerAdmissionController>() ==
+            nullptr) {
+          return true;
+        }
+        // Right above the connected channel filter, which every other stage
+        // has already run by now and which is always the last filter.
+        std::vector<const grpc_channel_filter*>* stack =
+            builder->mutable_stack();
+        if (stack->empty()) return true;
+        stack->insert(stack->end() - 1, &ServerAdmissionControlFilter::kFilter);
+        return true;
+      });
+}
+
+}  // namespace grpc_core
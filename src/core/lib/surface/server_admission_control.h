@@ -0,0 +1,137 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SURFACE_SERVER_ADMISSION_CONTROL_H
+#define GRPC_SRC_CORE_LIB_SURFACE_SERVER_ADMISSION_CONTROL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_fwd.h"
+#include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/transport/transport.h"
+
+namespace grpc_core {
+
+// Decides whether a server is overloaded, and should turn away new calls
+// before spending anything on them. The server counts as overloaded while
+// any of the following holds:
+// - an incoming call has waited longer than the configured queue delay for
+//   the application to request it,
+// - the server's memory quota is under high pressure,
+// - the EventEngine took longer than the configured delay to run a callback.
+// The signals are sampled at most every few milliseconds, so that Admit()
+// is cheap enough to be asked for every call.
+class ServerAdmissionController
+    : public RefCounted<ServerAdmissionController> {
+ public:
+  // Returns the time at which the oldest incoming call still waiting to be
+  // requested by the application was queued, if any.
+  using OldestPendingCallTime = absl::AnyInvocable<absl::optional<Timestamp>()>;
+
+  // Returns null unless GRPC_ARG_SERVER_ADMISSION_CONTROL is set in args.
+  static RefCountedPtr<ServerAdmissionController> Create(
+      const ChannelArgs& args, OldestPendingCallTime oldest_pending_call_time);
+
+  ServerAdmissionController(
+      Duration max_queue_delay, Duration max_event_engine_delay,
+      MemoryQuotaRefPtr memory_quota,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine,
+      OldestPendingCallTime oldest_pending_call_time);
+
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.server_admission_controller";
+  }
+  static int ChannelArgsCompare(const ServerAdmissionController* a,
+                                const ServerAdmissionController* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Returns false if a new call should be rejected.
+  bool Admit();
+
+  // Stops looking at the server's pending calls, once the server is gone.
+  void Shutdown();
+
+ private:
+  void UpdateLocked(Timestamp now) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const Duration max_queue_delay_;
+  const Duration max_event_engine_delay_;
+  const MemoryQuotaRefPtr memory_quota_;
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+      event_engine_;
+  Mutex mu_;
+  OldestPendingCallTime oldest_pending_call_time_ ABSL_GUARDED_BY(mu_);
+  // When the EventEngine was last asked to run a probe callback, and how
+  // long it took to run the last probe that completed.
+  bool probe_in_flight_ ABSL_GUARDED_BY(mu_) = false;
+  Timestamp probe_start_ ABSL_GUARDED_BY(mu_);
+  Duration probe_delay_ ABSL_GUARDED_BY(mu_);
+  std::atomic<bool> overloaded_{false};
+  // Milliseconds after the process epoch at which the signals are to be
+  // sampled again.
+  std::atomic<int64_t> next_update_{0};
+};
+
+// Fails calls with RESOURCE_EXHAUSTED while the server's
+// ServerAdmissionController reports overload. Sits right above the
+// transport, so rejected calls skip the work of every other filter and
+// never reach the server's request matching.
+class ServerAdmissionControlFilter final : public ChannelFilter {
+ public:
+  static const grpc_channel_filter kFilter;
+
+  static absl::StatusOr<ServerAdmissionControlFilter> Create(
+      const ChannelArgs& args, ChannelFilter::Args);
+
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(
+      CallArgs call_args, NextPromiseFactory next_promise_factory) override;
+
+ private:
+  explicit ServerAdmissionControlFilter(
+      RefCountedPtr<ServerAdmissionController> controller)
+      : controller_(std::move(controller)) {}
+
+  RefCountedPtr<ServerAdmissionController> controller_;
+};
+
+void RegisterServerAdmissionControlFilter(CoreConfiguration::Builder* builder);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SURFACE_SERVER_ADMISSION_CONTROL_H
@@ -0,0 +1,172 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/surface/server_connection_rebalancer.h"
+
+#include <limits.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "absl/status/status.h"
+
+#include <grpc/impl/grpc_types.h>
+
+#include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/surface/channel_stack_type.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Counts a call in flight for as long as it lives.
+class CallInFlight {
+ public:
+  explicit CallInFlight(RefCountedPtr<ServerConnectionRebalancer> rebalancer)
+      : rebalancer_(std::move(rebalancer)) {
+    rebalancer_->StartCall();
+  }
+  CallInFlight(CallInFlight&& other) noexcept = default;
+  CallInFlight& operator=(CallInFlight&&) = delete;
+  ~CallInFlight() {
+    if (rebalancer_ != nullptr) rebalancer_->FinishCall();
+  }
+
+ private:
+  RefCountedPtr<ServerConnectionRebalancer> rebalancer_;
+};
+
+}  // namespace
+
+//
+// ServerConnectionRebalancer
+//
+
+constexpr Duration ServerConnectionRebalancer::kCheckInterval;
+
+RefCountedPtr<ServerConnectionRebalancer> ServerConnectionRebalancer::Create(
+    const ChannelArgs& args) {
+  const int threshold_percent =
+      args.GetInt(GRPC_ARG_SERVER_CONNECTION_REBALANCING_LOAD_THRESHOLD_PERCENT)
+          .value_or(0);
+  if (threshold_percent <= 0) return nullptr;
+  const int max_goaways_per_second =
+      args.GetInt(GRPC_ARG_SERVER_CONNECTION_REBALANCING_MAX_GOAWAYS_PER_SECOND)
+          .value_or(1);
+  return MakeRefCounted<ServerConnectionRebalancer>(
+      threshold_percent / 100.0, std::max(1, max_goaways_per_second),
+      std::max(0, args.GetInt(GRPC_ARG_SERVER_CONNECTION_REBALANCING_MAX_CALLS)
+                      .value_or(0)),
+      args.GetObjectRef<ServerLoadReporter>());
+}
+
+ServerConnectionRebalancer::ServerConnectionRebalancer(
+    double load_threshold, double max_goaways_per_second, size_t max_calls,
+    RefCountedPtr<ServerLoadReporter> load_reporter)
+    : load_threshold_(load_threshold),
+      max_goaways_per_second_(max_goaways_per_second),
+      max_calls_(max_calls),
+      load_reporter_(std::move(load_reporter)),
+      tokens_(std::max(1.0, max_goaways_per_second)) {}
+
+double ServerConnectionRebalancer::Load() {
+  double load = 0;
+  if (max_calls_ != 0) {
+    load = static_cast<double>(
+               calls_in_flight_.load(std::memory_order_relaxed)) /
+           max_calls_;
+  }
+  if (load_reporter_ != nullptr) {
+    absl::optional<double> utilization = load_reporter_->Utilization();
+    if (utilization.has_value()) load = std::max(load, *utilization);
+  }
+  return load;
+}
+
+size_t ServerConnectionRebalancer::ConnectionsToShed(size_t num_connections,
+                                                     Timestamp now) {
+  if (num_connections == 0) return 0;
+  const double load = Load();
+  if (load <= load_threshold_) return 0;
+  // Assuming the load is spread evenly over the connections, this is the
+  // share of them that takes the load above the threshold.
+  const size_t wanted = static_cast<size_t>(
+      std::ceil(num_connections * (1 - load_threshold_ / load)));
+  MutexLock lock(&mu_);
+  if (last_refill_.has_value()) {
+    tokens_ = std::min(std::max(1.0, max_goaways_per_second_),
+                       tokens_ + (now - *last_refill_).seconds() *
+                                     max_goaways_per_second_);
+  }
+  last_refill_ = now;
+  const size_t shed =
+      std::min(wanted, static_cast<size_t>(std::floor(tokens_)));
+  tokens_ -= shed;
+  return shed;
+}
+
+//
+// ServerConnectionRebalancingFilter
+//
+
+const grpc_channel_filter ServerConnectionRebalancingFilter::kFilter =
+    MakePromiseBasedFilter<ServerConnectionRebalancingFilter,
+                           FilterEndpoint::kServer>(
+        "server_connection_rebalancing");
+
+absl::StatusOr<ServerConnectionRebalancingFilter>
+ServerConnectionRebalancingFilter::Create(const ChannelArgs& args,
+                                          ChannelFilter::Args) {
+  auto rebalancer = args.GetObjectRef<ServerConnectionRebalancer>();
+  if (rebalancer == nullptr) {
+    return absl::InvalidArgumentError(
+        "server_connection_rebalancing filter needs a "
+        "ServerConnectionRebalancer");
+  }
+  return ServerConnectionRebalancingFilter(std::move(rebalancer));
+}
+
+ArenaPromise<ServerMetadataHandle>
+ServerConnectionRebalancingFilter::MakeCallPromise(
+    CallArgs call_args, NextPromiseFactory next_promise_factory) {
+  // The call counts until its promise is destroyed, however it ends.
+  return Map(next_promise_factory(std::move(call_args)),
+             [in_flight = CallInFlight(rebalancer_)](ServerMetadataHandle md) {
+               return md;
+             });
+}
+
+void RegisterServerConnectionRebalancingFilter(
+    CoreConfiguration::Builder* builder) {
+  builder->channel_init()->RegisterStage(
+      GRPC_SERVER_CHANNEL, INT_MAX, [](ChannelStackBuilder* builder) {
+        auto* rebalancer =
+            builder->channel_args().GetObject<ServerConnectionRebalancer>();
+        if (rebalancer == nullptr || !rebalancer->counts_calls()) return true;
+        // Right above the connected channel filter, which is always the last
+        // filter.
+        std::vector<const grpc_channel_filter*>* stack =
+            builder->mutable_stack();
+        if (stack->empty()) return true;
+        stack->insert(stack->end() - 1,
+                      &ServerConnectionRebalancingFilter::kFilter);
+        return true;
+      });
+}
+
+}  // namespace grpc_core
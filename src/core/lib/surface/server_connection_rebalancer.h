@@ -0,0 +1,146 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SURFACE_SERVER_CONNECTION_REBALANCER_H
+#define GRPC_SRC_CORE_LIB_SURFACE_SERVER_CONNECTION_REBALANCER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <atomic>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_fwd.h"
+#include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/transport/transport.h"
+
+namespace grpc_core {
+
+// Tells the server how busy the process is, by some measure the server
+// cannot see for itself, such as the utilization the application reports
+// for ORCA. Passed to the server in its channel args.
+class ServerLoadReporter : public RefCounted<ServerLoadReporter> {
+ public:
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.server_load_reporter";
+  }
+  static int ChannelArgsCompare(const ServerLoadReporter* a,
+                                const ServerLoadReporter* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Returns the utilization of the server, where 1 means fully loaded, or
+  // nullopt if it is not known.
+  virtual absl::optional<double> Utilization() = 0;
+};
+
+// Decides when a server with
+// GRPC_ARG_SERVER_CONNECTION_REBALANCING_LOAD_THRESHOLD_PERCENT sends
+// GOAWAY to some of its connections, so that their clients reconnect to
+// less loaded servers. Each listener asks it every kCheckInterval how many
+// of its connections to shed. The GOAWAYs of all the server's listeners
+// come out of one token bucket, so that the server does not drop a large
+// part of its clients at once while they take time to move.
+class ServerConnectionRebalancer
+    : public RefCounted<ServerConnectionRebalancer> {
+ public:
+  static constexpr Duration kCheckInterval = Duration::Seconds(1);
+
+  // Returns null unless
+  // GRPC_ARG_SERVER_CONNECTION_REBALANCING_LOAD_THRESHOLD_PERCENT is set in
+  // args.
+  static RefCountedPtr<ServerConnectionRebalancer> Create(
+      const ChannelArgs& args);
+
+  // load_threshold is a fraction of the capacity. A max_calls of 0 leaves
+  // calls in flight out of the load.
+  ServerConnectionRebalancer(double load_threshold,
+                             double max_goaways_per_second, size_t max_calls,
+                             RefCountedPtr<ServerLoadReporter> load_reporter);
+
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.server_connection_rebalancer";
+  }
+  static int ChannelArgsCompare(const ServerConnectionRebalancer* a,
+                                const ServerConnectionRebalancer* b) {
+    return QsortCompare(a, b);
+  }
+
+  bool counts_calls() const { return max_calls_ != 0; }
+  void StartCall() { calls_in_flight_.fetch_add(1, std::memory_order_relaxed); }
+  void FinishCall() {
+    calls_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // Returns the load of the server, where 1 means at full capacity.
+  double Load();
+
+  // Returns how many of a listener's num_connections established
+  // connections to send GOAWAY to at time now, and takes that many from the
+  // rate limit.
+  size_t ConnectionsToShed(size_t num_connections, Timestamp now);
+
+ private:
+  const double load_threshold_;
+  const double max_goaways_per_second_;
+  const size_t max_calls_;
+  const RefCountedPtr<ServerLoadReporter> load_reporter_;
+  std::atomic<size_t> calls_in_flight_{0};
+  Mutex mu_;
+  // GOAWAYs that may be sent right away, refilled at max_goaways_per_second_
+  // up to a second's worth.
+  double tokens_ ABSL_GUARDED_BY(mu_);
+  absl::optional<Timestamp> last_refill_ ABSL_GUARDED_BY(mu_);
+};
+
+// Counts the calls in flight on a server whose ServerConnectionRebalancer
+// weighs them in its load.
+class ServerConnectionRebalancingFilter final : public ChannelFilter {
+ public:
+  static const grpc_channel_filter kFilter;
+
+  static absl::StatusOr<ServerConnectionRebalancingFilter> Create(
+      const ChannelArgs& args, ChannelFilter::Args);
+
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(
+      CallArgs call_args, NextPromiseFactory next_promise_factory) override;
+
+ private:
+  explicit ServerConnectionRebalancingFilter(
+      RefCountedPtr<ServerConnectionRebalancer> rebalancer)
+      : rebalancer_(std::move(rebalancer)) {}
+
+  RefCountedPtr<ServerConnectionRebalancer> rebalancer_;
+};
+
+void RegisterServerConnectionRebalancingFilter(
+    CoreConfiguration::Builder* builder);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SURFACE_SERVER_CONNECTION_REBALANCER_H
@@ -0,0 +1,197 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/surface/server_fair_queuing.h"
+
+#include <limits.h>
+
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
+#include "absl/types/optional.h"
+
+#include <grpc/impl/grpc_types.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/promise.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/surface/channel_stack_type.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Parses "tenant=weight,...", skipping the entries that are not valid.
+absl::flat_hash_map<std::string, uint32_t> ParseWeights(
+    absl::string_view weights_arg) {
+  absl::flat_hash_map<std::string, uint32_t> weights;
+  for (absl::string_view entry :
+       absl::StrSplit(weights_arg, ',', absl::SkipWhitespace())) {
+    std::pair<absl::string_view, absl::string_view> tenant_and_weight =
+        absl::StrSplit(entry, absl::MaxSplits('=', 1));
+    uint32_t weight;
+    if (!absl::SimpleAtoi(tenant_and_weight.second, &weight) || weight == 0) {
+      gpr_log(GPR_ERROR, "%s: ignoring invalid entry \"%s\"",
+              GRPC_ARG_SERVER_FAIR_QUEUING_TENANT_WEIGHTS,
+              std::string(entry).c_str());
+      continue;
+    }
+    weights[std::string(absl::StripAsciiWhitespace(tenant_and_weight.first))] =
+        weight;
+  }
+  return weights;
+}
+
+// Counts a call in flight for as long as it lives.
+class CallInFlight {
+ public:
+  CallInFlight(RefCountedPtr<ServerFairQueuingPolicy> policy,
+               std::string tenant)
+      : policy_(std::move(policy)), tenant_(std::move(tenant)) {}
+  CallInFlight(CallInFlight&& other) noexcept = default;
+  CallInFlight& operator=(CallInFlight&&) = delete;
+  ~CallInFlight() {
+    if (policy_ != nullptr) policy_->FinishCall(tenant_);
+  }
+
+ private:
+  RefCountedPtr<ServerFairQueuingPolicy> policy_;
+  std::string tenant_;
+};
+
+}  // namespace
+
+//
+// ServerFairQueuingPolicy
+//
+
+RefCountedPtr<ServerFairQueuingPolicy> ServerFairQueuingPolicy::Create(
+    const ChannelArgs& args) {
+  if (!args.GetBool(GRPC_ARG_SERVER_FAIR_QUEUING).value_or(false)) {
+    return nullptr;
+  }
+  return MakeRefCounted<ServerFairQueuingPolicy>(
+      std::string(
+          args.GetString(GRPC_ARG_SERVER_FAIR_QUEUING_TENANT_METADATA_KEY)
+              .value_or("")),
+      ParseWeights(args.GetString(GRPC_ARG_SERVER_FAIR_QUEUING_TENANT_WEIGHTS)
+                       .value_or("")),
+      std::max(
+          0,
+          args.GetInt(
+                  GRPC_ARG_SERVER_FAIR_QUEUING_MAX_CONCURRENT_CALLS_PER_TENANT)
+              .value_or(0)));
+}
+
+ServerFairQueuingPolicy::ServerFairQueuingPolicy(
+    std::string tenant_metadata_key,
+    absl::flat_hash_map<std::string, uint32_t> weights,
+    size_t max_concurrent_calls_per_tenant)
+    : tenant_metadata_key_(std::move(tenant_metadata_key)),
+      weights_(std::move(weights)),
+      max_concurrent_calls_per_tenant_(max_concurrent_calls_per_tenant) {}
+
+std::string ServerFairQueuingPolicy::TenantOf(
+    const grpc_metadata_batch& metadata, absl::string_view path) const {
+  if (tenant_metadata_key_.empty()) return std::string(path);
+  std::string backing;
+  absl::optional<absl::string_view> tenant =
+      metadata.GetStringValue(tenant_metadata_key_, &backing);
+  if (!tenant.has_value()) return "";
+  return std::string(*tenant);
+}
+
+uint32_t ServerFairQueuingPolicy::WeightOf(absl::string_view tenant) const {
+  auto it = weights_.find(tenant);
+  return it == weights_.end() ? 1 : it->second;
+}
+
+bool ServerFairQueuingPolicy::StartCall(absl::string_view tenant) {
+  if (!limits_concurrent_calls()) return true;
+  MutexLock lock(&mu_);
+  size_t& calls = calls_in_flight_[std::string(tenant)];
+  if (calls >= max_concurrent_calls_per_tenant_) return false;
+  ++calls;
+  return true;
+}
+
+void ServerFairQueuingPolicy::FinishCall(absl::string_view tenant) {
+  if (!limits_concurrent_calls()) return;
+  MutexLock lock(&mu_);
+  auto it = calls_in_flight_.find(tenant);
+  GPR_ASSERT(it != calls_in_flight_.end());
+  if (--it->second == 0) calls_in_flight_.erase(it);
+}
+
+//
+// ServerFairQueuingFilter
+//
+
+const grpc_channel_filter ServerFairQueuingFilter::kFilter =
+    MakePromiseBasedFilter<ServerFairQueuingFilter, FilterEndpoint::kServer>(
+        "server_fair_queuing");
+
+absl::StatusOr<ServerFairQueuingFilter> ServerFairQueuingFilter::Create(
+    const ChannelArgs& args, ChannelFilter::Args) {
+  auto policy = args.GetObjectRef<ServerFairQueuingPolicy>();
+  if (policy == nullptr) {
+    return absl::InvalidArgumentError(
+        "server_fair_queuing filter needs a ServerFairQueuingPolicy");
+  }
+  return ServerFairQueuingFilter(std::move(policy));
+}
+
+ArenaPromise<ServerMetadataHandle> ServerFairQueuingFilter::MakeCallPromise(
+    CallArgs call_args, NextPromiseFactory next_promise_factory) {
+  const Slice* path =
+      call_args.client_initial_metadata->get_pointer(HttpPathMetadata());
+  std::string tenant = policy_->TenantOf(
+      *call_args.client_initial_metadata,
+      path == nullptr ? absl::string_view() : path->as_string_view());
+  if (!policy_->StartCall(tenant)) {
+    return Immediate(ServerMetadataFromStatus(
+        absl::ResourceExhaustedError("Too many calls in flight for tenant")));
+  }
+  // The call counts until its promise is destroyed, however it ends.
+  return Map(next_promise_factory(std::move(call_args)),
+             [in_flight = CallInFlight(policy_, std::move(tenant))](
+                 ServerMetadataHandle md) { return md; });
+}
+
+void RegisterServerFairQueuingFilter(CoreConfiguration::Builder* builder) {
+  builder->channel_init()->RegisterStage(
+      GRPC_SERVER_CHANNEL, INT_MAX, [](ChannelStackBuilder* builder) {
+        auto* policy =
+            builder->channel_args().GetObject<ServerFairQueuingPolicy>();
+        if (policy == nullptr || !policy->limits_concurrent_calls()) {
+          return true;
+        }
+        // Right above the connected channel filter, which is always the last
+        // filter.
+        std::vector<const grpc_channel_filter*>* stack =
+            builder->mutable_stack();
+        if (stack->empty()) return true;
+        stack->insert(stack->end() - 1, &ServerFairQueuingFilter::kFilter);
+        return true;
+      });
+}
+
+}  // namespace grpc_core
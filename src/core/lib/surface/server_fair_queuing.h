@@ -0,0 +1,192 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SURFACE_SERVER_FAIR_QUEUING_H
+#define GRPC_SRC_CORE_LIB_SURFACE_SERVER_FAIR_QUEUING_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <map>
+#include <queue>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_fwd.h"
+#include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/lib/transport/transport.h"
+
+namespace grpc_core {
+
+// Queues items in one FIFO per flow, and pops them by deficit round robin
+// over the flows that have items: each round, a flow gets as many of its
+// items popped as its weight. Under backlog, each flow thus gets a share of
+// the pops proportional to its weight, however many items it queues. All
+// items cost the same. Not thread safe.
+template <typename T>
+class DeficitRoundRobinQueue {
+ public:
+  bool empty() const { return active_.empty(); }
+  size_t size() const { return size_; }
+
+  // Queues item behind the others of flow. weight is how many of the flow's
+  // items are popped per round; the last one pushed with applies.
+  void Push(absl::string_view flow, uint32_t weight, T item) {
+    auto it = flows_.find(flow);
+    if (it == flows_.end()) {
+      it = flows_.emplace(std::string(flow), Flow()).first;
+      active_.push_back(it);
+    }
+    it->second.weight = std::max<uint32_t>(weight, 1);
+    it->second.items.push(std::move(item));
+    ++size_;
+  }
+
+  // Pops the next item. Must not be called while empty.
+  T Pop() {
+    auto it = active_.front();
+    Flow& flow = it->second;
+    if (flow.deficit == 0) flow.deficit = flow.weight;
+    T item = std::move(flow.items.front());
+    flow.items.pop();
+    --flow.deficit;
+    --size_;
+    if (flow.items.empty()) {
+      // Idle flows keep no credit for later rounds.
+      active_.pop_front();
+      flows_.erase(it);
+    } else if (flow.deficit == 0) {
+      active_.pop_front();
+      active_.push_back(it);
+    }
+    return item;
+  }
+
+  // Calls f on the oldest item of each flow.
+  template <typename F>
+  void ForEachFront(F f) const {
+    for (const auto& it : active_) f(it->second.items.front());
+  }
+
+ private:
+  struct Flow {
+    uint32_t weight = 1;
+    // How many more items the flow gets popped in the current round.
+    uint32_t deficit = 0;
+    std::queue<T> items;
+  };
+  using FlowMap = std::map<std::string, Flow, std::less<>>;
+
+  FlowMap flows_;
+  // The flows with items, in round robin order, the current one first.
+  std::deque<typename FlowMap::iterator> active_;
+  size_t size_ = 0;
+};
+
+// How a server with GRPC_ARG_SERVER_FAIR_QUEUING shares itself between
+// tenants: which tenant a call belongs to, how much of the server each
+// tenant gets while calls queue up, and how many calls each tenant may have
+// in flight. The server's request matchers queue pending calls per tenant
+// in a DeficitRoundRobinQueue, and ServerFairQueuingFilter enforces the
+// concurrency limit.
+class ServerFairQueuingPolicy : public RefCounted<ServerFairQueuingPolicy> {
+ public:
+  // Returns null unless GRPC_ARG_SERVER_FAIR_QUEUING is set in args.
+  static RefCountedPtr<ServerFairQueuingPolicy> Create(const ChannelArgs& args);
+
+  // An empty tenant_metadata_key classifies calls by method. A
+  // max_concurrent_calls_per_tenant of 0 means no limit.
+  ServerFairQueuingPolicy(std::string tenant_metadata_key,
+                          absl::flat_hash_map<std::string, uint32_t> weights,
+                          size_t max_concurrent_calls_per_tenant);
+
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.server_fair_queuing_policy";
+  }
+  static int ChannelArgsCompare(const ServerFairQueuingPolicy* a,
+                                const ServerFairQueuingPolicy* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Returns the tenant of a call with the given initial metadata and path.
+  std::string TenantOf(const grpc_metadata_batch& metadata,
+                       absl::string_view path) const;
+
+  uint32_t WeightOf(absl::string_view tenant) const;
+
+  bool limits_concurrent_calls() const {
+    return max_concurrent_calls_per_tenant_ != 0;
+  }
+
+  // Counts a new call of tenant in flight, unless the tenant already has as
+  // many as it may, in which case it returns false.
+  bool StartCall(absl::string_view tenant);
+  // Stops counting a call that StartCall() counted.
+  void FinishCall(absl::string_view tenant);
+
+ private:
+  const std::string tenant_metadata_key_;
+  const absl::flat_hash_map<std::string, uint32_t> weights_;
+  const size_t max_concurrent_calls_per_tenant_;
+  Mutex mu_;
+  // Tenants without calls in flight are left out.
+  absl::flat_hash_map<std::string, size_t> calls_in_flight_
+      ABSL_GUARDED_BY(mu_);
+};
+
+// Fails calls with RESOURCE_EXHAUSTED when their tenant already has as many
+// calls in flight as the server's ServerFairQueuingPolicy allows. Sits right
+// above the transport, like ServerAdmissionControlFilter, so that rejected
+// calls never reach the server's request matching, let alone a handler.
+class ServerFairQueuingFilter final : public ChannelFilter {
+ public:
+  static const grpc_channel_filter kFilter;
+
+  static absl::StatusOr<ServerFairQueuingFilter> Create(const ChannelArgs& args,
+                                                        ChannelFilter::Args);
+
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(
+      CallArgs call_args, NextPromiseFactory next_promise_factory) override;
+
+ private:
+  explicit ServerFairQueuingFilter(
+      RefCountedPtr<ServerFairQueuingPolicy> policy)
+      : policy_(std::move(policy)) {}
+
+  RefCountedPtr<ServerFairQueuingPolicy> policy_;
+};
+
+void RegisterServerFairQueuingFilter(CoreConfiguration::Builder* builder);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SURFACE_SERVER_FAIR_QUEUING_H
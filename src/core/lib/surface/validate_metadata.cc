@@ -20,6 +20,8 @@
 
 #include "src/core/lib/surface/validate_metadata.h"
 
+#include <string.h>
+
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 
@@ -31,26 +33,73 @@
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/iomgr/error.h"
 
+namespace {
+
+// Scans [p, e) eight bytes at a time, only dropping to a per-byte search
+// once a block containing an illegal byte has been found. Returns e if every
+// byte is legal.
+const uint8_t* FindIllegalByte(const uint8_t* p, const uint8_t* e,
+                               const grpc_core::BitSet<256>& legal_bits) {
+  while (e - p >= 8) {
+    bool ok = legal_bits.is_set(p[0]) & legal_bits.is_set(p[1]) &
+              legal_bits.is_set(p[2]) & legal_bits.is_set(p[3]) &
+              legal_bits.is_set(p[4]) & legal_bits.is_set(p[5]) &
+              legal_bits.is_set(p[6]) & legal_bits.is_set(p[7]);
+    if (!ok) break;
+    p += 8;
+  }
+  for (; p != e; p++) {
+    if (!legal_bits.is_set(*p)) return p;
+  }
+  return e;
+}
+
+// Non-binary header values are exactly the printable range [32, 126], so
+// whole words can be range checked without any table lookups.
+const uint8_t* FindNonPrintableByte(const uint8_t* p, const uint8_t* e) {
+  constexpr uint64_t kOnes = 0x0101010101010101ull;
+  constexpr uint64_t kHighBits = 0x8080808080808080ull;
+  while (e - p >= 8) {
+    uint64_t w;
+    memcpy(&w, p, sizeof(w));
+    // High bit of a byte set iff that byte is < 32 or > 126 (any borrow or
+    // carry across bytes only originates from a byte that is itself out of
+    // range, so the any-byte answer is exact).
+    const uint64_t below = (w - kOnes * 32) & ~w;
+    const uint64_t above = (w + kOnes * 1) | w;
+    if ((below | above) & kHighBits) break;
+    p += 8;
+  }
+  for (; p != e; p++) {
+    if (*p < 32 || *p > 126) return p;
+  }
+  return e;
+}
+
+grpc_error_handle IllegalByteError(const grpc_slice& slice, const uint8_t* p,
+                                   const char* err_desc) {
+  size_t len;
+  grpc_core::UniquePtr<char> ptr(gpr_dump_return_len(
+      reinterpret_cast<const char*> GRPC_SLICE_START_PTR(slice),
+      GRPC_SLICE_LENGTH(slice), GPR_DUMP_HEX | GPR_DUMP_ASCII, &len));
+  grpc_error_handle error = grpc_error_set_str(
+      grpc_error_set_int(GRPC_ERROR_CREATE(err_desc),
+                         grpc_core::StatusIntProperty::kOffset,
+                         p - GRPC_SLICE_START_PTR(slice)),
+      grpc_core::StatusStrProperty::kRawBytes,
+      absl::string_view(ptr.get(), len));
+  return error;
+}
+
+}  // namespace
+
 static grpc_error_handle conforms_to(const grpc_slice& slice,
                                      const grpc_core::BitSet<256>& legal_bits,
                                      const char* err_desc) {
-  const uint8_t* p = GRPC_SLICE_START_PTR(slice);
   const uint8_t* e = GRPC_SLICE_END_PTR(slice);
-  for (; p != e; p++) {
-    if (!legal_bits.is_set(*p)) {
-      size_t len;
-      grpc_core::UniquePtr<char> ptr(gpr_dump_return_len(
-          reinterpret_cast<const char*> GRPC_SLICE_START_PTR(slice),
-          GRPC_SLICE_LENGTH(slice), GPR_DUMP_HEX | GPR_DUMP_ASCII, &len));
-      grpc_error_handle error = grpc_error_set_str(
-          grpc_error_set_int(GRPC_ERROR_CREATE(err_desc),
-                             grpc_core::StatusIntProperty::kOffset,
-                             p - GRPC_SLICE_START_PTR(slice)),
-          grpc_core::StatusStrProperty::kRawBytes,
-          absl::string_view(ptr.get(), len));
-      return error;
-    }
-  }
+  const uint8_t* p =
+      FindIllegalByte(GRPC_SLICE_START_PTR(slice), e, legal_bits);
+  if (p != e) return IllegalByteError(slice, p, err_desc);
   return absl::OkStatus();
 }
 
@@ -90,22 +139,12 @@ int grpc_header_key_is_legal(grpc_slice slice) {
   return error2int(grpc_validate_header_key_is_legal(slice));
 }
 
-namespace {
-class LegalHeaderNonBinValueBits : public grpc_core::BitSet<256> {
- public:
-  constexpr LegalHeaderNonBinValueBits() {
-    for (int i = 32; i <= 126; i++) {
-      set(i);
-    }
-  }
-};
-constexpr LegalHeaderNonBinValueBits g_legal_header_non_bin_value_bits;
-}  // namespace
-
 grpc_error_handle grpc_validate_header_nonbin_value_is_legal(
     const grpc_slice& slice) {
-  return conforms_to(slice, g_legal_header_non_bin_value_bits,
-                     "Illegal header value");
+  const uint8_t* e = GRPC_SLICE_END_PTR(slice);
+  const uint8_t* p = FindNonPrintableByte(GRPC_SLICE_START_PTR(slice), e);
+  if (p != e) return IllegalByteError(slice, p, "Illegal header value");
+  return absl::OkStatus();
 }
 
 int grpc_header_nonbin_value_is_legal(grpc_slice slice) {
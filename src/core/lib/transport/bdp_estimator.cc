@@ -39,9 +39,8 @@ BdpEstimator::BdpEstimator(absl::string_view name)
       bw_est_(0),
       name_(name) {}
 
-Timestamp BdpEstimator::CompletePing() {
-  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
-  gpr_timespec dt_ts = gpr_time_sub(now, ping_start_time_);
+Timestamp BdpEstimator::CompletePing(gpr_timespec ack_time) {
+  gpr_timespec dt_ts = gpr_time_sub(ack_time, ping_start_time_);
   double dt = static_cast<double>(dt_ts.tv_sec) +
               1e-9 * static_cast<double>(dt_ts.tv_nsec);
   double bw = dt > 0 ? (static_cast<double>(accumulator_) / dt) : 0;
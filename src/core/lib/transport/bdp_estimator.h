@@ -23,6 +23,7 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
 #include <string>
 
 #include "absl/strings/string_view.h"
@@ -47,6 +48,14 @@ class BdpEstimator {
 
   void AddIncomingBytes(int64_t num_bytes) { accumulator_ += num_bytes; }
 
+  // Starts from an estimate measured earlier, e.g. on another connection to
+  // the same peer, rather than from the default.  Estimates only grow, so
+  // this never lowers the current one.
+  void Seed(int64_t estimate, double bandwidth) {
+    estimate_ = std::max(estimate_, estimate);
+    bw_est_ = std::max(bw_est_, bandwidth);
+  }
+
   // Schedule a ping: call in response to receiving a true from
   // grpc_bdp_estimator_add_incoming_bytes once a ping has been scheduled by a
   // transport (but not necessarily started)
@@ -63,18 +72,25 @@ class BdpEstimator {
   // Start a ping: call after calling grpc_bdp_estimator_schedule_ping and
   // once
   // the ping is on the wire
-  void StartPing() {
+  void StartPing() { StartPing(gpr_now(GPR_CLOCK_MONOTONIC)); }
+  // As above, for a ping that went on the wire at \a start_time, which lets
+  // transports leave out the time the call waited behind other work.
+  void StartPing(gpr_timespec start_time) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_bdp_estimator_trace)) {
       gpr_log(GPR_INFO, "bdp[%s]:start acc=%" PRId64 " est=%" PRId64,
               std::string(name_).c_str(), accumulator_, estimate_);
     }
     GPR_ASSERT(ping_state_ == PingState::SCHEDULED);
     ping_state_ = PingState::STARTED;
-    ping_start_time_ = gpr_now(GPR_CLOCK_MONOTONIC);
+    ping_start_time_ = start_time;
   }
 
   // Completes a previously started ping, returns when to schedule the next one
-  Timestamp CompletePing();
+  Timestamp CompletePing() {
+    return CompletePing(gpr_now(GPR_CLOCK_MONOTONIC));
+  }
+  // As above, for a ping whose ack was read at \a ack_time.
+  Timestamp CompletePing(gpr_timespec ack_time);
 
   int64_t accumulator() { return accumulator_; }
 
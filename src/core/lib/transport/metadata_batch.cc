@@ -19,6 +19,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <utility>
 
 #include "absl/strings/escaping.h"
 #include "absl/strings/match.h"
@@ -35,7 +36,11 @@ void DebugStringBuilder::Add(absl::string_view key, absl::string_view value) {
 }
 
 void UnknownMap::Append(absl::string_view key, Slice value) {
-  unknown_.EmplaceBack(Slice::FromCopiedString(key), value.Ref());
+  unknown_.EmplaceBack(Slice::FromCopiedString(key), std::move(value));
+}
+
+void UnknownMap::Append(Slice key, Slice value) {
+  unknown_.EmplaceBack(std::move(key), std::move(value));
 }
 
 void UnknownMap::Remove(absl::string_view key) {
@@ -294,4 +299,20 @@ std::string WaitForReady::DisplayValue(ValueType x) {
                       x.explicitly_set ? " (explicit)" : "");
 }
 
+absl::string_view GrpcInternalCompressionLevelRequest::DisplayValue(
+    ValueType x) {
+  switch (x) {
+    case GRPC_COMPRESS_LEVEL_NONE:
+      return "none";
+    case GRPC_COMPRESS_LEVEL_LOW:
+      return "low";
+    case GRPC_COMPRESS_LEVEL_MED:
+      return "med";
+    case GRPC_COMPRESS_LEVEL_HIGH:
+      return "high";
+    default:
+      return "<discarded-invalid-value>";
+  }
+}
+
 }  // namespace grpc_core
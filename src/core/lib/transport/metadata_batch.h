@@ -183,6 +183,15 @@ struct GrpcInternalEncodingRequest : public CompressionAlgorithmBasedMetadata {
   static absl::string_view key() { return "grpc-internal-encoding-request"; }
 };
 
+// grpc-stream-encoding metadata trait: in client initial metadata, the
+// algorithm the client can decompress the server's messages with when one
+// compression context covers all of them; in server initial metadata, that
+// the server's compressed messages on this stream do so.
+struct GrpcStreamEncodingMetadata : public CompressionAlgorithmBasedMetadata {
+  static constexpr bool kRepeatable = false;
+  static absl::string_view key() { return "grpc-stream-encoding"; }
+};
+
 // grpc-accept-encoding metadata trait.
 struct GrpcAcceptEncodingMetadata {
   static constexpr bool kRepeatable = false;
@@ -303,6 +312,23 @@ struct GrpcPreviousRpcAttemptsMetadata
   static absl::string_view key() { return "grpc-previous-rpc-attempts"; }
 };
 
+// grpc-write-weight metadata trait: the share of its connection a stream gets
+// when the transport schedules writes fairly (see
+// GRPC_ARG_HTTP2_WRITE_SCHEDULER). Consumed by the local transport, and never
+// sent to the peer.
+struct GrpcWriteWeightMetadata : public SimpleIntBasedMetadata<uint32_t, 1> {
+  static constexpr bool kRepeatable = false;
+  static absl::string_view key() { return "grpc-write-weight"; }
+};
+
+// grpc-zstd-dictionary metadata trait: ID of the zstd dictionary the sender
+// compresses its messages with, and is able to decompress with.
+struct GrpcZstdDictionaryMetadata
+    : public SimpleIntBasedMetadata<uint32_t, 0> {
+  static constexpr bool kRepeatable = false;
+  static absl::string_view key() { return "grpc-zstd-dictionary"; }
+};
+
 // grpc-retry-pushback-ms metadata trait.
 struct GrpcRetryPushbackMsMetadata {
   static constexpr bool kRepeatable = false;
@@ -407,6 +433,18 @@ struct WaitForReady {
   static std::string DisplayValue(ValueType x);
 };
 
+// Annotation added by surface code to carry the compression level requested
+// for a call down to the compression filter, which maps it onto the codec's
+// own effort setting.
+struct GrpcInternalCompressionLevelRequest {
+  static absl::string_view DebugKey() {
+    return "GrpcInternalCompressionLevelRequest";
+  }
+  static constexpr bool kRepeatable = false;
+  using ValueType = grpc_compression_level;
+  static absl::string_view DisplayValue(ValueType x);
+};
+
 // Annotation added by a transport to note that server trailing metadata
 // is a Trailers-Only response.
 struct GrpcTrailersOnly {
@@ -486,6 +524,109 @@ struct NameLookup<void> {
   }
 };
 
+// Same result as NameLookup, but with one hash and at most one key compare
+// instead of a compare per trait: the HPACK parser looks up every literal
+// header it decodes. Trait keys are not constexpr, so the table is built on
+// first use for each (Op, Traits...) by searching for a seed that makes the
+// hash perfect over the encodable traits' keys. Should there be none, it
+// falls back to NameLookup.
+template <typename Op, typename... Traits>
+class NameLookupTable {
+ public:
+  using Result = decltype(NameLookup<void, Traits...>::Lookup(
+      absl::string_view(), static_cast<Op*>(nullptr)));
+
+  static Result Lookup(absl::string_view key, Op* op) {
+    static const NameLookupTable* const table = new NameLookupTable();
+    return table->Dispatch(key, op);
+  }
+
+ private:
+  // Power of two, and at least four times the number of keys so that a
+  // perfect seed is found quickly.
+  static constexpr size_t kTableSize = 128;
+  static constexpr uint32_t kMaxSeeds = 1024;
+
+  static constexpr size_t NumKeys() {
+    constexpr bool kEncodable[] = {false, IsEncodableTrait<Traits>::value...};
+    size_t n = 0;
+    for (bool encodable : kEncodable) n += encodable;
+    return n;
+  }
+
+  struct Entry {
+    absl::string_view key;
+    Result (*found)(Op* op) = nullptr;
+  };
+
+  NameLookupTable() {
+    static_assert(NumKeys() * 4 <= kTableSize,
+                  "grow kTableSize along with the number of keys");
+    for (uint32_t seed = 1; seed <= kMaxSeeds; ++seed) {
+      if (TryBuild(seed)) {
+        seed_ = seed;
+        return;
+      }
+    }
+  }
+
+  Result Dispatch(absl::string_view key, Op* op) const {
+    if (GPR_UNLIKELY(seed_ == 0)) {
+      return NameLookup<void, Traits...>::Lookup(key, op);
+    }
+    if (key.empty()) return op->NotFound(key);
+    const Entry& entry = table_[Hash(key, seed_)];
+    if (entry.found != nullptr && entry.key == key) return entry.found(op);
+    return op->NotFound(key);
+  }
+
+  // Mixes the length and the first, middle and last bytes of the key.
+  static size_t Hash(absl::string_view key, uint32_t seed) {
+    uint32_t h = seed * 0x9e3779b1u;
+    h = (h ^ static_cast<uint32_t>(key.size())) * 0x01000193u;
+    h = (h ^ static_cast<uint8_t>(key[0])) * 0x01000193u;
+    h = (h ^ static_cast<uint8_t>(key[key.size() / 2])) * 0x01000193u;
+    h = (h ^ static_cast<uint8_t>(key[key.size() - 1])) * 0x01000193u;
+    return (h ^ (h >> 16)) & (kTableSize - 1);
+  }
+
+  template <typename Trait>
+  static Result Found(Op* op) {
+    return op->Found(Trait());
+  }
+
+  bool TryBuild(uint32_t seed) {
+    for (Entry& entry : table_) entry = Entry();
+    bool perfect = true;
+    int unused[] = {
+        0, (perfect = perfect &&
+                      Insert<Traits>(seed, absl::bool_constant<IsEncodableTrait<
+                                               Traits>::value>()),
+            0)...};
+    (void)unused;
+    return perfect;
+  }
+
+  template <typename Trait>
+  bool Insert(uint32_t seed, std::true_type /*encodable*/) {
+    const absl::string_view key = Trait::key();
+    Entry& entry = table_[Hash(key, seed)];
+    if (entry.found != nullptr) return false;
+    entry.key = key;
+    entry.found = &Found<Trait>;
+    return true;
+  }
+
+  template <typename Trait>
+  bool Insert(uint32_t /*seed*/, std::false_type /*encodable*/) {
+    return true;
+  }
+
+  Entry table_[kTableSize];
+  // Zero if no perfect seed was found.
+  uint32_t seed_ = 0;
+};
+
 // Helper to take a slice to a memento to a value.
 // By splitting this part out we can scale code size as the number of
 // (memento, value) types, rather than as the number of traits.
@@ -841,7 +982,7 @@ class CopySink {
   }
 
   void Encode(const Slice& key, const Slice& value) {
-    dst_->unknown_.Append(key.as_string_view(), value.Ref());
+    dst_->unknown_.Append(key.Ref(), value.Ref());
   }
 
  private:
@@ -913,9 +1054,14 @@ class UnknownMap {
  public:
   explicit UnknownMap(Arena* arena) : unknown_(arena) {}
 
-  using BackingType = ChunkedVector<std::pair<Slice, Slice>, 10>;
+  // Most calls carry at most a couple of unknown entries per batch: those
+  // stay inline, and the rest go to arena chunks of eight.
+  using BackingType = ChunkedVector<std::pair<Slice, Slice>, 8, 2>;
 
   void Append(absl::string_view key, Slice value);
+  // As above, but shares key rather than copying it.  Used when the key
+  // is already held in a slice, e.g. by a parser or an HPACK table entry.
+  void Append(Slice key, Slice value);
   void Remove(absl::string_view key);
   absl::optional<absl::string_view> GetStringValue(absl::string_view key,
                                                    std::string* backing) const;
@@ -930,7 +1076,7 @@ class UnknownMap {
 
  private:
   // Backing store for added metadata.
-  ChunkedVector<std::pair<Slice, Slice>, 10> unknown_;
+  BackingType unknown_;
 };
 
 }  // namespace metadata_detail
@@ -1163,7 +1309,8 @@ class MetadataMap {
   // Remove some metadata by name
   void Remove(absl::string_view key) {
     metadata_detail::RemoveHelper<Derived> helper(static_cast<Derived*>(this));
-    metadata_detail::NameLookup<void, Traits...>::Lookup(key, &helper);
+    metadata_detail::NameLookupTable<metadata_detail::RemoveHelper<Derived>,
+                                     Traits...>::Lookup(key, &helper);
   }
 
   void Remove(const char* key) { Remove(absl::string_view(key)); }
@@ -1173,7 +1320,9 @@ class MetadataMap {
                                                    std::string* buffer) const {
     metadata_detail::GetStringValueHelper<Derived> helper(
         static_cast<const Derived*>(this), buffer);
-    return metadata_detail::NameLookup<void, Traits...>::Lookup(name, &helper);
+    return metadata_detail::NameLookupTable<
+        metadata_detail::GetStringValueHelper<Derived>,
+        Traits...>::Lookup(name, &helper);
   }
 
   // Extract a piece of known metadata.
@@ -1216,7 +1365,9 @@ class MetadataMap {
                                        MetadataParseErrorFn on_error) {
     metadata_detail::ParseHelper<Derived> helper(value.TakeOwned(), on_error,
                                                  transport_size);
-    return metadata_detail::NameLookup<void, Traits...>::Lookup(key, &helper);
+    return metadata_detail::NameLookupTable<
+        metadata_detail::ParseHelper<Derived>, Traits...>::Lookup(key,
+                                                                  &helper);
   }
 
   // Set a value from a parsed metadata object.
@@ -1229,7 +1380,8 @@ class MetadataMap {
               MetadataParseErrorFn on_error) {
     metadata_detail::AppendHelper<Derived> helper(static_cast<Derived*>(this),
                                                   value.TakeOwned(), on_error);
-    metadata_detail::NameLookup<void, Traits...>::Lookup(key, &helper);
+    metadata_detail::NameLookupTable<metadata_detail::AppendHelper<Derived>,
+                                     Traits...>::Lookup(key, &helper);
   }
 
   void Clear();
@@ -1318,6 +1470,8 @@ using grpc_metadata_batch_base = grpc_core::MetadataMap<
     grpc_core::GrpcEncodingMetadata, grpc_core::GrpcInternalEncodingRequest,
     grpc_core::GrpcAcceptEncodingMetadata, grpc_core::GrpcStatusMetadata,
     grpc_core::GrpcTimeoutMetadata, grpc_core::GrpcPreviousRpcAttemptsMetadata,
+    grpc_core::GrpcZstdDictionaryMetadata,
+    grpc_core::GrpcStreamEncodingMetadata, grpc_core::GrpcWriteWeightMetadata,
     grpc_core::GrpcRetryPushbackMsMetadata, grpc_core::UserAgentMetadata,
     grpc_core::GrpcMessageMetadata, grpc_core::HostMetadata,
     grpc_core::EndpointLoadMetricsBinMetadata,
@@ -1327,7 +1481,8 @@ using grpc_metadata_batch_base = grpc_core::MetadataMap<
     // Non-encodable things
     grpc_core::GrpcStreamNetworkState, grpc_core::PeerString,
     grpc_core::GrpcStatusContext, grpc_core::GrpcStatusFromWire,
-    grpc_core::WaitForReady, grpc_core::GrpcTrailersOnly>;
+    grpc_core::WaitForReady, grpc_core::GrpcTrailersOnly,
+    grpc_core::GrpcInternalCompressionLevelRequest>;
 
 struct grpc_metadata_batch : public grpc_metadata_batch_base {
   using grpc_metadata_batch_base::grpc_metadata_batch_base;
@@ -0,0 +1,113 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/transport/promise_endpoint.h"
+
+#include <stdint.h>
+
+#include <grpc/slice_buffer.h>
+#include <grpc/support/log.h>
+
+namespace grpc_core {
+
+using grpc_event_engine::experimental::EventEngine;
+
+PromiseEndpoint::PromiseEndpoint(
+    std::unique_ptr<EventEngine::Endpoint> endpoint,
+    SliceBuffer already_received)
+    : endpoint_(std::move(endpoint)) {
+  GPR_ASSERT(endpoint_ != nullptr);
+  MutexLock lock(&read_state_->mu);
+  read_state_->buffer.Swap(&already_received);
+}
+
+Poll<absl::Status> PromiseEndpoint::PollWrite(bool& started,
+                                              SliceBuffer& data) {
+  WriteState* state = write_state_.get();
+  if (!started) {
+    started = true;
+    if (data.Length() == 0) return absl::OkStatus();
+    {
+      MutexLock lock(&state->mu);
+      GPR_ASSERT(!state->writing);
+      state->writing = true;
+      state->waker = Activity::current()->MakeNonOwningWaker();
+    }
+    grpc_slice_buffer_swap(state->buffer.c_slice_buffer(),
+                           data.c_slice_buffer());
+    endpoint_->Write(
+        [state = write_state_](absl::Status status) {
+          ReleasableMutexLock lock(&state->mu);
+          state->writing = false;
+          state->result = std::move(status);
+          Waker waker = std::move(state->waker);
+          lock.Release();
+          waker.Wakeup();
+        },
+        &state->buffer, nullptr);
+  }
+  MutexLock lock(&state->mu);
+  if (state->result.has_value()) {
+    absl::Status status = std::move(*state->result);
+    state->result.reset();
+    state->buffer.Clear();
+    return status;
+  }
+  state->waker = Activity::current()->MakeNonOwningWaker();
+  return Pending{};
+}
+
+Poll<absl::StatusOr<SliceBuffer>> PromiseEndpoint::PollRead(
+    size_t num_bytes) {
+  ReadState* state = read_state_.get();
+  ReleasableMutexLock lock(&state->mu);
+  if (state->buffer.Length() >= num_bytes) {
+    SliceBuffer out;
+    state->buffer.MoveFirstNBytesIntoSliceBuffer(num_bytes, out);
+    return std::move(out);
+  }
+  if (!state->error.ok()) return state->error;
+  state->waker = Activity::current()->MakeNonOwningWaker();
+  if (state->reading) return Pending{};
+  state->reading = true;
+  // Ask for everything we're still missing in one go, so that large payloads
+  // are not read in many small pieces.
+  const EventEngine::Endpoint::ReadArgs args = {
+      static_cast<int64_t>(num_bytes - state->buffer.Length())};
+  lock.Release();
+  endpoint_->Read(
+      [state = read_state_](absl::Status status) {
+        ReleasableMutexLock lock(&state->mu);
+        state->reading = false;
+        if (!status.ok()) {
+          state->error = std::move(status);
+        } else if (state->pending.Length() == 0) {
+          // A successful read that produced nothing means the peer closed the
+          // connection.
+          state->error = absl::UnavailableError("Endpoint closed");
+        }
+        // The endpoint may hand us valid bytes even when the read failed.
+        grpc_slice_buffer_move_into(state->pending.c_slice_buffer(),
+                                    state->buffer.c_slice_buffer());
+        Waker waker = std::move(state->waker);
+        lock.Release();
+        waker.Wakeup();
+      },
+      &state->pending, &args);
+  return Pending{};
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,119 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_TRANSPORT_PROMISE_ENDPOINT_H
+#define GRPC_SRC_CORE_LIB_TRANSPORT_PROMISE_ENDPOINT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <memory>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/slice/slice_buffer.h"
+
+namespace grpc_core {
+
+// Wraps an EventEngine endpoint with a promise based interface.
+// At most one read and one write may be outstanding at any time.
+class PromiseEndpoint {
+ public:
+  // already_received holds bytes that were read from the endpoint before it
+  // was wrapped (e.g. during a handshake); they are returned by the first
+  // reads.
+  PromiseEndpoint(
+      std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+          endpoint,
+      SliceBuffer already_received);
+  ~PromiseEndpoint() = default;
+
+  PromiseEndpoint(const PromiseEndpoint&) = delete;
+  PromiseEndpoint& operator=(const PromiseEndpoint&) = delete;
+
+  // Returns a promise that writes data to the endpoint when first polled, and
+  // resolves to the status of the write once the endpoint is done with it.
+  // Writing an empty buffer completes immediately.
+  auto Write(SliceBuffer data) {
+    return [this, data = std::move(data), started = false]() mutable {
+      return PollWrite(started, data);
+    };
+  }
+
+  // Returns a promise that resolves to exactly num_bytes bytes read from the
+  // endpoint, or to the error that stopped the endpoint from reading them.
+  // Reading zero bytes completes immediately.
+  auto Read(size_t num_bytes) {
+    return [this, num_bytes]() { return PollRead(num_bytes); };
+  }
+
+  const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+  GetPeerAddress() const {
+    return endpoint_->GetPeerAddress();
+  }
+  const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+  GetLocalAddress() const {
+    return endpoint_->GetLocalAddress();
+  }
+
+ private:
+  // State shared with the callbacks of the outstanding endpoint operations,
+  // which may run after the PromiseEndpoint has been destroyed.
+  struct ReadState : public RefCounted<ReadState> {
+    Mutex mu;
+    // Bytes received from the endpoint and not yet returned by a read.
+    SliceBuffer buffer ABSL_GUARDED_BY(mu);
+    // Filled in by the endpoint while a read is outstanding.
+    grpc_event_engine::experimental::SliceBuffer pending;
+    bool reading ABSL_GUARDED_BY(mu) = false;
+    // Once set, every read that cannot be satisfied from buffer fails.
+    absl::Status error ABSL_GUARDED_BY(mu);
+    Waker waker ABSL_GUARDED_BY(mu);
+  };
+
+  struct WriteState : public RefCounted<WriteState> {
+    Mutex mu;
+    // Owned by the endpoint while a write is outstanding.
+    grpc_event_engine::experimental::SliceBuffer buffer;
+    bool writing ABSL_GUARDED_BY(mu) = false;
+    // Set when the outstanding write completes, until it is reported.
+    absl::optional<absl::Status> result ABSL_GUARDED_BY(mu);
+    Waker waker ABSL_GUARDED_BY(mu);
+  };
+
+  Poll<absl::Status> PollWrite(bool& started, SliceBuffer& data);
+  Poll<absl::StatusOr<SliceBuffer>> PollRead(size_t num_bytes);
+
+  const std::unique_ptr<grpc_event_engine::experimental::EventEngine::Endpoint>
+      endpoint_;
+  const RefCountedPtr<ReadState> read_state_ = MakeRefCounted<ReadState>();
+  const RefCountedPtr<WriteState> write_state_ = MakeRefCounted<WriteState>();
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_TRANSPORT_PROMISE_ENDPOINT_H
@@ -0,0 +1,59 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_TRANSPORT_STREAM_LIMIT_H
+#define GRPC_SRC_CORE_LIB_TRANSPORT_STREAM_LIMIT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <atomic>
+#include <limits>
+
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+
+namespace grpc_core {
+
+// How many concurrent streams the peer of a connection allows. Passed to a
+// transport as a channel arg by whoever created the connection, and updated
+// by the transport whenever the peer changes its limit.
+class TransportStreamLimit : public RefCounted<TransportStreamLimit> {
+ public:
+  static absl::string_view ChannelArgName() {
+    return "grpc.internal.transport_stream_limit";
+  }
+  static int ChannelArgsCompare(const TransportStreamLimit* a,
+                                const TransportStreamLimit* b) {
+    return QsortCompare(a, b);
+  }
+
+  void SetPeerLimit(uint32_t limit) {
+    peer_limit_.store(limit, std::memory_order_relaxed);
+  }
+  uint32_t peer_limit() const {
+    return peer_limit_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // Unlimited until the peer says otherwise, as in http2.
+  std::atomic<uint32_t> peer_limit_{std::numeric_limits<uint32_t>::max()};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_TRANSPORT_STREAM_LIMIT_H
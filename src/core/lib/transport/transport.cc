@@ -97,6 +97,7 @@ void grpc_transport_move_stats(grpc_transport_stream_stats* from,
   grpc_transport_move_one_way_stats(&from->incoming, &to->incoming);
   grpc_transport_move_one_way_stats(&from->outgoing, &to->outgoing);
   to->latency = std::exchange(from->latency, gpr_inf_future(GPR_TIMESPAN));
+  to->timing = std::exchange(from->timing, grpc_transport_stream_timing());
 }
 
 size_t grpc_transport_stream_size(grpc_transport* transport) {
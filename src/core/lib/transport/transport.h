@@ -25,6 +25,8 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <string>
 #include <utility>
@@ -112,6 +114,28 @@ class Message {
 
 using MessageHandle = Arena::PoolPtr<Message>;
 
+// How many more bytes a call could send right now without waiting for the
+// peer's flow control: the send window, less what the transport already has
+// queued for the call. Published by transports that do flow control through
+// GRPC_CONTEXT_WRITE_WINDOW_HINT, and read by applications pacing their
+// writes. The value may be stale by the time it is read.
+class WriteWindowHint {
+ public:
+  static constexpr int64_t kUnknown = -1;
+
+  void Set(int64_t window, int64_t buffered) {
+    writable_bytes_.store(std::max<int64_t>(0, window - buffered),
+                          std::memory_order_relaxed);
+  }
+  // Returns kUnknown until the transport has published a value.
+  int64_t writable_bytes() const {
+    return writable_bytes_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<int64_t> writable_bytes_{kUnknown};
+};
+
 // Ok/not-ok check for trailing metadata, so that it can be used as result types
 // for TrySeq.
 inline bool IsStatusOk(const ServerMetadataHandle& m) {
@@ -244,10 +268,31 @@ struct grpc_transport_one_way_stats {
   uint64_t header_bytes = 0;
 };
 
+// Points in the life of a stream that help tell where its latency went, as
+// GPR_CLOCK_MONOTONIC timestamps. Points the stream never reached are left at
+// gpr_inf_past.
+struct grpc_transport_stream_timing {
+  gpr_timespec initial_metadata_encoded = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  gpr_timespec initial_metadata_decoded = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  gpr_timespec first_write_flushed = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  gpr_timespec last_write_flushed = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  gpr_timespec first_flow_control_stall = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  // When the latest write of the stream that the peer ACKed before the stream
+  // closed left the host and was ACKed, as timestamped by the kernel. Only
+  // with GRPC_ARG_TCP_WRITE_TIMESTAMPS.
+  gpr_timespec last_write_sent = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  gpr_timespec last_write_acked = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  // How many times, and for how long in total, the stream had data to send but
+  // no flow control window to send it in.
+  uint32_t flow_control_stalls = 0;
+  gpr_timespec flow_control_stalled_time = gpr_time_0(GPR_TIMESPAN);
+};
+
 struct grpc_transport_stream_stats {
   grpc_transport_one_way_stats incoming;
   grpc_transport_one_way_stats outgoing;
   gpr_timespec latency = gpr_inf_future(GPR_TIMESPAN);
+  grpc_transport_stream_timing timing;
 };
 
 void grpc_transport_move_one_way_stats(grpc_transport_one_way_stats* from,
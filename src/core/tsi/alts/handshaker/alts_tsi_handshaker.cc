@@ -261,7 +261,9 @@ static const tsi_handshaker_result_vtable result_vtable = {
     handshaker_result_create_zero_copy_grpc_protector,
     handshaker_result_create_frame_protector,
     handshaker_result_get_unused_bytes,
-    handshaker_result_destroy};
+    handshaker_result_destroy,
+    nullptr,  // enable_kernel_tls
+};
 
 tsi_result alts_tsi_handshaker_result_create(grpc_gcp_HandshakerResp* resp,
                                              bool is_client,
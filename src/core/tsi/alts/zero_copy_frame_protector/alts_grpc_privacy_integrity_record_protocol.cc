@@ -20,6 +20,10 @@
 
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_privacy_integrity_record_protocol.h"
 
+#include <stdint.h>
+
+#include <algorithm>
+
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
@@ -82,25 +86,34 @@ static tsi_result alts_grpc_privacy_integrity_unprotect(
         "Invalid nullptr arguments to alts_grpc_record_protocol unprotect.");
     return TSI_INVALID_ARGUMENT;
   }
-  // Allocates memory for output frame. In privacy-integrity unprotect, the
-  // unprotected data are stored in a newly allocated buffer.
   if (protected_slices->length < rp->header_length + rp->tag_length) {
     gpr_log(GPR_ERROR, "Protected slices do not have sufficient data.");
     return TSI_INVALID_ARGUMENT;
   }
   size_t unprotected_frame_size =
       protected_slices->length - rp->header_length - rp->tag_length;
-  grpc_slice unprotected_slice = GRPC_SLICE_MALLOC(unprotected_frame_size);
-  iovec_t unprotected_iovec = {GRPC_SLICE_START_PTR(unprotected_slice),
-                               GRPC_SLICE_LENGTH(unprotected_slice)};
   // Strips frame header from protected slices.
   grpc_slice_buffer_reset_and_unref(&rp->header_sb);
   grpc_slice_buffer_move_first(protected_slices, rp->header_length,
                                &rp->header_sb);
   iovec_t header_iovec = alts_grpc_record_protocol_get_header_iovec(rp);
+  alts_grpc_record_protocol_convert_slice_buffer_to_iovec(rp, protected_slices);
+  // When the rest of the frame is in a single writable slice, it is decrypted
+  // in place and the unprotected data alias the protected frame. Otherwise,
+  // the unprotected data are stored in a newly allocated buffer.
+  bool in_place = protected_slices->count == 1 &&
+                  alts_grpc_record_protocol_slice_is_writable(
+                      protected_slices->slices[0]);
+  grpc_slice unprotected_slice = grpc_empty_slice();
+  iovec_t unprotected_iovec = {nullptr, unprotected_frame_size};
+  if (in_place) {
+    unprotected_iovec.iov_base = rp->iovec_buf[0].iov_base;
+  } else {
+    unprotected_slice = GRPC_SLICE_MALLOC(unprotected_frame_size);
+    unprotected_iovec.iov_base = GRPC_SLICE_START_PTR(unprotected_slice);
+  }
   // Calls alts_iovec_record_protocol unprotect.
   char* error_details = nullptr;
-  alts_grpc_record_protocol_convert_slice_buffer_to_iovec(rp, protected_slices);
   grpc_status_code status =
       alts_iovec_record_protocol_privacy_integrity_unprotect(
           rp->iovec_rp, header_iovec, rp->iovec_buf, protected_slices->count,
@@ -112,15 +125,170 @@ static tsi_result alts_grpc_privacy_integrity_unprotect(
     return TSI_INTERNAL_ERROR;
   }
   grpc_slice_buffer_reset_and_unref(&rp->header_sb);
+  if (in_place) {
+    // Drops the frame tag and hands over what is left of the frame.
+    grpc_slice_buffer_trim_end(protected_slices, rp->tag_length, nullptr);
+    grpc_slice_buffer_move_into(protected_slices, unprotected_slices);
+  } else {
+    grpc_slice_buffer_reset_and_unref(protected_slices);
+    grpc_slice_buffer_add(unprotected_slices, unprotected_slice);
+  }
+  return TSI_OK;
+}
+
+static tsi_result alts_grpc_privacy_integrity_protect_batch(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices) {
+  // Input sanity check.
+  if (rp == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    gpr_log(GPR_ERROR,
+            "Invalid nullptr arguments to alts_grpc_record_protocol protect.");
+    return TSI_INVALID_ARGUMENT;
+  }
+  // Allocates memory for all the output frames at once. As in a single
+  // protect, empty data still makes one frame.
+  size_t data_length = unprotected_slices->length;
+  size_t frame_overhead = rp->header_length + rp->tag_length;
+  size_t num_frames =
+      std::max<size_t>(1, (data_length + max_unprotected_data_size - 1) /
+                              max_unprotected_data_size);
+  grpc_slice protected_slice =
+      GRPC_SLICE_MALLOC(data_length + num_frames * frame_overhead);
+  uint8_t* protected_frame = GRPC_SLICE_START_PTR(protected_slice);
+  // Seals each frame straight from the unprotected slices.
+  alts_grpc_slice_buffer_cursor cursor = {0, 0};
+  size_t remaining = data_length;
+  for (size_t i = 0; i < num_frames; i++) {
+    size_t frame_data_length = std::min(remaining, max_unprotected_data_size);
+    size_t iovec_count =
+        alts_grpc_record_protocol_convert_slice_buffer_range_to_iovec(
+            rp, unprotected_slices, &cursor, frame_data_length);
+    iovec_t protected_iovec = {protected_frame,
+                               frame_data_length + frame_overhead};
+    char* error_details = nullptr;
+    grpc_status_code status =
+        alts_iovec_record_protocol_privacy_integrity_protect(
+            rp->iovec_rp, rp->iovec_buf, iovec_count, protected_iovec,
+            &error_details);
+    if (status != GRPC_STATUS_OK) {
+      gpr_log(GPR_ERROR, "Failed to protect, %s", error_details);
+      gpr_free(error_details);
+      grpc_core::CSliceUnref(protected_slice);
+      return TSI_INTERNAL_ERROR;
+    }
+    protected_frame += protected_iovec.iov_len;
+    remaining -= frame_data_length;
+  }
+  grpc_slice_buffer_add(protected_slices, protected_slice);
+  grpc_slice_buffer_reset_and_unref(unprotected_slices);
+  return TSI_OK;
+}
+
+static tsi_result alts_grpc_privacy_integrity_unprotect_batch(
+    alts_grpc_record_protocol* rp, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices) {
+  // Input sanity check.
+  if (rp == nullptr || protected_slices == nullptr ||
+      unprotected_slices == nullptr) {
+    gpr_log(
+        GPR_ERROR,
+        "Invalid nullptr arguments to alts_grpc_record_protocol unprotect.");
+    return TSI_INVALID_ARGUMENT;
+  }
+  size_t frame_overhead = rp->header_length + rp->tag_length;
+  if (protected_slices->length < frame_overhead) {
+    gpr_log(GPR_ERROR, "Protected slices do not have sufficient data.");
+    return TSI_INVALID_ARGUMENT;
+  }
+  // Frames that are each in a single writable slice are decrypted in place.
+  // The others share a buffer allocated for the unprotected data on first
+  // use. It is sized as for a single frame, the most data the frames can
+  // hold.
+  grpc_slice unprotected_slice = grpc_empty_slice();
+  size_t unprotected_length = 0;
+  alts_grpc_slice_buffer_cursor cursor = {0, 0};
+  size_t remaining = protected_slices->length;
+  while (remaining > 0) {
+    // Copies the frame header, which may be in multiple slices, to
+    // rp->header_buf, and gets the frame size from its length field.
+    uint32_t frame_size = 0;
+    if (remaining >= frame_overhead) {
+      alts_grpc_record_protocol_copy_slice_buffer_range(
+          protected_slices, &cursor, rp->header_length, rp->header_buf);
+      frame_size = (static_cast<uint32_t>(rp->header_buf[3]) << 24) |
+                   (static_cast<uint32_t>(rp->header_buf[2]) << 16) |
+                   (static_cast<uint32_t>(rp->header_buf[1]) << 8) |
+                   static_cast<uint32_t>(rp->header_buf[0]);
+    }
+    if (remaining < frame_overhead ||
+        frame_size < frame_overhead - kZeroCopyFrameLengthFieldSize ||
+        frame_size > remaining - kZeroCopyFrameLengthFieldSize) {
+      gpr_log(GPR_ERROR, "Protected slices do not hold full frames.");
+      grpc_core::CSliceUnref(unprotected_slice);
+      return TSI_INVALID_ARGUMENT;
+    }
+    size_t protected_data_length =
+        frame_size + kZeroCopyFrameLengthFieldSize - rp->header_length;
+    iovec_t header_iovec = {rp->header_buf, rp->header_length};
+    alts_grpc_slice_buffer_cursor data_cursor = cursor;
+    size_t iovec_count =
+        alts_grpc_record_protocol_convert_slice_buffer_range_to_iovec(
+            rp, protected_slices, &cursor, protected_data_length);
+    bool in_place = iovec_count == 1 &&
+                    alts_grpc_record_protocol_slice_is_writable(
+                        protected_slices->slices[data_cursor.slice_index]);
+    iovec_t unprotected_iovec = {nullptr,
+                                 protected_data_length - rp->tag_length};
+    if (in_place) {
+      unprotected_iovec.iov_base = rp->iovec_buf[0].iov_base;
+    } else {
+      if (GRPC_SLICE_IS_EMPTY(unprotected_slice)) {
+        unprotected_slice =
+            GRPC_SLICE_MALLOC(protected_slices->length - frame_overhead);
+      }
+      unprotected_iovec.iov_base =
+          GRPC_SLICE_START_PTR(unprotected_slice) + unprotected_length;
+    }
+    char* error_details = nullptr;
+    grpc_status_code status =
+        alts_iovec_record_protocol_privacy_integrity_unprotect(
+            rp->iovec_rp, header_iovec, rp->iovec_buf, iovec_count,
+            unprotected_iovec, &error_details);
+    if (status != GRPC_STATUS_OK) {
+      gpr_log(GPR_ERROR, "Failed to unprotect, %s", error_details);
+      gpr_free(error_details);
+      grpc_core::CSliceUnref(unprotected_slice);
+      return TSI_INTERNAL_ERROR;
+    }
+    if (unprotected_iovec.iov_len > 0) {
+      if (in_place) {
+        grpc_slice_buffer_add(
+            unprotected_slices,
+            grpc_slice_sub(protected_slices->slices[data_cursor.slice_index],
+                           data_cursor.offset,
+                           data_cursor.offset + unprotected_iovec.iov_len));
+      } else {
+        grpc_slice_buffer_add(
+            unprotected_slices,
+            grpc_slice_sub(unprotected_slice, unprotected_length,
+                           unprotected_length + unprotected_iovec.iov_len));
+        unprotected_length += unprotected_iovec.iov_len;
+      }
+    }
+    remaining -= rp->header_length + protected_data_length;
+  }
   grpc_slice_buffer_reset_and_unref(protected_slices);
-  grpc_slice_buffer_add(unprotected_slices, unprotected_slice);
+  grpc_core::CSliceUnref(unprotected_slice);
   return TSI_OK;
 }
 
 static const alts_grpc_record_protocol_vtable
     alts_grpc_privacy_integrity_record_protocol_vtable = {
         alts_grpc_privacy_integrity_protect,
-        alts_grpc_privacy_integrity_unprotect, nullptr};
+        alts_grpc_privacy_integrity_unprotect, nullptr,
+        alts_grpc_privacy_integrity_protect_batch,
+        alts_grpc_privacy_integrity_unprotect_batch};
 
 tsi_result alts_grpc_privacy_integrity_record_protocol_create(
     gsec_aead_crypter* crypter, size_t overflow_size, bool is_client,
@@ -68,6 +68,55 @@ tsi_result alts_grpc_record_protocol_unprotect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices);
 
+///
+/// This method protects all of the unprotected data as a batch of consecutive
+/// frames, each carrying at most max_unprotected_data_size bytes, and appends
+/// them to protected_slices. The frames are sealed one after the other into a
+/// single newly allocated slice, without moving the unprotected slices into a
+/// staging buffer for each frame. The input unprotected data slice buffer will
+/// be cleared, although the actual unprotected data bytes are not modified.
+///
+///- self: an alts_grpc_record_protocol instance.
+///- unprotected_slices: the unprotected data to be protected.
+///- max_unprotected_data_size: the most unprotected data a frame may carry.
+///- protected_slices: slice buffer where the protected frames are appended.
+///
+/// This method returns TSI_OK in case of success, TSI_UNIMPLEMENTED if the
+/// record protocol does not support batches, in which case nothing is
+/// consumed, or a specific error code in case of failure.
+///
+tsi_result alts_grpc_record_protocol_protect_batch(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices);
+
+///
+/// This method unprotects a batch of consecutive full frames of protected
+/// data, and appends their unprotected data to unprotected_slices, in a single
+/// newly allocated slice. It is the caller's responsibility to make sure that
+/// protected_slices holds full frames only. The input protected frames slice
+/// buffer will be cleared, although the actual protected data bytes are not
+/// modified.
+///
+///- self: an alts_grpc_record_protocol instance.
+///- protected_slices: full frames of protected data in grpc slices.
+///- unprotected_slices: slice buffer where unprotected data is appended.
+///
+/// This method returns TSI_OK in case of success, TSI_UNIMPLEMENTED if the
+/// record protocol does not support batches, in which case nothing is
+/// consumed, or a specific error code in case of failure.
+///
+tsi_result alts_grpc_record_protocol_unprotect_batch(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices);
+
+///
+/// This method returns whether the record protocol supports
+/// alts_grpc_record_protocol_protect_batch() and
+/// alts_grpc_record_protocol_unprotect_batch().
+///
+bool alts_grpc_record_protocol_supports_batch(
+    const alts_grpc_record_protocol* self);
+
 ///
 /// This method returns maximum allowed unprotected data size, given maximum
 /// protected frame size.
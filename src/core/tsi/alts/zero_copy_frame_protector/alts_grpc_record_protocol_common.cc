@@ -29,6 +29,7 @@
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/slice/slice_refcount.h"
 
 const size_t kInitialIovecBufferSize = 8;
 
@@ -58,6 +59,59 @@ void alts_grpc_record_protocol_convert_slice_buffer_to_iovec(
   }
 }
 
+size_t alts_grpc_record_protocol_convert_slice_buffer_range_to_iovec(
+    alts_grpc_record_protocol* rp, const grpc_slice_buffer* sb,
+    alts_grpc_slice_buffer_cursor* cursor, size_t length) {
+  GPR_ASSERT(rp != nullptr && sb != nullptr && cursor != nullptr);
+  // A range spans at most all the slices of sb.
+  ensure_iovec_buf_size(rp, sb);
+  size_t count = 0;
+  while (length > 0) {
+    GPR_ASSERT(cursor->slice_index < sb->count);
+    const grpc_slice& slice = sb->slices[cursor->slice_index];
+    size_t available = GRPC_SLICE_LENGTH(slice) - cursor->offset;
+    size_t taken = std::min(available, length);
+    rp->iovec_buf[count].iov_base =
+        GRPC_SLICE_START_PTR(sb->slices[cursor->slice_index]) + cursor->offset;
+    rp->iovec_buf[count].iov_len = taken;
+    count++;
+    length -= taken;
+    if (taken == available) {
+      cursor->slice_index++;
+      cursor->offset = 0;
+    } else {
+      cursor->offset += taken;
+    }
+  }
+  return count;
+}
+
+void alts_grpc_record_protocol_copy_slice_buffer_range(
+    const grpc_slice_buffer* src, alts_grpc_slice_buffer_cursor* cursor,
+    size_t length, unsigned char* dst) {
+  GPR_ASSERT(src != nullptr && cursor != nullptr && dst != nullptr);
+  while (length > 0) {
+    GPR_ASSERT(cursor->slice_index < src->count);
+    const grpc_slice& slice = src->slices[cursor->slice_index];
+    size_t available = GRPC_SLICE_LENGTH(slice) - cursor->offset;
+    size_t taken = std::min(available, length);
+    memcpy(dst, GRPC_SLICE_START_PTR(slice) + cursor->offset, taken);
+    dst += taken;
+    length -= taken;
+    if (taken == available) {
+      cursor->slice_index++;
+      cursor->offset = 0;
+    } else {
+      cursor->offset += taken;
+    }
+  }
+}
+
+bool alts_grpc_record_protocol_slice_is_writable(const grpc_slice& slice) {
+  return slice.refcount != nullptr &&
+         slice.refcount != grpc_slice_refcount::NoopRefcount();
+}
+
 void alts_grpc_record_protocol_copy_slice_buffer(const grpc_slice_buffer* src,
                                                  unsigned char* dst) {
   GPR_ASSERT(src != nullptr && dst != nullptr);
@@ -149,6 +203,44 @@ tsi_result alts_grpc_record_protocol_unprotect(
   return self->vtable->unprotect(self, protected_slices, unprotected_slices);
 }
 
+tsi_result alts_grpc_record_protocol_protect_batch(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
+    size_t max_unprotected_data_size, grpc_slice_buffer* protected_slices) {
+  if (grpc_core::ExecCtx::Get() == nullptr || self == nullptr ||
+      self->vtable == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr || max_unprotected_data_size == 0) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->protect_batch == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  return self->vtable->protect_batch(self, unprotected_slices,
+                                     max_unprotected_data_size,
+                                     protected_slices);
+}
+
+tsi_result alts_grpc_record_protocol_unprotect_batch(
+    alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices) {
+  if (grpc_core::ExecCtx::Get() == nullptr || self == nullptr ||
+      self->vtable == nullptr || protected_slices == nullptr ||
+      unprotected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->unprotect_batch == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  return self->vtable->unprotect_batch(self, protected_slices,
+                                       unprotected_slices);
+}
+
+bool alts_grpc_record_protocol_supports_batch(
+    const alts_grpc_record_protocol* self) {
+  return self != nullptr && self->vtable != nullptr &&
+         self->vtable->protect_batch != nullptr &&
+         self->vtable->unprotect_batch != nullptr;
+}
+
 void alts_grpc_record_protocol_destroy(alts_grpc_record_protocol* self) {
   if (self == nullptr) {
     return;
@@ -39,6 +39,14 @@ struct alts_grpc_record_protocol_vtable {
                           grpc_slice_buffer* protected_slices,
                           grpc_slice_buffer* unprotected_slices);
   void (*destruct)(alts_grpc_record_protocol* self);
+  // Optional: protect and unprotect several frames at once.
+  tsi_result (*protect_batch)(alts_grpc_record_protocol* self,
+                              grpc_slice_buffer* unprotected_slices,
+                              size_t max_unprotected_data_size,
+                              grpc_slice_buffer* protected_slices);
+  tsi_result (*unprotect_batch)(alts_grpc_record_protocol* self,
+                                grpc_slice_buffer* protected_slices,
+                                grpc_slice_buffer* unprotected_slices);
 };
 // Main struct for alts_grpc_record_protocol implementation, shared by both
 // integrity-only record protocol and privacy-integrity record protocol.
@@ -63,6 +71,43 @@ struct alts_grpc_record_protocol {
 void alts_grpc_record_protocol_convert_slice_buffer_to_iovec(
     alts_grpc_record_protocol* rp, const grpc_slice_buffer* sb);
 
+///
+/// A position in a slice buffer: the index of a slice and an offset in it.
+/// It lets the frames of a batch be walked through without moving slices.
+///
+struct alts_grpc_slice_buffer_cursor {
+  size_t slice_index;
+  size_t offset;
+};
+
+///
+/// Converts the |length| bytes of input sb that start at |cursor| into
+/// iovec_t's, puts the result into rp->iovec_buf, and advances |cursor| past
+/// them. Returns the number of iovec_t's. As with
+/// alts_grpc_record_protocol_convert_slice_buffer_to_iovec(), the actual data
+/// are not copied. The caller needs to ensure sb holds |length| bytes past
+/// |cursor|.
+///
+size_t alts_grpc_record_protocol_convert_slice_buffer_range_to_iovec(
+    alts_grpc_record_protocol* rp, const grpc_slice_buffer* sb,
+    alts_grpc_slice_buffer_cursor* cursor, size_t length);
+
+///
+/// Copies the |length| bytes of src that start at |cursor| to dst, and
+/// advances |cursor| past them. The caller needs to ensure src holds |length|
+/// bytes past |cursor|.
+///
+void alts_grpc_record_protocol_copy_slice_buffer_range(
+    const grpc_slice_buffer* src, alts_grpc_slice_buffer_cursor* cursor,
+    size_t length, unsigned char* dst);
+
+///
+/// Returns true if the bytes of slice may be overwritten, so that a frame can
+/// be unprotected in place. Inlined slices and slices over static memory are
+/// not.
+///
+bool alts_grpc_record_protocol_slice_is_writable(const grpc_slice& slice);
+
 ///
 /// Copies bytes from slice buffer to destination buffer. Caller is responsible
 /// for allocating enough memory of destination buffer. This method is used for
@@ -60,28 +60,36 @@ typedef struct alts_zero_copy_grpc_protector {
 } alts_zero_copy_grpc_protector;
 
 ///
-/// Given a slice buffer, parses the first 4 bytes little-endian unsigned frame
-/// size and returns the total frame size including the frame field. Caller
-/// needs to make sure the input slice buffer has at least 4 bytes. Returns true
-/// on success and false on failure.
+/// Given a slice buffer, parses the 4 bytes little-endian unsigned frame size
+/// starting at offset and returns the total frame size including the frame
+/// field. Caller needs to make sure the input slice buffer has at least 4 bytes
+/// after offset. Returns true on success and false on failure.
 ///
-static bool read_frame_size(const grpc_slice_buffer* sb,
+static bool read_frame_size(const grpc_slice_buffer* sb, size_t offset,
                             uint32_t* total_frame_size) {
-  if (sb == nullptr || sb->length < kZeroCopyFrameLengthFieldSize) {
+  if (sb == nullptr || sb->length < offset ||
+      sb->length - offset < kZeroCopyFrameLengthFieldSize) {
     return false;
   }
   uint8_t frame_size_buffer[kZeroCopyFrameLengthFieldSize];
   uint8_t* buf = frame_size_buffer;
-  // Copies the first 4 bytes to a temporary buffer.
+  // Copies the 4 bytes at offset to a temporary buffer.
   size_t remaining = kZeroCopyFrameLengthFieldSize;
   for (size_t i = 0; i < sb->count; i++) {
     size_t slice_length = GRPC_SLICE_LENGTH(sb->slices[i]);
+    if (offset >= slice_length) {
+      offset -= slice_length;
+      continue;
+    }
+    const uint8_t* slice_data = GRPC_SLICE_START_PTR(sb->slices[i]) + offset;
+    slice_length -= offset;
+    offset = 0;
     if (remaining <= slice_length) {
-      memcpy(buf, GRPC_SLICE_START_PTR(sb->slices[i]), remaining);
+      memcpy(buf, slice_data, remaining);
       remaining = 0;
       break;
     } else {
-      memcpy(buf, GRPC_SLICE_START_PTR(sb->slices[i]), slice_length);
+      memcpy(buf, slice_data, slice_length);
       buf += slice_length;
       remaining -= slice_length;
     }
@@ -157,6 +165,13 @@ static tsi_result alts_zero_copy_grpc_protector_protect(
   }
   alts_zero_copy_grpc_protector* protector =
       reinterpret_cast<alts_zero_copy_grpc_protector*>(self);
+  // Seals all the frames at once if the record protocol supports it.
+  if (unprotected_slices->length > protector->max_unprotected_data_size &&
+      alts_grpc_record_protocol_supports_batch(protector->record_protocol)) {
+    return alts_grpc_record_protocol_protect_batch(
+        protector->record_protocol, unprotected_slices,
+        protector->max_unprotected_data_size, protected_slices);
+  }
   // Calls alts_grpc_record_protocol protect repeatly.
   while (unprotected_slices->length > protector->max_unprotected_data_size) {
     grpc_slice_buffer_move_first(unprotected_slices,
@@ -189,7 +204,7 @@ static tsi_result alts_zero_copy_grpc_protector_unprotect(
   while (protector->protected_sb.length >= kZeroCopyFrameLengthFieldSize) {
     if (protector->parsed_frame_size == 0) {
       // We have not parsed frame size yet. Parses frame size.
-      if (!read_frame_size(&protector->protected_sb,
+      if (!read_frame_size(&protector->protected_sb, /*offset=*/0,
                            &protector->parsed_frame_size)) {
         grpc_slice_buffer_reset_and_unref(&protector->protected_sb);
         return TSI_DATA_CORRUPTED;
@@ -198,7 +213,33 @@ static tsi_result alts_zero_copy_grpc_protector_unprotect(
     if (protector->protected_sb.length < protector->parsed_frame_size) break;
     // At this point, protected_sb contains at least one frame of data.
     tsi_result status;
-    if (protector->protected_sb.length == protector->parsed_frame_size) {
+    size_t batch_length = protector->parsed_frame_size;
+    if (alts_grpc_record_protocol_supports_batch(
+            protector->unrecord_protocol)) {
+      // Gathers the full frames that follow, to unprotect them all at once.
+      // Frames with a bad size are left to the loop above to report.
+      uint32_t next_frame_size = 0;
+      while (read_frame_size(&protector->protected_sb, batch_length,
+                             &next_frame_size) &&
+             protector->protected_sb.length - batch_length >=
+                 next_frame_size) {
+        batch_length += next_frame_size;
+      }
+    }
+    if (batch_length > protector->parsed_frame_size) {
+      if (protector->protected_sb.length == batch_length) {
+        status = alts_grpc_record_protocol_unprotect_batch(
+            protector->unrecord_protocol, &protector->protected_sb,
+            unprotected_slices);
+      } else {
+        grpc_slice_buffer_move_first(&protector->protected_sb, batch_length,
+                                     &protector->protected_staging_sb);
+        status = alts_grpc_record_protocol_unprotect_batch(
+            protector->unrecord_protocol, &protector->protected_staging_sb,
+            unprotected_slices);
+      }
+    } else if (protector->protected_sb.length ==
+               protector->parsed_frame_size) {
       status = alts_grpc_record_protocol_unprotect(protector->unrecord_protocol,
                                                    &protector->protected_sb,
                                                    unprotected_slices);
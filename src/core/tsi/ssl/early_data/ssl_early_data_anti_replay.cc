@@ -0,0 +1,46 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/tsi/ssl/early_data/ssl_early_data_anti_replay.h"
+
+#include <stdint.h>
+
+#include <utility>
+
+#include <openssl/sha.h>
+
+namespace tsi {
+
+bool SslEarlyDataAntiReplay::AcceptEarlyData(absl::string_view psk_extension,
+                                             gpr_timespec now) {
+  uint8_t digest[SHA256_DIGEST_LENGTH];
+  SHA256(reinterpret_cast<const uint8_t*>(psk_extension.data()),
+         psk_extension.size(), digest);
+  std::string key(reinterpret_cast<const char*>(digest), sizeof(digest));
+  grpc_core::MutexLock lock(&mu_);
+  while (!entries_.empty() && gpr_time_cmp(entries_.front().expiry, now) <= 0) {
+    digests_.erase(entries_.front().digest);
+    entries_.pop_front();
+  }
+  if (entries_.size() >= capacity_) return false;
+  if (!digests_.insert(key).second) return false;
+  entries_.push_back(Entry{
+      std::move(key),
+      gpr_time_add(now, gpr_time_from_millis(kWindowMs, GPR_TIMESPAN))});
+  return true;
+}
+
+}  // namespace tsi
@@ -0,0 +1,82 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_EARLY_DATA_SSL_EARLY_DATA_ANTI_REPLAY_H
+#define GRPC_SRC_CORE_TSI_SSL_EARLY_DATA_SSL_EARLY_DATA_ANTI_REPLAY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <deque>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/time.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace tsi {
+
+// Remembers the ClientHellos whose TLS 1.3 early data a server accepted, so
+// that the early data of the same ClientHello sent again, as an attacker
+// replaying it would, is rejected. ClientHellos are told apart by their
+// pre_shared_key extension, which holds the ticket and a binder over the
+// whole ClientHello.
+//
+// Entries are only kept for kWindowMs: BoringSSL already rejects the early
+// data of tickets whose age is off by more than that, which replays older than
+// kWindowMs are. Replays sent to other servers sharing the same session ticket
+// keys are not detected.
+class SslEarlyDataAntiReplay
+    : public grpc_core::RefCounted<SslEarlyDataAntiReplay> {
+ public:
+  static constexpr int64_t kWindowMs = 60 * 1000;
+
+  // Remembers up to capacity ClientHellos. Once that many were seen within
+  // kWindowMs, further early data is rejected until the oldest expire.
+  explicit SslEarlyDataAntiReplay(size_t capacity) : capacity_(capacity) {}
+
+  SslEarlyDataAntiReplay(const SslEarlyDataAntiReplay&) = delete;
+  SslEarlyDataAntiReplay& operator=(const SslEarlyDataAntiReplay&) = delete;
+
+  // Returns true, and remembers it, if the early data of the ClientHello with
+  // the pre_shared_key extension psk_extension may be accepted at now, a
+  // GPR_CLOCK_MONOTONIC time.
+  bool AcceptEarlyData(absl::string_view psk_extension, gpr_timespec now);
+  bool AcceptEarlyData(absl::string_view psk_extension) {
+    return AcceptEarlyData(psk_extension, gpr_now(GPR_CLOCK_MONOTONIC));
+  }
+
+ private:
+  struct Entry {
+    std::string digest;
+    gpr_timespec expiry;
+  };
+
+  const size_t capacity_;
+  grpc_core::Mutex mu_;
+  // Oldest first, so that they expire from the front.
+  std::deque<Entry> entries_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_set<std::string> digests_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_EARLY_DATA_SSL_EARLY_DATA_ANTI_REPLAY_H
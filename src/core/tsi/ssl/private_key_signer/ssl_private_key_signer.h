@@ -0,0 +1,53 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_PRIVATE_KEY_SIGNER_SSL_PRIVATE_KEY_SIGNER_H
+#define GRPC_SRC_CORE_TSI_SSL_PRIVATE_KEY_SIGNER_SSL_PRIVATE_KEY_SIGNER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <string>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/gprpp/ref_counted.h"
+
+namespace tsi {
+
+// Signs the handshakes of a TLS server with a private key that is not in
+// process memory, such as one kept in an HSM or by a remote signing
+// service. Signing runs asynchronously: the handshake is suspended, without
+// holding on to a thread, until the signer calls back, so that many
+// handshakes can wait on the signer at once.
+class SslPrivateKeySigner : public grpc_core::RefCounted<SslPrivateKeySigner> {
+ public:
+  using OnSignDone =
+      absl::AnyInvocable<void(absl::StatusOr<std::string> signature)>;
+
+  // Signs |data| with the TLS SignatureScheme |signature_algorithm|, as
+  // listed in RFC 8446, section 4.2.3. |data| is not hashed yet: the signer
+  // hashes it as the algorithm says. |on_done| must be invoked exactly once,
+  // with the signature or with the error that fails the handshake. It may be
+  // invoked from any thread, including this one before Sign() returns.
+  virtual void Sign(absl::string_view data, uint16_t signature_algorithm,
+                    OnSignDone on_done) = 0;
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_PRIVATE_KEY_SIGNER_SSL_PRIVATE_KEY_SIGNER_H
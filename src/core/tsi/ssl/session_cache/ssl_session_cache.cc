@@ -125,6 +125,17 @@ SslSessionPtr SslSessionLRUCache::Get(const char* key) {
   return node->CopySession();
 }
 
+void SslSessionLRUCache::Erase(const char* key) {
+  grpc_core::MutexLock lock(&lock_);
+  auto it = entry_by_key_.find(key);
+  if (it == entry_by_key_.end()) return;
+  Node* node = it->second;
+  Remove(node);
+  entry_by_key_.erase(it);
+  delete node;
+  AssertInvariants();
+}
+
 void SslSessionLRUCache::Remove(SslSessionLRUCache::Node* node) {
   if (node->prev_ == nullptr) {
     use_order_list_head_ = node->next_;
@@ -76,6 +76,8 @@ class SslSessionLRUCache
   /// Returns the session from the cache associated with \a key or null if not
   /// found.
   SslSessionPtr Get(const char* key);
+  /// Discards the session associated with \a key, if any.
+  void Erase(const char* key);
 
  private:
   class Node;
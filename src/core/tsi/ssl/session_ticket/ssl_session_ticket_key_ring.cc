@@ -0,0 +1,69 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/tsi/ssl/session_ticket/ssl_session_ticket_key_ring.h"
+
+#include <string.h>
+
+#include <openssl/crypto.h>
+
+namespace tsi {
+
+static_assert(sizeof(SslSessionTicketKeyRing::Key) ==
+                  SslSessionTicketKeyRing::kKeySize,
+              "keys must be laid out as they are on the wire");
+
+SslSessionTicketKeyRing::~SslSessionTicketKeyRing() {
+  grpc_core::MutexLock lock(&mu_);
+  ClearKeysLocked();
+}
+
+bool SslSessionTicketKeyRing::SetKeys(absl::string_view keys) {
+  if (keys.empty() || keys.size() % kKeySize != 0) return false;
+  grpc_core::MutexLock lock(&mu_);
+  ClearKeysLocked();
+  keys_.resize(keys.size() / kKeySize);
+  memcpy(keys_.data(), keys.data(), keys.size());
+  return true;
+}
+
+bool SslSessionTicketKeyRing::GetEncryptionKey(Key* key) {
+  grpc_core::MutexLock lock(&mu_);
+  if (keys_.empty()) return false;
+  *key = keys_.front();
+  return true;
+}
+
+SslSessionTicketKeyRing::DecryptionKey
+SslSessionTicketKeyRing::GetDecryptionKey(const uint8_t* name, Key* key) {
+  grpc_core::MutexLock lock(&mu_);
+  for (size_t i = 0; i < keys_.size(); ++i) {
+    if (memcmp(keys_[i].name, name, kKeyNameSize) == 0) {
+      *key = keys_[i];
+      return i == 0 ? DecryptionKey::kCurrent : DecryptionKey::kPrevious;
+    }
+  }
+  return DecryptionKey::kNotFound;
+}
+
+void SslSessionTicketKeyRing::ClearKeysLocked() {
+  if (!keys_.empty()) {
+    OPENSSL_cleanse(keys_.data(), keys_.size() * sizeof(Key));
+  }
+  keys_.clear();
+}
+
+}  // namespace tsi
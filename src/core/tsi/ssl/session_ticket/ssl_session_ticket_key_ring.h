@@ -0,0 +1,90 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_SESSION_TICKET_SSL_SESSION_TICKET_KEY_RING_H
+#define GRPC_SRC_CORE_TSI_SSL_SESSION_TICKET_SSL_SESSION_TICKET_KEY_RING_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace tsi {
+
+// The keys that TLS servers encrypt session tickets with, and decrypt the
+// tickets presented by resuming clients with. Servers that share the same
+// keys, such as the replicas behind a load balancer, resume each other's
+// sessions. Keys can be rotated at any time: the first key encrypts new
+// tickets, while the others are only kept around to decrypt the tickets
+// that are still out there, which get renewed with the first key.
+class SslSessionTicketKeyRing
+    : public grpc_core::RefCounted<SslSessionTicketKeyRing> {
+ public:
+  static constexpr size_t kKeyNameSize = 16;
+  static constexpr size_t kHmacKeySize = 32;
+  static constexpr size_t kAesKeySize = 32;
+  // A key is made of the name that tickets carry to tell their key, an
+  // HMAC-SHA256 key and an AES-256-CBC key, in this order, as in the key
+  // files of other TLS servers such as nginx.
+  static constexpr size_t kKeySize = kKeyNameSize + kHmacKeySize + kAesKeySize;
+
+  struct Key {
+    uint8_t name[kKeyNameSize];
+    uint8_t hmac_key[kHmacKeySize];
+    uint8_t aes_key[kAesKeySize];
+  };
+
+  enum class DecryptionKey {
+    kNotFound,
+    kCurrent,
+    // The ticket was encrypted with a key that is being rotated out, and the
+    // client should be sent a new one.
+    kPrevious,
+  };
+
+  SslSessionTicketKeyRing() = default;
+  ~SslSessionTicketKeyRing() override;
+
+  SslSessionTicketKeyRing(const SslSessionTicketKeyRing&) = delete;
+  SslSessionTicketKeyRing& operator=(const SslSessionTicketKeyRing&) = delete;
+
+  // Replaces the keys with keys, a concatenation of kKeySize byte keys of
+  // which the first one is current. Returns false, leaving the keys as they
+  // were, if keys is empty or not made of whole keys.
+  bool SetKeys(absl::string_view keys);
+
+  // Copies the current key into key. Returns false if there are no keys.
+  bool GetEncryptionKey(Key* key);
+
+  // Copies the key named name, which is kKeyNameSize bytes, into key.
+  DecryptionKey GetDecryptionKey(const uint8_t* name, Key* key);
+
+ private:
+  void ClearKeysLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  grpc_core::Mutex mu_;
+  std::vector<Key> keys_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_SESSION_TICKET_SSL_SESSION_TICKET_KEY_RING_H
@@ -20,6 +20,8 @@
 
 #include "src/core/tsi/ssl_transport_security.h"
 
+#include <errno.h>
+#include <inttypes.h>
 #include <limits.h>
 #include <string.h>
 
@@ -33,17 +35,29 @@
 #include <sys/socket.h>
 #endif
 
+#ifdef GPR_LINUX
+#include <linux/tls.h>
+#include <netinet/tcp.h>
+#endif
+
+#include <algorithm>
 #include <string>
+#include <utility>
 
 #include <openssl/bio.h>
 #include <openssl/crypto.h>  // For OPENSSL_free
 #include <openssl/engine.h>
 #include <openssl/err.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
 #include <openssl/tls1.h>
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/escaping.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
@@ -57,6 +71,10 @@
 
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/strerror.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/tsi/ssl/early_data/ssl_early_data_anti_replay.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
@@ -80,6 +98,31 @@
 // SSL structure. This is what we would ultimately want though...
 #define TSI_SSL_MAX_PROTECTION_OVERHEAD 100
 
+// Kernel TLS is only attempted for TLS 1.3, whose traffic secrets reach us
+// through the keylog callback.
+#if defined(GPR_LINUX) && defined(TLS_1_3_VERSION) && \
+    OPENSSL_VERSION_NUMBER >= 0x10101000 && !defined(LIBRESSL_VERSION_NUMBER)
+#define TSI_SSL_KERNEL_TLS 1
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#endif
+
+// Handshakes can only wait for an asynchronous private key signer through
+// BoringSSL's SSL_PRIVATE_KEY_METHOD.
+#ifdef OPENSSL_IS_BORINGSSL
+#define TSI_SSL_PRIVATE_KEY_OFFLOAD 1
+#endif
+
+// TLS 1.3 early data relies on BoringSSL handing control back while the
+// handshake is still running on early data (SSL_in_early_data()).
+#ifdef OPENSSL_IS_BORINGSSL
+#define TSI_SSL_EARLY_DATA 1
+#endif
+
 using TlsSessionKeyLogger = tsi::TlsSessionKeyLoggerCache::TlsSessionKeyLogger;
 
 // --- Structure definitions. ---
@@ -100,6 +143,7 @@ struct tsi_ssl_client_handshaker_factory {
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<tsi::SslSessionLRUCache> session_cache;
   grpc_core::RefCountedPtr<TlsSessionKeyLogger> key_logger;
+  bool enable_early_data;
 };
 
 struct tsi_ssl_server_handshaker_factory {
@@ -113,8 +157,32 @@ struct tsi_ssl_server_handshaker_factory {
   unsigned char* alpn_protocol_list;
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<TlsSessionKeyLogger> key_logger;
+  bool enable_kernel_tls;
+  grpc_core::RefCountedPtr<tsi::SslSessionTicketKeyRing>
+      session_ticket_key_ring;
+  grpc_core::RefCountedPtr<tsi::SslPrivateKeySigner> private_key_signer;
+  grpc_core::RefCountedPtr<tsi::SslEarlyDataAntiReplay> early_data_anti_replay;
 };
 
+#ifdef TSI_SSL_PRIVATE_KEY_OFFLOAD
+struct tsi_ssl_handshaker;
+
+// A signing by the server's private key signer. It is shared by the
+// handshaker that started it and by the signer's callback, since either may
+// be done with it first.
+struct tsi_ssl_private_key_operation
+    : public grpc_core::RefCounted<tsi_ssl_private_key_operation> {
+  grpc_core::Mutex mu;
+  bool done ABSL_GUARDED_BY(mu) = false;
+  absl::StatusOr<std::string> signature ABSL_GUARDED_BY(mu);
+  // Set while next() has returned TSI_ASYNC to wait for the signature: the
+  // handshake to resume once it is there, and whom to tell about it.
+  tsi_ssl_handshaker* handshaker ABSL_GUARDED_BY(mu) = nullptr;
+  tsi_handshaker_on_next_done_cb cb ABSL_GUARDED_BY(mu) = nullptr;
+  void* user_data ABSL_GUARDED_BY(mu) = nullptr;
+};
+#endif
+
 struct tsi_ssl_handshaker {
   tsi_handshaker base;
   SSL* ssl;
@@ -123,6 +191,15 @@ struct tsi_ssl_handshaker {
   unsigned char* outgoing_bytes_buffer;
   size_t outgoing_bytes_buffer_size;
   tsi_ssl_handshaker_factory* factory_ref;
+#ifdef TSI_SSL_PRIVATE_KEY_OFFLOAD
+  // The signing in progress, if any. Holds a ref.
+  tsi_ssl_private_key_operation* private_key_operation;
+  // Where the handshake stood when it started waiting for the signature: how
+  // much of outgoing_bytes_buffer was filled, and how many bytes the
+  // interrupted next() call had received.
+  size_t pending_bytes_written;
+  size_t pending_received_bytes_size;
+#endif
 };
 struct tsi_ssl_handshaker_result {
   tsi_handshaker_result base;
@@ -138,6 +215,16 @@ struct tsi_ssl_frame_protector {
   unsigned char* buffer;
   size_t buffer_size;
   size_t buffer_offset;
+#ifdef TSI_SSL_EARLY_DATA
+  // Client side, while the handshake still runs on early data: how many more
+  // bytes the server takes as early data. What is written beyond that is
+  // queued in deferred, to be written from deferred_offset on once the
+  // handshake is done.
+  size_t early_data_remaining;
+  unsigned char* deferred;
+  size_t deferred_size;
+  size_t deferred_offset;
+#endif
 };
 // --- Library Initialization. ---
 
@@ -145,6 +232,25 @@ static gpr_once g_init_openssl_once = GPR_ONCE_INIT;
 static int g_ssl_ctx_ex_factory_index = -1;
 static const unsigned char kSslSessionIdContext[] = {'g', 'r', 'p', 'c'};
 static int g_ssl_ex_verified_root_cert_index = -1;
+#ifdef TSI_SSL_PRIVATE_KEY_OFFLOAD
+static int g_ssl_ex_handshaker_index = -1;
+#endif
+#ifdef TSI_SSL_KERNEL_TLS
+static int g_ssl_ex_kernel_tls_secrets_index = -1;
+
+// The TLS 1.3 application traffic secrets of a server session, kept until
+// the handshaker result hands them to the kernel.
+struct tsi_ssl_kernel_tls_secrets {
+  std::string client_traffic_secret;
+  std::string server_traffic_secret;
+};
+
+static void kernel_tls_secrets_free(void* /*parent*/, void* ptr,
+                                    CRYPTO_EX_DATA* /*ad*/, int /*index*/,
+                                    long /*argl*/, void* /*argp*/) {
+  delete static_cast<tsi_ssl_kernel_tls_secrets*>(ptr);
+}
+#endif
 #if !defined(OPENSSL_IS_BORINGSSL) && !defined(OPENSSL_NO_ENGINE)
 static const char kSslEnginePrefix[] = "engine:";
 #endif
@@ -198,6 +304,18 @@ static void init_openssl(void) {
   g_ssl_ex_verified_root_cert_index =
       SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
   GPR_ASSERT(g_ssl_ex_verified_root_cert_index != -1);
+
+#ifdef TSI_SSL_PRIVATE_KEY_OFFLOAD
+  g_ssl_ex_handshaker_index =
+      SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  GPR_ASSERT(g_ssl_ex_handshaker_index != -1);
+#endif
+
+#ifdef TSI_SSL_KERNEL_TLS
+  g_ssl_ex_kernel_tls_secrets_index = SSL_get_ex_new_index(
+      0, nullptr, nullptr, nullptr, kernel_tls_secrets_free);
+  GPR_ASSERT(g_ssl_ex_kernel_tls_secrets_index != -1);
+#endif
 }
 
 // --- Ssl utils. ---
@@ -1051,6 +1169,54 @@ void tsi_ssl_session_cache_unref(tsi_ssl_session_cache* cache) {
 
 // --- tsi_frame_protector methods implementation. ---
 
+#ifdef TSI_SSL_EARLY_DATA
+static bool ssl_protector_in_early_data(const tsi_ssl_frame_protector* impl) {
+  return !SSL_is_server(impl->ssl) && SSL_in_early_data(impl->ssl);
+}
+
+static bool ssl_protector_has_deferred(const tsi_ssl_frame_protector* impl) {
+  return impl->deferred_offset < impl->deferred_size;
+}
+
+static void ssl_protector_defer(tsi_ssl_frame_protector* impl,
+                                const unsigned char* bytes, size_t size) {
+  impl->deferred = static_cast<unsigned char*>(
+      gpr_realloc(impl->deferred, impl->deferred_size + size));
+  memcpy(impl->deferred + impl->deferred_size, bytes, size);
+  impl->deferred_size += size;
+}
+
+// Queues the bytes waiting in the frame buffer, behind which nothing may be
+// written.
+static void ssl_protector_defer_buffer(tsi_ssl_frame_protector* impl) {
+  ssl_protector_defer(impl, impl->buffer, impl->buffer_offset);
+  impl->buffer_offset = 0;
+}
+
+// Once the handshake is done, writes the next frame of what was queued during
+// early data, unless the network BIO still holds protected bytes to be read
+// first.
+static tsi_result ssl_protector_write_deferred(tsi_ssl_frame_protector* impl) {
+  if (!ssl_protector_has_deferred(impl) || ssl_protector_in_early_data(impl) ||
+      BIO_pending(impl->network_io) > 0) {
+    return TSI_OK;
+  }
+  size_t size = std::min(impl->buffer_size,
+                         impl->deferred_size - impl->deferred_offset);
+  tsi_result result = grpc_core::DoSslWrite(
+      impl->ssl, impl->deferred + impl->deferred_offset, size);
+  if (result != TSI_OK) return result;
+  impl->deferred_offset += size;
+  if (!ssl_protector_has_deferred(impl)) {
+    gpr_free(impl->deferred);
+    impl->deferred = nullptr;
+    impl->deferred_size = 0;
+    impl->deferred_offset = 0;
+  }
+  return TSI_OK;
+}
+#endif
+
 static tsi_result ssl_protector_protect(tsi_frame_protector* self,
                                         const unsigned char* unprotected_bytes,
                                         size_t* unprotected_bytes_size,
@@ -1058,11 +1224,39 @@ static tsi_result ssl_protector_protect(tsi_frame_protector* self,
                                         size_t* protected_output_frames_size) {
   tsi_ssl_frame_protector* impl =
       reinterpret_cast<tsi_ssl_frame_protector*>(self);
-
+#ifdef TSI_SSL_EARLY_DATA
+  tsi_result result = ssl_protector_write_deferred(impl);
+  if (result != TSI_OK) return result;
+  // Whether this call fills the frame buffer and writes it as early data.
+  bool writes_early_data =
+      ssl_protector_in_early_data(impl) &&
+      BIO_pending(impl->network_io) == 0 &&
+      *unprotected_bytes_size >= impl->buffer_size - impl->buffer_offset;
+  if (BIO_pending(impl->network_io) == 0 &&
+      (ssl_protector_has_deferred(impl) ||
+       (writes_early_data &&
+        impl->buffer_size > impl->early_data_remaining))) {
+    // The server takes no more early data, so everything from here on waits
+    // for the handshake.
+    ssl_protector_defer_buffer(impl);
+    ssl_protector_defer(impl, unprotected_bytes, *unprotected_bytes_size);
+    *protected_output_frames_size = 0;
+    return TSI_OK;
+  }
+  result = grpc_core::SslProtectorProtect(
+      unprotected_bytes, impl->buffer_size, impl->buffer_offset, impl->buffer,
+      impl->ssl, impl->network_io, unprotected_bytes_size,
+      protected_output_frames, protected_output_frames_size);
+  if (result == TSI_OK && writes_early_data) {
+    impl->early_data_remaining -= impl->buffer_size;
+  }
+  return result;
+#else
   return grpc_core::SslProtectorProtect(
       unprotected_bytes, impl->buffer_size, impl->buffer_offset, impl->buffer,
       impl->ssl, impl->network_io, unprotected_bytes_size,
       protected_output_frames, protected_output_frames_size);
+#endif
 }
 
 static tsi_result ssl_protector_protect_flush(
@@ -1070,10 +1264,33 @@ static tsi_result ssl_protector_protect_flush(
     size_t* protected_output_frames_size, size_t* still_pending_size) {
   tsi_ssl_frame_protector* impl =
       reinterpret_cast<tsi_ssl_frame_protector*>(self);
+#ifdef TSI_SSL_EARLY_DATA
+  tsi_result result = ssl_protector_write_deferred(impl);
+  if (result != TSI_OK) return result;
+  if (ssl_protector_has_deferred(impl)) {
+    ssl_protector_defer_buffer(impl);
+  } else if (ssl_protector_in_early_data(impl)) {
+    if (impl->buffer_offset > impl->early_data_remaining) {
+      ssl_protector_defer_buffer(impl);
+    } else {
+      impl->early_data_remaining -= impl->buffer_offset;
+    }
+  }
+  result = grpc_core::SslProtectorProtectFlush(
+      impl->buffer_offset, impl->buffer, impl->ssl, impl->network_io,
+      protected_output_frames, protected_output_frames_size,
+      still_pending_size);
+  // What is queued only counts as pending once it can be written.
+  if (result == TSI_OK && !ssl_protector_in_early_data(impl)) {
+    *still_pending_size += impl->deferred_size - impl->deferred_offset;
+  }
+  return result;
+#else
   return grpc_core::SslProtectorProtectFlush(
       impl->buffer_offset, impl->buffer, impl->ssl, impl->network_io,
       protected_output_frames, protected_output_frames_size,
       still_pending_size);
+#endif
 }
 
 static tsi_result ssl_protector_unprotect(
@@ -1091,6 +1308,9 @@ static void ssl_protector_destroy(tsi_frame_protector* self) {
   tsi_ssl_frame_protector* impl =
       reinterpret_cast<tsi_ssl_frame_protector*>(self);
   if (impl->buffer != nullptr) gpr_free(impl->buffer);
+#ifdef TSI_SSL_EARLY_DATA
+  if (impl->deferred != nullptr) gpr_free(impl->deferred);
+#endif
   if (impl->ssl != nullptr) SSL_free(impl->ssl);
   if (impl->network_io != nullptr) BIO_free(impl->network_io);
   gpr_free(self);
@@ -1300,6 +1520,12 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
   impl->ssl = nullptr;
   protector_impl->network_io = impl->network_io;
   impl->network_io = nullptr;
+#ifdef TSI_SSL_EARLY_DATA
+  if (ssl_protector_in_early_data(protector_impl)) {
+    protector_impl->early_data_remaining =
+        SSL_SESSION_get_max_early_data(SSL_get_session(protector_impl->ssl));
+  }
+#endif
   protector_impl->base.vtable = &frame_protector_vtable;
   *protector = &protector_impl->base;
   return TSI_OK;
@@ -1315,6 +1541,155 @@ static tsi_result ssl_handshaker_result_get_unused_bytes(
   return TSI_OK;
 }
 
+#ifdef TSI_SSL_KERNEL_TLS
+// HKDF-Expand-Label from RFC 8446 section 7.1, with an empty context. Keys
+// and IVs are never longer than the hash, so a single HMAC block suffices.
+static bool tls13_hkdf_expand_label(const EVP_MD* md,
+                                    const std::string& secret,
+                                    absl::string_view label, uint8_t* out,
+                                    size_t out_len) {
+  std::string info;
+  info.push_back(static_cast<char>(out_len >> 8));
+  info.push_back(static_cast<char>(out_len & 0xff));
+  info.push_back(static_cast<char>(strlen("tls13 ") + label.size()));
+  absl::StrAppend(&info, "tls13 ", label);
+  info.push_back(0);  // Empty context.
+  info.push_back(1);  // Index of the one and only block.
+  unsigned char block[EVP_MAX_MD_SIZE];
+  unsigned int block_size = 0;
+  if (HMAC(md, secret.data(), static_cast<int>(secret.size()),
+           reinterpret_cast<const unsigned char*>(info.data()), info.size(),
+           block, &block_size) == nullptr ||
+      block_size < out_len) {
+    return false;
+  }
+  memcpy(out, block, out_len);
+  OPENSSL_cleanse(block, sizeof(block));
+  return true;
+}
+
+// Installs the keys derived from traffic_secret for one direction of the
+// socket, described by one of the tls12_crypto_info_* types of
+// <linux/tls.h>.
+template <typename CryptoInfo>
+static bool kernel_tls_set_crypto_info(int fd, int direction,
+                                       uint16_t cipher_type, const EVP_MD* md,
+                                       const std::string& traffic_secret) {
+  CryptoInfo crypto_info;
+  memset(&crypto_info, 0, sizeof(crypto_info));
+  crypto_info.info.version = TLS_1_3_VERSION;
+  crypto_info.info.cipher_type = cipher_type;
+  // The kernel takes the 12 byte TLS 1.3 IV as an implicit salt followed by
+  // the part that the record sequence number is mixed into. The sequence
+  // number itself starts from zero, since with session tickets disabled the
+  // server has not protected any record with the application keys yet.
+  uint8_t iv[sizeof(crypto_info.salt) + sizeof(crypto_info.iv)];
+  bool ok = tls13_hkdf_expand_label(md, traffic_secret, "key",
+                                    crypto_info.key, sizeof(crypto_info.key)) &&
+            tls13_hkdf_expand_label(md, traffic_secret, "iv", iv, sizeof(iv));
+  if (ok) {
+    memcpy(crypto_info.salt, iv, sizeof(crypto_info.salt));
+    memcpy(crypto_info.iv, iv + sizeof(crypto_info.salt),
+           sizeof(crypto_info.iv));
+    if (setsockopt(fd, SOL_TLS, direction, &crypto_info,
+                   sizeof(crypto_info)) != 0) {
+      gpr_log(GPR_INFO, "Could not install kernel TLS %s keys: %s",
+              direction == TLS_RX ? "RX" : "TX",
+              grpc_core::StrError(errno).c_str());
+      ok = false;
+    }
+  }
+  OPENSSL_cleanse(iv, sizeof(iv));
+  OPENSSL_cleanse(&crypto_info, sizeof(crypto_info));
+  return ok;
+}
+
+// Returns false if the kernel does not implement the TLS 1.3 cipher suite
+// with the given IANA id.
+static bool kernel_tls_set_crypto_info(int fd, int direction,
+                                       uint16_t protocol_id,
+                                       const std::string& traffic_secret) {
+  switch (protocol_id) {
+    case 0x1301:  // TLS_AES_128_GCM_SHA256
+      return kernel_tls_set_crypto_info<tls12_crypto_info_aes_gcm_128>(
+          fd, direction, TLS_CIPHER_AES_GCM_128, EVP_sha256(), traffic_secret);
+    case 0x1302:  // TLS_AES_256_GCM_SHA384
+      return kernel_tls_set_crypto_info<tls12_crypto_info_aes_gcm_256>(
+          fd, direction, TLS_CIPHER_AES_GCM_256, EVP_sha384(), traffic_secret);
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    case 0x1303:  // TLS_CHACHA20_POLY1305_SHA256
+      return kernel_tls_set_crypto_info<tls12_crypto_info_chacha20_poly1305>(
+          fd, direction, TLS_CIPHER_CHACHA20_POLY1305, EVP_sha256(),
+          traffic_secret);
+#endif
+    default:
+      return false;
+  }
+}
+
+static bool kernel_tls_supports_cipher(uint16_t protocol_id) {
+  switch (protocol_id) {
+    case 0x1301:
+    case 0x1302:
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    case 0x1303:
+#endif
+      return true;
+    default:
+      return false;
+  }
+}
+
+static tsi_result ssl_handshaker_result_enable_kernel_tls(
+    tsi_handshaker_result* self, int fd) {
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(self);
+  if (impl->ssl == nullptr) return TSI_FAILED_PRECONDITION;
+  // Only set for server sessions of a factory created with enable_kernel_tls.
+  tsi_ssl_kernel_tls_secrets* secrets =
+      static_cast<tsi_ssl_kernel_tls_secrets*>(
+          SSL_get_ex_data(impl->ssl, g_ssl_ex_kernel_tls_secrets_index));
+  const SSL_CIPHER* cipher = SSL_get_current_cipher(impl->ssl);
+  // Records that came in along with the end of the handshake have been read
+  // off the socket already, and left for the frame protector to decrypt. Like
+  // OpenSSL's own kTLS support, leave such sessions in user space rather than
+  // guessing what they hold.
+  if (secrets == nullptr || secrets->client_traffic_secret.empty() ||
+      secrets->server_traffic_secret.empty() ||
+      SSL_version(impl->ssl) != TLS1_3_VERSION || cipher == nullptr ||
+      !kernel_tls_supports_cipher(SSL_CIPHER_get_protocol_id(cipher)) ||
+      impl->unused_bytes_size > 0 || SSL_pending(impl->ssl) > 0 ||
+      BIO_pending(impl->network_io) > 0) {
+    return TSI_UNIMPLEMENTED;
+  }
+  const uint16_t protocol_id = SSL_CIPHER_get_protocol_id(cipher);
+  if (setsockopt(fd, IPPROTO_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+    gpr_log(GPR_DEBUG, "Kernel TLS is not available: %s",
+            grpc_core::StrError(errno).c_str());
+    return TSI_UNIMPLEMENTED;
+  }
+  // Until keys are installed, the TLS ULP passes bytes through as they are,
+  // so the session can still go on with a frame protector.
+  if (!kernel_tls_set_crypto_info(fd, TLS_RX, protocol_id,
+                                  secrets->client_traffic_secret)) {
+    return TSI_UNIMPLEMENTED;
+  }
+  if (!kernel_tls_set_crypto_info(fd, TLS_TX, protocol_id,
+                                  secrets->server_traffic_secret)) {
+    gpr_log(GPR_ERROR, "Kernel TLS took RX keys but not TX keys.");
+    return TSI_INTERNAL_ERROR;
+  }
+  // The kernel has all it needs; don't keep the secrets around any longer.
+  OPENSSL_cleanse(&secrets->client_traffic_secret[0],
+                  secrets->client_traffic_secret.size());
+  OPENSSL_cleanse(&secrets->server_traffic_secret[0],
+                  secrets->server_traffic_secret.size());
+  SSL_set_ex_data(impl->ssl, g_ssl_ex_kernel_tls_secrets_index, nullptr);
+  delete secrets;
+  return TSI_OK;
+}
+#endif  // TSI_SSL_KERNEL_TLS
+
 static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(self);
@@ -1331,6 +1706,11 @@ static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
+#ifdef TSI_SSL_KERNEL_TLS
+    ssl_handshaker_result_enable_kernel_tls,
+#else
+    nullptr,  // enable_kernel_tls
+#endif
 };
 
 static tsi_result ssl_handshaker_result_create(
@@ -1389,6 +1769,15 @@ static tsi_result ssl_handshaker_get_result(tsi_ssl_handshaker* impl) {
       SSL_is_init_finished(impl->ssl)) {
     impl->result = TSI_OK;
   }
+#ifdef TSI_SSL_EARLY_DATA
+  // With early data, the handshake is handed on to the frame protector,
+  // whose SSL_read() calls finish it: a client may then write early data
+  // before the server answers, and a server read the client's early data.
+  if (impl->result == TSI_HANDSHAKE_IN_PROGRESS &&
+      SSL_in_early_data(impl->ssl)) {
+    impl->result = TSI_OK;
+  }
+#endif
   return impl->result;
 }
 
@@ -1414,6 +1803,11 @@ static tsi_result ssl_handshaker_do_handshake(tsi_ssl_handshaker* impl,
         return TSI_OK;
       case SSL_ERROR_WANT_WRITE:
         return TSI_DRAIN_BUFFER;
+#ifdef TSI_SSL_PRIVATE_KEY_OFFLOAD
+      case SSL_ERROR_WANT_PRIVATE_KEY_OPERATION:
+        // The handshake goes on once the private key signer calls back.
+        return TSI_ASYNC;
+#endif
       default: {
         char err_str[256];
         ERR_error_string_n(ERR_get_error(), err_str, sizeof(err_str));
@@ -1453,6 +1847,16 @@ static tsi_result ssl_handshaker_process_bytes_from_peer(
 
 static void ssl_handshaker_destroy(tsi_handshaker* self) {
   tsi_ssl_handshaker* impl = reinterpret_cast<tsi_ssl_handshaker*>(self);
+#ifdef TSI_SSL_PRIVATE_KEY_OFFLOAD
+  // A signature still to come is dropped when it arrives.
+  if (impl->private_key_operation != nullptr) {
+    {
+      grpc_core::MutexLock lock(&impl->private_key_operation->mu);
+      impl->private_key_operation->handshaker = nullptr;
+    }
+    impl->private_key_operation->Unref();
+  }
+#endif
   SSL_free(impl->ssl);
   BIO_free(impl->network_io);
   gpr_free(impl->outgoing_bytes_buffer);
@@ -1520,34 +1924,58 @@ static tsi_result ssl_handshaker_write_output_buffer(tsi_handshaker* self,
   return status;
 }
 
-static tsi_result ssl_handshaker_next(tsi_handshaker* self,
-                                      const unsigned char* received_bytes,
-                                      size_t received_bytes_size,
-                                      const unsigned char** bytes_to_send,
-                                      size_t* bytes_to_send_size,
-                                      tsi_handshaker_result** handshaker_result,
-                                      tsi_handshaker_on_next_done_cb /*cb*/,
-                                      void* /*user_data*/, std::string* error) {
-  // Input sanity check.
-  if ((received_bytes_size > 0 && received_bytes == nullptr) ||
-      bytes_to_send == nullptr || bytes_to_send_size == nullptr ||
-      handshaker_result == nullptr) {
-    if (error != nullptr) *error = "invalid argument";
-    return TSI_INVALID_ARGUMENT;
-  }
-  // If there are received bytes, process them first.
-  tsi_ssl_handshaker* impl = reinterpret_cast<tsi_ssl_handshaker*>(self);
-  tsi_result status = TSI_OK;
-  size_t bytes_consumed = received_bytes_size;
-  size_t bytes_written = 0;
-  if (received_bytes_size > 0) {
-    status = ssl_handshaker_process_bytes_from_peer(impl, received_bytes,
-                                                    &bytes_consumed, error);
+#ifdef TSI_SSL_PRIVATE_KEY_OFFLOAD
+// Called when the handshake has to wait for the private key signer. Returns
+// false if the signature is in already, so that the handshake can just go on.
+// Otherwise the handshake is left for ssl_private_key_operation_done() to
+// resume, with the state given here.
+static bool ssl_handshaker_wait_for_private_key(
+    tsi_ssl_handshaker* impl, size_t bytes_written, size_t received_bytes_size,
+    tsi_handshaker_on_next_done_cb cb, void* user_data) {
+  tsi_ssl_private_key_operation* op = impl->private_key_operation;
+  GPR_ASSERT(op != nullptr);
+  grpc_core::MutexLock lock(&op->mu);
+  if (op->done) return false;
+  impl->pending_bytes_written = bytes_written;
+  impl->pending_received_bytes_size = received_bytes_size;
+  op->handshaker = impl;
+  op->cb = cb;
+  op->user_data = user_data;
+  return true;
+}
+#endif
+
+// Carries the handshake on from |status|, what the last SSL_do_handshake()
+// step returned, and sets what is to be sent to the peer, and the handshaker
+// result once the handshake is done. |bytes_written| bytes of
+// outgoing_bytes_buffer are filled already, and |received_bytes_size| bytes
+// were received by the next() call the handshake is running for.
+static tsi_result ssl_handshaker_continue(
+    tsi_ssl_handshaker* impl, tsi_result status, size_t received_bytes_size,
+    size_t bytes_written, const unsigned char** bytes_to_send,
+    size_t* bytes_to_send_size, tsi_handshaker_result** handshaker_result,
+    tsi_handshaker_on_next_done_cb cb, void* user_data, std::string* error) {
+  tsi_handshaker* self = &impl->base;
+  while (true) {
     while (status == TSI_DRAIN_BUFFER) {
       status = ssl_handshaker_write_output_buffer(self, &bytes_written, error);
       if (status != TSI_OK) return status;
       status = ssl_handshaker_do_handshake(impl, error);
     }
+#ifdef TSI_SSL_PRIVATE_KEY_OFFLOAD
+    if (status == TSI_ASYNC) {
+      if (ssl_handshaker_wait_for_private_key(
+              impl, bytes_written, received_bytes_size, cb, user_data)) {
+        return TSI_ASYNC;
+      }
+      status = ssl_handshaker_do_handshake(impl, error);
+      continue;
+    }
+#else
+    (void)cb;
+    (void)user_data;
+#endif
+    break;
   }
   if (status != TSI_OK) return status;
   // Get bytes to send to the peer, if available.
@@ -1585,6 +2013,138 @@ static tsi_result ssl_handshaker_next(tsi_handshaker* self,
   return status;
 }
 
+static tsi_result ssl_handshaker_next(tsi_handshaker* self,
+                                      const unsigned char* received_bytes,
+                                      size_t received_bytes_size,
+                                      const unsigned char** bytes_to_send,
+                                      size_t* bytes_to_send_size,
+                                      tsi_handshaker_result** handshaker_result,
+                                      tsi_handshaker_on_next_done_cb cb,
+                                      void* user_data, std::string* error) {
+  // Input sanity check.
+  if ((received_bytes_size > 0 && received_bytes == nullptr) ||
+      bytes_to_send == nullptr || bytes_to_send_size == nullptr ||
+      handshaker_result == nullptr) {
+    if (error != nullptr) *error = "invalid argument";
+    return TSI_INVALID_ARGUMENT;
+  }
+  // If there are received bytes, process them first.
+  tsi_ssl_handshaker* impl = reinterpret_cast<tsi_ssl_handshaker*>(self);
+  tsi_result status = TSI_OK;
+  size_t bytes_consumed = received_bytes_size;
+  if (received_bytes_size > 0) {
+    status = ssl_handshaker_process_bytes_from_peer(impl, received_bytes,
+                                                    &bytes_consumed, error);
+  }
+  return ssl_handshaker_continue(impl, status, received_bytes_size, 0,
+                                 bytes_to_send, bytes_to_send_size,
+                                 handshaker_result, cb, user_data, error);
+}
+
+#ifdef TSI_SSL_PRIVATE_KEY_OFFLOAD
+// Takes the signer's result, on whatever thread the signer finished on. If
+// the handshake is waiting for it, the handshake goes on from here, and the
+// callback given to the interrupted next() call is invoked once it reaches
+// the next point where next() would have returned.
+static void ssl_private_key_operation_done(
+    tsi_ssl_private_key_operation* op,
+    absl::StatusOr<std::string> signature) {
+  tsi_ssl_handshaker* impl;
+  tsi_handshaker_on_next_done_cb cb;
+  void* user_data;
+  {
+    grpc_core::MutexLock lock(&op->mu);
+    op->done = true;
+    op->signature = std::move(signature);
+    impl = std::exchange(op->handshaker, nullptr);
+    cb = op->cb;
+    user_data = op->user_data;
+  }
+  if (impl == nullptr) return;
+  std::string error;
+  const unsigned char* bytes_to_send = nullptr;
+  size_t bytes_to_send_size = 0;
+  tsi_handshaker_result* handshaker_result = nullptr;
+  tsi_result status = ssl_handshaker_continue(
+      impl, ssl_handshaker_do_handshake(impl, &error),
+      impl->pending_received_bytes_size, impl->pending_bytes_written,
+      &bytes_to_send, &bytes_to_send_size, &handshaker_result, cb, user_data,
+      &error);
+  // Waiting for another signature, if ever.
+  if (status == TSI_ASYNC) return;
+  if (status != TSI_OK && status != TSI_INCOMPLETE_DATA) {
+    gpr_log(GPR_ERROR, "Handshake failed after private key signing: %s",
+            error.c_str());
+  }
+  cb(status, user_data, bytes_to_send, bytes_to_send_size, handshaker_result);
+}
+
+static enum ssl_private_key_result_t ssl_private_key_complete(
+    SSL* ssl, uint8_t* out, size_t* out_len, size_t max_out) {
+  tsi_ssl_handshaker* impl = static_cast<tsi_ssl_handshaker*>(
+      SSL_get_ex_data(ssl, g_ssl_ex_handshaker_index));
+  tsi_ssl_private_key_operation* op = impl->private_key_operation;
+  absl::StatusOr<std::string> signature;
+  {
+    grpc_core::MutexLock lock(&op->mu);
+    if (!op->done) return ssl_private_key_retry;
+    signature = std::move(op->signature);
+  }
+  impl->private_key_operation = nullptr;
+  op->Unref();
+  if (!signature.ok()) {
+    gpr_log(GPR_ERROR, "Private key signing failed: %s",
+            signature.status().ToString().c_str());
+    return ssl_private_key_failure;
+  }
+  if (signature->size() > max_out) {
+    gpr_log(GPR_ERROR,
+            "Private key signer returned %" PRIuPTR
+            " bytes, more than the %" PRIuPTR " a signature can have.",
+            signature->size(), max_out);
+    return ssl_private_key_failure;
+  }
+  memcpy(out, signature->data(), signature->size());
+  *out_len = signature->size();
+  return ssl_private_key_success;
+}
+
+static enum ssl_private_key_result_t ssl_private_key_sign(
+    SSL* ssl, uint8_t* out, size_t* out_len, size_t max_out,
+    uint16_t signature_algorithm, const uint8_t* in, size_t in_len) {
+  tsi_ssl_handshaker* impl = static_cast<tsi_ssl_handshaker*>(
+      SSL_get_ex_data(ssl, g_ssl_ex_handshaker_index));
+  tsi_ssl_server_handshaker_factory* factory =
+      reinterpret_cast<tsi_ssl_server_handshaker_factory*>(impl->factory_ref);
+  GPR_ASSERT(impl->private_key_operation == nullptr);
+  impl->private_key_operation =
+      grpc_core::MakeRefCounted<tsi_ssl_private_key_operation>().release();
+  factory->private_key_signer->Sign(
+      absl::string_view(reinterpret_cast<const char*>(in), in_len),
+      signature_algorithm,
+      [op = impl->private_key_operation->Ref()](
+          absl::StatusOr<std::string> signature) {
+        ssl_private_key_operation_done(op.get(), std::move(signature));
+      });
+  // The signer may have called back already.
+  return ssl_private_key_complete(ssl, out, out_len, max_out);
+}
+
+static enum ssl_private_key_result_t ssl_private_key_decrypt(
+    SSL* /*ssl*/, uint8_t* /*out*/, size_t* /*out_len*/, size_t /*max_out*/,
+    const uint8_t* /*in*/, size_t /*in_len*/) {
+  gpr_log(GPR_ERROR,
+          "RSA key exchange cannot be used with a private key signer.");
+  return ssl_private_key_failure;
+}
+
+static const SSL_PRIVATE_KEY_METHOD kSslPrivateKeyMethod = {
+    ssl_private_key_sign,
+    ssl_private_key_decrypt,
+    ssl_private_key_complete,
+};
+#endif
+
 static const tsi_handshaker_vtable handshaker_vtable = {
     nullptr,  // get_bytes_to_send_to_peer -- deprecated
     nullptr,  // process_bytes_from_peer   -- deprecated
@@ -1599,7 +2159,7 @@ static const tsi_handshaker_vtable handshaker_vtable = {
 // --- tsi_ssl_handshaker_factory common methods. ---
 
 static void tsi_ssl_handshaker_resume_session(
-    SSL* ssl, tsi::SslSessionLRUCache* session_cache) {
+    SSL* ssl, tsi::SslSessionLRUCache* session_cache, bool enable_early_data) {
   const char* server_name = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
   if (server_name == nullptr) {
     return;
@@ -1608,6 +2168,17 @@ static void tsi_ssl_handshaker_resume_session(
   if (session != nullptr) {
     // SSL_set_session internally increments reference counter.
     SSL_set_session(ssl, session.get());
+#ifdef TSI_SSL_EARLY_DATA
+    // A session resumed with early data is only used once, so that a server
+    // rejecting the reuse of a ClientHello's ticket as a replay does not
+    // reject the connections that the same session would be resumed on
+    // concurrently. The server sends new sessions after the handshake.
+    if (enable_early_data && SSL_SESSION_early_data_capable(session.get())) {
+      session_cache->Erase(server_name);
+    }
+#else
+    (void)enable_early_data;
+#endif
   }
 }
 
@@ -1654,11 +2225,19 @@ static tsi_result create_tsi_ssl_handshaker(SSL_CTX* ctx, int is_client,
         reinterpret_cast<tsi_ssl_client_handshaker_factory*>(factory);
     if (client_factory->session_cache != nullptr) {
       tsi_ssl_handshaker_resume_session(ssl,
-                                        client_factory->session_cache.get());
+                                        client_factory->session_cache.get(),
+                                        client_factory->enable_early_data);
     }
     ERR_clear_error();
     ssl_result = SSL_do_handshake(ssl);
     ssl_result = SSL_get_error(ssl, ssl_result);
+#ifdef TSI_SSL_EARLY_DATA
+    // With early data, the ClientHello is all that is to be sent before the
+    // client may write.
+    if (ssl_result == SSL_ERROR_NONE && SSL_in_early_data(ssl)) {
+      ssl_result = SSL_ERROR_WANT_READ;
+    }
+#endif
     if (ssl_result != SSL_ERROR_WANT_READ) {
       gpr_log(GPR_ERROR,
               "Unexpected error received from first SSL_do_handshake call: %s",
@@ -1681,6 +2260,9 @@ static tsi_result create_tsi_ssl_handshaker(SSL_CTX* ctx, int is_client,
       static_cast<unsigned char*>(gpr_zalloc(impl->outgoing_bytes_buffer_size));
   impl->base.vtable = &handshaker_vtable;
   impl->factory_ref = tsi_ssl_handshaker_factory_ref(factory);
+#ifdef TSI_SSL_PRIVATE_KEY_OFFLOAD
+  SSL_set_ex_data(ssl, g_ssl_ex_handshaker_index, impl);
+#endif
   *handshaker = &impl->base;
   return TSI_OK;
 }
@@ -1789,6 +2371,9 @@ static void tsi_ssl_server_handshaker_factory_destroy(
   }
   if (self->alpn_protocol_list != nullptr) gpr_free(self->alpn_protocol_list);
   self->key_logger.reset();
+  self->session_ticket_key_ring.reset();
+  self->private_key_signer.reset();
+  self->early_data_anti_replay.reset();
   gpr_free(self);
 }
 
@@ -1912,6 +2497,128 @@ static void ssl_keylogging_callback(const SSL* ssl, const char* info) {
   factory->key_logger->LogSessionKeys(ssl_context, info);
 }
 
+#ifdef TSI_SSL_KERNEL_TLS
+// Keeps the application traffic secrets of a server session for
+// ssl_handshaker_result_enable_kernel_tls(). Keylog lines look like
+// "<label> <client random> <secret>", both values in hex.
+static void kernel_tls_record_secret(SSL* ssl, absl::string_view line) {
+  std::string tsi_ssl_kernel_tls_secrets::*secret;
+  if (absl::StartsWith(line, "CLIENT_TRAFFIC_SECRET_0 ")) {
+    secret = &tsi_ssl_kernel_tls_secrets::client_traffic_secret;
+  } else if (absl::StartsWith(line, "SERVER_TRAFFIC_SECRET_0 ")) {
+    secret = &tsi_ssl_kernel_tls_secrets::server_traffic_secret;
+  } else {
+    return;
+  }
+  tsi_ssl_kernel_tls_secrets* secrets =
+      static_cast<tsi_ssl_kernel_tls_secrets*>(
+          SSL_get_ex_data(ssl, g_ssl_ex_kernel_tls_secrets_index));
+  if (secrets == nullptr) {
+    secrets = new tsi_ssl_kernel_tls_secrets();
+    SSL_set_ex_data(ssl, g_ssl_ex_kernel_tls_secrets_index, secrets);
+  }
+  secrets->*secret = absl::HexStringToBytes(line.substr(line.rfind(' ') + 1));
+}
+#endif  // TSI_SSL_KERNEL_TLS
+
+#if OPENSSL_VERSION_NUMBER >= 0x10101000 && !defined(LIBRESSL_VERSION_NUMBER)
+/// This callback is invoked at the server when ssl/tls handshakes complete and
+/// either keylogging or kernel TLS is enabled.
+static void ssl_server_keylogging_callback(const SSL* ssl, const char* info) {
+  SSL_CTX* ssl_context = SSL_get_SSL_CTX(ssl);
+  GPR_ASSERT(ssl_context != nullptr);
+  tsi_ssl_server_handshaker_factory* factory =
+      static_cast<tsi_ssl_server_handshaker_factory*>(
+          SSL_CTX_get_ex_data(ssl_context, g_ssl_ctx_ex_factory_index));
+#ifdef TSI_SSL_KERNEL_TLS
+  if (factory->enable_kernel_tls) {
+    kernel_tls_record_secret(const_cast<SSL*>(ssl), info);
+  }
+#endif
+  if (factory->key_logger != nullptr) {
+    factory->key_logger->LogSessionKeys(ssl_context, info);
+  }
+}
+#endif
+
+/// This callback is invoked at the server to encrypt (enc == 1) or decrypt
+/// (enc == 0) a session ticket with the keys of the factory's session ticket
+/// key ring. Tickets are protected with AES-256-CBC and HMAC-SHA256, as
+/// OpenSSL does with its built-in keys.
+static int server_handshaker_factory_session_ticket_key_callback(
+    SSL* ssl, unsigned char* key_name, unsigned char* iv,
+    EVP_CIPHER_CTX* cipher_ctx, HMAC_CTX* hmac_ctx, int enc) {
+  tsi_ssl_server_handshaker_factory* factory =
+      static_cast<tsi_ssl_server_handshaker_factory*>(SSL_CTX_get_ex_data(
+          SSL_get_SSL_CTX(ssl), g_ssl_ctx_ex_factory_index));
+  tsi::SslSessionTicketKeyRing::Key key;
+  int result = -1;
+  if (enc) {
+    // Without a key, the server simply does not issue a ticket.
+    if (!factory->session_ticket_key_ring->GetEncryptionKey(&key)) return 0;
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1) {
+      OPENSSL_cleanse(&key, sizeof(key));
+      return -1;
+    }
+    memcpy(key_name, key.name, sizeof(key.name));
+    result = 1;
+  } else {
+    switch (
+        factory->session_ticket_key_ring->GetDecryptionKey(key_name, &key)) {
+      case tsi::SslSessionTicketKeyRing::DecryptionKey::kNotFound:
+        // Falls back to a full handshake.
+        return 0;
+      case tsi::SslSessionTicketKeyRing::DecryptionKey::kCurrent:
+        result = 1;
+        break;
+      case tsi::SslSessionTicketKeyRing::DecryptionKey::kPrevious:
+        // Still accepted, but the client gets a ticket under the current key.
+        result = 2;
+        break;
+    }
+  }
+  if (EVP_CipherInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.aes_key,
+                        iv, enc) != 1 ||
+      HMAC_Init_ex(hmac_ctx, key.hmac_key, sizeof(key.hmac_key), EVP_sha256(),
+                   nullptr) != 1) {
+    result = -1;
+  }
+  OPENSSL_cleanse(&key, sizeof(key));
+  return result;
+}
+
+#ifdef TSI_SSL_EARLY_DATA
+// Rejects the early data of ClientHellos that were seen before, which a
+// replay by an attacker would be. It runs before the server looks at the
+// session the client resumes, which is when early data is accepted.
+static enum ssl_select_cert_result_t
+server_handshaker_factory_select_certificate_callback(
+    const SSL_CLIENT_HELLO* client_hello) {
+  const uint8_t* psk_extension;
+  size_t psk_extension_size;
+  const uint8_t* early_data_extension;
+  size_t early_data_extension_size;
+  // Only ClientHellos that come with early data need to be remembered.
+  if (!SSL_early_callback_ctx_extension_get(
+          client_hello, TLSEXT_TYPE_early_data, &early_data_extension,
+          &early_data_extension_size) ||
+      !SSL_early_callback_ctx_extension_get(
+          client_hello, TLSEXT_TYPE_pre_shared_key, &psk_extension,
+          &psk_extension_size)) {
+    return ssl_select_cert_success;
+  }
+  tsi_ssl_server_handshaker_factory* factory =
+      static_cast<tsi_ssl_server_handshaker_factory*>(SSL_CTX_get_ex_data(
+          SSL_get_SSL_CTX(client_hello->ssl), g_ssl_ctx_ex_factory_index));
+  if (!factory->early_data_anti_replay->AcceptEarlyData(absl::string_view(
+          reinterpret_cast<const char*>(psk_extension), psk_extension_size))) {
+    // The handshake goes on, taking a round trip as without early data.
+    SSL_set_early_data_enabled(client_hello->ssl, 0);
+  }
+  return ssl_select_cert_success;
+}
+#endif
+
 // --- tsi_ssl_handshaker_factory constructors. ---
 
 static tsi_ssl_handshaker_factory_vtable client_handshaker_factory_vtable = {
@@ -1975,6 +2682,13 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
     SSL_CTX_sess_set_new_cb(ssl_context,
                             server_handshaker_factory_new_session_callback);
     SSL_CTX_set_session_cache_mode(ssl_context, SSL_SESS_CACHE_CLIENT);
+#ifdef TSI_SSL_EARLY_DATA
+    // Only resumed sessions can carry early data.
+    if (options->enable_early_data) {
+      impl->enable_early_data = true;
+      SSL_CTX_set_early_data_enabled(ssl_context, 1);
+    }
+#endif
   }
 
 #if OPENSSL_VERSION_NUMBER >= 0x10101000 && !defined(LIBRESSL_VERSION_NUMBER)
@@ -2119,6 +2833,12 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
       options->pem_key_cert_pairs == nullptr) {
     return TSI_INVALID_ARGUMENT;
   }
+#ifndef TSI_SSL_PRIVATE_KEY_OFFLOAD
+  if (options->private_key_signer != nullptr) {
+    gpr_log(GPR_ERROR, "Private key signers are only supported by BoringSSL.");
+    return TSI_UNIMPLEMENTED;
+  }
+#endif
 
   impl = static_cast<tsi_ssl_server_handshaker_factory*>(
       gpr_zalloc(sizeof(*impl)));
@@ -2149,6 +2869,23 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
   if (options->key_logger != nullptr) {
     impl->key_logger = options->key_logger->Ref();
   }
+#ifdef TSI_SSL_KERNEL_TLS
+  impl->enable_kernel_tls = options->enable_kernel_tls;
+#endif
+  if (options->session_ticket_key_ring != nullptr) {
+    impl->session_ticket_key_ring = options->session_ticket_key_ring->Ref();
+  }
+  if (options->private_key_signer != nullptr) {
+    impl->private_key_signer = options->private_key_signer->Ref();
+  }
+#ifdef TSI_SSL_EARLY_DATA
+  if (options->enable_early_data &&
+      options->early_data_anti_replay_capacity > 0) {
+    impl->early_data_anti_replay =
+        grpc_core::MakeRefCounted<tsi::SslEarlyDataAntiReplay>(
+            options->early_data_anti_replay_capacity);
+  }
+#endif
 
   for (i = 0; i < options->num_key_cert_pairs; i++) {
     do {
@@ -2173,6 +2910,12 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
                                     &options->pem_key_cert_pairs[i],
                                     options->cipher_suites);
       if (result != TSI_OK) break;
+#ifdef TSI_SSL_PRIVATE_KEY_OFFLOAD
+      if (impl->private_key_signer != nullptr) {
+        SSL_CTX_set_private_key_method(impl->ssl_contexts[i],
+                                       &kSslPrivateKeyMethod);
+      }
+#endif
 
       // TODO(elessar): Provide ability to disable session ticket keys.
 
@@ -2186,7 +2929,13 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
         break;
       }
 
-      if (options->session_ticket_key != nullptr) {
+      if (impl->session_ticket_key_ring != nullptr) {
+        SSL_CTX_set_ex_data(impl->ssl_contexts[i], g_ssl_ctx_ex_factory_index,
+                            impl);
+        SSL_CTX_set_tlsext_ticket_key_cb(
+            impl->ssl_contexts[i],
+            server_handshaker_factory_session_ticket_key_callback);
+      } else if (options->session_ticket_key != nullptr) {
         if (SSL_CTX_set_tlsext_ticket_keys(
                 impl->ssl_contexts[i],
                 const_cast<char*>(options->session_ticket_key),
@@ -2269,15 +3018,33 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
 
 #if OPENSSL_VERSION_NUMBER >= 0x10101000 && !defined(LIBRESSL_VERSION_NUMBER)
       // Register factory at index
-      if (options->key_logger != nullptr) {
+      if (options->key_logger != nullptr || impl->enable_kernel_tls) {
         // Need to set factory at g_ssl_ctx_ex_factory_index
         SSL_CTX_set_ex_data(impl->ssl_contexts[i], g_ssl_ctx_ex_factory_index,
                             impl);
         // SSL_CTX_set_keylog_callback is set here to register callback
         // when ssl/tls handshakes complete.
-        SSL_CTX_set_keylog_callback(
-            impl->ssl_contexts[i],
-            ssl_keylogging_callback<tsi_ssl_server_handshaker_factory>);
+        SSL_CTX_set_keylog_callback(impl->ssl_contexts[i],
+                                    ssl_server_keylogging_callback);
+      }
+#endif
+#ifdef TSI_SSL_KERNEL_TLS
+      // The kernel has to start from the first record protected with the
+      // application keys, which session tickets would otherwise be.
+      if (impl->enable_kernel_tls) {
+        SSL_CTX_set_num_tickets(impl->ssl_contexts[i], 0);
+      }
+#endif
+#ifdef TSI_SSL_EARLY_DATA
+      if (options->enable_early_data) {
+        SSL_CTX_set_early_data_enabled(impl->ssl_contexts[i], 1);
+        if (impl->early_data_anti_replay != nullptr) {
+          SSL_CTX_set_ex_data(impl->ssl_contexts[i],
+                              g_ssl_ctx_ex_factory_index, impl);
+          SSL_CTX_set_select_certificate_cb(
+              impl->ssl_contexts[i],
+              server_handshaker_factory_select_certificate_callback);
+        }
       }
 #endif
     } while (false);
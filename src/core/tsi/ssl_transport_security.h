@@ -28,6 +28,8 @@
 #include <grpc/grpc_security_constants.h>
 
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
+#include "src/core/tsi/ssl/private_key_signer/ssl_private_key_signer.h"
+#include "src/core/tsi/ssl/session_ticket/ssl_session_ticket_key_ring.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/transport_security_interface.h"
 
@@ -182,6 +184,15 @@ struct tsi_ssl_client_handshaker_options {
   // > 1.1 is supported for CRL checking
   const char* crl_directory;
 
+  // Whether TLS 1.3 sessions resumed from session_cache send what is written
+  // before the server answers as 0-RTT early data, saving the round trip of
+  // the handshake. Early data may be replayed by an attacker, so this shall
+  // only be set when everything sent on the connection is safe to be
+  // processed more than once. A session is only resumed with early data once.
+  // If the server rejects the early data, the connection fails. Only
+  // supported with BoringSSL, ignored otherwise.
+  bool enable_early_data;
+
   tsi_ssl_client_handshaker_options()
       : pem_key_cert_pair(nullptr),
         pem_root_certs(nullptr),
@@ -194,7 +205,8 @@ struct tsi_ssl_client_handshaker_options {
         skip_server_certificate_verification(false),
         min_tls_version(tsi_tls_version::TSI_TLS1_2),
         max_tls_version(tsi_tls_version::TSI_TLS1_3),
-        crl_directory(nullptr) {}
+        crl_directory(nullptr),
+        enable_early_data(false) {}
 };
 
 // Creates a client handshaker factory.
@@ -313,6 +325,10 @@ struct tsi_ssl_server_handshaker_options {
   const char* session_ticket_key;
   // session_ticket_key_size is a size of session ticket encryption key.
   size_t session_ticket_key_size;
+  // session_ticket_key_ring, if not NULL, supplies the session ticket keys,
+  // which may be rotated and shared with other servers, in place of
+  // session_ticket_key. The factory takes a ref to it.
+  tsi::SslSessionTicketKeyRing* session_ticket_key_ring;
   // The min and max TLS versions that will be negotiated by the handshaker.
   tsi_tls_version min_tls_version;
   tsi_tls_version max_tls_version;
@@ -325,6 +341,29 @@ struct tsi_ssl_server_handshaker_options {
   // crl checking. Only OpenSSL version > 1.1 is supported for CRL checking
   const char* crl_directory;
 
+  // Whether TLS 1.3 sessions may hand their record protection over to the
+  // kernel (kTLS) once the handshake completes, see
+  // tsi_handshaker_result_enable_kernel_tls(). Setting this disables TLS 1.3
+  // session tickets, since the kernel must start from the first record
+  // protected with the application traffic keys.
+  bool enable_kernel_tls;
+
+  // private_key_signer, if not NULL, signs the handshakes in place of the
+  // private keys of pem_key_cert_pairs, which may then be NULL. The
+  // handshake waits for the signer without blocking a thread: next() returns
+  // TSI_ASYNC and calls back once the signature is there. The factory takes
+  // a ref to it. Only supported with BoringSSL.
+  tsi::SslPrivateKeySigner* private_key_signer;
+
+  // Whether clients resuming TLS 1.3 sessions may send 0-RTT early data,
+  // which is handed on before the handshake completes.
+  // early_data_anti_replay_capacity is how many ClientHellos are remembered
+  // to reject the early data of replayed ones, see tsi::SslEarlyDataAntiReplay.
+  // 0 does not detect replays. Only supported with BoringSSL, ignored
+  // otherwise.
+  bool enable_early_data;
+  size_t early_data_anti_replay_capacity;
+
   tsi_ssl_server_handshaker_options()
       : pem_key_cert_pairs(nullptr),
         num_key_cert_pairs(0),
@@ -335,10 +374,15 @@ struct tsi_ssl_server_handshaker_options {
         num_alpn_protocols(0),
         session_ticket_key(nullptr),
         session_ticket_key_size(0),
+        session_ticket_key_ring(nullptr),
         min_tls_version(tsi_tls_version::TSI_TLS1_2),
         max_tls_version(tsi_tls_version::TSI_TLS1_3),
         key_logger(nullptr),
-        crl_directory(nullptr) {}
+        crl_directory(nullptr),
+        enable_kernel_tls(false),
+        private_key_signer(nullptr),
+        enable_early_data(false),
+        early_data_anti_replay_capacity(0) {}
 };
 
 // Creates a server handshaker factory.
@@ -48,6 +48,10 @@ const char* SslErrorString(int error) {
       return "SSL_ERROR_SYSCALL";
     case SSL_ERROR_SSL:
       return "SSL_ERROR_SSL";
+#ifdef OPENSSL_IS_BORINGSSL
+    case SSL_ERROR_EARLY_DATA_REJECTED:
+      return "SSL_ERROR_EARLY_DATA_REJECTED";
+#endif
     default:
       return "Unknown error";
   }
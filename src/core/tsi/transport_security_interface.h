@@ -279,6 +279,16 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
     const tsi_handshaker_result* self, const unsigned char** bytes,
     size_t* bytes_size);
 
+// This method hands the protection of records over to the kernel TLS (kTLS)
+// layer of the socket fd that the handshake took place on. On TSI_OK, reads
+// from and writes to fd carry plaintext from then on, and the unused bytes
+// returned by tsi_handshaker_result_get_unused_bytes() are plaintext too. It
+// returns TSI_UNIMPLEMENTED, with fd left untouched, if the handshaker result
+// does not support kernel TLS for the negotiated session; the caller is then
+// expected to create a frame protector as usual.
+tsi_result tsi_handshaker_result_enable_kernel_tls(tsi_handshaker_result* self,
+                                                   int fd);
+
 // This method releases the tsi_handshaker_handshaker object. After this method
 // is called, no other method can be called on the object.
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self);
@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -41,6 +42,7 @@
 #include <grpcpp/support/slice.h>
 
 #include "src/core/lib/iomgr/iomgr.h"
+#include "src/core/lib/surface/call.h"
 
 namespace grpc {
 
@@ -99,6 +101,27 @@ std::string Channel::GetServiceConfigJSON() const {
                              &channel_info.service_config_json);
 }
 
+void Channel::StartUnaryBatch(const std::function<void()>& start_calls) {
+  grpc_core::CallBatchScope batch;
+  start_calls();
+}
+
+void Channel::StartUnaryCall(void (*start)(void* arg), void* arg) {
+  // Interceptors run while the call's batch is started, and may block (e.g.
+  // on a call of their own), which a CallBatchScope does not allow.  Within
+  // a StartUnaryBatch() the call simply joins that batch.
+  if (!interceptor_creators_.empty() ||
+      grpc::internal::g_global_client_interceptor_factory != nullptr ||
+      grpc_core::CallBatchScope::Active()) {
+    start(arg);
+    return;
+  }
+  // Creating the call and starting its batch then share one ExecCtx, instead
+  // of each flushing its own.
+  grpc_core::CallBatchScope batch;
+  start(arg);
+}
+
 namespace experimental {
 
 void ChannelResetConnectionBackoff(Channel* channel) {
@@ -211,6 +234,17 @@ bool Channel::WaitForStateChangeImpl(grpc_connectivity_state last_observed,
   return ok;
 }
 
+bool Channel::WaitForWarmImpl(gpr_timespec deadline, double fraction) {
+  grpc::CompletionQueue cq;
+  bool ok = false;
+  void* tag = nullptr;
+  grpc_channel_watch_warm(c_channel_, fraction, deadline, cq.cq(),
+                          new TagSaver(nullptr));
+  cq.Next(&tag, &ok);
+  GPR_ASSERT(tag == nullptr);
+  return ok;
+}
+
 namespace {
 class ShutdownCallback : public grpc_completion_queue_functor {
  public:
@@ -166,6 +166,11 @@ void ClientContext::TryCancel() {
 void ClientContext::SendCancelToInterceptors() {
   internal::CancelInterceptorBatchMethods cancel_methods;
   for (size_t i = 0; i < rpc_info_.interceptors_.size(); i++) {
+    if ((rpc_info_.hook_masks_[i] &
+         experimental::InterceptionHookBit(
+             experimental::InterceptionHookPoints::PRE_SEND_CANCEL)) == 0) {
+      continue;
+    }
     rpc_info_.RunInterceptor(&cancel_methods, i);
   }
 }
@@ -0,0 +1,47 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/support/port_platform.h>
+
+#include <functional>
+#include <utility>
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpcpp/support/callback_common.h>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/surface/call.h"
+
+namespace grpc {
+namespace internal {
+
+void RunInBackground(std::function<void()> work) {
+  grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+      [work = std::move(work)]() {
+        grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+        grpc_core::ExecCtx exec_ctx;
+        work();
+      });
+}
+
+int64_t WritableBytesHint(grpc_call* call) {
+  return grpc_call_writable_bytes_hint(call);
+}
+
+}  // namespace internal
+}  // namespace grpc
@@ -22,14 +22,43 @@
 
 #include <grpc/grpc_security.h>
 #include <grpc/grpc_security_constants.h>
+#include <grpc/status.h>
 #include <grpc/support/log.h>
 #include <grpcpp/security/tls_certificate_provider.h>
 #include <grpcpp/security/tls_certificate_verifier.h>
 #include <grpcpp/security/tls_credentials_options.h>
+#include <grpcpp/security/tls_private_key_signer.h>
+#include <grpcpp/security/tls_session_ticket_key_provider.h>
+#include <grpcpp/support/status.h>
 
 namespace grpc {
 namespace experimental {
 
+namespace {
+
+void PrivateKeySignerSign(void* user_data, const unsigned char* data,
+                          size_t data_size, uint16_t signature_algorithm,
+                          grpc_tls_on_private_key_sign_done_cb callback,
+                          void* callback_arg) {
+  auto* signer = static_cast<std::shared_ptr<PrivateKeySigner>*>(user_data);
+  (*signer)->Sign(
+      std::string(reinterpret_cast<const char*>(data), data_size),
+      static_cast<PrivateKeySigner::SignatureAlgorithm>(signature_algorithm),
+      [callback, callback_arg](grpc::Status status, std::string signature) {
+        callback(callback_arg,
+                 static_cast<grpc_status_code>(status.error_code()),
+                 status.error_message().c_str(),
+                 reinterpret_cast<const unsigned char*>(signature.data()),
+                 signature.size());
+      });
+}
+
+void PrivateKeySignerDestruct(void* user_data) {
+  delete static_cast<std::shared_ptr<PrivateKeySigner>*>(user_data);
+}
+
+}  // namespace
+
 TlsCredentialsOptions::TlsCredentialsOptions() {
   c_credentials_options_ = grpc_tls_credentials_options_create();
 }
@@ -69,6 +98,11 @@ void TlsCredentialsOptions::set_crl_directory(const std::string& path) {
                                                  path.c_str());
 }
 
+void TlsCredentialsOptions::set_early_data(bool early_data) {
+  grpc_tls_credentials_options_set_early_data(c_credentials_options_,
+                                              early_data);
+}
+
 void TlsCredentialsOptions::set_tls_session_key_log_file_path(
     const std::string& tls_session_key_log_file_path) {
   grpc_tls_credentials_options_set_tls_session_key_log_file_path(
@@ -98,6 +132,14 @@ void TlsChannelCredentialsOptions::set_verify_server_certs(
                                                       verify_server_certs);
 }
 
+void TlsChannelCredentialsOptions::set_verified_peer_cache_size(
+    size_t verified_peer_cache_size) {
+  grpc_tls_credentials_options* options = c_credentials_options();
+  GPR_ASSERT(options != nullptr);
+  grpc_tls_credentials_options_set_verified_peer_cache_size(
+      options, verified_peer_cache_size);
+}
+
 void TlsServerCredentialsOptions::set_cert_request_type(
     grpc_ssl_client_certificate_request_type cert_request_type) {
   grpc_tls_credentials_options* options = c_credentials_options();
@@ -106,5 +148,36 @@ void TlsServerCredentialsOptions::set_cert_request_type(
                                                      cert_request_type);
 }
 
+void TlsServerCredentialsOptions::set_session_ticket_key_provider(
+    std::shared_ptr<SessionTicketKeyProviderInterface>
+        session_ticket_key_provider) {
+  session_ticket_key_provider_ = std::move(session_ticket_key_provider);
+  if (session_ticket_key_provider_ != nullptr) {
+    grpc_tls_credentials_options_set_session_ticket_key_provider(
+        c_credentials_options(), session_ticket_key_provider_->c_provider());
+  }
+}
+
+void TlsServerCredentialsOptions::set_private_key_signer(
+    std::shared_ptr<PrivateKeySigner> private_key_signer) {
+  if (private_key_signer == nullptr) return;
+  grpc_tls_private_key_signer_external external_signer;
+  external_signer.user_data =
+      new std::shared_ptr<PrivateKeySigner>(std::move(private_key_signer));
+  external_signer.sign = PrivateKeySignerSign;
+  external_signer.destruct = PrivateKeySignerDestruct;
+  grpc_tls_private_key_signer* c_signer =
+      grpc_tls_private_key_signer_external_create(&external_signer);
+  grpc_tls_credentials_options_set_private_key_signer(c_credentials_options(),
+                                                      c_signer);
+  grpc_tls_private_key_signer_release(c_signer);
+}
+
+void TlsServerCredentialsOptions::set_early_data_anti_replay_capacity(
+    size_t early_data_anti_replay_capacity) {
+  grpc_tls_credentials_options_set_early_data_anti_replay_capacity(
+      c_credentials_options(), early_data_anti_replay_capacity);
+}
+
 }  // namespace experimental
 }  // namespace grpc
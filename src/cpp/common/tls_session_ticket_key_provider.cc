@@ -0,0 +1,50 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+
+#include <grpc/grpc_security.h>
+#include <grpc/support/log.h>
+#include <grpcpp/security/tls_session_ticket_key_provider.h>
+
+namespace grpc {
+namespace experimental {
+
+InMemorySessionTicketKeyProvider::InMemorySessionTicketKeyProvider() {
+  c_provider_ = grpc_tls_session_ticket_key_provider_in_memory_create();
+  GPR_ASSERT(c_provider_ != nullptr);
+}
+
+InMemorySessionTicketKeyProvider::~InMemorySessionTicketKeyProvider() {
+  grpc_tls_session_ticket_key_provider_release(c_provider_);
+}
+
+bool InMemorySessionTicketKeyProvider::SetKeys(const std::string& keys) {
+  return grpc_tls_session_ticket_key_provider_in_memory_set_keys(
+      c_provider_, keys.data(), keys.size());
+}
+
+FileWatcherSessionTicketKeyProvider::FileWatcherSessionTicketKeyProvider(
+    const std::string& key_file_path, unsigned int refresh_interval_sec) {
+  c_provider_ = grpc_tls_session_ticket_key_provider_file_watcher_create(
+      key_file_path.c_str(), refresh_interval_sec);
+  GPR_ASSERT(c_provider_ != nullptr);
+}
+
+FileWatcherSessionTicketKeyProvider::~FileWatcherSessionTicketKeyProvider() {
+  grpc_tls_session_ticket_key_provider_release(c_provider_);
+}
+
+}  // namespace experimental
+}  // namespace grpc
@@ -122,7 +122,8 @@ OpenCensusCallTracer::OpenCensusCallAttemptTracer::OpenCensusCallAttemptTracer(
       arena_allocated_(arena_allocated),
       context_(parent_->CreateCensusContextForCallAttempt()),
       start_time_(absl::Now()) {
-  if (OpenCensusTracingEnabled() && parent_->tracing_enabled_) {
+  if (OpenCensusTracingEnabled() && parent_->tracing_enabled_ &&
+      context_.Span().IsSampled()) {
     context_.AddSpanAttribute("previous-rpc-attempts", attempt_num);
     context_.AddSpanAttribute("transparent-retry", is_transparent_retry);
   }
@@ -192,28 +193,20 @@ void OpenCensusCallTracer::OpenCensusCallAttemptTracer::
     return;
   }
   if (OpenCensusStatsEnabled()) {
+    // Recorded together with the other per-attempt measures in RecordEnd().
     uint64_t elapsed_time = 0;
     FilterTrailingMetadata(recv_trailing_metadata, &elapsed_time);
-    std::vector<std::pair<opencensus::tags::TagKey, std::string>> tags =
-        context_.tags().tags();
-    tags.emplace_back(ClientMethodTagKey(), std::string(parent_->method_));
-    std::string final_status = absl::StatusCodeToString(status_code_);
-    tags.emplace_back(ClientStatusTagKey(), final_status);
-    ::opencensus::stats::Record(
-        {{RpcClientSentBytesPerRpc(),
-          static_cast<double>(transport_stream_stats->outgoing.data_bytes)},
-         {RpcClientReceivedBytesPerRpc(),
-          static_cast<double>(transport_stream_stats->incoming.data_bytes)},
-         {RpcClientServerLatency(),
-          ToDoubleMilliseconds(absl::Nanoseconds(elapsed_time))}},
-        tags);
+    has_trailing_stats_ = true;
+    sent_bytes_ =
+        static_cast<double>(transport_stream_stats->outgoing.data_bytes);
+    received_bytes_ =
+        static_cast<double>(transport_stream_stats->incoming.data_bytes);
+    server_latency_ms_ = ToDoubleMilliseconds(absl::Nanoseconds(elapsed_time));
     if (grpc_core::IsTransportSuppliesClientLatencyEnabled()) {
       if (gpr_time_cmp(transport_stream_stats->latency,
                        gpr_inf_future(GPR_TIMESPAN)) != 0) {
-        double latency_ms = absl::ToDoubleMilliseconds(absl::Microseconds(
+        transport_latency_ms_ = absl::ToDoubleMilliseconds(absl::Microseconds(
             gpr_timespec_to_micros(transport_stream_stats->latency)));
-        ::opencensus::stats::Record({{RpcClientTransportLatency(), latency_ms}},
-                                    tags);
       }
     }
   }
@@ -232,11 +225,28 @@ void OpenCensusCallTracer::OpenCensusCallAttemptTracer::RecordEnd(
         context_.tags().tags();
     tags.emplace_back(ClientMethodTagKey(), std::string(parent_->method_));
     tags.emplace_back(ClientStatusTagKey(), StatusCodeToString(status_code_));
-    ::opencensus::stats::Record(
-        {{RpcClientRoundtripLatency(), latency_ms},
-         {RpcClientSentMessagesPerRpc(), sent_message_count_},
-         {RpcClientReceivedMessagesPerRpc(), recv_message_count_}},
-        tags);
+    // Each Record() builds a tag map and takes the stats manager lock, so
+    // all the per-attempt measures share one.
+    if (has_trailing_stats_) {
+      ::opencensus::stats::Record(
+          {{RpcClientRoundtripLatency(), latency_ms},
+           {RpcClientSentMessagesPerRpc(), sent_message_count_},
+           {RpcClientReceivedMessagesPerRpc(), recv_message_count_},
+           {RpcClientSentBytesPerRpc(), sent_bytes_},
+           {RpcClientReceivedBytesPerRpc(), received_bytes_},
+           {RpcClientServerLatency(), server_latency_ms_}},
+          tags);
+    } else {
+      ::opencensus::stats::Record(
+          {{RpcClientRoundtripLatency(), latency_ms},
+           {RpcClientSentMessagesPerRpc(), sent_message_count_},
+           {RpcClientReceivedMessagesPerRpc(), recv_message_count_}},
+          tags);
+    }
+    if (transport_latency_ms_.has_value()) {
+      ::opencensus::stats::Record(
+          {{RpcClientTransportLatency(), *transport_latency_ms_}}, tags);
+    }
     grpc_core::MutexLock lock(&parent_->mu_);
     if (--parent_->num_active_rpcs_ == 0) {
       parent_->time_at_last_attempt_end_ = absl::Now();
@@ -345,8 +355,11 @@ CensusContext OpenCensusCallTracer::CreateCensusContextForCallAttempt() {
   GPR_DEBUG_ASSERT(context_.Context().IsValid());
   auto context = CensusContext(absl::StrCat("Attempt.", method_),
                                &(context_.Span()), context_.tags());
-  grpc::internal::OpenCensusRegistry::Get()
-      .PopulateCensusContextWithConstantAttributes(&context);
+  // Attributes of spans that are not sampled are dropped anyway.
+  if (context.Span().IsSampled()) {
+    grpc::internal::OpenCensusRegistry::Get()
+        .PopulateCensusContextWithConstantAttributes(&context);
+  }
   return context;
 }
 
@@ -27,6 +27,7 @@
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "absl/time/time.h"
+#include "absl/types/optional.h"
 
 #include <grpc/support/time.h>
 #include <grpcpp/opencensus.h>
@@ -98,6 +99,12 @@ class OpenCensusCallTracer : public grpc_core::CallTracer {
     uint64_t sent_message_count_ = 0;
     // End status code
     absl::StatusCode status_code_;
+    // Measures taken from the trailing metadata, recorded in RecordEnd().
+    bool has_trailing_stats_ = false;
+    double sent_bytes_ = 0;
+    double received_bytes_ = 0;
+    double server_latency_ms_ = 0;
+    absl::optional<double> transport_latency_ms_;
   };
 
   explicit OpenCensusCallTracer(grpc_call_context_element* call_context,
@@ -174,6 +174,8 @@ void EncodeMessageToPayload(const grpc_core::SliceBuffer* message,
                             uint32_t log_len, LoggingSink::Entry* entry) {
   auto* sb = message->c_slice_buffer();
   entry->payload.message_length = sb->length;
+  entry->payload.message.reserve(
+      std::min(sb->length, static_cast<size_t>(log_len)));
   // Log the message to a max of the configured message length
   for (size_t i = 0; i < sb->count; i++) {
     absl::StrAppend(
@@ -20,8 +20,11 @@
 
 #include "src/cpp/ext/gcp/observability_logging_sink.h"
 
+#include <inttypes.h>
+
 #include <algorithm>
 #include <initializer_list>
+#include <iterator>
 #include <map>
 #include <utility>
 
@@ -44,8 +47,10 @@
 #include <grpcpp/support/channel_arguments.h>
 #include <grpcpp/support/status.h>
 
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/json/json.h"
 #include "src/cpp/ext/filters/census/open_census_call_tracer.h"
 
@@ -56,7 +61,8 @@ ObservabilityLoggingSink::ObservabilityLoggingSink(
     GcpObservabilityConfig::CloudLogging logging_config, std::string project_id,
     std::map<std::string, std::string> labels)
     : project_id_(std::move(project_id)),
-      labels_(labels.begin(), labels.end()) {
+      labels_(labels.begin(), labels.end()),
+      event_engine_(grpc_event_engine::experimental::GetDefaultEventEngine()) {
   for (auto& client_rpc_event_config : logging_config.client_rpc_events) {
     client_configs_.emplace_back(client_rpc_event_config);
   }
@@ -72,6 +78,11 @@ ObservabilityLoggingSink::ObservabilityLoggingSink(
   }
 }
 
+ObservabilityLoggingSink::~ObservabilityLoggingSink() {
+  grpc_core::MutexLock lock(&mu_);
+  if (flush_timer_.has_value()) event_engine_->Cancel(*flush_timer_);
+}
+
 LoggingSink::Config ObservabilityLoggingSink::FindMatch(
     bool is_client, absl::string_view service, absl::string_view method) {
   const auto& configs = is_client ? client_configs_ : server_configs_;
@@ -97,6 +108,13 @@ LoggingSink::Config ObservabilityLoggingSink::FindMatch(
 
 namespace {
 
+// Entries are written in requests of up to kMaxBatchSize entries, at most
+// kFlushDelay after they were logged.
+constexpr size_t kMaxBatchSize = 100;
+constexpr grpc_core::Duration kFlushDelay = grpc_core::Duration::Seconds(1);
+// Beyond this many entries waiting to be written, new entries are dropped.
+constexpr size_t kMaxQueuedEntries = 10000;
+
 std::string EventTypeToString(LoggingSink::Entry::EventType type) {
   switch (type) {
     case LoggingSink::Entry::EventType::kClientHeader:
@@ -229,6 +247,49 @@ void EntryToJsonStructProto(LoggingSink::Entry entry,
 }
 
 void ObservabilityLoggingSink::LogEntry(Entry entry) {
+  gpr_timespec timestamp =
+      grpc_core::Timestamp::Now().as_timespec(GPR_CLOCK_REALTIME);
+  grpc_core::MutexLock lock(&mu_);
+  if (entries_.size() >= kMaxQueuedEntries) {
+    ++dropped_entries_;
+    return;
+  }
+  entries_.push_back(QueuedEntry{timestamp, std::move(entry)});
+  if (!flush_pending_) {
+    flush_pending_ = true;
+    flush_timer_ = event_engine_->RunAfter(kFlushDelay, [this] {
+      grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+      grpc_core::ExecCtx exec_ctx;
+      FlushEntries();
+    });
+  } else if (entries_.size() >= kMaxBatchSize && flush_timer_.has_value() &&
+             event_engine_->Cancel(*flush_timer_)) {
+    // A full batch is waiting: write it now rather than after the timer.
+    flush_timer_.reset();
+    event_engine_->Run([this] {
+      grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+      grpc_core::ExecCtx exec_ctx;
+      FlushEntries();
+    });
+  }
+}
+
+void ObservabilityLoggingSink::FlushEntries() {
+  std::vector<QueuedEntry> entries;
+  uint64_t dropped_entries;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    flush_pending_ = false;
+    flush_timer_.reset();
+    entries.swap(entries_);
+    dropped_entries = std::exchange(dropped_entries_, 0);
+  }
+  if (dropped_entries != 0) {
+    gpr_log(GPR_ERROR,
+            "GCP Observability Logging dropped %" PRIu64
+            " entries: too many entries waiting to be written",
+            dropped_entries);
+  }
   absl::call_once(once_, [this]() {
     std::string endpoint;
     absl::optional<std::string> endpoint_env =
@@ -248,14 +309,21 @@ void ObservabilityLoggingSink::LogEntry(Entry entry) {
     stub_ = google::logging::v2::LoggingServiceV2::NewStub(
         CreateCustomChannel(endpoint, GoogleDefaultCredentials(), args));
   });
+  for (size_t i = 0; i < entries.size(); i += kMaxBatchSize) {
+    const size_t end = std::min(entries.size(), i + kMaxBatchSize);
+    WriteEntries(std::vector<QueuedEntry>(
+        std::make_move_iterator(entries.begin() + i),
+        std::make_move_iterator(entries.begin() + end)));
+  }
+}
+
+void ObservabilityLoggingSink::WriteEntries(std::vector<QueuedEntry> entries) {
   struct CallContext {
     ClientContext context;
     google::logging::v2::WriteLogEntriesRequest request;
     google::logging::v2::WriteLogEntriesResponse response;
   };
-  // TODO(yashykt): Implement batching so that we can batch a bunch of log
-  // entries into a single entry. Also, set a reasonable deadline on the
-  // context, and actually use the entry.
+  // TODO(yashykt): Set a reasonable deadline on the context.
   CallContext* call = new CallContext;
   call->context.set_authority(authority_);
   call->request.set_log_name(
@@ -265,14 +333,14 @@ void ObservabilityLoggingSink::LogEntry(Entry entry) {
   (*call->request.mutable_labels()).insert(labels_.begin(), labels_.end());
   // TODO(yashykt): Figure out the proper resource type and labels.
   call->request.mutable_resource()->set_type("global");
-  auto* proto_entry = call->request.add_entries();
-  // Fill the current timestamp
-  gpr_timespec timespec =
-      grpc_core::Timestamp::Now().as_timespec(GPR_CLOCK_REALTIME);
-  proto_entry->mutable_timestamp()->set_seconds(timespec.tv_sec);
-  proto_entry->mutable_timestamp()->set_nanos(timespec.tv_nsec);
-  // TODO(yashykt): Check if we need to fill receive timestamp
-  EntryToJsonStructProto(std::move(entry), proto_entry->mutable_json_payload());
+  for (QueuedEntry& entry : entries) {
+    auto* proto_entry = call->request.add_entries();
+    proto_entry->mutable_timestamp()->set_seconds(entry.timestamp.tv_sec);
+    proto_entry->mutable_timestamp()->set_nanos(entry.timestamp.tv_nsec);
+    // TODO(yashykt): Check if we need to fill receive timestamp
+    EntryToJsonStructProto(std::move(entry.entry),
+                           proto_entry->mutable_json_payload());
+  }
   stub_->async()->WriteLogEntries(
       &(call->context), &(call->request), &(call->response),
       [call](Status status) {
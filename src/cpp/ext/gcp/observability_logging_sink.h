@@ -32,9 +32,15 @@
 #include <google/protobuf/struct.pb.h>
 
 #include "absl/base/call_once.h"
+#include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 #include "google/logging/v2/logging.grpc.pb.h"
 
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/gprpp/sync.h"
 #include "src/cpp/ext/filters/logging/logging_sink.h"
 #include "src/cpp/ext/gcp/observability_config.h"
 
@@ -42,13 +48,17 @@ namespace grpc {
 namespace internal {
 
 // Interface for a logging sink that will be used by the logging filter.
+// LogEntry() only queues the entry: queued entries are converted and written
+// to Cloud Logging in batches from an EventEngine thread, so RPCs never wait
+// on the logging service. When too many entries are waiting to be written,
+// new ones are dropped and counted instead.
 class ObservabilityLoggingSink : public LoggingSink {
  public:
   ObservabilityLoggingSink(GcpObservabilityConfig::CloudLogging logging_config,
                            std::string project_id,
                            std::map<std::string, std::string> labels);
 
-  ~ObservabilityLoggingSink() override = default;
+  ~ObservabilityLoggingSink() override;
 
   LoggingSink::Config FindMatch(bool is_client, absl::string_view service,
                                 absl::string_view method) override;
@@ -70,6 +80,14 @@ class ObservabilityLoggingSink : public LoggingSink {
     uint32_t max_message_bytes = 0;
   };
 
+  struct QueuedEntry {
+    gpr_timespec timestamp;
+    Entry entry;
+  };
+
+  void FlushEntries();
+  void WriteEntries(std::vector<QueuedEntry> entries);
+
   std::vector<Configuration> client_configs_;
   std::vector<Configuration> server_configs_;
   std::string project_id_;
@@ -77,6 +95,15 @@ class ObservabilityLoggingSink : public LoggingSink {
   std::vector<std::pair<std::string, std::string>> labels_;
   absl::once_flag once_;
   std::unique_ptr<google::logging::v2::LoggingServiceV2::StubInterface> stub_;
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
+  grpc_core::Mutex mu_;
+  std::vector<QueuedEntry> entries_ ABSL_GUARDED_BY(mu_);
+  // Whether a FlushEntries() is scheduled, either after the flush timer or
+  // right away.
+  bool flush_pending_ ABSL_GUARDED_BY(mu_) = false;
+  absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      flush_timer_ ABSL_GUARDED_BY(mu_);
+  uint64_t dropped_entries_ ABSL_GUARDED_BY(mu_) = 0;
 };
 
 // Exposed for just for testing purposes
@@ -18,6 +18,7 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
@@ -28,8 +29,10 @@
 #include <grpcpp/ext/call_metric_recorder.h>
 #include <grpcpp/ext/server_metric_recorder.h>
 
+#include "src/core/ext/filters/backend_metrics/backend_metric_filter.h"
 #include "src/core/ext/filters/client_channel/lb_policy/backend_metric_data.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/slice/slice.h"
 
 using grpc_core::BackendMetricData;
 
@@ -58,9 +61,12 @@ ServerMetricRecorder::ServerMetricRecorder()
 void ServerMetricRecorder::UpdateBackendMetricDataState(
     std::function<void(BackendMetricData*)> updater) {
   internal::MutexLock lock(&mu_);
-  auto new_state = std::make_shared<BackendMetricDataState>(*metric_state_);
+  auto new_state = std::make_shared<BackendMetricDataState>();
+  new_state->data = metric_state_->data;
   updater(&new_state->data);
-  ++new_state->sequence_number;
+  new_state->sequence_number = metric_state_->sequence_number + 1;
+  new_state->serialized =
+      grpc_core::SerializeBackendMetricData(new_state->data);
   metric_state_ = std::move(new_state);
 }
 
@@ -254,6 +260,7 @@ experimental::CallMetricRecorder& BackendMetricState::RecordUtilizationMetric(
   internal::MutexLock lock(&mu_);
   absl::string_view name_sv(name.data(), name.length());
   utilization_[name_sv] = value;
+  has_named_metrics_.store(true, std::memory_order_relaxed);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_backend_metric_trace)) {
     gpr_log(GPR_INFO, "[%p] Utilization recorded: %s %f", this,
             std::string(name_sv).c_str(), value);
@@ -266,6 +273,7 @@ experimental::CallMetricRecorder& BackendMetricState::RecordRequestCostMetric(
   internal::MutexLock lock(&mu_);
   absl::string_view name_sv(name.data(), name.length());
   request_cost_[name_sv] = value;
+  has_named_metrics_.store(true, std::memory_order_relaxed);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_backend_metric_trace)) {
     gpr_log(GPR_INFO, "[%p] Request cost recorded: %s %f", this,
             std::string(name_sv).c_str(), value);
@@ -308,4 +316,33 @@ BackendMetricData BackendMetricState::GetBackendMetricData() {
   return data;
 }
 
+absl::optional<grpc_core::Slice>
+BackendMetricState::GetSerializedBackendMetricData() {
+  if (IsUtilizationValid(cpu_utilization_.load(std::memory_order_relaxed)) ||
+      IsUtilizationValid(mem_utilization_.load(std::memory_order_relaxed)) ||
+      IsQpsValid(qps_.load(std::memory_order_relaxed)) ||
+      has_named_metrics_.load(std::memory_order_relaxed)) {
+    return absl::nullopt;
+  }
+  if (server_metric_recorder_ == nullptr) return grpc_core::Slice();
+  auto state = server_metric_recorder_->GetMetricsIfChanged();
+  // GetBackendMetricData() reports only the named utilization recorded to
+  // the call, so the serialized form does not apply when the server has any.
+  if (!state->data.utilization.empty()) return absl::nullopt;
+  return state->serialized.Ref();
+}
+
+absl::optional<double> ServerMetricRecorderLoadReporter::Utilization() {
+  grpc_core::BackendMetricData data = server_metric_recorder_->GetMetrics();
+  absl::optional<double> utilization;
+  auto add = [&utilization](double value) {
+    if (!IsUtilizationValid(value)) return;
+    utilization = std::max(utilization.value_or(0.0), value);
+  };
+  add(data.cpu_utilization);
+  add(data.mem_utilization);
+  for (const auto& named : data.utilization) add(named.second);
+  return utilization;
+}
+
 }  // namespace grpc
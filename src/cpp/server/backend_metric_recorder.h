@@ -26,6 +26,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 
 #include <grpcpp/ext/call_metric_recorder.h>
 #include <grpcpp/ext/server_metric_recorder.h>
@@ -34,6 +35,8 @@
 
 #include "src/core/ext/filters/backend_metrics/backend_metric_provider.h"
 #include "src/core/ext/filters/client_channel/lb_policy/backend_metric_data.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/surface/server_connection_rebalancer.h"
 
 namespace grpc {
 namespace experimental {
@@ -42,6 +45,9 @@ namespace experimental {
 struct ServerMetricRecorder::BackendMetricDataState {
   grpc_core::BackendMetricData data;
   uint64_t sequence_number = 0;
+  // `data` serialized as an OrcaLoadReport, built once per update and shared
+  // by every call and ORCA stream that reports it.
+  grpc_core::Slice serialized;
 };
 
 }  // namespace experimental
@@ -65,17 +71,38 @@ class BackendMetricState : public grpc_core::BackendMetricProvider,
       string_ref name, double value) override;
   // This clears metrics currently recorded. Don't call twice.
   grpc_core::BackendMetricData GetBackendMetricData() override;
+  // Returns the serialized metrics of `server_metric_recorder` when nothing
+  // was recorded to this.
+  absl::optional<grpc_core::Slice> GetSerializedBackendMetricData() override;
 
  private:
   experimental::ServerMetricRecorder* server_metric_recorder_;
   std::atomic<double> cpu_utilization_{-1.0};
   std::atomic<double> mem_utilization_{-1.0};
   std::atomic<double> qps_{-1.0};
+  // Set once a named metric is recorded.
+  std::atomic<bool> has_named_metrics_{false};
   internal::Mutex mu_;
   std::map<absl::string_view, double> utilization_ ABSL_GUARDED_BY(mu_);
   std::map<absl::string_view, double> request_cost_ ABSL_GUARDED_BY(mu_);
 };
 
+// Reports the utilization a server records to its ServerMetricRecorder, for
+// the server to shed connections by it.
+class ServerMetricRecorderLoadReporter : public grpc_core::ServerLoadReporter {
+ public:
+  // `server_metric_recorder` must outlive this.
+  explicit ServerMetricRecorderLoadReporter(
+      experimental::ServerMetricRecorder* server_metric_recorder)
+      : server_metric_recorder_(server_metric_recorder) {}
+
+  // The highest of the CPU, memory and named utilizations recorded.
+  absl::optional<double> Utilization() override;
+
+ private:
+  experimental::ServerMetricRecorder* const server_metric_recorder_;
+};
+
 }  // namespace grpc
 
 #endif  // GRPC_SRC_CPP_SERVER_BACKEND_METRIC_RECORDER_H
@@ -28,7 +28,6 @@
 #include "google/protobuf/duration.upb.h"
 #include "upb/upb.h"
 #include "upb/upb.hpp"
-#include "xds/data/orca/v3/orca_load_report.upb.h"
 #include "xds/service/orca/v3/orca.upb.h"
 
 #include <grpc/event_engine/event_engine.h>
@@ -186,39 +185,11 @@ OrcaService::OrcaService(ServerMetricRecorder* const server_metric_recorder,
 }
 
 Slice OrcaService::GetOrCreateSerializedResponse() {
-  grpc::internal::MutexLock lock(&mu_);
+  // The recorder serializes its metrics once per update, so every stream
+  // shares the same bytes.
   std::shared_ptr<const ServerMetricRecorder::BackendMetricDataState> result =
       server_metric_recorder_->GetMetricsIfChanged();
-  if (!response_slice_seq_.has_value() ||
-      *response_slice_seq_ != result->sequence_number) {
-    const auto& data = result->data;
-    upb::Arena arena;
-    xds_data_orca_v3_OrcaLoadReport* response =
-        xds_data_orca_v3_OrcaLoadReport_new(arena.ptr());
-    if (data.cpu_utilization != -1) {
-      xds_data_orca_v3_OrcaLoadReport_set_cpu_utilization(response,
-                                                          data.cpu_utilization);
-    }
-    if (data.mem_utilization != -1) {
-      xds_data_orca_v3_OrcaLoadReport_set_mem_utilization(response,
-                                                          data.mem_utilization);
-    }
-    if (data.qps != -1) {
-      xds_data_orca_v3_OrcaLoadReport_set_rps_fractional(response, data.qps);
-    }
-    for (const auto& u : data.utilization) {
-      xds_data_orca_v3_OrcaLoadReport_utilization_set(
-          response,
-          upb_StringView_FromDataAndSize(u.first.data(), u.first.size()),
-          u.second, arena.ptr());
-    }
-    size_t buf_length;
-    char* buf = xds_data_orca_v3_OrcaLoadReport_serialize(response, arena.ptr(),
-                                                          &buf_length);
-    response_slice_.emplace(buf, buf_length);
-    response_slice_seq_ = result->sequence_number;
-  }
-  return Slice(*response_slice_);
+  return Slice(result->serialized.c_slice(), Slice::ADD_REF);
 }
 
 }  // namespace experimental
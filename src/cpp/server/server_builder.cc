@@ -185,6 +185,9 @@ ServerBuilder& ServerBuilder::SetSyncServerOption(
     case CQ_TIMEOUT_MSEC:
       sync_server_settings_.cq_timeout_msec = val;
       break;
+    case MAX_HANDLERS:
+      sync_server_settings_.max_handlers = val;
+      break;
   }
   return *this;
 }
@@ -351,10 +354,11 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
     // This is a Sync server
     gpr_log(GPR_INFO,
             "Synchronous server. Num CQs: %d, Min pollers: %d, Max Pollers: "
-            "%d, CQ timeout (msec): %d",
+            "%d, CQ timeout (msec): %d, Max handlers: %d",
             sync_server_settings_.num_cqs, sync_server_settings_.min_pollers,
             sync_server_settings_.max_pollers,
-            sync_server_settings_.cq_timeout_msec);
+            sync_server_settings_.cq_timeout_msec,
+            sync_server_settings_.max_handlers);
   }
 
   if (has_callback_methods) {
@@ -365,7 +369,8 @@ std::unique_ptr<grpc::Server> ServerBuilder::BuildAndStart() {
       &args, sync_server_cqs, sync_server_settings_.min_pollers,
       sync_server_settings_.max_pollers, sync_server_settings_.cq_timeout_msec,
       std::move(acceptors_), server_config_fetcher_, resource_quota_,
-      std::move(interceptor_creators_), server_metric_recorder_));
+      std::move(interceptor_creators_), server_metric_recorder_,
+      sync_server_settings_.max_handlers));
 
   ServerInitializer* initializer = server->initializer();
 
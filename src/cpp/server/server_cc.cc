@@ -34,6 +34,7 @@
 #include <grpc/byte_buffer.h>
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
@@ -66,13 +67,17 @@
 #include <grpcpp/support/status.h>
 
 #include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/resource_quota/api.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/surface/server.h"
+#include "src/core/lib/surface/server_connection_rebalancer.h"
 #include "src/cpp/client/create_channel_internal.h"
+#include "src/cpp/server/backend_metric_recorder.h"
 #include "src/cpp/server/external_connection_acceptor_impl.h"
 #include "src/cpp/server/health/default_health_check_service.h"
 #include "src/cpp/thread_manager/thread_manager.h"
@@ -503,6 +508,7 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
     data->cq = cq_.cq();
   }
 
+  CallbackRequestPool* const pool_;
   Server* const server_;
   grpc::internal::RpcServiceMethod* const method_;
   const bool has_request_payload_;
@@ -531,6 +537,62 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
   grpc_core::ManualConstructor<internal::Call> wrapped_call_;
 };
 
+// Keeps the storage of finished CallbackRequests for the next ones, so that
+// a steady stream of callback calls does not go through the allocator for
+// each of them. Free blocks are kept in shards picked by the current CPU, to
+// keep the threads that finish calls from contending on one lock.
+class Server::CallbackRequestPool {
+ public:
+  explicit CallbackRequestPool(size_t block_size)
+      : block_size_(block_size),
+        num_shards_(std::max(1u, gpr_cpu_num_cores())),
+        shards_(new Shard[num_shards_]) {}
+
+  ~CallbackRequestPool() {
+    for (size_t i = 0; i < num_shards_; ++i) {
+      for (void* block : shards_[i].free_blocks) ::operator delete(block);
+    }
+  }
+
+  void* Get() {
+    Shard& shard = shards_[gpr_cpu_current_cpu() % num_shards_];
+    {
+      grpc::internal::MutexLock lock(&shard.mu);
+      if (!shard.free_blocks.empty()) {
+        void* block = shard.free_blocks.back();
+        shard.free_blocks.pop_back();
+        return block;
+      }
+    }
+    return ::operator new(block_size_);
+  }
+
+  void Put(void* block) {
+    Shard& shard = shards_[gpr_cpu_current_cpu() % num_shards_];
+    {
+      grpc::internal::MutexLock lock(&shard.mu);
+      if (shard.free_blocks.size() < kMaxFreeBlocksPerShard) {
+        shard.free_blocks.push_back(block);
+        return;
+      }
+    }
+    ::operator delete(block);
+  }
+
+ private:
+  // Bounds the memory held after a burst of calls.
+  static constexpr size_t kMaxFreeBlocksPerShard = 256;
+
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    grpc::internal::Mutex mu;
+    std::vector<void*> free_blocks;
+  };
+
+  const size_t block_size_;
+  const size_t num_shards_;
+  std::unique_ptr<Shard[]> shards_;
+};
+
 template <class ServerContextType>
 class Server::CallbackRequest final
     : public grpc::internal::CompletionQueueTag {
@@ -542,10 +604,12 @@ class Server::CallbackRequest final
   // For codegen services, the value of method represents the defined
   // characteristics of the method being requested. For generic services, method
   // is nullptr since these services don't have pre-defined methods.
-  CallbackRequest(Server* server, grpc::internal::RpcServiceMethod* method,
+  CallbackRequest(CallbackRequestPool* pool, Server* server,
+                  grpc::internal::RpcServiceMethod* method,
                   grpc::CompletionQueue* cq,
                   grpc_core::Server::RegisteredCallAllocation* data)
-      : server_(server),
+      : pool_(pool),
+        server_(server),
         method_(method),
         has_request_payload_(method->method_type() ==
                                  grpc::internal::RpcMethod::NORMAL_RPC ||
@@ -563,9 +627,11 @@ class Server::CallbackRequest final
 
   // For generic services, method is nullptr since these services don't have
   // pre-defined methods.
-  CallbackRequest(Server* server, grpc::CompletionQueue* cq,
+  CallbackRequest(CallbackRequestPool* pool, Server* server,
+                  grpc::CompletionQueue* cq,
                   grpc_core::Server::BatchCallAllocation* data)
-      : server_(server),
+      : pool_(pool),
+        server_(server),
         method_(nullptr),
         has_request_payload_(false),
         call_details_(new grpc_call_details),
@@ -589,7 +655,23 @@ class Server::CallbackRequest final
     if (ctx_alloc_by_default_ || server_->context_allocator() == nullptr) {
       default_ctx_.Destroy();
     }
-    server_->UnrefWithPossibleNotify();
+  }
+
+  // Constructs a request in storage taken from \a pool, forwarding the
+  // rest of \a args to the constructor.
+  template <class... Args>
+  static void Create(CallbackRequestPool* pool, Args&&... args) {
+    new (pool->Get()) CallbackRequest(pool, std::forward<Args>(args)...);
+  }
+
+  // Destroys the request and returns its storage to the pool it came from.
+  // Drops the server ref last, as the pool does not outlive the server.
+  void Destroy() {
+    Server* server = server_;
+    CallbackRequestPool* pool = pool_;
+    this->~CallbackRequest();
+    pool->Put(this);
+    server->UnrefWithPossibleNotify();
   }
 
   // Needs specialization to account for different processing of metadata
@@ -635,7 +717,7 @@ class Server::CallbackRequest final
       if (!ok) {
         // The call has been shutdown.
         // Delete its contents to free up the request.
-        delete req_;
+        req_->Destroy();
         return;
       }
 
@@ -698,7 +780,7 @@ class Server::CallbackRequest final
                           : req_->server_->generic_handler_.get();
       handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
           call_, req_->ctx_, req_->request_, req_->request_status_,
-          req_->handler_data_, [this] { delete req_; }));
+          req_->handler_data_, [this] { req_->Destroy(); }));
     }
   };
 
@@ -718,6 +800,7 @@ class Server::CallbackRequest final
     data->cq = cq_->cq();
   }
 
+  CallbackRequestPool* const pool_;
   Server* const server_;
   grpc::internal::RpcServiceMethod* const method_;
   const bool has_request_payload_;
@@ -778,8 +861,10 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
   SyncRequestThreadManager(Server* server, grpc::CompletionQueue* server_cq,
                            std::shared_ptr<GlobalCallbacks> global_callbacks,
                            grpc_resource_quota* rq, int min_pollers,
-                           int max_pollers, int cq_timeout_msec)
-      : ThreadManager("SyncServer", rq, min_pollers, max_pollers),
+                           int max_pollers, int cq_timeout_msec,
+                           int max_handlers)
+      : ThreadManager("SyncServer", rq, min_pollers, max_pollers,
+                      max_handlers),
         server_(server),
         server_cq_(server_cq),
         cq_timeout_msec_(cq_timeout_msec),
@@ -885,7 +970,8 @@ Server::Server(
     std::vector<
         std::unique_ptr<grpc::experimental::ServerInterceptorFactoryInterface>>
         interceptor_creators,
-    experimental::ServerMetricRecorder* server_metric_recorder)
+    experimental::ServerMetricRecorder* server_metric_recorder,
+    int max_handlers)
     : acceptors_(std::move(acceptors)),
       interceptor_creators_(std::move(interceptor_creators)),
       max_receive_message_size_(INT_MIN),
@@ -913,7 +999,7 @@ Server::Server(
     for (const auto& it : *sync_server_cqs_) {
       sync_req_mgrs_.emplace_back(new SyncRequestThreadManager(
           this, it.get(), global_callbacks_, server_rq, min_pollers,
-          max_pollers, sync_cq_timeout_msec));
+          max_pollers, sync_cq_timeout_msec, max_handlers));
     }
 
     if (default_rq_created) {
@@ -925,6 +1011,19 @@ Server::Server(
     acceptor->SetToChannelArgs(args);
   }
 
+  if (server_metric_recorder_ != nullptr) {
+    // Lets the server shed connections by the utilization recorded, when it
+    // is set up to rebalance them.
+    auto load_reporter =
+        grpc_core::MakeRefCounted<ServerMetricRecorderLoadReporter>(
+            server_metric_recorder_);
+    args->SetPointerWithVtable(
+        std::string(grpc_core::ServerLoadReporter::ChannelArgName()),
+        static_cast<grpc_core::ServerLoadReporter*>(load_reporter.get()),
+        grpc_core::ChannelArgTypeTraits<
+            grpc_core::ServerLoadReporter>::VTable());
+  }
+
   grpc_channel_args channel_args;
   args->SetChannelArgs(&channel_args);
 
@@ -1062,11 +1161,16 @@ bool Server::RegisterService(const std::string* addr, grpc::Service* service) {
       grpc::internal::RpcServiceMethod* method_value = method.get();
       grpc::CompletionQueue* cq = CallbackCQ();
       grpc_server_register_completion_queue(server_, cq->cq(), nullptr);
+      if (callback_request_pool_ == nullptr) {
+        callback_request_pool_ = std::make_unique<CallbackRequestPool>(
+            sizeof(CallbackRequest<grpc::CallbackServerContext>));
+      }
+      CallbackRequestPool* pool = callback_request_pool_.get();
       grpc_core::Server::FromC(server_)->SetRegisteredMethodAllocator(
-          cq->cq(), method_registration_tag, [this, cq, method_value] {
+          cq->cq(), method_registration_tag, [this, pool, cq, method_value] {
             grpc_core::Server::RegisteredCallAllocation result;
-            new CallbackRequest<grpc::CallbackServerContext>(this, method_value,
-                                                             cq, &result);
+            CallbackRequest<grpc::CallbackServerContext>::Create(
+                pool, this, method_value, cq, &result);
             return result;
           });
     }
@@ -1103,12 +1207,18 @@ void Server::RegisterCallbackGenericService(
   generic_handler_.reset(service->Handler());
 
   grpc::CompletionQueue* cq = CallbackCQ();
-  grpc_core::Server::FromC(server_)->SetBatchMethodAllocator(cq->cq(), [this,
-                                                                        cq] {
-    grpc_core::Server::BatchCallAllocation result;
-    new CallbackRequest<grpc::GenericCallbackServerContext>(this, cq, &result);
-    return result;
-  });
+  if (generic_callback_request_pool_ == nullptr) {
+    generic_callback_request_pool_ = std::make_unique<CallbackRequestPool>(
+        sizeof(CallbackRequest<grpc::GenericCallbackServerContext>));
+  }
+  CallbackRequestPool* pool = generic_callback_request_pool_.get();
+  grpc_core::Server::FromC(server_)->SetBatchMethodAllocator(
+      cq->cq(), [this, pool, cq] {
+        grpc_core::Server::BatchCallAllocation result;
+        CallbackRequest<grpc::GenericCallbackServerContext>::Create(
+            pool, this, cq, &result);
+        return result;
+      });
 }
 
 int Server::AddListeningPort(const std::string& addr,
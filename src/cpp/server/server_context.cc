@@ -339,6 +339,11 @@ void ServerContextBase::TryCancel() const {
   internal::CancelInterceptorBatchMethods cancel_methods;
   if (rpc_info_) {
     for (size_t i = 0; i < rpc_info_->interceptors_.size(); i++) {
+      if ((rpc_info_->hook_masks_[i] &
+           experimental::InterceptionHookBit(
+               experimental::InterceptionHookPoints::PRE_SEND_CANCEL)) == 0) {
+        continue;
+      }
       rpc_info_->RunInterceptor(&cancel_methods, i);
     }
   }
@@ -22,7 +22,9 @@
 #include <initializer_list>
 
 #include "absl/strings/str_format.h"
+#include "absl/time/time.h"
 
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/gprpp/crash.h"
@@ -32,8 +34,23 @@
 
 namespace grpc {
 
-ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
-    : thd_mgr_(thd_mgr) {
+namespace {
+
+// Queued work should not wait longer than this for a handler thread.
+constexpr int64_t kTargetQueueDelayMicros = 1000;
+// Handler threads are added at most this often, so that the pool grows
+// with sustained delay rather than with each burst of work.
+constexpr int64_t kAdjustIntervalMillis = 10;
+// When the process already uses this much of all CPUs, more handler threads
+// would not get the work done sooner.
+constexpr double kMaxCpuUtilization = 0.9;
+// Handler threads exit after being idle for this long, down to one.
+constexpr int64_t kHandlerIdleTimeoutMillis = 10000;
+
+}  // namespace
+
+ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr, bool handler)
+    : thd_mgr_(thd_mgr), handler_(handler) {
   // Make thread creation exclusive with respect to its join happening in
   // ~WorkerThread().
   thd_ = grpc_core::Thread(
@@ -46,7 +63,13 @@ ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
 }
 
 void ThreadManager::WorkerThread::Run() {
-  thd_mgr_->MainWorkLoop();
+  if (handler_) {
+    thd_mgr_->HandlerLoop();
+  } else if (thd_mgr_->max_handlers_ > 0) {
+    thd_mgr_->PollerLoop();
+  } else {
+    thd_mgr_->MainWorkLoop();
+  }
   thd_mgr_->MarkAsCompleted(this);
 }
 
@@ -56,7 +79,8 @@ ThreadManager::WorkerThread::~WorkerThread() {
 }
 
 ThreadManager::ThreadManager(const char*, grpc_resource_quota* resource_quota,
-                             int min_pollers, int max_pollers)
+                             int min_pollers, int max_pollers,
+                             int max_handlers)
     : shutdown_(false),
       thread_quota_(
           grpc_core::ResourceQuota::FromC(resource_quota)->thread_quota()),
@@ -64,6 +88,9 @@ ThreadManager::ThreadManager(const char*, grpc_resource_quota* resource_quota,
       min_pollers_(min_pollers),
       max_pollers_(max_pollers == -1 ? INT_MAX : max_pollers),
       num_threads_(0),
+      max_handlers_(max_handlers),
+      last_adjust_time_(gpr_now(GPR_CLOCK_MONOTONIC)),
+      last_adjust_cpu_(clock()),
       max_active_threads_sofar_(0) {}
 
 ThreadManager::~ThreadManager() {
@@ -127,27 +154,146 @@ void ThreadManager::CleanupCompletedThreads() {
 }
 
 void ThreadManager::Initialize() {
-  if (!thread_quota_->Reserve(min_pollers_)) {
+  // With separate handler threads, one handler is started along with the
+  // pollers.
+  const int num_handlers = max_handlers_ > 0 ? 1 : 0;
+  if (!thread_quota_->Reserve(min_pollers_ + num_handlers)) {
     grpc_core::Crash(absl::StrFormat(
         "No thread quota available to even create the minimum required "
         "polling threads (i.e %d). Unable to start the thread manager",
-        min_pollers_));
+        min_pollers_ + num_handlers));
   }
 
   {
     grpc_core::MutexLock lock(&mu_);
     num_pollers_ = min_pollers_;
-    num_threads_ = min_pollers_;
-    max_active_threads_sofar_ = min_pollers_;
+    num_handlers_ = num_handlers;
+    num_threads_ = min_pollers_ + num_handlers;
+    max_active_threads_sofar_ = num_threads_;
   }
 
-  for (int i = 0; i < min_pollers_; i++) {
-    WorkerThread* worker = new WorkerThread(this);
+  for (int i = 0; i < min_pollers_ + num_handlers; i++) {
+    WorkerThread* worker = new WorkerThread(this, i >= min_pollers_);
     GPR_ASSERT(worker->created());  // Must be able to create the minimum
     worker->Start();
   }
 }
 
+void ThreadManager::PollerLoop() {
+  while (true) {
+    void* tag;
+    bool ok;
+    WorkStatus work_status = PollForWork(&tag, &ok);
+    if (work_status == SHUTDOWN) break;
+    bool resource_exhausted = false;
+    bool done;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+      if (work_status == WORK_FOUND) {
+        if (num_handlers_ > 0 || AddHandlerLocked()) {
+          pending_work_.push_back({tag, ok, now});
+          if (num_idle_handlers_ > 0) work_cv_.Signal();
+        } else {
+          // No handler is left, and there is no quota to start one.
+          resource_exhausted = true;
+        }
+      }
+      // Timeouts give a chance to add handlers when all of them are stuck,
+      // and no new work arrives.
+      MaybeAddHandlerLocked(now);
+      done = shutdown_;
+    }
+    if (resource_exhausted) DoWork(tag, ok, false);
+    if (done) break;
+  }
+
+  {
+    grpc_core::MutexLock lock(&mu_);
+    num_pollers_--;
+    // Handlers exit once no poller is left to queue more work.
+    if (num_pollers_ == 0) work_cv_.SignalAll();
+  }
+  CleanupCompletedThreads();
+}
+
+void ThreadManager::HandlerLoop() {
+  grpc_core::LockableAndReleasableMutexLock lock(&mu_);
+  while (true) {
+    if (pending_work_.empty()) {
+      if (shutdown_ && num_pollers_ == 0) break;
+      num_idle_handlers_++;
+      bool timed_out = work_cv_.WaitWithTimeout(
+          &mu_, absl::Milliseconds(kHandlerIdleTimeoutMillis));
+      num_idle_handlers_--;
+      if (timed_out && pending_work_.empty() && !shutdown_ &&
+          num_handlers_ > 1) {
+        break;
+      }
+      continue;
+    }
+    PendingWork work = pending_work_.front();
+    pending_work_.pop_front();
+    lock.Release();
+    DoWork(work.tag, work.ok, true);
+    lock.Lock();
+    MaybeAddHandlerLocked(gpr_now(GPR_CLOCK_MONOTONIC));
+  }
+  num_handlers_--;
+  lock.Release();
+  CleanupCompletedThreads();
+}
+
+void ThreadManager::MaybeAddHandlerLocked(gpr_timespec now) {
+  if (static_cast<int>(pending_work_.size()) <= num_idle_handlers_ ||
+      num_handlers_ >= max_handlers_ || shutdown_) {
+    return;
+  }
+  gpr_timespec waited = gpr_time_sub(now, pending_work_.front().queued_time);
+  if (gpr_time_cmp(waited, gpr_time_from_micros(kTargetQueueDelayMicros,
+                                                GPR_TIMESPAN)) < 0) {
+    return;
+  }
+  gpr_timespec elapsed = gpr_time_sub(now, last_adjust_time_);
+  if (gpr_time_cmp(elapsed, gpr_time_from_millis(kAdjustIntervalMillis,
+                                                 GPR_TIMESPAN)) < 0) {
+    return;
+  }
+  // clock() measures the CPU time of the whole process. Where it measures
+  // wall time instead (Windows), this never finds the CPUs saturated, and
+  // handlers are added on queueing delay alone.
+  clock_t cpu = clock();
+  cpu_utilization_ = static_cast<double>(cpu - last_adjust_cpu_) /
+                     CLOCKS_PER_SEC /
+                     (gpr_timespec_to_micros(elapsed) / GPR_US_PER_SEC *
+                      gpr_cpu_num_cores());
+  last_adjust_time_ = now;
+  last_adjust_cpu_ = cpu;
+  if (cpu_utilization_ >= kMaxCpuUtilization) return;
+  AddHandlerLocked();
+}
+
+bool ThreadManager::AddHandlerLocked() {
+  if (!thread_quota_->Reserve(1)) return false;
+  num_handlers_++;
+  num_threads_++;
+  if (num_threads_ > max_active_threads_sofar_) {
+    max_active_threads_sofar_ = num_threads_;
+  }
+  // The new thread blocks on mu_ until the caller releases it, which is
+  // fine since handlers are added at most every kAdjustIntervalMillis.
+  WorkerThread* worker = new WorkerThread(this, /*handler=*/true);
+  if (!worker->created()) {
+    num_handlers_--;
+    num_threads_--;
+    thread_quota_->Release(1);
+    delete worker;
+    return false;
+  }
+  worker->Start();
+  return true;
+}
+
 void ThreadManager::MainWorkLoop() {
   while (true) {
     void* tag;
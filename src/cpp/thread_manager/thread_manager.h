@@ -19,8 +19,13 @@
 #ifndef GRPC_SRC_CPP_THREAD_MANAGER_THREAD_MANAGER_H
 #define GRPC_SRC_CPP_THREAD_MANAGER_THREAD_MANAGER_H
 
+#include <time.h>
+
+#include <deque>
 #include <list>
 
+#include <grpc/support/time.h>
+
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/resource_quota/api.h"
@@ -30,8 +35,19 @@ namespace grpc {
 
 class ThreadManager {
  public:
+  // If max_handlers is 0, each thread both polls for work and does the work
+  // it finds, and the number of threads polling at any time is kept between
+  // min_pollers and max_pollers.
+  //
+  // Otherwise polling and handling are done by separate threads: min_pollers
+  // threads only poll, and queue the work they find for a pool of 1 to
+  // max_handlers handler threads. A handler is added while queued work has
+  // waited longer than a target delay and the process has CPU to spare, so
+  // that handlers blocked in application code do not starve the queue, and
+  // handlers that have been idle for a while exit.
   explicit ThreadManager(const char* name, grpc_resource_quota* resource_quota,
-                         int min_pollers, int max_pollers);
+                         int min_pollers, int max_pollers,
+                         int max_handlers = 0);
   virtual ~ThreadManager();
 
   // Initializes and Starts the Rpc Manager threads
@@ -117,7 +133,8 @@ class ThreadManager {
   // not be called (and the need for this WorkerThread class is eliminated)
   class WorkerThread {
    public:
-    explicit WorkerThread(ThreadManager* thd_mgr);
+    // A handler thread runs HandlerLoop() instead of MainWorkLoop().
+    explicit WorkerThread(ThreadManager* thd_mgr, bool handler = false);
     ~WorkerThread();
 
     bool created() const { return created_; }
@@ -129,18 +146,36 @@ class ThreadManager {
     void Run();
 
     ThreadManager* const thd_mgr_;
+    const bool handler_;
     grpc_core::Thread thd_;
     bool created_;
   };
 
+  // Work found by a poller, waiting for a handler thread.
+  struct PendingWork {
+    void* tag;
+    bool ok;
+    gpr_timespec queued_time;
+  };
+
   // The main function in ThreadManager
   void MainWorkLoop();
 
+  // The loops of poller and handler threads when max_handlers_ is positive.
+  void PollerLoop();
+  void HandlerLoop();
+  // Starts a handler thread if queued work has waited too long and the
+  // process is not already busy on all CPUs.
+  void MaybeAddHandlerLocked(gpr_timespec now)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Starts a handler thread, after reserving thread quota for it.
+  bool AddHandlerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   void MarkAsCompleted(WorkerThread* thd);
   void CleanupCompletedThreads();
 
-  // Protects shutdown_, num_pollers_, num_threads_ and
-  // max_active_threads_sofar_
+  // Protects shutdown_, num_pollers_, num_threads_, the handler thread state
+  // and max_active_threads_sofar_
   grpc_core::Mutex mu_;
 
   bool shutdown_;
@@ -165,6 +200,19 @@ class ThreadManager {
   // threads that are currently polling i.e num_pollers_)
   int num_threads_;
 
+  // The maximum number of handler threads, or 0 if pollers do their own work
+  const int max_handlers_;
+  // Number of handler threads, and how many of them are waiting for work
+  int num_handlers_ = 0;
+  int num_idle_handlers_ = 0;
+  std::deque<PendingWork> pending_work_;
+  grpc_core::CondVar work_cv_;
+  // When MaybeAddHandlerLocked() last sampled the process CPU time, the CPU
+  // time then, and the fraction of all CPUs used since the sample before.
+  gpr_timespec last_adjust_time_;
+  clock_t last_adjust_cpu_ = 0;
+  double cpu_utilization_ = 0;
+
   // See GetMaxActiveThreadsSoFar()'s description.
   // To be more specific, this variable tracks the max value num_threads_ was
   // ever set so far
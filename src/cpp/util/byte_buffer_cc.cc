@@ -24,11 +24,22 @@
 #include <grpc/impl/compression_types.h>
 #include <grpc/slice.h>
 #include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/proto_buffer_writer.h>
 #include <grpcpp/support/slice.h>
 #include <grpcpp/support/status.h>
 
+#include "src/core/lib/slice/slice_pool.h"
+
 namespace grpc {
 
+namespace internal {
+
+grpc_slice AllocateProtoBufferWriterSlice(size_t length) {
+  return grpc_core::PooledSliceMalloc(length);
+}
+
+}  // namespace internal
+
 Status ByteBuffer::TrySingleSlice(Slice* slice) const {
   if (!buffer_) {
     return Status(StatusCode::FAILED_PRECONDITION, "Buffer not initialized");
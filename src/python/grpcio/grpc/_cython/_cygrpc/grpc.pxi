@@ -262,6 +262,7 @@ cdef extern from "grpc/grpc.h":
     GRPC_CQ_DEFAULT_POLLING
     GRPC_CQ_NON_LISTENING
     GRPC_CQ_NON_POLLING
+    GRPC_CQ_NON_POLLING_LOCK_FREE
 
   ctypedef struct grpc_completion_queue_attributes:
     int version
@@ -688,6 +689,8 @@ cdef extern from "grpc/compression.h":
     GRPC_COMPRESS_DEFLATE
     GRPC_COMPRESS_GZIP
     GRPC_COMPRESS_STREAM_GZIP
+    GRPC_COMPRESS_ZSTD
+    GRPC_COMPRESS_LZ4
     GRPC_COMPRESS_ALGORITHMS_COUNT
 
   ctypedef enum grpc_compression_level:
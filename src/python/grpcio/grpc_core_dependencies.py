@@ -28,6 +28,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/filters/client_channel/client_channel_plugin.cc',
     'src/core/ext/filters/client_channel/client_channel_service_config.cc',
     'src/core/ext/filters/client_channel/config_selector.cc',
+    'src/core/ext/filters/client_channel/connection_attempt_scheduler.cc',
     'src/core/ext/filters/client_channel/dynamic_filters.cc',
     'src/core/ext/filters/client_channel/global_subchannel_pool.cc',
     'src/core/ext/filters/client_channel/health/health_check_client.cc',
@@ -39,6 +40,9 @@ CORE_SOURCE_FILES = [
     'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_balancer_addresses.cc',
     'src/core/ext/filters/client_channel/lb_policy/grpclb/grpclb_client_stats.cc',
     'src/core/ext/filters/client_channel/lb_policy/grpclb/load_balancer_api.cc',
+    'src/core/ext/filters/client_channel/lb_policy/least_request/least_request.cc',
+    'src/core/ext/filters/client_channel/lb_policy/maglev/maglev.cc',
+    'src/core/ext/filters/client_channel/lb_policy/maglev/maglev_table.cc',
     'src/core/ext/filters/client_channel/lb_policy/oob_backend_metric.cc',
     'src/core/ext/filters/client_channel/lb_policy/outlier_detection/outlier_detection.cc',
     'src/core/ext/filters/client_channel/lb_policy/pick_first/pick_first.cc',
@@ -65,6 +69,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_wrapper_posix.cc',
     'src/core/ext/filters/client_channel/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc',
     'src/core/ext/filters/client_channel/resolver/dns/dns_resolver_selection.cc',
+    'src/core/ext/filters/client_channel/resolver/dns/dns_result_cache.cc',
     'src/core/ext/filters/client_channel/resolver/dns/native/dns_resolver.cc',
     'src/core/ext/filters/client_channel/resolver/fake/fake_resolver.cc',
     'src/core/ext/filters/client_channel/resolver/google_c2p/google_c2p_resolver.cc',
@@ -121,6 +126,9 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/writing.cc',
     'src/core/ext/transport/inproc/inproc_plugin.cc',
     'src/core/ext/transport/inproc/inproc_transport.cc',
+    'src/core/ext/transport/shm/shm_endpoint.cc',
+    'src/core/ext/transport/shm/shm_handshaker.cc',
+    'src/core/ext/transport/shm/shm_ring.cc',
     'src/core/ext/upb-generated/envoy/admin/v3/certs.upb.c',
     'src/core/ext/upb-generated/envoy/admin/v3/clusters.upb.c',
     'src/core/ext/upb-generated/envoy/admin/v3/config_dump.upb.c',
@@ -452,6 +460,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/xds/xds_http_stateful_session_filter.cc',
     'src/core/ext/xds/xds_lb_policy_registry.cc',
     'src/core/ext/xds/xds_listener.cc',
+    'src/core/ext/xds/xds_resource_cache.cc',
     'src/core/ext/xds/xds_route_config.cc',
     'src/core/ext/xds/xds_routing.cc',
     'src/core/ext/xds/xds_server_config_fetcher.cc',
@@ -471,10 +480,12 @@ CORE_SOURCE_FILES = [
     'src/core/lib/channel/promise_based_filter.cc',
     'src/core/lib/channel/status_util.cc',
     'src/core/lib/compression/compression.cc',
+    'src/core/lib/compression/compression_dictionary.cc',
     'src/core/lib/compression/compression_internal.cc',
     'src/core/lib/compression/message_compress.cc',
     'src/core/lib/config/core_configuration.cc',
     'src/core/lib/debug/event_log.cc',
+    'src/core/lib/debug/event_ring.cc',
     'src/core/lib/debug/histogram_view.cc',
     'src/core/lib/debug/stats.cc',
     'src/core/lib/debug/stats_data.cc',
@@ -485,7 +496,9 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/event_engine.cc',
     'src/core/lib/event_engine/forkable.cc',
     'src/core/lib/event_engine/memory_allocator.cc',
+    'src/core/lib/event_engine/posix_engine/ares_resolver.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+    'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
     'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
@@ -498,6 +511,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
     'src/core/lib/event_engine/posix_engine/timer_manager.cc',
+    'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
     'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_pipe.cc',
@@ -507,6 +521,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/slice.cc',
     'src/core/lib/event_engine/slice_buffer.cc',
     'src/core/lib/event_engine/tcp_socket_utils.cc',
+    'src/core/lib/event_engine/thread_affinity.cc',
     'src/core/lib/event_engine/thread_local.cc',
     'src/core/lib/event_engine/thread_pool.cc',
     'src/core/lib/event_engine/time_util.cc',
@@ -516,6 +531,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/windows/win_socket.cc',
     'src/core/lib/event_engine/windows/windows_endpoint.cc',
     'src/core/lib/event_engine/windows/windows_engine.cc',
+    'src/core/lib/event_engine/work_queue.cc',
     'src/core/lib/experiments/config.cc',
     'src/core/lib/experiments/experiments.cc',
     'src/core/lib/gpr/alloc.cc',
@@ -545,6 +561,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/gpr/tmpfile_posix.cc',
     'src/core/lib/gpr/tmpfile_windows.cc',
     'src/core/lib/gpr/wrap_memcpy.cc',
+    'src/core/lib/gprpp/adaptive_mutex.cc',
     'src/core/lib/gprpp/crash.cc',
     'src/core/lib/gprpp/env_linux.cc',
     'src/core/lib/gprpp/env_posix.cc',
@@ -555,6 +572,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/gprpp/host_port.cc',
     'src/core/lib/gprpp/load_file.cc',
     'src/core/lib/gprpp/mpscq.cc',
+    'src/core/lib/gprpp/numa.cc',
     'src/core/lib/gprpp/stat_posix.cc',
     'src/core/lib/gprpp/stat_windows.cc',
     'src/core/lib/gprpp/status_helper.cc',
@@ -710,8 +728,11 @@ CORE_SOURCE_FILES = [
     'src/core/lib/security/credentials/tls/grpc_tls_certificate_provider.cc',
     'src/core/lib/security/credentials/tls/grpc_tls_certificate_verifier.cc',
     'src/core/lib/security/credentials/tls/grpc_tls_credentials_options.cc',
+    'src/core/lib/security/credentials/tls/grpc_tls_private_key_signer.cc',
+    'src/core/lib/security/credentials/tls/grpc_tls_session_ticket_key_provider.cc',
     'src/core/lib/security/credentials/tls/tls_credentials.cc',
     'src/core/lib/security/credentials/tls/tls_utils.cc',
+    'src/core/lib/security/credentials/tls/tls_verified_peer_cache.cc',
     'src/core/lib/security/credentials/xds/xds_credentials.cc',
     'src/core/lib/security/security_connector/alts/alts_security_connector.cc',
     'src/core/lib/security/security_connector/fake/fake_security_connector.cc',
@@ -725,6 +746,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/security/security_connector/ssl_utils_config.cc',
     'src/core/lib/security/security_connector/tls/tls_security_connector.cc',
     'src/core/lib/security/transport/client_auth_filter.cc',
+    'src/core/lib/security/transport/handshake_executor.cc',
     'src/core/lib/security/transport/secure_endpoint.cc',
     'src/core/lib/security/transport/security_handshaker.cc',
     'src/core/lib/security/transport/server_auth_filter.cc',
@@ -736,6 +758,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/slice/percent_encoding.cc',
     'src/core/lib/slice/slice.cc',
     'src/core/lib/slice/slice_buffer.cc',
+    'src/core/lib/slice/slice_pool.cc',
     'src/core/lib/slice/slice_refcount.cc',
     'src/core/lib/slice/slice_string_helpers.cc',
     'src/core/lib/surface/api_trace.cc',
@@ -758,6 +781,9 @@ CORE_SOURCE_FILES = [
     'src/core/lib/surface/lame_client.cc',
     'src/core/lib/surface/metadata_array.cc',
     'src/core/lib/surface/server.cc',
+    'src/core/lib/surface/server_admission_control.cc',
+    'src/core/lib/surface/server_connection_rebalancer.cc',
+    'src/core/lib/surface/server_fair_queuing.cc',
     'src/core/lib/surface/validate_metadata.cc',
     'src/core/lib/surface/version.cc',
     'src/core/lib/transport/bdp_estimator.cc',
@@ -798,10 +824,12 @@ CORE_SOURCE_FILES = [
     'src/core/tsi/alts/zero_copy_frame_protector/alts_zero_copy_grpc_protector.cc',
     'src/core/tsi/fake_transport_security.cc',
     'src/core/tsi/local_transport_security.cc',
+    'src/core/tsi/ssl/early_data/ssl_early_data_anti_replay.cc',
     'src/core/tsi/ssl/key_logging/ssl_key_logging.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_cache.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_openssl.cc',
+    'src/core/tsi/ssl/session_ticket/ssl_session_ticket_key_ring.cc',
     'src/core/tsi/ssl_transport_security.cc',
     'src/core/tsi/ssl_transport_security_utils.cc',
     'src/core/tsi/transport_security.cc',
@@ -66,6 +66,7 @@ grpc_completion_queue_thread_local_cache_flush_type grpc_completion_queue_thread
 grpc_channel_check_connectivity_state_type grpc_channel_check_connectivity_state_import;
 grpc_channel_num_external_connectivity_watchers_type grpc_channel_num_external_connectivity_watchers_import;
 grpc_channel_watch_connectivity_state_type grpc_channel_watch_connectivity_state_import;
+grpc_channel_watch_warm_type grpc_channel_watch_warm_import;
 grpc_channel_support_connectivity_watcher_type grpc_channel_support_connectivity_watcher_import;
 grpc_channel_create_call_type grpc_channel_create_call_import;
 grpc_channel_register_call_type grpc_channel_register_call_import;
@@ -155,6 +156,7 @@ grpc_sts_credentials_create_type grpc_sts_credentials_create_import;
 grpc_auth_metadata_context_copy_type grpc_auth_metadata_context_copy_import;
 grpc_auth_metadata_context_reset_type grpc_auth_metadata_context_reset_import;
 grpc_metadata_credentials_create_from_plugin_type grpc_metadata_credentials_create_from_plugin_import;
+grpc_metadata_credentials_create_from_plugin_with_metadata_ttl_type grpc_metadata_credentials_create_from_plugin_with_metadata_ttl_import;
 grpc_ssl_server_certificate_config_create_type grpc_ssl_server_certificate_config_create_import;
 grpc_ssl_server_certificate_config_destroy_type grpc_ssl_server_certificate_config_destroy_import;
 grpc_ssl_server_credentials_create_type grpc_ssl_server_credentials_create_import;
@@ -187,7 +189,18 @@ grpc_tls_credentials_options_watch_identity_key_cert_pairs_type grpc_tls_credent
 grpc_tls_credentials_options_set_identity_cert_name_type grpc_tls_credentials_options_set_identity_cert_name_import;
 grpc_tls_credentials_options_set_cert_request_type_type grpc_tls_credentials_options_set_cert_request_type_import;
 grpc_tls_credentials_options_set_crl_directory_type grpc_tls_credentials_options_set_crl_directory_import;
+grpc_tls_session_ticket_key_provider_in_memory_create_type grpc_tls_session_ticket_key_provider_in_memory_create_import;
+grpc_tls_session_ticket_key_provider_in_memory_set_keys_type grpc_tls_session_ticket_key_provider_in_memory_set_keys_import;
+grpc_tls_session_ticket_key_provider_file_watcher_create_type grpc_tls_session_ticket_key_provider_file_watcher_create_import;
+grpc_tls_session_ticket_key_provider_release_type grpc_tls_session_ticket_key_provider_release_import;
+grpc_tls_credentials_options_set_session_ticket_key_provider_type grpc_tls_credentials_options_set_session_ticket_key_provider_import;
+grpc_tls_private_key_signer_external_create_type grpc_tls_private_key_signer_external_create_import;
+grpc_tls_private_key_signer_release_type grpc_tls_private_key_signer_release_import;
+grpc_tls_credentials_options_set_private_key_signer_type grpc_tls_credentials_options_set_private_key_signer_import;
 grpc_tls_credentials_options_set_verify_server_cert_type grpc_tls_credentials_options_set_verify_server_cert_import;
+grpc_tls_credentials_options_set_verified_peer_cache_size_type grpc_tls_credentials_options_set_verified_peer_cache_size_import;
+grpc_tls_credentials_options_set_early_data_type grpc_tls_credentials_options_set_early_data_import;
+grpc_tls_credentials_options_set_early_data_anti_replay_capacity_type grpc_tls_credentials_options_set_early_data_anti_replay_capacity_import;
 grpc_tls_credentials_options_set_check_call_host_type grpc_tls_credentials_options_set_check_call_host_import;
 grpc_insecure_credentials_create_type grpc_insecure_credentials_create_import;
 grpc_insecure_server_credentials_create_type grpc_insecure_server_credentials_create_import;
@@ -352,6 +365,7 @@ void grpc_rb_load_imports(HMODULE library) {
   grpc_channel_check_connectivity_state_import = (grpc_channel_check_connectivity_state_type) GetProcAddress(library, "grpc_channel_check_connectivity_state");
   grpc_channel_num_external_connectivity_watchers_import = (grpc_channel_num_external_connectivity_watchers_type) GetProcAddress(library, "grpc_channel_num_external_connectivity_watchers");
   grpc_channel_watch_connectivity_state_import = (grpc_channel_watch_connectivity_state_type) GetProcAddress(library, "grpc_channel_watch_connectivity_state");
+  grpc_channel_watch_warm_import = (grpc_channel_watch_warm_type) GetProcAddress(library, "grpc_channel_watch_warm");
   grpc_channel_support_connectivity_watcher_import = (grpc_channel_support_connectivity_watcher_type) GetProcAddress(library, "grpc_channel_support_connectivity_watcher");
   grpc_channel_create_call_import = (grpc_channel_create_call_type) GetProcAddress(library, "grpc_channel_create_call");
   grpc_channel_register_call_import = (grpc_channel_register_call_type) GetProcAddress(library, "grpc_channel_register_call");
@@ -441,6 +455,7 @@ void grpc_rb_load_imports(HMODULE library) {
   grpc_auth_metadata_context_copy_import = (grpc_auth_metadata_context_copy_type) GetProcAddress(library, "grpc_auth_metadata_context_copy");
   grpc_auth_metadata_context_reset_import = (grpc_auth_metadata_context_reset_type) GetProcAddress(library, "grpc_auth_metadata_context_reset");
   grpc_metadata_credentials_create_from_plugin_import = (grpc_metadata_credentials_create_from_plugin_type) GetProcAddress(library, "grpc_metadata_credentials_create_from_plugin");
+  grpc_metadata_credentials_create_from_plugin_with_metadata_ttl_import = (grpc_metadata_credentials_create_from_plugin_with_metadata_ttl_type) GetProcAddress(library, "grpc_metadata_credentials_create_from_plugin_with_metadata_ttl");
   grpc_ssl_server_certificate_config_create_import = (grpc_ssl_server_certificate_config_create_type) GetProcAddress(library, "grpc_ssl_server_certificate_config_create");
   grpc_ssl_server_certificate_config_destroy_import = (grpc_ssl_server_certificate_config_destroy_type) GetProcAddress(library, "grpc_ssl_server_certificate_config_destroy");
   grpc_ssl_server_credentials_create_import = (grpc_ssl_server_credentials_create_type) GetProcAddress(library, "grpc_ssl_server_credentials_create");
@@ -473,7 +488,18 @@ void grpc_rb_load_imports(HMODULE library) {
   grpc_tls_credentials_options_set_identity_cert_name_import = (grpc_tls_credentials_options_set_identity_cert_name_type) GetProcAddress(library, "grpc_tls_credentials_options_set_identity_cert_name");
   grpc_tls_credentials_options_set_cert_request_type_import = (grpc_tls_credentials_options_set_cert_request_type_type) GetProcAddress(library, "grpc_tls_credentials_options_set_cert_request_type");
   grpc_tls_credentials_options_set_crl_directory_import = (grpc_tls_credentials_options_set_crl_directory_type) GetProcAddress(library, "grpc_tls_credentials_options_set_crl_directory");
+  grpc_tls_session_ticket_key_provider_in_memory_create_import = (grpc_tls_session_ticket_key_provider_in_memory_create_type) GetProcAddress(library, "grpc_tls_session_ticket_key_provider_in_memory_create");
+  grpc_tls_session_ticket_key_provider_in_memory_set_keys_import = (grpc_tls_session_ticket_key_provider_in_memory_set_keys_type) GetProcAddress(library, "grpc_tls_session_ticket_key_provider_in_memory_set_keys");
+  grpc_tls_session_ticket_key_provider_file_watcher_create_import = (grpc_tls_session_ticket_key_provider_file_watcher_create_type) GetProcAddress(library, "grpc_tls_session_ticket_key_provider_file_watcher_create");
+  grpc_tls_session_ticket_key_provider_release_import = (grpc_tls_session_ticket_key_provider_release_type) GetProcAddress(library, "grpc_tls_session_ticket_key_provider_release");
+  grpc_tls_credentials_options_set_session_ticket_key_provider_import = (grpc_tls_credentials_options_set_session_ticket_key_provider_type) GetProcAddress(library, "grpc_tls_credentials_options_set_session_ticket_key_provider");
+  grpc_tls_private_key_signer_external_create_import = (grpc_tls_private_key_signer_external_create_type) GetProcAddress(library, "grpc_tls_private_key_signer_external_create");
+  grpc_tls_private_key_signer_release_import = (grpc_tls_private_key_signer_release_type) GetProcAddress(library, "grpc_tls_private_key_signer_release");
+  grpc_tls_credentials_options_set_private_key_signer_import = (grpc_tls_credentials_options_set_private_key_signer_type) GetProcAddress(library, "grpc_tls_credentials_options_set_private_key_signer");
   grpc_tls_credentials_options_set_verify_server_cert_import = (grpc_tls_credentials_options_set_verify_server_cert_type) GetProcAddress(library, "grpc_tls_credentials_options_set_verify_server_cert");
+  grpc_tls_credentials_options_set_verified_peer_cache_size_import = (grpc_tls_credentials_options_set_verified_peer_cache_size_type) GetProcAddress(library, "grpc_tls_credentials_options_set_verified_peer_cache_size");
+  grpc_tls_credentials_options_set_early_data_import = (grpc_tls_credentials_options_set_early_data_type) GetProcAddress(library, "grpc_tls_credentials_options_set_early_data");
+  grpc_tls_credentials_options_set_early_data_anti_replay_capacity_import = (grpc_tls_credentials_options_set_early_data_anti_replay_capacity_type) GetProcAddress(library, "grpc_tls_credentials_options_set_early_data_anti_replay_capacity");
   grpc_tls_credentials_options_set_check_call_host_import = (grpc_tls_credentials_options_set_check_call_host_type) GetProcAddress(library, "grpc_tls_credentials_options_set_check_call_host");
   grpc_insecure_credentials_create_import = (grpc_insecure_credentials_create_type) GetProcAddress(library, "grpc_insecure_credentials_create");
   grpc_insecure_server_credentials_create_import = (grpc_insecure_server_credentials_create_type) GetProcAddress(library, "grpc_insecure_server_credentials_create");
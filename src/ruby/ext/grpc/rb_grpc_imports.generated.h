@@ -173,6 +173,9 @@ extern grpc_channel_num_external_connectivity_watchers_type grpc_channel_num_ext
 typedef void(*grpc_channel_watch_connectivity_state_type)(grpc_channel* channel, grpc_connectivity_state last_observed_state, gpr_timespec deadline, grpc_completion_queue* cq, void* tag);
 extern grpc_channel_watch_connectivity_state_type grpc_channel_watch_connectivity_state_import;
 #define grpc_channel_watch_connectivity_state grpc_channel_watch_connectivity_state_import
+typedef void(*grpc_channel_watch_warm_type)(grpc_channel* channel, double fraction, gpr_timespec deadline, grpc_completion_queue* cq, void* tag);
+extern grpc_channel_watch_warm_type grpc_channel_watch_warm_import;
+#define grpc_channel_watch_warm grpc_channel_watch_warm_import
 typedef int(*grpc_channel_support_connectivity_watcher_type)(grpc_channel* channel);
 extern grpc_channel_support_connectivity_watcher_type grpc_channel_support_connectivity_watcher_import;
 #define grpc_channel_support_connectivity_watcher grpc_channel_support_connectivity_watcher_import
@@ -440,6 +443,9 @@ extern grpc_auth_metadata_context_reset_type grpc_auth_metadata_context_reset_im
 typedef grpc_call_credentials*(*grpc_metadata_credentials_create_from_plugin_type)(grpc_metadata_credentials_plugin plugin, grpc_security_level min_security_level, void* reserved);
 extern grpc_metadata_credentials_create_from_plugin_type grpc_metadata_credentials_create_from_plugin_import;
 #define grpc_metadata_credentials_create_from_plugin grpc_metadata_credentials_create_from_plugin_import
+typedef grpc_call_credentials*(*grpc_metadata_credentials_create_from_plugin_with_metadata_ttl_type)(grpc_metadata_credentials_plugin plugin, grpc_security_level min_security_level, gpr_timespec metadata_ttl, void* reserved);
+extern grpc_metadata_credentials_create_from_plugin_with_metadata_ttl_type grpc_metadata_credentials_create_from_plugin_with_metadata_ttl_import;
+#define grpc_metadata_credentials_create_from_plugin_with_metadata_ttl grpc_metadata_credentials_create_from_plugin_with_metadata_ttl_import
 typedef grpc_ssl_server_certificate_config*(*grpc_ssl_server_certificate_config_create_type)(const char* pem_root_certs, const grpc_ssl_pem_key_cert_pair* pem_key_cert_pairs, size_t num_key_cert_pairs);
 extern grpc_ssl_server_certificate_config_create_type grpc_ssl_server_certificate_config_create_import;
 #define grpc_ssl_server_certificate_config_create grpc_ssl_server_certificate_config_create_import
@@ -536,9 +542,42 @@ extern grpc_tls_credentials_options_set_cert_request_type_type grpc_tls_credenti
 typedef void(*grpc_tls_credentials_options_set_crl_directory_type)(grpc_tls_credentials_options* options, const char* crl_directory);
 extern grpc_tls_credentials_options_set_crl_directory_type grpc_tls_credentials_options_set_crl_directory_import;
 #define grpc_tls_credentials_options_set_crl_directory grpc_tls_credentials_options_set_crl_directory_import
+typedef grpc_tls_session_ticket_key_provider*(*grpc_tls_session_ticket_key_provider_in_memory_create_type)(void);
+extern grpc_tls_session_ticket_key_provider_in_memory_create_type grpc_tls_session_ticket_key_provider_in_memory_create_import;
+#define grpc_tls_session_ticket_key_provider_in_memory_create grpc_tls_session_ticket_key_provider_in_memory_create_import
+typedef int(*grpc_tls_session_ticket_key_provider_in_memory_set_keys_type)(grpc_tls_session_ticket_key_provider* provider, const char* keys, size_t keys_size);
+extern grpc_tls_session_ticket_key_provider_in_memory_set_keys_type grpc_tls_session_ticket_key_provider_in_memory_set_keys_import;
+#define grpc_tls_session_ticket_key_provider_in_memory_set_keys grpc_tls_session_ticket_key_provider_in_memory_set_keys_import
+typedef grpc_tls_session_ticket_key_provider*(*grpc_tls_session_ticket_key_provider_file_watcher_create_type)(const char* key_file_path, unsigned int refresh_interval_sec);
+extern grpc_tls_session_ticket_key_provider_file_watcher_create_type grpc_tls_session_ticket_key_provider_file_watcher_create_import;
+#define grpc_tls_session_ticket_key_provider_file_watcher_create grpc_tls_session_ticket_key_provider_file_watcher_create_import
+typedef void(*grpc_tls_session_ticket_key_provider_release_type)(grpc_tls_session_ticket_key_provider* provider);
+extern grpc_tls_session_ticket_key_provider_release_type grpc_tls_session_ticket_key_provider_release_import;
+#define grpc_tls_session_ticket_key_provider_release grpc_tls_session_ticket_key_provider_release_import
+typedef void(*grpc_tls_credentials_options_set_session_ticket_key_provider_type)(grpc_tls_credentials_options* options, grpc_tls_session_ticket_key_provider* provider);
+extern grpc_tls_credentials_options_set_session_ticket_key_provider_type grpc_tls_credentials_options_set_session_ticket_key_provider_import;
+#define grpc_tls_credentials_options_set_session_ticket_key_provider grpc_tls_credentials_options_set_session_ticket_key_provider_import
+typedef grpc_tls_private_key_signer*(*grpc_tls_private_key_signer_external_create_type)(const grpc_tls_private_key_signer_external* external_signer);
+extern grpc_tls_private_key_signer_external_create_type grpc_tls_private_key_signer_external_create_import;
+#define grpc_tls_private_key_signer_external_create grpc_tls_private_key_signer_external_create_import
+typedef void(*grpc_tls_private_key_signer_release_type)(grpc_tls_private_key_signer* signer);
+extern grpc_tls_private_key_signer_release_type grpc_tls_private_key_signer_release_import;
+#define grpc_tls_private_key_signer_release grpc_tls_private_key_signer_release_import
+typedef void(*grpc_tls_credentials_options_set_private_key_signer_type)(grpc_tls_credentials_options* options, grpc_tls_private_key_signer* signer);
+extern grpc_tls_credentials_options_set_private_key_signer_type grpc_tls_credentials_options_set_private_key_signer_import;
+#define grpc_tls_credentials_options_set_private_key_signer grpc_tls_credentials_options_set_private_key_signer_import
 typedef void(*grpc_tls_credentials_options_set_verify_server_cert_type)(grpc_tls_credentials_options* options, int verify_server_cert);
 extern grpc_tls_credentials_options_set_verify_server_cert_type grpc_tls_credentials_options_set_verify_server_cert_import;
 #define grpc_tls_credentials_options_set_verify_server_cert grpc_tls_credentials_options_set_verify_server_cert_import
+typedef void(*grpc_tls_credentials_options_set_verified_peer_cache_size_type)(grpc_tls_credentials_options* options, size_t verified_peer_cache_size);
+extern grpc_tls_credentials_options_set_verified_peer_cache_size_type grpc_tls_credentials_options_set_verified_peer_cache_size_import;
+#define grpc_tls_credentials_options_set_verified_peer_cache_size grpc_tls_credentials_options_set_verified_peer_cache_size_import
+typedef void(*grpc_tls_credentials_options_set_early_data_type)(grpc_tls_credentials_options* options, int enable_early_data);
+extern grpc_tls_credentials_options_set_early_data_type grpc_tls_credentials_options_set_early_data_import;
+#define grpc_tls_credentials_options_set_early_data grpc_tls_credentials_options_set_early_data_import
+typedef void(*grpc_tls_credentials_options_set_early_data_anti_replay_capacity_type)(grpc_tls_credentials_options* options, size_t early_data_anti_replay_capacity);
+extern grpc_tls_credentials_options_set_early_data_anti_replay_capacity_type grpc_tls_credentials_options_set_early_data_anti_replay_capacity_import;
+#define grpc_tls_credentials_options_set_early_data_anti_replay_capacity grpc_tls_credentials_options_set_early_data_anti_replay_capacity_import
 typedef void(*grpc_tls_credentials_options_set_check_call_host_type)(grpc_tls_credentials_options* options, int check_call_host);
 extern grpc_tls_credentials_options_set_check_call_host_type grpc_tls_credentials_options_set_check_call_host_import;
 #define grpc_tls_credentials_options_set_check_call_host grpc_tls_credentials_options_set_check_call_host_import
@@ -36,6 +36,16 @@ TEST(AvlTest, Lookup) {
   EXPECT_EQ(nullptr, avl.Lookup(5));
 }
 
+TEST(AvlTest, RemoveAbsentKeyKeepsIdentity) {
+  auto avl = AVL<int, int>().Add(1, 1).Add(2, 2).Add(3, 3).Add(4, 4);
+  EXPECT_TRUE(avl.Remove(5).SameIdentity(avl));
+  EXPECT_TRUE(avl.Remove(0).SameIdentity(avl));
+  auto removed = avl.Remove(3);
+  EXPECT_FALSE(removed.SameIdentity(avl));
+  EXPECT_EQ(nullptr, removed.Lookup(3));
+  EXPECT_EQ(4, *removed.Lookup(4));
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
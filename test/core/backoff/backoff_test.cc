@@ -173,6 +173,39 @@ TEST(BackOffTest, JitterBackOff) {
   }
 }
 
+TEST(BackOffTest, DecorrelatedJitterBackOff) {
+  const auto initial_backoff = grpc_core::Duration::Milliseconds(100);
+  const auto max_backoff = grpc_core::Duration::Seconds(10);
+  const double multiplier = 3.0;
+  BackOff::Options options;
+  options.set_initial_backoff(initial_backoff)
+      .set_multiplier(multiplier)
+      .set_jitter(0.2)
+      .set_max_backoff(max_backoff)
+      .set_decorrelated_jitter(true);
+  BackOff backoff(options);
+
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::Timestamp next = backoff.NextAttemptTime();
+  EXPECT_EQ(next - grpc_core::Timestamp::Now(), initial_backoff);
+
+  // Each backoff is between the initial backoff and multiplier times the
+  // previous one, capped at the max.
+  auto previous = initial_backoff;
+  bool varied = false;
+  for (int i = 0; i < 10000; i++) {
+    next = backoff.NextAttemptTime();
+    const grpc_core::Duration timeout = next - grpc_core::Timestamp::Now();
+    EXPECT_GE(timeout, initial_backoff);
+    EXPECT_LE(timeout, max_backoff);
+    EXPECT_LE(timeout.millis(),
+              static_cast<int64_t>(previous.millis() * multiplier) + 1);
+    if (timeout != previous) varied = true;
+    previous = timeout;
+  }
+  EXPECT_TRUE(varied);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc
@@ -73,6 +73,18 @@ TEST(ChannelArgsTest, SetGetRemove) {
   gpr_free(ptr);
 }
 
+TEST(ChannelArgsTest, SetSameValueIsNoop) {
+  ChannelArgs a = ChannelArgs().Set("int", 1).Set("str", "x");
+  EXPECT_EQ(a.Set("int", 1), a);
+  EXPECT_EQ(a.Set("str", "x"), a);
+  EXPECT_EQ(a.Remove("missing"), a);
+  EXPECT_NE(a.Set("int", 2), a);
+  EXPECT_EQ(a.Set("int", 2).GetInt("int"), 2);
+  EXPECT_EQ(a.UnionWith(a), a);
+  EXPECT_EQ(ChannelArgs().UnionWith(a), a);
+  EXPECT_EQ(a.UnionWith(ChannelArgs()), a);
+}
+
 TEST(ChannelArgsTest, StoreRefCountedPtr) {
   struct Test : public RefCounted<Test> {
     explicit Test(int n) : n(n) {}
@@ -153,6 +153,37 @@ TEST(ChannelStackTest, CreateChannelStack) {
   grpc_slice_unref(path);
 }
 
+TEST(ChannelStackTest, LayoutIsSharedByIdenticalStacks) {
+  constexpr size_t kAlignment = GPR_MAX_ALIGNMENT;
+  grpc_channel_filter small_filter = {};
+  small_filter.sizeof_channel_data = 1;
+  small_filter.sizeof_call_data = 3;
+  grpc_channel_filter large_filter = {};
+  large_filter.sizeof_channel_data = kAlignment + 1;
+  large_filter.sizeof_call_data = 2 * kAlignment;
+  const grpc_channel_filter* filters[] = {&small_filter, &large_filter};
+  const grpc_core::ChannelStackLayout& layout =
+      grpc_core::GetChannelStackLayout(filters, 2);
+  EXPECT_EQ(&layout, &grpc_core::GetChannelStackLayout(filters, 2));
+  EXPECT_NE(&layout, &grpc_core::GetChannelStackLayout(filters, 1));
+  EXPECT_EQ(layout.channel_stack_size, grpc_channel_stack_size(filters, 2));
+  ASSERT_EQ(layout.channel_data_offsets.size(), 2u);
+  EXPECT_EQ(layout.channel_data_offsets[1] - layout.channel_data_offsets[0],
+            kAlignment);
+  EXPECT_EQ(layout.channel_stack_size - layout.channel_data_offsets[1],
+            2 * kAlignment);
+  ASSERT_EQ(layout.call_data_offsets.size(), 2u);
+  EXPECT_EQ(layout.call_data_offsets[0] % kAlignment, 0u);
+  EXPECT_EQ(layout.call_data_offsets[1] - layout.call_data_offsets[0],
+            kAlignment);
+  EXPECT_EQ(layout.call_stack_size - layout.call_data_offsets[1],
+            2 * kAlignment);
+  // A different filter at the same address must not reuse the layout.
+  large_filter.sizeof_call_data = 0;
+  EXPECT_EQ(grpc_core::GetChannelStackLayout(filters, 2).call_stack_size,
+            layout.call_data_offsets[1]);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,116 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/filters/client_channel/connection_attempt_scheduler.h"
+
+#include <string>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/gprpp/sync.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+// Records the order in which waiting attempts start.
+class StartLog {
+ public:
+  absl::AnyInvocable<void()> Start(int attempt) {
+    return [this, attempt]() {
+      MutexLock lock(&mu_);
+      order_.push_back(attempt);
+    };
+  }
+
+  std::vector<int> order() {
+    MutexLock lock(&mu_);
+    return order_;
+  }
+
+ private:
+  Mutex mu_;
+  std::vector<int> order_;
+};
+
+TEST(ConnectionAttemptSchedulerTest, StartsUpToTheLimitRightAway) {
+  auto* scheduler = ConnectionAttemptScheduler::Get();
+  const std::string address = "10.0.0.1:443";
+  StartLog log;
+  EXPECT_FALSE(
+      scheduler->RequestAttempt(address, 2, false, log.Start(1)).has_value());
+  EXPECT_FALSE(
+      scheduler->RequestAttempt(address, 2, false, log.Start(2)).has_value());
+  // Another address has its own limit.
+  EXPECT_FALSE(scheduler->RequestAttempt("10.0.0.2:443", 2, false, log.Start(3))
+                   .has_value());
+  auto waiting = scheduler->RequestAttempt(address, 2, false, log.Start(4));
+  ASSERT_TRUE(waiting.has_value());
+  EXPECT_TRUE(scheduler->HasWaitingAttempts());
+  EXPECT_TRUE(scheduler->CancelAttempt(address, *waiting));
+  EXPECT_FALSE(scheduler->HasWaitingAttempts());
+  scheduler->FinishAttempt(address);
+  scheduler->FinishAttempt(address);
+  scheduler->FinishAttempt("10.0.0.2:443");
+  // Callbacks only run for attempts that waited, and that one was cancelled.
+  EXPECT_TRUE(log.order().empty());
+}
+
+TEST(ConnectionAttemptSchedulerTest, StartsUrgentAttemptsFirst) {
+  auto* scheduler = ConnectionAttemptScheduler::Get();
+  const std::string address = "10.0.0.3:443";
+  StartLog log;
+  EXPECT_FALSE(
+      scheduler->RequestAttempt(address, 1, false, log.Start(0)).has_value());
+  auto normal = scheduler->RequestAttempt(address, 1, false, log.Start(1));
+  auto made_urgent = scheduler->RequestAttempt(address, 1, false, log.Start(2));
+  auto urgent = scheduler->RequestAttempt(address, 1, true, log.Start(3));
+  ASSERT_TRUE(normal.has_value());
+  ASSERT_TRUE(made_urgent.has_value());
+  ASSERT_TRUE(urgent.has_value());
+  scheduler->MakeUrgent(address, *made_urgent);
+  // Each finished attempt lets exactly one waiting attempt start.
+  for (int i = 0; i < 3; ++i) {
+    size_t before = log.order().size();
+    scheduler->FinishAttempt(address);
+    while (log.order().size() == before) absl::SleepFor(absl::Milliseconds(1));
+  }
+  EXPECT_EQ(log.order(), std::vector<int>({3, 2, 1}));
+  // A started attempt can no longer be cancelled.
+  EXPECT_FALSE(scheduler->CancelAttempt(address, *normal));
+  scheduler->FinishAttempt(address);
+  EXPECT_FALSE(scheduler->HasWaitingAttempts());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,260 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Benchmark LB policy pickers, alone and under contention, and the cost of
+// applying resolver updates to LB policies with many endpoints.
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "absl/types/span.h"
+#include "absl/types/variant.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/ring_hash/ring_hash.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/unique_type_name.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+#include "test/core/client_channel/lb_policy/lb_policy_test_lib.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+const int kEndpointsLow = 10;
+const int kEndpointsHigh = 10000;
+const int kRangeMultiplier = 10;
+
+// Drives an LB policy through the LoadBalancingPolicyTest fakes, with every
+// subchannel already READY, as in a channel that has been up for a while.
+class LbPolicyBenchmark : public LoadBalancingPolicyTest {
+ public:
+  LbPolicyBenchmark(absl::string_view policy_name, const Json& config)
+      : lb_policy_(MakeLbPolicy(policy_name)),
+        config_(MakeConfig(Json::Array{Json::Object{
+            {std::string(policy_name), config}}})) {}
+
+  ~LbPolicyBenchmark() override {
+    picker_.reset();
+    lb_policy_.reset();
+  }
+
+  // Returns the addresses of the first \a n endpoints, starting at \a first.
+  static std::vector<std::string> Addresses(int first, int n) {
+    std::vector<std::string> addresses;
+    addresses.reserve(n);
+    for (int i = first; i < first + n; ++i) {
+      addresses.push_back(
+          absl::StrCat("ipv4:10.0.", i / 256, ".", i % 256, ":443"));
+    }
+    return addresses;
+  }
+
+  // Creates READY subchannels for \a addresses, for updates to pick up.
+  void MakeReady(const std::vector<std::string>& addresses) {
+    for (const std::string& address : addresses) {
+      if (FindSubchannel(address) != nullptr) continue;
+      SubchannelState* subchannel = CreateSubchannel(address);
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+    }
+  }
+
+  // Sends \a addresses to the LB policy, and keeps the last picker that it
+  // reports in response.
+  void Update(const std::vector<std::string>& addresses) {
+    std::vector<absl::string_view> views(addresses.begin(), addresses.end());
+    GPR_ASSERT(ApplyUpdate(BuildUpdate(views, config_), lb_policy_.get())
+                   .ok());
+    while (!helper_->QueueEmpty()) {
+      auto update = helper_->GetNextStateUpdate();
+      if (!update.has_value()) break;
+      picker_ = std::move(update->picker);
+    }
+  }
+
+  void SetCallAttribute(UniqueTypeName name, std::string value) {
+    call_attributes_.emplace(name, std::move(value));
+  }
+
+  // Picks a subchannel, and reports the call on it as done, as the client
+  // channel does for each call. Safe to call from multiple threads.
+  void Pick() {
+    ExecCtx exec_ctx;
+    FakeMetadata metadata({});
+    std::map<UniqueTypeName, absl::string_view> attributes;
+    for (const auto& p : call_attributes_) {
+      attributes.emplace(p.first, p.second);
+    }
+    FakeCallState call_state(attributes);
+    auto result = picker_->Pick({"/service/method", &metadata, &call_state});
+    auto* complete =
+        absl::get_if<LoadBalancingPolicy::PickResult::Complete>(&result.result);
+    GPR_ASSERT(complete != nullptr);
+    if (complete->subchannel_call_tracker != nullptr) {
+      complete->subchannel_call_tracker->Start();
+      FakeMetadata trailing_metadata({});
+      FakeBackendMetricAccessor backend_metric_accessor(absl::nullopt);
+      complete->subchannel_call_tracker->Finish(
+          {"", absl::OkStatus(), &trailing_metadata, &backend_metric_accessor});
+    }
+  }
+
+ private:
+  void TestBody() override {}
+
+  OrphanablePtr<LoadBalancingPolicy> lb_policy_;
+  RefCountedPtr<LoadBalancingPolicy::Config> config_;
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_;
+  std::map<UniqueTypeName, std::string> call_attributes_;
+};
+
+struct RoundRobin {
+  static std::unique_ptr<LbPolicyBenchmark> Make() {
+    return std::make_unique<LbPolicyBenchmark>("round_robin", Json::Object());
+  }
+};
+
+struct WeightedRoundRobin {
+  static std::unique_ptr<LbPolicyBenchmark> Make() {
+    return std::make_unique<LbPolicyBenchmark>(
+        "weighted_round_robin_experimental", Json::Object());
+  }
+};
+
+struct RingHash {
+  static std::unique_ptr<LbPolicyBenchmark> Make() {
+    auto benchmark = std::make_unique<LbPolicyBenchmark>(
+        "ring_hash_experimental", Json::Object());
+    benchmark->SetCallAttribute(RequestHashAttributeName(), "1234567890");
+    return benchmark;
+  }
+};
+
+// Outlier detection counting every call's result around round_robin.
+struct OutlierDetection {
+  static std::unique_ptr<LbPolicyBenchmark> Make() {
+    return std::make_unique<LbPolicyBenchmark>(
+        "outlier_detection_experimental",
+        Json::Object{
+            {"successRateEjection", Json::Object()},
+            {"childPolicy",
+             Json::Array{Json::Object{{"round_robin", Json::Object()}}}}});
+  }
+};
+
+// Shared by the threads of a benchmark run: set up by thread 0 before the
+// loop and torn down after it, as the loop starts and ends on a barrier.
+std::unique_ptr<LbPolicyBenchmark>* g_benchmark;
+
+template <typename Policy>
+void BM_Pick(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    g_benchmark = new std::unique_ptr<LbPolicyBenchmark>(Policy::Make());
+    auto addresses = LbPolicyBenchmark::Addresses(0, state.range(0));
+    (*g_benchmark)->MakeReady(addresses);
+    (*g_benchmark)->Update(addresses);
+  }
+  for (auto _ : state) {
+    (*g_benchmark)->Pick();
+  }
+  if (state.thread_index() == 0) {
+    delete g_benchmark;
+    g_benchmark = nullptr;
+  }
+}
+BENCHMARK_TEMPLATE(BM_Pick, RoundRobin)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kEndpointsLow, kEndpointsHigh)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Pick, WeightedRoundRobin)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kEndpointsLow, kEndpointsHigh)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Pick, RingHash)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kEndpointsLow, kEndpointsHigh)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Pick, OutlierDetection)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kEndpointsLow, kEndpointsHigh)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+// Alternates between two address lists that differ by one endpoint, as a
+// resolver does when an endpoint comes and goes.
+template <typename Policy>
+void BM_Update(benchmark::State& state) {
+  auto benchmark = Policy::Make();
+  const std::vector<std::string> address_lists[] = {
+      LbPolicyBenchmark::Addresses(0, state.range(0)),
+      LbPolicyBenchmark::Addresses(1, state.range(0))};
+  for (const auto& addresses : address_lists) {
+    benchmark->MakeReady(addresses);
+  }
+  for (auto _ : state) {
+    benchmark->Update(address_lists[state.iterations() % 2]);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Update, RoundRobin)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kEndpointsLow, kEndpointsHigh);
+BENCHMARK_TEMPLATE(BM_Update, WeightedRoundRobin)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kEndpointsLow, kEndpointsHigh);
+BENCHMARK_TEMPLATE(BM_Update, RingHash)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kEndpointsLow, kEndpointsHigh);
+BENCHMARK_TEMPLATE(BM_Update, OutlierDetection)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kEndpointsLow, kEndpointsHigh);
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
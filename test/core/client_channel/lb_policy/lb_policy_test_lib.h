@@ -812,6 +812,7 @@ class LoadBalancingPolicyTest : public ::testing::Test {
       if (subchannel_call_tracker != nullptr) {
         *subchannel_call_tracker = std::move(complete->subchannel_call_tracker);
       } else {
+        ExecCtx exec_ctx;
         complete->subchannel_call_tracker->Start();
         FakeMetadata metadata({});
         FakeBackendMetricAccessor backend_metric_accessor({});
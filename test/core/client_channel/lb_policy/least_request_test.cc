@@ -0,0 +1,225 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <stddef.h>
+
+#include <array>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/ext/filters/client_channel/lb_policy/backend_metric_data.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/load_balancing/lb_policy.h"
+#include "test/core/client_channel/lb_policy/lb_policy_test_lib.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class LeastRequestTest : public LoadBalancingPolicyTest {
+ protected:
+  // A call that has been picked and started but not yet finished.
+  struct Call {
+    std::string address;
+    std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+        tracker;
+  };
+
+  LeastRequestTest()
+      : lb_policy_(MakeLbPolicy("least_request_experimental")) {}
+
+  static Json MakeJson(Json::Object fields) {
+    return Json::Array{
+        Json::Object{{"least_request_experimental", std::move(fields)}}};
+  }
+
+  // Picks and starts a call, leaving it in flight.
+  Call StartCall(LoadBalancingPolicy::SubchannelPicker* picker,
+                 SourceLocation location = SourceLocation()) {
+    Call call;
+    auto address = ExpectPickComplete(picker, {}, &call.tracker, location);
+    EXPECT_TRUE(address.has_value())
+        << location.file() << ":" << location.line();
+    EXPECT_NE(call.tracker, nullptr)
+        << location.file() << ":" << location.line();
+    if (address.has_value()) call.address = std::move(*address);
+    if (call.tracker != nullptr) call.tracker->Start();
+    return call;
+  }
+
+  static void FinishCall(
+      Call& call,
+      absl::optional<BackendMetricData> backend_metric_data = absl::nullopt) {
+    if (call.tracker == nullptr) return;
+    FakeMetadata metadata({});
+    FakeBackendMetricAccessor backend_metric_accessor(
+        std::move(backend_metric_data));
+    LoadBalancingPolicy::SubchannelCallTrackerInterface::FinishArgs args = {
+        call.address, absl::OkStatus(), &metadata, &backend_metric_accessor};
+    call.tracker->Finish(args);
+    call.tracker.reset();
+  }
+
+  // Starts num_calls calls on picker, holding all of them open so that
+  // each pick sees the load of the previous ones, then finishes them.
+  // Returns the set of addresses that were picked.
+  std::set<std::string> PickWhileHoldingCalls(
+      LoadBalancingPolicy::SubchannelPicker* picker, size_t num_calls,
+      SourceLocation location = SourceLocation()) {
+    std::vector<Call> calls;
+    std::set<std::string> addresses;
+    for (size_t i = 0; i < num_calls; ++i) {
+      calls.push_back(StartCall(picker, location));
+      addresses.insert(calls.back().address);
+    }
+    for (auto& call : calls) FinishCall(call);
+    return addresses;
+  }
+
+  // Brings up all addresses, checking after each one becomes READY that
+  // the picker spreads held calls over all READY addresses.  This needs
+  // choiceCount to be at least the number of addresses, so that every
+  // pick considers every address.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ExpectStartup(
+      absl::Span<const absl::string_view> addresses,
+      RefCountedPtr<LoadBalancingPolicy::Config> config) {
+    EXPECT_EQ(ApplyUpdate(BuildUpdate(addresses, std::move(config)),
+                          lb_policy_.get()),
+              absl::OkStatus());
+    // Expect the initial CONNECTNG update with a picker that queues.
+    ExpectConnectingUpdate();
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      auto* subchannel = FindSubchannel(addresses[i]);
+      EXPECT_NE(subchannel, nullptr) << "Address: " << addresses[i];
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested());
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+      std::set<std::string> expected(addresses.begin(),
+                                     addresses.begin() + i + 1);
+      if (i == 0) {
+        picker = WaitForConnected();
+        EXPECT_EQ(PickWhileHoldingCalls(picker.get(), 1), expected);
+      } else {
+        // Skip any number of duplicate updates for the previous set of
+        // READY subchannels.
+        WaitForStateUpdate([&](FakeHelper::StateUpdate update) {
+          EXPECT_EQ(update.state, GRPC_CHANNEL_READY);
+          picker = std::move(update.picker);
+          return PickWhileHoldingCalls(picker.get(), i + 1) != expected;
+        });
+      }
+    }
+    return picker;
+  }
+
+  OrphanablePtr<LoadBalancingPolicy> lb_policy_;
+};
+
+TEST_F(LeastRequestTest, Basic) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  ExpectStartup(kAddresses, MakeConfig(MakeJson({{"choiceCount", 3}})));
+}
+
+TEST_F(LeastRequestTest, PicksAddressWithFewestCallsInFlight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = ExpectStartup(kAddresses, MakeConfig(MakeJson({})));
+  ASSERT_NE(picker, nullptr);
+  Call call1 = StartCall(picker.get());
+  Call call2 = StartCall(picker.get());
+  EXPECT_NE(call1.address, call2.address);
+  // Once call2 finishes, its address is the only one left with nothing
+  // in flight, so every new call goes there.
+  FinishCall(call2);
+  for (size_t i = 0; i < 5; ++i) {
+    Call call = StartCall(picker.get());
+    EXPECT_EQ(call.address, call2.address);
+    FinishCall(call);
+  }
+  FinishCall(call1);
+}
+
+TEST_F(LeastRequestTest, UtilizationWeight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = ExpectStartup(
+      kAddresses, MakeConfig(MakeJson({{"utilizationWeight", 1}})));
+  ASSERT_NE(picker, nullptr);
+  Call call1 = StartCall(picker.get());
+  Call call2 = StartCall(picker.get());
+  ASSERT_NE(call1.address, call2.address);
+  Call& busy = call1.address == kAddresses[0] ? call1 : call2;
+  Call& idle = call1.address == kAddresses[0] ? call2 : call1;
+  // Address 0 reports that it is nearly saturated.
+  BackendMetricData backend_metric_data;
+  backend_metric_data.cpu_utilization = 0.9;
+  FinishCall(busy, backend_metric_data);
+  FinishCall(idle);
+  // Both addresses now have nothing in flight, but address 0 is busier.
+  for (size_t i = 0; i < 5; ++i) {
+    Call call = StartCall(picker.get());
+    EXPECT_EQ(call.address, kAddresses[1]);
+    FinishCall(call);
+  }
+  // Enough calls in flight on address 1 outweigh the utilization.
+  std::vector<Call> calls;
+  calls.push_back(StartCall(picker.get()));
+  calls.push_back(StartCall(picker.get()));
+  EXPECT_EQ(calls[0].address, kAddresses[1]);
+  EXPECT_EQ(calls[1].address, kAddresses[0]);
+  for (auto& call : calls) FinishCall(call);
+}
+
+TEST_F(LeastRequestTest, InvalidChoiceCount) {
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          MakeJson({{"choiceCount", 1}}));
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating least_request LB policy config: "
+                "[field:choiceCount error:must be at least 2]"));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,142 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/filters/client_channel/lb_policy/maglev/maglev_table.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr uint64_t kTableSize = MaglevTable::kDefaultTableSize;
+
+std::vector<std::string> MakeKeys(size_t num_keys) {
+  std::vector<std::string> keys;
+  for (size_t i = 0; i < num_keys; ++i) {
+    keys.push_back(absl::StrCat("10.0.", i / 250, ".", i % 250, ":443"));
+  }
+  return keys;
+}
+
+MaglevTable MakeTable(const std::vector<std::string>& keys,
+                      const std::vector<uint32_t>& weights = {}) {
+  std::vector<MaglevTable::Endpoint> endpoints;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    endpoints.push_back({keys[i], weights.empty() ? 1 : weights[i]});
+  }
+  return MaglevTable(endpoints, kTableSize);
+}
+
+std::vector<size_t> CountSlots(const MaglevTable& table,
+                               size_t num_endpoints) {
+  std::vector<size_t> counts(num_endpoints);
+  for (size_t i = 0; i < table.size(); ++i) {
+    EXPECT_LT(table[i], num_endpoints);
+    ++counts[table[i]];
+  }
+  return counts;
+}
+
+TEST(MaglevTableTest, IsPrime) {
+  EXPECT_FALSE(MaglevTable::IsPrime(0));
+  EXPECT_FALSE(MaglevTable::IsPrime(1));
+  EXPECT_TRUE(MaglevTable::IsPrime(2));
+  EXPECT_TRUE(MaglevTable::IsPrime(3));
+  EXPECT_FALSE(MaglevTable::IsPrime(4));
+  EXPECT_FALSE(MaglevTable::IsPrime(65536));
+  EXPECT_TRUE(MaglevTable::IsPrime(MaglevTable::kDefaultTableSize));
+  EXPECT_TRUE(MaglevTable::IsPrime(MaglevTable::kMaxTableSize));
+}
+
+TEST(MaglevTableTest, SingleEndpointOwnsEverySlot) {
+  MaglevTable table = MakeTable(MakeKeys(1));
+  EXPECT_EQ(table.size(), kTableSize);
+  EXPECT_EQ(CountSlots(table, 1)[0], kTableSize);
+}
+
+TEST(MaglevTableTest, EqualWeightsSpreadEvenly) {
+  constexpr size_t kNumEndpoints = 100;
+  MaglevTable table = MakeTable(MakeKeys(kNumEndpoints));
+  std::vector<size_t> counts = CountSlots(table, kNumEndpoints);
+  // Every endpoint claims one slot per round, so counts differ by at most 1.
+  EXPECT_LE(*std::max_element(counts.begin(), counts.end()) -
+                *std::min_element(counts.begin(), counts.end()),
+            1);
+}
+
+TEST(MaglevTableTest, SlotsFollowWeights) {
+  MaglevTable table = MakeTable(MakeKeys(3), {1, 2, 3});
+  std::vector<size_t> counts = CountSlots(table, 3);
+  EXPECT_NEAR(counts[0], kTableSize / 6.0, 2);
+  EXPECT_NEAR(counts[1], kTableSize * 2 / 6.0, 2);
+  EXPECT_NEAR(counts[2], kTableSize * 3 / 6.0, 2);
+}
+
+TEST(MaglevTableTest, LookupUsesHashModuloSize) {
+  MaglevTable table = MakeTable(MakeKeys(10));
+  for (uint64_t hash : {uint64_t{0}, uint64_t{12345}, kTableSize + 7,
+                        ~uint64_t{0}}) {
+    EXPECT_EQ(table.Lookup(hash), table[hash % kTableSize]);
+  }
+}
+
+TEST(MaglevTableTest, RemovingEndpointMovesFewOtherSlots) {
+  constexpr size_t kNumEndpoints = 100;
+  constexpr size_t kRemoved = 37;
+  std::vector<std::string> keys = MakeKeys(kNumEndpoints);
+  MaglevTable before = MakeTable(keys);
+  std::vector<std::string> remaining = keys;
+  remaining.erase(remaining.begin() + kRemoved);
+  MaglevTable after = MakeTable(remaining);
+  size_t moved = 0;
+  for (size_t i = 0; i < kTableSize; ++i) {
+    if (before[i] == kRemoved) continue;
+    if (keys[before[i]] != remaining[after[i]]) ++moved;
+  }
+  // Only the removed endpoint's slots have to move; allow a little churn
+  // on top of that, as the paper describes.
+  EXPECT_LT(moved, kTableSize / 50);
+}
+
+TEST(MaglevTableTest, AddingEndpointMovesFewOtherSlots) {
+  constexpr size_t kNumEndpoints = 100;
+  std::vector<std::string> keys = MakeKeys(kNumEndpoints);
+  MaglevTable before = MakeTable(keys);
+  std::vector<std::string> more = MakeKeys(kNumEndpoints + 1);
+  MaglevTable after = MakeTable(more);
+  size_t moved = 0;
+  for (size_t i = 0; i < kTableSize; ++i) {
+    if (after[i] == kNumEndpoints) continue;
+    if (keys[before[i]] != more[after[i]]) ++moved;
+  }
+  EXPECT_LT(moved, kTableSize / 50);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,8 +16,12 @@
 
 #include <stddef.h>
 
+#include <array>
+
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "gtest/gtest.h"
 
 #include <grpc/grpc.h>
@@ -70,6 +74,47 @@ TEST_F(PickFirstTest, Basic) {
   }
 }
 
+TEST_F(PickFirstTest, HappyEyeballsRacesSlowConnectionAttempt) {
+  // Two IPv6 addresses followed by an IPv4 one.  With the families
+  // interleaved, the IPv4 address is tried second.
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv6:[::1]:441", "ipv6:[::1]:442", "ipv4:127.0.0.1:443"};
+  const ChannelArgs kArgs =
+      ChannelArgs().Set(GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS,
+                        100);
+  LoadBalancingPolicy::UpdateArgs update = BuildUpdate(kAddresses);
+  update.args = kArgs;
+  absl::Status status = ApplyUpdate(std::move(update), lb_policy_.get());
+  EXPECT_TRUE(status.ok()) << status;
+  ExpectConnectingUpdate();
+  const ChannelArgs kSubchannelArgs =
+      kArgs.Set(GRPC_ARG_INHIBIT_HEALTH_CHECKING, true);
+  auto* subchannel1 = FindSubchannel(kAddresses[0], kSubchannelArgs);
+  ASSERT_NE(subchannel1, nullptr);
+  auto* subchannel2 = FindSubchannel(kAddresses[1], kSubchannelArgs);
+  ASSERT_NE(subchannel2, nullptr);
+  auto* subchannel3 = FindSubchannel(kAddresses[2], kSubchannelArgs);
+  ASSERT_NE(subchannel3, nullptr);
+  // The first attempt neither succeeds nor fails.
+  EXPECT_TRUE(subchannel1->ConnectionRequested());
+  subchannel1->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  // Once the attempt delay passes, the IPv4 address is tried alongside it.
+  absl::Time deadline = absl::Now() + absl::Seconds(5);
+  while (!subchannel3->ConnectionRequested()) {
+    ASSERT_LT(absl::Now(), deadline);
+    absl::SleepFor(absl::Milliseconds(10));
+  }
+  EXPECT_FALSE(subchannel2->ConnectionRequested());
+  // The IPv4 address connects first and is selected.
+  subchannel3->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel3->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[2]);
+  }
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
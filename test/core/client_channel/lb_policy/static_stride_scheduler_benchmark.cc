@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -100,6 +101,31 @@ BENCHMARK(BM_StaticStrideSchedulerMake)
     ->RangeMultiplier(kRangeMultiplier)
     ->Range(kNumWeightsLow, kNumWeightsHigh);
 
+// Like Weights(), but with every tenth weight zeroed, as for backends that
+// have not reported load yet.
+const std::vector<float>& WeightsWithZeros() {
+  static const NoDestruct<std::vector<float>> kWeights([] {
+    std::vector<float> weights = Weights();
+    for (size_t i = 0; i < weights.size(); i += 10) weights[i] = 0;
+    return weights;
+  }());
+  return *kWeights;
+}
+
+void BM_StaticStrideSchedulerMakeWithZeros(benchmark::State& state) {
+  uint32_t sequence = 0;
+  for (auto s : state) {
+    const absl::optional<StaticStrideScheduler> scheduler =
+        StaticStrideScheduler::Make(
+            absl::MakeSpan(WeightsWithZeros()).subspan(0, state.range(0)),
+            [&] { return sequence++; });
+    GPR_ASSERT(scheduler.has_value());
+  }
+}
+BENCHMARK(BM_StaticStrideSchedulerMakeWithZeros)
+    ->RangeMultiplier(kRangeMultiplier)
+    ->Range(kNumWeightsLow, kNumWeightsHigh);
+
 }  // namespace
 }  // namespace grpc_core
 
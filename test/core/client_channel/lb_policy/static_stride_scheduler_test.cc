@@ -91,6 +91,28 @@ TEST(StaticStrideSchedulerTest, ZeroWeightUsesMean) {
   EXPECT_THAT(picks, ElementsAre(3, 2, 1));
 }
 
+TEST(StaticStrideSchedulerTest, MaxAndZeroWeightsOutsideFirstBlock) {
+  // More weights than fit in the unrolled normalization loop, with the max
+  // in the remainder and zeros in both parts.
+  uint32_t sequence = 0;
+  const std::vector<float> weights = {1, 0, 1, 2, 2, 0, 4};
+  const absl::optional<StaticStrideScheduler> scheduler =
+      StaticStrideScheduler::Make(absl::MakeSpan(weights),
+                                  [&] { return sequence++; });
+  ASSERT_TRUE(scheduler.has_value());
+
+  // Zero weights get the mean of the others, 2.
+  const std::vector<int> expected = {1, 2, 1, 2, 2, 2, 4};
+  constexpr int kRounds = 1000;
+  std::vector<int> picks(weights.size());
+  for (int i = 0; i < 14 * kRounds; ++i) {
+    ++picks[scheduler->Pick()];
+  }
+  for (size_t i = 0; i < weights.size(); ++i) {
+    EXPECT_NEAR(picks[i], expected[i] * kRounds, kRounds / 100) << i;
+  }
+}
+
 TEST(StaticStrideSchedulerTest, AllWeightsEqualIsRoundRobin) {
   uint32_t sequence = 0;
   const std::vector<float> weights = {300, 300, 0};
@@ -0,0 +1,232 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/filters/client_channel/resolver/dns/dns_result_cache.h"
+
+#include <string.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/synchronization/notification.h"
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/pollset_set.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/lib/resolver/server_address.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::GetDefaultEventEngine;
+
+// Records the lookups started through it, and completes them on demand.
+class FakeDns {
+ public:
+  DnsResultCache::StartLookup Start() {
+    return [this](grpc_pollset_set* /*interested_parties*/,
+                  std::function<void(DnsResultCache::Result)> on_done) {
+      ++num_lookups_;
+      on_done_ = std::move(on_done);
+      return MakeOrphanable<Handle>(this);
+    };
+  }
+
+  void Finish(DnsResultCache::Result result) {
+    auto on_done = std::move(on_done_);
+    on_done_ = nullptr;
+    on_done(std::move(result));
+  }
+
+  int num_lookups() const { return num_lookups_; }
+  bool cancelled() const { return cancelled_; }
+
+ private:
+  class Handle : public Orphanable {
+   public:
+    explicit Handle(FakeDns* dns) : dns_(dns) {}
+
+    void Orphan() override {
+      if (dns_->on_done_ != nullptr) {
+        dns_->cancelled_ = true;
+        dns_->Finish({absl::CancelledError(), absl::nullopt, absl::nullopt});
+      }
+      delete this;
+    }
+
+   private:
+    FakeDns* dns_;
+  };
+
+  int num_lookups_ = 0;
+  bool cancelled_ = false;
+  std::function<void(DnsResultCache::Result)> on_done_;
+};
+
+DnsResultCache::Result MakeResult(int port) {
+  grpc_resolved_address address;
+  memset(&address, 0, sizeof(address));
+  address.len = static_cast<socklen_t>(port);
+  ServerAddressList addresses;
+  addresses.emplace_back(address, ChannelArgs());
+  return {std::move(addresses), absl::nullopt, absl::nullopt};
+}
+
+class DnsResultCacheTest : public ::testing::Test {
+ protected:
+  DnsResultCacheTest()
+      : event_engine_(GetDefaultEventEngine()),
+        interested_parties_(grpc_pollset_set_create()) {
+    DnsResultCache::Get()->Clear();
+  }
+
+  ~DnsResultCacheTest() override {
+    grpc_pollset_set_destroy(interested_parties_);
+  }
+
+  // Starts a lookup whose result is stored in *result.
+  OrphanablePtr<Orphanable> Lookup(
+      const std::string& key, Duration max_age, FakeDns* dns,
+      absl::optional<DnsResultCache::Result>* result,
+      absl::Notification* done = nullptr) {
+    return DnsResultCache::Get()->Lookup(
+        key, max_age, interested_parties_, event_engine_.get(), dns->Start(),
+        [result, done](const DnsResultCache::Result& r) {
+          *result = r;
+          if (done != nullptr) done->Notify();
+        });
+  }
+
+  ExecCtx exec_ctx_;
+  std::shared_ptr<EventEngine> event_engine_;
+  grpc_pollset_set* interested_parties_;
+};
+
+TEST_F(DnsResultCacheTest, ConcurrentLookupsShareOneQuery) {
+  FakeDns dns;
+  absl::optional<DnsResultCache::Result> result1;
+  absl::optional<DnsResultCache::Result> result2;
+  absl::optional<DnsResultCache::Result> other_result;
+  auto request1 = Lookup("shared", Duration::Zero(), &dns, &result1);
+  auto request2 = Lookup("shared", Duration::Zero(), &dns, &result2);
+  EXPECT_EQ(dns.num_lookups(), 1);
+  FakeDns other_dns;
+  auto other_request =
+      Lookup("other", Duration::Zero(), &other_dns, &other_result);
+  EXPECT_EQ(other_dns.num_lookups(), 1);
+  dns.Finish(MakeResult(1));
+  ASSERT_TRUE(result1.has_value());
+  ASSERT_TRUE(result2.has_value());
+  ASSERT_TRUE(result1->addresses.ok());
+  EXPECT_EQ(*result1->addresses, *MakeResult(1).addresses);
+  EXPECT_EQ(*result2->addresses, *MakeResult(1).addresses);
+  EXPECT_FALSE(other_result.has_value());
+  other_dns.Finish(MakeResult(2));
+  ASSERT_TRUE(other_result.has_value());
+  EXPECT_EQ(*other_result->addresses, *MakeResult(2).addresses);
+  // Without a max age, the result is not kept.
+  auto request3 = Lookup("shared", Duration::Zero(), &dns, &result1);
+  EXPECT_EQ(dns.num_lookups(), 2);
+  dns.Finish(MakeResult(1));
+}
+
+TEST_F(DnsResultCacheTest, CachesResultsForMaxAge) {
+  auto stats_before = global_stats().Collect();
+  FakeDns dns;
+  absl::optional<DnsResultCache::Result> result;
+  auto request = Lookup("cached", Duration::Minutes(1), &dns, &result);
+  dns.Finish(MakeResult(1));
+  ASSERT_TRUE(result.has_value());
+  // A request with a max age gets the cached result, asynchronously.
+  absl::optional<DnsResultCache::Result> cached_result;
+  absl::Notification done;
+  auto cached_request =
+      Lookup("cached", Duration::Minutes(1), &dns, &cached_result, &done);
+  done.WaitForNotification();
+  EXPECT_EQ(dns.num_lookups(), 1);
+  ASSERT_TRUE(cached_result.has_value());
+  EXPECT_EQ(*cached_result->addresses, *MakeResult(1).addresses);
+  // A request without one starts a new lookup.
+  auto uncached_request = Lookup("cached", Duration::Zero(), &dns, &result);
+  EXPECT_EQ(dns.num_lookups(), 2);
+  dns.Finish(MakeResult(1));
+  auto stats = global_stats().Collect()->Diff(*stats_before);
+  EXPECT_EQ(stats->dns_cache_hits, 1);
+  EXPECT_EQ(stats->dns_cache_misses, 2);
+}
+
+TEST_F(DnsResultCacheTest, FailuresAreNotCached) {
+  FakeDns dns;
+  absl::optional<DnsResultCache::Result> result;
+  auto request = Lookup("failed", Duration::Minutes(1), &dns, &result);
+  dns.Finish({absl::UnavailableError("no such name"), absl::nullopt,
+              absl::nullopt});
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->addresses.status(),
+            absl::UnavailableError("no such name"));
+  auto retry_request = Lookup("failed", Duration::Minutes(1), &dns, &result);
+  EXPECT_EQ(dns.num_lookups(), 2);
+  dns.Finish(MakeResult(1));
+}
+
+TEST_F(DnsResultCacheTest, CancellingLastRequestCancelsLookup) {
+  FakeDns dns;
+  absl::optional<DnsResultCache::Result> result1;
+  absl::optional<DnsResultCache::Result> result2;
+  auto request1 = Lookup("cancelled", Duration::Zero(), &dns, &result1);
+  auto request2 = Lookup("cancelled", Duration::Zero(), &dns, &result2);
+  request1.reset();
+  EXPECT_FALSE(dns.cancelled());
+  request2.reset();
+  EXPECT_TRUE(dns.cancelled());
+  // Cancelled requests are not notified.
+  EXPECT_FALSE(result1.has_value());
+  EXPECT_FALSE(result2.has_value());
+  // A later request starts a new lookup.
+  auto request3 = Lookup("cancelled", Duration::Zero(), &dns, &result1);
+  EXPECT_EQ(dns.num_lookups(), 2);
+  dns.Finish(MakeResult(1));
+  EXPECT_TRUE(result1.has_value());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -697,6 +697,120 @@ TEST_F(RetryParserTest, InvalidRetryPolicyPerAttemptRecvTimeoutBadValue) {
       << service_config.status();
 }
 
+TEST_F(RetryParserTest, ValidHedgingPolicy) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 3,\n"
+      "      \"hedgingDelay\": \"0.5s\",\n"
+      "      \"nonFatalStatusCodes\": [\"UNAVAILABLE\"]\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  const ChannelArgs args =
+      ChannelArgs().Set(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING, 1);
+  auto service_config = ServiceConfigImpl::Create(args, test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* vector_ptr =
+      (*service_config)
+          ->GetMethodParsedConfigVector(
+              grpc_slice_from_static_string("/TestServ/TestMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  const auto* parsed_config = static_cast<internal::RetryMethodConfig*>(
+      ((*vector_ptr)[parser_index_]).get());
+  ASSERT_NE(parsed_config, nullptr);
+  const auto* hedging_policy = parsed_config->hedging_policy();
+  ASSERT_NE(hedging_policy, nullptr);
+  EXPECT_EQ(hedging_policy->max_attempts(), 3);
+  EXPECT_EQ(hedging_policy->hedging_delay(), Duration::Milliseconds(500));
+  EXPECT_TRUE(hedging_policy->non_fatal_status_codes().Contains(
+      GRPC_STATUS_UNAVAILABLE));
+  EXPECT_FALSE(
+      hedging_policy->non_fatal_status_codes().Contains(GRPC_STATUS_ABORTED));
+}
+
+TEST_F(RetryParserTest, HedgingPolicyIgnoredWithoutHedgingEnabled) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 3\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* vector_ptr =
+      (*service_config)
+          ->GetMethodParsedConfigVector(
+              grpc_slice_from_static_string("/TestServ/TestMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  EXPECT_EQ(((*vector_ptr)[parser_index_]).get(), nullptr);
+}
+
+TEST_F(RetryParserTest, InvalidHedgingPolicyMaxAttemptsBadValue) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 1,\n"
+      "      \"nonFatalStatusCodes\": [\"FOO\"]\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  const ChannelArgs args =
+      ChannelArgs().Set(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING, 1);
+  auto service_config = ServiceConfigImpl::Create(args, test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:methodConfig[0].hedgingPolicy.maxAttempts "
+            "error:must be at least 2; "
+            "field:methodConfig[0].hedgingPolicy.nonFatalStatusCodes[0] "
+            "error:failed to parse status code]")
+      << service_config.status();
+}
+
+TEST_F(RetryParserTest, InvalidBothRetryAndHedgingPolicy) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"retryPolicy\": {\n"
+      "      \"maxAttempts\": 2,\n"
+      "      \"initialBackoff\": \"1s\",\n"
+      "      \"maxBackoff\": \"120s\",\n"
+      "      \"backoffMultiplier\": 1.6,\n"
+      "      \"retryableStatusCodes\": [\"ABORTED\"]\n"
+      "    },\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 3\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  const ChannelArgs args =
+      ChannelArgs().Set(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING, 1);
+  auto service_config = ServiceConfigImpl::Create(args, test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:methodConfig[0].hedgingPolicy "
+            "error:may not be set when retryPolicy is set]")
+      << service_config.status();
+}
+
 }  // namespace testing
 }  // namespace grpc_core
 
@@ -14,72 +14,119 @@
 
 #include "src/core/ext/filters/channel_idle/idle_filter_state.h"
 
+#include <atomic>
 #include <chrono>
 #include <random>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "absl/types/optional.h"
 #include "gtest/gtest.h"
 
+#include <grpc/grpc.h>
+
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+
 namespace grpc_core {
 namespace testing {
 
-TEST(IdleFilterStateTest, IdlenessStartsTimer) {
+constexpr Duration kTimeout = Duration::Seconds(5);
+
+class IdleFilterStateTest : public ::testing::Test {
+ protected:
+  // Some time well past the process epoch.
+  const Timestamp start_ = Timestamp::FromMillisecondsAfterProcessEpoch(100000);
+
+  void SetNow(Timestamp now) { exec_ctx_.TestOnlySetNow(now); }
+
+ private:
+  ExecCtx exec_ctx_;
+};
+
+TEST_F(IdleFilterStateTest, FirstCallStartsTimer) {
   IdleFilterState s(false);
-  s.IncreaseCallCount();
-  // First idle should start the timer
-  EXPECT_TRUE(s.DecreaseCallCount());
+  // First call should start the timer
+  EXPECT_TRUE(s.IncreaseCallCount());
+  s.DecreaseCallCount();
   for (int i = 0; i < 10; i++) {
-    // Next idle should not!
-    s.IncreaseCallCount();
-    EXPECT_FALSE(s.DecreaseCallCount());
+    // Next calls should not!
+    EXPECT_FALSE(s.IncreaseCallCount());
+    s.DecreaseCallCount();
   }
 }
 
-TEST(IdleFilterStateTest, TimerStopsAfterIdle) {
+TEST_F(IdleFilterStateTest, TimerStopsAfterIdle) {
+  SetNow(start_);
   IdleFilterState s(true);
-  EXPECT_FALSE(s.CheckTimer());
+  EXPECT_EQ(s.CheckTimer(kTimeout), absl::nullopt);
+  // Once stopped, the next call starts it again.
+  EXPECT_TRUE(s.IncreaseCallCount());
 }
 
-TEST(IdleFilterStateTest, TimerKeepsGoingWithActivity) {
+TEST_F(IdleFilterStateTest, TimerWaitsForTimeoutAfterLastCall) {
+  SetNow(start_);
   IdleFilterState s(true);
-  for (int i = 0; i < 10; i++) {
-    s.IncreaseCallCount();
-    (void)s.DecreaseCallCount();
-    EXPECT_TRUE(s.CheckTimer());
+  EXPECT_FALSE(s.IncreaseCallCount());
+  SetNow(start_ + Duration::Seconds(1));
+  s.DecreaseCallCount();
+  SetNow(start_ + Duration::Seconds(3));
+  EXPECT_EQ(s.CheckTimer(kTimeout), start_ + Duration::Seconds(6));
+  SetNow(start_ + Duration::Seconds(6));
+  EXPECT_EQ(s.CheckTimer(kTimeout), absl::nullopt);
+}
+
+TEST_F(IdleFilterStateTest, TimerKeepsGoingWhileCallsInProgress) {
+  SetNow(start_);
+  IdleFilterState s(true);
+  EXPECT_FALSE(s.IncreaseCallCount());
+  for (int i = 1; i <= 10; i++) {
+    SetNow(start_ + kTimeout * i);
+    EXPECT_EQ(s.CheckTimer(kTimeout), start_ + kTimeout * (i + 1));
   }
-  EXPECT_FALSE(s.CheckTimer());
+  s.DecreaseCallCount();
+  SetNow(start_ + kTimeout * 12);
+  EXPECT_EQ(s.CheckTimer(kTimeout), absl::nullopt);
 }
 
-TEST(IdleFilterStateTest, StressTest) {
+TEST_F(IdleFilterStateTest, StressTest) {
   IdleFilterState s(false);
   std::atomic<bool> done{false};
-  int idle_polls = 0;
-  int thread_jumps = 0;
+  std::atomic<int> idle_polls{0};
+  std::atomic<int> timer_runs{0};
   std::vector<std::thread> threads;
   for (int idx = 0; idx < 10; idx++) {
     std::thread t([&] {
+      ExecCtx exec_ctx;
       int ctr = 0;
+      bool start_timer = false;
       auto increase = [&] {
-        s.IncreaseCallCount();
+        if (s.IncreaseCallCount()) {
+          EXPECT_FALSE(start_timer);
+          start_timer = true;
+        }
         ctr++;
       };
       auto decrease = [&] {
         ctr--;
-        if (s.DecreaseCallCount()) {
-          thread_jumps++;
-          if (thread_jumps == 10) done.store(true, std::memory_order_relaxed);
-          EXPECT_EQ(ctr, 0);
-          do {
-            idle_polls++;
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-          } while (s.CheckTimer());
-        }
+        s.DecreaseCallCount();
+      };
+      // Runs the timer, once this thread started it and holds no calls.
+      auto run_timer = [&] {
+        if (!start_timer) return;
+        start_timer = false;
+        do {
+          idle_polls++;
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+          exec_ctx.InvalidateNow();
+        } while (s.CheckTimer(Duration::Milliseconds(20)).has_value());
+        if (++timer_runs == 10) done.store(true, std::memory_order_relaxed);
       };
       std::mt19937 g{std::random_device()()};
       while (!done.load(std::memory_order_relaxed)) {
         std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        exec_ctx.InvalidateNow();
         for (int i = 0; i < 100; i++) {
           if (g() & 1) {
             increase();
@@ -90,10 +137,12 @@ TEST(IdleFilterStateTest, StressTest) {
         while (ctr > 0) {
           decrease();
         }
+        run_timer();
       }
       while (ctr > 0) {
         decrease();
       }
+      run_timer();
     });
     threads.emplace_back(std::move(t));
   }
@@ -105,5 +154,8 @@ TEST(IdleFilterStateTest, StressTest) {
 
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
-  return RUN_ALL_TESTS();
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
 }
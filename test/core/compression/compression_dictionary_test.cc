@@ -0,0 +1,178 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/compression/compression_dictionary.h"
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/service_config/service_config_impl.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "test/core/util/test_config.h"
+
+#ifdef HAVE_LIBZSTD
+#include <zdict.h>
+#endif
+
+namespace grpc_core {
+namespace testing {
+
+TEST(CompressionDictionaryTest, RejectsDataThatIsNotADictionary) {
+  auto dictionary = CompressionDictionary::Create("not a zstd dictionary");
+  EXPECT_EQ(dictionary.status().code(),
+            IsCompressionAlgorithmSupported(GRPC_COMPRESS_ZSTD)
+                ? absl::StatusCode::kInvalidArgument
+                : absl::StatusCode::kUnimplemented)
+      << dictionary.status();
+}
+
+TEST(CompressionDictionaryTest, EmptySetFindsNothing) {
+  CompressionDictionarySet dictionaries;
+  EXPECT_EQ(dictionaries.Find(1), nullptr);
+}
+
+TEST(CompressionParserTest, InvalidBase64) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"zstdDictionary\": \"not base64!\"\n"
+      "  } ]\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:methodConfig[0].zstdDictionary error:not valid base64]")
+      << service_config.status();
+}
+
+#ifdef HAVE_LIBZSTD
+
+// Messages sharing most of their bytes, like small protobufs of one type.
+std::vector<std::string> MakeSamples(size_t count) {
+  std::vector<std::string> samples;
+  for (size_t i = 0; i < count; i++) {
+    samples.push_back(absl::StrCat("{\"user_id\": ", i * 7919,
+                                   ", \"region\": \"europe-west", i % 4,
+                                   "\", \"status\": \"ACTIVE\", \"tags\": "
+                                   "[\"premium\", \"verified\"]}"));
+  }
+  return samples;
+}
+
+// Builds a dictionary with the given ID from MakeSamples().
+std::string MakeDictionary(uint32_t id) {
+  std::string all;
+  std::vector<size_t> sizes;
+  for (const std::string& sample : MakeSamples(1000)) {
+    all += sample;
+    sizes.push_back(sample.size());
+  }
+  std::string dictionary(4096, '\0');
+  ZDICT_params_t params = {};
+  params.dictID = id;
+  const size_t size = ZDICT_finalizeDictionary(
+      &dictionary[0], dictionary.size(), all.data(), 2048, all.data(),
+      sizes.data(), static_cast<unsigned>(sizes.size()), params);
+  GPR_ASSERT(!ZDICT_isError(size));
+  dictionary.resize(size);
+  return dictionary;
+}
+
+TEST(CompressionDictionaryTest, RoundTripsAndBeatsPlainZstd) {
+  auto dictionary = CompressionDictionary::Create(MakeDictionary(42));
+  ASSERT_TRUE(dictionary.ok()) << dictionary.status();
+  EXPECT_EQ((*dictionary)->id(), 42u);
+  DictionaryCompressor compressor;
+  const std::string message = MakeSamples(1001).back();
+  SliceBuffer input;
+  input.Append(Slice::FromCopiedString(message));
+  SliceBuffer with_dictionary;
+  ASSERT_TRUE(compressor.Compress(**dictionary, GRPC_COMPRESS_LEVEL_NONE,
+                                  input.c_slice_buffer(),
+                                  with_dictionary.c_slice_buffer()));
+  SliceBuffer without_dictionary;
+  grpc_msg_compress(GRPC_COMPRESS_ZSTD, input.c_slice_buffer(),
+                    without_dictionary.c_slice_buffer());
+  EXPECT_LT(with_dictionary.Length(), without_dictionary.Length());
+  SliceBuffer output;
+  ASSERT_TRUE(compressor.Decompress(**dictionary,
+                                    with_dictionary.c_slice_buffer(),
+                                    output.c_slice_buffer()));
+  EXPECT_EQ(output.JoinIntoString(), message);
+}
+
+TEST(CompressionDictionaryTest, DecompressesFramesWithoutDictionary) {
+  auto dictionary = CompressionDictionary::Create(MakeDictionary(42));
+  ASSERT_TRUE(dictionary.ok()) << dictionary.status();
+  DictionaryCompressor compressor;
+  const std::string message(1000, 'x');
+  SliceBuffer input;
+  input.Append(Slice::FromCopiedString(message));
+  SliceBuffer compressed;
+  ASSERT_TRUE(grpc_msg_compress(GRPC_COMPRESS_ZSTD, input.c_slice_buffer(),
+                                compressed.c_slice_buffer()));
+  SliceBuffer output;
+  ASSERT_TRUE(compressor.Decompress(**dictionary, compressed.c_slice_buffer(),
+                                    output.c_slice_buffer()));
+  EXPECT_EQ(output.JoinIntoString(), message);
+}
+
+TEST(CompressionDictionaryTest, FailsOnFramesFromAnotherDictionary) {
+  auto dictionary = CompressionDictionary::Create(MakeDictionary(42));
+  ASSERT_TRUE(dictionary.ok()) << dictionary.status();
+  auto other = CompressionDictionary::Create(MakeDictionary(43));
+  ASSERT_TRUE(other.ok()) << other.status();
+  DictionaryCompressor compressor;
+  SliceBuffer input;
+  input.Append(Slice::FromCopiedString(MakeSamples(1).back()));
+  SliceBuffer compressed;
+  ASSERT_TRUE(compressor.Compress(**other, GRPC_COMPRESS_LEVEL_HIGH,
+                                  input.c_slice_buffer(),
+                                  compressed.c_slice_buffer()));
+  SliceBuffer output;
+  EXPECT_FALSE(compressor.Decompress(**dictionary, compressed.c_slice_buffer(),
+                                     output.c_slice_buffer()));
+}
+
+#endif  // HAVE_LIBZSTD
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
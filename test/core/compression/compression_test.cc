@@ -25,16 +25,16 @@
 #include <grpc/slice.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/gpr/useful.h"
 #include "test/core/util/test_config.h"
 
 TEST(CompressionTest, CompressionAlgorithmParse) {
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd", "lz4"};
   const grpc_compression_algorithm valid_algorithms[] = {
-      GRPC_COMPRESS_NONE,
-      GRPC_COMPRESS_GZIP,
-      GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD, GRPC_COMPRESS_LZ4,
   };
   const char* invalid_names[] = {"gzip2", "foo", "", "2gzip"};
 
@@ -64,11 +64,10 @@ TEST(CompressionTest, CompressionAlgorithmName) {
   int success;
   const char* name;
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate"};
+  const char* valid_names[] = {"identity", "gzip", "deflate", "zstd", "lz4"};
   const grpc_compression_algorithm valid_algorithms[] = {
-      GRPC_COMPRESS_NONE,
-      GRPC_COMPRESS_GZIP,
-      GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_ZSTD, GRPC_COMPRESS_LZ4,
   };
 
   gpr_log(GPR_DEBUG, "test_compression_algorithm_name");
@@ -205,6 +204,28 @@ TEST(CompressionTest, CompressionAlgorithmForLevel) {
   }
 }
 
+TEST(CompressionTest, CompressionAlgorithmForLevelPrefersFastCodecs) {
+  uint32_t accepted_encodings = 0;
+  grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_NONE);  // always
+  grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_GZIP);
+  grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_DEFLATE);
+  grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_ZSTD);
+  grpc_core::SetBit(&accepted_encodings, GRPC_COMPRESS_LZ4);
+
+  const bool have_zstd =
+      grpc_core::IsCompressionAlgorithmSupported(GRPC_COMPRESS_ZSTD);
+  const bool have_lz4 =
+      grpc_core::IsCompressionAlgorithmSupported(GRPC_COMPRESS_LZ4);
+  // Codecs missing from this build are never chosen, even if the peer accepts
+  // them.
+  ASSERT_EQ(have_lz4 ? GRPC_COMPRESS_LZ4 : GRPC_COMPRESS_GZIP,
+            grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_LOW,
+                                                 accepted_encodings));
+  ASSERT_EQ(have_zstd ? GRPC_COMPRESS_ZSTD : GRPC_COMPRESS_DEFLATE,
+            grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_HIGH,
+                                                 accepted_encodings));
+}
+
 TEST(CompressionTest, CompressionEnableDisableAlgorithm) {
   grpc_compression_options options;
   grpc_compression_algorithm algorithm;
@@ -28,6 +28,7 @@
 #include <grpc/slice_buffer.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/util/slice_splitter.h"
@@ -113,7 +114,10 @@ static grpc_slice repeated(char c, size_t length) {
 
 static compressability get_compressability(
     test_value id, grpc_compression_algorithm algorithm) {
-  if (algorithm == GRPC_COMPRESS_NONE) return SHOULD_NOT_COMPRESS;
+  if (algorithm == GRPC_COMPRESS_NONE ||
+      !grpc_core::IsCompressionAlgorithmSupported(algorithm)) {
+    return SHOULD_NOT_COMPRESS;
+  }
   switch (id) {
     case ONE_A:
       return SHOULD_NOT_COMPRESS;
@@ -301,6 +305,92 @@ TEST(MessageCompressTest, BadDecompressionAlgorithm) {
   grpc_slice_buffer_destroy(&output);
 }
 
+TEST(MessageCompressTest, CompressWithLevel) {
+  const grpc_compression_level levels[] = {
+      GRPC_COMPRESS_LEVEL_NONE, GRPC_COMPRESS_LEVEL_LOW,
+      GRPC_COMPRESS_LEVEL_MED, GRPC_COMPRESS_LEVEL_HIGH};
+  grpc_slice value = create_test_value(ONE_MB_A);
+  for (int i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    const auto algorithm = static_cast<grpc_compression_algorithm>(i);
+    if (algorithm == GRPC_COMPRESS_NONE ||
+        !grpc_core::IsCompressionAlgorithmSupported(algorithm)) {
+      continue;
+    }
+    for (grpc_compression_level level : levels) {
+      grpc_core::ExecCtx exec_ctx;
+      grpc_slice_buffer input;
+      grpc_slice_buffer compressed;
+      grpc_slice_buffer output;
+      grpc_slice_buffer_init(&input);
+      grpc_slice_buffer_init(&compressed);
+      grpc_slice_buffer_init(&output);
+      grpc_slice_buffer_add(&input, grpc_slice_ref(value));
+      ASSERT_EQ(1, grpc_msg_compress_with_level(algorithm, level, &input,
+                                                &compressed));
+      ASSERT_LT(compressed.length, input.length);
+      ASSERT_EQ(1, grpc_msg_decompress(algorithm, &compressed, &output));
+      grpc_slice final = grpc_slice_merge(output.slices, output.count);
+      ASSERT_TRUE(grpc_slice_eq(value, final));
+      grpc_slice_unref(final);
+      grpc_slice_buffer_destroy(&input);
+      grpc_slice_buffer_destroy(&compressed);
+      grpc_slice_buffer_destroy(&output);
+    }
+  }
+  grpc_slice_unref(value);
+}
+
+TEST(MessageCompressTest, DeflateStream) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::DeflateStreamCompressor compressor;
+  grpc_core::DeflateStreamDecompressor decompressor;
+  const char kMessage[] =
+      "{\"user\": \"someone\", \"status\": \"online\", \"seq\": 1}";
+  size_t first_size = 0;
+  for (int i = 0; i < 10; i++) {
+    grpc_slice value = grpc_slice_from_static_string(kMessage);
+    grpc_slice_buffer input;
+    grpc_slice_buffer compressed;
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&input);
+    grpc_slice_buffer_init(&compressed);
+    grpc_slice_buffer_init(&output);
+    grpc_split_slices_to_buffer(GRPC_SLICE_SPLIT_ONE_BYTE, &value, 1, &input);
+    ASSERT_TRUE(compressor.Compress(GRPC_COMPRESS_LEVEL_NONE, &input,
+                                    &compressed));
+    if (i == 0) {
+      first_size = compressed.length;
+    } else {
+      // Later messages are compressed against the first.
+      EXPECT_LT(compressed.length, first_size / 2);
+    }
+    ASSERT_TRUE(decompressor.Decompress(&compressed, &output));
+    grpc_slice final = grpc_slice_merge(output.slices, output.count);
+    EXPECT_TRUE(grpc_slice_eq(value, final));
+    grpc_slice_unref(final);
+    grpc_slice_buffer_destroy(&input);
+    grpc_slice_buffer_destroy(&compressed);
+    grpc_slice_buffer_destroy(&output);
+  }
+}
+
+TEST(MessageCompressTest, DeflateStreamBadData) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::DeflateStreamDecompressor decompressor;
+  grpc_slice_buffer input;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&output);
+  // A reserved block type.
+  grpc_slice_buffer_add(&input, grpc_slice_from_copied_string("\xff\xff"));
+  EXPECT_FALSE(decompressor.Decompress(&input, &output));
+  EXPECT_EQ(output.length, 0);
+  // The context is unusable afterwards.
+  EXPECT_FALSE(decompressor.Decompress(&input, &output));
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&output);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,127 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/debug/event_ring.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/strings/match.h"
+#include "gtest/gtest.h"
+
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+
+using Event = EventRing::Event;
+
+class EventRingTest : public ::testing::Test {
+ protected:
+  void SetUp() override { EventRing::Clear(); }
+};
+
+TEST_F(EventRingTest, RecordsEveryEventAtRateOne) {
+  EventRing::SetSampleRate(1);
+  std::thread([] {
+    EventRing::Record(Event::kCallStart, 1);
+    EventRing::Record(Event::kFrameRead, (uint64_t{1} << 32) | 42);
+    EventRing::Record(Event::kCallFinish, 1);
+  }).join();
+  std::vector<EventRing::Entry> entries = EventRing::Snapshot();
+  ASSERT_EQ(entries.size(), 3);
+  EXPECT_EQ(entries[0].event, Event::kCallStart);
+  EXPECT_EQ(entries[1].event, Event::kFrameRead);
+  EXPECT_EQ(entries[1].arg, (uint64_t{1} << 32) | 42);
+  EXPECT_EQ(entries[2].event, Event::kCallFinish);
+  EXPECT_LE(entries[0].when, entries[2].when);
+}
+
+TEST_F(EventRingTest, SamplesOneInN) {
+  EventRing::SetSampleRate(4);
+  // A new thread starts sampling with its first event.
+  std::thread([] {
+    for (int i = 0; i < 40; ++i) {
+      EventRing::Record(Event::kPollerWakeup, i);
+    }
+  }).join();
+  std::vector<EventRing::Entry> entries = EventRing::Snapshot();
+  ASSERT_EQ(entries.size(), 10);
+  for (size_t i = 0; i < entries.size(); ++i) {
+    EXPECT_EQ(entries[i].arg, 4 * i);
+  }
+}
+
+TEST_F(EventRingTest, RecordsNothingWhenDisabled) {
+  EventRing::SetSampleRate(0);
+  std::thread([] {
+    for (int i = 0; i < 100; ++i) {
+      EventRing::Record(Event::kTimerFire);
+    }
+  }).join();
+  EXPECT_TRUE(EventRing::Snapshot().empty());
+}
+
+TEST_F(EventRingTest, KeepsTheMostRecentEvents) {
+  EventRing::SetSampleRate(1);
+  constexpr uint64_t kEvents = 3 * EventRing::kEntriesPerCpu;
+  std::thread([] {
+    for (uint64_t i = 0; i < kEvents; ++i) {
+      EventRing::Record(Event::kFrameWrite, i);
+    }
+  }).join();
+  std::vector<EventRing::Entry> entries = EventRing::Snapshot();
+  ASSERT_FALSE(entries.empty());
+  EXPECT_LE(entries.size(), kEvents);
+  EXPECT_EQ(entries.back().arg, kEvents - 1);
+}
+
+TEST_F(EventRingTest, SnapshotsWhileRecording) {
+  EventRing::SetSampleRate(1);
+  std::atomic<bool> done{false};
+  std::thread writer([&done] {
+    while (!done.load(std::memory_order_relaxed)) {
+      EventRing::Record(Event::kFrameWrite, 1234);
+    }
+  });
+  for (int i = 0; i < 100; ++i) {
+    for (const EventRing::Entry& entry : EventRing::Snapshot()) {
+      EXPECT_EQ(entry.event, Event::kFrameWrite);
+      EXPECT_EQ(entry.arg, 1234);
+    }
+  }
+  done.store(true, std::memory_order_relaxed);
+  writer.join();
+}
+
+TEST_F(EventRingTest, DumpsChromeTrace) {
+  EventRing::SetSampleRate(1);
+  std::thread([] { EventRing::Record(Event::kFrameRead, 7); }).join();
+  std::string trace = EventRing::DumpChromeTrace();
+  EXPECT_TRUE(absl::StartsWith(trace, "{\"traceEvents\":[{")) << trace;
+  EXPECT_TRUE(absl::EndsWith(trace, "}]}")) << trace;
+  EXPECT_TRUE(absl::StrContains(trace, "\"name\":\"frame_read\"")) << trace;
+  EXPECT_TRUE(absl::StrContains(trace, "\"args\":{\"arg\":7}")) << trace;
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
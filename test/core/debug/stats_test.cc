@@ -52,6 +52,31 @@ TEST(StatsTest, IncSpecificCounter) {
   EXPECT_EQ(snapshot->delta()->client_calls_created, 1);
 }
 
+TEST(StatsTest, ScraperReportsDeltaSinceLastScrape) {
+  ExecCtx exec_ctx;
+  GlobalStatsScraper scraper;
+  auto first = scraper.Scrape();
+  EXPECT_EQ(first.delta->client_calls_created,
+            first.total->client_calls_created);
+  global_stats().IncrementClientCallsCreated();
+  global_stats().IncrementClientCallsCreated();
+  global_stats().IncrementHttp2WriteFlushDelayUs(100);
+  auto second = scraper.Scrape();
+  EXPECT_EQ(second.delta->client_calls_created, 2);
+  EXPECT_EQ(second.total->client_calls_created,
+            first.total->client_calls_created + 2);
+  HistogramView delay =
+      second.delta->histogram(GlobalStats::Histogram::kHttp2WriteFlushDelayUs);
+  EXPECT_EQ(delay.Count(), 1);
+  EXPECT_EQ(delay.buckets[delay.bucket_for(100)], 1);
+  EXPECT_EQ(scraper.Scrape().delta->client_calls_created, 0);
+}
+
+TEST(StatsTest, MicrosecondsSince) {
+  EXPECT_GE(MicrosecondsSince(gpr_get_cycle_counter()), 0);
+  EXPECT_LT(MicrosecondsSince(gpr_get_cycle_counter()), 1000000);
+}
+
 static int FindExpectedBucket(const HistogramView& h, int value) {
   if (value < 0) {
     return 0;
@@ -146,6 +146,8 @@ extern void retry_exceeds_buffer_size_in_initial_batch(grpc_end2end_test_config
 extern void retry_exceeds_buffer_size_in_initial_batch_pre_init(void);
 extern void retry_exceeds_buffer_size_in_subsequent_batch(grpc_end2end_test_config config);
 extern void retry_exceeds_buffer_size_in_subsequent_batch_pre_init(void);
+extern void retry_hedging(grpc_end2end_test_config config);
+extern void retry_hedging_pre_init(void);
 extern void retry_lb_drop(grpc_end2end_test_config config);
 extern void retry_lb_drop_pre_init(void);
 extern void retry_lb_fail(grpc_end2end_test_config config);
@@ -279,6 +281,7 @@ void grpc_end2end_tests_pre_init(void) {
   retry_exceeds_buffer_size_in_delay_pre_init();
   retry_exceeds_buffer_size_in_initial_batch_pre_init();
   retry_exceeds_buffer_size_in_subsequent_batch_pre_init();
+  retry_hedging_pre_init();
   retry_lb_drop_pre_init();
   retry_lb_fail_pre_init();
   retry_non_retriable_status_pre_init();
@@ -382,6 +385,7 @@ void grpc_end2end_tests(int argc, char **argv,
     retry_exceeds_buffer_size_in_delay(config);
     retry_exceeds_buffer_size_in_initial_batch(config);
     retry_exceeds_buffer_size_in_subsequent_batch(config);
+    retry_hedging(config);
     retry_lb_drop(config);
     retry_lb_fail(config);
     retry_non_retriable_status(config);
@@ -650,6 +654,10 @@ void grpc_end2end_tests(int argc, char **argv,
       retry_exceeds_buffer_size_in_subsequent_batch(config);
       continue;
     }
+    if (0 == strcmp("retry_hedging", argv[i])) {
+      retry_hedging(config);
+      continue;
+    }
     if (0 == strcmp("retry_lb_drop", argv[i])) {
       retry_lb_drop(config);
       continue;
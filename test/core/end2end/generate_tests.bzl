@@ -311,6 +311,7 @@ END2END_TESTS = {
         short_name = "retry_exceeds_buffer_size_in_subseq",
         needs_retry = True,
     ),
+    "retry_hedging": _test_options(needs_client_channel = True, needs_retry = True),
     "retry_lb_drop": _test_options(needs_client_channel = True, needs_retry = True),
     "retry_lb_fail": _test_options(needs_client_channel = True, needs_retry = True),
     "retry_non_retriable_status": _test_options(needs_client_channel = True, needs_retry = True),
@@ -34,6 +34,7 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/bitset.h"
 #include "src/core/lib/surface/call.h"
@@ -279,7 +280,8 @@ static void request_with_payload_template_inner(
     grpc_compression_algorithm expected_algorithm_from_server,
     grpc_metadata* client_init_metadata, bool set_server_level,
     grpc_compression_level server_compression_level,
-    bool send_message_before_initial_metadata, bool decompress_in_core) {
+    bool send_message_before_initial_metadata, bool decompress_in_core,
+    int offload_threshold) {
   grpc_call* c;
   grpc_call* s;
   grpc_slice request_payload_slice;
@@ -325,6 +327,12 @@ static void request_with_payload_template_inner(
     server_args =
         server_args.Set(GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION, false);
   }
+  if (offload_threshold > 0) {
+    client_args = client_args.Set(GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD,
+                                  offload_threshold);
+    server_args = server_args.Set(GRPC_ARG_COMPRESSION_OFFLOAD_THRESHOLD,
+                                  offload_threshold);
+  }
   f = begin_test(config, test_name, client_args.ToC().get(),
                  server_args.ToC().get(), decompress_in_core);
   grpc_core::CqVerifier cqv(f.cq);
@@ -389,9 +397,17 @@ static void request_with_payload_template_inner(
   cqv.Expect(tag(100), true);
   cqv.Verify();
 
+  // The client advertises every algorithm it has a codec for.
+  uint32_t num_supported_algorithms = 0;
+  for (int i = 0; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    if (grpc_core::IsCompressionAlgorithmSupported(
+            static_cast<grpc_compression_algorithm>(i))) {
+      ++num_supported_algorithms;
+    }
+  }
   GPR_ASSERT(grpc_core::BitCount(
                  grpc_call_test_only_get_encodings_accepted_by_peer(s)) ==
-             GRPC_COMPRESS_ALGORITHMS_COUNT);
+             num_supported_algorithms);
   GPR_ASSERT(
       grpc_core::GetBit(grpc_call_test_only_get_encodings_accepted_by_peer(s),
                         GRPC_COMPRESS_NONE) != 0);
@@ -571,14 +587,14 @@ static void request_with_payload_template(
       default_server_channel_compression_algorithm,
       expected_algorithm_from_client, expected_algorithm_from_server,
       client_init_metadata, set_server_level, server_compression_level,
-      send_message_before_initial_metadata, false);
+      send_message_before_initial_metadata, false, 0);
   request_with_payload_template_inner(
       config, test_name, client_send_flags_bitmask,
       default_client_channel_compression_algorithm,
       default_server_channel_compression_algorithm,
       expected_algorithm_from_client, expected_algorithm_from_server,
       client_init_metadata, set_server_level, server_compression_level,
-      send_message_before_initial_metadata, true);
+      send_message_before_initial_metadata, true, 0);
 }
 
 static void test_invoke_request_with_exceptionally_uncompressed_payload(
@@ -617,6 +633,19 @@ static void test_invoke_request_with_send_message_before_initial_metadata(
       /* ignored */ GRPC_COMPRESS_LEVEL_NONE, true);
 }
 
+static void test_invoke_request_with_offloaded_compression(
+    grpc_end2end_test_config config) {
+  // Every message is above the threshold, so all (de)compression happens on
+  // the EventEngine.
+  for (bool decompress_in_core : {false, true}) {
+    request_with_payload_template_inner(
+        config, "test_invoke_request_with_offloaded_compression", 0,
+        GRPC_COMPRESS_GZIP, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_GZIP,
+        GRPC_COMPRESS_GZIP, nullptr, false,
+        /* ignored */ GRPC_COMPRESS_LEVEL_NONE, false, decompress_in_core, 1);
+  }
+}
+
 static void test_invoke_request_with_server_level(
     grpc_end2end_test_config config) {
   request_with_payload_template(
@@ -682,6 +711,7 @@ void compressed_payload(grpc_end2end_test_config config) {
   test_invoke_request_with_uncompressed_payload(config);
   test_invoke_request_with_compressed_payload(config);
   test_invoke_request_with_send_message_before_initial_metadata(config);
+  test_invoke_request_with_offloaded_compression(config);
   test_invoke_request_with_server_level(config);
   test_invoke_request_with_compressed_payload_md_override(config);
   test_invoke_request_with_disabled_algorithm(config);
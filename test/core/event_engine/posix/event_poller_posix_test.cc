@@ -61,6 +61,7 @@
 #include <grpc/support/sync.h>
 
 #include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
@@ -668,7 +669,7 @@ class Worker : public grpc_core::DualRefCounted<Worker> {
 
  private:
   void Work() {
-    auto result = g_event_poller->Work(24h, [this]() {
+    auto result = poller_->Work(24h, [this]() {
       // Schedule next work instantiation immediately and take a Ref for
       // the next instantiation.
       Ref().release();
@@ -706,6 +707,23 @@ TEST_F(EventPollerTest, TestMultipleHandles) {
   worker->Wait();
 }
 
+// Same as TestMultipleHandles, but explicitly exercises the io_uring poller
+// which is never picked by the default poll strategy.
+TEST_F(EventPollerTest, TestIoUringPollerMultipleHandles) {
+  static constexpr int kNumHandles = 100;
+  static constexpr int kNumWakeupsPerHandle = 100;
+  PosixEventPoller* poller = MakeIoUringPoller(Scheduler());
+  if (poller == nullptr) {
+    gpr_log(GPR_INFO, "io_uring poller unsupported, skipping test");
+    return;
+  }
+  Worker* worker =
+      new Worker(Scheduler(), poller, kNumHandles, kNumWakeupsPerHandle);
+  worker->Start();
+  worker->Wait();
+  poller->Shutdown();
+}
+
 }  // namespace
 }  // namespace experimental
 }  // namespace grpc_event_engine
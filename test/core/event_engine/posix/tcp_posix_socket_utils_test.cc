@@ -29,6 +29,7 @@
 
 #include <netinet/in.h>
 #include <netinet/ip.h>
+#include <netinet/tcp.h>
 
 #include <grpc/support/alloc.h>
 
@@ -170,6 +171,33 @@ TEST(TcpPosixSocketUtilsTest, SocketOptionsTest) {
   close(sock);
 }
 
+TEST(TcpPosixSocketUtilsTest, TcpFastOpenConnectTest) {
+  int sock = socket(PF_INET, SOCK_STREAM, 0);
+  if (sock < 0) {
+    // Try ipv6
+    sock = socket(AF_INET6, SOCK_STREAM, 0);
+  }
+  EXPECT_GT(sock, 0);
+  PosixSocketWrapper posix_sock(sock);
+  PosixTcpOptions options;
+  posix_sock.TrySetSocketTcpFastOpenConnect(options);
+#ifdef TCP_FASTOPEN_CONNECT
+  int val = -1;
+  socklen_t len = sizeof(val);
+  if (getsockopt(sock, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &val, &len) != 0) {
+    close(sock);
+    GTEST_SKIP() << "TCP_FASTOPEN_CONNECT is not supported by the kernel";
+  }
+  EXPECT_EQ(val, 0);
+  options.tcp_fast_open_connect = true;
+  posix_sock.TrySetSocketTcpFastOpenConnect(options);
+  ASSERT_EQ(getsockopt(sock, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &val, &len),
+            0);
+  EXPECT_EQ(val, 1);
+#endif
+  close(sock);
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
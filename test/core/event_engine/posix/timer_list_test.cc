@@ -28,8 +28,10 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/time.h"
 
+using testing::AnyNumber;
 using testing::Mock;
 using testing::Return;
 using testing::StrictMock;
@@ -65,6 +67,14 @@ CheckResult FinishCheck(
   return CheckResult::kTimersFired;
 }
 
+// Unlike the heap, which wakes up at the end of its refill window anyway, the
+// timer wheel kicks the host whenever a new timer becomes the earliest one.
+void AllowTimerWheelKicks(StrictMock<MockHost>* host) {
+  if (grpc_core::IsEventEngineTimerWheelEnabled()) {
+    EXPECT_CALL(*host, Kick()).Times(AnyNumber());
+  }
+}
+
 }  // namespace
 
 TEST(TimerListTest, Add) {
@@ -75,6 +85,7 @@ TEST(TimerListTest, Add) {
       grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100);
 
   StrictMock<MockHost> host;
+  AllowTimerWheelKicks(&host);
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
   TimerList timer_list(&host);
 
@@ -135,6 +146,7 @@ TEST(TimerListTest, Destruction) {
   StrictMock<MockClosure> closures[5];
 
   StrictMock<MockHost> host;
+  AllowTimerWheelKicks(&host);
   EXPECT_CALL(host, Now())
       .WillOnce(
           Return(grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(0)));
@@ -204,6 +216,7 @@ TEST(TimerListTest, LongRunningServiceCleanup) {
       grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(k25Days.millis());
 
   StrictMock<MockHost> host;
+  AllowTimerWheelKicks(&host);
   EXPECT_CALL(host, Now()).WillOnce(Return(kStart));
   TimerList timer_list(&host);
 
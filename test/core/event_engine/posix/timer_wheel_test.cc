@@ -0,0 +1,161 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+using testing::UnorderedElementsAre;
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+std::vector<Timer*> PopExpired(TimerWheel* wheel, int64_t now) {
+  std::vector<Timer*> out;
+  wheel->PopExpired(now, &out);
+  EXPECT_GT(wheel->NextDeadline(), now);
+  return out;
+}
+}  // namespace
+
+TEST(TimerWheelTest, EmptyWheel) {
+  TimerWheel wheel(0);
+  EXPECT_TRUE(wheel.is_empty());
+  EXPECT_EQ(wheel.NextDeadline(), std::numeric_limits<int64_t>::max());
+  EXPECT_THAT(PopExpired(&wheel, 1000000), IsEmpty());
+}
+
+TEST(TimerWheelTest, ExpiresAtDeadline) {
+  TimerWheel wheel(100);
+  Timer timers[3];
+  timers[0].deadline = 90;
+  timers[1].deadline = 150;
+  timers[2].deadline = 151;
+  EXPECT_TRUE(wheel.Add(&timers[1]));
+  EXPECT_FALSE(wheel.Add(&timers[2]));
+  EXPECT_TRUE(wheel.Add(&timers[0]));
+  // An already expired timer is reported as due immediately.
+  EXPECT_EQ(wheel.NextDeadline(), 100);
+  EXPECT_THAT(PopExpired(&wheel, 100), ElementsAre(&timers[0]));
+  EXPECT_EQ(wheel.NextDeadline(), 150);
+  EXPECT_THAT(PopExpired(&wheel, 149), IsEmpty());
+  EXPECT_THAT(PopExpired(&wheel, 150), ElementsAre(&timers[1]));
+  EXPECT_THAT(PopExpired(&wheel, 151), ElementsAre(&timers[2]));
+  EXPECT_TRUE(wheel.is_empty());
+}
+
+TEST(TimerWheelTest, Remove) {
+  TimerWheel wheel(0);
+  Timer timers[3];
+  timers[0].deadline = 10;
+  timers[1].deadline = 10;
+  timers[2].deadline = 100000;
+  for (Timer& timer : timers) wheel.Add(&timer);
+  wheel.Remove(&timers[0]);
+  wheel.Remove(&timers[2]);
+  EXPECT_THAT(PopExpired(&wheel, 1000000), ElementsAre(&timers[1]));
+  EXPECT_TRUE(wheel.is_empty());
+}
+
+// Timers far enough in the future to land on every level of the wheel, and in
+// the overflow list, still expire exactly at their deadlines.
+TEST(TimerWheelTest, CascadesThroughAllLevels) {
+  const int64_t kStart = 12345;
+  TimerWheel wheel(kStart);
+  const std::vector<int64_t> offsets = {
+      1,      63,     64,       65,       4095,     4096,     4097,
+      262143, 262144, 262145,   16777215, 16777216, 16777217, 40000000};
+  std::vector<Timer> timers(offsets.size());
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    timers[i].deadline = kStart + offsets[i];
+    wheel.Add(&timers[i]);
+  }
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    EXPECT_THAT(PopExpired(&wheel, timers[i].deadline - 1), IsEmpty())
+        << "offset " << offsets[i];
+    EXPECT_THAT(PopExpired(&wheel, timers[i].deadline),
+                ElementsAre(&timers[i]))
+        << "offset " << offsets[i];
+  }
+  EXPECT_TRUE(wheel.is_empty());
+}
+
+TEST(TimerWheelTest, FarFutureDeadline) {
+  TimerWheel wheel(0);
+  Timer timers[2];
+  timers[0].deadline = std::numeric_limits<int64_t>::max() - 1;
+  timers[1].deadline = 5;
+  wheel.Add(&timers[0]);
+  wheel.Add(&timers[1]);
+  EXPECT_THAT(PopExpired(&wheel, 10), ElementsAre(&timers[1]));
+  wheel.Remove(&timers[0]);
+  EXPECT_TRUE(wheel.is_empty());
+}
+
+TEST(TimerWheelTest, LargeJumps) {
+  TimerWheel wheel(0);
+  std::vector<Timer> timers(1000);
+  for (Timer& timer : timers) {
+    timer.deadline = rand() % 100000000;
+    wheel.Add(&timer);
+  }
+  std::vector<Timer*> popped;
+  int64_t now = 0;
+  while (!wheel.is_empty()) {
+    now += rand() % 1000000;
+    for (Timer* timer : PopExpired(&wheel, now)) {
+      EXPECT_LE(timer->deadline, now);
+      popped.push_back(timer);
+    }
+    for (Timer& timer : timers) {
+      if (std::find(popped.begin(), popped.end(), &timer) == popped.end()) {
+        EXPECT_GT(timer.deadline, now);
+      }
+    }
+  }
+  EXPECT_EQ(popped.size(), timers.size());
+}
+
+TEST(TimerWheelTest, AddAfterAdvancing) {
+  TimerWheel wheel(0);
+  Timer timers[2];
+  timers[0].deadline = 1000;
+  wheel.Add(&timers[0]);
+  EXPECT_THAT(PopExpired(&wheel, 500), IsEmpty());
+  timers[1].deadline = 520;
+  EXPECT_TRUE(wheel.Add(&timers[1]));
+  EXPECT_THAT(PopExpired(&wheel, 999), UnorderedElementsAre(&timers[1]));
+  EXPECT_THAT(PopExpired(&wheel, 1000), ElementsAre(&timers[0]));
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
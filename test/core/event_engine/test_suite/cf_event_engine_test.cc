@@ -19,17 +19,27 @@
 
 #include "src/core/lib/event_engine/cf_engine/cf_engine.h"
 #include "test/core/event_engine/test_suite/event_engine_test_framework.h"
+#include "test/core/event_engine/test_suite/posix/oracle_event_engine_posix.h"
+#include "test/core/event_engine/test_suite/tests/client_test.h"
+#include "test/core/event_engine/test_suite/tests/server_test.h"
 #include "test/core/event_engine/test_suite/tests/timer_test.h"
 #include "test/core/util/test_config.h"
 
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   grpc::testing::TestEnvironment env(&argc, argv);
-  auto factory = []() {
-    return std::make_unique<grpc_event_engine::experimental::CFEventEngine>();
-  };
-  SetEventEngineFactories(factory, factory);
+  SetEventEngineFactories(
+      []() {
+        return std::make_unique<
+            grpc_event_engine::experimental::CFEventEngine>();
+      },
+      []() {
+        return std::make_unique<
+            grpc_event_engine::experimental::PosixOracleEventEngine>();
+      });
   grpc_event_engine::experimental::InitTimerTests();
+  grpc_event_engine::experimental::InitClientTests();
+  grpc_event_engine::experimental::InitServerTests();
   // TODO(ctiller): EventEngine temporarily needs grpc to be initialized first
   // until we clear out the iomgr shutdown code.
   grpc_init();
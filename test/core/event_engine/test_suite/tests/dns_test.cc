@@ -12,8 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/gprpp/notification.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/event_engine/test_suite/event_engine_test_framework.h"
 
@@ -25,7 +39,105 @@ void InitDNSTests() {}
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
-class EventEngineDNSTest : public EventEngineTest {};
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::ResolvedAddressToNormalizedString;
+using namespace std::chrono_literals;
+
+class EventEngineDNSTest : public EventEngineTest {
+ protected:
+  // Looks up name, and returns the addresses as strings.
+  absl::StatusOr<std::vector<std::string>> LookupHostname(
+      EventEngine::DNSResolver* resolver, absl::string_view name,
+      absl::string_view default_port) {
+    grpc_core::Notification done;
+    absl::StatusOr<std::vector<std::string>> result;
+    resolver->LookupHostname(
+        [&](absl::StatusOr<std::vector<EventEngine::ResolvedAddress>>
+                addresses) {
+          if (!addresses.ok()) {
+            result = addresses.status();
+          } else {
+            result.emplace();
+            for (const auto& address : *addresses) {
+              result->push_back(
+                  ResolvedAddressToNormalizedString(address).value());
+            }
+          }
+          done.Notify();
+        },
+        name, default_port, 10s);
+    done.WaitForNotification();
+    return result;
+  }
+};
+
+TEST_F(EventEngineDNSTest, LookupIpLiterals) {
+  grpc_core::ExecCtx exec_ctx;
+  std::shared_ptr<EventEngine> engine(NewEventEngine());
+  auto resolver = engine->GetDNSResolver({});
+  for (const auto& test_case :
+       std::vector<std::array<std::string, 3>>{
+           {"127.0.0.1:443", "", "127.0.0.1:443"},
+           {"127.0.0.1", "8080", "127.0.0.1:8080"},
+           {"[::1]:443", "", "[::1]:443"}}) {
+    auto result = LookupHostname(resolver.get(), test_case[0], test_case[1]);
+    ASSERT_TRUE(result.ok()) << test_case[0] << ": " << result.status();
+    EXPECT_EQ(*result, std::vector<std::string>{test_case[2]});
+  }
+}
+
+TEST_F(EventEngineDNSTest, LookupLocalhost) {
+  grpc_core::ExecCtx exec_ctx;
+  std::shared_ptr<EventEngine> engine(NewEventEngine());
+  auto resolver = engine->GetDNSResolver({});
+  auto result = LookupHostname(resolver.get(), "localhost", "https");
+  ASSERT_TRUE(result.ok()) << result.status();
+  EXPECT_FALSE(result->empty());
+}
+
+TEST_F(EventEngineDNSTest, InvalidNames) {
+  grpc_core::ExecCtx exec_ctx;
+  std::shared_ptr<EventEngine> engine(NewEventEngine());
+  auto resolver = engine->GetDNSResolver({});
+  EXPECT_EQ(LookupHostname(resolver.get(), "", "443").status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(LookupHostname(resolver.get(), "[::1", "443").status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(LookupHostname(resolver.get(), "127.0.0.1", "").status().code(),
+            absl::StatusCode::kInvalidArgument);
+}
+
+TEST_F(EventEngineDNSTest, ManyConcurrentLookups) {
+  grpc_core::ExecCtx exec_ctx;
+  std::shared_ptr<EventEngine> engine(NewEventEngine());
+  auto resolver = engine->GetDNSResolver({});
+  constexpr int kNumLookups = 1000;
+  std::atomic<int> succeeded{0};
+  std::atomic<int> remaining{kNumLookups};
+  grpc_core::Notification done;
+  for (int i = 0; i < kNumLookups; ++i) {
+    resolver->LookupHostname(
+        [&](absl::StatusOr<std::vector<EventEngine::ResolvedAddress>>
+                addresses) {
+          if (addresses.ok() && !addresses->empty()) ++succeeded;
+          if (--remaining == 0) done.Notify();
+        },
+        "localhost:443", "", 10s);
+  }
+  done.WaitForNotification();
+  EXPECT_EQ(succeeded.load(), kNumLookups);
+}
 
-// TODO(hork): establish meaningful tests
-TEST_F(EventEngineDNSTest, TODO) { grpc_core::ExecCtx exec_ctx; }
+TEST_F(EventEngineDNSTest, CancelCompletedLookupFails) {
+  grpc_core::ExecCtx exec_ctx;
+  std::shared_ptr<EventEngine> engine(NewEventEngine());
+  auto resolver = engine->GetDNSResolver({});
+  grpc_core::Notification done;
+  auto handle = resolver->LookupHostname(
+      [&](absl::StatusOr<std::vector<EventEngine::ResolvedAddress>>) {
+        done.Notify();
+      },
+      "127.0.0.1:443", "", 10s);
+  done.WaitForNotification();
+  EXPECT_FALSE(resolver->CancelLookup(handle));
+}
@@ -16,6 +16,7 @@
 
 #include <stdlib.h>
 
+#include <atomic>
 #include <chrono>
 #include <thread>
 
@@ -80,6 +81,24 @@ TEST(ThreadPoolTest, CanSurviveFork) {
   p.Quiesce();
 }
 
+TEST(ThreadPoolTest, ResumesParkedThreadsInForkParent) {
+  ThreadPool p;
+  grpc_core::Notification n;
+  p.PrepareFork();
+  // Runs only once the parked threads are resumed; none are started.
+  p.Run([&n] { n.Notify(); });
+  EXPECT_FALSE(n.WaitForNotificationWithTimeout(absl::Milliseconds(100)));
+  p.PostforkParent();
+  n.WaitForNotification();
+  // A second fork parks the same threads again.
+  p.PrepareFork();
+  p.PostforkParent();
+  grpc_core::Notification n2;
+  p.Run([&n2] { n2.Notify(); });
+  n2.WaitForNotification();
+  p.Quiesce();
+}
+
 void ScheduleSelf(ThreadPool* p) {
   p->Run([p] { ScheduleSelf(p); });
 }
@@ -118,6 +137,59 @@ TEST(ThreadPoolTest, CanStartLotsOfClosures) {
   p.Quiesce();
 }
 
+TEST(ThreadPoolTest, IdleThreadsStealLocallyScheduledWork) {
+  static constexpr int kNumCallbacks = 100;
+  ThreadPool p;
+  std::atomic<int> remaining{kNumCallbacks};
+  grpc_core::Notification n;
+  p.Run([&p, &remaining, &n] {
+    grpc_core::Notification all_done;
+    // These land on this thread's local queue.
+    for (int i = 0; i < kNumCallbacks; i++) {
+      p.Run([&remaining, &all_done] {
+        if (remaining.fetch_sub(1) == 1) all_done.Notify();
+      });
+    }
+    // This thread is now blocked, so only other threads can drain its queue.
+    all_done.WaitForNotification();
+    n.Notify();
+  });
+  n.WaitForNotification();
+  EXPECT_EQ(remaining.load(), 0);
+  p.Quiesce();
+}
+
+TEST(ThreadPoolTest, TransportIoRunsAheadOfBacklog) {
+  static constexpr int kNumCallbacks = 1000;
+  ThreadPool p;
+  std::atomic<int> remaining{kNumCallbacks};
+  grpc_core::Notification all_done;
+  for (int i = 0; i < kNumCallbacks; i++) {
+    p.Run([&remaining, &all_done] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      if (remaining.fetch_sub(1) == 1) all_done.Notify();
+    });
+  }
+  class IoClosure : public EventEngine::Closure {
+   public:
+    explicit IoClosure(std::atomic<int>* remaining) : remaining_(remaining) {}
+    void Run() override {
+      remaining_when_run = remaining_->load();
+      ran.Notify();
+    }
+    std::atomic<int>* const remaining_;
+    int remaining_when_run = 0;
+    grpc_core::Notification ran;
+  };
+  IoClosure io(&remaining);
+  p.Run(&io, ThreadPool::Priority::kTransportIo);
+  io.ran.WaitForNotification();
+  // It was picked up by the next free thread, not after the backlog.
+  EXPECT_GT(io.remaining_when_run, kNumCallbacks / 2);
+  all_done.WaitForNotification();
+  p.Quiesce();
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
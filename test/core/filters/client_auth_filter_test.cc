@@ -20,6 +20,7 @@
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 #include "absl/types/variant.h"
@@ -36,6 +37,7 @@
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/promise/poll.h"
@@ -90,6 +92,44 @@ class ClientAuthFilterTest : public ::testing::Test {
     absl::Status status_;
   };
 
+  // Adds an authorization header and counts how many times it was asked to.
+  class CountingCallCreds : public grpc_call_credentials {
+   public:
+    explicit CountingCallCreds(Duration metadata_ttl)
+        : grpc_call_credentials(GRPC_SECURITY_NONE),
+          metadata_ttl_(metadata_ttl) {}
+
+    UniqueTypeName type() const override {
+      static UniqueTypeName::Factory kFactory("CountingCallCreds");
+      return kFactory.Create();
+    }
+
+    ArenaPromise<absl::StatusOr<ClientMetadataHandle>> GetRequestMetadata(
+        ClientMetadataHandle initial_metadata,
+        const GetRequestMetadataArgs* /*args*/) override {
+      ++num_calls_;
+      initial_metadata->Append(
+          "authorization",
+          Slice::FromCopiedString(absl::StrCat("token-", num_calls_)),
+          [](absl::string_view, const Slice&) { abort(); });
+      return Immediate<absl::StatusOr<ClientMetadataHandle>>(
+          std::move(initial_metadata));
+    }
+
+    Duration cacheable_metadata_ttl() const override { return metadata_ttl_; }
+
+    int num_calls() const { return num_calls_; }
+
+    int cmp_impl(const grpc_call_credentials* other) const override {
+      return QsortCompare(static_cast<const grpc_call_credentials*>(this),
+                          other);
+    }
+
+   private:
+    const Duration metadata_ttl_;
+    int num_calls_ = 0;
+  };
+
   ClientAuthFilterTest()
       : memory_allocator_(
             ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
@@ -111,12 +151,17 @@ class ClientAuthFilterTest : public ::testing::Test {
   }
 
   ChannelArgs MakeChannelArgs(absl::Status status_for_call_creds) {
-    ChannelArgs args;
-    auto security_connector = channel_creds_->create_security_connector(
+    return MakeChannelArgs(
         status_for_call_creds.ok()
             ? nullptr
-            : MakeRefCounted<FailCallCreds>(std::move(status_for_call_creds)),
-        std::string(target_.as_string_view()).c_str(), &args);
+            : MakeRefCounted<FailCallCreds>(std::move(status_for_call_creds)));
+  }
+
+  ChannelArgs MakeChannelArgs(RefCountedPtr<grpc_call_credentials> call_creds) {
+    ChannelArgs args;
+    auto security_connector = channel_creds_->create_security_connector(
+        std::move(call_creds), std::string(target_.as_string_view()).c_str(),
+        &args);
     auto auth_context = MakeRefCounted<grpc_auth_context>(nullptr);
     absl::string_view security_level = "TSI_SECURITY_NONE";
     auth_context->add_property(GRPC_TRANSPORT_SECURITY_LEVEL_PROPERTY_NAME,
@@ -208,6 +253,73 @@ TEST_F(ClientAuthFilterTest, RewritesInvalidStatusFromCallCreds) {
             "ABORTED: nope");
 }
 
+// Runs one call through \a filter with the given path, and returns the
+// authorization header the credentials added to it.
+std::string CallAuthorizationHeader(ClientAuthFilter* filter, Arena* arena,
+                                    grpc_call_context_element* call_context,
+                                    const Slice& target,
+                                    absl::string_view path) {
+  TestContext<Arena> context(arena);
+  TestContext<grpc_call_context_element> promise_call_context(call_context);
+  grpc_metadata_batch initial_metadata(arena);
+  grpc_metadata_batch trailing_metadata(arena);
+  initial_metadata.Set(HttpAuthorityMetadata(), target.Ref());
+  initial_metadata.Set(HttpPathMetadata(), Slice::FromCopiedString(path));
+  std::string authorization;
+  auto promise = filter->MakeCallPromise(
+      CallArgs{ClientMetadataHandle(&initial_metadata,
+                                    Arena::PooledDeleter(nullptr)),
+               nullptr, nullptr, nullptr},
+      [&](CallArgs call_args) {
+        std::string buffer;
+        authorization = std::string(
+            call_args.client_initial_metadata
+                ->GetStringValue("authorization", &buffer)
+                .value_or(""));
+        return ArenaPromise<ServerMetadataHandle>(
+            [&]() -> Poll<ServerMetadataHandle> {
+              return ServerMetadataHandle(&trailing_metadata,
+                                          Arena::PooledDeleter(nullptr));
+            });
+      });
+  auto result = promise();
+  EXPECT_TRUE(absl::holds_alternative<ServerMetadataHandle>(result));
+  return authorization;
+}
+
+TEST_F(ClientAuthFilterTest, ReusesCacheableCallCredsMetadata) {
+  auto call_creds = MakeRefCounted<CountingCallCreds>(Duration::Hours(1));
+  auto filter =
+      ClientAuthFilter::Create(MakeChannelArgs(call_creds), ChannelFilter::Args());
+  ASSERT_TRUE(filter.ok()) << filter.status();
+  EXPECT_EQ(CallAuthorizationHeader(&*filter, arena_.get(), call_context_,
+                                    target_, "/service/method1"),
+            "token-1");
+  EXPECT_EQ(CallAuthorizationHeader(&*filter, arena_.get(), call_context_,
+                                    target_, "/service/method1"),
+            "token-1");
+  EXPECT_EQ(call_creds->num_calls(), 1);
+  // Another method gets its own entry.
+  EXPECT_EQ(CallAuthorizationHeader(&*filter, arena_.get(), call_context_,
+                                    target_, "/service/method2"),
+            "token-2");
+  EXPECT_EQ(call_creds->num_calls(), 2);
+}
+
+TEST_F(ClientAuthFilterTest, DoesNotCacheCallCredsMetadataWithoutTtl) {
+  auto call_creds = MakeRefCounted<CountingCallCreds>(Duration::Zero());
+  auto filter =
+      ClientAuthFilter::Create(MakeChannelArgs(call_creds), ChannelFilter::Args());
+  ASSERT_TRUE(filter.ok()) << filter.status();
+  EXPECT_EQ(CallAuthorizationHeader(&*filter, arena_.get(), call_context_,
+                                    target_, "/service/method1"),
+            "token-1");
+  EXPECT_EQ(CallAuthorizationHeader(&*filter, arena_.get(), call_context_,
+                                    target_, "/service/method1"),
+            "token-2");
+  EXPECT_EQ(call_creds->num_calls(), 2);
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -16,12 +16,19 @@
 //
 //
 
+#include <stdio.h>
 #include <string.h>
+#include <unistd.h>
+
+#include <string>
 
 #include <gtest/gtest.h>
 
+#include "absl/strings/match.h"
+
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gpr/log_sink.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "test/core/util/test_config.h"
 
@@ -87,6 +94,85 @@ TEST(LogTest, LogVerbosity) {
   test_log_function_unreached(GPR_DEBUG);
 }
 
+#ifdef GPR_LINUX_LOG
+// Captures what is written to stderr while it is alive.
+class CapturedStderr {
+ public:
+  CapturedStderr() : file_(tmpfile()), saved_stderr_(dup(STDERR_FILENO)) {
+    fflush(stderr);
+    dup2(fileno(file_), STDERR_FILENO);
+  }
+  ~CapturedStderr() {
+    Restore();
+    fclose(file_);
+  }
+
+  std::string Release() {
+    Restore();
+    std::string contents;
+    char buf[4096];
+    rewind(file_);
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), file_)) > 0) contents.append(buf, n);
+    return contents;
+  }
+
+ private:
+  void Restore() {
+    if (saved_stderr_ < 0) return;
+    fflush(stderr);
+    dup2(saved_stderr_, STDERR_FILENO);
+    close(saved_stderr_);
+    saved_stderr_ = -1;
+  }
+
+  FILE* file_;
+  int saved_stderr_;
+};
+
+static int CountOccurrences(const std::string& haystack,
+                            const std::string& needle) {
+  int count = 0;
+  for (size_t pos = haystack.find(needle); pos != std::string::npos;
+       pos = haystack.find(needle, pos + needle.size())) {
+    ++count;
+  }
+  return count;
+}
+
+TEST(LogTest, AsyncSinkWritesQueuedLines) {
+  gpr_set_log_verbosity(GPR_LOG_SEVERITY_ERROR);
+  grpc_core::ConfigureDefaultLogSink(true, 0);
+  CapturedStderr captured;
+  for (int i = 0; i < 100; ++i) gpr_log(GPR_ERROR, "async line %d", i);
+  grpc_core::FlushDefaultLogSink();
+  grpc_core::ConfigureDefaultLogSink(false, 0);
+  std::string output = captured.Release();
+  EXPECT_EQ(CountOccurrences(output, "async line "), 100) << output;
+  EXPECT_TRUE(absl::StrContains(output, "async line 99\n"));
+}
+
+TEST(LogTest, RateLimitDropsLinesPerCallSite) {
+  gpr_set_log_verbosity(GPR_LOG_SEVERITY_ERROR);
+  grpc_core::ConfigureDefaultLogSink(false, 10);
+  const uint64_t rate_limited_before =
+      grpc_core::GetDefaultLogSinkDrops().rate_limited;
+  CapturedStderr captured;
+  for (int i = 0; i < 100; ++i) gpr_log(GPR_ERROR, "limited line");
+  gpr_log(GPR_ERROR, "another call site");
+  grpc_core::ConfigureDefaultLogSink(false, 0);
+  std::string output = captured.Release();
+  // The loop may straddle a second boundary and get two seconds' worth.
+  const int logged = CountOccurrences(output, "limited line");
+  EXPECT_GE(logged, 10);
+  EXPECT_LE(logged, 20);
+  EXPECT_EQ(grpc_core::GetDefaultLogSinkDrops().rate_limited -
+                rate_limited_before,
+            static_cast<uint64_t>(100 - logged));
+  EXPECT_TRUE(absl::StrContains(output, "another call site"));
+}
+#endif  // GPR_LINUX_LOG
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
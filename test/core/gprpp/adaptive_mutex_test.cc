@@ -0,0 +1,90 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/gprpp/adaptive_mutex.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+TEST(AdaptiveMutexTest, TryLock) {
+  AdaptiveMutex mu;
+  EXPECT_TRUE(mu.TryLock());
+  EXPECT_FALSE(mu.TryLock());
+  mu.Unlock();
+  EXPECT_TRUE(mu.TryLock());
+  mu.Unlock();
+  EXPECT_EQ(mu.contention_stats().spin_acquires, 0);
+  EXPECT_EQ(mu.contention_stats().parks, 0);
+}
+
+TEST(AdaptiveMutexTest, ExcludesUnderContention) {
+  constexpr int kThreads = 8;
+  constexpr int kIterations = 100000;
+  AdaptiveMutex mu;
+  int counter = 0;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; i++) {
+    threads.emplace_back([&mu, &counter] {
+      for (int j = 0; j < kIterations; j++) {
+        AdaptiveMutexLock lock(&mu);
+        ++counter;
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(counter, kThreads * kIterations);
+}
+
+std::atomic<int> g_spin_acquires{0};
+std::atomic<int> g_parks{0};
+
+TEST(AdaptiveMutexTest, ParksWhenHeldLong) {
+  OnAdaptiveMutexContention = [](bool parked) {
+    (parked ? g_parks : g_spin_acquires).fetch_add(1);
+  };
+  AdaptiveMutex mu;
+  mu.Lock();
+  std::atomic<bool> locked{false};
+  std::thread waiter([&mu, &locked] {
+    AdaptiveMutexLock lock(&mu);
+    locked.store(true);
+  });
+  // Far longer than the waiter can spin for.
+  absl::SleepFor(absl::Milliseconds(100));
+  EXPECT_FALSE(locked.load());
+  mu.Unlock();
+  waiter.join();
+  EXPECT_TRUE(locked.load());
+  EXPECT_EQ(mu.contention_stats().parks, 1);
+  EXPECT_EQ(g_parks.load(), 1);
+  OnAdaptiveMutexContention = nullptr;
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
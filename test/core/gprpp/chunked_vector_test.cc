@@ -30,6 +30,7 @@ namespace testing {
 
 static constexpr size_t kInitialArenaSize = 1024;
 static constexpr size_t kChunkSize = 3;
+static constexpr size_t kInlineSize = 2;
 
 class ChunkedVectorTest : public ::testing::Test {
  protected:
@@ -167,6 +168,62 @@ TEST_F(ChunkedVectorTest, RemoveIf) {
   EXPECT_EQ(v.size(), 0);
 }
 
+TEST_F(ChunkedVectorTest, InlineStack) {
+  auto arena = MakeScopedArena(kInitialArenaSize, &memory_allocator_);
+  ChunkedVector<int, kChunkSize, kInlineSize> v(arena.get());
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.begin(), v.end());
+  // Fill the inline chunk, then one arena chunk and part of another.
+  for (int i = 1; i <= 7; i++) {
+    v.EmplaceBack(i);
+    EXPECT_EQ(i, v.size());
+  }
+  int expect = 1;
+  for (int i : v) EXPECT_EQ(expect++, i);
+  for (int i = 7; i >= 1; i--) {
+    EXPECT_EQ(i, v.PopBack());
+  }
+  EXPECT_TRUE(v.empty());
+  v.EmplaceBack(8);
+  EXPECT_EQ(8, *v.begin());
+}
+
+TEST_F(ChunkedVectorTest, InlineMove) {
+  auto arena = MakeScopedArena(kInitialArenaSize, &memory_allocator_);
+  using Vector = ChunkedVector<std::unique_ptr<int>, kChunkSize, kInlineSize>;
+  for (int n : {0, 1, 2, 4}) {
+    Vector v(arena.get());
+    for (int i = 0; i < n; i++) v.EmplaceBack(std::make_unique<int>(i));
+    Vector moved(std::move(v));
+    EXPECT_TRUE(v.empty());
+    Vector assigned(arena.get());
+    assigned.EmplaceBack(std::make_unique<int>(42));
+    assigned = std::move(moved);
+    EXPECT_TRUE(moved.empty());
+    EXPECT_EQ(assigned.size(), n);
+    int expect = 0;
+    for (const auto& p : assigned) EXPECT_EQ(expect++, *p);
+    // Both ends of a move can still be appended to.
+    v.EmplaceBack(std::make_unique<int>(n));
+    assigned.EmplaceBack(std::make_unique<int>(n));
+    EXPECT_EQ(v.size(), 1);
+    EXPECT_EQ(assigned.size(), n + 1);
+  }
+}
+
+TEST_F(ChunkedVectorTest, InlineSwap) {
+  auto arena = MakeScopedArena(kInitialArenaSize, &memory_allocator_);
+  ChunkedVector<int, kChunkSize, kInlineSize> a(arena.get());
+  ChunkedVector<int, kChunkSize, kInlineSize> b(arena.get());
+  a.EmplaceBack(1);
+  for (int i = 2; i <= 5; i++) b.EmplaceBack(i);
+  a.Swap(&b);
+  EXPECT_EQ(a.size(), 4);
+  EXPECT_EQ(*a.begin(), 2);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_EQ(*b.begin(), 1);
+}
+
 }  // namespace testing
 
 }  // namespace grpc_core
@@ -28,10 +28,14 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/sharded_mpscq.h"
 #include "src/core/lib/gprpp/thd.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/util/test_config.h"
 
+using grpc_core::LockedShardedMultiProducerSingleConsumerQueue;
 using grpc_core::MultiProducerSingleConsumerQueue;
+using grpc_core::ShardedMultiProducerSingleConsumerQueue;
 
 typedef struct test_node {
   MultiProducerSingleConsumerQueue::Node node;
@@ -181,6 +185,76 @@ TEST(MpscqTest, MtMultipop) {
   gpr_mu_destroy(&pa.mu);
 }
 
+TEST(ShardedMpscqTest, Serial) {
+  grpc_core::ExecCtx exec_ctx;
+  ShardedMultiProducerSingleConsumerQueue q;
+  bool empty;
+  EXPECT_EQ(q.PopAndCheckEnd(&empty), nullptr);
+  EXPECT_TRUE(empty);
+  EXPECT_TRUE(q.Push(&new_node(0, nullptr)->node));
+  for (size_t i = 1; i < 1000; i++) {
+    // Pushes from one ExecCtx all go to the same shard.
+    EXPECT_FALSE(q.Push(&new_node(i, nullptr)->node));
+  }
+  for (size_t i = 0; i < 1000; i++) {
+    test_node* n = reinterpret_cast<test_node*>(q.Pop());
+    ASSERT_NE(n, nullptr);
+    ASSERT_EQ(n->i, i);
+    delete n;
+  }
+  EXPECT_EQ(q.PopAndCheckEnd(&empty), nullptr);
+  EXPECT_TRUE(empty);
+}
+
+typedef struct {
+  size_t ctr;
+  LockedShardedMultiProducerSingleConsumerQueue* q;
+  gpr_event* start;
+} sharded_thd_args;
+
+static void sharded_test_thread(void* args) {
+  sharded_thd_args* a = static_cast<sharded_thd_args*>(args);
+  grpc_core::ExecCtx exec_ctx;
+  gpr_event_wait(a->start, gpr_inf_future(GPR_CLOCK_REALTIME));
+  for (size_t i = 1; i <= THREAD_ITERATIONS; i++) {
+    a->q->Push(&new_node(i, &a->ctr)->node);
+  }
+}
+
+TEST(ShardedMpscqTest, Mt) {
+  gpr_event start;
+  gpr_event_init(&start);
+  grpc_core::Thread thds[50];
+  sharded_thd_args ta[GPR_ARRAY_SIZE(thds)];
+  LockedShardedMultiProducerSingleConsumerQueue q;
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(thds); i++) {
+    ta[i].ctr = 0;
+    ta[i].q = &q;
+    ta[i].start = &start;
+    thds[i] = grpc_core::Thread("grpc_sharded_mt_test", sharded_test_thread,
+                                &ta[i]);
+    thds[i].Start();
+  }
+  size_t num_done = 0;
+  gpr_event_set(&start, reinterpret_cast<void*>(1));
+  while (num_done != GPR_ARRAY_SIZE(thds)) {
+    MultiProducerSingleConsumerQueue::Node* n;
+    while ((n = q.Pop()) == nullptr) {
+    }
+    // Each producer's nodes stay in order, since they all go to the shard
+    // of its ExecCtx.
+    test_node* tn = reinterpret_cast<test_node*>(n);
+    ASSERT_EQ(*tn->ctr, tn->i - 1);
+    *tn->ctr = tn->i;
+    if (tn->i == THREAD_ITERATIONS) num_done++;
+    delete tn;
+  }
+  for (auto& th : thds) {
+    th.Join();
+  }
+  EXPECT_EQ(q.TryPop(), nullptr);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -184,6 +184,39 @@ TEST(RefCountedNonPolymorphicWithTracing, Basic) {
   foo->Unref(DEBUG_LOCATION, "original_ref");
 }
 
+class FooNonAtomic : public RefCounted<FooNonAtomic, PolymorphicRefCount,
+                                       kUnrefDelete, NonAtomicRefCount> {
+ public:
+  FooNonAtomic() : RefCounted("FooNonAtomic") {}
+};
+
+TEST(RefCountedNonAtomic, Basic) {
+  FooNonAtomic* foo = new FooNonAtomic();
+  foo->Unref();
+}
+
+TEST(RefCountedNonAtomic, ExtraRef) {
+  FooNonAtomic* foo = new FooNonAtomic();
+  RefCountedPtr<FooNonAtomic> foop = foo->Ref(DEBUG_LOCATION, "extra_ref");
+  foop.release();
+  foo->Unref(DEBUG_LOCATION, "extra_ref");
+  foop = foo->RefIfNonZero();
+  EXPECT_NE(foop, nullptr);
+  foop.release();
+  foo->Unref();
+  foo->Unref(DEBUG_LOCATION, "original_ref");
+}
+
+TEST(RefCountedNonAtomic, RefIfNonZero) {
+  NonAtomicRefCount refs(0);
+  EXPECT_FALSE(refs.RefIfNonZero());
+  refs.Ref();
+  EXPECT_TRUE(refs.RefIfNonZero());
+  EXPECT_FALSE(refs.Unref());
+  EXPECT_TRUE(refs.Unref());
+  EXPECT_FALSE(refs.RefIfNonZero());
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -39,6 +39,27 @@ TEST(TimestampTest, ToString) {
   EXPECT_EQ(Timestamp::InfPast().ToString(), "@-∞");
 }
 
+TEST(TimestampTest, NowFollowsMonotonicClock) {
+  const Duration kTolerance = Duration::Milliseconds(5);
+  // Long enough for a cycle counter based clock to calibrate and resync.
+  const Timestamp end =
+      Timestamp::FromTimespecRoundDown(gpr_now(GPR_CLOCK_MONOTONIC)) +
+      Duration::Milliseconds(1500);
+  Timestamp last = Timestamp::InfPast();
+  while (true) {
+    const Timestamp before =
+        Timestamp::FromTimespecRoundDown(gpr_now(GPR_CLOCK_MONOTONIC));
+    const Timestamp now = Timestamp::Now();
+    const Timestamp after =
+        Timestamp::FromTimespecRoundUp(gpr_now(GPR_CLOCK_MONOTONIC));
+    ASSERT_GE(now, last);
+    ASSERT_GE(now, before - kTolerance);
+    ASSERT_LE(now, after + kTolerance);
+    last = now;
+    if (before > end) break;
+  }
+}
+
 TEST(DurationTest, Empty) { EXPECT_EQ(Duration(), Duration::Zero()); }
 
 TEST(DurationTest, Scales) {
@@ -93,6 +114,25 @@ TEST(DurationTest, ToString) {
   EXPECT_EQ(Duration::NegativeInfinity().ToString(), "-∞");
 }
 
+TEST(TimerSlackTest, IsOnePercentUpToASecond) {
+  EXPECT_EQ(TimerSlack(Duration::Milliseconds(50)), Duration::Zero());
+  EXPECT_EQ(TimerSlack(Duration::Seconds(10)), Duration::Milliseconds(100));
+  EXPECT_EQ(TimerSlack(Duration::Hours(2)), Duration::Seconds(1));
+  EXPECT_EQ(TimerSlack(Duration::Infinity()), Duration::Seconds(1));
+}
+
+TEST(TimerSlackTest, CoarseDeadlinesShareBuckets) {
+  auto at = Timestamp::FromMillisecondsAfterProcessEpoch;
+  // 100ms of slack buckets deadlines to 64ms boundaries.
+  EXPECT_EQ(CoarseDeadline(at(1000), Duration::Milliseconds(100)), at(1024));
+  EXPECT_EQ(CoarseDeadline(at(1024), Duration::Milliseconds(100)), at(1024));
+  EXPECT_EQ(CoarseDeadline(at(1025), Duration::Milliseconds(100)), at(1088));
+  // Without slack, deadlines stay as they are.
+  EXPECT_EQ(CoarseDeadline(at(1001), Duration::Milliseconds(1)), at(1001));
+  EXPECT_EQ(CoarseDeadline(Timestamp::InfFuture(), Duration::Seconds(1)),
+            Timestamp::InfFuture());
+}
+
 }  // namespace testing
 }  // namespace grpc_core
 
@@ -97,6 +97,29 @@ TEST(ValidationErrors, ErrorsForMultipleFields) {
       << status;
 }
 
+TEST(ValidationErrors, FieldNamesInParts) {
+  ValidationErrors errors;
+  {
+    ValidationErrors::ScopedField field(&errors, ".", "foo");
+    {
+      ValidationErrors::ScopedField field(&errors, "[\"", "bar", "\"]");
+      EXPECT_FALSE(errors.FieldHasErrors());
+      errors.AddError("value smells funny");
+      EXPECT_TRUE(errors.FieldHasErrors());
+    }
+    EXPECT_FALSE(errors.FieldHasErrors());
+    ValidationErrors::ScopedField field2(&errors, ".baz");
+    errors.AddError("too hot");
+  }
+  absl::Status status = errors.status("errors validating config");
+  EXPECT_EQ(status.code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(status.message(),
+            "errors validating config: ["
+            "field:foo.baz error:too hot; "
+            "field:foo[\"bar\"] error:value smells funny]")
+      << status;
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
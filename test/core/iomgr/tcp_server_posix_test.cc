@@ -55,6 +55,7 @@
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/iomgr/resolve_address.h"
+#include "src/core/lib/iomgr/socket_utils_posix.h"
 #include "src/core/lib/iomgr/tcp_server.h"
 #include "src/core/lib/resource_quota/api.h"
 #include "test/core/util/port.h"
@@ -698,6 +699,60 @@ static void test_pre_allocated_unix_fd() {
 }
 #endif  // GRPC_HAVE_UNIX_SOCKET
 
+// Tests that a server opens the requested number of SO_REUSEPORT listeners
+// for a port, and accepts connections on each of them.
+static void test_listeners_per_port(void) {
+  if (!grpc_is_socket_reuse_port_supported()) return;
+  grpc_core::ExecCtx exec_ctx;
+  const unsigned kListenersPerPort = 4;
+  grpc_arg chan_args[1];
+  chan_args[0].type = GRPC_ARG_INTEGER;
+  chan_args[0].key = const_cast<char*>(GRPC_ARG_TCP_LISTENERS_PER_PORT);
+  chan_args[0].value.integer = kListenersPerPort;
+  const grpc_channel_args channel_args = {1, chan_args};
+  auto args = grpc_core::CoreConfiguration::Get()
+                  .channel_args_preconditioning()
+                  .PreconditionChannelArgs(&channel_args);
+  grpc_tcp_server* s;
+  ASSERT_EQ(
+      absl::OkStatus(),
+      grpc_tcp_server_create(
+          nullptr,
+          grpc_event_engine::experimental::ChannelArgsEndpointConfig(args),
+          on_connect, nullptr, &s));
+  LOG_TEST("test_listeners_per_port");
+  test_addr dst;
+  memset(&dst, 0, sizeof(dst));
+  struct sockaddr_in* addr =
+      reinterpret_cast<struct sockaddr_in*>(dst.addr.addr);
+  dst.addr.len = static_cast<socklen_t>(sizeof(struct sockaddr_in));
+  addr->sin_family = AF_INET;
+  addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  int port = -1;
+  ASSERT_EQ(grpc_tcp_server_add_port(s, &dst.addr, &port), absl::OkStatus());
+  ASSERT_GT(port, 0);
+  ASSERT_TRUE(grpc_sockaddr_set_port(&dst.addr, port));
+  test_addr_init_str(&dst);
+
+  std::vector<grpc_pollset*> test_pollset;
+  test_pollset.push_back(g_pollset);
+  grpc_tcp_server_start(s, &test_pollset);
+  ASSERT_EQ(grpc_tcp_server_port_fd_count(s, 0), kListenersPerPort);
+
+  for (int i = 0; i < 20; ++i) {
+    on_connect_result result;
+    on_connect_result_init(&result);
+    ASSERT_TRUE(GRPC_LOG_IF_ERROR("tcp_connect", tcp_connect(&dst, &result)));
+    ASSERT_EQ(result.server, s);
+    ASSERT_EQ(result.port_index, 0u);
+    ASSERT_LT(result.fd_index, kListenersPerPort);
+    ASSERT_EQ(grpc_tcp_server_port_fd(s, result.port_index, result.fd_index),
+              result.server_fd);
+  }
+
+  grpc_tcp_server_unref(s);
+}
+
 static void destroy_pollset(void* p, grpc_error_handle /*error*/) {
   grpc_pollset_destroy(static_cast<grpc_pollset*>(p));
 }
@@ -729,6 +784,7 @@ TEST(TcpServerPosixTest, MainTest) {
     test_no_op_with_port();
     test_no_op_with_port_and_start();
     test_pre_allocated_inet_fd();
+    test_listeners_per_port();
 #ifdef GRPC_HAVE_UNIX_SOCKET
     test_pre_allocated_unix_fd();
 #endif
@@ -138,6 +138,20 @@ TEST(Json, Utf8) {
   EXPECT_THAT("\"\xf5\x80\x80\x80\"", ContainsInvalidUtf8());
 }
 
+TEST(Json, LongStrings) {
+  // Long enough for the reader to scan several bytes at a time, with an
+  // escape or a multi-byte character at each offset within a word.
+  for (size_t i = 0; i < 16; ++i) {
+    std::string a(i, 'a');
+    std::string b(16 - i, 'b');
+    std::string escaped = absl::StrCat("\"", a, "\\n", b, "\"");
+    RunSuccessTest(escaped.c_str(), absl::StrCat(a, "\n", b), escaped.c_str());
+    std::string utf8 = absl::StrCat("\"", a, "\xc3\x9f", b, "\"");
+    RunSuccessTest(utf8.c_str(), absl::StrCat(a, "\xc3\x9f", b),
+                   absl::StrCat("\"", a, "\\u00df", b, "\"").c_str());
+  }
+}
+
 TEST(Json, NestedEmptyContainers) {
   RunSuccessTest(" [ [ ] , { } , [ ] ] ",
                  Json::Array{
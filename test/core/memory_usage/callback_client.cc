@@ -18,6 +18,7 @@
 
 #include <limits.h>
 #include <stdio.h>
+#include <sys/resource.h>
 
 #include <chrono>
 #include <memory>
@@ -27,6 +28,7 @@
 
 #include "absl/flags/flag.h"
 #include "absl/flags/parse.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 
 #include <grpc/support/log.h>
@@ -35,6 +37,7 @@
 #include <grpcpp/support/channel_arguments.h>
 #include <grpcpp/support/status.h>
 
+#include "src/core/lib/gprpp/host_port.h"
 #include "src/core/lib/gprpp/notification.h"
 #include "src/proto/grpc/testing/benchmark_service.grpc.pb.h"
 #include "src/proto/grpc/testing/messages.pb.h"
@@ -45,6 +48,33 @@ ABSL_FLAG(std::string, target, "", "Target host:port");
 ABSL_FLAG(bool, secure, false, "Use SSL Credentials");
 ABSL_FLAG(int, server_pid, 99999, "Server's pid");
 ABSL_FLAG(int, size, 50, "Number of channels");
+ABSL_FLAG(int, loopback_addresses, 1,
+          "Spread the channels over this many 127.0.x.y addresses, on the "
+          "port of --target, to get past the ephemeral port range of a "
+          "single address pair");
+ABSL_FLAG(int, keepalive_time_ms, -1,
+          "Keepalive ping interval of idle channels, -1 for no keepalive");
+ABSL_FLAG(int, idle_seconds, 0,
+          "How long to hold the channels idle before measuring them again");
+ABSL_FLAG(bool, channelz, true, "Enable channelz on the channels");
+ABSL_FLAG(int, hpack_table_size, -1,
+          "HPACK decoder table size, -1 for the default");
+ABSL_FLAG(int, read_chunk_size, -1,
+          "TCP read chunk size, -1 for the default");
+
+// Returns the target of the index-th channel.
+std::string TargetForTest(int index) {
+  int loopback_addresses = absl::GetFlag(FLAGS_loopback_addresses);
+  if (loopback_addresses <= 1) return absl::GetFlag(FLAGS_target);
+  std::string host;
+  std::string port;
+  GPR_ASSERT(
+      grpc_core::SplitHostPort(absl::GetFlag(FLAGS_target), &host, &port));
+  int address = index % loopback_addresses + 1;
+  return grpc_core::JoinHostPort(
+      absl::StrCat("127.0.", address / 256, ".", address % 256),
+      std::stoi(port));
+}
 
 std::shared_ptr<grpc::Channel> CreateChannelForTest(int index) {
   // Set the authentication mechanism.
@@ -62,10 +92,29 @@ std::shared_ptr<grpc::Channel> CreateChannelForTest(int index) {
   // Arg to bypass mechanism that combines channels on the serverside if they
   // have the same channel args. Allows for one channel per connection
   channel_args.SetInt("grpc.memory_usage_counter", index);
+  if (absl::GetFlag(FLAGS_keepalive_time_ms) >= 0) {
+    channel_args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS,
+                        absl::GetFlag(FLAGS_keepalive_time_ms));
+    channel_args.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+    channel_args.SetInt(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
+  }
+  if (!absl::GetFlag(FLAGS_channelz)) {
+    channel_args.SetInt(GRPC_ARG_ENABLE_CHANNELZ, 0);
+  }
+  if (absl::GetFlag(FLAGS_hpack_table_size) >= 0) {
+    channel_args.SetInt(GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_DECODER,
+                        absl::GetFlag(FLAGS_hpack_table_size));
+  }
+  if (absl::GetFlag(FLAGS_read_chunk_size) > 0) {
+    channel_args.SetInt(GRPC_ARG_TCP_READ_CHUNK_SIZE,
+                        absl::GetFlag(FLAGS_read_chunk_size));
+    channel_args.SetInt(GRPC_ARG_TCP_MIN_READ_CHUNK_SIZE,
+                        absl::GetFlag(FLAGS_read_chunk_size));
+  }
 
   // Create a channel to the server and a stub
   std::shared_ptr<grpc::Channel> channel =
-      CreateCustomChannel(absl::GetFlag(FLAGS_target), creds, channel_args);
+      CreateCustomChannel(TargetForTest(index), creds, channel_args);
   return channel;
 }
 
@@ -119,6 +168,17 @@ std::shared_ptr<CallParams> GetBeforeSnapshot(
   return params;
 }
 
+// Every channel holds a socket, so large sizes need more than the default
+// limit on open files.
+void RaiseOpenFileLimit() {
+  struct rlimit limit;
+  if (getrlimit(RLIMIT_NOFILE, &limit) != 0) return;
+  limit.rlim_cur = limit.rlim_max;
+  if (setrlimit(RLIMIT_NOFILE, &limit) != 0) {
+    gpr_log(GPR_ERROR, "Client: could not raise the open file limit");
+  }
+}
+
 int main(int argc, char** argv) {
   absl::ParseCommandLine(argc, argv);
   char* fake_argv[1];
@@ -131,6 +191,7 @@ int main(int argc, char** argv) {
   }
   gpr_log(GPR_INFO, "Client Target: %s", absl::GetFlag(FLAGS_target).c_str());
   gpr_log(GPR_INFO, "Client Size: %d", absl::GetFlag(FLAGS_size));
+  RaiseOpenFileLimit();
 
   // Getting initial memory usage
   std::shared_ptr<grpc::Channel> get_memory_channel = CreateChannelForTest(0);
@@ -152,6 +213,18 @@ int main(int argc, char** argv) {
   long peak_server_memory = GetMemUsage(absl::GetFlag(FLAGS_server_pid));
   long peak_client_memory = GetMemUsage();
 
+  // Hold the channels idle, with only keepalive pings on them
+  int idle_seconds = absl::GetFlag(FLAGS_idle_seconds);
+  double before_idle_server_cpu =
+      GetCpuSeconds(absl::GetFlag(FLAGS_server_pid));
+  double before_idle_client_cpu = GetCpuSeconds();
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(idle_seconds));
+  double idle_server_cpu = GetCpuSeconds(absl::GetFlag(FLAGS_server_pid)) -
+                           before_idle_server_cpu;
+  double idle_client_cpu = GetCpuSeconds() - before_idle_client_cpu;
+  long idle_server_memory = GetMemUsage(absl::GetFlag(FLAGS_server_pid));
+  long idle_client_memory = GetMemUsage();
+
   // Checking that all channels are still open
   for (int i = 0; i < size; ++i) {
     GPR_ASSERT(!std::exchange(channels_list[i], nullptr)
@@ -168,6 +241,23 @@ int main(int argc, char** argv) {
   printf("server channel memory usage: %f bytes per channel\n",
          static_cast<double>(peak_server_memory - before_server_memory) / size *
              1024);
+  if (idle_seconds > 0) {
+    printf("---------Idle channel stats--------\n");
+    printf("client channel memory usage after %ds idle: %f bytes per "
+           "channel\n",
+           idle_seconds,
+           static_cast<double>(idle_client_memory - before_client_memory) /
+               size * 1024);
+    printf("server channel memory usage after %ds idle: %f bytes per "
+           "channel\n",
+           idle_seconds,
+           static_cast<double>(idle_server_memory - before_server_memory) /
+               size * 1024);
+    printf("client idle cpu: %f%% of a core\n",
+           idle_client_cpu / idle_seconds * 100);
+    printf("server idle cpu: %f%% of a core\n",
+           idle_server_cpu / idle_seconds * 100);
+  }
   gpr_log(GPR_INFO, "Client Done");
   return 0;
 }
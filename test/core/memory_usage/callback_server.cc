@@ -17,6 +17,7 @@
 //
 
 #include <signal.h>
+#include <sys/resource.h>
 #include <unistd.h>
 
 #include <memory>
@@ -72,6 +73,11 @@ static void sigint_handler(int /*x*/) { _exit(0); }
 
 ABSL_FLAG(std::string, bind, "", "Bind host:port");
 ABSL_FLAG(bool, secure, false, "Use SSL Credentials");
+ABSL_FLAG(bool, channelz, true, "Enable channelz on the server");
+ABSL_FLAG(int, hpack_table_size, -1,
+          "HPACK decoder table size, -1 for the default");
+ABSL_FLAG(int, read_chunk_size, -1,
+          "TCP read chunk size, -1 for the default");
 
 int main(int argc, char** argv) {
   absl::ParseCommandLine(argc, argv);
@@ -88,6 +94,14 @@ int main(int argc, char** argv) {
   }
   gpr_log(GPR_INFO, "Server port: %s", server_address.c_str());
 
+  // Every connection holds a socket, so large sizes need more than the
+  // default limit on open files.
+  struct rlimit limit;
+  if (getrlimit(RLIMIT_NOFILE, &limit) == 0) {
+    limit.rlim_cur = limit.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &limit);
+  }
+
   // Get initial process memory usage before creating server
   long before_server_create = GetMemUsage();
   ServerCallbackImpl callback_server(before_server_create);
@@ -101,6 +115,22 @@ int main(int argc, char** argv) {
     // TODO (chennancy) Add in secure credentials
   }
   builder.AddListeningPort(server_address, creds);
+  // Accept keepalive pings on idle connections, however often the client
+  // sends them.
+  builder.AddChannelArgument(GRPC_ARG_HTTP2_MAX_PING_STRIKES, 0);
+  if (!absl::GetFlag(FLAGS_channelz)) {
+    builder.AddChannelArgument(GRPC_ARG_ENABLE_CHANNELZ, 0);
+  }
+  if (absl::GetFlag(FLAGS_hpack_table_size) >= 0) {
+    builder.AddChannelArgument(GRPC_ARG_HTTP2_HPACK_TABLE_SIZE_DECODER,
+                               absl::GetFlag(FLAGS_hpack_table_size));
+  }
+  if (absl::GetFlag(FLAGS_read_chunk_size) > 0) {
+    builder.AddChannelArgument(GRPC_ARG_TCP_READ_CHUNK_SIZE,
+                               absl::GetFlag(FLAGS_read_chunk_size));
+    builder.AddChannelArgument(GRPC_ARG_TCP_MIN_READ_CHUNK_SIZE,
+                               absl::GetFlag(FLAGS_read_chunk_size));
+  }
   builder.RegisterService(&callback_server);
 
   // Set up the server to start accepting requests.
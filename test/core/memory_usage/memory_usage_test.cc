@@ -41,13 +41,18 @@
 #include "test/core/util/subprocess.h"
 #include "test/core/util/test_config.h"
 
+// Default call and channel in order to trigger CI testing for each one;
+// idle_channel takes minutes and is run by hand.
 ABSL_FLAG(std::string, benchmark_names, "call,channel",
-          "Which benchmark to run");  // Default all benchmarks in order to
-                                      // trigger CI testing for each one
+          "Which benchmarks to run: call, channel, idle_channel");
 ABSL_FLAG(int, size, 1000, "Number of channels/calls");
 ABSL_FLAG(std::string, scenario_config, "insecure",
           "Possible Values: minstack (Use minimal stack), resource_quota, "
           "secure (Use SSL credentials on server)");
+ABSL_FLAG(int, idle_seconds, 30,
+          "How long the idle_channel benchmark holds its channels idle");
+ABSL_FLAG(int, keepalive_time_ms, 10000,
+          "Keepalive ping interval of the idle_channel benchmark");
 ABSL_FLAG(bool, memory_profiling, false,
           "Run memory profiling");  // TODO (chennancy) Connect this flag
 
@@ -143,6 +148,76 @@ int RunChannelBenchmark(char* root) {
   return svr.Join() == 0 ? 0 : 2;
 }
 
+// Connections to hold per 127.0.x.y address, well within the ephemeral port
+// range of one address pair
+constexpr int kChannelsPerLoopbackAddress = 20000;
+
+// Idle channel scale benchmark: holds --size mostly idle channels with
+// keepalive, and reports their memory and idle CPU. It runs once with
+// everything on and then once with each component turned off or shrunk, so
+// that the difference from the first run is what that component costs per
+// channel.
+int RunIdleChannelBenchmark(char* root) {
+  struct Variant {
+    const char* name;
+    std::vector<std::string> flags;  // Passed to both client and server
+    std::vector<std::string> client_flags;
+  };
+  const std::vector<Variant> variants = {
+      {"all", {}, {}},
+      {"no channelz", {"--nochannelz"}, {}},
+      {"no hpack table", {"--hpack_table_size=0"}, {}},
+      {"smallest read buffers", {"--read_chunk_size=256"}, {}},
+      {"no keepalive timers", {}, {"--keepalive_time_ms=-1"}},
+  };
+  const int size = absl::GetFlag(FLAGS_size);
+  for (const Variant& variant : variants) {
+    printf("=========Idle channels: %s========\n", variant.name);
+    fflush(stdout);
+    int port = grpc_pick_unused_port_or_die();
+
+    // start the server
+    std::vector<std::string> server_flags = {
+        absl::StrCat(root, "/memory_usage_callback_server",
+                     gpr_subprocess_binary_extension()),
+        "--bind", grpc_core::JoinHostPort("::", port)};
+    absl::c_copy(variant.flags, std::back_inserter(server_flags));
+    Subprocess svr(server_flags);
+
+    // Wait one second before starting client to avoid possible race
+    // condition of client sending an RPC before the server is set up
+    gpr_sleep_until(grpc_timeout_seconds_to_deadline(1));
+
+    // start the client
+    std::vector<std::string> client_flags = {
+        absl::StrCat(root, "/memory_usage_callback_client",
+                     gpr_subprocess_binary_extension()),
+        "--target",
+        grpc_core::JoinHostPort("127.0.0.1", port),
+        "--nosecure",
+        absl::StrCat("--server_pid=", svr.GetPID()),
+        absl::StrCat("--size=", size),
+        absl::StrCat("--loopback_addresses=",
+                     size / kChannelsPerLoopbackAddress + 1),
+        absl::StrCat("--idle_seconds=", absl::GetFlag(FLAGS_idle_seconds)),
+        absl::StrCat("--keepalive_time_ms=",
+                     absl::GetFlag(FLAGS_keepalive_time_ms))};
+    absl::c_copy(variant.flags, std::back_inserter(client_flags));
+    // Later flags win, so the variant can override the keepalive
+    absl::c_copy(variant.client_flags, std::back_inserter(client_flags));
+    Subprocess cli(client_flags);
+    // wait for completion
+    int status;
+    if ((status = cli.Join()) != 0) {
+      printf("client failed with: %d", status);
+      return 1;
+    }
+    svr.Interrupt();
+    if (svr.Join() != 0) return 2;
+  }
+  return 0;
+}
+
 int RunBenchmark(char* root, absl::string_view benchmark,
                  std::vector<std::string> server_scenario_flags,
                  std::vector<std::string> client_scenario_flags) {
@@ -150,6 +225,8 @@ int RunBenchmark(char* root, absl::string_view benchmark,
     return RunCallBenchmark(root, server_scenario_flags, client_scenario_flags);
   } else if (benchmark == "channel") {
     return RunChannelBenchmark(root);
+  } else if (benchmark == "idle_channel") {
+    return RunIdleChannelBenchmark(root);
   } else {
     gpr_log(GPR_INFO, "Not a valid benchmark name");
     return 4;
@@ -55,3 +55,27 @@ long GetMemUsage(absl::optional<int> pid) {
   // Memory in KB
   return resident_set;
 }
+
+double GetCpuSeconds(absl::optional<int> pid) {
+  std::string path = "/proc/self/stat";
+  if (pid != absl::nullopt) {
+    path = absl::StrCat("/proc/", pid.value(), "/stat");
+  }
+  std::ifstream stat_stream(path, std::ios_base::in);
+
+  // Temporary variables for irrelevant leading entries in stats
+  std::string temp_pid, comm, state, ppid, pgrp, session, tty_nr;
+  std::string tpgid, flags, minflt, cminflt, majflt, cmajflt;
+
+  // utime and stime are in clock ticks
+  long utime = 0, stime = 0;
+  stat_stream >> temp_pid >> comm >> state >> ppid >> pgrp >> session >>
+      tty_nr >> tpgid >> flags >> minflt >> cminflt >> majflt >> cmajflt >>
+      utime >> stime;
+  stat_stream.close();
+
+  // pid does not connect to an existing process
+  GPR_ASSERT(!state.empty());
+
+  return static_cast<double>(utime + stime) / sysconf(_SC_CLK_TCK);
+}
@@ -23,6 +23,10 @@
 // the pid
 long GetMemUsage(absl::optional<int> pid = absl::nullopt);
 
+// Returns the user plus system CPU time used so far by the process with the
+// given pid (or by the calling process), in seconds.
+double GetCpuSeconds(absl::optional<int> pid = absl::nullopt);
+
 struct MemStats {
   long rss;  // Resident set size, in kb
   static MemStats Snapshot() { return MemStats{GetMemUsage()}; }
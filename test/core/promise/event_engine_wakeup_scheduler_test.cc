@@ -16,7 +16,10 @@
 
 #include <stdlib.h>
 
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "gtest/gtest.h"
@@ -25,6 +28,7 @@
 #include <grpc/grpc.h>
 
 #include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/poll.h"
 
@@ -59,6 +63,86 @@ TEST(EventEngineWakeupSchedulerTest, Works) {
   EXPECT_EQ(state, 2);
 }
 
+TEST(BatchingEventEngineWakeupSchedulerTest, Works) {
+  int state = 0;
+  Notification done;
+  auto activity = MakeActivity(
+      [&state]() mutable -> Poll<absl::Status> {
+        ++state;
+        switch (state) {
+          case 1:
+            return Pending();
+          case 2:
+            return absl::OkStatus();
+          default:
+            abort();
+        }
+      },
+      BatchingEventEngineWakeupScheduler(
+          grpc_event_engine::experimental::CreateEventEngine()),
+      [&done](absl::Status status) {
+        EXPECT_EQ(status, absl::OkStatus());
+        done.Notify();
+      });
+
+  EXPECT_EQ(state, 1);
+  EXPECT_FALSE(done.HasBeenNotified());
+  activity->ForceWakeup();
+  done.WaitForNotification();
+  EXPECT_EQ(state, 2);
+}
+
+// An activity run by the event engine wakes up many others: they should all
+// run on the same thread, after it. Waking more than kMaxBatchSize also
+// exercises handing the rest back to the event engine.
+TEST(BatchingEventEngineWakeupSchedulerTest, RunsWakeupsFromSameThreadAfter) {
+  constexpr size_t kNumWoken = promise_detail::WakeupBatch::kMaxBatchSize + 8;
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine =
+      grpc_event_engine::experimental::CreateEventEngine();
+  std::atomic<bool> waker_done{false};
+  std::thread::id waker_thread;
+  std::atomic<size_t> num_on_waker_thread{0};
+  std::atomic<size_t> num_done{0};
+  Notification all_done;
+  std::vector<ActivityPtr> woken;
+  for (size_t i = 0; i < kNumWoken; ++i) {
+    woken.push_back(MakeActivity(
+        [&, polled = false]() mutable -> Poll<absl::Status> {
+          if (!polled) {
+            polled = true;
+            return Pending();
+          }
+          EXPECT_TRUE(waker_done.load());
+          if (std::this_thread::get_id() == waker_thread) {
+            num_on_waker_thread.fetch_add(1);
+          }
+          return absl::OkStatus();
+        },
+        BatchingEventEngineWakeupScheduler(event_engine),
+        [&](absl::Status status) {
+          EXPECT_EQ(status, absl::OkStatus());
+          if (num_done.fetch_add(1) + 1 == kNumWoken) all_done.Notify();
+        }));
+  }
+  auto waker = MakeActivity(
+      [&, polled = false]() mutable -> Poll<absl::Status> {
+        if (!polled) {
+          polled = true;
+          return Pending();
+        }
+        waker_thread = std::this_thread::get_id();
+        for (auto& activity : woken) activity->ForceWakeup();
+        waker_done.store(true);
+        return absl::OkStatus();
+      },
+      BatchingEventEngineWakeupScheduler(event_engine),
+      [](absl::Status status) { EXPECT_EQ(status, absl::OkStatus()); });
+  waker->ForceWakeup();
+  all_done.WaitForNotification();
+  EXPECT_GE(num_on_waker_thread.load(),
+            promise_detail::WakeupBatch::kMaxBatchSize);
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
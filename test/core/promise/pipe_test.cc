@@ -18,8 +18,10 @@
 #include <memory>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
+#include "absl/types/optional.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -30,6 +32,7 @@
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/detail/basic_join.h"
 #include "src/core/lib/promise/join.h"
+#include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
@@ -381,6 +384,121 @@ TEST_F(PipeTest, CanFlowControlThroughManyStages) {
   ASSERT_TRUE(*done);
 }
 
+TEST_F(PipeTest, BatchPipeReceivesQueuedMessagesTogether) {
+  StrictMock<MockFunction<void(absl::Status)>> on_done;
+  EXPECT_CALL(on_done, Call(absl::OkStatus()));
+  MakeActivity(
+      [] {
+        auto* pipe = GetContext<Arena>()->ManagedNew<BatchPipe<int, 4>>();
+        // All three pushes complete without the receiver running, and are
+        // then received by a single Next.
+        return Seq(Join(pipe->sender.Push(1), pipe->sender.Push(2),
+                        pipe->sender.Push(3)),
+                   [pipe](std::tuple<bool, bool, bool> pushed) {
+                     EXPECT_EQ(pushed, std::make_tuple(true, true, true));
+                     return pipe->receiver.Next();
+                   },
+                   [](absl::optional<std::vector<int>> batch) {
+                     EXPECT_THAT(batch, ::testing::Optional(
+                                            ::testing::ElementsAre(1, 2, 3)));
+                     return absl::OkStatus();
+                   });
+      },
+      NoWakeupScheduler(),
+      [&on_done](absl::Status status) { on_done.Call(std::move(status)); },
+      MakeScopedArena(1024, &memory_allocator_));
+}
+
+TEST_F(PipeTest, BatchPipeFlowControlsWhenFull) {
+  StrictMock<MockFunction<void(absl::Status)>> on_done;
+  EXPECT_CALL(on_done, Call(absl::OkStatus()));
+  MakeActivity(
+      [] {
+        auto* pipe = GetContext<Arena>()->ManagedNew<BatchPipe<int, 2>>();
+        auto* received = GetContext<Arena>()->ManagedNew<std::vector<int>>();
+        // The third push waits for the receiver to drain the first two.
+        return Seq(
+            Join(Seq(pipe->sender.Push(1),
+                     [pipe](bool) { return pipe->sender.Push(2); },
+                     [pipe](bool) { return pipe->sender.Push(3); },
+                     [pipe](bool ok) {
+                       pipe->sender.Close();
+                       return ok;
+                     }),
+                 Loop([pipe, received]() {
+                   return Map(pipe->receiver.Next(),
+                              [received](absl::optional<std::vector<int>> batch)
+                                  -> LoopCtl<bool> {
+                                if (!batch.has_value()) return true;
+                                EXPECT_LE(batch->size(), 2u);
+                                received->insert(received->end(),
+                                                 batch->begin(), batch->end());
+                                return Continue{};
+                              });
+                 })),
+            [received](std::tuple<bool, bool> result) {
+              EXPECT_EQ(result, std::make_tuple(true, true));
+              EXPECT_THAT(*received, ::testing::ElementsAre(1, 2, 3));
+              return absl::OkStatus();
+            });
+      },
+      NoWakeupScheduler(),
+      [&on_done](absl::Status status) { on_done.Call(std::move(status)); },
+      MakeScopedArena(1024, &memory_allocator_));
+}
+
+TEST_F(PipeTest, BatchPipeRunsInterceptorsOverEachMessage) {
+  StrictMock<MockFunction<void(absl::Status)>> on_done;
+  EXPECT_CALL(on_done, Call(absl::OkStatus()));
+  MakeActivity(
+      [] {
+        auto* pipe = GetContext<Arena>()->ManagedNew<BatchPipe<int, 4>>();
+        pipe->sender.InterceptAndMap([](int value) { return value * 10; });
+        pipe->receiver.InterceptAndMap([](int value) { return value + 1; });
+        return Seq(Join(pipe->sender.Push(1), pipe->sender.Push(2)),
+                   [pipe](std::tuple<bool, bool>) {
+                     return pipe->receiver.Next();
+                   },
+                   [](absl::optional<std::vector<int>> batch) {
+                     EXPECT_THAT(batch, ::testing::Optional(
+                                            ::testing::ElementsAre(11, 21)));
+                     return absl::OkStatus();
+                   });
+      },
+      NoWakeupScheduler(),
+      [&on_done](absl::Status status) { on_done.Call(std::move(status)); },
+      MakeScopedArena(1024, &memory_allocator_));
+}
+
+TEST_F(PipeTest, BatchPipeCancelsWhenInterceptorDropsMessage) {
+  StrictMock<MockFunction<void(absl::Status)>> on_done;
+  EXPECT_CALL(on_done, Call(absl::OkStatus()));
+  MakeActivity(
+      [] {
+        auto* pipe = GetContext<Arena>()->ManagedNew<BatchPipe<int, 4>>();
+        pipe->receiver.InterceptAndMap(
+            [](int value) -> absl::optional<int> {
+              if (value == 2) return absl::nullopt;
+              return value;
+            });
+        return Seq(Join(pipe->sender.Push(1), pipe->sender.Push(2)),
+                   [pipe](std::tuple<bool, bool>) {
+                     return pipe->receiver.Next();
+                   },
+                   [pipe](absl::optional<std::vector<int>> batch) {
+                     EXPECT_FALSE(batch.has_value());
+                     return pipe->sender.Push(3);
+                   },
+                   [](bool pushed) {
+                     EXPECT_FALSE(pushed);
+                     return absl::OkStatus();
+                   });
+      },
+      NoWakeupScheduler(),
+      [&on_done](absl::Status status) { on_done.Call(std::move(status)); },
+      MakeScopedArena(1024, &memory_allocator_));
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
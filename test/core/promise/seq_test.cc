@@ -90,6 +90,16 @@ TEST(SeqTest, SaneSizes) {
   EXPECT_LT(sizeof(p1), 2 * sizeof(Big));
 }
 
+TEST(SeqTest, StepsShareStorage) {
+  // Every factory is kept until its step runs, but only one promise is alive
+  // at a time: a sequence should cost its state, the first promise and the
+  // factories, not one slot per step.
+  int* p = nullptr;
+  auto step = [p](int) { return [p]() { return 1; }; };
+  auto seq = Seq([p]() { return 1; }, step, step, step, step);
+  EXPECT_LE(sizeof(seq), 6 * sizeof(int*));
+}
+
 TEST(SeqIterTest, Accumulate) {
   std::vector<int> v{1, 2, 3, 4, 5};
   EXPECT_EQ(SeqIter(v.begin(), v.end(), 0,
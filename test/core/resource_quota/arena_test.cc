@@ -25,6 +25,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/strings/str_join.h"
@@ -33,6 +34,8 @@
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/gpr/alloc.h"
+#include "src/core/lib/gprpp/numa.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -306,6 +309,79 @@ TEST_F(ArenaTest, ConcurrentMakePooled) {
   args.arena->Destroy();
 }
 
+TEST_F(ArenaTest, CountsChainedZones) {
+  ExecCtx exec_ctx;
+  Arena* arena = Arena::Create(1024, &memory_allocator_);
+  arena->Alloc(512);
+  EXPECT_EQ(arena->ChainedZones(), 0u);
+  arena->Alloc(2048);
+  EXPECT_EQ(arena->ChainedZones(), 1u);
+  arena->Alloc(4096);
+  EXPECT_EQ(arena->ChainedZones(), 2u);
+  arena->Destroy();
+}
+
+TEST_F(ArenaTest, CachedStorageIsReused) {
+  ExecCtx exec_ctx;
+  ArenaCache cache;
+  Arena* arena = Arena::Create(1024, &memory_allocator_, &cache);
+  void* storage = arena;
+  arena->Destroy();
+  arena = Arena::Create(1024, &memory_allocator_, &cache);
+  EXPECT_EQ(storage, arena);
+  // The initial zone of a reused arena is fully available again.
+  EXPECT_EQ(arena->TotalUsedBytes(), 0u);
+  memset(arena->Alloc(1024), 0xab, 1024);
+  arena->Destroy();
+}
+
+TEST_F(ArenaTest, CachedStorageOfOtherSizesIsNotReused) {
+  ExecCtx exec_ctx;
+  ArenaCache cache;
+  Arena* arena = Arena::Create(1024, &memory_allocator_, &cache);
+  void* storage = arena;
+  arena->Destroy();
+  arena = Arena::Create(4096, &memory_allocator_, &cache);
+  EXPECT_NE(storage, arena);
+  memset(arena->Alloc(4096), 0xab, 4096);
+  arena->Destroy();
+}
+
+TEST_F(ArenaTest, CachedStorageStaysOnItsNumaNode) {
+  ArenaCache cache;
+  void* storage = gpr_malloc_aligned(1024, GPR_MAX_ALIGNMENT);
+  const size_t node = NumaNodeCount() - 1;
+  ASSERT_TRUE(cache.Put(storage, 1024, node));
+  for (size_t other = 0; other < node; ++other) {
+    EXPECT_EQ(cache.Take(1024, other), nullptr);
+  }
+  EXPECT_EQ(cache.Take(1024, node), storage);
+  gpr_free_aligned(storage);
+}
+
+TEST_F(ArenaTest, ConcurrentCachedArenas) {
+  ArenaCache cache;
+  std::pair<ArenaCache*, MemoryAllocator*> args(&cache, &memory_allocator_);
+  Thread thds[CONCURRENT_TEST_THREADS];
+  for (auto& th : thds) {
+    th = Thread(
+        "grpc_concurrent_test",
+        [](void* arg) {
+          auto* a = static_cast<std::pair<ArenaCache*, MemoryAllocator*>*>(arg);
+          for (size_t i = 0; i < concurrent_test_iterations() / 10; i++) {
+            Arena* arena = Arena::Create(1024, a->second, a->first);
+            memset(arena->Alloc(512), 0xab, 512);
+            arena->Destroy();
+          }
+        },
+        &args);
+    th.Start();
+  }
+  for (auto& th : thds) {
+    th.Join();
+  }
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char* argv[]) {
@@ -19,12 +19,14 @@
 #include <chrono>
 #include <random>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
 
 #include <grpc/slice.h>
 
+#include "src/core/lib/gprpp/numa.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/resource_quota/call_checker.h"
 #include "test/core/util/test_config.h"
@@ -122,6 +124,27 @@ TEST(MemoryQuotaTest, ReserveRangeNoPressure) {
   memory_allocator.Release(total);
 }
 
+TEST(MemoryQuotaTest, TracksUsagePerNumaNode) {
+  MemoryQuota memory_quota("foo");
+  auto total_usage = [&memory_quota]() {
+    size_t usage = 0;
+    for (size_t node = 0; node < NumaNodeCount(); ++node) {
+      usage += memory_quota.GetNumaNodeUsage(node);
+    }
+    return usage;
+  };
+  {
+    ExecCtx exec_ctx;
+    auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
+    auto n = memory_allocator.Reserve(MemoryRequest(1024 * 1024));
+    EXPECT_GE(total_usage(), n);
+    memory_allocator.Release(n);
+  }
+  // Everything comes back once the allocator is gone.
+  EXPECT_EQ(total_usage(), 0);
+  EXPECT_EQ(memory_quota.GetNumaNodeUsage(NumaNodeCount()), 0);
+}
+
 TEST(MemoryQuotaTest, MakeSlice) {
   MemoryQuota memory_quota("foo");
   auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
@@ -169,6 +192,55 @@ TEST(MemoryQuotaTest, NoBunchingIfIdle) {
   EXPECT_GE(count_reclaimers_called.load(std::memory_order_relaxed), 8000);
 }
 
+TEST(MemoryQuotaTest, SubQuotaUsageCountsAgainstParent) {
+  MemoryQuota memory_quota("foo");
+  auto sub_quota = memory_quota.CreateSubQuota("foo/bar");
+  auto total_usage = [](const MemoryQuota& quota) {
+    size_t usage = 0;
+    for (size_t node = 0; node < NumaNodeCount(); ++node) {
+      usage += quota.GetNumaNodeUsage(node);
+    }
+    return usage;
+  };
+  ExecCtx exec_ctx;
+  auto memory_allocator = sub_quota->CreateMemoryAllocator("baz");
+  auto n = memory_allocator.Reserve(MemoryRequest(1024 * 1024));
+  EXPECT_GE(total_usage(*sub_quota), n);
+  EXPECT_GE(total_usage(memory_quota), n);
+  memory_allocator.Release(n);
+}
+
+TEST(MemoryQuotaTest, ParentOvercommitReclaimsFromHeaviestSubQuota) {
+  ExecCtx exec_ctx;
+  MemoryQuota memory_quota("foo");
+  memory_quota.SetSize(1024 * 1024);
+  auto light_quota = memory_quota.CreateSubQuota("foo/light");
+  auto heavy_quota = memory_quota.CreateSubQuota("foo/heavy");
+  auto light_allocator = light_quota->CreateMemoryAllocator("light");
+  auto heavy_allocator = heavy_quota->CreateMemoryAllocator("heavy");
+  auto light_n = light_allocator.Reserve(MemoryRequest(8192));
+  size_t heavy_n = 0;
+  light_allocator.PostReclaimer(ReclamationPass::kDestructive,
+                                [](absl::optional<ReclamationSweep> sweep) {
+                                  EXPECT_FALSE(sweep.has_value());
+                                });
+  auto checker = CallChecker::Make();
+  heavy_allocator.PostReclaimer(
+      ReclamationPass::kDestructive,
+      [&heavy_allocator, &heavy_n,
+       checker](absl::optional<ReclamationSweep> sweep) {
+        checker->Called();
+        EXPECT_TRUE(sweep.has_value());
+        heavy_allocator.Release(std::exchange(heavy_n, 0));
+      });
+  // Neither sub-quota has a size limit: only the parent goes into
+  // overcommit.
+  heavy_n = heavy_allocator.Reserve(MemoryRequest(1024 * 1024));
+  exec_ctx.Flush();
+  EXPECT_EQ(heavy_n, 0);
+  light_allocator.Release(light_n);
+}
+
 }  // namespace testing
 
 namespace memory_quota_detail {
@@ -19,6 +19,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+
 #include <grpc/grpc_security_constants.h>
 
 #include "src/core/lib/security/authorization/evaluate_args.h"
@@ -608,6 +611,79 @@ TEST_F(AuthorizationMatchersTest, PolicyAuthorizationMatcherFailedMatch) {
   EXPECT_FALSE(matcher.Matches(args));
 }
 
+TEST_F(AuthorizationMatchersTest, OrAuthorizationMatcherManyPaths) {
+  std::vector<std::unique_ptr<Rbac::Permission>> rules;
+  for (int i = 0; i < 10; ++i) {
+    rules.push_back(
+        std::make_unique<Rbac::Permission>(Rbac::Permission::MakePathPermission(
+            StringMatcher::Create(StringMatcher::Type::kExact,
+                                  absl::StrCat("/svc", i, "/Method"))
+                .value())));
+  }
+  rules.push_back(
+      std::make_unique<Rbac::Permission>(Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kPrefix,
+                                /*matcher=*/"/pkg.Foo/")
+              .value())));
+  rules.push_back(
+      std::make_unique<Rbac::Permission>(Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kExact,
+                                /*matcher=*/"/CASE/path",
+                                /*case_sensitive=*/false)
+              .value())));
+  rules.push_back(
+      std::make_unique<Rbac::Permission>(Rbac::Permission::MakePathPermission(
+          StringMatcher::Create(StringMatcher::Type::kSafeRegex,
+                                /*matcher=*/"/regex/.*")
+              .value())));
+  auto matcher = AuthorizationMatcher::Create(
+      Rbac::Permission::MakeOrPermission(std::move(rules)));
+  auto matches = [&](const char* path) {
+    EvaluateArgsTestUtil util;
+    util.AddPairToMetadata(":path", path);
+    return matcher->Matches(util.MakeEvaluateArgs());
+  };
+  EXPECT_TRUE(matches("/svc0/Method"));
+  EXPECT_TRUE(matches("/svc9/Method"));
+  EXPECT_TRUE(matches("/pkg.Foo/Bar"));
+  EXPECT_TRUE(matches("/case/PATH"));
+  EXPECT_TRUE(matches("/regex/foo"));
+  EXPECT_FALSE(matches("/svc10/Method"));
+  EXPECT_FALSE(matches("/svc1/method"));
+  EXPECT_FALSE(matches("/pkg.Foo"));
+}
+
+TEST_F(AuthorizationMatchersTest, OrAuthorizationMatcherManyPrincipalNames) {
+  std::vector<std::unique_ptr<Rbac::Principal>> ids;
+  for (absl::string_view name :
+       {"spiffe://foo.abc", "bar.test.domain.com", "CN=abc,OU=Google"}) {
+    ids.push_back(std::make_unique<Rbac::Principal>(
+        Rbac::Principal::MakeAuthenticatedPrincipal(
+            StringMatcher::Create(StringMatcher::Type::kExact, name).value())));
+  }
+  auto matcher = AuthorizationMatcher::Create(
+      Rbac::Principal::MakeOrPrincipal(std::move(ids)));
+  auto matches = [&](const char* security_type, const char* property_name,
+                     const char* value) {
+    EvaluateArgsTestUtil util;
+    util.AddPropertyToAuthContext(GRPC_TRANSPORT_SECURITY_TYPE_PROPERTY_NAME,
+                                  security_type);
+    util.AddPropertyToAuthContext(property_name, value);
+    return matcher->Matches(util.MakeEvaluateArgs());
+  };
+  EXPECT_TRUE(matches(GRPC_TLS_TRANSPORT_SECURITY_TYPE,
+                      GRPC_PEER_URI_PROPERTY_NAME, "spiffe://foo.abc"));
+  EXPECT_TRUE(matches(GRPC_SSL_TRANSPORT_SECURITY_TYPE,
+                      GRPC_PEER_DNS_PROPERTY_NAME, "bar.test.domain.com"));
+  EXPECT_TRUE(matches(GRPC_TLS_TRANSPORT_SECURITY_TYPE,
+                      GRPC_X509_SUBJECT_PROPERTY_NAME, "CN=abc,OU=Google"));
+  EXPECT_FALSE(matches(GRPC_TLS_TRANSPORT_SECURITY_TYPE,
+                       GRPC_PEER_URI_PROPERTY_NAME, "spiffe://bar.abc"));
+  // Connection is not authenticated.
+  EXPECT_FALSE(matches("insecure", GRPC_PEER_URI_PROPERTY_NAME,
+                       "spiffe://foo.abc"));
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
@@ -161,6 +161,56 @@ TEST(TlsCredentialsOptionsComparatorTest, DifferentCrlDirectory) {
   delete options_1;
   delete options_2;
 }
+TEST(TlsCredentialsOptionsComparatorTest, DifferentSessionTicketKeyProvider) {
+  auto* options_1 = grpc_tls_credentials_options_create();
+  auto* options_2 = grpc_tls_credentials_options_create();
+  options_1->set_session_ticket_key_provider(MakeRefCounted<grpc_tls_session_ticket_key_provider>());
+  options_2->set_session_ticket_key_provider(MakeRefCounted<grpc_tls_session_ticket_key_provider>());
+  EXPECT_FALSE(*options_1 == *options_2);
+  EXPECT_FALSE(*options_2 == *options_1);
+  delete options_1;
+  delete options_2;
+}
+TEST(TlsCredentialsOptionsComparatorTest, DifferentPrivateKeySigner) {
+  auto* options_1 = grpc_tls_credentials_options_create();
+  auto* options_2 = grpc_tls_credentials_options_create();
+  options_1->set_private_key_signer(MakeRefCounted<ExternalPrivateKeySigner>(grpc_tls_private_key_signer_external{}));
+  options_2->set_private_key_signer(MakeRefCounted<ExternalPrivateKeySigner>(grpc_tls_private_key_signer_external{}));
+  EXPECT_FALSE(*options_1 == *options_2);
+  EXPECT_FALSE(*options_2 == *options_1);
+  delete options_1;
+  delete options_2;
+}
+TEST(TlsCredentialsOptionsComparatorTest, DifferentVerifiedPeerCacheSize) {
+  auto* options_1 = grpc_tls_credentials_options_create();
+  auto* options_2 = grpc_tls_credentials_options_create();
+  options_1->set_verified_peer_cache_size(0);
+  options_2->set_verified_peer_cache_size(100);
+  EXPECT_FALSE(*options_1 == *options_2);
+  EXPECT_FALSE(*options_2 == *options_1);
+  delete options_1;
+  delete options_2;
+}
+TEST(TlsCredentialsOptionsComparatorTest, DifferentEarlyData) {
+  auto* options_1 = grpc_tls_credentials_options_create();
+  auto* options_2 = grpc_tls_credentials_options_create();
+  options_1->set_early_data(false);
+  options_2->set_early_data(true);
+  EXPECT_FALSE(*options_1 == *options_2);
+  EXPECT_FALSE(*options_2 == *options_1);
+  delete options_1;
+  delete options_2;
+}
+TEST(TlsCredentialsOptionsComparatorTest, DifferentEarlyDataAntiReplayCapacity) {
+  auto* options_1 = grpc_tls_credentials_options_create();
+  auto* options_2 = grpc_tls_credentials_options_create();
+  options_1->set_early_data_anti_replay_capacity(0);
+  options_2->set_early_data_anti_replay_capacity(100);
+  EXPECT_FALSE(*options_1 == *options_2);
+  EXPECT_FALSE(*options_2 == *options_1);
+  delete options_1;
+  delete options_2;
+}
 
 } // namespace
 } // namespace grpc_core
@@ -0,0 +1,139 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/security/transport/handshake_executor.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/synchronization/notification.h"
+#include "gtest/gtest.h"
+
+#include "src/core/lib/gprpp/sync.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(HandshakeExecutorTest, ServesFastLaneFirstAndShedsFullHandshakes) {
+  HandshakeExecutor executor(1);
+  // Keep the only thread busy while steps are queued behind it.
+  absl::Notification blocked;
+  absl::Notification unblock;
+  ASSERT_TRUE(executor.Run(
+      [&]() {
+        blocked.Notify();
+        unblock.WaitForNotification();
+      },
+      HandshakeExecutor::Priority::kContinuation, 2));
+  blocked.WaitForNotification();
+  Mutex mu;
+  std::vector<std::string> order;
+  auto step = [&](std::string name) {
+    return [&, name]() {
+      MutexLock lock(&mu);
+      order.push_back(name);
+    };
+  };
+  EXPECT_TRUE(executor.Run(step("full"),
+                           HandshakeExecutor::Priority::kFullHandshake, 2));
+  EXPECT_TRUE(executor.Run(step("resumption"),
+                           HandshakeExecutor::Priority::kResumption, 2));
+  // Two steps are waiting: a new full handshake is shed, but a resumption
+  // still fits in the fast lane, and continuations are never shed.
+  EXPECT_FALSE(executor.Run(step("shed"),
+                            HandshakeExecutor::Priority::kFullHandshake, 2));
+  EXPECT_TRUE(executor.Run(step("resumption2"),
+                           HandshakeExecutor::Priority::kResumption, 2));
+  EXPECT_FALSE(executor.Run(step("shed"),
+                            HandshakeExecutor::Priority::kResumption, 2));
+  absl::Notification done;
+  EXPECT_TRUE(executor.Run(
+      [&]() {
+        step("continuation")();
+        done.Notify();
+      },
+      HandshakeExecutor::Priority::kContinuation, 2));
+  EXPECT_TRUE(executor.Run(step("full2"),
+                           HandshakeExecutor::Priority::kFullHandshake, 10));
+  unblock.Notify();
+  done.WaitForNotification();
+  absl::Notification drained;
+  EXPECT_TRUE(executor.Run([&]() { drained.Notify(); },
+                           HandshakeExecutor::Priority::kFullHandshake, 10));
+  drained.WaitForNotification();
+  MutexLock lock(&mu);
+  EXPECT_EQ(order,
+            std::vector<std::string>({"resumption", "resumption2",
+                                      "continuation", "full", "full2"}));
+}
+
+// Builds a TLS record holding a ClientHello with the given extensions, each
+// a type and a body.
+std::string ClientHello(
+    const std::vector<std::pair<uint16_t, std::string>>& extensions) {
+  auto u16 = [](size_t v) {
+    return std::string({static_cast<char>(v >> 8), static_cast<char>(v)});
+  };
+  auto u24 = [&](size_t v) { return std::string(1, v >> 16) + u16(v); };
+  std::string exts;
+  for (const auto& ext : extensions) {
+    exts += u16(ext.first) + u16(ext.second.size()) + ext.second;
+  }
+  std::string body = u16(0x0303) + std::string(32, 'r') +
+                     std::string(1, 32) + std::string(32, 's') + u16(2) +
+                     u16(0x1301) + std::string(1, 1) + std::string(1, 0) +
+                     u16(exts.size()) + exts;
+  std::string handshake = std::string(1, 1) + u24(body.size()) + body;
+  return std::string(1, 22) + u16(0x0301) + u16(handshake.size()) + handshake;
+}
+
+TEST(TlsClientHelloOffersResumptionTest, FullHandshake) {
+  EXPECT_FALSE(TlsClientHelloOffersResumption(ClientHello({})));
+  // Server name, and an empty session ticket asking for a new one.
+  EXPECT_FALSE(TlsClientHelloOffersResumption(
+      ClientHello({{0, "\x00\x05\x00\x00\x02hi"}, {35, ""}})));
+}
+
+TEST(TlsClientHelloOffersResumptionTest, Resumption) {
+  EXPECT_TRUE(TlsClientHelloOffersResumption(
+      ClientHello({{0, "name"}, {35, "ticket"}})));
+  EXPECT_TRUE(
+      TlsClientHelloOffersResumption(ClientHello({{43, "v"}, {41, "psk"}})));
+}
+
+TEST(TlsClientHelloOffersResumptionTest, NotAClientHello) {
+  EXPECT_FALSE(TlsClientHelloOffersResumption(""));
+  EXPECT_FALSE(TlsClientHelloOffersResumption("PRI * HTTP/2.0"));
+  std::string hello = ClientHello({{41, "psk"}});
+  // Cut short before the extension.
+  EXPECT_FALSE(
+      TlsClientHelloOffersResumption(hello.substr(0, hello.size() - 8)));
+  // An extension claiming more bytes than there are.
+  hello[hello.size() - 4] = 0x7f;
+  EXPECT_FALSE(TlsClientHelloOffersResumption(hello));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -20,8 +20,12 @@
 
 #include <string.h>
 
+#include <atomic>
+
 #include <gtest/gtest.h>
 
+#include "absl/synchronization/notification.h"
+
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
@@ -617,6 +621,85 @@ TEST(JwtVerifierTest, JwtVerifierBadFormat) {
   grpc_core::HttpRequest::SetOverride(nullptr, nullptr, nullptr);
 }
 
+TEST(JwtVerifierTest, JwtVerifierCachesVerificationKey) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_jwt_verifier* verifier = grpc_jwt_verifier_create(nullptr, 0);
+  char* jwt = nullptr;
+  char* key_str = json_key_str(json_key_str_part3_for_google_email_issuer);
+  grpc_auth_json_key key = grpc_auth_json_key_create_from_string(key_str);
+  gpr_free(key_str);
+  ASSERT_TRUE(grpc_auth_json_key_is_valid(&key));
+  jwt = grpc_jwt_encode_and_sign(&key, expected_audience, expected_lifetime,
+                                 nullptr);
+  grpc_auth_json_key_destruct(&key);
+  ASSERT_NE(jwt, nullptr);
+  // First verification: the keys are fetched.
+  grpc_core::HttpRequest::SetOverride(httpcli_get_google_keys_for_email,
+                                      httpcli_post_should_not_be_called,
+                                      httpcli_put_should_not_be_called);
+  grpc_jwt_verifier_verify(verifier, nullptr, jwt, expected_audience,
+                           on_verification_success,
+                           const_cast<char*>(expected_user_data));
+  grpc_core::ExecCtx::Get()->Flush();
+  // Second verification: the cached key is used.
+  grpc_core::HttpRequest::SetOverride(httpcli_get_should_not_be_called,
+                                      httpcli_post_should_not_be_called,
+                                      httpcli_put_should_not_be_called);
+  grpc_jwt_verifier_verify(verifier, nullptr, jwt, expected_audience,
+                           on_verification_success,
+                           const_cast<char*>(expected_user_data));
+  grpc_jwt_verifier_destroy(verifier);
+  grpc_core::ExecCtx::Get()->Flush();
+  gpr_free(jwt);
+  grpc_core::HttpRequest::SetOverride(nullptr, nullptr, nullptr);
+}
+
+struct batch_verification_state {
+  std::atomic<int> remaining{0};
+  std::atomic<int> failures{0};
+  absl::Notification done;
+};
+
+static void on_batch_verification_done(void* user_data,
+                                       grpc_jwt_verifier_status status,
+                                       grpc_jwt_claims* claims) {
+  auto* state = static_cast<batch_verification_state*>(user_data);
+  if (status != GRPC_JWT_VERIFIER_OK || claims == nullptr ||
+      strcmp(grpc_jwt_claims_audience(claims), expected_audience) != 0) {
+    state->failures.fetch_add(1);
+  }
+  if (claims != nullptr) grpc_jwt_claims_destroy(claims);
+  if (state->remaining.fetch_sub(1) == 1) state->done.Notify();
+}
+
+TEST(JwtVerifierTest, JwtVerifierVerifyBatch) {
+  constexpr int kNumJwts = 8;
+  grpc_jwt_verifier* verifier = grpc_jwt_verifier_create(nullptr, 0);
+  char* key_str = json_key_str(json_key_str_part3_for_google_email_issuer);
+  grpc_auth_json_key key = grpc_auth_json_key_create_from_string(key_str);
+  gpr_free(key_str);
+  ASSERT_TRUE(grpc_auth_json_key_is_valid(&key));
+  char* jwt = grpc_jwt_encode_and_sign(&key, expected_audience,
+                                       expected_lifetime, nullptr);
+  grpc_auth_json_key_destruct(&key);
+  ASSERT_NE(jwt, nullptr);
+  grpc_core::HttpRequest::SetOverride(httpcli_get_google_keys_for_email,
+                                      httpcli_post_should_not_be_called,
+                                      httpcli_put_should_not_be_called);
+  batch_verification_state state;
+  state.remaining = kNumJwts;
+  grpc_jwt_verifier_batch_entry entries[kNumJwts];
+  for (int i = 0; i < kNumJwts; i++) {
+    entries[i] = {jwt, expected_audience, on_batch_verification_done, &state};
+  }
+  grpc_jwt_verifier_verify_batch(verifier, entries, kNumJwts);
+  gpr_free(jwt);
+  grpc_jwt_verifier_destroy(verifier);
+  state.done.WaitForNotification();
+  EXPECT_EQ(state.failures.load(), 0);
+  grpc_core::HttpRequest::SetOverride(nullptr, nullptr, nullptr);
+}
+
 // find verification key: bad jks, cannot find key in jks
 // bad signature custom provided email
 // bad key
@@ -36,6 +36,7 @@
 #include "src/core/lib/security/credentials/tls/grpc_tls_certificate_provider.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_credentials_options.h"
 #include "src/core/lib/security/credentials/tls/tls_credentials.h"
+#include "src/core/lib/security/credentials/tls/tls_verified_peer_cache.h"
 #include "src/core/lib/security/security_connector/ssl_utils_config.h"
 #include "src/core/tsi/transport_security.h"
 #include "test/core/util/test_config.h"
@@ -635,6 +636,101 @@ TEST_F(TlsSecurityConnectorTest,
   core_external_verifier->Unref();
 }
 
+// A verifier that accepts all the peers and counts them.
+class CountingCertificateVerifier : public grpc_tls_certificate_verifier {
+ public:
+  bool Verify(grpc_tls_custom_verification_check_request* /*request*/,
+              std::function<void(absl::Status)> /*callback*/,
+              absl::Status* sync_status) override {
+    ++num_verified_;
+    *sync_status = absl::OkStatus();
+    return true;
+  }
+  void Cancel(grpc_tls_custom_verification_check_request* /*request*/) override {
+  }
+  UniqueTypeName type() const override {
+    static UniqueTypeName::Factory kFactory("Counting");
+    return kFactory.Create();
+  }
+
+  int num_verified() const { return num_verified_; }
+
+ private:
+  int CompareImpl(const grpc_tls_certificate_verifier* other) const override {
+    return QsortCompare(static_cast<const grpc_tls_certificate_verifier*>(this),
+                        other);
+  }
+
+  int num_verified_ = 0;
+};
+
+TEST_F(TlsSecurityConnectorTest,
+       ChannelSecurityConnectorWithVerifiedPeerCacheSkipsVerifiedPeers) {
+  auto verifier = MakeRefCounted<CountingCertificateVerifier>();
+  RefCountedPtr<grpc_tls_credentials_options> options =
+      MakeRefCounted<grpc_tls_credentials_options>();
+  options->set_verify_server_cert(true);
+  options->set_certificate_verifier(verifier);
+  options->set_check_call_host(false);
+  options->set_verified_peer_cache_size(10);
+  RefCountedPtr<TlsCredentials> credential =
+      MakeRefCounted<TlsCredentials>(options);
+  // Each connection gets its own security connector, but they all share the
+  // cache of the credentials.
+  auto check_peer = [&](const char* pem_cert) {
+    ChannelArgs new_args;
+    RefCountedPtr<grpc_channel_security_connector> connector =
+        credential->create_security_connector(nullptr, kTargetName, &new_args);
+    ASSERT_NE(connector, nullptr);
+    tsi_peer peer;
+    GPR_ASSERT(tsi_construct_peer(2, &peer) == TSI_OK);
+    GPR_ASSERT(tsi_construct_string_peer_property(
+                   TSI_SSL_ALPN_SELECTED_PROTOCOL, "grpc", strlen("grpc"),
+                   &peer.properties[0]) == TSI_OK);
+    GPR_ASSERT(tsi_construct_string_peer_property_from_cstring(
+                   TSI_X509_PEM_CERT_PROPERTY, pem_cert,
+                   &peer.properties[1]) == TSI_OK);
+    RefCountedPtr<grpc_auth_context> auth_context;
+    ExecCtx exec_ctx;
+    grpc_closure* on_peer_checked = GRPC_CLOSURE_CREATE(
+        VerifyExpectedErrorCallback, nullptr, grpc_schedule_on_exec_ctx);
+    connector->check_peer(peer, nullptr, new_args, &auth_context,
+                          on_peer_checked);
+  };
+  check_peer("pem_cert_1");
+  EXPECT_EQ(verifier->num_verified(), 1);
+  check_peer("pem_cert_1");
+  EXPECT_EQ(verifier->num_verified(), 1);
+  check_peer("pem_cert_2");
+  EXPECT_EQ(verifier->num_verified(), 2);
+}
+
+TEST(TlsVerifiedPeerCacheTest, EvictsLeastRecentlyUsed) {
+  auto cache = MakeRefCounted<TlsVerifiedPeerCache>(2);
+  std::string digest = TlsVerifiedPeerCache::TrustBundleDigest("roots");
+  cache->Insert("cert_1", "target", digest);
+  cache->Insert("cert_2", "target", digest);
+  EXPECT_TRUE(cache->Lookup("cert_1", "target", digest));
+  cache->Insert("cert_3", "target", digest);
+  EXPECT_EQ(cache->Size(), 2);
+  EXPECT_TRUE(cache->Lookup("cert_1", "target", digest));
+  EXPECT_FALSE(cache->Lookup("cert_2", "target", digest));
+  EXPECT_TRUE(cache->Lookup("cert_3", "target", digest));
+}
+
+TEST(TlsVerifiedPeerCacheTest, KeysOnTargetAndTrustBundle) {
+  auto cache = MakeRefCounted<TlsVerifiedPeerCache>(10);
+  std::string digest = TlsVerifiedPeerCache::TrustBundleDigest("roots");
+  cache->Insert("cert", "target", digest);
+  EXPECT_TRUE(cache->Lookup("cert", "target", digest));
+  EXPECT_FALSE(cache->Lookup("cert", "other_target", digest));
+  EXPECT_FALSE(cache->Lookup(
+      "cert", "target", TlsVerifiedPeerCache::TrustBundleDigest("new_roots")));
+  cache->Clear();
+  EXPECT_EQ(cache->Size(), 0);
+  EXPECT_FALSE(cache->Lookup("cert", "target", digest));
+}
+
 TEST_F(TlsSecurityConnectorTest,
        ChannelSecurityConnectorHostnameVerifierSucceeds) {
   RefCountedPtr<grpc_tls_credentials_options> options =
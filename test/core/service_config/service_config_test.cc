@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -76,6 +77,10 @@ class TestParser1 : public ServiceConfigParser::Parser {
     return LoadFromJson<std::unique_ptr<TestParsedConfig1>>(json, JsonArgs(),
                                                             errors);
   }
+
+  std::vector<absl::string_view> ChannelArgsUsed() const override {
+    return {GRPC_ARG_DISABLE_PARSING};
+  }
 };
 
 class TestParsedConfig2 : public ServiceConfigParser::ParsedConfig {
@@ -107,6 +112,10 @@ class TestParser2 : public ServiceConfigParser::Parser {
     return LoadFromJson<std::unique_ptr<TestParsedConfig2>>(json, JsonArgs(),
                                                             errors);
   }
+
+  std::vector<absl::string_view> ChannelArgsUsed() const override {
+    return {GRPC_ARG_DISABLE_PARSING};
+  }
 };
 
 class ServiceConfigTest : public ::testing::Test {
@@ -292,6 +301,44 @@ TEST_F(ServiceConfigTest, Parser1DisabledViaChannelArg) {
   EXPECT_EQ((*service_config)->GetGlobalParsedConfig(0), nullptr);
 }
 
+TEST_F(ServiceConfigTest, IdenticalConfigsAreShared) {
+  const char* test_json =
+      "{\"global_param\":5,"
+      "\"methodConfig\":[{\"name\":[{\"service\":\"TestServ\"}],"
+      "\"method_param\":5}]}";
+  auto service_config1 = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config1.ok()) << service_config1.status();
+  // Channel args that no parser uses do not matter.
+  auto service_config2 = ServiceConfigImpl::Create(
+      ChannelArgs().Set("unused_arg", 1), test_json);
+  ASSERT_TRUE(service_config2.ok()) << service_config2.status();
+  EXPECT_EQ(service_config1->get(), service_config2->get());
+  // Channel args that a parser uses do.
+  auto service_config3 = ServiceConfigImpl::Create(
+      ChannelArgs().Set(GRPC_ARG_DISABLE_PARSING, 1), test_json);
+  ASSERT_TRUE(service_config3.ok()) << service_config3.status();
+  EXPECT_NE(service_config1->get(), service_config3->get());
+  EXPECT_EQ((*service_config3)->GetGlobalParsedConfig(0), nullptr);
+  // So does the JSON string.
+  auto service_config4 =
+      ServiceConfigImpl::Create(ChannelArgs(), "{\"global_param\":5}");
+  ASSERT_TRUE(service_config4.ok()) << service_config4.status();
+  EXPECT_NE(service_config1->get(), service_config4->get());
+}
+
+TEST_F(ServiceConfigTest, ReleasedConfigsAreNotShared) {
+  const char* test_json = "{\"global_param\":5}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  service_config->reset();
+  service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  EXPECT_EQ(static_cast<TestParsedConfig1*>(
+                (*service_config)->GetGlobalParsedConfig(0))
+                ->value(),
+            5);
+}
+
 TEST_F(ServiceConfigTest, Parser1ErrorInvalidType) {
   const char* test_json = "{\"global_param\":[]}";
   auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
@@ -327,6 +374,37 @@ TEST_F(ServiceConfigTest, Parser2BasicTest) {
   EXPECT_EQ(static_cast<TestParsedConfig1*>(parsed_config)->value(), 5);
 }
 
+TEST_F(ServiceConfigTest, MethodConfigLookupOrder) {
+  const char* test_json =
+      "{\"methodConfig\": ["
+      "{\"name\":[{\"service\":\"A\",\"method\":\"M\"}],"
+      "\"method_param\":1},"
+      "{\"name\":[{\"service\":\"A\"}],\"method_param\":2},"
+      "{\"name\":[{\"service\":\"B\",\"method\":\"M\"}],"
+      "\"method_param\":3},"
+      "{\"name\":[{}],\"method_param\":4}]}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  auto lookup = [&](const char* path) -> uint32_t {
+    const auto* vector_ptr =
+        (*service_config)
+            ->GetMethodParsedConfigVector(grpc_slice_from_static_string(path));
+    if (vector_ptr == nullptr) return 0;
+    return static_cast<TestParsedConfig2*>((*vector_ptr)[1].get())->value();
+  };
+  // Exact method match.
+  EXPECT_EQ(lookup("/A/M"), 1);
+  EXPECT_EQ(lookup("/B/M"), 3);
+  // Service wildcard.
+  EXPECT_EQ(lookup("/A/Other"), 2);
+  EXPECT_EQ(lookup("/A/"), 2);
+  // Default method config.
+  EXPECT_EQ(lookup("/B/Other"), 4);
+  EXPECT_EQ(lookup("/C/M"), 4);
+  EXPECT_EQ(lookup("/A/M/"), 4);
+  EXPECT_EQ(lookup("/AB/M"), 4);
+}
+
 TEST_F(ServiceConfigTest, Parser2DisabledViaChannelArg) {
   const ChannelArgs args = ChannelArgs().Set(GRPC_ARG_DISABLE_PARSING, 1);
   const char* test_json =
@@ -183,6 +183,41 @@ void test_slice_buffer_first() {
   ASSERT_EQ(buf.length, 0);
 }
 
+TEST(CSliceBufferTest, ShrinkToFit) {
+  grpc_slice_buffer buf;
+  grpc_slice_buffer_init(&buf);
+  for (int i = 0; i < 4 * GRPC_SLICE_BUFFER_INLINE_ELEMENTS; ++i) {
+    grpc_slice_buffer_add_indexed(&buf, grpc_slice_from_copied_string("a"));
+  }
+  ASSERT_NE(buf.base_slices, buf.inlined);
+
+  // Drop most of the slices: the rest move into a smaller array.
+  for (int i = 0; i < 2 * GRPC_SLICE_BUFFER_INLINE_ELEMENTS; ++i) {
+    grpc_slice_unref(grpc_slice_buffer_take_first(&buf));
+  }
+  grpc_slice_buffer_shrink_to_fit(&buf);
+  ASSERT_NE(buf.base_slices, buf.inlined);
+  ASSERT_EQ(buf.capacity, 2 * GRPC_SLICE_BUFFER_INLINE_ELEMENTS);
+  ASSERT_EQ(buf.count, 2 * GRPC_SLICE_BUFFER_INLINE_ELEMENTS);
+  ASSERT_EQ(buf.length, 2 * GRPC_SLICE_BUFFER_INLINE_ELEMENTS);
+
+  // Once they fit, they move back into the inlined array.
+  grpc_slice_buffer_reset_and_unref(&buf);
+  grpc_slice_buffer_add(&buf, grpc_slice_from_copied_string("bb"));
+  grpc_slice_buffer_shrink_to_fit(&buf);
+  ASSERT_EQ(buf.base_slices, buf.inlined);
+  ASSERT_EQ(buf.capacity, GRPC_SLICE_BUFFER_INLINE_ELEMENTS);
+  ASSERT_EQ(buf.count, 1);
+  ASSERT_EQ(GRPC_SLICE_LENGTH(buf.slices[0]), 2);
+
+  // The buffer keeps growing as usual afterwards.
+  for (int i = 0; i < 2 * GRPC_SLICE_BUFFER_INLINE_ELEMENTS; ++i) {
+    grpc_slice_buffer_add_indexed(&buf, grpc_slice_from_copied_string("a"));
+  }
+  ASSERT_EQ(buf.count, 2 * GRPC_SLICE_BUFFER_INLINE_ELEMENTS + 1);
+  grpc_slice_buffer_destroy(&buf);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -116,10 +116,13 @@ TEST(PercentEncodingTest, MainTest) {
   TEST_VECTOR("\xff", "%FF", grpc_core::PercentEncodingType::URL);
   TEST_VECTOR("\xee", "%EE", grpc_core::PercentEncodingType::URL);
   TEST_VECTOR("%2", "%252", grpc_core::PercentEncodingType::URL);
+  TEST_VECTOR("no escapes until\xff then a b", "no escapes until%FF then a b",
+              grpc_core::PercentEncodingType::Compatible);
   TEST_NONCONFORMANT_VECTOR("%", "%");
   TEST_NONCONFORMANT_VECTOR("%A", "%A");
   TEST_NONCONFORMANT_VECTOR("%AG", "%AG");
   TEST_NONCONFORMANT_VECTOR("\0", "\0");
+  TEST_NONCONFORMANT_VECTOR("a run %41 b run%4", "a run A b run%4");
 }
 
 int main(int argc, char** argv) {
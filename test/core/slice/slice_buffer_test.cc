@@ -78,6 +78,34 @@ TEST(SliceBufferTest, SliceRefTest) {
   sb.Clear();
 }
 
+TEST(SliceBufferTest, MoveTest) {
+  for (size_t count : {1, 3, 20}) {
+    SliceBuffer sb;
+    for (size_t i = 0; i < count; i++) {
+      sb.AppendIndexed(MakeSlice(kNewSliceLength + i));
+    }
+    // Leave unused slots at the front, as a parser consuming the buffer does.
+    Slice first = sb.TakeFirst();
+    SliceBuffer moved(std::move(sb));
+    EXPECT_EQ(sb.Count(), 0);
+    EXPECT_EQ(sb.Length(), 0);
+    ASSERT_EQ(moved.Count(), count - 1);
+    for (size_t i = 1; i < count; i++) {
+      EXPECT_EQ(moved[i - 1].length(), kNewSliceLength + i);
+    }
+    // The moved-from buffer is usable again.
+    sb.Append(std::move(first));
+    SliceBuffer assigned;
+    assigned.Append(MakeSlice(kNewSliceLength));
+    assigned = std::move(moved);
+    EXPECT_EQ(moved.Count(), 0);
+    ASSERT_EQ(assigned.Count(), count - 1);
+    assigned = std::move(sb);
+    ASSERT_EQ(assigned.Count(), 1);
+    EXPECT_EQ(assigned.Length(), kNewSliceLength);
+  }
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,184 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/slice/slice_pool.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/gprpp/numa.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// A single ExecCtx pins the calling thread to one CPU's pool.
+TEST(SlicePoolTest, ReusesReleasedBlocks) {
+  ExecCtx exec_ctx;
+  auto before = global_stats().Collect();
+  grpc_slice first = PooledSliceMalloc(64 * 1024);
+  ASSERT_EQ(GRPC_SLICE_LENGTH(first), 64 * 1024);
+  memset(GRPC_SLICE_START_PTR(first), 'a', GRPC_SLICE_LENGTH(first));
+  uint8_t* first_bytes = GRPC_SLICE_START_PTR(first);
+  grpc_slice_unref(first);
+  // Any length in the same size class reuses the block.
+  grpc_slice second = PooledSliceMalloc(40 * 1024);
+  EXPECT_EQ(GRPC_SLICE_LENGTH(second), 40 * 1024);
+  EXPECT_EQ(GRPC_SLICE_START_PTR(second), first_bytes);
+  grpc_slice_unref(second);
+  auto diff = global_stats().Collect()->Diff(*before);
+  EXPECT_GE(diff->slice_pool_hits, 1);
+  EXPECT_GE(diff->slice_pool_misses + diff->slice_pool_hits, 2);
+}
+
+TEST(SlicePoolTest, BlocksOutliveOtherReferences) {
+  ExecCtx exec_ctx;
+  grpc_slice slice = PooledSliceMalloc(8 * 1024);
+  memset(GRPC_SLICE_START_PTR(slice), 'b', GRPC_SLICE_LENGTH(slice));
+  grpc_slice tail = grpc_slice_split_tail(&slice, 4 * 1024);
+  grpc_slice_unref(slice);
+  // The tail still holds the block, so it must not be handed out again.
+  grpc_slice other = PooledSliceMalloc(8 * 1024);
+  EXPECT_NE(GRPC_SLICE_START_PTR(other), GRPC_SLICE_START_PTR(slice));
+  memset(GRPC_SLICE_START_PTR(other), 'c', GRPC_SLICE_LENGTH(other));
+  for (size_t i = 0; i < GRPC_SLICE_LENGTH(tail); ++i) {
+    ASSERT_EQ(GRPC_SLICE_START_PTR(tail)[i], 'b');
+  }
+  grpc_slice_unref(other);
+  grpc_slice_unref(tail);
+}
+
+TEST(SlicePoolTest, ChargesOwnerWhileInUse) {
+  ExecCtx exec_ctx;
+  MemoryQuota memory_quota("test");
+  auto usage = [&memory_quota]() {
+    size_t usage = 0;
+    for (size_t node = 0; node < NumaNodeCount(); ++node) {
+      usage += memory_quota.GetNumaNodeUsage(node);
+    }
+    return usage;
+  };
+  auto owner =
+      std::make_unique<MemoryOwner>(memory_quota.CreateMemoryOwner("owner"));
+  grpc_slice slice = PooledSliceMalloc(64 * 1024, owner.get());
+  ASSERT_EQ(GRPC_SLICE_LENGTH(slice), 64 * 1024);
+  EXPECT_GE(usage(), 64 * 1024);
+  uint8_t* bytes = GRPC_SLICE_START_PTR(slice);
+  // As with MakeSlice, the slice may outlive its owner, as read buffers can
+  // outlive their endpoint.
+  owner.reset();
+  grpc_slice_unref(slice);
+  EXPECT_EQ(usage(), 0);
+  // The block went back to the pool.
+  grpc_slice other = PooledSliceMalloc(64 * 1024);
+  EXPECT_EQ(GRPC_SLICE_START_PTR(other), bytes);
+  grpc_slice_unref(other);
+}
+
+TEST(SlicePoolTest, LengthsOutsideThePoolAreNotPooled) {
+  ExecCtx exec_ctx;
+  auto before = global_stats().Collect();
+  for (size_t length : {size_t{0}, size_t{100}, kSlicePoolMinBlockSize - 1,
+                        kSlicePoolMaxBlockSize + 1}) {
+    grpc_slice slice = PooledSliceMalloc(length);
+    EXPECT_EQ(GRPC_SLICE_LENGTH(slice), length);
+    grpc_slice_unref(slice);
+  }
+  auto diff = global_stats().Collect()->Diff(*before);
+  EXPECT_EQ(diff->slice_pool_hits, 0);
+  EXPECT_EQ(diff->slice_pool_misses, 0);
+}
+
+TEST(SlicePoolTest, ReleasedOnOtherThreads) {
+  // Slices are allocated and released without an ExecCtx, and released on a
+  // different thread than the one that allocated them, as when a message
+  // serialized by the application is sent by the transport.
+  std::vector<grpc_slice> slices;
+  for (int i = 0; i < 10; ++i) {
+    for (size_t length = kSlicePoolMinBlockSize;
+         length <= kSlicePoolMaxBlockSize; length *= 2) {
+      slices.push_back(PooledSliceMalloc(length));
+      memset(GRPC_SLICE_START_PTR(slices.back()), 'd', length);
+    }
+  }
+  std::thread([&slices]() {
+    for (grpc_slice& slice : slices) grpc_slice_unref(slice);
+  }).join();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([]() {
+      for (int i = 0; i < 1000; ++i) {
+        grpc_slice slice = PooledSliceMalloc(4096 + i);
+        memset(GRPC_SLICE_START_PTR(slice), 'e', GRPC_SLICE_LENGTH(slice));
+        grpc_slice_unref(slice);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
+TEST(SlicePoolTest, IdleBlocksAreReclaimed) {
+  {
+    ExecCtx exec_ctx;
+    std::vector<grpc_slice> slices;
+    for (int i = 0; i < 16; ++i) {
+      slices.push_back(PooledSliceMalloc(64 * 1024));
+    }
+    for (grpc_slice& slice : slices) grpc_slice_unref(slice);
+  }
+  auto before = global_stats().Collect();
+  // Shrinking the quota below what is in use makes it reclaim memory.
+  auto memory_quota = ResourceQuota::Default()->memory_quota();
+  {
+    ExecCtx exec_ctx;
+    memory_quota->SetSize(1);
+  }
+  const gpr_timespec deadline = grpc_timeout_seconds_to_deadline(30);
+  while (global_stats().Collect()->Diff(*before)->slice_pool_frees == 0) {
+    ASSERT_LT(gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline), 0);
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(10));
+  }
+  ExecCtx exec_ctx;
+  memory_quota->SetSize(std::numeric_limits<intptr_t>::max());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
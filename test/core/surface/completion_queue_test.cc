@@ -75,7 +75,8 @@ static void shutdown_and_destroy(grpc_completion_queue* cc) {
 TEST(GrpcCompletionQueueTest, TestNoOp) {
   grpc_cq_completion_type completion_types[] = {GRPC_CQ_NEXT, GRPC_CQ_PLUCK};
   grpc_cq_polling_type polling_types[] = {
-      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING,
+      GRPC_CQ_NON_POLLING_LOCK_FREE};
   grpc_completion_queue_attributes attr;
   LOG_TEST("test_no_op");
 
@@ -114,7 +115,8 @@ TEST(GrpcCompletionQueueTest, TestPollsetConversion) {
 
 TEST(GrpcCompletionQueueTest, TestWaitEmpty) {
   grpc_cq_polling_type polling_types[] = {
-      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING,
+      GRPC_CQ_NON_POLLING_LOCK_FREE};
   grpc_completion_queue* cc;
   grpc_completion_queue_attributes attr;
   grpc_event event;
@@ -142,7 +144,8 @@ TEST(GrpcCompletionQueueTest, TestCqEndOp) {
   grpc_completion_queue* cc;
   grpc_cq_completion completion;
   grpc_cq_polling_type polling_types[] = {
-      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING,
+      GRPC_CQ_NON_POLLING_LOCK_FREE};
   grpc_completion_queue_attributes attr;
   void* tag = create_test_tag();
 
@@ -175,7 +178,8 @@ TEST(GrpcCompletionQueueTest, TestCqTlsCacheFull) {
   grpc_completion_queue* cc;
   grpc_cq_completion completion;
   grpc_cq_polling_type polling_types[] = {
-      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING,
+      GRPC_CQ_NON_POLLING_LOCK_FREE};
   grpc_completion_queue_attributes attr;
   void* tag = create_test_tag();
   void* res_tag;
@@ -216,7 +220,8 @@ TEST(GrpcCompletionQueueTest, TestCqTlsCacheFull) {
 TEST(GrpcCompletionQueueTest, TestCqTlsCacheEmpty) {
   grpc_completion_queue* cc;
   grpc_cq_polling_type polling_types[] = {
-      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING,
+      GRPC_CQ_NON_POLLING_LOCK_FREE};
   grpc_completion_queue_attributes attr;
   void* res_tag;
   int ok;
@@ -242,7 +247,8 @@ TEST(GrpcCompletionQueueTest, TestCqTlsCacheEmpty) {
 
 TEST(GrpcCompletionQueueTest, TestShutdownThenNextPolling) {
   grpc_cq_polling_type polling_types[] = {
-      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING,
+      GRPC_CQ_NON_POLLING_LOCK_FREE};
   grpc_completion_queue* cc;
   grpc_completion_queue_attributes attr;
   grpc_event event;
@@ -264,7 +270,8 @@ TEST(GrpcCompletionQueueTest, TestShutdownThenNextPolling) {
 
 TEST(GrpcCompletionQueueTest, TestShutdownThenNextWithTimeout) {
   grpc_cq_polling_type polling_types[] = {
-      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING,
+      GRPC_CQ_NON_POLLING_LOCK_FREE};
   grpc_completion_queue* cc;
   grpc_completion_queue_attributes attr;
   grpc_event event;
@@ -291,7 +298,8 @@ TEST(GrpcCompletionQueueTest, TestPluck) {
   void* tags[128];
   grpc_cq_completion completions[GPR_ARRAY_SIZE(tags)];
   grpc_cq_polling_type polling_types[] = {
-      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING,
+      GRPC_CQ_NON_POLLING_LOCK_FREE};
   grpc_completion_queue_attributes attr;
   unsigned i, j;
 
@@ -343,7 +351,8 @@ TEST(GrpcCompletionQueueTest, TestPluck) {
 
 TEST(GrpcCompletionQueueTest, TestPluckAfterShutdown) {
   grpc_cq_polling_type polling_types[] = {
-      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING,
+      GRPC_CQ_NON_POLLING_LOCK_FREE};
   grpc_event ev;
   grpc_completion_queue* cc;
   grpc_completion_queue_attributes attr;
@@ -369,7 +378,8 @@ TEST(GrpcCompletionQueueTest, TestCallback) {
   static void* tags[128];
   grpc_cq_completion completions[GPR_ARRAY_SIZE(tags)];
   grpc_cq_polling_type polling_types[] = {
-      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING};
+      GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_LISTENING, GRPC_CQ_NON_POLLING,
+      GRPC_CQ_NON_POLLING_LOCK_FREE};
   grpc_completion_queue_attributes attr;
   unsigned i;
   static gpr_mu mu, shutdown_mu;
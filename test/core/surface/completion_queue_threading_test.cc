@@ -213,18 +213,25 @@ static void consumer_thread(void* arg) {
   }
 }
 
-static void test_threading(size_t producers, size_t consumers) {
+static void test_threading(size_t producers, size_t consumers,
+                           grpc_cq_polling_type polling_type) {
   test_thread_options* options = static_cast<test_thread_options*>(
       gpr_malloc((producers + consumers) * sizeof(test_thread_options)));
   gpr_event phase1 = GPR_EVENT_INIT;
   gpr_event phase2 = GPR_EVENT_INIT;
-  grpc_completion_queue* cc = grpc_completion_queue_create_for_next(nullptr);
+  grpc_completion_queue_attributes attr;
+  attr.version = 1;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  attr.cq_polling_type = polling_type;
+  grpc_completion_queue* cc = grpc_completion_queue_create(
+      grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
   size_t i;
   size_t total_consumed = 0;
   static int optid = 101;
 
-  gpr_log(GPR_INFO, "%s: %" PRIuPTR " producers, %" PRIuPTR " consumers",
-          "test_threading", producers, consumers);
+  gpr_log(GPR_INFO,
+          "%s: %" PRIuPTR " producers, %" PRIuPTR " consumers, polling type %d",
+          "test_threading", producers, consumers, polling_type);
 
   // start all threads: they will wait for phase1
   grpc_core::Thread* threads = static_cast<grpc_core::Thread*>(
@@ -298,10 +305,13 @@ static void test_threading(size_t producers, size_t consumers) {
 TEST(CompletionQueueThreadingTest, MainTest) {
   grpc_init();
   test_too_many_plucks();
-  test_threading(1, 1);
-  test_threading(1, 10);
-  test_threading(10, 1);
-  test_threading(10, 10);
+  for (grpc_cq_polling_type polling_type :
+       {GRPC_CQ_DEFAULT_POLLING, GRPC_CQ_NON_POLLING_LOCK_FREE}) {
+    test_threading(1, 1, polling_type);
+    test_threading(1, 10, polling_type);
+    test_threading(10, 1, polling_type);
+    test_threading(10, 10, polling_type);
+  }
   grpc_shutdown();
 }
 
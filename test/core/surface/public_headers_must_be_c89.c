@@ -116,6 +116,7 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_channel_check_connectivity_state);
   printf("%lx", (unsigned long) grpc_channel_num_external_connectivity_watchers);
   printf("%lx", (unsigned long) grpc_channel_watch_connectivity_state);
+  printf("%lx", (unsigned long) grpc_channel_watch_warm);
   printf("%lx", (unsigned long) grpc_channel_support_connectivity_watcher);
   printf("%lx", (unsigned long) grpc_channel_create_call);
   printf("%lx", (unsigned long) grpc_channel_register_call);
@@ -203,6 +204,7 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_auth_metadata_context_copy);
   printf("%lx", (unsigned long) grpc_auth_metadata_context_reset);
   printf("%lx", (unsigned long) grpc_metadata_credentials_create_from_plugin);
+  printf("%lx", (unsigned long) grpc_metadata_credentials_create_from_plugin_with_metadata_ttl);
   printf("%lx", (unsigned long) grpc_ssl_server_certificate_config_create);
   printf("%lx", (unsigned long) grpc_ssl_server_certificate_config_destroy);
   printf("%lx", (unsigned long) grpc_ssl_server_credentials_create);
@@ -235,7 +237,18 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_tls_credentials_options_set_identity_cert_name);
   printf("%lx", (unsigned long) grpc_tls_credentials_options_set_cert_request_type);
   printf("%lx", (unsigned long) grpc_tls_credentials_options_set_crl_directory);
+  printf("%lx", (unsigned long) grpc_tls_session_ticket_key_provider_in_memory_create);
+  printf("%lx", (unsigned long) grpc_tls_session_ticket_key_provider_in_memory_set_keys);
+  printf("%lx", (unsigned long) grpc_tls_session_ticket_key_provider_file_watcher_create);
+  printf("%lx", (unsigned long) grpc_tls_session_ticket_key_provider_release);
+  printf("%lx", (unsigned long) grpc_tls_credentials_options_set_session_ticket_key_provider);
+  printf("%lx", (unsigned long) grpc_tls_private_key_signer_external_create);
+  printf("%lx", (unsigned long) grpc_tls_private_key_signer_release);
+  printf("%lx", (unsigned long) grpc_tls_credentials_options_set_private_key_signer);
   printf("%lx", (unsigned long) grpc_tls_credentials_options_set_verify_server_cert);
+  printf("%lx", (unsigned long) grpc_tls_credentials_options_set_verified_peer_cache_size);
+  printf("%lx", (unsigned long) grpc_tls_credentials_options_set_early_data);
+  printf("%lx", (unsigned long) grpc_tls_credentials_options_set_early_data_anti_replay_capacity);
   printf("%lx", (unsigned long) grpc_tls_credentials_options_set_check_call_host);
   printf("%lx", (unsigned long) grpc_insecure_credentials_create);
   printf("%lx", (unsigned long) grpc_insecure_server_credentials_create);
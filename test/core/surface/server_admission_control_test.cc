@@ -0,0 +1,211 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+#include <string.h>
+
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/impl/grpc_types.h>
+#include <grpc/slice.h>
+#include <grpc/status.h>
+#include <grpc/support/time.h>
+
+#include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/surface/server.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+grpc_event Next(grpc_completion_queue* cq) {
+  return grpc_completion_queue_next(cq, grpc_timeout_seconds_to_deadline(10),
+                                    nullptr);
+}
+
+class ServerAdmissionControlTest : public ::testing::Test {
+ protected:
+  ServerAdmissionControlTest() {
+    grpc_arg args[] = {
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_SERVER_ADMISSION_CONTROL), 1),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(
+                GRPC_ARG_SERVER_ADMISSION_CONTROL_MAX_QUEUE_DELAY_MS),
+            20),
+        // Keep a busy test machine from tripping the EventEngine signal.
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(
+                GRPC_ARG_SERVER_ADMISSION_CONTROL_MAX_EVENT_ENGINE_DELAY_MS),
+            60000),
+    };
+    grpc_channel_args server_args = {GPR_ARRAY_SIZE(args), args};
+    server_cq_ = grpc_completion_queue_create_for_next(nullptr);
+    server_ = grpc_server_create(&server_args, nullptr);
+    grpc_server_register_completion_queue(server_, server_cq_, nullptr);
+    grpc_server_start(server_);
+    client_cq_ = grpc_completion_queue_create_for_next(nullptr);
+    channel_ = grpc_inproc_channel_create(server_, nullptr, nullptr);
+  }
+
+  ~ServerAdmissionControlTest() override {
+    grpc_channel_destroy(channel_);
+    grpc_server_shutdown_and_notify(server_, server_cq_, Tag(-1));
+    grpc_server_cancel_all_calls(server_);
+    grpc_event ev = Next(server_cq_);
+    EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+    EXPECT_EQ(ev.tag, Tag(-1));
+    grpc_server_destroy(server_);
+    for (grpc_completion_queue* cq : {server_cq_, client_cq_}) {
+      grpc_completion_queue_shutdown(cq);
+      while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                        nullptr)
+                 .type != GRPC_QUEUE_SHUTDOWN) {
+      }
+      grpc_completion_queue_destroy(cq);
+    }
+  }
+
+  struct ClientCall {
+    grpc_call* call = nullptr;
+    grpc_metadata_array trailing_metadata;
+    grpc_status_code status = GRPC_STATUS_UNKNOWN;
+    grpc_slice details;
+  };
+
+  void StartCall(ClientCall* c, intptr_t tag) {
+    c->call = grpc_channel_create_call(
+        channel_, nullptr, GRPC_PROPAGATE_DEFAULTS, client_cq_,
+        grpc_slice_from_static_string("/foo"), nullptr,
+        grpc_timeout_seconds_to_deadline(30), nullptr);
+    grpc_metadata_array_init(&c->trailing_metadata);
+    grpc_op ops[3];
+    memset(ops, 0, sizeof(ops));
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+    ops[2].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    ops[2].data.recv_status_on_client.trailing_metadata = &c->trailing_metadata;
+    ops[2].data.recv_status_on_client.status = &c->status;
+    ops[2].data.recv_status_on_client.status_details = &c->details;
+    ASSERT_EQ(GRPC_CALL_OK,
+              grpc_call_start_batch(c->call, ops, 3, Tag(tag), nullptr));
+  }
+
+  void DestroyCall(ClientCall* c) {
+    grpc_slice_unref(c->details);
+    grpc_metadata_array_destroy(&c->trailing_metadata);
+    grpc_call_unref(c->call);
+  }
+
+  size_t PendingCallCount() {
+    return Server::FromC(server_)->PendingCallCount();
+  }
+
+  grpc_completion_queue* server_cq_;
+  grpc_server* server_;
+  grpc_completion_queue* client_cq_;
+  grpc_channel* channel_;
+};
+
+TEST_F(ServerAdmissionControlTest, RejectsCallsWhileCallsWaitTooLong) {
+  auto before = global_stats().Collect();
+  // The application never requests this call, so it waits in the server's
+  // queue for longer than the configured delay.
+  ClientCall waiting;
+  StartCall(&waiting, 1);
+  const gpr_timespec deadline = grpc_timeout_seconds_to_deadline(10);
+  while (PendingCallCount() < 1) {
+    ASSERT_LT(gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline), 0);
+    grpc_completion_queue_next(
+        server_cq_, grpc_timeout_milliseconds_to_deadline(10), nullptr);
+  }
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(50));
+  // New calls are turned away before they reach the queue.
+  ClientCall rejected;
+  StartCall(&rejected, 2);
+  grpc_event ev = Next(client_cq_);
+  ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(ev.tag, Tag(2));
+  EXPECT_EQ(rejected.status, GRPC_STATUS_RESOURCE_EXHAUSTED);
+  EXPECT_EQ(PendingCallCount(), 1);
+  EXPECT_GE(global_stats().Collect()->Diff(*before)->server_calls_rejected, 1);
+  DestroyCall(&rejected);
+  // Shutting down fails the waiting call.
+  grpc_server_shutdown_and_notify(server_, server_cq_, Tag(3));
+  grpc_server_cancel_all_calls(server_);
+  ev = Next(server_cq_);
+  EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(ev.tag, Tag(3));
+  ev = Next(client_cq_);
+  EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(ev.tag, Tag(1));
+  DestroyCall(&waiting);
+}
+
+TEST_F(ServerAdmissionControlTest, AdmitsCallsWhenNotOverloaded) {
+  auto before = global_stats().Collect();
+  grpc_call* server_call;
+  grpc_call_details call_details;
+  grpc_metadata_array request_metadata;
+  grpc_call_details_init(&call_details);
+  grpc_metadata_array_init(&request_metadata);
+  ASSERT_EQ(GRPC_CALL_OK,
+            grpc_server_request_call(server_, &server_call, &call_details,
+                                     &request_metadata, server_cq_, server_cq_,
+                                     Tag(100)));
+  ClientCall c;
+  StartCall(&c, 1);
+  grpc_event ev = Next(server_cq_);
+  ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+  ASSERT_EQ(ev.tag, Tag(100));
+  ASSERT_TRUE(ev.success);
+  grpc_op ops[3];
+  memset(ops, 0, sizeof(ops));
+  int cancelled;
+  ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+  ops[1].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  ops[1].data.recv_close_on_server.cancelled = &cancelled;
+  ops[2].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  ops[2].data.send_status_from_server.status = GRPC_STATUS_OK;
+  ASSERT_EQ(GRPC_CALL_OK,
+            grpc_call_start_batch(server_call, ops, 3, Tag(101), nullptr));
+  ev = Next(server_cq_);
+  ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(ev.tag, Tag(101));
+  ev = Next(client_cq_);
+  ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(c.status, GRPC_STATUS_OK);
+  EXPECT_EQ(global_stats().Collect()->Diff(*before)->server_calls_rejected, 0);
+  grpc_call_unref(server_call);
+  grpc_call_details_destroy(&call_details);
+  grpc_metadata_array_destroy(&request_metadata);
+  DestroyCall(&c);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -0,0 +1,105 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/server_connection_rebalancer.h"
+
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/impl/grpc_types.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+class FakeLoadReporter : public ServerLoadReporter {
+ public:
+  absl::optional<double> Utilization() override { return utilization; }
+
+  absl::optional<double> utilization;
+};
+
+TEST(ServerConnectionRebalancerTest, CreatedFromChannelArgs) {
+  EXPECT_EQ(ServerConnectionRebalancer::Create(ChannelArgs()), nullptr);
+  auto reporter = MakeRefCounted<FakeLoadReporter>();
+  reporter->utilization = 0.9;
+  auto rebalancer = ServerConnectionRebalancer::Create(
+      ChannelArgs()
+          .Set(GRPC_ARG_SERVER_CONNECTION_REBALANCING_LOAD_THRESHOLD_PERCENT,
+               80)
+          .SetObject(RefCountedPtr<ServerLoadReporter>(reporter)));
+  ASSERT_NE(rebalancer, nullptr);
+  EXPECT_FALSE(rebalancer->counts_calls());
+  EXPECT_DOUBLE_EQ(rebalancer->Load(), 0.9);
+}
+
+TEST(ServerConnectionRebalancerTest, LoadIsHighestSignal) {
+  auto reporter = MakeRefCounted<FakeLoadReporter>();
+  ServerConnectionRebalancer rebalancer(0.8, 1, 4, reporter);
+  EXPECT_DOUBLE_EQ(rebalancer.Load(), 0);
+  rebalancer.StartCall();
+  rebalancer.StartCall();
+  EXPECT_DOUBLE_EQ(rebalancer.Load(), 0.5);
+  reporter->utilization = 0.25;
+  EXPECT_DOUBLE_EQ(rebalancer.Load(), 0.5);
+  reporter->utilization = 0.75;
+  EXPECT_DOUBLE_EQ(rebalancer.Load(), 0.75);
+  rebalancer.FinishCall();
+  rebalancer.FinishCall();
+}
+
+TEST(ServerConnectionRebalancerTest, ShedsExcessShareOfConnections) {
+  auto reporter = MakeRefCounted<FakeLoadReporter>();
+  ServerConnectionRebalancer rebalancer(0.5, 100, 0, reporter);
+  const Timestamp now = Timestamp::Now();
+  EXPECT_EQ(rebalancer.ConnectionsToShed(10, now), 0u);
+  reporter->utilization = 0.5;
+  EXPECT_EQ(rebalancer.ConnectionsToShed(10, now), 0u);
+  // Half of the load is over the threshold.
+  reporter->utilization = 1;
+  EXPECT_EQ(rebalancer.ConnectionsToShed(10, now), 5u);
+  EXPECT_EQ(rebalancer.ConnectionsToShed(0, now), 0u);
+}
+
+TEST(ServerConnectionRebalancerTest, RateLimitsGoaways) {
+  auto reporter = MakeRefCounted<FakeLoadReporter>();
+  reporter->utilization = 1;
+  ServerConnectionRebalancer rebalancer(0.1, 2, 0, reporter);
+  const Timestamp start = Timestamp::Now();
+  EXPECT_EQ(rebalancer.ConnectionsToShed(100, start), 2u);
+  EXPECT_EQ(rebalancer.ConnectionsToShed(100, start), 0u);
+  EXPECT_EQ(rebalancer.ConnectionsToShed(
+                100, start + Duration::Milliseconds(500)),
+            1u);
+  // Idle time does not build up more than a second's worth.
+  EXPECT_EQ(rebalancer.ConnectionsToShed(100, start + Duration::Seconds(10)),
+            2u);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
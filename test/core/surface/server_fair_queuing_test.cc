@@ -0,0 +1,238 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/server_fair_queuing.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/impl/grpc_types.h>
+#include <grpc/slice.h>
+#include <grpc/status.h>
+#include <grpc/support/time.h>
+
+#include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/surface/server.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(DeficitRoundRobinQueueTest, SingleFlowIsFifo) {
+  DeficitRoundRobinQueue<int> queue;
+  EXPECT_TRUE(queue.empty());
+  for (int i = 0; i < 5; i++) queue.Push("", 1, i);
+  EXPECT_EQ(queue.size(), 5u);
+  for (int i = 0; i < 5; i++) EXPECT_EQ(queue.Pop(), i);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(DeficitRoundRobinQueueTest, FlowsTakeTurnsByWeight) {
+  DeficitRoundRobinQueue<std::string> queue;
+  // A flow that queues a lot first does not hold up the others.
+  for (int i = 0; i < 6; i++) queue.Push("noisy", 1, "n");
+  for (int i = 0; i < 6; i++) queue.Push("gold", 2, "g");
+  queue.Push("quiet", 1, "q");
+  std::string order;
+  while (!queue.empty()) order += queue.Pop();
+  EXPECT_EQ(order, "nggqnggnggnnn");
+}
+
+TEST(DeficitRoundRobinQueueTest, ForEachFrontVisitsOldestOfEachFlow) {
+  DeficitRoundRobinQueue<int> queue;
+  queue.Push("a", 1, 1);
+  queue.Push("b", 1, 2);
+  queue.Push("a", 1, 3);
+  std::vector<int> fronts;
+  queue.ForEachFront([&fronts](int item) { fronts.push_back(item); });
+  EXPECT_EQ(fronts, std::vector<int>({1, 2}));
+}
+
+TEST(ServerFairQueuingPolicyTest, CreatedFromChannelArgs) {
+  EXPECT_EQ(ServerFairQueuingPolicy::Create(ChannelArgs()), nullptr);
+  auto policy = ServerFairQueuingPolicy::Create(
+      ChannelArgs()
+          .Set(GRPC_ARG_SERVER_FAIR_QUEUING, true)
+          .Set(GRPC_ARG_SERVER_FAIR_QUEUING_TENANT_WEIGHTS,
+               "gold=4, silver=2,bad=0,worse"));
+  ASSERT_NE(policy, nullptr);
+  EXPECT_EQ(policy->WeightOf("gold"), 4u);
+  EXPECT_EQ(policy->WeightOf("silver"), 2u);
+  EXPECT_EQ(policy->WeightOf("bad"), 1u);
+  EXPECT_EQ(policy->WeightOf("other"), 1u);
+  EXPECT_FALSE(policy->limits_concurrent_calls());
+}
+
+TEST(ServerFairQueuingPolicyTest, LimitsConcurrentCallsPerTenant) {
+  ServerFairQueuingPolicy policy("tenant", {}, 2);
+  EXPECT_TRUE(policy.StartCall("a"));
+  EXPECT_TRUE(policy.StartCall("a"));
+  EXPECT_FALSE(policy.StartCall("a"));
+  EXPECT_TRUE(policy.StartCall("b"));
+  policy.FinishCall("a");
+  EXPECT_TRUE(policy.StartCall("a"));
+  policy.FinishCall("a");
+  policy.FinishCall("a");
+  policy.FinishCall("b");
+}
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+grpc_event Next(grpc_completion_queue* cq) {
+  return grpc_completion_queue_next(cq, grpc_timeout_seconds_to_deadline(10),
+                                    nullptr);
+}
+
+class ServerFairQueuingTest : public ::testing::Test {
+ protected:
+  ServerFairQueuingTest() {
+    grpc_arg args[] = {
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(GRPC_ARG_SERVER_FAIR_QUEUING), 1),
+        grpc_channel_arg_string_create(
+            const_cast<char*>(GRPC_ARG_SERVER_FAIR_QUEUING_TENANT_METADATA_KEY),
+            const_cast<char*>("x-tenant")),
+        grpc_channel_arg_integer_create(
+            const_cast<char*>(
+                GRPC_ARG_SERVER_FAIR_QUEUING_MAX_CONCURRENT_CALLS_PER_TENANT),
+            1),
+    };
+    grpc_channel_args server_args = {GPR_ARRAY_SIZE(args), args};
+    server_cq_ = grpc_completion_queue_create_for_next(nullptr);
+    server_ = grpc_server_create(&server_args, nullptr);
+    grpc_server_register_completion_queue(server_, server_cq_, nullptr);
+    grpc_server_start(server_);
+    client_cq_ = grpc_completion_queue_create_for_next(nullptr);
+    channel_ = grpc_inproc_channel_create(server_, nullptr, nullptr);
+  }
+
+  ~ServerFairQueuingTest() override {
+    grpc_channel_destroy(channel_);
+    grpc_server_shutdown_and_notify(server_, server_cq_, Tag(-1));
+    grpc_server_cancel_all_calls(server_);
+    grpc_event ev = Next(server_cq_);
+    EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+    EXPECT_EQ(ev.tag, Tag(-1));
+    grpc_server_destroy(server_);
+    for (grpc_completion_queue* cq : {server_cq_, client_cq_}) {
+      grpc_completion_queue_shutdown(cq);
+      while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                        nullptr)
+                 .type != GRPC_QUEUE_SHUTDOWN) {
+      }
+      grpc_completion_queue_destroy(cq);
+    }
+  }
+
+  struct ClientCall {
+    grpc_call* call = nullptr;
+    grpc_metadata tenant;
+    grpc_metadata_array trailing_metadata;
+    grpc_status_code status = GRPC_STATUS_UNKNOWN;
+    grpc_slice details;
+  };
+
+  void StartCall(ClientCall* c, const char* tenant, intptr_t tag) {
+    c->call = grpc_channel_create_call(
+        channel_, nullptr, GRPC_PROPAGATE_DEFAULTS, client_cq_,
+        grpc_slice_from_static_string("/foo"), nullptr,
+        grpc_timeout_seconds_to_deadline(30), nullptr);
+    memset(&c->tenant, 0, sizeof(c->tenant));
+    c->tenant.key = grpc_slice_from_static_string("x-tenant");
+    c->tenant.value = grpc_slice_from_static_string(tenant);
+    grpc_metadata_array_init(&c->trailing_metadata);
+    grpc_op ops[3];
+    memset(ops, 0, sizeof(ops));
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[0].data.send_initial_metadata.count = 1;
+    ops[0].data.send_initial_metadata.metadata = &c->tenant;
+    ops[1].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+    ops[2].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    ops[2].data.recv_status_on_client.trailing_metadata = &c->trailing_metadata;
+    ops[2].data.recv_status_on_client.status = &c->status;
+    ops[2].data.recv_status_on_client.status_details = &c->details;
+    ASSERT_EQ(GRPC_CALL_OK,
+              grpc_call_start_batch(c->call, ops, 3, Tag(tag), nullptr));
+  }
+
+  void DestroyCall(ClientCall* c) {
+    grpc_slice_unref(c->details);
+    grpc_metadata_array_destroy(&c->trailing_metadata);
+    grpc_call_unref(c->call);
+  }
+
+  void WaitForPendingCalls(size_t n) {
+    const gpr_timespec deadline = grpc_timeout_seconds_to_deadline(10);
+    while (Server::FromC(server_)->PendingCallCount() < n) {
+      ASSERT_LT(gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline), 0);
+      grpc_completion_queue_next(
+          server_cq_, grpc_timeout_milliseconds_to_deadline(10), nullptr);
+    }
+  }
+
+  grpc_completion_queue* server_cq_;
+  grpc_server* server_;
+  grpc_completion_queue* client_cq_;
+  grpc_channel* channel_;
+};
+
+TEST_F(ServerFairQueuingTest, RejectsCallsOverTenantLimit) {
+  // The application never requests these calls, so they stay in flight.
+  ClientCall a1;
+  StartCall(&a1, "a", 1);
+  ClientCall b1;
+  StartCall(&b1, "b", 2);
+  WaitForPendingCalls(2);
+  // Tenant a is at its limit, so its next call is turned away; tenant b's
+  // calls are not affected by it.
+  ClientCall a2;
+  StartCall(&a2, "a", 3);
+  grpc_event ev = Next(client_cq_);
+  ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(ev.tag, Tag(3));
+  EXPECT_EQ(a2.status, GRPC_STATUS_RESOURCE_EXHAUSTED);
+  EXPECT_EQ(Server::FromC(server_)->PendingCallCount(), 2u);
+  DestroyCall(&a2);
+  // Shutting down fails the waiting calls.
+  grpc_server_shutdown_and_notify(server_, server_cq_, Tag(4));
+  grpc_server_cancel_all_calls(server_);
+  ev = Next(server_cq_);
+  EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(ev.tag, Tag(4));
+  for (int i = 0; i < 2; i++) {
+    ev = Next(client_cq_);
+    EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+  }
+  DestroyCall(&a1);
+  DestroyCall(&b1);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
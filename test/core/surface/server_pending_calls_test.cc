@@ -0,0 +1,228 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+#include <string.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+#include <grpc/status.h>
+#include <grpc/support/time.h>
+
+#include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/surface/server.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kNumCalls = 20;
+
+void* Tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+grpc_event Next(grpc_completion_queue* cq) {
+  return grpc_completion_queue_next(cq, grpc_timeout_seconds_to_deadline(10),
+                                    nullptr);
+}
+
+class ServerPendingCallsTest : public ::testing::Test {
+ protected:
+  ServerPendingCallsTest() {
+    server_cq_ = grpc_completion_queue_create_for_next(nullptr);
+    server_ = grpc_server_create(nullptr, nullptr);
+    grpc_server_register_completion_queue(server_, server_cq_, nullptr);
+    grpc_server_start(server_);
+    client_cq_ = grpc_completion_queue_create_for_next(nullptr);
+    channel_ = grpc_inproc_channel_create(server_, nullptr, nullptr);
+  }
+
+  ~ServerPendingCallsTest() override {
+    grpc_channel_destroy(channel_);
+    grpc_server_shutdown_and_notify(server_, server_cq_, Tag(-1));
+    grpc_event ev = Next(server_cq_);
+    EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+    EXPECT_EQ(ev.tag, Tag(-1));
+    grpc_server_destroy(server_);
+    for (grpc_completion_queue* cq : {server_cq_, client_cq_}) {
+      grpc_completion_queue_shutdown(cq);
+      while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                        nullptr)
+                 .type != GRPC_QUEUE_SHUTDOWN) {
+      }
+      grpc_completion_queue_destroy(cq);
+    }
+  }
+
+  size_t PendingCallCount() {
+    return Server::FromC(server_)->PendingCallCount();
+  }
+
+  grpc_completion_queue* server_cq_;
+  grpc_server* server_;
+  grpc_completion_queue* client_cq_;
+  grpc_channel* channel_;
+};
+
+struct ClientCall {
+  grpc_call* call = nullptr;
+  grpc_metadata_array trailing_metadata;
+  grpc_status_code status;
+  grpc_slice details;
+};
+
+TEST_F(ServerPendingCallsTest, CallsWaitUntilRequested) {
+  auto before = global_stats().Collect();
+  // Start calls before the application has requested any of them.
+  std::vector<ClientCall> client_calls(kNumCalls);
+  grpc_slice method = grpc_slice_from_static_string("/foo");
+  for (int i = 0; i < kNumCalls; i++) {
+    ClientCall& c = client_calls[i];
+    c.call = grpc_channel_create_call(
+        channel_, nullptr, GRPC_PROPAGATE_DEFAULTS, client_cq_, method,
+        nullptr, grpc_timeout_seconds_to_deadline(30), nullptr);
+    grpc_metadata_array_init(&c.trailing_metadata);
+    grpc_op ops[3];
+    memset(ops, 0, sizeof(ops));
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+    ops[2].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    ops[2].data.recv_status_on_client.trailing_metadata = &c.trailing_metadata;
+    ops[2].data.recv_status_on_client.status = &c.status;
+    ops[2].data.recv_status_on_client.status_details = &c.details;
+    ASSERT_EQ(GRPC_CALL_OK,
+              grpc_call_start_batch(c.call, ops, 3, Tag(i + 1), nullptr));
+  }
+  const gpr_timespec deadline = grpc_timeout_seconds_to_deadline(10);
+  while (PendingCallCount() < kNumCalls) {
+    ASSERT_LT(gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline), 0);
+    grpc_completion_queue_next(
+        server_cq_, grpc_timeout_milliseconds_to_deadline(10), nullptr);
+  }
+  EXPECT_EQ(PendingCallCount(), kNumCalls);
+  EXPECT_GE(global_stats().Collect()->Diff(*before)->server_calls_queued,
+            kNumCalls);
+  // Each request is matched to one of the waiting calls right away. Requests
+  // are made from several threads, which may match calls queued on another
+  // CPU.
+  std::vector<grpc_call*> server_calls(kNumCalls);
+  std::vector<grpc_call_details> call_details(kNumCalls);
+  std::vector<grpc_metadata_array> request_metadata(kNumCalls);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&, t]() {
+      for (int i = t; i < kNumCalls; i += 4) {
+        grpc_call_details_init(&call_details[i]);
+        grpc_metadata_array_init(&request_metadata[i]);
+        EXPECT_EQ(GRPC_CALL_OK,
+                  grpc_server_request_call(
+                      server_, &server_calls[i], &call_details[i],
+                      &request_metadata[i], server_cq_, server_cq_,
+                      Tag(100 + i)));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  for (int i = 0; i < kNumCalls; i++) {
+    grpc_event ev = Next(server_cq_);
+    ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+    ASSERT_TRUE(ev.success);
+  }
+  EXPECT_EQ(PendingCallCount(), 0);
+  for (int i = 0; i < kNumCalls; i++) {
+    grpc_op ops[3];
+    memset(ops, 0, sizeof(ops));
+    int cancelled;
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+    ops[1].data.recv_close_on_server.cancelled = &cancelled;
+    ops[2].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    ops[2].data.send_status_from_server.status = GRPC_STATUS_OK;
+    ASSERT_EQ(GRPC_CALL_OK, grpc_call_start_batch(server_calls[i], ops, 3,
+                                                  Tag(200 + i), nullptr));
+    grpc_event ev = Next(server_cq_);
+    ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+    EXPECT_EQ(ev.tag, Tag(200 + i));
+    grpc_call_unref(server_calls[i]);
+    grpc_call_details_destroy(&call_details[i]);
+    grpc_metadata_array_destroy(&request_metadata[i]);
+  }
+  for (int i = 0; i < kNumCalls; i++) {
+    grpc_event ev = Next(client_cq_);
+    ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+  }
+  for (ClientCall& c : client_calls) {
+    EXPECT_EQ(c.status, GRPC_STATUS_OK);
+    grpc_slice_unref(c.details);
+    grpc_metadata_array_destroy(&c.trailing_metadata);
+    grpc_call_unref(c.call);
+  }
+}
+
+TEST_F(ServerPendingCallsTest, ShutdownFailsWaitingCalls) {
+  grpc_call* call = grpc_channel_create_call(
+      channel_, nullptr, GRPC_PROPAGATE_DEFAULTS, client_cq_,
+      grpc_slice_from_static_string("/foo"), nullptr,
+      grpc_timeout_seconds_to_deadline(30), nullptr);
+  grpc_metadata_array trailing_metadata;
+  grpc_metadata_array_init(&trailing_metadata);
+  grpc_status_code status;
+  grpc_slice details;
+  grpc_op ops[3];
+  memset(ops, 0, sizeof(ops));
+  ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+  ops[1].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  ops[2].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  ops[2].data.recv_status_on_client.trailing_metadata = &trailing_metadata;
+  ops[2].data.recv_status_on_client.status = &status;
+  ops[2].data.recv_status_on_client.status_details = &details;
+  ASSERT_EQ(GRPC_CALL_OK, grpc_call_start_batch(call, ops, 3, Tag(1), nullptr));
+  const gpr_timespec deadline = grpc_timeout_seconds_to_deadline(10);
+  while (PendingCallCount() < 1) {
+    ASSERT_LT(gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline), 0);
+    grpc_completion_queue_next(
+        server_cq_, grpc_timeout_milliseconds_to_deadline(10), nullptr);
+  }
+  grpc_server_shutdown_and_notify(server_, server_cq_, Tag(2));
+  grpc_server_cancel_all_calls(server_);
+  grpc_event ev = Next(server_cq_);
+  EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(ev.tag, Tag(2));
+  EXPECT_EQ(PendingCallCount(), 0);
+  ev = Next(client_cq_);
+  EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_NE(status, GRPC_STATUS_OK);
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&trailing_metadata);
+  grpc_call_unref(call);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -98,6 +98,19 @@ TEST(BdpEstimatorTest, GetEstimate3Samples) {
   est.EstimateBdp();
 }
 
+TEST(BdpEstimatorTest, UsesGivenPingTimes) {
+  ExecCtx exec_ctx;
+  BdpEstimator est("test");
+  est.SchedulePing();
+  gpr_timespec start = gpr_time_from_seconds(1000, GPR_CLOCK_MONOTONIC);
+  est.StartPing(start);
+  est.AddIncomingBytes(1000000);
+  // The estimate follows the times given, not when the calls are made.
+  est.CompletePing(gpr_time_add(start, gpr_time_from_millis(1, GPR_TIMESPAN)));
+  EXPECT_NEAR(est.EstimateBandwidth(), 1e9, 1);
+  EXPECT_EQ(est.EstimateBdp(), 1000000);
+}
+
 namespace {
 int64_t NextPow2(int64_t v) {
   v--;
@@ -37,6 +37,7 @@ MockWritableParcel::MockWritableParcel() {
   ON_CALL(*this, WriteBinder).WillByDefault(Return(absl::OkStatus()));
   ON_CALL(*this, WriteString).WillByDefault(Return(absl::OkStatus()));
   ON_CALL(*this, WriteByteArray).WillByDefault(Return(absl::OkStatus()));
+  ON_CALL(*this, WriteFileDescriptor).WillByDefault(Return(absl::OkStatus()));
 }
 
 MockBinder::MockBinder() {
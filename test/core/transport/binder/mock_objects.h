@@ -34,6 +34,7 @@ class MockWritableParcel : public WritableParcel {
   MOCK_METHOD(absl::Status, WriteString, (absl::string_view), (override));
   MOCK_METHOD(absl::Status, WriteByteArray, (const int8_t*, int32_t),
               (override));
+  MOCK_METHOD(absl::Status, WriteFileDescriptor, (int), (override));
 
   MockWritableParcel();
 };
@@ -46,6 +47,7 @@ class MockReadableParcel : public ReadableParcel {
   MOCK_METHOD(absl::Status, ReadBinder, (std::unique_ptr<Binder>*), (override));
   MOCK_METHOD(absl::Status, ReadByteArray, (std::string*), (override));
   MOCK_METHOD(absl::Status, ReadString, (std::string*), (override));
+  MOCK_METHOD(absl::Status, ReadFileDescriptor, (int*), (override));
 
   MockReadableParcel();
 };
@@ -19,6 +19,9 @@
 // WireReaderImpl and both the output (readable) parcel and the transport stream
 // receiver are correct in all possible situations.
 
+#include <string.h>
+#include <unistd.h>
+
 #include <memory>
 #include <string>
 #include <thread>
@@ -30,6 +33,7 @@
 
 #include <grpcpp/security/binder_security_policy.h>
 
+#include "src/core/ext/transport/binder/wire_format/shared_memory.h"
 #include "src/core/ext/transport/binder/wire_format/wire_reader_impl.h"
 #include "test/core/transport/binder/mock_objects.h"
 #include "test/core/util/test_config.h"
@@ -222,6 +226,40 @@ TEST_F(WireReaderTest, ProcessTransactionServerRpcDataFlagMessageDataNonEmpty) {
   EXPECT_TRUE(CallProcessTransaction(kFirstCallId).ok());
 }
 
+TEST_F(WireReaderTest,
+       ProcessTransactionServerRpcDataFlagMessageDataInSharedMemory) {
+  if (!SharedMemoryPool::IsSupported()) {
+    GTEST_SKIP() << "shared memory is not supported";
+  }
+  ::testing::InSequence sequence;
+  UnblockSetupTransport();
+
+  // The region is larger than the message, as regions are from a pool.
+  const std::string kMessageData(1000, 'm');
+  SharedMemoryPool pool;
+  absl::StatusOr<SharedMemoryRegion> region = pool.Get(kMessageData.size());
+  ASSERT_TRUE(region.ok()) << region.status();
+  memcpy(region->data, kMessageData.data(), kMessageData.size());
+
+  // flag
+  ExpectReadInt32(kFlagMessageData | kFlagMessageDataInSharedMemory);
+  // sequence number
+  ExpectReadInt32(0);
+  // message size
+  EXPECT_CALL(mock_readable_parcel_, ReadInt64)
+      .WillOnce(DoAll(SetArgPointee<0>(kMessageData.size()),
+                      Return(absl::OkStatus())));
+  // The binder hands us a duplicate.
+  EXPECT_CALL(mock_readable_parcel_, ReadFileDescriptor)
+      .WillOnce(DoAll(SetArgPointee<0>(dup(region->fd)),
+                      Return(absl::OkStatus())));
+  EXPECT_CALL(*transport_stream_receiver_,
+              NotifyRecvMessage(kFirstCallId, StatusOrStrEq(kMessageData)));
+
+  EXPECT_TRUE(CallProcessTransaction(kFirstCallId).ok());
+  pool.Put(*region);
+}
+
 TEST_F(WireReaderTest, ProcessTransactionServerRpcDataFlagMessageDataEmpty) {
   ::testing::InSequence sequence;
   UnblockSetupTransport();
@@ -14,6 +14,8 @@
 
 #include "src/core/ext/transport/binder/wire_format/wire_writer.h"
 
+#include <unistd.h>
+
 #include <string>
 #include <utility>
 
@@ -28,6 +30,7 @@
 
 namespace grpc_binder {
 
+using ::testing::_;
 using ::testing::Return;
 
 MATCHER_P(StrEqInt8Ptr, target, "") {
@@ -258,6 +261,58 @@ TEST(WireWriterTest, RpcCall) {
   grpc_core::ExecCtx::Get()->Flush();
 }
 
+TEST(WireWriterTest, SendsLargeMessagesInPooledSharedMemory) {
+  if (!SharedMemoryPool::IsSupported()) {
+    GTEST_SKIP() << "shared memory is not supported";
+  }
+  grpc::internal::GrpcLibrary init_lib;
+  grpc_core::ExecCtx exec_ctx;
+  auto mock_binder = std::make_unique<MockBinder>();
+  MockBinder& mock_binder_ref = *mock_binder;
+  MockWritableParcel mock_writable_parcel;
+  ON_CALL(mock_binder_ref, GetWritableParcel)
+      .WillByDefault(Return(&mock_writable_parcel));
+  WireWriterImpl wire_writer(std::move(mock_binder),
+                             kFeatureSharedMemoryMessages);
+  const std::string data(WireWriterImpl::kSharedMemoryThreshold, 'a');
+
+  auto SendAndReadBack = [&](int seq) {
+    int sent_fd = -1;
+    ::testing::InSequence sequence;
+    EXPECT_CALL(mock_writable_parcel,
+                WriteInt32(kFlagMessageData | kFlagMessageDataInSharedMemory));
+    EXPECT_CALL(mock_writable_parcel, WriteInt32(seq));
+    EXPECT_CALL(mock_writable_parcel, WriteInt64(data.size()));
+    EXPECT_CALL(mock_writable_parcel, WriteFileDescriptor(_))
+        .WillOnce([&sent_fd](int fd) {
+          sent_fd = fd;
+          return absl::OkStatus();
+        });
+    EXPECT_CALL(mock_binder_ref, Transact(BinderTransportTxCode(kFirstCallId)));
+    auto tx = std::make_unique<Transaction>(kFirstCallId, /*is_client=*/true);
+    tx->SetData(data);
+    EXPECT_TRUE(wire_writer.RpcCall(std::move(tx)).ok());
+    grpc_core::ExecCtx::Get()->Flush();
+    // The binder would hand the other end a duplicate.
+    absl::StatusOr<std::string> received =
+        ReadSharedMemory(dup(sent_fd), data.size());
+    EXPECT_TRUE(received.ok()) << received.status();
+    EXPECT_EQ(*received, data);
+    return sent_fd;
+  };
+
+  int first_fd = SendAndReadBack(0);
+  // The other end has not acknowledged the first message yet, so its region
+  // may still be in use.
+  int second_fd = SendAndReadBack(1);
+  EXPECT_NE(second_fd, first_fd);
+  // Once it has acknowledged both, their regions are reused.
+  wire_writer.OnAckReceived(2 * data.size());
+  int third_fd = SendAndReadBack(2);
+  EXPECT_TRUE(third_fd == first_fd || third_fd == second_fd);
+  grpc_core::ExecCtx::Get()->Flush();
+}
+
 }  // namespace grpc_binder
 
 int main(int argc, char** argv) {
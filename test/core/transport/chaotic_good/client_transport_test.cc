@@ -0,0 +1,304 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/client_transport.h"
+
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/grpc.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/status.h>
+
+#include "src/core/ext/transport/chaotic_good/frame.h"
+#include "src/core/ext/transport/chaotic_good/frame_header.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/join.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/pipe.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/lib/transport/promise_endpoint.h"
+#include "test/core/promise/test_context.h"
+#include "test/core/promise/test_wakeup_schedulers.h"
+
+using testing::_;
+using testing::MockFunction;
+using testing::StrictMock;
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace testing {
+
+using grpc_event_engine::experimental::EventEngine;
+
+class MockEndpoint : public EventEngine::Endpoint {
+ public:
+  MOCK_METHOD(
+      void, Read,
+      (absl::AnyInvocable<void(absl::Status)> on_read,
+       grpc_event_engine::experimental::SliceBuffer* buffer,
+       const EventEngine::Endpoint::ReadArgs* args),
+      (override));
+  MOCK_METHOD(
+      void, Write,
+      (absl::AnyInvocable<void(absl::Status)> on_writable,
+       grpc_event_engine::experimental::SliceBuffer* data,
+       const EventEngine::Endpoint::WriteArgs* args),
+      (override));
+  MOCK_METHOD(const EventEngine::ResolvedAddress&, GetPeerAddress, (),
+              (const, override));
+  MOCK_METHOD(const EventEngine::ResolvedAddress&, GetLocalAddress, (),
+              (const, override));
+};
+
+// Everything written to a mock endpoint, and a way to feed it reads.
+struct EndpointState {
+  SliceBuffer written;
+  absl::AnyInvocable<void(absl::Status)> on_read;
+  grpc_event_engine::experimental::SliceBuffer* read_buffer = nullptr;
+
+  void CompleteRead(SliceBuffer data) {
+    ASSERT_NE(on_read, nullptr);
+    grpc_slice_buffer_move_into(data.c_slice_buffer(),
+                                read_buffer->c_slice_buffer());
+    auto on_read_now = std::move(on_read);
+    on_read = nullptr;
+    on_read_now(absl::OkStatus());
+  }
+};
+
+class ClientTransportTest : public ::testing::Test {
+ protected:
+  ClientTransportTest() {
+    Expect(control_endpoint_, &control_);
+    Expect(data_endpoint_, &data_);
+  }
+
+  // Records writes to endpoint and completes them immediately; keeps reads
+  // pending until the test completes them.
+  static void Expect(StrictMock<MockEndpoint>* endpoint,
+                     EndpointState* state) {
+    EXPECT_CALL(*endpoint, Write(_, _, _))
+        .WillRepeatedly(
+            [state](absl::AnyInvocable<void(absl::Status)> on_writable,
+                    grpc_event_engine::experimental::SliceBuffer* data,
+                    const EventEngine::Endpoint::WriteArgs*) {
+              grpc_slice_buffer_move_into(data->c_slice_buffer(),
+                                          state->written.c_slice_buffer());
+              on_writable(absl::OkStatus());
+            });
+    EXPECT_CALL(*endpoint, Read(_, _, _))
+        .WillRepeatedly(
+            [state](absl::AnyInvocable<void(absl::Status)> on_read,
+                    grpc_event_engine::experimental::SliceBuffer* buffer,
+                    const EventEngine::Endpoint::ReadArgs*) {
+              state->on_read = std::move(on_read);
+              state->read_buffer = buffer;
+            });
+  }
+
+  OrphanablePtr<ClientTransport> MakeTransport() {
+    return MakeOrphanable<ClientTransport>(
+        std::make_unique<PromiseEndpoint>(
+            std::unique_ptr<EventEngine::Endpoint>(control_endpoint_),
+            SliceBuffer()),
+        std::make_unique<PromiseEndpoint>(
+            std::unique_ptr<EventEngine::Endpoint>(data_endpoint_),
+            SliceBuffer()),
+        grpc_event_engine::experimental::GetDefaultEventEngine());
+  }
+
+  // Parse all client frames written so far.
+  std::vector<ClientFragmentFrame> WrittenFrames() {
+    TestContext<Arena> arena_ctx(arena_.get());
+    std::vector<ClientFragmentFrame> frames;
+    while (control_.written.Length() != 0) {
+      uint8_t header_bytes[64];
+      control_.written.MoveFirstNBytesIntoBuffer(64, header_bytes);
+      auto header = FrameHeader::Parse(header_bytes);
+      EXPECT_TRUE(header.ok()) << header.status();
+      if (!header.ok()) break;
+      const FrameSizes sizes = header->ComputeFrameSizes();
+      BufferPair buffers;
+      control_.written.MoveFirstNBytesIntoSliceBuffer(sizes.control_length,
+                                                      buffers.control);
+      data_.written.MoveFirstNBytesIntoSliceBuffer(sizes.data_length,
+                                                   buffers.data);
+      ClientFragmentFrame frame;
+      EXPECT_EQ(frame.Deserialize(&hpack_parser_, *header, buffers),
+                absl::OkStatus());
+      frames.push_back(std::move(frame));
+    }
+    EXPECT_EQ(data_.written.Length(), 0);
+    return frames;
+  }
+
+  MessageHandle MakeMessage(absl::string_view payload) {
+    SliceBuffer buffer;
+    buffer.Append(Slice::FromCopiedString(payload));
+    return arena_->MakePooled<Message>(std::move(buffer), 0);
+  }
+
+  MemoryAllocator memory_allocator_ = MemoryAllocator(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("test"));
+  ScopedArenaPtr arena_ = MakeScopedArena(1024, &memory_allocator_);
+  StrictMock<MockEndpoint>* control_endpoint_ =
+      new StrictMock<MockEndpoint>();
+  StrictMock<MockEndpoint>* data_endpoint_ = new StrictMock<MockEndpoint>();
+  EndpointState control_;
+  EndpointState data_;
+  HPackParser hpack_parser_;
+};
+
+TEST_F(ClientTransportTest, StartsReadingFrameHeaders) {
+  auto transport = MakeTransport();
+  EXPECT_NE(control_.on_read, nullptr);
+  EXPECT_EQ(data_.on_read, nullptr);
+}
+
+TEST_F(ClientTransportTest, UnaryCall) {
+  auto transport = MakeTransport();
+  Pipe<ServerMetadataHandle> server_initial_metadata(arena_.get());
+  Pipe<MessageHandle> client_to_server_messages(arena_.get());
+  Pipe<MessageHandle> server_to_client_messages(arena_.get());
+  auto client_initial_metadata =
+      arena_->MakePooled<ClientMetadata>(arena_.get());
+  client_initial_metadata->Set(HttpPathMetadata(),
+                               Slice::FromStaticString("/demo.Service/Step"));
+  StrictMock<MockFunction<void(absl::Status)>> on_done;
+  auto activity = MakeActivity(
+      [&]() {
+        return Seq(
+            Join(transport->MakeCallPromise(CallArgs{
+                     std::move(client_initial_metadata),
+                     &server_initial_metadata.sender,
+                     &client_to_server_messages.receiver,
+                     &server_to_client_messages.sender}),
+                 Seq(client_to_server_messages.sender.Push(MakeMessage("hi")),
+                     [&client_to_server_messages](bool pushed) {
+                       client_to_server_messages.sender.Close();
+                       return pushed;
+                     }),
+                 Map(server_initial_metadata.receiver.Next(),
+                     [](NextResult<ServerMetadataHandle> md) {
+                       return md.has_value();
+                     }),
+                 Map(server_to_client_messages.receiver.Next(),
+                     [](NextResult<MessageHandle> message) -> std::string {
+                       if (!message.has_value()) return "";
+                       return (*message)->payload()->JoinIntoString();
+                     })),
+            [](std::tuple<ServerMetadataHandle, bool, bool, std::string>
+                   result) {
+              EXPECT_EQ(std::get<0>(result)->get(GrpcStatusMetadata()),
+                        GRPC_STATUS_OK);
+              EXPECT_TRUE(std::get<1>(result));
+              EXPECT_TRUE(std::get<2>(result));
+              EXPECT_EQ(std::get<3>(result), "hello");
+              return absl::OkStatus();
+            });
+      },
+      InlineWakeupScheduler(),
+      [&on_done](absl::Status status) { on_done.Call(std::move(status)); },
+      arena_.get());
+  // Metadata went to the control endpoint, the message to the data endpoint.
+  auto frames = WrittenFrames();
+  ASSERT_FALSE(frames.empty());
+  EXPECT_NE(frames.front().headers, nullptr);
+  std::string sent;
+  for (const auto& frame : frames) {
+    EXPECT_EQ(frame.stream_id, 1);
+    if (frame.message != nullptr) {
+      sent += frame.message->payload()->JoinIntoString();
+    }
+  }
+  EXPECT_EQ(sent, "hi");
+  EXPECT_TRUE(frames.back().end_of_stream);
+  // Answer the call in a single frame.
+  HPackCompressor hpack_compressor;
+  ServerFragmentFrame response;
+  response.stream_id = 1;
+  response.headers = arena_->MakePooled<ServerMetadata>(arena_.get());
+  response.message = MakeMessage("hello");
+  response.trailers = arena_->MakePooled<ServerMetadata>(arena_.get());
+  response.trailers->Set(GrpcStatusMetadata(), GRPC_STATUS_OK);
+  BufferPair serialized = response.Serialize(&hpack_compressor);
+  EXPECT_CALL(on_done, Call(absl::OkStatus()));
+  control_.CompleteRead(std::move(serialized.control));
+  data_.CompleteRead(std::move(serialized.data));
+  // The transport went straight back to waiting for the next frame.
+  EXPECT_NE(control_.on_read, nullptr);
+}
+
+TEST_F(ClientTransportTest, CallFailsWhenTransportCloses) {
+  auto transport = MakeTransport();
+  Pipe<ServerMetadataHandle> server_initial_metadata(arena_.get());
+  Pipe<MessageHandle> client_to_server_messages(arena_.get());
+  Pipe<MessageHandle> server_to_client_messages(arena_.get());
+  StrictMock<MockFunction<void(absl::Status)>> on_done;
+  auto activity = MakeActivity(
+      [&]() {
+        return Map(transport->MakeCallPromise(CallArgs{
+                       arena_->MakePooled<ClientMetadata>(arena_.get()),
+                       &server_initial_metadata.sender,
+                       &client_to_server_messages.receiver,
+                       &server_to_client_messages.sender}),
+                   [](ServerMetadataHandle md) {
+                     EXPECT_EQ(md->get(GrpcStatusMetadata()),
+                               GRPC_STATUS_UNAVAILABLE);
+                     return absl::OkStatus();
+                   });
+      },
+      InlineWakeupScheduler(),
+      [&on_done](absl::Status status) { on_done.Call(std::move(status)); },
+      arena_.get());
+  EXPECT_CALL(on_done, Call(absl::OkStatus()));
+  // The server went away.
+  ASSERT_NE(control_.on_read, nullptr);
+  auto on_read = std::move(control_.on_read);
+  on_read(absl::UnavailableError("connection reset"));
+}
+
+}  // namespace testing
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int r = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return r;
+}
@@ -15,6 +15,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "absl/status/statusor.h"
@@ -43,13 +44,17 @@ template <typename T>
 void AssertRoundTrips(const T& input, FrameType expected_frame_type) {
   HPackCompressor hpack_compressor;
   auto serialized = input.Serialize(&hpack_compressor);
-  GPR_ASSERT(serialized.Length() >= 64);
-  GPR_ASSERT(serialized.Length() % 64 == 0);
+  GPR_ASSERT(serialized.control.Length() >= 64);
+  GPR_ASSERT(serialized.control.Length() % 64 == 0);
+  GPR_ASSERT(serialized.data.Length() % 64 == 0);
   uint8_t header_bytes[64];
-  serialized.MoveFirstNBytesIntoBuffer(64, header_bytes);
+  serialized.control.MoveFirstNBytesIntoBuffer(64, header_bytes);
   auto header = FrameHeader::Parse(header_bytes);
   GPR_ASSERT(header.ok());
   GPR_ASSERT(header->type == expected_frame_type);
+  FrameSizes sizes = header->ComputeFrameSizes();
+  GPR_ASSERT(sizes.control_length == serialized.control.Length());
+  GPR_ASSERT(sizes.data_length == serialized.data.Length());
   T output;
   HPackParser hpack_parser;
   auto deser = output.Deserialize(&hpack_parser, header.value(), serialized);
@@ -62,8 +67,14 @@ void FinishParseAndChecks(const FrameHeader& header, const uint8_t* data,
                           size_t size) {
   T parsed;
   HPackParser hpack_parser;
-  SliceBuffer serialized;
-  serialized.Append(Slice::FromCopiedBuffer(data, size));
+  // The first control_length bytes after the header go to the control
+  // endpoint, everything else goes to the data endpoint.
+  BufferPair serialized;
+  const size_t control_length = std::min<uint64_t>(
+      size, header.ComputeFrameSizes().control_length);
+  serialized.control.Append(Slice::FromCopiedBuffer(data, control_length));
+  serialized.data.Append(
+      Slice::FromCopiedBuffer(data + control_length, size - control_length));
   auto deser = parsed.Deserialize(&hpack_parser, header, serialized);
   if (!deser.ok()) return;
   AssertRoundTrips(parsed, header.type);
@@ -14,6 +14,8 @@
 
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
 
+#include <stddef.h>
+
 #include <algorithm>
 #include <cstdint>
 #include <vector>
@@ -91,23 +93,35 @@ TEST(FrameHeaderTest, SimpleDeserialize) {
             absl::InvalidArgumentError("Invalid padding"));
 }
 
+TEST(FrameHeaderTest, DeserializeRejectsNonZeroPaddingAnywhere) {
+  const std::vector<uint8_t> header = Serialize(
+      FrameHeader{FrameType::kFragment, BitSet<3>::FromInt(7), 1, 2, 3, 4});
+  for (size_t i = 20; i < 64; i++) {
+    std::vector<uint8_t> data = header;
+    data[i] = 0x80;
+    EXPECT_EQ(Deserialize(data).status(),
+              absl::InvalidArgumentError("Invalid padding"))
+        << "padding byte " << i;
+  }
+}
+
 TEST(FrameHeaderTest, ComputeFrameSizes) {
   EXPECT_EQ(
       (FrameHeader{FrameType::kFragment, BitSet<3>::FromInt(7), 1, 0, 0, 0})
           .ComputeFrameSizes(),
-      (FrameSizes{0, 0, 0}));
+      (FrameSizes{0, 0}));
   EXPECT_EQ(
       (FrameHeader{FrameType::kFragment, BitSet<3>::FromInt(7), 1, 14, 0, 0})
           .ComputeFrameSizes(),
-      (FrameSizes{64, 64, 64}));
+      (FrameSizes{64, 0}));
   EXPECT_EQ(
       (FrameHeader{FrameType::kFragment, BitSet<3>::FromInt(7), 1, 0, 14, 0})
           .ComputeFrameSizes(),
-      (FrameSizes{0, 64, 64}));
+      (FrameSizes{0, 64}));
   EXPECT_EQ(
       (FrameHeader{FrameType::kFragment, BitSet<3>::FromInt(7), 1, 0, 0, 14})
           .ComputeFrameSizes(),
-      (FrameSizes{0, 0, 64}));
+      (FrameSizes{64, 0}));
 }
 
 }  // namespace
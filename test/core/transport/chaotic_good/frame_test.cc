@@ -28,13 +28,17 @@ template <typename T>
 void AssertRoundTrips(const T input, FrameType expected_frame_type) {
   HPackCompressor hpack_compressor;
   auto serialized = input.Serialize(&hpack_compressor);
-  EXPECT_GE(serialized.Length(), 64);
-  EXPECT_EQ(serialized.Length() % 64, 0);
+  EXPECT_GE(serialized.control.Length(), 64);
+  EXPECT_EQ(serialized.control.Length() % 64, 0);
+  EXPECT_EQ(serialized.data.Length() % 64, 0);
   uint8_t header_bytes[64];
-  serialized.MoveFirstNBytesIntoBuffer(64, header_bytes);
+  serialized.control.MoveFirstNBytesIntoBuffer(64, header_bytes);
   auto header = FrameHeader::Parse(header_bytes);
   EXPECT_TRUE(header.ok()) << header.status();
   EXPECT_EQ(header->type, expected_frame_type);
+  FrameSizes sizes = header->ComputeFrameSizes();
+  EXPECT_EQ(sizes.control_length, serialized.control.Length());
+  EXPECT_EQ(sizes.data_length, serialized.data.Length());
   T output;
   HPackParser hpack_parser;
   auto deser = output.Deserialize(&hpack_parser, header.value(), serialized);
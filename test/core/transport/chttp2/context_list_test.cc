@@ -30,11 +30,13 @@
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/atm.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
 #include "src/core/lib/channel/channel_args_preconditioning.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/transport/transport.h"
@@ -167,6 +169,45 @@ TEST_F(ContextListTest, NonEmptyListEmptyTimestamp) {
   exec_ctx.Flush();
 }
 
+TEST_F(ContextListTest, RecordsStreamWriteTimestamps) {
+  // Entries are kept for the stream's own timestamps without a global
+  // callback.
+  grpc_http2_set_write_timestamps_callback(nullptr);
+  grpc_http2_set_fn_get_copied_context(nullptr);
+  ContextList* list = nullptr;
+  ExecCtx exec_ctx;
+  grpc_stream_refcount ref;
+  GRPC_STREAM_REF_INIT(&ref, 1, nullptr, nullptr, "phony ref");
+  grpc_endpoint* mock_endpoint = grpc_mock_endpoint_create(discard_write);
+  auto args = CoreConfiguration::Get()
+                  .channel_args_preconditioning()
+                  .PreconditionChannelArgs(nullptr);
+  grpc_transport* t = grpc_create_chttp2_transport(args, mock_endpoint, true);
+  auto* s = static_cast<grpc_chttp2_stream*>(
+      gpr_malloc(grpc_transport_stream_size(t)));
+  grpc_transport_init_stream(t, reinterpret_cast<grpc_stream*>(s), &ref,
+                             nullptr, nullptr);
+  s->write_timestamps = MakeRefCounted<StreamWriteTimestamps>();
+  ContextList::Append(&list, s);
+  ASSERT_NE(list, nullptr);
+  Timestamps ts;
+  ts.sent_time.time = gpr_now(GPR_CLOCK_REALTIME);
+  ts.acked_time.time = gpr_now(GPR_CLOCK_REALTIME);
+  ContextList::Execute(list, &ts, absl::OkStatus());
+  grpc_transport_stream_timing timing;
+  s->write_timestamps->Fill(&timing);
+  EXPECT_EQ(timing.last_write_sent.clock_type, GPR_CLOCK_MONOTONIC);
+  EXPECT_NE(gpr_time_cmp(timing.last_write_sent,
+                         gpr_inf_past(GPR_CLOCK_MONOTONIC)),
+            0);
+  EXPECT_GE(gpr_time_cmp(timing.last_write_acked, timing.last_write_sent), 0);
+  grpc_transport_destroy_stream(t, reinterpret_cast<grpc_stream*>(s), nullptr);
+  exec_ctx.Flush();
+  gpr_free(s);
+  grpc_transport_destroy(t);
+  exec_ctx.Flush();
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -17,6 +17,7 @@
 #include <memory>
 #include <tuple>
 
+#include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
 
 #include <grpc/support/time.h>
@@ -263,6 +264,40 @@ TEST_F(FlowControlTest, GradualReadsUpdate) {
   EXPECT_EQ(immediate_updates + queued_updates, 65535);
 }
 
+TEST_F(FlowControlTest, PredictiveBdpStartsFromHistory) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  EXPECT_FALSE(tfc.predictive_bdp());
+  tfc.SetPredictiveBdp(BdpHistory::Sample{4 * 1024 * 1024, 1e9});
+  EXPECT_TRUE(tfc.predictive_bdp());
+  EXPECT_EQ(tfc.bdp_estimator()->EstimateBdp(), 4 * 1024 * 1024);
+  EXPECT_EQ(tfc.bdp_estimator()->EstimateBandwidth(), 1e9);
+}
+
+TEST(BdpHistoryTest, RecordsPerPeer) {
+  BdpHistory history;
+  EXPECT_FALSE(history.Lookup("ipv4:127.0.0.1:1").has_value());
+  history.Record("ipv4:127.0.0.1:1", {100000, 1e6});
+  history.Record("ipv4:127.0.0.1:2", {200000, 2e6});
+  history.Record("ipv4:127.0.0.1:1", {300000, 3e6});
+  auto sample = history.Lookup("ipv4:127.0.0.1:1");
+  ASSERT_TRUE(sample.has_value());
+  EXPECT_EQ(sample->bdp, 300000);
+  EXPECT_EQ(sample->bandwidth, 3e6);
+  sample = history.Lookup("ipv4:127.0.0.1:2");
+  ASSERT_TRUE(sample.has_value());
+  EXPECT_EQ(sample->bdp, 200000);
+}
+
+TEST(BdpHistoryTest, ForgetsOldestPeer) {
+  BdpHistory history;
+  for (int i = 0; i < 2000; i++) {
+    history.Record(absl::StrCat("peer", i), {i, 0});
+  }
+  EXPECT_FALSE(history.Lookup("peer0").has_value());
+  EXPECT_TRUE(history.Lookup("peer1999").has_value());
+}
+
 }  // namespace chttp2
 }  // namespace grpc_core
 
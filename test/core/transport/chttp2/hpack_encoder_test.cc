@@ -148,11 +148,16 @@ static void CrashOnAppendError(absl::string_view, const grpc_core::Slice&) {
   abort();
 }
 
+// Encodes with compressor if given, or else with a fresh compressor.
 grpc_slice EncodeHeaderIntoBytes(
     bool is_eof,
-    const std::vector<std::pair<std::string, std::string>>& header_fields) {
-  std::unique_ptr<grpc_core::HPackCompressor> compressor =
-      std::make_unique<grpc_core::HPackCompressor>();
+    const std::vector<std::pair<std::string, std::string>>& header_fields,
+    grpc_core::HPackCompressor* compressor = nullptr) {
+  std::unique_ptr<grpc_core::HPackCompressor> fresh_compressor;
+  if (compressor == nullptr) {
+    fresh_compressor = std::make_unique<grpc_core::HPackCompressor>();
+    compressor = fresh_compressor.get();
+  }
 
   grpc_core::MemoryAllocator memory_allocator =
       grpc_core::MemoryAllocator(grpc_core::ResourceQuota::Default()
@@ -301,6 +306,100 @@ TEST(HpackEncoderTest, UserAgentMetadataNoIndexing) {
   grpc_slice_unref(encoded_header);
 }
 
+// The first byte of the first header field in encoded.
+static uint8_t FirstFieldByte(const grpc_slice& encoded) {
+  constexpr size_t kHttp2FrameHeaderSize = 9u;
+  return GRPC_SLICE_START_PTR(encoded)[kHttp2FrameHeaderSize];
+}
+
+TEST(HpackEncoderTest, RecurringMetadataIndexing) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+
+  // Sent as a literal when first seen, indexed when seen again, and then
+  // referred to by its index.
+  const uint8_t expected[] = {0x00, 0x40, 0xbe, 0xbe};
+  for (uint8_t first_byte : expected) {
+    const grpc_slice encoded_header =
+        EncodeHeaderIntoBytes(false, {{"x-env", "prod"}}, &compressor);
+    EXPECT_EQ(FirstFieldByte(encoded_header), first_byte);
+    grpc_slice_unref(encoded_header);
+  }
+}
+
+TEST(HpackEncoderTest, NewTimeoutRefersToIndexedName) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+
+  // A timeout no earlier one can stand for is indexed again, but the second
+  // time under the name of the first (dynamic index 62) instead of a literal
+  // name.
+  const std::pair<const char*, uint8_t> expected[] = {{"10S", 0x40},
+                                                      {"20S", 0x7e}};
+  for (const auto& timeout : expected) {
+    const grpc_slice encoded_header = EncodeHeaderIntoBytes(
+        false, {{grpc_core::GrpcTimeoutMetadata::key().data(), timeout.first}},
+        &compressor);
+    EXPECT_EQ(FirstFieldByte(encoded_header), timeout.second);
+    grpc_slice_unref(encoded_header);
+  }
+}
+
+TEST(HpackEncoderTest, EvictAllEmptiesBothTables) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+
+  for (int i = 0; i < 2; i++) {
+    grpc_slice_unref(
+        EncodeHeaderIntoBytes(false, {{"x-env", "prod"}}, &compressor));
+  }
+  EXPECT_GT(compressor.test_only_table_size(), 0);
+  compressor.EvictAll();
+  EXPECT_EQ(compressor.test_only_table_size(), 0);
+
+  // The next block resizes the peer's table to zero and back to 4096 bytes,
+  // and the pair is a literal again.
+  const grpc_core::Slice merged(
+      EncodeHeaderIntoBytes(false, {{"x-env", "prod"}}, &compressor));
+  const grpc_core::Slice expect(parse_hexstring(
+      "000010 0104 deadbeef 20 3fe11f 00 0578 2d 656e 76 0470 726f 64"));
+  EXPECT_EQ(merged, expect);
+}
+
+TEST(HpackEncoderTest, HighCardinalityMetadataNoIndexing) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+
+  int indexed = 0;
+  for (int i = 0; i < 1000; i++) {
+    const grpc_slice encoded_header = EncodeHeaderIntoBytes(
+        false, {{"x-request-id", std::to_string(i)}}, &compressor);
+    if (FirstFieldByte(encoded_header) != 0x00) indexed++;
+    grpc_slice_unref(encoded_header);
+  }
+  // The sketch may rarely mistake a new value for a recurring one.
+  EXPECT_LE(indexed, 10);
+}
+
+TEST(HpackEncoderTest, CredentialsNoIndexing) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+
+  for (int i = 0; i < 3; i++) {
+    const grpc_slice encoded_header = EncodeHeaderIntoBytes(
+        false, {{"authorization", "Bearer secret"}}, &compressor);
+    EXPECT_THAT(encoded_header, HasLiteralHeaderFieldNewNameFlagNoIndexing());
+    grpc_slice_unref(encoded_header);
+  }
+}
+
+TEST(HpackEncoderTest, WriteWeightNotSent) {
+  grpc_core::ExecCtx exec_ctx;
+
+  verify(false, "000005 0104 deadbeef 00 0161 0161",
+         {{"a", "a"}, {grpc_core::GrpcWriteWeightMetadata::key().data(), "8"}});
+}
+
 static void verify_continuation_headers(const char* key, const char* value,
                                         bool is_eof) {
   grpc_core::MemoryAllocator memory_allocator =
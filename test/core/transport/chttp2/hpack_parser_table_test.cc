@@ -27,6 +27,7 @@
 
 #include <grpc/grpc.h>
 
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice.h"
 #include "test/core/util/test_config.h"
@@ -134,6 +135,25 @@ TEST(HpackParserTableTest, ManyAdditions) {
   }
 }
 
+TEST(HpackParserTableTest, InternValue) {
+  const std::string value(64, 'a');
+  Slice first =
+      HPackTable::InternValue("user-agent", Slice::FromCopiedString(value));
+  Slice second =
+      HPackTable::InternValue("user-agent", Slice::FromCopiedString(value));
+  Slice other_key =
+      HPackTable::InternValue("x-routing", Slice::FromCopiedString(value));
+  Slice short_value =
+      HPackTable::InternValue("user-agent", Slice::FromCopiedString("short"));
+  EXPECT_EQ(first.as_string_view(), value);
+  EXPECT_EQ(second.as_string_view(), value);
+  EXPECT_EQ(other_key.as_string_view(), value);
+  EXPECT_EQ(short_value.as_string_view(), "short");
+  // Values of the same header share storage if interning is enabled.
+  EXPECT_EQ(first.begin() == second.begin(), IsHpackInternCacheEnabled());
+  EXPECT_NE(first.begin(), other_key.begin());
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
@@ -33,6 +33,7 @@
 #include <grpc/event_engine/memory_allocator.h>
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
+#include <grpc/status.h>
 #include <grpc/support/alloc.h>
 
 #include "src/core/lib/gprpp/crash.h"
@@ -306,6 +307,36 @@ INSTANTIATE_TEST_SUITE_P(
                   "a.b.c-bin: omg2021\n"},
              }}));
 
+TEST(HPackParserTest, RejectsOversizedHeaderBeforeItsValueArrives) {
+  grpc_init();
+  {
+    grpc_core::MemoryAllocator memory_allocator =
+        grpc_core::MemoryAllocator(grpc_core::ResourceQuota::Default()
+                                       ->memory_quota()
+                                       ->CreateMemoryAllocator("test"));
+    auto arena = grpc_core::MakeScopedArena(1024, &memory_allocator);
+    grpc_core::ExecCtx exec_ctx;
+    grpc_metadata_batch b(arena.get());
+    auto parser = std::make_unique<grpc_core::HPackParser>();
+    parser->BeginFrame(
+        &b, 4096, grpc_core::HPackParser::Boundary::None,
+        grpc_core::HPackParser::Priority::None,
+        grpc_core::HPackParser::LogInfo{
+            1, grpc_core::HPackParser::LogInfo::kHeaders, false});
+    // A literal header "a" whose value claims 65664 bytes, none of which are
+    // in the frame yet.
+    grpc_slice input = parse_hexstring("0001 617f 8180 04");
+    auto err = parser->Parse(input, false);
+    grpc_slice_unref(input);
+    intptr_t status;
+    ASSERT_TRUE(grpc_error_get_int(
+        err, grpc_core::StatusIntProperty::kRpcStatus, &status));
+    EXPECT_EQ(status, GRPC_STATUS_RESOURCE_EXHAUSTED);
+    parser.reset();
+  }
+  grpc_shutdown();
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -169,6 +169,35 @@ static void test_periodic_compaction(uint32_t n) {
   grpc_chttp2_stream_map_destroy(&map);
 }
 
+// delete the visited entry and its successor from inside for_each, as
+// closing a transport does, and make sure only live entries are visited
+static void delete_visited_and_next(void* user_data, uint32_t stream_id,
+                                    void* ptr) {
+  grpc_chttp2_stream_map* map = static_cast<grpc_chttp2_stream_map*>(user_data);
+  ASSERT_EQ(stream_id, reinterpret_cast<uintptr_t>(ptr));
+  ASSERT_EQ(stream_id % 4, 1);
+  ASSERT_EQ(ptr, grpc_chttp2_stream_map_delete(map, stream_id));
+  grpc_chttp2_stream_map_delete(map, stream_id + 2);
+}
+
+static void test_delete_during_for_each(uint32_t n) {
+  grpc_chttp2_stream_map map;
+  uint32_t i;
+
+  LOG_TEST("test_delete_during_for_each");
+  gpr_log(GPR_INFO, "n = %d", n);
+
+  grpc_chttp2_stream_map_init(&map, 8);
+  for (i = 1; i <= 4 * n; i += 2) {
+    grpc_chttp2_stream_map_add(&map, i, reinterpret_cast<void*>(i));
+  }
+  ASSERT_NE(nullptr, grpc_chttp2_stream_map_rand(&map));
+  grpc_chttp2_stream_map_for_each(&map, delete_visited_and_next, &map);
+  ASSERT_EQ(0, grpc_chttp2_stream_map_size(&map));
+  ASSERT_EQ(nullptr, grpc_chttp2_stream_map_rand(&map));
+  grpc_chttp2_stream_map_destroy(&map);
+}
+
 TEST(StreamMapTest, MainTest) {
   uint32_t n = 1;
   uint32_t prev = 1;
@@ -182,6 +211,7 @@ TEST(StreamMapTest, MainTest) {
     test_delete_evens_sweep(n);
     test_delete_evens_incremental(n);
     test_periodic_compaction(n);
+    test_delete_during_for_each(n);
 
     tmp = n;
     n += prev;
@@ -18,8 +18,10 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 #include "gtest/gtest.h"
 
@@ -125,6 +127,42 @@ TEST_F(MetadataMapTest, TimeoutEncodeTest) {
   EXPECT_EQ(encoder.output(), "grpc-timeout: deadline=1234\n");
 }
 
+// Records the key bytes of each unknown metadatum it receives.
+class UnknownKeyRecorder {
+ public:
+  const std::vector<const uint8_t*>& keys() const { return keys_; }
+
+  void Encode(const Slice& key, const Slice&) { keys_.push_back(key.data()); }
+
+  void Encode(GrpcTimeoutMetadata, Timestamp) {}
+
+ private:
+  std::vector<const uint8_t*> keys_;
+};
+
+TEST_F(MetadataMapTest, ParsedUnknownKeyIsShared) {
+  // Long enough that slices of it are not inlined.
+  constexpr absl::string_view kKey = "x-custom-header-too-long-to-inline";
+  auto parsed = TimeoutOnlyMetadataMap::Parse(
+      kKey, Slice::FromCopiedString("v"), 42,
+      [](absl::string_view, const Slice&) { abort(); });
+  auto arena = MakeScopedArena(1024, &memory_allocator_);
+  TimeoutOnlyMetadataMap map1(arena.get());
+  TimeoutOnlyMetadataMap map2(arena.get());
+  map1.Set(parsed);
+  map2.Set(parsed);
+  TimeoutOnlyMetadataMap copy = map1.Copy();
+  UnknownKeyRecorder recorder;
+  map1.Encode(&recorder);
+  map2.Encode(&recorder);
+  copy.Encode(&recorder);
+  ASSERT_EQ(recorder.keys().size(), 3);
+  EXPECT_EQ(recorder.keys()[0], recorder.keys()[1]);
+  EXPECT_EQ(recorder.keys()[0], recorder.keys()[2]);
+  std::string backing;
+  EXPECT_EQ(copy.GetStringValue(kKey, &backing), "v");
+}
+
 TEST_F(MetadataMapTest, NonEncodableTrait) {
   struct EncoderWithNoTraitEncodeFunctions {
     void Encode(const Slice&, const Slice&) {
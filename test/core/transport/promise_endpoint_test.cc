@@ -0,0 +1,212 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/transport/promise_endpoint.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
+
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "test/core/promise/test_wakeup_schedulers.h"
+
+using testing::_;
+using testing::MockFunction;
+using testing::StrictMock;
+
+namespace grpc_core {
+namespace testing {
+
+using grpc_event_engine::experimental::EventEngine;
+
+class MockEndpoint : public EventEngine::Endpoint {
+ public:
+  MOCK_METHOD(
+      void, Read,
+      (absl::AnyInvocable<void(absl::Status)> on_read,
+       grpc_event_engine::experimental::SliceBuffer* buffer,
+       const EventEngine::Endpoint::ReadArgs* args),
+      (override));
+  MOCK_METHOD(
+      void, Write,
+      (absl::AnyInvocable<void(absl::Status)> on_writable,
+       grpc_event_engine::experimental::SliceBuffer* data,
+       const EventEngine::Endpoint::WriteArgs* args),
+      (override));
+  MOCK_METHOD(const EventEngine::ResolvedAddress&, GetPeerAddress, (),
+              (const, override));
+  MOCK_METHOD(const EventEngine::ResolvedAddress&, GetLocalAddress, (),
+              (const, override));
+};
+
+SliceBuffer MakeBuffer(absl::string_view contents) {
+  SliceBuffer buffer;
+  buffer.Append(Slice::FromCopiedString(contents));
+  return buffer;
+}
+
+// Returns an action for MockEndpoint::Read that completes the read inline
+// with contents.
+auto ReadReturns(std::string contents) {
+  return [contents](absl::AnyInvocable<void(absl::Status)> on_read,
+                    grpc_event_engine::experimental::SliceBuffer* buffer,
+                    const EventEngine::Endpoint::ReadArgs*) {
+    buffer->Append(grpc_event_engine::experimental::Slice::FromCopiedString(
+        contents));
+    on_read(absl::OkStatus());
+  };
+}
+
+class PromiseEndpointTest : public ::testing::Test {
+ protected:
+  // Runs promise to completion in an activity and returns its result.
+  template <typename Promise>
+  absl::Status Run(Promise promise) {
+    absl::Status result = absl::UnknownError("not run");
+    auto activity = MakeActivity(
+        std::move(promise), InlineWakeupScheduler(),
+        [&result](absl::Status status) { result = std::move(status); });
+    return result;
+  }
+
+  StrictMock<MockEndpoint>* endpoint_ = new StrictMock<MockEndpoint>();
+};
+
+TEST_F(PromiseEndpointTest, ReadsAlreadyReceivedBytesFirst) {
+  PromiseEndpoint promise_endpoint(
+      std::unique_ptr<EventEngine::Endpoint>(endpoint_), MakeBuffer("hello"));
+  EXPECT_EQ(Run(Map(promise_endpoint.Read(5),
+                    [](absl::StatusOr<SliceBuffer> buffer) {
+                      EXPECT_TRUE(buffer.ok()) << buffer.status();
+                      EXPECT_EQ(buffer->JoinIntoString(), "hello");
+                      return absl::OkStatus();
+                    })),
+            absl::OkStatus());
+}
+
+TEST_F(PromiseEndpointTest, ReadsUntilEnoughBytesArrive) {
+  PromiseEndpoint promise_endpoint(
+      std::unique_ptr<EventEngine::Endpoint>(endpoint_), MakeBuffer("ab"));
+  EXPECT_CALL(*endpoint_, Read(_, _, _))
+      .WillOnce(ReadReturns("cd"))
+      .WillOnce(ReadReturns("efgh"));
+  EXPECT_EQ(Run(Seq(promise_endpoint.Read(5),
+                    [&promise_endpoint](absl::StatusOr<SliceBuffer> buffer) {
+                      EXPECT_TRUE(buffer.ok()) << buffer.status();
+                      EXPECT_EQ(buffer->JoinIntoString(), "abcde");
+                      // The rest of the last read is kept for the next one.
+                      return promise_endpoint.Read(3);
+                    },
+                    [](absl::StatusOr<SliceBuffer> buffer) {
+                      EXPECT_TRUE(buffer.ok()) << buffer.status();
+                      EXPECT_EQ(buffer->JoinIntoString(), "fgh");
+                      return absl::OkStatus();
+                    })),
+            absl::OkStatus());
+}
+
+TEST_F(PromiseEndpointTest, ReadFailsOnceEndpointCloses) {
+  PromiseEndpoint promise_endpoint(
+      std::unique_ptr<EventEngine::Endpoint>(endpoint_), SliceBuffer{});
+  EXPECT_CALL(*endpoint_, Read(_, _, _)).WillOnce(ReadReturns(""));
+  EXPECT_EQ(Run(Map(promise_endpoint.Read(1),
+                    [](absl::StatusOr<SliceBuffer> buffer) {
+                      return buffer.status();
+                    })),
+            absl::UnavailableError("Endpoint closed"));
+}
+
+TEST_F(PromiseEndpointTest, ReadCompletesLater) {
+  PromiseEndpoint promise_endpoint(
+      std::unique_ptr<EventEngine::Endpoint>(endpoint_), SliceBuffer{});
+  absl::AnyInvocable<void(absl::Status)> on_read;
+  grpc_event_engine::experimental::SliceBuffer* read_buffer = nullptr;
+  EXPECT_CALL(*endpoint_, Read(_, _, _))
+      .WillOnce([&](absl::AnyInvocable<void(absl::Status)> cb,
+                    grpc_event_engine::experimental::SliceBuffer* buffer,
+                    const EventEngine::Endpoint::ReadArgs* args) {
+        EXPECT_EQ(args->read_hint_bytes, 3);
+        on_read = std::move(cb);
+        read_buffer = buffer;
+      });
+  StrictMock<MockFunction<void(absl::Status)>> on_done;
+  auto activity = MakeActivity(
+      Map(promise_endpoint.Read(3),
+          [](absl::StatusOr<SliceBuffer> buffer) {
+            EXPECT_TRUE(buffer.ok()) << buffer.status();
+            EXPECT_EQ(buffer->JoinIntoString(), "xyz");
+            return absl::OkStatus();
+          }),
+      InlineWakeupScheduler(),
+      [&on_done](absl::Status status) { on_done.Call(std::move(status)); });
+  ASSERT_NE(read_buffer, nullptr);
+  read_buffer->Append(
+      grpc_event_engine::experimental::Slice::FromCopiedString("xyz"));
+  EXPECT_CALL(on_done, Call(absl::OkStatus()));
+  on_read(absl::OkStatus());
+}
+
+TEST_F(PromiseEndpointTest, WritesToEndpoint) {
+  PromiseEndpoint promise_endpoint(
+      std::unique_ptr<EventEngine::Endpoint>(endpoint_), SliceBuffer{});
+  EXPECT_CALL(*endpoint_, Write(_, _, _))
+      .WillOnce([](absl::AnyInvocable<void(absl::Status)> on_writable,
+                   grpc_event_engine::experimental::SliceBuffer* data,
+                   const EventEngine::Endpoint::WriteArgs*) {
+        EXPECT_EQ(data->Length(), 5);
+        on_writable(absl::OkStatus());
+      });
+  EXPECT_EQ(Run(promise_endpoint.Write(MakeBuffer("hello"))),
+            absl::OkStatus());
+}
+
+TEST_F(PromiseEndpointTest, EmptyWriteSkipsEndpoint) {
+  PromiseEndpoint promise_endpoint(
+      std::unique_ptr<EventEngine::Endpoint>(endpoint_), SliceBuffer{});
+  EXPECT_EQ(Run(promise_endpoint.Write(SliceBuffer())), absl::OkStatus());
+}
+
+TEST_F(PromiseEndpointTest, WriteReportsEndpointError) {
+  PromiseEndpoint promise_endpoint(
+      std::unique_ptr<EventEngine::Endpoint>(endpoint_), SliceBuffer{});
+  EXPECT_CALL(*endpoint_, Write(_, _, _))
+      .WillOnce([](absl::AnyInvocable<void(absl::Status)> on_writable,
+                   grpc_event_engine::experimental::SliceBuffer*,
+                   const EventEngine::Endpoint::WriteArgs*) {
+        on_writable(absl::InternalError("write failed"));
+      });
+  EXPECT_EQ(Run(promise_endpoint.Write(MakeBuffer("hello"))),
+            absl::InternalError("write failed"));
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,145 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/transport/shm/shm_ring.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/support/alloc.h>
+
+#include "src/core/lib/slice/slice_internal.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+constexpr size_t kCapacity = 64;
+
+class ShmRingTest : public ::testing::Test {
+ protected:
+  ShmRingTest()
+      : memory_(gpr_malloc_aligned(ShmRing::MappedSize(kCapacity), 64)),
+        writer_(memory_, kCapacity),
+        reader_(memory_, kCapacity) {
+    writer_.Init();
+    grpc_slice_buffer_init(&out_);
+  }
+  ~ShmRingTest() override {
+    grpc_slice_buffer_destroy(&out_);
+    gpr_free_aligned(memory_);
+  }
+
+  // Writes \a data, returning what Write() returned and leaving what did
+  // not fit in \a rest.
+  int64_t Write(ShmRing* ring, const std::string& data,
+                std::string* rest = nullptr) {
+    grpc_slice_buffer in;
+    grpc_slice_buffer_init(&in);
+    grpc_slice_buffer_add(&in, grpc_slice_from_cpp_string(data));
+    int64_t n = ring->Write(&in);
+    if (rest != nullptr) *rest = Contents(in);
+    grpc_slice_buffer_destroy(&in);
+    return n;
+  }
+
+  std::string Read(ShmRing* ring, size_t max_bytes = kCapacity) {
+    grpc_slice_buffer_reset_and_unref(&out_);
+    EXPECT_GE(ring->Read(&out_, max_bytes), 0);
+    return Contents(out_);
+  }
+
+  static std::string Contents(const grpc_slice_buffer& buffer) {
+    std::string result;
+    for (size_t i = 0; i < buffer.count; ++i) {
+      result += std::string(StringViewFromSlice(buffer.slices[i]));
+    }
+    return result;
+  }
+
+  void* const memory_;
+  ShmRing writer_;
+  ShmRing reader_;
+  grpc_slice_buffer out_;
+};
+
+TEST_F(ShmRingTest, CarriesBytesAcrossTheEndOfTheRing) {
+  const std::string first(40, 'a');
+  const std::string second = "0123456789abcdefghijklmnopqrstuvwxyz!@#$%^&*()";
+  EXPECT_EQ(Write(&writer_, first), 40);
+  EXPECT_EQ(Read(&reader_), first);
+  EXPECT_EQ(Write(&writer_, second), static_cast<int64_t>(second.size()));
+  EXPECT_EQ(Read(&reader_, 10), second.substr(0, 10));
+  EXPECT_EQ(Read(&reader_), second.substr(10));
+  EXPECT_EQ(Read(&reader_), "");
+}
+
+TEST_F(ShmRingTest, WriterWaitsForSpaceOnlyWhenFull) {
+  std::string rest;
+  EXPECT_EQ(Write(&writer_, std::string(100, 'x'), &rest), 64);
+  EXPECT_EQ(rest.size(), 36u);
+  EXPECT_EQ(Write(&writer_, rest), 0);
+  EXPECT_TRUE(writer_.WaitForSpace());
+  EXPECT_EQ(Read(&reader_, 10), std::string(10, 'x'));
+  EXPECT_TRUE(reader_.TakeWriterWaiting());
+  EXPECT_FALSE(reader_.TakeWriterWaiting());
+  EXPECT_EQ(Write(&writer_, rest), 10);
+  // No waiting when there is space.
+  EXPECT_EQ(Read(&reader_, 1), "x");
+  EXPECT_FALSE(writer_.WaitForSpace());
+  EXPECT_FALSE(reader_.TakeWriterWaiting());
+}
+
+TEST_F(ShmRingTest, ReaderWaitsForDataOnlyWhenEmpty) {
+  EXPECT_TRUE(reader_.WaitForData());
+  EXPECT_EQ(Write(&writer_, "hello"), 5);
+  EXPECT_TRUE(writer_.TakeReaderWaiting());
+  EXPECT_FALSE(writer_.TakeReaderWaiting());
+  EXPECT_FALSE(reader_.WaitForData());
+  EXPECT_EQ(Write(&writer_, "!"), 1);
+  EXPECT_FALSE(writer_.TakeReaderWaiting());
+  EXPECT_EQ(Read(&reader_), "hello!");
+}
+
+TEST_F(ShmRingTest, RejectsImpossiblePeerIndices) {
+  EXPECT_EQ(Write(&writer_, std::string(64, 'y')), 64);
+  EXPECT_EQ(Read(&reader_).size(), 64u);
+  EXPECT_EQ(Write(&writer_, std::string(64, 'z')), 64);
+  // Peers that start over from zero see indices further along than the
+  // ring could ever hold.
+  ShmRing stale_reader(memory_, kCapacity);
+  EXPECT_EQ(stale_reader.Read(&out_, kCapacity), -1);
+  ShmRing stale_writer(memory_, kCapacity);
+  EXPECT_EQ(Write(&stale_writer, "w"), -1);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -36,6 +36,7 @@ constexpr size_t kMaxSliceLength = 256;
 constexpr size_t kMaxSlices = 10;
 constexpr size_t kSealRepeatTimes = 5;
 constexpr size_t kTagLength = 16;
+constexpr size_t kMaxBatchFrameDataLength = 100;
 
 // Test fixtures for each test cases.
 struct alts_grpc_record_protocol_test_fixture {
@@ -376,6 +377,48 @@ static void corrupted_data(alts_grpc_record_protocol* sender,
   grpc_core::ExecCtx::Get()->Flush();
 }
 
+static void batch_seal_unseal(alts_grpc_record_protocol* sender,
+                              alts_grpc_record_protocol* receiver) {
+  if (!alts_grpc_record_protocol_supports_batch(sender)) {
+    return;
+  }
+  grpc_core::ExecCtx exec_ctx;
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_grpc_record_protocol_test_var* var =
+        alts_grpc_record_protocol_test_var_create();
+    // Seals as many frames and then unseals them all at once.
+    size_t data_length = var->original_sb.length;
+    size_t num_frames = (data_length + kMaxBatchFrameDataLength - 1) /
+                        kMaxBatchFrameDataLength;
+    tsi_result status = alts_grpc_record_protocol_protect_batch(
+        sender, &var->original_sb, kMaxBatchFrameDataLength,
+        &var->protected_sb);
+    ASSERT_EQ(status, TSI_OK);
+    ASSERT_EQ(var->original_sb.length, 0);
+    ASSERT_EQ(var->protected_sb.length,
+              data_length +
+                  num_frames * (var->header_length + var->tag_length));
+    status = alts_grpc_record_protocol_unprotect_batch(
+        receiver, &var->protected_sb, &var->unprotected_sb);
+    ASSERT_EQ(status, TSI_OK);
+    ASSERT_TRUE(
+        are_slice_buffers_equal(&var->unprotected_sb, &var->duplicate_sb));
+    alts_grpc_record_protocol_test_var_destroy(var);
+  }
+  // Unseals a batch holding a corrupted frame.
+  alts_grpc_record_protocol_test_var* var =
+      alts_grpc_record_protocol_test_var_create();
+  tsi_result status = alts_grpc_record_protocol_protect_batch(
+      sender, &var->original_sb, kMaxBatchFrameDataLength, &var->protected_sb);
+  ASSERT_EQ(status, TSI_OK);
+  alter_random_byte(&var->protected_sb);
+  status = alts_grpc_record_protocol_unprotect_batch(
+      receiver, &var->protected_sb, &var->unprotected_sb);
+  ASSERT_NE(status, TSI_OK);
+  alts_grpc_record_protocol_test_var_destroy(var);
+  grpc_core::ExecCtx::Get()->Flush();
+}
+
 static void input_check(alts_grpc_record_protocol* rp) {
   grpc_core::ExecCtx exec_ctx;
   tsi_result status;
@@ -435,6 +478,12 @@ static void alts_grpc_record_protocol_corrupted_data_tests(
   corrupted_data(fixture->server_protect, fixture->client_unprotect);
 }
 
+static void alts_grpc_record_protocol_batch_seal_unseal_tests(
+    alts_grpc_record_protocol_test_fixture* fixture) {
+  batch_seal_unseal(fixture->client_protect, fixture->server_unprotect);
+  batch_seal_unseal(fixture->server_protect, fixture->client_unprotect);
+}
+
 static void alts_grpc_record_protocol_input_check_tests(
     alts_grpc_record_protocol_test_fixture* fixture) {
   input_check(fixture->client_protect);
@@ -461,6 +510,10 @@ static void alts_grpc_record_protocol_tests(
   auto* fixture_5 = fixture_create();
   alts_grpc_record_protocol_input_check_tests(fixture_5);
   alts_grpc_record_protocol_test_fixture_destroy(fixture_5);
+
+  auto* fixture_6 = fixture_create();
+  alts_grpc_record_protocol_batch_seal_unseal_tests(fixture_6);
+  alts_grpc_record_protocol_test_fixture_destroy(fixture_6);
 }
 
 TEST(AltsGrpcRecordProtocolTest, MainTest) {
@@ -143,6 +143,22 @@ TEST(SslSessionCacheTest, LruCache) {
   EXPECT_EQ(tracker.AliveCount(), 0);
 }
 
+TEST(SslSessionCacheTest, Erase) {
+  SessionTracker tracker;
+  RefCountedPtr<tsi::SslSessionLRUCache> cache =
+      tsi::SslSessionLRUCache::Create(3);
+  cache->Put("first.dropbox.com", tracker.NewSession(1));
+  cache->Put("second.dropbox.com", tracker.NewSession(2));
+  cache->Erase("first.dropbox.com");
+  EXPECT_FALSE(tracker.IsAlive(1));
+  EXPECT_EQ(cache->Get("first.dropbox.com"), nullptr);
+  EXPECT_TRUE(cache->Get("second.dropbox.com"));
+  EXPECT_EQ(cache->Size(), 1);
+  // Erasing a missing key does nothing.
+  cache->Erase("third.dropbox.com");
+  EXPECT_EQ(cache->Size(), 1);
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -22,10 +22,22 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <atomic>
+#include <string>
+#include <thread>
+#include <utility>
+
 #include <gtest/gtest.h>
 #include <openssl/crypto.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
 #include <openssl/pem.h>
+#include <openssl/rsa.h>
+#include <openssl/ssl.h>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
@@ -34,8 +46,12 @@
 
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/iomgr/load_file.h"
+#include "src/core/tsi/ssl/early_data/ssl_early_data_anti_replay.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
+#include "src/core/tsi/ssl/private_key_signer/ssl_private_key_signer.h"
+#include "src/core/tsi/ssl/session_ticket/ssl_session_ticket_key_ring.h"
 #include "src/core/tsi/transport_security.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "test/core/tsi/transport_security_test_lib.h"
@@ -106,6 +122,8 @@ typedef struct ssl_tsi_test_fixture {
   bool session_reused;
   const char* session_ticket_key;
   size_t session_ticket_key_size;
+  tsi::SslSessionTicketKeyRing* session_ticket_key_ring;
+  tsi::SslPrivateKeySigner* private_key_signer;
   size_t network_bio_buf_size;
   size_t ssl_bio_buf_size;
   tsi_ssl_server_handshaker_factory* server_handshaker_factory;
@@ -181,6 +199,8 @@ static void ssl_test_setup_handshakers(tsi_test_fixture* fixture) {
   }
   server_options.session_ticket_key = ssl_fixture->session_ticket_key;
   server_options.session_ticket_key_size = ssl_fixture->session_ticket_key_size;
+  server_options.session_ticket_key_ring = ssl_fixture->session_ticket_key_ring;
+  server_options.private_key_signer = ssl_fixture->private_key_signer;
   server_options.min_tls_version = test_tls_version;
   server_options.max_tls_version = test_tls_version;
   ASSERT_EQ(tsi_create_ssl_server_handshaker_factory_with_options(
@@ -579,6 +599,8 @@ static tsi_test_fixture* ssl_tsi_test_fixture_create() {
   ssl_fixture->session_reused = false;
   ssl_fixture->session_ticket_key = nullptr;
   ssl_fixture->session_ticket_key_size = 0;
+  ssl_fixture->session_ticket_key_ring = nullptr;
+  ssl_fixture->private_key_signer = nullptr;
   ssl_fixture->force_client_auth = false;
   ssl_fixture->network_bio_buf_size = 0;
   ssl_fixture->ssl_bio_buf_size = 0;
@@ -853,6 +875,152 @@ void ssl_tsi_test_do_handshake_session_cache() {
   tsi_ssl_session_cache_unref(session_cache);
 }
 
+void ssl_tsi_test_do_handshake_session_ticket_key_ring() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_do_handshake_session_ticket_key_ring");
+  tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
+  // Each handshake gets a new server handshaker factory, as another server
+  // sharing the same keys would be.
+  auto key_ring = grpc_core::MakeRefCounted<tsi::SslSessionTicketKeyRing>();
+  auto do_handshake = [&key_ring, &session_cache](bool session_reused) {
+    tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+    ssl_tsi_test_fixture* ssl_fixture =
+        reinterpret_cast<ssl_tsi_test_fixture*>(fixture);
+    ssl_fixture->server_name_indication =
+        const_cast<char*>("waterzooi.test.google.be");
+    ssl_fixture->session_ticket_key_ring = key_ring.get();
+    tsi_ssl_session_cache_ref(session_cache);
+    ssl_fixture->session_cache = session_cache;
+    ssl_fixture->session_reused = session_reused;
+    tsi_test_do_round_trip(&ssl_fixture->base);
+    tsi_test_fixture_destroy(fixture);
+  };
+  const std::string key_a(tsi::SslSessionTicketKeyRing::kKeySize, 'a');
+  const std::string key_b(tsi::SslSessionTicketKeyRing::kKeySize, 'b');
+  const std::string key_c(tsi::SslSessionTicketKeyRing::kKeySize, 'c');
+  const std::string key_d(tsi::SslSessionTicketKeyRing::kKeySize, 'd');
+  GPR_ASSERT(!key_ring->SetKeys(""));
+  GPR_ASSERT(!key_ring->SetKeys(key_a.substr(1)));
+  GPR_ASSERT(key_ring->SetKeys(key_a));
+  do_handshake(false);
+  do_handshake(true);
+  // Tickets encrypted with a key that is being rotated out are still
+  // accepted.
+  GPR_ASSERT(key_ring->SetKeys(key_b + key_a));
+  do_handshake(true);
+  // Tickets encrypted with a key that is gone are not.
+  GPR_ASSERT(key_ring->SetKeys(key_c));
+  do_handshake(false);
+  do_handshake(true);
+  GPR_ASSERT(key_ring->SetKeys(key_d + key_c));
+  do_handshake(true);
+  tsi_ssl_session_cache_unref(session_cache);
+}
+
+#ifdef OPENSSL_IS_BORINGSSL
+// Signs with a key it holds, on a thread of its own, as a remote signer would.
+class TestPrivateKeySigner final : public tsi::SslPrivateKeySigner {
+ public:
+  explicit TestPrivateKeySigner(const char* pem_key) {
+    BIO* bio = BIO_new_mem_buf(pem_key, strlen(pem_key));
+    key_ = PEM_read_bio_PrivateKey(bio, nullptr, nullptr,
+                                   const_cast<char*>(""));
+    BIO_free(bio);
+    GPR_ASSERT(key_ != nullptr);
+  }
+  ~TestPrivateKeySigner() override { EVP_PKEY_free(key_); }
+
+  void Sign(absl::string_view data, uint16_t signature_algorithm,
+            OnSignDone on_done) override {
+    num_signatures_++;
+    std::thread([self = Ref(), this, data = std::string(data),
+                 signature_algorithm, on_done = std::move(on_done)]() mutable {
+      on_done(SignNow(data, signature_algorithm));
+    }).detach();
+  }
+
+  int num_signatures() const { return num_signatures_.load(); }
+
+ private:
+  absl::StatusOr<std::string> SignNow(const std::string& data,
+                                      uint16_t signature_algorithm) {
+    bssl::ScopedEVP_MD_CTX ctx;
+    EVP_PKEY_CTX* pctx;
+    if (!EVP_DigestSignInit(ctx.get(), &pctx,
+                            SSL_get_signature_algorithm_digest(
+                                signature_algorithm),
+                            nullptr, key_)) {
+      return absl::InternalError("EVP_DigestSignInit failed");
+    }
+    if (SSL_is_signature_algorithm_rsa_pss(signature_algorithm) &&
+        (!EVP_PKEY_CTX_set_rsa_padding(pctx, RSA_PKCS1_PSS_PADDING) ||
+         !EVP_PKEY_CTX_set_rsa_pss_saltlen(pctx, -1))) {
+      return absl::InternalError("Setting up RSA-PSS failed");
+    }
+    size_t signature_size = 0;
+    const uint8_t* input = reinterpret_cast<const uint8_t*>(data.data());
+    if (!EVP_DigestSign(ctx.get(), nullptr, &signature_size, input,
+                        data.size())) {
+      return absl::InternalError("EVP_DigestSign failed");
+    }
+    std::string signature(signature_size, '\0');
+    if (!EVP_DigestSign(ctx.get(), reinterpret_cast<uint8_t*>(&signature[0]),
+                        &signature_size, input, data.size())) {
+      return absl::InternalError("EVP_DigestSign failed");
+    }
+    signature.resize(signature_size);
+    return signature;
+  }
+
+  EVP_PKEY* key_;
+  std::atomic<int> num_signatures_{0};
+};
+
+void ssl_tsi_test_do_handshake_with_private_key_signer() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_do_handshake_with_private_key_signer");
+  tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+  ssl_tsi_test_fixture* ssl_fixture =
+      reinterpret_cast<ssl_tsi_test_fixture*>(fixture);
+  // The handshake picks the first key-cert pair, which the server no longer
+  // has the private key of.
+  tsi_ssl_pem_key_cert_pair* key_cert_pair =
+      &ssl_fixture->key_cert_lib->server_pem_key_cert_pairs[0];
+  auto signer = grpc_core::MakeRefCounted<TestPrivateKeySigner>(
+      key_cert_pair->private_key);
+  gpr_free(const_cast<char*>(key_cert_pair->private_key));
+  key_cert_pair->private_key = nullptr;
+  ssl_fixture->private_key_signer = signer.get();
+  tsi_test_do_round_trip(fixture);
+  tsi_test_fixture_destroy(fixture);
+  GPR_ASSERT(signer->num_signatures() == 1);
+}
+#else
+void ssl_tsi_test_private_key_signer_unsupported() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_private_key_signer_unsupported");
+  class FailingPrivateKeySigner final : public tsi::SslPrivateKeySigner {
+   public:
+    void Sign(absl::string_view /*data*/, uint16_t /*signature_algorithm*/,
+              OnSignDone on_done) override {
+      on_done(absl::UnimplementedError("not signing"));
+    }
+  };
+  auto signer = grpc_core::MakeRefCounted<FailingPrivateKeySigner>();
+  char* cert_chain = load_file(SSL_TSI_TEST_CREDENTIALS_DIR, "server0.pem");
+  tsi_ssl_pem_key_cert_pair cert_pair;
+  cert_pair.cert_chain = cert_chain;
+  cert_pair.private_key = nullptr;
+  tsi_ssl_server_handshaker_options options;
+  options.pem_key_cert_pairs = &cert_pair;
+  options.num_key_cert_pairs = 1;
+  options.private_key_signer = signer.get();
+  tsi_ssl_server_handshaker_factory* server_handshaker_factory = nullptr;
+  ASSERT_EQ(tsi_create_ssl_server_handshaker_factory_with_options(
+                &options, &server_handshaker_factory),
+            TSI_UNIMPLEMENTED);
+  ASSERT_EQ(server_handshaker_factory, nullptr);
+  gpr_free(cert_chain);
+}
+#endif
+
 void ssl_tsi_test_do_handshake_with_intermediate_ca() {
   gpr_log(
       GPR_INFO,
@@ -1191,6 +1359,12 @@ TEST(SslTransportSecurityTest, MainTest) {
     ssl_tsi_test_do_handshake_alpn_server_no_client();
     ssl_tsi_test_do_handshake_alpn_client_server_ok();
     ssl_tsi_test_do_handshake_session_cache();
+    ssl_tsi_test_do_handshake_session_ticket_key_ring();
+#ifdef OPENSSL_IS_BORINGSSL
+    ssl_tsi_test_do_handshake_with_private_key_signer();
+#else
+    ssl_tsi_test_private_key_signer_unsupported();
+#endif
     ssl_tsi_test_do_round_trip_for_all_configs();
     ssl_tsi_test_do_round_trip_with_error_on_stack();
     ssl_tsi_test_do_round_trip_odd_buffer_size();
@@ -1204,6 +1378,22 @@ TEST(SslTransportSecurityTest, MainTest) {
   grpc_shutdown();
 }
 
+TEST(SslEarlyDataAntiReplayTest, RejectsReplays) {
+  tsi::SslEarlyDataAntiReplay anti_replay(2);
+  gpr_timespec now = gpr_time_0(GPR_CLOCK_MONOTONIC);
+  EXPECT_TRUE(anti_replay.AcceptEarlyData("hello1", now));
+  EXPECT_FALSE(anti_replay.AcceptEarlyData("hello1", now));
+  EXPECT_TRUE(anti_replay.AcceptEarlyData("hello2", now));
+  // Full until the oldest expire.
+  EXPECT_FALSE(anti_replay.AcceptEarlyData("hello3", now));
+  now = gpr_time_add(
+      now, gpr_time_from_millis(tsi::SslEarlyDataAntiReplay::kWindowMs,
+                                GPR_TIMESPAN));
+  EXPECT_TRUE(anti_replay.AcceptEarlyData("hello3", now));
+  EXPECT_TRUE(anti_replay.AcceptEarlyData("hello1", now));
+  EXPECT_FALSE(anti_replay.AcceptEarlyData("hello1", now));
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -40,12 +40,15 @@
 #include "upb/def.h"
 
 #include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpcpp/impl/codegen/config_protobuf.h>
 
 #include "src/core/ext/xds/xds_bootstrap.h"
+#include "src/core/ext/xds/xds_resource_cache.h"
 #include "src/core/ext/xds/xds_resource_type_impl.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gpr/tmpfile.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -62,6 +65,8 @@
 // IWYU pragma: no_include <google/protobuf/unknown_field_set.h>
 // IWYU pragma: no_include <google/protobuf/util/json_util.h>
 
+using envoy::service::discovery::v3::DeltaDiscoveryRequest;
+using envoy::service::discovery::v3::DeltaDiscoveryResponse;
 using envoy::service::discovery::v3::DiscoveryRequest;
 using envoy::service::discovery::v3::DiscoveryResponse;
 
@@ -120,10 +125,12 @@ class XdsClientTest : public ::testing::Test {
       bool IgnoreResourceDeletion() const override {
         return ignore_resource_deletion_;
       }
+      bool UseDeltaProtocol() const override { return use_delta_protocol_; }
       bool Equals(const XdsServer& other) const override {
         const auto& o = static_cast<const FakeXdsServer&>(other);
         return server_uri_ == o.server_uri_ &&
-               ignore_resource_deletion_ == o.ignore_resource_deletion_;
+               ignore_resource_deletion_ == o.ignore_resource_deletion_ &&
+               use_delta_protocol_ == o.use_delta_protocol_;
       }
 
       void set_server_uri(std::string server_uri) {
@@ -132,10 +139,14 @@ class XdsClientTest : public ::testing::Test {
       void set_ignore_resource_deletion(bool ignore_resource_deletion) {
         ignore_resource_deletion_ = ignore_resource_deletion;
       }
+      void set_use_delta_protocol(bool use_delta_protocol) {
+        use_delta_protocol_ = use_delta_protocol;
+      }
 
      private:
       std::string server_uri_ = "default_xds_server";
       bool ignore_resource_deletion_ = false;
+      bool use_delta_protocol_ = false;
     };
 
     class FakeAuthority : public Authority {
@@ -169,11 +180,20 @@ class XdsClientTest : public ::testing::Test {
         server_.set_ignore_resource_deletion(ignore_resource_deletion);
         return *this;
       }
+      Builder& set_use_delta_protocol(bool use_delta_protocol) {
+        server_.set_use_delta_protocol(use_delta_protocol);
+        return *this;
+      }
+      Builder& set_resource_cache_path(std::string resource_cache_path) {
+        resource_cache_path_ = std::move(resource_cache_path);
+        return *this;
+      }
       std::unique_ptr<XdsBootstrap> Build() {
         auto bootstrap = std::make_unique<FakeXdsBootstrap>();
         bootstrap->server_ = std::move(server_);
         bootstrap->node_ = std::move(node_);
         bootstrap->authorities_ = std::move(authorities_);
+        bootstrap->resource_cache_path_ = std::move(resource_cache_path_);
         return bootstrap;
       }
 
@@ -181,6 +201,7 @@ class XdsClientTest : public ::testing::Test {
       FakeXdsServer server_;
       absl::optional<FakeNode> node_;
       std::map<std::string, FakeAuthority> authorities_;
+      std::string resource_cache_path_;
     };
 
     std::string ToString() const override { return "<fake>"; }
@@ -206,11 +227,15 @@ class XdsClientTest : public ::testing::Test {
       }
       return nullptr;
     }
+    const std::string& resource_cache_path() const override {
+      return resource_cache_path_;
+    }
 
    private:
     FakeXdsServer server_;
     absl::optional<FakeNode> node_;
     std::map<std::string, FakeAuthority> authorities_;
+    std::string resource_cache_path_;
   };
 
   // A template for a test xDS resource type with an associated watcher impl.
@@ -553,6 +578,42 @@ class XdsClientTest : public ::testing::Test {
     DiscoveryResponse response_;
   };
 
+  // A helper class to build and serialize a DeltaDiscoveryResponse.
+  class DeltaResponseBuilder {
+   public:
+    explicit DeltaResponseBuilder(absl::string_view type_url) {
+      response_.set_type_url(absl::StrCat("type.googleapis.com/", type_url));
+    }
+
+    DeltaResponseBuilder& set_nonce(absl::string_view nonce) {
+      response_.set_nonce(std::string(nonce));
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddFooResource(const XdsFooResource& resource,
+                                         absl::string_view version) {
+      auto* res = response_.add_resources();
+      res->set_name(resource.name);
+      res->set_version(std::string(version));
+      *res->mutable_resource() = XdsFooResourceType::EncodeAsAny(resource);
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddRemovedResource(absl::string_view name) {
+      response_.add_removed_resources(std::string(name));
+      return *this;
+    }
+
+    std::string Serialize() {
+      std::string serialized_response;
+      EXPECT_TRUE(response_.SerializeToString(&serialized_response));
+      return serialized_response;
+    }
+
+   private:
+    DeltaDiscoveryResponse response_;
+  };
+
   class ScopedExperimentalEnvVar {
    public:
     explicit ScopedExperimentalEnvVar(const char* env_var) : env_var_(env_var) {
@@ -621,13 +682,29 @@ class XdsClientTest : public ::testing::Test {
         xds_client_.get(), resource_name, watcher, delay_unsubscription);
   }
 
+  // Writes entries to a new temporary file and returns its path.
+  static std::string WriteResourceCacheFile(
+      const XdsResourceCache::EntryMap& entries) {
+    char* name = nullptr;
+    FILE* file = gpr_tmpfile("xds_client_test", &name);
+    GPR_ASSERT(file != nullptr);
+    fclose(file);
+    std::string path = name;
+    gpr_free(name);
+    GPR_ASSERT(XdsResourceCache::Write(path, entries).ok());
+    return path;
+  }
+
   RefCountedPtr<FakeXdsTransportFactory::FakeStreamingCall> WaitForAdsStream(
       const XdsBootstrap::XdsServer& server,
       absl::Duration timeout = absl::Seconds(5)) {
     const auto* xds_server = xds_client_->bootstrap().FindXdsServer(server);
     GPR_ASSERT(xds_server != nullptr);
     return transport_factory_->WaitForStream(
-        *xds_server, FakeXdsTransportFactory::kAdsMethod,
+        *xds_server,
+        xds_server->UseDeltaProtocol()
+            ? FakeXdsTransportFactory::kDeltaAdsMethod
+            : FakeXdsTransportFactory::kAdsMethod,
         timeout * grpc_test_slowdown_factor());
   }
 
@@ -688,6 +765,58 @@ class XdsClientTest : public ::testing::Test {
         << location.file() << ":" << location.line();
   }
 
+  // Gets the latest delta request sent to the fake xDS server.
+  absl::optional<DeltaDiscoveryRequest> WaitForDeltaRequest(
+      FakeXdsTransportFactory::FakeStreamingCall* stream,
+      absl::Duration timeout = absl::Seconds(3),
+      SourceLocation location = SourceLocation()) {
+    auto message =
+        stream->WaitForMessageFromClient(timeout * grpc_test_slowdown_factor());
+    if (!message.has_value()) return absl::nullopt;
+    DeltaDiscoveryRequest request;
+    bool success = request.ParseFromString(*message);
+    EXPECT_TRUE(success) << "Failed to deserialize DeltaDiscoveryRequest at "
+                         << location.file() << ":" << location.line();
+    if (!success) return absl::nullopt;
+    return std::move(request);
+  }
+
+  // Helper function to check the fields of a DeltaDiscoveryRequest.
+  void CheckDeltaRequest(
+      const DeltaDiscoveryRequest& request, absl::string_view type_url,
+      absl::string_view response_nonce, absl::Status error_detail,
+      std::set<absl::string_view> subscribe,
+      std::set<absl::string_view> unsubscribe,
+      std::map<std::string, std::string> initial_resource_versions = {},
+      SourceLocation location = SourceLocation()) {
+    EXPECT_EQ(request.type_url(),
+              absl::StrCat("type.googleapis.com/", type_url))
+        << location.file() << ":" << location.line();
+    EXPECT_EQ(request.response_nonce(), response_nonce)
+        << location.file() << ":" << location.line();
+    if (error_detail.ok()) {
+      EXPECT_FALSE(request.has_error_detail())
+          << location.file() << ":" << location.line();
+    } else {
+      EXPECT_EQ(request.error_detail().code(),
+                static_cast<int>(error_detail.code()))
+          << location.file() << ":" << location.line();
+      EXPECT_EQ(request.error_detail().message(), error_detail.message())
+          << location.file() << ":" << location.line();
+    }
+    EXPECT_THAT(request.resource_names_subscribe(),
+                ::testing::UnorderedElementsAreArray(subscribe))
+        << location.file() << ":" << location.line();
+    EXPECT_THAT(request.resource_names_unsubscribe(),
+                ::testing::UnorderedElementsAreArray(unsubscribe))
+        << location.file() << ":" << location.line();
+    std::map<std::string, std::string> actual_initial_resource_versions(
+        request.initial_resource_versions().begin(),
+        request.initial_resource_versions().end());
+    EXPECT_EQ(actual_initial_resource_versions, initial_resource_versions)
+        << location.file() << ":" << location.line();
+  }
+
   // Helper function to check the contents of the node message in a
   // request against the client's node info.
   void CheckRequestNode(const DiscoveryRequest& request,
@@ -1697,6 +1826,133 @@ TEST_F(XdsClientTest, StreamClosedByServer) {
   EXPECT_TRUE(stream->Orphaned());
 }
 
+TEST_F(XdsClientTest, DeltaProtocolSendsOnlyChanges) {
+  InitXdsClient(FakeXdsBootstrap::Builder().set_use_delta_protocol(true));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  // XdsClient should have created a delta ADS stream.
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  // XdsClient should have sent a subscription request on the ADS stream.
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo1"}, /*unsubscribe=*/{});
+  EXPECT_EQ(request->node().user_agent_name(), "foo agent");
+  // Send a response.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "v1")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 6);
+  // The ACK carries the nonce but no subscription changes.
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  EXPECT_FALSE(request->has_node());
+  // Start a watch for "foo2".  Only the new name is sent.
+  auto watcher2 = StartFooWatch("foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo2"}, /*unsubscribe=*/{});
+  // The server sends only foo2, which does not affect foo1.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo2", 7), "v1")
+          .Serialize());
+  resource = watcher2->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo2");
+  EXPECT_EQ(resource->value, 7);
+  EXPECT_FALSE(watcher->HasEvent());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  // The server removes foo1.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("C")
+          .AddRemovedResource("foo1")
+          .Serialize());
+  EXPECT_TRUE(watcher->WaitForDoesNotExist(absl::Seconds(1)));
+  EXPECT_FALSE(watcher2->HasEvent());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"C", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  // Cancelling the watch for foo1 sends an unsubscription.
+  CancelFooWatch(watcher.get(), "foo1");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"C", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{"foo1"});
+  CancelFooWatch(watcher2.get(), "foo2");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
+TEST_F(XdsClientTest, DeltaProtocolSendsCachedVersionsOnNewStream) {
+  InitXdsClient(FakeXdsBootstrap::Builder().set_use_delta_protocol(true));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo1"}, /*unsubscribe=*/{});
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "v1")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Now server closes the stream.
+  stream->MaybeSendStatusToClient(absl::OkStatus());
+  EXPECT_TRUE(stream->Orphaned());
+  // The new stream resubscribes and reports the cached version, so the
+  // server need not resend foo1.
+  stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{"foo1"}, /*unsubscribe=*/{},
+                    /*initial_resource_versions=*/{{"foo1", "v1"}});
+  // A resend of the unchanged resource is not reported to the watcher.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo1", 6), "v2")
+          .Serialize());
+  EXPECT_TRUE(watcher->ExpectNoEvent(absl::Seconds(1)));
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*subscribe=*/{}, /*unsubscribe=*/{});
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
 TEST_F(XdsClientTest, StreamClosedByServerWithoutSeeingResponse) {
   InitXdsClient();
   // Start a watch for "foo1".
@@ -1894,6 +2150,84 @@ TEST_F(XdsClientTest, ResourceDoesNotExistUponTimeout) {
   EXPECT_TRUE(stream->Orphaned());
 }
 
+TEST_F(XdsClientTest, ResourceCacheServesWatchersBeforeServerResponds) {
+  const std::string path = WriteResourceCacheFile(
+      {{{std::string(XdsFooResourceType::Get()->type_url()), "foo1"},
+        {"1", XdsFooResource("foo1", 6).AsJsonString()}}});
+  InitXdsClient(FakeXdsBootstrap::Builder().set_resource_cache_path(path));
+  // Start a watch for "foo1".  The watcher sees the cached resource
+  // without waiting for the server.
+  auto watcher = StartFooWatch("foo1");
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 6);
+  // XdsClient still subscribes to the resource.
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"", /*response_nonce=*/"",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // The server sends a newer version, which replaces the cached one.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("2")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 7))
+          .Serialize());
+  resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 7);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"2", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // The cache file is rewritten shortly afterwards.
+  const XdsResourceCache::Entry expected_entry = {
+      "2", XdsFooResource("foo1", 7).AsJsonString()};
+  bool updated = false;
+  absl::Time deadline =
+      absl::Now() + absl::Seconds(5) * grpc_test_slowdown_factor();
+  while (!updated && absl::Now() < deadline) {
+    absl::SleepFor(absl::Milliseconds(100));
+    auto entries = XdsResourceCache::Read(path);
+    updated = entries.ok() && entries->size() == 1 &&
+              entries->begin()->second == expected_entry;
+  }
+  EXPECT_TRUE(updated);
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+  remove(path.c_str());
+}
+
+TEST_F(XdsClientTest, ResourceCacheEntryDoesNotExistUponTimeout) {
+  const std::string path = WriteResourceCacheFile(
+      {{{std::string(XdsFooResourceType::Get()->type_url()), "foo1"},
+        {"1", XdsFooResource("foo1", 6).AsJsonString()}}});
+  InitXdsClient(FakeXdsBootstrap::Builder().set_resource_cache_path(path),
+                Duration::Seconds(1));
+  auto watcher = StartFooWatch("foo1");
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 6);
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // The server never confirms the cached resource, so it may have been
+  // deleted while the client was not running.
+  EXPECT_TRUE(watcher->WaitForDoesNotExist(absl::Seconds(5)));
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+  remove(path.c_str());
+}
+
 TEST_F(XdsClientTest, ResourceDoesNotExistAfterStreamRestart) {
   // Lower resources-does-not-exist timeout so test finishes faster.
   InitXdsClient(FakeXdsBootstrap::Builder(), Duration::Seconds(3));
@@ -2244,6 +2578,62 @@ TEST_F(XdsClientTest, ResourceWrappedInResourceMessage) {
   EXPECT_TRUE(stream->Orphaned());
 }
 
+TEST_F(XdsClientTest, UnwatchedResourcesNotDecodedUntilWatched) {
+  InitXdsClient();
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"", /*response_nonce=*/"",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // The server also sends resources that nobody is watching.  Since they
+  // are in Resource wrappers, XdsClient does not decode them, so the
+  // invalid one is not NACKed.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6),
+                          /*in_resource_wrapper=*/true)
+          .AddFooResource(XdsFooResource("foo2", 7),
+                          /*in_resource_wrapper=*/true)
+          .AddInvalidResource(XdsFooResourceType::Get()->type_url(),
+                              "{\"name\":\"foo3\",\"value\":[]}",
+                              /*resource_wrapper_name=*/"foo3")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"1", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // Starting a watch for "foo2" decodes the resource that was kept, so
+  // the watcher sees it without waiting for the server.
+  auto watcher2 = StartFooWatch("foo2");
+  resource = watcher2->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo2");
+  EXPECT_EQ(resource->value, 7);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"1", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1", "foo2"});
+  // Cancel watches.
+  CancelFooWatch(watcher.get(), "foo1");
+  CancelFooWatch(watcher2.get(), "foo2");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
 TEST_F(XdsClientTest, MultipleResourceTypes) {
   InitXdsClient();
   // Start a watch for "foo1".
@@ -2412,6 +2802,72 @@ TEST_F(XdsClientTest, Federation) {
   EXPECT_TRUE(stream2->Orphaned());
 }
 
+TEST_F(XdsClientTest, FederationAuthorityWithSameServerSharesAdsStream) {
+  ScopedExperimentalEnvVar env_var("GRPC_EXPERIMENTAL_XDS_FEDERATION");
+  constexpr char kAuthority[] = "xds.example.com";
+  const std::string kXdstpResourceName = absl::StrCat(
+      "xdstp://", kAuthority, "/", XdsFooResource::TypeUrl(), "/foo2");
+  // Authority lists its own copy of the top-level xDS server.
+  FakeXdsBootstrap::FakeAuthority authority;
+  authority.set_server(FakeXdsBootstrap::FakeXdsServer());
+  InitXdsClient(
+      FakeXdsBootstrap::Builder().AddAuthority(kAuthority, authority));
+  // Start a watch for the xdstp resource name.
+  auto watcher = StartFooWatch(kXdstpResourceName);
+  // XdsClient should have created an ADS stream to the top-level xDS server.
+  auto stream = WaitForAdsStream(xds_client_->bootstrap().server());
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"", /*response_nonce=*/"",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{kXdstpResourceName});
+  // Start a watch for "foo1", from the top-level server.
+  auto watcher2 = StartFooWatch("foo1");
+  // XdsClient will subscribe to it on the same ADS stream.
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"", /*response_nonce=*/"",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1", kXdstpResourceName});
+  // A single response serves both watchers.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .AddFooResource(XdsFooResource(kXdstpResourceName, 3))
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, kXdstpResourceName);
+  EXPECT_EQ(resource->value, 3);
+  resource = watcher2->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"1", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1", kXdstpResourceName});
+  // Cancel watch for the xdstp resource name.
+  CancelFooWatch(watcher.get(), kXdstpResourceName);
+  // XdsClient should send an unsubscription request.
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"1", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // Now cancel watch for "foo1".
+  CancelFooWatch(watcher2.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
 TEST_F(XdsClientTest, FederationAuthorityDefaultsToTopLevelXdsServer) {
   ScopedExperimentalEnvVar env_var("GRPC_EXPERIMENTAL_XDS_FEDERATION");
   constexpr char kAuthority[] = "xds.example.com";
@@ -0,0 +1,120 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/xds/xds_resource_cache.h"
+
+#include <stdio.h>
+
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+
+#include <grpc/support/alloc.h>
+
+#include "src/core/lib/gpr/tmpfile.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+XdsResourceCache::EntryMap MakeEntries() {
+  XdsResourceCache::EntryMap entries;
+  entries[{"envoy.config.listener.v3.Listener", "server.example.com"}] = {
+      "3", "serialized listener"};
+  entries[{"envoy.config.cluster.v3.Cluster", "cluster_a"}] = {"7", ""};
+  entries[{"envoy.config.cluster.v3.Cluster", "cluster_b"}] = {
+      "7", std::string("\0\1\2", 3)};
+  return entries;
+}
+
+TEST(XdsResourceCacheTest, RoundTrip) {
+  XdsResourceCache::EntryMap entries = MakeEntries();
+  auto parsed = XdsResourceCache::Parse(XdsResourceCache::Serialize(entries));
+  ASSERT_TRUE(parsed.ok()) << parsed.status();
+  EXPECT_EQ(*parsed, entries);
+}
+
+TEST(XdsResourceCacheTest, RoundTripEmpty) {
+  auto parsed = XdsResourceCache::Parse(XdsResourceCache::Serialize({}));
+  ASSERT_TRUE(parsed.ok()) << parsed.status();
+  EXPECT_TRUE(parsed->empty());
+}
+
+TEST(XdsResourceCacheTest, RejectsBadMagic) {
+  std::string contents = XdsResourceCache::Serialize(MakeEntries());
+  contents[0] = 'x';
+  EXPECT_EQ(XdsResourceCache::Parse(contents).status().code(),
+            absl::StatusCode::kInvalidArgument);
+}
+
+TEST(XdsResourceCacheTest, RejectsOtherFormatVersion) {
+  std::string contents = XdsResourceCache::Serialize(MakeEntries());
+  // The format version follows the 8-byte magic string.
+  ++contents[8];
+  auto parsed = XdsResourceCache::Parse(contents);
+  EXPECT_EQ(parsed.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_NE(parsed.status().message().find("format version"),
+            absl::string_view::npos)
+      << parsed.status();
+}
+
+TEST(XdsResourceCacheTest, RejectsTruncatedAndTrailingData) {
+  std::string contents = XdsResourceCache::Serialize(MakeEntries());
+  for (size_t size = 0; size < contents.size(); ++size) {
+    EXPECT_FALSE(XdsResourceCache::Parse(contents.substr(0, size)).ok())
+        << "size " << size;
+  }
+  EXPECT_FALSE(XdsResourceCache::Parse(contents + "x").ok());
+}
+
+TEST(XdsResourceCacheTest, WriteThenRead) {
+  char* name = nullptr;
+  FILE* file = gpr_tmpfile("xds_resource_cache_test", &name);
+  ASSERT_NE(file, nullptr);
+  fclose(file);
+  std::string path = name;
+  gpr_free(name);
+  XdsResourceCache::EntryMap entries = MakeEntries();
+  ASSERT_TRUE(XdsResourceCache::Write(path, entries).ok());
+  auto read = XdsResourceCache::Read(path);
+  ASSERT_TRUE(read.ok()) << read.status();
+  EXPECT_EQ(*read, entries);
+  // Rewriting replaces the previous contents.
+  entries.erase(entries.begin());
+  ASSERT_TRUE(XdsResourceCache::Write(path, entries).ok());
+  read = XdsResourceCache::Read(path);
+  ASSERT_TRUE(read.ok()) << read.status();
+  EXPECT_EQ(*read, entries);
+  remove(path.c_str());
+}
+
+TEST(XdsResourceCacheTest, ReadMissingFile) {
+  EXPECT_FALSE(
+      XdsResourceCache::Read("/nonexistent/xds_resource_cache").ok());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,162 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Benchmark decoding and validating large xDS resources, as the XdsClient
+// does for every update from the control plane.
+
+#include <string>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+#include "upb/def.hpp"
+#include "upb/upb.hpp"
+
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/xds/xds_bootstrap_grpc.h"
+#include "src/core/ext/xds/xds_client.h"
+#include "src/core/ext/xds/xds_endpoint.h"
+#include "src/core/ext/xds/xds_resource_type.h"
+#include "src/core/ext/xds/xds_route_config.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/proto/grpc/testing/xds/v3/address.pb.h"
+#include "src/proto/grpc/testing/xds/v3/base.pb.h"
+#include "src/proto/grpc/testing/xds/v3/endpoint.pb.h"
+#include "src/proto/grpc/testing/xds/v3/route.pb.h"
+#include "test/core/util/test_config.h"
+
+using envoy::config::endpoint::v3::ClusterLoadAssignment;
+using envoy::config::route::v3::RouteConfiguration;
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+const int kEndpointsPerLocality = 100;
+
+TraceFlag xds_resource_decode_benchmark_trace(
+    false, "xds_resource_decode_benchmark");
+
+RefCountedPtr<XdsClient> MakeXdsClient() {
+  auto bootstrap = GrpcXdsBootstrap::Create(
+      "{\n"
+      "  \"xds_servers\": [\n"
+      "    {\n"
+      "      \"server_uri\": \"xds.example.com\",\n"
+      "      \"channel_creds\": [\n"
+      "        {\"type\": \"google_default\"}\n"
+      "      ]\n"
+      "    }\n"
+      "  ]\n"
+      "}");
+  if (!bootstrap.ok()) {
+    Crash(absl::StrFormat("Error parsing bootstrap: %s",
+                          bootstrap.status().ToString().c_str()));
+  }
+  return MakeRefCounted<XdsClient>(std::move(*bootstrap),
+                                   /*transport_factory=*/nullptr,
+                                   /*event_engine=*/nullptr, "foo agent",
+                                   "foo version");
+}
+
+// Decodes \a serialized_resource with \a resource_type once per iteration,
+// each time in a fresh arena, as for a new response.
+void DecodeLoop(benchmark::State& state, const XdsResourceType* resource_type,
+                const std::string& serialized_resource) {
+  auto xds_client = MakeXdsClient();
+  upb::DefPool upb_def_pool;
+  for (auto _ : state) {
+    upb::Arena upb_arena;
+    XdsResourceType::DecodeContext decode_context = {
+        xds_client.get(), xds_client->bootstrap().server(),
+        &xds_resource_decode_benchmark_trace, upb_def_pool.ptr(),
+        upb_arena.ptr()};
+    auto decode_result =
+        resource_type->Decode(decode_context, serialized_resource);
+    GPR_ASSERT(decode_result.resource.ok());
+    benchmark::DoNotOptimize(decode_result);
+  }
+  state.SetBytesProcessed(state.iterations() * serialized_resource.size());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// An EDS resource with range(0) endpoints, kEndpointsPerLocality to a
+// locality.
+void BM_DecodeEndpoints(benchmark::State& state) {
+  ClusterLoadAssignment cla;
+  cla.set_cluster_name("foo");
+  envoy::config::endpoint::v3::LocalityLbEndpoints* locality = nullptr;
+  for (int i = 0; i < state.range(0); ++i) {
+    if (i % kEndpointsPerLocality == 0) {
+      locality = cla.add_endpoints();
+      locality->mutable_load_balancing_weight()->set_value(1);
+      locality->mutable_locality()->set_region("myregion");
+      locality->mutable_locality()->set_zone(
+          absl::StrCat("zone", i / kEndpointsPerLocality));
+    }
+    auto* socket_address = locality->add_lb_endpoints()
+                               ->mutable_endpoint()
+                               ->mutable_address()
+                               ->mutable_socket_address();
+    socket_address->set_address(
+        absl::StrCat("10.0.", i / 256, ".", i % 256));
+    socket_address->set_port_value(443);
+  }
+  DecodeLoop(state, XdsEndpointResourceType::Get(), cla.SerializeAsString());
+}
+BENCHMARK(BM_DecodeEndpoints)->RangeMultiplier(10)->Range(10, 10000);
+
+// An RDS resource with range(0) prefix routes, each to its own cluster.
+void BM_DecodeRouteConfig(benchmark::State& state) {
+  RouteConfiguration route_config;
+  route_config.set_name("foo");
+  auto* vhost = route_config.add_virtual_hosts();
+  vhost->add_domains("*");
+  for (int i = 0; i < state.range(0); ++i) {
+    auto* route = vhost->add_routes();
+    route->mutable_match()->set_prefix(absl::StrCat("/service", i, "/"));
+    route->mutable_route()->set_cluster(absl::StrCat("cluster", i));
+  }
+  DecodeLoop(state, XdsRouteConfigResourceType::Get(),
+             route_config.SerializeAsString());
+}
+BENCHMARK(BM_DecodeRouteConfig)->RangeMultiplier(10)->Range(5, 5000);
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
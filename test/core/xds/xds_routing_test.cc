@@ -0,0 +1,176 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/xds/xds_routing.h"
+
+#include <stddef.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include "src/core/ext/xds/xds_route_config.h"
+#include "src/core/lib/matchers/matchers.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class VirtualHostList : public XdsRouting::VirtualHostListIterator {
+ public:
+  explicit VirtualHostList(std::vector<std::vector<std::string>> domains)
+      : domains_(std::move(domains)) {}
+
+  size_t Size() const override { return domains_.size(); }
+
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return domains_[index];
+  }
+
+ private:
+  std::vector<std::vector<std::string>> domains_;
+};
+
+class RouteList : public XdsRouting::RouteListIterator {
+ public:
+  void AddRoute(StringMatcher::Type type, absl::string_view path,
+                bool case_sensitive = true) {
+    XdsRouteConfigResource::Route::Matchers matchers;
+    matchers.path_matcher =
+        StringMatcher::Create(type, path, case_sensitive).value();
+    matchers_.push_back(std::move(matchers));
+  }
+
+  size_t Size() const override { return matchers_.size(); }
+
+  const XdsRouteConfigResource::Route::Matchers& GetMatchersForRoute(
+      size_t index) const override {
+    return matchers_[index];
+  }
+
+ private:
+  std::vector<XdsRouteConfigResource::Route::Matchers> matchers_;
+};
+
+absl::optional<size_t> FindVirtualHost(const VirtualHostList& vhosts,
+                                       absl::string_view domain) {
+  auto expected = XdsRouting::FindVirtualHostForDomain(vhosts, domain);
+  auto actual = XdsRouting::FindVirtualHostForDomain(
+      XdsRouting::VirtualHostIndex(vhosts), domain);
+  EXPECT_EQ(expected, actual) << domain;
+  return actual;
+}
+
+absl::optional<size_t> GetRoute(const RouteList& routes,
+                                absl::string_view path) {
+  auto expected = XdsRouting::GetRouteForRequest(routes, path, nullptr);
+  auto actual = XdsRouting::GetRouteForRequest(
+      routes, XdsRouting::RouteIndex(routes), path, nullptr);
+  EXPECT_EQ(expected, actual) << path;
+  return actual;
+}
+
+TEST(XdsRoutingTest, VirtualHostMatchOrder) {
+  VirtualHostList vhosts({{"*"},
+                          {"foo.*", "foo.example.*"},
+                          {"*.example.com"},
+                          {"*.com", "bar.example.com"},
+                          {"FOO.example.com"},
+                          {"foo.example.com"}});
+  // Exact match wins, case-insensitively, and the first virtual host
+  // with the pattern wins.
+  EXPECT_EQ(FindVirtualHost(vhosts, "foo.example.com"), 4);
+  EXPECT_EQ(FindVirtualHost(vhosts, "bar.example.com"), 3);
+  // Then the longest suffix match.
+  EXPECT_EQ(FindVirtualHost(vhosts, "baz.example.com"), 2);
+  EXPECT_EQ(FindVirtualHost(vhosts, "baz.test.com"), 3);
+  // Then the longest prefix match.
+  EXPECT_EQ(FindVirtualHost(vhosts, "foo.example.org"), 1);
+  EXPECT_EQ(FindVirtualHost(vhosts, "foo.test.org"), 1);
+  // Then the universe match.
+  EXPECT_EQ(FindVirtualHost(vhosts, "test.org"), 0);
+  // The asterisk must match at least one character.
+  EXPECT_EQ(FindVirtualHost(vhosts, ".example.com"), 3);
+  EXPECT_EQ(FindVirtualHost(vhosts, "foo."), 0);
+}
+
+TEST(XdsRoutingTest, NoVirtualHostMatches) {
+  VirtualHostList vhosts({{"foo.example.com"}, {"*.test.com"}});
+  EXPECT_EQ(FindVirtualHost(vhosts, "bar.example.com"), absl::nullopt);
+  EXPECT_EQ(FindVirtualHost(vhosts, "test.com"), absl::nullopt);
+}
+
+TEST(XdsRoutingTest, FirstMatchingRouteWins) {
+  RouteList routes;
+  routes.AddRoute(StringMatcher::Type::kExact, "/svc.A/Method1");
+  routes.AddRoute(StringMatcher::Type::kPrefix, "/svc.A/");
+  routes.AddRoute(StringMatcher::Type::kExact, "/svc.A/Method2");
+  routes.AddRoute(StringMatcher::Type::kSafeRegex, ".*/Other");
+  routes.AddRoute(StringMatcher::Type::kExact, "/SVC.b/method",
+                  /*case_sensitive=*/false);
+  routes.AddRoute(StringMatcher::Type::kPrefix, "/svc.b/",
+                  /*case_sensitive=*/true);
+  routes.AddRoute(StringMatcher::Type::kPrefix, "");
+  EXPECT_EQ(GetRoute(routes, "/svc.A/Method1"), 0);
+  EXPECT_EQ(GetRoute(routes, "/svc.A/Method2"), 1);
+  EXPECT_EQ(GetRoute(routes, "/svc.A/Other"), 1);
+  EXPECT_EQ(GetRoute(routes, "/svc.C/Other"), 3);
+  EXPECT_EQ(GetRoute(routes, "/svc.B/Method"), 4);
+  EXPECT_EQ(GetRoute(routes, "/svc.b/method2"), 5);
+  // Case-sensitive matchers do not match paths that only differ in case.
+  EXPECT_EQ(GetRoute(routes, "/SVC.a/Method1"), 6);
+  EXPECT_EQ(GetRoute(routes, "/svc.B/Method2"), 6);
+}
+
+TEST(XdsRoutingTest, NoRouteMatches) {
+  RouteList routes;
+  routes.AddRoute(StringMatcher::Type::kExact, "/svc.A/Method1");
+  routes.AddRoute(StringMatcher::Type::kPrefix, "/svc.B/");
+  routes.AddRoute(StringMatcher::Type::kSuffix, "/Method2");
+  EXPECT_EQ(GetRoute(routes, "/svc.A/Method2"), 2);
+  EXPECT_EQ(GetRoute(routes, "/svc.A/Method3"), absl::nullopt);
+  EXPECT_EQ(GetRoute(routes, "/svc.A/Method1/extra"), absl::nullopt);
+  EXPECT_EQ(GetRoute(routes, "/svc."), absl::nullopt);
+}
+
+TEST(XdsRoutingTest, ManyRoutes) {
+  RouteList routes;
+  for (int i = 0; i < 1000; ++i) {
+    routes.AddRoute(StringMatcher::Type::kExact,
+                    "/svc" + std::to_string(i) + "/Method");
+    routes.AddRoute(StringMatcher::Type::kPrefix,
+                    "/svc" + std::to_string(i) + "/");
+  }
+  EXPECT_EQ(GetRoute(routes, "/svc123/Method"), 246);
+  EXPECT_EQ(GetRoute(routes, "/svc123/Other"), 247);
+  EXPECT_EQ(GetRoute(routes, "/svc1000/Method"), absl::nullopt);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
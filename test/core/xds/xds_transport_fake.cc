@@ -223,6 +223,7 @@ FakeXdsTransportFactory::FakeXdsTransport::CreateStreamingCall(
 //
 
 constexpr char FakeXdsTransportFactory::kAdsMethod[];
+constexpr char FakeXdsTransportFactory::kDeltaAdsMethod[];
 constexpr char FakeXdsTransportFactory::kLrsMethod[];
 
 OrphanablePtr<XdsTransportFactory::XdsTransport>
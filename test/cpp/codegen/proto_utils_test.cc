@@ -16,12 +16,16 @@
 //
 //
 
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <grpc/byte_buffer.h>
 #include <grpc/slice.h>
 #include <grpcpp/impl/grpc_library.h>
 #include <grpcpp/impl/proto_utils.h>
+#include <grpcpp/support/proto_buffer_reader.h>
 
 #include "test/core/util/test_config.h"
 
@@ -180,6 +184,38 @@ TEST_F(WriterTest, LargeBlockLargeBackup) {
   BufferWriterTest(4096, 8192, 4095);
 }
 
+#ifdef GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
+
+class ReaderTest : public WriterTest {};
+
+TEST_F(ReaderTest, ReadCordAcrossSlices) {
+  const std::string a(1000, 'a');
+  const std::string b(100, 'b');
+  const std::string c(2000, 'c');
+  std::vector<Slice> slices;
+  slices.emplace_back(a);
+  slices.emplace_back(b);
+  slices.emplace_back(c);
+  ByteBuffer bb(slices.data(), slices.size());
+  ProtoBufferReader reader(&bb);
+  const void* data;
+  int size;
+  ASSERT_TRUE(reader.Next(&data, &size));
+  reader.BackUp(size - 10);
+  absl::Cord cord;
+  ASSERT_TRUE(reader.ReadCord(&cord, 1500));
+  EXPECT_EQ(std::string(cord), (a + b + c).substr(10, 1500));
+  EXPECT_EQ(reader.ByteCount(), 1510);
+  // The rest of the last slice is returned by Next.
+  ASSERT_TRUE(reader.Next(&data, &size));
+  EXPECT_EQ(size, 1590);
+  EXPECT_EQ(reader.ByteCount(), 3100);
+  absl::Cord rest;
+  EXPECT_FALSE(reader.ReadCord(&rest, 1));
+}
+
+#endif  // GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
+
 }  // namespace
 }  // namespace internal
 }  // namespace grpc
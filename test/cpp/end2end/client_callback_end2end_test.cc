@@ -576,6 +576,44 @@ TEST_P(ClientCallbackEnd2endTest, MultipleRpcs) {
   }
 }
 
+TEST_P(ClientCallbackEnd2endTest, UnaryBatch) {
+  ResetStub();
+  constexpr int kNumRpcs = 100;
+  std::vector<EchoRequest> requests(kNumRpcs);
+  std::vector<EchoResponse> responses(kNumRpcs);
+  std::vector<ClientContext> contexts(kNumRpcs);
+  std::mutex mu;
+  std::condition_variable cv;
+  int remaining = kNumRpcs;
+  int cancelled = 0;
+  channel_->StartUnaryBatch([&] {
+    for (int i = 0; i < kNumRpcs; i++) {
+      requests[i].set_message("Hello " + std::to_string(i));
+      // Calls that fail up front must not hold up the rest of the batch.
+      if (i % 10 == 0) contexts[i].TryCancel();
+      stub_->async()->Echo(&contexts[i], &requests[i], &responses[i],
+                           [&, i](Status s) {
+                             if (i % 10 == 0) {
+                               EXPECT_EQ(grpc::StatusCode::CANCELLED,
+                                         s.error_code());
+                             } else {
+                               EXPECT_TRUE(s.ok());
+                               EXPECT_EQ(requests[i].message(),
+                                         responses[i].message());
+                             }
+                             std::lock_guard<std::mutex> l(mu);
+                             if (!s.ok()) ++cancelled;
+                             if (--remaining == 0) cv.notify_one();
+                           });
+    }
+  });
+  std::unique_lock<std::mutex> l(mu);
+  while (remaining > 0) {
+    cv.wait(l);
+  }
+  EXPECT_EQ(kNumRpcs / 10, cancelled);
+}
+
 TEST_P(ClientCallbackEnd2endTest, CancelRpcBeforeStart) {
   ResetStub();
   EchoRequest request;
@@ -1244,6 +1282,67 @@ TEST_P(ClientCallbackEnd2endTest, BidiStreamFirstWriteAsync) {
   }
 }
 
+TEST_P(ClientCallbackEnd2endTest, BidiStreamBackgroundSerialization) {
+  ResetStub();
+  class Client : public grpc::ClientBidiReactor<EchoRequest, EchoResponse> {
+   public:
+    explicit Client(grpc::testing::EchoTestService::Stub* stub) {
+      stub->async()->BidiStream(&context_, this);
+      StartRead(&response_);
+      Write();
+      StartCall();
+    }
+    void OnReadDone(bool ok) override {
+      if (!ok) return;
+      // The writes must reach the server in the order they were started.
+      EXPECT_EQ(response_.message(), Message(reads_complete_));
+      reads_complete_++;
+      StartRead(&response_);
+    }
+    void OnWriteDone(bool ok) override {
+      EXPECT_TRUE(ok);
+      if (writes_started_ < kNumMessages) Write();
+    }
+    void OnDone(const Status& s) override {
+      EXPECT_TRUE(s.ok());
+      EXPECT_EQ(kNumMessages, reads_complete_);
+      std::unique_lock<std::mutex> l(mu_);
+      done_ = true;
+      cv_.notify_one();
+    }
+    void Await() {
+      std::unique_lock<std::mutex> l(mu_);
+      while (!done_) {
+        cv_.wait(l);
+      }
+    }
+
+   private:
+    static constexpr int kNumMessages = 10;
+    static std::string Message(int i) {
+      return std::to_string(i) + std::string(100 * 1024, 'a');
+    }
+    void Write() {
+      request_.set_message(Message(writes_started_++));
+      // OnWriteDone may run, and start the next write, before StartWrite
+      // returns.
+      const bool last = writes_started_ == kNumMessages;
+      StartWrite(&request_, WriteOptions().set_background_serialization());
+      // Half-close while the last message may still be serializing.
+      if (last) StartWritesDone();
+    }
+    EchoRequest request_;
+    EchoResponse response_;
+    ClientContext context_;
+    int writes_started_ = 0;
+    int reads_complete_ = 0;
+    std::mutex mu_;
+    std::condition_variable cv_;
+    bool done_ = false;
+  } test{stub_.get()};
+  test.Await();
+}
+
 TEST_P(ClientCallbackEnd2endTest, BidiStreamCorked) {
   ResetStub();
   BidiClient test(stub_.get(), DO_NOT_CANCEL,
@@ -1366,6 +1465,120 @@ TEST_P(ClientCallbackEnd2endTest, SimultaneousReadAndWritesDone) {
   test.Await();
 }
 
+TEST_P(ClientCallbackEnd2endTest, BidiStreamWriteBatch) {
+  ResetStub();
+  class Client : public grpc::ClientBidiReactor<EchoRequest, EchoResponse> {
+   public:
+    explicit Client(grpc::testing::EchoTestService::Stub* stub) {
+      for (int i = 0; i < kNumMessages; i++) {
+        requests_[i].set_message("Hello batch " + std::to_string(i));
+        request_ptrs_[i] = &requests_[i];
+      }
+      stub->async()->BidiStream(&context_, this);
+      StartWriteBatch(request_ptrs_, kNumMessages);
+      StartRead(&response_);
+      StartCall();
+    }
+    void OnWriteDone(bool ok) override {
+      // Once for the whole batch.
+      EXPECT_TRUE(ok);
+      writes_complete_++;
+      StartWritesDone();
+    }
+    void OnReadDone(bool ok) override {
+      if (!ok) return;
+      EXPECT_EQ(response_.message(), requests_[reads_complete_].message());
+      reads_complete_++;
+      StartRead(&response_);
+    }
+    void OnDone(const Status& s) override {
+      EXPECT_TRUE(s.ok());
+      EXPECT_EQ(writes_complete_, 1);
+      EXPECT_EQ(reads_complete_, kNumMessages);
+      std::unique_lock<std::mutex> l(mu_);
+      done_ = true;
+      cv_.notify_one();
+    }
+    void Await() {
+      std::unique_lock<std::mutex> l(mu_);
+      while (!done_) {
+        cv_.wait(l);
+      }
+    }
+
+   private:
+    static constexpr int kNumMessages = 16;
+    EchoRequest requests_[kNumMessages];
+    const EchoRequest* request_ptrs_[kNumMessages];
+    EchoResponse response_;
+    ClientContext context_;
+    int writes_complete_ = 0;
+    int reads_complete_ = 0;
+    std::mutex mu_;
+    std::condition_variable cv_;
+    bool done_ = false;
+  } test{stub_.get()};
+
+  test.Await();
+}
+
+TEST_P(ClientCallbackEnd2endTest, BidiStreamReportsWritableBytes) {
+  // Only chttp2 publishes its send window.
+  if (GetParam().protocol != Protocol::TCP) {
+    return;
+  }
+
+  ResetStub();
+  class Client : public grpc::ClientBidiReactor<EchoRequest, EchoResponse> {
+   public:
+    explicit Client(grpc::testing::EchoTestService::Stub* stub) {
+      request_.set_message("Hello bidi ");
+      stub->async()->BidiStream(&context_, this);
+      StartWrite(&request_);
+      StartRead(&response_);
+      StartCall();
+    }
+    void OnWritable(size_t bytes) override {
+      // Nothing else is queued once the write has completed, and the message
+      // fits well within the default window.
+      EXPECT_GT(bytes, 0u);
+      writable_reported_ = true;
+    }
+    void OnWriteDone(bool ok) override {
+      EXPECT_TRUE(ok);
+      EXPECT_TRUE(writable_reported_);
+      StartWritesDone();
+    }
+    void OnReadDone(bool ok) override {
+      EXPECT_TRUE(ok);
+      EXPECT_EQ(response_.message(), request_.message());
+    }
+    void OnDone(const Status& s) override {
+      EXPECT_TRUE(s.ok());
+      std::unique_lock<std::mutex> l(mu_);
+      done_ = true;
+      cv_.notify_one();
+    }
+    void Await() {
+      std::unique_lock<std::mutex> l(mu_);
+      while (!done_) {
+        cv_.wait(l);
+      }
+    }
+
+   private:
+    EchoRequest request_;
+    EchoResponse response_;
+    ClientContext context_;
+    bool writable_reported_ = false;
+    std::mutex mu_;
+    std::condition_variable cv_;
+    bool done_ = false;
+  } test{stub_.get()};
+
+  test.Await();
+}
+
 TEST_P(ClientCallbackEnd2endTest, UnimplementedRpc) {
   ChannelArguments args;
   const auto& channel_creds = GetCredentialsProvider()->GetChannelCredentials(
@@ -0,0 +1,149 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <grpc/support/log.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/support/client_coroutine.h>
+
+#include "src/core/lib/gprpp/notification.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/end2end/test_service_impl.h"
+
+// The coroutine API is only available when compiled as C++20.
+#ifdef GRPCPP_CLIENT_COROUTINE_SUPPORTED
+
+namespace grpc {
+namespace testing {
+namespace {
+
+// A coroutine type that runs eagerly, and that nothing awaits.
+struct Task {
+  struct promise_type {
+    Task get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { GPR_ASSERT(false); }
+  };
+};
+
+class ClientCoroutineEnd2endTest : public ::testing::Test {
+ protected:
+  ClientCoroutineEnd2endTest() {
+    ServerBuilder builder;
+    builder.RegisterService(&service_);
+    server_ = builder.BuildAndStart();
+    stub_ = EchoTestService::NewStub(server_->InProcessChannel({}));
+  }
+
+  ~ClientCoroutineEnd2endTest() override { server_->Shutdown(); }
+
+  CallbackTestServiceImpl service_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_F(ClientCoroutineEnd2endTest, UnaryCall) {
+  grpc_core::Notification done;
+  [](EchoTestService::Stub* stub, grpc_core::Notification* done) -> Task {
+    for (int i = 0; i < 10; i++) {
+      ClientContext context;
+      EchoRequest request;
+      EchoResponse response;
+      request.set_message("hello" + std::to_string(i));
+      Status status = co_await experimental::UnaryCallAwaiter(
+          [&](ClientUnaryReactor* reactor) {
+            stub->async()->Echo(&context, &request, &response, reactor);
+          });
+      EXPECT_TRUE(status.ok()) << status.error_message();
+      EXPECT_EQ(response.message(), request.message());
+    }
+    done->Notify();
+  }(stub_.get(), &done);
+  done.WaitForNotification();
+}
+
+TEST_F(ClientCoroutineEnd2endTest, BidiStream) {
+  grpc_core::Notification done;
+  [](EchoTestService::Stub* stub, grpc_core::Notification* done) -> Task {
+    ClientContext context;
+    experimental::ClientBidiStream<EchoRequest, EchoResponse> stream;
+    stub->async()->BidiStream(&context, &stream);
+    stream.StartCall();
+    for (int i = 0; i < 10; i++) {
+      EchoRequest request;
+      EchoResponse response;
+      request.set_message("hello" + std::to_string(i));
+      EXPECT_TRUE(co_await stream.Write(&request));
+      EXPECT_TRUE(co_await stream.Read(&response));
+      EXPECT_EQ(response.message(), request.message());
+    }
+    EXPECT_TRUE(co_await stream.WritesDone());
+    EchoResponse response;
+    EXPECT_FALSE(co_await stream.Read(&response));
+    Status status = co_await stream.Finish();
+    EXPECT_TRUE(status.ok()) << status.error_message();
+    done->Notify();
+  }(stub_.get(), &done);
+  done.WaitForNotification();
+}
+
+TEST_F(ClientCoroutineEnd2endTest, ServerStreaming) {
+  grpc_core::Notification done;
+  [](EchoTestService::Stub* stub, grpc_core::Notification* done) -> Task {
+    ClientContext context;
+    EchoRequest request;
+    request.set_message("hello");
+    experimental::ClientReadStream<EchoResponse> stream;
+    stub->async()->ResponseStream(&context, &request, &stream);
+    stream.StartCall();
+    EchoResponse response;
+    int num_responses = 0;
+    while (co_await stream.Read(&response)) {
+      EXPECT_EQ(response.message(), "hello" + std::to_string(num_responses));
+      ++num_responses;
+    }
+    EXPECT_EQ(num_responses, kServerDefaultResponseStreamsToSend);
+    Status status = co_await stream.Finish();
+    EXPECT_TRUE(status.ok()) << status.error_message();
+    done->Notify();
+  }(stub_.get(), &done);
+  done.WaitForNotification();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+#endif  // GRPCPP_CLIENT_COROUTINE_SUPPORTED
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,6 +16,7 @@
 //
 //
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -710,6 +711,42 @@ class LoggingInterceptorFactory
   }
 };
 
+// Acts only at POST_RECV_STATUS, and checks that it is not run at any other
+// hook point.
+class StatusOnlyInterceptor : public experimental::Interceptor {
+ public:
+  void Intercept(experimental::InterceptorBatchMethods* methods) override {
+    EXPECT_TRUE(methods->QueryInterceptionHookPoint(
+        experimental::InterceptionHookPoints::POST_RECV_STATUS));
+    num_times_run_.fetch_add(1, std::memory_order_relaxed);
+    methods->Proceed();
+  }
+
+  uint32_t InterceptionHookMask() override {
+    return experimental::InterceptionHookBit(
+        experimental::InterceptionHookPoints::POST_RECV_STATUS);
+  }
+
+  static void Reset() { num_times_run_.store(0, std::memory_order_relaxed); }
+  static int GetNumTimesRun() {
+    return num_times_run_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static std::atomic<int> num_times_run_;
+};
+
+std::atomic<int> StatusOnlyInterceptor::num_times_run_;
+
+class StatusOnlyInterceptorFactory
+    : public experimental::ClientInterceptorFactoryInterface {
+ public:
+  experimental::Interceptor* CreateClientInterceptor(
+      experimental::ClientRpcInfo* /*info*/) override {
+    return new StatusOnlyInterceptor();
+  }
+};
+
 class TestScenario {
  public:
   explicit TestScenario(const ChannelType& channel_type,
@@ -906,6 +943,24 @@ TEST_F(ClientInterceptorsEnd2endTest, ClientInterceptorHijackingTest) {
   EXPECT_EQ(PhonyInterceptor::GetNumTimesRun(), 20);
 }
 
+TEST_F(ClientInterceptorsEnd2endTest, ClientInterceptorHookMaskTest) {
+  ChannelArguments args;
+  PhonyInterceptor::Reset();
+  StatusOnlyInterceptor::Reset();
+  std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+      creators;
+  creators.push_back(std::make_unique<StatusOnlyInterceptorFactory>());
+  creators.push_back(std::make_unique<LoggingInterceptorFactory>());
+  creators.push_back(std::make_unique<StatusOnlyInterceptorFactory>());
+  creators.push_back(std::make_unique<PhonyInterceptorFactory>());
+  auto channel = experimental::CreateCustomChannelWithInterceptors(
+      server_address_, InsecureChannelCredentials(), args, std::move(creators));
+  MakeCall(channel);
+  LoggingInterceptor::VerifyUnaryCall();
+  EXPECT_EQ(StatusOnlyInterceptor::GetNumTimesRun(), 2);
+  EXPECT_EQ(PhonyInterceptor::GetNumTimesRun(), 1);
+}
+
 TEST_F(ClientInterceptorsEnd2endTest, ClientInterceptorLogThenHijackTest) {
   ChannelArguments args;
   std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
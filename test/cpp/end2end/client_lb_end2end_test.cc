@@ -1504,6 +1504,38 @@ TEST_F(RoundRobinTest, Basic) {
   EXPECT_EQ("round_robin", channel->GetLoadBalancingPolicyName());
 }
 
+TEST_F(RoundRobinTest, WaitForWarm) {
+  const int kNumServers = 3;
+  StartServers(kNumServers);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("round_robin", response_generator);
+  response_generator.SetNextResolution(GetServersPorts());
+  // Every backend is connected before the first RPC, so the first RPCs are
+  // spread over all of them.
+  EXPECT_TRUE(channel->WaitForWarm(grpc_timeout_seconds_to_deadline(5), 1.0));
+  EXPECT_EQ(channel->GetState(false), GRPC_CHANNEL_READY);
+  auto stub = BuildStub(channel);
+  for (int i = 0; i < kNumServers; ++i) {
+    CheckRpcSendOk(DEBUG_LOCATION, stub);
+  }
+  for (int i = 0; i < kNumServers; ++i) {
+    EXPECT_EQ(1, servers_[i]->service_.request_count()) << "server " << i;
+  }
+}
+
+TEST_F(RoundRobinTest, WaitForWarmTimesOut) {
+  // One of two backends is down, so the channel never gets to all READY.
+  StartServers(1);
+  std::vector<int> ports = GetServersPorts();
+  ports.push_back(grpc_pick_unused_port_or_die());
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("round_robin", response_generator);
+  response_generator.SetNextResolution(ports);
+  EXPECT_FALSE(
+      channel->WaitForWarm(grpc_timeout_milliseconds_to_deadline(500), 1.0));
+  EXPECT_TRUE(channel->WaitForWarm(grpc_timeout_seconds_to_deadline(5), 0.5));
+}
+
 TEST_F(RoundRobinTest, ProcessPending) {
   StartServers(1);  // Single server
   auto response_generator = BuildResolverResponseGenerator();
@@ -352,6 +352,37 @@ TEST_P(ArenaAllocatorTest, SimpleRpc) {
   EXPECT_EQ(kRpcCount, allocator->allocation_count);
 }
 
+TEST_P(ArenaAllocatorTest, ClientSideMessages) {
+  const int kRpcCount = 10;
+  ArenaAllocator allocator;
+  CreateServer(nullptr);
+  ResetStub();
+  for (int i = 0; i < kRpcCount; i++) {
+    MessageHolder<EchoRequest, EchoResponse>* messages =
+        allocator.AllocateMessages();
+    messages->request()->set_message("hello");
+    ClientContext cli_ctx;
+    std::mutex mu;
+    std::condition_variable cv;
+    bool done = false;
+    // The messages are released once the callback returns.
+    stub_->async()->Echo(
+        &cli_ctx, messages, [messages, &done, &mu, &cv](Status s) {
+          EXPECT_TRUE(s.ok());
+          EXPECT_EQ("hello", messages->response()->message());
+          EXPECT_NE(nullptr, messages->response()->GetArena());
+          std::lock_guard<std::mutex> l(mu);
+          done = true;
+          cv.notify_one();
+        });
+    std::unique_lock<std::mutex> l(mu);
+    while (!done) {
+      cv.wait(l);
+    }
+  }
+  EXPECT_EQ(kRpcCount, allocator.allocation_count);
+}
+
 std::vector<TestScenario> CreateTestScenarios(bool test_insecure) {
   std::vector<TestScenario> scenarios;
   std::vector<std::string> credentials_types{
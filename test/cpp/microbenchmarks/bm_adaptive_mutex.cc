@@ -0,0 +1,58 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/lib/gprpp/adaptive_mutex.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using grpc_core::AdaptiveMutex;
+using grpc_core::Mutex;
+
+// A critical section about as long as a hash set insert.
+template <typename MutexType>
+void BM_ShortCriticalSection(benchmark::State& state) {
+  static MutexType mu;
+  static uint64_t counter[8];
+  for (auto _ : state) {
+    mu.Lock();
+    for (uint64_t& c : counter) benchmark::DoNotOptimize(++c);
+    mu.Unlock();
+  }
+}
+BENCHMARK_TEMPLATE(BM_ShortCriticalSection, Mutex)->ThreadRange(1, 16);
+BENCHMARK_TEMPLATE(BM_ShortCriticalSection, AdaptiveMutex)->ThreadRange(1, 16);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -19,6 +19,7 @@
 // This benchmark exists to show that byte-buffer copy is size-independent
 
 #include <memory>
+#include <utility>
 
 #include <benchmark/benchmark.h>
 
@@ -28,6 +29,8 @@
 #include <grpcpp/impl/grpc_library.h>
 #include <grpcpp/support/byte_buffer.h>
 
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "test/core/util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
@@ -108,6 +111,24 @@ static void BM_ByteBufferReader_Peek(benchmark::State& state) {
 }
 BENCHMARK(BM_ByteBufferReader_Peek)->Ranges({{64 * 1024, 1024 * 1024}});
 
+// Messages are moved between the call, filters and transport as SliceBuffers,
+// nearly always holding one or two slices.
+static void BM_SliceBuffer_Move(benchmark::State& state) {
+  const int num_slices = state.range(0);
+  grpc_core::SliceBuffer a;
+  for (int i = 0; i < num_slices; ++i) {
+    a.AppendIndexed(grpc_core::Slice::FromCopiedString("hello world"));
+  }
+  grpc_core::SliceBuffer b;
+  for (auto _ : state) {
+    b = std::move(a);
+    grpc_core::SliceBuffer c(std::move(b));
+    a = std::move(c);
+    benchmark::DoNotOptimize(a.Count());
+  }
+}
+BENCHMARK(BM_SliceBuffer_Move)->Arg(1)->Arg(2)->Arg(8)->Arg(64);
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -20,6 +20,7 @@
 #include <benchmark/benchmark.h>
 
 #include "absl/container/btree_map.h"
+#include "absl/strings/str_cat.h"
 
 #include <grpcpp/support/channel_arguments.h>
 
@@ -38,6 +39,21 @@ void BM_ChannelArgs(benchmark::State& state) {
 }
 BENCHMARK(BM_ChannelArgs);
 
+void BM_ChannelArgsDerivedFromSameBase(benchmark::State& state) {
+  grpc_core::ChannelArgs base;
+  for (int i = 0; i < 20; i++) {
+    base = base.Set(absl::StrCat(kKey, i), kValue);
+  }
+  // As when every subchannel of a channel adds the same arg on top of the
+  // channel's args.
+  grpc_core::ChannelArgs arg1 = base.Set(absl::StrCat(kKey, 0), kValue);
+  grpc_core::ChannelArgs arg2 = base.Set(absl::StrCat(kKey, 0), kValue);
+  for (auto s : state) {
+    benchmark::DoNotOptimize(arg1 < arg2);
+  }
+}
+BENCHMARK(BM_ChannelArgsDerivedFromSameBase);
+
 void BM_grpc_channel_args(benchmark::State& state) {
   grpc_channel_args arg1, arg2;
   grpc::ChannelArguments xargs;
@@ -0,0 +1,160 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark chaotic-good framing
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/status.h>
+
+#include "src/core/ext/transport/chaotic_good/frame.h"
+#include "src/core/ext/transport/chaotic_good/frame_header.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "test/core/promise/test_context.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+const FrameHeader kHeader = {FrameType::kFragment, BitSet<3>::FromInt(7), 1,
+                             120, 1024, 20};
+
+void BM_FrameHeaderSerialize(benchmark::State& state) {
+  uint8_t data[64];
+  for (auto _ : state) {
+    kHeader.Serialize(data);
+    benchmark::DoNotOptimize(data);
+  }
+}
+BENCHMARK(BM_FrameHeaderSerialize);
+
+void BM_FrameHeaderParse(benchmark::State& state) {
+  uint8_t data[64];
+  kHeader.Serialize(data);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(FrameHeader::Parse(data));
+  }
+}
+BENCHMARK(BM_FrameHeaderParse);
+
+class FrameFixture {
+ public:
+  explicit FrameFixture(size_t message_size) {
+    client_frame_.stream_id = 1;
+    client_frame_.headers = arena_->MakePooled<ClientMetadata>(arena_.get());
+    client_frame_.headers->Set(HttpPathMetadata(),
+                               Slice::FromStaticString("/demo.Service/Call"));
+    client_frame_.headers->Set(HttpAuthorityMetadata(),
+                               Slice::FromStaticString("demo.example.com"));
+    client_frame_.message = MakeMessage(message_size);
+    client_frame_.end_of_stream = true;
+    server_frame_.stream_id = 1;
+    server_frame_.headers = arena_->MakePooled<ServerMetadata>(arena_.get());
+    server_frame_.message = MakeMessage(message_size);
+    server_frame_.trailers = arena_->MakePooled<ServerMetadata>(arena_.get());
+    server_frame_.trailers->Set(GrpcStatusMetadata(), GRPC_STATUS_OK);
+  }
+
+  Arena* arena() { return arena_.get(); }
+  const ClientFragmentFrame& client_frame() const { return client_frame_; }
+  const ServerFragmentFrame& server_frame() const { return server_frame_; }
+
+ private:
+  MessageHandle MakeMessage(size_t size) {
+    SliceBuffer payload;
+    payload.Append(Slice::FromCopiedString(std::string(size, 'a')));
+    return arena_->MakePooled<Message>(std::move(payload), 0);
+  }
+
+  MemoryAllocator memory_allocator_ = MemoryAllocator(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("bm"));
+  ScopedArenaPtr arena_ = MakeScopedArena(1024, &memory_allocator_);
+  ClientFragmentFrame client_frame_;
+  ServerFragmentFrame server_frame_;
+};
+
+// With state.range(1) set, one compressor encodes every frame, as on a
+// connection; otherwise each frame starts from an empty HPACK table.
+void BM_ClientFragmentSerialize(benchmark::State& state) {
+  FrameFixture fixture(state.range(0));
+  auto connection_compressor = std::make_unique<HPackCompressor>();
+  for (auto _ : state) {
+    if (state.range(1) == 0) {
+      connection_compressor = std::make_unique<HPackCompressor>();
+    }
+    benchmark::DoNotOptimize(
+        fixture.client_frame().Serialize(connection_compressor.get()));
+  }
+}
+BENCHMARK(BM_ClientFragmentSerialize)
+    ->ArgsProduct({{0, 1024, 64 * 1024}, {0, 1}});
+
+// Serializes and parses back a server frame with headers, a message and an
+// OK status, with one compressor and parser as on a connection.
+void BM_ServerFragmentRoundTrip(benchmark::State& state) {
+  FrameFixture fixture(state.range(0));
+  TestContext<Arena> arena_ctx(fixture.arena());
+  HPackCompressor compressor;
+  HPackParser parser;
+  for (auto _ : state) {
+    BufferPair buffers = fixture.server_frame().Serialize(&compressor);
+    uint8_t header_bytes[64];
+    buffers.control.MoveFirstNBytesIntoBuffer(64, header_bytes);
+    auto header = FrameHeader::Parse(header_bytes);
+    ServerFragmentFrame frame;
+    auto status = frame.Deserialize(&parser, *header, buffers);
+    if (!status.ok()) {
+      state.SkipWithError(status.ToString().c_str());
+      break;
+    }
+    benchmark::DoNotOptimize(frame);
+  }
+}
+BENCHMARK(BM_ServerFragmentRoundTrip)->Arg(0)->Arg(1024)->Arg(64 * 1024);
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
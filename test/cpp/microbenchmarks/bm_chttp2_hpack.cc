@@ -22,6 +22,9 @@
 
 #include <memory>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -34,6 +37,7 @@
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/percent_encoding.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/lib/transport/metadata_batch.h"
@@ -302,6 +306,8 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<31, false>)
     ->Args({0, 16384});
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<100, false>)
     ->Args({0, 16384});
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<1000, false>)
+    ->Args({0, 16384});
 // test with a tiny frame size, to highlight continuation costs
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleNonBinaryElem)
     ->Args({0, 1});
@@ -598,6 +604,42 @@ class NonIndexedBinaryElem<100, false> {
   }
 };
 
+// Many literal headers without indexing, so that every one of them has its
+// key looked up: known keys of all lengths, interleaved with unknown ones.
+class ManyNonIndexedElems {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() { return {}; }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    static const std::pair<const char*, const char*> kHeaders[] = {
+        {"content-type", "application/grpc"},
+        {"x-request-id", "1"},
+        {"user-agent", "bm"},
+        {"x-trace-flags", "1"},
+        {"grpc-encoding", "identity"},
+        {"x-tenant", "1"},
+        {"grpc-message", "ok"},
+        {"x-custom-field", "1"},
+        {"grpc-accept-encoding", "identity"},
+        {"lb-token", "1"},
+        {"x-user", "1"},
+        {"grpc-previous-rpc-attempts", "1"},
+        {"te", "trailers"},
+        {"x-region", "1"},
+        {"host", "localhost"},
+        {"x-client-info", "1"}};
+    std::vector<uint8_t> bytes;
+    for (const auto& header : kHeaders) {
+      bytes.push_back(0x00);
+      for (const char* s : {header.first, header.second}) {
+        const size_t length = strlen(s);
+        bytes.push_back(static_cast<uint8_t>(length));
+        bytes.insert(bytes.end(), s, s + length);
+      }
+    }
+    return {MakeSlice(bytes)};
+  }
+};
+
 using RepresentativeClientInitialMetadata = FromEncoderFixture<
     hpack_encoder_fixtures::RepresentativeClientInitialMetadata>;
 using RepresentativeServerInitialMetadata = FromEncoderFixture<
@@ -639,6 +681,7 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<3, true>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<10, true>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<31, true>);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, NonIndexedBinaryElem<100, true>);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, ManyNonIndexedElems);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeClientInitialMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
@@ -657,6 +700,49 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline);
 
 }  // namespace hpack_parser_fixtures
 
+////////////////////////////////////////////////////////////////////////////////
+// grpc-message percent encoding
+//
+
+// A status message of state.range(0) bytes. If state.range(1) is set, the
+// message has a single byte to escape close to its end.
+static std::string MakeStatusMessage(benchmark::State& state) {
+  std::string message;
+  while (message.size() < static_cast<size_t>(state.range(0))) {
+    message += "deadline exceeded while waiting for the backend ";
+  }
+  message.resize(state.range(0));
+  if (state.range(1) != 0) message[message.size() - 10] = '\n';
+  return message;
+}
+
+static void BM_PercentEncodeStatusMessage(benchmark::State& state) {
+  grpc_core::Slice message =
+      grpc_core::Slice::FromCopiedString(MakeStatusMessage(state));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grpc_core::PercentEncodeSlice(
+        message.Ref(), grpc_core::PercentEncodingType::Compatible));
+  }
+}
+BENCHMARK(BM_PercentEncodeStatusMessage)
+    ->Args({64, 0})
+    ->Args({1024, 0})
+    ->Args({1024, 1});
+
+static void BM_PercentDecodeStatusMessage(benchmark::State& state) {
+  grpc_core::Slice message = grpc_core::PercentEncodeSlice(
+      grpc_core::Slice::FromCopiedString(MakeStatusMessage(state)),
+      grpc_core::PercentEncodingType::Compatible);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        grpc_core::PermissivePercentDecodeSlice(message.Ref()));
+  }
+}
+BENCHMARK(BM_PercentDecodeStatusMessage)
+    ->Args({64, 0})
+    ->Args({1024, 0})
+    ->Args({1024, 1});
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
@@ -33,6 +33,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/chttp2/transport/stream_map.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/resource_quota/api.h"
@@ -409,6 +410,32 @@ static void BM_TransportEmptyOp(benchmark::State& state) {
 }
 BENCHMARK(BM_TransportEmptyOp);
 
+// Keeps state.range(0) streams open, and for each new stream looks up every
+// open stream once (as frames arrive for them) before closing the oldest.
+static void BM_StreamMapChurn(benchmark::State& state) {
+  const uint32_t concurrent = static_cast<uint32_t>(state.range(0));
+  grpc_chttp2_stream_map map;
+  grpc_chttp2_stream_map_init(&map, 8);
+  uint32_t next_id = 1;
+  for (uint32_t i = 0; i < concurrent; i++, next_id += 2) {
+    grpc_chttp2_stream_map_add(&map, next_id, &map);
+  }
+  uint32_t frame = 0;
+  for (auto _ : state) {
+    const uint32_t oldest = next_id - 2 * concurrent;
+    benchmark::DoNotOptimize(grpc_chttp2_stream_map_find(
+        &map, oldest + 2 * (frame++ % concurrent)));
+    if (frame % concurrent == 0) {
+      grpc_chttp2_stream_map_delete(&map, oldest);
+      grpc_chttp2_stream_map_add(&map, next_id, &map);
+      next_id += 2;
+    }
+  }
+  grpc_chttp2_stream_map_destroy(&map);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StreamMapChurn)->Range(1, 10000);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
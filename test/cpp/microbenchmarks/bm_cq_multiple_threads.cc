@@ -115,13 +115,18 @@ static grpc_event_engine_vtable make_engine_vtable(const char* name) {
   return vtable;
 }
 
-static void setup() {
+static void setup(grpc_cq_polling_type polling_type) {
   grpc_init();
   GPR_ASSERT(strcmp(grpc_get_poll_strategy_name(), "none") == 0 ||
              strcmp(grpc_get_poll_strategy_name(), "bm_cq_multiple_threads") ==
                  0);
 
-  g_cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_completion_queue_attributes attr;
+  attr.version = 1;
+  attr.cq_completion_type = GRPC_CQ_NEXT;
+  attr.cq_polling_type = polling_type;
+  g_cq = grpc_completion_queue_create(
+      grpc_completion_queue_factory_lookup(&attr), &attr, nullptr);
 }
 
 static void teardown() {
@@ -158,14 +163,13 @@ static void teardown() {
 // by grpc, and its Finish call must take place before grpc_shutdown so that it
 // can use grpc_stats).
 //
-static void BM_Cq_Throughput(benchmark::State& state) {
+static void StartThread(benchmark::State& state,
+                        grpc_cq_polling_type polling_type) {
   gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
-  auto thd_idx = state.thread_index();
-
   gpr_mu_lock(&g_mu);
   g_threads_active++;
-  if (thd_idx == 0) {
-    setup();
+  if (state.thread_index() == 0) {
+    setup(polling_type);
     g_active = true;
     gpr_cv_broadcast(&g_cv);
   } else {
@@ -174,12 +178,10 @@ static void BM_Cq_Throughput(benchmark::State& state) {
     }
   }
   gpr_mu_unlock(&g_mu);
+}
 
-  for (auto _ : state) {
-    GPR_ASSERT(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
-               GRPC_OP_COMPLETE);
-  }
-
+static void FinishThread(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
   state.SetItemsProcessed(state.iterations());
 
   gpr_mu_lock(&g_mu);
@@ -193,14 +195,50 @@ static void BM_Cq_Throughput(benchmark::State& state) {
   }
   gpr_mu_unlock(&g_mu);
 
-  if (thd_idx == 0) {
+  if (state.thread_index() == 0) {
     teardown();
     g_active = false;
   }
 }
 
+static void BM_Cq_Throughput(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  StartThread(state, GRPC_CQ_DEFAULT_POLLING);
+  for (auto _ : state) {
+    GPR_ASSERT(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
+               GRPC_OP_COMPLETE);
+  }
+  FinishThread(state);
+}
+
 BENCHMARK(BM_Cq_Throughput)->ThreadRange(1, 16)->UseRealTime();
 
+// Every thread queues a completion and then takes one from the completion
+// queue, so that completions are queued from all threads at once. Only run
+// for the non polling completion queue types (passed as the argument), whose
+// pollers do not generate completions of their own.
+static void BM_Cq_EndOpThroughput(benchmark::State& state) {
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  StartThread(state, static_cast<grpc_cq_polling_type>(state.range(0)));
+  void* tag = reinterpret_cast<void*>(10);  // Some random number
+  for (auto _ : state) {
+    grpc_core::ExecCtx exec_ctx;
+    GPR_ASSERT(grpc_cq_begin_op(g_cq, tag));
+    grpc_cq_end_op(g_cq, tag, absl::OkStatus(), cq_done_cb, nullptr,
+                   static_cast<grpc_cq_completion*>(
+                       gpr_malloc(sizeof(grpc_cq_completion))));
+    GPR_ASSERT(grpc_completion_queue_next(g_cq, deadline, nullptr).type ==
+               GRPC_OP_COMPLETE);
+  }
+  FinishThread(state);
+}
+
+BENCHMARK(BM_Cq_EndOpThroughput)
+    ->Arg(GRPC_CQ_NON_POLLING)
+    ->Arg(GRPC_CQ_NON_POLLING_LOCK_FREE)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
 namespace {
 const grpc_event_engine_vtable g_none_vtable =
     grpc::testing::make_engine_vtable("none");
@@ -85,6 +85,31 @@ BENCHMARK(BM_ExecCtx_RunCounted)
     ->Range(100, 10000)
     ->MeasureProcessCPUTime()
     ->UseRealTime();
+
+// Entering core, as a surface API call or an EventEngine callback does.
+template <typename EntryExecCtx>
+void EnterCore(benchmark::State& state) {
+  for (auto _ : state) {
+    grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+    EntryExecCtx exec_ctx;
+    benchmark::DoNotOptimize(grpc_core::ExecCtx::Get());
+  }
+}
+
+// Arg 1 enters with an ExecCtx already active on the thread.
+template <typename EntryExecCtx>
+void BM_ExecCtx_Enter(benchmark::State& state) {
+  if (state.range(0) != 0) {
+    grpc_core::ExecCtx exec_ctx;
+    EnterCore<EntryExecCtx>(state);
+  } else {
+    EnterCore<EntryExecCtx>(state);
+  }
+}
+BENCHMARK_TEMPLATE(BM_ExecCtx_Enter, grpc_core::ExecCtx)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ExecCtx_Enter, grpc_core::PassThroughExecCtx)
+    ->Arg(0)
+    ->Arg(1);
 }  // namespace
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
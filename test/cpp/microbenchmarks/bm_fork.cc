@@ -0,0 +1,92 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark the latency of fork() with the fork handlers, as seen by the
+// parent, with channels open.
+
+#include <errno.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/event_engine/forkable.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+pid_t ForkWithHandlers() {
+#ifdef GRPC_POSIX_FORK_ALLOW_PTHREAD_ATFORK
+  return fork();
+#else
+  grpc_event_engine::experimental::PrepareFork();
+  pid_t pid = fork();
+  if (pid == 0) {
+    grpc_event_engine::experimental::PostforkChild();
+  } else {
+    grpc_event_engine::experimental::PostforkParent();
+  }
+  return pid;
+#endif
+}
+
+void BM_Fork(benchmark::State& state) {
+  grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+  std::vector<grpc_channel*> channels;
+  for (int i = 0; i < state.range(0); i++) {
+    channels.push_back(grpc_channel_create("localhost:1234", creds, nullptr));
+  }
+  grpc_channel_credentials_release(creds);
+  for (auto _ : state) {
+    pid_t pid = ForkWithHandlers();
+    GPR_ASSERT(pid >= 0);
+    if (pid == 0) _exit(0);
+    // The child's exit is not part of the fork latency.
+    state.PauseTiming();
+    int status;
+    while (waitpid(pid, &status, 0) == -1) GPR_ASSERT(errno == EINTR);
+    state.ResumeTiming();
+  }
+  for (grpc_channel* channel : channels) grpc_channel_destroy(channel);
+}
+BENCHMARK(BM_Fork)->Range(0, 512)->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
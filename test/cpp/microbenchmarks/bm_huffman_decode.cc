@@ -23,7 +23,7 @@
 #include "src/core/lib/slice/slice.h"
 #include "test/core/util/test_config.h"
 
-const std::vector<uint8_t>* Input() {
+const std::vector<uint8_t>* RawInput() {
   static const grpc_core::NoDestruct<std::vector<uint8_t>> v([]() {
     std::vector<uint8_t> v;
     std::mt19937 rd(0);
@@ -37,7 +37,14 @@ const std::vector<uint8_t>* Input() {
         v.push_back(dist_normal(rd));
       }
     }
-    grpc_core::Slice s = grpc_core::Slice::FromCopiedBuffer(v);
+    return v;
+  }());
+  return v.get();
+}
+
+const std::vector<uint8_t>* Input() {
+  static const grpc_core::NoDestruct<std::vector<uint8_t>> v([]() {
+    grpc_core::Slice s = grpc_core::Slice::FromCopiedBuffer(*RawInput());
     grpc_core::Slice c(grpc_chttp2_huffman_compress(s.c_slice()));
     return std::vector<uint8_t>(c.begin(), c.end());
   }());
@@ -56,6 +63,25 @@ static void BM_Decode(benchmark::State& state) {
 }
 BENCHMARK(BM_Decode);
 
+static void BM_Encode(benchmark::State& state) {
+  grpc_core::Slice input = grpc_core::Slice::FromCopiedBuffer(*RawInput());
+  for (auto _ : state) {
+    grpc_core::Slice c(grpc_chttp2_huffman_compress(input.c_slice()));
+    benchmark::DoNotOptimize(c.data());
+  }
+}
+BENCHMARK(BM_Encode);
+
+static void BM_Base64EncodeAndHuffmanCompress(benchmark::State& state) {
+  grpc_core::Slice input = grpc_core::Slice::FromCopiedBuffer(*RawInput());
+  for (auto _ : state) {
+    grpc_core::Slice c(
+        grpc_chttp2_base64_encode_and_huffman_compress(input.c_slice()));
+    benchmark::DoNotOptimize(c.data());
+  }
+}
+BENCHMARK(BM_Base64EncodeAndHuffmanCompress);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
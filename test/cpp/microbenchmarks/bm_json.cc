@@ -0,0 +1,98 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Benchmark parsing of large service configs.
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/json/json.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// A service config with one method config per service, each with a retry
+// policy, as a control plane would generate for many services.  Pretty
+// printed, like configs read from files usually are.
+std::string MakeServiceConfig(int num_services) {
+  std::vector<std::string> method_configs;
+  for (int i = 0; i < num_services; ++i) {
+    method_configs.push_back(absl::StrCat(
+        "    {\n"
+        "      \"name\": [\n"
+        "        { \"service\": \"com.example.package",
+        i,
+        ".ExampleService\" },\n"
+        "        { \"service\": \"com.example.package",
+        i,
+        ".OtherService\", \"method\": \"Method\" }\n"
+        "      ],\n"
+        "      \"timeout\": \"1.500s\",\n"
+        "      \"waitForReady\": true,\n"
+        "      \"maxRequestMessageBytes\": 4194304,\n"
+        "      \"retryPolicy\": {\n"
+        "        \"maxAttempts\": 3,\n"
+        "        \"initialBackoff\": \"0.1s\",\n"
+        "        \"maxBackoff\": \"10s\",\n"
+        "        \"backoffMultiplier\": 1.5,\n"
+        "        \"retryableStatusCodes\": [ \"UNAVAILABLE\", "
+        "\"RESOURCE_EXHAUSTED\" ]\n"
+        "      }\n"
+        "    }"));
+  }
+  return absl::StrCat(
+      "{\n"
+      "  \"loadBalancingConfig\": [ { \"round_robin\": {} } ],\n"
+      "  \"methodConfig\": [\n",
+      absl::StrJoin(method_configs, ",\n"),
+      "\n  ]\n"
+      "}\n");
+}
+
+void BM_ParseServiceConfig(benchmark::State& state) {
+  const std::string json = MakeServiceConfig(state.range(0));
+  for (auto _ : state) {
+    auto parsed = Json::Parse(json);
+    GPR_ASSERT(parsed.ok());
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_ParseServiceConfig)->Arg(1)->Arg(100)->Arg(5000);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,72 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/lib/gprpp/mpscq.h"
+#include "src/core/lib/gprpp/sharded_mpscq.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using grpc_core::MultiProducerSingleConsumerQueue;
+using grpc_core::ShardedMultiProducerSingleConsumerQueue;
+
+struct Item : public MultiProducerSingleConsumerQueue::Node {};
+
+// Every thread pushes, as threads requesting calls do onto the server's
+// queues, and thread 0 also pops.  What is left is drained once all the
+// threads have stopped pushing.
+template <typename Queue>
+void BM_FanIn(benchmark::State& state) {
+  static Queue queue;
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    queue.Push(new Item());
+    if (state.thread_index() == 0) {
+      delete static_cast<Item*>(queue.Pop());
+    }
+  }
+  if (state.thread_index() == 0) {
+    bool empty = false;
+    while (!empty) {
+      delete static_cast<Item*>(queue.PopAndCheckEnd(&empty));
+    }
+  }
+}
+BENCHMARK_TEMPLATE(BM_FanIn, MultiProducerSingleConsumerQueue)
+    ->ThreadRange(1, 16);
+BENCHMARK_TEMPLATE(BM_FanIn, ShardedMultiProducerSingleConsumerQueue)
+    ->ThreadRange(1, 16);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,162 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark parties
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/event_engine/memory_allocator.h>
+
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/party.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+class AllocatorOwner {
+ protected:
+  MemoryAllocator memory_allocator_ = MemoryAllocator(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("test"));
+};
+
+class BenchParty final : public AllocatorOwner, public Party {
+ public:
+  BenchParty() : Party(Arena::Create(1024, &memory_allocator_)) {}
+  std::string DebugTag() const override { return "BenchParty"; }
+};
+
+// A participant that stays pending, and hands out an owning waker for itself
+// every time it is polled.
+class WakeupSlot {
+ public:
+  void Spawn(Party* party) {
+    party->Spawn(
+        [this]() -> Poll<int> {
+          polls_.fetch_add(1, std::memory_order_relaxed);
+          if (done_.load(std::memory_order_relaxed)) return 0;
+          delete waker_.exchange(
+              new Waker(Activity::current()->MakeOwningWaker()),
+              std::memory_order_acq_rel);
+          return Pending{};
+        },
+        [](int) {});
+  }
+
+  // Wakes the participant if it handed out a waker since the last call.
+  // Returns false otherwise.
+  bool TryWakeup() {
+    Waker* waker = waker_.exchange(nullptr, std::memory_order_acq_rel);
+    if (waker == nullptr) return false;
+    waker->Wakeup();
+    delete waker;
+    return true;
+  }
+
+  // Drops the waker still held, if any.
+  void Finish() {
+    done_.store(true, std::memory_order_relaxed);
+    while (!TryWakeup()) {
+    }
+  }
+
+  uint64_t polls() const { return polls_.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<Waker*> waker_{nullptr};
+  std::atomic<bool> done_{false};
+  std::atomic<uint64_t> polls_{0};
+};
+
+void BM_PartyCreate(benchmark::State& state) {
+  for (auto _ : state) {
+    MakeOrphanable<BenchParty>();
+  }
+}
+BENCHMARK(BM_PartyCreate);
+
+void BM_PartySpawn(benchmark::State& state) {
+  auto party = MakeOrphanable<BenchParty>();
+  for (auto _ : state) {
+    party->Spawn([]() -> Poll<int> { return 42; },
+                 [](int x) { benchmark::DoNotOptimize(x); });
+  }
+}
+BENCHMARK(BM_PartySpawn);
+
+void BM_PartyWakeup(benchmark::State& state) {
+  auto party = MakeOrphanable<BenchParty>();
+  WakeupSlot slot;
+  slot.Spawn(party.get());
+  for (auto _ : state) {
+    slot.TryWakeup();
+  }
+  slot.Finish();
+}
+BENCHMARK(BM_PartyWakeup);
+
+// Two participants woken from two threads, so that wakeups keep finding the
+// party running on the other thread.
+void BM_PartyCrossThreadWakeup(benchmark::State& state) {
+  auto party = MakeOrphanable<BenchParty>();
+  WakeupSlot local;
+  WakeupSlot remote;
+  local.Spawn(party.get());
+  remote.Spawn(party.get());
+  std::atomic<bool> stop{false};
+  std::thread remote_thread([&]() {
+    while (!stop.load(std::memory_order_relaxed)) {
+      remote.TryWakeup();
+    }
+  });
+  for (auto _ : state) {
+    while (!local.TryWakeup()) {
+    }
+  }
+  stop.store(true, std::memory_order_relaxed);
+  remote_thread.join();
+  state.counters["remote_polls"] = benchmark::Counter(
+      static_cast<double>(remote.polls()), benchmark::Counter::kIsRate);
+  local.Finish();
+  remote.Finish();
+}
+BENCHMARK(BM_PartyCrossThreadWakeup)->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,242 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark promise combinators and the synchronization primitives built on
+// them. Sequences are in bm_seq, parties in bm_party.
+
+#include <stdlib.h>
+
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/status/status.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/memory_allocator.h>
+
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/join.h"
+#include "src/core/lib/promise/latch.h"
+#include "src/core/lib/promise/observable.h"
+#include "src/core/lib/promise/pipe.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/promise/race.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+auto Ready(int* p) {
+  return [p]() -> Poll<int> { return *p; };
+}
+
+auto Never() {
+  return []() -> Poll<int> { return Pending{}; };
+}
+
+// Every wakeup in these benchmarks happens while the activity runs, so
+// nothing should ever be scheduled.
+struct NoWakeupScheduler {
+  template <typename ActivityType>
+  class BoundScheduler {
+   public:
+    explicit BoundScheduler(NoWakeupScheduler) {}
+    void ScheduleWakeup() { abort(); }
+  };
+};
+
+class AllocatorOwner {
+ protected:
+  MemoryAllocator memory_allocator_ = MemoryAllocator(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("test"));
+};
+
+// Runs the benchmark loop \a body from inside an activity with an arena, as
+// primitives that can block need an activity to take wakers from.
+class InActivity : public AllocatorOwner {
+ public:
+  template <typename Body>
+  void Run(Body body) {
+    auto activity = MakeActivity(
+        [&body]() {
+          return [&body]() -> Poll<absl::Status> {
+            body();
+            return absl::OkStatus();
+          };
+        },
+        NoWakeupScheduler(), [](absl::Status) {},
+        MakeScopedArena(1024, &memory_allocator_));
+  }
+};
+
+void BM_Join2(benchmark::State& state) {
+  int one = 1;
+  for (auto _ : state) {
+    auto join = Join(Ready(&one), Ready(&one));
+    benchmark::DoNotOptimize(join());
+  }
+}
+BENCHMARK(BM_Join2);
+
+void BM_Join4(benchmark::State& state) {
+  int one = 1;
+  for (auto _ : state) {
+    auto join = Join(Ready(&one), Ready(&one), Ready(&one), Ready(&one));
+    benchmark::DoNotOptimize(join());
+  }
+}
+BENCHMARK(BM_Join4);
+
+// The first promise to finish wins, so the cost depends on how many are
+// polled first.
+void BM_RaceFirstReady(benchmark::State& state) {
+  int one = 1;
+  for (auto _ : state) {
+    auto race = Race(Ready(&one), Never());
+    benchmark::DoNotOptimize(race());
+  }
+}
+BENCHMARK(BM_RaceFirstReady);
+
+void BM_RaceLastReady(benchmark::State& state) {
+  int one = 1;
+  for (auto _ : state) {
+    auto race = Race(Never(), Never(), Never(), Ready(&one));
+    benchmark::DoNotOptimize(race());
+  }
+}
+BENCHMARK(BM_RaceLastReady);
+
+// Promises up to a pointer in size are stored inline in the ArenaPromise,
+// larger ones in the arena.
+template <bool kLarge>
+void BM_ArenaPromiseCreate(benchmark::State& state) {
+  MemoryAllocator memory_allocator = MemoryAllocator(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("test"));
+  Arena* arena = Arena::Create(1024, &memory_allocator);
+  int one = 1;
+  for (auto _ : state) {
+    {
+      promise_detail::Context<Arena> context(arena);
+      if (kLarge) {
+        int* a = &one;
+        int* b = &one;
+        ArenaPromise<int> promise(
+            [a, b]() -> Poll<int> { return *a + *b; });
+        benchmark::DoNotOptimize(promise());
+      } else {
+        ArenaPromise<int> promise(Ready(&one));
+        benchmark::DoNotOptimize(promise());
+      }
+    }
+    // Periodically recreate the arena to bound its growth.
+    if (state.iterations() % 1024 == 0) {
+      arena->Destroy();
+      arena = Arena::Create(1024, &memory_allocator);
+    }
+  }
+  arena->Destroy();
+}
+BENCHMARK_TEMPLATE(BM_ArenaPromiseCreate, false);
+BENCHMARK_TEMPLATE(BM_ArenaPromiseCreate, true);
+
+// A latch that is already set when waited on.
+void BM_LatchSetThenWait(benchmark::State& state) {
+  InActivity().Run([&state]() {
+    for (auto _ : state) {
+      Latch<int> latch;
+      latch.Set(42);
+      auto wait = latch.Wait();
+      benchmark::DoNotOptimize(wait());
+    }
+  });
+}
+BENCHMARK(BM_LatchSetThenWait);
+
+// A waiter that blocks, is woken by Set(), and polls again.
+void BM_LatchWaitThenSet(benchmark::State& state) {
+  InActivity().Run([&state]() {
+    for (auto _ : state) {
+      Latch<int> latch;
+      auto wait = latch.Wait();
+      GPR_ASSERT(absl::holds_alternative<Pending>(wait()));
+      latch.Set(42);
+      benchmark::DoNotOptimize(wait());
+    }
+  });
+}
+BENCHMARK(BM_LatchWaitThenSet);
+
+// An observer waiting for the next value is woken by every Push().
+void BM_ObservablePushNext(benchmark::State& state) {
+  InActivity().Run([&state]() {
+    Observable<int> observable;
+    auto observer = observable.MakeObserver();
+    int i = 0;
+    for (auto _ : state) {
+      auto next = observer.Next();
+      GPR_ASSERT(absl::holds_alternative<Pending>(next()));
+      observable.Push(++i);
+      benchmark::DoNotOptimize(next());
+    }
+  });
+}
+BENCHMARK(BM_ObservablePushNext);
+
+// One message through a pipe: the push blocks until the receiver has taken
+// the message and dropped it.
+void BM_PipePushNext(benchmark::State& state) {
+  InActivity().Run([&state]() {
+    Pipe<int> pipe;
+    int i = 0;
+    for (auto _ : state) {
+      auto push = pipe.sender.Push(++i);
+      auto next = pipe.receiver.Next();
+      GPR_ASSERT(absl::holds_alternative<Pending>(push()));
+      {
+        auto result = next();
+        GPR_ASSERT(!absl::holds_alternative<Pending>(result));
+        benchmark::DoNotOptimize(result);
+      }
+      GPR_ASSERT(!absl::holds_alternative<Pending>(push()));
+    }
+    state.SetItemsProcessed(state.iterations());
+  });
+}
+BENCHMARK(BM_PipePushNext);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,158 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Benchmark the per-RPC cost of RBAC authorization as the number of paths
+// and principals in a policy grows.
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/grpc_security_constants.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/matchers/matchers.h"
+#include "src/core/lib/security/authorization/evaluate_args.h"
+#include "src/core/lib/security/authorization/grpc_authorization_engine.h"
+#include "src/core/lib/security/authorization/matchers.h"
+#include "src/core/lib/security/authorization/rbac_policy.h"
+#include "test/core/util/evaluate_args_test_util.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+std::string PathForIndex(int i) {
+  return absl::StrCat("/pkg.Service", i, "/Method");
+}
+
+std::string PrincipalForIndex(int i) {
+  return absl::StrCat("spiffe://example.com/ns/default/sa/client", i);
+}
+
+Rbac::Policy MakePolicy(int num_rules) {
+  std::vector<std::unique_ptr<Rbac::Permission>> permissions;
+  std::vector<std::unique_ptr<Rbac::Principal>> principals;
+  for (int i = 0; i < num_rules; ++i) {
+    permissions.push_back(
+        std::make_unique<Rbac::Permission>(Rbac::Permission::MakePathPermission(
+            StringMatcher::Create(StringMatcher::Type::kExact, PathForIndex(i))
+                .value())));
+    principals.push_back(std::make_unique<Rbac::Principal>(
+        Rbac::Principal::MakeAuthenticatedPrincipal(
+            StringMatcher::Create(StringMatcher::Type::kExact,
+                                  PrincipalForIndex(i))
+                .value())));
+  }
+  return Rbac::Policy(
+      Rbac::Permission::MakeOrPermission(std::move(permissions)),
+      Rbac::Principal::MakeOrPrincipal(std::move(principals)));
+}
+
+// Builds the matcher tree one matcher per rule, the way
+// AuthorizationMatcher::Create() used to, for comparison.
+std::unique_ptr<AuthorizationMatcher> MakeInterpretedMatcher(int num_rules) {
+  std::vector<std::unique_ptr<AuthorizationMatcher>> paths;
+  std::vector<std::unique_ptr<AuthorizationMatcher>> names;
+  for (int i = 0; i < num_rules; ++i) {
+    paths.push_back(std::make_unique<PathAuthorizationMatcher>(
+        StringMatcher::Create(StringMatcher::Type::kExact, PathForIndex(i))
+            .value()));
+    names.push_back(std::make_unique<AuthenticatedAuthorizationMatcher>(
+        StringMatcher::Create(StringMatcher::Type::kExact,
+                              PrincipalForIndex(i))
+            .value()));
+  }
+  std::vector<std::unique_ptr<AuthorizationMatcher>> matchers;
+  matchers.push_back(
+      std::make_unique<OrAuthorizationMatcher>(std::move(paths)));
+  matchers.push_back(
+      std::make_unique<OrAuthorizationMatcher>(std::move(names)));
+  return std::make_unique<AndAuthorizationMatcher>(std::move(matchers));
+}
+
+// The request matches the last rule, which is the worst case for checking
+// the rules one by one.
+class Request {
+ public:
+  explicit Request(int num_rules)
+      : path_(PathForIndex(num_rules - 1)),
+        principal_(PrincipalForIndex(num_rules - 1)) {
+    util_.AddPairToMetadata(":path", path_.c_str());
+    util_.AddPropertyToAuthContext(GRPC_TRANSPORT_SECURITY_TYPE_PROPERTY_NAME,
+                                   GRPC_TLS_TRANSPORT_SECURITY_TYPE);
+    util_.AddPropertyToAuthContext(GRPC_PEER_URI_PROPERTY_NAME,
+                                   principal_.c_str());
+  }
+
+  EvaluateArgs MakeEvaluateArgs() { return util_.MakeEvaluateArgs(); }
+
+ private:
+  const std::string path_;
+  const std::string principal_;
+  EvaluateArgsTestUtil util_;
+};
+
+void BM_RbacInterpreted(benchmark::State& state) {
+  const int num_rules = state.range(0);
+  auto matcher = MakeInterpretedMatcher(num_rules);
+  Request request(num_rules);
+  EvaluateArgs args = request.MakeEvaluateArgs();
+  for (auto _ : state) {
+    bool matches = matcher->Matches(args);
+    GPR_ASSERT(matches);
+    benchmark::DoNotOptimize(matches);
+  }
+}
+BENCHMARK(BM_RbacInterpreted)->RangeMultiplier(4)->Range(1, 1024);
+
+void BM_RbacEngine(benchmark::State& state) {
+  const int num_rules = state.range(0);
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy"] = MakePolicy(num_rules);
+  GrpcAuthorizationEngine engine(
+      Rbac(Rbac::Action::kAllow, std::move(policies)));
+  Request request(num_rules);
+  EvaluateArgs args = request.MakeEvaluateArgs();
+  for (auto _ : state) {
+    auto decision = engine.Evaluate(args);
+    GPR_ASSERT(decision.type == AuthorizationEngine::Decision::Type::kAllow);
+    benchmark::DoNotOptimize(decision);
+  }
+}
+BENCHMARK(BM_RbacEngine)->RangeMultiplier(4)->Range(1, 1024);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
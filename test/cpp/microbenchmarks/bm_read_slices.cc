@@ -0,0 +1,108 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark allocating endpoint read slices, with many connections each
+// holding a read buffer until the transport parses it.
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/event_engine/memory_request.h>
+#include <grpc/slice.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice_pool.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// The sizes endpoints allocate reads in.
+constexpr size_t kSmallRead = 8 * 1024;
+constexpr size_t kBigRead = 64 * 1024;
+
+struct MakeSlice {
+  static grpc_slice Read(size_t length, MemoryOwner* owner) {
+    return owner->MakeSlice(
+        grpc_event_engine::experimental::MemoryRequest(length));
+  }
+};
+
+struct PooledSlice {
+  static grpc_slice Read(size_t length, MemoryOwner* owner) {
+    return PooledSliceMalloc(length, owner);
+  }
+};
+
+// Each connection has one read buffer in flight: reading into a connection
+// releases the buffer it read into last time, as the parser would.
+template <typename Allocate>
+void BM_ReadSlices(benchmark::State& state) {
+  const size_t connections = state.range(0);
+  const size_t length = state.range(1);
+  ExecCtx exec_ctx;
+  std::vector<std::unique_ptr<MemoryOwner>> owners;
+  std::vector<grpc_slice> in_flight;
+  for (size_t i = 0; i < connections; ++i) {
+    owners.push_back(std::make_unique<MemoryOwner>(
+        ResourceQuota::Default()->memory_quota()->CreateMemoryOwner("bench")));
+    in_flight.push_back(Allocate::Read(length, owners.back().get()));
+  }
+  size_t next = 0;
+  for (auto _ : state) {
+    grpc_slice_unref(in_flight[next]);
+    in_flight[next] = Allocate::Read(length, owners[next].get());
+    // Touch the buffer, as the kernel would when copying the read into it.
+    GRPC_SLICE_START_PTR(in_flight[next])[0] = 0;
+    if (++next == connections) next = 0;
+  }
+  for (grpc_slice& slice : in_flight) grpc_slice_unref(slice);
+  state.SetBytesProcessed(state.iterations() * length);
+}
+
+void ReadArgs(benchmark::internal::Benchmark* b) {
+  for (int64_t connections : {1, 64, 1024, 16384}) {
+    b->Args({connections, kSmallRead});
+  }
+  for (int64_t connections : {1, 64, 1024}) {
+    b->Args({connections, kBigRead});
+  }
+}
+BENCHMARK_TEMPLATE(BM_ReadSlices, MakeSlice)->Apply(ReadArgs);
+BENCHMARK_TEMPLATE(BM_ReadSlices, PooledSlice)->Apply(ReadArgs);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,79 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using grpc_core::kUnrefDelete;
+using grpc_core::NonAtomicRefCount;
+using grpc_core::PolymorphicRefCount;
+using grpc_core::RefCount;
+using grpc_core::RefCounted;
+using grpc_core::RefCountedPtr;
+
+template <typename RefCountType>
+class Foo : public RefCounted<Foo<RefCountType>, PolymorphicRefCount,
+                              kUnrefDelete, RefCountType> {};
+
+// A ref taken and dropped, as when a callback holds its object alive.
+template <typename RefCountType>
+void BM_RefUnref(benchmark::State& state) {
+  RefCountedPtr<Foo<RefCountType>> foo =
+      grpc_core::MakeRefCounted<Foo<RefCountType>>();
+  for (auto _ : state) {
+    RefCountedPtr<Foo<RefCountType>> ref = foo->Ref();
+    benchmark::DoNotOptimize(ref.get());
+  }
+}
+BENCHMARK_TEMPLATE(BM_RefUnref, RefCount);
+BENCHMARK_TEMPLATE(BM_RefUnref, NonAtomicRefCount);
+
+// An object created, reffed range(0) more times and then released, as for
+// a per-call object handed to each of a call's callbacks.
+template <typename RefCountType>
+void BM_Lifetime(benchmark::State& state) {
+  const int refs = state.range(0);
+  for (auto _ : state) {
+    auto* foo = new Foo<RefCountType>();
+    for (int i = 0; i < refs; ++i) foo->Ref().release();
+    for (int i = 0; i <= refs; ++i) foo->Unref();
+  }
+}
+BENCHMARK_TEMPLATE(BM_Lifetime, RefCount)->Arg(0)->Arg(4);
+BENCHMARK_TEMPLATE(BM_Lifetime, NonAtomicRefCount)->Arg(0)->Arg(4);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,163 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark sequence combinators, and report the size of the promises they
+// build.
+
+#include <benchmark/benchmark.h>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+#include <grpc/event_engine/memory_allocator.h>
+
+#include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/promise/try_seq.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// Each step keeps a pointer in its factory, as filters usually do for their
+// call data, and produces a promise holding a value.
+auto Step(int* p) {
+  return [p](int x) { return [p, x]() -> Poll<int> { return x + *p; }; };
+}
+
+auto TryStep(int* p) {
+  return [p](int x) {
+    return [p, x]() -> Poll<absl::StatusOr<int>> { return x + *p; };
+  };
+}
+
+auto First(int* p) {
+  return [p]() -> Poll<int> { return *p; };
+}
+
+auto TryFirst(int* p) {
+  return [p]() -> Poll<absl::StatusOr<int>> { return *p; };
+}
+
+template <int kSteps>
+struct MakeSeq;
+
+template <>
+struct MakeSeq<2> {
+  static auto Make(int* p) { return Seq(First(p), Step(p)); }
+  static auto MakeTry(int* p) { return TrySeq(TryFirst(p), TryStep(p)); }
+};
+
+template <>
+struct MakeSeq<4> {
+  static auto Make(int* p) {
+    return Seq(First(p), Step(p), Step(p), Step(p));
+  }
+  static auto MakeTry(int* p) {
+    return TrySeq(TryFirst(p), TryStep(p), TryStep(p), TryStep(p));
+  }
+};
+
+template <>
+struct MakeSeq<8> {
+  static auto Make(int* p) {
+    return Seq(First(p), Step(p), Step(p), Step(p), Step(p), Step(p), Step(p),
+               Step(p));
+  }
+  static auto MakeTry(int* p) {
+    return TrySeq(TryFirst(p), TryStep(p), TryStep(p), TryStep(p), TryStep(p),
+                  TryStep(p), TryStep(p), TryStep(p));
+  }
+};
+
+template <int kSteps>
+void BM_Seq(benchmark::State& state) {
+  int one = 1;
+  for (auto _ : state) {
+    auto seq = MakeSeq<kSteps>::Make(&one);
+    benchmark::DoNotOptimize(seq());
+  }
+  state.counters["bytes"] =
+      sizeof(decltype(MakeSeq<kSteps>::Make(static_cast<int*>(nullptr))));
+}
+BENCHMARK_TEMPLATE(BM_Seq, 2);
+BENCHMARK_TEMPLATE(BM_Seq, 4);
+BENCHMARK_TEMPLATE(BM_Seq, 8);
+
+template <int kSteps>
+void BM_TrySeq(benchmark::State& state) {
+  int one = 1;
+  for (auto _ : state) {
+    auto seq = MakeSeq<kSteps>::MakeTry(&one);
+    benchmark::DoNotOptimize(seq());
+  }
+  state.counters["bytes"] =
+      sizeof(decltype(MakeSeq<kSteps>::MakeTry(static_cast<int*>(nullptr))));
+}
+BENCHMARK_TEMPLATE(BM_TrySeq, 2);
+BENCHMARK_TEMPLATE(BM_TrySeq, 4);
+BENCHMARK_TEMPLATE(BM_TrySeq, 8);
+
+// As filters see them: type erased into an ArenaPromise, which places the
+// sequence in the call arena.
+template <int kSteps>
+void BM_ArenaPromiseTrySeq(benchmark::State& state) {
+  MemoryAllocator memory_allocator = MemoryAllocator(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("test"));
+  Arena* arena = Arena::Create(1024, &memory_allocator);
+  int one = 1;
+  for (auto _ : state) {
+    {
+      promise_detail::Context<Arena> context(arena);
+      ArenaPromise<absl::StatusOr<int>> promise(
+          MakeSeq<kSteps>::MakeTry(&one));
+      benchmark::DoNotOptimize(promise());
+    }
+    // Periodically recreate the arena to bound its growth.
+    if (state.iterations() % 1024 == 0) {
+      arena->Destroy();
+      arena = Arena::Create(1024, &memory_allocator);
+    }
+  }
+  arena->Destroy();
+  state.counters["bytes"] =
+      sizeof(decltype(MakeSeq<kSteps>::MakeTry(static_cast<int*>(nullptr))));
+}
+BENCHMARK_TEMPLATE(BM_ArenaPromiseTrySeq, 2);
+BENCHMARK_TEMPLATE(BM_ArenaPromiseTrySeq, 4);
+BENCHMARK_TEMPLATE(BM_ArenaPromiseTrySeq, 8);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,90 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark the cold start of the library, up to the first channel.
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+
+#include "src/core/lib/config/core_configuration.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// Runs every plugin registration, as the first channel or server after
+// process start does.
+void BM_BuildCoreConfiguration(benchmark::State& state) {
+  for (auto _ : state) {
+    CoreConfiguration::Reset();
+    benchmark::DoNotOptimize(&CoreConfiguration::Get());
+  }
+}
+BENCHMARK(BM_BuildCoreConfiguration);
+
+// Then looks up a policy whose factory is only constructed on first use.
+void BM_BuildCoreConfigurationAndLookupLazyPolicy(benchmark::State& state) {
+  for (auto _ : state) {
+    CoreConfiguration::Reset();
+    benchmark::DoNotOptimize(
+        CoreConfiguration::Get().lb_policy_registry().LoadBalancingPolicyExists(
+            "grpclb", nullptr));
+  }
+}
+BENCHMARK(BM_BuildCoreConfigurationAndLookupLazyPolicy);
+
+void BM_InitShutdown(benchmark::State& state) {
+  for (auto _ : state) {
+    grpc_init();
+    grpc_shutdown_blocking();
+  }
+}
+BENCHMARK(BM_InitShutdown);
+
+// Everything from a fresh configuration to a created (not yet connected)
+// channel.
+void BM_InitToFirstChannel(benchmark::State& state) {
+  for (auto _ : state) {
+    CoreConfiguration::Reset();
+    grpc_init();
+    grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+    grpc_channel* channel =
+        grpc_channel_create("dns:///localhost:1234", creds, nullptr);
+    grpc_channel_destroy(channel);
+    grpc_channel_credentials_release(creds);
+    grpc_shutdown_blocking();
+  }
+}
+BENCHMARK(BM_InitToFirstChannel);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
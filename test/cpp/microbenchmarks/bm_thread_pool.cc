@@ -174,6 +174,32 @@ void BM_ThreadPool_Lambda_FanOut(benchmark::State& state) {
 }
 BENCHMARK(BM_ThreadPool_Lambda_FanOut)->Apply(FanoutTestArguments);
 
+// Each benchmark thread schedules its own fan-out tree against one shared pool.
+// As the number of scheduling threads grows towards the number of cores, this
+// shows how well the pool's queues cope with concurrent producers.
+void BM_ThreadPool_Lambda_FanOut_Concurrent(benchmark::State& state) {
+  // Shared by all benchmark threads and all runs. It is intentionally leaked:
+  // callbacks may still be unwinding on pool threads when a run finishes.
+  static std::shared_ptr<ThreadPool>* pool =
+      new std::shared_ptr<ThreadPool>(std::make_shared<ThreadPool>());
+  auto params = GetFanoutParameters(state);
+  for (auto _ : state) {
+    std::atomic_int count{0};
+    grpc_core::Notification signal;
+    FanOutCallback(*pool, params, signal, count, /*processing_layer=*/0);
+    do {
+      signal.WaitForNotification();
+    } while (count.load() != params.limit);
+  }
+  state.SetItemsProcessed(params.limit * state.iterations());
+}
+BENCHMARK(BM_ThreadPool_Lambda_FanOut_Concurrent)
+    ->Args({2, 70})  // depth 2, fans out 4971
+    ->Args({4, 8})   // depth 4, fans out 4681
+    ->ThreadRange(1, 64)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+
 void ClosureFanOutCallback(EventEngine::Closure* child_closure,
                            std::shared_ptr<ThreadPool> pool,
                            grpc_core::Notification** signal_holder,
@@ -0,0 +1,77 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmark the clock reads that every call makes.
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/support/time.h>
+
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+void BM_GprNowMonotonic(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(gpr_now(GPR_CLOCK_MONOTONIC));
+  }
+}
+BENCHMARK(BM_GprNowMonotonic);
+
+void BM_TimestampNow(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grpc_core::Timestamp::Now());
+  }
+}
+BENCHMARK(BM_TimestampNow);
+
+// An ExecCtx caches the time, but the cache is invalidated as closures run,
+// so a call still reads the clock a few times.
+void BM_ExecCtxNowAfterInvalidate(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    exec_ctx.InvalidateNow();
+    benchmark::DoNotOptimize(exec_ctx.Now());
+  }
+}
+BENCHMARK(BM_ExecCtxNowAfterInvalidate);
+
+void BM_TimestampNowMultiThreaded(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grpc_core::Timestamp::Now());
+  }
+}
+BENCHMARK(BM_TimestampNowMultiThreaded)->ThreadRange(1, 16);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,102 @@
+// Copyright 2023 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include <benchmark/benchmark.h>
+
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/work_serializer.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using grpc_core::WorkSerializer;
+
+WorkSerializer* g_work_serializer;
+// Only touched from callbacks, which the WorkSerializer serializes.
+int64_t g_callbacks_run;
+
+void GlobalSetup(const benchmark::State& /*state*/) {
+  g_work_serializer = new WorkSerializer();
+  g_callbacks_run = 0;
+}
+
+void GlobalTeardown(const benchmark::State& /*state*/) {
+  delete g_work_serializer;
+}
+
+// One thread running callbacks on an idle WorkSerializer.
+void BM_WorkSerializerRunUncontended(benchmark::State& state) {
+  WorkSerializer work_serializer;
+  int64_t callbacks_run = 0;
+  for (auto _ : state) {
+    work_serializer.Run([&callbacks_run]() { ++callbacks_run; },
+                        DEBUG_LOCATION);
+  }
+  benchmark::DoNotOptimize(callbacks_run);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_WorkSerializerRunUncontended);
+
+// Many threads running callbacks on the same WorkSerializer, so that most
+// callbacks are queued and run by whichever thread holds it.
+void BM_WorkSerializerRunContended(benchmark::State& state) {
+  for (auto _ : state) {
+    g_work_serializer->Run([]() { ++g_callbacks_run; }, DEBUG_LOCATION);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_WorkSerializerRunContended)
+    ->Setup(GlobalSetup)
+    ->Teardown(GlobalTeardown)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+// Callbacks scheduled in batches of range(0) and then drained.
+void BM_WorkSerializerScheduleAndDrain(benchmark::State& state) {
+  WorkSerializer work_serializer;
+  const int batch_size = state.range(0);
+  int64_t callbacks_run = 0;
+  for (auto _ : state) {
+    for (int i = 0; i < batch_size; ++i) {
+      work_serializer.Schedule([&callbacks_run]() { ++callbacks_run; },
+                               DEBUG_LOCATION);
+    }
+    work_serializer.DrainQueue();
+  }
+  benchmark::DoNotOptimize(callbacks_run);
+  state.SetItemsProcessed(state.iterations() * batch_size);
+}
+BENCHMARK(BM_WorkSerializerScheduleAndDrain)->Range(1, 256);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -121,6 +121,19 @@ class ClientRequestCreator<ByteBuffer> {
   }
 };
 
+// Returns the UsageTimer::Now() time at which a request due at \a issue_time
+// (on GPR_CLOCK_MONOTONIC) was meant to be sent. Open loop latencies are
+// measured from there rather than from when the request actually went out, so
+// that requests held back behind slow ones count the time they waited instead
+// of hiding it (coordinated omission).
+inline double IntendedStartTime(gpr_timespec issue_time) {
+  const gpr_timespec behind =
+      gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), issue_time);
+  const double now = UsageTimer::Now();
+  if (gpr_time_cmp(behind, gpr_time_0(GPR_TIMESPAN)) <= 0) return now;
+  return now - gpr_timespec_to_micros(behind) * 1e-6;
+}
+
 class HistogramEntry final {
  public:
   HistogramEntry() : value_used_(false), status_used_(false) {}
@@ -56,6 +56,7 @@ class SynchronousClient
     num_threads_ =
         config.outstanding_rpcs_per_channel() * config.client_channels();
     responses_.resize(num_threads_);
+    issue_times_.resize(num_threads_);
     SetupLoadTest(config, num_threads_);
   }
 
@@ -84,6 +85,7 @@ class SynchronousClient
   bool WaitToIssue(int thread_idx) {
     if (!closed_loop_) {
       const gpr_timespec next_issue_time = NextIssueTime(thread_idx);
+      issue_times_[thread_idx] = next_issue_time;
       // Avoid sleeping for too long continuously because we might
       // need to terminate before then. This is an issue since
       // exponential distribution can occasionally produce bad outliers
@@ -105,8 +107,15 @@ class SynchronousClient
     return true;
   }
 
+  // Start time of the request the last WaitToIssue() was for.
+  double IssueStartTime(int thread_idx) {
+    return closed_loop_ ? UsageTimer::Now()
+                        : IntendedStartTime(issue_times_[thread_idx]);
+  }
+
   size_t num_threads_;
   std::vector<SimpleResponse> responses_;
+  std::vector<gpr_timespec> issue_times_;
 };
 
 class SynchronousUnaryClient final : public SynchronousClient {
@@ -124,7 +133,7 @@ class SynchronousUnaryClient final : public SynchronousClient {
       return true;
     }
     auto* stub = channels_[thread_idx % channels_.size()].get_stub();
-    double start = UsageTimer::Now();
+    double start = IssueStartTime(thread_idx);
     grpc::ClientContext context;
     grpc::Status s =
         stub->UnaryCall(&context, request_, &responses_[thread_idx]);
@@ -242,7 +251,7 @@ class SynchronousStreamingPingPongClient final
     if (!WaitToIssue(thread_idx)) {
       return true;
     }
-    double start = UsageTimer::Now();
+    double start = IssueStartTime(thread_idx);
     if (stream_[thread_idx]->Write(request_) &&
         stream_[thread_idx]->Read(&responses_[thread_idx])) {
       entry->set_value((UsageTimer::Now() - start) * 1e9);
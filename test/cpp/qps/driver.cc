@@ -141,6 +141,8 @@ static void postprocess_scenario_result(ScenarioResult* result) {
   result->mutable_summary()->set_latency_95(histogram.Percentile(95));
   result->mutable_summary()->set_latency_99(histogram.Percentile(99));
   result->mutable_summary()->set_latency_999(histogram.Percentile(99.9));
+  result->mutable_summary()->set_latency_9999(histogram.Percentile(99.99));
+  result->mutable_summary()->set_latency_99999(histogram.Percentile(99.999));
 
   // Calculate qps and cpu load for each client and then aggregate results for
   // all clients
@@ -20,8 +20,13 @@
 #include <iostream>
 #include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "absl/flags/flag.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
 
 #include <grpc/support/log.h>
 #include <grpcpp/impl/codegen/config_protobuf.h>
@@ -58,6 +63,10 @@ ABSL_FLAG(double, error_tolerance, 0.01,
           "Defines threshold for stopping the search. When current search "
           "range is narrower than the error_tolerance computed range, we "
           "stop the search.");
+ABSL_FLAG(std::vector<std::string>, offered_load_sweep, {},
+          "Comma separated list of offered loads (in QPS) to run each "
+          "scenario at, in open loop with Poisson interarrival, reporting "
+          "tail latency against offered load. Not used with --search_param.");
 
 ABSL_FLAG(std::string, qps_server_target_override, "",
           "Override QPS server target to configure in client configs."
@@ -227,6 +236,40 @@ static double SearchOfferedLoad(
   return targeted_offered_load;
 }
 
+// Runs \a scenario once per offered load of --offered_load_sweep, and logs
+// how its latency percentiles grow with the load.
+static void SweepOfferedLoad(
+    Scenario* scenario,
+    const std::map<std::string, std::string>& per_worker_credential_types,
+    bool* success) {
+  std::vector<std::string> sweep_report;
+  for (const std::string& load : absl::GetFlag(FLAGS_offered_load_sweep)) {
+    double offered_load;
+    if (!absl::SimpleAtod(load, &offered_load) || offered_load <= 0) {
+      grpc_core::Crash(absl::StrCat("Invalid offered load in sweep: ", load));
+    }
+    scenario->mutable_client_config()
+        ->mutable_load_params()
+        ->mutable_poisson()
+        ->set_offered_load(offered_load);
+    auto result = RunAndReport(*scenario, per_worker_credential_types, success);
+    const ScenarioResultSummary& summary = result->summary();
+    sweep_report.push_back(absl::StrFormat(
+        "%12.0f %12.1f %10.1f %10.1f %10.1f %10.1f %10.1f", offered_load,
+        summary.qps(), summary.latency_50() / 1000,
+        summary.latency_99() / 1000, summary.latency_999() / 1000,
+        summary.latency_9999() / 1000, summary.latency_99999() / 1000));
+    if (!*success) break;
+  }
+  gpr_log(GPR_INFO, "Latency (us) vs offered load for %s:",
+          scenario->name().c_str());
+  gpr_log(GPR_INFO, "%12s %12s %10s %10s %10s %10s %10s", "offered_load",
+          "qps", "p50", "p99", "p99.9", "p99.99", "p99.999");
+  for (const std::string& line : sweep_report) {
+    gpr_log(GPR_INFO, "%s", line.c_str());
+  }
+}
+
 static bool QpsDriver() {
   std::string json;
 
@@ -270,6 +313,11 @@ static bool QpsDriver() {
 
   for (int i = 0; i < scenarios.scenarios_size(); i++) {
     if (absl::GetFlag(FLAGS_search_param).empty()) {
+      if (!absl::GetFlag(FLAGS_offered_load_sweep).empty()) {
+        SweepOfferedLoad(scenarios.mutable_scenarios(i),
+                         per_worker_credential_types, &success);
+        continue;
+      }
       const Scenario& scenario = scenarios.scenarios(i);
       RunAndReport(scenario, per_worker_credential_types, &success);
     } else {
@@ -95,12 +95,15 @@ void GprLogReporter::ReportQPSPerCore(const ScenarioResult& result) {
 
 void GprLogReporter::ReportLatency(const ScenarioResult& result) {
   gpr_log(GPR_INFO,
-          "Latencies (50/90/95/99/99.9%%-ile): %.1f/%.1f/%.1f/%.1f/%.1f us",
+          "Latencies (50/90/95/99/99.9/99.99/99.999%%-ile): "
+          "%.1f/%.1f/%.1f/%.1f/%.1f/%.1f/%.1f us",
           result.summary().latency_50() / 1000,
           result.summary().latency_90() / 1000,
           result.summary().latency_95() / 1000,
           result.summary().latency_99() / 1000,
-          result.summary().latency_999() / 1000);
+          result.summary().latency_999() / 1000,
+          result.summary().latency_9999() / 1000,
+          result.summary().latency_99999() / 1000);
 }
 
 void GprLogReporter::ReportTimes(const ScenarioResult& result) {
@@ -58,13 +58,17 @@ struct TestThreadManagerSettings {
 
   // How many should be instantiated
   int thread_manager_count;
+
+  // The max number of handler threads, or 0 if pollers do the work
+  int max_handlers;
 };
 
 class TestThreadManager final : public grpc::ThreadManager {
  public:
   TestThreadManager(const char* name, grpc_resource_quota* rq,
                     const TestThreadManagerSettings& settings)
-      : ThreadManager(name, rq, settings.min_pollers, settings.max_pollers),
+      : ThreadManager(name, rq, settings.min_pollers, settings.max_pollers,
+                      settings.max_handlers),
         settings_(settings),
         num_do_work_(0),
         num_poll_for_work_(0),
@@ -152,10 +156,18 @@ class ThreadManagerTest
 TestThreadManagerSettings scenarios[] = {
     {2 /* min_pollers */, 10 /* max_pollers */, 10 /* poll_duration_ms */,
      1 /* work_duration_ms */, 50 /* max_poll_calls */,
-     INT_MAX /* thread_limit */, 1 /* thread_manager_count */},
+     INT_MAX /* thread_limit */, 1 /* thread_manager_count */,
+     0 /* max_handlers */},
     {1 /* min_pollers */, 1 /* max_pollers */, 1 /* poll_duration_ms */,
      10 /* work_duration_ms */, 50 /* max_poll_calls */, 3 /* thread_limit */,
-     2 /* thread_manager_count */}};
+     2 /* thread_manager_count */, 0 /* max_handlers */},
+    {2 /* min_pollers */, 2 /* max_pollers */, 1 /* poll_duration_ms */,
+     10 /* work_duration_ms */, 200 /* max_poll_calls */,
+     INT_MAX /* thread_limit */, 1 /* thread_manager_count */,
+     8 /* max_handlers */},
+    {1 /* min_pollers */, 1 /* max_pollers */, 1 /* poll_duration_ms */,
+     10 /* work_duration_ms */, 100 /* max_poll_calls */, 3 /* thread_limit */,
+     1 /* thread_manager_count */, 8 /* max_handlers */}};
 
 INSTANTIATE_TEST_SUITE_P(ThreadManagerTest, ThreadManagerTest,
                          ::testing::ValuesIn(scenarios));
@@ -179,6 +191,18 @@ TEST_P(ThreadManagerTest, TestThreadQuota) {
   }
 }
 
+TEST_P(ThreadManagerTest, TestHandlerThreads) {
+  if (GetParam().max_handlers > 0) {
+    for (auto& tm : thread_manager_) {
+      // Work takes longer than polling, so queued work waits for the first
+      // handler, and more handlers are added up to the limits.
+      EXPECT_GT(tm->GetMaxActiveThreadsSoFar(), GetParam().min_pollers + 1);
+      EXPECT_LE(tm->GetMaxActiveThreadsSoFar(),
+                GetParam().min_pollers + GetParam().max_handlers);
+    }
+  }
+}
+
 }  // namespace
 }  // namespace grpc
 
@@ -17,6 +17,7 @@
 //
 
 #include <cstring>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -50,6 +51,24 @@ TEST_F(ByteBufferTest, CopyCtor) {
   EXPECT_FALSE(buffer2.Valid());
 }
 
+TEST_F(ByteBufferTest, MoveCtor) {
+  Slice s(kContent1);
+  ByteBuffer buffer1(&s, 1);
+  ByteBuffer buffer2(std::move(buffer1));
+  EXPECT_FALSE(buffer1.Valid());
+  EXPECT_EQ(strlen(kContent1), buffer2.Length());
+}
+
+TEST_F(ByteBufferTest, MoveAssignment) {
+  Slice s1(kContent1);
+  Slice s2(kContent2);
+  ByteBuffer buffer1(&s1, 1);
+  ByteBuffer buffer2(&s2, 1);
+  buffer2 = std::move(buffer1);
+  EXPECT_FALSE(buffer1.Valid());
+  EXPECT_EQ(strlen(kContent1), buffer2.Length());
+}
+
 TEST_F(ByteBufferTest, CreateFromSingleSlice) {
   Slice s(kContent1);
   ByteBuffer buffer(&s, 1);
@@ -160,7 +160,63 @@ _DATA_MEMBERS = [
         setter_move_semantics=True,
         test_name="DifferentCrlDirectory",
         test_value_1="\"crl_directory_1\"",
-        test_value_2="\"crl_directory_2\"")
+        test_value_2="\"crl_directory_2\""),
+    DataMember(
+        name='session_ticket_key_provider',
+        type='grpc_core::RefCountedPtr<grpc_tls_session_ticket_key_provider>',
+        override_getter=
+        """grpc_tls_session_ticket_key_provider* session_ticket_key_provider() const {
+    return session_ticket_key_provider_.get();
+  }""",
+        setter_comment=
+        ' Sets the provider of the keys that the server encrypts and decrypts session tickets with. If not set, the keys are generated by each server handshaker factory and not shared.',
+        setter_move_semantics=True,
+        test_name="DifferentSessionTicketKeyProvider",
+        test_value_1="MakeRefCounted<grpc_tls_session_ticket_key_provider>()",
+        test_value_2="MakeRefCounted<grpc_tls_session_ticket_key_provider>()"),
+    DataMember(
+        name='private_key_signer',
+        type='grpc_core::RefCountedPtr<tsi::SslPrivateKeySigner>',
+        override_getter=
+        """tsi::SslPrivateKeySigner* private_key_signer() const {
+    return private_key_signer_.get();
+  }""",
+        setter_comment=
+        ' Sets the signer that signs the server\'s handshakes, in place of the private keys of its identity key-cert pairs, which may then be empty. Only supported with BoringSSL.',
+        setter_move_semantics=True,
+        test_name="DifferentPrivateKeySigner",
+        test_value_1=
+        "MakeRefCounted<ExternalPrivateKeySigner>(grpc_tls_private_key_signer_external{})",
+        test_value_2=
+        "MakeRefCounted<ExternalPrivateKeySigner>(grpc_tls_private_key_signer_external{})"
+    ),
+    DataMember(
+        name='verified_peer_cache_size',
+        type='size_t',
+        default_initializer='0',
+        setter_comment=
+        ' Sets how many peers that passed the certificate verifier are remembered, so that new connections to them skip it. The default value is 0, which disables the cache. Only used on the client side.',
+        test_name="DifferentVerifiedPeerCacheSize",
+        test_value_1="0",
+        test_value_2="100"),
+    DataMember(
+        name='early_data',
+        type='bool',
+        default_initializer='false',
+        setter_comment=
+        ' Sets whether TLS 1.3 0-RTT early data is sent by clients resuming sessions, and accepted by servers. Early data may be replayed, so clients shall only enable it when all their RPCs are safe to be processed more than once. Only supported with BoringSSL.',
+        test_name="DifferentEarlyData",
+        test_value_1="false",
+        test_value_2="true"),
+    DataMember(
+        name='early_data_anti_replay_capacity',
+        type='size_t',
+        default_initializer='10000',
+        setter_comment=
+        ' Sets how many ClientHellos a server accepting early data remembers, to reject the early data of replayed ones. 0 disables replay detection. Only used on the server side.',
+        test_name="DifferentEarlyDataAntiReplayCapacity",
+        test_value_1="0",
+        test_value_2="100")
 ]
 
 
@@ -229,6 +285,8 @@ print(
 #include "src/core/lib/security/credentials/tls/grpc_tls_certificate_distributor.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_certificate_provider.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_certificate_verifier.h"
+#include "src/core/lib/security/credentials/tls/grpc_tls_private_key_signer.h"
+#include "src/core/lib/security/credentials/tls/grpc_tls_session_ticket_key_provider.h"
 #include "src/core/lib/security/security_connector/ssl_utils.h"
 
 // Contains configurable options specified by callers to configure their certain
@@ -1042,6 +1042,8 @@ include/grpcpp/security/server_credentials.h \
 include/grpcpp/security/tls_certificate_provider.h \
 include/grpcpp/security/tls_certificate_verifier.h \
 include/grpcpp/security/tls_credentials_options.h \
+include/grpcpp/security/tls_private_key_signer.h \
+include/grpcpp/security/tls_session_ticket_key_provider.h \
 include/grpcpp/server.h \
 include/grpcpp/server_builder.h \
 include/grpcpp/server_context.h \
@@ -1053,6 +1055,7 @@ include/grpcpp/support/byte_buffer.h \
 include/grpcpp/support/callback_common.h \
 include/grpcpp/support/channel_arguments.h \
 include/grpcpp/support/client_callback.h \
+include/grpcpp/support/client_coroutine.h \
 include/grpcpp/support/client_interceptor.h \
 include/grpcpp/support/config.h \
 include/grpcpp/support/interceptor.h \
@@ -25,6 +25,15 @@ _AVAILABLE_BENCHMARK_TESTS = [
     'bm_chttp2_hpack',
     'bm_chttp2_transport',
     'bm_pollset',
+    'bm_seq',
+    'bm_party',
+    'bm_mpscq',
+    'bm_adaptive_mutex',
+    'bm_fork',
+    'bm_promise',
+    'bm_ref_counted',
+    'bm_timestamp',
+    'bm_work_serializer',
 ]
 
 _INTERESTING = ('cpu_time', 'real_time', 'locks_per_iteration',